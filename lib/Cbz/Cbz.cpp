@@ -0,0 +1,148 @@
+/**
+ * Cbz.cpp
+ *
+ * CBZ comic archive handling implementation
+ */
+
+#include "Cbz.h"
+
+#include <FsHelpers.h>
+#include <HalStorage.h>
+#include <Logging.h>
+#include <ZipFile.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+namespace {
+constexpr char zipIndexFile[] = "/zip.idx";
+
+// Scanners name pages 1.jpg ... 10.jpg as often as 001.jpg ... 010.jpg: runs of digits compare by value, the rest
+// of the name without case
+bool naturalLess(const std::string& a, const std::string& b) {
+  size_t i = 0;
+  size_t j = 0;
+  while (i < a.size() && j < b.size()) {
+    if (isdigit(static_cast<unsigned char>(a[i])) && isdigit(static_cast<unsigned char>(b[j]))) {
+      // Skip leading zeros, then the longer run is the larger number, or the first digit that differs decides
+      while (i < a.size() && a[i] == '0') i++;
+      while (j < b.size() && b[j] == '0') j++;
+      size_t endA = i;
+      size_t endB = j;
+      while (endA < a.size() && isdigit(static_cast<unsigned char>(a[endA]))) endA++;
+      while (endB < b.size() && isdigit(static_cast<unsigned char>(b[endB]))) endB++;
+      if (endA - i != endB - j) {
+        return endA - i < endB - j;
+      }
+      for (; i < endA; i++, j++) {
+        if (a[i] != b[j]) {
+          return a[i] < b[j];
+        }
+      }
+      continue;
+    }
+    const int ca = tolower(static_cast<unsigned char>(a[i]));
+    const int cb = tolower(static_cast<unsigned char>(b[j]));
+    if (ca != cb) {
+      return ca < cb;
+    }
+    i++;
+    j++;
+  }
+  return a.size() - i < b.size() - j;
+}
+
+// Page images, leaving out directories, hidden files and the resource forks macOS adds to zips
+bool isPageImage(const char* name) {
+  const char* base = strrchr(name, '/');
+  base = base ? base + 1 : name;
+  if (*base == '\0' || *base == '.' || strncmp(name, "__MACOSX/", 9) == 0) {
+    return false;
+  }
+  const std::string_view baseName{base};
+  return FsHelpers::hasJpgExtension(baseName) || FsHelpers::hasPngExtension(baseName);
+}
+}  // namespace
+
+bool Cbz::load() {
+  LOG_DBG("CBZ", "Loading CBZ: %s", filepath.c_str());
+  setupCacheDir();
+
+  pages.clear();
+  ZipFile zip(filepath, cachePath + zipIndexFile);
+  const bool listed = zip.forEachEntry([this](const char* name, const ZipFile::FileStatSlim&) {
+    if (isPageImage(name)) {
+      pages.emplace_back(name);
+    }
+  });
+  if (!listed) {
+    LOG_ERR("CBZ", "Failed to read the zip directory: %s", filepath.c_str());
+    return false;
+  }
+  if (pages.empty()) {
+    LOG_ERR("CBZ", "No page images in %s", filepath.c_str());
+    return false;
+  }
+  std::sort(pages.begin(), pages.end(), naturalLess);
+
+  loaded = true;
+  LOG_DBG("CBZ", "Loaded CBZ: %s (%zu pages)", filepath.c_str(), pages.size());
+  return true;
+}
+
+void Cbz::setupCacheDir() const {
+  if (Storage.exists(cachePath.c_str())) {
+    return;
+  }
+
+  // Create directories recursively
+  for (size_t i = 1; i < cachePath.length(); i++) {
+    if (cachePath[i] == '/') {
+      Storage.mkdir(cachePath.substr(0, i).c_str());
+    }
+  }
+  Storage.mkdir(cachePath.c_str());
+}
+
+std::string Cbz::getTitle() const {
+  const size_t lastSlash = filepath.find_last_of('/');
+  std::string filename = (lastSlash != std::string::npos) ? filepath.substr(lastSlash + 1) : filepath;
+  if (FsHelpers::hasCbzExtension(filename)) {
+    filename.resize(filename.length() - 4);
+  }
+  return filename;
+}
+
+std::string Cbz::getPageImagePath(const uint32_t pageIndex) const {
+  const std::string& name = pages[pageIndex];
+  const std::string ext = FsHelpers::hasPngExtension(name) ? ".png" : ".jpg";
+  return cachePath + "/img_" + std::to_string(pageIndex) + ext;
+}
+
+bool Cbz::extractPage(const uint32_t pageIndex) const {
+  if (!loaded || pageIndex >= pages.size()) {
+    return false;
+  }
+  const std::string imagePath = getPageImagePath(pageIndex);
+  if (Storage.exists(imagePath.c_str())) {
+    return true;
+  }
+
+  // Written under a temp name so an interrupted extraction is never taken for the page
+  const std::string tmpPath = imagePath + ".tmp";
+  FsFile imageFile;
+  if (!Storage.openFileForWrite("CBZ", tmpPath, imageFile)) {
+    return false;
+  }
+  ZipFile zip(filepath, cachePath + zipIndexFile);
+  const bool extracted = zip.readFileToStream(pages[pageIndex].c_str(), imageFile, Storage.getChunkSize());
+  imageFile.flush();
+  imageFile.close();
+  if (!extracted || !Storage.rename(tmpPath.c_str(), imagePath.c_str())) {
+    LOG_ERR("CBZ", "Failed to extract page %lu: %s", pageIndex, pages[pageIndex].c_str());
+    Storage.remove(tmpPath.c_str());
+    return false;
+  }
+  return true;
+}
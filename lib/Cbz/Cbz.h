@@ -0,0 +1,52 @@
+/**
+ * Cbz.h
+ *
+ * CBZ comic archive handling for CrossPoint Reader
+ * A CBZ is a zip of page images, read in the natural order of their names
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Cbz {
+  std::string filepath;
+  std::string cachePath;
+  std::vector<std::string> pages;  // Names of the JPEG and PNG entries, in reading order
+  bool loaded = false;
+
+ public:
+  explicit Cbz(std::string filepath, const std::string& cacheDir) : filepath(std::move(filepath)) {
+    // Create cache key based on filepath (same as Epub)
+    cachePath = cacheDir + "/cbz_" + std::to_string(std::hash<std::string>{}(this->filepath));
+  }
+
+  /**
+   * Lists the page images from the zip's central directory
+   * @return true if the archive has at least one page
+   */
+  bool load();
+
+  void setupCacheDir() const;
+
+  // Path accessors
+  const std::string& getCachePath() const { return cachePath; }
+  const std::string& getPath() const { return filepath; }
+
+  // The file name without its extension; CBZ has no metadata
+  std::string getTitle() const;
+
+  uint32_t getPageCount() const { return static_cast<uint32_t>(pages.size()); }
+
+  // Where the page's image is extracted to, in the cache directory. Named img_ like the images of an EPUB, so the
+  // cache budget drops them first.
+  std::string getPageImagePath(uint32_t pageIndex) const;
+
+  /**
+   * Extract a page's image to getPageImagePath(), unless it is there already
+   * @return true if the image is in place
+   */
+  bool extractPage(uint32_t pageIndex) const;
+};
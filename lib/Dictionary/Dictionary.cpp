@@ -0,0 +1,787 @@
+#include "Dictionary.h"
+
+#include <Arduino.h>
+#include <BufferedFileReader.h>
+#include <BufferedFileWriter.h>
+#include <Epub/htmlEntities.h>
+#include <InflateReader.h>
+#include <Logging.h>
+#include <Print.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+struct DictzipInflateCtx {
+  InflateReader reader;  // Must be first — callback casts uzlib_uncomp* to DictzipInflateCtx*
+  FsFile* file = nullptr;
+  size_t fileRemaining = 0;
+  uint8_t readBuf[512];
+};
+
+namespace {
+constexpr char INDEX_MAGIC[4] = {'D', 'I', 'X', '1'};
+constexpr char CACHE_DIR[] = "/.crosspoint";
+// StarDict headwords are shorter than 256 bytes, so prefix and suffix lengths fit a byte
+constexpr size_t MAX_WORD_LENGTH = 255;
+// A block grows past BLOCK_SIZE rather than split words that fold the same, up to this
+constexpr size_t MAX_BLOCK_SIZE = 2 * Dictionary::BLOCK_SIZE;
+constexpr size_t ENTRY_OVERHEAD = 2 + 2 * sizeof(uint32_t);
+
+// StarDict orders headwords by g_ascii_strcasecmp() first, so the .idx is sorted by the words ASCII lowercased
+std::string fold(const std::string& word) {
+  std::string folded = word;
+  for (char& c : folded) {
+    if (c >= 'A' && c <= 'Z') {
+      c = static_cast<char>(c - 'A' + 'a');
+    }
+  }
+  return folded;
+}
+
+uint32_t readBigEndian(const uint8_t* bytes) {
+  return static_cast<uint32_t>(bytes[0]) << 24 | static_cast<uint32_t>(bytes[1]) << 16 |
+         static_cast<uint32_t>(bytes[2]) << 8 | bytes[3];
+}
+
+uint16_t readLittleEndian16(const uint8_t* bytes) { return static_cast<uint16_t>(bytes[0] | bytes[1] << 8); }
+
+bool endsWith(const std::string& word, const char* suffix) {
+  const size_t length = strlen(suffix);
+  return word.size() > length && word.compare(word.size() - length, length, suffix) == 0;
+}
+
+void appendUtf8(std::string& out, const uint32_t cp) {
+  if (cp < 0x80) {
+    out += static_cast<char>(cp);
+  } else if (cp < 0x800) {
+    out += static_cast<char>(0xC0 | cp >> 6);
+    out += static_cast<char>(0x80 | (cp & 0x3F));
+  } else if (cp < 0x10000) {
+    out += static_cast<char>(0xE0 | cp >> 12);
+    out += static_cast<char>(0x80 | (cp >> 6 & 0x3F));
+    out += static_cast<char>(0x80 | (cp & 0x3F));
+  } else if (cp < 0x110000) {
+    out += static_cast<char>(0xF0 | cp >> 18);
+    out += static_cast<char>(0x80 | (cp >> 12 & 0x3F));
+    out += static_cast<char>(0x80 | (cp >> 6 & 0x3F));
+    out += static_cast<char>(0x80 | (cp & 0x3F));
+  }
+}
+
+// Turns the fields of a definition as stored in the .dict into plain text: text fields are written with their markup
+// removed, one paragraph or more each, and binary fields (sounds, pictures) are skipped
+class DefinitionFilter final : public Print {
+  enum State : uint8_t { FIELD_TYPE, TEXT, TAG, ENTITY, BINARY_SIZE, BINARY };
+
+  Print& out;
+  const std::string& types;
+  size_t fieldIndex = 0;
+  State state = FIELD_TYPE;
+  char type = 0;
+  // The field runs to the end of the definition instead of ending in a NUL or having a size
+  bool lastField = false;
+  uint32_t binaryRemaining = 0;
+  uint8_t sizeBytes = 0;
+  // Up to 11 characters of a tag's name, enough for the block elements that break a line
+  char tagName[12] = {};
+  uint8_t tagNameLength = 0;
+  bool tagNameDone = false;
+  std::string entity;
+  char lastWritten = '\n';
+
+  bool isMarkup() const { return type == 'h' || type == 'g' || type == 'x' || type == 'k'; }
+
+  void put(const char c) {
+    if (c == ' ' && (lastWritten == ' ' || lastWritten == '\n')) {
+      return;
+    }
+    if (c == '\n' && lastWritten == '\n') {
+      return;
+    }
+    out.write(static_cast<uint8_t>(c));
+    lastWritten = c;
+  }
+
+  void put(const char* s) {
+    while (*s) {
+      put(*s++);
+    }
+  }
+
+  void beginField() {
+    state = TEXT;
+    if (types.empty()) {
+      state = FIELD_TYPE;
+      lastField = false;
+    } else if (fieldIndex < types.size()) {
+      type = types[fieldIndex];
+      lastField = fieldIndex == types.size() - 1;
+    } else {
+      // More fields than sametypesequence has types
+      type = 'r';
+      lastField = true;
+    }
+    if (state == TEXT && type >= 'A' && type <= 'Z') {
+      state = lastField ? BINARY : BINARY_SIZE;
+      binaryRemaining = UINT32_MAX;
+      sizeBytes = 0;
+    } else if (state == TEXT && type == 't') {
+      put('[');
+    }
+  }
+
+  void endField() {
+    if (type == 't') {
+      put(']');
+      put('\n');
+    } else if (type >= 'a' && type <= 'z') {
+      put('\n');
+    }
+    fieldIndex++;
+    beginField();
+  }
+
+  bool breaksLine() const {
+    static const char* const BLOCK_TAGS[] = {"br", "p", "div", "li", "tr", "dd", "dt", "blockquote", "hr", "h1",
+                                             "h2", "h3", "h4", "def", "ex"};
+    const char* name = tagName[0] == '/' ? tagName + 1 : tagName;
+    return std::any_of(std::begin(BLOCK_TAGS), std::end(BLOCK_TAGS),
+                       [name](const char* tag) { return strcmp(name, tag) == 0; });
+  }
+
+  void endEntity() {
+    const char* value = nullptr;
+    std::string decoded;
+    if (entity.size() > 3 && entity[1] == '#') {
+      const bool hex = entity[2] == 'x' || entity[2] == 'X';
+      const uint32_t cp = strtoul(entity.c_str() + (hex ? 3 : 2), nullptr, hex ? 16 : 10);
+      if (cp > 0) {
+        appendUtf8(decoded, cp == 0xA0 ? ' ' : cp);
+        value = decoded.c_str();
+      }
+    } else if (entity == "&nbsp;") {
+      value = " ";
+    } else {
+      value = lookupHtmlEntity(entity.c_str(), entity.size());
+    }
+    put(value ? value : entity.c_str());
+    entity.clear();
+  }
+
+  void text(const char c) {
+    if (c == 0 && !lastField) {
+      endField();
+    } else if (type == 'r' || type == 0) {
+      // Resource file names and unknown text are not shown
+    } else if (isMarkup() && c == '<') {
+      state = TAG;
+      tagNameLength = 0;
+      tagNameDone = false;
+    } else if (isMarkup() && c == '&') {
+      state = ENTITY;
+      entity = "&";
+    } else if (c == '\n') {
+      // HTML collapses line breaks, the other formats keep them
+      put(type == 'h' ? ' ' : '\n');
+    } else if (c == ' ' || c == '\t' || c == '\r') {
+      put(' ');
+    } else if (c != 0) {
+      put(c);
+    }
+  }
+
+  void scan(const char c) {
+    switch (state) {
+      case FIELD_TYPE:
+        type = c;
+        if (type >= 'A' && type <= 'Z') {
+          state = BINARY_SIZE;
+          sizeBytes = 0;
+          binaryRemaining = 0;
+        } else {
+          state = TEXT;
+          if (type == 't') {
+            put('[');
+          }
+        }
+        break;
+      case TEXT:
+        text(c);
+        break;
+      case TAG:
+        if (c == '>') {
+          tagName[tagNameLength] = '\0';
+          if (breaksLine()) {
+            put('\n');
+          }
+          state = TEXT;
+        } else if (c == ' ' || c == '\t' || c == '\n' || c == '/') {
+          tagNameDone = tagNameDone || tagNameLength > 0;
+          if (c == '/' && tagNameLength == 0) {
+            tagName[tagNameLength++] = c;
+          }
+        } else if (!tagNameDone) {
+          if (tagNameLength < sizeof(tagName) - 1) {
+            tagName[tagNameLength++] = static_cast<char>(tolower(static_cast<uint8_t>(c)));
+          } else {
+            tagNameDone = true;
+          }
+        }
+        break;
+      case ENTITY:
+        entity += c;
+        if (c == ';') {
+          state = TEXT;
+          endEntity();
+        } else if (entity.size() > 10 || c == ' ' || c == '<' || c == '&') {
+          entity.pop_back();
+          put(entity.c_str());
+          entity.clear();
+          state = TEXT;
+          text(c);
+        }
+        break;
+      case BINARY_SIZE:
+        binaryRemaining = binaryRemaining << 8 | static_cast<uint8_t>(c);
+        if (++sizeBytes == 4) {
+          state = BINARY;
+          if (binaryRemaining == 0) {
+            endField();
+          }
+        }
+        break;
+      case BINARY:
+        if (--binaryRemaining == 0) {
+          endField();
+        }
+        break;
+    }
+  }
+
+ public:
+  DefinitionFilter(Print& out, const std::string& types) : out(out), types(types) { beginField(); }
+
+  size_t write(const uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* buffer, const size_t size) override {
+    for (size_t i = 0; i < size; i++) {
+      scan(static_cast<char>(buffer[i]));
+    }
+    return size;
+  }
+
+  void finish() {
+    if (state == ENTITY) {
+      put(entity.c_str());
+    }
+    if (type == 't' && state == TEXT) {
+      put(']');
+    }
+    put('\n');
+  }
+};
+
+int dictzipReadCallback(uzlib_uncomp* uncomp) {
+  auto* ctx = reinterpret_cast<DictzipInflateCtx*>(uncomp);
+  if (ctx->fileRemaining == 0) return -1;
+
+  const size_t toRead = std::min(ctx->fileRemaining, sizeof(ctx->readBuf));
+  const size_t bytesRead = ctx->file->read(ctx->readBuf, toRead);
+  if (bytesRead == 0) return -1;
+  ctx->fileRemaining -= bytesRead;
+
+  uncomp->source = ctx->readBuf + 1;
+  uncomp->source_limit = ctx->readBuf + bytesRead;
+  return ctx->readBuf[0];
+}
+}  // namespace
+
+bool Dictionary::open(const std::function<void()>& popupFn) {
+  auto dir = Storage.open(DIRECTORY);
+  if (!dir || !dir.isDirectory()) {
+    LOG_DBG("DIC", "No %s directory", DIRECTORY);
+    return false;
+  }
+  std::string stem;
+  char fileName[128];
+  for (auto file = dir.openNextFile(); file; file = dir.openNextFile()) {
+    file.getName(fileName, sizeof(fileName));
+    const std::string candidate = fileName;
+    if (!file.isDirectory() && endsWith(candidate, ".ifo")) {
+      const std::string candidateStem = candidate.substr(0, candidate.size() - 4);
+      if (stem.empty() || candidateStem < stem) {
+        stem = candidateStem;
+      }
+    }
+  }
+  dir.close();
+  if (stem.empty()) {
+    LOG_DBG("DIC", "No dictionary in %s", DIRECTORY);
+    return false;
+  }
+
+  basePath = std::string(DIRECTORY) + "/" + stem;
+  name = stem;
+  if (!readInfo(basePath + ".ifo")) {
+    return false;
+  }
+  if (!Storage.exists((basePath + ".idx").c_str())) {
+    LOG_ERR("DIC", "%s.idx is missing (a compressed .idx.gz is not supported)", stem.c_str());
+    return false;
+  }
+  if (Storage.exists((basePath + ".dict").c_str())) {
+    if (!Storage.openFileForRead("DIC", basePath + ".dict", dictFile)) {
+      return false;
+    }
+  } else if (!Storage.openFileForRead("DIC", basePath + ".dict.dz", dictFile) || !readDictzipHeader()) {
+    return false;
+  }
+
+  indexPath = std::string(CACHE_DIR) + "/dict_" + stem + ".bin";
+  if (loadIndex()) {
+    return true;
+  }
+  if (popupFn) {
+    popupFn();
+  }
+  return buildIndex() && loadIndex();
+}
+
+bool Dictionary::readInfo(const std::string& ifoPath) {
+  FsFile file;
+  if (!Storage.openFileForRead("DIC", ifoPath, file)) {
+    return false;
+  }
+  char buffer[1024];
+  const int length = file.read(buffer, sizeof(buffer) - 1);
+  file.close();
+  if (length <= 0) {
+    return false;
+  }
+  buffer[length] = '\0';
+
+  for (char* line = strtok(buffer, "\r\n"); line; line = strtok(nullptr, "\r\n")) {
+    char* value = strchr(line, '=');
+    if (!value) {
+      continue;
+    }
+    *value++ = '\0';
+    if (strcmp(line, "bookname") == 0) {
+      name = value;
+    } else if (strcmp(line, "sametypesequence") == 0) {
+      sameTypeSequence = value;
+    } else if (strcmp(line, "idxoffsetbits") == 0) {
+      wideOffsets = strcmp(value, "64") == 0;
+    }
+  }
+  return true;
+}
+
+bool Dictionary::readDictzipHeader() {
+  // gzip member header (RFC 1952) whose extra field has dictzip's "RA" subfield: version, chunk length, chunk count
+  // and the compressed size of each chunk. Every chunk starts at a full flush, so inflating can start at any of them.
+  BufferedFileReader reader(dictFile, 1024);
+  uint8_t header[10];
+  if (reader.read(header, sizeof(header)) != sizeof(header) || header[0] != 0x1F || header[1] != 0x8B ||
+      header[2] != 8 || !(header[3] & 0x04)) {
+    LOG_ERR("DIC", "%s.dict.dz is not dictzip compressed", name.c_str());
+    return false;
+  }
+  const uint8_t flags = header[3];
+  uint8_t lengthBytes[2];
+  reader.read(lengthBytes, 2);
+  const size_t extraEnd = reader.position() + readLittleEndian16(lengthBytes);
+  std::vector<uint16_t> chunkSizes;
+  while (reader.position() + 4 <= extraEnd) {
+    uint8_t subfield[4];
+    reader.read(subfield, sizeof(subfield));
+    const uint16_t length = readLittleEndian16(subfield + 2);
+    if (subfield[0] != 'R' || subfield[1] != 'A' || length < 6) {
+      reader.skip(length);
+      continue;
+    }
+    uint8_t ra[6];
+    reader.read(ra, sizeof(ra));
+    chunkLength = readLittleEndian16(ra + 2);
+    chunkSizes.resize(readLittleEndian16(ra + 4));
+    for (auto& size : chunkSizes) {
+      reader.read(lengthBytes, 2);
+      size = readLittleEndian16(lengthBytes);
+    }
+    reader.seek(extraEnd);
+  }
+  if (chunkLength == 0 || chunkSizes.empty()) {
+    LOG_ERR("DIC", "%s.dict.dz has no dictzip chunk table", name.c_str());
+    return false;
+  }
+  reader.seek(extraEnd);
+  uint8_t c = 1;
+  if (flags & 0x08) {
+    while (c != 0 && reader.read(&c, 1) == 1) {
+    }
+  }
+  c = 1;
+  if (flags & 0x10) {
+    while (c != 0 && reader.read(&c, 1) == 1) {
+    }
+  }
+  if (flags & 0x02) {
+    reader.skip(2);
+  }
+
+  chunkOffsets.resize(chunkSizes.size() + 1);
+  chunkOffsets[0] = reader.position();
+  for (size_t i = 0; i < chunkSizes.size(); i++) {
+    chunkOffsets[i + 1] = chunkOffsets[i] + chunkSizes[i];
+  }
+  return true;
+}
+
+bool Dictionary::buildIndex() {
+  const auto start = millis();
+  FsFile idx;
+  FsFile index;
+  if (!Storage.openFileForRead("DIC", basePath + ".idx", idx)) {
+    return false;
+  }
+  Storage.mkdir(CACHE_DIR);
+  if (!Storage.openFileForWrite("DIC", indexPath, index)) {
+    return false;
+  }
+
+  IndexHeader header = {};
+  BufferedFileWriter writer(index);
+  writer.write(&header, sizeof(header));
+
+  std::vector<uint32_t> offsets;
+  std::string keys;
+  std::vector<uint8_t> current;
+  current.reserve(BLOCK_SIZE + ENTRY_OVERHEAD + MAX_WORD_LENGTH);
+  std::string previousWord;
+  std::string previousFolded;
+  uint32_t wordCount = 0;
+  uint32_t skipped = 0;
+  bool ok = true;
+
+  const auto flushBlock = [&]() {
+    ok = ok && writer.write(current.data(), current.size()) == current.size();
+    current.clear();
+    previousWord.clear();
+  };
+
+  BufferedFileReader reader(idx, 4096);
+  std::string word;
+  const size_t locationSize = wideOffsets ? 12 : 8;
+  while (ok) {
+    word.clear();
+    uint8_t c;
+    while (reader.read(&c, 1) == 1 && c != 0) {
+      word += static_cast<char>(c);
+    }
+    uint8_t location[12];
+    if (reader.read(location, locationSize) != static_cast<int>(locationSize)) {
+      break;
+    }
+    const uint32_t highOffset = wideOffsets ? readBigEndian(location) : 0;
+    const uint32_t offset = readBigEndian(location + locationSize - 8);
+    const uint32_t size = readBigEndian(location + locationSize - 4);
+    std::string folded = fold(word);
+    if (word.empty() || word.size() > MAX_WORD_LENGTH || highOffset != 0 || folded < previousFolded) {
+      skipped++;
+      continue;
+    }
+
+    const size_t entrySize = ENTRY_OVERHEAD + word.size();
+    const bool sameAsPrevious = folded == previousFolded;
+    if (!current.empty() && current.size() + entrySize > BLOCK_SIZE &&
+        (!sameAsPrevious || current.size() + entrySize > MAX_BLOCK_SIZE)) {
+      flushBlock();
+    }
+    if (current.empty()) {
+      // The shortest prefix of the block's first word that sorts after the last word of the block before
+      size_t common = 0;
+      while (common < previousFolded.size() && common < folded.size() && previousFolded[common] == folded[common]) {
+        common++;
+      }
+      offsets.push_back(writer.position());
+      keys += offsets.size() == 1 ? std::string() : folded.substr(0, common + 1);
+      keys += '\0';
+    }
+
+    size_t shared = 0;
+    while (shared < previousWord.size() && shared < word.size() && previousWord[shared] == word[shared]) {
+      shared++;
+    }
+    current.push_back(static_cast<uint8_t>(shared));
+    current.push_back(static_cast<uint8_t>(word.size() - shared));
+    current.insert(current.end(), word.begin() + shared, word.end());
+    const uint8_t* offsetBytes = reinterpret_cast<const uint8_t*>(&offset);
+    const uint8_t* sizeBytes = reinterpret_cast<const uint8_t*>(&size);
+    current.insert(current.end(), offsetBytes, offsetBytes + sizeof(offset));
+    current.insert(current.end(), sizeBytes, sizeBytes + sizeof(size));
+    previousWord = std::move(word);
+    previousFolded = std::move(folded);
+    wordCount++;
+  }
+  if (!current.empty()) {
+    flushBlock();
+  }
+
+  memcpy(header.magic, INDEX_MAGIC, 4);
+  header.idxFileSize = idx.size();
+  header.wordCount = wordCount;
+  header.blockCount = offsets.size();
+  header.fencesOffset = writer.position();
+  offsets.push_back(writer.position());
+  const char* key = keys.c_str();
+  for (size_t i = 0; i + 1 < offsets.size(); i++) {
+    const auto keyLength = static_cast<uint8_t>(strlen(key));
+    writer.write(&offsets[i], sizeof(uint32_t));
+    writer.write(keyLength);
+    writer.write(key, keyLength);
+    key += keyLength + 1;
+  }
+  writer.write(&offsets.back(), sizeof(uint32_t));
+  ok = writer.flush() && ok && wordCount > 0;
+  if (ok) {
+    index.seek(0);
+    ok = index.write(&header, sizeof(header)) == sizeof(header);
+  }
+  index.close();
+  idx.close();
+
+  if (!ok) {
+    LOG_ERR("DIC", "Failed to write dictionary index %s", indexPath.c_str());
+    Storage.remove(indexPath.c_str());
+    return false;
+  }
+  LOG_DBG("DIC", "Indexed %u words of %s in %u blocks in %lu ms (%u skipped)", static_cast<unsigned>(wordCount),
+          name.c_str(), static_cast<unsigned>(header.blockCount), millis() - start, static_cast<unsigned>(skipped));
+  return true;
+}
+
+bool Dictionary::loadIndex() {
+  if (!Storage.exists(indexPath.c_str()) || !Storage.openFileForRead("DIC", indexPath, indexFile)) {
+    return false;
+  }
+  IndexHeader header = {};
+  FsFile idx;
+  if (indexFile.read(&header, sizeof(header)) != sizeof(header) || memcmp(header.magic, INDEX_MAGIC, 4) != 0 ||
+      !Storage.openFileForRead("DIC", basePath + ".idx", idx) || idx.size() != header.idxFileSize ||
+      header.blockCount == 0) {
+    // Interrupted build or a replaced dictionary
+    indexFile.close();
+    return false;
+  }
+  idx.close();
+
+  blockOffsets.clear();
+  keyStarts.clear();
+  fenceKeys.clear();
+  indexFile.seek(header.fencesOffset);
+  BufferedFileReader reader(indexFile, 1024);
+  blockOffsets.resize(header.blockCount + 1);
+  keyStarts.resize(header.blockCount);
+  for (uint32_t i = 0; i < header.blockCount; i++) {
+    uint8_t keyLength = 0;
+    char key[256];
+    reader.read(&blockOffsets[i], sizeof(uint32_t));
+    reader.read(&keyLength, 1);
+    if (reader.read(key, keyLength) != keyLength) {
+      blockOffsets.clear();
+      indexFile.close();
+      return false;
+    }
+    keyStarts[i] = fenceKeys.size();
+    fenceKeys.append(key, keyLength);
+    fenceKeys += '\0';
+  }
+  reader.read(&blockOffsets.back(), sizeof(uint32_t));
+  loadedBlock = -1;
+  LOG_DBG("DIC", "Opened %s: %u words, %u fences in %u bytes", name.c_str(), static_cast<unsigned>(header.wordCount),
+          static_cast<unsigned>(header.blockCount),
+          static_cast<unsigned>(fenceKeys.size() + blockOffsets.size() * sizeof(uint32_t) * 2));
+  return true;
+}
+
+int Dictionary::findBlock(const std::string& folded) const {
+  // The last block whose key is at most the word; the first block's key is empty
+  int low = 0;
+  int high = static_cast<int>(keyStarts.size()) - 1;
+  while (low < high) {
+    const int mid = (low + high + 1) / 2;
+    if (strcmp(fenceKeys.c_str() + keyStarts[mid], folded.c_str()) <= 0) {
+      low = mid;
+    } else {
+      high = mid - 1;
+    }
+  }
+  return low;
+}
+
+bool Dictionary::loadBlock(const int index) {
+  if (loadedBlock == index) {
+    return true;
+  }
+  loadedBlock = -1;
+  const uint32_t size = blockOffsets[index + 1] - blockOffsets[index];
+  block.resize(size);
+  if (!indexFile.seek(blockOffsets[index]) || indexFile.read(block.data(), size) != static_cast<int>(size)) {
+    LOG_ERR("DIC", "Failed to read dictionary block %d", index);
+    return false;
+  }
+  loadedBlock = index;
+  return true;
+}
+
+bool Dictionary::lookup(const std::string& word, std::vector<DictionaryEntry>& entries) {
+  entries.clear();
+  if (!isOpen() || word.empty() || word.size() > MAX_WORD_LENGTH) {
+    return false;
+  }
+  const std::string folded = fold(word);
+  if (!loadBlock(findBlock(folded))) {
+    return false;
+  }
+
+  std::string current;
+  size_t position = 0;
+  while (position + ENTRY_OVERHEAD <= block.size()) {
+    const uint8_t shared = block[position];
+    const uint8_t suffixLength = block[position + 1];
+    if (shared > current.size() || position + ENTRY_OVERHEAD + suffixLength > block.size()) {
+      break;
+    }
+    current.resize(shared);
+    current.append(reinterpret_cast<const char*>(block.data() + position + 2), suffixLength);
+    position += 2 + suffixLength;
+    DictionaryEntry entry{current, 0, 0};
+    memcpy(&entry.offset, block.data() + position, sizeof(uint32_t));
+    memcpy(&entry.size, block.data() + position + sizeof(uint32_t), sizeof(uint32_t));
+    position += 2 * sizeof(uint32_t);
+
+    const int order = fold(current).compare(folded);
+    if (order > 0) {
+      break;
+    }
+    if (order == 0) {
+      entries.push_back(std::move(entry));
+    }
+  }
+  std::stable_partition(entries.begin(), entries.end(), [&word](const DictionaryEntry& e) { return e.word == word; });
+  return !entries.empty();
+}
+
+bool Dictionary::find(const std::string& word, std::vector<DictionaryEntry>& entries) {
+  const auto start = millis();
+  if (lookup(word, entries)) {
+    LOG_DBG("DIC", "Found %s in %lu ms", word.c_str(), millis() - start);
+    return true;
+  }
+
+  const std::string folded = fold(word);
+  std::vector<std::string> stems;
+  const auto addStem = [&](const size_t suffixLength, const char* ending) {
+    std::string stem = folded.substr(0, folded.size() - suffixLength) + ending;
+    if (stem.size() >= 2) {
+      stems.push_back(std::move(stem));
+    }
+  };
+  // A doubled final consonant is undone as well: "running", "stopped"
+  const auto addVerbStems = [&](const size_t suffixLength) {
+    addStem(suffixLength, "");
+    addStem(suffixLength, "e");
+    const size_t end = folded.size() - suffixLength;
+    if (end >= 3 && folded[end - 1] == folded[end - 2] && !strchr("aeiouls", folded[end - 1])) {
+      addStem(suffixLength + 1, "");
+    }
+  };
+  if (endsWith(folded, "'s")) {
+    addStem(2, "");
+  } else if (endsWith(folded, "ies") || endsWith(folded, "ied")) {
+    addStem(3, "y");
+  } else if (endsWith(folded, "es")) {
+    addStem(2, "");
+    addStem(1, "");
+  } else if (endsWith(folded, "s") && !endsWith(folded, "ss")) {
+    addStem(1, "");
+  } else if (endsWith(folded, "ed")) {
+    addVerbStems(2);
+  } else if (endsWith(folded, "ing")) {
+    addVerbStems(3);
+  } else if (endsWith(folded, "ly")) {
+    addStem(2, "");
+  }
+  for (const auto& stem : stems) {
+    if (lookup(stem, entries)) {
+      LOG_DBG("DIC", "Found %s as %s in %lu ms", word.c_str(), stem.c_str(), millis() - start);
+      return true;
+    }
+  }
+  LOG_DBG("DIC", "%s not found in %lu ms", word.c_str(), millis() - start);
+  return false;
+}
+
+bool Dictionary::readDefinition(const DictionaryEntry& entry, Print& out) {
+  if (!dictFile) {
+    return false;
+  }
+  DefinitionFilter filter(out, sameTypeSequence);
+  const bool ok = chunkOffsets.empty() ? streamDefinition(entry, filter) : inflateDefinition(entry, filter);
+  filter.finish();
+  return ok;
+}
+
+bool Dictionary::streamDefinition(const DictionaryEntry& entry, Print& out) {
+  if (!dictFile.seek(entry.offset)) {
+    return false;
+  }
+  uint8_t buffer[512];
+  uint32_t remaining = entry.size;
+  while (remaining > 0) {
+    const int bytesRead = dictFile.read(buffer, std::min<size_t>(remaining, sizeof(buffer)));
+    if (bytesRead <= 0) {
+      LOG_ERR("DIC", "Failed to read definition of %s", entry.word.c_str());
+      return false;
+    }
+    out.write(buffer, bytesRead);
+    remaining -= bytesRead;
+  }
+  return true;
+}
+
+bool Dictionary::inflateDefinition(const DictionaryEntry& entry, Print& out) {
+  const size_t chunk = entry.offset / chunkLength;
+  if (chunk + 1 >= chunkOffsets.size() || !dictFile.seek(chunkOffsets[chunk])) {
+    return false;
+  }
+  // The chunks form one deflate stream, so inflating goes on into the next chunk if the definition runs into it
+  DictzipInflateCtx ctx;
+  ctx.file = &dictFile;
+  ctx.fileRemaining = chunkOffsets.back() - chunkOffsets[chunk];
+  if (!ctx.reader.init(true)) {
+    LOG_ERR("DIC", "Failed to init inflate reader");
+    return false;
+  }
+  ctx.reader.setReadCallback(dictzipReadCallback);
+
+  uint8_t buffer[512];
+  size_t toSkip = entry.offset - chunk * chunkLength;
+  size_t remaining = entry.size;
+  while (remaining > 0) {
+    const size_t wanted = std::min(sizeof(buffer), toSkip > 0 ? toSkip : remaining);
+    size_t produced = 0;
+    const InflateStatus status = ctx.reader.readAtMost(buffer, wanted, &produced);
+    if (toSkip > 0) {
+      toSkip -= produced;
+    } else {
+      out.write(buffer, produced);
+      remaining -= produced;
+    }
+    if (status == InflateStatus::Error || (status == InflateStatus::Done && remaining > 0)) {
+      LOG_ERR("DIC", "Failed to inflate definition of %s", entry.word.c_str());
+      return false;
+    }
+  }
+  return true;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <HalStorage.h>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+class Print;
+
+// A headword of the dictionary and where its definition is in the .dict file
+struct DictionaryEntry {
+  std::string word;
+  uint32_t offset;
+  uint32_t size;
+};
+
+/**
+ * Offline lookups in a StarDict dictionary (.ifo, .idx and .dict or dictzipped .dict.dz) copied to /dictionaries.
+ *
+ * The .idx file lists the headwords in order but can only be searched from its start, so the first open() imports it
+ * into an index in /.crosspoint, next to the book caches:
+ * - IndexHeader
+ * - blocks of about BLOCK_SIZE bytes, each holding headwords in .idx order, front coded:
+ *   uint8_t prefix length shared with the word before in the block, uint8_t suffix length, the suffix,
+ *   uint32_t offset and uint32_t size of the definition
+ * - fences: for each block, uint32_t block offset, uint8_t key length and the key, then uint32_t end of the blocks
+ *
+ * A block's key is the shortest prefix of its first word (ASCII folded) that sorts after the last word of the block
+ * before, so the keys are a few bytes and the fences stay in RAM. A lookup finds the block in the fences, reads it with
+ * one seek, and reads the definition with another.
+ */
+class Dictionary {
+ public:
+  static constexpr char DIRECTORY[] = "/dictionaries";
+  static constexpr size_t BLOCK_SIZE = 4096;
+
+  struct IndexHeader {
+    char magic[4];  // "DIX1", written last so an interrupted build is never used
+    uint32_t idxFileSize;
+    uint32_t wordCount;
+    uint32_t blockCount;
+    uint32_t fencesOffset;
+  };
+
+  // Opens the first dictionary in DIRECTORY by name, importing its .idx first if needed; popupFn is called before an
+  // import, which takes a few seconds for a large dictionary
+  bool open(const std::function<void()>& popupFn = nullptr);
+  bool isOpen() const { return !blockOffsets.empty(); }
+  const std::string& getName() const { return name; }
+
+  // The entries whose headword is the word, ASCII case aside; those spelled the same way come first
+  bool lookup(const std::string& word, std::vector<DictionaryEntry>& entries);
+  // Like lookup(), falling back to the word without common English inflections ("walked", "cities", "running")
+  bool find(const std::string& word, std::vector<DictionaryEntry>& entries);
+  // Writes the definition as plain text to out: markup is removed, paragraphs end in '\n'
+  bool readDefinition(const DictionaryEntry& entry, Print& out);
+
+ private:
+  std::string name;
+  std::string basePath;
+  std::string indexPath;
+  // The types of the fields of every definition, empty when each field starts with its type
+  std::string sameTypeSequence;
+  bool wideOffsets = false;
+  FsFile indexFile;
+  FsFile dictFile;
+  // Fences: blockOffsets has one more element than there are blocks, keys are NUL terminated in fenceKeys
+  std::vector<uint32_t> blockOffsets;
+  std::vector<uint32_t> keyStarts;
+  std::string fenceKeys;
+  // The block read last, fallbacks of find() mostly land in it again
+  std::vector<uint8_t> block;
+  int loadedBlock = -1;
+  // Dictzip: chunk size and the file offset of every chunk, plus the end of the last one; empty for a plain .dict
+  uint32_t chunkLength = 0;
+  std::vector<uint32_t> chunkOffsets;
+
+  bool readInfo(const std::string& ifoPath);
+  bool readDictzipHeader();
+  bool buildIndex();
+  bool loadIndex();
+  bool loadBlock(int index);
+  int findBlock(const std::string& folded) const;
+  bool streamDefinition(const DictionaryEntry& entry, Print& out);
+  bool inflateDefinition(const DictionaryEntry& entry, Print& out);
+};
@@ -80,7 +80,12 @@ void EpdFont::getTextDimensions(const char* string, int* w, int* h) const {
   *h = maxY - minY;
 }
 
-static uint8_t lookupKernClass(const EpdKernClassEntry* entries, const uint16_t count, const uint32_t cp) {
+static uint8_t lookupKernClass(const uint8_t* lookup, const uint16_t lookupSize, const EpdKernClassEntry* entries,
+                               const uint16_t count, const uint32_t cp) {
+  if (cp < lookupSize) {
+    // Direct table for Latin, which is nearly every pair laid out
+    return lookup[cp];
+  }
   if (!entries || count == 0 || cp > 0xFFFF) {
     return 0;
   }
@@ -104,17 +109,26 @@ int8_t EpdFont::getKerning(const uint32_t leftCp, const uint32_t rightCp) const
   if (!data->kernMatrix) {
     return 0;
   }
-  const uint8_t lc = lookupKernClass(data->kernLeftClasses, data->kernLeftEntryCount, leftCp);
+  const uint8_t lc = lookupKernClass(data->kernLeftLookup, data->kernLookupSize, data->kernLeftClasses,
+                                     data->kernLeftEntryCount, leftCp);
   if (lc == 0) return 0;
-  const uint8_t rc = lookupKernClass(data->kernRightClasses, data->kernRightEntryCount, rightCp);
+  const uint8_t rc = lookupKernClass(data->kernRightLookup, data->kernLookupSize, data->kernRightClasses,
+                                     data->kernRightEntryCount, rightCp);
   if (rc == 0) return 0;
   return data->kernMatrix[(lc - 1) * data->kernRightClassCount + (rc - 1)];
 }
 
+bool EpdFont::mayStartLigature(const uint32_t cp) const {
+  if (!data->ligaturePairs || data->ligaturePairCount == 0) {
+    return false;
+  }
+  return cp >= data->ligatureStartsSize || (data->ligatureStarts[cp >> 3] & (1u << (cp & 7))) != 0;
+}
+
 uint32_t EpdFont::getLigature(const uint32_t leftCp, const uint32_t rightCp) const {
   const auto* pairs = data->ligaturePairs;
   const auto count = data->ligaturePairCount;
-  if (!pairs || count == 0 || leftCp > 0xFFFF || rightCp > 0xFFFF) {
+  if (!mayStartLigature(leftCp) || leftCp > 0xFFFF || rightCp > 0xFFFF) {
     return 0;
   }
 
@@ -134,10 +148,8 @@ uint32_t EpdFont::getLigature(const uint32_t leftCp, const uint32_t rightCp) con
 }
 
 uint32_t EpdFont::applyLigatures(uint32_t cp, const char*& text) const {
-  if (!data->ligaturePairs || data->ligaturePairCount == 0) {
-    return cp;
-  }
-  while (true) {
+  // Most codepoints start no ligature, so the next one is not even decoded
+  while (mayStartLigature(cp)) {
     const auto saved = reinterpret_cast<const uint8_t*>(text);
     const uint32_t nextCp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text));
     if (nextCp == 0) break;
@@ -155,19 +167,27 @@ const EpdGlyph* EpdFont::getGlyph(const uint32_t cp) const {
   const int count = data->intervalCount;
   if (count == 0) return nullptr;
 
-  const EpdUnicodeInterval* intervals = data->intervals;
-  const auto* end = intervals + count;
-
-  // upper_bound: range lookup. Finds the first interval with first > cp, so the
-  // interval just before it is the last one with first <= cp. That's the only
-  // candidate that could contain cp. Then we verify cp <= candidate.last.
-  const auto it = std::upper_bound(
-      intervals, end, cp, [](uint32_t value, const EpdUnicodeInterval& interval) { return value < interval.first; });
-
-  if (it != intervals) {
-    const auto& interval = *(it - 1);
-    if (cp <= interval.last) {
-      return &data->glyph[interval.offset + (cp - interval.first)];
+  if (cp < data->glyphLookupSize) {
+    // Direct table for Latin/Cyrillic, which is nearly every character laid out
+    const uint16_t entry = data->glyphLookup[cp];
+    if (entry != 0) {
+      return &data->glyph[entry - 1];
+    }
+  } else {
+    const EpdUnicodeInterval* intervals = data->intervals;
+    const auto* end = intervals + count;
+
+    // upper_bound: range lookup. Finds the first interval with first > cp, so the
+    // interval just before it is the last one with first <= cp. That's the only
+    // candidate that could contain cp. Then we verify cp <= candidate.last.
+    const auto it = std::upper_bound(
+        intervals, end, cp, [](uint32_t value, const EpdUnicodeInterval& interval) { return value < interval.first; });
+
+    if (it != intervals) {
+      const auto& interval = *(it - 1);
+      if (cp <= interval.last) {
+        return &data->glyph[interval.offset + (cp - interval.first)];
+      }
     }
   }
 
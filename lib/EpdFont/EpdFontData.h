@@ -129,4 +129,15 @@ typedef struct {
   uint8_t kernRightClassCount;           ///< Number of distinct right classes (matrix cols)
   const EpdLigaturePair* ligaturePairs;  ///< Sorted ligature pair table (nullptr if none)
   uint32_t ligaturePairCount;            ///< Number of entries in ligaturePairs
+  const uint16_t* glyphLookup;           ///< glyphLookup[cp] = glyph index + 1, or 0 if missing (nullptr if none)
+  uint16_t glyphLookupSize;              ///< Codepoints below this are resolved through glyphLookup
+  const uint8_t* kernLeftLookup;         ///< kernLeftLookup[cp] = left kerning class of cp, or 0 (nullptr if none)
+  const uint8_t* kernRightLookup;        ///< kernRightLookup[cp] = right kerning class of cp, or 0 (nullptr if none)
+  uint16_t kernLookupSize;               ///< Codepoints below this are classed through the two kern lookups
+  const uint8_t* ligatureStarts;         ///< Bit cp % 8 of byte cp / 8 set if a ligature pair starts with cp
+  uint16_t ligatureStartsSize;           ///< Codepoints below this start no ligature unless their bit is set
+  uint32_t glyphCount;                   ///< Entries in glyph
+  /// Set for fonts streamed from storage (see SdFont): bitmap is NULL and compressed group data is read through this
+  bool (*readBitmap)(void* context, uint32_t offset, uint8_t* buffer, uint32_t length);
+  void* readContext;
 } EpdFontData;
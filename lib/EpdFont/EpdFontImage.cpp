@@ -0,0 +1,101 @@
+#include "EpdFontImage.h"
+
+#include <cstddef>
+#include <cstring>
+
+namespace EpdFontImage {
+namespace {
+constexpr char MAGIC[4] = {'E', 'P', 'D', 'F'};
+constexpr uint16_t VERSION = 1;
+
+// The tables are stored in the in-memory layout of these structs
+static_assert(sizeof(EpdUnicodeInterval) == 12, "EpdUnicodeInterval layout changed");
+static_assert(sizeof(EpdGlyph) == 16 && offsetof(EpdGlyph, dataOffset) == 12, "EpdGlyph layout changed");
+static_assert(sizeof(EpdFontGroup) == 20 && offsetof(EpdFontGroup, firstGlyphIndex) == 16,
+              "EpdFontGroup layout changed");
+static_assert(sizeof(EpdKernClassEntry) == 3 && sizeof(EpdLigaturePair) == 8, "Kerning/ligature layout changed");
+
+// Hands out consecutive tables from the tables block, failing once a table would run past its end
+class TableCursor {
+  const uint8_t* base;
+  uint32_t size;
+  uint32_t offset = 0;
+  bool ok = true;
+
+ public:
+  TableCursor(const uint8_t* base, const uint32_t size) : base(base), size(size) {}
+  template <typename T>
+  const T* take(const uint32_t count) {
+    const uint64_t bytes = static_cast<uint64_t>(count) * sizeof(T);
+    if (!ok || offset + bytes > size) {
+      ok = false;
+      return nullptr;
+    }
+    const T* table = count > 0 ? reinterpret_cast<const T*>(base + offset) : nullptr;
+    offset = pad4(offset + static_cast<uint32_t>(bytes));
+    return table;
+  }
+  bool valid() const { return ok; }
+};
+}  // namespace
+
+bool checkHeader(const Header& header, const uint64_t imageSize) {
+  return memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0 && header.version == VERSION && header.groupCount > 0 &&
+         header.glyphCount > 0 && header.intervalCount > 0 &&
+         header.bitmapOffset == sizeof(header) + header.tablesSize &&
+         static_cast<uint64_t>(header.bitmapOffset) + header.bitmapSize <= imageSize;
+}
+
+bool bindTables(const Header& header, const uint8_t* tables, EpdFontData& data) {
+  TableCursor cursor(tables, header.tablesSize);
+  data = {};
+  data.intervals = cursor.take<EpdUnicodeInterval>(header.intervalCount);
+  data.glyph = cursor.take<EpdGlyph>(header.glyphCount);
+  data.glyphCount = header.glyphCount;
+  data.groups = cursor.take<EpdFontGroup>(header.groupCount);
+  data.glyphToGroup = header.hasGlyphToGroup ? cursor.take<uint16_t>(header.glyphCount) : nullptr;
+  data.kernLeftClasses = cursor.take<EpdKernClassEntry>(header.kernLeftEntryCount);
+  data.kernRightClasses = cursor.take<EpdKernClassEntry>(header.kernRightEntryCount);
+  data.kernMatrix = cursor.take<int8_t>(header.kernLeftClassCount * header.kernRightClassCount);
+  data.ligaturePairs = cursor.take<EpdLigaturePair>(header.ligaturePairCount);
+  data.glyphLookup = cursor.take<uint16_t>(header.glyphLookupSize);
+  if (!cursor.valid()) {
+    data = {};
+    return false;
+  }
+
+  // Every lookup indexes the glyph table through the intervals and groups, so check them once here
+  const EpdUnicodeInterval& last = data.intervals[header.intervalCount - 1];
+  const uint64_t intervalGlyphs = static_cast<uint64_t>(last.offset) + (last.last - last.first + 1);
+  bool consistent = last.last >= last.first && intervalGlyphs <= header.glyphCount;
+  for (uint16_t i = 0; consistent && i < header.groupCount; i++) {
+    const EpdFontGroup& group = data.groups[i];
+    consistent = static_cast<uint64_t>(group.compressedOffset) + group.compressedSize <= header.bitmapSize &&
+                 (data.glyphToGroup || group.firstGlyphIndex + group.glyphCount <= header.glyphCount);
+  }
+  for (uint32_t i = 0; consistent && data.glyphToGroup && i < header.glyphCount; i++) {
+    consistent = data.glyphToGroup[i] < header.groupCount;
+  }
+  for (uint16_t i = 0; consistent && i < header.glyphLookupSize; i++) {
+    consistent = data.glyphLookup[i] <= header.glyphCount;
+  }
+  if (!consistent) {
+    data = {};
+    return false;
+  }
+
+  data.intervalCount = header.intervalCount;
+  data.advanceY = header.advanceY;
+  data.ascender = header.ascender;
+  data.descender = header.descender;
+  data.is2Bit = header.is2Bit != 0;
+  data.groupCount = header.groupCount;
+  data.kernLeftEntryCount = header.kernLeftEntryCount;
+  data.kernRightEntryCount = header.kernRightEntryCount;
+  data.kernLeftClassCount = header.kernLeftClassCount;
+  data.kernRightClassCount = header.kernRightClassCount;
+  data.ligaturePairCount = header.ligaturePairCount;
+  data.glyphLookupSize = header.glyphLookupSize;
+  return true;
+}
+}  // namespace EpdFontImage
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+
+#include "EpdFontData.h"
+
+/**
+ * The .epdfont container written by scripts/epdfont_file.py: a header, the tables in the in-memory layout of the
+ * EpdFontData structs, then the compressed glyph groups. SdFont reads one from the card into RAM; FontPartition
+ * points straight at the copies in its memory-mapped flash partition.
+ */
+namespace EpdFontImage {
+struct Header {
+  char magic[4];
+  uint16_t version;
+  uint8_t is2Bit;
+  uint8_t advanceY;
+  int16_t ascender;
+  int16_t descender;
+  uint32_t intervalCount;
+  uint32_t glyphCount;
+  uint16_t groupCount;
+  uint8_t hasGlyphToGroup;
+  uint8_t kernLeftClassCount;
+  uint8_t kernRightClassCount;
+  uint8_t reserved0;
+  uint16_t kernLeftEntryCount;
+  uint16_t kernRightEntryCount;
+  uint16_t glyphLookupSize;
+  uint32_t ligaturePairCount;
+  uint32_t tablesSize;
+  uint32_t bitmapOffset;
+  uint32_t bitmapSize;
+  uint32_t contentHash;
+};
+static_assert(sizeof(Header) == 52, "Header must match scripts/epdfont_file.py");
+
+constexpr uint32_t pad4(const uint32_t n) { return (n + 3) & ~3u; }
+
+// Whether header is a supported version and its tables and groups fit in imageSize bytes
+bool checkHeader(const Header& header, uint64_t imageSize);
+// Points data's tables into tables (header.tablesSize bytes) and fills in the header's fields, after checking every
+// index into the glyph and group tables. Leaves the bitmap, the pair lookups and readBitmap to the caller.
+bool bindTables(const Header& header, const uint8_t* tables, EpdFontData& data);
+}  // namespace EpdFontImage
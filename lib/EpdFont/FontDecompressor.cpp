@@ -2,25 +2,82 @@
 
 #include <Arduino.h>
 #include <Logging.h>
+#include <MemoryBudget.h>
 #include <Utf8.h>
 
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+
+namespace {
+// Decompressed bytes a streamed group passes through at a time, at least; more when a needed glyph is larger
+constexpr uint32_t STREAM_WINDOW_BYTES = 512;
+// Compressed bytes a streamed group on storage is read in
+constexpr uint32_t STREAM_INPUT_BYTES = 256;
+
+// Compressed input of a streamed group on storage
+struct GroupStream {
+  InflateReader reader;  // Must be first, see InflateReader
+  const EpdFontData* fontData = nullptr;
+  uint32_t nextOffset = 0;
+  uint32_t endOffset = 0;
+  uint8_t input[STREAM_INPUT_BYTES];
+};
+
+int groupStreamReadCallback(uzlib_uncomp* uncomp) {
+  auto* stream = reinterpret_cast<GroupStream*>(uncomp);
+  const uint32_t toRead = std::min(stream->endOffset - stream->nextOffset, STREAM_INPUT_BYTES);
+  if (toRead == 0 ||
+      !stream->fontData->readBitmap(stream->fontData->readContext, stream->nextOffset, stream->input, toRead)) {
+    return -1;
+  }
+  stream->nextOffset += toRead;
+  uncomp->source = stream->input + 1;
+  uncomp->source_limit = stream->input + toRead;
+  return stream->input[0];
+}
+}  // namespace
 
 FontDecompressor::~FontDecompressor() { deinit(); }
 
 bool FontDecompressor::init() {
   clearCache();
+  // Any group is inflated again in a few milliseconds
+  MemoryBudget::registerCache(this, "font groups", MemoryBudget::EVICT_FIRST,
+                              [this] { return evictOldestGroup(nullptr); });
   return true;
 }
 
 void FontDecompressor::deinit() {
-  freePageBuffer();
-  freeHotGroup();
+  MemoryBudget::unregisterCache(this);
+  clearCache();
+  releaseGroupCache();
 }
 
 void FontDecompressor::clearCache() {
   freePageBuffer();
-  freeHotGroup();
+  hotGlyphBuf.clear();
+  hotGlyphBuf.shrink_to_fit();
+}
+
+void FontDecompressor::releaseGroupCache() {
+  for (auto& entry : cachedGroups) {
+    evictGroup(entry);
+  }
+}
+
+void FontDecompressor::setGroupCacheBudget(const uint32_t bytes) {
+  groupCacheBudget = bytes;
+  trimGroupCache(0, nullptr);
+}
+
+void FontDecompressor::setPlanarGlyphs(const bool planarGlyphs) {
+  if (planarGlyphs != planar) {
+    clearCache();
+    planar = planarGlyphs;
+  }
 }
 
 void FontDecompressor::freePageBuffer() {
@@ -32,13 +89,88 @@ void FontDecompressor::freePageBuffer() {
   pageSlotCount = 0;
 }
 
-void FontDecompressor::freeHotGroup() {
-  hotGroup.clear();
-  hotGroup.shrink_to_fit();
-  hotGroupFont = nullptr;
-  hotGroupIndex = UINT16_MAX;
-  hotGlyphBuf.clear();
-  hotGlyphBuf.shrink_to_fit();
+// --- Group cache ---
+
+FontDecompressor::CachedGroup* FontDecompressor::findGroup(const EpdFontData* fontData, const uint16_t groupIndex) {
+  for (auto& entry : cachedGroups) {
+    if (entry.data && entry.fontData == fontData && entry.groupIndex == groupIndex) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+void FontDecompressor::evictGroup(CachedGroup& entry) {
+  if (!entry.data) return;
+  free(entry.data);
+  groupCacheBytes -= entry.size;
+  entry = {};
+}
+
+bool FontDecompressor::evictOldestGroup(const CachedGroup* keep) {
+  CachedGroup* oldest = nullptr;
+  for (auto& entry : cachedGroups) {
+    if (entry.data && &entry != keep && (!oldest || entry.lastUse < oldest->lastUse)) {
+      oldest = &entry;
+    }
+  }
+  if (!oldest) return false;
+  evictGroup(*oldest);
+  return true;
+}
+
+void FontDecompressor::trimGroupCache(const uint32_t extraBytes, const CachedGroup* keep) {
+  while (groupCacheBytes + extraBytes > groupCacheBudget || ESP.getFreeHeap() < GROUP_CACHE_MIN_FREE_HEAP) {
+    if (!evictOldestGroup(keep)) return;
+  }
+}
+
+const uint8_t* FontDecompressor::acquireGroup(const EpdFontData* fontData, const uint16_t groupIndex) {
+  if (CachedGroup* entry = findGroup(fontData, groupIndex)) {
+    entry->lastUse = ++groupUseCounter;
+    stats.groupCacheBytes = groupCacheBytes;
+    return entry->data;
+  }
+
+  const EpdFontGroup& group = fontData->groups[groupIndex];
+  trimGroupCache(group.uncompressedSize, nullptr);
+
+  // Take a free entry, or the least recently used one if all are taken
+  CachedGroup* slot = &cachedGroups[0];
+  for (auto& entry : cachedGroups) {
+    if (!entry.data) {
+      slot = &entry;
+      break;
+    }
+    if (entry.lastUse < slot->lastUse) slot = &entry;
+  }
+  evictGroup(*slot);
+
+  auto* data = static_cast<uint8_t*>(malloc(group.uncompressedSize));
+  if (!data) {
+    // Heap too fragmented for this group: give back everything else and try once more
+    releaseGroupCache();
+    data = static_cast<uint8_t*>(malloc(group.uncompressedSize));
+  }
+  if (!data) {
+    LOG_ERR("FDC", "Failed to allocate %u bytes for group %u", group.uncompressedSize, groupIndex);
+    return nullptr;
+  }
+  if (!decompressGroup(fontData, groupIndex, data, group.uncompressedSize)) {
+    free(data);
+    return nullptr;
+  }
+
+  *slot = {fontData, groupIndex, data, group.uncompressedSize, ++groupUseCounter};
+  groupCacheBytes += group.uncompressedSize;
+  stats.groupsInflated++;
+  if (group.uncompressedSize > stats.peakTempBytes) {
+    stats.peakTempBytes = group.uncompressedSize;
+  }
+  // The new group may have pushed free heap under the threshold
+  trimGroupCache(0, slot);
+  stats.groupCacheBytes = groupCacheBytes;
+  return data;
 }
 
 uint16_t FontDecompressor::getGroupIndex(const EpdFontData* fontData, uint32_t glyphIndex) {
@@ -62,14 +194,117 @@ bool FontDecompressor::decompressGroup(const EpdFontData* fontData, uint16_t gro
   const EpdFontGroup& group = fontData->groups[groupIndex];
 
   const uint32_t tDecomp = millis();
+  // Fonts on storage: fetch the compressed group with one positioned read, then inflate it from memory
+  uint8_t* compressed = nullptr;
+  if (fontData->readBitmap) {
+    compressed = static_cast<uint8_t*>(malloc(group.compressedSize));
+    if (!compressed || !fontData->readBitmap(fontData->readContext, group.compressedOffset, compressed,
+                                             group.compressedSize)) {
+      LOG_ERR("FDC", "Failed to read group %u (%u bytes) from storage", groupIndex, group.compressedSize);
+      free(compressed);
+      stats.decompressTimeMs += millis() - tDecomp;
+      return false;
+    }
+  }
+
   inflateReader.init(false);
-  inflateReader.setSource(&fontData->bitmap[group.compressedOffset], group.compressedSize);
-  if (!inflateReader.read(outBuf, outSize)) {
-    stats.decompressTimeMs += millis() - tDecomp;
+  inflateReader.setSource(compressed ? compressed : &fontData->bitmap[group.compressedOffset], group.compressedSize);
+  const bool ok = inflateReader.read(outBuf, outSize);
+  free(compressed);
+  stats.decompressTimeMs += millis() - tDecomp;
+  if (!ok) {
     LOG_ERR("FDC", "Decompression failed for group %u", groupIndex);
     return false;
   }
+  return true;
+}
+
+bool FontDecompressor::shouldStreamGroup(const EpdFontGroup& group) const {
+  return group.uncompressedSize > groupCacheBudget ||
+         ESP.getFreeHeap() < GROUP_CACHE_MIN_FREE_HEAP + group.uncompressedSize;
+}
+
+bool FontDecompressor::streamGroupGlyphs(const EpdFontData* fontData, const uint16_t groupIndex, PageSlot& slot,
+                                         uint32_t& writeOffset) {
+  const EpdFontGroup& group = fontData->groups[groupIndex];
+  uint32_t windowSize = STREAM_WINDOW_BYTES;
+  for (uint16_t i = 0; i < slot.glyphCount; i++) {
+    if (slot.glyphs[i].bufferOffset == UINT32_MAX && getGroupIndex(fontData, slot.glyphs[i].glyphIndex) == groupIndex) {
+      windowSize = std::max(windowSize, alignedBytes(fontData->glyph[slot.glyphs[i].glyphIndex]));
+    }
+  }
+
+  // Off the stack, as uzlib's trees make it over a kilobyte. The pooled inflate window is reserved at boot; taking a
+  // new one from the heap would cost more than the group.
+  std::unique_ptr<GroupStream> stream(new (std::nothrow) GroupStream);
+  if (!stream || !stream->reader.init(true, /*pooledWindowOnly=*/true)) {
+    return false;
+  }
+  auto* window = static_cast<uint8_t*>(malloc(windowSize));
+  if (!window) {
+    return false;
+  }
+  if (fontData->readBitmap) {
+    stream->fontData = fontData;
+    stream->nextOffset = group.compressedOffset;
+    stream->endOffset = group.compressedOffset + group.compressedSize;
+    stream->reader.setReadCallback(groupStreamReadCallback);
+  } else {
+    stream->reader.setSource(&fontData->bitmap[group.compressedOffset], group.compressedSize);
+  }
+
+  const uint32_t tDecomp = millis();
+  // Group bytes [windowStart, windowStart + windowFill) are in the window. Glyphs come in glyph index order, which is
+  // also the order of their aligned offsets within a group, so the stream only moves forward.
+  uint32_t windowStart = 0;
+  uint32_t windowFill = 0;
+  bool ok = true;
+  for (uint16_t i = 0; ok && i < slot.glyphCount; i++) {
+    PageGlyphEntry& entry = slot.glyphs[i];
+    if (entry.bufferOffset != UINT32_MAX || getGroupIndex(fontData, entry.glyphIndex) != groupIndex) continue;
+    const EpdGlyph& glyph = fontData->glyph[entry.glyphIndex];
+
+    // Drop the bytes before the glyph, inflating past those not read yet
+    if (entry.alignedOffset < windowStart + windowFill) {
+      const uint32_t drop = entry.alignedOffset - windowStart;
+      memmove(window, window + drop, windowFill - drop);
+      windowFill -= drop;
+    } else {
+      uint32_t skip = entry.alignedOffset - (windowStart + windowFill);
+      windowFill = 0;
+      while (ok && skip > 0) {
+        const uint32_t chunk = std::min(skip, windowSize);
+        ok = stream->reader.read(window, chunk);
+        skip -= chunk;
+      }
+    }
+    windowStart = entry.alignedOffset;
+
+    // Fill the window, up to the end of the group, until it holds the glyph
+    const uint32_t size = alignedBytes(glyph);
+    if (ok && windowFill < size) {
+      const uint32_t chunk = std::min(windowSize, group.uncompressedSize - windowStart) - windowFill;
+      ok = size <= windowFill + chunk && stream->reader.read(window + windowFill, chunk);
+      windowFill += chunk;
+    }
+    if (!ok) break;
+
+    extractGlyph(window, &slot.buffer[writeOffset], glyph);
+    entry.bufferOffset = writeOffset;
+    writeOffset += extractedBytes(glyph);
+  }
+  free(window);
   stats.decompressTimeMs += millis() - tDecomp;
+
+  const uint32_t tempBytes = windowSize + sizeof(GroupStream);
+  if (tempBytes > stats.peakTempBytes) {
+    stats.peakTempBytes = tempBytes;
+  }
+  if (!ok) {
+    LOG_ERR("FDC", "Streaming decompression failed for group %u", groupIndex);
+    return false;
+  }
+  stats.groupsStreamed++;
   return true;
 }
 
@@ -126,7 +361,58 @@ void FontDecompressor::compactSingleGlyph(const uint8_t* alignedSrc, uint8_t* pa
   if (outBits > 0) packedDst[writeIdx] = outByte << (8 - outBits);
 }
 
-// --- getBitmap: page buffer → hot group → decompress ---
+namespace {
+// The high bits (high nibble) and low bits (low nibble) of the four 2-bit pixels of a byte, first pixel first
+constexpr uint8_t splitPixelPairs(const uint8_t pairs) {
+  return static_cast<uint8_t>((pairs >> 4 & 8) | (pairs >> 3 & 4) | (pairs >> 2 & 2) | (pairs >> 1 & 1)) << 4 |
+         ((pairs >> 3 & 8) | (pairs >> 2 & 4) | (pairs >> 1 & 2) | (pairs & 1));
+}
+}  // namespace
+
+void FontDecompressor::splitSingleGlyph(const uint8_t* alignedSrc, uint8_t* planesDst, uint8_t width,
+                                        uint8_t height) {
+  if (width == 0 || height == 0) return;
+  const uint32_t rowStride = (width + 3) / 4;
+  const uint32_t planeSize = (static_cast<uint32_t>(width) * height + 7) / 8;
+  uint8_t* hiPlane = planesDst;
+  uint8_t* loPlane = planesDst + planeSize;
+  // Four pixels at a time: bits collect at the bottom of the accumulators and leave a byte at a time
+  uint32_t hiBits = 0, loBits = 0, outBits = 0;
+  uint32_t writeIdx = 0;
+  for (uint8_t y = 0; y < height; y++) {
+    const uint8_t* row = &alignedSrc[y * rowStride];
+    for (uint8_t x = 0; x < width; x += 4) {
+      const uint8_t split = splitPixelPairs(row[x / 4]);
+      const uint32_t count = width - x < 4 ? width - x : 4;
+      hiBits = (hiBits << count) | ((split >> 4) >> (4 - count));
+      loBits = (loBits << count) | ((split & 0x0F) >> (4 - count));
+      outBits += count;
+      if (outBits >= 8) {
+        outBits -= 8;
+        hiPlane[writeIdx] = static_cast<uint8_t>(hiBits >> outBits);
+        loPlane[writeIdx++] = static_cast<uint8_t>(loBits >> outBits);
+      }
+    }
+  }
+  if (outBits > 0) {
+    hiPlane[writeIdx] = static_cast<uint8_t>(hiBits << (8 - outBits));
+    loPlane[writeIdx] = static_cast<uint8_t>(loBits << (8 - outBits));
+  }
+}
+
+uint32_t FontDecompressor::extractedBytes(const EpdGlyph& glyph) const {
+  return planar ? 2 * planeBytes(glyph) : glyph.dataLength;
+}
+
+void FontDecompressor::extractGlyph(const uint8_t* alignedSrc, uint8_t* dst, const EpdGlyph& glyph) const {
+  if (planar) {
+    splitSingleGlyph(alignedSrc, dst, glyph.width, glyph.height);
+  } else {
+    compactSingleGlyph(alignedSrc, dst, glyph.width, glyph.height);
+  }
+}
+
+// --- getBitmap: page buffer → group cache → decompress ---
 
 const uint8_t* FontDecompressor::getBitmap(const EpdFontData* fontData, const EpdGlyph* glyph, uint32_t glyphIndex) {
   const uint32_t tStart = micros();
@@ -151,7 +437,7 @@ const uint8_t* FontDecompressor::getBitmap(const EpdFontData* fontData, const Ep
           stats.getBitmapTimeUs += micros() - tStart;
           return &slot.buffer[slot.glyphs[mid].bufferOffset];
         }
-        break;  // Not extracted during prewarm; fall through to hot-group path
+        break;  // Not extracted during prewarm; fall through to the group cache
       }
       if (slot.glyphs[mid].glyphIndex < glyphIndex)
         left = mid + 1;
@@ -161,7 +447,7 @@ const uint8_t* FontDecompressor::getBitmap(const EpdFontData* fontData, const Ep
     break;  // Found the right slot but glyph wasn't in it; don't check other slots
   }
 
-  // Fallback: hot group slot
+  // Fallback: group cache
   uint16_t groupIndex = getGroupIndex(fontData, glyphIndex);
   if (groupIndex >= fontData->groupCount) {
     LOG_ERR("FDC", "Glyph %u not found in any group", glyphIndex);
@@ -169,39 +455,20 @@ const uint8_t* FontDecompressor::getBitmap(const EpdFontData* fontData, const Ep
     return nullptr;
   }
 
-  // Check if hot group already has this group decompressed — if not, decompress it
-  if (!(!hotGroup.empty() && hotGroupFont == fontData && hotGroupIndex == groupIndex)) {
-    stats.cacheMisses++;
-    const EpdFontGroup& group = fontData->groups[groupIndex];
-
-    hotGroup.resize(group.uncompressedSize);
-    if (hotGroup.empty()) {
-      LOG_ERR("FDC", "Failed to allocate %u bytes for hot group %u", group.uncompressedSize, groupIndex);
-      hotGroupFont = nullptr;
-      hotGroupIndex = UINT16_MAX;
-      stats.getBitmapTimeUs += micros() - tStart;
-      return nullptr;
-    }
-
-    if (!decompressGroup(fontData, groupIndex, hotGroup.data(), group.uncompressedSize)) {
-      hotGroup.clear();
-      hotGroup.shrink_to_fit();
-      hotGroupFont = nullptr;
-      hotGroupIndex = UINT16_MAX;
-      stats.getBitmapTimeUs += micros() - tStart;
-      return nullptr;
-    }
-
-    hotGroupFont = fontData;
-    hotGroupIndex = groupIndex;
-    stats.hotGroupBytes = group.uncompressedSize;
-  } else {
+  if (findGroup(fontData, groupIndex)) {
     stats.cacheHits++;
+  } else {
+    stats.cacheMisses++;
+  }
+  const uint8_t* groupData = acquireGroup(fontData, groupIndex);
+  if (!groupData) {
+    stats.getBitmapTimeUs += micros() - tStart;
+    return nullptr;
   }
 
   // Compact just the requested glyph from byte-aligned data into scratch buffer
-  if (glyph->dataLength > hotGlyphBuf.size()) {
-    hotGlyphBuf.resize(glyph->dataLength);
+  if (extractedBytes(*glyph) > hotGlyphBuf.size()) {
+    hotGlyphBuf.resize(extractedBytes(*glyph));
   }
   if (hotGlyphBuf.empty()) {
     stats.getBitmapTimeUs += micros() - tStart;
@@ -209,7 +476,7 @@ const uint8_t* FontDecompressor::getBitmap(const EpdFontData* fontData, const Ep
   }
 
   uint32_t alignedOff = getAlignedOffset(fontData, groupIndex, glyphIndex);
-  compactSingleGlyph(&hotGroup[alignedOff], hotGlyphBuf.data(), glyph->width, glyph->height);
+  extractGlyph(&groupData[alignedOff], hotGlyphBuf.data(), *glyph);
   stats.getBitmapTimeUs += micros() - tStart;
   return hotGlyphBuf.data();
 }
@@ -222,6 +489,10 @@ int32_t FontDecompressor::findGlyphIndex(const EpdFontData* fontData, uint32_t c
 
   if (count == 0) return -1;
 
+  if (codepoint < fontData->glyphLookupSize) {
+    return static_cast<int32_t>(fontData->glyphLookup[codepoint]) - 1;
+  }
+
   // Binary search
   int left = 0;
   int right = count - 1;
@@ -245,46 +516,57 @@ int32_t FontDecompressor::findGlyphIndex(const EpdFontData* fontData, uint32_t c
 int FontDecompressor::prewarmCache(const EpdFontData* fontData, const char* utf8Text) {
   if (!fontData || !fontData->groups || !utf8Text) return 0;
 
-  // Allocate the next available slot (caller must call freePageBuffer/clearCache to reset)
-  if (pageSlotCount >= MAX_PAGE_SLOTS) {
-    LOG_ERR("FDC", "All %u page buffer slots full, cannot prewarm fontData=%p", MAX_PAGE_SLOTS, (void*)fontData);
-    return -1;
-  }
-  PageSlot& slot = pageSlots[pageSlotCount];
-
   // Step 1: Collect unique glyph indices needed for this page
   uint32_t neededGlyphs[MAX_PAGE_GLYPHS];
   uint16_t glyphCount = 0;
   bool glyphCapWarned = false;
 
-  const unsigned char* p = reinterpret_cast<const unsigned char*>(utf8Text);
-  while (*p) {
-    uint32_t cp = utf8NextCodepoint(&p);
-    if (cp == 0) break;
-
-    int32_t glyphIdx = findGlyphIndex(fontData, cp);
-    if (glyphIdx < 0) continue;
-
-    // Deduplicate
-    bool found = false;
-    for (uint16_t i = 0; i < glyphCount; i++) {
-      if (neededGlyphs[i] == static_cast<uint32_t>(glyphIdx)) {
-        found = true;
-        break;
+  size_t length = strlen(utf8Text);
+  uint32_t codepoints[32];
+  while (length > 0) {
+    size_t consumed;
+    const size_t count = utf8DecodeCodepoints(utf8Text, length, codepoints, 32, &consumed);
+    if (count == 0) break;
+    utf8Text += consumed;
+    length -= consumed;
+
+    for (size_t c = 0; c < count; c++) {
+      const int32_t glyphIdx = findGlyphIndex(fontData, codepoints[c]);
+      if (glyphIdx < 0) continue;
+
+      // Deduplicate
+      bool found = false;
+      for (uint16_t i = 0; i < glyphCount; i++) {
+        if (neededGlyphs[i] == static_cast<uint32_t>(glyphIdx)) {
+          found = true;
+          break;
+        }
       }
-    }
-    if (!found) {
-      if (glyphCount < MAX_PAGE_GLYPHS) {
-        neededGlyphs[glyphCount++] = static_cast<uint32_t>(glyphIdx);
-      } else if (!glyphCapWarned) {
-        LOG_DBG("FDC", "Glyph cap (%u) reached during prewarm; excess glyphs will use hot-group fallback",
-                MAX_PAGE_GLYPHS);
-        glyphCapWarned = true;
+      if (!found) {
+        if (glyphCount < MAX_PAGE_GLYPHS) {
+          neededGlyphs[glyphCount++] = static_cast<uint32_t>(glyphIdx);
+        } else if (!glyphCapWarned) {
+          LOG_DBG("FDC", "Glyph cap (%u) reached during prewarm; excess glyphs will use group cache fallback",
+                  MAX_PAGE_GLYPHS);
+          glyphCapWarned = true;
+        }
       }
     }
   }
 
-  if (glyphCount == 0) return 0;
+  return prewarmGlyphs(fontData, neededGlyphs, glyphCount);
+}
+
+int FontDecompressor::prewarmGlyphs(const EpdFontData* fontData, const uint32_t* neededGlyphs,
+                                    const uint16_t glyphCount) {
+  if (!fontData || !fontData->groups || glyphCount == 0) return 0;
+
+  // Allocate the next available slot (caller must call freePageBuffer/clearCache to reset)
+  if (pageSlotCount >= MAX_PAGE_SLOTS) {
+    LOG_ERR("FDC", "All %u page buffer slots full, cannot prewarm fontData=%p", MAX_PAGE_SLOTS, (void*)fontData);
+    return -1;
+  }
+  PageSlot& slot = pageSlots[pageSlotCount];
 
   // Step 2: Compute total buffer size and collect unique groups
   uint32_t totalBytes = 0;
@@ -293,7 +575,7 @@ int FontDecompressor::prewarmCache(const EpdFontData* fontData, const char* utf8
   bool groupCapWarned = false;
 
   for (uint16_t i = 0; i < glyphCount; i++) {
-    totalBytes += fontData->glyph[neededGlyphs[i]].dataLength;
+    totalBytes += extractedBytes(fontData->glyph[neededGlyphs[i]]);
     uint16_t gi = getGroupIndex(fontData, neededGlyphs[i]);
     bool found = false;
     for (uint8_t j = 0; j < groupCount; j++) {
@@ -306,7 +588,7 @@ int FontDecompressor::prewarmCache(const EpdFontData* fontData, const char* utf8
       if (groupCount < 128) {
         neededGroups[groupCount++] = gi;
       } else if (!groupCapWarned) {
-        LOG_DBG("FDC", "Group cap (128) reached during prewarm; some groups will use hot-group fallback");
+        LOG_DBG("FDC", "Group cap (128) reached during prewarm; some groups will use group cache fallback");
         groupCapWarned = true;
       }
     }
@@ -336,7 +618,7 @@ int FontDecompressor::prewarmCache(const EpdFontData* fontData, const char* utf8
     slot.glyphs[i] = {neededGlyphs[i], UINT32_MAX, 0};
   }
 
-  // Sort by glyphIndex for binary search in getBitmap()
+  // Sort by glyphIndex for binary search in getBitmap() (a single pass if they come sorted)
   for (uint16_t i = 1; i < glyphCount; i++) {
     PageGlyphEntry key = slot.glyphs[i];
     int j = i - 1;
@@ -417,43 +699,40 @@ int FontDecompressor::prewarmCache(const EpdFontData* fontData, const char* utf8
     }
   }
 
-  // Step 4: For each unique group, decompress to temp buffer and extract needed glyphs
+  // Step 4: For each unique group, get it from the group cache and extract needed glyphs. Groups that are already
+  // cached go first, so inflating the new ones can't evict them before they are used.
   uint32_t writeOffset = 0;
   int missed = 0;
 
-  for (uint8_t g = 0; g < groupCount; g++) {
-    uint16_t groupIdx = neededGroups[g];
-    const EpdFontGroup& group = fontData->groups[groupIdx];
+  for (uint8_t pass = 0; pass < 2; pass++) {
+    for (uint8_t g = 0; g < groupCount; g++) {
+      const uint16_t groupIdx = neededGroups[g];
+      if ((findGroup(fontData, groupIdx) != nullptr) != (pass == 0)) continue;
 
-    auto* tempBuf = static_cast<uint8_t*>(malloc(group.uncompressedSize));
-    if (!tempBuf) {
-      LOG_ERR("FDC", "Failed to allocate temp buffer (%u bytes) for group %u", group.uncompressedSize, groupIdx);
-      missed++;
-      continue;
-    }
-    if (group.uncompressedSize > stats.peakTempBytes) {
-      stats.peakTempBytes = group.uncompressedSize;
-    }
+      // Groups the cache can't take without a spike are inflated past instead, holding no more than a glyph or so
+      if (pass == 1 && shouldStreamGroup(fontData->groups[groupIdx]) &&
+          streamGroupGlyphs(fontData, groupIdx, slot, writeOffset)) {
+        continue;
+      }
 
-    if (!decompressGroup(fontData, groupIdx, tempBuf, group.uncompressedSize)) {
-      free(tempBuf);
-      missed++;
-      continue;
-    }
+      const uint8_t* groupData = acquireGroup(fontData, groupIdx);
+      if (!groupData) {
+        missed++;
+        continue;
+      }
 
-    // Extract needed glyphs directly from the byte-aligned temp buffer, compacting on the fly.
-    // alignedOffset was pre-computed in step 3b — no full-group compact scan needed.
-    for (uint16_t i = 0; i < slot.glyphCount; i++) {
-      if (slot.glyphs[i].bufferOffset != UINT32_MAX) continue;  // already extracted
-      if (getGroupIndex(fontData, slot.glyphs[i].glyphIndex) != groupIdx) continue;
+      // Extract needed glyphs directly from the byte-aligned group, compacting (or splitting into planes) on the fly.
+      // alignedOffset was pre-computed in step 3b — no full-group compact scan needed.
+      for (uint16_t i = 0; i < slot.glyphCount; i++) {
+        if (slot.glyphs[i].bufferOffset != UINT32_MAX) continue;  // already extracted
+        if (getGroupIndex(fontData, slot.glyphs[i].glyphIndex) != groupIdx) continue;
 
-      const EpdGlyph& glyph = fontData->glyph[slot.glyphs[i].glyphIndex];
-      compactSingleGlyph(&tempBuf[slot.glyphs[i].alignedOffset], &slot.buffer[writeOffset], glyph.width, glyph.height);
-      slot.glyphs[i].bufferOffset = writeOffset;
-      writeOffset += glyph.dataLength;
+        const EpdGlyph& glyph = fontData->glyph[slot.glyphs[i].glyphIndex];
+        extractGlyph(&groupData[slot.glyphs[i].alignedOffset], &slot.buffer[writeOffset], glyph);
+        slot.glyphs[i].bufferOffset = writeOffset;
+        writeOffset += extractedBytes(glyph);
+      }
     }
-
-    free(tempBuf);
   }
 
   LOG_DBG("FDC", "Prewarm: %u glyphs in %u bytes from %u groups (%d missed)", glyphCount, writeOffset, groupCount,
@@ -470,9 +749,10 @@ void FontDecompressor::logStats(const char* label) {
   const uint32_t total = stats.cacheHits + stats.cacheMisses;
   LOG_DBG("FDC", "[%s] hits=%lu misses=%lu (%.1f%% hit rate)", label, stats.cacheHits, stats.cacheMisses,
           total > 0 ? 100.0f * stats.cacheHits / total : 0.0f);
-  LOG_DBG("FDC", "[%s] decompress=%lums groups_accessed=%u", label, stats.decompressTimeMs, stats.uniqueGroupsAccessed);
-  LOG_DBG("FDC", "[%s] mem: pageBuf=%lu pageGlyphs=%lu hotGroup=%lu peakTemp=%lu", label, stats.pageBufferBytes,
-          stats.pageGlyphsBytes, stats.hotGroupBytes, stats.peakTempBytes);
+  LOG_DBG("FDC", "[%s] decompress=%lums groups_accessed=%u groups_inflated=%u groups_streamed=%u", label,
+          stats.decompressTimeMs, stats.uniqueGroupsAccessed, stats.groupsInflated, stats.groupsStreamed);
+  LOG_DBG("FDC", "[%s] mem: pageBuf=%lu pageGlyphs=%lu groupCache=%lu peakGroup=%lu", label, stats.pageBufferBytes,
+          stats.pageGlyphsBytes, stats.groupCacheBytes, stats.peakTempBytes);
   if (stats.getBitmapCalls > 0) {
     LOG_DBG("FDC", "[%s] getBitmap: %lu calls, %luus total, %luus/call avg", label, stats.getBitmapCalls,
             stats.getBitmapTimeUs, stats.getBitmapTimeUs / stats.getBitmapCalls);
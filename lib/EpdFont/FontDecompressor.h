@@ -10,34 +10,62 @@ class FontDecompressor {
  public:
   static constexpr uint16_t MAX_PAGE_GLYPHS = 512;
   static constexpr uint8_t MAX_PAGE_SLOTS = 4;  // One per font style (R/B/I/BI)
+  static constexpr uint8_t MAX_CACHED_GROUPS = 8;
+  static constexpr uint32_t DEFAULT_GROUP_CACHE_BUDGET = 48 * 1024;
+  // Cached groups beyond the one in use are dropped while free heap is below this
+  static constexpr uint32_t GROUP_CACHE_MIN_FREE_HEAP = 64 * 1024;
 
   FontDecompressor() = default;
   ~FontDecompressor();
 
+  // Registers the decompressed groups with MemoryBudget, which drops them first when a large allocation needs room
   bool init();
   void deinit();
 
   // Returns pointer to decompressed bitmap data for the given glyph.
-  // Checks the page buffer (from prewarm) first, then falls back to the hot group slot.
+  // Checks the page buffer (from prewarm) first, then falls back to the group cache.
+  // Compressed glyphs come as bit planes (see setPlanarGlyphs) unless that is turned off.
   const uint8_t* getBitmap(const EpdFontData* fontData, const EpdGlyph* glyph, uint32_t glyphIndex);
 
-  // Free all cached data (page buffer + hot group).
+  // Layout of the glyphs getBitmap() returns for compressed (2-bit) fonts. Planar: the high bits of the pixels, then
+  // the low bits, each plane a continuous bit stream of planeBytes(); a gray pass then reads one or two bits per pixel
+  // instead of unpacking pairs. Packed: the 2-bit stream of uncompressed fonts. Changing it frees the page buffers.
+  void setPlanarGlyphs(bool planar);
+  bool planarGlyphs() const { return planar; }
+  // Bytes of one plane of a planar glyph
+  static uint32_t planeBytes(const EpdGlyph& glyph) {
+    return (static_cast<uint32_t>(glyph.width) * glyph.height + 7) / 8;
+  }
+
+  // Free the page buffers. Decompressed groups are kept, so the next page in the same fonts skips most inflates.
   void clearCache();
 
+  // Free the decompressed groups too, for callers that need the memory back.
+  void releaseGroupCache();
+  // Upper bound for the decompressed groups kept across pages; 0 keeps only the group in use.
+  void setGroupCacheBudget(uint32_t bytes);
+
   // Pre-scan UTF-8 text and extract needed glyph bitmaps into a flat page buffer.
-  // Each group is decompressed once into a temp buffer; only needed glyphs are kept.
+  // Each group is decompressed once, into the group cache while it has room; otherwise it is streamed through a
+  // small window (see streamGroupGlyphs). Only needed glyphs are kept.
   // Returns the number of glyphs that couldn't be loaded (0 on full success).
   int prewarmCache(const EpdFontData* fontData, const char* utf8Text);
+  // Same for glyphs already looked up: count distinct glyph indices of fontData, best sorted ascending
+  int prewarmGlyphs(const EpdFontData* fontData, const uint32_t* glyphIndices, uint16_t count);
+  // Index of the glyph for a codepoint in fontData, -1 if it has none
+  static int32_t findGlyphIndex(const EpdFontData* fontData, uint32_t codepoint);
 
   struct Stats {
     uint32_t cacheHits = 0;
     uint32_t cacheMisses = 0;
     uint32_t decompressTimeMs = 0;
     uint16_t uniqueGroupsAccessed = 0;
+    uint16_t groupsInflated = 0;     // group cache misses
+    uint16_t groupsStreamed = 0;     // groups prewarm inflated past without holding them
     uint32_t pageBufferBytes = 0;  // pageBuffer allocation
     uint32_t pageGlyphsBytes = 0;  // pageGlyphs lookup table allocation
-    uint32_t hotGroupBytes = 0;    // current hot group allocation
-    uint32_t peakTempBytes = 0;    // largest temp buffer in prewarm
+    uint32_t groupCacheBytes = 0;  // decompressed groups held after the last access
+    uint32_t peakTempBytes = 0;    // largest group inflated, or streaming scratch
     uint32_t getBitmapTimeUs = 0;  // cumulative getBitmap time (micros)
     uint32_t getBitmapCalls = 0;   // number of getBitmap calls
   };
@@ -48,6 +76,7 @@ class FontDecompressor {
  private:
   Stats stats;
   InflateReader inflateReader;
+  bool planar = true;
 
   // Page buffer slots: each style gets its own flat glyph buffer with sorted lookup.
   // Up to MAX_PAGE_SLOTS (4) styles can be prewarmed simultaneously.
@@ -65,21 +94,51 @@ class FontDecompressor {
   PageSlot pageSlots[MAX_PAGE_SLOTS] = {};
   uint8_t pageSlotCount = 0;
 
-  // Hot group: last decompressed group (byte-aligned) for non-prewarmed fallback path.
-  // Kept in byte-aligned format; individual glyphs are compacted on demand into hotGlyphBuf.
-  const EpdFontData* hotGroupFont = nullptr;
-  uint16_t hotGroupIndex = UINT16_MAX;
-  std::vector<uint8_t> hotGroup;
+  // Recently decompressed groups (byte-aligned), shared by prewarm and the non-prewarmed fallback path and kept
+  // across pages up to groupCacheBudget bytes. Least recently used groups are evicted first.
+  struct CachedGroup {
+    const EpdFontData* fontData = nullptr;
+    uint16_t groupIndex = UINT16_MAX;
+    uint8_t* data = nullptr;
+    uint32_t size = 0;
+    uint32_t lastUse = 0;
+  };
+  CachedGroup cachedGroups[MAX_CACHED_GROUPS] = {};
+  uint32_t groupCacheBytes = 0;
+  uint32_t groupCacheBudget = DEFAULT_GROUP_CACHE_BUDGET;
+  uint32_t groupUseCounter = 0;
 
-  // Scratch buffer for compacting a single glyph from the hot group.
+  // Scratch buffer for compacting a single glyph from a cached group.
   // Valid until the next getBitmap() call.
   std::vector<uint8_t> hotGlyphBuf;
 
   void freePageBuffer();
-  void freeHotGroup();
+  // Returns the decompressed group, inflating it into the cache if needed. Valid until the next acquireGroup() call.
+  const uint8_t* acquireGroup(const EpdFontData* fontData, uint16_t groupIndex);
+  CachedGroup* findGroup(const EpdFontData* fontData, uint16_t groupIndex);
+  void evictGroup(CachedGroup& entry);
+  // Evicts the least recently used group other than keep; false if there is none
+  bool evictOldestGroup(const CachedGroup* keep);
+  // Evicts least recently used groups other than keep until extraBytes more fit in the budget and free heap allows
+  void trimGroupCache(uint32_t extraBytes, const CachedGroup* keep);
   uint16_t getGroupIndex(const EpdFontData* fontData, uint32_t glyphIndex);
   uint32_t getAlignedOffset(const EpdFontData* fontData, uint16_t groupIndex, uint32_t glyphIndex);
   bool decompressGroup(const EpdFontData* fontData, uint16_t groupIndex, uint8_t* outBuf, uint32_t outSize);
+  // Whether prewarm should stream a group that isn't cached rather than inflate it whole into the cache: when the
+  // cache couldn't keep it, or free heap is too low to hold it without evicting other groups
+  bool shouldStreamGroup(const EpdFontGroup& group) const;
+  // Inflates a group a window at a time through the pooled inflate window, extracting the slot's glyphs of the group
+  // as their bytes pass by, so no more than the window and the largest of those glyphs is held. False if no pooled
+  // window was free or inflating failed; glyphs extracted until then keep their place.
+  bool streamGroupGlyphs(const EpdFontData* fontData, uint16_t groupIndex, PageSlot& slot, uint32_t& writeOffset);
+  // Bytes a glyph takes in the page buffer and hotGlyphBuf
+  uint32_t extractedBytes(const EpdGlyph& glyph) const;
+  // Bytes a glyph takes in its byte-aligned group
+  static uint32_t alignedBytes(const EpdGlyph& glyph) {
+    return glyph.width > 0 && glyph.height > 0 ? static_cast<uint32_t>((glyph.width + 3) / 4) * glyph.height : 0;
+  }
+  // Copies a glyph out of its byte-aligned group in the current layout
+  void extractGlyph(const uint8_t* alignedSrc, uint8_t* dst, const EpdGlyph& glyph) const;
   static void compactSingleGlyph(const uint8_t* alignedSrc, uint8_t* packedDst, uint8_t width, uint8_t height);
-  static int32_t findGlyphIndex(const EpdFontData* fontData, uint32_t codepoint);
+  static void splitSingleGlyph(const uint8_t* alignedSrc, uint8_t* planesDst, uint8_t width, uint8_t height);
 };
@@ -0,0 +1,135 @@
+#include "FontPartition.h"
+
+#include <Logging.h>
+
+#include <cstring>
+#include <new>
+
+#include "EpdFontImage.h"
+
+namespace {
+constexpr char MAGIC[4] = {'E', 'P', 'F', 'B'};
+constexpr uint16_t VERSION = 1;
+constexpr size_t NAME_SIZE = 32;
+// Past Latin Extended-B the fonts have no pair lookups (scripts/pair_lookup.py)
+constexpr uint16_t PAIR_LOOKUP_LIMIT = 0x250;
+
+struct BundleHeader {
+  char magic[4];
+  uint16_t version;
+  uint16_t fontCount;
+  uint32_t size;
+  uint32_t contentHash;
+};
+static_assert(sizeof(BundleHeader) == 16, "BundleHeader must match scripts/build_font_partition.py");
+}  // namespace
+
+struct FontPartition::Entry {
+  char name[NAME_SIZE];
+  uint32_t imageOffset;
+  uint32_t imageSize;
+  uint32_t lookupsOffset;
+  uint16_t kernLookupSize;
+  uint16_t ligatureStartsSize;
+};
+
+bool FontPartition::mount() {
+  static_assert(sizeof(Entry) == 48, "Entry must match scripts/build_font_partition.py");
+  if (base) {
+    return true;
+  }
+  const esp_partition_t* partition =
+      esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, LABEL);
+  if (!partition) {
+    LOG_INF("FNP", "No font partition");
+    return false;
+  }
+
+  // The header is read first, so only the bundle is mapped rather than the whole partition
+  BundleHeader header;
+  if (esp_partition_read(partition, 0, &header, sizeof(header)) != ESP_OK ||
+      memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION) {
+    LOG_ERR("FNP", "Font partition holds no version %u bundle", VERSION);
+    return false;
+  }
+  if (header.size > partition->size || header.fontCount == 0 ||
+      sizeof(header) + static_cast<uint64_t>(header.fontCount) * sizeof(Entry) > header.size) {
+    LOG_ERR("FNP", "Font bundle header is invalid");
+    return false;
+  }
+
+  const void* mapped = nullptr;
+  if (esp_partition_mmap(partition, 0, header.size, ESP_PARTITION_MMAP_DATA, &mapped, &mapping) != ESP_OK) {
+    LOG_ERR("FNP", "Failed to map %lu bytes of the font partition", static_cast<unsigned long>(header.size));
+    return false;
+  }
+  data.reset(new (std::nothrow) EpdFontData[header.fontCount]());
+  if (!data) {
+    esp_partition_munmap(mapping);
+    return false;
+  }
+
+  base = static_cast<const uint8_t*>(mapped);
+  size = header.size;
+  contentHash = header.contentHash;
+  entries = reinterpret_cast<const Entry*>(base + sizeof(header));
+  fontCount = header.fontCount;
+  LOG_INF("FNP", "Mapped font bundle: %u fonts, %lu bytes", fontCount, static_cast<unsigned long>(size));
+  return true;
+}
+
+const FontPartition::Entry* FontPartition::find(const char* name) const {
+  for (uint16_t i = 0; i < fontCount; i++) {
+    if (strncmp(entries[i].name, name, NAME_SIZE) == 0) {
+      return &entries[i];
+    }
+  }
+  return nullptr;
+}
+
+uint32_t FontPartition::getFontHash(const char* name) const {
+  const Entry* entry = find(name);
+  if (!entry || entry->imageOffset % 4 != 0 ||
+      static_cast<uint64_t>(entry->imageOffset) + sizeof(EpdFontImage::Header) > size) {
+    return 0;
+  }
+  return reinterpret_cast<const EpdFontImage::Header*>(base + entry->imageOffset)->contentHash;
+}
+
+bool FontPartition::bind(EpdFont& font, const char* name) {
+  const Entry* entry = find(name);
+  if (!entry) {
+    return false;
+  }
+  const uint32_t lookupsSize = 2 * entry->kernLookupSize + entry->ligatureStartsSize / 8;
+  if (entry->imageOffset % 4 != 0 || static_cast<uint64_t>(entry->imageOffset) + entry->imageSize > size ||
+      entry->imageSize < sizeof(EpdFontImage::Header) || entry->kernLookupSize > PAIR_LOOKUP_LIMIT ||
+      entry->ligatureStartsSize > PAIR_LOOKUP_LIMIT ||
+      static_cast<uint64_t>(entry->lookupsOffset) + lookupsSize > size) {
+    LOG_ERR("FNP", "Font %s has an invalid entry", name);
+    return false;
+  }
+
+  const uint8_t* image = base + entry->imageOffset;
+  const auto& header = *reinterpret_cast<const EpdFontImage::Header*>(image);
+  EpdFontData& fontData = data[entry - entries];
+  if (!EpdFontImage::checkHeader(header, entry->imageSize) ||
+      !EpdFontImage::bindTables(header, image + sizeof(header), fontData)) {
+    LOG_ERR("FNP", "Font %s is not a valid font image", name);
+    return false;
+  }
+  fontData.bitmap = image + header.bitmapOffset;
+
+  const uint8_t* lookups = base + entry->lookupsOffset;
+  if (entry->kernLookupSize > 0 && fontData.kernMatrix) {
+    fontData.kernLeftLookup = lookups;
+    fontData.kernRightLookup = lookups + entry->kernLookupSize;
+    fontData.kernLookupSize = entry->kernLookupSize;
+  }
+  if (entry->ligatureStartsSize > 0 && fontData.ligaturePairs) {
+    fontData.ligatureStarts = lookups + 2 * entry->kernLookupSize;
+    fontData.ligatureStartsSize = entry->ligatureStartsSize;
+  }
+  font.data = &fontData;
+  return true;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <esp_partition.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "EpdFont.h"
+
+/**
+ * Fonts kept in the "fonts" flash partition instead of the app image, in the bundle written by
+ * scripts/build_font_partition.py: .epdfont images (see EpdFontImage.h) with their pair lookups, found by name.
+ *
+ * mount() memory-maps the bundle through the flash cache, so a bound font's tables and compressed glyph groups are
+ * read in place just like a builtin font's const arrays; only its EpdFontData, a few pointers, is kept in RAM. The
+ * mapping lasts until the next reset.
+ */
+class FontPartition {
+ public:
+  static constexpr char LABEL[] = "fonts";
+
+  // Maps the bundle and checks its header and entries; false if the partition is missing, blank or invalid
+  bool mount();
+  bool isMounted() const { return base != nullptr; }
+  // Points font at the font called name; false, leaving font as it was, if the bundle has no valid font of that name
+  bool bind(EpdFont& font, const char* name);
+  // Hash of the bundle's contents, written by the bundler; differs between any two bundles
+  uint32_t getContentHash() const { return contentHash; }
+  // Content hash of the .epdfont image of the font called name, 0 if there is none
+  uint32_t getFontHash(const char* name) const;
+
+ private:
+  struct Entry;
+
+  const uint8_t* base = nullptr;
+  uint32_t size = 0;
+  uint32_t contentHash = 0;
+  const Entry* entries = nullptr;
+  uint16_t fontCount = 0;
+  esp_partition_mmap_handle_t mapping = 0;
+  // One per entry, filled as fonts are bound
+  std::unique_ptr<EpdFontData[]> data;
+
+  const Entry* find(const char* name) const;
+};
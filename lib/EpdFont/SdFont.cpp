@@ -0,0 +1,112 @@
+#include "SdFont.h"
+
+#include <Logging.h>
+
+#include <cstdlib>
+#include <cstring>
+
+#include "EpdFontImage.h"
+
+namespace {
+using EpdFontImage::pad4;
+
+// The tables must fit the heap next to everything else; a CJK font's glyph table is the largest realistic case
+constexpr uint32_t MAX_TABLES_SIZE = 160 * 1024;
+
+// The file doesn't store the direct kerning class and ligature start lookups fontconvert.py emits for built-in fonts
+// (see scripts/pair_lookup.py), so they are built on load after the tables
+constexpr uint16_t PAIR_LOOKUP_LIMIT = 0x250;
+constexpr uint32_t PAIR_LOOKUP_BYTES = 2 * PAIR_LOOKUP_LIMIT + PAIR_LOOKUP_LIMIT / 8;
+
+void buildPairLookups(EpdFontData& data, uint8_t* buffer) {
+  memset(buffer, 0, PAIR_LOOKUP_BYTES);
+  if (data.kernMatrix) {
+    uint8_t* left = buffer;
+    uint8_t* right = buffer + PAIR_LOOKUP_LIMIT;
+    for (uint16_t i = 0; i < data.kernLeftEntryCount; i++) {
+      const EpdKernClassEntry& entry = data.kernLeftClasses[i];
+      if (entry.codepoint < PAIR_LOOKUP_LIMIT) left[entry.codepoint] = entry.classId;
+    }
+    for (uint16_t i = 0; i < data.kernRightEntryCount; i++) {
+      const EpdKernClassEntry& entry = data.kernRightClasses[i];
+      if (entry.codepoint < PAIR_LOOKUP_LIMIT) right[entry.codepoint] = entry.classId;
+    }
+    data.kernLeftLookup = left;
+    data.kernRightLookup = right;
+    data.kernLookupSize = PAIR_LOOKUP_LIMIT;
+  }
+  if (data.ligaturePairs && data.ligaturePairCount > 0) {
+    uint8_t* starts = buffer + 2 * PAIR_LOOKUP_LIMIT;
+    for (uint32_t i = 0; i < data.ligaturePairCount; i++) {
+      const uint32_t cp = data.ligaturePairs[i].pair >> 16;
+      if (cp < PAIR_LOOKUP_LIMIT) starts[cp >> 3] |= 1u << (cp & 7);
+    }
+    data.ligatureStarts = starts;
+    data.ligatureStartsSize = PAIR_LOOKUP_LIMIT;
+  }
+}
+}  // namespace
+
+bool SdFont::load(const char* path) {
+  unload();
+  if (!Storage.openFileForRead("SDF", path, file)) {
+    return false;
+  }
+
+  EpdFontImage::Header header;
+  if (file.read(&header, sizeof(header)) != sizeof(header) || !EpdFontImage::checkHeader(header, file.fileSize()) ||
+      header.tablesSize > MAX_TABLES_SIZE) {
+    LOG_ERR("SDF", "%s is not a supported font file", path);
+    file.close();
+    return false;
+  }
+
+  tables = static_cast<uint8_t*>(malloc(pad4(header.tablesSize) + PAIR_LOOKUP_BYTES));
+  if (!tables) {
+    LOG_ERR("SDF", "Not enough memory for the tables of %s (%lu bytes)", path,
+            static_cast<unsigned long>(header.tablesSize));
+    file.close();
+    return false;
+  }
+  if (file.read(tables, header.tablesSize) != static_cast<int>(header.tablesSize)) {
+    LOG_ERR("SDF", "Failed to read the tables of %s", path);
+    unload();
+    return false;
+  }
+
+  if (!EpdFontImage::bindTables(header, tables, data)) {
+    LOG_ERR("SDF", "%s: tables out of range", path);
+    unload();
+    return false;
+  }
+  buildPairLookups(data, tables + pad4(header.tablesSize));
+  data.readBitmap = &SdFont::readBitmap;
+  data.readContext = this;
+
+  tablesSize = pad4(header.tablesSize) + PAIR_LOOKUP_BYTES;
+  bitmapOffset = header.bitmapOffset;
+  bitmapSize = header.bitmapSize;
+  contentHash = header.contentHash;
+  LOG_DBG("SDF", "Loaded %s: %lu glyphs, %u groups, %lu bytes in RAM", path,
+          static_cast<unsigned long>(header.glyphCount), header.groupCount, static_cast<unsigned long>(tablesSize));
+  return true;
+}
+
+void SdFont::unload() {
+  free(tables);
+  tables = nullptr;
+  tablesSize = 0;
+  data = {};
+  if (file) {
+    file.close();
+  }
+}
+
+bool SdFont::readBitmap(void* context, const uint32_t offset, uint8_t* buffer, const uint32_t length) {
+  auto* self = static_cast<SdFont*>(context);
+  if (!self->file || static_cast<uint64_t>(offset) + length > self->bitmapSize) {
+    return false;
+  }
+  return self->file.seekSet(self->bitmapOffset + offset) &&
+         self->file.read(buffer, length) == static_cast<int>(length);
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <HalStorage.h>
+
+#include <cstdint>
+
+#include "EpdFont.h"
+
+/**
+ * A compressed font loaded from an .epdfont file (see scripts/epdfont_file.py) instead of flash.
+ *
+ * The glyph, interval, group, kerning and ligature tables are read into one allocation on load, since layout touches
+ * them for every character, followed by the direct kerning class and ligature start lookups built from them. The compressed glyph groups, which are most of the file, stay on the card:
+ * FontDecompressor fetches a group with a positioned read through EpdFontData::readBitmap when it needs to inflate it.
+ * The file therefore stays open while the font is loaded.
+ */
+class SdFont {
+ public:
+  SdFont() = default;
+  ~SdFont() { unload(); }
+  SdFont(const SdFont&) = delete;
+  SdFont& operator=(const SdFont&) = delete;
+
+  bool load(const char* path);
+  // Callers must drop FontDecompressor's group cache first, it is keyed by the EpdFontData this frees
+  void unload();
+  bool isLoaded() const { return tables != nullptr; }
+  const EpdFont* getFont() const { return isLoaded() ? &font : nullptr; }
+  // Hash of the file's contents, written by the converter; differs between any two font files
+  uint32_t getContentHash() const { return contentHash; }
+  uint32_t getTablesSize() const { return tablesSize; }
+
+ private:
+  FsFile file;
+  uint8_t* tables = nullptr;
+  uint32_t tablesSize = 0;
+  uint32_t bitmapOffset = 0;
+  uint32_t bitmapSize = 0;
+  uint32_t contentHash = 0;
+  EpdFontData data = {};
+  EpdFont font{&data};
+
+  static bool readBitmap(void* context, uint32_t offset, uint8_t* buffer, uint32_t length);
+};
@@ -2884,6 +2884,89 @@ static const EpdUnicodeInterval bookerly_12_bolditalicIntervals[] = {
     { 0xFFFD, 0xFFFD, 0x3A9 },
 };
 
+static const uint16_t bookerly_12_bolditalicGlyphLookup[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53,
+    54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+    86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+    133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+    149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
+    165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
+    181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+    197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+    213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+    229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+    245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260,
+    261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276,
+    277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292,
+    293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+    309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    325, 326, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 327,
+    328, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340,
+    341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356,
+    357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372,
+    373, 374, 375, 376, 377, 378, 0, 0, 379, 380, 381, 382, 383, 384, 385, 386,
+    387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402,
+    403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    419, 420, 421, 422, 423, 0, 424, 425, 426, 427, 428, 429, 430, 0, 0, 431,
+    0, 432, 433, 434, 435, 436, 0, 0, 0, 0, 0, 437, 0, 0, 0, 0,
+    0, 0, 0, 438, 439, 440, 441, 442, 443, 444, 0, 0, 0, 445, 446, 0,
+    447, 448, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 449, 0, 450, 451, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467,
+    468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483,
+    484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+    516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547,
+    0, 0, 548, 549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 550, 551, 552, 553, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 554, 555, 556, 557, 558, 559,
+    560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575,
+    576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639,
+    640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655,
+    656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671,
+};
+
 static const EpdFontGroup bookerly_12_bolditalicGroups[] = {
     { 0, 3615, 6789, 100, 0 },
     { 3615, 3160, 8280, 96, 100 },
@@ -4464,6 +4547,88 @@ static const EpdLigaturePair bookerly_12_bolditalicLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t bookerly_12_bolditalicKernLeftLookup[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 1, 2, 0, 3, 0, 4, 5, 4, 6,
+    7, 0, 0, 8, 9, 10, 11, 12, 13, 14, 15, 15, 0, 0, 0, 0,
+    0, 16, 17, 18, 19, 20, 21, 22, 23, 23, 24, 25, 26, 27, 28, 19,
+    29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 0, 0, 0,
+    0, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 49, 49, 43,
+    43, 54, 55, 56, 57, 42, 58, 58, 59, 58, 60, 61, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 62, 0, 0, 0, 63, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 65,
+    16, 16, 16, 16, 16, 16, 20, 18, 20, 20, 20, 20, 23, 23, 23, 23,
+    19, 28, 19, 19, 19, 19, 19, 0, 19, 34, 34, 34, 34, 38, 66, 67,
+    42, 42, 42, 42, 42, 42, 46, 68, 46, 46, 46, 46, 50, 69, 70, 70,
+    43, 49, 43, 43, 43, 43, 43, 0, 71, 42, 42, 42, 42, 58, 43, 58,
+    16, 42, 16, 42, 72, 73, 18, 44, 18, 44, 18, 44, 18, 44, 19, 74,
+    19, 45, 20, 46, 20, 46, 20, 46, 75, 76, 20, 46, 22, 48, 22, 48,
+    22, 48, 22, 48, 23, 49, 77, 49, 23, 70, 23, 70, 23, 70, 78, 79,
+    23, 42, 24, 51, 24, 80, 25, 52, 81, 26, 53, 26, 82, 0, 74, 0,
+    0, 26, 83, 28, 49, 28, 49, 28, 49, 49, 28, 51, 19, 43, 19, 43,
+    19, 43, 20, 46, 31, 55, 31, 55, 31, 55, 32, 56, 32, 56, 32, 84,
+    32, 56, 33, 85, 33, 0, 33, 57, 34, 42, 34, 42, 34, 42, 34, 42,
+    34, 42, 34, 86, 35, 58, 38, 58, 38, 39, 60, 39, 60, 39, 60, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    87, 88, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89,
+    90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 39, 60, 60, 24, 51, 51, 24, 51, 51, 16, 42, 23,
+    70, 19, 43, 34, 42, 34, 42, 34, 42, 34, 42, 34, 42, 43, 16, 42,
+    16, 42, 20, 46, 22, 91, 22, 48, 25, 52, 19, 92, 19, 43, 93, 94,
+    80, 39, 60, 60, 22, 48, 0, 0, 28, 49, 16, 42, 20, 46, 19, 71,
+    16, 42, 16, 42, 20, 46, 20, 46, 23, 70, 23, 70, 19, 43, 19, 43,
+    31, 55, 31, 55, 34, 42, 34, 42, 32, 56, 33, 95, 17, 96, 23, 49,
+};
+
+static const uint8_t bookerly_12_bolditalicKernRightLookup[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 0, 0, 3, 0, 2, 0, 4, 5, 0, 6, 7, 8, 9,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 0, 0, 0, 22,
+    0, 23, 24, 25, 24, 26, 26, 25, 26, 26, 27, 26, 26, 28, 26, 25,
+    24, 25, 24, 29, 30, 31, 32, 32, 33, 34, 35, 0, 36, 37, 0, 0,
+    0, 38, 39, 38, 38, 38, 40, 41, 42, 43, 44, 42, 42, 45, 45, 38,
+    45, 38, 45, 46, 47, 48, 49, 49, 50, 51, 52, 0, 0, 53, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 7, 0, 0,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 57,
+    23, 23, 23, 23, 23, 23, 58, 25, 26, 26, 26, 26, 26, 26, 26, 26,
+    24, 26, 25, 25, 25, 25, 25, 0, 25, 31, 31, 31, 31, 34, 26, 59,
+    38, 38, 38, 38, 60, 38, 38, 38, 38, 38, 38, 38, 61, 43, 62, 62,
+    38, 45, 38, 38, 38, 38, 38, 0, 63, 48, 48, 48, 48, 49, 64, 49,
+    23, 38, 23, 38, 23, 38, 25, 38, 25, 38, 25, 38, 25, 65, 24, 38,
+    24, 38, 26, 38, 26, 38, 26, 38, 26, 38, 26, 38, 25, 41, 25, 41,
+    25, 41, 25, 41, 26, 42, 26, 66, 26, 62, 26, 62, 26, 62, 26, 43,
+    26, 45, 26, 43, 27, 67, 26, 42, 45, 26, 42, 26, 42, 26, 42, 26,
+    42, 26, 68, 26, 45, 26, 45, 26, 45, 45, 26, 45, 25, 38, 25, 38,
+    25, 38, 25, 38, 24, 45, 24, 45, 24, 45, 29, 46, 29, 46, 29, 46,
+    29, 69, 30, 47, 30, 47, 30, 47, 31, 48, 31, 48, 31, 48, 31, 48,
+    31, 48, 31, 48, 32, 49, 34, 49, 34, 35, 52, 35, 52, 35, 70, 59,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    25, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+    48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 24, 24, 38, 26, 26, 42, 26, 26, 45, 23, 38, 26,
+    62, 25, 38, 31, 48, 31, 48, 31, 48, 31, 48, 31, 48, 71, 23, 38,
+    23, 38, 58, 38, 25, 72, 25, 41, 26, 42, 25, 38, 25, 38, 73, 74,
+    67, 24, 24, 38, 25, 41, 0, 0, 26, 45, 23, 38, 58, 38, 25, 63,
+    23, 38, 23, 38, 26, 38, 26, 38, 26, 62, 26, 62, 25, 38, 25, 38,
+    24, 45, 24, 45, 31, 48, 31, 48, 29, 46, 30, 47, 75, 76, 26, 42,
+};
+
+static const uint8_t bookerly_12_bolditalicLigatureStarts[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const EpdFontData bookerly_12_bolditalic = {
     bookerly_12_bolditalicBitmaps,
     bookerly_12_bolditalicGlyphs,
@@ -4485,4 +4650,12 @@ static const EpdFontData bookerly_12_bolditalic = {
     134,
     bookerly_12_bolditalicLigaturePairs,
     5,
+    bookerly_12_bolditalicGlyphLookup,
+    1280,
+    bookerly_12_bolditalicKernLeftLookup,
+    bookerly_12_bolditalicKernRightLookup,
+    544,
+    bookerly_12_bolditalicLigatureStarts,
+    592,
+    938,
 };
@@ -2603,6 +2603,89 @@ static const EpdUnicodeInterval bookerly_12_regularIntervals[] = {
     { 0xFFFD, 0xFFFD, 0x3A9 },
 };
 
+static const uint16_t bookerly_12_regularGlyphLookup[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53,
+    54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+    86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+    133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+    149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
+    165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
+    181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+    197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+    213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+    229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+    245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260,
+    261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276,
+    277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292,
+    293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+    309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    325, 326, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 327,
+    328, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340,
+    341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356,
+    357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372,
+    373, 374, 375, 376, 377, 378, 0, 0, 379, 380, 381, 382, 383, 384, 385, 386,
+    387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402,
+    403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    419, 420, 421, 422, 423, 0, 424, 425, 426, 427, 428, 429, 430, 0, 0, 431,
+    0, 432, 433, 434, 435, 436, 0, 0, 0, 0, 0, 437, 0, 0, 0, 0,
+    0, 0, 0, 438, 439, 440, 441, 442, 443, 444, 0, 0, 0, 445, 446, 0,
+    447, 448, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 449, 0, 450, 451, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467,
+    468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483,
+    484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+    516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547,
+    0, 0, 548, 549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 550, 551, 552, 553, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 554, 555, 556, 557, 558, 559,
+    560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575,
+    576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639,
+    640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655,
+    656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671,
+};
+
 static const EpdFontGroup bookerly_12_regularGroups[] = {
     { 0, 3057, 5926, 100, 0 },
     { 3057, 2776, 7374, 96, 100 },
@@ -4198,6 +4281,88 @@ static const EpdLigaturePair bookerly_12_regularLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t bookerly_12_regularKernLeftLookup[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 1, 2, 0, 3, 4, 5, 6, 5, 7,
+    8, 9, 10, 11, 12, 8, 10, 13, 14, 15, 16, 16, 4, 4, 4, 0,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 25, 26, 27, 28, 29, 30, 21,
+    31, 32, 33, 34, 35, 36, 37, 37, 38, 39, 40, 41, 42, 0, 0, 0,
+    0, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 50, 50, 44,
+    44, 55, 56, 57, 58, 59, 60, 60, 61, 60, 62, 63, 0, 0, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 6, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 0, 0, 0, 67,
+    18, 18, 18, 18, 18, 18, 22, 20, 22, 22, 22, 22, 25, 25, 25, 25,
+    21, 30, 21, 21, 21, 21, 21, 4, 68, 36, 36, 36, 36, 39, 69, 70,
+    43, 43, 43, 43, 43, 43, 47, 45, 47, 47, 47, 47, 51, 51, 71, 71,
+    72, 50, 44, 44, 44, 44, 44, 4, 73, 59, 59, 59, 59, 60, 44, 60,
+    18, 43, 18, 43, 74, 75, 20, 45, 20, 45, 20, 45, 20, 45, 21, 76,
+    21, 46, 22, 47, 22, 47, 22, 47, 77, 78, 22, 47, 24, 49, 24, 49,
+    24, 49, 24, 49, 25, 50, 25, 50, 25, 71, 25, 71, 25, 71, 79, 80,
+    25, 51, 26, 52, 26, 81, 27, 53, 53, 28, 54, 28, 54, 0, 76, 0,
+    0, 28, 82, 30, 50, 30, 50, 30, 50, 50, 30, 50, 21, 44, 21, 44,
+    21, 44, 22, 47, 33, 56, 33, 56, 33, 56, 34, 57, 34, 57, 34, 57,
+    34, 57, 35, 83, 35, 0, 35, 58, 36, 59, 36, 59, 36, 59, 36, 59,
+    36, 59, 36, 84, 37, 60, 39, 60, 39, 40, 62, 40, 62, 40, 62, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    85, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87,
+    88, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 40, 62, 62, 26, 52, 52, 26, 52, 52, 18, 43, 25,
+    71, 21, 44, 36, 59, 36, 59, 36, 59, 36, 59, 36, 59, 44, 18, 43,
+    18, 43, 22, 47, 24, 89, 24, 49, 27, 53, 21, 44, 21, 44, 0, 90,
+    81, 40, 62, 62, 24, 49, 0, 0, 30, 50, 18, 43, 22, 47, 91, 44,
+    18, 43, 18, 43, 22, 47, 22, 47, 25, 71, 25, 71, 21, 44, 21, 44,
+    33, 56, 33, 56, 36, 59, 36, 59, 34, 57, 35, 58, 19, 92, 25, 50,
+};
+
+static const uint8_t bookerly_12_regularKernRightLookup[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 0, 0, 0, 0, 2, 0, 3, 4, 5, 6, 7, 8, 9,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 0, 19, 20, 5, 5, 5, 21,
+    0, 22, 23, 24, 23, 23, 23, 24, 23, 23, 25, 23, 23, 26, 23, 24,
+    23, 24, 23, 27, 28, 29, 30, 30, 31, 32, 33, 0, 34, 35, 0, 0,
+    0, 36, 37, 38, 38, 38, 39, 40, 41, 42, 43, 41, 41, 44, 44, 38,
+    45, 38, 44, 46, 47, 48, 49, 49, 50, 51, 52, 0, 0, 53, 5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 7, 0, 0,
+    55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 57,
+    22, 22, 22, 22, 22, 22, 58, 24, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 24, 24, 24, 24, 24, 5, 59, 29, 29, 29, 29, 32, 23, 60,
+    36, 36, 36, 61, 62, 36, 36, 38, 38, 38, 38, 63, 64, 42, 65, 66,
+    38, 44, 38, 38, 38, 38, 38, 5, 67, 48, 48, 48, 48, 51, 68, 51,
+    22, 69, 22, 70, 22, 36, 24, 38, 24, 38, 24, 38, 24, 38, 23, 38,
+    23, 38, 23, 71, 23, 71, 23, 38, 23, 38, 23, 38, 24, 40, 24, 40,
+    24, 40, 24, 40, 23, 41, 23, 72, 23, 66, 23, 66, 23, 66, 23, 42,
+    23, 42, 23, 42, 25, 73, 23, 41, 44, 23, 41, 23, 41, 23, 41, 23,
+    41, 23, 74, 23, 44, 23, 44, 23, 44, 44, 23, 44, 24, 38, 24, 38,
+    24, 38, 24, 38, 23, 44, 23, 44, 23, 75, 27, 46, 27, 46, 27, 46,
+    27, 76, 28, 47, 28, 47, 28, 47, 29, 48, 29, 48, 29, 48, 29, 48,
+    29, 48, 29, 48, 30, 49, 32, 51, 32, 33, 52, 33, 52, 33, 77, 60,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    24, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29,
+    48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 23, 23, 38, 23, 23, 41, 23, 23, 44, 22, 36, 23,
+    66, 24, 38, 29, 48, 29, 48, 29, 48, 29, 48, 29, 48, 78, 22, 36,
+    22, 36, 58, 36, 24, 79, 24, 40, 23, 41, 24, 38, 24, 38, 80, 81,
+    0, 23, 23, 38, 24, 40, 0, 0, 23, 44, 22, 36, 58, 36, 82, 38,
+    22, 36, 22, 36, 23, 38, 23, 38, 23, 66, 23, 66, 24, 38, 24, 38,
+    23, 44, 23, 44, 29, 48, 29, 48, 27, 46, 28, 47, 83, 84, 23, 41,
+};
+
+static const uint8_t bookerly_12_regularLigatureStarts[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const EpdFontData bookerly_12_regular = {
     bookerly_12_regularBitmaps,
     bookerly_12_regularGlyphs,
@@ -4219,4 +4384,12 @@ static const EpdFontData bookerly_12_regular = {
     134,
     bookerly_12_regularLigaturePairs,
     5,
+    bookerly_12_regularGlyphLookup,
+    1280,
+    bookerly_12_regularKernLeftLookup,
+    bookerly_12_regularKernRightLookup,
+    544,
+    bookerly_12_regularLigatureStarts,
+    592,
+    938,
 };
@@ -3025,6 +3025,89 @@ static const EpdUnicodeInterval bookerly_14_boldIntervals[] = {
     { 0xFFFD, 0xFFFD, 0x3A9 },
 };
 
+static const uint16_t bookerly_14_boldGlyphLookup[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53,
+    54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+    86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+    133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+    149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
+    165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
+    181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+    197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+    213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+    229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+    245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260,
+    261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276,
+    277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292,
+    293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+    309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    325, 326, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 327,
+    328, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340,
+    341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356,
+    357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372,
+    373, 374, 375, 376, 377, 378, 0, 0, 379, 380, 381, 382, 383, 384, 385, 386,
+    387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402,
+    403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    419, 420, 421, 422, 423, 0, 424, 425, 426, 427, 428, 429, 430, 0, 0, 431,
+    0, 432, 433, 434, 435, 436, 0, 0, 0, 0, 0, 437, 0, 0, 0, 0,
+    0, 0, 0, 438, 439, 440, 441, 442, 443, 444, 0, 0, 0, 445, 446, 0,
+    447, 448, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 449, 0, 450, 451, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467,
+    468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483,
+    484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+    516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547,
+    0, 0, 548, 549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 550, 551, 552, 553, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 554, 555, 556, 557, 558, 559,
+    560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575,
+    576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639,
+    640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655,
+    656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671,
+};
+
 static const EpdFontGroup bookerly_14_boldGroups[] = {
     { 0, 3852, 8467, 100, 0 },
     { 3852, 3444, 10249, 96, 100 },
@@ -4616,6 +4699,88 @@ static const EpdLigaturePair bookerly_14_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t bookerly_14_boldKernLeftLookup[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 1, 2, 0, 3, 4, 5, 6, 5, 7,
+    8, 9, 10, 8, 11, 12, 13, 14, 15, 16, 17, 17, 4, 4, 4, 0,
+    18, 19, 20, 21, 22, 23, 24, 25, 26, 26, 27, 28, 29, 30, 31, 22,
+    32, 33, 34, 35, 36, 37, 38, 38, 39, 40, 41, 42, 43, 0, 0, 0,
+    0, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 51, 51, 45,
+    45, 56, 57, 58, 59, 60, 61, 61, 62, 61, 63, 64, 0, 0, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 0, 6, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 0, 0, 0, 68,
+    19, 19, 19, 19, 19, 19, 23, 21, 23, 23, 23, 23, 26, 26, 26, 26,
+    22, 31, 22, 22, 22, 22, 22, 4, 69, 37, 37, 37, 37, 40, 70, 71,
+    44, 44, 44, 44, 44, 44, 48, 46, 48, 48, 48, 48, 52, 52, 72, 72,
+    45, 51, 45, 45, 45, 45, 45, 4, 45, 60, 60, 60, 60, 61, 45, 61,
+    19, 44, 19, 44, 73, 74, 21, 46, 21, 46, 21, 46, 21, 46, 22, 75,
+    22, 76, 23, 48, 23, 48, 23, 48, 77, 78, 23, 48, 25, 50, 25, 50,
+    25, 50, 25, 50, 26, 51, 26, 51, 26, 72, 26, 72, 26, 72, 26, 79,
+    26, 52, 27, 53, 27, 80, 28, 54, 54, 29, 55, 29, 55, 0, 75, 0,
+    0, 29, 81, 31, 51, 31, 51, 31, 51, 51, 31, 51, 22, 45, 22, 45,
+    22, 45, 23, 48, 34, 57, 34, 57, 34, 57, 35, 58, 35, 58, 35, 58,
+    35, 58, 36, 82, 36, 83, 36, 59, 37, 60, 37, 60, 37, 60, 37, 60,
+    37, 60, 37, 84, 38, 61, 40, 61, 40, 41, 63, 41, 63, 41, 63, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    85, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87,
+    88, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 41, 63, 63, 27, 53, 53, 27, 53, 53, 19, 44, 26,
+    72, 22, 45, 37, 60, 37, 60, 37, 60, 37, 60, 37, 60, 45, 19, 44,
+    19, 44, 23, 48, 25, 89, 25, 50, 28, 54, 22, 45, 22, 45, 0, 90,
+    80, 41, 63, 63, 25, 50, 0, 0, 31, 51, 19, 44, 23, 48, 69, 45,
+    19, 44, 19, 44, 23, 48, 23, 48, 26, 72, 26, 72, 22, 45, 22, 45,
+    34, 57, 34, 57, 37, 60, 37, 60, 35, 58, 36, 59, 20, 91, 26, 51,
+};
+
+static const uint8_t bookerly_14_boldKernRightLookup[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 1, 0, 2, 3, 4, 5, 6, 7, 8,
+    9, 10, 11, 10, 12, 13, 14, 15, 16, 0, 17, 18, 4, 4, 4, 19,
+    0, 20, 21, 22, 21, 21, 21, 22, 21, 21, 23, 21, 21, 24, 21, 22,
+    21, 22, 21, 25, 26, 27, 28, 28, 29, 30, 31, 0, 32, 33, 0, 0,
+    0, 34, 35, 36, 36, 36, 37, 38, 39, 40, 41, 39, 39, 42, 42, 36,
+    43, 36, 42, 44, 45, 46, 47, 47, 48, 49, 50, 0, 0, 51, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 0, 6, 0, 0,
+    53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 55,
+    20, 20, 20, 20, 20, 20, 56, 22, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 22, 22, 22, 22, 22, 4, 57, 27, 27, 27, 27, 30, 21, 58,
+    34, 34, 34, 59, 60, 34, 34, 36, 36, 36, 36, 61, 62, 40, 63, 64,
+    36, 42, 36, 36, 36, 36, 65, 4, 66, 46, 46, 46, 46, 49, 67, 49,
+    20, 68, 20, 69, 20, 34, 22, 36, 22, 70, 22, 36, 22, 71, 21, 36,
+    21, 36, 21, 72, 21, 70, 21, 36, 21, 36, 21, 70, 22, 38, 22, 73,
+    22, 38, 22, 38, 21, 39, 21, 74, 21, 64, 21, 64, 21, 64, 21, 40,
+    21, 40, 21, 40, 23, 75, 21, 39, 42, 21, 39, 21, 39, 21, 39, 21,
+    39, 21, 76, 21, 42, 21, 42, 21, 42, 42, 21, 42, 22, 36, 22, 71,
+    22, 36, 22, 36, 21, 42, 21, 42, 21, 77, 25, 44, 25, 78, 25, 44,
+    25, 79, 26, 45, 26, 45, 26, 45, 27, 46, 27, 46, 27, 46, 27, 46,
+    27, 46, 27, 46, 28, 47, 30, 49, 30, 31, 50, 31, 50, 31, 80, 58,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27,
+    46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 21, 21, 36, 21, 21, 39, 21, 21, 42, 20, 34, 21,
+    64, 22, 36, 27, 46, 27, 46, 27, 46, 27, 46, 27, 46, 81, 20, 34,
+    20, 34, 56, 34, 22, 82, 22, 38, 21, 39, 22, 36, 22, 36, 83, 84,
+    75, 21, 21, 36, 22, 38, 0, 0, 21, 42, 20, 34, 56, 34, 57, 36,
+    20, 34, 20, 34, 21, 36, 21, 36, 21, 64, 21, 64, 22, 36, 22, 36,
+    21, 42, 21, 42, 27, 46, 27, 46, 25, 44, 26, 45, 85, 86, 21, 39,
+};
+
+static const uint8_t bookerly_14_boldLigatureStarts[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const EpdFontData bookerly_14_bold = {
     bookerly_14_boldBitmaps,
     bookerly_14_boldGlyphs,
@@ -4637,4 +4802,12 @@ static const EpdFontData bookerly_14_bold = {
     137,
     bookerly_14_boldLigaturePairs,
     5,
+    bookerly_14_boldGlyphLookup,
+    1280,
+    bookerly_14_boldKernLeftLookup,
+    bookerly_14_boldKernRightLookup,
+    544,
+    bookerly_14_boldLigatureStarts,
+    592,
+    938,
 };
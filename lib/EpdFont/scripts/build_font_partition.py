@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+"""
+Bundles compressed font headers generated by fontconvert.py (--2bit --compress) into the image of the "fonts" flash
+partition, read by FontPartition (lib/EpdFont/FontPartition.cpp), e.g.
+
+    python build_font_partition.py fonts.bin ../builtinFonts/bookerly_12_*.h ../builtinFonts/notosans_*.h
+
+Each font is stored under the name of its header file (bookerly_12_regular) as an .epdfont image, the same bytes
+build_sd_font.py writes, followed by the direct kerning class and ligature start lookups of pair_lookup.py that the
+.epdfont format leaves out, so the firmware can use the whole font in place.
+
+Layout, little-endian, every offset from the start of the partition and 4-byte aligned:
+  header (16 bytes)        magic "EPFB", uint16 version, uint16 fontCount, uint32 size, uint32 contentHash
+  entry[fontCount]         (48 bytes) char name[32], uint32 imageOffset, uint32 imageSize, uint32 lookupsOffset,
+                           uint16 kernLookupSize, uint16 ligatureStartsSize
+  per font: the .epdfont image, then kernLeftLookup[kernLookupSize], kernRightLookup[kernLookupSize],
+            ligatureStarts[ligatureStartsSize / 8]
+"""
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+from build_sd_font import read_font_header
+from epdfont_file import epdfont_bytes
+from pair_lookup import PAIR_LOOKUP_LIMIT, build_kern_lookups, build_ligature_starts
+
+MAGIC = b"EPFB"
+VERSION = 1
+HEADER = struct.Struct("<4sHHII")
+ENTRY = struct.Struct("<32sIIIHH")
+NAME_SIZE = 32
+
+assert HEADER.size == 16 and ENTRY.size == 48
+
+
+def _pad4(buf):
+    buf.extend(b"\0" * (-len(buf) % 4))
+
+
+def build_bundle(header_paths):
+    names = [os.path.splitext(os.path.basename(path))[0] for path in header_paths]
+    for name in names:
+        if len(name.encode()) >= NAME_SIZE:
+            sys.exit(f"{name}: font names are limited to {NAME_SIZE - 1} bytes")
+
+    body = bytearray()
+    body_start = HEADER.size + ENTRY.size * len(header_paths)
+    entries = []
+    for name, path in zip(names, header_paths):
+        font = read_font_header(path)
+        image = epdfont_bytes(**font)
+        image_offset = body_start + len(body)
+        body += image
+        _pad4(body)
+
+        kern_left, kern_right = build_kern_lookups(font['kern_left_classes'], font['kern_right_classes'])
+        starts = build_ligature_starts(font['ligature_pairs'])
+        lookups_offset = body_start + len(body)
+        body += bytes(kern_left) + bytes(kern_right) + bytes(starts)
+        _pad4(body)
+        entries.append(ENTRY.pack(name.encode(), image_offset, len(image), lookups_offset, len(kern_left),
+                                  PAIR_LOOKUP_LIMIT if starts else 0))
+        print(f"{name}: {len(font['glyphs'])} glyphs, {len(image)} bytes")
+
+    table = b"".join(entries)
+    size = body_start + len(body)
+    # Identifies the bundle, so a reflashed partition is told apart from the one it replaced
+    content_hash = zlib.crc32(bytes(body), zlib.crc32(table))
+    return HEADER.pack(MAGIC, VERSION, len(entries), size, content_hash) + table + bytes(body)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Bundle compressed font headers into a font partition image.")
+    parser.add_argument("output", help="path of the partition image to write")
+    parser.add_argument("headers", nargs="+", help="font headers generated by fontconvert.py --2bit --compress")
+    parser.add_argument("--max-size", type=lambda v: int(v, 0), help="fail if the image is larger (partition size)")
+    args = parser.parse_args()
+
+    bundle = build_bundle(args.headers)
+    if args.max_size is not None and len(bundle) > args.max_size:
+        sys.exit(f"{args.output}: {len(bundle)} bytes don't fit the {args.max_size} byte partition")
+    with open(args.output, "wb") as f:
+        f.write(bundle)
+    print(f"{args.output}: {len(args.headers)} fonts, {len(bundle)} bytes")
+
+
+if __name__ == '__main__':
+    main()
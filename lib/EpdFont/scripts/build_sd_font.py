@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+"""
+Converts a compressed font header generated by fontconvert.py (--2bit --compress) into an
+.epdfont file that the firmware loads from the SD card, e.g.
+
+    python build_sd_font.py ../builtinFonts/bookerly_14_regular.h /sdcard/fonts/medium/regular.epdfont
+
+fontconvert.py can also write the .epdfont directly with --sd-output.
+"""
+import argparse
+import re
+import sys
+
+from epdfont_file import write_epdfont
+from verify_compression import parse_glyphs, parse_groups, parse_hex_array, parse_intervals, parse_uint8_array
+
+
+def _array(content, ctype, name):
+    match = re.search(r'static const ' + ctype + r' ' + re.escape(name) + r'\[\d*\]\s*=\s*\{(.*?)\};', content,
+                      re.DOTALL)
+    return match.group(1) if match else None
+
+
+def _strip_comments(text):
+    return re.sub(r'//[^\n]*', '', text)
+
+
+def read_font_header(header_path):
+    """Parses a compressed font header into the keyword arguments of epdfont_file.epdfont_bytes()."""
+    with open(header_path, 'r') as f:
+        content = f.read()
+
+    data_match = re.search(r'static const EpdFontData (\w+) = \{(.*?)\};', content, re.DOTALL)
+    if not data_match:
+        sys.exit(f"{header_path}: no EpdFontData found")
+    font_name = data_match.group(1)
+    fields = [v.strip() for v in _strip_comments(data_match.group(2)).split(',') if v.strip()]
+    # bitmap, glyph, intervals, intervalCount, advanceY, ascender, descender, is2Bit, groups, groupCount,
+    # glyphToGroup, kernLeft, kernRight, kernMatrix, leftEntries, rightEntries, leftClasses, rightClasses,
+    # ligatures, ligatureCount
+    advance_y, ascender, descender = int(fields[4]), int(fields[5]), int(fields[6])
+    is_2bit = fields[7] == 'true'
+    kern_left_class_count, kern_right_class_count = int(fields[16]), int(fields[17])
+
+    groups_text = _array(content, 'EpdFontGroup', font_name + 'Groups')
+    if groups_text is None:
+        sys.exit(f"{header_path}: not a compressed font, regenerate it with --2bit --compress")
+    groups = [(g['compressedOffset'], g['compressedSize'], g['uncompressedSize'], g['glyphCount'],
+               g['firstGlyphIndex']) for g in parse_groups(groups_text)]
+    glyphs = [(g['width'], g['height'], g['advanceX'], g['left'], g['top'], g['dataLength'], g['dataOffset'])
+              for g in parse_glyphs(_strip_comments(_array(content, 'EpdGlyph', font_name + 'Glyphs')))]
+    intervals = parse_intervals(_array(content, 'EpdUnicodeInterval', font_name + 'Intervals'))
+    bitmap = parse_hex_array(_array(content, 'uint8_t', font_name + 'Bitmaps'))
+
+    g2g_text = _array(content, 'uint16_t', font_name + 'GlyphToGroup')
+    glyph_to_group = parse_uint8_array(g2g_text) if g2g_text else None
+
+    def kern_classes(suffix):
+        text = _array(content, 'EpdKernClassEntry', font_name + suffix)
+        if not text:
+            return []
+        return [(int(cp, 16), int(cls)) for cp, cls in
+                re.findall(r'\{\s*0x([0-9A-Fa-f]+)\s*,\s*(\d+)\s*\}', _strip_comments(text))]
+
+    matrix_text = _array(content, 'int8_t', font_name + 'KernMatrix')
+    kern_matrix = [int(v) for v in re.findall(r'-?\d+', matrix_text)] if matrix_text else []
+    ligature_text = _array(content, 'EpdLigaturePair', font_name + 'LigaturePairs')
+    ligature_pairs = [(int(a, 16), int(b, 16)) for a, b in
+                      re.findall(r'\{\s*0x([0-9A-Fa-f]+)\s*,\s*0x([0-9A-Fa-f]+)\s*\}',
+                                 _strip_comments(ligature_text))] if ligature_text else []
+
+    return dict(advance_y=advance_y, ascender=ascender, descender=descender, is_2bit=is_2bit, intervals=intervals,
+                glyphs=glyphs, groups=groups, bitmap=bitmap, glyph_to_group=glyph_to_group,
+                kern_left_classes=kern_classes('KernLeftClasses'), kern_right_classes=kern_classes('KernRightClasses'),
+                kern_matrix=kern_matrix, kern_left_class_count=kern_left_class_count,
+                kern_right_class_count=kern_right_class_count, ligature_pairs=ligature_pairs)
+
+
+def convert(header_path, output_path):
+    font = read_font_header(header_path)
+    write_epdfont(output_path, **font)
+    print(f"{output_path}: {len(font['glyphs'])} glyphs, {len(font['groups'])} groups, "
+          f"{len(font['bitmap'])} bytes of bitmaps")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a compressed font header into an SD card .epdfont file.")
+    parser.add_argument("header", help="font header generated by fontconvert.py --2bit --compress")
+    parser.add_argument("output", help="path of the .epdfont file to write")
+    args = parser.parse_args()
+    convert(args.header, args.output)
+
+
+if __name__ == '__main__':
+    main()
@@ -39,6 +39,25 @@ for size in ${OPENDYSLEXIC_FONT_SIZES[@]}; do
   done
 done
 
+# The UI fonts are uncompressed, so menus never go through FontDecompressor, and cover what the translations use plus
+# the scripts file names and book titles are written in, rather than every block the reading fonts have
+UI_CHARSET="$(mktemp)"
+trap 'rm -f "$UI_CHARSET"' EXIT
+(cd ../../.. && python scripts/gen_i18n.py --ui-charset "$UI_CHARSET")
+UI_SCRIPT_INTERVALS=(
+  --additional-intervals 0x0020,0x007E  # Basic Latin
+  --additional-intervals 0x00A0,0x017F  # Latin-1 Supplement, Latin Extended-A
+  --additional-intervals 0x01A0,0x01A1  # Latin Extended-B: Vietnamese
+  --additional-intervals 0x01AF,0x01B0
+  --additional-intervals 0x01C4,0x021F  # Latin Extended-B: European
+  --additional-intervals 0x0300,0x036F  # Combining Diacritical Marks, for decomposed file names
+  --additional-intervals 0x0400,0x04FF  # Cyrillic
+  --additional-intervals 0x1EA0,0x1EF9  # Vietnamese
+  --additional-intervals 0x2010,0x2027  # Dashes, quotes, ellipsis
+  --additional-intervals 0x20AC,0x20AC  # Euro sign
+  --additional-intervals 0xFFFD,0xFFFD  # Replacement Character
+)
+
 UI_FONT_SIZES=(10 12)
 UI_FONT_STYLES=("Regular" "Bold")
 
@@ -47,12 +66,13 @@ for size in ${UI_FONT_SIZES[@]}; do
     font_name="ubuntu_${size}_$(echo $style | tr '[:upper:]' '[:lower:]')"
     font_path="../builtinFonts/source/Ubuntu/Ubuntu-${style}.ttf"
     output_path="../builtinFonts/${font_name}.h"
-    python fontconvert.py $font_name $size $font_path > $output_path
+    python fontconvert.py $font_name $size $font_path --charset "$UI_CHARSET" "${UI_SCRIPT_INTERVALS[@]}" > $output_path
     echo "Generated $output_path"
   done
 done
 
-python fontconvert.py notosans_8_regular 8 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf > ../builtinFonts/notosans_8_regular.h
+python fontconvert.py notosans_8_regular 8 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf \
+  --charset "$UI_CHARSET" "${UI_SCRIPT_INTERVALS[@]}" > ../builtinFonts/notosans_8_regular.h
 
 echo ""
 echo "Running compression verification..."
@@ -0,0 +1,91 @@
+"""
+Writer for the .epdfont container read by SdFont and FontPartition (lib/EpdFont/EpdFontImage.h).
+
+Layout, little-endian:
+  header (52 bytes, see EpdFontImage::Header)
+  tables, each padded to 4 bytes, in this order:
+    EpdUnicodeInterval[intervalCount]   first, last, offset               (12 bytes)
+    EpdGlyph[glyphCount]                width .. dataOffset               (16 bytes, 2 padding bytes before dataOffset)
+    EpdFontGroup[groupCount]            compressedOffset .. firstGlyphIndex (20 bytes, 2 padding bytes)
+    uint16 glyphToGroup[glyphCount]     only if hasGlyphToGroup
+    EpdKernClassEntry[leftEntries]      codepoint, classId                (3 bytes, packed)
+    EpdKernClassEntry[rightEntries]
+    int8 kernMatrix[leftClasses * rightClasses]
+    EpdLigaturePair[ligaturePairCount]  pair, ligatureCp                  (8 bytes)
+    uint16 glyphLookup[glyphLookupSize] see glyph_lookup.py
+  compressed group data (bitmapSize bytes at bitmapOffset)
+
+The tables are the in-memory layout of the firmware structs, so the device reads them with a single read.
+"""
+import struct
+import zlib
+
+from glyph_lookup import build_glyph_lookup
+
+MAGIC = b"EPDF"
+VERSION = 1
+HEADER = struct.Struct("<4sHBBhhIIHBBBBHHHIIIII")
+INTERVAL = struct.Struct("<III")
+GLYPH = struct.Struct("<BBHhhH2xI")
+GROUP = struct.Struct("<IIIH2xI")
+KERN_CLASS = struct.Struct("<HB")
+LIGATURE = struct.Struct("<II")
+
+assert HEADER.size == 52
+
+
+def _pad4(buf):
+    buf.extend(b"\0" * (-len(buf) % 4))
+
+
+def epdfont_bytes(*, advance_y, ascender, descender, is_2bit, intervals, glyphs, groups, bitmap,
+                  glyph_to_group=None, kern_left_classes=(), kern_right_classes=(), kern_matrix=(),
+                  kern_left_class_count=0, kern_right_class_count=0, ligature_pairs=()):
+    """
+    intervals: [(first, last, offset)]
+    glyphs: [(width, height, advanceX, left, top, dataLength, dataOffset)]
+    groups: [(compressedOffset, compressedSize, uncompressedSize, glyphCount, firstGlyphIndex)]
+    kern_*_classes: [(codepoint, classId)], ligature_pairs: [(pair, ligatureCp)]
+    """
+    if not groups:
+        raise ValueError("SD fonts must be compressed (--2bit --compress)")
+
+    tables = bytearray()
+    for interval in intervals:
+        tables += INTERVAL.pack(*interval)
+    for glyph in glyphs:
+        tables += GLYPH.pack(*glyph)
+    for group in groups:
+        tables += GROUP.pack(*group)
+    if glyph_to_group:
+        tables += struct.pack(f"<{len(glyph_to_group)}H", *glyph_to_group)
+        _pad4(tables)
+    for entry in kern_left_classes:
+        tables += KERN_CLASS.pack(*entry)
+    _pad4(tables)
+    for entry in kern_right_classes:
+        tables += KERN_CLASS.pack(*entry)
+    _pad4(tables)
+    tables += struct.pack(f"<{len(kern_matrix)}b", *kern_matrix)
+    _pad4(tables)
+    for pair in ligature_pairs:
+        tables += LIGATURE.pack(*pair)
+    glyph_lookup = build_glyph_lookup(intervals)
+    tables += struct.pack(f"<{len(glyph_lookup)}H", *glyph_lookup)
+    _pad4(tables)
+
+    bitmap = bytes(bitmap)
+    bitmap_offset = HEADER.size + len(tables)
+    # Identifies the font contents, so section caches laid out with a different file are never reused
+    content_hash = zlib.crc32(bitmap, zlib.crc32(bytes(tables)))
+    header = HEADER.pack(MAGIC, VERSION, 1 if is_2bit else 0, advance_y, ascender, descender, len(intervals),
+                         len(glyphs), len(groups), 1 if glyph_to_group else 0, kern_left_class_count,
+                         kern_right_class_count, 0, len(kern_left_classes), len(kern_right_classes), len(glyph_lookup),
+                         len(ligature_pairs), len(tables), bitmap_offset, len(bitmap), content_hash)
+    return header + bytes(tables) + bitmap
+
+
+def write_epdfont(path, **font):
+    """Writes the .epdfont of font, the keyword arguments of epdfont_bytes()."""
+    with open(path, "wb") as f:
+        f.write(epdfont_bytes(**font))
@@ -7,6 +7,10 @@ import math
 import argparse
 from collections import namedtuple
 from fontTools.ttLib import TTFont
+from epdfont_file import write_epdfont
+from glyph_lookup import build_glyph_lookup
+from pair_lookup import build_kern_lookups, build_ligature_starts
+from text_corpus import codepoint_frequencies
 
 # Originally from https://github.com/vroland/epdiy
 
@@ -16,9 +20,13 @@ parser.add_argument("size", type=int, help="font size to use.")
 parser.add_argument("fontstack", action="store", nargs='+', help="list of font files, ordered by descending priority.")
 parser.add_argument("--2bit", dest="is2Bit", action="store_true", help="generate 2-bit greyscale bitmap instead of 1-bit black and white.")
 parser.add_argument("--additional-intervals", dest="additional_intervals", action="append", help="Additional code point intervals to export as min,max. This argument can be repeated.")
+parser.add_argument("--charset", dest="charset", help="Export only the characters in this UTF-8 text file (and any --additional-intervals) instead of the default intervals, for fonts that only draw known strings.")
 parser.add_argument("--compress", dest="compress", action="store_true", help="Compress glyph bitmaps using DEFLATE with group-based compression.")
 parser.add_argument("--force-autohint", dest="force_autohint", action="store_true", help="Force FreeType auto-hinter instead of native font hinting. Improves stem width consistency for fonts with weak or no native TrueType hints.")
 parser.add_argument("--pnum", dest="pnum", action="store_true", help="Use proportional numerals (pnum OpenType feature) instead of default tabular figures. Reduces visual gaps between digits in running prose.")
+parser.add_argument("--frequency-corpus", dest="frequency_corpus", action="append", help="Group compressed glyphs by how often they occur in this corpus (.txt, .epub or a directory of them) instead of by Unicode block: the most frequent codepoints go into one small hot group, the rest into per-script cold groups. Repeat once per language.")
+parser.add_argument("--hot-group-size", dest="hot_group_size", type=int, default=128, help="Maximum number of glyphs in the hot group of a frequency-grouped font (default: 128).")
+parser.add_argument("--sd-output", dest="sd_output", help="Also write the font as an .epdfont file for loading from the SD card (requires --compress).")
 args = parser.parse_args()
 
 GlyphProps = namedtuple("GlyphProps", ["width", "height", "advance_x", "left", "top", "data_length", "data_offset", "code_point"])
@@ -128,6 +136,15 @@ intervals = [
     (0xFFFD, 0xFFFD),
 ]
 
+if args.charset:
+    with open(args.charset, encoding="utf-8") as f:
+        intervals = []
+        for code_point in sorted({ord(c) for c in f.read() if c != "\n"}):
+            if intervals and intervals[-1][1] + 1 == code_point:
+                intervals[-1] = (intervals[-1][0], code_point)
+            else:
+                intervals.append((code_point, code_point))
+
 add_ints = []
 if args.additional_intervals:
     add_ints = [tuple([int(n, base=0) for n in i.split(",")]) for i in args.additional_intervals]
@@ -787,6 +804,12 @@ def to_byte_aligned(packed, width, height):
 if compress and not is2Bit:
     print("Error: --compress requires --2bit (byte-aligned compression only supports 2-bit format)", file=sys.stderr)
     sys.exit(1)
+if args.frequency_corpus and not compress:
+    print("Error: --frequency-corpus requires --compress", file=sys.stderr)
+    sys.exit(1)
+if args.sd_output and not compress:
+    print("Error: --sd-output requires --compress", file=sys.stderr)
+    sys.exit(1)
 if compress:
     # Script-based grouping: glyphs that co-occur in typical text rendering
     # are grouped together for efficient LRU caching on the embedded target.
@@ -815,24 +838,54 @@ if compress:
                 return i
         return -1
 
-    groups = []  # list of (first_glyph_index, glyph_count)
-    current_group_id = None
-    group_start = 0
-    group_count = 0
-
-    for i, (props, packed) in enumerate(all_glyphs):
-        sg = get_script_group(props.code_point)
-        if sg != current_group_id:
-            if group_count > 0:
-                groups.append((group_start, group_count))
-            current_group_id = sg
-            group_start = i
-            group_count = 1
-        else:
-            group_count += 1
-
-    if group_count > 0:
-        groups.append((group_start, group_count))
+    def hot_codepoints():
+        # Per corpus (language), the most frequent codepoints covering HOT_COVERAGE of its text. The union is ranked
+        # by each codepoint's best share in any corpus, so a small language isn't crowded out by a large one.
+        HOT_COVERAGE = 0.995
+        available = set(all_codepoints)
+        share = {}
+        for corpus in args.frequency_corpus:
+            counts = {cp: n for cp, n in codepoint_frequencies(corpus).items() if cp in available}
+            total = sum(counts.values())
+            if total == 0:
+                print(f"Warning: corpus {corpus} has no text covered by this font", file=sys.stderr)
+                continue
+            covered = 0
+            for cp, n in sorted(counts.items(), key=lambda item: (-item[1], item[0])):
+                if covered >= HOT_COVERAGE * total:
+                    break
+                share[cp] = max(share.get(cp, 0), n / total)
+                covered += n
+        ranked = sorted(share, key=lambda cp: (-share[cp], cp))
+        return set(ranked[:args.hot_group_size])
+
+    # Each group is the ascending list of its glyph indices; the firmware expects group data in glyph index order
+    group_members = []
+    if args.frequency_corpus:
+        hot = hot_codepoints()
+        hot.add(0x20)  # the space glyph has no bitmap, but pages always contain it
+        group_members.append([i for i, (props, _) in enumerate(all_glyphs) if props.code_point in hot])
+        cold_by_script = {}
+        for i, (props, _) in enumerate(all_glyphs):
+            if props.code_point not in hot:
+                cold_by_script.setdefault(get_script_group(props.code_point), []).append(i)
+        group_members.extend(members for _, members in sorted(cold_by_script.items(), key=lambda item: item[1][0]))
+    else:
+        current_group_id = None
+        for i, (props, packed) in enumerate(all_glyphs):
+            sg = get_script_group(props.code_point)
+            if sg != current_group_id:
+                group_members.append([])
+                current_group_id = sg
+            group_members[-1].append(i)
+    group_members = [members for members in group_members if members]
+
+    glyph_to_group = None
+    if args.frequency_corpus:
+        glyph_to_group = [0] * len(all_glyphs)
+        for group_index, members in enumerate(group_members):
+            for gi in members:
+                glyph_to_group[gi] = group_index
 
     # Compress each group
     compressed_groups = []  # list of (compressed_bytes, uncompressed_size, glyph_count, first_glyph_index)
@@ -842,11 +895,11 @@ if compress:
     # Also build modified glyph props with within-group offsets
     modified_glyph_props = list(glyph_props)
 
-    for first_idx, count in groups:
+    for members in group_members:
         # Concatenate bitmap data for this group
         packed_len = 0
         group_aligned = bytearray()
-        for gi in range(first_idx, first_idx + count):
+        for gi in members:
             props, packed = all_glyphs[gi]
             # Update glyph's dataOffset to be within-group offset (packed offset)
             within_group_offset = packed_len
@@ -868,14 +921,14 @@ if compress:
         compressor = zlib.compressobj(level=9, wbits=-15)
         compressed = compressor.compress(bytes(group_aligned)) + compressor.flush()
 
-        compressed_groups.append((compressed, len(group_aligned), count, first_idx))
+        compressed_groups.append((compressed, len(group_aligned), len(members), members[0]))
         compressed_bitmap_data.extend(compressed)
         compressed_offset += len(compressed)
 
     glyph_props = modified_glyph_props
     total_compressed = len(compressed_bitmap_data)
     total_uncompressed = len(glyph_data)
-    print(f"// Compression: {total_uncompressed} -> {total_compressed} bytes ({100*total_compressed/total_uncompressed:.1f}%), {len(groups)} groups", file=sys.stderr)
+    print(f"// Compression: {total_uncompressed} -> {total_compressed} bytes ({100*total_compressed/total_uncompressed:.1f}%), {len(group_members)} groups{' (frequency-grouped, ' + str(len(group_members[0])) + ' hot glyphs)' if glyph_to_group else ''}", file=sys.stderr)
 
 print(f"""/**
  * generated by fontconvert.py
@@ -909,13 +962,24 @@ for i, g in enumerate(glyph_props):
     print ("    { " + ", ".join([f"{a}" for a in list(g[:-1])]),"},", f"// {cp_label(g.code_point)}")
 print ("};\n");
 
-print(f"static const EpdUnicodeInterval {font_name}Intervals[] = {{")
+interval_offsets = []
 offset = 0
 for i_start, i_end in intervals:
-    print (f"    {{ 0x{i_start:X}, 0x{i_end:X}, 0x{offset:X} }},")
+    interval_offsets.append((i_start, i_end, offset))
     offset += i_end - i_start + 1
+
+print(f"static const EpdUnicodeInterval {font_name}Intervals[] = {{")
+for i_start, i_end, offset in interval_offsets:
+    print (f"    {{ 0x{i_start:X}, 0x{i_end:X}, 0x{offset:X} }},")
 print ("};\n");
 
+glyph_lookup = build_glyph_lookup(interval_offsets)
+if glyph_lookup:
+    print(f"static const uint16_t {font_name}GlyphLookup[] = {{")
+    for c in chunks(glyph_lookup, 16):
+        print("    " + " ".join(f"{g}," for g in c))
+    print("};\n")
+
 if compress:
     print(f"static const EpdFontGroup {font_name}Groups[] = {{")
     compressed_offset = 0
@@ -924,6 +988,12 @@ if compress:
         compressed_offset += len(compressed)
     print("};\n")
 
+if compress and glyph_to_group:
+    print(f"static const uint16_t {font_name}GlyphToGroup[] = {{")
+    for c in chunks(glyph_to_group, 16):
+        print("    " + " ".join(f"{g}," for g in c))
+    print("};\n")
+
 if kern_map:
     print(f"static const EpdKernClassEntry {font_name}KernLeftClasses[] = {{")
     for cp, cls in kern_left_classes:
@@ -948,6 +1018,21 @@ if ligature_pairs:
         print(f"    {{ 0x{packed_pair:08X}, 0x{lig_cp:04X} }}, // {cp_label(packed_pair >> 16)} {cp_label(packed_pair & 0xFFFF)} -> {cp_label(lig_cp)}")
     print("};\n")
 
+kern_left_lookup, kern_right_lookup = build_kern_lookups(kern_left_classes, kern_right_classes) if kern_map else ([], [])
+if kern_left_lookup:
+    for name, table in (("KernLeftLookup", kern_left_lookup), ("KernRightLookup", kern_right_lookup)):
+        print(f"static const uint8_t {font_name}{name}[] = {{")
+        for c in chunks(table, 16):
+            print("    " + " ".join(f"{v}," for v in c))
+        print("};\n")
+
+ligature_starts = build_ligature_starts(ligature_pairs)
+if ligature_starts:
+    print(f"static const uint8_t {font_name}LigatureStarts[] = {{")
+    for c in chunks(ligature_starts, 16):
+        print("    " + " ".join(f"0x{v:02X}," for v in c))
+    print("};\n")
+
 print(f"static const EpdFontData {font_name} = {{")
 print(f"    {font_name}Bitmaps,")
 print(f"    {font_name}Glyphs,")
@@ -963,8 +1048,11 @@ if compress:
 else:
     print("    nullptr,")
     print("    0,")
-# glyphToGroup (not used for script-grouped fonts)
-print("    nullptr,")
+# glyphToGroup (only for frequency-grouped fonts; script groups are contiguous)
+if compress and glyph_to_group:
+    print(f"    {font_name}GlyphToGroup,")
+else:
+    print("    nullptr,")
 if kern_map:
     print(f"    {font_name}KernLeftClasses,")
     print(f"    {font_name}KernRightClasses,")
@@ -987,4 +1075,40 @@ if ligature_pairs:
 else:
     print(f"    nullptr,")
     print(f"    0,")
+if glyph_lookup:
+    print(f"    {font_name}GlyphLookup,")
+    print(f"    {len(glyph_lookup)},")
+else:
+    print(f"    nullptr,")
+    print(f"    0,")
+if kern_left_lookup:
+    print(f"    {font_name}KernLeftLookup,")
+    print(f"    {font_name}KernRightLookup,")
+    print(f"    {len(kern_left_lookup)},")
+else:
+    print(f"    nullptr,")
+    print(f"    nullptr,")
+    print(f"    0,")
+if ligature_starts:
+    print(f"    {font_name}LigatureStarts,")
+    print(f"    {len(ligature_starts) * 8},")
+else:
+    print(f"    nullptr,")
+    print(f"    0,")
+print(f"    {len(all_glyphs)},")
 print("};")
+
+if args.sd_output:
+    sd_groups = []
+    compressed_offset = 0
+    for compressed, uncompressed_size, count, first_idx in compressed_groups:
+        sd_groups.append((compressed_offset, len(compressed), uncompressed_size, count, first_idx))
+        compressed_offset += len(compressed)
+    write_epdfont(args.sd_output, advance_y=norm_ceil(face.size.height), ascender=norm_ceil(face.size.ascender),
+                  descender=norm_floor(face.size.descender), is_2bit=is2Bit, intervals=interval_offsets,
+                  glyphs=[tuple(g[:-1]) for g in glyph_props], groups=sd_groups, bitmap=compressed_bitmap_data,
+                  glyph_to_group=glyph_to_group, kern_left_classes=kern_left_classes,
+                  kern_right_classes=kern_right_classes, kern_matrix=kern_matrix,
+                  kern_left_class_count=kern_left_class_count, kern_right_class_count=kern_right_class_count,
+                  ligature_pairs=ligature_pairs)
+    print(f"// Wrote {args.sd_output}", file=sys.stderr)
@@ -0,0 +1,25 @@
+"""
+Direct codepoint -> glyph index table for the dense low BMP blocks (Basic Latin through Cyrillic).
+
+Text in these scripts is nearly all of what the reader lays out, so EpdFont::getGlyph and
+FontDecompressor::findGlyphIndex index this table instead of binary-searching the intervals.
+Entries hold glyph index + 1, with 0 for codepoints the font doesn't have.
+"""
+
+# End of the Cyrillic block; above it fonts are sparse and the interval search is used
+GLYPH_LOOKUP_LIMIT = 0x500
+MAX_GLYPH_INDEX = 0xFFFE
+
+
+def build_glyph_lookup(intervals):
+    """intervals: [(first, last, offset)] as in EpdUnicodeInterval. Returns the table, trimmed after the last glyph."""
+    table = [0] * GLYPH_LOOKUP_LIMIT
+    size = 0
+    for first, last, offset in intervals:
+        for cp in range(first, min(last, GLYPH_LOOKUP_LIMIT - 1) + 1):
+            index = offset + cp - first
+            if index > MAX_GLYPH_INDEX:
+                return []
+            table[cp] = index + 1
+            size = cp + 1
+    return table[:size]
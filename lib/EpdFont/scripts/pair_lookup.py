@@ -0,0 +1,38 @@
+"""
+Direct kerning class tables and a ligature start bitmap for the low codepoints (Basic Latin through Latin Extended-B).
+
+EpdFont::getKerning classes both codepoints of every pair laid out or drawn, and applyLigatures checks every
+codepoint for a ligature. For these codepoints the classes are one table read instead of a binary search, and a
+codepoint whose bit is clear in the bitmap starts no ligature, so the pair table is not searched at all.
+"""
+
+# End of Latin Extended-B; kerning above it is rare enough for the binary search
+PAIR_LOOKUP_LIMIT = 0x250
+
+
+def build_kern_lookups(left_classes, right_classes):
+    """left/right_classes: [(codepoint, classId)] as in EpdKernClassEntry. Returns the left and right tables of
+    class ids, both trimmed after the last codepoint either side has a class for."""
+    left = [0] * PAIR_LOOKUP_LIMIT
+    right = [0] * PAIR_LOOKUP_LIMIT
+    size = 0
+    for table, classes in ((left, left_classes), (right, right_classes)):
+        for cp, class_id in classes:
+            if cp < PAIR_LOOKUP_LIMIT:
+                table[cp] = class_id
+                size = max(size, cp + 1)
+    return left[:size], right[:size]
+
+
+def build_ligature_starts(ligature_pairs):
+    """ligature_pairs: [(left << 16 | right, ligatureCp)]. Returns a bitmap with bit cp % 8 of byte cp // 8 set for
+    every codepoint that is the left of a pair. It is not trimmed: the letters after the last ligature start are the
+    ones it saves the most searches for. Empty if there are no ligatures."""
+    if not ligature_pairs:
+        return []
+    starts = [0] * (PAIR_LOOKUP_LIMIT // 8)
+    for pair, _ in ligature_pairs:
+        cp = pair >> 16
+        if cp < PAIR_LOOKUP_LIMIT:
+            starts[cp // 8] |= 1 << (cp % 8)
+    return starts
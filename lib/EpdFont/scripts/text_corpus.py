@@ -0,0 +1,74 @@
+"""
+Plain-text extraction from sample books, shared by fontconvert.py (frequency grouping)
+and verify_compression.py (groups-touched-per-page report).
+
+A corpus path may be a .txt file, an .epub, or a directory searched recursively for both.
+"""
+import html
+import os
+import re
+import zipfile
+from collections import Counter
+
+_TAG_RE = re.compile(r'<[^>]+>')
+_HIDDEN_RE = re.compile(r'<(head|script|style)\b.*?</\1\s*>', re.DOTALL | re.IGNORECASE)
+_SPACE_RE = re.compile(r'\s+')
+
+
+def _xhtml_to_text(markup):
+    text = _HIDDEN_RE.sub(' ', markup)
+    text = _TAG_RE.sub(' ', text)
+    return _SPACE_RE.sub(' ', html.unescape(text)).strip()
+
+
+def _texts_from_epub(path):
+    with zipfile.ZipFile(path) as book:
+        for name in sorted(book.namelist()):
+            if name.lower().endswith(('.xhtml', '.html', '.htm')):
+                text = _xhtml_to_text(book.read(name).decode('utf-8', errors='replace'))
+                if text:
+                    yield text
+
+
+def _corpus_files(path):
+    if os.path.isdir(path):
+        for root, _dirs, files in os.walk(path):
+            for name in sorted(files):
+                if name.lower().endswith(('.txt', '.epub')):
+                    yield os.path.join(root, name)
+    else:
+        yield path
+
+
+def iter_corpus_texts(path):
+    """Yields (source_file, text) for every chapter or text file found under path."""
+    for file_path in _corpus_files(path):
+        if file_path.lower().endswith('.epub'):
+            for text in _texts_from_epub(file_path):
+                yield file_path, text
+        else:
+            with open(file_path, 'r', encoding='utf-8', errors='replace') as f:
+                yield file_path, _SPACE_RE.sub(' ', f.read()).strip()
+
+
+def codepoint_frequencies(path):
+    """Counts how often each non-space codepoint occurs in the corpus."""
+    counts = Counter()
+    for _source, text in iter_corpus_texts(path):
+        counts.update(ord(c) for c in text if not c.isspace())
+    return counts
+
+
+def split_pages(text, chars_per_page):
+    """Cuts text into page-sized chunks at word boundaries, roughly as the reader would paginate it."""
+    pages = []
+    start = 0
+    while start < len(text):
+        end = min(len(text), start + chars_per_page)
+        if end < len(text):
+            space = text.rfind(' ', start, end)
+            if space > start:
+                end = space
+        pages.append(text[start:end])
+        start = end + 1
+    return pages
@@ -8,13 +8,19 @@ compacts to packed format, and verifies the data matches expected glyph sizes.
 
 Supports both contiguous-group fonts (Latin) and frequency-grouped fonts (CJK)
 with glyphToGroup mapping arrays.
+
+With --pages, also reports how many groups each page of the given books touches, which is
+the number of inflates a page costs on the device without the group cache.
 """
+import argparse
 import math
 import os
 import re
 import sys
 import zlib
 
+from text_corpus import iter_corpus_texts, split_pages
+
 
 def parse_hex_array(text):
     """Extract bytes from a C hex array string like '{ 0xAB, 0xCD, ... }'"""
@@ -57,6 +63,12 @@ def parse_glyphs(text):
     return glyphs
 
 
+def parse_intervals(text):
+    """Parse EpdUnicodeInterval array entries: { first, last, offset }"""
+    return [(int(m.group(1), 16), int(m.group(2), 16), int(m.group(3), 16))
+            for m in re.finditer(r'\{\s*0x([0-9A-Fa-f]+)\s*,\s*0x([0-9A-Fa-f]+)\s*,\s*0x([0-9A-Fa-f]+)\s*\}', text)]
+
+
 def get_group_glyph_indices(group, group_index, glyphs, glyph_to_group):
     """Get the ordered list of glyph indices belonging to a group."""
     if glyph_to_group is not None:
@@ -230,12 +242,80 @@ def verify_font_file(filepath):
     return (font_name, True, f"{len(groups)} groups, {len(glyphs)} glyphs OK{extra_info}")
 
 
-def main():
-    if len(sys.argv) < 2:
-        print(f"Usage: {sys.argv[0]} <font_headers_directory>", file=sys.stderr)
-        sys.exit(1)
+def groups_per_page(filepath, pages):
+    """Returns the number of distinct groups each page touches, or None for uncompressed fonts."""
+    with open(filepath, 'r') as f:
+        content = f.read()
+    groups_match = re.search(r'static const EpdFontGroup (\w+)Groups\[\]\s*=\s*\{(.+?)\};', content, re.DOTALL)
+    if not groups_match:
+        return None
+    font_name = groups_match.group(1)
+    groups = parse_groups(groups_match.group(2))
+    intervals_match = re.search(
+        r'static const EpdUnicodeInterval ' + re.escape(font_name) + r'Intervals\[\]\s*=\s*\{(.+?)\};',
+        content, re.DOTALL
+    )
+    intervals = parse_intervals(intervals_match.group(1)) if intervals_match else []
+    g2g_match = re.search(
+        r'static const uint16_t ' + re.escape(font_name) + r'GlyphToGroup\[\]\s*=\s*\{(.+?)\};',
+        content, re.DOTALL
+    )
+    glyph_to_group = parse_uint8_array(g2g_match.group(1)) if g2g_match else None
+
+    def group_of(cp):
+        for first, last, offset in intervals:
+            if first <= cp <= last:
+                glyph_index = offset + cp - first
+                if glyph_to_group is not None:
+                    return glyph_to_group[glyph_index]
+                for gi, group in enumerate(groups):
+                    if group['firstGlyphIndex'] <= glyph_index < group['firstGlyphIndex'] + group['glyphCount']:
+                        return gi
+        return None
+
+    cache = {}
+    counts = []
+    for page in pages:
+        touched = set()
+        for c in set(page):
+            if c.isspace():
+                continue
+            if c not in cache:
+                cache[c] = group_of(ord(c))
+            if cache[c] is not None:
+                touched.add(cache[c])
+        counts.append(len(touched))
+    return counts
+
+
+def report_groups_per_page(font_dir, files, book_dir, chars_per_page):
+    pages = []
+    for _source, text in iter_corpus_texts(book_dir):
+        pages.extend(split_pages(text, chars_per_page))
+    if not pages:
+        print(f"No text found in {book_dir}")
+        return
+    print(f"\nGroups touched per page ({len(pages)} pages of ~{chars_per_page} chars from {book_dir}):")
+    for filename in files:
+        counts = groups_per_page(os.path.join(font_dir, filename), pages)
+        if not counts:
+            continue
+        ordered = sorted(counts)
+        at_most_two = sum(1 for c in counts if c <= 2)
+        print(f"  {filename}: mean {sum(counts) / len(counts):.2f}, median {ordered[len(ordered) // 2]}, "
+              f"max {ordered[-1]}, {100 * at_most_two / len(counts):.0f}% of pages need <= 2 groups")
+
 
-    font_dir = sys.argv[1]
+def main():
+    parser = argparse.ArgumentParser(description="Round-trip verification for compressed font headers.")
+    parser.add_argument("font_dir", help="directory with the generated font headers")
+    parser.add_argument("--pages", dest="pages", help="also report groups touched per page on these books "
+                        "(.epub/.txt or a directory, e.g. test/epubs)")
+    parser.add_argument("--chars-per-page", dest="chars_per_page", type=int, default=1500,
+                        help="page size used for --pages (default: 1500)")
+    args = parser.parse_args()
+
+    font_dir = args.font_dir
     if not os.path.isdir(font_dir):
         print(f"Error: {font_dir} is not a directory", file=sys.stderr)
         sys.exit(1)
@@ -260,6 +340,9 @@ def main():
 
     print(f"\nResults: {passed} passed, {failed} failed, {skipped} skipped (uncompressed)")
 
+    if args.pages:
+        report_groups_per_page(font_dir, files, args.pages, args.chars_per_page)
+
     if failed > 0:
         sys.exit(1)
 
@@ -3,15 +3,24 @@
 #include <FsHelpers.h>
 #include <HalStorage.h>
 #include <JpegToBmpConverter.h>
+#include <KOReaderDocumentId.h>
 #include <Logging.h>
 #include <PngToBmpConverter.h>
 #include <ZipFile.h>
 
+#include "Epub/ImagePack.h"
 #include "Epub/parsers/ContainerParser.h"
 #include "Epub/parsers/ContentOpfParser.h"
+#include "Epub/parsers/Fb2Parser.h"
 #include "Epub/parsers/TocNavParser.h"
 #include "Epub/parsers/TocNcxParser.h"
 
+namespace {
+// Entry index of the EPUB zip, shared with BookMetadataCache
+constexpr char zipIndexFile[] = "/zip.idx";
+constexpr char staleMarkerFile[] = "/stale";
+}  // namespace
+
 bool Epub::findContentOpfFile(std::string* contentOpfFile) const {
   const auto containerPath = "META-INF/container.xml";
   size_t containerSize;
@@ -132,10 +141,6 @@ bool Epub::parseContentOpf(BookMetadataCache::BookMetadata& bookMetadata) {
     tocNavItem = opfParser.tocNavPath;
   }
 
-  if (!opfParser.cssFiles.empty()) {
-    cssFiles = opfParser.cssFiles;
-  }
-
   LOG_DBG("EBP", "Successfully parsed content.opf");
   return true;
 }
@@ -149,18 +154,11 @@ bool Epub::parseTocNcxFile() const {
 
   LOG_DBG("EBP", "Parsing toc ncx file: %s", tocNcxItem.c_str());
 
-  const auto tmpNcxPath = getCachePath() + "/toc.ncx";
-  FsFile tempNcxFile;
-  if (!Storage.openFileForWrite("EBP", tmpNcxPath, tempNcxFile)) {
+  size_t ncxSize;
+  if (!getItemSize(tocNcxItem, &ncxSize)) {
+    LOG_ERR("EBP", "Could not get size of toc ncx");
     return false;
   }
-  readItemContentsToStream(tocNcxItem, tempNcxFile, 1024);
-  // Explicitly close() file before reopening for reading
-  tempNcxFile.close();
-  if (!Storage.openFileForRead("EBP", tmpNcxPath, tempNcxFile)) {
-    return false;
-  }
-  const auto ncxSize = tempNcxFile.size();
 
   TocNcxParser ncxParser(contentBasePath, ncxSize, bookMetadataCache.get());
 
@@ -169,29 +167,12 @@ bool Epub::parseTocNcxFile() const {
     return false;
   }
 
-  const auto ncxBuffer = static_cast<uint8_t*>(malloc(1024));
-  if (!ncxBuffer) {
-    LOG_ERR("EBP", "Could not allocate memory for toc ncx parser");
+  // Inflated straight into the parser, like content.opf
+  if (!readItemContentsToStream(tocNcxItem, ncxParser, 1024)) {
+    LOG_ERR("EBP", "Could not process all toc ncx data");
     return false;
   }
 
-  while (tempNcxFile.available()) {
-    const auto readSize = tempNcxFile.read(ncxBuffer, 1024);
-    if (readSize == 0) break;
-    const auto processedSize = ncxParser.write(ncxBuffer, readSize);
-
-    if (processedSize != readSize) {
-      LOG_ERR("EBP", "Could not process all toc ncx data");
-      free(ncxBuffer);
-      return false;
-    }
-  }
-
-  free(ncxBuffer);
-  // Explicitly close() file before calling Storage.remove()
-  tempNcxFile.close();
-  Storage.remove(tmpNcxPath.c_str());
-
   LOG_DBG("EBP", "Parsed TOC items");
   return true;
 }
@@ -205,18 +186,11 @@ bool Epub::parseTocNavFile() const {
 
   LOG_DBG("EBP", "Parsing toc nav file: %s", tocNavItem.c_str());
 
-  const auto tmpNavPath = getCachePath() + "/toc.nav";
-  FsFile tempNavFile;
-  if (!Storage.openFileForWrite("EBP", tmpNavPath, tempNavFile)) {
+  size_t navSize;
+  if (!getItemSize(tocNavItem, &navSize)) {
+    LOG_ERR("EBP", "Could not get size of toc nav");
     return false;
   }
-  readItemContentsToStream(tocNavItem, tempNavFile, 1024);
-  // Explicitly close() file before reopening for reading
-  tempNavFile.close();
-  if (!Storage.openFileForRead("EBP", tmpNavPath, tempNavFile)) {
-    return false;
-  }
-  const auto navSize = tempNavFile.size();
 
   // Note: We can't use `contentBasePath` here as the nav file may be in a different folder to the content.opf
   // and the HTMLX nav file will have hrefs relative to itself
@@ -228,53 +202,50 @@ bool Epub::parseTocNavFile() const {
     return false;
   }
 
-  const auto navBuffer = static_cast<uint8_t*>(malloc(1024));
-  if (!navBuffer) {
-    LOG_ERR("EBP", "Could not allocate memory for toc nav parser");
+  if (!readItemContentsToStream(tocNavItem, navParser, 1024)) {
+    LOG_ERR("EBP", "Could not process all toc nav data");
     return false;
   }
 
-  while (tempNavFile.available()) {
-    const auto readSize = tempNavFile.read(navBuffer, 1024);
-    const auto processedSize = navParser.write(navBuffer, readSize);
-
-    if (processedSize != readSize) {
-      LOG_ERR("EBP", "Could not process all toc nav data");
-      free(navBuffer);
-      return false;
-    }
-  }
-
-  free(navBuffer);
-  // Explicitly close() file before calling Storage.remove()
-  tempNavFile.close();
-  Storage.remove(tmpNavPath.c_str());
-
   LOG_DBG("EBP", "Parsed TOC nav items");
   return true;
 }
 
-void Epub::parseCssFiles() const {
+bool Epub::loadStylesheets(const std::vector<std::string>& stylesheets) const {
   // Maximum CSS file size we'll attempt to parse (uncompressed)
   // Larger files risk memory exhaustion on ESP32
   constexpr size_t MAX_CSS_FILE_SIZE = 128 * 1024;  // 128KB
   // Minimum heap required before attempting CSS parsing
   constexpr size_t MIN_HEAP_FOR_CSS_PARSING = 64 * 1024;  // 64KB
 
-  if (cssFiles.empty()) {
-    LOG_DBG("EBP", "No CSS files to parse, but CssParser created for inline styles");
+  if (!getCssParser()) {
+    return false;
+  }
+  if (stylesheets.empty()) {
+    // Inline styles only
+    cssParser->clear();
+    return true;
   }
 
-  LOG_DBG("EBP", "CSS files to parse: %zu", cssFiles.size());
-
-  // See if we have a cached version of the CSS rules
-  if (cssParser->hasCache()) {
-    LOG_DBG("EBP", "CSS cache exists, skipping parseCssFiles");
-    return;
+  // One compiled cache per set of stylesheets, keyed by their paths in link order; chapters of a book mostly share one
+  uint32_t hash = 2166136261u;
+  for (const auto& cssPath : stylesheets) {
+    for (const char c : cssPath) {
+      hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+    }
+    hash = (hash ^ '\n') * 16777619u;
+  }
+  char cacheName[16];
+  snprintf(cacheName, sizeof(cacheName), "css_%08x", static_cast<unsigned>(hash));
+  cssParser->setCacheName(cacheName);
+  if (cssParser->loadFromCache()) {
+    return true;
   }
 
   // No cache yet - parse CSS files
-  for (const auto& cssPath : cssFiles) {
+  const uint32_t cssStart = millis();
+  cssParser->clear();
+  for (const auto& cssPath : stylesheets) {
     LOG_DBG("EBP", "Parsing CSS file: %s", cssPath.c_str());
 
     // Check heap before parsing - CSS parsing allocates heavily
@@ -287,12 +258,14 @@ void Epub::parseCssFiles() const {
 
     // Check CSS file size before decompressing - skip files that are too large
     size_t cssFileSize = 0;
-    if (getItemSize(cssPath, &cssFileSize)) {
-      if (cssFileSize > MAX_CSS_FILE_SIZE) {
-        LOG_ERR("EBP", "CSS file too large (%zu bytes > %zu max), skipping: %s", cssFileSize, MAX_CSS_FILE_SIZE,
-                cssPath.c_str());
-        continue;
-      }
+    if (!getItemSize(cssPath, &cssFileSize)) {
+      LOG_ERR("EBP", "Linked CSS file not found: %s", cssPath.c_str());
+      continue;
+    }
+    if (cssFileSize > MAX_CSS_FILE_SIZE) {
+      LOG_ERR("EBP", "CSS file too large (%zu bytes > %zu max), skipping: %s", cssFileSize, MAX_CSS_FILE_SIZE,
+              cssPath.c_str());
+      continue;
     }
 
     // Extract CSS file to temp location
@@ -302,7 +275,7 @@ void Epub::parseCssFiles() const {
       LOG_ERR("EBP", "Could not create temp CSS file");
       continue;
     }
-    if (!readItemContentsToStream(cssPath, tempCssFile, 1024)) {
+    if (!readItemContentsToStream(cssPath, tempCssFile, Storage.getChunkSize())) {
       LOG_ERR("EBP", "Could not read CSS file: %s", cssPath.c_str());
       // Explicitly close() file before calling Storage.remove()
       tempCssFile.close();
@@ -324,65 +297,21 @@ void Epub::parseCssFiles() const {
     Storage.remove(tmpCssPath.c_str());
   }
 
-  // Save to cache for next time
-  if (!cssParser->saveToCache()) {
-    LOG_ERR("EBP", "Failed to save CSS rules to cache");
-  }
+  // Styles are resolved from the compiled cache only, so compile it and read it back
+  const bool saved = cssParser->saveToCache();
   cssParser->clear();
-
-  LOG_DBG("EBP", "Loaded %zu CSS style rules from %zu files", cssParser->ruleCount(), cssFiles.size());
-}
-
-// load in the meta data for the epub file
-bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss) {
-  LOG_DBG("EBP", "Loading ePub: %s", filepath.c_str());
-
-  // Initialize spine/TOC cache
-  bookMetadataCache.reset(new BookMetadataCache(cachePath));
-  // Always create CssParser - needed for inline style parsing even without CSS files
-  cssParser.reset(new CssParser(cachePath));
-
-  // Try to load existing cache first
-  if (bookMetadataCache->load()) {
-    if (!skipLoadingCss) {
-      // Rebuild CSS cache when missing or when cache version changed (loadFromCache removes stale file)
-      if (!cssParser->hasCache() || !cssParser->loadFromCache()) {
-        LOG_DBG("EBP", "CSS rules cache missing or stale, attempting to parse CSS files");
-        cssParser->deleteCache();
-
-        if (!parseContentOpf(bookMetadataCache->coreMetadata)) {
-          LOG_ERR("EBP", "Could not parse content.opf from cached bookMetadata for CSS files");
-          // continue anyway - book will work without CSS and we'll still load any inline style CSS
-        }
-        parseCssFiles();
-        // Invalidate section caches so they are rebuilt with the new CSS
-        Storage.removeDir((cachePath + "/sections").c_str());
-      }
-    }
-    LOG_DBG("EBP", "Loaded ePub: %s", filepath.c_str());
-    return true;
-  }
-
-  // If we didn't load from cache above and we aren't allowed to build, fail now
-  if (!buildIfMissing) {
-    return false;
-  }
-
-  // Cache doesn't exist or is invalid, build it
-  LOG_DBG("EBP", "Cache not found, building spine/TOC cache");
-  setupCacheDir();
-
-  const uint32_t indexingStart = millis();
-
-  // Begin building cache - stream entries to disk immediately
-  if (!bookMetadataCache->beginWrite()) {
-    LOG_ERR("EBP", "Could not begin writing cache");
+  if (!saved || !cssParser->loadFromCache()) {
+    LOG_ERR("EBP", "Failed to compile CSS rules cache");
     return false;
   }
+  LOG_DBG("EBP", "Compiled %zu CSS style rules from %zu files in %lu ms", cssParser->ruleCount(), stylesheets.size(),
+          millis() - cssStart);
+  return true;
+}
 
+bool Epub::parsePackage(BookMetadataCache::BookMetadata& bookMetadata) {
   // OPF Pass
   const uint32_t opfStart = millis();
-  BookMetadataCache::BookMetadata bookMetadata;
   if (!bookMetadataCache->beginContentOpfPass()) {
     LOG_ERR("EBP", "Could not begin writing content.opf pass");
     return false;
@@ -428,6 +357,112 @@ bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss) {
     return false;
   }
   LOG_DBG("EBP", "TOC pass completed in %lu ms", millis() - tocStart);
+  return true;
+}
+
+bool Epub::indexFb2(BookMetadataCache::BookMetadata& bookMetadata, std::vector<uint32_t>& spineSizes) {
+  const uint32_t fb2Start = millis();
+  FsFile book;
+  if (!Storage.openFileForRead("EBP", filepath, book)) {
+    return false;
+  }
+  Fb2Parser parser(*fb2Index);
+  const bool parsed = parser.parse(book);
+  book.close();
+  if (!parsed) {
+    LOG_ERR("EBP", "Could not parse FB2 book");
+    return false;
+  }
+  LOG_DBG("EBP", "FB2 pass completed in %lu ms", millis() - fb2Start);
+
+  if (!bookMetadataCache->beginContentOpfPass()) {
+    LOG_ERR("EBP", "Could not begin writing content.opf pass");
+    return false;
+  }
+  for (size_t i = 0; i < fb2Index->sections.size(); i++) {
+    bookMetadataCache->createSpineEntry(Fb2Index::sectionHref(i));
+    spineSizes.push_back(fb2Index->sections[i].length);
+  }
+  if (!bookMetadataCache->endContentOpfPass()) {
+    LOG_ERR("EBP", "Could not end writing content.opf pass");
+    return false;
+  }
+
+  if (!bookMetadataCache->beginTocPass()) {
+    LOG_ERR("EBP", "Could not begin writing toc pass");
+    return false;
+  }
+  for (const auto& item : parser.toc) {
+    bookMetadataCache->createTocEntry(item.title, Fb2Index::sectionHref(item.section), item.anchor, item.level);
+  }
+  if (!bookMetadataCache->endTocPass()) {
+    LOG_ERR("EBP", "Could not end writing toc pass");
+    return false;
+  }
+
+  bookMetadata.title = std::move(parser.title);
+  bookMetadata.author = std::move(parser.author);
+  bookMetadata.language = std::move(parser.language);
+  bookMetadata.coverItemHref = std::move(parser.coverHref);
+  if (!fb2Index->save(cachePath)) {
+    LOG_ERR("EBP", "Could not write FB2 index");
+    return false;
+  }
+  return true;
+}
+
+// load in the meta data for the epub file
+bool Epub::load(const bool buildIfMissing) {
+  LOG_DBG("EBP", "Loading ePub: %s", filepath.c_str());
+
+  // The book was replaced since the cache was built
+  if (isCacheStale()) {
+    LOG_DBG("EBP", "Cache is stale, clearing it");
+    clearCache();
+  }
+
+  // Initialize spine/TOC cache
+  bookMetadataCache.reset(new BookMetadataCache(cachePath));
+  // The CSS parser is left for the first section laid out, see getCssParser()
+  cssParser.reset();
+
+  if (fb2) {
+    fb2Index.reset(new Fb2Index());
+  }
+
+  // Try to load existing cache first
+  if (bookMetadataCache->load()) {
+    if (!fb2 || fb2Index->load(cachePath)) {
+      LOG_DBG("EBP", "Loaded ePub: %s", filepath.c_str());
+      return true;
+    }
+    // The FB2 index is missing, so both are built again
+    bookMetadataCache.reset(new BookMetadataCache(cachePath));
+  }
+
+  // If we didn't load from cache above and we aren't allowed to build, fail now
+  if (!buildIfMissing) {
+    return false;
+  }
+
+  // Cache doesn't exist or is invalid, build it
+  LOG_DBG("EBP", "Cache not found, building spine/TOC cache");
+  setupCacheDir();
+
+  const uint32_t indexingStart = millis();
+
+  // Begin building cache - stream entries to disk immediately
+  if (!bookMetadataCache->beginWrite()) {
+    LOG_ERR("EBP", "Could not begin writing cache");
+    return false;
+  }
+
+  BookMetadataCache::BookMetadata bookMetadata;
+  // Sizes of the spine items when they aren't zip entries
+  std::vector<uint32_t> spineSizes;
+  if (fb2 ? !indexFb2(bookMetadata, spineSizes) : !parsePackage(bookMetadata)) {
+    return false;
+  }
 
   // Close the cache files
   if (!bookMetadataCache->endWrite()) {
@@ -437,7 +472,7 @@ bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss) {
 
   // Build final book.bin
   const uint32_t buildStart = millis();
-  if (!bookMetadataCache->buildBookBin(filepath, bookMetadata)) {
+  if (!bookMetadataCache->buildBookBin(filepath, bookMetadata, spineSizes)) {
     LOG_ERR("EBP", "Could not update mappings and sizes");
     return false;
   }
@@ -448,6 +483,9 @@ bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss) {
     LOG_DBG("EBP", "Could not cleanup tmp files - ignoring");
   }
 
+  // The book is being read through anyway; have its sync document ID ready so KOReader sync starts right away
+  KOReaderDocumentId::calculate(filepath, cachePath);
+
   // Reload the cache from disk so it's in the correct state
   bookMetadataCache.reset(new BookMetadataCache(cachePath));
   if (!bookMetadataCache->load()) {
@@ -455,13 +493,7 @@ bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss) {
     return false;
   }
 
-  if (!skipLoadingCss) {
-    // Parse CSS files after cache reload
-    parseCssFiles();
-    Storage.removeDir((cachePath + "/sections").c_str());
-  }
-
-  LOG_DBG("EBP", "Loaded ePub: %s", filepath.c_str());
+  LOG_DBG("EBP", "Loaded ePub: %s in %lu ms", filepath.c_str(), millis() - indexingStart);
   return true;
 }
 
@@ -471,7 +503,8 @@ bool Epub::clearCache() const {
     return true;
   }
 
-  if (!Storage.removeDir(cachePath.c_str())) {
+  ImagePack::forget();
+  if (!Storage.discardDir(cachePath.c_str())) {
     LOG_ERR("EPB", "Failed to clear cache");
     return false;
   }
@@ -480,6 +513,23 @@ bool Epub::clearCache() const {
   return true;
 }
 
+bool Epub::invalidateCache() const {
+  if (!Storage.exists(cachePath.c_str())) {
+    return true;
+  }
+
+  FsFile marker;
+  if (!Storage.openFileForWrite("EPB", cachePath + staleMarkerFile, marker)) {
+    LOG_ERR("EPB", "Failed to mark cache stale, clearing it");
+    return clearCache();
+  }
+  marker.close();
+  LOG_DBG("EPB", "Cache marked stale");
+  return true;
+}
+
+bool Epub::isCacheStale() const { return Storage.exists((cachePath + staleMarkerFile).c_str()); }
+
 void Epub::setupCacheDir() const {
   if (Storage.exists(cachePath.c_str())) {
     return;
@@ -490,6 +540,21 @@ void Epub::setupCacheDir() const {
 
 const std::string& Epub::getCachePath() const { return cachePath; }
 
+CssParser* Epub::getCssParser() const {
+  if (!cssParser) {
+    // Needed for inline styles even without stylesheets, which are parsed when a chapter linking them is laid out, see
+    // loadStylesheets()
+    cssParser.reset(new (std::nothrow) CssParser(cachePath));
+    if (!cssParser) {
+      LOG_ERR("EBP", "Couldn't allocate the CSS parser");
+      return nullptr;
+    }
+    // Left by versions that compiled every stylesheet of the book into one cache
+    cssParser->deleteCache();
+  }
+  return cssParser.get();
+}
+
 const std::string& Epub::getPath() const { return filepath; }
 
 const std::string& Epub::getTitle() const {
@@ -549,7 +614,7 @@ bool Epub::generateCoverBmp(bool cropped) const {
     if (!Storage.openFileForWrite("EBP", coverJpgTempPath, coverJpg)) {
       return false;
     }
-    readItemContentsToStream(coverImageHref, coverJpg, 1024);
+    extractItemToFile(coverImageHref, coverJpg);
     // Explicitly close() file before reopening for reading
     coverJpg.close();
 
@@ -583,7 +648,7 @@ bool Epub::generateCoverBmp(bool cropped) const {
     if (!Storage.openFileForWrite("EBP", coverPngTempPath, coverPng)) {
       return false;
     }
-    readItemContentsToStream(coverImageHref, coverPng, 1024);
+    extractItemToFile(coverImageHref, coverPng);
     // Explicitly close() file before reopening for reading
     coverPng.close();
 
@@ -638,7 +703,7 @@ bool Epub::generateThumbBmp(int height) const {
     if (!Storage.openFileForWrite("EBP", coverJpgTempPath, coverJpg)) {
       return false;
     }
-    readItemContentsToStream(coverImageHref, coverJpg, 1024);
+    extractItemToFile(coverImageHref, coverJpg);
     // Explicitly close() file before reopening for reading
     coverJpg.close();
 
@@ -675,7 +740,7 @@ bool Epub::generateThumbBmp(int height) const {
     if (!Storage.openFileForWrite("EBP", coverPngTempPath, coverPng)) {
       return false;
     }
-    readItemContentsToStream(coverImageHref, coverPng, 1024);
+    extractItemToFile(coverImageHref, coverPng);
     // Explicitly close() file before reopening for reading
     coverPng.close();
 
@@ -720,7 +785,30 @@ uint8_t* Epub::readItemContentsToBytes(const std::string& itemHref, size_t* size
 
   const std::string path = FsHelpers::normalisePath(itemHref);
 
-  const auto content = ZipFile(filepath).readFileToMemory(path.c_str(), size, trailingNullByte);
+  if (fb2) {
+    // Sections only; images are decoded as they are streamed
+    ZipFile::StoredEntry section;
+    if (!openStoredItem(path, section)) {
+      LOG_DBG("EBP", "Failed to read item %s", path.c_str());
+      return nullptr;
+    }
+    auto* content = static_cast<uint8_t*>(malloc(section.size() + (trailingNullByte ? 1 : 0)));
+    if (!content || section.read(content, section.size()) != static_cast<int>(section.size())) {
+      LOG_DBG("EBP", "Failed to read item %s", path.c_str());
+      free(content);
+      return nullptr;
+    }
+    if (trailingNullByte) {
+      content[section.size()] = '\0';
+    }
+    if (size) {
+      *size = section.size();
+    }
+    return content;
+  }
+
+  const auto content =
+      ZipFile(filepath, cachePath + zipIndexFile).readFileToMemory(path.c_str(), size, trailingNullByte);
   if (!content) {
     LOG_DBG("EBP", "Failed to read item %s", path.c_str());
     return nullptr;
@@ -736,12 +824,81 @@ bool Epub::readItemContentsToStream(const std::string& itemHref, Print& out, con
   }
 
   const std::string path = FsHelpers::normalisePath(itemHref);
-  return ZipFile(filepath).readFileToStream(path.c_str(), out, chunkSize);
+  if (fb2) {
+    return readFb2ItemToStream(path, out, chunkSize);
+  }
+  return ZipFile(filepath, cachePath + zipIndexFile).readFileToStream(path.c_str(), out, chunkSize);
+}
+
+bool Epub::readFb2ItemToStream(const std::string& path, Print& out, const size_t chunkSize) const {
+  ZipFile::StoredEntry section;
+  if (openStoredItem(path, section)) {
+    std::unique_ptr<uint8_t[]> buffer(new (std::nothrow) uint8_t[chunkSize]);
+    if (!buffer) {
+      return false;
+    }
+    while (section.available() > 0) {
+      const int read = section.read(buffer.get(), chunkSize);
+      if (read <= 0 || out.write(buffer.get(), read) != static_cast<size_t>(read)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  const Fb2Index::Image* image = fb2Index ? fb2Index->findImage(path) : nullptr;
+  if (!image) {
+    LOG_DBG("EBP", "No section or image %s in FB2 book", path.c_str());
+    return false;
+  }
+  FsFile book;
+  return Storage.openFileForRead("EBP", filepath, book) && Fb2Index::decodeImage(book, image->range, out);
+}
+
+bool Epub::extractItemToFile(const std::string& itemHref, FsFile& file) const {
+  size_t size = 0;
+  if (getItemSize(itemHref, &size) && size > 0 && !file.preAllocate(size)) {
+    LOG_DBG("EBP", "No contiguous run of %zu bytes for %s", size, itemHref.c_str());
+  }
+  return readItemContentsToStream(itemHref, file, Storage.getChunkSize());
+}
+
+bool Epub::openStoredItem(const std::string& itemHref, ZipFile::StoredEntry& entry) const {
+  if (itemHref.empty()) {
+    return false;
+  }
+
+  const std::string path = FsHelpers::normalisePath(itemHref);
+  if (fb2) {
+    // A section is read in place; an image is base64, never read as it is stored
+    const int section = fb2Index ? fb2Index->sectionIndex(path) : -1;
+    return section >= 0 && ZipFile::openFileRange(filepath, fb2Index->sections[section].offset,
+                                                  fb2Index->sections[section].length, entry);
+  }
+  return ZipFile(filepath, cachePath + zipIndexFile).openStoredEntry(path.c_str(), entry);
+}
+
+bool Epub::openInflatedItem(const std::string& itemHref, ZipFile::InflatedEntry& entry) const {
+  if (itemHref.empty() || fb2) {
+    return false;
+  }
+
+  const std::string path = FsHelpers::normalisePath(itemHref);
+  return ZipFile(filepath, cachePath + zipIndexFile).openInflatedEntry(path.c_str(), entry);
 }
 
 bool Epub::getItemSize(const std::string& itemHref, size_t* size) const {
   const std::string path = FsHelpers::normalisePath(itemHref);
-  return ZipFile(filepath).getInflatedFileSize(path.c_str(), size);
+  if (fb2) {
+    // The size of an image is only known once its base64 is decoded
+    const int section = fb2Index ? fb2Index->sectionIndex(path) : -1;
+    if (section < 0) {
+      return false;
+    }
+    *size = fb2Index->sections[section].length;
+    return true;
+  }
+  return ZipFile(filepath, cachePath + zipIndexFile).getInflatedFileSize(path.c_str(), size);
 }
 
 int Epub::getSpineItemsCount() const {
@@ -751,7 +908,23 @@ int Epub::getSpineItemsCount() const {
   return bookMetadataCache->getSpineCount();
 }
 
-size_t Epub::getCumulativeSpineItemSize(const int spineIndex) const { return getSpineItem(spineIndex).cumulativeSize; }
+size_t Epub::getCumulativeSpineItemSize(const int spineIndex) const {
+  const int index = validSpineIndex(spineIndex);
+  return index < 0 ? 0 : bookMetadataCache->getCumulativeSize(index);
+}
+
+// Like getSpineItem(): the first entry stands in for an index out of range. -1 if the cache is not loaded.
+int Epub::validSpineIndex(const int spineIndex) const {
+  if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
+    LOG_ERR("EBP", "Spine lookup but cache not loaded");
+    return -1;
+  }
+  if (spineIndex < 0 || spineIndex >= bookMetadataCache->getSpineCount()) {
+    LOG_ERR("EBP", "Spine index:%d is out of range", spineIndex);
+    return 0;
+  }
+  return spineIndex;
+}
 
 BookMetadataCache::SpineEntry Epub::getSpineItem(const int spineIndex) const {
   if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
@@ -781,6 +954,14 @@ BookMetadataCache::TocEntry Epub::getTocItem(const int tocIndex) const {
   return bookMetadataCache->getTocEntry(tocIndex);
 }
 
+bool Epub::getTocItems(const int first, const int count, std::vector<BookMetadataCache::TocEntry>& items) const {
+  if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
+    items.clear();
+    return false;
+  }
+  return bookMetadataCache->getTocEntries(first, count, items);
+}
+
 int Epub::getTocItemsCount() const {
   if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
     return 0;
@@ -801,7 +982,7 @@ int Epub::getSpineIndexForTocIndex(const int tocIndex) const {
     return 0;
   }
 
-  const int spineIndex = bookMetadataCache->getTocEntry(tocIndex).spineIndex;
+  const int spineIndex = bookMetadataCache->getSpineIndexForToc(tocIndex);
   if (spineIndex < 0) {
     LOG_DBG("EBP", "Section not found for TOC index %d", tocIndex);
     return 0;
@@ -810,7 +991,18 @@ int Epub::getSpineIndexForTocIndex(const int tocIndex) const {
   return spineIndex;
 }
 
-int Epub::getTocIndexForSpineIndex(const int spineIndex) const { return getSpineItem(spineIndex).tocIndex; }
+int Epub::getTocIndexForSpineIndex(const int spineIndex) const {
+  const int index = validSpineIndex(spineIndex);
+  return index < 0 ? -1 : bookMetadataCache->getTocIndexForSpine(index);
+}
+
+std::string Epub::getTocTitle(const int tocIndex) const {
+  if (!bookMetadataCache || !bookMetadataCache->isLoaded() || tocIndex < 0 ||
+      tocIndex >= bookMetadataCache->getTocCount()) {
+    return {};
+  }
+  return bookMetadataCache->getTocTitle(tocIndex);
+}
 
 size_t Epub::getBookSize() const {
   if (!bookMetadataCache || !bookMetadataCache->isLoaded() || bookMetadataCache->getSpineCount() == 0) {
@@ -834,13 +1026,11 @@ int Epub::getSpineIndexForTextReference() const {
     return 0;
   }
 
-  // loop through spine items to get the correct index matching the text href
-  for (size_t i = 0; i < getSpineItemsCount(); i++) {
-    if (getSpineItem(i).href == bookMetadataCache->coreMetadata.textReferenceHref) {
-      LOG_DBG("EBP", "Text reference %s found at index %d", bookMetadataCache->coreMetadata.textReferenceHref.c_str(),
-              i);
-      return i;
-    }
+  const int index = bookMetadataCache->findSpineIndex(bookMetadataCache->coreMetadata.textReferenceHref);
+  if (index >= 0) {
+    LOG_DBG("EBP", "Text reference %s found at index %d", bookMetadataCache->coreMetadata.textReferenceHref.c_str(),
+            index);
+    return index;
   }
   // This should not happen, as we checked for empty textReferenceHref earlier
   LOG_DBG("EBP", "Section not found for text reference");
@@ -871,18 +1061,23 @@ int Epub::resolveHrefToSpineIndex(const std::string& href) const {
   // Same-file reference (anchor-only)
   if (target.empty()) return -1;
 
-  // Extract just the filename for comparison
-  size_t targetSlash = target.find_last_of('/');
-  std::string targetFilename = (targetSlash != std::string::npos) ? target.substr(targetSlash + 1) : target;
+  // Exact match, else filename-only match
+  return bookMetadataCache->findSpineIndex(target);
+}
+
+const std::string& Epub::getFb2Encoding() const {
+  static std::string blank;
+  return fb2Index ? fb2Index->encoding : blank;
+}
 
-  for (int i = 0; i < getSpineItemsCount(); i++) {
-    const auto& spineHref = getSpineItem(i).href;
-    // Try exact match first
-    if (spineHref == target) return i;
-    // Then filename-only match
-    size_t spineSlash = spineHref.find_last_of('/');
-    std::string spineFilename = (spineSlash != std::string::npos) ? spineHref.substr(spineSlash + 1) : spineHref;
-    if (spineFilename == targetFilename) return i;
+std::string Epub::resolveFb2Href(const std::string& href) const {
+  if (!fb2Index || href.size() < 2 || href[0] != '#') {
+    return href;
+  }
+  const char* id = href.c_str() + 1;
+  if (const Fb2Index::Image* image = fb2Index->findImageById(id)) {
+    return image->href;
   }
-  return -1;
+  std::string target = fb2Index->linkTargetHref(id);
+  return target.empty() ? href : target;
 }
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <FsHelpers.h>
 #include <Print.h>
+#include <ZipFile.h>
 
 #include <memory>
 #include <string>
@@ -8,10 +10,9 @@
 #include <vector>
 
 #include "Epub/BookMetadataCache.h"
+#include "Epub/Fb2Index.h"
 #include "Epub/css/CssParser.h"
 
-class ZipFile;
-
 class Epub {
   // the ncx file (EPUB 2)
   std::string tocNcxItem;
@@ -25,26 +26,37 @@ class Epub {
   std::string cachePath;
   // Spine and TOC cache
   std::unique_ptr<BookMetadataCache> bookMetadataCache;
-  // CSS parser for styling
-  std::unique_ptr<CssParser> cssParser;
-  // CSS files
-  std::vector<std::string> cssFiles;
+  // CSS parser for styling, made when a section is first laid out (see getCssParser())
+  mutable std::unique_ptr<CssParser> cssParser;
+  // An FB2 book is read through its sections and images instead of as a zip
+  bool fb2;
+  std::unique_ptr<Fb2Index> fb2Index;
 
   bool findContentOpfFile(std::string* contentOpfFile) const;
   bool parseContentOpf(BookMetadataCache::BookMetadata& bookMetadata);
+  // The OPF and TOC passes of building the cache
+  bool parsePackage(BookMetadataCache::BookMetadata& bookMetadata);
+  // In their place for an FB2 book, in one pass over it; spineSizes are those of its sections
+  bool indexFb2(BookMetadataCache::BookMetadata& bookMetadata, std::vector<uint32_t>& spineSizes);
+  bool readFb2ItemToStream(const std::string& path, Print& out, size_t chunkSize) const;
   bool parseTocNcxFile() const;
   bool parseTocNavFile() const;
-  void parseCssFiles() const;
+  int validSpineIndex(int spineIndex) const;
 
  public:
-  explicit Epub(std::string filepath, const std::string& cacheDir) : filepath(std::move(filepath)) {
+  explicit Epub(std::string filepath, const std::string& cacheDir)
+      : filepath(std::move(filepath)), fb2(FsHelpers::hasFb2Extension(this->filepath)) {
     // create a cache key based on the filepath
     cachePath = cacheDir + "/epub_" + std::to_string(std::hash<std::string>{}(this->filepath));
   }
   ~Epub() = default;
   std::string& getBasePath() { return contentBasePath; }
-  bool load(bool buildIfMissing = true, bool skipLoadingCss = false);
+  bool load(bool buildIfMissing = true);
   bool clearCache() const;
+  // Marks the cache as belonging to an older copy of the book; the next load() clears it before using it. Cheap
+  // enough to call while answering an upload, unlike clearCache().
+  bool invalidateCache() const;
+  bool isCacheStale() const;
   void setupCacheDir() const;
   const std::string& getCachePath() const;
   const std::string& getPath() const;
@@ -59,9 +71,19 @@ class Epub {
   uint8_t* readItemContentsToBytes(const std::string& itemHref, size_t* size = nullptr,
                                    bool trailingNullByte = false) const;
   bool readItemContentsToStream(const std::string& itemHref, Print& out, size_t chunkSize) const;
+  // Streams an item into a newly created file, reserving contiguous clusters for all of it first
+  bool extractItemToFile(const std::string& itemHref, FsFile& file) const;
+  // Opens a view of an item stored without compression, to read it in place; false if it must be inflated
+  bool openStoredItem(const std::string& itemHref, ZipFile::StoredEntry& entry) const;
+  // Opens an inflating view of a compressed item, to parse it without inflating it to a temp file first
+  bool openInflatedItem(const std::string& itemHref, ZipFile::InflatedEntry& entry) const;
   bool getItemSize(const std::string& itemHref, size_t* size) const;
   BookMetadataCache::SpineEntry getSpineItem(int spineIndex) const;
   BookMetadataCache::TocEntry getTocItem(int tocIndex) const;
+  // Title of a TOC entry; cheaper than getTocItem() when asked for the same entry repeatedly
+  std::string getTocTitle(int tocIndex) const;
+  // Up to count consecutive TOC items from first on, read in one pass; for lists showing many at once
+  bool getTocItems(int first, int count, std::vector<BookMetadataCache::TocEntry>& items) const;
   int getSpineItemsCount() const;
   int getTocItemsCount() const;
   int getSpineIndexForTocIndex(int tocIndex) const;
@@ -71,6 +93,18 @@ class Epub {
 
   size_t getBookSize() const;
   float calculateProgress(int currentSpineIndex, float currentSpineRead) const;
-  CssParser* getCssParser() const { return cssParser.get(); }
+  // Made on first use, so a book whose sections are all laid out already never reads or holds any CSS; laying out is
+  // done under RenderLock, which keeps two tasks from making it at once
+  CssParser* getCssParser() const;
+  // Loads the rules of the given stylesheets (paths in the EPUB, in link order) into the CSS parser, compiling them
+  // into a cache the first time this set is asked for. An empty list leaves inline styles only.
+  bool loadStylesheets(const std::vector<std::string>& stylesheets) const;
   int resolveHrefToSpineIndex(const std::string& href) const;
+
+  bool isFb2() const { return fb2; }
+  // The encoding an FB2 book declares, which its sections are parsed in; empty for UTF-8
+  const std::string& getFb2Encoding() const;
+  // An FB2 reference ("#id") as the href of what it points to: an image, or the section holding the id with the id as
+  // its anchor. Unchanged if the id is neither's.
+  std::string resolveFb2Href(const std::string& href) const;
 };
@@ -9,10 +9,11 @@
 #include "FsHelpers.h"
 
 namespace {
-constexpr uint8_t BOOK_CACHE_VERSION = 5;
+constexpr uint8_t BOOK_CACHE_VERSION = 6;
 constexpr char bookBinFile[] = "/book.bin";
 constexpr char tmpSpineBinFile[] = "/spine.bin.tmp";
 constexpr char tmpTocBinFile[] = "/toc.bin.tmp";
+constexpr char zipIndexFile[] = "/zip.idx";  // Written by the ZipFile behind Epub's item reads
 }  // namespace
 
 /* ============= WRITING / BUILDING FUNCTIONS ================ */
@@ -29,13 +30,19 @@ bool BookMetadataCache::beginContentOpfPass() {
   LOG_DBG("BMC", "Beginning content opf pass");
 
   // Open spine file for writing
-  return Storage.openFileForWrite("BMC", cachePath + tmpSpineBinFile, spineFile);
+  if (!Storage.openFileForWrite("BMC", cachePath + tmpSpineBinFile, spineFile)) {
+    return false;
+  }
+  spineWriter.reset(new BufferedFileWriter(spineFile));
+  return true;
 }
 
 bool BookMetadataCache::endContentOpfPass() {
+  const bool written = !spineWriter || spineWriter->flush();
+  spineWriter.reset();
   // Explicit close() required: member variable persists beyond function scope
   spineFile.close();
-  return true;
+  return written;
 }
 
 bool BookMetadataCache::beginTocPass() {
@@ -49,43 +56,38 @@ bool BookMetadataCache::beginTocPass() {
     spineFile.close();
     return false;
   }
+  tocWriter.reset(new BufferedFileWriter(tocFile));
 
-  if (spineCount >= LARGE_SPINE_THRESHOLD) {
-    spineHrefIndex.clear();
-    spineHrefIndex.resize(spineCount);
-    spineFile.seek(0);
-    for (int i = 0; i < spineCount; i++) {
-      auto entry = readSpineEntry(spineFile);
-      SpineHrefIndexEntry idx;
-      idx.hrefHash = fnvHash64(entry.href);
-      idx.hrefLen = static_cast<uint16_t>(entry.href.size());
-      idx.spineIndex = static_cast<int16_t>(i);
-      spineHrefIndex[i] = idx;
-    }
-    std::sort(spineHrefIndex.begin(), spineHrefIndex.end(),
-              [](const SpineHrefIndexEntry& a, const SpineHrefIndexEntry& b) {
-                return a.hrefHash < b.hrefHash || (a.hrefHash == b.hrefHash && a.hrefLen < b.hrefLen);
-              });
-    spineFile.seek(0);
-    useSpineHrefIndex = true;
-    LOG_DBG("BMC", "Using fast index for %d spine items", spineCount);
-  } else {
-    useSpineHrefIndex = false;
+  spineHrefIndex.clear();
+  spineHrefIndex.resize(spineCount);
+  spineFile.seek(0);
+  BufferedFileReader spineReader(spineFile);
+  for (int i = 0; i < spineCount; i++) {
+    auto entry = readSpineEntry(spineReader);
+    SpineHrefIndexEntry idx;
+    idx.hrefHash = fnvHash64(entry.href);
+    idx.hrefLen = static_cast<uint16_t>(entry.href.size());
+    idx.spineIndex = static_cast<int16_t>(i);
+    spineHrefIndex[i] = idx;
   }
+  std::sort(spineHrefIndex.begin(), spineHrefIndex.end(), hrefIndexLess);
+  spineFile.seek(0);
+  LOG_DBG("BMC", "Indexed %d spine items", spineCount);
 
   return true;
 }
 
 bool BookMetadataCache::endTocPass() {
+  const bool written = !tocWriter || tocWriter->flush();
+  tocWriter.reset();
   // Explicit close() required: member variables persist beyond function scope
   tocFile.close();
   spineFile.close();
 
   spineHrefIndex.clear();
   spineHrefIndex.shrink_to_fit();
-  useSpineHrefIndex = false;
 
-  return true;
+  return written;
 }
 
 bool BookMetadataCache::endWrite() {
@@ -99,7 +101,8 @@ bool BookMetadataCache::endWrite() {
   return true;
 }
 
-bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMetadata& metadata) {
+bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMetadata& metadata,
+                                     const std::vector<uint32_t>& knownSpineSizes) {
   // Open all three files, writing to meta, reading from spine and toc
   if (!Storage.openFileForWrite("BMC", cachePath + bookBinFile, bookFile)) {
     return false;
@@ -118,40 +121,53 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
     return false;
   }
 
-  constexpr uint32_t headerASize =
-      sizeof(BOOK_CACHE_VERSION) + /* LUT Offset */ sizeof(uint32_t) + sizeof(spineCount) + sizeof(tocCount);
+  // Flushed before book.bin is closed
+  BufferedFileWriter bookWriter(bookFile, 4096);
+
+  constexpr uint32_t headerASize = sizeof(BOOK_CACHE_VERSION) + /* LUT Offset */ sizeof(uint32_t) +
+                                   sizeof(spineCount) + sizeof(tocCount) + /* Href index offset */ sizeof(uint32_t);
   const uint32_t metadataSize = metadata.title.size() + metadata.author.size() + metadata.language.size() +
                                 metadata.coverItemHref.size() + metadata.textReferenceHref.size() +
                                 sizeof(uint32_t) * 5;
   const uint32_t lutSize = sizeof(uint32_t) * spineCount + sizeof(uint32_t) * tocCount;
   const uint32_t lutOffset = headerASize + metadataSize;
+  // The entries are copied from the temp files, fixed size fields filled in, so the size is known up front: one run of
+  // clusters for all of it, the href index last
+  const uint32_t indexOffset = lutOffset + lutSize + spineFile.size() + tocFile.size();
+  bookFile.preAllocate(indexOffset + HREF_INDEX_ENTRY_SIZE * spineCount);
 
   // Header A
-  serialization::writePod(bookFile, BOOK_CACHE_VERSION);
-  serialization::writePod(bookFile, lutOffset);
-  serialization::writePod(bookFile, spineCount);
-  serialization::writePod(bookFile, tocCount);
+  serialization::writePod(bookWriter, BOOK_CACHE_VERSION);
+  serialization::writePod(bookWriter, lutOffset);
+  serialization::writePod(bookWriter, spineCount);
+  serialization::writePod(bookWriter, tocCount);
+  serialization::writePod(bookWriter, indexOffset);
   // Metadata
-  serialization::writeString(bookFile, metadata.title);
-  serialization::writeString(bookFile, metadata.author);
-  serialization::writeString(bookFile, metadata.language);
-  serialization::writeString(bookFile, metadata.coverItemHref);
-  serialization::writeString(bookFile, metadata.textReferenceHref);
+  serialization::writeString(bookWriter, metadata.title);
+  serialization::writeString(bookWriter, metadata.author);
+  serialization::writeString(bookWriter, metadata.language);
+  serialization::writeString(bookWriter, metadata.coverItemHref);
+  serialization::writeString(bookWriter, metadata.textReferenceHref);
 
-  // Loop through spine entries, writing LUT positions
+  // The temp files are read through these from here on
   spineFile.seek(0);
+  tocFile.seek(0);
+  BufferedFileReader spineReader(spineFile);
+  BufferedFileReader tocReader(tocFile);
+
+  // Loop through spine entries, writing LUT positions
   for (int i = 0; i < spineCount; i++) {
-    uint32_t pos = spineFile.position();
-    auto spineEntry = readSpineEntry(spineFile);
-    serialization::writePod(bookFile, pos + lutOffset + lutSize);
+    uint32_t pos = spineReader.position();
+    auto spineEntry = readSpineEntry(spineReader);
+    serialization::writePod(bookWriter, pos + lutOffset + lutSize);
   }
+  const auto spineSize = static_cast<uint32_t>(spineReader.position());
 
   // Loop through toc entries, writing LUT positions
-  tocFile.seek(0);
   for (int i = 0; i < tocCount; i++) {
-    uint32_t pos = tocFile.position();
-    auto tocEntry = readTocEntry(tocFile);
-    serialization::writePod(bookFile, pos + lutOffset + lutSize + static_cast<uint32_t>(spineFile.position()));
+    uint32_t pos = tocReader.position();
+    auto tocEntry = readTocEntry(tocReader);
+    serialization::writePod(bookWriter, pos + lutOffset + lutSize + spineSize);
   }
 
   // LUTs complete
@@ -159,9 +175,9 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
 
   // Build spineIndex->tocIndex mapping in one pass (O(n) instead of O(n*m))
   std::deque<int16_t> spineToTocIndex(spineCount, -1);
-  tocFile.seek(0);
+  tocReader.seek(0);
   for (int j = 0; j < tocCount; j++) {
-    auto tocEntry = readTocEntry(tocFile);
+    auto tocEntry = readTocEntry(tocReader);
     if (tocEntry.spineIndex >= 0 && tocEntry.spineIndex < spineCount) {
       if (spineToTocIndex[tocEntry.spineIndex] == -1) {
         spineToTocIndex[tocEntry.spineIndex] = static_cast<int16_t>(j);
@@ -169,9 +185,10 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
     }
   }
 
-  ZipFile zip(epubPath);
+  const bool sizesKnown = !knownSpineSizes.empty();
+  ZipFile zip(epubPath, cachePath + zipIndexFile);
   // Pre-open zip file to speed up size calculations
-  if (!zip.open()) {
+  if (!sizesKnown && !zip.open()) {
     LOG_ERR("BMC", "Could not open EPUB zip for size calculations");
     // Explicit close() required: member variables persist beyond function scope
     bookFile.close();
@@ -190,15 +207,15 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
   std::deque<uint32_t> spineSizes;
   bool useBatchSizes = false;
 
-  if (spineCount >= LARGE_SPINE_THRESHOLD) {
+  if (!sizesKnown && spineCount >= LARGE_SPINE_THRESHOLD) {
     LOG_DBG("BMC", "Using batch size lookup for %d spine items", spineCount);
 
     std::deque<ZipFile::SizeTarget> targets;
     targets.resize(spineCount);
 
-    spineFile.seek(0);
+    spineReader.seek(0);
     for (int i = 0; i < spineCount; i++) {
-      auto entry = readSpineEntry(spineFile);
+      auto entry = readSpineEntry(spineReader);
       std::string path = FsHelpers::normalisePath(entry.href);
 
       ZipFile::SizeTarget t;
@@ -222,11 +239,16 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
     useBatchSizes = true;
   }
 
+  // Spine file names, for findSpineIndex()
+  std::deque<SpineHrefIndexEntry> fileNameIndex(spineCount);
+
   uint32_t cumSize = 0;
-  spineFile.seek(0);
+  spineReader.seek(0);
   int lastSpineTocIndex = -1;
   for (int i = 0; i < spineCount; i++) {
-    auto spineEntry = readSpineEntry(spineFile);
+    auto spineEntry = readSpineEntry(spineReader);
+    const std::string fileName = fileNameOf(spineEntry.href);
+    fileNameIndex[i] = {fnvHash64(fileName), static_cast<uint16_t>(fileName.size()), static_cast<int16_t>(i)};
 
     spineEntry.tocIndex = spineToTocIndex[i];
 
@@ -240,7 +262,9 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
     lastSpineTocIndex = spineEntry.tocIndex;
 
     size_t itemSize = 0;
-    if (useBatchSizes) {
+    if (sizesKnown) {
+      itemSize = i < static_cast<int>(knownSpineSizes.size()) ? knownSpineSizes[i] : 0;
+    } else if (useBatchSizes) {
       itemSize = spineSizes[i];
       if (itemSize == 0) {
         const std::string path = FsHelpers::normalisePath(spineEntry.href);
@@ -259,22 +283,40 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
     spineEntry.cumulativeSize = cumSize;
 
     // Write out spine data to book.bin
-    writeSpineEntry(bookFile, spineEntry);
+    writeSpineEntry(bookWriter, spineEntry);
   }
   // Close opened zip file
   zip.close();
 
   // Loop through toc entries from toc file writing to book.bin
-  tocFile.seek(0);
+  tocReader.seek(0);
   for (int i = 0; i < tocCount; i++) {
-    auto tocEntry = readTocEntry(tocFile);
-    writeTocEntry(bookFile, tocEntry);
+    auto tocEntry = readTocEntry(tocReader);
+    writeTocEntry(bookWriter, tocEntry);
   }
 
+  // Href index
+  const bool indexPlaced = bookWriter.position() == indexOffset;
+  if (!indexPlaced) {
+    LOG_ERR("BMC", "Href index at %u, expected %u", static_cast<unsigned>(bookWriter.position()),
+            static_cast<unsigned>(indexOffset));
+  }
+  std::sort(fileNameIndex.begin(), fileNameIndex.end(), hrefIndexLess);
+  for (const SpineHrefIndexEntry& entry : fileNameIndex) {
+    serialization::writePod(bookWriter, entry.hrefHash);
+    serialization::writePod(bookWriter, entry.hrefLen);
+    serialization::writePod(bookWriter, entry.spineIndex);
+  }
+
+  const bool written = indexPlaced && bookWriter.flush() && bookFile.truncate();
   // Explicit close() required: member variables persist beyond function scope
   bookFile.close();
   spineFile.close();
   tocFile.close();
+  if (!written) {
+    LOG_ERR("BMC", "Failed to write book.bin");
+    return false;
+  }
 
   LOG_DBG("BMC", "Successfully built book.bin");
   return true;
@@ -292,80 +334,56 @@ bool BookMetadataCache::cleanupTmpFiles() const {
   return true;
 }
 
-uint32_t BookMetadataCache::writeSpineEntry(FsFile& file, const SpineEntry& entry) const {
-  const uint32_t pos = file.position();
-  serialization::writeString(file, entry.href);
-  serialization::writePod(file, entry.cumulativeSize);
-  serialization::writePod(file, entry.tocIndex);
+uint32_t BookMetadataCache::writeSpineEntry(BufferedFileWriter& writer, const SpineEntry& entry) const {
+  const uint32_t pos = writer.position();
+  serialization::writeString(writer, entry.href);
+  serialization::writePod(writer, entry.cumulativeSize);
+  serialization::writePod(writer, entry.tocIndex);
   return pos;
 }
 
-uint32_t BookMetadataCache::writeTocEntry(FsFile& file, const TocEntry& entry) const {
-  const uint32_t pos = file.position();
-  serialization::writeString(file, entry.title);
-  serialization::writeString(file, entry.href);
-  serialization::writeString(file, entry.anchor);
-  serialization::writePod(file, entry.level);
-  serialization::writePod(file, entry.spineIndex);
+uint32_t BookMetadataCache::writeTocEntry(BufferedFileWriter& writer, const TocEntry& entry) const {
+  const uint32_t pos = writer.position();
+  serialization::writeString(writer, entry.title);
+  serialization::writeString(writer, entry.href);
+  serialization::writeString(writer, entry.anchor);
+  serialization::writePod(writer, entry.level);
+  serialization::writePod(writer, entry.spineIndex);
   return pos;
 }
 
 // Note: for the LUT to be accurate, this **MUST** be called for all spine items before `addTocEntry` is ever called
 // this is because in this function we're marking positions of the items
 void BookMetadataCache::createSpineEntry(const std::string& href) {
-  if (!buildMode || !spineFile) {
+  if (!buildMode || !spineFile || !spineWriter) {
     LOG_DBG("BMC", "createSpineEntry called but not in build mode");
     return;
   }
 
   const SpineEntry entry(href, 0, -1);
-  writeSpineEntry(spineFile, entry);
+  writeSpineEntry(*spineWriter, entry);
   spineCount++;
 }
 
 void BookMetadataCache::createTocEntry(const std::string& title, const std::string& href, const std::string& anchor,
                                        const uint8_t level) {
-  if (!buildMode || !tocFile || !spineFile) {
+  if (!buildMode || !tocFile || !spineFile || !tocWriter) {
     LOG_DBG("BMC", "createTocEntry called but not in build mode");
     return;
   }
 
   int16_t spineIndex = -1;
 
-  if (useSpineHrefIndex) {
-    uint64_t targetHash = fnvHash64(href);
-    uint16_t targetLen = static_cast<uint16_t>(href.size());
-
-    auto it =
-        std::lower_bound(spineHrefIndex.begin(), spineHrefIndex.end(), SpineHrefIndexEntry{targetHash, targetLen, 0},
-                         [](const SpineHrefIndexEntry& a, const SpineHrefIndexEntry& b) {
-                           return a.hrefHash < b.hrefHash || (a.hrefHash == b.hrefHash && a.hrefLen < b.hrefLen);
-                         });
-
-    while (it != spineHrefIndex.end() && it->hrefHash == targetHash && it->hrefLen == targetLen) {
-      spineIndex = it->spineIndex;
-      break;
-    }
-
-    if (spineIndex == -1) {
-      LOG_DBG("BMC", "createTocEntry: Could not find spine item for TOC href %s", href.c_str());
-    }
+  const SpineHrefIndexEntry key{fnvHash64(href), static_cast<uint16_t>(href.size()), 0};
+  const auto it = std::lower_bound(spineHrefIndex.begin(), spineHrefIndex.end(), key, hrefIndexLess);
+  if (it != spineHrefIndex.end() && it->hrefHash == key.hrefHash && it->hrefLen == key.hrefLen) {
+    spineIndex = it->spineIndex;
   } else {
-    spineFile.seek(0);
-    for (int i = 0; i < spineCount; i++) {
-      auto spineEntry = readSpineEntry(spineFile);
-      if (spineEntry.href == href) {
-        spineIndex = static_cast<int16_t>(i);
-        break;
-      }
-    }
-    if (spineIndex == -1) {
-      LOG_DBG("BMC", "createTocEntry: Could not find spine item for TOC href %s", href.c_str());
-    }
+    LOG_DBG("BMC", "createTocEntry: Could not find spine item for TOC href %s", href.c_str());
   }
 
   const TocEntry entry(title, href, anchor, level, spineIndex);
-  writeTocEntry(tocFile, entry);
+  writeTocEntry(*tocWriter, entry);
   tocCount++;
 }
 
@@ -388,6 +406,7 @@ bool BookMetadataCache::load() {
   serialization::readPod(bookFile, lutOffset);
   serialization::readPod(bookFile, spineCount);
   serialization::readPod(bookFile, tocCount);
+  serialization::readPod(bookFile, hrefIndexOffset);
 
   serialization::readString(bookFile, coreMetadata.title);
   serialization::readString(bookFile, coreMetadata.author);
@@ -395,11 +414,131 @@ bool BookMetadataCache::load() {
   serialization::readString(bookFile, coreMetadata.coverItemHref);
   serialization::readString(bookFile, coreMetadata.textReferenceHref);
 
+  if (!loadEntryInfo()) {
+    LOG_ERR("BMC", "Could not read spine and TOC entries");
+    bookFile.close();
+    return false;
+  }
+
   loaded = true;
   LOG_DBG("BMC", "Loaded cache data: %d spine, %d TOC entries", spineCount, tocCount);
   return true;
 }
 
+// Entries follow the LUT in order, spine first, so one sequential pass reads them all
+bool BookMetadataCache::loadEntryInfo() {
+  BufferedFileReader reader(bookFile, 1024);
+  auto skipString = [&reader] {
+    uint32_t len;
+    serialization::readPod(reader, len);
+    return reader.skip(len);
+  };
+
+  cachedTitleIndex = -1;
+  spineInfo.clear();
+  tocSpineIndex.clear();
+  spineInfo.reserve(spineCount);
+  tocSpineIndex.reserve(tocCount);
+
+  if (!reader.seek(lutOffset + sizeof(uint32_t) * (spineCount + tocCount))) {
+    return false;
+  }
+  for (uint16_t i = 0; i < spineCount; i++) {
+    SpineInfo info;
+    if (!skipString()) {
+      return false;
+    }
+    serialization::readPod(reader, info.cumulativeSize);
+    serialization::readPod(reader, info.tocIndex);
+    spineInfo.push_back(info);
+  }
+  for (uint16_t i = 0; i < tocCount; i++) {
+    // Title, href and anchor, then the level
+    if (!skipString() || !skipString() || !skipString() || !reader.skip(sizeof(uint8_t))) {
+      return false;
+    }
+    int16_t spineIndex;
+    serialization::readPod(reader, spineIndex);
+    tocSpineIndex.push_back(spineIndex);
+  }
+  return true;
+}
+
+size_t BookMetadataCache::getCumulativeSize(const int spineIndex) const {
+  return spineIndex >= 0 && spineIndex < static_cast<int>(spineInfo.size()) ? spineInfo[spineIndex].cumulativeSize
+                                                                              : 0;
+}
+
+int16_t BookMetadataCache::getTocIndexForSpine(const int spineIndex) const {
+  return spineIndex >= 0 && spineIndex < static_cast<int>(spineInfo.size()) ? spineInfo[spineIndex].tocIndex : -1;
+}
+
+int16_t BookMetadataCache::getSpineIndexForToc(const int tocIndex) const {
+  return tocIndex >= 0 && tocIndex < static_cast<int>(tocSpineIndex.size()) ? tocSpineIndex[tocIndex] : -1;
+}
+
+bool BookMetadataCache::readHrefIndexEntry(const uint32_t index, SpineHrefIndexEntry& entry) {
+  if (!bookFile.seek(hrefIndexOffset + HREF_INDEX_ENTRY_SIZE * index)) {
+    return false;
+  }
+  serialization::readPod(bookFile, entry.hrefHash);
+  serialization::readPod(bookFile, entry.hrefLen);
+  serialization::readPod(bookFile, entry.spineIndex);
+  return true;
+}
+
+int BookMetadataCache::findSpineIndex(const std::string& href) {
+  if (!loaded || href.empty()) {
+    return -1;
+  }
+
+  const std::string fileName = fileNameOf(href);
+  const SpineHrefIndexEntry key{fnvHash64(fileName), static_cast<uint16_t>(fileName.size()), 0};
+  uint32_t low = 0;
+  uint32_t high = spineCount;
+  SpineHrefIndexEntry entry;
+  while (low < high) {
+    const uint32_t mid = low + (high - low) / 2;
+    if (!readHrefIndexEntry(mid, entry)) {
+      return -1;
+    }
+    if (hrefIndexLess(entry, key)) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+
+  // The items with this file name, in spine order
+  std::vector<int16_t> candidates;
+  for (uint32_t i = low; i < spineCount && readHrefIndexEntry(i, entry); i++) {
+    if (entry.hrefHash != key.hrefHash || entry.hrefLen != key.hrefLen) {
+      break;
+    }
+    candidates.push_back(entry.spineIndex);
+  }
+  if (candidates.empty()) {
+    return -1;
+  }
+  // Only a file name shared by several items needs their hrefs read: the one at href itself, else the first
+  if (candidates.size() > 1) {
+    for (const int16_t candidate : candidates) {
+      if (getSpineEntry(candidate).href == href) {
+        return candidate;
+      }
+    }
+  }
+  return candidates.front();
+}
+
+const std::string& BookMetadataCache::getTocTitle(const int tocIndex) {
+  if (tocIndex != cachedTitleIndex) {
+    cachedTitle = getTocEntry(tocIndex).title;
+    cachedTitleIndex = tocIndex;
+  }
+  return cachedTitle;
+}
+
 BookMetadataCache::SpineEntry BookMetadataCache::getSpineEntry(const int index) {
   if (!loaded) {
     LOG_ERR("BMC", "getSpineEntry called but cache not loaded");
@@ -412,11 +551,12 @@ BookMetadataCache::SpineEntry BookMetadataCache::getSpineEntry(const int index)
   }
 
   // Seek to spine LUT item, read from LUT and get out data
-  bookFile.seek(lutOffset + sizeof(uint32_t) * index);
+  BufferedFileReader reader(bookFile);
+  reader.seek(lutOffset + sizeof(uint32_t) * index);
   uint32_t spineEntryPos;
-  serialization::readPod(bookFile, spineEntryPos);
-  bookFile.seek(spineEntryPos);
-  return readSpineEntry(bookFile);
+  serialization::readPod(reader, spineEntryPos);
+  reader.seek(spineEntryPos);
+  return readSpineEntry(reader);
 }
 
 BookMetadataCache::TocEntry BookMetadataCache::getTocEntry(const int index) {
@@ -431,27 +571,49 @@ BookMetadataCache::TocEntry BookMetadataCache::getTocEntry(const int index) {
   }
 
   // Seek to TOC LUT item, read from LUT and get out data
-  bookFile.seek(lutOffset + sizeof(uint32_t) * spineCount + sizeof(uint32_t) * index);
+  BufferedFileReader reader(bookFile);
+  reader.seek(lutOffset + sizeof(uint32_t) * spineCount + sizeof(uint32_t) * index);
   uint32_t tocEntryPos;
-  serialization::readPod(bookFile, tocEntryPos);
-  bookFile.seek(tocEntryPos);
-  return readTocEntry(bookFile);
+  serialization::readPod(reader, tocEntryPos);
+  reader.seek(tocEntryPos);
+  return readTocEntry(reader);
+}
+
+bool BookMetadataCache::getTocEntries(const int first, const int count, std::vector<TocEntry>& entries) {
+  entries.clear();
+  if (!loaded || first < 0 || first >= static_cast<int>(tocCount) || count <= 0) {
+    return false;
+  }
+
+  // The entries are stored in order, so only the first one needs its LUT position
+  BufferedFileReader reader(bookFile, 1024);
+  reader.seek(lutOffset + sizeof(uint32_t) * spineCount + sizeof(uint32_t) * first);
+  uint32_t tocEntryPos;
+  serialization::readPod(reader, tocEntryPos);
+  reader.seek(tocEntryPos);
+
+  const int total = std::min(count, static_cast<int>(tocCount) - first);
+  entries.reserve(total);
+  for (int i = 0; i < total; i++) {
+    entries.push_back(readTocEntry(reader));
+  }
+  return true;
 }
 
-BookMetadataCache::SpineEntry BookMetadataCache::readSpineEntry(FsFile& file) const {
+BookMetadataCache::SpineEntry BookMetadataCache::readSpineEntry(BufferedFileReader& reader) const {
   SpineEntry entry;
-  serialization::readString(file, entry.href);
-  serialization::readPod(file, entry.cumulativeSize);
-  serialization::readPod(file, entry.tocIndex);
+  serialization::readString(reader, entry.href);
+  serialization::readPod(reader, entry.cumulativeSize);
+  serialization::readPod(reader, entry.tocIndex);
   return entry;
 }
 
-BookMetadataCache::TocEntry BookMetadataCache::readTocEntry(FsFile& file) const {
+BookMetadataCache::TocEntry BookMetadataCache::readTocEntry(BufferedFileReader& reader) const {
   TocEntry entry;
-  serialization::readString(file, entry.title);
-  serialization::readString(file, entry.href);
-  serialization::readString(file, entry.anchor);
-  serialization::readPod(file, entry.level);
-  serialization::readPod(file, entry.spineIndex);
+  serialization::readString(reader, entry.title);
+  serialization::readString(reader, entry.href);
+  serialization::readString(reader, entry.anchor);
+  serialization::readPod(reader, entry.level);
+  serialization::readPod(reader, entry.spineIndex);
   return entry;
 }
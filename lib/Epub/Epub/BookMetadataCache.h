@@ -1,10 +1,14 @@
 #pragma once
 
+#include <BufferedFileReader.h>
+#include <BufferedFileWriter.h>
 #include <HalStorage.h>
 
 #include <algorithm>
 #include <deque>
+#include <memory>
 #include <string>
+#include <vector>
 
 class BookMetadataCache {
  public:
@@ -45,27 +49,44 @@ class BookMetadataCache {
  private:
   std::string cachePath;
   size_t lutOffset;
+  uint32_t hrefIndexOffset = 0;
   uint16_t spineCount;
   uint16_t tocCount;
   bool loaded;
   bool buildMode;
 
   FsFile bookFile;
-  // Temp file handles during build
+  // Temp file handles during build, written through the writers during their pass
   FsFile spineFile;
   FsFile tocFile;
+  std::unique_ptr<BufferedFileWriter> spineWriter;
+  std::unique_ptr<BufferedFileWriter> tocWriter;
 
-  // Index for fast href→spineIndex lookup (used only for large EPUBs)
+  // Index for fast href→spineIndex lookup, sorted by hash, length, then spine index (so the first of equal keys is the
+  // earliest in the spine). The TOC pass keeps one of the full hrefs in RAM; book.bin ends with one of the file names,
+  // binary searched in place by findSpineIndex().
   struct SpineHrefIndexEntry {
     uint64_t hrefHash;  // FNV-1a 64-bit hash
     uint16_t hrefLen;   // length for collision reduction
     int16_t spineIndex;
   };
+  static constexpr uint32_t HREF_INDEX_ENTRY_SIZE = sizeof(uint64_t) + sizeof(uint16_t) + sizeof(int16_t);
   std::deque<SpineHrefIndexEntry> spineHrefIndex;
-  bool useSpineHrefIndex = false;
 
   static constexpr uint16_t LARGE_SPINE_THRESHOLD = 400;
 
+  // Numeric fields of every entry, read once by load() so progress and chapter lookups on each page need no SD access.
+  // The strings stay on the card until asked for.
+  struct SpineInfo {
+    size_t cumulativeSize;
+    int16_t tocIndex;
+  };
+  std::vector<SpineInfo> spineInfo;
+  std::vector<int16_t> tocSpineIndex;
+  // Last TOC title read, the status bar asks for the same chapter on every page
+  int cachedTitleIndex = -1;
+  std::string cachedTitle;
+
   // FNV-1a 64-bit hash function
   static uint64_t fnvHash64(const std::string& s) {
     uint64_t hash = 14695981039346656037ull;
@@ -75,11 +96,22 @@ class BookMetadataCache {
     }
     return hash;
   }
+  static bool hrefIndexLess(const SpineHrefIndexEntry& a, const SpineHrefIndexEntry& b) {
+    if (a.hrefHash != b.hrefHash) return a.hrefHash < b.hrefHash;
+    if (a.hrefLen != b.hrefLen) return a.hrefLen < b.hrefLen;
+    return a.spineIndex < b.spineIndex;
+  }
+  static std::string fileNameOf(const std::string& href) {
+    const size_t slash = href.find_last_of('/');
+    return slash == std::string::npos ? href : href.substr(slash + 1);
+  }
 
-  uint32_t writeSpineEntry(FsFile& file, const SpineEntry& entry) const;
-  uint32_t writeTocEntry(FsFile& file, const TocEntry& entry) const;
-  SpineEntry readSpineEntry(FsFile& file) const;
-  TocEntry readTocEntry(FsFile& file) const;
+  uint32_t writeSpineEntry(BufferedFileWriter& writer, const SpineEntry& entry) const;
+  uint32_t writeTocEntry(BufferedFileWriter& writer, const TocEntry& entry) const;
+  SpineEntry readSpineEntry(BufferedFileReader& reader) const;
+  TocEntry readTocEntry(BufferedFileReader& reader) const;
+  bool loadEntryInfo();
+  bool readHrefIndexEntry(uint32_t index, SpineHrefIndexEntry& entry);
 
  public:
   BookMetadata coreMetadata;
@@ -99,13 +131,25 @@ class BookMetadataCache {
   bool endWrite();
   bool cleanupTmpFiles() const;
 
-  // Post-processing to update mappings and sizes
-  bool buildBookBin(const std::string& epubPath, const BookMetadata& metadata);
+  // Post-processing to update mappings and sizes. knownSpineSizes, if given, are the spine item sizes, which are then
+  // not looked up in the EPUB zip (an FB2 book has none)
+  bool buildBookBin(const std::string& epubPath, const BookMetadata& metadata,
+                    const std::vector<uint32_t>& knownSpineSizes = {});
 
   // Reading phase (read mode)
   bool load();
   SpineEntry getSpineEntry(int index);
   TocEntry getTocEntry(int index);
+  // Up to count consecutive TOC entries from first on, in one sequential read
+  bool getTocEntries(int first, int count, std::vector<TocEntry>& entries);
+  // From the in-RAM table; an index out of range gives the values of an empty entry
+  size_t getCumulativeSize(int spineIndex) const;
+  int16_t getTocIndexForSpine(int spineIndex) const;
+  int16_t getSpineIndexForToc(int tocIndex) const;
+  const std::string& getTocTitle(int tocIndex);
+  // The spine item at href (no #fragment), or failing that the first with the same file name; -1 if none. A binary
+  // search of the index at the end of book.bin, reading a spine entry only when several share the file name.
+  int findSpineIndex(const std::string& href);
   int getSpineCount() const { return spineCount; }
   int getTocCount() const { return tocCount; }
   bool isLoaded() const { return loaded; }
@@ -0,0 +1,103 @@
+#include "BookPageCounts.h"
+
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "Epub.h"
+
+namespace {
+constexpr uint8_t PAGES_FILE_VERSION = 1;
+
+std::string pagesPath(const std::string& layoutDir) { return layoutDir + "/pages.bin"; }
+
+bool readCounts(const std::string& layoutDir, const int spineCount, std::vector<uint16_t>& counts) {
+  counts.assign(spineCount, BookPageCounts::UNKNOWN);
+  FsFile f;
+  const std::string path = pagesPath(layoutDir);
+  if (!Storage.exists(path.c_str()) || !Storage.openFileForRead("BPC", path, f)) {
+    return false;
+  }
+  uint8_t version = 0;
+  uint16_t count = 0;
+  serialization::readPod(f, version);
+  serialization::readPod(f, count);
+  if (version != PAGES_FILE_VERSION || count != spineCount) {
+    return false;
+  }
+  return f.read(counts.data(), count * sizeof(uint16_t)) == static_cast<int>(count * sizeof(uint16_t));
+}
+}  // namespace
+
+void BookPageCounts::record(const std::string& layoutDir, const int spineCount, const int spineIndex,
+                            const uint16_t pageCount) {
+  if (spineIndex < 0 || spineIndex >= spineCount || pageCount == UNKNOWN) {
+    return;
+  }
+  std::vector<uint16_t> counts;
+  readCounts(layoutDir, spineCount, counts);
+  if (counts[spineIndex] == pageCount) {
+    return;
+  }
+  counts[spineIndex] = pageCount;
+
+  FsFile f;
+  if (!Storage.openFileForWrite("BPC", pagesPath(layoutDir), f)) {
+    return;
+  }
+  serialization::writePod(f, PAGES_FILE_VERSION);
+  serialization::writePod(f, static_cast<uint16_t>(spineCount));
+  f.write(counts.data(), counts.size() * sizeof(uint16_t));
+}
+
+bool BookPageCounts::load(const Epub& epub, const std::string& layoutDir) {
+  const int spineCount = epub.getSpineItemsCount();
+  readCounts(layoutDir, spineCount, counts);
+  sizes.resize(spineCount);
+
+  size_t previous = 0;
+  uint64_t laidOutBytes = 0;
+  uint32_t laidOutPages = 0;
+  exact = true;
+  for (int i = 0; i < spineCount; i++) {
+    const size_t cumulative = epub.getCumulativeSpineItemSize(i);
+    sizes[i] = static_cast<uint32_t>(cumulative - previous);
+    previous = cumulative;
+    if (counts[i] == UNKNOWN) {
+      exact = false;
+    } else {
+      laidOutBytes += sizes[i];
+      laidOutPages += counts[i];
+    }
+  }
+  bytesPerPage = laidOutPages > 0 ? static_cast<float>(laidOutBytes) / static_cast<float>(laidOutPages) : 0;
+  LOG_DBG("BPC", "%u pages laid out, %.0f bytes per page, %d pages in the book%s", laidOutPages, bytesPerPage,
+          totalPages(), exact ? "" : " (estimated)");
+  return isLoaded();
+}
+
+int BookPageCounts::pagesOf(const int spineIndex) const {
+  if (spineIndex < 0 || spineIndex >= static_cast<int>(counts.size())) {
+    return 0;
+  }
+  if (counts[spineIndex] != UNKNOWN) {
+    return counts[spineIndex];
+  }
+  if (bytesPerPage <= 0) {
+    return 0;
+  }
+  // Every spine item shows at least one page
+  return std::max(1, static_cast<int>(std::lround(static_cast<float>(sizes[spineIndex]) / bytesPerPage)));
+}
+
+int BookPageCounts::pagesBefore(const int spineIndex) const {
+  const int end = std::min(spineIndex, static_cast<int>(counts.size()));
+  int pages = 0;
+  for (int i = 0; i < end; i++) {
+    pages += pagesOf(i);
+  }
+  return pages;
+}
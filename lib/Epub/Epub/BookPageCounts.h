@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Epub;
+
+/**
+ * Page numbers across the whole book for one layout, without laying out every chapter first. The page counts of the
+ * spine items laid out so far are exact; the others are estimated from their size in the XHTML bytes per page of the
+ * laid out ones, so the estimate gets closer with every chapter the reader or the background indexer lays out.
+ *
+ * The counts are kept in pages.bin in the layout's directory (sections/<layout>/), written by Section whenever it has
+ * a complete section file:
+ * - uint8_t version
+ * - uint16_t spine item count
+ * - uint16_t page count per spine item, UNKNOWN while it has not been laid out
+ */
+class BookPageCounts {
+ public:
+  static constexpr uint16_t UNKNOWN = UINT16_MAX;
+
+  // Records the page count of a laid out spine item; writes the file only when the count is new
+  static void record(const std::string& layoutDir, int spineCount, int spineIndex, uint16_t pageCount);
+
+  // Reads the counts of the layout and calibrates the estimate; false if no spine item has been laid out yet, the
+  // estimate then has nothing to go on
+  bool load(const Epub& epub, const std::string& layoutDir);
+  bool isLoaded() const { return bytesPerPage > 0; }
+  // True when every count is exact
+  bool isExact() const { return exact; }
+
+  // Pages of the spine item, estimated while it has not been laid out
+  int pagesOf(int spineIndex) const;
+  // Pages of the spine items before it, i.e. the book-wide index of its first page
+  int pagesBefore(int spineIndex) const;
+  int totalPages() const { return pagesBefore(static_cast<int>(counts.size())); }
+
+ private:
+  std::vector<uint16_t> counts;
+  // Sizes of the spine items in the XHTML, for the estimate
+  std::vector<uint32_t> sizes;
+  float bytesPerPage = 0;
+  bool exact = false;
+};
@@ -0,0 +1,203 @@
+#include "Fb2Index.h"
+
+#include <BufferedFileWriter.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+
+namespace {
+constexpr char indexFile[] = "/fb2.idx";
+constexpr uint8_t INDEX_FILE_VERSION = 1;
+constexpr char SECTION_PREFIX[] = "section";
+constexpr char SECTION_SUFFIX[] = ".xml";
+constexpr size_t DECODE_CHUNK_SIZE = 2048;
+
+// 0..63 for the base64 alphabet, 64 for what is skipped: whitespace, and the '=' padding at the end
+uint8_t base64Value(const uint8_t c) {
+  if (c >= 'A' && c <= 'Z') return c - 'A';
+  if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+  if (c >= '0' && c <= '9') return c - '0' + 52;
+  if (c == '+') return 62;
+  if (c == '/') return 63;
+  return 64;
+}
+
+bool targetLess(const Fb2Index::LinkTarget& a, const Fb2Index::LinkTarget& b) {
+  return a.idHash < b.idHash || (a.idHash == b.idHash && a.idLength < b.idLength);
+}
+}  // namespace
+
+std::string Fb2Index::sectionHref(const size_t section) {
+  return SECTION_PREFIX + std::to_string(section) + SECTION_SUFFIX;
+}
+
+uint32_t Fb2Index::idHash(const char* id, const size_t length) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; i++) {
+    hash ^= static_cast<uint8_t>(id[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+int Fb2Index::sectionIndex(const std::string& href) const {
+  constexpr size_t prefixLength = sizeof(SECTION_PREFIX) - 1;
+  constexpr size_t suffixLength = sizeof(SECTION_SUFFIX) - 1;
+  if (href.size() <= prefixLength + suffixLength || href.compare(0, prefixLength, SECTION_PREFIX) != 0 ||
+      href.compare(href.size() - suffixLength, suffixLength, SECTION_SUFFIX) != 0) {
+    return -1;
+  }
+  char* end = nullptr;
+  const unsigned long section = strtoul(href.c_str() + prefixLength, &end, 10);
+  if (end != href.c_str() + href.size() - suffixLength || section >= sections.size()) {
+    return -1;
+  }
+  return static_cast<int>(section);
+}
+
+const Fb2Index::Image* Fb2Index::findImage(const std::string& href) const {
+  const auto it =
+      std::find_if(images.begin(), images.end(), [&href](const Image& image) { return image.href == href; });
+  return it == images.end() ? nullptr : &*it;
+}
+
+const Fb2Index::Image* Fb2Index::findImageById(const char* id) const {
+  const auto it = std::find_if(images.begin(), images.end(), [id](const Image& image) { return image.id == id; });
+  return it == images.end() ? nullptr : &*it;
+}
+
+std::string Fb2Index::linkTargetHref(const char* id) const {
+  const size_t length = strlen(id);
+  const LinkTarget key{idHash(id, length), static_cast<uint16_t>(length), 0};
+  const auto it = std::lower_bound(linkTargets.begin(), linkTargets.end(), key, targetLess);
+  if (it == linkTargets.end() || it->idHash != key.idHash || it->idLength != key.idLength) {
+    return {};
+  }
+  return sectionHref(it->section) + "#" + id;
+}
+
+bool Fb2Index::save(const std::string& cachePath) {
+  // Stable, so the first of equal keys is the first in the book
+  std::stable_sort(linkTargets.begin(), linkTargets.end(), targetLess);
+
+  FsFile file;
+  if (!Storage.openFileForWrite("FB2", cachePath + indexFile, file)) {
+    return false;
+  }
+  BufferedFileWriter writer(file, 1024);
+  serialization::writePod(writer, INDEX_FILE_VERSION);
+  serialization::writePod(writer, static_cast<uint16_t>(sections.size()));
+  for (const Range& section : sections) {
+    serialization::writePod(writer, section);
+  }
+  serialization::writePod(writer, static_cast<uint16_t>(images.size()));
+  for (const Image& image : images) {
+    serialization::writeString(writer, image.id);
+    serialization::writeString(writer, image.href);
+    serialization::writePod(writer, image.range);
+  }
+  serialization::writePod(writer, static_cast<uint16_t>(linkTargets.size()));
+  for (const LinkTarget& target : linkTargets) {
+    serialization::writePod(writer, target);
+  }
+  serialization::writeString(writer, encoding);
+  const bool written = writer.flush();
+  file.close();
+  if (!written) {
+    LOG_ERR("FB2", "Failed to write FB2 index");
+  }
+  return written;
+}
+
+bool Fb2Index::load(const std::string& cachePath) {
+  sections.clear();
+  images.clear();
+  linkTargets.clear();
+  encoding.clear();
+
+  FsFile file;
+  const std::string path = cachePath + indexFile;
+  if (!Storage.exists(path.c_str()) || !Storage.openFileForRead("FB2", path, file)) {
+    return false;
+  }
+  uint8_t version = 0;
+  serialization::readPod(file, version);
+  if (version != INDEX_FILE_VERSION) {
+    LOG_DBG("FB2", "Index version mismatch: expected %d, got %d", INDEX_FILE_VERSION, version);
+    return false;
+  }
+  uint16_t count = 0;
+  serialization::readPod(file, count);
+  sections.resize(count);
+  for (Range& section : sections) {
+    serialization::readPod(file, section);
+  }
+  count = 0;
+  serialization::readPod(file, count);
+  images.resize(count);
+  for (Image& image : images) {
+    serialization::readString(file, image.id);
+    serialization::readString(file, image.href);
+    serialization::readPod(file, image.range);
+  }
+  count = 0;
+  serialization::readPod(file, count);
+  linkTargets.resize(count);
+  for (LinkTarget& target : linkTargets) {
+    serialization::readPod(file, target);
+  }
+  serialization::readString(file, encoding);
+  // A file cut short leaves the reads past its end failing
+  if (file.position() != file.size()) {
+    LOG_ERR("FB2", "FB2 index is damaged");
+    sections.clear();
+    images.clear();
+    linkTargets.clear();
+    return false;
+  }
+  return true;
+}
+
+bool Fb2Index::decodeImage(FsFile& book, const Range& range, Print& out) {
+  if (!book.seek(range.offset)) {
+    return false;
+  }
+  // Decoded in place: three bytes out for every four in, so the output never overtakes the input
+  std::unique_ptr<uint8_t[]> buffer(new (std::nothrow) uint8_t[DECODE_CHUNK_SIZE]);
+  if (!buffer) {
+    LOG_ERR("FB2", "Couldn't allocate memory for image decoding");
+    return false;
+  }
+  uint32_t bits = 0;
+  int bitCount = 0;
+  uint32_t remaining = range.length;
+  while (remaining > 0) {
+    const int read = book.read(buffer.get(), std::min<uint32_t>(remaining, DECODE_CHUNK_SIZE));
+    if (read <= 0) {
+      return false;
+    }
+    remaining -= read;
+    size_t length = 0;
+    for (int i = 0; i < read; i++) {
+      const uint8_t value = base64Value(buffer[i]);
+      if (value == 64) {
+        continue;
+      }
+      bits = bits << 6 | value;
+      bitCount += 6;
+      if (bitCount >= 8) {
+        bitCount -= 8;
+        buffer[length++] = static_cast<uint8_t>(bits >> bitCount);
+      }
+    }
+    if (length > 0 && out.write(buffer.get(), length) != length) {
+      return false;
+    }
+  }
+  return true;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <HalStorage.h>
+#include <Print.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Where the parts of an FB2 book lie in its file. An FB2 book is one XML file: the sections of its bodies are its
+ * chapters, and its images follow them as base64 text in <binary> elements. Fb2Parser finds them in one pass when the
+ * book is first opened, so a section is then read in place like a chapter stored in an EPUB, and an image is decoded
+ * straight out of its <binary> when it is extracted.
+ *
+ * Sections are spine items named section<N>.xml, images are named by their id, with an extension for their content
+ * type if the id has none. Kept in fb2.idx in the book's cache:
+ * - uint8_t version
+ * - uint16_t count, then count sections of {uint32_t offset, uint32_t length}
+ * - uint16_t count, then count images of {string id, string href, uint32_t offset, uint32_t length}
+ * - uint16_t count, then count link targets of {uint32_t id hash, uint16_t id length, uint16_t section}, sorted
+ * - string encoding, empty for UTF-8
+ */
+class Fb2Index {
+ public:
+  struct Range {
+    uint32_t offset;
+    uint32_t length;
+  };
+
+  struct Image {
+    std::string id;
+    std::string href;
+    Range range;  // Of the base64 text
+  };
+
+  // A section with an id, for the links to it (notes, mostly); ids are not kept, of equal hashes the first is found
+  struct LinkTarget {
+    uint32_t idHash;
+    uint16_t idLength;
+    uint16_t section;
+  };
+
+  // A section is a run of sibling elements, and only the XML declaration of the file has its encoding
+  std::vector<Range> sections;
+  std::vector<Image> images;
+  std::vector<LinkTarget> linkTargets;
+  std::string encoding;
+
+  static std::string sectionHref(size_t section);
+  static uint32_t idHash(const char* id, size_t length);
+
+  // -1 if href names no section
+  int sectionIndex(const std::string& href) const;
+  const Image* findImage(const std::string& href) const;
+  const Image* findImageById(const char* id) const;
+  // "section<N>.xml#id" for the section holding the id, or empty
+  std::string linkTargetHref(const char* id) const;
+
+  bool save(const std::string& cachePath);
+  bool load(const std::string& cachePath);
+
+  // Writes the image the base64 text at range of book encodes to out, decoding it as it is read
+  static bool decodeImage(FsFile& book, const Range& range, Print& out);
+};
@@ -0,0 +1,187 @@
+#include "ImagePack.h"
+
+#include <Logging.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include <algorithm>
+
+namespace {
+constexpr char PACK_FILE[] = "/img_pack.bin";
+constexpr char INDEX_FILE[] = "/img_pack.idx";
+constexpr uint8_t INDEX_FILE_VERSION = 1;
+constexpr size_t RECORD_SIZE = sizeof(uint32_t) * 3;
+
+class PackLock {
+  static SemaphoreHandle_t mutex() {
+    static const SemaphoreHandle_t handle = xSemaphoreCreateMutex();
+    return handle;
+  }
+
+ public:
+  PackLock() { xSemaphoreTake(mutex(), portMAX_DELAY); }
+  ~PackLock() { xSemaphoreGive(mutex()); }
+  PackLock(const PackLock&) = delete;
+  PackLock& operator=(const PackLock&) = delete;
+};
+
+std::string dirOf(const std::string& imagePath) {
+  const size_t slash = imagePath.find_last_of('/');
+  return slash == std::string::npos ? std::string() : imagePath.substr(0, slash);
+}
+
+uint32_t hashName(const std::string& imagePath) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = imagePath.find_last_of('/') + 1; i < imagePath.size(); i++) {
+    hash ^= static_cast<uint8_t>(imagePath[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+}  // namespace
+
+std::string ImagePack::dir;
+std::vector<ImagePack::Entry> ImagePack::entries;
+uint32_t ImagePack::end = 0;
+
+void ImagePack::load(const std::string& imagePath) {
+  const std::string imageDir = dirOf(imagePath);
+  if (imageDir == dir && !dir.empty()) {
+    return;
+  }
+  dir = imageDir;
+  entries.clear();
+  end = 0;
+
+  FsFile index;
+  const std::string indexPath = dir + INDEX_FILE;
+  if (!Storage.exists(indexPath.c_str()) || !Storage.openFileForRead("IMP", indexPath, index)) {
+    return;
+  }
+  FsFile pack;
+  const size_t packSize = Storage.openFileForRead("IMP", dir + PACK_FILE, pack) ? pack.size() : 0;
+  pack.close();
+  uint8_t version = 0;
+  if (index.read(&version, 1) != 1 || version != INDEX_FILE_VERSION) {
+    return;
+  }
+  // A record cut short is ignored, as is one past the end of the pack
+  const size_t count = (index.size() - 1) / RECORD_SIZE;
+  entries.resize(count);
+  if (count > 0 && index.read(entries.data(), count * RECORD_SIZE) != static_cast<int>(count * RECORD_SIZE)) {
+    entries.clear();
+    return;
+  }
+  while (!entries.empty() && entries.back().offset + entries.back().length > packSize) {
+    entries.pop_back();
+  }
+  for (const Entry& entry : entries) {
+    end = std::max(end, entry.offset + entry.length);
+  }
+  LOG_DBG("IMP", "Loaded %u packed images of %s", static_cast<unsigned>(entries.size()), dir.c_str());
+}
+
+const ImagePack::Entry* ImagePack::find(const std::string& imagePath) {
+  load(imagePath);
+  const uint32_t nameHash = hashName(imagePath);
+  // The latest record of a name wins
+  const auto it = std::find_if(entries.rbegin(), entries.rend(),
+                               [nameHash](const Entry& entry) { return entry.nameHash == nameHash; });
+  return it == entries.rend() ? nullptr : &*it;
+}
+
+bool ImagePack::contains(const std::string& imagePath) {
+  PackLock lock;
+  return find(imagePath) != nullptr;
+}
+
+bool ImagePack::append(const std::string& imagePath, const std::function<bool(Print&)>& writeFn) {
+  PackLock lock;
+  load(imagePath);
+
+  FsFile pack = Storage.open((dir + PACK_FILE).c_str(), O_RDWR | O_CREAT);
+  if (!pack || !pack.seek(end)) {
+    LOG_ERR("IMP", "Failed to open image pack of %s", dir.c_str());
+    return false;
+  }
+  const bool written = writeFn(pack);
+  const uint32_t dataEnd = pack.position();
+  if (!written || dataEnd == end) {
+    // Cut off again, so the data isn't left past the end for nothing
+    pack.seek(end);
+    pack.truncate();
+    return false;
+  }
+  pack.close();
+
+  const std::string indexPath = dir + INDEX_FILE;
+  FsFile index = Storage.open(indexPath.c_str(), O_RDWR | O_CREAT);
+  // After the records held, over a record cut short by a power loss if there is one
+  const size_t recordsEnd = 1 + entries.size() * RECORD_SIZE;
+  const Entry entry{hashName(imagePath), end, dataEnd - end};
+  bool indexed = index && (index.size() > 0 || index.write(INDEX_FILE_VERSION) == 1) && index.seek(recordsEnd) &&
+                 index.write(&entry, RECORD_SIZE) == RECORD_SIZE;
+  if (indexed && index.size() > recordsEnd + RECORD_SIZE) {
+    indexed = index.truncate();
+  }
+  index.close();
+  if (!indexed) {
+    LOG_ERR("IMP", "Failed to index packed image %s", imagePath.c_str());
+    return false;
+  }
+  entries.push_back(entry);
+  end = dataEnd;
+  return true;
+}
+
+void ImagePack::forget() {
+  PackLock lock;
+  dir.clear();
+  entries.clear();
+  end = 0;
+}
+
+bool ImagePack::Reader::open(const std::string& imagePath) {
+  file.close();
+  pos = 0;
+  Entry entry{};
+  bool packed = false;
+  {
+    PackLock lock;
+    if (const Entry* found = find(imagePath)) {
+      entry = *found;
+      packed = true;
+    }
+  }
+  if (packed) {
+    if (!Storage.openFileForRead("IMP", dirOf(imagePath) + PACK_FILE, file) || !file.seek(entry.offset)) {
+      file.close();
+      return false;
+    }
+    base = entry.offset;
+    length = entry.length;
+    return true;
+  }
+  if (!Storage.openFileForRead("IMP", imagePath, file)) {
+    return false;
+  }
+  base = 0;
+  length = file.size();
+  return true;
+}
+
+int ImagePack::Reader::read(void* buf, const size_t count) {
+  const int bytesRead = file.read(buf, std::min(count, length - pos));
+  if (bytesRead > 0) {
+    pos += bytesRead;
+  }
+  return bytesRead;
+}
+
+bool ImagePack::Reader::seek(const size_t position) {
+  if (position > length || !file.seek(base + position)) {
+    return false;
+  }
+  pos = position;
+  return true;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <HalStorage.h>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * The images extracted from a book, appended one after another to img_pack.bin in the book's cache, so an illustrated
+ * book keeps two files there rather than one per image. FAT finds a file by walking its directory, which gets slow
+ * with thousands of entries, and so does deleting them.
+ *
+ * Images keep the path they would have as files of their own (img_<spine>_<n>.<ext>) and are found by its name.
+ * img_pack.idx lists them: a version byte, then {uint32_t name hash, uint32_t offset, uint32_t length} per image, in
+ * the order they were appended. An image's data is written before its index record, so an append cut short by a power
+ * loss leaves data no record points to, which the next append writes over. The records of the book being read are
+ * held in memory, 12 bytes per image.
+ *
+ * Paths without a pack entry are opened as files of their own, like the pages extracted from a CBZ. Layout on the
+ * indexer worker and page loads on the render task both append, under a mutex.
+ */
+class ImagePack {
+ public:
+  // An image as the decoders read it: its entry in the pack, or the file at its path
+  class Reader {
+    FsFile file;
+    size_t base = 0;
+    size_t length = 0;
+    size_t pos = 0;
+
+   public:
+    bool open(const std::string& imagePath);
+    size_t size() const { return length; }
+    // Reads stop at the end of the image
+    int read(void* buf, size_t count);
+    bool seek(size_t position);
+    void close() { file.close(); }
+  };
+
+  static bool contains(const std::string& imagePath);
+  // Appends the image written by writeFn under imagePath's name. Fails if writeFn does or writes nothing.
+  static bool append(const std::string& imagePath, const std::function<bool(Print&)>& writeFn);
+  // Drops the records held in memory, after a book cache was deleted or trimmed
+  static void forget();
+
+ private:
+  struct Entry {
+    uint32_t nameHash;
+    uint32_t offset;
+    uint32_t length;
+  };
+
+  static std::string dir;
+  static std::vector<Entry> entries;
+  static uint32_t end;
+
+  // With the lock held: loads the records of the pack in imagePath's directory unless they are the ones held
+  static void load(const std::string& imagePath);
+  static const Entry* find(const std::string& imagePath);
+};
@@ -0,0 +1,234 @@
+#include "LinkTargetIndex.h"
+
+#include <Arduino.h>
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Print.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "../Epub.h"
+
+namespace {
+constexpr uint8_t LINK_INDEX_VERSION = 1;
+constexpr uint32_t ENTRY_SIZE = sizeof(uint32_t) + sizeof(uint16_t) + sizeof(uint32_t);
+
+constexpr uint32_t FNV_OFFSET = 2166136261u;
+constexpr uint32_t FNV_PRIME = 16777619u;
+
+struct Entry {
+  uint32_t hash;
+  uint16_t length;
+  uint32_t offset;
+};
+
+bool entryBefore(const Entry& a, const Entry& b) {
+  return a.hash < b.hash || (a.hash == b.hash && a.length < b.length);
+}
+
+// Picks the id attributes out of markup streamed into it, without parsing it as XML. Comments and other <! and <?
+// constructs are skipped up to their '>'.
+class IdScanner final : public Print {
+  enum State : uint8_t { TEXT, TAG_NAME, TAG, ATTRIBUTE_NAME, AFTER_NAME, BEFORE_VALUE, VALUE, DECLARATION };
+
+  State state = TEXT;
+  uint32_t position = 0;
+  uint32_t tagStart = 0;
+  // Up to 3 characters of the attribute name, enough to tell "id" from the rest
+  char name[3] = {};
+  uint8_t nameLength = 0;
+  bool isId = false;
+  char quote = 0;
+  uint32_t hash = FNV_OFFSET;
+  uint32_t valueLength = 0;
+
+  void scan(const char c) {
+    const bool space = c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    switch (state) {
+      case TEXT:
+        if (c == '<') {
+          state = TAG_NAME;
+          tagStart = position;
+        }
+        break;
+      case TAG_NAME:
+        if (c == '!' || c == '?') {
+          state = DECLARATION;
+        } else if (c == '>') {
+          state = TEXT;
+        } else if (space) {
+          state = TAG;
+        }
+        break;
+      case TAG:
+        if (c == '>') {
+          state = TEXT;
+        } else if (!space && c != '/') {
+          state = ATTRIBUTE_NAME;
+          name[0] = c;
+          nameLength = 1;
+        }
+        break;
+      case ATTRIBUTE_NAME:
+        if (c == '=' || space) {
+          isId = nameLength == 2 && name[0] == 'i' && name[1] == 'd';
+          state = c == '=' ? BEFORE_VALUE : AFTER_NAME;
+        } else if (c == '>') {
+          state = TEXT;
+        } else if (nameLength < sizeof(name)) {
+          name[nameLength++] = c;
+        }
+        break;
+      case AFTER_NAME:
+        if (c == '=') {
+          state = BEFORE_VALUE;
+        } else if (c == '>') {
+          state = TEXT;
+        } else if (!space) {
+          // Attribute without a value, this is the next one
+          state = TAG;
+          scan(c);
+        }
+        break;
+      case BEFORE_VALUE:
+        if (c == '"' || c == '\'') {
+          state = VALUE;
+          quote = c;
+          hash = FNV_OFFSET;
+          valueLength = 0;
+        } else if (c == '>') {
+          state = TEXT;
+        } else if (!space) {
+          // Unquoted values are not XHTML, skip to the next attribute
+          state = TAG;
+        }
+        break;
+      case VALUE:
+        if (c == quote) {
+          if (isId && valueLength > 0 && valueLength <= UINT16_MAX && entries.size() < UINT16_MAX) {
+            entries.push_back({hash, static_cast<uint16_t>(valueLength), tagStart});
+          }
+          state = TAG;
+        } else if (isId) {
+          hash ^= static_cast<uint8_t>(c);
+          hash *= FNV_PRIME;
+          valueLength++;
+        }
+        break;
+      case DECLARATION:
+        if (c == '>') {
+          state = TEXT;
+        }
+        break;
+    }
+  }
+
+ public:
+  std::vector<Entry> entries;
+
+  size_t write(const uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* buffer, const size_t size) override {
+    for (size_t i = 0; i < size; i++) {
+      scan(static_cast<char>(buffer[i]));
+      position++;
+    }
+    return size;
+  }
+};
+
+uint32_t hashId(const std::string& id) {
+  uint32_t hash = FNV_OFFSET;
+  for (const char c : id) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= FNV_PRIME;
+  }
+  return hash;
+}
+}  // namespace
+
+bool LinkTargetIndex::build(const Epub& epub, const int spineIndex, const std::string& path) {
+  const auto start = millis();
+  IdScanner scanner;
+  if (!epub.readItemContentsToStream(epub.getSpineItem(spineIndex).href, scanner, 1024)) {
+    LOG_ERR("LTI", "Failed to read spine item %d", spineIndex);
+    return false;
+  }
+  // Stable, so of ids that can't be told apart the first in the chapter comes first
+  std::stable_sort(scanner.entries.begin(), scanner.entries.end(), entryBefore);
+
+  FsFile file;
+  if (!Storage.openFileForWrite("LTI", path, file)) {
+    return false;
+  }
+  serialization::writePod(file, LINK_INDEX_VERSION);
+  serialization::writePod(file, static_cast<uint16_t>(scanner.entries.size()));
+  for (const auto& entry : scanner.entries) {
+    serialization::writePod(file, entry.hash);
+    serialization::writePod(file, entry.length);
+    serialization::writePod(file, entry.offset);
+  }
+  LOG_DBG("LTI", "Indexed %zu ids of spine item %d in %lu ms", scanner.entries.size(), spineIndex, millis() - start);
+  return true;
+}
+
+std::optional<uint32_t> LinkTargetIndex::findOffset(const std::shared_ptr<Epub>& epub, const int spineIndex,
+                                                    const std::string& id) {
+  if (!epub || id.empty() || id.size() > UINT16_MAX || spineIndex < 0 || spineIndex >= epub->getSpineItemsCount()) {
+    return std::nullopt;
+  }
+
+  const auto dir = epub->getCachePath() + "/links";
+  const auto path = dir + "/" + std::to_string(spineIndex) + ".bin";
+  FsFile file;
+  uint8_t version = 0;
+  uint16_t count = 0;
+  for (int attempt = 0; attempt < 2; attempt++) {
+    if (Storage.openFileForRead("LTI", path, file)) {
+      serialization::readPod(file, version);
+      serialization::readPod(file, count);
+      if (version == LINK_INDEX_VERSION && file.size() == sizeof(version) + sizeof(count) + ENTRY_SIZE * count) {
+        break;
+      }
+      file.close();
+    }
+    if (attempt > 0) {
+      return std::nullopt;
+    }
+    Storage.mkdir(dir.c_str());
+    if (!build(*epub, spineIndex, path)) {
+      Storage.remove(path.c_str());
+      return std::nullopt;
+    }
+  }
+
+  // First entry not before the id's, then the one matching it if any
+  const Entry target = {hashId(id), static_cast<uint16_t>(id.size()), 0};
+  const uint32_t entriesOffset = sizeof(version) + sizeof(count);
+  Entry entry = {};
+  uint16_t low = 0;
+  uint16_t high = count;
+  while (low < high) {
+    const uint16_t mid = low + (high - low) / 2;
+    file.seek(entriesOffset + ENTRY_SIZE * mid);
+    serialization::readPod(file, entry.hash);
+    serialization::readPod(file, entry.length);
+    if (entryBefore(entry, target)) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  if (low == count) {
+    return std::nullopt;
+  }
+  file.seek(entriesOffset + ENTRY_SIZE * low);
+  serialization::readPod(file, entry.hash);
+  serialization::readPod(file, entry.length);
+  serialization::readPod(file, entry.offset);
+  if (entry.hash != target.hash || entry.length != target.length) {
+    return std::nullopt;
+  }
+  return entry.offset;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+class Epub;
+
+/**
+ * Byte offsets of the id attributes in a spine item's XHTML, for going to a link target (e.g. a note in an endnotes
+ * file) in a chapter that has not been laid out yet: the reader then only lays out the chapter up to that offset.
+ * The index is built by scanning the raw markup for id attributes, which takes a fraction of the time laying the
+ * chapter out does, and is cached in links/N.bin in the book's cache directory.
+ *
+ * File format:
+ * - uint8_t version
+ * - uint16_t count
+ * - count entries of uint32_t FNV-1a hash of the id, uint16_t id length and uint32_t offset of the '<' of the tag
+ *   carrying it, sorted by hash and length
+ * Ids are not stored; of ids with the same hash and length, the first in the chapter is found.
+ */
+class LinkTargetIndex {
+ public:
+  // Offset of the start tag with the given id in the spine item, indexing the item first if it isn't yet
+  static std::optional<uint32_t> findOffset(const std::shared_ptr<Epub>& epub, int spineIndex, const std::string& id);
+
+ private:
+  static bool build(const Epub& epub, int spineIndex, const std::string& path);
+};
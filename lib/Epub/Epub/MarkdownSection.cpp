@@ -0,0 +1,216 @@
+#include "MarkdownSection.h"
+
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <vector>
+
+#include "Page.h"
+#include "hyphenation/Hyphenator.h"
+#include "parsers/MarkdownParser.h"
+
+namespace {
+constexpr uint8_t SECTION_FILE_VERSION = 2;
+constexpr uint32_t HEADER_SIZE = sizeof(uint8_t) + sizeof(uint32_t) + sizeof(int) + sizeof(float) + sizeof(bool) +
+                                 sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(bool) +
+                                 sizeof(uint16_t) + sizeof(uint32_t);
+}  // namespace
+
+uint32_t MarkdownSection::onPageComplete(BufferedFileWriter& writer, PageRecordScratch* scratch,
+                                         std::unique_ptr<Page> page, const int fontId) {
+  if (!file) {
+    LOG_ERR("MDS", "File not open for writing page %d", pageCount);
+    return 0;
+  }
+
+  const uint32_t position = writer.position();
+  if (!page->serializeRecord(writer, scratch, &renderer, fontId)) {
+    LOG_ERR("MDS", "Failed to serialize page %d", pageCount);
+    return 0;
+  }
+
+  pageCount++;
+  return position;
+}
+
+void MarkdownSection::writeSectionFileHeader(BufferedFileWriter& writer, const uint32_t sourceSize, const int fontId,
+                                             const float lineCompression, const bool extraParagraphSpacing,
+                                             const uint8_t paragraphAlignment, const uint16_t viewportWidth,
+                                             const uint16_t viewportHeight, const bool hyphenationEnabled) {
+  static_assert(HEADER_SIZE == sizeof(SECTION_FILE_VERSION) + sizeof(sourceSize) + sizeof(fontId) +
+                                   sizeof(lineCompression) + sizeof(extraParagraphSpacing) +
+                                   sizeof(paragraphAlignment) + sizeof(viewportWidth) + sizeof(viewportHeight) +
+                                   sizeof(hyphenationEnabled) + sizeof(pageCount) + sizeof(uint32_t),
+                "Header size mismatch");
+  serialization::writePod(writer, SECTION_FILE_VERSION);
+  serialization::writePod(writer, sourceSize);
+  serialization::writePod(writer, fontId);
+  serialization::writePod(writer, lineCompression);
+  serialization::writePod(writer, extraParagraphSpacing);
+  serialization::writePod(writer, paragraphAlignment);
+  serialization::writePod(writer, viewportWidth);
+  serialization::writePod(writer, viewportHeight);
+  serialization::writePod(writer, hyphenationEnabled);
+  serialization::writePod(writer, pageCount);                 // Placeholder for page count (patched later)
+  serialization::writePod(writer, static_cast<uint32_t>(0));  // Placeholder for LUT offset (patched later)
+}
+
+bool MarkdownSection::loadSectionFile(const uint32_t sourceSize, const int fontId, const float lineCompression,
+                                      const bool extraParagraphSpacing, const uint8_t paragraphAlignment,
+                                      const uint16_t viewportWidth, const uint16_t viewportHeight,
+                                      const bool hyphenationEnabled) {
+  pageCount = 0;
+  if (!Storage.openFileForRead("MDS", filePath, file)) {
+    return false;
+  }
+
+  uint8_t version;
+  uint32_t fileSourceSize;
+  int fileFontId;
+  float fileLineCompression;
+  bool fileExtraParagraphSpacing;
+  uint8_t fileParagraphAlignment;
+  uint16_t fileViewportWidth, fileViewportHeight;
+  bool fileHyphenationEnabled;
+  serialization::readPod(file, version);
+  serialization::readPod(file, fileSourceSize);
+  serialization::readPod(file, fileFontId);
+  serialization::readPod(file, fileLineCompression);
+  serialization::readPod(file, fileExtraParagraphSpacing);
+  serialization::readPod(file, fileParagraphAlignment);
+  serialization::readPod(file, fileViewportWidth);
+  serialization::readPod(file, fileViewportHeight);
+  serialization::readPod(file, fileHyphenationEnabled);
+
+  if (version != SECTION_FILE_VERSION || sourceSize != fileSourceSize || fontId != fileFontId ||
+      lineCompression != fileLineCompression || extraParagraphSpacing != fileExtraParagraphSpacing ||
+      paragraphAlignment != fileParagraphAlignment || viewportWidth != fileViewportWidth ||
+      viewportHeight != fileViewportHeight || hyphenationEnabled != fileHyphenationEnabled) {
+    // Explicit close() required: member variable persists beyond function scope
+    file.close();
+    LOG_DBG("MDS", "Section file out of date, rebuilding");
+    clearCache();
+    return false;
+  }
+
+  uint16_t filePageCount;
+  uint32_t lutOffset;
+  serialization::readPod(file, filePageCount);
+  serialization::readPod(file, lutOffset);
+  // Explicit close() required: member variable persists beyond function scope
+  file.close();
+  if (lutOffset == 0) {
+    LOG_DBG("MDS", "Section file incomplete, rebuilding");
+    return false;
+  }
+  pageCount = filePageCount;
+  LOG_DBG("MDS", "Loaded section file: %d pages", pageCount);
+  return true;
+}
+
+bool MarkdownSection::clearCache() const {
+  if (!Storage.exists(filePath.c_str())) {
+    return true;
+  }
+  if (!Storage.remove(filePath.c_str())) {
+    LOG_ERR("MDS", "Failed to clear cache");
+    return false;
+  }
+  return true;
+}
+
+bool MarkdownSection::createSectionFile(const uint32_t sourceSize, const int fontId, const float lineCompression,
+                                        const bool extraParagraphSpacing, const uint8_t paragraphAlignment,
+                                        const uint16_t viewportWidth, const uint16_t viewportHeight,
+                                        const bool hyphenationEnabled, const std::function<void()>& popupFn) {
+  pageCount = 0;
+  if (!Storage.openFileForWrite("MDS", filePath, file)) {
+    return false;
+  }
+  // Flushed before the header is patched
+  BufferedFileWriter writer(file, 4096);
+  writeSectionFileHeader(writer, sourceSize, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment,
+                         viewportWidth, viewportHeight, hyphenationEnabled);
+
+  std::vector<uint32_t> lut = {};
+  std::unique_ptr<PageRecordScratch> recordScratch;
+  if (SECTION_RECORD_COMPRESSION) {
+    recordScratch.reset(new PageRecordScratch());
+  }
+  MarkdownParser parser(sourcePath, renderer, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment,
+                        viewportWidth, viewportHeight, hyphenationEnabled,
+                        [this, &lut, &writer, &recordScratch, fontId](std::unique_ptr<Page> page) {
+                          lut.emplace_back(this->onPageComplete(writer, recordScratch.get(), std::move(page), fontId));
+                        },
+                        popupFn);
+  // Markdown doesn't declare its language; only explicit hyphens are break points
+  Hyphenator::setPreferredLanguage("");
+  if (!parser.parseAndBuildPages()) {
+    LOG_ERR("MDS", "Failed to parse Markdown and build pages");
+    // Explicitly close() file before calling Storage.remove()
+    file.close();
+    Storage.remove(filePath.c_str());
+    pageCount = 0;
+    return false;
+  }
+
+  const uint32_t lutOffset = writer.position();
+  for (const uint32_t pos : lut) {
+    if (pos == 0) {
+      LOG_ERR("MDS", "Failed to write LUT due to invalid page positions");
+      // Explicitly close() file before calling Storage.remove()
+      file.close();
+      Storage.remove(filePath.c_str());
+      pageCount = 0;
+      return false;
+    }
+    serialization::writePod(writer, pos);
+  }
+  if (!writer.flush()) {
+    LOG_ERR("MDS", "Failed to write section file");
+    // Explicitly close() file before calling Storage.remove()
+    file.close();
+    Storage.remove(filePath.c_str());
+    pageCount = 0;
+    return false;
+  }
+
+  // Patch header with final pageCount and lutOffset
+  file.seek(HEADER_SIZE - sizeof(uint32_t) - sizeof(pageCount));
+  serialization::writePod(file, pageCount);
+  serialization::writePod(file, lutOffset);
+  // Explicit close() required: member variable persists beyond function scope
+  file.close();
+  LOG_DBG("MDS", "Built section file: %d pages", pageCount);
+  return true;
+}
+
+std::unique_ptr<Page> MarkdownSection::loadPageFromSectionFile() {
+  if (currentPage < 0 || currentPage >= pageCount || !Storage.openFileForRead("MDS", filePath, file)) {
+    return nullptr;
+  }
+
+  // A page record ends where the next one starts, or at the LUT after the last page
+  file.seek(HEADER_SIZE - sizeof(uint32_t));
+  uint32_t lutOffset;
+  serialization::readPod(file, lutOffset);
+  file.seek(lutOffset + sizeof(uint32_t) * currentPage);
+  uint32_t pagePos;
+  uint32_t pageEnd = lutOffset;
+  serialization::readPod(file, pagePos);
+  if (currentPage + 1 < pageCount) {
+    serialization::readPod(file, pageEnd);
+  }
+  if (pageEnd <= pagePos) {
+    LOG_ERR("MDS", "Invalid record bounds for page %d", currentPage);
+    file.close();
+    return nullptr;
+  }
+  file.seek(pagePos);
+
+  auto page = Page::deserialize(file, pageEnd - pagePos);
+  // Explicit close() required: member variable persists beyond function scope
+  file.close();
+  return page;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <HalStorage.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+
+class BufferedFileWriter;
+class Page;
+struct PageRecordScratch;
+class GfxRenderer;
+
+// Pages of a Markdown document, laid out by MarkdownParser into a section file of the same layout as an EPUB
+// chapter's (see Section): a header with the layout parameters, the serialized pages, then a LUT of page offsets.
+class MarkdownSection {
+  std::string sourcePath;
+  std::string filePath;
+  GfxRenderer& renderer;
+  FsFile file;
+
+  void writeSectionFileHeader(BufferedFileWriter& writer, uint32_t sourceSize, int fontId, float lineCompression,
+                              bool extraParagraphSpacing, uint8_t paragraphAlignment, uint16_t viewportWidth,
+                              uint16_t viewportHeight, bool hyphenationEnabled);
+  uint32_t onPageComplete(BufferedFileWriter& writer, PageRecordScratch* scratch, std::unique_ptr<Page> page,
+                          int fontId);
+
+ public:
+  uint16_t pageCount = 0;
+  int currentPage = 0;
+
+  explicit MarkdownSection(std::string sourcePath, const std::string& cachePath, GfxRenderer& renderer)
+      : sourcePath(std::move(sourcePath)), filePath(cachePath + "/section.bin"), renderer(renderer) {}
+  ~MarkdownSection() = default;
+  bool loadSectionFile(uint32_t sourceSize, int fontId, float lineCompression, bool extraParagraphSpacing,
+                       uint8_t paragraphAlignment, uint16_t viewportWidth, uint16_t viewportHeight,
+                       bool hyphenationEnabled);
+  bool clearCache() const;
+  bool createSectionFile(uint32_t sourceSize, int fontId, float lineCompression, bool extraParagraphSpacing,
+                         uint8_t paragraphAlignment, uint16_t viewportWidth, uint16_t viewportHeight,
+                         bool hyphenationEnabled, const std::function<void()>& popupFn = nullptr);
+  std::unique_ptr<Page> loadPageFromSectionFile();
+};
@@ -1,79 +1,228 @@
 #include "Page.h"
 
+#include <FontCacheManager.h>
+#include <GfxRenderer.h>
 #include <Logging.h>
 #include <Serialization.h>
 
+#include "converters/ImageDecoderFactory.h"
+
+namespace {
+// Codec byte at the start of a page record in a section file
+constexpr uint8_t RECORD_STORED = 0;
+// Followed by the uint16_t size of the page data, then the data LZ compressed
+constexpr uint8_t RECORD_LZ = 1;
+}  // namespace
+
 void PageLine::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) {
   block->render(renderer, fontId, xPos + xOffset, yPos + yOffset);
 }
 
-bool PageLine::serialize(FsFile& file) {
-  serialization::writePod(file, xPos);
-  serialization::writePod(file, yPos);
+bool PageLine::serialize(BufferedFileWriter& writer) { return serialize(writer, nullptr, 0); }
+
+bool PageLine::serialize(BufferedFileWriter& writer, const GfxRenderer* renderer, const int fontId) {
+  serialization::writePod(writer, xPos);
+  serialization::writePod(writer, yPos);
 
   // serialize TextBlock pointed to by PageLine
-  return block->serialize(file);
+  return block->serialize(writer, renderer, fontId);
 }
 
-std::unique_ptr<PageLine> PageLine::deserialize(FsFile& file) {
+std::unique_ptr<PageLine> PageLine::deserialize(BufferedFileReader& reader) {
   int16_t xPos;
   int16_t yPos;
-  serialization::readPod(file, xPos);
-  serialization::readPod(file, yPos);
+  serialization::readPod(reader, xPos);
+  serialization::readPod(reader, yPos);
 
-  auto tb = TextBlock::deserialize(file);
+  auto tb = TextBlock::deserialize(reader);
   return std::unique_ptr<PageLine>(new PageLine(std::move(tb), xPos, yPos));
 }
 
+void PageTextLine::render(const GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset,
+                          const int style) const {
+  const int x = xPos + xOffset;
+  const int y = yPos + yOffset;
+  const uint8_t* wordGlyphs = glyphs;
+  forEachWord([&](const char* word, const uint16_t i, const int16_t wordX, const EpdFontFamily::Style wordStyle) {
+    uint16_t glyphCount = 0;
+    if (runLengths) {
+      memcpy(&glyphCount, runLengths + i * sizeof(uint16_t), sizeof(glyphCount));
+    }
+    if (style == ALL_STYLES || wordStyle % STYLE_COUNT == style) {
+      TextBlock::renderWord(renderer, fontId, wordX + x, y, word, wordStyle, wordGlyphs, glyphCount);
+    }
+    wordGlyphs += glyphCount * sizeof(PlacedGlyph);
+  });
+}
+
+namespace {
+// Draws the lines include(line) accepts, style by style (see PAGE_STYLE_BATCHED_RENDER)
+template <typename Include>
+void renderLines(const std::vector<PageTextLine>& lines, const GfxRenderer& renderer, const int fontId,
+                 const int xOffset, const int yOffset, Include&& include) {
+#if PAGE_STYLE_BATCHED_RENDER
+  uint8_t styles = 0;
+  for (const auto& line : lines) {
+    if (include(line)) {
+      styles |= line.styleMask();
+    }
+  }
+  // A single style needs no filtering
+  const bool batched = (styles & (styles - 1)) != 0;
+  for (int style = 0; style < PageTextLine::STYLE_COUNT; style++) {
+    if ((styles & (1 << style)) == 0) {
+      continue;
+    }
+    for (const auto& line : lines) {
+      if (include(line)) {
+        line.render(renderer, fontId, xOffset, yOffset, batched ? style : PageTextLine::ALL_STYLES);
+      }
+    }
+    if (!batched) {
+      break;
+    }
+  }
+#else
+  for (const auto& line : lines) {
+    if (include(line)) {
+      line.render(renderer, fontId, xOffset, yOffset);
+    }
+  }
+#endif
+}
+}  // namespace
+
+void PageTextLine::recordGlyphs(FontCacheManager& fontCache, const int fontId) const {
+  const uint8_t* wordGlyphs = glyphs;
+  forEachWord([&](const char* word, const uint16_t i, int16_t, const EpdFontFamily::Style style) {
+    uint16_t glyphCount = 0;
+    if (runLengths) {
+      memcpy(&glyphCount, runLengths + i * sizeof(uint16_t), sizeof(glyphCount));
+    }
+    if (glyphCount > 0) {
+      fontCache.recordGlyphs(wordGlyphs, glyphCount, fontId, style);
+    } else {
+      fontCache.recordText(word, fontId, style);
+    }
+    wordGlyphs += glyphCount * sizeof(PlacedGlyph);
+  });
+}
+
 void PageImage::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) {
   // Images don't use fontId or text rendering
   imageBlock->render(renderer, xPos + xOffset, yPos + yOffset);
 }
 
-bool PageImage::serialize(FsFile& file) {
-  serialization::writePod(file, xPos);
-  serialization::writePod(file, yPos);
+bool PageImage::serialize(BufferedFileWriter& writer) {
+  serialization::writePod(writer, xPos);
+  serialization::writePod(writer, yPos);
 
   // serialize ImageBlock
-  return imageBlock->serialize(file);
+  return imageBlock->serialize(writer);
 }
 
-std::unique_ptr<PageImage> PageImage::deserialize(FsFile& file) {
+std::unique_ptr<PageImage> PageImage::deserialize(BufferedFileReader& reader) {
   int16_t xPos;
   int16_t yPos;
-  serialization::readPod(file, xPos);
-  serialization::readPod(file, yPos);
+  serialization::readPod(reader, xPos);
+  serialization::readPod(reader, yPos);
 
-  auto ib = ImageBlock::deserialize(file);
+  auto ib = ImageBlock::deserialize(reader);
   return std::unique_ptr<PageImage>(new PageImage(std::move(ib), xPos, yPos));
 }
 
 void Page::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) const {
+  bool drewImages = false;
   for (auto& element : elements) {
     element->render(renderer, fontId, xOffset, yOffset);
+    drewImages |= element->getTag() == TAG_PageImage;
+  }
+  renderLines(lines, renderer, fontId, xOffset, yOffset, [](const PageTextLine&) { return true; });
+  if (drewImages) {
+    ImageDecoderFactory::releaseScratch();  // The page's images shared the decoders
+  }
+}
+
+void Page::renderText(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) const {
+  for (auto& element : elements) {
+    if (element->getTag() != TAG_PageImage) {
+      element->render(renderer, fontId, xOffset, yOffset);
+    }
+  }
+  renderLines(lines, renderer, fontId, xOffset, yOffset, [](const PageTextLine&) { return true; });
+}
+
+void Page::renderImages(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) const {
+  bool drewImages = false;
+  for (auto& element : elements) {
+    if (element->getTag() == TAG_PageImage) {
+      element->render(renderer, fontId, xOffset, yOffset);
+      drewImages = true;
+    }
+  }
+  if (drewImages) {
+    ImageDecoderFactory::releaseScratch();  // The page's images shared the decoders
   }
 }
 
-bool Page::serialize(FsFile& file) const {
+void Page::recordGlyphs(FontCacheManager& fontCache, const int fontId) const {
+  for (const auto& element : elements) {
+    if (element->getTag() == TAG_PageLine) {
+      static_cast<const PageLine&>(*element).getBlock()->recordGlyphs(fontCache, fontId);
+    }
+  }
+  for (const auto& line : lines) {
+    line.recordGlyphs(fontCache, fontId);
+  }
+}
+
+void Page::renderBand(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset,
+                      const int bandTop, const int bandBottom) const {
+  // A line is drawn below its y position; a line height either side leaves room for tall glyphs and raised marks
+  const int lineHeight = renderer.getLineHeight(fontId);
+  const auto reaches = [&](const int top, const int bottom) {
+    return top + yOffset - lineHeight < bandBottom && bottom + yOffset + lineHeight > bandTop;
+  };
+  for (auto& element : elements) {
+    const int height = element->getTag() == TAG_PageImage
+                           ? static_cast<const PageImage&>(*element).getImageBlock().getHeight()
+                           : lineHeight;
+    if (reaches(element->yPos, element->yPos + height)) {
+      element->render(renderer, fontId, xOffset, yOffset);
+    }
+  }
+  renderLines(lines, renderer, fontId, xOffset, yOffset,
+              [&](const PageTextLine& line) { return reaches(line.yPos, line.yPos + lineHeight); });
+}
+
+bool Page::serialize(BufferedFileWriter& writer, const GfxRenderer* renderer, const int fontId) const {
+  if (!lines.empty()) {
+    LOG_ERR("PGE", "Can't serialize a page loaded into an arena");
+    return false;
+  }
+
   const uint16_t count = elements.size();
-  serialization::writePod(file, count);
+  serialization::writePod(writer, count);
 
   for (const auto& el : elements) {
     // Use getTag() method to determine type
-    serialization::writePod(file, static_cast<uint8_t>(el->getTag()));
+    serialization::writePod(writer, static_cast<uint8_t>(el->getTag()));
 
-    if (!el->serialize(file)) {
+    const bool written = el->getTag() == TAG_PageLine
+                             ? static_cast<PageLine&>(*el).serialize(writer, renderer, fontId)
+                             : el->serialize(writer);
+    if (!written) {
       return false;
     }
   }
 
   // Serialize footnotes (clamp to MAX_FOOTNOTES_PER_PAGE to match addFootnote/deserialize limits)
   const uint16_t fnCount = std::min<uint16_t>(footnotes.size(), MAX_FOOTNOTES_PER_PAGE);
-  serialization::writePod(file, fnCount);
+  serialization::writePod(writer, fnCount);
   for (uint16_t i = 0; i < fnCount; i++) {
     const auto& fn = footnotes[i];
-    if (file.write(fn.number, sizeof(fn.number)) != sizeof(fn.number) ||
-        file.write(fn.href, sizeof(fn.href)) != sizeof(fn.href)) {
+    if (writer.write(fn.number, sizeof(fn.number)) != sizeof(fn.number) ||
+        writer.write(fn.href, sizeof(fn.href)) != sizeof(fn.href)) {
       LOG_ERR("PGE", "Failed to write footnote");
       return false;
     }
@@ -82,21 +231,42 @@ bool Page::serialize(FsFile& file) const {
   return true;
 }
 
-std::unique_ptr<Page> Page::deserialize(FsFile& file) {
+bool Page::serializeRecord(BufferedFileWriter& writer, PageRecordScratch* scratch, const GfxRenderer* renderer,
+                           const int fontId) const {
+  if (!scratch) {
+    serialization::writePod(writer, RECORD_STORED);
+    return serialize(writer, renderer, fontId);
+  }
+
+  scratch->page.clear();
+  if (!serialize(scratch->page, renderer, fontId) || !scratch->page.flush()) {
+    return false;
+  }
+  const size_t size = scratch->page.position();
+  if (size > UINT16_MAX) {
+    serialization::writePod(writer, RECORD_STORED);
+    return writer.write(scratch->page.data(), size) == size;
+  }
+  serialization::writePod(writer, RECORD_LZ);
+  serialization::writePod(writer, static_cast<uint16_t>(size));
+  return lz::compress(scratch->page.data(), size, writer, scratch->hashTable);
+}
+
+std::unique_ptr<Page> Page::deserialize(BufferedFileReader& reader) {
   auto page = std::unique_ptr<Page>(new Page());
 
   uint16_t count;
-  serialization::readPod(file, count);
+  serialization::readPod(reader, count);
 
   for (uint16_t i = 0; i < count; i++) {
     uint8_t tag;
-    serialization::readPod(file, tag);
+    serialization::readPod(reader, tag);
 
     if (tag == TAG_PageLine) {
-      auto pl = PageLine::deserialize(file);
+      auto pl = PageLine::deserialize(reader);
       page->elements.push_back(std::move(pl));
     } else if (tag == TAG_PageImage) {
-      auto pi = PageImage::deserialize(file);
+      auto pi = PageImage::deserialize(reader);
       page->elements.push_back(std::move(pi));
     } else {
       LOG_ERR("PGE", "Deserialization failed: Unknown tag %u", tag);
@@ -106,7 +276,7 @@ std::unique_ptr<Page> Page::deserialize(FsFile& file) {
 
   // Deserialize footnotes
   uint16_t fnCount;
-  serialization::readPod(file, fnCount);
+  serialization::readPod(reader, fnCount);
   if (fnCount > MAX_FOOTNOTES_PER_PAGE) {
     LOG_ERR("PGE", "Invalid footnote count %u", fnCount);
     return nullptr;
@@ -114,8 +284,8 @@ std::unique_ptr<Page> Page::deserialize(FsFile& file) {
   page->footnotes.resize(fnCount);
   for (uint16_t i = 0; i < fnCount; i++) {
     auto& entry = page->footnotes[i];
-    if (file.read(entry.number, sizeof(entry.number)) != sizeof(entry.number) ||
-        file.read(entry.href, sizeof(entry.href)) != sizeof(entry.href)) {
+    if (reader.read(entry.number, sizeof(entry.number)) != sizeof(entry.number) ||
+        reader.read(entry.href, sizeof(entry.href)) != sizeof(entry.href)) {
       LOG_ERR("PGE", "Failed to read footnote %u", i);
       return nullptr;
     }
@@ -125,3 +295,221 @@ std::unique_ptr<Page> Page::deserialize(FsFile& file) {
 
   return page;
 }
+
+namespace {
+// Bounds-checked cursor over a page record in memory
+class RecordReader {
+  uint8_t* pos;
+  uint8_t* const end;
+
+ public:
+  RecordReader(uint8_t* begin, const size_t size) : pos(begin), end(begin + size) {}
+
+  template <typename T>
+  bool read(T& value) {
+    if (static_cast<size_t>(end - pos) < sizeof(T)) {
+      return false;
+    }
+    memcpy(&value, pos, sizeof(T));
+    pos += sizeof(T);
+    return true;
+  }
+
+  bool readVarint(uint32_t& value) {
+    value = 0;
+    for (size_t i = 0; i < serialization::MAX_VARINT_SIZE && pos < end; i++) {
+      const uint8_t byte = *pos++;
+      value |= static_cast<uint32_t>(byte & 0x7F) << (7 * i);
+      if ((byte & 0x80) == 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  const uint8_t* position() const { return pos; }
+
+  // Returns a pointer to the next n bytes and skips them, or nullptr if the record is too short
+  uint8_t* take(const size_t n) {
+    if (static_cast<size_t>(end - pos) < n) {
+      return nullptr;
+    }
+    uint8_t* p = pos;
+    pos += n;
+    return p;
+  }
+};
+
+bool readArenaLine(RecordReader& reader, PageTextLine& line) {
+  if (!reader.read(line.xPos) || !reader.read(line.yPos) || !reader.read(line.wordCount) ||
+      line.wordCount > 10000) {
+    return false;
+  }
+
+  line.firstWord = "";
+  for (uint16_t i = 0; i < line.wordCount; i++) {
+    uint32_t len;
+    uint8_t* bytes;
+    if (!reader.read(len) || !(bytes = reader.take(len))) {
+      return false;
+    }
+    // Slide the word into the last length byte to make room for its terminator
+    char* word = reinterpret_cast<char*>(bytes - 1);
+    memmove(word, bytes, len);
+    word[len] = '\0';
+    if (i == 0) {
+      line.firstWord = word;
+    }
+  }
+
+  // Walked once here, so that forEachWord() can decode them without bounds checks
+  line.styleRuns = reader.position();
+  for (uint32_t styled = 0; styled < line.wordCount;) {
+    uint32_t run;
+    if (!reader.take(sizeof(EpdFontFamily::Style)) || !reader.readVarint(run) || run == 0 ||
+        run > line.wordCount - styled) {
+      return false;
+    }
+    styled += run;
+  }
+  line.xDeltas = reader.position();
+  for (uint16_t i = 0; i < line.wordCount; i++) {
+    uint32_t delta;
+    if (!reader.readVarint(delta)) {
+      return false;
+    }
+  }
+
+  uint16_t glyphCount;
+  if (!reader.take(TextBlock::SERIALIZED_STYLE_SIZE) || !reader.read(glyphCount)) {
+    return false;
+  }
+
+  line.runLengths = nullptr;
+  line.glyphs = nullptr;
+  if (glyphCount == 0) {
+    return true;
+  }
+  line.runLengths = reader.take(line.wordCount * sizeof(uint16_t));
+  line.glyphs = reader.take(glyphCount * sizeof(PlacedGlyph));
+  if (!line.runLengths || !line.glyphs) {
+    return false;
+  }
+  // render() walks the runs word by word, so they must not add up to more glyphs than were stored
+  uint32_t runTotal = 0;
+  for (uint16_t i = 0; i < line.wordCount; i++) {
+    uint16_t len;
+    memcpy(&len, line.runLengths + i * sizeof(uint16_t), sizeof(len));
+    runTotal += len;
+  }
+  return runTotal <= glyphCount;
+}
+
+std::shared_ptr<PageImage> readArenaImage(RecordReader& reader) {
+  int16_t xPos, yPos, width, height;
+  uint32_t len, sourceLen;
+  const uint8_t* path;
+  const uint8_t* source;
+  if (!reader.read(xPos) || !reader.read(yPos) || !reader.read(len) || !(path = reader.take(len)) ||
+      !reader.read(width) || !reader.read(height) || !reader.read(sourceLen) || !(source = reader.take(sourceLen))) {
+    return nullptr;
+  }
+  auto imageBlock = std::make_shared<ImageBlock>(std::string(reinterpret_cast<const char*>(path), len),
+                                                 std::string(reinterpret_cast<const char*>(source), sourceLen),
+                                                 width, height);
+  return std::make_shared<PageImage>(std::move(imageBlock), xPos, yPos);
+}
+}  // namespace
+
+std::unique_ptr<Page> Page::deserialize(FsFile& file, const uint32_t recordSize) {
+  uint8_t codec;
+  uint16_t rawSize = 0;
+  if (recordSize < sizeof(codec) || file.read(&codec, sizeof(codec)) != sizeof(codec) ||
+      (codec == RECORD_LZ &&
+       (recordSize < sizeof(codec) + sizeof(rawSize) || file.read(&rawSize, sizeof(rawSize)) != sizeof(rawSize)))) {
+    LOG_ERR("PGE", "Failed to read page record header");
+    return nullptr;
+  }
+  const uint32_t dataSize = recordSize - sizeof(codec) - (codec == RECORD_LZ ? sizeof(rawSize) : 0);
+  const uint32_t pageSize = codec == RECORD_LZ ? rawSize : dataSize;
+  if (codec != RECORD_STORED && codec != RECORD_LZ) {
+    LOG_ERR("PGE", "Unknown page record codec %u", codec);
+    return nullptr;
+  }
+
+  auto page = std::unique_ptr<Page>(new Page());
+  page->arena.reset(static_cast<uint8_t*>(malloc(pageSize)));
+  if (!page->arena) {
+    LOG_ERR("PGE", "Failed to allocate %u byte page arena", pageSize);
+    return nullptr;
+  }
+  if (codec == RECORD_STORED) {
+    if (file.read(page->arena.get(), dataSize) != static_cast<int>(dataSize)) {
+      LOG_ERR("PGE", "Failed to read %u byte page record", dataSize);
+      return nullptr;
+    }
+  } else {
+    const std::unique_ptr<uint8_t, decltype(&free)> compressed(static_cast<uint8_t*>(malloc(dataSize)), &free);
+    if (!compressed || file.read(compressed.get(), dataSize) != static_cast<int>(dataSize) ||
+        !lz::decompress(compressed.get(), dataSize, page->arena.get(), pageSize)) {
+      LOG_ERR("PGE", "Failed to read %u byte compressed page record", dataSize);
+      return nullptr;
+    }
+  }
+
+  RecordReader reader(page->arena.get(), pageSize);
+  uint16_t count;
+  if (!reader.read(count)) {
+    LOG_ERR("PGE", "Deserialization failed: truncated record");
+    return nullptr;
+  }
+  page->lines.reserve(count);
+
+  for (uint16_t i = 0; i < count; i++) {
+    uint8_t tag;
+    if (!reader.read(tag)) {
+      LOG_ERR("PGE", "Deserialization failed: truncated record");
+      return nullptr;
+    }
+
+    if (tag == TAG_PageLine) {
+      PageTextLine line;
+      if (!readArenaLine(reader, line)) {
+        LOG_ERR("PGE", "Deserialization failed: bad line %u", i);
+        return nullptr;
+      }
+      page->lines.push_back(line);
+    } else if (tag == TAG_PageImage) {
+      auto pi = readArenaImage(reader);
+      if (!pi) {
+        LOG_ERR("PGE", "Deserialization failed: bad image %u", i);
+        return nullptr;
+      }
+      page->elements.push_back(std::move(pi));
+    } else {
+      LOG_ERR("PGE", "Deserialization failed: Unknown tag %u", tag);
+      return nullptr;
+    }
+  }
+
+  uint16_t fnCount;
+  if (!reader.read(fnCount) || fnCount > MAX_FOOTNOTES_PER_PAGE) {
+    LOG_ERR("PGE", "Invalid footnote count");
+    return nullptr;
+  }
+  page->footnotes.resize(fnCount);
+  for (auto& entry : page->footnotes) {
+    const uint8_t* number = reader.take(sizeof(entry.number));
+    const uint8_t* href = reader.take(sizeof(entry.href));
+    if (!number || !href) {
+      LOG_ERR("PGE", "Failed to read footnote");
+      return nullptr;
+    }
+    memcpy(entry.number, number, sizeof(entry.number));
+    memcpy(entry.href, href, sizeof(entry.href));
+    entry.number[sizeof(entry.number) - 1] = '\0';
+    entry.href[sizeof(entry.href) - 1] = '\0';
+  }
+
+  return page;
+}
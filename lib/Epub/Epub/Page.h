@@ -1,7 +1,12 @@
 #pragma once
+#include <BufferedFileReader.h>
+#include <BufferedFileWriter.h>
 #include <HalStorage.h>
+#include <LzCodec.h>
 
 #include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <string>
 #include <utility>
 #include <vector>
@@ -23,7 +28,7 @@ class PageElement {
   explicit PageElement(const int16_t xPos, const int16_t yPos) : xPos(xPos), yPos(yPos) {}
   virtual ~PageElement() = default;
   virtual void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) = 0;
-  virtual bool serialize(FsFile& file) = 0;
+  virtual bool serialize(BufferedFileWriter& writer) = 0;
   virtual PageElementTag getTag() const = 0;  // Add type identification
 };
 
@@ -36,9 +41,10 @@ class PageLine final : public PageElement {
       : PageElement(xPos, yPos), block(std::move(block)) {}
   const std::shared_ptr<TextBlock>& getBlock() const { return block; }
   void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) override;
-  bool serialize(FsFile& file) override;
+  bool serialize(BufferedFileWriter& writer) override;
+  bool serialize(BufferedFileWriter& writer, const GfxRenderer* renderer, int fontId);
   PageElementTag getTag() const override { return TAG_PageLine; }
-  static std::unique_ptr<PageLine> deserialize(FsFile& file);
+  static std::unique_ptr<PageLine> deserialize(BufferedFileReader& reader);
 };
 
 // New PageImage class
@@ -49,16 +55,111 @@ class PageImage final : public PageElement {
   PageImage(std::shared_ptr<ImageBlock> block, const int16_t xPos, const int16_t yPos)
       : PageElement(xPos, yPos), imageBlock(std::move(block)) {}
   void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) override;
-  bool serialize(FsFile& file) override;
+  bool serialize(BufferedFileWriter& writer) override;
   PageElementTag getTag() const override { return TAG_PageImage; }
-  static std::unique_ptr<PageImage> deserialize(FsFile& file);
+  static std::unique_ptr<PageImage> deserialize(BufferedFileReader& reader);
   const ImageBlock& getImageBlock() const { return *imageBlock; }
 };
 
+// A text line of a page loaded with Page::deserialize(file, recordSize). Instead of owning a TextBlock it points into
+// the page's arena, where the line's words, style runs and x deltas stay in their serialized layout (see
+// TextBlock::serialize()) and are decoded word by word as they are walked. Each word has been NUL-terminated in place
+// by shifting it one byte into its 4-byte length prefix, so word i + 1 starts strlen(word i) + 1 + WORD_PREFIX_GAP
+// bytes after word i. Lines written with glyph runs also point at each word's glyph count and the PlacedGlyph entries
+// of all words, in word order.
+struct PageTextLine {
+  static constexpr size_t WORD_PREFIX_GAP = sizeof(uint32_t) - 1;
+
+  int16_t xPos;
+  int16_t yPos;
+  uint16_t wordCount;
+  const char* firstWord;
+  const uint8_t* styleRuns;   // Style byte and varint word count pairs, covering wordCount words
+  const uint8_t* xDeltas;     // wordCount signed varints
+  const uint8_t* runLengths;  // wordCount uint16_t values, not necessarily aligned; nullptr without glyph runs
+  const uint8_t* glyphs;      // PlacedGlyph entries, not necessarily aligned
+
+  static constexpr int ALL_STYLES = -1;
+  static constexpr int STYLE_COUNT = 8;  // Every combination of bold, italic and underline
+
+  // Draws the words of the line, or with style other than ALL_STYLES only the words in that style
+  void render(const GfxRenderer& renderer, int fontId, int xOffset, int yOffset, int style = ALL_STYLES) const;
+  void recordGlyphs(FontCacheManager& fontCache, int fontId) const;
+  // Bit s set for each style s the line has words in
+  uint8_t styleMask() const {
+    uint8_t mask = 0;
+    const uint8_t* styleRun = styleRuns;
+    for (uint32_t styled = 0; styled < wordCount;) {
+      mask |= 1 << (*styleRun++ % STYLE_COUNT);
+      styled += nextVarint(styleRun);
+    }
+    return mask;
+  }
+  // Calls fn(const char* word, uint16_t index, int16_t x, EpdFontFamily::Style style) for the words in order, x
+  // relative to the line
+  template <typename Fn>
+  void forEachWord(Fn&& fn) const {
+    const char* word = firstWord;
+    const uint8_t* styleRun = styleRuns;
+    const uint8_t* xDelta = xDeltas;
+    EpdFontFamily::Style style = EpdFontFamily::REGULAR;
+    uint32_t styleLeft = 0;
+    int16_t x = 0;
+    for (uint16_t i = 0; i < wordCount; i++) {
+      if (styleLeft == 0) {
+        style = static_cast<EpdFontFamily::Style>(*styleRun++);
+        styleLeft = nextVarint(styleRun);
+      }
+      styleLeft--;
+      const uint32_t zigzag = nextVarint(xDelta);
+      x = static_cast<int16_t>(x + (static_cast<int32_t>(zigzag >> 1) ^ -static_cast<int32_t>(zigzag & 1)));
+      fn(word, i, x, style);
+      word += strlen(word) + 1 + WORD_PREFIX_GAP;
+    }
+  }
+
+ private:
+  // Page::deserialize() has checked that every varint of the line ends inside the arena
+  static uint32_t nextVarint(const uint8_t*& p) {
+    uint32_t value = 0;
+    for (int shift = 0;; shift += 7) {
+      const uint8_t byte = *p++;
+      value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) {
+        return value;
+      }
+    }
+  }
+};
+
+// Section files LZ compress their page records as they are written unless the build turns it off; either kind of
+// record reads back the same
+#ifndef SECTION_RECORD_COMPRESSION
+#define SECTION_RECORD_COMPRESSION 1
+#endif
+
+// Pages loaded into an arena draw their text one style at a time, all regular words, then all italic ones and so on,
+// so the glyph cache serves each style's glyphs in a row instead of alternating between styles word by word. Words
+// don't overlap, so the order they are drawn in doesn't change the frame.
+#ifndef PAGE_STYLE_BATCHED_RENDER
+#define PAGE_STYLE_BATCHED_RENDER 1
+#endif
+
+// Buffers reused by the Page::serializeRecord() calls of a section build to compress its page records
+struct PageRecordScratch {
+  BufferedFileWriter page;
+  uint16_t hashTable[lz::HASH_ENTRIES];
+};
+
 class Page {
+  // Backing store for lines, holding the page record as read from the section file
+  std::unique_ptr<uint8_t, decltype(&free)> arena{nullptr, &free};
+
  public:
   // the list of block index and line numbers on this page
   std::vector<std::shared_ptr<PageElement>> elements;
+  // Text lines of pages loaded into an arena (see PageTextLine); empty for pages built by the parser
+  std::vector<PageTextLine> lines;
   std::vector<FootnoteEntry> footnotes;
   static constexpr uint16_t MAX_FOOTNOTES_PER_PAGE = 16;
 
@@ -73,27 +174,86 @@ class Page {
   }
 
   void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) const;
-  bool serialize(FsFile& file) const;
-  static std::unique_ptr<Page> deserialize(FsFile& file);
+  // render() split in two, so the text can be shown before the images are decoded: renderText() leaves the image
+  // areas blank and renderImages() draws only the images
+  void renderText(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) const;
+  void renderImages(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) const;
+  // Renders only the elements that can reach into the screen rows [bandTop, bandBottom), see
+  // GfxRenderer::beginGrayscaleBand()
+  void renderBand(GfxRenderer& renderer, int fontId, int xOffset, int yOffset, int bandTop, int bandBottom) const;
+  // Adds the glyphs of the page to the prewarm scan without rendering it. Lines loaded with glyph runs hand over the
+  // glyph indices resolved at layout time, so the scan needs no UTF-8 decoding or glyph lookups for them.
+  void recordGlyphs(FontCacheManager& fontCache, int fontId) const;
+  // Pass the renderer and font to store glyph runs along with the words (see TextBlock::serialize())
+  bool serialize(BufferedFileWriter& writer, const GfxRenderer* renderer = nullptr, int fontId = 0) const;
+  static std::unique_ptr<Page> deserialize(BufferedFileReader& reader);
+  // Writes the page as a section file record: a codec byte, then what serialize() writes, LZ compressed (see
+  // LzCodec.h) through scratch when it is given
+  bool serializeRecord(BufferedFileWriter& writer, PageRecordScratch* scratch, const GfxRenderer* renderer,
+                       int fontId) const;
+  // Reads a page record (see serializeRecord()) of known size for display: one allocation holds all text, instead of a
+  // TextBlock, strings and shared_ptr per line. Such pages can't be serialized again.
+  static std::unique_ptr<Page> deserialize(FsFile& file, uint32_t recordSize);
+
+  // Calls fn(const char* word) for the words of the page in reading order, for pages built by the parser and pages
+  // loaded into an arena alike
+  template <typename Fn>
+  void forEachWord(Fn&& fn) const {
+    for (const auto& line : lines) {
+      line.forEachWord([&fn](const char* word, uint16_t, int16_t, EpdFontFamily::Style) { fn(word); });
+    }
+    for (const auto& el : elements) {
+      if (el->getTag() == TAG_PageLine) {
+        for (const auto& word : static_cast<const PageLine&>(*el).getBlock()->getWords()) {
+          fn(word.c_str());
+        }
+      }
+    }
+  }
+
+  // Calls fn(const char* word, int x, int y, EpdFontFamily::Style style) for the words of the page in reading order,
+  // with the top left of each word relative to the page origin as render() places it
+  template <typename Fn>
+  void forEachPlacedWord(Fn&& fn) const {
+    for (const auto& line : lines) {
+      line.forEachWord([&fn, &line](const char* word, uint16_t, const int16_t wordX, const EpdFontFamily::Style style) {
+        fn(word, line.xPos + wordX, line.yPos, style);
+      });
+    }
+    for (const auto& el : elements) {
+      if (el->getTag() == TAG_PageLine) {
+        const auto& block = *static_cast<const PageLine&>(*el).getBlock();
+        const auto& words = block.getWords();
+        for (size_t i = 0; i < words.size() && i < block.getWordXpos().size(); i++) {
+          fn(words[i].c_str(), el->xPos + block.getWordXpos()[i], el->yPos, block.getWordStyles()[i]);
+        }
+      }
+    }
+  }
 
-  // Check if page contains any images (used to force full refresh)
-  bool hasImages() const {
-    return std::any_of(elements.begin(), elements.end(),
-                       [](const std::shared_ptr<PageElement>& el) { return el->getTag() == TAG_PageImage; });
+  // Whether the page has an image not known to be bilevel: a gray one, or one not decoded yet. Such pages put their
+  // images up in a refresh of their own after the text and take both grayscale passes. Bilevel images are drawn from
+  // their pixel caches with the text, like a line of it, and the grayscale passes skip them.
+  bool hasGrayImages() const {
+    return std::any_of(elements.begin(), elements.end(), [](const std::shared_ptr<PageElement>& el) {
+      return el->getTag() == TAG_PageImage &&
+             static_cast<const PageImage&>(*el).getImageBlock().getTone() != ImageBlock::Tone::Bilevel;
+    });
   }
 
-  // Get bounding box of all images on the page (union of image rects)
-  // Returns false if no images. Coordinates are relative to page origin.
+  // Get bounding box of the ink of all images on the page (union of the images' ink bounds, the whole image for one
+  // not decoded yet). Returns false if no image has ink. Coordinates are relative to page origin.
   bool getImageBoundingBox(int16_t& outX, int16_t& outY, int16_t& outW, int16_t& outH) const {
     bool found = false;
     int16_t minX = INT16_MAX, minY = INT16_MAX, maxX = INT16_MIN, maxY = INT16_MIN;
     for (const auto& el : elements) {
-      if (el->getTag() == TAG_PageImage) {
-        const auto& img = static_cast<const PageImage&>(*el);
-        int16_t x = img.xPos;
-        int16_t y = img.yPos;
-        int16_t right = x + img.getImageBlock().getWidth();
-        int16_t bottom = y + img.getImageBlock().getHeight();
+      int16_t inkX, inkY, inkW, inkH;
+      if (el->getTag() == TAG_PageImage &&
+          static_cast<const PageImage&>(*el).getImageBlock().getInkBounds(inkX, inkY, inkW, inkH)) {
+        int16_t x = el->xPos + inkX;
+        int16_t y = el->yPos + inkY;
+        int16_t right = x + inkW;
+        int16_t bottom = y + inkH;
         minX = std::min(minX, x);
         minY = std::min(minY, y);
         maxX = std::max(maxX, right);
@@ -0,0 +1,52 @@
+#include "PageCache.h"
+
+#include <MemoryBudget.h>
+
+#include <algorithm>
+
+#include "Page.h"
+
+PageCache::PageCache() {
+  entries.reserve(CAPACITY);
+  // A page is read back from the section file in a few milliseconds
+  MemoryBudget::registerCache(this, "pages", MemoryBudget::EVICT_NORMAL, [this] {
+    if (entries.empty()) {
+      return false;
+    }
+    entries.pop_back();
+    return true;
+  });
+}
+
+PageCache::~PageCache() { MemoryBudget::unregisterCache(this); }
+
+std::shared_ptr<Page> PageCache::get(const int spineIndex, const int pageIndex, const uint32_t layoutStamp) {
+  const auto it = std::find_if(entries.begin(), entries.end(), [&](const Entry& e) {
+    return e.spineIndex == spineIndex && e.pageIndex == pageIndex && e.layoutStamp == layoutStamp;
+  });
+  if (it == entries.end()) {
+    return nullptr;
+  }
+  // Move to front
+  std::rotate(entries.begin(), it, it + 1);
+  return entries.front().page;
+}
+
+void PageCache::put(const int spineIndex, const int pageIndex, const uint32_t layoutStamp,
+                    std::shared_ptr<Page> page) {
+  const auto it = std::find_if(entries.begin(), entries.end(), [&](const Entry& e) {
+    return e.spineIndex == spineIndex && e.pageIndex == pageIndex;
+  });
+  if (it != entries.end()) {
+    entries.erase(it);
+  } else if (entries.size() >= CAPACITY) {
+    entries.pop_back();
+  }
+  entries.insert(entries.begin(), Entry{spineIndex, pageIndex, layoutStamp, std::move(page)});
+}
+
+void PageCache::invalidate(const int spineIndex) {
+  entries.erase(std::remove_if(entries.begin(), entries.end(),
+                               [spineIndex](const Entry& e) { return e.spineIndex == spineIndex; }),
+                entries.end());
+}
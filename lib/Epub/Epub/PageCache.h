@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class Page;
+
+/**
+ * Small LRU of deserialized pages, shared by the Section objects of an open book so that flipping back and forth or
+ * returning from a footnote doesn't read and re-allocate the page from the section file again.
+ *
+ * Entries are keyed by spine index, page number and a stamp of the layout parameters in the section file header, so a
+ * relaid-out section never serves stale pages. Registered with MemoryBudget, which drops the least recently used
+ * pages when a large allocation needs room. Not thread-safe: only use it with RenderLock held.
+ */
+class PageCache {
+  struct Entry {
+    int spineIndex;
+    int pageIndex;
+    uint32_t layoutStamp;
+    std::shared_ptr<Page> page;
+  };
+  std::vector<Entry> entries;  // Most recently used first
+
+ public:
+  static constexpr size_t CAPACITY = 3;  // Current page and one on either side
+
+  PageCache();
+  ~PageCache();
+  PageCache(const PageCache&) = delete;
+  PageCache& operator=(const PageCache&) = delete;
+
+  std::shared_ptr<Page> get(int spineIndex, int pageIndex, uint32_t layoutStamp);
+  void put(int spineIndex, int pageIndex, uint32_t layoutStamp, std::shared_ptr<Page> page);
+  // Drops all pages of a section, e.g. when its file is rebuilt
+  void invalidate(int spineIndex);
+  void clear() { entries.clear(); }
+};
@@ -5,88 +5,194 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <limits>
 #include <vector>
 
+#include "WordWidthCache.h"
+#include "hyphenation/HyphenationCache.h"
 #include "hyphenation/Hyphenator.h"
 
 constexpr int MAX_COST = std::numeric_limits<int>::max();
+// Most words computeLineBreaks puts on one line; bounds its search even when words measure zero width
+constexpr size_t MAX_LINE_WORDS = 128;
+// Positions of line breaking state kept at once, however long the paragraph. The line break test builds a reference
+// with a window wider than any of its paragraphs, which is the full DP.
+#ifndef PARSED_TEXT_BREAK_WINDOW
+#define PARSED_TEXT_BREAK_WINDOW 1024
+#endif
+constexpr size_t BREAK_WINDOW = PARSED_TEXT_BREAK_WINDOW;
+// A full window must hold a committable line break at least a line before the current word
+static_assert(BREAK_WINDOW > 3 * MAX_LINE_WORDS, "BREAK_WINDOW too small for MAX_LINE_WORDS");
 
 namespace {
 
 // Soft hyphen byte pattern used throughout EPUBs (UTF-8 for U+00AD).
 constexpr char SOFT_HYPHEN_UTF8[] = "\xC2\xAD";
 constexpr size_t SOFT_HYPHEN_BYTES = 2;
+// Longest word measured from a copy on the stack; longer ones, rare outside URLs, are copied to the heap
+constexpr size_t MEASURE_BUFFER_SIZE = 96;
+
+bool isSoftHyphenAt(const std::string_view word, const size_t i) {
+  return word.compare(i, SOFT_HYPHEN_BYTES, SOFT_HYPHEN_UTF8, SOFT_HYPHEN_BYTES) == 0;
+}
+
+// Copies word to out without its soft hyphens, so rendered glyphs match measured widths, and returns the bytes copied
+size_t copyWithoutSoftHyphens(const std::string_view word, char* out) {
+  size_t length = 0;
+  for (size_t i = 0; i < word.size(); ++i) {
+    if (isSoftHyphenAt(word, i)) {
+      ++i;
+      continue;
+    }
+    out[length++] = word[i];
+  }
+  return length;
+}
 
 // Returns the first rendered codepoint of a word (skipping leading soft hyphens).
-uint32_t firstCodepoint(const std::string& word) {
-  const auto* ptr = reinterpret_cast<const unsigned char*>(word.c_str());
-  while (true) {
+uint32_t firstCodepoint(const std::string_view word) {
+  const auto* ptr = reinterpret_cast<const unsigned char*>(word.data());
+  const auto* end = ptr + word.size();
+  while (ptr < end) {
     const uint32_t cp = utf8NextCodepoint(&ptr);
     if (cp == 0) return 0;
     if (cp != 0x00AD) return cp;  // skip soft hyphens
   }
+  return 0;
 }
 
 // Returns the last codepoint of a word by scanning backward for the start of the last UTF-8 sequence.
-uint32_t lastCodepoint(const std::string& word) {
+uint32_t lastCodepoint(const std::string_view word) {
   if (word.empty()) return 0;
   // UTF-8 continuation bytes start with 10xxxxxx; scan backward to find the leading byte.
   size_t i = word.size() - 1;
   while (i > 0 && (static_cast<uint8_t>(word[i]) & 0xC0) == 0x80) {
     --i;
   }
-  const auto* ptr = reinterpret_cast<const unsigned char*>(word.c_str() + i);
+  const auto* ptr = reinterpret_cast<const unsigned char*>(word.data() + i);
   return utf8NextCodepoint(&ptr);
 }
 
-bool containsSoftHyphen(const std::string& word) { return word.find(SOFT_HYPHEN_UTF8) != std::string::npos; }
-
-// Removes every soft hyphen in-place so rendered glyphs match measured widths.
-void stripSoftHyphensInPlace(std::string& word) {
-  size_t pos = 0;
-  while ((pos = word.find(SOFT_HYPHEN_UTF8, pos)) != std::string::npos) {
-    word.erase(pos, SOFT_HYPHEN_BYTES);
-  }
-}
-
 // Returns the advance width for a word while ignoring soft hyphen glyphs and optionally appending a visible hyphen.
 // Uses advance width (sum of glyph advances + kerning) rather than bounding box width so that italic glyph overhangs
 // don't inflate inter-word spacing.
-uint16_t measureWordWidth(const GfxRenderer& renderer, const int fontId, const std::string& word,
-                          const EpdFontFamily::Style style, const bool appendHyphen = false) {
-  if (word.size() == 1 && word[0] == ' ' && !appendHyphen) {
-    return renderer.getSpaceWidth(fontId, style);
+uint16_t measureWordAdvance(const GfxRenderer& renderer, const FontHandle& font, const std::string_view word,
+                            const EpdFontFamily::Style style, const bool appendHyphen) {
+  // The renderer wants a NUL terminated string, which a word in the paragraph buffer need not be
+  char stackText[MEASURE_BUFFER_SIZE];
+  std::string heapText;
+  char* text = stackText;
+  if (word.size() + 2 > MEASURE_BUFFER_SIZE) {
+    heapText.resize(word.size() + 2);
+    text = &heapText[0];
   }
-  const bool hasSoftHyphen = containsSoftHyphen(word);
-  if (!hasSoftHyphen && !appendHyphen) {
-    return renderer.getTextAdvanceX(fontId, word.c_str(), style);
+  size_t length = copyWithoutSoftHyphens(word, text);
+  if (appendHyphen) {
+    text[length++] = '-';
   }
+  text[length] = '\0';
+  return renderer.getTextAdvanceX(font, text, style);
+}
 
-  std::string sanitized = word;
-  if (hasSoftHyphen) {
-    stripSoftHyphensInPlace(sanitized);
+// measureWordAdvance through the section's width cache, when there is one
+uint16_t measureWordWidth(const GfxRenderer& renderer, const FontHandle& font, const std::string_view word,
+                          const EpdFontFamily::Style style, WordWidthCache* cache, const bool appendHyphen = false) {
+  if (word.size() == 1 && word[0] == ' ' && !appendHyphen) {
+    return renderer.getSpaceWidth(font, style);
   }
-  if (appendHyphen) {
-    sanitized.push_back('-');
+  if (!cache) {
+    return measureWordAdvance(renderer, font, word, style, appendHyphen);
   }
-  return renderer.getTextAdvanceX(fontId, sanitized.c_str(), style);
+
+  const uint64_t key = WordWidthCache::makeKey(font.id, style, word.data(), word.size(), appendHyphen);
+  uint16_t width;
+  if (!cache->lookup(key, width)) {
+    width = measureWordAdvance(renderer, font, word, style, appendHyphen);
+    cache->store(key, width);
+  }
+  return width;
 }
 
 }  // namespace
 
-void ParsedText::addWord(std::string word, const EpdFontFamily::Style fontStyle, const bool underline,
+void ParsedText::addWord(std::string_view word, const EpdFontFamily::Style fontStyle, const bool underline,
                          const bool attachToPrevious) {
   if (word.empty()) return;
+  if (word.size() > UINT16_MAX) {
+    word = word.substr(0, utf8SafeTruncateBuffer(word.data(), UINT16_MAX));
+  }
 
-  words.push_back(std::move(word));
   EpdFontFamily::Style combinedStyle = fontStyle;
   if (underline) {
     combinedStyle = static_cast<EpdFontFamily::Style>(combinedStyle | EpdFontFamily::UNDERLINE);
   }
-  wordStyles.push_back(combinedStyle);
-  wordContinues.push_back(attachToPrevious);
+  words.push_back({static_cast<uint32_t>(wordBytes.size()), static_cast<uint16_t>(word.size()), combinedStyle,
+                   attachToPrevious ? CONTINUES : uint8_t{0}});
+  wordBytes.append(word);
+  wordBytes.push_back('\0');
+}
+
+void ParsedText::append(ParsedText&& other) {
+  const auto shift = static_cast<uint32_t>(wordBytes.size());
+  wordBytes.append(other.wordBytes);
+  words.reserve(words.size() + other.words.size());
+  for (Word word : other.words) {
+    word.offset += shift;
+    words.push_back(word);
+  }
+  other.wordBytes.clear();
+  other.words.clear();
+}
+
+void ParsedText::consumeWords(const size_t count) {
+  if (count >= words.size()) {
+    wordBytes.clear();
+    words.clear();
+    return;
+  }
+  const uint32_t consumedBytes = words[count].offset;
+  wordBytes.erase(0, consumedBytes);
+  words.erase(words.begin(), words.begin() + count);
+  for (Word& word : words) {
+    word.offset -= consumedBytes;
+  }
+}
+
+int ParsedText::gapBefore(const size_t index, const GfxRenderer& renderer, const FontHandle& font) const {
+  // A split word's prefix ends in its hyphen
+  const uint32_t left = words[index - 1].flags & HYPHENATED ? '-' : lastCodepoint(wordText(index - 1));
+  const uint32_t right = firstCodepoint(wordText(index));
+  if (continues(index)) {
+    // Cross-boundary kerning for continuation words (e.g. nonbreaking spaces, attached punctuation)
+    return renderer.getKerning(font, left, right, words[index - 1].style);
+  }
+  return renderer.getSpaceAdvance(font, left, right, words[index - 1].style);
+}
+
+uint16_t ParsedText::measureWord(const size_t index, const GfxRenderer& renderer, const FontHandle& font) const {
+  return measureWordWidth(renderer, font, wordText(index), words[index].style, widthCache,
+                          words[index].flags & HYPHENATED);
+}
+
+void ParsedText::measureContentWidths(const GfxRenderer& renderer, const int fontId, int& minWidth, int& maxWidth) {
+  const FontHandle font = renderer.resolveFont(fontId);
+  minWidth = 0;
+  maxWidth = 0;
+  // Words attached to the previous one can't be split from it
+  int joinedWidth = 0;
+  for (size_t i = 0; i < words.size(); ++i) {
+    const int width = measureWord(i, renderer, font);
+    if (i > 0 && !continues(i)) {
+      maxWidth += renderer.getSpaceWidth(font, words[i].style);
+      joinedWidth = 0;
+    }
+    joinedWidth += width;
+    maxWidth += width;
+    minWidth = std::max(minWidth, joinedWidth);
+  }
 }
 
 // Consumes data to minimize memory usage
@@ -96,48 +202,53 @@ void ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const int fo
   if (words.empty()) {
     return;
   }
+  // One font lookup for every measurement of the paragraph
+  const FontHandle font = renderer.resolveFont(fontId);
 
   // Apply fixed transforms before any per-line layout work.
   applyParagraphIndent();
 
   const int pageWidth = viewportWidth;
-  auto wordWidths = calculateWordWidths(renderer, fontId);
+  auto wordWidths = calculateWordWidths(renderer, font);
 
   std::vector<size_t> lineBreakIndices;
   if (hyphenationEnabled) {
     // Use greedy layout that can split words mid-loop when a hyphenated prefix fits.
-    lineBreakIndices = computeHyphenatedLineBreaks(renderer, fontId, pageWidth, wordWidths, wordContinues);
+    lineBreakIndices = computeHyphenatedLineBreaks(renderer, font, pageWidth, wordWidths);
+    if (!includeLastLine && !lineBreakIndices.empty()) {
+      // Greedy lines are final once a word has overflowed them; only the last one can still grow
+      lineBreakIndices.pop_back();
+    }
   } else {
-    lineBreakIndices = computeLineBreaks(renderer, fontId, pageWidth, wordWidths, wordContinues);
+    lineBreakIndices = computeLineBreaks(renderer, font, pageWidth, wordWidths, includeLastLine);
   }
-  const size_t lineCount = includeLastLine ? lineBreakIndices.size() : lineBreakIndices.size() - 1;
+  const size_t lineCount = lineBreakIndices.size();
 
   for (size_t i = 0; i < lineCount; ++i) {
-    extractLine(i, pageWidth, wordWidths, wordContinues, lineBreakIndices, processLine, renderer, fontId);
+    extractLine(i, pageWidth, wordWidths, lineBreakIndices, processLine, renderer, font, includeLastLine);
   }
 
   // Remove consumed words so size() reflects only remaining words
   if (lineCount > 0) {
-    const size_t consumed = lineBreakIndices[lineCount - 1];
-    words.erase(words.begin(), words.begin() + consumed);
-    wordStyles.erase(wordStyles.begin(), wordStyles.begin() + consumed);
-    wordContinues.erase(wordContinues.begin(), wordContinues.begin() + consumed);
+    linesEmitted = true;
+    consumeWords(lineBreakIndices[lineCount - 1]);
   }
 }
 
-std::vector<uint16_t> ParsedText::calculateWordWidths(const GfxRenderer& renderer, const int fontId) {
+std::vector<uint16_t> ParsedText::calculateWordWidths(const GfxRenderer& renderer, const FontHandle& font) {
   std::vector<uint16_t> wordWidths;
   wordWidths.reserve(words.size());
 
   for (size_t i = 0; i < words.size(); ++i) {
-    wordWidths.push_back(measureWordWidth(renderer, fontId, words[i], wordStyles[i]));
+    wordWidths.push_back(measureWord(i, renderer, font));
   }
 
   return wordWidths;
 }
 
-std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, const int fontId, const int pageWidth,
-                                                  std::vector<uint16_t>& wordWidths, std::vector<bool>& continuesVec) {
+std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, const FontHandle& font,
+                                                  const int pageWidth, std::vector<uint16_t>& wordWidths,
+                                                  const bool paragraphComplete) {
   if (words.empty()) {
     return {};
   }
@@ -147,7 +258,7 @@ std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, c
   // Negative text-indent (hanging indent, e.g. margin-left:3em; text-indent:-1em) always applies —
   // it is structural (positions the bullet/marker), not decorative.
   const int firstLineIndent =
-      blockStyle.textIndentDefined && (blockStyle.textIndent < 0 || !extraParagraphSpacing) &&
+      !linesEmitted && blockStyle.textIndentDefined && (blockStyle.textIndent < 0 || !extraParagraphSpacing) &&
               (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left)
           ? blockStyle.textIndent
           : 0;
@@ -157,7 +268,7 @@ std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, c
     // First word needs to fit in reduced width if there's an indent
     const int effectiveWidth = i == 0 ? pageWidth - firstLineIndent : pageWidth;
     while (wordWidths[i] > effectiveWidth) {
-      if (!hyphenateWordAtIndex(i, effectiveWidth, renderer, fontId, wordWidths, /*allowFallbackBreaks=*/true)) {
+      if (!hyphenateWordAtIndex(i, effectiveWidth, renderer, font, wordWidths, /*allowFallbackBreaks=*/true)) {
         break;
       }
     }
@@ -165,32 +276,123 @@ std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, c
 
   const size_t totalWordCount = words.size();
 
-  // DP table to store the minimum badness (cost) of lines starting at index i
-  std::vector<int> dp(totalWordCount);
-  // 'ans[i]' stores the index 'j' of the *last word* in the optimal line starting at 'i'
-  std::vector<size_t> ans(totalWordCount);
+  // Forward DP over line starts: cost[p] is the minimum badness of words [0, p) laid out so that a line starts at word
+  // p, prev[p] the start of the line ending there. Badness is the squared slack of every line but the last. Since a
+  // line holds at most MAX_LINE_WORDS words only a window of positions is live, so the tables are capped at
+  // BREAK_WINDOW entries however long the paragraph is; lines before the window are committed to lineBreakIndices.
+  const size_t windowSize = std::min(totalWordCount + 1, BREAK_WINDOW);
+  std::vector<int> cost(windowSize, MAX_COST);
+  std::vector<size_t> prev(windowSize, 0);
+  std::vector<size_t> mark(windowSize, 0);
+  const auto slot = [windowSize](const size_t pos) { return pos % windowSize; };
 
-  // Base Case
-  dp[totalWordCount - 1] = 0;
-  ans[totalWordCount - 1] = totalWordCount - 1;
+  std::vector<size_t> lineBreakIndices;
+  size_t committed = 0;       // Every remaining layout starts a line here
+  size_t initializedEnd = 1;  // Positions [committed, initializedEnd) hold DP state
+  size_t markStamp = 0;
+  cost[0] = 0;
+
+  std::vector<size_t> openStarts;  // Starts of the lines that could still take the words that follow
+  const auto relax = [&](const size_t from, const size_t to, const int total) {
+    if (to == totalWordCount) {
+      openStarts.push_back(from);
+    }
+    for (; initializedEnd <= to; ++initializedEnd) {
+      cost[slot(initializedEnd)] = MAX_COST;
+    }
+    if (total < cost[slot(to)]) {
+      cost[slot(to)] = total;
+      prev[slot(to)] = from;
+    }
+  };
 
-  for (int i = totalWordCount - 2; i >= 0; --i) {
-    int currlen = 0;
-    dp[i] = MAX_COST;
+  // Latest line start on the chains of every head; reference is the head whose chain gets marked
+  const auto sharedLineStart = [&](const std::vector<size_t>& heads, const size_t reference) {
+    ++markStamp;
+    for (size_t pos = reference; pos > committed; pos = prev[slot(pos)]) {
+      mark[slot(pos)] = markStamp;
+    }
+    mark[slot(committed)] = markStamp;
+    size_t common = reference;
+    for (const size_t head : heads) {
+      size_t pos = head;
+      while (mark[slot(pos)] != markStamp) {
+        pos = prev[slot(pos)];
+      }
+      common = std::min(common, pos);
+    }
+    return common;
+  };
+
+  // Emits the lines of the best layout ending at target, which every remaining layout must go through
+  const auto commit = [&](const size_t target) {
+    const size_t firstNew = lineBreakIndices.size();
+    for (size_t pos = target; pos > committed; pos = prev[slot(pos)]) {
+      lineBreakIndices.push_back(pos);
+    }
+    std::reverse(lineBreakIndices.begin() + firstNew, lineBreakIndices.end());
+    committed = target;
+  };
+
+  size_t i = 0;
+  while (i < totalWordCount) {
+    const size_t lineEnd = std::min(totalWordCount, i + MAX_LINE_WORDS);
+    if (lineEnd - committed >= windowSize) {
+      // The window is full. Every layout continues through one of the positions reached so far at or after word i,
+      // so the lines on which all of their chains agree are final.
+      std::vector<size_t> heads;
+      size_t best = SIZE_MAX;
+      for (size_t pos = i; pos < initializedEnd; ++pos) {
+        if (cost[slot(pos)] == MAX_COST) continue;
+        heads.push_back(pos);
+        if (best == SIZE_MAX || cost[slot(pos)] < cost[slot(best)]) {
+          best = pos;
+        }
+      }
+      size_t common = sharedLineStart(heads, best);
+
+      if (common == committed) {
+        // Some candidate still differs from the first line in the window: keep the cheapest layout's lines up to a
+        // break at least a line before word i, and drop the candidates that don't share them
+        common = best;
+        while (common + MAX_LINE_WORDS > i) {
+          common = prev[slot(common)];
+        }
+        for (const size_t head : heads) {
+          size_t pos = head;
+          while (pos > common) {
+            pos = prev[slot(pos)];
+          }
+          if (pos != common) {
+            cost[slot(head)] = MAX_COST;
+          }
+        }
+      }
+      commit(common);
+      // Lines reaching the end that were ruled out by the commit
+      openStarts.erase(std::remove_if(openStarts.begin(), openStarts.end(),
+                                      [&](size_t pos) {
+                                        while (pos > committed) {
+                                          pos = prev[slot(pos)];
+                                        }
+                                        return pos != committed;
+                                      }),
+                       openStarts.end());
+    }
+
+    if (i >= initializedEnd || cost[slot(i)] == MAX_COST) {
+      ++i;
+      continue;  // No layout starts a line here
+    }
 
     // First line has reduced width due to text-indent
     const int effectivePageWidth = i == 0 ? pageWidth - firstLineIndent : pageWidth;
+    int currlen = 0;
+    bool anyLineFits = false;
 
-    for (size_t j = i; j < totalWordCount; ++j) {
+    for (size_t j = i; j < lineEnd; ++j) {
       // Add space before word j, unless it's the first word on the line or a continuation
-      int gap = 0;
-      if (j > static_cast<size_t>(i) && !continuesVec[j]) {
-        gap =
-            renderer.getSpaceAdvance(fontId, lastCodepoint(words[j - 1]), firstCodepoint(words[j]), wordStyles[j - 1]);
-      } else if (j > static_cast<size_t>(i) && continuesVec[j]) {
-        // Cross-boundary kerning for continuation words (e.g. nonbreaking spaces, attached punctuation)
-        gap = renderer.getKerning(fontId, lastCodepoint(words[j - 1]), firstCodepoint(words[j]), wordStyles[j - 1]);
-      }
+      const int gap = j > i ? gapBefore(j, renderer, font) : 0;
       currlen += wordWidths[j] + gap;
 
       if (currlen > effectivePageWidth) {
@@ -198,88 +400,67 @@ std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, c
       }
 
       // Cannot break after word j if the next word attaches to it (continuation group)
-      if (j + 1 < totalWordCount && continuesVec[j + 1]) {
+      if (j + 1 < totalWordCount && continues(j + 1)) {
         continue;
       }
 
-      int cost;
-      if (j == totalWordCount - 1) {
-        cost = 0;  // Last line
-      } else {
+      long long total = cost[slot(i)];
+      if (j != totalWordCount - 1) {  // The last line is free
         const int remainingSpace = effectivePageWidth - currlen;
-        // Use long long for the square to prevent overflow
-        const long long cost_ll = static_cast<long long>(remainingSpace) * remainingSpace + dp[j + 1];
-
-        if (cost_ll > MAX_COST) {
-          cost = MAX_COST;
-        } else {
-          cost = static_cast<int>(cost_ll);
-        }
-      }
-
-      if (cost < dp[i]) {
-        dp[i] = cost;
-        ans[i] = j;  // j is the index of the last word in this optimal line
+        total += static_cast<long long>(remainingSpace) * remainingSpace;
       }
+      relax(i, j + 1, total > MAX_COST ? MAX_COST - 1 : static_cast<int>(total));
+      anyLineFits = true;
     }
 
-    // Handle oversized word: if no valid configuration found, force single-word line
+    // Handle oversized word: if no line starting here fits, force a single-word line at no cost.
     // This prevents cascade failure where one oversized word breaks all preceding words
-    if (dp[i] == MAX_COST) {
-      ans[i] = i;  // Just this word on its own line
-      // Inherit cost from next word to allow subsequent words to find valid configurations
-      if (i + 1 < static_cast<int>(totalWordCount)) {
-        dp[i] = dp[i + 1];
-      } else {
-        dp[i] = 0;
-      }
+    if (!anyLineFits) {
+      relax(i, i + 1, cost[slot(i)]);
     }
+    ++i;
   }
 
-  // Stores the index of the word that starts the next line (last_word_index + 1)
-  std::vector<size_t> lineBreakIndices;
-  size_t currentWordIndex = 0;
-
-  while (currentWordIndex < totalWordCount) {
-    size_t nextBreakIndex = ans[currentWordIndex] + 1;
-
-    // Safety check: prevent infinite loop if nextBreakIndex doesn't advance
-    if (nextBreakIndex <= currentWordIndex) {
-      // Force advance by at least one word to avoid infinite loop
-      nextBreakIndex = currentWordIndex + 1;
-    }
-
-    lineBreakIndices.push_back(nextBreakIndex);
-    currentWordIndex = nextBreakIndex;
+  if (paragraphComplete) {
+    commit(totalWordCount);
+  } else if (!openStarts.empty()) {
+    // More words follow, so the last line isn't known yet. Every layout of the longer paragraph puts the last
+    // buffered word on a line starting at one of openStarts, and breaks before those are already final.
+    commit(sharedLineStart(openStarts, openStarts.front()));
   }
-
   return lineBreakIndices;
 }
 
 void ParsedText::applyParagraphIndent() {
-  if (extraParagraphSpacing || words.empty()) {
+  if (extraParagraphSpacing || words.empty() || indentApplied) {
     return;
   }
+  indentApplied = true;
 
   if (blockStyle.textIndentDefined) {
     // CSS text-indent is explicitly set (even if 0) - don't use fallback EmSpace
     // The actual indent positioning is handled in extractLine()
   } else if (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left) {
     // No CSS text-indent defined - use EmSpace fallback for visual indent
-    words.front().insert(0, "\xe2\x80\x83");
+    constexpr char EM_SPACE[] = "\xe2\x80\x83";
+    constexpr uint32_t EM_SPACE_BYTES = sizeof(EM_SPACE) - 1;
+    wordBytes.insert(0, EM_SPACE, EM_SPACE_BYTES);
+    words.front().length += EM_SPACE_BYTES;
+    for (size_t i = 1; i < words.size(); ++i) {
+      words[i].offset += EM_SPACE_BYTES;
+    }
   }
 }
 
 // Builds break indices while opportunistically splitting the word that would overflow the current line.
-std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& renderer, const int fontId,
-                                                            const int pageWidth, std::vector<uint16_t>& wordWidths,
-                                                            std::vector<bool>& continuesVec) {
+std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& renderer, const FontHandle& font,
+                                                            const int pageWidth, std::vector<uint16_t>& wordWidths) {
   // Calculate first line indent (only for left/justified text).
   // Positive text-indent (paragraph indent) is suppressed when extraParagraphSpacing is on.
   // Negative text-indent (hanging indent, e.g. margin-left:3em; text-indent:-1em) always applies —
   // it is structural (positions the bullet/marker), not decorative.
   const int firstLineIndent =
-      blockStyle.textIndentDefined && (blockStyle.textIndent < 0 || !extraParagraphSpacing) &&
+      !linesEmitted && blockStyle.textIndentDefined && (blockStyle.textIndent < 0 || !extraParagraphSpacing) &&
               (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left)
           ? blockStyle.textIndent
           : 0;
@@ -298,15 +479,7 @@ std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& r
     // Consume as many words as possible for current line, splitting when prefixes fit
     while (currentIndex < wordWidths.size()) {
       const bool isFirstWord = currentIndex == lineStart;
-      int spacing = 0;
-      if (!isFirstWord && !continuesVec[currentIndex]) {
-        spacing = renderer.getSpaceAdvance(fontId, lastCodepoint(words[currentIndex - 1]),
-                                           firstCodepoint(words[currentIndex]), wordStyles[currentIndex - 1]);
-      } else if (!isFirstWord && continuesVec[currentIndex]) {
-        // Cross-boundary kerning for continuation words (e.g. nonbreaking spaces, attached punctuation)
-        spacing = renderer.getKerning(fontId, lastCodepoint(words[currentIndex - 1]),
-                                      firstCodepoint(words[currentIndex]), wordStyles[currentIndex - 1]);
-      }
+      const int spacing = isFirstWord ? 0 : gapBefore(currentIndex, renderer, font);
       const int candidateWidth = spacing + wordWidths[currentIndex];
 
       // Word fits on current line
@@ -321,7 +494,7 @@ std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& r
       const bool allowFallbackBreaks = isFirstWord;  // Only for first word on line
 
       if (availableWidth > 0 &&
-          hyphenateWordAtIndex(currentIndex, availableWidth, renderer, fontId, wordWidths, allowFallbackBreaks)) {
+          hyphenateWordAtIndex(currentIndex, availableWidth, renderer, font, wordWidths, allowFallbackBreaks)) {
         // Prefix now fits; append it to this line and move to next line
         lineWidth += spacing + wordWidths[currentIndex];
         ++currentIndex;
@@ -338,7 +511,7 @@ std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& r
 
     // Don't break before a continuation word (e.g., orphaned "?" after "question").
     // Backtrack to the start of the continuation group so the whole group moves to the next line.
-    while (currentIndex > lineStart + 1 && currentIndex < wordWidths.size() && continuesVec[currentIndex]) {
+    while (currentIndex > lineStart + 1 && currentIndex < wordWidths.size() && continues(currentIndex)) {
       --currentIndex;
     }
 
@@ -352,42 +525,58 @@ std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& r
 // Splits words[wordIndex] into prefix (adding a hyphen only when needed) and remainder when a legal breakpoint fits the
 // available width.
 bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availableWidth, const GfxRenderer& renderer,
-                                      const int fontId, std::vector<uint16_t>& wordWidths,
+                                      const FontHandle& font, std::vector<uint16_t>& wordWidths,
                                       const bool allowFallbackBreaks) {
   // Guard against invalid indices or zero available width before attempting to split.
   if (availableWidth <= 0 || wordIndex >= words.size()) {
     return false;
   }
 
-  const std::string& word = words[wordIndex];
-  const auto style = wordStyles[wordIndex];
-
-  // Collect candidate breakpoints (byte offsets and hyphen requirements).
-  auto breakInfos = Hyphenator::breakOffsets(word, allowFallbackBreaks);
-  if (breakInfos.empty()) {
-    return false;
-  }
+  const std::string_view word = wordText(wordIndex);
+  const auto style = words[wordIndex].style;
 
   size_t chosenOffset = 0;
   int chosenWidth = -1;
   bool chosenNeedsHyphen = true;
 
-  // Iterate over each legal breakpoint and retain the widest prefix that still fits.
-  for (const auto& info : breakInfos) {
-    const size_t offset = info.byteOffset;
+  // Called for each legal breakpoint in ascending order; retains the widest prefix that still fits.
+  const auto considerBreak = [&](const size_t offset, const bool needsHyphen) {
     if (offset == 0 || offset >= word.size()) {
-      continue;
+      return;
     }
 
-    const bool needsHyphen = info.requiresInsertedHyphen;
-    const int prefixWidth = measureWordWidth(renderer, fontId, word.substr(0, offset), style, needsHyphen);
+    const int prefixWidth = measureWordWidth(renderer, font, word.substr(0, offset), style, widthCache, needsHyphen);
     if (prefixWidth > availableWidth || prefixWidth <= chosenWidth) {
-      continue;  // Skip if too wide or not an improvement
+      return;  // Skip if too wide or not an improvement
     }
 
     chosenWidth = prefixWidth;
     chosenOffset = offset;
     chosenNeedsHyphen = needsHyphen;
+  };
+
+  // Collect candidate breakpoints (byte offsets and hyphen requirements), from the cache when the word was seen before.
+  const bool cacheable = hyphenationCache && HyphenationCache::fits(word);
+  const uint64_t cacheKey = cacheable ? HyphenationCache::makeKey(word, allowFallbackBreaks) : 0;
+  uint64_t breakMask = 0;
+  uint64_t hyphenMask = 0;
+  if (cacheable && hyphenationCache->lookup(cacheKey, breakMask, hyphenMask)) {
+    for (uint64_t bits = breakMask; bits != 0; bits &= bits - 1) {
+      const int offset = __builtin_ctzll(bits);
+      considerBreak(offset, (hyphenMask >> offset) & 1);
+    }
+  } else {
+    const auto breakInfos = Hyphenator::breakOffsets(std::string(word), allowFallbackBreaks);
+    for (const auto& info : breakInfos) {
+      considerBreak(info.byteOffset, info.requiresInsertedHyphen);
+      if (cacheable && info.byteOffset < HyphenationCache::MAX_WORD_BYTES) {
+        breakMask |= 1ull << info.byteOffset;
+        hyphenMask |= static_cast<uint64_t>(info.requiresInsertedHyphen) << info.byteOffset;
+      }
+    }
+    if (cacheable) {
+      hyphenationCache->store(cacheKey, breakMask, hyphenMask);
+    }
   }
 
   if (chosenWidth < 0) {
@@ -395,16 +584,15 @@ bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availabl
     return false;
   }
 
-  // Split the word at the selected breakpoint and append a hyphen if required.
-  std::string remainder = word.substr(chosenOffset);
-  words[wordIndex].resize(chosenOffset);
-  if (chosenNeedsHyphen) {
-    words[wordIndex].push_back('-');
-  }
-
-  // Insert the remainder word (with matching style and continuation flag) directly after the prefix.
-  words.insert(words.begin() + wordIndex + 1, remainder);
-  wordStyles.insert(wordStyles.begin() + wordIndex + 1, style);
+  // Split the word at the selected breakpoint, in the span table only: the prefix keeps the first chosenOffset bytes
+  // and gets a hyphen if required, the remainder takes the rest of the bytes (and a hyphen the whole word had).
+  Word& prefix = words[wordIndex];
+  Word remainder = prefix;
+  remainder.offset += chosenOffset;
+  remainder.length -= chosenOffset;
+  remainder.flags &= ~CONTINUES;
+  prefix.length = chosenOffset;
+  prefix.flags = (prefix.flags & ~HYPHENATED) | (chosenNeedsHyphen ? HYPHENATED : 0);
 
   // Continuation flag handling after splitting a word into prefix + remainder.
   //
@@ -425,20 +613,19 @@ bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availabl
   //
   // This lets the backtracking loop keep the entire prefix group ("200 Quadrat-") on one
   // line, while "kilometer" moves to the next line.
-  // wordContinues[wordIndex] is intentionally left unchanged — the prefix keeps its original attachment.
-  wordContinues.insert(wordContinues.begin() + wordIndex + 1, false);
+  // The prefix's CONTINUES flag is intentionally left unchanged — it keeps its original attachment.
+  words.insert(words.begin() + wordIndex + 1, remainder);
 
   // Update cached widths to reflect the new prefix/remainder pairing.
   wordWidths[wordIndex] = static_cast<uint16_t>(chosenWidth);
-  const uint16_t remainderWidth = measureWordWidth(renderer, fontId, remainder, style);
-  wordWidths.insert(wordWidths.begin() + wordIndex + 1, remainderWidth);
+  wordWidths.insert(wordWidths.begin() + wordIndex + 1, measureWord(wordIndex + 1, renderer, font));
   return true;
 }
 
 void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const std::vector<uint16_t>& wordWidths,
-                             const std::vector<bool>& continuesVec, const std::vector<size_t>& lineBreakIndices,
+                             const std::vector<size_t>& lineBreakIndices,
                              const std::function<void(std::shared_ptr<TextBlock>)>& processLine,
-                             const GfxRenderer& renderer, const int fontId) {
+                             const GfxRenderer& renderer, const FontHandle& font, const bool paragraphComplete) {
   const size_t lineBreak = lineBreakIndices[breakIndex];
   const size_t lastBreakAt = breakIndex > 0 ? lineBreakIndices[breakIndex - 1] : 0;
   const size_t lineWordCount = lineBreak - lastBreakAt;
@@ -447,7 +634,7 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
   // Positive text-indent (paragraph indent) is suppressed when extraParagraphSpacing is on.
   // Negative text-indent (hanging indent, e.g. margin-left:3em; text-indent:-1em) always applies —
   // it is structural (positions the bullet/marker), not decorative.
-  const bool isFirstLine = breakIndex == 0;
+  const bool isFirstLine = breakIndex == 0 && !linesEmitted;
   const int firstLineIndent =
       isFirstLine && blockStyle.textIndentDefined && (blockStyle.textIndent < 0 || !extraParagraphSpacing) &&
               (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left)
@@ -463,22 +650,17 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
   for (size_t wordIdx = 0; wordIdx < lineWordCount; wordIdx++) {
     lineWordWidthSum += wordWidths[lastBreakAt + wordIdx];
     // Count gaps: each word after the first creates a gap, unless it's a continuation
-    if (wordIdx > 0 && !continuesVec[lastBreakAt + wordIdx]) {
-      actualGapCount++;
-      totalNaturalGaps +=
-          renderer.getSpaceAdvance(fontId, lastCodepoint(words[lastBreakAt + wordIdx - 1]),
-                                   firstCodepoint(words[lastBreakAt + wordIdx]), wordStyles[lastBreakAt + wordIdx - 1]);
-    } else if (wordIdx > 0 && continuesVec[lastBreakAt + wordIdx]) {
-      // Cross-boundary kerning for continuation words (e.g. nonbreaking spaces, attached punctuation)
-      totalNaturalGaps +=
-          renderer.getKerning(fontId, lastCodepoint(words[lastBreakAt + wordIdx - 1]),
-                              firstCodepoint(words[lastBreakAt + wordIdx]), wordStyles[lastBreakAt + wordIdx - 1]);
+    if (wordIdx > 0) {
+      if (!continues(lastBreakAt + wordIdx)) {
+        actualGapCount++;
+      }
+      totalNaturalGaps += gapBefore(lastBreakAt + wordIdx, renderer, font);
     }
   }
 
   // Calculate spacing (account for indent reducing effective page width on first line)
   const int effectivePageWidth = pageWidth - firstLineIndent;
-  const bool isLastLine = breakIndex == lineBreakIndices.size() - 1;
+  const bool isLastLine = paragraphComplete && breakIndex == lineBreakIndices.size() - 1;
 
   // For justified text, compute per-gap extra to distribute remaining space evenly
   const int spareSpace = effectivePageWidth - lineWordWidthSum - totalNaturalGaps;
@@ -503,20 +685,14 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
   for (size_t wordIdx = 0; wordIdx < lineWordCount; wordIdx++) {
     lineXPos.push_back(xpos);
 
-    const bool nextIsContinuation = wordIdx + 1 < lineWordCount && continuesVec[lastBreakAt + wordIdx + 1];
+    const bool nextIsContinuation = wordIdx + 1 < lineWordCount && continues(lastBreakAt + wordIdx + 1);
     if (nextIsContinuation) {
-      int advance = wordWidths[lastBreakAt + wordIdx];
       // Cross-boundary kerning for continuation words (e.g. nonbreaking spaces, attached punctuation)
-      advance +=
-          renderer.getKerning(fontId, lastCodepoint(words[lastBreakAt + wordIdx]),
-                              firstCodepoint(words[lastBreakAt + wordIdx + 1]), wordStyles[lastBreakAt + wordIdx]);
-      xpos += advance;
+      xpos += wordWidths[lastBreakAt + wordIdx] + gapBefore(lastBreakAt + wordIdx + 1, renderer, font);
     } else {
       int gap = 0;
       if (wordIdx + 1 < lineWordCount) {
-        gap = renderer.getSpaceAdvance(fontId, lastCodepoint(words[lastBreakAt + wordIdx]),
-                                       firstCodepoint(words[lastBreakAt + wordIdx + 1]),
-                                       wordStyles[lastBreakAt + wordIdx]);
+        gap = gapBefore(lastBreakAt + wordIdx + 1, renderer, font);
       }
       if (blockStyle.alignment == CssTextAlign::Justify && !isLastLine) {
         gap += justifyExtra;
@@ -525,15 +701,18 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
     }
   }
 
-  // Build line data by moving from the original vectors using index range
-  std::vector<std::string> lineWords(std::make_move_iterator(words.begin() + lastBreakAt),
-                                     std::make_move_iterator(words.begin() + lineBreak));
-  std::vector<EpdFontFamily::Style> lineWordStyles(wordStyles.begin() + lastBreakAt, wordStyles.begin() + lineBreak);
-
-  for (auto& word : lineWords) {
-    if (containsSoftHyphen(word)) {
-      stripSoftHyphensInPlace(word);
+  // Copy the line's words out of the buffer as the strings TextBlock keeps, without soft hyphens
+  std::vector<std::string> lineWords(lineWordCount);
+  std::vector<EpdFontFamily::Style> lineWordStyles(lineWordCount);
+  for (size_t wordIdx = 0; wordIdx < lineWordCount; wordIdx++) {
+    const Word& word = words[lastBreakAt + wordIdx];
+    std::string& text = lineWords[wordIdx];
+    text.resize(word.length + 1);
+    text.resize(copyWithoutSoftHyphens(wordText(lastBreakAt + wordIdx), &text[0]));
+    if (word.flags & HYPHENATED) {
+      text.push_back('-');
     }
+    lineWordStyles[wordIdx] = word.style;
   }
 
   processLine(
@@ -1,49 +1,95 @@
 #pragma once
 
 #include <EpdFontFamily.h>
+#include <FontTable.h>
 
 #include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "blocks/BlockStyle.h"
 #include "blocks/TextBlock.h"
 
 class GfxRenderer;
+class HyphenationCache;
+class WordWidthCache;
 
+/**
+ * The words of a paragraph, buffered until they are laid out into lines. Their bytes live back to back in one buffer,
+ * indexed by a table of spans, so adding a word and splitting one at a hyphenation point only append to the buffer
+ * and edit the table. Both keep their capacity as lines are consumed, and a paragraph streamed through them reuses it.
+ */
 class ParsedText {
-  std::vector<std::string> words;
-  std::vector<EpdFontFamily::Style> wordStyles;
-  std::vector<bool> wordContinues;  // true = word attaches to previous (no space before it)
+  // A word's span of wordBytes. Words are stored in order and the first starts at offset 0; a word added whole is
+  // followed by a NUL, while the prefix of a split word runs straight into its remainder.
+  struct Word {
+    uint32_t offset;
+    uint16_t length;
+    EpdFontFamily::Style style;
+    uint8_t flags;
+  };
+  static constexpr uint8_t CONTINUES = 1;   // Attaches to the previous word, with no space before it
+  static constexpr uint8_t HYPHENATED = 2;  // The prefix of a split word, shown with a hyphen after it
+
+  std::string wordBytes;
+  std::vector<Word> words;
   BlockStyle blockStyle;
   bool extraParagraphSpacing;
   bool hyphenationEnabled;
+  WordWidthCache* widthCache;  // Optional, shared by the paragraphs of a section
+  HyphenationCache* hyphenationCache;  // Optional, likewise
+  bool indentApplied = false;
+  bool linesEmitted = false;  // The first line has been laid out, so the words left start a later line
+
+  std::string_view wordText(const size_t index) const {
+    return {wordBytes.data() + words[index].offset, words[index].length};
+  }
+  bool continues(const size_t index) const { return words[index].flags & CONTINUES; }
+  // Gap before word index on a line: a space, or only kerning when the word attaches to the one before
+  int gapBefore(size_t index, const GfxRenderer& renderer, const FontHandle& font) const;
+  uint16_t measureWord(size_t index, const GfxRenderer& renderer, const FontHandle& font) const;
 
   void applyParagraphIndent();
-  std::vector<size_t> computeLineBreaks(const GfxRenderer& renderer, int fontId, int pageWidth,
-                                        std::vector<uint16_t>& wordWidths, std::vector<bool>& continuesVec);
-  std::vector<size_t> computeHyphenatedLineBreaks(const GfxRenderer& renderer, int fontId, int pageWidth,
-                                                  std::vector<uint16_t>& wordWidths, std::vector<bool>& continuesVec);
-  bool hyphenateWordAtIndex(size_t wordIndex, int availableWidth, const GfxRenderer& renderer, int fontId,
+  // Drops the first count words and their bytes
+  void consumeWords(size_t count);
+  std::vector<size_t> computeLineBreaks(const GfxRenderer& renderer, const FontHandle& font, int pageWidth,
+                                        std::vector<uint16_t>& wordWidths, bool paragraphComplete);
+  std::vector<size_t> computeHyphenatedLineBreaks(const GfxRenderer& renderer, const FontHandle& font, int pageWidth,
+                                                  std::vector<uint16_t>& wordWidths);
+  bool hyphenateWordAtIndex(size_t wordIndex, int availableWidth, const GfxRenderer& renderer, const FontHandle& font,
                             std::vector<uint16_t>& wordWidths, bool allowFallbackBreaks);
   void extractLine(size_t breakIndex, int pageWidth, const std::vector<uint16_t>& wordWidths,
-                   const std::vector<bool>& continuesVec, const std::vector<size_t>& lineBreakIndices,
+                   const std::vector<size_t>& lineBreakIndices,
                    const std::function<void(std::shared_ptr<TextBlock>)>& processLine, const GfxRenderer& renderer,
-                   int fontId);
-  std::vector<uint16_t> calculateWordWidths(const GfxRenderer& renderer, int fontId);
+                   const FontHandle& font, bool paragraphComplete);
+  std::vector<uint16_t> calculateWordWidths(const GfxRenderer& renderer, const FontHandle& font);
 
  public:
   explicit ParsedText(const bool extraParagraphSpacing, const bool hyphenationEnabled = false,
-                      const BlockStyle& blockStyle = BlockStyle())
-      : blockStyle(blockStyle), extraParagraphSpacing(extraParagraphSpacing), hyphenationEnabled(hyphenationEnabled) {}
+                      const BlockStyle& blockStyle = BlockStyle(), WordWidthCache* widthCache = nullptr,
+                      HyphenationCache* hyphenationCache = nullptr)
+      : blockStyle(blockStyle),
+        extraParagraphSpacing(extraParagraphSpacing),
+        hyphenationEnabled(hyphenationEnabled),
+        widthCache(widthCache),
+        hyphenationCache(hyphenationCache) {}
   ~ParsedText() = default;
 
-  void addWord(std::string word, EpdFontFamily::Style fontStyle, bool underline = false, bool attachToPrevious = false);
+  void addWord(std::string_view word, EpdFontFamily::Style fontStyle, bool underline = false,
+               bool attachToPrevious = false);
   void setBlockStyle(const BlockStyle& blockStyle) { this->blockStyle = blockStyle; }
   BlockStyle& getBlockStyle() { return blockStyle; }
   size_t size() const { return words.size(); }
   bool isEmpty() const { return words.empty(); }
+  // Moves the words of other to the end of this paragraph
+  void append(ParsedText&& other);
+  // Width of the widest word (the narrowest the words can be set without splitting one) and of all the words set on
+  // one line, for sizing table columns
+  void measureContentWidths(const GfxRenderer& renderer, int fontId, int& minWidth, int& maxWidth);
+  // Lays out the buffered words, emits the lines and drops their words. With includeLastLine false the paragraph
+  // continues: only lines that words added later can no longer change are emitted.
   void layoutAndExtractLines(const GfxRenderer& renderer, int fontId, uint16_t viewportWidth,
                              const std::function<void(std::shared_ptr<TextBlock>)>& processLine,
                              bool includeLastLine = true);
@@ -0,0 +1,338 @@
+#include "SearchIndex.h"
+
+#include <Arduino.h>
+#include <Logging.h>
+#include <Print.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <deque>
+
+#include "../Epub.h"
+#include "Page.h"
+
+namespace {
+constexpr uint32_t FNV_OFFSET = 2166136261u;
+constexpr uint32_t FNV_PRIME = 16777619u;
+constexpr uint32_t FILTER_BITS = SearchIndex::FILTER_SIZE * 8;
+constexpr int BITS_PER_WORD = 3;
+// Words shown before and after the phrase in a snippet
+constexpr size_t SNIPPET_BEFORE = 3;
+constexpr size_t SNIPPET_AFTER = 5;
+
+// Length of the punctuation character at s, 0 if it starts a letter or digit: ASCII punctuation, the quotes, dashes
+// and ellipsis of U+2010-U+2026, and the Latin-1 guillemets and inverted marks
+size_t punctuationLength(const char* s, const size_t length) {
+  const auto c = static_cast<uint8_t>(s[0]);
+  if (c < 0x80) {
+    return isalnum(c) ? 0 : 1;
+  }
+  if (c == 0xE2 && length >= 3 && static_cast<uint8_t>(s[1]) == 0x80 && static_cast<uint8_t>(s[2]) >= 0x90 &&
+      static_cast<uint8_t>(s[2]) <= 0xA6) {
+    return 3;
+  }
+  if (c == 0xC2 && length >= 2) {
+    const auto next = static_cast<uint8_t>(s[1]);
+    return next == 0xAB || next == 0xBB || next == 0xA1 || next == 0xBF ? 2 : 0;
+  }
+  return 0;
+}
+
+// The word as it is compared: punctuation trimmed from both ends, ASCII lowercased and typographic apostrophes
+// straightened, so "Don’t," matches don't
+std::string normalize(const char* word, size_t length) {
+  size_t start = 0;
+  while (start < length) {
+    const size_t skip = punctuationLength(word + start, length - start);
+    if (skip == 0) {
+      break;
+    }
+    start += skip;
+  }
+  while (length > start) {
+    if (static_cast<uint8_t>(word[length - 1]) < 0x80) {
+      if (isalnum(static_cast<uint8_t>(word[length - 1]))) {
+        break;
+      }
+      length--;
+    } else if (length - start >= 3 && punctuationLength(word + length - 3, 3) == 3) {
+      length -= 3;
+    } else if (length - start >= 2 && punctuationLength(word + length - 2, 2) == 2) {
+      length -= 2;
+    } else {
+      break;
+    }
+  }
+
+  std::string normalized;
+  normalized.reserve(length - start);
+  for (size_t i = start; i < length; i++) {
+    const auto c = static_cast<uint8_t>(word[i]);
+    if (c == 0xE2 && i + 2 < length && static_cast<uint8_t>(word[i + 1]) == 0x80 &&
+        static_cast<uint8_t>(word[i + 2]) == 0x99) {
+      normalized += '\'';
+      i += 2;
+    } else {
+      normalized += static_cast<char>(tolower(c));
+    }
+  }
+  return normalized;
+}
+
+std::string normalize(const char* word) { return normalize(word, strlen(word)); }
+
+uint32_t hashWord(const std::string& word) {
+  uint32_t hash = FNV_OFFSET;
+  for (const char c : word) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= FNV_PRIME;
+  }
+  return hash;
+}
+
+// Calls fn(bit) for the bits of a word in a filter, derived from one hash by double hashing
+template <typename Fn>
+void forEachBit(const std::string& word, Fn&& fn) {
+  const uint32_t hash = hashWord(word);
+  const uint32_t step = (hash >> 17 | hash << 15) | 1;
+  for (int i = 0; i < BITS_PER_WORD; i++) {
+    fn((hash + i * step) % FILTER_BITS);
+  }
+}
+
+void appendWord(std::string& snippet, const std::string& word) {
+  if (!snippet.empty()) {
+    snippet += ' ';
+  }
+  snippet += word;
+}
+
+// Looks for the phrase in text streamed into it, without parsing it as XML: tags and entities separate words, the
+// text of the head is skipped. Comments and other <! and <? constructs end at their first '>'.
+class PhraseScanner final : public Print {
+  enum State : uint8_t { TEXT, TAG, ENTITY };
+
+  const std::vector<std::string>& terms;
+  const int spineIndex;
+  const size_t maxMatches;
+  std::vector<SearchMatch>& matches;
+
+  State state = TEXT;
+  uint32_t position = 0;
+  std::string word;
+  uint32_t wordStart = 0;
+  // Up to 6 characters of the tag's name, enough to tell <head> and </head> from the rest
+  char tagName[6] = {};
+  uint8_t tagNameLength = 0;
+  bool tagNameDone = false;
+  bool inHead = false;
+  // Terms matched by the last words, and the offset of the first of them
+  size_t matched = 0;
+  uint32_t matchStart = 0;
+  // The last words as written, for the snippet
+  std::deque<std::string> recent;
+  size_t wordsAfter = 0;
+
+  bool tagIs(const char* name) const {
+    return tagNameLength == strlen(name) && strncmp(tagName, name, tagNameLength) == 0;
+  }
+
+  void endWord() {
+    if (word.empty()) {
+      return;
+    }
+    const std::string normalized = normalize(word.c_str(), word.size());
+    if (wordsAfter > 0) {
+      appendWord(matches.back().snippet, word);
+      wordsAfter--;
+    }
+    recent.push_back(word);
+    if (recent.size() > SNIPPET_BEFORE + terms.size()) {
+      recent.pop_front();
+    }
+    word.clear();
+    if (normalized.empty()) {
+      return;
+    }
+
+    if (normalized != terms[matched]) {
+      matched = 0;
+    }
+    if (normalized == terms[matched]) {
+      if (matched == 0) {
+        matchStart = wordStart;
+      }
+      matched++;
+    }
+    if (matched == terms.size()) {
+      if (matches.size() < maxMatches) {
+        SearchMatch match{spineIndex, -1, static_cast<int32_t>(matchStart), ""};
+        for (const auto& shown : recent) {
+          appendWord(match.snippet, shown);
+        }
+        matches.push_back(std::move(match));
+        wordsAfter = SNIPPET_AFTER;
+      }
+      matched = 0;
+    }
+  }
+
+  void scan(const char c) {
+    const bool space = c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    switch (state) {
+      case TEXT:
+        if (c == '<') {
+          endWord();
+          state = TAG;
+          tagNameLength = 0;
+          tagNameDone = false;
+        } else if (c == '&') {
+          endWord();
+          state = ENTITY;
+        } else if (inHead) {
+          break;
+        } else if (space) {
+          endWord();
+        } else {
+          if (word.empty()) {
+            wordStart = position;
+          }
+          word += c;
+        }
+        break;
+      case TAG:
+        if (c == '>') {
+          if (tagIs("head")) {
+            inHead = true;
+          } else if (tagIs("/head")) {
+            inHead = false;
+          }
+          state = TEXT;
+        } else if (space) {
+          tagNameDone = true;
+        } else if (!tagNameDone) {
+          if (tagNameLength < sizeof(tagName)) {
+            tagName[tagNameLength++] = c;
+          } else {
+            tagNameDone = true;
+          }
+        }
+        break;
+      case ENTITY:
+        if (c == ';' || space || c == '<') {
+          state = TEXT;
+          if (c == '<') {
+            scan(c);
+          }
+        }
+        break;
+    }
+  }
+
+ public:
+  PhraseScanner(const std::vector<std::string>& terms, const int spineIndex, const size_t maxMatches,
+                std::vector<SearchMatch>& matches)
+      : terms(terms), spineIndex(spineIndex), maxMatches(maxMatches), matches(matches) {}
+
+  size_t write(const uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* buffer, const size_t size) override {
+    for (size_t i = 0; i < size; i++) {
+      scan(static_cast<char>(buffer[i]));
+      position++;
+    }
+    return size;
+  }
+
+  void finish() { endWord(); }
+};
+}  // namespace
+
+std::vector<std::string> SearchIndex::terms(const std::string& query) {
+  std::vector<std::string> result;
+  size_t start = 0;
+  while (start < query.size()) {
+    size_t end = query.find(' ', start);
+    if (end == std::string::npos) {
+      end = query.size();
+    }
+    std::string term = normalize(query.c_str() + start, end - start);
+    if (!term.empty()) {
+      result.push_back(std::move(term));
+    }
+    start = end + 1;
+  }
+  return result;
+}
+
+void SearchIndex::addPage(const Page& page, uint8_t* filter) {
+  page.forEachWord([filter](const char* word) {
+    const std::string normalized = normalize(word);
+    if (normalized.empty()) {
+      return;
+    }
+    forEachBit(normalized, [filter](const uint32_t bit) { filter[bit / 8] |= 1 << (bit % 8); });
+  });
+}
+
+bool SearchIndex::mayContain(const uint8_t* filter, const std::vector<std::string>& terms) {
+  for (const auto& term : terms) {
+    bool present = true;
+    forEachBit(term, [filter, &present](const uint32_t bit) { present &= (filter[bit / 8] >> (bit % 8)) & 1; });
+    if (!present) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool SearchIndex::findOnPage(const Page& page, const std::vector<std::string>& terms, const int spineIndex,
+                             const int pageIndex, std::vector<SearchMatch>& matches) {
+  std::vector<const char*> words;
+  page.forEachWord([&words](const char* word) { words.push_back(word); });
+
+  for (size_t first = 0; first < words.size(); first++) {
+    size_t matched = 0;
+    size_t next = first;
+    while (matched < terms.size() && next < words.size()) {
+      const std::string normalized = normalize(words[next++]);
+      if (normalized.empty() && matched > 0) {
+        // A word of punctuation only, e.g. a dash between spaces
+        continue;
+      }
+      if (normalized != terms[matched]) {
+        break;
+      }
+      matched++;
+    }
+    if (matched == terms.size()) {
+      SearchMatch match{spineIndex, pageIndex, -1, ""};
+      const size_t from = first > SNIPPET_BEFORE ? first - SNIPPET_BEFORE : 0;
+      const size_t to = std::min(words.size(), next + SNIPPET_AFTER);
+      for (size_t i = from; i < to; i++) {
+        appendWord(match.snippet, words[i]);
+      }
+      matches.push_back(std::move(match));
+      return true;
+    }
+  }
+  return false;
+}
+
+bool SearchIndex::scanMarkup(const Epub& epub, const int spineIndex, const std::vector<std::string>& terms,
+                             const size_t maxMatches, std::vector<SearchMatch>& matches) {
+  if (terms.empty()) {
+    return true;
+  }
+  const auto start = millis();
+  const size_t before = matches.size();
+  PhraseScanner scanner(terms, spineIndex, maxMatches, matches);
+  if (!epub.readItemContentsToStream(epub.getSpineItem(spineIndex).href, scanner, 1024)) {
+    LOG_ERR("SRC", "Failed to read spine item %d", spineIndex);
+    return false;
+  }
+  scanner.finish();
+  LOG_DBG("SRC", "Scanned spine item %d in %lu ms, %zu matches", spineIndex, millis() - start,
+          matches.size() - before);
+  return true;
+}
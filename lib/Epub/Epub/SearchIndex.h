@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Epub;
+class Page;
+
+// Section builds write a search index along with the section file unless the build turns it off
+#ifndef SECTION_SEARCH_INDEX
+#define SECTION_SEARCH_INDEX 1
+#endif
+
+// A place in the book showing the phrase searched for
+struct SearchMatch {
+  int spineIndex;
+  // Page in the section file, -1 for a match found in the markup of a chapter not laid out yet
+  int page;
+  // Byte offset of the match in the spine item's XHTML, -1 for a match on a laid out page
+  int32_t sourceOffset;
+  // The phrase with a few words around it
+  std::string snippet;
+};
+
+/**
+ * Searching a book for a phrase without laying it out or inflating its XHTML again.
+ *
+ * While Section lays out a chapter it adds the words of every page to a Bloom filter, kept in N.srch next to the
+ * section file N.bin (sections/<layout>/):
+ * - uint8_t version
+ * - FILTER_SIZE bytes per page, in page order
+ * A query reads the filters in one pass and only loads the pages whose filter has every word of the phrase, to
+ * confirm it on the page. Words are compared without the punctuation around them and, for ASCII, without case; a
+ * phrase split across pages or a word hyphenated across lines is not found.
+ *
+ * Chapters without a complete section file are scanned in their markup instead (scanMarkup()), which finds the byte
+ * offset of each match; the reader goes to it like to a synced position (see Section::getPageForSourceOffset()).
+ */
+class SearchIndex {
+ public:
+  static constexpr uint8_t VERSION = 1;
+  // 2048 bits: with 3 bits per word, a page of 300 distinct words lets through about 5% of the words not on it
+  static constexpr size_t FILTER_SIZE = 256;
+
+  // The words of a query as they are compared, empty if it has none
+  static std::vector<std::string> terms(const std::string& query);
+  // Sets the bits of the words of a page in its filter
+  static void addPage(const Page& page, uint8_t* filter);
+  // False if the page of the filter can't have every term; true may be a false positive
+  static bool mayContain(const uint8_t* filter, const std::vector<std::string>& terms);
+  // Appends a match if the words of the page hold the terms in a row
+  static bool findOnPage(const Page& page, const std::vector<std::string>& terms, int spineIndex, int pageIndex,
+                         std::vector<SearchMatch>& matches);
+  // Appends the matches in the markup of a spine item, up to maxMatches in all; false if it can't be read
+  static bool scanMarkup(const Epub& epub, int spineIndex, const std::vector<std::string>& terms, size_t maxMatches,
+                         std::vector<SearchMatch>& matches);
+};
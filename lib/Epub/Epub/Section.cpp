@@ -1,29 +1,409 @@
 #include "Section.h"
 
+#include <FsHelpers.h>
 #include <HalStorage.h>
 #include <Logging.h>
 #include <Serialization.h>
 
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+
+#include "BookPageCounts.h"
 #include "Epub/css/CssParser.h"
+#include "ImagePack.h"
 #include "Page.h"
+#include "PageCache.h"
+#include "SearchIndex.h"
 #include "hyphenation/Hyphenator.h"
 #include "parsers/ChapterHtmlSlimParser.h"
 
 namespace {
-constexpr uint8_t SECTION_FILE_VERSION = 19;
+constexpr uint8_t SECTION_FILE_VERSION = 27;
 constexpr uint32_t HEADER_SIZE = sizeof(uint8_t) + sizeof(int) + sizeof(float) + sizeof(bool) + sizeof(uint8_t) +
                                  sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(bool) + sizeof(bool) +
                                  sizeof(uint8_t) + sizeof(uint32_t) + sizeof(uint32_t);
+
+// FNV-1a of an anchor id, the key of the anchor map
+uint32_t hashAnchor(const std::string& anchor) {
+  uint32_t hash = 2166136261u;
+  for (const char c : anchor) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+// Anchor map entry: anchor hash, page, offset of the anchor id from the start of the map
+constexpr uint32_t ANCHOR_ENTRY_SIZE = sizeof(uint32_t) + sizeof(uint16_t) + sizeof(uint32_t);
+
+// A section file comes out at two to three and a half times its chapter's XHTML; what is reserved past the end is
+// released when the build completes
+constexpr uint32_t SECTION_SIZE_PER_SOURCE_BYTE = 3;
+
+// Whether the length-prefixed anchor id at offset is anchor, compared in pieces without allocating
+bool anchorNameEquals(FsFile& f, const uint32_t offset, const std::string& anchor) {
+  f.seek(offset);
+  uint32_t length;
+  serialization::readPod(f, length);
+  if (length != anchor.size()) {
+    return false;
+  }
+  char buffer[32];
+  for (size_t done = 0; done < length;) {
+    const size_t chunk = std::min(sizeof(buffer), length - done);
+    if (f.read(buffer, chunk) != static_cast<int>(chunk) || memcmp(buffer, anchor.data() + done, chunk) != 0) {
+      return false;
+    }
+    done += chunk;
+  }
+  return true;
+}
+
+// Identifies the header parameters a section file was laid out with, for keying cached pages
+uint32_t computeLayoutStamp(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
+                            const uint8_t paragraphAlignment, const uint16_t viewportWidth,
+                            const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle,
+                            const uint8_t imageRendering) {
+  uint32_t hash = 2166136261u;
+  serialization::hashPod(hash, SECTION_FILE_VERSION);
+  serialization::hashPod(hash, fontId);
+  serialization::hashPod(hash, lineCompression);
+  serialization::hashPod(hash, extraParagraphSpacing);
+  serialization::hashPod(hash, paragraphAlignment);
+  serialization::hashPod(hash, viewportWidth);
+  serialization::hashPod(hash, viewportHeight);
+  serialization::hashPod(hash, hyphenationEnabled);
+  serialization::hashPod(hash, embeddedStyle);
+  serialization::hashPod(hash, imageRendering);
+  return hash;
+}
+
+// Layouts whose section files a book keeps; using one more drops the least recently used
+constexpr size_t MAX_LAYOUTS = 3;
+constexpr uint8_t LAYOUTS_FILE_VERSION = 1;
+
+std::string layoutDir(const std::string& sectionsDir, const uint32_t stamp) {
+  char name[9];
+  snprintf(name, sizeof(name), "%08x", static_cast<unsigned>(stamp));
+  return sectionsDir + "/" + name;
+}
+
+// Books cached before layouts had directories of their own have their section files straight in sections/
+void removeFlatSectionFiles(const std::string& sectionsDir) {
+  auto dir = Storage.open(sectionsDir.c_str());
+  if (!dir || !dir.isDirectory()) {
+    return;
+  }
+  std::vector<std::string> names;
+  char name[32];
+  for (auto file = dir.openNextFile(); file; file = dir.openNextFile()) {
+    if (!file.isDirectory()) {
+      file.getName(name, sizeof(name));
+      names.emplace_back(name);
+    }
+  }
+  dir.close();
+  for (const auto& fileName : names) {
+    Storage.remove((sectionsDir + "/" + fileName).c_str());
+  }
+}
+
+// sections/layouts.bin lists the stamps of the layout directories under sections/, most recently used first. Moves
+// stamp to the front, removing the directories of the layouts that drop off the end of the list.
+void useLayout(const std::string& sectionsDir, const uint32_t stamp) {
+  const std::string listPath = sectionsDir + "/layouts.bin";
+  std::vector<uint32_t> stamps;
+  FsFile f;
+  if (Storage.exists(listPath.c_str()) && Storage.openFileForRead("SCT", listPath, f)) {
+    uint8_t version = 0;
+    uint8_t count = 0;
+    serialization::readPod(f, version);
+    serialization::readPod(f, count);
+    if (version == LAYOUTS_FILE_VERSION) {
+      stamps.resize(std::min<size_t>(count, MAX_LAYOUTS));
+      for (uint32_t& entry : stamps) {
+        serialization::readPod(f, entry);
+      }
+    }
+    f.close();
+  } else {
+    removeFlatSectionFiles(sectionsDir);
+  }
+  if (!stamps.empty() && stamps.front() == stamp) {
+    return;
+  }
+
+  stamps.erase(std::remove(stamps.begin(), stamps.end(), stamp), stamps.end());
+  stamps.insert(stamps.begin(), stamp);
+  while (stamps.size() > MAX_LAYOUTS) {
+    LOG_DBG("SCT", "Removing sections of layout %08x", static_cast<unsigned>(stamps.back()));
+    Storage.discardDir(layoutDir(sectionsDir, stamps.back()).c_str());
+    stamps.pop_back();
+  }
+  Storage.mkdir(layoutDir(sectionsDir, stamp).c_str());
+  if (!Storage.openFileForWrite("SCT", listPath, f)) {
+    return;
+  }
+  serialization::writePod(f, LAYOUTS_FILE_VERSION);
+  serialization::writePod(f, static_cast<uint8_t>(stamps.size()));
+  for (const uint32_t entry : stamps) {
+    serialization::writePod(f, entry);
+  }
+}
+
+// Checkpoint file (N.ckpt) written next to an incomplete section file when a build is aborted:
+// version, end of the last complete page in the .bin, parser checkpoint, LUT of the pages written so far, anchors,
+// page source offsets, the partially filled page.
+bool saveCheckpoint(const std::string& path, ChapterHtmlSlimParser::Checkpoint& checkpoint,
+                    const std::vector<uint32_t>& lut, const uint32_t pagesEnd) {
+  if (lut.size() != checkpoint.completedPageCount) {
+    LOG_ERR("SCT", "Checkpoint page count mismatch (%u vs %u)", lut.size(), checkpoint.completedPageCount);
+    return false;
+  }
+
+  FsFile f;
+  if (!Storage.openFileForWrite("SCT", path, f)) {
+    return false;
+  }
+  BufferedFileWriter writer(f);
+  serialization::writePod(writer, SECTION_FILE_VERSION);
+  serialization::writePod(writer, pagesEnd);
+  serialization::writePod(writer, checkpoint.byteOffset);
+  serialization::writePod(writer, checkpoint.currentPageNextY);
+  serialization::writePod(writer, checkpoint.nextBlockStyle);
+  serialization::writePod(writer, checkpoint.completedPageCount);
+  for (const uint32_t pos : lut) {
+    serialization::writePod(writer, pos);
+  }
+  serialization::writePod(writer, static_cast<uint16_t>(checkpoint.anchors.size()));
+  for (const auto& [anchor, page] : checkpoint.anchors) {
+    serialization::writeString(writer, anchor);
+    serialization::writePod(writer, page);
+  }
+  serialization::writePod(writer, static_cast<uint16_t>(checkpoint.pageOffsets.size()));
+  for (const uint32_t offset : checkpoint.pageOffsets) {
+    serialization::writePod(writer, offset);
+  }
+  const bool hasPage = checkpoint.currentPage != nullptr;
+  serialization::writePod(writer, hasPage);
+  if (hasPage && !checkpoint.currentPage->serialize(writer)) {
+    LOG_ERR("SCT", "Failed to serialize checkpoint page");
+    f.close();
+    Storage.remove(path.c_str());
+    return false;
+  }
+  if (!writer.flush()) {
+    LOG_ERR("SCT", "Failed to write checkpoint");
+    f.close();
+    Storage.remove(path.c_str());
+    return false;
+  }
+  return true;
+}
+
+// Reads the checkpoint up to and including the LUT, which is all that's needed to show the pages built so far
+bool readCheckpointPages(BufferedFileReader& reader, const uint32_t binSize,
+                         ChapterHtmlSlimParser::Checkpoint& checkpoint, std::vector<uint32_t>& lut,
+                         uint32_t& pagesEnd) {
+  uint8_t version;
+  serialization::readPod(reader, version);
+  serialization::readPod(reader, pagesEnd);
+  if (version != SECTION_FILE_VERSION || pagesEnd < HEADER_SIZE || pagesEnd > binSize) {
+    LOG_DBG("SCT", "Ignoring stale checkpoint");
+    return false;
+  }
+  serialization::readPod(reader, checkpoint.byteOffset);
+  serialization::readPod(reader, checkpoint.currentPageNextY);
+  serialization::readPod(reader, checkpoint.nextBlockStyle);
+  serialization::readPod(reader, checkpoint.completedPageCount);
+  lut.resize(checkpoint.completedPageCount);
+  for (uint32_t& pos : lut) {
+    serialization::readPod(reader, pos);
+  }
+  return true;
+}
+
+bool loadCheckpoint(const std::string& path, const uint32_t binSize, ChapterHtmlSlimParser::Checkpoint& checkpoint,
+                    std::vector<uint32_t>& lut, uint32_t& pagesEnd) {
+  FsFile f;
+  if (!Storage.openFileForRead("SCT", path, f)) {
+    return false;
+  }
+  BufferedFileReader reader(f, 1024);
+  if (!readCheckpointPages(reader, binSize, checkpoint, lut, pagesEnd)) {
+    return false;
+  }
+
+  uint16_t anchorCount;
+  serialization::readPod(reader, anchorCount);
+  checkpoint.anchors.resize(anchorCount);
+  for (auto& [anchor, page] : checkpoint.anchors) {
+    serialization::readString(reader, anchor);
+    serialization::readPod(reader, page);
+  }
+  uint16_t offsetCount;
+  serialization::readPod(reader, offsetCount);
+  checkpoint.pageOffsets.resize(offsetCount);
+  for (uint32_t& offset : checkpoint.pageOffsets) {
+    serialization::readPod(reader, offset);
+  }
+  bool hasPage;
+  serialization::readPod(reader, hasPage);
+  if (hasPage) {
+    checkpoint.currentPage = Page::deserialize(reader);
+    if (!checkpoint.currentPage) {
+      LOG_ERR("SCT", "Failed to deserialize checkpoint page");
+      return false;
+    }
+  }
+  return true;
+}
+
+// Page of an anchor among those of the pages laid out before a build was paused
+std::optional<uint16_t> findCheckpointAnchor(const std::string& path, const uint32_t binSize,
+                                             const std::string& anchor) {
+  FsFile f;
+  ChapterHtmlSlimParser::Checkpoint checkpoint;
+  std::vector<uint32_t> lut;
+  uint32_t pagesEnd;
+  if (!Storage.openFileForRead("SCT", path, f)) {
+    return std::nullopt;
+  }
+  BufferedFileReader reader(f, 1024);
+  if (!readCheckpointPages(reader, binSize, checkpoint, lut, pagesEnd)) {
+    return std::nullopt;
+  }
+  uint16_t anchorCount;
+  serialization::readPod(reader, anchorCount);
+  std::string key;
+  for (uint16_t i = 0; i < anchorCount; i++) {
+    uint16_t page;
+    serialization::readString(reader, key);
+    serialization::readPod(reader, page);
+    if (key == anchor) {
+      return page;
+    }
+  }
+  return std::nullopt;
+}
+
+// Among the pages of an incomplete build: the last one starting at or before a source offset
+std::optional<uint16_t> findCheckpointPage(const std::string& path, const uint32_t binSize, const uint32_t offset) {
+  FsFile f;
+  ChapterHtmlSlimParser::Checkpoint checkpoint;
+  std::vector<uint32_t> lut;
+  uint32_t pagesEnd;
+  if (!Storage.openFileForRead("SCT", path, f)) {
+    return std::nullopt;
+  }
+  BufferedFileReader reader(f, 1024);
+  if (!readCheckpointPages(reader, binSize, checkpoint, lut, pagesEnd) || lut.empty()) {
+    return std::nullopt;
+  }
+  uint16_t anchorCount;
+  serialization::readPod(reader, anchorCount);
+  std::string key;
+  uint16_t anchorPage;
+  for (uint16_t i = 0; i < anchorCount; i++) {
+    serialization::readString(reader, key);
+    serialization::readPod(reader, anchorPage);
+  }
+  uint16_t offsetCount;
+  serialization::readPod(reader, offsetCount);
+  // The last offset can belong to the partially filled page
+  const uint16_t count = std::min<uint16_t>(offsetCount, lut.size());
+  uint16_t page = 0;
+  for (uint16_t i = 0; i < count; i++) {
+    uint32_t pageOffset;
+    serialization::readPod(reader, pageOffset);
+    if (pageOffset > offset) {
+      break;
+    }
+    page = i;
+  }
+  return page;
+}
+
+// Value of attribute name in the text of one tag, empty if absent
+std::string tagAttribute(const std::string& tag, const char* name) {
+  const size_t nameLen = strlen(name);
+  for (size_t at = tag.find(name); at != std::string::npos; at = tag.find(name, at + nameLen)) {
+    size_t i = at + nameLen;
+    if (at == 0 || !isspace(static_cast<unsigned char>(tag[at - 1]))) continue;
+    while (i < tag.size() && isspace(static_cast<unsigned char>(tag[i]))) i++;
+    if (i >= tag.size() || tag[i] != '=') continue;
+    i++;
+    while (i < tag.size() && isspace(static_cast<unsigned char>(tag[i]))) i++;
+    if (i >= tag.size() || (tag[i] != '"' && tag[i] != '\'')) continue;
+    const size_t end = tag.find(tag[i], i + 1);
+    return end == std::string::npos ? std::string{} : tag.substr(i + 1, end - i - 1);
+  }
+  return {};
+}
+
+// Stylesheets linked from a chapter's <head>, in document order, as paths in the EPUB. Only the head is read, so
+// this is a few KB of the chapter at most.
+template <typename Source>
+std::vector<std::string> findLinkedStylesheets(Source& source, const std::string& contentBase) {
+  constexpr size_t MAX_HEAD_SIZE = 16 * 1024;
+  std::string head;
+  char chunk[512];
+  size_t bodyAt = std::string::npos;
+  while (head.size() < MAX_HEAD_SIZE && bodyAt == std::string::npos) {
+    const int n = source.read(chunk, sizeof(chunk));
+    if (n <= 0) break;
+    // Back up so that a "<body" split across chunks is found
+    const size_t from = head.size() > 4 ? head.size() - 4 : 0;
+    head.append(chunk, n);
+    bodyAt = head.find("<body", from);
+  }
+  if (bodyAt != std::string::npos) {
+    head.resize(bodyAt);
+  }
+
+  std::vector<std::string> stylesheets;
+  for (size_t at = head.find("<link"); at != std::string::npos; at = head.find("<link", at + 5)) {
+    const size_t end = head.find('>', at);
+    if (end == std::string::npos) break;
+    const std::string tag = head.substr(at, end - at);
+    const std::string rel = tagAttribute(tag, "rel");
+    std::string href = tagAttribute(tag, "href");
+    if (rel.find("stylesheet") == std::string::npos || rel.find("alternate") != std::string::npos || href.empty() ||
+        href.find("://") != std::string::npos) {
+      continue;
+    }
+    href = href.substr(0, href.find_first_of("?#"));
+    std::string path = FsHelpers::normalisePath(href[0] == '/' ? href.substr(1) : contentBase + href);
+    if (std::find(stylesheets.begin(), stylesheets.end(), path) == stylesheets.end()) {
+      stylesheets.push_back(std::move(path));
+    }
+  }
+  return stylesheets;
+}
 }  // namespace
 
-uint32_t Section::onPageComplete(std::unique_ptr<Page> page) {
+std::string Section::getLayoutDir() const { return layoutDir(sectionsDir, layoutStamp); }
+
+void Section::selectLayout(const uint32_t stamp) {
+  layoutStamp = stamp;
+  const std::string dir = layoutDir(sectionsDir, stamp);
+  filePath = dir + "/" + std::to_string(spineIndex) + ".bin";
+  checkpointPath = dir + "/" + std::to_string(spineIndex) + ".ckpt";
+  searchIndexPath = dir + "/" + std::to_string(spineIndex) + ".srch";
+  useLayout(sectionsDir, stamp);
+}
+
+uint32_t Section::onPageComplete(BufferedFileWriter& writer, PageRecordScratch* scratch, std::unique_ptr<Page> page,
+                                 const int fontId) {
   if (!file) {
     LOG_ERR("SCT", "File not open for writing page %d", pageCount);
     return 0;
   }
 
-  const uint32_t position = file.position();
-  if (!page->serialize(file)) {
+  const uint32_t position = writer.position();
+  if (!page->serializeRecord(writer, scratch, &renderer, fontId)) {
     LOG_ERR("SCT", "Failed to serialize page %d", pageCount);
     return 0;
   }
@@ -33,10 +413,11 @@ uint32_t Section::onPageComplete(std::unique_ptr<Page> page) {
   return position;
 }
 
-void Section::writeSectionFileHeader(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
-                                     const uint8_t paragraphAlignment, const uint16_t viewportWidth,
-                                     const uint16_t viewportHeight, const bool hyphenationEnabled,
-                                     const bool embeddedStyle, const uint8_t imageRendering) {
+void Section::writeSectionFileHeader(BufferedFileWriter& writer, const int fontId, const float lineCompression,
+                                     const bool extraParagraphSpacing, const uint8_t paragraphAlignment,
+                                     const uint16_t viewportWidth, const uint16_t viewportHeight,
+                                     const bool hyphenationEnabled, const bool embeddedStyle,
+                                     const uint8_t imageRendering) {
   if (!file) {
     LOG_DBG("SCT", "File not open for writing header");
     return;
@@ -46,25 +427,43 @@ void Section::writeSectionFileHeader(const int fontId, const float lineCompressi
                                    sizeof(viewportHeight) + sizeof(pageCount) + sizeof(hyphenationEnabled) +
                                    sizeof(embeddedStyle) + sizeof(imageRendering) + sizeof(uint32_t) + sizeof(uint32_t),
                 "Header size mismatch");
-  serialization::writePod(file, SECTION_FILE_VERSION);
-  serialization::writePod(file, fontId);
-  serialization::writePod(file, lineCompression);
-  serialization::writePod(file, extraParagraphSpacing);
-  serialization::writePod(file, paragraphAlignment);
-  serialization::writePod(file, viewportWidth);
-  serialization::writePod(file, viewportHeight);
-  serialization::writePod(file, hyphenationEnabled);
-  serialization::writePod(file, embeddedStyle);
-  serialization::writePod(file, imageRendering);
-  serialization::writePod(file, pageCount);  // Placeholder for page count (will be initially 0, patched later)
-  serialization::writePod(file, static_cast<uint32_t>(0));  // Placeholder for LUT offset (patched later)
-  serialization::writePod(file, static_cast<uint32_t>(0));  // Placeholder for anchor map offset (patched later)
+  serialization::writePod(writer, SECTION_FILE_VERSION);
+  serialization::writePod(writer, fontId);
+  serialization::writePod(writer, lineCompression);
+  serialization::writePod(writer, extraParagraphSpacing);
+  serialization::writePod(writer, paragraphAlignment);
+  serialization::writePod(writer, viewportWidth);
+  serialization::writePod(writer, viewportHeight);
+  serialization::writePod(writer, hyphenationEnabled);
+  serialization::writePod(writer, embeddedStyle);
+  serialization::writePod(writer, imageRendering);
+  serialization::writePod(writer, pageCount);  // Placeholder for page count (will be initially 0, patched later)
+  serialization::writePod(writer, static_cast<uint32_t>(0));  // Placeholder for LUT offset (patched later)
+  serialization::writePod(writer, static_cast<uint32_t>(0));  // Placeholder for anchor map offset (patched later)
+}
+
+void Section::loadPartialPages(const uint32_t binSize) {
+  ChapterHtmlSlimParser::Checkpoint checkpoint;
+  FsFile f;
+  partial = false;
+  if (Storage.exists(checkpointPath.c_str()) && Storage.openFileForRead("SCT", checkpointPath, f)) {
+    BufferedFileReader reader(f);
+    partial = readCheckpointPages(reader, binSize, checkpoint, partialLut, partialPagesEnd);
+  }
+  if (!partial) {
+    partialLut.clear();
+  }
+  pageCount = static_cast<uint16_t>(partialLut.size());
 }
 
 bool Section::loadSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
                               const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                               const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle,
                               const uint8_t imageRendering) {
+  partial = false;
+  partialLut.clear();
+  selectLayout(computeLayoutStamp(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+                                  viewportHeight, hyphenationEnabled, embeddedStyle, imageRendering));
   if (!Storage.openFileForRead("SCT", filePath, file)) {
     return false;
   }
@@ -113,14 +512,35 @@ bool Section::loadSectionFile(const int fontId, const float lineCompression, con
   }
 
   serialization::readPod(file, pageCount);
+  uint32_t lutOffset;
+  serialization::readPod(file, lutOffset);
+  const uint32_t fileSize = file.size();
   // Explicit close() required: member variable persists beyond function scope
   file.close();
+  if (lutOffset == 0) {
+    // Build was interrupted; createSectionFile() picks it up again if a checkpoint was saved. Meanwhile the pages
+    // it already wrote can be shown (see isPartial()).
+    loadPartialPages(fileSize);
+    LOG_DBG("SCT", "Section file incomplete: %d pages so far", pageCount);
+    return false;
+  }
   LOG_DBG("SCT", "Deserialization succeeded: %d pages", pageCount);
+  BookPageCounts::record(getLayoutDir(), epub->getSpineItemsCount(), spineIndex, pageCount);
   return true;
 }
 
 // Your updated class method (assuming you are using the 'SD' object, which is a wrapper for a specific filesystem)
 bool Section::clearCache() const {
+  if (pageCache) {
+    pageCache->invalidate(spineIndex);
+  }
+  if (Storage.exists(checkpointPath.c_str())) {
+    Storage.remove(checkpointPath.c_str());
+  }
+  if (Storage.exists(searchIndexPath.c_str())) {
+    Storage.remove(searchIndexPath.c_str());
+  }
+
   if (!Storage.exists(filePath.c_str())) {
     LOG_DBG("SCT", "Cache does not exist, no action needed");
     return true;
@@ -135,17 +555,20 @@ bool Section::clearCache() const {
   return true;
 }
 
-bool Section::createSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
-                                const uint8_t paragraphAlignment, const uint16_t viewportWidth,
-                                const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle,
-                                const uint8_t imageRendering, const std::function<void()>& popupFn) {
-  const auto localPath = epub->getSpineItem(spineIndex).href;
-  const auto tmpHtmlPath = epub->getCachePath() + "/.tmp_" + std::to_string(spineIndex) + ".html";
-
-  // Create cache directory if it doesn't exist
-  {
-    const auto sectionsDir = epub->getCachePath() + "/sections";
-    Storage.mkdir(sectionsDir.c_str());
+bool Section::openSource(const std::string& localPath, const std::string& tmpHtmlPath,
+                         ZipFile::StoredEntry& storedHtml, ZipFile::InflatedEntry& inflatedHtml,
+                         bool& parseInPlace) const {
+  // A chapter stored without compression is parsed in place from the EPUB, a compressed one as it is inflated. Only
+  // if no inflate window can be had is it inflated to a temp file first.
+  parseInPlace = epub->openStoredItem(localPath, storedHtml);
+  if (parseInPlace) {
+    LOG_DBG("SCT", "Parsing stored HTML in place (%zu bytes)", storedHtml.size());
+    return true;
+  }
+  parseInPlace = epub->openInflatedItem(localPath, inflatedHtml);
+  if (parseInPlace) {
+    LOG_DBG("SCT", "Parsing HTML as it is inflated (%zu bytes)", inflatedHtml.size());
+    return true;
   }
 
   // Retry logic for SD card timing issues
@@ -166,7 +589,7 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
     if (!Storage.openFileForWrite("SCT", tmpHtmlPath, tmpHtml)) {
       continue;
     }
-    success = epub->readItemContentsToStream(localPath, tmpHtml, 1024);
+    success = epub->extractItemToFile(localPath, tmpHtml);
     fileSize = tmpHtml.size();
     // Explicitly close() file before calling Storage.remove()
     tmpHtml.close();
@@ -182,52 +605,215 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
     LOG_ERR("SCT", "Failed to stream item contents to temp file after retries");
     return false;
   }
-
   LOG_DBG("SCT", "Streamed temp HTML to %s (%d bytes)", tmpHtmlPath.c_str(), fileSize);
+  return true;
+}
 
-  if (!Storage.openFileForWrite("SCT", filePath, file)) {
+CssParser* Section::loadStylesheets(const std::string& tmpHtmlPath, ZipFile::StoredEntry& storedHtml,
+                                    ZipFile::InflatedEntry& inflatedHtml, const bool parseInPlace,
+                                    const std::string& contentBase) const {
+  CssParser* cssParser = epub->getCssParser();
+  if (!cssParser) {
+    return nullptr;
+  }
+  // Only the stylesheets this chapter links apply to it
+  std::vector<std::string> stylesheets;
+  if (storedHtml.isOpen()) {
+    stylesheets = findLinkedStylesheets(storedHtml, contentBase);
+    storedHtml.seek(0);
+  } else if (parseInPlace) {
+    // Only the head is inflated for this, then the chapter is inflated again from the start for the parser
+    stylesheets = findLinkedStylesheets(inflatedHtml, contentBase);
+    if (!inflatedHtml.rewind()) {
+      LOG_ERR("SCT", "Failed to rewind inflated HTML");
+    }
+  } else {
+    FsFile html;
+    if (Storage.openFileForRead("SCT", tmpHtmlPath, html)) {
+      stylesheets = findLinkedStylesheets(html, contentBase);
+      html.close();
+    }
+  }
+  if (!epub->loadStylesheets(stylesheets)) {
+    LOG_ERR("SCT", "Failed to load CSS of chapter");
+  }
+  return cssParser;
+}
+
+bool Section::createSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
+                                const uint8_t paragraphAlignment, const uint16_t viewportWidth,
+                                const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle,
+                                const uint8_t imageRendering, const std::function<void()>& popupFn,
+                                const std::function<bool()>& abortFn) {
+  selectLayout(computeLayoutStamp(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+                                  viewportHeight, hyphenationEnabled, embeddedStyle, imageRendering));
+  laidOutSourceOffset = 0;
+  if (pageCache) {
+    pageCache->invalidate(spineIndex);
+  }
+
+  const auto localPath = epub->getSpineItem(spineIndex).href;
+  const auto tmpHtmlPath = epub->getCachePath() + "/.tmp_" + std::to_string(spineIndex) + ".html";
+
+  // Create the layout's directory if it doesn't exist
+  Storage.mkdir(layoutDir(sectionsDir, layoutStamp).c_str());
+
+  ZipFile::StoredEntry storedHtml;
+  ZipFile::InflatedEntry inflatedHtml;
+  bool parseInPlace = false;
+  if (!openSource(localPath, tmpHtmlPath, storedHtml, inflatedHtml, parseInPlace)) {
     return false;
   }
-  writeSectionFileHeader(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
-                         viewportHeight, hyphenationEnabled, embeddedStyle, imageRendering);
+  size_t sourceSize = storedHtml.isOpen() ? storedHtml.size() : inflatedHtml.isOpen() ? inflatedHtml.size() : 0;
+  if (!parseInPlace) {
+    epub->getItemSize(localPath, &sourceSize);
+  }
+
+  // Continue an aborted build if it left a checkpoint, appending to the pages it already wrote
+  ChapterHtmlSlimParser::Checkpoint resumePoint;
   std::vector<uint32_t> lut = {};
+  uint32_t pagesEnd = 0;
+  bool resuming = false;
+  if (Storage.exists(checkpointPath.c_str())) {
+    file = Storage.open(filePath.c_str(), O_RDWR);
+    resuming = file && loadCheckpoint(checkpointPath, file.size(), resumePoint, lut, pagesEnd) && file.seek(pagesEnd);
+    if (!resuming) {
+      file.close();
+    }
+  }
+
+  if (resuming) {
+    pageCount = static_cast<uint16_t>(lut.size());
+    LOG_DBG("SCT", "Resuming section build after %d pages", pageCount);
+  } else {
+    lut.clear();
+    resumePoint = ChapterHtmlSlimParser::Checkpoint{};
+    pageCount = 0;
+    if (!Storage.openFileForWrite("SCT", filePath, file)) {
+      return false;
+    }
+    // One run of clusters, so pages and the LUT are read back in multi-sector transfers
+    const uint32_t estimatedSize = HEADER_SIZE + sourceSize * SECTION_SIZE_PER_SOURCE_BYTE;
+    if (sourceSize > 0 && !file.preAllocate(estimatedSize)) {
+      LOG_DBG("SCT", "No contiguous run of %lu bytes for the section file", static_cast<unsigned long>(estimatedSize));
+    }
+  }
+  // Pages are written out a few sectors at a time; flushed before the file is checkpointed, patched or closed
+  BufferedFileWriter writer(file, 4096);
+  if (!resuming) {
+    writeSectionFileHeader(writer, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+                           viewportHeight, hyphenationEnabled, embeddedStyle, imageRendering);
+  }
+
+  std::unique_ptr<PageRecordScratch> recordScratch;
+  if (SECTION_RECORD_COMPRESSION) {
+    recordScratch.reset(new PageRecordScratch());
+  }
+
+  // The search index gets a filter per page as the pages are written; a resumed build continues after those of the
+  // pages it already has
+  FsFile searchFile;
+  if (SECTION_SEARCH_INDEX) {
+    const uint32_t filtersEnd = sizeof(SearchIndex::VERSION) + lut.size() * SearchIndex::FILTER_SIZE;
+    if (resuming) {
+      searchFile = Storage.open(searchIndexPath.c_str(), O_RDWR);
+      if (searchFile && (searchFile.size() < filtersEnd || !searchFile.seek(filtersEnd))) {
+        searchFile.close();
+      }
+    } else if (Storage.openFileForWrite("SCT", searchIndexPath, searchFile)) {
+      serialization::writePod(searchFile, SearchIndex::VERSION);
+    }
+  }
+  const auto addSearchFilter = [this, &searchFile](const Page& page) {
+    if (!searchFile) {
+      return;
+    }
+    uint8_t filter[SearchIndex::FILTER_SIZE] = {};
+    SearchIndex::addPage(page, filter);
+    if (searchFile.write(filter, sizeof(filter)) != sizeof(filter)) {
+      LOG_ERR("SCT", "Failed to write search filter of page %d", pageCount);
+      searchFile.close();
+      Storage.remove(searchIndexPath.c_str());
+    }
+  };
 
   // Derive the content base directory and image cache path prefix for the parser
   size_t lastSlash = localPath.find_last_of('/');
   std::string contentBase = (lastSlash != std::string::npos) ? localPath.substr(0, lastSlash + 1) : "";
   std::string imageBasePath = epub->getCachePath() + "/img_" + std::to_string(spineIndex) + "_";
 
-  CssParser* cssParser = nullptr;
-  if (embeddedStyle) {
-    cssParser = epub->getCssParser();
-    if (cssParser) {
-      if (!cssParser->loadFromCache()) {
-        LOG_ERR("SCT", "Failed to load CSS from cache");
-      }
-    }
-  }
+  CssParser* cssParser =
+      embeddedStyle ? loadStylesheets(tmpHtmlPath, storedHtml, inflatedHtml, parseInPlace, contentBase) : nullptr;
 
+  const ChapterHtmlSlimParser* builder = nullptr;
   ChapterHtmlSlimParser visitor(
       epub, tmpHtmlPath, renderer, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
       viewportHeight, hyphenationEnabled,
-      [this, &lut](std::unique_ptr<Page> page) { lut.emplace_back(this->onPageComplete(std::move(page))); },
-      embeddedStyle, contentBase, imageBasePath, imageRendering, popupFn, cssParser);
+      [this, &lut, &builder, &writer, &recordScratch, &addSearchFilter, fontId](std::unique_ptr<Page> page) {
+        addSearchFilter(*page);
+        lut.emplace_back(this->onPageComplete(writer, recordScratch.get(), std::move(page), fontId));
+        // The content before the start of the page just completed is all on complete pages
+        laidOutSourceOffset = builder->getPageOffsets().back();
+      },
+      embeddedStyle, contentBase, imageBasePath, imageRendering, popupFn, cssParser, abortFn);
+  builder = &visitor;
+  if (storedHtml.isOpen()) {
+    visitor.setStoredSource(storedHtml);
+  } else if (inflatedHtml.isOpen()) {
+    visitor.setInflatedSource(inflatedHtml);
+  }
+  if (resuming) {
+    visitor.resumeFrom(std::move(resumePoint));
+  }
   Hyphenator::setPreferredLanguage(epub->getLanguage());
-  success = visitor.parseAndBuildPages();
+  bool success = visitor.parseAndBuildPages();
 
-  Storage.remove(tmpHtmlPath.c_str());
+  storedHtml.close();
+  inflatedHtml.close();
+  if (!parseInPlace) {
+    Storage.remove(tmpHtmlPath.c_str());
+  }
   if (!success) {
-    LOG_ERR("SCT", "Failed to parse XML and build pages");
-    // Explicitly close() file before calling Storage.remove()
-    file.close();
-    Storage.remove(filePath.c_str());
+    partial = false;
+    partialLut.clear();
+    const bool pagesFlushed = writer.flush();
+    const uint32_t pagesWritten = writer.position();
+    if (pagesFlushed && visitor.hasCheckpoint() &&
+        saveCheckpoint(checkpointPath, visitor.getCheckpoint(), lut, pagesWritten)) {
+      LOG_DBG("SCT", "Section build paused after %d pages", pageCount);
+      // Explicit close() required: member variable persists beyond function scope
+      file.close();
+      partial = true;
+      partialLut = std::move(lut);
+      partialPagesEnd = pagesWritten;
+    } else if (visitor.wasAborted() && resuming) {
+      // Stopped before reaching a new checkpoint; the previous one still describes the pages on disk
+      LOG_DBG("SCT", "Section build aborted, keeping previous checkpoint");
+      file.close();
+      pageCount = 0;
+    } else {
+      if (visitor.wasAborted()) {
+        LOG_DBG("SCT", "Section build aborted, discarding partial file");
+      } else {
+        LOG_ERR("SCT", "Failed to parse XML and build pages");
+      }
+      // Explicitly close() file before calling Storage.remove()
+      file.close();
+      Storage.remove(filePath.c_str());
+      searchFile.close();
+      Storage.remove(searchIndexPath.c_str());
+      if (Storage.exists(checkpointPath.c_str())) {
+        Storage.remove(checkpointPath.c_str());
+      }
+      pageCount = 0;
+    }
     if (cssParser) {
-      cssParser->clear();
+      cssParser->releaseIfLowOnHeap();
     }
     return false;
   }
 
-  const uint32_t lutOffset = file.position();
+  const uint32_t lutOffset = writer.position();
   bool hasFailedLutRecords = false;
   // Write LUT
   for (const uint32_t& pos : lut) {
@@ -235,7 +821,7 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
       hasFailedLutRecords = true;
       break;
     }
-    serialization::writePod(file, pos);
+    serialization::writePod(writer, pos);
   }
 
   if (hasFailedLutRecords) {
@@ -246,15 +832,55 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
     return false;
   }
 
-  // Write anchor-to-page map for fragment navigation (e.g. footnote targets)
-  const uint32_t anchorMapOffset = file.position();
+  // Page source offsets follow the LUT, one per page, for mapping positions from other readers to pages
+  const auto& pageOffsets = visitor.getPageOffsets();
+  if (pageOffsets.size() != pageCount) {
+    LOG_ERR("SCT", "Page offset count mismatch (%u vs %u)", pageOffsets.size(), pageCount);
+  }
+  uint32_t pageOffset = 0;
+  for (uint16_t i = 0; i < pageCount; i++) {
+    if (i < pageOffsets.size()) {
+      pageOffset = pageOffsets[i];
+    }
+    serialization::writePod(writer, pageOffset);
+  }
+
+  // Write anchor-to-page map for fragment navigation (e.g. footnote targets): a count, entries sorted by anchor hash,
+  // then the anchor ids in the same order, which are only read to rule out hash collisions
+  const uint32_t anchorMapOffset = writer.position();
   const auto& anchors = visitor.getAnchors();
-  serialization::writePod(file, static_cast<uint16_t>(anchors.size()));
-  for (const auto& [anchor, page] : anchors) {
-    serialization::writeString(file, anchor);
-    serialization::writePod(file, page);
+  const uint16_t anchorCount = static_cast<uint16_t>(std::min<size_t>(anchors.size(), UINT16_MAX));
+  std::vector<std::pair<uint32_t, uint16_t>> anchorOrder;
+  anchorOrder.reserve(anchorCount);
+  for (uint16_t i = 0; i < anchorCount; i++) {
+    anchorOrder.emplace_back(hashAnchor(anchors[i].first), i);
+  }
+  // Stable, so of repeated ids the first one recorded is still found first
+  std::stable_sort(anchorOrder.begin(), anchorOrder.end(),
+                   [](const auto& a, const auto& b) { return a.first < b.first; });
+  serialization::writePod(writer, anchorCount);
+  uint32_t nameOffset = sizeof(anchorCount) + ANCHOR_ENTRY_SIZE * anchorCount;
+  for (const auto& [hash, index] : anchorOrder) {
+    serialization::writePod(writer, hash);
+    serialization::writePod(writer, anchors[index].second);
+    serialization::writePod(writer, nameOffset);
+    nameOffset += sizeof(uint32_t) + anchors[index].first.size();
+  }
+  for (const auto& [hash, index] : anchorOrder) {
+    serialization::writeString(writer, anchors[index].first);
+  }
+  if (!writer.flush()) {
+    LOG_ERR("SCT", "Failed to write section file");
+    // Explicitly close() file before calling Storage.remove()
+    file.close();
+    Storage.remove(filePath.c_str());
+    return false;
   }
 
+  searchFile.close();
+  // Releases what was reserved past the end
+  file.truncate();
+
   // Patch header with final pageCount, lutOffset, and anchorMapOffset
   file.seek(HEADER_SIZE - sizeof(uint32_t) * 2 - sizeof(pageCount));
   serialization::writePod(file, pageCount);
@@ -262,29 +888,192 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
   serialization::writePod(file, anchorMapOffset);
   // Explicit close() required: member variable persists beyond function scope
   file.close();
+  if (Storage.exists(checkpointPath.c_str())) {
+    Storage.remove(checkpointPath.c_str());
+  }
+  partial = false;
+  partialLut.clear();
   if (cssParser) {
-    cssParser->clear();
+    cssParser->releaseIfLowOnHeap();
   }
+  BookPageCounts::record(getLayoutDir(), epub->getSpineItemsCount(), spineIndex, pageCount);
   return true;
 }
 
-std::unique_ptr<Page> Section::loadPageFromSectionFile() {
+bool Section::findPhrase(const std::vector<std::string>& terms, const size_t maxMatches,
+                         std::vector<SearchMatch>& matches) {
+  FsFile f;
+  if (partial || !Storage.exists(searchIndexPath.c_str()) || !Storage.openFileForRead("SCT", searchIndexPath, f)) {
+    return false;
+  }
+  uint8_t version = 0;
+  serialization::readPod(f, version);
+  if (version != SearchIndex::VERSION || f.size() < sizeof(version) + pageCount * SearchIndex::FILTER_SIZE) {
+    LOG_ERR("SCT", "Search index of section %d doesn't match its pages", spineIndex);
+    return false;
+  }
+
+  BufferedFileReader reader(f, 2048);
+  uint8_t filter[SearchIndex::FILTER_SIZE];
+  for (uint16_t page = 0; page < pageCount && matches.size() < maxMatches; page++) {
+    if (reader.read(filter, sizeof(filter)) != sizeof(filter)) {
+      return false;
+    }
+    if (!SearchIndex::mayContain(filter, terms)) {
+      continue;
+    }
+    // Confirmed on the page itself, the filter lets through some pages without the phrase
+    if (const auto p = loadPage(page)) {
+      SearchIndex::findOnPage(*p, terms, spineIndex, page, matches);
+    }
+  }
+  return true;
+}
+
+std::unique_ptr<Page> Section::layoutPageAt(const uint32_t sourceOffset, const int fontId, const float lineCompression,
+                                            const bool extraParagraphSpacing, const uint8_t paragraphAlignment,
+                                            const uint16_t viewportWidth, const uint16_t viewportHeight,
+                                            const bool hyphenationEnabled, const bool embeddedStyle,
+                                            const uint8_t imageRendering, uint32_t& pageSourceOffset) {
+  selectLayout(computeLayoutStamp(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+                                  viewportHeight, hyphenationEnabled, embeddedStyle, imageRendering));
+  const auto localPath = epub->getSpineItem(spineIndex).href;
+  const auto tmpHtmlPath = epub->getCachePath() + "/.tmp_" + std::to_string(spineIndex) + ".html";
+  ZipFile::StoredEntry storedHtml;
+  ZipFile::InflatedEntry inflatedHtml;
+  bool parseInPlace = false;
+  if (!openSource(localPath, tmpHtmlPath, storedHtml, inflatedHtml, parseInPlace)) {
+    return nullptr;
+  }
+
+  const size_t lastSlash = localPath.find_last_of('/');
+  const std::string contentBase = (lastSlash != std::string::npos) ? localPath.substr(0, lastSlash + 1) : "";
+  const std::string imageBasePath = epub->getCachePath() + "/img_" + std::to_string(spineIndex) + "_";
+  CssParser* cssParser =
+      embeddedStyle ? loadStylesheets(tmpHtmlPath, storedHtml, inflatedHtml, parseInPlace, contentBase) : nullptr;
+
+  // Stops at the next text block boundary once the first page is complete
+  std::unique_ptr<Page> firstPage;
+  ChapterHtmlSlimParser visitor(
+      epub, tmpHtmlPath, renderer, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+      viewportHeight, hyphenationEnabled,
+      [&firstPage](std::unique_ptr<Page> page) {
+        if (!firstPage) {
+          firstPage = std::move(page);
+        }
+      },
+      embeddedStyle, contentBase, imageBasePath, imageRendering, nullptr, cssParser,
+      [&firstPage]() { return firstPage != nullptr; });
+  if (storedHtml.isOpen()) {
+    visitor.setStoredSource(storedHtml);
+  } else if (inflatedHtml.isOpen()) {
+    visitor.setInflatedSource(inflatedHtml);
+  }
+  visitor.seedAt(sourceOffset);
+  Hyphenator::setPreferredLanguage(epub->getLanguage());
+  visitor.parseAndBuildPages();
+
+  storedHtml.close();
+  inflatedHtml.close();
+  if (!parseInPlace) {
+    Storage.remove(tmpHtmlPath.c_str());
+  }
+  if (cssParser) {
+    cssParser->releaseIfLowOnHeap();
+  }
+  if (!firstPage || visitor.getPageOffsets().empty()) {
+    LOG_ERR("SCT", "No page at byte %u of section %d", sourceOffset, spineIndex);
+    return nullptr;
+  }
+  pageSourceOffset = visitor.getPageOffsets().front();
+  LOG_DBG("SCT", "Laid out a page at byte %u of section %d", pageSourceOffset, spineIndex);
+  extractPageImages(*firstPage);
+  return firstPage;
+}
+
+bool Section::findPageRecord(FsFile& f, const int page, uint32_t& pagePos, uint32_t& pageEnd) const {
+  // A page record ends where the next one starts, or at the LUT after the last page
+  if (partial) {
+    if (page < 0 || page >= static_cast<int>(partialLut.size())) {
+      return false;
+    }
+    pagePos = partialLut[page];
+    pageEnd = page + 1 < static_cast<int>(partialLut.size()) ? partialLut[page + 1] : partialPagesEnd;
+  } else {
+    if (page < 0 || page >= pageCount) {
+      return false;
+    }
+    f.seek(HEADER_SIZE - sizeof(uint32_t) * 2);
+    uint32_t lutOffset;
+    serialization::readPod(f, lutOffset);
+    f.seek(lutOffset + sizeof(uint32_t) * page);
+    serialization::readPod(f, pagePos);
+    pageEnd = lutOffset;
+    if (page + 1 < pageCount) {
+      serialization::readPod(f, pageEnd);
+    }
+  }
+  if (pageEnd <= pagePos) {
+    LOG_ERR("SCT", "Invalid record bounds for page %d", page);
+    return false;
+  }
+  return true;
+}
+
+bool Section::getPageRecord(const int page, uint32_t& pagePos, uint32_t& pageEnd) const {
+  FsFile f;
+  return Storage.openFileForRead("SCT", filePath, f) && findPageRecord(f, page, pagePos, pageEnd);
+}
+
+void Section::extractPageImages(const Page& page) const {
+  for (const auto& element : page.elements) {
+    if (element->getTag() != TAG_PageImage) {
+      continue;
+    }
+    const ImageBlock& image = static_cast<const PageImage&>(*element).getImageBlock();
+    if (image.getSourcePath().empty() || image.hasImageData()) {
+      continue;
+    }
+
+    // Only indexed once complete, so an interrupted extraction is never taken for the image
+    const bool extracted = ImagePack::append(image.getImagePath(), [this, &image](Print& out) {
+      return epub->readItemContentsToStream(image.getSourcePath(), out, Storage.getChunkSize());
+    });
+    if (!extracted) {
+      LOG_ERR("SCT", "Failed to extract image %s", image.getSourcePath().c_str());
+    }
+  }
+}
+
+std::shared_ptr<Page> Section::loadPage(const int page) {
+  if (pageCache) {
+    if (auto cached = pageCache->get(spineIndex, page, layoutStamp)) {
+      return cached;
+    }
+  }
+
   if (!Storage.openFileForRead("SCT", filePath, file)) {
     return nullptr;
   }
 
-  file.seek(HEADER_SIZE - sizeof(uint32_t) * 2);
-  uint32_t lutOffset;
-  serialization::readPod(file, lutOffset);
-  file.seek(lutOffset + sizeof(uint32_t) * currentPage);
   uint32_t pagePos;
-  serialization::readPod(file, pagePos);
+  uint32_t pageEnd;
+  if (!findPageRecord(file, page, pagePos, pageEnd)) {
+    file.close();
+    return nullptr;
+  }
   file.seek(pagePos);
 
-  auto page = Page::deserialize(file);
+  std::shared_ptr<Page> loaded = Page::deserialize(file, pageEnd - pagePos);
   // Explicit close() required: member variable persists beyond function scope
   file.close();
-  return page;
+  if (loaded) {
+    extractPageImages(*loaded);
+  }
+  if (loaded && pageCache) {
+    pageCache->put(spineIndex, page, layoutStamp, loaded);
+  }
+  return loaded;
 }
 
 std::optional<uint16_t> Section::getPageForAnchor(const std::string& anchor) const {
@@ -294,6 +1083,11 @@ std::optional<uint16_t> Section::getPageForAnchor(const std::string& anchor) con
   }
 
   const uint32_t fileSize = f.size();
+  if (partial) {
+    // The anchor map is only written with the last page, until then the checkpoint has the anchors seen so far
+    f.close();
+    return findCheckpointAnchor(checkpointPath, fileSize, anchor);
+  }
   f.seek(HEADER_SIZE - sizeof(uint32_t));
   uint32_t anchorMapOffset;
   serialization::readPod(f, anchorMapOffset);
@@ -304,15 +1098,101 @@ std::optional<uint16_t> Section::getPageForAnchor(const std::string& anchor) con
   f.seek(anchorMapOffset);
   uint16_t count;
   serialization::readPod(f, count);
-  for (uint16_t i = 0; i < count; i++) {
-    std::string key;
+  const uint32_t entriesOffset = anchorMapOffset + sizeof(count);
+  if (entriesOffset + ANCHOR_ENTRY_SIZE * count > fileSize) {
+    return std::nullopt;
+  }
+
+  // First entry with the anchor's hash
+  const uint32_t hash = hashAnchor(anchor);
+  uint16_t low = 0;
+  uint16_t high = count;
+  while (low < high) {
+    const uint16_t mid = low + (high - low) / 2;
+    f.seek(entriesOffset + ANCHOR_ENTRY_SIZE * mid);
+    uint32_t entryHash;
+    serialization::readPod(f, entryHash);
+    if (entryHash < hash) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+
+  for (uint16_t i = low; i < count; i++) {
+    f.seek(entriesOffset + ANCHOR_ENTRY_SIZE * i);
+    uint32_t entryHash;
     uint16_t page;
-    serialization::readString(f, key);
+    uint32_t nameOffset;
+    serialization::readPod(f, entryHash);
+    if (entryHash != hash) {
+      break;
+    }
     serialization::readPod(f, page);
-    if (key == anchor) {
+    serialization::readPod(f, nameOffset);
+    if (anchorNameEquals(f, anchorMapOffset + nameOffset, anchor)) {
       return page;
     }
   }
 
   return std::nullopt;
 }
+
+bool Section::readPageOffsetTable(FsFile& f, uint32_t& tableOffset, uint16_t& count) const {
+  if (!Storage.openFileForRead("SCT", filePath, f)) {
+    return false;
+  }
+  f.seek(HEADER_SIZE - sizeof(uint32_t) * 2 - sizeof(count));
+  uint32_t lutOffset;
+  serialization::readPod(f, count);
+  serialization::readPod(f, lutOffset);
+  tableOffset = lutOffset + sizeof(uint32_t) * count;
+  // Incomplete builds have neither table yet
+  return lutOffset != 0 && count > 0 && tableOffset + sizeof(uint32_t) * count <= f.size();
+}
+
+std::optional<uint32_t> Section::getPageSourceOffset(const int page) const {
+  FsFile f;
+  uint32_t tableOffset;
+  uint16_t count;
+  if (!readPageOffsetTable(f, tableOffset, count) || page < 0 || page >= count) {
+    return std::nullopt;
+  }
+  f.seek(tableOffset + sizeof(uint32_t) * page);
+  uint32_t offset;
+  serialization::readPod(f, offset);
+  return offset;
+}
+
+std::optional<uint16_t> Section::getPageForSourceOffset(const uint32_t offset) const {
+  FsFile f;
+  uint32_t tableOffset;
+  uint16_t count;
+  if (partial) {
+    if (!Storage.openFileForRead("SCT", filePath, f)) {
+      return std::nullopt;
+    }
+    const uint32_t fileSize = f.size();
+    f.close();
+    return findCheckpointPage(checkpointPath, fileSize, offset);
+  }
+  if (!readPageOffsetTable(f, tableOffset, count)) {
+    return std::nullopt;
+  }
+
+  // Last page starting at or before the offset
+  uint16_t low = 0;
+  uint16_t high = count;
+  while (high - low > 1) {
+    const uint16_t mid = low + (high - low) / 2;
+    f.seek(tableOffset + sizeof(uint32_t) * mid);
+    uint32_t midOffset;
+    serialization::readPod(f, midOffset);
+    if (midOffset <= offset) {
+      low = mid;
+    } else {
+      high = mid;
+    }
+  }
+  return low;
+}
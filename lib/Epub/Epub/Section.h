@@ -3,43 +3,117 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "Epub.h"
 
+class BufferedFileWriter;
+class CssParser;
 class Page;
+struct SearchMatch;
+struct PageRecordScratch;
+class PageCache;
 class GfxRenderer;
 
 class Section {
   std::shared_ptr<Epub> epub;
   const int spineIndex;
   GfxRenderer& renderer;
+  // Section files are kept per layout, in a directory named by its layout stamp (see selectLayout())
+  std::string sectionsDir;
   std::string filePath;
+  std::string checkpointPath;
+  std::string searchIndexPath;
   FsFile file;
+  PageCache* pageCache;
+  uint32_t layoutStamp = 0;
+  // Set while only part of the chapter has been laid out, pages are then looked up in the checkpoint's LUT
+  bool partial = false;
+  std::vector<uint32_t> partialLut;
+  uint32_t partialPagesEnd = 0;
+  uint32_t laidOutSourceOffset = 0;
 
-  void writeSectionFileHeader(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
-                              uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled,
-                              bool embeddedStyle, uint8_t imageRendering);
-  uint32_t onPageComplete(std::unique_ptr<Page> page);
+  void writeSectionFileHeader(BufferedFileWriter& writer, int fontId, float lineCompression, bool extraParagraphSpacing,
+                              uint8_t paragraphAlignment, uint16_t viewportWidth, uint16_t viewportHeight,
+                              bool hyphenationEnabled, bool embeddedStyle, uint8_t imageRendering);
+  uint32_t onPageComplete(BufferedFileWriter& writer, PageRecordScratch* scratch, std::unique_ptr<Page> page,
+                          int fontId);
+  // Points the file paths at the directory of the layout with this stamp, making it the book's most recent layout
+  void selectLayout(uint32_t stamp);
+  void loadPartialPages(uint32_t binSize);
+  bool findPageRecord(FsFile& f, int page, uint32_t& pagePos, uint32_t& pageEnd) const;
+  // Extracts the page's images that the layout only measured in the EPUB, so the first showing can draw them
+  void extractPageImages(const Page& page) const;
+  // Opens the section file at its page source offset table; false if the file has none (incomplete build)
+  bool readPageOffsetTable(FsFile& f, uint32_t& tableOffset, uint16_t& count) const;
+  // Opens the chapter's XHTML for parsing straight from the EPUB: in place if stored without compression, otherwise
+  // inflated as it is parsed. Falls back to inflating it to tmpHtmlPath first if that can't be set up.
+  bool openSource(const std::string& localPath, const std::string& tmpHtmlPath, ZipFile::StoredEntry& storedHtml,
+                  ZipFile::InflatedEntry& inflatedHtml, bool& parseInPlace) const;
+  // Loads the stylesheets the chapter links into the book's CSS parser, which it returns (null without one)
+  CssParser* loadStylesheets(const std::string& tmpHtmlPath, ZipFile::StoredEntry& storedHtml,
+                             ZipFile::InflatedEntry& inflatedHtml, bool parseInPlace,
+                             const std::string& contentBase) const;
 
  public:
   uint16_t pageCount = 0;
   int currentPage = 0;
 
-  explicit Section(const std::shared_ptr<Epub>& epub, const int spineIndex, GfxRenderer& renderer)
+  // pageCache is optional; when given, loaded pages are kept there and served from it on the next request.
+  explicit Section(const std::shared_ptr<Epub>& epub, const int spineIndex, GfxRenderer& renderer,
+                   PageCache* pageCache = nullptr)
       : epub(epub),
         spineIndex(spineIndex),
         renderer(renderer),
-        filePath(epub->getCachePath() + "/sections/" + std::to_string(spineIndex) + ".bin") {}
+        sectionsDir(epub->getCachePath() + "/sections"),
+        pageCache(pageCache) {}
   ~Section() = default;
   bool loadSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                        uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle,
                        uint8_t imageRendering);
   bool clearCache() const;
+  // True when pageCount only covers the pages of an aborted build (after loadSectionFile() or createSectionFile()
+  // returned false). Those pages can be shown; calling createSectionFile() again lays out the rest.
+  bool isPartial() const { return partial; }
+  // Builds the section file. A build stopped by abortFn is checkpointed at the last text block boundary, and the next
+  // call (after loadSectionFile() has validated the layout parameters) continues from there.
   bool createSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                          uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle,
-                         uint8_t imageRendering, const std::function<void()>& popupFn = nullptr);
-  std::unique_ptr<Page> loadPageFromSectionFile();
+                         uint8_t imageRendering, const std::function<void()>& popupFn = nullptr,
+                         const std::function<bool()>& abortFn = nullptr);
+  // Lays out just the page at a byte offset in the chapter's XHTML (see ChapterHtmlSlimParser::seedAt()), without
+  // touching the section file: a provisional page for a jump deep into a chapter that hasn't been laid out that far.
+  // pageSourceOffset is set to where the page starts, for finding the matching page once the chapter is laid out.
+  std::unique_ptr<Page> layoutPageAt(uint32_t sourceOffset, int fontId, float lineCompression,
+                                     bool extraParagraphSpacing, uint8_t paragraphAlignment, uint16_t viewportWidth,
+                                     uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle,
+                                     uint8_t imageRendering, uint32_t& pageSourceOffset);
+  std::shared_ptr<Page> loadPageFromSectionFile() { return loadPage(currentPage); }
+  // Loads any laid out page, e.g. the next one ahead of the turn to it; goes through pageCache like the current page
+  std::shared_ptr<Page> loadPage(int page);
+  // Stamp of the layout parameters the pages were built with, changes whenever the section is relaid out
+  uint32_t getLayoutStamp() const { return layoutStamp; }
+  // Directory of the section files of that layout, shared by every spine item laid out with it (see BookPageCounts)
+  std::string getLayoutDir() const;
+  // Where a page's record lies in the section file, for reading it back without a Section (see getFilePath())
+  bool getPageRecord(int page, uint32_t& pagePos, uint32_t& pageEnd) const;
+  const std::string& getFilePath() const { return filePath; }
 
-  // Look up the page number for an anchor id from the section cache file.
+  // Look up the page number for an anchor id from the section cache file, or for a partial section among the anchors
+  // of the pages laid out so far.
   std::optional<uint16_t> getPageForAnchor(const std::string& anchor) const;
+  // While createSectionFile() runs: the chapter's XHTML up to this byte offset is on complete pages. For an abortFn
+  // that stops the build once it has passed some point, e.g. a link target (see LinkTargetIndex).
+  uint32_t getLaidOutSourceOffset() const { return laidOutSourceOffset; }
+
+  // Appends the pages of a complete section showing the phrase (see SearchIndex), up to maxMatches in all; false if
+  // the section has no search index
+  bool findPhrase(const std::vector<std::string>& terms, size_t maxMatches, std::vector<SearchMatch>& matches);
+
+  // Byte offset in the chapter's XHTML where a page's content starts, from the section cache file. Together with the
+  // spine item sizes this places a page in the book exactly, independent of the layout it was built with.
+  std::optional<uint32_t> getPageSourceOffset(int page) const;
+  // The page showing the content at a byte offset in the chapter's XHTML (binary search over the same table); for a
+  // partial section among the pages laid out so far
+  std::optional<uint16_t> getPageForSourceOffset(uint32_t offset) const;
 };
@@ -0,0 +1,109 @@
+#include "TableLayout.h"
+
+#include <GfxRenderer.h>
+
+#include <algorithm>
+#include <string>
+
+#include "blocks/TextBlock.h"
+
+namespace {
+// Gap between columns, in space widths
+constexpr int COLUMN_GAP_SPACES = 3;
+}  // namespace
+
+void TableLayout::addCell(std::unique_ptr<ParsedText> cell) {
+  if (rows.empty()) {
+    startRow();
+  }
+  rows.back().push_back(std::move(cell));
+}
+
+void TableLayout::layout(const GfxRenderer& renderer, const int fontId, const uint16_t width,
+                         const std::function<void(std::shared_ptr<TextBlock>)>& processLine,
+                         const std::function<void()>& rowEnd) {
+  size_t columns = 0;
+  for (const auto& row : rows) {
+    columns = std::max(columns, row.size());
+  }
+  if (columns == 0) {
+    return;
+  }
+
+  // First pass: the narrowest and widest content of each column
+  std::vector<int> minWidths(columns, 0);
+  std::vector<int> maxWidths(columns, 0);
+  for (const auto& row : rows) {
+    for (size_t c = 0; c < row.size(); c++) {
+      int minWidth, maxWidth;
+      row[c]->measureContentWidths(renderer, fontId, minWidth, maxWidth);
+      minWidths[c] = std::max(minWidths[c], minWidth);
+      maxWidths[c] = std::max(maxWidths[c], maxWidth);
+    }
+  }
+
+  const int gap = COLUMN_GAP_SPACES * renderer.getSpaceWidth(fontId);
+  const int available = std::max(static_cast<int>(width) - gap * static_cast<int>(columns - 1), 1);
+  int minTotal = 0;
+  int maxTotal = 0;
+  for (size_t c = 0; c < columns; c++) {
+    minTotal += minWidths[c];
+    maxTotal += maxWidths[c];
+  }
+  std::vector<int> columnWidths(columns);
+  for (size_t c = 0; c < columns; c++) {
+    if (maxTotal <= available) {
+      columnWidths[c] = maxWidths[c];
+    } else if (minTotal <= available) {
+      columnWidths[c] = minWidths[c] + static_cast<int>(static_cast<int64_t>(maxWidths[c] - minWidths[c]) *
+                                                        (available - minTotal) / (maxTotal - minTotal));
+    } else {
+      columnWidths[c] = static_cast<int>(static_cast<int64_t>(minWidths[c]) * available / minTotal);
+    }
+  }
+  std::vector<int16_t> columnXs(columns, 0);
+  for (size_t c = 1; c < columns; c++) {
+    columnXs[c] = static_cast<int16_t>(columnXs[c - 1] + columnWidths[c - 1] + gap);
+  }
+
+  // Second pass: each cell at its column's width, the cells of a row merged line by line
+  std::vector<std::vector<std::shared_ptr<TextBlock>>> cellLines(columns);
+  for (auto& row : rows) {
+    size_t rowLines = 0;
+    for (size_t c = 0; c < row.size(); c++) {
+      cellLines[c].clear();
+      if (columnWidths[c] > 0) {
+        row[c]->layoutAndExtractLines(
+            renderer, fontId, static_cast<uint16_t>(columnWidths[c]),
+            [&lines = cellLines[c]](const std::shared_ptr<TextBlock>& line) { lines.push_back(line); });
+      }
+      rowLines = std::max(rowLines, cellLines[c].size());
+    }
+    row.clear();
+
+    for (size_t l = 0; l < rowLines; l++) {
+      std::vector<std::string> words;
+      std::vector<int16_t> xs;
+      std::vector<EpdFontFamily::Style> styles;
+      for (size_t c = 0; c < columns; c++) {
+        if (l >= cellLines[c].size()) {
+          continue;
+        }
+        const TextBlock& line = *cellLines[c][l];
+        words.insert(words.end(), line.getWords().begin(), line.getWords().end());
+        for (const int16_t x : line.getWordXpos()) {
+          xs.push_back(static_cast<int16_t>(columnXs[c] + x));
+        }
+        styles.insert(styles.end(), line.getWordStyles().begin(), line.getWordStyles().end());
+      }
+      processLine(std::make_shared<TextBlock>(std::move(words), std::move(xs), std::move(styles)));
+    }
+    for (auto& lines : cellLines) {
+      lines.clear();
+    }
+    if (rowLines > 0) {
+      rowEnd();
+    }
+  }
+  rows.clear();
+}
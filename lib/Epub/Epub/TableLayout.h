@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "ParsedText.h"
+
+class GfxRenderer;
+class TextBlock;
+
+// Tables are laid out as a grid when they fit TableLayout's limits; without it every table is flattened into a
+// paragraph per cell
+#ifndef TABLE_GRID_LAYOUT
+#define TABLE_GRID_LAYOUT 1
+#endif
+
+/**
+ * A table buffered cell by cell and laid out as a grid once it is complete. Columns are sized in two passes over the
+ * buffered cells: the first measures each column's narrowest and widest content (through the section's word width
+ * cache, as the cells are ParsedText paragraphs), the second lays every cell out at its column's width. Each row is
+ * then emitted as lines that hold the words of all its cells, at their column's x, so a row needs nothing on the page
+ * that a paragraph doesn't.
+ *
+ * Column widths follow the auto layout of HTML: columns get their widest content when it fits, else their narrowest
+ * plus a share of the room left in proportion to what more they could use, else less than their narrowest in
+ * proportion to it, splitting words. Row and column spans are not supported; each cell takes one column.
+ *
+ * The parser keeps a table buffered only up to MAX_SOURCE_BYTES of its source and MAX_COLUMNS cells per row, and
+ * flattens bigger ones into a paragraph per cell.
+ */
+class TableLayout {
+ public:
+  static constexpr uint32_t MAX_SOURCE_BYTES = 6 * 1024;
+  static constexpr size_t MAX_COLUMNS = 6;
+
+  using Row = std::vector<std::unique_ptr<ParsedText>>;
+
+  void startRow() { rows.emplace_back(); }
+  void addCell(std::unique_ptr<ParsedText> cell);
+  // Cells of the row being buffered
+  size_t rowCellCount() const { return rows.empty() ? 0 : rows.back().size(); }
+  std::vector<Row>& getRows() { return rows; }
+
+  // Lays the table out within width, calling processLine for each line in order and rowEnd after each row's lines
+  void layout(const GfxRenderer& renderer, int fontId, uint16_t width,
+              const std::function<void(std::shared_ptr<TextBlock>)>& processLine,
+              const std::function<void()>& rowEnd);
+
+ private:
+  std::vector<Row> rows;
+};
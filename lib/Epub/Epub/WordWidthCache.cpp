@@ -0,0 +1,58 @@
+#include "WordWidthCache.h"
+
+#include <Logging.h>
+
+#include <cstring>
+
+static_assert((WordWidthCache::CAPACITY & (WordWidthCache::CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+uint64_t WordWidthCache::makeKey(const int fontId, const EpdFontFamily::Style style, const char* text,
+                                 const size_t length, const bool appendHyphen) {
+  // FNV-1a over the font selection, then the text
+  uint64_t hash = 14695981039346656037ull;
+  const auto mix = [&hash](const uint8_t byte) {
+    hash ^= byte;
+    hash *= 1099511628211ull;
+  };
+  const auto id = static_cast<uint32_t>(fontId);
+  for (int shift = 0; shift < 32; shift += 8) {
+    mix(static_cast<uint8_t>(id >> shift));
+  }
+  mix(static_cast<uint8_t>(style));
+  mix(appendHyphen ? 1 : 0);
+  for (size_t i = 0; i < length; i++) {
+    mix(static_cast<uint8_t>(text[i]));
+  }
+  return hash != 0 ? hash : 1;
+}
+
+bool WordWidthCache::lookup(const uint64_t key, uint16_t& width) {
+  lookups++;
+  const uint16_t slot = static_cast<uint16_t>(key) & (CAPACITY - 1);
+  if (keys[slot] != key) {
+    return false;
+  }
+  hits++;
+  width = widths[slot];
+  return true;
+}
+
+void WordWidthCache::store(const uint64_t key, const uint16_t width) {
+  const uint16_t slot = static_cast<uint16_t>(key) & (CAPACITY - 1);
+  keys[slot] = key;
+  widths[slot] = width;
+}
+
+void WordWidthCache::clear() {
+  memset(keys, 0, sizeof(keys));
+  lookups = 0;
+  hits = 0;
+}
+
+void WordWidthCache::logStats() const {
+  if (lookups == 0) {
+    return;
+  }
+  LOG_DBG("WWC", "Word widths: %lu of %lu measurements cached (%lu%%)", static_cast<unsigned long>(hits),
+          static_cast<unsigned long>(lookups), static_cast<unsigned long>(hits * 100ull / lookups));
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <EpdFontFamily.h>
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Advance widths of words already measured while building a section, so that each distinct word is measured once
+ * per font and style rather than at every occurrence. Direct-mapped: a word whose slot is taken replaces the older
+ * entry.
+ *
+ * Entries are keyed by a 64-bit hash of (fontId, style, text), so a cache shared across fonts never returns another
+ * font's width. Font ids are fixed for built-in fonts and derived from the file contents for SD card fonts, so a
+ * width only goes stale if a caller reuses an id for other glyphs; clear() covers that case.
+ */
+class WordWidthCache {
+ public:
+  static constexpr uint16_t CAPACITY = 512;  // Power of two; 5KB
+
+  static uint64_t makeKey(int fontId, EpdFontFamily::Style style, const char* text, size_t length,
+                          bool appendHyphen);
+
+  bool lookup(uint64_t key, uint16_t& width);
+  void store(uint64_t key, uint16_t width);
+  void clear();
+
+  uint32_t getLookups() const { return lookups; }
+  uint32_t getHits() const { return hits; }
+  void logStats() const;
+
+ private:
+  uint64_t keys[CAPACITY] = {};  // 0 marks an empty slot
+  uint16_t widths[CAPACITY] = {};
+  uint32_t lookups = 0;
+  uint32_t hits = 0;
+};
@@ -4,18 +4,33 @@
 #include <Logging.h>
 #include <Serialization.h>
 
+#include <algorithm>
+#include <cstring>
+
+#include "../ImagePack.h"
 #include "../converters/DirectPixelWriter.h"
 #include "../converters/ImageDecoderFactory.h"
 
-// Cache file format:
-// - uint16_t width
-// - uint16_t height
-// - uint8_t pixels[...] - 2 bits per pixel, packed (4 pixels per byte), row-major order
+// Decoded images are cached next to the extracted image file; see PixelCache.h for the format
 
-ImageBlock::ImageBlock(const std::string& imagePath, int16_t width, int16_t height)
-    : imagePath(imagePath), width(width), height(height) {}
+ImageBlock::ImageBlock(const std::string& imagePath, const std::string& sourcePath, int16_t width, int16_t height)
+    : imagePath(imagePath), sourcePath(sourcePath), width(width), height(height) {}
 
-bool ImageBlock::imageExists() const { return Storage.exists(imagePath.c_str()); }
+bool ImageBlock::imageExists() const { return ImagePack::contains(imagePath); }
+
+namespace {
+std::string getCachePath(const std::string& imagePath);
+}
+
+bool ImageBlock::hasImageData() const { return imageExists() || hasPixelCache(); }
+
+bool ImageBlock::hasPixelCache() const { return Storage.exists(getCachePath(imagePath).c_str()); }
+
+void ImageBlock::setToneProfile(const PixelCache::ToneProfile& profile) const {
+  toneRead = true;
+  toneProfile = profile;
+  tone = profile.bilevel ? Tone::Bilevel : Tone::Gray;
+}
 
 namespace {
 
@@ -28,15 +43,23 @@ std::string getCachePath(const std::string& imagePath) {
   return imagePath + ".pxc";
 }
 
-bool renderFromCache(GfxRenderer& renderer, const std::string& cachePath, int x, int y, int expectedWidth,
-                     int expectedHeight) {
-  FsFile cacheFile;
+// Rows read from the cache per SD access
+constexpr int CACHE_READ_BYTES = 4096;
+
+// Opens a pixel cache and reads its header, checking that the cache is complete and at about the laid-out size
+bool openCache(const std::string& cachePath, const int expectedWidth, const int expectedHeight, FsFile& cacheFile,
+               uint16_t& cachedWidth, uint16_t& cachedHeight, PixelCache::ToneProfile& tone) {
   if (!Storage.openFileForRead("IMG", cachePath, cacheFile)) {
     return false;
   }
 
-  uint16_t cachedWidth, cachedHeight;
-  if (cacheFile.read(&cachedWidth, 2) != 2 || cacheFile.read(&cachedHeight, 2) != 2) {
+  char magic[sizeof(PixelCache::MAGIC)];
+  if (cacheFile.read(magic, sizeof(magic)) != sizeof(magic) || cacheFile.read(&cachedWidth, 2) != 2 ||
+      cacheFile.read(&cachedHeight, 2) != 2 || cacheFile.read(&tone, sizeof(tone)) != sizeof(tone)) {
+    return false;
+  }
+  if (memcmp(magic, PixelCache::MAGIC, sizeof(magic)) != 0) {
+    LOG_DBG("IMG", "Ignoring cache in an older format: %s", cachePath.c_str());
     return false;
   }
 
@@ -49,16 +72,43 @@ bool renderFromCache(GfxRenderer& renderer, const std::string& cachePath, int x,
     return false;
   }
 
-  // Use cached dimensions for rendering (they're the actual decoded size)
-  expectedWidth = cachedWidth;
-  expectedHeight = cachedHeight;
+  // A cache file is only renamed into place once complete, but check rather than draw half an image
+  const int bytesPerRow = (cachedWidth + 3) / 4;  // 2 bits per pixel, 4 pixels per byte
+  if (cacheFile.fileSize() != PixelCache::HEADER_SIZE + (size_t)bytesPerRow * cachedHeight) {
+    LOG_ERR("IMG", "Cache file has the wrong size: %s", cachePath.c_str());
+    return false;
+  }
+  return true;
+}
+
+bool renderFromCache(GfxRenderer& renderer, const std::string& cachePath, int x, int y, int expectedWidth,
+                     int expectedHeight, PixelCache::ToneProfile& tone) {
+  FsFile cacheFile;
+  uint16_t cachedWidth, cachedHeight;
+  if (!openCache(cachePath, expectedWidth, expectedHeight, cacheFile, cachedWidth, cachedHeight, tone)) {
+    return false;
+  }
+  const int bytesPerRow = (cachedWidth + 3) / 4;  // 2 bits per pixel, 4 pixels per byte
 
   LOG_DBG("IMG", "Loading from cache: %s (%dx%d)", cachePath.c_str(), cachedWidth, cachedHeight);
 
-  // Read and render row by row to minimize memory usage
-  const int bytesPerRow = (cachedWidth + 3) / 4;  // 2 bits per pixel, 4 pixels per byte
-  uint8_t* rowBuffer = (uint8_t*)malloc(bytesPerRow);
-  if (!rowBuffer) {
+  // White pixels are left alone in every render mode, so only the rows and columns with ink are read and drawn
+  const int firstInkRow = tone.inkY;
+  const int endInkRow = std::min<int>(tone.inkY + tone.inkHeight, cachedHeight);
+  const int firstInkCol = tone.inkX;
+  const int endInkCol = std::min<int>(tone.inkX + tone.inkWidth, cachedWidth);
+  if (endInkRow <= firstInkRow || endInkCol <= firstInkCol) {
+    return true;  // Blank
+  }
+  if (!cacheFile.seek(PixelCache::HEADER_SIZE + (size_t)bytesPerRow * firstInkRow)) {
+    LOG_ERR("IMG", "Cache seek error at row %d", firstInkRow);
+    return false;
+  }
+
+  // Read a few rows at a time and render row by row to keep memory small
+  const int rowsPerRead = std::max(1, std::min<int>(CACHE_READ_BYTES / bytesPerRow, endInkRow - firstInkRow));
+  uint8_t* readBuffer = (uint8_t*)malloc((size_t)bytesPerRow * rowsPerRead);
+  if (!readBuffer) {
     LOG_ERR("IMG", "Failed to allocate row buffer");
     return false;
   }
@@ -66,32 +116,73 @@ bool renderFromCache(GfxRenderer& renderer, const std::string& cachePath, int x,
   DirectPixelWriter pw;
   pw.init(renderer);
 
-  for (int row = 0; row < cachedHeight; row++) {
-    if (cacheFile.read(rowBuffer, bytesPerRow) != bytesPerRow) {
-      LOG_ERR("IMG", "Cache read error at row %d", row);
-      free(rowBuffer);
+  for (int firstRow = firstInkRow; firstRow < endInkRow; firstRow += rowsPerRead) {
+    const int rows = std::min(rowsPerRead, endInkRow - firstRow);
+    if (cacheFile.read(readBuffer, bytesPerRow * rows) != bytesPerRow * rows) {
+      LOG_ERR("IMG", "Cache read error at row %d", firstRow);
+      free(readBuffer);
       return false;
     }
 
-    const int destY = y + row;
-    pw.beginRow(destY);
-    for (int col = 0; col < cachedWidth; col++) {
-      const int byteIdx = col >> 2;            // col / 4
-      const int bitShift = 6 - (col & 3) * 2;  // MSB first within byte
-      uint8_t pixelValue = (rowBuffer[byteIdx] >> bitShift) & 0x03;
-
-      pw.writePixel(x + col, pixelValue);
+    for (int r = 0; r < rows; r++) {
+      const uint8_t* rowBuffer = readBuffer + r * bytesPerRow;
+      pw.beginRow(y + firstRow + r);
+      for (int col = firstInkCol; col < endInkCol; col++) {
+        const int byteIdx = col >> 2;  // col / 4
+        if (rowBuffer[byteIdx] == PixelCache::BLANK) {
+          col |= 3;  // Four white pixels; the loop moves on to the next byte
+          continue;
+        }
+        const int bitShift = 6 - (col & 3) * 2;  // MSB first within byte
+        uint8_t pixelValue = (rowBuffer[byteIdx] >> bitShift) & 0x03;
+
+        pw.writePixel(x + col, pixelValue);
+      }
     }
   }
 
-  free(rowBuffer);
+  free(readBuffer);
   LOG_DBG("IMG", "Cache render complete");
   return true;
 }
 
 }  // namespace
 
+ImageBlock::Tone ImageBlock::getTone() const {
+  if (!toneRead) {
+    toneRead = true;
+    FsFile cacheFile;
+    uint16_t cachedWidth, cachedHeight;
+    PixelCache::ToneProfile profile;
+    if (hasPixelCache() &&
+        openCache(getCachePath(imagePath), width, height, cacheFile, cachedWidth, cachedHeight, profile)) {
+      setToneProfile(profile);
+    }
+  }
+  return tone;
+}
+
+bool ImageBlock::getInkBounds(int16_t& x, int16_t& y, int16_t& w, int16_t& h) const {
+  if (getTone() == Tone::Unknown) {
+    x = 0;
+    y = 0;
+    w = width;
+    h = height;
+    return true;
+  }
+  x = static_cast<int16_t>(toneProfile.inkX);
+  y = static_cast<int16_t>(toneProfile.inkY);
+  w = static_cast<int16_t>(std::min<int>(toneProfile.inkWidth, width - x));
+  h = static_cast<int16_t>(std::min<int>(toneProfile.inkHeight, height - y));
+  return w > 0 && h > 0;
+}
+
 void ImageBlock::render(GfxRenderer& renderer, const int x, const int y) {
+  // The grayscale passes draw only gray pixels
+  if (renderer.getRenderMode() != GfxRenderer::BW && getTone() == Tone::Bilevel) {
+    return;
+  }
+
   LOG_DBG("IMG", "Rendering image at %d,%d: %s (%dx%d)", x, y, imagePath.c_str(), width, height);
 
   const int screenWidth = renderer.getScreenWidth();
@@ -106,14 +197,16 @@ void ImageBlock::render(GfxRenderer& renderer, const int x, const int y) {
 
   // Try to render from cache first
   std::string cachePath = getCachePath(imagePath);
-  if (renderFromCache(renderer, cachePath, x, y, width, height)) {
+  PixelCache::ToneProfile profile;
+  if (renderFromCache(renderer, cachePath, x, y, width, height, profile)) {
+    setToneProfile(profile);
     return;  // Successfully rendered from cache
   }
 
   // No cache - need to decode the image
   // Check if image file exists
-  FsFile file;
-  if (!Storage.openFileForRead("IMG", imagePath, file)) {
+  ImagePack::Reader file;
+  if (!file.open(imagePath)) {
     LOG_ERR("IMG", "Image file not found: %s", imagePath.c_str());
     return;
   }
@@ -147,6 +240,9 @@ void ImageBlock::render(GfxRenderer& renderer, const int x, const int y) {
   LOG_DBG("IMG", "Using %s decoder", decoder->getFormatName());
 
   bool success = decoder->decodeToFramebuffer(imagePath, renderer, config);
+  // The decode wrote a new cache, with the image's tone
+  toneRead = false;
+  tone = Tone::Unknown;
   if (!success) {
     LOG_ERR("IMG", "Failed to decode image: %s", imagePath.c_str());
     return;
@@ -155,18 +251,21 @@ void ImageBlock::render(GfxRenderer& renderer, const int x, const int y) {
   LOG_DBG("IMG", "Decode successful");
 }
 
-bool ImageBlock::serialize(FsFile& file) {
-  serialization::writeString(file, imagePath);
-  serialization::writePod(file, width);
-  serialization::writePod(file, height);
+bool ImageBlock::serialize(BufferedFileWriter& writer) {
+  serialization::writeString(writer, imagePath);
+  serialization::writePod(writer, width);
+  serialization::writePod(writer, height);
+  serialization::writeString(writer, sourcePath);
   return true;
 }
 
-std::unique_ptr<ImageBlock> ImageBlock::deserialize(FsFile& file) {
+std::unique_ptr<ImageBlock> ImageBlock::deserialize(BufferedFileReader& reader) {
   std::string path;
-  serialization::readString(file, path);
+  serialization::readString(reader, path);
   int16_t w, h;
-  serialization::readPod(file, w);
-  serialization::readPod(file, h);
-  return std::unique_ptr<ImageBlock>(new ImageBlock(path, w, h));
+  serialization::readPod(reader, w);
+  serialization::readPod(reader, h);
+  std::string source;
+  serialization::readString(reader, source);
+  return std::unique_ptr<ImageBlock>(new ImageBlock(path, source, w, h));
 }
@@ -1,31 +1,57 @@
 #pragma once
+#include <BufferedFileReader.h>
+#include <BufferedFileWriter.h>
 #include <HalStorage.h>
 
 #include <memory>
 #include <string>
 
+#include "../converters/PixelCache.h"
 #include "Block.h"
 
 class ImageBlock final : public Block {
  public:
-  ImageBlock(const std::string& imagePath, int16_t width, int16_t height);
+  // imagePath names the image as extracted into the book's ImagePack, sourcePath is the image's path in the EPUB
+  ImageBlock(const std::string& imagePath, const std::string& sourcePath, int16_t width, int16_t height);
   ~ImageBlock() override = default;
 
   const std::string& getImagePath() const { return imagePath; }
+  const std::string& getSourcePath() const { return sourcePath; }
   int16_t getWidth() const { return width; }
   int16_t getHeight() const { return height; }
 
+  // Whether the image was extracted into the pack; answered from memory
   bool imageExists() const;
+  // Whether render() has something to draw from: the extracted image or the decoded pixel cache next to it. Layout
+  // only reads an image's size from the EPUB, the image is extracted when a page showing it is first loaded.
+  bool hasImageData() const;
+  // Whether the image was decoded before and can be drawn from its pixel cache
+  bool hasPixelCache() const;
+
+  enum class Tone : uint8_t { Unknown, Bilevel, Gray };
+  // Read from the pixel cache the first time it is asked for, so Unknown until the image was decoded once. A bilevel
+  // image is drawn in the black and white frame only; the grayscale passes skip it.
+  Tone getTone() const;
+  // Bounds of the image's pixels that aren't white, relative to its top left; the whole image while the tone is
+  // unknown. False for a blank image.
+  bool getInkBounds(int16_t& x, int16_t& y, int16_t& w, int16_t& h) const;
 
   BlockType getType() override { return IMAGE_BLOCK; }
   bool isEmpty() override { return false; }
 
   void render(GfxRenderer& renderer, const int x, const int y);
-  bool serialize(FsFile& file);
-  static std::unique_ptr<ImageBlock> deserialize(FsFile& file);
+  bool serialize(BufferedFileWriter& writer);
+  static std::unique_ptr<ImageBlock> deserialize(BufferedFileReader& reader);
 
  private:
   std::string imagePath;
+  std::string sourcePath;
   int16_t width;
   int16_t height;
+  // From the pixel cache header; render() sets them when it draws from the cache and clears toneRead when it decodes
+  mutable bool toneRead = false;
+  mutable Tone tone = Tone::Unknown;
+  mutable PixelCache::ToneProfile toneProfile = {};
+
+  void setToneProfile(const PixelCache::ToneProfile& profile) const;
 };
@@ -1,9 +1,41 @@
 #include "TextBlock.h"
 
+#include <FontCacheManager.h>
 #include <GfxRenderer.h>
 #include <Logging.h>
 #include <Serialization.h>
 
+void TextBlock::renderWord(const GfxRenderer& renderer, const int fontId, const int wordX, const int y,
+                           const char* word, const EpdFontFamily::Style style, const uint8_t* glyphs,
+                           const uint16_t glyphCount) {
+  if (glyphCount > 0) {
+    renderer.drawGlyphRun(fontId, wordX, y, word, glyphs, glyphCount, true, style);
+  } else {
+    renderer.drawText(fontId, wordX, y, word, true, style);
+  }
+
+  if ((style & EpdFontFamily::UNDERLINE) != 0) {
+    const int fullWordWidth = renderer.getTextWidth(fontId, word, style);
+    // y is the top of the text line; add ascender to reach baseline, then offset 2px below
+    const int underlineY = y + renderer.getFontAscenderSize(fontId) + 2;
+
+    int startX = wordX;
+    int underlineWidth = fullWordWidth;
+
+    // if word starts with em-space ("\xe2\x80\x83"), account for the additional indent before drawing the line
+    if (static_cast<uint8_t>(word[0]) == 0xE2 && static_cast<uint8_t>(word[1]) == 0x80 &&
+        static_cast<uint8_t>(word[2]) == 0x83) {
+      const char* visiblePtr = word + 3;
+      const int prefixWidth = renderer.getTextAdvanceX(fontId, "\xe2\x80\x83", style);
+      const int visibleWidth = renderer.getTextWidth(fontId, visiblePtr, style);
+      startX = wordX + prefixWidth;
+      underlineWidth = visibleWidth;
+    }
+
+    renderer.drawLine(startX, underlineY, startX + underlineWidth, underlineY, true);
+  }
+}
+
 void TextBlock::render(const GfxRenderer& renderer, const int fontId, const int x, const int y) const {
   // Validate iterator bounds before rendering
   if (words.size() != wordXpos.size() || words.size() != wordStyles.size()) {
@@ -13,65 +45,82 @@ void TextBlock::render(const GfxRenderer& renderer, const int fontId, const int
   }
 
   for (size_t i = 0; i < words.size(); i++) {
-    const int wordX = wordXpos[i] + x;
-    const EpdFontFamily::Style currentStyle = wordStyles[i];
-    renderer.drawText(fontId, wordX, y, words[i].c_str(), true, currentStyle);
-
-    if ((currentStyle & EpdFontFamily::UNDERLINE) != 0) {
-      const std::string& w = words[i];
-      const int fullWordWidth = renderer.getTextWidth(fontId, w.c_str(), currentStyle);
-      // y is the top of the text line; add ascender to reach baseline, then offset 2px below
-      const int underlineY = y + renderer.getFontAscenderSize(fontId) + 2;
-
-      int startX = wordX;
-      int underlineWidth = fullWordWidth;
-
-      // if word starts with em-space ("\xe2\x80\x83"), account for the additional indent before drawing the line
-      if (w.size() >= 3 && static_cast<uint8_t>(w[0]) == 0xE2 && static_cast<uint8_t>(w[1]) == 0x80 &&
-          static_cast<uint8_t>(w[2]) == 0x83) {
-        const char* visiblePtr = w.c_str() + 3;
-        const int prefixWidth = renderer.getTextAdvanceX(fontId, "\xe2\x80\x83", currentStyle);
-        const int visibleWidth = renderer.getTextWidth(fontId, visiblePtr, currentStyle);
-        startX = wordX + prefixWidth;
-        underlineWidth = visibleWidth;
-      }
-
-      renderer.drawLine(startX, underlineY, startX + underlineWidth, underlineY, true);
-    }
+    renderWord(renderer, fontId, wordXpos[i] + x, y, words[i].c_str(), wordStyles[i]);
+  }
+}
+
+void TextBlock::recordGlyphs(FontCacheManager& fontCache, const int fontId) const {
+  for (size_t i = 0; i < words.size() && i < wordStyles.size(); i++) {
+    fontCache.recordText(words[i].c_str(), fontId, wordStyles[i]);
   }
 }
 
-bool TextBlock::serialize(FsFile& file) const {
+bool TextBlock::serialize(BufferedFileWriter& writer, const GfxRenderer* renderer, const int fontId) const {
   if (words.size() != wordXpos.size() || words.size() != wordStyles.size()) {
     LOG_ERR("TXB", "Serialization failed: size mismatch (words=%u, xpos=%u, styles=%u)\n", words.size(),
             wordXpos.size(), wordStyles.size());
     return false;
   }
 
-  // Word data
-  serialization::writePod(file, static_cast<uint16_t>(words.size()));
-  for (const auto& w : words) serialization::writeString(file, w);
-  for (auto x : wordXpos) serialization::writePod(file, x);
-  for (auto s : wordStyles) serialization::writePod(file, s);
+  // Word data: the words, the styles as runs (a style, then the varint count of the words in a row that have it),
+  // then each word's x as a signed varint delta from the previous word's
+  serialization::writePod(writer, static_cast<uint16_t>(words.size()));
+  for (const auto& w : words) serialization::writeString(writer, w);
+  for (size_t i = 0; i < wordStyles.size();) {
+    size_t run = 1;
+    while (i + run < wordStyles.size() && wordStyles[i + run] == wordStyles[i]) {
+      run++;
+    }
+    serialization::writePod(writer, wordStyles[i]);
+    serialization::writeVarint(writer, run);
+    i += run;
+  }
+  int16_t previousX = 0;
+  for (const int16_t x : wordXpos) {
+    serialization::writeSignedVarint(writer, x - previousX);
+    previousX = x;
+  }
 
   // Style (alignment + margins/padding/indent)
-  serialization::writePod(file, blockStyle.alignment);
-  serialization::writePod(file, blockStyle.textAlignDefined);
-  serialization::writePod(file, blockStyle.marginTop);
-  serialization::writePod(file, blockStyle.marginBottom);
-  serialization::writePod(file, blockStyle.marginLeft);
-  serialization::writePod(file, blockStyle.marginRight);
-  serialization::writePod(file, blockStyle.paddingTop);
-  serialization::writePod(file, blockStyle.paddingBottom);
-  serialization::writePod(file, blockStyle.paddingLeft);
-  serialization::writePod(file, blockStyle.paddingRight);
-  serialization::writePod(file, blockStyle.textIndent);
-  serialization::writePod(file, blockStyle.textIndentDefined);
+  serialization::writePod(writer, blockStyle.alignment);
+  serialization::writePod(writer, blockStyle.textAlignDefined);
+  serialization::writePod(writer, blockStyle.marginTop);
+  serialization::writePod(writer, blockStyle.marginBottom);
+  serialization::writePod(writer, blockStyle.marginLeft);
+  serialization::writePod(writer, blockStyle.marginRight);
+  serialization::writePod(writer, blockStyle.paddingTop);
+  serialization::writePod(writer, blockStyle.paddingBottom);
+  serialization::writePod(writer, blockStyle.paddingLeft);
+  serialization::writePod(writer, blockStyle.paddingRight);
+  serialization::writePod(writer, blockStyle.textIndent);
+  serialization::writePod(writer, blockStyle.textIndentDefined);
+
+  // Glyph runs: total glyph count (0 = none), then each word's glyph count (0 = draw as text), then the glyphs
+  std::vector<uint16_t> runLengths;
+  std::vector<PlacedGlyph> glyphs;
+  if (renderer) {
+    runLengths.reserve(words.size());
+    for (size_t i = 0; i < words.size(); i++) {
+      const size_t before = glyphs.size();
+      const bool resolved = renderer->resolveGlyphRun(fontId, words[i].c_str(), wordStyles[i], glyphs);
+      runLengths.push_back(resolved ? static_cast<uint16_t>(glyphs.size() - before) : 0);
+    }
+  }
+  const uint16_t glyphCount = glyphs.size() <= UINT16_MAX ? static_cast<uint16_t>(glyphs.size()) : 0;
+  serialization::writePod(writer, glyphCount);
+  if (glyphCount > 0) {
+    for (auto len : runLengths) serialization::writePod(writer, len);
+    const size_t glyphBytes = glyphs.size() * sizeof(PlacedGlyph);
+    if (writer.write(reinterpret_cast<const uint8_t*>(glyphs.data()), glyphBytes) != glyphBytes) {
+      LOG_ERR("TXB", "Failed to write glyph runs");
+      return false;
+    }
+  }
 
   return true;
 }
 
-std::unique_ptr<TextBlock> TextBlock::deserialize(FsFile& file) {
+std::unique_ptr<TextBlock> TextBlock::deserialize(BufferedFileReader& reader) {
   uint16_t wc;
   std::vector<std::string> words;
   std::vector<int16_t> wordXpos;
@@ -79,7 +128,7 @@ std::unique_ptr<TextBlock> TextBlock::deserialize(FsFile& file) {
   BlockStyle blockStyle;
 
   // Word count
-  serialization::readPod(file, wc);
+  serialization::readPod(reader, wc);
 
   // Sanity check: prevent allocation of unreasonably large vectors (max 10000 words per block)
   if (wc > 10000) {
@@ -89,25 +138,50 @@ std::unique_ptr<TextBlock> TextBlock::deserialize(FsFile& file) {
 
   // Word data
   words.resize(wc);
-  wordXpos.resize(wc);
-  wordStyles.resize(wc);
-  for (auto& w : words) serialization::readString(file, w);
-  for (auto& x : wordXpos) serialization::readPod(file, x);
-  for (auto& s : wordStyles) serialization::readPod(file, s);
+  wordXpos.reserve(wc);
+  wordStyles.reserve(wc);
+  for (auto& w : words) serialization::readString(reader, w);
+  while (wordStyles.size() < wc) {
+    EpdFontFamily::Style style;
+    uint32_t run;
+    serialization::readPod(reader, style);
+    if (!serialization::readVarint(reader, run) || run == 0 || run > wc - wordStyles.size()) {
+      LOG_ERR("TXB", "Deserialization failed: bad style run");
+      return nullptr;
+    }
+    wordStyles.insert(wordStyles.end(), run, style);
+  }
+  int16_t x = 0;
+  for (uint16_t i = 0; i < wc; i++) {
+    int32_t delta;
+    if (!serialization::readSignedVarint(reader, delta)) {
+      LOG_ERR("TXB", "Deserialization failed: truncated x positions");
+      return nullptr;
+    }
+    x = static_cast<int16_t>(x + delta);
+    wordXpos.push_back(x);
+  }
 
   // Style (alignment + margins/padding/indent)
-  serialization::readPod(file, blockStyle.alignment);
-  serialization::readPod(file, blockStyle.textAlignDefined);
-  serialization::readPod(file, blockStyle.marginTop);
-  serialization::readPod(file, blockStyle.marginBottom);
-  serialization::readPod(file, blockStyle.marginLeft);
-  serialization::readPod(file, blockStyle.marginRight);
-  serialization::readPod(file, blockStyle.paddingTop);
-  serialization::readPod(file, blockStyle.paddingBottom);
-  serialization::readPod(file, blockStyle.paddingLeft);
-  serialization::readPod(file, blockStyle.paddingRight);
-  serialization::readPod(file, blockStyle.textIndent);
-  serialization::readPod(file, blockStyle.textIndentDefined);
+  serialization::readPod(reader, blockStyle.alignment);
+  serialization::readPod(reader, blockStyle.textAlignDefined);
+  serialization::readPod(reader, blockStyle.marginTop);
+  serialization::readPod(reader, blockStyle.marginBottom);
+  serialization::readPod(reader, blockStyle.marginLeft);
+  serialization::readPod(reader, blockStyle.marginRight);
+  serialization::readPod(reader, blockStyle.paddingTop);
+  serialization::readPod(reader, blockStyle.paddingBottom);
+  serialization::readPod(reader, blockStyle.paddingLeft);
+  serialization::readPod(reader, blockStyle.paddingRight);
+  serialization::readPod(reader, blockStyle.textIndent);
+  serialization::readPod(reader, blockStyle.textIndentDefined);
+
+  // Glyph runs are only used when rendering from the page arena, skip them
+  uint16_t glyphCount;
+  serialization::readPod(reader, glyphCount);
+  if (glyphCount > 0) {
+    reader.skip(wc * sizeof(uint16_t) + glyphCount * sizeof(PlacedGlyph));
+  }
 
   return std::unique_ptr<TextBlock>(
       new TextBlock(std::move(words), std::move(wordXpos), std::move(wordStyles), blockStyle));
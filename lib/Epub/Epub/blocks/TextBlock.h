@@ -1,4 +1,6 @@
 #pragma once
+#include <BufferedFileReader.h>
+#include <BufferedFileWriter.h>
 #include <EpdFontFamily.h>
 #include <HalStorage.h>
 
@@ -9,6 +11,8 @@
 #include "Block.h"
 #include "BlockStyle.h"
 
+class FontCacheManager;
+
 // Represents a line of text on a page
 class TextBlock final : public Block {
  private:
@@ -28,11 +32,24 @@ class TextBlock final : public Block {
   void setBlockStyle(const BlockStyle& blockStyle) { this->blockStyle = blockStyle; }
   const BlockStyle& getBlockStyle() const { return blockStyle; }
   const std::vector<std::string>& getWords() const { return words; }
+  const std::vector<int16_t>& getWordXpos() const { return wordXpos; }
+  const std::vector<EpdFontFamily::Style>& getWordStyles() const { return wordStyles; }
   bool isEmpty() override { return words.empty(); }
   size_t wordCount() const { return words.size(); }
   // given a renderer works out where to break the words into lines
   void render(const GfxRenderer& renderer, int fontId, int x, int y) const;
+  // Adds the glyphs render() would draw to the prewarm scan, see FontCacheManager::PrewarmScope
+  void recordGlyphs(FontCacheManager& fontCache, int fontId) const;
+  // Draws a single word of a line at wordX, including its underline. With a glyph run (see serialize()) the glyphs are
+  // drawn as placed at layout time instead of decoding the word again.
+  static void renderWord(const GfxRenderer& renderer, int fontId, int wordX, int y, const char* word,
+                         EpdFontFamily::Style style, const uint8_t* glyphs = nullptr, uint16_t glyphCount = 0);
+  // Bytes of block style that serialize() writes after the word data
+  static constexpr size_t SERIALIZED_STYLE_SIZE = sizeof(BlockStyle::alignment) + sizeof(BlockStyle::textAlignDefined) +
+                                                  9 * sizeof(int16_t) + sizeof(BlockStyle::textIndentDefined);
   BlockType getType() override { return TEXT_BLOCK; }
-  bool serialize(FsFile& file) const;
-  static std::unique_ptr<TextBlock> deserialize(FsFile& file);
+  // With a renderer, each word's glyph run is resolved and stored after the block style, so page rendering can skip
+  // UTF-8 decoding, ligatures, kerning and glyph lookups. Without one (checkpoints) the line is stored without runs.
+  bool serialize(BufferedFileWriter& writer, const GfxRenderer* renderer = nullptr, int fontId = 0) const;
+  static std::unique_ptr<TextBlock> deserialize(BufferedFileReader& reader);
 };
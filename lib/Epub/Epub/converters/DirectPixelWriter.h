@@ -4,6 +4,8 @@
 #include <HalDisplay.h>
 #include <stdint.h>
 
+#include "PixelCache.h"
+
 // Direct framebuffer writer that eliminates per-pixel overhead from the image
 // rendering hot path.  Pre-computes orientation transform as linear coefficients
 // and caches render-mode state so the inner loop is: one multiply, one add,
@@ -136,20 +138,18 @@ struct DirectPixelWriter {
 //
 // Caller guarantees coordinates are within cache bounds.
 struct DirectCacheWriter {
-  uint8_t* buffer;
-  int bytesPerRow;
+  PixelCache* cache;
   int originX;
   uint8_t* rowPtr;  // Pre-computed for current row
 
-  void init(uint8_t* cacheBuffer, int cacheBytesPerRow, int cacheOriginX) {
-    buffer = cacheBuffer;
-    bytesPerRow = cacheBytesPerRow;
-    originX = cacheOriginX;
+  void init(PixelCache& pixelCache) {
+    cache = &pixelCache;
+    originX = pixelCache.originX;
     rowPtr = nullptr;
   }
 
   // Call once per row before the column loop.
-  inline void beginRow(int screenY, int cacheOriginY) { rowPtr = buffer + (screenY - cacheOriginY) * bytesPerRow; }
+  inline void beginRow(int screenY) { rowPtr = cache->row(screenY - cache->originY); }
 
   // Write a 2-bit pixel value. No bounds checking.
   inline void writePixel(int screenX, uint8_t value) const {
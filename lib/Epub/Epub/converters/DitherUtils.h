@@ -10,18 +10,22 @@ inline const uint8_t bayer4x4[4][4] = {
     {15, 7, 13, 5},
 };
 
+// The gray each Bayer cell needs for levels 1, 2 and 3: the thresholds 64/128/192 less the cell's offset
+// (bayer - 8) * 5, which scales to +/-40 (half of the quantization step 85). Comparing against these is the same as
+// adding the offset, clamping and comparing against 64/128/192.
+inline const uint8_t bayerThresholds4Level[4][4][3] = {
+    {{104, 168, 232}, {64, 128, 192}, {94, 158, 222}, {54, 118, 182}},
+    {{44, 108, 172}, {84, 148, 212}, {34, 98, 162}, {74, 138, 202}},
+    {{89, 153, 217}, {49, 113, 177}, {99, 163, 227}, {59, 123, 187}},
+    {{29, 93, 157}, {69, 133, 197}, {39, 103, 167}, {79, 143, 207}},
+};
+
+// The lowest gray every cell dithers to level 3 (white), the largest threshold above
+constexpr uint8_t BAYER_WHITE_GRAY = 232;
+
 // Apply Bayer dithering and quantize to 4 levels (0-3)
 // Stateless - works correctly with any pixel processing order
 inline uint8_t applyBayerDither4Level(uint8_t gray, int x, int y) {
-  int bayer = bayer4x4[y & 3][x & 3];
-  int dither = (bayer - 8) * 5;  // Scale to +/-40 (half of quantization step 85)
-
-  int adjusted = gray + dither;
-  if (adjusted < 0) adjusted = 0;
-  if (adjusted > 255) adjusted = 255;
-
-  if (adjusted < 64) return 0;
-  if (adjusted < 128) return 1;
-  if (adjusted < 192) return 2;
-  return 3;
+  const uint8_t* threshold = bayerThresholds4Level[y & 3][x & 3];
+  return (gray >= threshold[0]) + (gray >= threshold[1]) + (gray >= threshold[2]);
 }
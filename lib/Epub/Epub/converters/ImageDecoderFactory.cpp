@@ -2,27 +2,108 @@
 
 #include <Logging.h>
 
+#include <cstring>
 #include <memory>
 #include <string>
 
 #include "JpegToFramebufferConverter.h"
 #include "PngToFramebufferConverter.h"
 
-std::unique_ptr<JpegToFramebufferConverter> ImageDecoderFactory::jpegDecoder = nullptr;
-std::unique_ptr<PngToFramebufferConverter> ImageDecoderFactory::pngDecoder = nullptr;
+namespace {
+using ReadFn = std::function<int(void*, size_t)>;
 
-ImageToFramebufferDecoder* ImageDecoderFactory::getDecoder(const std::string& imagePath) {
-  std::string ext = imagePath;
-  size_t dotPos = ext.rfind('.');
-  if (dotPos != std::string::npos) {
-    ext = ext.substr(dotPos);
-    for (auto& c : ext) {
-      c = tolower(c);
+// ".jpg" of "a/b.JPG", empty without an extension
+std::string lowercaseExtension(const std::string& imagePath) {
+  const size_t dotPos = imagePath.rfind('.');
+  if (dotPos == std::string::npos) {
+    return "";
+  }
+  std::string ext = imagePath.substr(dotPos);
+  for (auto& c : ext) {
+    c = tolower(c);
+  }
+  return ext;
+}
+
+bool readExactly(const ReadFn& read, void* buf, const size_t count) {
+  size_t done = 0;
+  while (done < count) {
+    const int n = read(static_cast<uint8_t*>(buf) + done, count - done);
+    if (n <= 0) return false;
+    done += n;
+  }
+  return true;
+}
+
+bool skipBytes(const ReadFn& read, size_t count) {
+  uint8_t scratch[64];
+  while (count > 0) {
+    const size_t n = count < sizeof(scratch) ? count : sizeof(scratch);
+    if (!readExactly(read, scratch, n)) return false;
+    count -= n;
+  }
+  return true;
+}
+
+uint16_t bigEndian16(const uint8_t* p) { return static_cast<uint16_t>(p[0] << 8 | p[1]); }
+uint32_t bigEndian32(const uint8_t* p) {
+  return static_cast<uint32_t>(p[0]) << 24 | static_cast<uint32_t>(p[1]) << 16 | static_cast<uint32_t>(p[2]) << 8 |
+         p[3];
+}
+
+bool readPngDimensions(const ReadFn& read, ImageDimensions& dims) {
+  // Signature, then the IHDR chunk, which has to come first: length, type, width, height
+  constexpr uint8_t SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  uint8_t header[24];
+  if (!readExactly(read, header, sizeof(header)) || memcmp(header, SIGNATURE, sizeof(SIGNATURE)) != 0 ||
+      memcmp(header + 12, "IHDR", 4) != 0) {
+    return false;
+  }
+  const uint32_t width = bigEndian32(header + 16);
+  const uint32_t height = bigEndian32(header + 20);
+  if (width == 0 || height == 0 || width > INT16_MAX || height > INT16_MAX) return false;
+  dims.width = static_cast<int16_t>(width);
+  dims.height = static_cast<int16_t>(height);
+  return true;
+}
+
+bool readJpegDimensions(const ReadFn& read, ImageDimensions& dims) {
+  uint8_t marker[2];
+  if (!readExactly(read, marker, 2) || marker[0] != 0xFF || marker[1] != 0xD8) return false;
+  while (true) {
+    // Segments start with 0xFF, which may be repeated as fill
+    if (!readExactly(read, marker, 1) || marker[0] != 0xFF) return false;
+    do {
+      if (!readExactly(read, marker + 1, 1)) return false;
+    } while (marker[1] == 0xFF);
+    const uint8_t type = marker[1];
+    if (type == 0xD9 || type == 0xDA) return false;  // End of image or scan data before any frame header
+    if (type == 0x01 || (type >= 0xD0 && type <= 0xD7)) continue;  // No length
+
+    uint8_t length[2];
+    if (!readExactly(read, length, 2) || bigEndian16(length) < 2) return false;
+    const uint16_t payload = bigEndian16(length) - 2;
+    // Frame headers: baseline, extended and progressive Huffman are what the decoder handles
+    if (type == 0xC0 || type == 0xC1 || type == 0xC2) {
+      uint8_t frame[5];  // Precision, height, width
+      if (payload < sizeof(frame) || !readExactly(read, frame, sizeof(frame))) return false;
+      dims.height = static_cast<int16_t>(bigEndian16(frame + 1));
+      dims.width = static_cast<int16_t>(bigEndian16(frame + 3));
+      return dims.width > 0 && dims.height > 0;
+    }
+    if (type >= 0xC3 && type <= 0xCF && type != 0xC4 && type != 0xC8 && type != 0xCC) {
+      return false;  // Lossless, hierarchical or arithmetic coded
     }
-  } else {
-    ext = "";
+    if (!skipBytes(read, payload)) return false;
   }
+}
+}  // namespace
+
+std::unique_ptr<JpegToFramebufferConverter> ImageDecoderFactory::jpegDecoder = nullptr;
+std::unique_ptr<PngToFramebufferConverter> ImageDecoderFactory::pngDecoder = nullptr;
 
+ImageToFramebufferDecoder* ImageDecoderFactory::getDecoder(const std::string& imagePath) {
+  const std::string ext = lowercaseExtension(imagePath);
   if (JpegToFramebufferConverter::supportsFormat(ext)) {
     if (!jpegDecoder) {
       jpegDecoder.reset(new JpegToFramebufferConverter());
@@ -40,3 +121,20 @@ ImageToFramebufferDecoder* ImageDecoderFactory::getDecoder(const std::string& im
 }
 
 bool ImageDecoderFactory::isFormatSupported(const std::string& imagePath) { return getDecoder(imagePath) != nullptr; }
+
+void ImageDecoderFactory::releaseScratch() {
+  if (jpegDecoder) jpegDecoder->releaseScratch();
+  if (pngDecoder) pngDecoder->releaseScratch();
+}
+
+bool ImageDecoderFactory::readDimensions(const std::string& imagePath, const std::function<int(void*, size_t)>& read,
+                                         ImageDimensions& dims) {
+  const std::string ext = lowercaseExtension(imagePath);
+  if (JpegToFramebufferConverter::supportsFormat(ext)) {
+    return readJpegDimensions(read, dims);
+  }
+  if (PngToFramebufferConverter::supportsFormat(ext)) {
+    return readPngDimensions(read, dims);
+  }
+  return false;
+}
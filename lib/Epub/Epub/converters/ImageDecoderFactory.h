@@ -1,5 +1,6 @@
 #pragma once
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -13,6 +14,14 @@ class ImageDecoderFactory {
   // Returns non-owning pointer - factory owns the decoder lifetime
   static ImageToFramebufferDecoder* getDecoder(const std::string& imagePath);
   static bool isFormatSupported(const std::string& imagePath);
+  // Frees the state the decoders kept from the images drawn since the last call. Called once a page's images are
+  // drawn, so the images of a page share one decoder allocation.
+  static void releaseScratch();
+  // Pixel size of the image from its header alone, read through `read` from the start of its data: the IHDR chunk
+  // of a PNG, the frame header of a JPEG (after the segments before it). No decoder is allocated, so layout can size
+  // an image straight from the EPUB without extracting it. read returns the bytes read, 0 at the end, -1 on errors.
+  static bool readDimensions(const std::string& imagePath, const std::function<int(void*, size_t)>& read,
+                             ImageDimensions& dims);
 
  private:
   static std::unique_ptr<JpegToFramebufferConverter> jpegDecoder;
@@ -31,9 +31,15 @@ class ImageToFramebufferDecoder {
 
   virtual const char* getFormatName() const = 0;
 
+  // decodeToFramebuffer() keeps the decoder state and buffers it allocated for the next image, as a page often has
+  // several; this frees them
+  virtual void releaseScratch() {}
+
  protected:
   // Size validation helpers
-  static constexpr int MAX_SOURCE_PIXELS = 3145728;  // 2048 * 1536
+  // Decoders stream the source in bands (JPEG MCU rows, PNG scanlines), so memory doesn't grow with the source and
+  // only a side length is limited, to keep the fixed-point scaling in range
+  static constexpr int MAX_SOURCE_DIMENSION = 16384;
 
   bool validateImageDimensions(int width, int height, const std::string& format);
   void warnUnsupportedFeature(const std::string& feature, const std::string& imagePath);
@@ -6,8 +6,12 @@
 
 #include "ImageToFramebufferDecoder.h"
 
+class JPEGDEC;
+
 class JpegToFramebufferConverter final : public ImageToFramebufferDecoder {
  public:
+  ~JpegToFramebufferConverter() override { releaseScratch(); }
+
   static bool getDimensionsStatic(const std::string& imagePath, ImageDimensions& out);
 
   bool decodeToFramebuffer(const std::string& imagePath, GfxRenderer& renderer, const RenderConfig& config) override;
@@ -18,4 +22,8 @@ class JpegToFramebufferConverter final : public ImageToFramebufferDecoder {
 
   static bool supportsFormat(const std::string& extension);
   const char* getFormatName() const override { return "JPEG"; }
+  void releaseScratch() override;
+
+ private:
+  JPEGDEC* jpeg = nullptr;
 };
@@ -4,42 +4,128 @@
 #include <Logging.h>
 #include <stdint.h>
 
+#include <cstdlib>
 #include <cstring>
 #include <string>
 
-// Cache buffer for storing 2-bit pixels (4 levels) during decode.
-// Packs 4 pixels per byte, MSB first.
+// Display-ready copy of a decoded image, written while decoding so ImageBlock::render can redraw the image from the
+// SD card instead of decoding it again. Pixels are stored dithered at the laid-out size, in logical (pre-rotation)
+// coordinates, so the cache holds for every orientation.
+//
+// Cache file format:
+// - char magic[4] - "PXC2"
+// - uint16_t width
+// - uint16_t height
+// - ToneProfile tone - written last, once every pixel is known
+// - uint8_t pixels[...] - 2 bits per pixel, packed (4 pixels per byte, MSB first), row-major order
+//
+// Decoders produce rows top to bottom, so only a window of rows is held in memory: a decoder calls completeRows()
+// once every row above some point is final, and those rows go straight to the file. The file is written under a
+// temporary name and only renamed into place by finish(), so a failed decode never leaves a truncated cache.
 struct PixelCache {
-  uint8_t* buffer;
+  // How the image uses the panel's tones. Line art and ornaments come out bilevel, which the grayscale passes leave
+  // alone, so a page of them needs no more than a black and white frame.
+  struct ToneProfile {
+    uint8_t bilevel;  // 1 when every pixel is black or white
+    uint8_t reserved;
+    uint16_t inkPermille;  // Share of the pixels that aren't white
+    // Bounds of the pixels that aren't white; inkWidth 0 for a blank image
+    uint16_t inkX;
+    uint16_t inkY;
+    uint16_t inkWidth;
+    uint16_t inkHeight;
+  };
+  static_assert(sizeof(ToneProfile) == 12, "ToneProfile is stored as is");
+
+  static constexpr char MAGIC[4] = {'P', 'X', 'C', '2'};
+  static constexpr int TONE_OFFSET = 8;
+  static constexpr int HEADER_SIZE = TONE_OFFSET + sizeof(ToneProfile);
+  // Pixels the decoder never writes are stored as white (3), which every render mode leaves alone, as on screen
+  static constexpr uint8_t BLANK = 0xFF;
+
+  uint8_t* buffer;  // windowRows rows, then one scratch row that absorbs writes outside the window
   int width;
   int height;
   int bytesPerRow;
-  int originX;  // config.x - to convert screen coords to cache coords
-  int originY;  // config.y
+  int originX;      // config.x - to convert screen coords to cache coords
+  int originY;      // config.y
+  int windowStart;  // Image row held in the first buffer row
+  int windowRows;
+  bool failed;  // A write fell outside the window or the file; the cache is dropped
+  FsFile file;
+  std::string path;
+  // Tone profile of the rows written so far
+  uint32_t inkPixels;
+  uint32_t grayPixels;
+  int inkMinX, inkMinY, inkMaxX, inkMaxY;
 
-  PixelCache() : buffer(nullptr), width(0), height(0), bytesPerRow(0), originX(0), originY(0) {}
+  PixelCache()
+      : buffer(nullptr),
+        width(0),
+        height(0),
+        bytesPerRow(0),
+        originX(0),
+        originY(0),
+        windowStart(0),
+        windowRows(0),
+        failed(false),
+        inkPixels(0),
+        grayPixels(0),
+        inkMinX(0),
+        inkMinY(0),
+        inkMaxX(-1),
+        inkMaxY(-1) {}
   PixelCache(const PixelCache&) = delete;
   PixelCache& operator=(const PixelCache&) = delete;
 
-  static constexpr size_t MAX_CACHE_BYTES = 256 * 1024;  // 256KB limit for embedded targets
-
-  bool allocate(int w, int h, int ox, int oy) {
+  // windowRows is the most rows the decoder can have in progress at once, e.g. one MCU row after scaling
+  bool begin(const std::string& cachePath, int w, int h, int ox, int oy, int rows) {
     width = w;
     height = h;
     originX = ox;
     originY = oy;
     bytesPerRow = (w + 3) / 4;  // 2 bits per pixel, 4 pixels per byte
-    size_t bufferSize = (size_t)bytesPerRow * h;
-    if (bufferSize > MAX_CACHE_BYTES) {
-      LOG_ERR("IMG", "Cache buffer too large: %d bytes for %dx%d (limit %d)", bufferSize, w, h, MAX_CACHE_BYTES);
+    windowStart = 0;
+    windowRows = rows < 1 ? 1 : (rows > h ? h : rows);
+    failed = false;
+    inkPixels = 0;
+    grayPixels = 0;
+    inkMinX = w;
+    inkMinY = h;
+    inkMaxX = -1;
+    inkMaxY = -1;
+    const size_t bufferSize = (size_t)bytesPerRow * (windowRows + 1);
+    buffer = (uint8_t*)malloc(bufferSize);
+    if (!buffer) {
+      LOG_ERR("IMG", "Failed to allocate cache window: %zu bytes for %d rows", bufferSize, windowRows);
       return false;
     }
-    buffer = (uint8_t*)malloc(bufferSize);
-    if (buffer) {
-      memset(buffer, 0, bufferSize);
-      LOG_DBG("IMG", "Allocated cache buffer: %d bytes for %dx%d", bufferSize, w, h);
+    memset(buffer, BLANK, bufferSize);
+
+    path = cachePath;
+    const std::string tempPath = path + ".tmp";
+    if (!Storage.openFileForWrite("IMG", tempPath, file)) {
+      LOG_ERR("IMG", "Failed to open cache file for writing: %s", tempPath.c_str());
+      free(buffer);
+      buffer = nullptr;
+      return false;
     }
-    return buffer != nullptr;
+    const uint16_t header[2] = {(uint16_t)w, (uint16_t)h};
+    const ToneProfile unknownTone = {};  // Taken for gray should the profile never be written
+    file.write(MAGIC, sizeof(MAGIC));
+    file.write(header, sizeof(header));
+    file.write(&unknownTone, sizeof(unknownTone));
+    LOG_DBG("IMG", "Caching %dx%d through a %d row window (%zu bytes)", w, h, windowRows, bufferSize);
+    return true;
+  }
+
+  // Buffer row for an image row, which must lie in the window
+  uint8_t* row(int localY) {
+    if (localY < windowStart || localY >= windowStart + windowRows) {
+      failed = true;
+      return buffer + windowRows * bytesPerRow;
+    }
+    return buffer + (localY - windowStart) * bytesPerRow;
   }
 
   void setPixel(int screenX, int screenY, uint8_t value) {
@@ -48,35 +134,104 @@ struct PixelCache {
     int localY = screenY - originY;
     if (localX < 0 || localX >= width || localY < 0 || localY >= height) return;
 
-    int byteIdx = localY * bytesPerRow + localX / 4;
+    uint8_t* rowPtr = row(localY);
+    int byteIdx = localX / 4;
     int bitShift = 6 - (localX % 4) * 2;  // MSB first: pixel 0 at bits 6-7
-    buffer[byteIdx] = (buffer[byteIdx] & ~(0x03 << bitShift)) | ((value & 0x03) << bitShift);
+    rowPtr[byteIdx] = (rowPtr[byteIdx] & ~(0x03 << bitShift)) | ((value & 0x03) << bitShift);
   }
 
-  bool writeToFile(const std::string& cachePath) {
-    if (!buffer) return false;
+  // Writes out every row above endY; rows the decoder skipped are written blank
+  void completeRows(int endY) {
+    if (!buffer) return;
+    if (endY > height) endY = height;
+    while (!failed && windowStart < endY) {
+      int rows = endY - windowStart;
+      if (rows > windowRows) rows = windowRows;
+      const size_t bytes = (size_t)rows * bytesPerRow;
+      profileRows(buffer, windowStart, rows);
+      if (file.write(buffer, bytes) != bytes) {
+        LOG_ERR("IMG", "Cache write failed at row %d", windowStart);
+        failed = true;
+        return;
+      }
+      // Slide the window: rows still in progress move to the front, the freed rows start out blank
+      const size_t keptBytes = (size_t)(windowRows - rows) * bytesPerRow;
+      memmove(buffer, buffer + bytes, keptBytes);
+      memset(buffer + keptBytes, BLANK, bytes);
+      windowStart += rows;
+    }
+  }
 
-    FsFile cacheFile;
-    if (!Storage.openFileForWrite("IMG", cachePath, cacheFile)) {
-      LOG_ERR("IMG", "Failed to open cache file for writing: %s", cachePath.c_str());
-      return false;
+  // Adds rows about to be written to the tone profile
+  void profileRows(const uint8_t* rows, const int firstRow, const int count) {
+    for (int r = 0; r < count; r++) {
+      const uint8_t* rowPtr = rows + r * bytesPerRow;
+      for (int byteIdx = 0; byteIdx < bytesPerRow; byteIdx++) {
+        if (rowPtr[byteIdx] == BLANK) continue;
+        for (int x = byteIdx * 4; x < byteIdx * 4 + 4 && x < width; x++) {
+          const uint8_t value = (rowPtr[byteIdx] >> (6 - (x % 4) * 2)) & 0x03;
+          if (value == 3) continue;
+          inkPixels++;
+          grayPixels += value != 0;
+          if (x < inkMinX) inkMinX = x;
+          if (x > inkMaxX) inkMaxX = x;
+          if (firstRow + r < inkMinY) inkMinY = firstRow + r;
+          inkMaxY = firstRow + r;
+        }
+      }
+    }
+  }
+
+  ToneProfile toneProfile() const {
+    ToneProfile tone = {};
+    tone.bilevel = grayPixels == 0;
+    tone.inkPermille = (uint16_t)((uint64_t)inkPixels * 1000 / ((uint64_t)width * height));
+    if (inkMaxX >= 0) {
+      tone.inkX = (uint16_t)inkMinX;
+      tone.inkY = (uint16_t)inkMinY;
+      tone.inkWidth = (uint16_t)(inkMaxX - inkMinX + 1);
+      tone.inkHeight = (uint16_t)(inkMaxY - inkMinY + 1);
     }
+    return tone;
+  }
 
-    uint16_t w = width;
-    uint16_t h = height;
-    cacheFile.write(&w, 2);
-    cacheFile.write(&h, 2);
-    cacheFile.write(buffer, bytesPerRow * height);
-    cacheFile.close();
+  // Writes the remaining rows and the tone profile, and moves the file into place
+  bool finish() {
+    if (!buffer) return false;
+    completeRows(height);
+    const ToneProfile tone = toneProfile();
+    if (!failed && (!file.seek(TONE_OFFSET) || file.write(&tone, sizeof(tone)) != sizeof(tone))) {
+      LOG_ERR("IMG", "Failed to write the tone profile: %s", path.c_str());
+      failed = true;
+    }
+    file.close();
+    free(buffer);
+    buffer = nullptr;
 
-    LOG_DBG("IMG", "Cache written: %s (%dx%d, %d bytes)", cachePath.c_str(), width, height, 4 + bytesPerRow * height);
+    const std::string tempPath = path + ".tmp";
+    if (failed) {
+      LOG_ERR("IMG", "Dropping incomplete cache: %s", path.c_str());
+      Storage.remove(tempPath.c_str());
+      return false;
+    }
+    Storage.remove(path.c_str());
+    if (!Storage.rename(tempPath.c_str(), path.c_str())) {
+      LOG_ERR("IMG", "Failed to move cache into place: %s", path.c_str());
+      Storage.remove(tempPath.c_str());
+      return false;
+    }
+    LOG_DBG("IMG", "Cache written: %s (%dx%d, %d bytes, %s, %u%% inked)", path.c_str(), width, height,
+            HEADER_SIZE + bytesPerRow * height, tone.bilevel ? "bilevel" : "gray", tone.inkPermille / 10);
     return true;
   }
 
   ~PixelCache() {
     if (buffer) {
+      // Decode abandoned before finish()
       free(buffer);
       buffer = nullptr;
+      file.close();
+      Storage.remove((path + ".tmp").c_str());
     }
   }
 };
@@ -9,6 +9,7 @@
 #include <cstdlib>
 #include <new>
 
+#include "../ImagePack.h"
 #include "DirectPixelWriter.h"
 #include "DitherUtils.h"
 #include "PixelCache.h"
@@ -17,7 +18,7 @@ namespace {
 
 // Context struct passed through PNGdec callbacks to avoid global mutable state.
 // The draw callback receives this via pDraw->pUser (set by png.decode()).
-// The file I/O callbacks receive the FsFile* via pFile->fHandle (set by pngOpen()).
+// The file I/O callbacks receive the ImagePack::Reader* via pFile->fHandle (set by pngOpen()).
 struct PngContext {
   GfxRenderer* renderer{nullptr};
   const RenderConfig* config{nullptr};
@@ -30,19 +31,26 @@ struct PngContext {
   int srcHeight{0};
   int dstWidth{0};
   int dstHeight{0};
-  int lastDstY{-1};  // Track last rendered destination Y to avoid duplicates
 
   PixelCache cache;
   bool caching{false};
 
   uint8_t* grayLineBuffer{nullptr};
+  uint32_t* rowSums{nullptr};  // Per destination column, over the source rows accumulated so far
+  uint32_t accumulatedRows{0};
+  bool accumulatedWhite{true};  // Every source row accumulated so far is all white
+  uint8_t whiteGray{255};       // The lowest gray drawn as white
+
+  // Gray of every palette index, blended over white with the tRNS alpha; built on the first scanline
+  uint8_t paletteGray[256];
+  bool paletteGrayReady{false};
 };
 
-// File I/O callbacks use pFile->fHandle to access the FsFile*,
+// File I/O callbacks use pFile->fHandle to access the ImagePack::Reader*,
 // avoiding the need for global file state.
 void* pngOpenWithHandle(const char* filename, int32_t* size) {
-  FsFile* f = new FsFile();
-  if (!Storage.openFileForRead("PNG", std::string(filename), *f)) {
+  auto* f = new ImagePack::Reader();
+  if (!f->open(filename)) {
     delete f;
     return nullptr;
   }
@@ -51,7 +59,7 @@ void* pngOpenWithHandle(const char* filename, int32_t* size) {
 }
 
 void pngCloseWithHandle(void* handle) {
-  FsFile* f = reinterpret_cast<FsFile*>(handle);
+  auto* f = reinterpret_cast<ImagePack::Reader*>(handle);
   if (f) {
     f->close();
     delete f;
@@ -59,13 +67,13 @@ void pngCloseWithHandle(void* handle) {
 }
 
 int32_t pngReadWithHandle(PNGFILE* pFile, uint8_t* pBuf, int32_t len) {
-  FsFile* f = reinterpret_cast<FsFile*>(pFile->fHandle);
+  auto* f = reinterpret_cast<ImagePack::Reader*>(pFile->fHandle);
   if (!f) return 0;
   return f->read(pBuf, len);
 }
 
 int32_t pngSeekWithHandle(PNGFILE* pFile, int32_t pos) {
-  FsFile* f = reinterpret_cast<FsFile*>(pFile->fHandle);
+  auto* f = reinterpret_cast<ImagePack::Reader*>(pFile->fHandle);
   if (!f) return -1;
   return f->seek(pos);
 }
@@ -103,10 +111,25 @@ int requiredPngInternalBufferBytes(int srcWidth, int pixelType) {
   return ((pitch + 1) * 2) + 32;
 }
 
-// Convert entire source line to grayscale with alpha blending to white background.
 // For indexed PNGs with tRNS chunk, alpha values are stored at palette[768] onwards.
+void buildPaletteGray(const uint8_t* palette, const int hasAlpha, uint8_t* paletteGray) {
+  for (int idx = 0; idx < 256; idx++) {
+    const uint8_t* p = &palette[idx * 3];
+    const uint8_t gray = (uint8_t)((p[0] * 77 + p[1] * 150 + p[2] * 29) >> 8);
+    if (hasAlpha) {
+      const uint8_t alpha = palette[768 + idx];
+      paletteGray[idx] = (uint8_t)((gray * alpha + 255 * (255 - alpha)) / 255);
+    } else {
+      paletteGray[idx] = gray;
+    }
+  }
+}
+
+// Convert entire source line to grayscale with alpha blending to white background.
+// Indexed pixels look up paletteGray (nullptr without a palette).
 // Processing the whole line at once improves cache locality and reduces per-pixel overhead.
-void convertLineToGray(uint8_t* pPixels, uint8_t* grayLine, int width, int pixelType, uint8_t* palette, int hasAlpha) {
+void convertLineToGray(const uint8_t* pPixels, uint8_t* grayLine, int width, int pixelType,
+                       const uint8_t* paletteGray) {
   switch (pixelType) {
     case PNG_PIXEL_GRAYSCALE:
       memcpy(grayLine, pPixels, width);
@@ -114,26 +137,15 @@ void convertLineToGray(uint8_t* pPixels, uint8_t* grayLine, int width, int pixel
 
     case PNG_PIXEL_TRUECOLOR:
       for (int x = 0; x < width; x++) {
-        uint8_t* p = &pPixels[x * 3];
+        const uint8_t* p = &pPixels[x * 3];
         grayLine[x] = (uint8_t)((p[0] * 77 + p[1] * 150 + p[2] * 29) >> 8);
       }
       break;
 
     case PNG_PIXEL_INDEXED:
-      if (palette) {
-        if (hasAlpha) {
-          for (int x = 0; x < width; x++) {
-            uint8_t idx = pPixels[x];
-            uint8_t* p = &palette[idx * 3];
-            uint8_t gray = (uint8_t)((p[0] * 77 + p[1] * 150 + p[2] * 29) >> 8);
-            uint8_t alpha = palette[768 + idx];
-            grayLine[x] = (uint8_t)((gray * alpha + 255 * (255 - alpha)) / 255);
-          }
-        } else {
-          for (int x = 0; x < width; x++) {
-            uint8_t* p = &palette[pPixels[x] * 3];
-            grayLine[x] = (uint8_t)((p[0] * 77 + p[1] * 150 + p[2] * 29) >> 8);
-          }
+      if (paletteGray) {
+        for (int x = 0; x < width; x++) {
+          grayLine[x] = paletteGray[pPixels[x]];
         }
       } else {
         memcpy(grayLine, pPixels, width);
@@ -150,7 +162,7 @@ void convertLineToGray(uint8_t* pPixels, uint8_t* grayLine, int width, int pixel
 
     case PNG_PIXEL_TRUECOLOR_ALPHA:
       for (int x = 0; x < width; x++) {
-        uint8_t* p = &pPixels[x * 4];
+        const uint8_t* p = &pPixels[x * 4];
         uint8_t gray = (uint8_t)((p[0] * 77 + p[1] * 150 + p[2] * 29) >> 8);
         uint8_t alpha = p[3];
         grayLine[x] = (uint8_t)((gray * alpha + 255 * (255 - alpha)) / 255);
@@ -163,55 +175,48 @@ void convertLineToGray(uint8_t* pPixels, uint8_t* grayLine, int width, int pixel
   }
 }
 
-int pngDrawCallback(PNGDRAW* pDraw) {
-  PngContext* ctx = reinterpret_cast<PngContext*>(pDraw->pUser);
-  if (!ctx || !ctx->config || !ctx->renderer || !ctx->grayLineBuffer) return 0;
-
-  int srcY = pDraw->y;
-  int srcWidth = ctx->srcWidth;
-
-  // Calculate destination Y with scaling
-  int dstY = (int)(srcY * ctx->scale);
-
-  // Skip if we already rendered this destination row (multiple source rows map to same dest)
-  if (dstY == ctx->lastDstY) return 1;
-  ctx->lastDstY = dstY;
-
-  // Check bounds
-  if (dstY >= ctx->dstHeight) return 1;
-
-  int outY = ctx->config->y + dstY;
-  if (outY >= ctx->screenHeight) return 1;
-
-  // Convert entire source line to grayscale (improves cache locality)
-  convertLineToGray(pDraw->pPixels, ctx->grayLineBuffer, srcWidth, pDraw->iPixelType, pDraw->pPalette,
-                    pDraw->iHasAlpha);
-
-  // Render scaled row using Bresenham-style integer stepping (no floating-point division)
-  int dstWidth = ctx->dstWidth;
-  int outXBase = ctx->config->x;
-  int screenWidth = ctx->screenWidth;
-  bool useDithering = ctx->config->useDithering;
-  bool caching = ctx->caching;
+// Draws (and caches) destination rows [firstDstY, endDstY) from the source rows accumulated since the last call,
+// then starts a new accumulation. Several rows are emitted from one source row when upscaling.
+void emitRows(PngContext* ctx, const int firstDstY, int endDstY) {
+  const int dstWidth = ctx->dstWidth;
+  const int outXBase = ctx->config->x;
+  const int screenWidth = ctx->screenWidth;
+  const bool useDithering = ctx->config->useDithering;
+  const bool caching = ctx->caching;
+  const uint32_t rows = ctx->accumulatedRows;
+  const uint32_t* sums = ctx->rowSums;
+  if (endDstY > ctx->dstHeight) endDstY = ctx->dstHeight;
+
+  // White is neither drawn nor cached (the cache starts out blank), so an all-white band is only counted off
+  if (ctx->accumulatedWhite) {
+    if (caching) ctx->cache.completeRows(endDstY);
+    memset(ctx->rowSums, 0, dstWidth * sizeof(uint32_t));
+    ctx->accumulatedRows = 0;
+    return;
+  }
 
-  // Pre-compute orientation and render-mode state once per row
+  // Pre-compute orientation and render-mode state once per call
   DirectPixelWriter pw;
   pw.init(*ctx->renderer);
-  pw.beginRow(outY);
 
   DirectCacheWriter cw;
   if (caching) {
-    cw.init(ctx->cache.buffer, ctx->cache.bytesPerRow, ctx->cache.originX);
-    cw.beginRow(outY, ctx->config->y);
+    cw.init(ctx->cache);
   }
 
-  int srcX = 0;
-  int error = 0;
+  for (int dstY = firstDstY; dstY < endDstY; dstY++) {
+    const int outY = ctx->config->y + dstY;
+    if (outY >= ctx->screenHeight) break;
+    pw.beginRow(outY);
+    if (caching) {
+      ctx->cache.completeRows(dstY);
+      cw.beginRow(outY);
+    }
 
-  for (int dstX = 0; dstX < dstWidth; dstX++) {
-    int outX = outXBase + dstX;
-    if (outX < screenWidth) {
-      uint8_t gray = ctx->grayLineBuffer[srcX];
+    for (int dstX = 0; dstX < dstWidth; dstX++) {
+      const int outX = outXBase + dstX;
+      if (outX >= screenWidth) break;
+      const uint8_t gray = (uint8_t)(rows > 1 ? (sums[dstX] + rows / 2) / rows : sums[dstX]);
 
       uint8_t ditheredGray;
       if (useDithering) {
@@ -224,14 +229,81 @@ int pngDrawCallback(PNGDRAW* pDraw) {
       if (caching) cw.writePixel(outX, ditheredGray);
     }
 
-    // Bresenham-style stepping: advance srcX based on ratio srcWidth/dstWidth
+    if (caching) ctx->cache.completeRows(dstY + 1);
+  }
+
+  memset(ctx->rowSums, 0, dstWidth * sizeof(uint32_t));
+  ctx->accumulatedRows = 0;
+  ctx->accumulatedWhite = true;
+}
+
+// Scanlines stream through a box filter: each source row is averaged down to the destination width and summed into
+// the row accumulator, and once the rows of a destination row are all in, it is drawn. Memory is one source line and
+// one destination row, whatever the source resolution.
+int pngDrawCallback(PNGDRAW* pDraw) {
+  PngContext* ctx = reinterpret_cast<PngContext*>(pDraw->pUser);
+  if (!ctx || !ctx->config || !ctx->renderer || !ctx->grayLineBuffer || !ctx->rowSums) return 0;
+
+  const int srcY = pDraw->y;
+  const int srcWidth = ctx->srcWidth;
+  const int dstWidth = ctx->dstWidth;
+  if (srcY >= ctx->srcHeight) return 1;
+
+  // Convert entire source line to grayscale (improves cache locality)
+  const uint8_t* paletteGray = nullptr;
+  if (pDraw->iPixelType == PNG_PIXEL_INDEXED && pDraw->pPalette) {
+    if (!ctx->paletteGrayReady) {
+      buildPaletteGray(pDraw->pPalette, pDraw->iHasAlpha, ctx->paletteGray);
+      ctx->paletteGrayReady = true;
+    }
+    paletteGray = ctx->paletteGray;
+  }
+  convertLineToGray(pDraw->pPixels, ctx->grayLineBuffer, srcWidth, pDraw->iPixelType, paletteGray);
+  const uint8_t* gray = ctx->grayLineBuffer;
+
+  // Averages of white are white, so a band of white source rows draws nothing. Line art is mostly such rows, and the
+  // scan of a row that isn't stops at its first dark pixel.
+  if (ctx->accumulatedWhite) {
+    const uint8_t whiteGray = ctx->whiteGray;
+    for (int x = 0; x < srcWidth; x++) {
+      if (gray[x] < whiteGray) {
+        ctx->accumulatedWhite = false;
+        break;
+      }
+    }
+  }
+
+  // Bresenham-style stepping (no floating-point division): each destination column averages the source columns it
+  // spans, and repeats the nearest one when upscaling
+  uint32_t* sums = ctx->rowSums;
+  int srcX = 0;
+  int error = 0;
+  for (int dstX = 0; dstX < dstWidth; dstX++) {
+    int span = 0;
     error += srcWidth;
     while (error >= dstWidth) {
       error -= dstWidth;
-      srcX++;
+      span++;
+    }
+    if (span <= 1) {
+      sums[dstX] += gray[srcX];
+    } else {
+      uint32_t sum = 0;
+      for (int i = 0; i < span; i++) {
+        sum += gray[srcX + i];
+      }
+      sums[dstX] += (sum + span / 2) / span;
     }
+    srcX += span;
   }
+  ctx->accumulatedRows++;
 
+  // This source row completes the destination rows that start before the next source row's
+  const int firstDstY = (int)((int64_t)srcY * ctx->dstHeight / ctx->srcHeight);
+  const int endDstY = (int)((int64_t)(srcY + 1) * ctx->dstHeight / ctx->srcHeight);
+  if (endDstY > firstDstY) {
+    emitRows(ctx, firstDstY, endDstY);
+  }
   return 1;
 }
 
@@ -271,22 +343,26 @@ bool PngToFramebufferConverter::decodeToFramebuffer(const std::string& imagePath
                                                     const RenderConfig& config) {
   LOG_DBG("PNG", "Decoding PNG: %s", imagePath.c_str());
 
-  size_t freeHeap = ESP.getFreeHeap();
-  if (freeHeap < MIN_FREE_HEAP_FOR_PNG) {
-    LOG_ERR("PNG", "Not enough heap for PNG decoder (%u free, need %u)", freeHeap, MIN_FREE_HEAP_FOR_PNG);
-    return false;
-  }
-
-  // Heap-allocate PNG decoder (~42 KB) - freed at end of function
-  PNG* png = new (std::nothrow) PNG();
+  // Heap-allocate PNG decoder (~42 KB). The decoder of the previous image on the page is reused; releaseScratch()
+  // frees it after the page.
   if (!png) {
-    LOG_ERR("PNG", "Failed to allocate PNG decoder");
-    return false;
+    size_t freeHeap = ESP.getFreeHeap();
+    if (freeHeap < MIN_FREE_HEAP_FOR_PNG) {
+      LOG_ERR("PNG", "Not enough heap for PNG decoder (%u free, need %u)", freeHeap, MIN_FREE_HEAP_FOR_PNG);
+      return false;
+    }
+
+    png = new (std::nothrow) PNG();
+    if (!png) {
+      LOG_ERR("PNG", "Failed to allocate PNG decoder");
+      return false;
+    }
   }
 
   PngContext ctx;
   ctx.renderer = &renderer;
   ctx.config = &config;
+  ctx.whiteGray = config.useDithering ? BAYER_WHITE_GRAY : 255;
   ctx.screenWidth = renderer.getScreenWidth();
   ctx.screenHeight = renderer.getScreenHeight();
 
@@ -294,13 +370,11 @@ bool PngToFramebufferConverter::decodeToFramebuffer(const std::string& imagePath
                      pngDrawCallback);
   if (rc != PNG_SUCCESS) {
     LOG_ERR("PNG", "Failed to open PNG: %d", rc);
-    delete png;
     return false;
   }
 
   if (!validateImageDimensions(png->getWidth(), png->getHeight(), "PNG")) {
     png->close();
-    delete png;
     return false;
   }
 
@@ -323,7 +397,6 @@ bool PngToFramebufferConverter::decodeToFramebuffer(const std::string& imagePath
     ctx.dstWidth = (int)(ctx.srcWidth * ctx.scale);
     ctx.dstHeight = (int)(ctx.srcHeight * ctx.scale);
   }
-  ctx.lastDstY = -1;  // Reset row tracking
 
   LOG_DBG("PNG", "PNG %dx%d -> %dx%d (scale %.2f), bpp: %d", ctx.srcWidth, ctx.srcHeight, ctx.dstWidth, ctx.dstHeight,
           ctx.scale, png->getBpp());
@@ -336,7 +409,6 @@ bool PngToFramebufferConverter::decodeToFramebuffer(const std::string& imagePath
             requiredInternal, ctx.srcWidth, pixelType, PNG_MAX_BUFFERED_PIXELS);
     LOG_ERR("PNG", "Aborting decode to avoid PNGdec internal buffer overflow");
     png->close();
-    delete png;
     return false;
   }
 
@@ -344,59 +416,65 @@ bool PngToFramebufferConverter::decodeToFramebuffer(const std::string& imagePath
     warnUnsupportedFeature("bit depth (" + std::to_string(png->getBpp()) + "bpp)", imagePath);
   }
 
-  // Allocate grayscale line buffer on demand (~3.2 KB) - freed after decode
-  const size_t grayBufSize = PNG_MAX_BUFFERED_PIXELS / 2;
-  ctx.grayLineBuffer = static_cast<uint8_t*>(malloc(grayBufSize));
-  if (!ctx.grayLineBuffer) {
-    LOG_ERR("PNG", "Failed to allocate gray line buffer");
+  // Grayscale line buffer and destination row accumulator (~8 KB + 4 bytes per output column), kept with the decoder
+  // for the next image; the accumulator grows to the widest image
+  if (!grayLineBuffer) {
+    grayLineBuffer = static_cast<uint8_t*>(malloc(PNG_MAX_BUFFERED_PIXELS / 2));
+  }
+  if (rowSumsCapacity < ctx.dstWidth) {
+    free(rowSums);
+    rowSums = static_cast<uint32_t*>(malloc(ctx.dstWidth * sizeof(uint32_t)));
+    rowSumsCapacity = rowSums ? ctx.dstWidth : 0;
+  }
+  if (!grayLineBuffer || !rowSums) {
+    LOG_ERR("PNG", "Failed to allocate line buffers");
     png->close();
-    delete png;
     return false;
   }
+  memset(rowSums, 0, ctx.dstWidth * sizeof(uint32_t));
+  ctx.grayLineBuffer = grayLineBuffer;
+  ctx.rowSums = rowSums;
 
-  // Allocate cache buffer using SCALED dimensions.
-  // PNG decode is fast enough (~135ms for 400x600) that caching provides minimal benefit
-  // for larger images, while the cache buffer competes with the 44KB PNG decoder for heap.
-  // Skip caching when the buffer would exceed the framebuffer size (48KB).
-  static constexpr size_t PNG_MAX_CACHE_BYTES = 48000;
+  // Stream the cache out at the SCALED dimensions. Rows arrive one at a time, top to bottom, so the window is a
+  // single row and caching costs next to no heap next to the 44KB PNG decoder.
   ctx.caching = !config.cachePath.empty();
-  if (ctx.caching) {
-    size_t cacheSize = (size_t)((ctx.dstWidth + 3) / 4) * ctx.dstHeight;
-    if (cacheSize > PNG_MAX_CACHE_BYTES) {
-      LOG_DBG("PNG", "Skipping cache: %zu bytes exceeds PNG limit (%zu)", cacheSize, PNG_MAX_CACHE_BYTES);
-      ctx.caching = false;
-    } else if (!ctx.cache.allocate(ctx.dstWidth, ctx.dstHeight, config.x, config.y)) {
-      LOG_ERR("PNG", "Failed to allocate cache buffer, continuing without caching");
-      ctx.caching = false;
-    }
+  if (ctx.caching && !ctx.cache.begin(config.cachePath, ctx.dstWidth, ctx.dstHeight, config.x, config.y, 1)) {
+    LOG_ERR("PNG", "Failed to start cache, continuing without caching");
+    ctx.caching = false;
   }
 
   unsigned long decodeStart = millis();
   rc = png->decode(&ctx, 0);
   unsigned long decodeTime = millis() - decodeStart;
 
-  free(ctx.grayLineBuffer);
-  ctx.grayLineBuffer = nullptr;
 
   if (rc != PNG_SUCCESS) {
     LOG_ERR("PNG", "Decode failed: %d", rc);
     png->close();
-    delete png;
     return false;
   }
 
   png->close();
-  delete png;
   LOG_DBG("PNG", "PNG decoding complete - render time: %lu ms", decodeTime);
 
-  // Write cache file if caching was enabled and buffer was allocated
+  // Write out the last rows and move the cache file into place
   if (ctx.caching) {
-    ctx.cache.writeToFile(config.cachePath);
+    ctx.cache.finish();
   }
 
   return true;
 }
 
+void PngToFramebufferConverter::releaseScratch() {
+  delete png;
+  png = nullptr;
+  free(grayLineBuffer);
+  grayLineBuffer = nullptr;
+  free(rowSums);
+  rowSums = nullptr;
+  rowSumsCapacity = 0;
+}
+
 bool PngToFramebufferConverter::supportsFormat(const std::string& extension) {
   return FsHelpers::hasPngExtension(extension);
 }
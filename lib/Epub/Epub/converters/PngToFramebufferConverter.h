@@ -1,9 +1,15 @@
 #pragma once
 
+#include <cstdint>
+
 #include "ImageToFramebufferDecoder.h"
 
+class PNG;
+
 class PngToFramebufferConverter final : public ImageToFramebufferDecoder {
  public:
+  ~PngToFramebufferConverter() override { releaseScratch(); }
+
   static bool getDimensionsStatic(const std::string& imagePath, ImageDimensions& out);
 
   bool decodeToFramebuffer(const std::string& imagePath, GfxRenderer& renderer, const RenderConfig& config) override;
@@ -14,4 +20,11 @@ class PngToFramebufferConverter final : public ImageToFramebufferDecoder {
 
   static bool supportsFormat(const std::string& extension);
   const char* getFormatName() const override { return "PNG"; }
+  void releaseScratch() override;
+
+ private:
+  PNG* png = nullptr;
+  uint8_t* grayLineBuffer = nullptr;
+  uint32_t* rowSums = nullptr;
+  int rowSumsCapacity = 0;
 };
\ No newline at end of file
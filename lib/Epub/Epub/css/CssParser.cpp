@@ -1,11 +1,14 @@
 #include "CssParser.h"
 
 #include <Arduino.h>
+#include <BufferedFileReader.h>
+#include <BufferedFileWriter.h>
 #include <Logging.h>
 
 #include <algorithm>
 #include <array>
 #include <cctype>
+#include <cstring>
 #include <string_view>
 
 namespace {
@@ -44,6 +47,11 @@ constexpr size_t MAX_RULES = 1500;
 // Minimum free heap required to apply CSS during rendering
 // If below this threshold, we skip CSS to avoid display artifacts.
 constexpr size_t MIN_FREE_HEAP_FOR_CSS = 48 * 1024;
+// Free heap below which loaded rules are released between chapters rather than kept for the next one
+constexpr size_t MIN_FREE_HEAP_TO_KEEP_CSS = 64 * 1024;
+
+// Maximum number of rules applied to one element; further matches are dropped
+constexpr size_t MAX_MATCHED_RULES = 24;
 
 // Maximum length for a single selector string
 // Prevents parsing of extremely long or malformed selectors
@@ -380,6 +388,7 @@ void CssParser::processRuleBlockWithStyle(const std::string& selectorGroup, cons
 
   // Handle comma-separated selectors
   const auto selectors = splitOnChar(selectorGroup, ',');
+  std::string canonicalBuf;
 
   for (const auto& sel : selectors) {
     // Validate selector length before processing
@@ -398,12 +407,6 @@ void CssParser::processRuleBlockWithStyle(const std::string& selectorGroup, cons
       continue;
     }
 
-    // TODO: Consider adding support for direct nested css selectors in the future
-    // Ensure no > in selector as we don't support nested CSS selectors for now
-    if (key.find('>') != std::string_view::npos) {
-      continue;
-    }
-
     // TODO: Consider adding support for attribute css selectors in the future
     // Ensure no [ in selector as we don't support attribute CSS selectors for now
     if (key.find('[') != std::string_view::npos) {
@@ -434,12 +437,13 @@ void CssParser::processRuleBlockWithStyle(const std::string& selectorGroup, cons
       continue;
     }
 
-    // TODO: Add support for more complex selectors in the future
-    // At the moment, we only ever check for `tag`, `tag.class1` or `.class1`
-    // If the selector has whitespace in it, then it's either a CSS selector for a descendant element (e.g. `tag1 tag2`)
-    // or some other slightly more advanced CSS selector which we don't support yet
-    if (key.find(' ') != std::string_view::npos) {
-      continue;
+    // Descendant (`tag1 tag2`) and child (`tag1 > tag2`) selectors are stored in canonical form, so that
+    // `div>p` and `div > p` merge; their parts can only be `tag`, `tag.class1` or `.class1`
+    if (key.find_first_of(" >") != std::string::npos) {
+      if (!canonicalAncestorSelector(key, canonicalBuf)) {
+        continue;
+      }
+      key.swap(canonicalBuf);
     }
 
     // Skip if this would exceed the rule limit
@@ -458,6 +462,41 @@ void CssParser::processRuleBlockWithStyle(const std::string& selectorGroup, cons
   }
 }
 
+bool CssParser::canonicalAncestorSelector(const std::string& selector, std::string& out) {
+  out.clear();
+  size_t partCount = 0;
+  bool pendingChild = false;
+  size_t i = 0;
+  while (i < selector.size()) {
+    if (selector[i] == ' ') {
+      ++i;
+      continue;
+    }
+    if (selector[i] == '>') {
+      if (partCount == 0 || pendingChild) return false;
+      pendingChild = true;
+      ++i;
+      continue;
+    }
+
+    const size_t start = i;
+    while (i < selector.size() && selector[i] != ' ' && selector[i] != '>') ++i;
+    const std::string_view part(selector.data() + start, i - start);
+    const size_t dot = part.find('.');
+    if (dot != std::string_view::npos &&
+        (dot + 1 == part.size() || part.find('.', dot + 1) != std::string_view::npos)) {
+      return false;  // `tag.` or several classes
+    }
+    if (partCount == MAX_SELECTOR_PARTS) return false;
+
+    if (partCount > 0) out.push_back(pendingChild ? '>' : ' ');
+    out.append(part);
+    ++partCount;
+    pendingChild = false;
+  }
+  return !pendingChild && partCount > 1;
+}
+
 // Main parsing entry point
 
 bool CssParser::loadFromStream(FsFile& source) {
@@ -608,7 +647,106 @@ bool CssParser::loadFromStream(FsFile& source) {
 
 // Style resolution
 
-CssStyle CssParser::resolveStyle(const std::string& tagName, const std::string& classAttr) const {
+void CssParser::clear() {
+  loadedCacheFile.clear();
+  rulesBySelector_.clear();
+  names_.clear();
+  nameOffsets_.clear();
+  indexedRules_.clear();
+  ancestorRules_.clear();
+}
+
+uint16_t CssParser::findNameId(const char* name, const size_t len) const {
+  // Stored names are lowercase, so only the looked-up name needs folding
+  auto compare = [name, len](const char* stored) {
+    for (size_t i = 0; i < len; ++i) {
+      const int c = std::tolower(static_cast<unsigned char>(name[i]));
+      const int s = static_cast<unsigned char>(stored[i]);
+      if (c != s) return s - c;  // stored[i] == '\0' also ends here, as name has no NULs
+    }
+    return static_cast<int>(static_cast<unsigned char>(stored[len]));
+  };
+
+  size_t lo = 0;
+  size_t hi = nameOffsets_.size();
+  while (lo < hi) {
+    const size_t mid = (lo + hi) / 2;
+    const int cmp = compare(names_.data() + nameOffsets_[mid]);
+    if (cmp == 0) return static_cast<uint16_t>(mid);
+    if (cmp < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return NO_NAME;
+}
+
+const CssStyle* CssParser::findIndexedRule(const uint16_t tagId, const uint16_t classId) const {
+  const auto it = std::lower_bound(indexedRules_.begin(), indexedRules_.end(), std::make_pair(tagId, classId),
+                                   [](const IndexedRule& rule, const std::pair<uint16_t, uint16_t>& key) {
+                                     return rule.tagId != key.first ? rule.tagId < key.first
+                                                                    : rule.classId < key.second;
+                                   });
+  if (it == indexedRules_.end() || it->tagId != tagId || it->classId != classId) return nullptr;
+  return &it->style;
+}
+
+template <typename Fn>
+void CssParser::forEachAncestorRule(const uint16_t tagId, const uint16_t classId, Fn&& fn) const {
+  auto it = std::lower_bound(ancestorRules_.begin(), ancestorRules_.end(), std::make_pair(tagId, classId),
+                             [](const AncestorRule& rule, const std::pair<uint16_t, uint16_t>& key) {
+                               const SelectorPart& last = rule.last();
+                               return last.tagId != key.first ? last.tagId < key.first : last.classId < key.second;
+                             });
+  for (; it != ancestorRules_.end() && it->last().tagId == tagId && it->last().classId == classId; ++it) {
+    fn(*it);
+  }
+}
+
+bool CssParser::matchAncestors(const AncestorRule& rule, const int partIndex, const ElementKey* ancestors,
+                               const size_t ancestorCount) {
+  if (partIndex < 0) {
+    return true;
+  }
+  const SelectorPart& part = rule.parts[partIndex];
+  if (rule.parts[partIndex + 1].childOfPrevious) {
+    // `part > next`: only the parent can match
+    return ancestorCount > 0 && part.matches(ancestors[ancestorCount - 1]) &&
+           matchAncestors(rule, partIndex - 1, ancestors, ancestorCount - 1);
+  }
+  // `part next`: any ancestor, nearest first; parts further left may need a farther one
+  for (size_t i = ancestorCount; i-- > 0;) {
+    if (part.matches(ancestors[i]) && matchAncestors(rule, partIndex - 1, ancestors, i)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+CssParser::ElementKey CssParser::makeElementKey(const char* tagName, const char* classAttr) const {
+  ElementKey key;
+  key.tagId = findNameId(tagName, strlen(tagName));
+  if (classAttr == nullptr) {
+    return key;
+  }
+
+  const char* p = classAttr;
+  while (*p && key.classCount < MAX_ELEMENT_CLASSES) {
+    while (*p && isCssWhitespace(*p)) ++p;
+    const char* start = p;
+    while (*p && !isCssWhitespace(*p)) ++p;
+    if (p == start) continue;
+    const uint16_t classId = findNameId(start, p - start);
+    if (classId != NO_NAME && !key.hasClass(classId)) {
+      key.classIds[key.classCount++] = classId;
+    }
+  }
+  return key;
+}
+
+CssStyle CssParser::resolveStyle(const ElementKey& element, const ElementKey* ancestors,
+                                 const size_t ancestorCount) const {
   static bool lowHeapWarningLogged = false;
   if (ESP.getFreeHeap() < MIN_FREE_HEAP_FOR_CSS) {
     if (!lowHeapWarningLogged) {
@@ -619,38 +757,71 @@ CssStyle CssParser::resolveStyle(const std::string& tagName, const std::string&
     return CssStyle{};
   }
   CssStyle result;
-  const std::string tag = normalized(tagName);
-
-  // 1. Apply element-level style (lowest priority)
-  const auto tagIt = rulesBySelector_.find(tag);
-  if (tagIt != rulesBySelector_.end()) {
-    result.applyOver(tagIt->second);
+  if (indexedRules_.empty() && ancestorRules_.empty()) {
+    return result;
   }
 
-  // TODO: Support combinations of classes (e.g. style on .class1.class2)
-  // 2. Apply class styles (medium priority)
-  if (!classAttr.empty()) {
-    const auto classes = splitWhitespace(classAttr);
-
-    for (const auto& cls : classes) {
-      std::string classKey = "." + normalized(cls);
-
-      auto classIt = rulesBySelector_.find(classKey);
-      if (classIt != rulesBySelector_.end()) {
-        result.applyOver(classIt->second);
-      }
+  // Matching rules, applied in order of specificity (classes, then tags) once all are found
+  struct Match {
+    uint16_t specificity;
+    const CssStyle* style;
+  };
+  Match matches[MAX_MATCHED_RULES];
+  size_t matchCount = 0;
+  auto addMatch = [&](const unsigned classes, const unsigned tags, const CssStyle* style) {
+    if (matchCount < MAX_MATCHED_RULES) {
+      matches[matchCount++] = {static_cast<uint16_t>(classes << 8 | tags), style};
     }
+  };
+  auto addSimpleRule = [&](const uint16_t tagId, const uint16_t classId) {
+    if (const CssStyle* style = findIndexedRule(tagId, classId)) {
+      addMatch(classId != NO_NAME, tagId != NO_NAME, style);
+    }
+  };
+  auto addAncestorRules = [&](const uint16_t tagId, const uint16_t classId) {
+    forEachAncestorRule(tagId, classId, [&](const AncestorRule& rule) {
+      if (!matchAncestors(rule, rule.partCount - 2, ancestors, ancestorCount)) {
+        return;
+      }
+      unsigned classes = 0;
+      unsigned tags = 0;
+      for (uint8_t i = 0; i < rule.partCount; ++i) {
+        classes += rule.parts[i].classId != NO_NAME;
+        tags += rule.parts[i].tagId != NO_NAME;
+      }
+      addMatch(classes, tags, &rule.style);
+    });
+  };
 
-    // TODO: Support combinations of classes (e.g. style on p.class1.class2)
-    // 3. Apply element.class styles (higher priority)
-    for (const auto& cls : classes) {
-      std::string combinedKey = tag + "." + normalized(cls);
+  // TODO: Support combinations of classes (e.g. style on .class1.class2 or p.class1.class2)
+  // Element, class and element.class rules, each candidate key also selecting the
+  // descendant/child rules that end in it
+  if (element.tagId != NO_NAME) {
+    addSimpleRule(element.tagId, NO_NAME);
+    if (!ancestorRules_.empty()) addAncestorRules(element.tagId, NO_NAME);
+  }
+  for (uint8_t i = 0; i < element.classCount; ++i) {
+    addSimpleRule(NO_NAME, element.classIds[i]);
+    if (!ancestorRules_.empty()) addAncestorRules(NO_NAME, element.classIds[i]);
+  }
+  if (element.tagId != NO_NAME) {
+    for (uint8_t i = 0; i < element.classCount; ++i) {
+      addSimpleRule(element.tagId, element.classIds[i]);
+      if (!ancestorRules_.empty()) addAncestorRules(element.tagId, element.classIds[i]);
+    }
+  }
 
-      auto combinedIt = rulesBySelector_.find(combinedKey);
-      if (combinedIt != rulesBySelector_.end()) {
-        result.applyOver(combinedIt->second);
-      }
+  // Stable insertion sort: among equal specificity, the order above wins
+  for (size_t i = 1; i < matchCount; ++i) {
+    const Match match = matches[i];
+    size_t j = i;
+    for (; j > 0 && matches[j - 1].specificity > match.specificity; --j) {
+      matches[j] = matches[j - 1];
     }
+    matches[j] = match;
+  }
+  for (size_t i = 0; i < matchCount; ++i) {
+    result.applyOver(*matches[i].style);
   }
 
   return result;
@@ -662,13 +833,126 @@ CssStyle CssParser::parseInlineStyle(const std::string& styleValue) { return par
 
 // Cache serialization
 
-// Cache file name (version is CssParser::CSS_CACHE_VERSION)
-constexpr char rulesCache[] = "/css_rules.cache";
+namespace {
+
+constexpr size_t CSS_LENGTH_FIELD_COUNT = 11;
+constexpr size_t CSS_LENGTH_BYTES = sizeof(float) + sizeof(uint8_t);
+constexpr size_t CSS_FIXED_STYLE_BYTES =
+    4 * sizeof(uint8_t) + (CSS_LENGTH_FIELD_COUNT * CSS_LENGTH_BYTES) + sizeof(uint8_t) + sizeof(uint16_t);
+
+void writeStyle(BufferedFileWriter& writer, const CssStyle& style) {
+  writer.write(static_cast<uint8_t>(style.textAlign));
+  writer.write(static_cast<uint8_t>(style.fontStyle));
+  writer.write(static_cast<uint8_t>(style.fontWeight));
+  writer.write(static_cast<uint8_t>(style.textDecoration));
+
+  // Write CssLength fields (value + unit)
+  auto writeLength = [&writer](const CssLength& len) {
+    writer.write(reinterpret_cast<const uint8_t*>(&len.value), sizeof(len.value));
+    writer.write(static_cast<uint8_t>(len.unit));
+  };
+
+  writeLength(style.textIndent);
+  writeLength(style.marginTop);
+  writeLength(style.marginBottom);
+  writeLength(style.marginLeft);
+  writeLength(style.marginRight);
+  writeLength(style.paddingTop);
+  writeLength(style.paddingBottom);
+  writeLength(style.paddingLeft);
+  writeLength(style.paddingRight);
+  writeLength(style.imageHeight);
+  writeLength(style.imageWidth);
+  writer.write(static_cast<uint8_t>(style.display));
+
+  // Write defined flags as uint16_t
+  uint16_t definedBits = 0;
+  if (style.defined.textAlign) definedBits |= 1 << 0;
+  if (style.defined.fontStyle) definedBits |= 1 << 1;
+  if (style.defined.fontWeight) definedBits |= 1 << 2;
+  if (style.defined.textDecoration) definedBits |= 1 << 3;
+  if (style.defined.textIndent) definedBits |= 1 << 4;
+  if (style.defined.marginTop) definedBits |= 1 << 5;
+  if (style.defined.marginBottom) definedBits |= 1 << 6;
+  if (style.defined.marginLeft) definedBits |= 1 << 7;
+  if (style.defined.marginRight) definedBits |= 1 << 8;
+  if (style.defined.paddingTop) definedBits |= 1 << 9;
+  if (style.defined.paddingBottom) definedBits |= 1 << 10;
+  if (style.defined.paddingLeft) definedBits |= 1 << 11;
+  if (style.defined.paddingRight) definedBits |= 1 << 12;
+  if (style.defined.imageHeight) definedBits |= 1 << 13;
+  if (style.defined.imageWidth) definedBits |= 1 << 14;
+  if (style.defined.display) definedBits |= 1 << 15;
+  writer.write(reinterpret_cast<const uint8_t*>(&definedBits), sizeof(definedBits));
+}
+
+bool readStyle(BufferedFileReader& reader, CssStyle& style) {
+  uint8_t enumVals[4];
+  if (reader.read(enumVals, sizeof(enumVals)) != sizeof(enumVals)) {
+    return false;
+  }
+  style.textAlign = static_cast<CssTextAlign>(enumVals[0]);
+  style.fontStyle = static_cast<CssFontStyle>(enumVals[1]);
+  style.fontWeight = static_cast<CssFontWeight>(enumVals[2]);
+  style.textDecoration = static_cast<CssTextDecoration>(enumVals[3]);
+
+  // Read CssLength fields
+  auto readLength = [&reader](CssLength& len) -> bool {
+    if (reader.read(&len.value, sizeof(len.value)) != sizeof(len.value)) {
+      return false;
+    }
+    uint8_t unitVal;
+    if (reader.read(&unitVal, 1) != 1) {
+      return false;
+    }
+    len.unit = static_cast<CssUnit>(unitVal);
+    return true;
+  };
+
+  if (!readLength(style.textIndent) || !readLength(style.marginTop) || !readLength(style.marginBottom) ||
+      !readLength(style.marginLeft) || !readLength(style.marginRight) || !readLength(style.paddingTop) ||
+      !readLength(style.paddingBottom) || !readLength(style.paddingLeft) || !readLength(style.paddingRight) ||
+      !readLength(style.imageHeight) || !readLength(style.imageWidth)) {
+    return false;
+  }
+
+  // Read display value
+  uint8_t displayVal;
+  if (reader.read(&displayVal, 1) != 1) {
+    return false;
+  }
+  style.display = static_cast<CssDisplay>(displayVal);
 
-bool CssParser::hasCache() const { return Storage.exists((cachePath + rulesCache).c_str()); }
+  // Read defined flags
+  uint16_t definedBits = 0;
+  if (reader.read(&definedBits, sizeof(definedBits)) != sizeof(definedBits)) {
+    return false;
+  }
+  style.defined.textAlign = (definedBits & 1 << 0) != 0;
+  style.defined.fontStyle = (definedBits & 1 << 1) != 0;
+  style.defined.fontWeight = (definedBits & 1 << 2) != 0;
+  style.defined.textDecoration = (definedBits & 1 << 3) != 0;
+  style.defined.textIndent = (definedBits & 1 << 4) != 0;
+  style.defined.marginTop = (definedBits & 1 << 5) != 0;
+  style.defined.marginBottom = (definedBits & 1 << 6) != 0;
+  style.defined.marginLeft = (definedBits & 1 << 7) != 0;
+  style.defined.marginRight = (definedBits & 1 << 8) != 0;
+  style.defined.paddingTop = (definedBits & 1 << 9) != 0;
+  style.defined.paddingBottom = (definedBits & 1 << 10) != 0;
+  style.defined.paddingLeft = (definedBits & 1 << 11) != 0;
+  style.defined.paddingRight = (definedBits & 1 << 12) != 0;
+  style.defined.imageHeight = (definedBits & 1 << 13) != 0;
+  style.defined.imageWidth = (definedBits & 1 << 14) != 0;
+  style.defined.display = (definedBits & 1 << 15) != 0;
+  return true;
+}
+
+}  // namespace
+
+bool CssParser::hasCache() const { return Storage.exists(cacheFile.c_str()); }
 
 void CssParser::deleteCache() const {
-  if (hasCache()) Storage.remove((cachePath + rulesCache).c_str());
+  if (hasCache()) Storage.remove(cacheFile.c_str());
 }
 
 bool CssParser::saveToCache() const {
@@ -676,73 +960,135 @@ bool CssParser::saveToCache() const {
     return false;
   }
 
+  // Split each selector into its parts, and each part into its tag and class. resolveStyle() only matches parts
+  // `tag`, `.class` and `tag.class`, so selectors naming several classes in a part are left out of the index.
+  struct SplitPart {
+    std::string_view tag;
+    std::string_view cls;
+    bool childOfPrevious;
+  };
+  struct SplitRule {
+    uint8_t partCount;
+    SplitPart parts[MAX_SELECTOR_PARTS];
+    const CssStyle* style;
+  };
+  auto splitSelector = [](const std::string_view selector, SplitRule& rule) {
+    rule.partCount = 0;
+    bool childOfPrevious = false;
+    size_t start = 0;
+    for (size_t i = 0; i <= selector.size(); ++i) {
+      if (i < selector.size() && selector[i] != ' ' && selector[i] != '>') continue;
+      const std::string_view part = selector.substr(start, i - start);
+      const size_t dot = part.find('.');
+      const std::string_view cls = dot == std::string_view::npos ? std::string_view{} : part.substr(dot + 1);
+      if (cls.find('.') != std::string_view::npos || (dot != std::string_view::npos && cls.empty()) ||
+          rule.partCount == MAX_SELECTOR_PARTS) {
+        return false;
+      }
+      rule.parts[rule.partCount++] = {part.substr(0, dot), cls, childOfPrevious};
+      childOfPrevious = i < selector.size() && selector[i] == '>';
+      start = i + 1;
+    }
+    return true;
+  };
+
+  std::vector<SplitRule> splitRules;
+  splitRules.reserve(rulesBySelector_.size());
+  std::vector<std::string_view> names;
+  names.reserve(rulesBySelector_.size());
+  for (const auto& pair : rulesBySelector_) {
+    SplitRule rule;
+    if (!splitSelector(pair.first, rule)) {
+      continue;
+    }
+    rule.style = &pair.second;
+    for (uint8_t i = 0; i < rule.partCount; ++i) {
+      if (!rule.parts[i].tag.empty()) names.push_back(rule.parts[i].tag);
+      if (!rule.parts[i].cls.empty()) names.push_back(rule.parts[i].cls);
+    }
+    splitRules.push_back(rule);
+  }
+
+  // Intern names: a name's ID is its position in sorted order
+  std::sort(names.begin(), names.end());
+  names.erase(std::unique(names.begin(), names.end()), names.end());
+  auto nameId = [&names](const std::string_view name) {
+    if (name.empty()) return NO_NAME;
+    return static_cast<uint16_t>(std::lower_bound(names.begin(), names.end(), name) - names.begin());
+  };
+
+  struct IdRule {
+    uint8_t partCount;
+    SelectorPart parts[MAX_SELECTOR_PARTS];
+    const CssStyle* style;
+
+    bool operator<(const IdRule& other) const {
+      // Single-part rules first, then both kinds by their last part
+      if ((partCount > 1) != (other.partCount > 1)) return partCount == 1;
+      const SelectorPart& a = parts[partCount - 1];
+      const SelectorPart& b = other.parts[other.partCount - 1];
+      return a.tagId != b.tagId ? a.tagId < b.tagId : a.classId < b.classId;
+    }
+  };
+  std::vector<IdRule> idRules;
+  idRules.reserve(splitRules.size());
+  for (const auto& rule : splitRules) {
+    IdRule idRule{rule.partCount, {}, rule.style};
+    for (uint8_t i = 0; i < rule.partCount; ++i) {
+      idRule.parts[i] = {nameId(rule.parts[i].tag), nameId(rule.parts[i].cls), rule.parts[i].childOfPrevious};
+    }
+    idRules.push_back(idRule);
+  }
+  std::sort(idRules.begin(), idRules.end());
+  const auto firstAncestorRule =
+      std::find_if(idRules.begin(), idRules.end(), [](const IdRule& rule) { return rule.partCount > 1; });
+
   FsFile file;
-  if (!Storage.openFileForWrite("CSS", cachePath + rulesCache, file)) {
+  if (!Storage.openFileForWrite("CSS", cacheFile, file)) {
     return false;
   }
+  BufferedFileWriter writer(file);
 
   // Write version
-  file.write(CssParser::CSS_CACHE_VERSION);
+  writer.write(CssParser::CSS_CACHE_VERSION);
+
+  // Write name table (length-prefixed, sorted)
+  const auto nameCount = static_cast<uint16_t>(names.size());
+  writer.write(reinterpret_cast<const uint8_t*>(&nameCount), sizeof(nameCount));
+  for (const auto& name : names) {
+    const auto nameLen = static_cast<uint16_t>(name.size());
+    writer.write(reinterpret_cast<const uint8_t*>(&nameLen), sizeof(nameLen));
+    writer.write(reinterpret_cast<const uint8_t*>(name.data()), nameLen);
+  }
+
+  // Write single-part rules sorted by (tag ID, class ID), each followed by its CssStyle fields
+  const auto ruleCount = static_cast<uint16_t>(firstAncestorRule - idRules.begin());
+  writer.write(reinterpret_cast<const uint8_t*>(&ruleCount), sizeof(ruleCount));
+  for (auto it = idRules.begin(); it != firstAncestorRule; ++it) {
+    writer.write(reinterpret_cast<const uint8_t*>(&it->parts[0].tagId), sizeof(it->parts[0].tagId));
+    writer.write(reinterpret_cast<const uint8_t*>(&it->parts[0].classId), sizeof(it->parts[0].classId));
+    writeStyle(writer, *it->style);
+  }
 
-  // Write rule count
-  const auto ruleCount = static_cast<uint16_t>(rulesBySelector_.size());
-  file.write(reinterpret_cast<const uint8_t*>(&ruleCount), sizeof(ruleCount));
+  // Write descendant/child rules sorted by their last part: part count, then each part, then the style
+  const auto ancestorRuleCount = static_cast<uint16_t>(idRules.end() - firstAncestorRule);
+  writer.write(reinterpret_cast<const uint8_t*>(&ancestorRuleCount), sizeof(ancestorRuleCount));
+  for (auto it = firstAncestorRule; it != idRules.end(); ++it) {
+    writer.write(it->partCount);
+    for (uint8_t i = 0; i < it->partCount; ++i) {
+      writer.write(reinterpret_cast<const uint8_t*>(&it->parts[i].tagId), sizeof(it->parts[i].tagId));
+      writer.write(reinterpret_cast<const uint8_t*>(&it->parts[i].classId), sizeof(it->parts[i].classId));
+      writer.write(static_cast<uint8_t>(it->parts[i].childOfPrevious));
+    }
+    writeStyle(writer, *it->style);
+  }
 
-  // Write each rule: selector string + CssStyle fields
-  for (const auto& pair : rulesBySelector_) {
-    // Write selector string (length-prefixed)
-    const auto selectorLen = static_cast<uint16_t>(pair.first.size());
-    file.write(reinterpret_cast<const uint8_t*>(&selectorLen), sizeof(selectorLen));
-    file.write(reinterpret_cast<const uint8_t*>(pair.first.data()), selectorLen);
-
-    // Write CssStyle fields (all are POD types)
-    const CssStyle& style = pair.second;
-    file.write(static_cast<uint8_t>(style.textAlign));
-    file.write(static_cast<uint8_t>(style.fontStyle));
-    file.write(static_cast<uint8_t>(style.fontWeight));
-    file.write(static_cast<uint8_t>(style.textDecoration));
-
-    // Write CssLength fields (value + unit)
-    auto writeLength = [&file](const CssLength& len) {
-      file.write(reinterpret_cast<const uint8_t*>(&len.value), sizeof(len.value));
-      file.write(static_cast<uint8_t>(len.unit));
-    };
-
-    writeLength(style.textIndent);
-    writeLength(style.marginTop);
-    writeLength(style.marginBottom);
-    writeLength(style.marginLeft);
-    writeLength(style.marginRight);
-    writeLength(style.paddingTop);
-    writeLength(style.paddingBottom);
-    writeLength(style.paddingLeft);
-    writeLength(style.paddingRight);
-    writeLength(style.imageHeight);
-    writeLength(style.imageWidth);
-    file.write(static_cast<uint8_t>(style.display));
-
-    // Write defined flags as uint16_t
-    uint16_t definedBits = 0;
-    if (style.defined.textAlign) definedBits |= 1 << 0;
-    if (style.defined.fontStyle) definedBits |= 1 << 1;
-    if (style.defined.fontWeight) definedBits |= 1 << 2;
-    if (style.defined.textDecoration) definedBits |= 1 << 3;
-    if (style.defined.textIndent) definedBits |= 1 << 4;
-    if (style.defined.marginTop) definedBits |= 1 << 5;
-    if (style.defined.marginBottom) definedBits |= 1 << 6;
-    if (style.defined.marginLeft) definedBits |= 1 << 7;
-    if (style.defined.marginRight) definedBits |= 1 << 8;
-    if (style.defined.paddingTop) definedBits |= 1 << 9;
-    if (style.defined.paddingBottom) definedBits |= 1 << 10;
-    if (style.defined.paddingLeft) definedBits |= 1 << 11;
-    if (style.defined.paddingRight) definedBits |= 1 << 12;
-    if (style.defined.imageHeight) definedBits |= 1 << 13;
-    if (style.defined.imageWidth) definedBits |= 1 << 14;
-    if (style.defined.display) definedBits |= 1 << 15;
-    file.write(reinterpret_cast<const uint8_t*>(&definedBits), sizeof(definedBits));
-  }
-
-  LOG_DBG("CSS", "Saved %u rules to cache", ruleCount);
+  if (!writer.flush()) {
+    LOG_ERR("CSS", "Failed to write cache");
+    return false;
+  }
+  LOG_DBG("CSS", "Saved %u rules and %u descendant/child rules with %u names to cache", ruleCount, ancestorRuleCount,
+          nameCount);
   return true;
 }
 
@@ -750,162 +1096,173 @@ bool CssParser::loadFromCache() {
   if (cachePath.empty()) {
     return false;
   }
+  // The cache of a set of stylesheets never changes while the book is open, so rules still loaded from it are current
+  if (cacheFile == loadedCacheFile) {
+    LOG_DBG("CSS", "Rules of %s already loaded", cacheFile.c_str());
+    return true;
+  }
 
   FsFile file;
-  if (!Storage.openFileForRead("CSS", cachePath + rulesCache, file)) {
+  if (!Storage.openFileForRead("CSS", cacheFile, file)) {
     return false;
   }
+  // The rules are read a few bytes at a time
+  BufferedFileReader reader(file, 1024);
 
   // Clear existing rules
   clear();
 
   // Read and verify version
   uint8_t version = 0;
-  if (file.read(&version, 1) != 1 || version != CssParser::CSS_CACHE_VERSION) {
+  if (reader.read(&version, 1) != 1 || version != CssParser::CSS_CACHE_VERSION) {
     LOG_DBG("CSS", "Cache version mismatch (got %u, expected %u), removing stale cache for rebuild", version,
             CssParser::CSS_CACHE_VERSION);
     // Explicitly close() file before calling Storage.remove()
     file.close();
-    Storage.remove((cachePath + rulesCache).c_str());
+    Storage.remove(cacheFile.c_str());
     return false;
   }
 
-  // Read rule count
-  uint16_t ruleCount = 0;
-  if (file.read(&ruleCount, sizeof(ruleCount)) != sizeof(ruleCount)) {
+  auto hasRemainingBytes = [&reader](const size_t neededBytes) -> bool {
+    return reader.available() >= neededBytes;
+  };
+
+  // Read name table
+  uint16_t nameCount = 0;
+  if (reader.read(&nameCount, sizeof(nameCount)) != sizeof(nameCount)) {
     return false;
   }
 
-  if (ruleCount > MAX_RULES) {
-    LOG_DBG("CSS", "Invalid cache rule count (%u > %zu)", ruleCount, MAX_RULES);
-    rulesBySelector_.clear();
+  // Every rule contributes at most two names
+  if (nameCount > 2 * MAX_RULES) {
+    LOG_DBG("CSS", "Invalid cache name count (%u > %zu)", nameCount, 2 * MAX_RULES);
     return false;
   }
 
-  auto hasRemainingBytes = [&file](const size_t neededBytes) -> bool {
-    return static_cast<size_t>(file.available()) >= neededBytes;
-  };
-
-  constexpr size_t CSS_LENGTH_FIELD_COUNT = 11;
-  constexpr size_t CSS_LENGTH_BYTES = sizeof(float) + sizeof(uint8_t);
-  constexpr size_t CSS_FIXED_STYLE_BYTES =
-      4 * sizeof(uint8_t) + (CSS_LENGTH_FIELD_COUNT * CSS_LENGTH_BYTES) + sizeof(uint8_t) + sizeof(uint16_t);
-
-  // Read each rule
-  for (uint16_t i = 0; i < ruleCount; ++i) {
-    // Read selector string
-    uint16_t selectorLen = 0;
-    if (!hasRemainingBytes(sizeof(selectorLen))) {
-      rulesBySelector_.clear();
-      return false;
-    }
-    if (file.read(&selectorLen, sizeof(selectorLen)) != sizeof(selectorLen)) {
-      rulesBySelector_.clear();
+  nameOffsets_.reserve(nameCount);
+  for (uint16_t i = 0; i < nameCount; ++i) {
+    uint16_t nameLen = 0;
+    if (reader.read(&nameLen, sizeof(nameLen)) != sizeof(nameLen)) {
+      clear();
       return false;
     }
 
-    if (selectorLen == 0 || selectorLen > MAX_SELECTOR_LENGTH || !hasRemainingBytes(selectorLen)) {
-      LOG_DBG("CSS", "Invalid selector length in cache: %u", selectorLen);
-      rulesBySelector_.clear();
+    if (nameLen == 0 || nameLen > MAX_SELECTOR_LENGTH || !hasRemainingBytes(nameLen)) {
+      LOG_DBG("CSS", "Invalid name length in cache: %u", nameLen);
+      clear();
       return false;
     }
 
-    std::string selector;
-    selector.resize(selectorLen);
-    if (file.read(&selector[0], selectorLen) != selectorLen) {
-      rulesBySelector_.clear();
+    const size_t offset = names_.size();
+    if (offset > UINT16_MAX) {
+      LOG_DBG("CSS", "CSS cache name table too large");
+      clear();
       return false;
     }
-
-    if (!hasRemainingBytes(CSS_FIXED_STYLE_BYTES)) {
-      LOG_DBG("CSS", "Truncated CSS cache while reading style payload");
-      rulesBySelector_.clear();
+    names_.resize(offset + nameLen + 1);
+    if (reader.read(&names_[offset], nameLen) != nameLen) {
+      clear();
       return false;
     }
+    nameOffsets_.push_back(static_cast<uint16_t>(offset));
+  }
+
+  // Read rule count
+  uint16_t ruleCount = 0;
+  if (reader.read(&ruleCount, sizeof(ruleCount)) != sizeof(ruleCount)) {
+    clear();
+    return false;
+  }
 
-    // Read CssStyle fields
-    CssStyle style;
-    uint8_t enumVal;
+  if (ruleCount > MAX_RULES) {
+    LOG_DBG("CSS", "Invalid cache rule count (%u > %zu)", ruleCount, MAX_RULES);
+    clear();
+    return false;
+  }
 
-    if (file.read(&enumVal, 1) != 1) {
-      rulesBySelector_.clear();
+  // Read each rule
+  indexedRules_.reserve(ruleCount);
+  for (uint16_t i = 0; i < ruleCount; ++i) {
+    if (!hasRemainingBytes(2 * sizeof(uint16_t) + CSS_FIXED_STYLE_BYTES)) {
+      LOG_DBG("CSS", "Truncated CSS cache while reading rule");
+      clear();
       return false;
     }
-    style.textAlign = static_cast<CssTextAlign>(enumVal);
 
-    if (file.read(&enumVal, 1) != 1) {
-      rulesBySelector_.clear();
+    IndexedRule rule{};
+    if (reader.read(&rule.tagId, sizeof(rule.tagId)) != sizeof(rule.tagId) ||
+        reader.read(&rule.classId, sizeof(rule.classId)) != sizeof(rule.classId) || !readStyle(reader, rule.style)) {
+      clear();
       return false;
     }
-    style.fontStyle = static_cast<CssFontStyle>(enumVal);
 
-    if (file.read(&enumVal, 1) != 1) {
-      rulesBySelector_.clear();
+    if ((rule.tagId != NO_NAME && rule.tagId >= nameCount) || (rule.classId != NO_NAME && rule.classId >= nameCount)) {
+      LOG_DBG("CSS", "Invalid name ID in cache rule");
+      clear();
       return false;
     }
-    style.fontWeight = static_cast<CssFontWeight>(enumVal);
 
-    if (file.read(&enumVal, 1) != 1) {
-      rulesBySelector_.clear();
+    indexedRules_.push_back(rule);
+  }
+
+  // Read descendant/child rules
+  uint16_t ancestorRuleCount = 0;
+  if (reader.read(&ancestorRuleCount, sizeof(ancestorRuleCount)) != sizeof(ancestorRuleCount)) {
+    clear();
+    return false;
+  }
+
+  if (ruleCount + ancestorRuleCount > MAX_RULES) {
+    LOG_DBG("CSS", "Invalid cache rule count (%u > %zu)", ruleCount + ancestorRuleCount, MAX_RULES);
+    clear();
+    return false;
+  }
+
+  constexpr size_t SELECTOR_PART_BYTES = 2 * sizeof(uint16_t) + sizeof(uint8_t);
+  ancestorRules_.reserve(ancestorRuleCount);
+  for (uint16_t i = 0; i < ancestorRuleCount; ++i) {
+    AncestorRule rule{};
+    if (reader.read(&rule.partCount, 1) != 1 || rule.partCount < 2 || rule.partCount > MAX_SELECTOR_PARTS ||
+        !hasRemainingBytes(rule.partCount * SELECTOR_PART_BYTES + CSS_FIXED_STYLE_BYTES)) {
+      LOG_DBG("CSS", "Invalid or truncated descendant/child rule in cache");
+      clear();
       return false;
     }
-    style.textDecoration = static_cast<CssTextDecoration>(enumVal);
 
-    // Read CssLength fields
-    auto readLength = [&file](CssLength& len) -> bool {
-      if (file.read(&len.value, sizeof(len.value)) != sizeof(len.value)) {
+    for (uint8_t j = 0; j < rule.partCount; ++j) {
+      SelectorPart& part = rule.parts[j];
+      uint8_t childOfPrevious = 0;
+      if (reader.read(&part.tagId, sizeof(part.tagId)) != sizeof(part.tagId) ||
+          reader.read(&part.classId, sizeof(part.classId)) != sizeof(part.classId) ||
+          reader.read(&childOfPrevious, 1) != 1) {
+        clear();
         return false;
       }
-      uint8_t unitVal;
-      if (file.read(&unitVal, 1) != 1) {
+      if ((part.tagId != NO_NAME && part.tagId >= nameCount) ||
+          (part.classId != NO_NAME && part.classId >= nameCount)) {
+        LOG_DBG("CSS", "Invalid name ID in cache rule");
+        clear();
         return false;
       }
-      len.unit = static_cast<CssUnit>(unitVal);
-      return true;
-    };
-
-    if (!readLength(style.textIndent) || !readLength(style.marginTop) || !readLength(style.marginBottom) ||
-        !readLength(style.marginLeft) || !readLength(style.marginRight) || !readLength(style.paddingTop) ||
-        !readLength(style.paddingBottom) || !readLength(style.paddingLeft) || !readLength(style.paddingRight) ||
-        !readLength(style.imageHeight) || !readLength(style.imageWidth)) {
-      rulesBySelector_.clear();
-      return false;
+      part.childOfPrevious = childOfPrevious != 0;
     }
 
-    // Read display value
-    uint8_t displayVal;
-    if (file.read(&displayVal, 1) != 1) {
-      rulesBySelector_.clear();
+    if (!readStyle(reader, rule.style)) {
+      clear();
       return false;
     }
-    style.display = static_cast<CssDisplay>(displayVal);
+    ancestorRules_.push_back(rule);
+  }
 
-    // Read defined flags
-    uint16_t definedBits = 0;
-    if (file.read(&definedBits, sizeof(definedBits)) != sizeof(definedBits)) {
-      rulesBySelector_.clear();
-      return false;
-    }
-    style.defined.textAlign = (definedBits & 1 << 0) != 0;
-    style.defined.fontStyle = (definedBits & 1 << 1) != 0;
-    style.defined.fontWeight = (definedBits & 1 << 2) != 0;
-    style.defined.textDecoration = (definedBits & 1 << 3) != 0;
-    style.defined.textIndent = (definedBits & 1 << 4) != 0;
-    style.defined.marginTop = (definedBits & 1 << 5) != 0;
-    style.defined.marginBottom = (definedBits & 1 << 6) != 0;
-    style.defined.marginLeft = (definedBits & 1 << 7) != 0;
-    style.defined.marginRight = (definedBits & 1 << 8) != 0;
-    style.defined.paddingTop = (definedBits & 1 << 9) != 0;
-    style.defined.paddingBottom = (definedBits & 1 << 10) != 0;
-    style.defined.paddingLeft = (definedBits & 1 << 11) != 0;
-    style.defined.paddingRight = (definedBits & 1 << 12) != 0;
-    style.defined.imageHeight = (definedBits & 1 << 13) != 0;
-    style.defined.imageWidth = (definedBits & 1 << 14) != 0;
-    style.defined.display = (definedBits & 1 << 15) != 0;
-
-    rulesBySelector_[selector] = style;
-  }
-
-  LOG_DBG("CSS", "Loaded %u rules from cache", ruleCount);
+  loadedCacheFile = cacheFile;
+  LOG_DBG("CSS", "Loaded %u rules and %u descendant/child rules with %u names from cache", ruleCount,
+          ancestorRuleCount, nameCount);
   return true;
 }
+
+void CssParser::releaseIfLowOnHeap() {
+  if (ESP.getFreeHeap() < MIN_FREE_HEAP_TO_KEEP_CSS) {
+    LOG_DBG("CSS", "Releasing rules, %u bytes of heap free", ESP.getFreeHeap());
+    clear();
+  }
+}
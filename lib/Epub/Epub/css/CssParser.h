@@ -13,25 +13,55 @@
  * Lightweight CSS parser for EPUB stylesheets
  *
  * Parses CSS files and extracts styling information relevant for e-ink display.
- * Uses a two-phase approach: first tokenizes the CSS content, then builds
- * a rule database that can be queried during HTML parsing.
+ * Uses a two-phase approach: first tokenizes the CSS content into a rule
+ * database keyed by selector, which saveToCache() then writes out as a
+ * precompiled index. loadFromCache() reads that index back, and it is what
+ * resolveStyle() queries during HTML parsing: tag and class names are interned
+ * into a sorted name table, and rules are sorted by (tag ID, class ID), so an
+ * element is resolved with a few binary searches and no allocation.
+ *
+ * Descendant and child selectors are bucketed by their rightmost part, so only
+ * the rules whose rightmost part names the element's tag or one of its classes
+ * are matched right to left against the element's ancestors.
  *
  * Supported selectors:
  *   - Element selectors: p, div, h1, etc.
  *   - Class selectors: .classname
  *   - Combined: element.classname
+ *   - Descendant and child: div p, div.chapter > p.first (up to MAX_SELECTOR_PARTS parts of the forms above)
  *   - Grouped: selector1, selector2 { }
  *
  * Not supported (silently ignored):
- *   - Descendant/child selectors
+ *   - Sibling combinators, attribute, ID and wildcard selectors
  *   - Pseudo-classes and pseudo-elements
  *   - Media queries (content is skipped)
  *   - @import, @font-face, etc.
  */
 class CssParser {
  public:
-  // Bump when CSS cache format or rules change; section caches are invalidated when this changes
-  static constexpr uint8_t CSS_CACHE_VERSION = 4;
+  // Bump when CSS cache format or rules change, along with the section file version so that sections are rebuilt
+  static constexpr uint8_t CSS_CACHE_VERSION = 6;
+
+  // Most parts in a descendant/child selector; longer selectors are ignored
+  static constexpr size_t MAX_SELECTOR_PARTS = 4;
+  // Most classes of one element considered when matching; further classes are ignored
+  static constexpr size_t MAX_ELEMENT_CLASSES = 8;
+  // ID of a name no rule uses, and of an absent selector part: NO_NAME tag for `.class`, NO_NAME class for `tag`
+  static constexpr uint16_t NO_NAME = 0xFFFF;
+
+  // An element's tag and classes as name IDs, for matching selectors without comparing strings
+  struct ElementKey {
+    uint16_t tagId = NO_NAME;
+    uint8_t classCount = 0;
+    uint16_t classIds[MAX_ELEMENT_CLASSES] = {};  // Only classes some rule names
+
+    [[nodiscard]] bool hasClass(const uint16_t classId) const {
+      for (uint8_t i = 0; i < classCount; ++i) {
+        if (classIds[i] == classId) return true;
+      }
+      return false;
+    }
+  };
 
   explicit CssParser(std::string cachePath) : cachePath(std::move(cachePath)) {}
   ~CssParser() = default;
@@ -51,12 +81,36 @@ class CssParser {
   /**
    * Look up the style for an HTML element, considering tag name and class attributes.
    * Applies CSS cascade: element style < class style < element.class style
+   * Only rules loaded by loadFromCache() are considered.
    *
    * @param tagName The HTML element name (e.g., "p", "div")
-   * @param classAttr The class attribute value (may contain multiple space-separated classes)
+   * @param classAttr The class attribute value (may contain multiple space-separated classes), or nullptr
+   * @return Combined style with all applicable rules merged
+   */
+  [[nodiscard]] CssStyle resolveStyle(const char* tagName, const char* classAttr) const {
+    return resolveStyle(makeElementKey(tagName, classAttr), nullptr, 0);
+  }
+
+  /**
+   * Look up the style for an HTML element inside the given ancestors, so that descendant and child selectors apply.
+   * Rules are applied in order of specificity: more classes win, then more tags.
+   *
+   * @param element Key of the element, from makeElementKey()
+   * @param ancestors Keys of the open ancestor elements, outermost first; may be null when ancestorCount is 0
    * @return Combined style with all applicable rules merged
    */
-  [[nodiscard]] CssStyle resolveStyle(const std::string& tagName, const std::string& classAttr) const;
+  [[nodiscard]] CssStyle resolveStyle(const ElementKey& element, const ElementKey* ancestors,
+                                      size_t ancestorCount) const;
+
+  /**
+   * Intern an element's tag name and class attribute (may be nullptr) into an ElementKey.
+   */
+  [[nodiscard]] ElementKey makeElementKey(const char* tagName, const char* classAttr) const;
+
+  /**
+   * Whether any loaded rule is a descendant/child selector, i.e. whether styles depend on ancestors
+   */
+  [[nodiscard]] bool hasAncestorRules() const { return !ancestorRules_.empty(); }
 
   /**
    * Parse an inline style attribute string.
@@ -68,17 +122,27 @@ class CssParser {
   /**
    * Check if any rules have been loaded
    */
-  [[nodiscard]] bool empty() const { return rulesBySelector_.empty(); }
+  [[nodiscard]] bool empty() const {
+    return rulesBySelector_.empty() && indexedRules_.empty() && ancestorRules_.empty();
+  }
 
   /**
    * Get count of loaded rule sets
    */
-  [[nodiscard]] size_t ruleCount() const { return rulesBySelector_.size(); }
+  [[nodiscard]] size_t ruleCount() const {
+    return rulesBySelector_.size() + indexedRules_.size() + ancestorRules_.size();
+  }
 
   /**
    * Clear all loaded rules
    */
-  void clear() { rulesBySelector_.clear(); }
+  void clear();
+
+  /**
+   * Select the cache file that the cache methods below use, <cachePath>/<name>.cache; "css_rules" until called.
+   * Lets one parser keep a compiled cache per set of stylesheets.
+   */
+  void setCacheName(const std::string& name) { cacheFile = cachePath + "/" + name + ".cache"; }
 
   /**
    * Check if CSS rules cache file exists
@@ -91,23 +155,80 @@ class CssParser {
   void deleteCache() const;
 
   /**
-   * Save parsed CSS rules to a cache file.
+   * Save parsed CSS rules to a cache file as a precompiled selector index.
    * @return true if cache was written successfully
    */
   bool saveToCache() const;
 
   /**
-   * Load CSS rules from a cache file.
-   * Clears any existing rules before loading.
+   * Load the precompiled selector index from a cache file.
+   * Clears any existing rules before loading, unless they were loaded from this same cache file and are still
+   * resident, in which case they are kept as they are.
    * @return true if cache was loaded successfully
    */
   bool loadFromCache();
 
+  /**
+   * Called once a chapter is laid out: frees the loaded rules if the heap is running short, otherwise keeps them so
+   * that the next chapter linking the same stylesheets doesn't read them back from the SD card.
+   */
+  void releaseIfLowOnHeap();
+
  private:
-  // Storage: maps normalized selector -> style properties
+  // Rule of the precompiled index; `tag.class` has both IDs set
+  struct IndexedRule {
+    uint16_t tagId;
+    uint16_t classId;
+    CssStyle style;
+  };
+
+  // One `tag`, `.class` or `tag.class` part of a descendant/child selector
+  struct SelectorPart {
+    uint16_t tagId;
+    uint16_t classId;
+    bool childOfPrevious;  // Joined to the part on its left by `>` rather than whitespace
+
+    [[nodiscard]] bool matches(const ElementKey& element) const {
+      return (tagId == NO_NAME || tagId == element.tagId) && (classId == NO_NAME || element.hasClass(classId));
+    }
+  };
+
+  // Descendant/child selector rule, parts left to right; bucketed by its last part
+  struct AncestorRule {
+    uint8_t partCount;
+    SelectorPart parts[MAX_SELECTOR_PARTS];
+    CssStyle style;
+
+    [[nodiscard]] const SelectorPart& last() const { return parts[partCount - 1]; }
+  };
+
+  // Parsing storage: maps normalized selector -> style properties
   std::unordered_map<std::string, CssStyle> rulesBySelector_;
 
+  // Lookup storage, read from the cache. A name's ID is its position in nameOffsets_,
+  // which is sorted by name; each offset points at a NUL-terminated lowercase name in names_.
+  std::string names_;
+  std::vector<uint16_t> nameOffsets_;
+  std::vector<IndexedRule> indexedRules_;    // Sorted by (tagId, classId)
+  std::vector<AncestorRule> ancestorRules_;  // Sorted by (tagId, classId) of the last part
+
   std::string cachePath;
+  std::string cacheFile = cachePath + "/css_rules.cache";
+  // Cache file the lookup storage was loaded from, empty when nothing is loaded
+  std::string loadedCacheFile;
+
+  // Index lookups; the name is matched case-insensitively
+  [[nodiscard]] uint16_t findNameId(const char* name, size_t len) const;
+  [[nodiscard]] const CssStyle* findIndexedRule(uint16_t tagId, uint16_t classId) const;
+  // Calls fn(rule) for each ancestor rule whose last part is exactly (tagId, classId)
+  template <typename Fn>
+  void forEachAncestorRule(uint16_t tagId, uint16_t classId, Fn&& fn) const;
+  // Whether parts [0, partIndex] match ancestors [0, ancestorCount), part partIndex + 1 having matched the element
+  // after them
+  static bool matchAncestors(const AncestorRule& rule, int partIndex, const ElementKey* ancestors,
+                             size_t ancestorCount);
+  // Rewrite a normalized descendant/child selector as its parts joined by " " or ">"; false if unsupported
+  static bool canonicalAncestorSelector(const std::string& selector, std::string& out);
 
   // Internal parsing helpers
   void processRuleBlockWithStyle(const std::string& selectorGroup, const CssStyle& style);
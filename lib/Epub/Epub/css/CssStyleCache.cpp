@@ -0,0 +1,56 @@
+#include "CssStyleCache.h"
+
+#include <Logging.h>
+
+static_assert((CssStyleCache::CAPACITY & (CssStyleCache::CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+uint64_t CssStyleCache::makeKey(const char* tagName, const char* classAttr, const char* styleAttr,
+                                const uint64_t ancestry) {
+  // FNV-1a over the ancestry, then the three strings, each followed by a NUL so that moving characters between them
+  // changes the key
+  uint64_t hash = 14695981039346656037ull;
+  const auto mix = [&hash](const uint8_t byte) {
+    hash ^= byte;
+    hash *= 1099511628211ull;
+  };
+  const auto mixString = [&mix](const char* s) {
+    if (s != nullptr) {
+      for (; *s; s++) {
+        mix(static_cast<uint8_t>(*s));
+      }
+    }
+    mix(0);
+  };
+  for (int shift = 0; shift < 64; shift += 8) {
+    mix(static_cast<uint8_t>(ancestry >> shift));
+  }
+  mixString(tagName);
+  mixString(classAttr);
+  mixString(styleAttr);
+  return hash != 0 ? hash : 1;
+}
+
+bool CssStyleCache::lookup(const uint64_t key, CssStyle& style) {
+  lookups++;
+  const Entry& entry = entries[static_cast<uint16_t>(key) & (CAPACITY - 1)];
+  if (entry.key != key) {
+    return false;
+  }
+  hits++;
+  style = entry.style;
+  return true;
+}
+
+void CssStyleCache::store(const uint64_t key, const CssStyle& style) {
+  Entry& entry = entries[static_cast<uint16_t>(key) & (CAPACITY - 1)];
+  entry.key = key;
+  entry.style = style;
+}
+
+void CssStyleCache::logStats() const {
+  if (lookups == 0) {
+    return;
+  }
+  LOG_DBG("CSC", "Element styles: %lu of %lu resolutions cached (%lu%%)", static_cast<unsigned long>(hits),
+          static_cast<unsigned long>(lookups), static_cast<unsigned long>(hits * 100ull / lookups));
+}
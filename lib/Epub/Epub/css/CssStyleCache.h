@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "CssStyle.h"
+
+/**
+ * Styles already resolved while building a section. Publisher XHTML repeats the same tag, class attribute and style
+ * attribute thousands of times in a chapter; a hit skips CssParser::resolveStyle() and re-parsing the inline style.
+ * Direct-mapped like WordWidthCache.
+ *
+ * Entries are keyed by a 64-bit hash of (tag, class attribute, style attribute, ancestry) and hold the stylesheet
+ * style with the inline style applied over it. The ancestry is a hash of the open ancestor elements when descendant
+ * or child selectors make the style depend on them, 0 otherwise.
+ */
+class CssStyleCache {
+ public:
+  static constexpr uint16_t CAPACITY = 64;  // Power of two; ~7KB
+
+  // classAttr and styleAttr may be null, which hashes like an empty attribute
+  static uint64_t makeKey(const char* tagName, const char* classAttr, const char* styleAttr, uint64_t ancestry);
+
+  bool lookup(uint64_t key, CssStyle& style);
+  void store(uint64_t key, const CssStyle& style);
+
+  void logStats() const;
+
+ private:
+  struct Entry {
+    uint64_t key;  // 0 marks an empty slot
+    CssStyle style;
+  };
+  Entry entries[CAPACITY] = {};
+  uint32_t lookups = 0;
+  uint32_t hits = 0;
+};
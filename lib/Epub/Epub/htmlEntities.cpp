@@ -3,6 +3,7 @@
 
 #include "htmlEntities.h"
 
+#include <cstdint>
 #include <cstring>
 
 struct EntityPair {
@@ -10,7 +11,7 @@ struct EntityPair {
   const char* value;
 };
 
-// Sorted lexicographically by key to allow binary search.
+// Kept sorted lexicographically by key, so a duplicate key fails the check below.
 static constexpr EntityPair ENTITY_LOOKUP[] = {
     {"&AElig;", "Æ"},    {"&Aacute;", "Á"},     {"&Acirc;", "Â"},      {"&Agrave;", "À"},   {"&Alpha;", "Α"},
     {"&Aring;", "Å"},    {"&Atilde;", "Ã"},     {"&Auml;", "Ä"},       {"&Beta;", "Β"},     {"&Ccedil;", "Ç"},
@@ -62,7 +63,7 @@ static constexpr EntityPair ENTITY_LOOKUP[] = {
     {"&yen;", "¥"},      {"&yuml;", "ÿ"},       {"&zeta;", "ζ"},       {"&zwj;", "\u200D"}, {"&zwnj;", "\u200C"},
 };
 
-static const size_t ENTITY_LOOKUP_COUNT = sizeof(ENTITY_LOOKUP) / sizeof(ENTITY_LOOKUP[0]);
+static constexpr size_t ENTITY_LOOKUP_COUNT = sizeof(ENTITY_LOOKUP) / sizeof(ENTITY_LOOKUP[0]);
 
 // Verify the table is sorted at compile time.
 static constexpr int constexprStrcmp(const char* a, const char* b) {
@@ -80,34 +81,68 @@ static constexpr bool isTableSorted() {
 }
 static_assert(isTableSorted(), "ENTITY_LOOKUP must be sorted lexicographically by key");
 
+// Keys are looked up in a hash table built at compile time: FNV-1a of the key, open addressing with linear probing
+// over ENTITY_SLOTS slots, each holding an index into ENTITY_LOOKUP (or NO_ENTITY). At under half full the probe
+// sequences stay short, and a lookup hashes the entity once and usually compares a single key; a miss gives up after
+// the longest probe sequence the build needed.
+static constexpr size_t ENTITY_SLOTS = 512;
+static constexpr uint8_t NO_ENTITY = 0xFF;
+static constexpr size_t MAX_ENTITY_PROBES = 8;
+static_assert(ENTITY_LOOKUP_COUNT < NO_ENTITY && ENTITY_LOOKUP_COUNT * 2 <= ENTITY_SLOTS, "Entity table too full");
+
+static constexpr uint32_t entityHash(const char* key, const size_t len) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < len; i++) {
+    hash = (hash ^ static_cast<uint8_t>(key[i])) * 16777619u;
+  }
+  return hash;
+}
+
+static constexpr size_t constexprStrlen(const char* s) {
+  size_t len = 0;
+  while (s[len] != '\0') len++;
+  return len;
+}
+
+struct EntityIndex {
+  uint8_t slots[ENTITY_SLOTS];
+  uint8_t keyLengths[ENTITY_LOOKUP_COUNT];
+  size_t maxProbes;
+};
+
+static constexpr EntityIndex buildEntityIndex() {
+  EntityIndex index{};
+  for (size_t slot = 0; slot < ENTITY_SLOTS; slot++) index.slots[slot] = NO_ENTITY;
+  for (size_t i = 0; i < ENTITY_LOOKUP_COUNT; i++) {
+    const size_t keyLen = constexprStrlen(ENTITY_LOOKUP[i].key);
+    index.keyLengths[i] = static_cast<uint8_t>(keyLen);
+    size_t slot = entityHash(ENTITY_LOOKUP[i].key, keyLen) & (ENTITY_SLOTS - 1);
+    size_t probes = 1;
+    while (index.slots[slot] != NO_ENTITY) {
+      slot = (slot + 1) & (ENTITY_SLOTS - 1);
+      probes++;
+    }
+    index.slots[slot] = static_cast<uint8_t>(i);
+    if (probes > index.maxProbes) index.maxProbes = probes;
+  }
+  return index;
+}
+
+static constexpr EntityIndex ENTITY_INDEX = buildEntityIndex();
+static_assert(ENTITY_INDEX.maxProbes <= MAX_ENTITY_PROBES, "Entity hash clusters, change ENTITY_SLOTS");
+
 // Lookup a single HTML entity and return its UTF-8 value.
 const char* lookupHtmlEntity(const char* entity, size_t len) {
   if (entity == nullptr || len == 0) return nullptr;
 
-  size_t lo = 0;
-  size_t hi = ENTITY_LOOKUP_COUNT;
-
-  while (lo < hi) {
-    const size_t mid = lo + (hi - lo) / 2;
-    const char* key = ENTITY_LOOKUP[mid].key;
-    const size_t keyLen = strlen(key);
-    const size_t cmpLen = (len < keyLen) ? len : keyLen;
-    int cmp = memcmp(entity, key, cmpLen);
-    if (cmp == 0) {
-      // safety net: if prefix equal, shorter string is considered smaller
-      if (len < keyLen)
-        cmp = -1;
-      else if (len > keyLen)
-        cmp = 1;
-      else
-        cmp = 0;
+  size_t slot = entityHash(entity, len) & (ENTITY_SLOTS - 1);
+  for (size_t probe = 0; probe < ENTITY_INDEX.maxProbes; probe++) {
+    const uint8_t i = ENTITY_INDEX.slots[slot];
+    if (i == NO_ENTITY) return nullptr;
+    if (ENTITY_INDEX.keyLengths[i] == len && memcmp(entity, ENTITY_LOOKUP[i].key, len) == 0) {
+      return ENTITY_LOOKUP[i].value;
     }
-
-    if (cmp == 0) return ENTITY_LOOKUP[mid].value;
-    if (cmp < 0)
-      hi = mid;
-    else
-      lo = mid + 1;
+    slot = (slot + 1) & (ENTITY_SLOTS - 1);
   }
 
   return nullptr;
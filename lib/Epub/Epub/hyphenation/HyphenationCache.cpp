@@ -0,0 +1,44 @@
+#include "HyphenationCache.h"
+
+#include <Logging.h>
+
+static_assert((HyphenationCache::CAPACITY & (HyphenationCache::CAPACITY - 1)) == 0,
+              "CAPACITY must be a power of two");
+
+uint64_t HyphenationCache::makeKey(const std::string_view word, const bool includeFallback) {
+  // FNV-1a over the fallback flag, then the text
+  uint64_t hash = 14695981039346656037ull;
+  const auto mix = [&hash](const uint8_t byte) {
+    hash ^= byte;
+    hash *= 1099511628211ull;
+  };
+  mix(includeFallback ? 1 : 0);
+  for (const char c : word) {
+    mix(static_cast<uint8_t>(c));
+  }
+  return hash != 0 ? hash : 1;
+}
+
+bool HyphenationCache::lookup(const uint64_t key, uint64_t& breakMask, uint64_t& hyphenMask) {
+  lookups++;
+  const Entry& entry = entries[static_cast<uint16_t>(key) & (CAPACITY - 1)];
+  if (entry.key != key) {
+    return false;
+  }
+  hits++;
+  breakMask = entry.breakMask;
+  hyphenMask = entry.hyphenMask;
+  return true;
+}
+
+void HyphenationCache::store(const uint64_t key, const uint64_t breakMask, const uint64_t hyphenMask) {
+  entries[static_cast<uint16_t>(key) & (CAPACITY - 1)] = {key, breakMask, hyphenMask};
+}
+
+void HyphenationCache::logStats() const {
+  if (lookups == 0) {
+    return;
+  }
+  LOG_DBG("HYC", "Hyphenation: %lu of %lu lookups cached (%lu%%)", static_cast<unsigned long>(hits),
+          static_cast<unsigned long>(lookups), static_cast<unsigned long>(hits * 100ull / lookups));
+}
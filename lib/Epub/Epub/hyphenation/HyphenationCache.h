@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * Hyphenation break points of the words already looked up while building a section. Line breaking asks for the
+ * breaks of every word that overflows a line, and the same words keep coming back over a chapter; a hit skips the
+ * codepoint decoding and the pattern trie walk. Direct-mapped like WordWidthCache.
+ *
+ * Breaks are stored as bitmasks over the word's byte offsets, so only words shorter than MAX_WORD_BYTES are cached.
+ * Words with no break points are cached too, they are the most common result.
+ */
+class HyphenationCache {
+ public:
+  static constexpr uint16_t CAPACITY = 128;  // Power of two; 3KB
+  static constexpr size_t MAX_WORD_BYTES = 64;
+
+  static bool fits(std::string_view word) { return word.size() < MAX_WORD_BYTES; }
+  static uint64_t makeKey(std::string_view word, bool includeFallback);
+
+  // Bit n of breakMask marks a break before byte n; the same bit of hyphenMask marks that it needs an inserted hyphen
+  bool lookup(uint64_t key, uint64_t& breakMask, uint64_t& hyphenMask);
+  void store(uint64_t key, uint64_t breakMask, uint64_t hyphenMask);
+
+  void logStats() const;
+
+ private:
+  struct Entry {
+    uint64_t key;  // 0 marks an empty slot
+    uint64_t breakMask;
+    uint64_t hyphenMask;
+  };
+  Entry entries[CAPACITY] = {};
+  uint32_t lookups = 0;
+  uint32_t hits = 0;
+};
@@ -95,24 +95,24 @@ void appendSegmentPatternBreaks(const std::vector<CodepointInfo>& cps, const Lan
     }
 
     if (i > segStart) {
-      std::vector<CodepointInfo> segment(cps.begin() + segStart, cps.begin() + i);
-      auto segIndexes = hyphenator.breakIndexes(segment);
+      const size_t segmentSize = i - segStart;
+      size_t segIndexes[LIANG_MAX_BREAK_INDEXES];
+      const size_t patternCount =
+          hyphenator.breakIndexes(cps.data() + segStart, segmentSize, segIndexes, LIANG_MAX_BREAK_INDEXES);
 
-      if (includeFallback && segIndexes.empty()) {
+      if (includeFallback && patternCount == 0) {
         const size_t minPrefix = hyphenator.minPrefix();
         const size_t minSuffix = hyphenator.minSuffix();
-        for (size_t idx = minPrefix; idx + minSuffix <= segment.size(); ++idx) {
-          segIndexes.push_back(idx);
+        for (size_t idx = minPrefix; idx + minSuffix <= segmentSize; ++idx) {
+          outBreaks.push_back({cps[segStart + idx].byteOffset, true});
         }
       }
 
-      for (const size_t idx : segIndexes) {
-        assert(idx > 0 && idx < segment.size());
-        if (idx == 0 || idx >= segment.size()) continue;
-        const size_t cpIdx = segStart + idx;
-        if (cpIdx < cps.size()) {
-          outBreaks.push_back({cps[cpIdx].byteOffset, true});
-        }
+      for (size_t k = 0; k < patternCount; ++k) {
+        const size_t idx = segIndexes[k];
+        assert(idx > 0 && idx < segmentSize);
+        if (idx == 0 || idx >= segmentSize) continue;
+        outBreaks.push_back({cps[segStart + idx].byteOffset, true});
       }
     }
 
@@ -235,30 +235,25 @@ std::vector<Hyphenator::BreakInfo> Hyphenator::breakOffsets(const std::string& w
   }
 
   // Ask language hyphenator for legal break points.
-  std::vector<size_t> indexes;
-  if (hyphenator) {
-    indexes = hyphenator->breakIndexes(cps);
-  }
+  size_t indexes[LIANG_MAX_BREAK_INDEXES];
+  const size_t patternCount =
+      hyphenator ? hyphenator->breakIndexes(cps.data(), cps.size(), indexes, LIANG_MAX_BREAK_INDEXES) : 0;
 
-  // Only add fallback breaks if needed
-  if (includeFallback && indexes.empty()) {
+  std::vector<Hyphenator::BreakInfo> breaks;
+  if (patternCount > 0) {
+    breaks.reserve(patternCount);
+    for (size_t k = 0; k < patternCount; ++k) {
+      breaks.push_back({byteOffsetForIndex(cps, indexes[k]), true});
+    }
+  } else if (includeFallback) {
+    // Only add fallback breaks if needed
     const size_t minPrefix = hyphenator ? hyphenator->minPrefix() : LiangWordConfig::kDefaultMinPrefix;
     const size_t minSuffix = hyphenator ? hyphenator->minSuffix() : LiangWordConfig::kDefaultMinSuffix;
     for (size_t idx = minPrefix; idx + minSuffix <= cps.size(); ++idx) {
-      indexes.push_back(idx);
+      breaks.push_back({byteOffsetForIndex(cps, idx), true});
     }
   }
 
-  if (indexes.empty()) {
-    return {};
-  }
-
-  std::vector<Hyphenator::BreakInfo> breaks;
-  breaks.reserve(indexes.size());
-  for (const size_t idx : indexes) {
-    breaks.push_back({byteOffsetForIndex(cps, idx), true});
-  }
-
   return breaks;
 }
 
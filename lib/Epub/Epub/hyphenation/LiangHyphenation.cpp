@@ -1,5 +1,7 @@
 #include "LiangHyphenation.h"
 
+#include <HalIram.h>
+
 #include <algorithm>
 #include <vector>
 
@@ -18,14 +20,14 @@
  *       while still emitting hyphen positions in codepoint space.
  *
  * 2.  Automaton decoding
- *     - SerializedHyphenationPatterns stores a contiguous blob generated from
- *       Typst's binary tries. The first 4 bytes contain the root offset. Each
- *       node packs transitions, variable-stride relative offsets to child
- *       nodes, and an optional pointer into a shared "levels" list. We parse
+ *     - SerializedHyphenationPatterns stores a contiguous blob re-encoded by
+ *       generate_hyphenation_trie.py from Typst's binary tries. Each node packs
+ *       transitions, variable-width targets (an index into the hub table of
+ *       the most shared nodes, a 6- or 14-bit relative offset or a 22-bit
+ *       address) and an optional pointer into a shared "levels" list. We parse
  *       that layout lazily via decodeState/transition, keeping everything in
  *       flash memory; no heap allocations besides the stack-local AutomatonState
- *       structs. getAutomaton caches parseAutomaton results per blob pointer so
- *       multiple words hitting the same language only pay the cost once.
+ *       structs.
  *
  * 3.  Pattern application
  *     - We walk the augmented bytes left-to-right. For each starting byte we
@@ -126,11 +128,12 @@ size_t encodeUtf8(uint32_t cp, AugmentedWord& word) {
 
 // Build the dotted, lowercase UTF-8 representation plus lookup tables into `word`.
 // Returns false if the word should be skipped (empty, non-letter, or too long).
-bool buildAugmentedWord(AugmentedWord& word, const std::vector<CodepointInfo>& cps, const LiangWordConfig& config) {
+bool buildAugmentedWord(AugmentedWord& word, const CodepointInfo* cps, const size_t cpCount,
+                        const LiangWordConfig& config) {
   word.byteLen = 0;
   word.charCount_ = 0;
 
-  if (cps.empty()) {
+  if (cpCount == 0) {
     return false;
   }
 
@@ -138,7 +141,8 @@ bool buildAugmentedWord(AugmentedWord& word, const std::vector<CodepointInfo>& c
   word.charByteOffsets[word.charCount_++] = 0;
   word.bytes[word.byteLen++] = '.';
 
-  for (const auto& info : cps) {
+  for (size_t i = 0; i < cpCount; ++i) {
+    const CodepointInfo& info = cps[i];
     if (!config.isLetter(info.value)) {
       word.byteLen = 0;
       word.charCount_ = 0;
@@ -183,13 +187,12 @@ bool buildAugmentedWord(AugmentedWord& word, const std::vector<CodepointInfo>& c
 
 // Decoded view of a single trie node pulled straight out of the serialized blob.
 // - transitions: contiguous list of next-byte values
-// - targets: packed relative offsets (1/2/3 bytes) for each transition
+// - targets: the 1-3 byte target of each transition, back-to-back
 // - levels: optional pointer into the global levels list with packed dist/level pairs
 struct AutomatonState {
   const uint8_t* data = nullptr;
   size_t size = 0;
   size_t addr = 0;
-  uint8_t stride = 1;
   size_t childCount = 0;
   const uint8_t* transitions = nullptr;
   const uint8_t* targets = nullptr;
@@ -200,7 +203,7 @@ struct AutomatonState {
 };
 
 // Interpret the node located at `addr`, returning transition metadata.
-AutomatonState decodeState(const EmbeddedAutomaton& automaton, size_t addr) {
+HOT_IRAM AutomatonState decodeState(const EmbeddedAutomaton& automaton, size_t addr) {
   AutomatonState state;
   if (addr >= automaton.size) {
     return state;
@@ -213,13 +216,9 @@ AutomatonState decodeState(const EmbeddedAutomaton& automaton, size_t addr) {
   const uint8_t header = base[pos++];
   // Header layout (bits):
   //   7        - hasLevels flag
-  //   6..5     - stride selector (0 -> 1 byte, otherwise 1|2|3)
+  //   6..5     - unused
   //   4..0     - child count (5 bits), 31 == overflow -> extra byte
   const bool hasLevels = (header >> 7) != 0;
-  uint8_t stride = static_cast<uint8_t>((header >> 5) & 0x03u);
-  if (stride == 0) {
-    stride = 1;
-  }
   size_t childCount = static_cast<size_t>(header & 0x1Fu);
   if (childCount == 31u) {
     if (pos >= remaining) {
@@ -243,7 +242,7 @@ AutomatonState decodeState(const EmbeddedAutomaton& automaton, size_t addr) {
     if (offset + levelsLen > automaton.size) {
       return AutomatonState{};
     }
-    levelsPtr = automaton.data + offset - 4u;
+    levelsPtr = automaton.data + offset;
   }
 
   if (pos + childCount > remaining) {
@@ -252,8 +251,8 @@ AutomatonState decodeState(const EmbeddedAutomaton& automaton, size_t addr) {
   const uint8_t* transitions = base + pos;
   pos += childCount;
 
-  const size_t targetsBytes = childCount * stride;
-  if (pos + targetsBytes > remaining) {
+  // Targets are at least a byte each; the ones actually followed are bounds checked in transition
+  if (pos + childCount > remaining) {
     return AutomatonState{};
   }
   const uint8_t* targets = base + pos;
@@ -261,7 +260,6 @@ AutomatonState decodeState(const EmbeddedAutomaton& automaton, size_t addr) {
   state.data = automaton.data;
   state.size = automaton.size;
   state.addr = addr;
-  state.stride = stride;
   state.childCount = childCount;
   state.transitions = transitions;
   state.targets = targets;
@@ -270,40 +268,82 @@ AutomatonState decodeState(const EmbeddedAutomaton& automaton, size_t addr) {
   return state;
 }
 
-// Convert the packed stride-sized delta back into a signed offset.
-int32_t decodeDelta(const uint8_t* buf, uint8_t stride) {
-  if (stride == 1) {
-    return static_cast<int8_t>(buf[0]);
+// Bytes taken by the target starting with `first`.
+size_t targetWidth(const uint8_t first) {
+  switch (first >> 6) {
+    case 2:
+      return 2;
+    case 3:
+      return 3;
+    default:
+      return 1;
   }
-  if (stride == 2) {
-    return static_cast<int16_t>((static_cast<uint16_t>(buf[0]) << 8) | static_cast<uint16_t>(buf[1]));
+}
+
+// Read the 24-bit big-endian value at `buf`.
+size_t read24(const uint8_t* buf) {
+  return (static_cast<size_t>(buf[0]) << 16) | (static_cast<size_t>(buf[1]) << 8) | static_cast<size_t>(buf[2]);
+}
+
+// Resolve the target at `buf` of the node at `addr` to the address of the child node. The top two bits of the
+// first byte select the encoding:
+//   00 - index into the hub table (6 bits)
+//   01 - signed offset from the node's address (6 bits)
+//   10 - signed offset from the node's address (14 bits, big-endian)
+//   11 - address (22 bits, big-endian)
+// Returns SIZE_MAX if the target points outside the blob.
+size_t decodeTarget(const EmbeddedAutomaton& automaton, const size_t addr, const uint8_t* buf) {
+  int32_t delta = 0;
+  switch (buf[0] >> 6) {
+    case 0: {
+      const size_t entry = automaton.hubOffset + 3u * buf[0];
+      return entry + 3u <= automaton.size ? read24(automaton.data + entry) : SIZE_MAX;
+    }
+    case 1:
+      // Sign-extend the low 6 bits
+      delta = static_cast<int32_t>(buf[0] & 0x3Fu) - ((buf[0] & 0x20u) ? 0x40 : 0);
+      break;
+    case 2: {
+      const int32_t value = (static_cast<int32_t>(buf[0] & 0x3Fu) << 8) | buf[1];
+      delta = value - ((value & 0x2000) ? 0x4000 : 0);
+      break;
+    }
+    default:
+      return read24(buf) & 0x3FFFFFu;
   }
-  const int32_t unsignedVal =
-      (static_cast<int32_t>(buf[0]) << 16) | (static_cast<int32_t>(buf[1]) << 8) | static_cast<int32_t>(buf[2]);
-  return unsignedVal - (1 << 23);
+  const int64_t target = static_cast<int64_t>(addr) + delta;
+  return target < 0 ? SIZE_MAX : static_cast<size_t>(target);
 }
 
 // Follow a single byte transition from `state`, decoding the child node on success.
-bool transition(const EmbeddedAutomaton& automaton, const AutomatonState& state, uint8_t letter, AutomatonState& out) {
+HOT_IRAM bool transition(const EmbeddedAutomaton& automaton, const AutomatonState& state, uint8_t letter,
+                         AutomatonState& out) {
   if (!state.valid()) {
     return false;
   }
 
-  // Children remain sorted by letter in the serialized blob, but the lists are
-  // short enough that a linear scan keeps code size down compared to binary search.
+  // Children are sorted by letter in the serialized blob, so the linear scan stops at the
+  // first letter past the one looked for. Targets vary in width, so the target of a
+  // transition is found by skipping the ones before it.
+  const uint8_t* end = state.data + state.size;
+  const uint8_t* target = state.targets;
   for (size_t idx = 0; idx < state.childCount; ++idx) {
+    if (target >= end || state.transitions[idx] > letter) {
+      return false;
+    }
+    const size_t width = targetWidth(target[0]);
     if (state.transitions[idx] != letter) {
+      target += width;
       continue;
     }
-    const uint8_t* deltaPtr = state.targets + idx * state.stride;
-    const int32_t delta = decodeDelta(deltaPtr, state.stride);
-    // Deltas are relative to the current node's address, allowing us to keep all
-    // targets within 24 bits while still referencing further nodes in the blob.
-    const int64_t nextAddr = static_cast<int64_t>(state.addr) + delta;
-    if (nextAddr < 0 || static_cast<size_t>(nextAddr) >= automaton.size) {
+    if (static_cast<size_t>(end - target) < width) {
+      return false;
+    }
+    const size_t nextAddr = decodeTarget(automaton, state.addr, target);
+    if (nextAddr >= automaton.size) {
       return false;
     }
-    out = decodeState(automaton, static_cast<size_t>(nextAddr));
+    out = decodeState(automaton, nextAddr);
     return out.valid();
   }
   return false;
@@ -311,16 +351,14 @@ bool transition(const EmbeddedAutomaton& automaton, const AutomatonState& state,
 
 // Converts odd score positions back into codepoint indexes, honoring min prefix/suffix constraints.
 // Each break corresponds to scores[breakIndex + 1] because of the leading '.' sentinel.
-// Convert odd score entries into hyphen positions while honoring prefix/suffix limits.
-std::vector<size_t> collectBreakIndexes(const std::vector<CodepointInfo>& cps, const uint8_t* scores,
-                                        const size_t scoresSize, const size_t minPrefix, const size_t minSuffix) {
-  std::vector<size_t> indexes;
-  const size_t cpCount = cps.size();
+size_t collectBreakIndexes(const size_t cpCount, const uint8_t* scores, const size_t scoresSize,
+                           const size_t minPrefix, const size_t minSuffix, size_t* out, const size_t capacity) {
+  size_t count = 0;
   if (cpCount < 2) {
-    return indexes;
+    return count;
   }
 
-  for (size_t breakIndex = 1; breakIndex < cpCount; ++breakIndex) {
+  for (size_t breakIndex = 1; breakIndex < cpCount && count < capacity; ++breakIndex) {
     if (breakIndex < minPrefix) {
       continue;
     }
@@ -337,29 +375,31 @@ std::vector<size_t> collectBreakIndexes(const std::vector<CodepointInfo>& cps, c
     if ((scores[scoreIdx] & 1u) == 0) {
       continue;
     }
-    indexes.push_back(breakIndex);
+    out[count++] = breakIndex;
   }
 
-  return indexes;
+  return count;
 }
 
 }  // namespace
 
+static_assert(MAX_WORD_CHARS <= LIANG_MAX_BREAK_INDEXES, "A word can have more breaks than callers make room for");
+
 // Entry point that runs the full Liang pipeline for a single word.
-std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
-                                      const SerializedHyphenationPatterns& patterns, const LiangWordConfig& config) {
+size_t liangBreakIndexes(const CodepointInfo* cps, const size_t cpCount, const SerializedHyphenationPatterns& patterns,
+                         const LiangWordConfig& config, size_t* out, const size_t capacity) {
   // AugmentedWord uses fixed-size C arrays (no heap allocation) to avoid
   // fragmenting the heap across hundreds of words during page layout.
   AugmentedWord augmented;
-  if (!buildAugmentedWord(augmented, cps, config)) {
-    return {};
+  if (!buildAugmentedWord(augmented, cps, cpCount, config)) {
+    return 0;
   }
 
   const EmbeddedAutomaton& automaton = patterns;
 
   const AutomatonState root = decodeState(automaton, automaton.rootOffset);
   if (!root.valid()) {
-    return {};
+    return 0;
   }
 
   // Liang scores: one entry per augmented char (leading/trailing dots included).
@@ -413,5 +453,12 @@ std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
     }
   }
 
-  return collectBreakIndexes(cps, scores, augmented.charCount_, config.minPrefix, config.minSuffix);
+  return collectBreakIndexes(cpCount, scores, augmented.charCount_, config.minPrefix, config.minSuffix, out, capacity);
+}
+
+std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
+                                      const SerializedHyphenationPatterns& patterns, const LiangWordConfig& config) {
+  size_t indexes[LIANG_MAX_BREAK_INDEXES];
+  const size_t count = liangBreakIndexes(cps.data(), cps.size(), patterns, config, indexes, LIANG_MAX_BREAK_INDEXES);
+  return std::vector<size_t>(indexes, indexes + count);
 }
@@ -33,6 +33,14 @@ struct LiangWordConfig {
       : isLetter(letterFn), toLower(lowerFn), minPrefix(prefix), minSuffix(suffix) {}
 };
 
-// Shared Liang pattern evaluator used by every language-specific hyphenator.
+// Most break indexes the evaluator reports for one word; longer words are not hyphenated.
+constexpr size_t LIANG_MAX_BREAK_INDEXES = 70;
+
+// Shared Liang pattern evaluator used by every language-specific hyphenator. Works on the caller's buffers without
+// allocating: writes at most `capacity` ascending break indexes into `out` and returns how many it wrote.
+size_t liangBreakIndexes(const CodepointInfo* cps, size_t cpCount, const SerializedHyphenationPatterns& patterns,
+                         const LiangWordConfig& config, size_t* out, size_t capacity);
+
+// Convenience wrapper returning the break indexes as a vector.
 std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
                                       const SerializedHyphenationPatterns& patterns, const LiangWordConfig& config);
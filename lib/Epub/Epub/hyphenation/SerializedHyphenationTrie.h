@@ -4,8 +4,11 @@
 #include <cstdint>
 
 // Lightweight descriptor that points at a serialized Liang hyphenation trie stored in flash.
+// See docs/hyphenation-trie-format.md for the layout of data.
 struct SerializedHyphenationPatterns {
   size_t rootOffset;
+  // Table of 3-byte addresses of the nodes most targets point at, which targets refer to by index
+  size_t hubOffset;
   const std::uint8_t* data;
   size_t size;
 };
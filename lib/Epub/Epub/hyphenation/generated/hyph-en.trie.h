@@ -7,1694 +7,1459 @@
 
 // Auto-generated by generate_hyphenation_trie.py. Do not edit manually.
 alignas(4) constexpr uint8_t en_trie_data[] = {
-    0x2C, 0x22, 0x1F, 0x21, 0x23, 0x2D, 0x37, 0x41, 0x2A, 0x20, 0x4B, 0x2B, 0x35, 0x23, 0x19, 0x2B,
-    0x0E, 0x29, 0x2D, 0x0F, 0x36, 0x04, 0x19, 0x19, 0x19, 0x0F, 0x17, 0x15, 0x04, 0x0C, 0x0D, 0x18,
-    0x02, 0x04, 0x18, 0x03, 0x16, 0x0E, 0x0E, 0x0B, 0x0F, 0x19, 0x05, 0x0F, 0x0E, 0x0F, 0x17, 0x0D,
-    0x02, 0x0C, 0x19, 0x18, 0x05, 0x0F, 0x18, 0x18, 0x0C, 0x01, 0x02, 0x0B, 0x04, 0x0B, 0x04, 0x16,
-    0x04, 0x22, 0x04, 0x0D, 0x02, 0x0D, 0x2D, 0x0E, 0x03, 0x17, 0x03, 0x23, 0x0C, 0x0C, 0x05, 0x22,
-    0x02, 0x0F, 0x0C, 0x04, 0x0F, 0x02, 0x22, 0x04, 0x17, 0x04, 0x15, 0x03, 0x20, 0x16, 0x0F, 0x01,
-    0x0E, 0x0E, 0x04, 0x0D, 0x0C, 0x23, 0x0E, 0x03, 0x0E, 0x01, 0x0C, 0x02, 0x0D, 0x0E, 0x16, 0x0C,
-    0x0B, 0x0E, 0x23, 0x0F, 0x0B, 0x0C, 0x01, 0x0E, 0x0D, 0x05, 0x17, 0x0E, 0x17, 0x01, 0x15, 0x04,
-    0x0B, 0x0E, 0x02, 0x0B, 0x0C, 0x0B, 0x0B, 0x18, 0x0B, 0x0F, 0x23, 0x0D, 0x21, 0x15, 0x16, 0x0E,
-    0x18, 0x0E, 0x0D, 0x17, 0x0B, 0x22, 0x0C, 0x0F, 0x20, 0x0F, 0x0B, 0x17, 0x0E, 0x0C, 0x04, 0x0B,
-    0x0C, 0x01, 0x18, 0x05, 0x0E, 0x03, 0x0E, 0x0E, 0x04, 0x0D, 0x0D, 0x05, 0x23, 0x02, 0x0F, 0x0D,
-    0x0F, 0x0F, 0x03, 0x22, 0x21, 0x0E, 0x18, 0x0D, 0x02, 0x18, 0x05, 0x19, 0x04, 0x0F, 0x0E, 0x40,
-    0x17, 0x17, 0x0E, 0x22, 0x05, 0x0F, 0x0C, 0x02, 0x15, 0x04, 0x23, 0x0C, 0x0F, 0x0F, 0x05, 0x0C,
-    0x04, 0x0E, 0x0E, 0x0C, 0x22, 0x0F, 0x22, 0x1F, 0x0D, 0x16, 0x0B, 0x0E, 0x19, 0x22, 0x0E, 0x19,
-    0x0E, 0x05, 0x23, 0x0F, 0x21, 0x17, 0x03, 0x18, 0x0C, 0x18, 0x01, 0x0B, 0x03, 0x15, 0x02, 0x0D,
-    0x0C, 0x01, 0x0C, 0x0C, 0x17, 0x19, 0x05, 0x18, 0x2C, 0x0D, 0x2C, 0x0F, 0x05, 0x2C, 0x16, 0x0D,
-    0x21, 0x0D, 0x21, 0x0C, 0x16, 0x16, 0x05, 0x21, 0x02, 0x16, 0x0E, 0x15, 0x2D, 0x19, 0x02, 0x0B,
-    0x0E, 0x01, 0x16, 0x29, 0x10, 0x0B, 0x37, 0x19, 0x22, 0x0B, 0x15, 0x23, 0x15, 0x21, 0x10, 0x2A,
-    0x0D, 0x24, 0x0B, 0x15, 0x22, 0x15, 0x2D, 0x0C, 0x0B, 0x1F, 0x0E, 0x24, 0x0D, 0x29, 0x0C, 0x33,
-    0x2D, 0x15, 0x42, 0x2E, 0x18, 0x2E, 0x15, 0x23, 0x1F, 0x21, 0x19, 0x23, 0x23, 0x20, 0x0D, 0x20,
-    0x0B, 0x1A, 0x15, 0x17, 0x19, 0x17, 0x15, 0x0C, 0x17, 0x23, 0x21, 0x15, 0x0B, 0x1A, 0x0B, 0x19,
-    0x0C, 0x0B, 0x0D, 0x2A, 0x0B, 0x2A, 0x0C, 0x1F, 0x19, 0x16, 0x0B, 0x0B, 0x24, 0x0C, 0x23, 0x0B,
-    0x1F, 0x0B, 0x0C, 0x1A, 0x15, 0x0D, 0x29, 0x0B, 0x0C, 0x21, 0x1A, 0x01, 0x16, 0x0B, 0x19, 0x29,
-    0x17, 0x21, 0x02, 0x0B, 0x16, 0x03, 0x19, 0x29, 0x0F, 0x0B, 0x17, 0x2D, 0x2B, 0x0F, 0x15, 0x15,
-    0x0B, 0x01, 0x10, 0x0D, 0x0D, 0x29, 0x0C, 0x0D, 0x0E, 0x0D, 0x2E, 0x1F, 0x10, 0x0B, 0x05, 0x16,
-    0x29, 0x02, 0x0B, 0x0E, 0x0D, 0x0B, 0x16, 0x0D, 0x19, 0x0D, 0x0F, 0x1F, 0x0E, 0x33, 0x0C, 0x2E,
-    0x0D, 0x01, 0x1A, 0x01, 0x19, 0x18, 0x0D, 0x0F, 0x0D, 0x2E, 0x0B, 0x01, 0x21, 0x1A, 0x17, 0x10,
-    0x16, 0x15, 0x1F, 0x0B, 0x01, 0x2B, 0x01, 0x23, 0x03, 0x1F, 0x0B, 0x21, 0x0B, 0x1F, 0x1F, 0x38,
-    0x0B, 0x17, 0x2B, 0x03, 0x17, 0x19, 0x1A, 0x0D, 0x15, 0x0C, 0x15, 0x05, 0x29, 0x15, 0x05, 0x1F,
-    0x15, 0x1F, 0x0F, 0x18, 0x15, 0x2E, 0x0F, 0x0F, 0x34, 0x20, 0x19, 0x0D, 0x16, 0x15, 0x05, 0x21,
-    0x15, 0x21, 0x1F, 0x0B, 0x0D, 0x38, 0x0D, 0x16, 0x0B, 0x0D, 0x18, 0x21, 0x18, 0x0F, 0x29, 0x21,
-    0x0B, 0x0B, 0x10, 0x0D, 0x0E, 0x38, 0x18, 0x23, 0x1F, 0x0D, 0x17, 0x29, 0x01, 0x35, 0x2B, 0x0D,
-    0x03, 0x2A, 0x2B, 0x10, 0x0D, 0x0C, 0x21, 0x22, 0x0F, 0x2B, 0x34, 0x0B, 0x1A, 0x0D, 0x17, 0x2D,
-    0x23, 0x03, 0x18, 0x0F, 0x0B, 0x0D, 0x1F, 0x16, 0x0D, 0x0B, 0x23, 0x10, 0x06, 0x19, 0x33, 0x0D,
-    0x23, 0x05, 0x17, 0x23, 0x33, 0x29, 0x01, 0x20, 0x17, 0x1F, 0x15, 0x1A, 0x0F, 0x03, 0x33, 0x03,
-    0x0C, 0x15, 0x0B, 0x3F, 0x0C, 0x0B, 0x0D, 0x1F, 0x0F, 0x2D, 0x0D, 0x0C, 0x0B, 0x23, 0x01, 0x29,
-    0x33, 0x0B, 0x1F, 0x18, 0x0B, 0x16, 0x1F, 0x10, 0x01, 0x2B, 0x0C, 0x05, 0x1F, 0x0B, 0x10, 0x1A,
-    0x05, 0x20, 0x15, 0x0F, 0x1F, 0x1F, 0x0C, 0x2B, 0x1F, 0x49, 0x0D, 0x3D, 0x03, 0x1F, 0x15, 0x03,
-    0x29, 0x0F, 0x0B, 0x15, 0x21, 0x33, 0x15, 0x0B, 0x23, 0x15, 0x15, 0x21, 0x0D, 0x35, 0x10, 0x0C,
-    0x29, 0x0E, 0xA0, 0x00, 0x41, 0x21, 0x68, 0xFD, 0xA0, 0x00, 0x51, 0x21, 0x72, 0xFD, 0x21, 0x65,
-    0xFD, 0x21, 0x64, 0xFD, 0xA0, 0x00, 0x61, 0x21, 0x74, 0xFD, 0xA0, 0x00, 0x71, 0x21, 0x74, 0xFD,
-    0xA0, 0x00, 0x81, 0x21, 0x74, 0xFD, 0x21, 0x61, 0xFD, 0xA0, 0x00, 0x91, 0x21, 0x6D, 0xFD, 0xA0,
-    0x00, 0xA1, 0x21, 0x73, 0xFD, 0xA2, 0x00, 0x41, 0x65, 0x69, 0xE5, 0xFD, 0x24, 0x63, 0x67, 0x69,
-    0x74, 0xE4, 0xC6, 0xF0, 0xF9, 0x21, 0x65, 0xC3, 0x22, 0x69, 0x79, 0xFD, 0xC0, 0x22, 0x73, 0x74,
-    0xD3, 0xFB, 0xA0, 0x00, 0xB1, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x24, 0x63, 0x70, 0x73, 0x74,
-    0xBF, 0xB9, 0xB9, 0xFD, 0x21, 0x6D, 0xCB, 0x21, 0x6F, 0xFD, 0x41, 0x64, 0xFF, 0xAA, 0x41, 0x69,
-    0xFF, 0x9A, 0x41, 0x6E, 0xFF, 0x90, 0x4C, 0x63, 0x64, 0x66, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74,
-    0x75, 0x76, 0x77, 0xFF, 0x8F, 0xFF, 0x9B, 0xFF, 0xA1, 0xFF, 0xA7, 0xFF, 0xB0, 0xFF, 0xC6, 0xFF,
-    0xD7, 0xFF, 0xE5, 0xFF, 0xF1, 0xFF, 0xF4, 0xFF, 0xF8, 0xFF, 0xFC, 0x41, 0x61, 0xFF, 0x85, 0x41,
-    0x65, 0xFF, 0x63, 0x43, 0x67, 0x6E, 0x73, 0xFF, 0x65, 0xFF, 0xF8, 0xFF, 0xFC, 0xC1, 0x00, 0x41,
-    0x61, 0xFF, 0x73, 0x41, 0x6F, 0xFF, 0x6D, 0x42, 0x6D, 0x74, 0xFF, 0x63, 0xFF, 0xFC, 0x22, 0x72,
-    0x73, 0xEF, 0xF9, 0xA0, 0x00, 0xC1, 0x21, 0x69, 0xFD, 0x41, 0x69, 0xFF, 0x39, 0x21, 0x74, 0xFC,
-    0x21, 0x74, 0xFD, 0x24, 0x61, 0x65, 0x72, 0x75, 0xD0, 0xEB, 0xF3, 0xFD, 0x21, 0x70, 0xC3, 0x41,
-    0x63, 0xFF, 0x4A, 0x41, 0x62, 0xFF, 0x4C, 0x21, 0x61, 0xFC, 0x41, 0x6C, 0xFF, 0x3F, 0x21, 0x6F,
-    0xFC, 0x45, 0x6D, 0x6E, 0x70, 0x72, 0x74, 0xFF, 0xEB, 0xFF, 0xEE, 0xFF, 0xF6, 0xFF, 0xFD, 0xFF,
-    0x17, 0x41, 0x61, 0xFF, 0x07, 0x21, 0x6C, 0xFC, 0x41, 0x69, 0xFF, 0x4A, 0x21, 0x6C, 0xFC, 0x21,
-    0x6C, 0xFD, 0xA1, 0x00, 0x51, 0x69, 0xFD, 0x41, 0x72, 0xFF, 0x12, 0xA1, 0x00, 0xD1, 0x74, 0xFC,
-    0x21, 0x65, 0xF7, 0xA1, 0x00, 0x51, 0x6E, 0xFD, 0x21, 0x67, 0xEF, 0x43, 0x65, 0x72, 0x6E, 0xFE,
-    0xEF, 0xFF, 0xF8, 0xFF, 0xFD, 0x25, 0x61, 0x65, 0x68, 0x69, 0x6F, 0xBC, 0xD0, 0xDD, 0xE6, 0xF6,
-    0x41, 0x6F, 0xFF, 0x2E, 0xC1, 0x00, 0x71, 0x76, 0xFF, 0x57, 0x42, 0x61, 0x69, 0xFE, 0xD0, 0xFF,
-    0xFA, 0x41, 0x63, 0xFE, 0xB1, 0x44, 0x6D, 0x6F, 0x72, 0x73, 0xFF, 0xEB, 0xFE, 0xC5, 0xFF, 0xF5,
-    0xFF, 0xFC, 0xA0, 0x00, 0xE1, 0x21, 0x6F, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x63,
-    0xFD, 0x41, 0x74, 0xFE, 0x97, 0x42, 0x63, 0x6D, 0xFE, 0x93, 0xFF, 0x6E, 0xA0, 0x04, 0xA2, 0x21,
-    0x76, 0xFD, 0x21, 0x69, 0xFD, 0x25, 0x65, 0x69, 0x6F, 0x75, 0x72, 0xD0, 0xE9, 0xEC, 0xF0, 0xFD,
-    0x41, 0x68, 0xFE, 0xC2, 0x21, 0x74, 0xFC, 0xA0, 0x00, 0xF1, 0x21, 0x69, 0xFD, 0x22, 0x72, 0x73,
-    0xF7, 0xFD, 0x41, 0x72, 0xFE, 0x60, 0xA0, 0x00, 0xD1, 0x41, 0x6D, 0xFE, 0x71, 0x42, 0x64, 0x65,
-    0xFE, 0x73, 0xFF, 0xFC, 0xA0, 0x01, 0x01, 0x21, 0x6D, 0xFD, 0x43, 0x61, 0x67, 0x73, 0xFF, 0xFD,
-    0xFE, 0x60, 0xFE, 0x60, 0xA0, 0x01, 0x12, 0x21, 0x74, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x75, 0xFD,
-    0x41, 0x72, 0xFE, 0x9E, 0xC1, 0x00, 0x71, 0x6C, 0xFE, 0x3A, 0x41, 0x65, 0xFE, 0x4F, 0xA0, 0x11,
-    0x73, 0x21, 0x6C, 0xFD, 0x21, 0x79, 0xFD, 0x21, 0x68, 0xFD, 0xA0, 0x11, 0xA2, 0x21, 0x62, 0xFD,
-    0x21, 0x69, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x72, 0xFD, 0xA1, 0x00, 0xD1, 0x65, 0xFD, 0x4D, 0x61,
-    0x62, 0x65, 0x67, 0x6C, 0x6E, 0x71, 0x72, 0x73, 0x75, 0x79, 0x74, 0x76, 0xFF, 0x9F, 0xFE, 0x0A,
-    0xFF, 0xA4, 0xFF, 0xA8, 0xFF, 0xAF, 0xFF, 0xBC, 0xFF, 0xCF, 0xFF, 0xD2, 0xFE, 0x1C, 0xFF, 0xD6,
-    0xFF, 0xDC, 0xFF, 0xE9, 0xFF, 0xFB, 0x41, 0x73, 0xFF, 0x71, 0x41, 0x6D, 0xFE, 0xF6, 0x21, 0x72,
-    0xFC, 0x22, 0x65, 0x6F, 0xF5, 0xFD, 0xA0, 0x11, 0xC3, 0x21, 0x6D, 0xFD, 0x21, 0x6F, 0xFD, 0xA1,
-    0x00, 0xD1, 0x73, 0xFD, 0xA0, 0x01, 0x32, 0x21, 0x74, 0xFD, 0xA0, 0x11, 0xF2, 0x43, 0x67, 0x6D,
-    0x74, 0xFD, 0xD3, 0xFD, 0xF8, 0xFF, 0xFD, 0xA2, 0x00, 0xD1, 0x6E, 0x6F, 0xF0, 0xF6, 0x42, 0x61,
-    0x62, 0xFD, 0xC2, 0xFD, 0xAA, 0x44, 0x61, 0x65, 0x69, 0x6F, 0xFF, 0xDA, 0xFF, 0xF2, 0xFF, 0xF9,
-    0xFD, 0xA6, 0x41, 0x69, 0xFD, 0xBD, 0x42, 0x64, 0x6B, 0xFF, 0xFC, 0xFD, 0xB3, 0x21, 0x6E, 0xF9,
-    0x42, 0x69, 0x65, 0xFD, 0xAF, 0xFD, 0x9A, 0x21, 0x6F, 0xF9, 0xA0, 0x09, 0x02, 0x21, 0x6F, 0xFD,
-    0xA0, 0x12, 0x12, 0x21, 0x61, 0xFD, 0xC5, 0x00, 0xD1, 0x72, 0x73, 0x74, 0x6D, 0x70, 0xFF, 0xF1,
-    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0xF7, 0xFF, 0xFD, 0x41, 0x72, 0xFD, 0x72, 0x42, 0x62, 0x65, 0xFD,
-    0x6E, 0xFF, 0xFC, 0x41, 0x79, 0xFD, 0x76, 0x42, 0x65, 0x6F, 0xFF, 0xFC, 0xFE, 0xE0, 0x42, 0x6E,
-    0x76, 0xFF, 0xF9, 0xFD, 0x6B, 0x24, 0x61, 0x65, 0x69, 0x6F, 0xB8, 0xD1, 0xE7, 0xF9, 0x41, 0x6C,
-    0xFE, 0xE6, 0x42, 0x6C, 0x6F, 0xFD, 0x36, 0xFF, 0xFC, 0x41, 0x6E, 0xFD, 0x47, 0x21, 0x69, 0xFC,
-    0x42, 0x6D, 0x70, 0xFD, 0x3A, 0xFF, 0xFD, 0x41, 0x69, 0xFD, 0x33, 0xA0, 0x04, 0xF2, 0x21, 0x74,
-    0xFD, 0xC5, 0x00, 0x61, 0x63, 0x65, 0x6B, 0x73, 0x75, 0xFF, 0xF6, 0xFD, 0xD2, 0xFE, 0xB5, 0xFD,
-    0x29, 0xFF, 0xFD, 0x41, 0x72, 0xFD, 0x1D, 0x45, 0x64, 0x6D, 0x6E, 0x72, 0x73, 0xFF, 0xCB, 0xFF,
-    0xD9, 0xFF, 0xEA, 0xFF, 0xFC, 0xFD, 0x67, 0x41, 0x75, 0xFF, 0x91, 0x41, 0x79, 0xFC, 0xED, 0x42,
-    0x65, 0x68, 0xFD, 0xF8, 0xFD, 0x10, 0x43, 0x63, 0x6D, 0x74, 0xFF, 0xF5, 0xFC, 0xE2, 0xFF, 0xF9,
-    0xA0, 0x01, 0x51, 0xA0, 0x12, 0x51, 0x21, 0x73, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x63, 0xFD, 0xC5,
-    0x00, 0xD1, 0x67, 0x6E, 0x70, 0x76, 0x69, 0xFE, 0x9B, 0xFC, 0xC3, 0xFC, 0xEA, 0xFF, 0xF1, 0xFF,
-    0xFD, 0xC1, 0x00, 0x51, 0x61, 0xFC, 0xD8, 0x44, 0x67, 0x6E, 0x6F, 0x74, 0xFF, 0xFA, 0xFE, 0x4F,
-    0xFC, 0xC3, 0xFC, 0xB1, 0x23, 0x61, 0x65, 0x69, 0xC2, 0xDB, 0xF3, 0xA0, 0x01, 0x62, 0x21, 0x61,
-    0xFD, 0x41, 0x6F, 0xFC, 0xB8, 0x41, 0x61, 0xFC, 0xB4, 0x41, 0x69, 0xFC, 0xB0, 0x21, 0x74, 0xFC,
-    0x24, 0x67, 0x6C, 0x6E, 0x72, 0xEE, 0xF1, 0xF5, 0xFD, 0x41, 0x63, 0xFE, 0x0E, 0x41, 0x61, 0xFC,
-    0x75, 0x21, 0x6C, 0xFC, 0x42, 0x65, 0x61, 0xFF, 0x6F, 0xFF, 0xFD, 0xA0, 0x12, 0x82, 0x21, 0x6C,
-    0xFD, 0x21, 0x61, 0xFD, 0xA3, 0x00, 0xD1, 0x72, 0x74, 0x67, 0xE5, 0xF0, 0xFD, 0xA0, 0x12, 0xD2,
-    0x21, 0x73, 0xFD, 0x21, 0x72, 0xFD, 0xC2, 0x01, 0x51, 0x74, 0x65, 0xFE, 0xBC, 0xFF, 0xFD, 0xA0,
-    0x12, 0xA3, 0x21, 0x63, 0xFD, 0x21, 0x69, 0xFD, 0x22, 0x73, 0x6D, 0xEE, 0xFD, 0x41, 0x65, 0xFD,
-    0xCA, 0x41, 0x6F, 0xFC, 0x49, 0x22, 0x6E, 0x72, 0xF8, 0xFC, 0xC1, 0x00, 0x81, 0x62, 0xFC, 0x55,
-    0x21, 0x61, 0xFA, 0x21, 0x74, 0xFD, 0x45, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xFF, 0x9A, 0xFF, 0xBE,
-    0xFF, 0xE2, 0xFF, 0xEF, 0xFF, 0xFD, 0x41, 0x63, 0xFC, 0x12, 0xA0, 0x12, 0xF2, 0x21, 0x66, 0xFD,
-    0x21, 0x6F, 0xFD, 0x41, 0x68, 0xFF, 0x2D, 0x21, 0x74, 0xFC, 0xA0, 0x13, 0x12, 0x21, 0x6D, 0xFD,
-    0x21, 0x65, 0xFD, 0x22, 0x65, 0x6E, 0xF4, 0xFD, 0x23, 0x69, 0x65, 0x6F, 0xDE, 0xE8, 0xFB, 0xC1,
-    0x00, 0xD1, 0x64, 0xFC, 0x0A, 0x41, 0x65, 0xFB, 0xFB, 0x21, 0x74, 0xFC, 0x41, 0x74, 0xFC, 0x87,
-    0x44, 0x61, 0x63, 0x64, 0x74, 0xFF, 0xFC, 0xFB, 0xEA, 0xFB, 0xE4, 0xFB, 0xEA, 0x41, 0x6C, 0xFB,
-    0xCB, 0xA1, 0x00, 0x71, 0x74, 0xFC, 0x41, 0x68, 0xFD, 0x51, 0x41, 0x74, 0xFD, 0x4D, 0x26, 0x64,
-    0x66, 0x72, 0x73, 0x74, 0x75, 0xD1, 0xDB, 0xE2, 0xF3, 0xF8, 0xFC, 0x41, 0x61, 0xFC, 0x8F, 0x42,
-    0x65, 0x69, 0xFB, 0xC1, 0xFB, 0xC4, 0x22, 0x64, 0x74, 0xF5, 0xF9, 0x41, 0x6E, 0xFB, 0xBE, 0x43,
-    0x65, 0x6F, 0x74, 0xFB, 0x99, 0xFF, 0xFC, 0xFD, 0x37, 0x41, 0x6D, 0xFE, 0xB7, 0x42, 0x6D, 0x61,
-    0xFD, 0x1A, 0xFF, 0xFC, 0x21, 0x65, 0xF9, 0xA0, 0x13, 0x31, 0x21, 0x73, 0xFD, 0x21, 0x79, 0xFD,
-    0x21, 0x6D, 0xF7, 0x21, 0x61, 0xFD, 0x21, 0x74, 0xFD, 0x22, 0x6C, 0x73, 0xF4, 0xFD, 0x24, 0x65,
-    0x69, 0x72, 0x6F, 0xC8, 0xD1, 0xE6, 0xFB, 0x41, 0x74, 0xFB, 0x5B, 0x41, 0x61, 0xFB, 0xA7, 0x21,
-    0x6E, 0xFC, 0x21, 0x6F, 0xFD, 0x21, 0x69, 0xFD, 0xA0, 0x13, 0x42, 0x21, 0x6F, 0xFD, 0x21, 0x6E,
-    0xFD, 0x21, 0x65, 0xFD, 0x44, 0x63, 0x6E, 0x74, 0x76, 0xFB, 0x44, 0xFF, 0xE3, 0xFF, 0xF1, 0xFF,
-    0xFD, 0xC1, 0x00, 0xC1, 0x63, 0xFE, 0xDC, 0x41, 0x69, 0xFB, 0x4C, 0xC1, 0x00, 0xC1, 0x74, 0xFB,
-    0x4B, 0x23, 0x65, 0x6D, 0x73, 0xF0, 0xF6, 0xFA, 0x41, 0x75, 0xFB, 0x41, 0x42, 0x67, 0x74, 0xFB,
-    0x1C, 0xFF, 0xFC, 0x41, 0x74, 0xFB, 0x36, 0x41, 0x64, 0xFB, 0x32, 0x43, 0x71, 0x73, 0x77, 0xFB,
-    0x0D, 0xFF, 0xF8, 0xFF, 0xFC, 0x41, 0x64, 0xFB, 0x03, 0x25, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xBB,
-    0xD8, 0xE3, 0xF2, 0xFC, 0x41, 0x69, 0xFE, 0xB9, 0x42, 0x66, 0x6C, 0xFB, 0x17, 0xFB, 0x17, 0x41,
-    0x69, 0xFF, 0x06, 0xA0, 0x13, 0x61, 0xA0, 0x0C, 0x31, 0xA0, 0x13, 0x72, 0xC6, 0x00, 0xA1, 0x63,
-    0x64, 0x70, 0x72, 0x73, 0x76, 0xFA, 0xD6, 0xFF, 0xF7, 0xFF, 0xFA, 0xFF, 0xFA, 0xFF, 0xFD, 0xFF,
-    0xFA, 0x21, 0x69, 0xEB, 0x44, 0x6C, 0x6E, 0x72, 0x6D, 0xFF, 0xD4, 0xFC, 0x62, 0xFF, 0xDB, 0xFF,
-    0xFD, 0xA0, 0x01, 0x81, 0x21, 0x67, 0xFD, 0xA1, 0x00, 0xD1, 0x6E, 0xFD, 0x41, 0x62, 0xFB, 0x8E,
-    0xA1, 0x00, 0x51, 0x61, 0xFC, 0xA0, 0x13, 0x92, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x41, 0x6F,
-    0xFF, 0x19, 0x21, 0x6E, 0xFC, 0x22, 0x68, 0x69, 0xF6, 0xFD, 0x47, 0x63, 0x65, 0x68, 0x69, 0x74,
-    0x79, 0x70, 0xFF, 0x9A, 0xFF, 0xCA, 0xFC, 0x2C, 0xFF, 0xDD, 0xFF, 0xE6, 0xFC, 0x2C, 0xFF, 0xFB,
-    0xA0, 0x13, 0xB2, 0x21, 0x72, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x65, 0xFD, 0xA1,
-    0x00, 0x51, 0x70, 0xFD, 0x41, 0x61, 0xFE, 0xC7, 0x41, 0x67, 0xFD, 0x00, 0x21, 0x65, 0xFC, 0xA2,
-    0x00, 0x51, 0x6E, 0x6C, 0xF5, 0xFD, 0x41, 0x6F, 0xFD, 0xB5, 0x42, 0x67, 0x6B, 0xFF, 0x97, 0xFA,
-    0x6F, 0xC3, 0x00, 0xD1, 0x6C, 0x6D, 0x6E, 0xFA, 0x41, 0xFF, 0xF5, 0xFF, 0xF9, 0x41, 0x67, 0xFD,
-    0x66, 0xC2, 0x00, 0x51, 0x69, 0x6F, 0xFA, 0x58, 0xFF, 0xFC, 0x41, 0x73, 0xFA, 0x4F, 0x44, 0x6E,
-    0x70, 0x75, 0x71, 0xFD, 0xAF, 0xFF, 0xF3, 0xFF, 0xFC, 0xFB, 0xC8, 0x41, 0x74, 0xFA, 0x44, 0x21,
-    0x75, 0xFC, 0x21, 0x62, 0xFD, 0x21, 0x69, 0xFD, 0x46, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0xFF,
-    0xA7, 0xFF, 0xB7, 0xFB, 0xAE, 0xFF, 0xC9, 0xFF, 0xE6, 0xFF, 0xFD, 0xA0, 0x13, 0xD2, 0x21, 0x74,
-    0xFD, 0xA1, 0x00, 0x61, 0x74, 0xFD, 0x41, 0x65, 0xFA, 0x04, 0xA0, 0x13, 0xF2, 0x21, 0x72, 0xFD,
-    0xA1, 0x00, 0x61, 0x72, 0xFD, 0x47, 0x61, 0x63, 0x64, 0x65, 0x6B, 0x6F, 0x75, 0xFF, 0xEC, 0xFF,
-    0xF1, 0xFA, 0x33, 0xFF, 0xFB, 0xF9, 0xFB, 0xF9, 0xFB, 0xF9, 0xF5, 0x44, 0x6E, 0x70, 0x72, 0x73,
-    0xFF, 0xEA, 0xF9, 0xDF, 0xFD, 0x92, 0xFA, 0x60, 0x41, 0x64, 0xFA, 0x57, 0x42, 0x6E, 0x72, 0xFF,
-    0xFC, 0xFA, 0x4F, 0xA0, 0x14, 0x12, 0x21, 0x72, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x63, 0xFD, 0x22,
-    0x65, 0x69, 0xED, 0xFD, 0x41, 0x6C, 0xFD, 0x15, 0xA0, 0x14, 0x32, 0x21, 0x6C, 0xFD, 0x21, 0x62,
-    0xFD, 0x22, 0x69, 0x65, 0xF3, 0xFD, 0xA0, 0x12, 0x32, 0x21, 0x69, 0xFD, 0x21, 0x6E, 0xFD, 0x21,
-    0x6C, 0xFD, 0xA0, 0x12, 0x53, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x72, 0xFD, 0x22, 0x69,
-    0x6F, 0xF1, 0xFD, 0x57, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6C, 0x6D,
-    0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x6B, 0xF9, 0xE3, 0xFA, 0x40, 0xFA,
-    0xA2, 0xFA, 0xF2, 0xFB, 0x6B, 0xFB, 0x9E, 0xFB, 0xD2, 0xFC, 0x32, 0xFC, 0x74, 0xFC, 0x84, 0xFC,
-    0xD1, 0xFD, 0x53, 0xFD, 0x85, 0xFD, 0xBB, 0xFE, 0x0B, 0xFE, 0x76, 0xFE, 0xE7, 0xFF, 0x65, 0xFF,
-    0xA8, 0xFF, 0xCC, 0xFF, 0xDE, 0xF9, 0xB2, 0xFF, 0xFB, 0xA0, 0x01, 0x91, 0xA0, 0x01, 0x71, 0x22,
-    0x6C, 0x6E, 0xFD, 0xFD, 0xA0, 0x01, 0x21, 0x21, 0x64, 0xFD, 0xA1, 0x00, 0xD1, 0x72, 0xFD, 0xA0,
-    0x01, 0xA2, 0x21, 0x62, 0xFD, 0x21, 0x61, 0xFD, 0x42, 0x61, 0x74, 0xF9, 0x28, 0xFF, 0xFD, 0x21,
-    0x74, 0xE5, 0x21, 0x61, 0xFD, 0xA0, 0x01, 0xC2, 0x22, 0x7A, 0x63, 0xFD, 0xD4, 0x21, 0x69, 0xFB,
-    0x21, 0x6C, 0xFD, 0x21, 0x67, 0xD1, 0xA1, 0x01, 0x91, 0x6F, 0xFD, 0xA0, 0x01, 0xE1, 0x21, 0x6C,
-    0xFD, 0x28, 0x2E, 0x61, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x75, 0xB8, 0xBE, 0xC9, 0xD7, 0xE1, 0xEF,
-    0xF5, 0xFD, 0xA2, 0x01, 0x41, 0x64, 0x6F, 0xB2, 0xB2, 0xA0, 0x02, 0x11, 0x21, 0x6C, 0xFD, 0x22,
-    0x72, 0x62, 0xF3, 0xFD, 0x41, 0x75, 0xFF, 0x98, 0xA0, 0x01, 0xF1, 0x22, 0x6F, 0x72, 0xF9, 0xFD,
-    0x41, 0x74, 0xFF, 0x8C, 0x21, 0x65, 0xFC, 0xA0, 0x02, 0x21, 0xA3, 0x02, 0x02, 0x65, 0x6E, 0x6F,
-    0xFD, 0xEE, 0xFD, 0x41, 0x62, 0xFF, 0x81, 0x21, 0x6F, 0xFC, 0x41, 0x66, 0xF8, 0xB6, 0x21, 0x69,
-    0xFC, 0xA0, 0x02, 0x31, 0x42, 0x6C, 0x6D, 0xFF, 0xA7, 0xFF, 0xFD, 0x27, 0x61, 0x65, 0x68, 0x69,
-    0x72, 0x74, 0x75, 0xC4, 0xD0, 0xD9, 0xDF, 0xEC, 0xF3, 0xF9, 0x21, 0x6E, 0xE7, 0x21, 0x69, 0xFD,
-    0x41, 0x2E, 0xFF, 0x54, 0x21, 0x72, 0xFC, 0x41, 0x61, 0xFF, 0x84, 0xC6, 0x02, 0x41, 0x61, 0x63,
-    0x65, 0x6F, 0x74, 0x75, 0xFF, 0xBC, 0xFF, 0xFC, 0xF8, 0x70, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0x41,
-    0x21, 0x65, 0xC1, 0x41, 0x77, 0xFF, 0x68, 0x41, 0x6E, 0xFF, 0x2D, 0x21, 0x61, 0xFC, 0x21, 0x75,
-    0xB3, 0xC2, 0x01, 0x91, 0x63, 0x6D, 0xFF, 0x96, 0xFF, 0x23, 0xA8, 0x02, 0x11, 0x64, 0x65, 0x69,
-    0x6C, 0x6F, 0x72, 0x73, 0x75, 0xC3, 0xCA, 0xD1, 0xE6, 0xE9, 0xF1, 0xF4, 0xF7, 0xC1, 0x02, 0x31,
-    0x69, 0xF8, 0xC2, 0x21, 0x72, 0xFA, 0xA0, 0x14, 0x51, 0x21, 0x68, 0xFD, 0x21, 0x73, 0xFD, 0xA1,
-    0x00, 0x51, 0x69, 0xFD, 0xA1, 0x02, 0x11, 0x66, 0xFB, 0xA0, 0x01, 0x41, 0x42, 0x62, 0x6E, 0xFF,
-    0xFD, 0xF8, 0x0C, 0x41, 0x6C, 0xFE, 0xE1, 0x43, 0x6C, 0x6F, 0x75, 0xFF, 0xFC, 0xF8, 0x01, 0xFE,
-    0xD2, 0xA0, 0x02, 0x52, 0xA0, 0x02, 0x71, 0x41, 0x69, 0xFF, 0x04, 0xA2, 0x02, 0x11, 0x67, 0x6E,
-    0xF9, 0xFC, 0x41, 0x72, 0xFE, 0xBA, 0x42, 0x65, 0x6C, 0xFF, 0xFC, 0xFE, 0xBE, 0x48, 0x61, 0x65,
-    0x69, 0x6C, 0x6E, 0x6F, 0x75, 0x79, 0xFF, 0xCF, 0xFF, 0xDA, 0xFF, 0x1B, 0xFF, 0xE4, 0xFF, 0x1B,
-    0xFF, 0xEE, 0xFF, 0xF9, 0xFF, 0xCC, 0x44, 0x61, 0x65, 0x6C, 0x6F, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
-    0x2B, 0xFF, 0x11, 0x41, 0x2E, 0xFF, 0x04, 0x41, 0x79, 0xFE, 0x8D, 0xC2, 0x02, 0x92, 0x69, 0x6F,
-    0xFA, 0x7E, 0xF7, 0xC5, 0x41, 0x65, 0xFA, 0x75, 0xC5, 0x02, 0x81, 0x61, 0x63, 0x6C, 0x6E, 0x74,
-    0xFE, 0x74, 0xFF, 0xEB, 0xFF, 0xEF, 0xFF, 0xF3, 0xFF, 0xFC, 0xA0, 0x02, 0xB1, 0x41, 0x6E, 0xFE,
-    0xCB, 0x21, 0x65, 0xFC, 0x43, 0x62, 0x64, 0x72, 0xFE, 0x60, 0xFE, 0x97, 0xFF, 0x75, 0x41, 0x69,
-    0xFE, 0x4B, 0x41, 0x69, 0xFF, 0x67, 0x42, 0x64, 0x74, 0xFE, 0x85, 0xFF, 0xFC, 0xA0, 0x02, 0xC2,
-    0xA2, 0x02, 0x41, 0x6E, 0x6F, 0xF6, 0xFD, 0x41, 0x2E, 0xFE, 0xCA, 0xC2, 0x01, 0xF1, 0x61, 0x65,
-    0xFF, 0xFC, 0xF7, 0x5D, 0x41, 0x76, 0xFE, 0x30, 0x41, 0x63, 0xFE, 0x21, 0x22, 0x65, 0x69, 0xF8,
-    0xFC, 0x41, 0x2E, 0xFE, 0x1B, 0x21, 0x67, 0xFC, 0xA0, 0x02, 0xE2, 0xA1, 0x01, 0x91, 0x74, 0xFD,
-    0xA0, 0x02, 0xE1, 0x44, 0x2E, 0x73, 0x74, 0x7A, 0xFF, 0x26, 0xFF, 0xF8, 0xFF, 0xFD, 0xFF, 0x41,
-    0x48, 0x61, 0x64, 0x65, 0x69, 0x6C, 0x6D, 0x6F, 0x79, 0xFF, 0xA4, 0xFF, 0xAE, 0xFF, 0xC0, 0xFF,
-    0xCB, 0xFF, 0xDC, 0xFD, 0xF9, 0xFF, 0xE5, 0xFF, 0xF3, 0x41, 0x63, 0xFD, 0xEB, 0x41, 0x73, 0xFE,
-    0xFC, 0xA0, 0x03, 0x02, 0x22, 0x69, 0x6F, 0xF9, 0xFD, 0xC5, 0x01, 0x91, 0x62, 0x67, 0x72, 0x73,
-    0x74, 0xFD, 0xDB, 0xFE, 0x12, 0xF7, 0x92, 0xFF, 0xF0, 0xFF, 0xFB, 0x41, 0x61, 0xFD, 0xC9, 0xA0,
-    0x14, 0x63, 0x21, 0x62, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x74, 0xFD, 0x22, 0x72, 0x6E, 0xF0, 0xFD,
-    0xC1, 0x01, 0xF1, 0x6F, 0xF6, 0xD8, 0x44, 0x63, 0x66, 0x6C, 0x6E, 0xFD, 0xE5, 0xFD, 0xAE, 0xFF,
-    0x21, 0xFF, 0xFA, 0xC2, 0x02, 0x11, 0x6E, 0x72, 0xFD, 0x99, 0xFA, 0x36, 0x45, 0x61, 0x65, 0x69,
-    0x6F, 0x70, 0xFF, 0xBD, 0xFF, 0xDF, 0xFF, 0xEA, 0xFF, 0xF7, 0xFF, 0x18, 0x41, 0x65, 0xFD, 0xBF,
-    0xA0, 0x13, 0x71, 0xA1, 0x02, 0x71, 0x73, 0xFD, 0x21, 0x79, 0xFB, 0xC2, 0x02, 0x21, 0x63, 0x69,
-    0xFD, 0xB0, 0xF6, 0x97, 0x41, 0x69, 0xFD, 0xE3, 0x24, 0x67, 0x6C, 0x72, 0x74, 0xE4, 0xF0, 0xF3,
-    0xFC, 0x41, 0x73, 0xF6, 0x81, 0x41, 0x73, 0xFD, 0x96, 0x41, 0x77, 0xFD, 0xE8, 0xC4, 0x01, 0x91,
-    0x65, 0x69, 0x6C, 0x6F, 0xFF, 0xF4, 0xFF, 0xF8, 0xFD, 0xBB, 0xFF, 0xFC, 0x41, 0x74, 0xFD, 0xF4,
-    0x44, 0x65, 0x6E, 0x73, 0x75, 0xFD, 0x3C, 0xFD, 0xB7, 0xFF, 0xFC, 0xFD, 0xB7, 0xC2, 0x02, 0x41,
-    0x69, 0x6C, 0xFA, 0x78, 0xFD, 0x9B, 0xA0, 0x02, 0xA2, 0x41, 0x73, 0xFD, 0x9E, 0xA0, 0x03, 0x22,
-    0x42, 0x65, 0x69, 0xFD, 0xB1, 0xFD, 0x1C, 0x41, 0x65, 0xFD, 0x15, 0x41, 0x68, 0xFD, 0x50, 0x4A,
-    0x63, 0x65, 0x66, 0x6D, 0x6E, 0x6F, 0x70, 0x73, 0x74, 0x75, 0xFF, 0xE7, 0xFF, 0xEA, 0xFF, 0xEE,
-    0xFF, 0xF1, 0xFF, 0xF8, 0xFD, 0x4C, 0xFD, 0x88, 0xFF, 0xFC, 0xFD, 0x4C, 0xFD, 0x88, 0x41, 0x69,
-    0xFD, 0x83, 0x21, 0x6C, 0xFC, 0x41, 0x7A, 0xFE, 0xDB, 0x21, 0x69, 0xFC, 0xC1, 0x01, 0x21, 0x68,
-    0xF6, 0x33, 0x41, 0x63, 0xF8, 0xE9, 0xA2, 0x00, 0x51, 0x74, 0x61, 0xF6, 0xFC, 0xA0, 0x02, 0x81,
-    0x41, 0x6F, 0xFD, 0x61, 0xC1, 0x02, 0x81, 0x6F, 0xF6, 0x06, 0x41, 0x72, 0xFD, 0x57, 0x48, 0x61,
-    0x63, 0x6E, 0x70, 0x74, 0x75, 0x67, 0x76, 0xFF, 0xEF, 0xFF, 0xF2, 0xFD, 0x53, 0xFF, 0xF6, 0xFD,
-    0x53, 0xFF, 0xFC, 0xF8, 0xE5, 0xF5, 0xFC, 0x41, 0x6C, 0xFB, 0x1A, 0xA0, 0x14, 0x93, 0x41, 0x65,
-    0xF8, 0xF2, 0x44, 0x65, 0x64, 0x6E, 0x72, 0xFD, 0x2F, 0xF8, 0xEE, 0xFF, 0xF9, 0xFF, 0xFC, 0x45,
-    0x61, 0x69, 0x6F, 0x72, 0x77, 0xFF, 0xE8, 0xFF, 0xF3, 0xFC, 0x8A, 0xFF, 0xBE, 0xFD, 0x22, 0x43,
-    0x61, 0x6C, 0x72, 0xFC, 0xBC, 0xFC, 0xBC, 0xFC, 0x7D, 0xCB, 0x02, 0x11, 0x61, 0x64, 0x65, 0x67,
-    0x69, 0x6B, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0xFF, 0x0F, 0xFF, 0x24, 0xFF, 0x37, 0xFF, 0x44, 0xFF,
-    0x66, 0xFF, 0x89, 0xFF, 0x90, 0xFF, 0x9D, 0xFF, 0xB5, 0xFF, 0xE6, 0xFF, 0xF6, 0x42, 0x72, 0x74,
-    0xF5, 0x75, 0xFC, 0x57, 0x41, 0x6F, 0xFC, 0x50, 0xA0, 0x0D, 0xF2, 0x21, 0x65, 0xFD, 0x21, 0x6C,
-    0xFD, 0x21, 0x62, 0xFD, 0x22, 0x72, 0x61, 0xF0, 0xFD, 0x41, 0x72, 0xFC, 0xAE, 0x42, 0x65, 0x69,
-    0xFF, 0xFC, 0xFC, 0x2C, 0xC1, 0x01, 0x41, 0x72, 0xFC, 0x30, 0x21, 0x61, 0xFA, 0x21, 0x6C, 0xFD,
-    0x42, 0x61, 0x75, 0xFC, 0x5B, 0xFC, 0x97, 0x43, 0x6C, 0x6E, 0x74, 0xFF, 0xF6, 0xFC, 0x54, 0xFF,
-    0xF9, 0x44, 0x63, 0x6C, 0x72, 0x73, 0xF5, 0x58, 0xFE, 0x4A, 0xF8, 0xA8, 0xF9, 0x79, 0x41, 0x73,
-    0xF5, 0x42, 0x21, 0x65, 0xFC, 0x48, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x73, 0x75, 0xFF, 0xA8,
-    0xFF, 0xBF, 0xFF, 0xC8, 0xFF, 0xE2, 0xFC, 0x54, 0xFF, 0xEC, 0xFF, 0xFD, 0xFC, 0x72, 0x41, 0x75,
-    0xF6, 0xDC, 0x41, 0x74, 0xFC, 0x19, 0x41, 0x73, 0xFB, 0xDE, 0x42, 0x65, 0x69, 0xFB, 0xD2, 0xFF,
-    0xFC, 0x41, 0x74, 0xFE, 0xB6, 0x21, 0x65, 0xFC, 0x41, 0x67, 0xF4, 0xEA, 0x42, 0x6F, 0x76, 0xFB,
-    0xC0, 0xFB, 0xC8, 0xA1, 0x02, 0x31, 0x69, 0xF9, 0xA0, 0x03, 0x62, 0x4A, 0x63, 0x64, 0x6C, 0x6D,
-    0x6E, 0x70, 0x74, 0x75, 0x76, 0x77, 0xFF, 0xD7, 0xFF, 0xDF, 0xFB, 0xF0, 0xFF, 0xEA, 0xFF, 0xED,
-    0xF4, 0xEF, 0xFF, 0xF8, 0xFB, 0xB1, 0xFF, 0xFD, 0xF4, 0xD7, 0x41, 0x61, 0xFE, 0xED, 0xA0, 0x14,
-    0xC2, 0x21, 0x74, 0xFD, 0x42, 0x61, 0x65, 0xFC, 0x36, 0xFF, 0xFD, 0x21, 0x68, 0xF9, 0x41, 0x65,
-    0xFB, 0x86, 0x21, 0x6E, 0xFC, 0x42, 0x69, 0x72, 0xFF, 0xFD, 0xFC, 0x0C, 0x41, 0x73, 0xFB, 0x70,
-    0x44, 0x61, 0x65, 0x6E, 0x73, 0xFF, 0x96, 0xFB, 0xE7, 0xFF, 0x92, 0xFF, 0xFC, 0x42, 0x69, 0x6C,
-    0xFB, 0xF4, 0xFB, 0xF4, 0x42, 0x6C, 0x6E, 0xFB, 0x60, 0xFB, 0x97, 0x41, 0x74, 0xFB, 0xCC, 0xC6,
-    0x01, 0xF1, 0x61, 0x65, 0x6D, 0x6E, 0x6F, 0x7A, 0xFF, 0xF5, 0xFF, 0xFC, 0xFB, 0xE2, 0xFB, 0x73,
-    0xFB, 0x8C, 0xFE, 0x7E, 0x41, 0x69, 0xFE, 0x69, 0x41, 0x69, 0xFB, 0x34, 0x43, 0x64, 0x6E, 0x6F,
-    0xFB, 0x59, 0xFF, 0xFC, 0xFB, 0xAB, 0x41, 0x65, 0xFE, 0x57, 0x21, 0x67, 0xFC, 0x21, 0x6E, 0xFD,
-    0x42, 0x65, 0x61, 0xF4, 0x42, 0xFF, 0xFD, 0x42, 0x61, 0x68, 0xFB, 0xAA, 0xFE, 0x46, 0xCD, 0x03,
-    0x42, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x69, 0x6D, 0x6F, 0x70, 0x71, 0x72, 0x73, 0xFF, 0x5D,
-    0xFF, 0x7C, 0xFF, 0x8D, 0xFF, 0x97, 0xFF, 0xA2, 0xFF, 0xAF, 0xFF, 0xC1, 0xFF, 0xD6, 0xFF, 0xDE,
-    0xFE, 0x3F, 0xFB, 0x4D, 0xFF, 0xF2, 0xFF, 0xF9, 0x42, 0x62, 0x6E, 0xFB, 0x79, 0xFF, 0x0A, 0xA0,
-    0x03, 0x83, 0x44, 0x61, 0x62, 0x63, 0x74, 0xFC, 0xBF, 0xFB, 0x55, 0xFB, 0x55, 0xFF, 0xFD, 0x41,
-    0x63, 0xFB, 0xEA, 0x41, 0x68, 0xFA, 0xD1, 0x41, 0x68, 0xFB, 0x5A, 0x41, 0x6E, 0xFB, 0x00, 0x42,
-    0x65, 0x72, 0xFF, 0xFC, 0xFB, 0x29, 0x41, 0x72, 0xF7, 0x4F, 0x41, 0x6F, 0xFA, 0xD5, 0x21, 0x74,
-    0xFC, 0x21, 0x70, 0xFD, 0x21, 0x6D, 0xFD, 0x4C, 0x2E, 0x61, 0x68, 0x69, 0x6B, 0x6C, 0x6F, 0x70,
-    0x73, 0x74, 0x75, 0x79, 0xFA, 0xA2, 0xFF, 0xC1, 0xF4, 0x92, 0xFF, 0xCB, 0xF6, 0xB0, 0xFB, 0x3A,
-    0xFF, 0xD8, 0xFF, 0xDC, 0xFF, 0xE0, 0xFF, 0xE8, 0xFF, 0xEF, 0xFF, 0xFD, 0x41, 0x6F, 0xFA, 0xBF,
-    0xC4, 0x02, 0x11, 0x62, 0x63, 0x6C, 0x70, 0xFA, 0xBE, 0xFA, 0x84, 0xFF, 0xFC, 0xFA, 0x84, 0xC1,
-    0x00, 0x81, 0x68, 0xFA, 0x75, 0x41, 0x2E, 0xFA, 0xA6, 0xC1, 0x00, 0x91, 0x61, 0xFA, 0x63, 0x42,
-    0x61, 0x6E, 0xFA, 0x9C, 0xFF, 0xFA, 0x46, 0x63, 0x67, 0x6E, 0x72, 0x73, 0x76, 0xFF, 0xE9, 0xFF,
-    0xD6, 0xFF, 0xEF, 0xFF, 0xF9, 0xFE, 0x7C, 0xFA, 0x5E, 0xA0, 0x14, 0xE3, 0x21, 0x73, 0xFD, 0x21,
-    0x6F, 0xFD, 0x43, 0x6D, 0x6E, 0x72, 0xF3, 0x7E, 0xFA, 0x3A, 0xFF, 0xFD, 0xC1, 0x02, 0x31, 0x6D,
-    0xF3, 0x74, 0xA2, 0x01, 0x91, 0x65, 0x6F, 0xF0, 0xFA, 0x41, 0x72, 0xF3, 0x76, 0x21, 0x61, 0xFC,
-    0x21, 0x6E, 0xFD, 0x41, 0x75, 0xFA, 0x58, 0x47, 0x2E, 0x61, 0x62, 0x63, 0x66, 0x6F, 0x74, 0xFA,
-    0x12, 0xFA, 0x15, 0xFA, 0x3E, 0xFA, 0x81, 0xFA, 0x54, 0xFF, 0xF9, 0xFF, 0xFC, 0x41, 0x7A, 0xFA,
-    0x07, 0xA1, 0x02, 0x11, 0x69, 0xFC, 0x44, 0x67, 0x6D, 0x70, 0x73, 0xFB, 0x13, 0xFF, 0xFB, 0xFB,
-    0x13, 0xFB, 0x13, 0x41, 0x70, 0xF9, 0xF1, 0xA1, 0x02, 0xB1, 0x6F, 0xFC, 0x41, 0x6B, 0xFA, 0x75,
-    0x41, 0x67, 0xFA, 0x71, 0x41, 0x2E, 0xFA, 0xE2, 0xA1, 0x01, 0x21, 0x73, 0xFC, 0x43, 0x61, 0x65,
-    0x68, 0xFF, 0xF3, 0xFF, 0xFB, 0xFA, 0x64, 0xC4, 0x02, 0x11, 0x61, 0x65, 0x6C, 0x72, 0xF9, 0xCD,
-    0xF9, 0xCD, 0xFA, 0x04, 0xFA, 0x80, 0x4A, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x73, 0x74, 0x75,
-    0x79, 0xFF, 0x3A, 0xFF, 0x60, 0xFF, 0x8C, 0xFF, 0xA1, 0xFF, 0xC0, 0xFF, 0xD1, 0xFF, 0xD6, 0xFF,
-    0xE7, 0xFF, 0xF1, 0xFA, 0x13, 0x41, 0x6C, 0xF2, 0xBD, 0xA1, 0x00, 0xF1, 0x74, 0xFC, 0x42, 0x68,
-    0x75, 0xFF, 0xFB, 0xF9, 0xCD, 0x41, 0x66, 0xF9, 0x9A, 0xA1, 0x03, 0xB2, 0x69, 0xFC, 0x41, 0x64,
-    0xF2, 0xC2, 0x41, 0x69, 0xFA, 0x01, 0x42, 0x65, 0x68, 0xF5, 0x73, 0xF9, 0xE2, 0x47, 0x62, 0x67,
-    0x6C, 0x6E, 0x72, 0x73, 0x74, 0xFA, 0x04, 0xFF, 0xE1, 0xFF, 0xEC, 0xFF, 0xF1, 0xF9, 0xAE, 0xFF,
-    0xF5, 0xFF, 0xF9, 0xC2, 0x02, 0x11, 0x67, 0x6E, 0xF9, 0x98, 0xF9, 0x59, 0x41, 0x6F, 0xF2, 0x7C,
-    0x43, 0x61, 0x6E, 0x79, 0xF9, 0x8B, 0xF9, 0x54, 0xF9, 0x54, 0x22, 0x6E, 0x72, 0xF2, 0xF6, 0xC3,
-    0x01, 0xF1, 0x65, 0x67, 0x6F, 0xF2, 0x6C, 0xF9, 0x7C, 0xFF, 0x24, 0x42, 0x63, 0x72, 0xF9, 0x39,
-    0xFA, 0xCF, 0x24, 0x61, 0x65, 0x69, 0x6F, 0xD1, 0xE8, 0xED, 0xF9, 0x41, 0x79, 0xFA, 0x59, 0x41,
-    0x79, 0xF9, 0xB2, 0x44, 0x61, 0x69, 0x6C, 0x73, 0xFF, 0xF8, 0xF9, 0x58, 0xFF, 0xFC, 0xF2, 0x45,
-    0x42, 0x63, 0x64, 0xF9, 0xA1, 0xF9, 0xA1, 0x21, 0x69, 0xF9, 0x43, 0x61, 0x65, 0x73, 0xFA, 0x29,
-    0xF2, 0x2E, 0xF2, 0x2E, 0x41, 0x69, 0xF2, 0x3C, 0x42, 0x69, 0x7A, 0xF2, 0x26, 0xFF, 0xFC, 0x59,
-    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71,
-    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xF9, 0x32, 0xF9, 0x8C, 0xF9, 0xDB, 0xF9,
-    0xF4, 0xFA, 0x05, 0xFA, 0x3E, 0xFA, 0x57, 0xFA, 0x79, 0xFA, 0x8B, 0xFA, 0x92, 0xFA, 0xF1, 0xFB,
-    0x5D, 0xFC, 0x7A, 0xF8, 0xEA, 0xFC, 0xF6, 0xFD, 0x0F, 0xFD, 0xDF, 0xFE, 0x48, 0xFF, 0x37, 0xFF,
-    0x7E, 0xFF, 0xC3, 0xFF, 0xD4, 0xFF, 0xE8, 0xFF, 0xEB, 0xFF, 0xF9, 0x41, 0x65, 0xF4, 0xC8, 0x21,
-    0x67, 0xFC, 0x41, 0x61, 0xF1, 0xD2, 0x41, 0x67, 0xF1, 0xDA, 0x21, 0x61, 0xFC, 0x43, 0x64, 0x65,
-    0x69, 0xFF, 0xFD, 0xF1, 0xBB, 0xF1, 0xCD, 0xA0, 0x15, 0x12, 0x21, 0x65, 0xFD, 0x21, 0x69, 0xFD,
-    0x21, 0x6E, 0xFD, 0x43, 0x62, 0x69, 0x6F, 0xF4, 0x0F, 0xF5, 0x2A, 0xFF, 0xFD, 0x41, 0x73, 0xF2,
-    0x01, 0x41, 0x79, 0xF8, 0xD7, 0xA1, 0x03, 0xD1, 0x68, 0xFC, 0x41, 0x2E, 0xF2, 0x49, 0x21, 0x72,
-    0xFC, 0x21, 0x65, 0xFD, 0x21, 0x6B, 0xFD, 0x4A, 0x2E, 0x64, 0x67, 0x6C, 0x6E, 0x72, 0x73, 0x74,
-    0x7A, 0x63, 0xFA, 0x49, 0xFF, 0xB8, 0xF9, 0x29, 0xFF, 0xBB, 0xFF, 0xC6, 0xFF, 0xDC, 0xFF, 0xE6,
-    0xFF, 0xEE, 0xF8, 0xEA, 0xFF, 0xFD, 0xC1, 0x02, 0x11, 0x72, 0xF8, 0xB1, 0x42, 0x6E, 0x74, 0xF2,
-    0x55, 0xF1, 0x5C, 0xA2, 0x03, 0xE2, 0x65, 0x69, 0xF3, 0xF9, 0xA0, 0x04, 0x02, 0x42, 0x6B, 0x74,
-    0xF1, 0x45, 0xF2, 0xDA, 0xC3, 0x04, 0x22, 0x61, 0x65, 0x69, 0xF8, 0x57, 0xF8, 0x57, 0xF8, 0x57,
-    0x42, 0x69, 0x75, 0xF8, 0x4B, 0xF8, 0x14, 0xC2, 0x03, 0xD1, 0x69, 0x6F, 0xF8, 0x71, 0xF8, 0x44,
-    0xA0, 0x01, 0x92, 0x42, 0x69, 0x75, 0xF8, 0x30, 0xF8, 0x01, 0x41, 0x72, 0xF7, 0xFA, 0xC2, 0x04,
-    0x42, 0x70, 0x74, 0xF8, 0x2D, 0xFF, 0xFC, 0x41, 0x7A, 0xF1, 0x29, 0xC3, 0x02, 0x71, 0x69, 0x72,
-    0x77, 0xFF, 0xFC, 0xF7, 0xE9, 0xF8, 0x20, 0x41, 0x69, 0xFC, 0xAF, 0x4C, 0x2E, 0x61, 0x64, 0x67,
-    0x6C, 0x6D, 0x6E, 0x73, 0x74, 0x77, 0x79, 0x76, 0xF7, 0xCE, 0xFF, 0xB2, 0xFF, 0xB9, 0xFF, 0xC5,
-    0xFF, 0xCC, 0xFF, 0xD5, 0xFF, 0xD8, 0xFF, 0xE3, 0xFF, 0xF0, 0xF8, 0x10, 0xFB, 0x89, 0xFF, 0xFC,
-    0xA0, 0x02, 0x41, 0xA0, 0x04, 0x62, 0xA0, 0x15, 0x32, 0x21, 0x66, 0xFD, 0xA1, 0x02, 0x31, 0x69,
-    0xFD, 0xC2, 0x02, 0x71, 0x6E, 0x72, 0xF7, 0xA3, 0xF8, 0x30, 0xA0, 0x04, 0x82, 0x41, 0x7A, 0xF7,
-    0xCE, 0x41, 0x62, 0xF2, 0x55, 0x21, 0x61, 0xFC, 0xA2, 0x03, 0xD1, 0x69, 0x6C, 0xF5, 0xFD, 0x41,
-    0x72, 0xF2, 0x1D, 0x43, 0x61, 0x64, 0x65, 0xFF, 0xFC, 0xF0, 0xA5, 0xF7, 0x9C, 0x41, 0x72, 0xF7,
-    0xAE, 0x42, 0x62, 0x68, 0xF7, 0xD7, 0xF0, 0xA3, 0x44, 0x67, 0x75, 0x6D, 0x72, 0xFF, 0xF5, 0xF7,
-    0x6C, 0xF0, 0xA8, 0xFF, 0xF9, 0xA0, 0x04, 0xC2, 0xA0, 0x15, 0x52, 0x21, 0x65, 0xFD, 0x22, 0x6F,
-    0x76, 0xF7, 0xFD, 0xA0, 0x04, 0xE2, 0x21, 0x61, 0xFD, 0xC4, 0x02, 0x81, 0x69, 0x72, 0x75, 0x7A,
-    0xFF, 0xF5, 0xF7, 0x82, 0xFF, 0xFD, 0xF7, 0x43, 0x48, 0x62, 0x64, 0x65, 0x66, 0x6C, 0x6E, 0x6F,
-    0x74, 0xFA, 0x65, 0xFF, 0x94, 0xFF, 0x99, 0xFF, 0xA2, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xD0, 0xFF,
-    0xF1, 0x41, 0x68, 0xF0, 0x6E, 0xA0, 0x15, 0x72, 0x21, 0x64, 0xFD, 0x22, 0x74, 0x6E, 0xF6, 0xFD,
-    0x41, 0x70, 0xF9, 0x00, 0x43, 0x2E, 0x6E, 0x73, 0xF8, 0x25, 0xF0, 0x2E, 0xFF, 0xFC, 0x42, 0x73,
-    0x6E, 0xF7, 0x79, 0xFF, 0xEA, 0xA0, 0x15, 0x92, 0x21, 0x64, 0xFD, 0xA1, 0x01, 0x41, 0x6E, 0xFD,
-    0x41, 0x6E, 0xF4, 0xB7, 0xA5, 0x05, 0x02, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xD7, 0xE0, 0xEA, 0xF7,
-    0xFC, 0xC1, 0x04, 0x62, 0x65, 0xFE, 0x45, 0xC1, 0x02, 0x71, 0x69, 0xF0, 0x13, 0x41, 0x63, 0xF0,
-    0x0D, 0x21, 0x69, 0xFC, 0x41, 0x62, 0xF0, 0x5A, 0xC1, 0x00, 0x51, 0x74, 0xF0, 0x08, 0x21, 0x61,
-    0xFA, 0xA0, 0x15, 0xB2, 0x21, 0x6F, 0xFD, 0x46, 0x2E, 0x61, 0x64, 0x65, 0x69, 0x6E, 0xF8, 0xA9,
-    0xFE, 0x93, 0xEF, 0xF9, 0xF8, 0xA9, 0xF8, 0xA9, 0xFF, 0xFD, 0xA0, 0x05, 0x22, 0xA0, 0x15, 0xD3,
-    0x21, 0x6C, 0xFD, 0x44, 0x61, 0x68, 0x6F, 0x75, 0xF6, 0x99, 0xEF, 0xE6, 0xF7, 0x2E, 0xFF, 0xFD,
-    0x41, 0x64, 0xF1, 0x64, 0x21, 0x6E, 0xFC, 0x4A, 0x64, 0x65, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73,
-    0x74, 0x75, 0xFF, 0xB0, 0xF7, 0x1A, 0xFF, 0xBA, 0xFF, 0xBD, 0xFF, 0xC7, 0xF7, 0xBD, 0xFF, 0xD0,
-    0xFF, 0xE3, 0xFF, 0xEC, 0xFF, 0xFD, 0x41, 0x74, 0xF6, 0x63, 0x41, 0x68, 0xF1, 0x3A, 0x21, 0x74,
-    0xFC, 0x41, 0x71, 0xEF, 0x81, 0x21, 0x73, 0xFC, 0x23, 0x69, 0x6F, 0x75, 0xEE, 0xF6, 0xFD, 0xC1,
-    0x05, 0x43, 0x6F, 0xF1, 0x13, 0xC3, 0x02, 0x41, 0x6C, 0x6F, 0x72, 0xF6, 0xDC, 0xF7, 0x64, 0xF6,
-    0xC2, 0x41, 0x66, 0xEF, 0x6D, 0x41, 0x61, 0xF6, 0xCC, 0xC1, 0x02, 0x31, 0x74, 0xF0, 0x20, 0xA0,
-    0x16, 0x02, 0xA2, 0x00, 0x81, 0x72, 0x73, 0xFD, 0xFD, 0x21, 0x65, 0xF9, 0x41, 0x6E, 0xFA, 0x5C,
-    0x42, 0x65, 0x69, 0xEF, 0x42, 0xFF, 0xFC, 0x43, 0x69, 0x73, 0x74, 0xFF, 0xF2, 0xFF, 0xF9, 0xF8,
-    0x09, 0x41, 0x6F, 0xF7, 0x43, 0x41, 0x2E, 0xF0, 0xD1, 0x21, 0x64, 0xFC, 0x41, 0x65, 0xF4, 0x29,
-    0x45, 0x61, 0x69, 0x6F, 0x65, 0x74, 0xF5, 0xF9, 0xFF, 0xF1, 0xF5, 0xFC, 0xFF, 0xF9, 0xFF, 0xFC,
-    0x48, 0x66, 0x67, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0xFF, 0xB1, 0xFF, 0xB5, 0xF7, 0x27, 0xEF,
-    0xD9, 0xFF, 0xB9, 0xF8, 0x6C, 0xFF, 0xD7, 0xFF, 0xF0, 0xA0, 0x05, 0x72, 0x42, 0x2E, 0x73, 0xF7,
-    0xC4, 0xEE, 0xFC, 0x55, 0x61, 0x62, 0x64, 0x65, 0x66, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
-    0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0xFD, 0x74, 0xFD, 0xA0, 0xFD, 0xA7, 0xFD,
-    0xF8, 0xFE, 0x1D, 0xFE, 0x20, 0xFE, 0x95, 0xF7, 0x67, 0xF6, 0x5E, 0xFE, 0xE1, 0xFD, 0xA7, 0xFE,
-    0xEE, 0xFF, 0x44, 0xF5, 0xC6, 0xFF, 0x75, 0xFF, 0x7C, 0xFF, 0x82, 0xFF, 0xDD, 0xF7, 0x67, 0xFF,
-    0xF6, 0xFF, 0xF9, 0x41, 0x6E, 0xEE, 0xC7, 0x42, 0x69, 0x6C, 0xFF, 0xFC, 0xF5, 0xF1, 0xA0, 0x16,
-    0x22, 0x42, 0x6E, 0x6D, 0xF5, 0x83, 0xFF, 0xFD, 0x21, 0x65, 0xF9, 0xA0, 0x04, 0x42, 0xA0, 0x05,
-    0x42, 0x42, 0x61, 0x69, 0xEE, 0x97, 0xF2, 0xFA, 0x43, 0x61, 0x6C, 0x6F, 0xF9, 0x8A, 0xFF, 0xF9,
-    0xF5, 0x61, 0x43, 0x63, 0x73, 0x7A, 0xEE, 0x86, 0xEE, 0x9E, 0xEE, 0x98, 0x45, 0x64, 0x65, 0x69,
-    0x74, 0x79, 0xEE, 0x94, 0xEE, 0x7C, 0xFF, 0xF6, 0xF1, 0x8F, 0xEE, 0x76, 0x41, 0x65, 0xFD, 0x4E,
-    0x41, 0x6D, 0xEE, 0x80, 0x21, 0x6F, 0xFC, 0x42, 0x65, 0x69, 0xEF, 0x70, 0xFC, 0x9F, 0x42, 0x74,
-    0x79, 0xFF, 0xF9, 0xF5, 0x2B, 0x41, 0x76, 0xF5, 0x24, 0xA0, 0x16, 0x43, 0x21, 0x73, 0xFD, 0x43,
-    0x68, 0x69, 0x61, 0xF5, 0xB2, 0xFF, 0xF6, 0xFF, 0xFD, 0x41, 0x6C, 0xEE, 0x57, 0x21, 0x61, 0xFC,
-    0xCC, 0x03, 0xD1, 0x62, 0x63, 0x64, 0x67, 0x68, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x76, 0xFF,
-    0x87, 0xEE, 0x35, 0xFF, 0x98, 0xFF, 0x9B, 0xFF, 0x9E, 0xFF, 0xA8, 0xFF, 0xBC, 0xFF, 0xCC, 0xFF,
-    0xD4, 0xFF, 0xDE, 0xFF, 0xEF, 0xFF, 0xFD, 0x41, 0x70, 0xF2, 0xB4, 0x43, 0x6D, 0x6E, 0x75, 0xFF,
-    0xFC, 0xEE, 0x07, 0xF2, 0x4F, 0xC3, 0x02, 0x21, 0x68, 0x69, 0x6F, 0xF1, 0x70, 0xEE, 0xFC, 0xFF,
-    0xF6, 0x41, 0x6E, 0xF4, 0xC8, 0x42, 0x2E, 0x65, 0xF4, 0xC4, 0xFF, 0xFC, 0x42, 0x2E, 0x6C, 0xF6,
-    0xB4, 0xF5, 0xF8, 0xA0, 0x05, 0x92, 0xC4, 0x03, 0xD1, 0x63, 0x65, 0x69, 0x74, 0xF5, 0xEE, 0xFF,
-    0xFD, 0xF4, 0xB3, 0xF5, 0xEE, 0x41, 0x6D, 0xF4, 0xAF, 0x21, 0x61, 0xFC, 0xC1, 0x02, 0x71, 0x62,
-    0xEF, 0x88, 0x21, 0x69, 0xFA, 0x43, 0x61, 0x73, 0x74, 0xF4, 0x94, 0xFF, 0xFD, 0xED, 0xDB, 0xA0,
-    0x02, 0xF2, 0xA1, 0x00, 0x51, 0x61, 0xFD, 0x4A, 0x2E, 0x64, 0x69, 0x6C, 0x6E, 0x70, 0x72, 0x73,
-    0x74, 0x77, 0xFC, 0xD9, 0xFF, 0xBE, 0xF5, 0xBD, 0xFF, 0xC5, 0xFF, 0xCF, 0xF5, 0xBD, 0xFF, 0xE2,
-    0xFF, 0xEE, 0xFF, 0xFB, 0xED, 0xB1, 0xA0, 0x05, 0xB2, 0x42, 0x63, 0x73, 0xF6, 0x57, 0xF4, 0x8C,
-    0x21, 0x69, 0xF9, 0x22, 0x62, 0x6E, 0xF3, 0xFD, 0x41, 0x70, 0xEF, 0x2C, 0x41, 0x69, 0xF5, 0x88,
-    0x42, 0x2E, 0x73, 0xF4, 0x8B, 0xF4, 0x8B, 0xC6, 0x00, 0xD1, 0x61, 0x64, 0x6C, 0x6D, 0x6E, 0x72,
-    0xFF, 0xF1, 0xF4, 0x42, 0xEE, 0x1C, 0xFF, 0xF5, 0xF8, 0xC7, 0xFF, 0xF9, 0x42, 0x2E, 0x73, 0xF6,
-    0x24, 0xF8, 0x5A, 0xC2, 0x05, 0xD2, 0x65, 0x69, 0xFF, 0xF9, 0xF6, 0x1D, 0x41, 0x76, 0xF0, 0xB5,
-    0x45, 0x6E, 0x6F, 0x74, 0x7A, 0x65, 0xFF, 0xF3, 0xF6, 0x10, 0xF5, 0x54, 0xEE, 0xE6, 0xFF, 0xFC,
-    0xA0, 0x05, 0xF2, 0x41, 0x75, 0xED, 0x47, 0x42, 0x2E, 0x68, 0xF4, 0x02, 0xFF, 0xFC, 0xC7, 0x02,
-    0x41, 0x2E, 0x61, 0x65, 0x69, 0x6F, 0x74, 0x73, 0xF3, 0xFB, 0xFF, 0xA5, 0xFF, 0xB9, 0xFF, 0xE2,
-    0xFF, 0xF2, 0xF7, 0x10, 0xFF, 0xF9, 0xA0, 0x06, 0x12, 0xC2, 0x02, 0x71, 0x62, 0x72, 0xFF, 0xFD,
-    0xED, 0x27, 0x41, 0x72, 0xF3, 0xD7, 0x41, 0x2E, 0xF5, 0xCA, 0x21, 0x63, 0xFC, 0x21, 0x69, 0xFD,
-    0x42, 0x61, 0x69, 0xF4, 0x61, 0xF5, 0x04, 0xC1, 0x01, 0x41, 0x74, 0xF4, 0xFD, 0xC1, 0x02, 0xB1,
-    0x2E, 0xF3, 0xBF, 0xC5, 0x02, 0x41, 0x61, 0x65, 0x67, 0x6F, 0x71, 0xFF, 0xF4, 0xEE, 0x86, 0xFF,
-    0xFA, 0xF5, 0xAD, 0xEE, 0x83, 0x43, 0x65, 0x68, 0x69, 0xF3, 0xA4, 0xF3, 0xE6, 0xF5, 0x83, 0x42,
-    0x61, 0x69, 0xF3, 0x9A, 0xF3, 0x9A, 0x21, 0x74, 0xF9, 0x41, 0x7A, 0xEC, 0xD1, 0xA1, 0x03, 0xE2,
-    0x69, 0xFC, 0xA0, 0x10, 0x42, 0x21, 0x72, 0xFD, 0x21, 0x61, 0xFD, 0xCE, 0x03, 0xD1, 0x61, 0x63,
-    0x65, 0x66, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x73, 0x74, 0x7A, 0x67, 0xFF, 0x9E, 0xF3, 0x89,
-    0xFF, 0xA7, 0xFF, 0xB2, 0xF3, 0x7E, 0xFF, 0xB5, 0xFB, 0xD5, 0xFF, 0xC8, 0xED, 0x17, 0xFF, 0xDA,
-    0xFF, 0xEB, 0xFF, 0xF2, 0xF5, 0x75, 0xFF, 0xFD, 0xC1, 0x01, 0xF1, 0x69, 0xF3, 0x93, 0x41, 0x6F,
-    0xF3, 0x4E, 0x21, 0x69, 0xFC, 0x21, 0x74, 0xFD, 0xC2, 0x01, 0x91, 0x61, 0x65, 0xFF, 0xFD, 0xF5,
-    0x38, 0x21, 0x72, 0xF7, 0x42, 0x6D, 0x61, 0xEC, 0x64, 0xEC, 0x67, 0x42, 0x63, 0x6D, 0xF3, 0x2E,
-    0xEC, 0x57, 0xC4, 0x06, 0x33, 0x61, 0x65, 0x69, 0x79, 0xFF, 0xEF, 0xFF, 0xF2, 0xFF, 0xF9, 0xEC,
-    0x56, 0xC1, 0x02, 0x41, 0x72, 0xF3, 0xB0, 0x41, 0x63, 0xF3, 0x54, 0xA1, 0x00, 0x51, 0x6E, 0xFC,
-    0xC1, 0x02, 0xE1, 0x72, 0xEC, 0x4A, 0x42, 0x69, 0x6F, 0xEC, 0x4A, 0xFF, 0xFA, 0x44, 0x61, 0x65,
-    0x67, 0x74, 0xEC, 0x2B, 0xF4, 0x1C, 0xEC, 0x3D, 0xEC, 0x43, 0xA0, 0x16, 0x73, 0x21, 0x6E, 0xFD,
-    0x21, 0x6F, 0xFD, 0x44, 0x61, 0x69, 0x6C, 0x68, 0xF3, 0x28, 0xFC, 0x1A, 0xF3, 0x7E, 0xFF, 0xFD,
-    0x41, 0x6E, 0xED, 0x97, 0x42, 0x62, 0x6F, 0xF2, 0xD5, 0xFF, 0xFC, 0xC1, 0x00, 0x61, 0x65, 0xEB,
-    0xF7, 0x42, 0x65, 0x69, 0xEC, 0x0F, 0xF2, 0xD3, 0x41, 0x74, 0xEC, 0xAE, 0x21, 0x73, 0xFC, 0xCE,
-    0x03, 0xD1, 0x61, 0x65, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x76, 0x77, 0x7A, 0x75,
-    0xF2, 0xF4, 0xED, 0x87, 0xFF, 0xA2, 0xFF, 0xAC, 0xFF, 0xB7, 0xFA, 0x1C, 0xFF, 0xBE, 0xFF, 0xD4,
-    0xFF, 0xE5, 0xEC, 0x26, 0xFF, 0xEC, 0xEC, 0x7C, 0xFF, 0xF2, 0xFF, 0xFD, 0x41, 0x63, 0xF4, 0x84,
-    0x42, 0x2E, 0x69, 0xF4, 0x80, 0xFF, 0xFC, 0x42, 0x73, 0x74, 0xF0, 0x9C, 0xFF, 0xF9, 0x41, 0x61,
-    0xFA, 0xD5, 0x44, 0x61, 0x64, 0x74, 0x76, 0xEB, 0xBB, 0xF4, 0x6E, 0xFF, 0xFC, 0xEB, 0xA6, 0xC1,
-    0x02, 0xE1, 0x65, 0xEB, 0xAB, 0x21, 0x69, 0xFA, 0xC4, 0x00, 0xD1, 0x66, 0x6E, 0x73, 0x74, 0xEB,
-    0xA8, 0xF3, 0x81, 0xEB, 0x8A, 0xFF, 0xFD, 0x42, 0x6C, 0x6F, 0xEB, 0x81, 0xEB, 0xA2, 0xA0, 0x16,
-    0xA2, 0x21, 0x64, 0xFD, 0x21, 0x6F, 0xFD, 0x41, 0x6F, 0xEE, 0x54, 0x21, 0x63, 0xFC, 0x44, 0x70,
-    0x73, 0x63, 0x65, 0xFF, 0xE9, 0xEC, 0x01, 0xFF, 0xF6, 0xFF, 0xFD, 0x45, 0x61, 0x65, 0x69, 0x6F,
-    0x75, 0xFF, 0xAC, 0xFF, 0xB7, 0xFF, 0xCD, 0xFF, 0xF3, 0xF0, 0x5A, 0xA0, 0x06, 0x63, 0x42, 0x67,
-    0x74, 0xF2, 0x26, 0xF2, 0x1E, 0x42, 0x62, 0x6E, 0xEB, 0x43, 0xFF, 0xF9, 0x41, 0x75, 0xF3, 0x2D,
-    0x42, 0x63, 0x6D, 0xFF, 0xFC, 0xEC, 0xCA, 0xA0, 0x16, 0xC3, 0x21, 0x63, 0xFD, 0x21, 0x65, 0xFD,
-    0x21, 0x6D, 0xFD, 0x21, 0x6F, 0xFD, 0xC6, 0x03, 0xE2, 0x61, 0x65, 0x69, 0x75, 0x77, 0x72, 0xFF,
-    0xDF, 0xF9, 0xC0, 0xFF, 0xEA, 0xEB, 0x25, 0xF3, 0x13, 0xFF, 0xFD, 0xC1, 0x01, 0x41, 0x74, 0xF3,
-    0x5C, 0x41, 0x73, 0xEB, 0x07, 0x42, 0x69, 0x75, 0xFF, 0xFC, 0xF3, 0x0F, 0x42, 0x69, 0x74, 0xF3,
-    0xC4, 0xFF, 0xF9, 0x43, 0x61, 0x65, 0x69, 0xF4, 0xFA, 0xF2, 0x44, 0xF2, 0x5E, 0x42, 0x69, 0x79,
-    0xF1, 0xFE, 0xF1, 0xC7, 0xA0, 0x06, 0x92, 0xA0, 0x16, 0xF3, 0x21, 0x65, 0xFD, 0x21, 0x63, 0xFD,
-    0x22, 0x62, 0x6E, 0xF4, 0xFD, 0x42, 0x61, 0x69, 0xFF, 0xFB, 0xF3, 0xE6, 0xC1, 0x03, 0xD1, 0x73,
-    0xEB, 0x8D, 0x42, 0x65, 0x76, 0xF2, 0x2F, 0xFB, 0xC7, 0xC2, 0x06, 0xB2, 0x69, 0x72, 0xFF, 0xF9,
-    0xF1, 0x90, 0x4A, 0x64, 0x66, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0xEA, 0xCE, 0xF2,
-    0xA7, 0xFF, 0xA9, 0xFF, 0xBA, 0xFF, 0xC1, 0xF2, 0xC2, 0xFF, 0xCB, 0xFF, 0xE3, 0xFF, 0xEA, 0xFF,
-    0xF7, 0xA0, 0x03, 0xD1, 0x50, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6E, 0x6F, 0x71, 0x72,
-    0x73, 0x74, 0x75, 0x79, 0x7A, 0xFC, 0x5C, 0xFC, 0x91, 0xFC, 0xE3, 0xFD, 0x6A, 0xFD, 0xE7, 0xFE,
-    0x14, 0xFE, 0x3E, 0xF1, 0x68, 0xFE, 0xAB, 0xF3, 0x06, 0xFF, 0x37, 0xFF, 0x47, 0xFF, 0x72, 0xFF,
-    0xDE, 0xFF, 0xFD, 0xEA, 0xD1, 0xA0, 0x06, 0xF3, 0xA0, 0x07, 0x22, 0x41, 0x67, 0xEA, 0x6F, 0x43,
-    0x64, 0x6B, 0x79, 0xEA, 0x7A, 0xEA, 0x7A, 0xF1, 0x2A, 0x41, 0x62, 0xED, 0x77, 0xC3, 0x02, 0x71,
-    0x69, 0x6F, 0x61, 0xFB, 0xF8, 0xF1, 0x1C, 0xFF, 0xFC, 0xC1, 0x05, 0x22, 0x65, 0xEA, 0x57, 0x41,
-    0x65, 0xF9, 0x7B, 0x21, 0x6E, 0xFC, 0x21, 0x6F, 0xFD, 0xCC, 0x06, 0xD2, 0x2E, 0x62, 0x63, 0x66,
-    0x67, 0x6D, 0x6E, 0x72, 0x74, 0x76, 0x79, 0x6C, 0xF2, 0xF7, 0xFF, 0xCC, 0xEA, 0x2C, 0xF1, 0x00,
-    0xF9, 0x57, 0xFF, 0xCF, 0xFF, 0xD2, 0xFF, 0xD6, 0xFF, 0xE4, 0xFF, 0xF0, 0xF2, 0xF7, 0xFF, 0xFD,
-    0x41, 0x62, 0xF1, 0x05, 0xA0, 0x09, 0xA2, 0x21, 0x62, 0xFD, 0xA2, 0x07, 0x42, 0x61, 0x69, 0xF6,
-    0xFD, 0x41, 0x73, 0xF2, 0x96, 0x42, 0x66, 0x6C, 0xEA, 0x14, 0xFF, 0xFC, 0x42, 0x69, 0x6F, 0xEA,
-    0x07, 0xF1, 0x6E, 0x41, 0x6E, 0xEF, 0x2E, 0x41, 0x6C, 0xF1, 0x4A, 0xA0, 0x17, 0x22, 0x21, 0x72,
-    0xFD, 0x41, 0x61, 0xFC, 0xC5, 0x21, 0x6E, 0xFC, 0x22, 0x61, 0x69, 0xF6, 0xFD, 0x44, 0x61, 0x69,
-    0x6F, 0x6C, 0xFF, 0xE6, 0xFF, 0xEA, 0xFB, 0xF8, 0xFF, 0xFB, 0xA0, 0x03, 0xE2, 0x41, 0x2E, 0xF0,
-    0x8C, 0x41, 0x66, 0xF0, 0x93, 0xA0, 0x07, 0x62, 0x42, 0x65, 0x71, 0xE9, 0xAA, 0xFF, 0xFD, 0x42,
-    0x69, 0x6F, 0xFF, 0xF9, 0xF0, 0x85, 0xC1, 0x02, 0x71, 0x2E, 0xE9, 0xBA, 0x42, 0x63, 0x6C, 0xFF,
-    0xFA, 0xF0, 0x78, 0x41, 0x73, 0xF0, 0xFE, 0x43, 0x6E, 0x72, 0x73, 0xFF, 0xFC, 0xE9, 0xB8, 0xF3,
-    0x96, 0xC3, 0x01, 0x41, 0x2E, 0x69, 0x6F, 0xF2, 0x4F, 0xFF, 0xEB, 0xFF, 0xF6, 0x41, 0x66, 0xE9,
-    0xA2, 0x21, 0x69, 0xFC, 0xC4, 0x03, 0xD1, 0x61, 0x6F, 0x74, 0x75, 0xF3, 0x86, 0xF0, 0x87, 0xFF,
-    0xFD, 0xF0, 0x87, 0xC3, 0x01, 0xF1, 0x61, 0x69, 0x75, 0xF0, 0x78, 0xE9, 0x5F, 0xF3, 0x6A, 0x41,
-    0x7A, 0xE9, 0x7A, 0x21, 0x69, 0xFC, 0x44, 0x68, 0x6D, 0x6E, 0x73, 0xF1, 0x43, 0xF2, 0x1A, 0xFF,
-    0xFD, 0xE9, 0x6A, 0x42, 0x69, 0x72, 0xE9, 0x57, 0xF0, 0x58, 0xC6, 0x00, 0xD1, 0x2E, 0x63, 0x6F,
-    0x74, 0x75, 0x69, 0xF0, 0x6F, 0xF0, 0x7E, 0xFC, 0x2C, 0xFF, 0xF9, 0xF0, 0xA7, 0xF9, 0x43, 0x41,
-    0x63, 0xF3, 0x2E, 0xC2, 0x01, 0xF1, 0x6F, 0x69, 0xF3, 0x2A, 0xFF, 0xFC, 0x41, 0x6C, 0xE9, 0x2E,
-    0xA1, 0x01, 0xF1, 0x69, 0xFC, 0xA0, 0x17, 0x42, 0x21, 0x69, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x69,
-    0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x52, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x69, 0x6C,
-    0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x79, 0x66, 0xF8, 0x29, 0xFF, 0x0E, 0xFF, 0x15,
-    0xFF, 0x36, 0xFF, 0x43, 0xFF, 0x46, 0xFF, 0x4A, 0xFF, 0x58, 0xFF, 0x7A, 0xFF, 0x8D, 0xFF, 0x9C,
-    0xF0, 0x50, 0xFF, 0xAF, 0xFF, 0xC3, 0xFF, 0xDC, 0xFF, 0xE9, 0xEF, 0xD2, 0xFF, 0xFD, 0xA0, 0x02,
-    0x22, 0x21, 0x74, 0xFD, 0x44, 0x61, 0x65, 0x69, 0x79, 0xF0, 0xB5, 0xFF, 0xFD, 0xF0, 0x04, 0xEF,
-    0xF5, 0xA0, 0x07, 0x82, 0xC1, 0x07, 0xA3, 0x62, 0xE8, 0xCC, 0x42, 0x6D, 0x69, 0xF0, 0x17, 0xE9,
-    0x10, 0x43, 0x61, 0x65, 0x74, 0xFF, 0xF9, 0xF0, 0x98, 0xF0, 0xB3, 0xA0, 0x07, 0xD2, 0x21, 0x6E,
-    0xFD, 0x41, 0x72, 0xE9, 0x2A, 0xA1, 0x02, 0xB1, 0x66, 0xFC, 0x41, 0x74, 0xF2, 0x96, 0x21, 0x61,
-    0xFC, 0x41, 0x2E, 0xF0, 0x93, 0xC1, 0x02, 0xE1, 0x7A, 0xEF, 0x5F, 0xC3, 0x02, 0xB1, 0x61, 0x65,
-    0x69, 0xFD, 0xE6, 0xFF, 0xF6, 0xFF, 0xFA, 0xC1, 0x03, 0xD1, 0x67, 0xE8, 0x89, 0xC2, 0x01, 0xF1,
-    0x6E, 0x72, 0xF2, 0x70, 0xF2, 0x70, 0xC2, 0x00, 0xD1, 0x65, 0x74, 0xFF, 0xF7, 0xEB, 0xD3, 0xA0,
-    0x07, 0xF2, 0xC2, 0x00, 0x61, 0x69, 0x74, 0xF1, 0x1E, 0xFF, 0xFD, 0x41, 0x69, 0xEF, 0x7E, 0xA0,
-    0x08, 0x12, 0xA0, 0x0F, 0x02, 0x21, 0x79, 0xFD, 0x21, 0x68, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x65,
-    0xFD, 0x50, 0x2E, 0x61, 0x63, 0x64, 0x65, 0x66, 0x67, 0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74,
-    0x76, 0x6D, 0xF0, 0xFF, 0xFF, 0x83, 0xFF, 0x90, 0xF0, 0x43, 0xFF, 0x9D, 0xFF, 0xA4, 0xF1, 0x8B,
-    0xFF, 0xAD, 0xFF, 0xBA, 0xFF, 0xC6, 0xFE, 0x56, 0xFF, 0xD5, 0xFF, 0xE1, 0xFF, 0xEA, 0xFF, 0xEE,
-    0xFF, 0xFD, 0xA0, 0x05, 0x52, 0x42, 0x2E, 0x73, 0xF0, 0x0F, 0xEE, 0xD4, 0x41, 0x64, 0xFE, 0x3E,
-    0x44, 0x2E, 0x64, 0x73, 0x61, 0xF0, 0x04, 0xF0, 0x04, 0xFF, 0xF5, 0xFF, 0xFC, 0xA0, 0x17, 0x63,
-    0x21, 0x65, 0xFD, 0x46, 0x61, 0x65, 0x6F, 0x75, 0x79, 0x69, 0xF8, 0xE6, 0xFF, 0xED, 0xF7, 0x27,
-    0xF8, 0xE6, 0xF7, 0x0D, 0xFF, 0xFD, 0xA0, 0x08, 0x33, 0x43, 0x61, 0x69, 0x6F, 0xEF, 0x38, 0xE7,
-    0xC9, 0xF6, 0xB1, 0x41, 0x69, 0xF6, 0xB4, 0x42, 0x61, 0x69, 0xF2, 0xBB, 0xE7, 0xBB, 0x41, 0x64,
-    0xE7, 0xCC, 0x41, 0x70, 0xE7, 0xB6, 0x41, 0x74, 0xF8, 0xB3, 0xA0, 0x17, 0x92, 0x21, 0x64, 0xFD,
-    0x21, 0x72, 0xFD, 0x21, 0x6F, 0xFD, 0xD0, 0x03, 0xD1, 0x2E, 0x64, 0x65, 0x66, 0x67, 0x6C, 0x6D,
-    0x6E, 0x6F, 0x70, 0x72, 0x73, 0x75, 0x76, 0x78, 0x77, 0xEF, 0xAE, 0xF2, 0xF8, 0xF0, 0x6A, 0xF9,
-    0x08, 0xEF, 0x93, 0xFF, 0xD3, 0xFF, 0xDD, 0xFF, 0xE1, 0xFF, 0xE8, 0xFF, 0xEC, 0xEF, 0x93, 0xEF,
-    0xAE, 0xFF, 0xF0, 0xEF, 0x0B, 0xEF, 0xAE, 0xFF, 0xFD, 0x41, 0x6F, 0xEB, 0xD2, 0x42, 0x67, 0x69,
-    0xFF, 0xFC, 0xEE, 0x3C, 0xA0, 0x17, 0xB2, 0x21, 0x6C, 0xFD, 0xA1, 0x02, 0xE1, 0x61, 0xFD, 0xC2,
-    0x00, 0x51, 0x61, 0x6E, 0xE8, 0x68, 0xFF, 0xFB, 0x41, 0x61, 0xF7, 0x0D, 0x21, 0x74, 0xFC, 0xA0,
-    0x17, 0xD3, 0x21, 0x67, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6C, 0xFD, 0x44, 0x62, 0x6C, 0x66, 0x70,
-    0xE7, 0x3D, 0xE7, 0x37, 0xFF, 0xF1, 0xFF, 0xFD, 0xA0, 0x18, 0x02, 0x21, 0x64, 0xFD, 0x21, 0x65,
-    0xFD, 0x43, 0x70, 0x77, 0x6D, 0xE7, 0x27, 0xED, 0xF8, 0xFF, 0xFD, 0x41, 0x69, 0xEF, 0xE5, 0x21,
-    0x6C, 0xFC, 0x21, 0x70, 0xFD, 0xC6, 0x03, 0xD1, 0x61, 0x65, 0x69, 0x6F, 0x75, 0x79, 0xFF, 0xA8,
-    0xFF, 0xBA, 0xFF, 0xD6, 0xFF, 0xEC, 0xFF, 0xFD, 0xED, 0xE4, 0xC3, 0x08, 0x63, 0x70, 0x77, 0x79,
-    0xEE, 0x67, 0xEE, 0xEF, 0xEE, 0xEF, 0x41, 0x62, 0xEE, 0x41, 0x42, 0x68, 0x61, 0xEE, 0x1F, 0xFF,
-    0xFC, 0x41, 0x2E, 0xF0, 0xEC, 0xA1, 0x08, 0x92, 0x6C, 0xFC, 0x42, 0x2E, 0x73, 0xED, 0xAF, 0xED,
-    0xAF, 0xC3, 0x02, 0x81, 0x61, 0x65, 0x74, 0xEF, 0x49, 0xE9, 0xD2, 0xFF, 0xF9, 0x41, 0x65, 0xEE,
-    0x1A, 0x41, 0x62, 0xE7, 0x04, 0xC1, 0x01, 0x91, 0x65, 0xEE, 0x2C, 0xA0, 0x18, 0x23, 0x21, 0x6C,
-    0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x70, 0xFD, 0xC9, 0x03, 0xD1, 0x61, 0x63, 0x65, 0x67, 0x6C, 0x6D,
-    0x6E, 0x70, 0x6F, 0xFF, 0xCE, 0xFF, 0xDA, 0xEE, 0xAC, 0xEE, 0x1A, 0xFF, 0xE6, 0xFF, 0xEA, 0xEE,
-    0x1A, 0xFF, 0xEE, 0xFF, 0xFD, 0x42, 0x65, 0x70, 0xED, 0xFC, 0xE6, 0xAB, 0xC2, 0x02, 0x11, 0x6E,
-    0x73, 0xEF, 0x54, 0xFF, 0xF9, 0x57, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A,
-    0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0xFC, 0x54, 0xEE,
-    0xF5, 0xED, 0x57, 0xFC, 0x85, 0xFD, 0x82, 0xF5, 0x35, 0xFD, 0xBF, 0xFD, 0xCC, 0xFE, 0x4C, 0xEE,
-    0xF5, 0xFE, 0x7D, 0xFE, 0x9E, 0xEE, 0xF5, 0xFE, 0xB1, 0xFE, 0xE1, 0xEE, 0xF5, 0xFF, 0x70, 0xFF,
-    0x85, 0xFF, 0x95, 0xFF, 0xD2, 0xEE, 0xF5, 0xEE, 0xF5, 0xFF, 0xF7, 0xA0, 0x07, 0x42, 0xC1, 0x00,
-    0x61, 0x69, 0xEA, 0x57, 0xC1, 0x02, 0x31, 0x72, 0xED, 0x10, 0x21, 0x65, 0xFA, 0xC2, 0x02, 0x31,
-    0x65, 0x6F, 0xE9, 0x26, 0xF8, 0xF6, 0x41, 0x65, 0xE8, 0xC2, 0xA0, 0x0B, 0xA2, 0x21, 0x73, 0xFD,
-    0x21, 0x65, 0xFD, 0x42, 0x64, 0x69, 0xEC, 0xE9, 0xFF, 0xFD, 0x42, 0x63, 0x6C, 0xE6, 0x0E, 0xE6,
-    0x0E, 0xC1, 0x00, 0xD1, 0x65, 0xE7, 0x96, 0x46, 0x61, 0x63, 0x65, 0x69, 0x6B, 0x74, 0xE6, 0x13,
-    0xE6, 0x01, 0xF0, 0xD7, 0xFF, 0xF3, 0xE6, 0x19, 0xFF, 0xFA, 0x43, 0x70, 0x73, 0x74, 0xEC, 0xCA,
-    0xED, 0x3D, 0xE7, 0x7D, 0x41, 0x66, 0xEC, 0xB8, 0xA0, 0x07, 0xB2, 0xC4, 0x02, 0x81, 0x65, 0x68,
-    0x69, 0x75, 0xE8, 0xAE, 0xE7, 0x6F, 0xFF, 0xF9, 0xFF, 0xFD, 0xC3, 0x02, 0x81, 0x65, 0x69, 0x6F,
-    0xF7, 0x19, 0xE5, 0xE6, 0xE5, 0xE6, 0x4B, 0x62, 0x63, 0x64, 0x67, 0x6C, 0x6D, 0x6E, 0x72, 0x73,
-    0x74, 0x76, 0xFF, 0x85, 0xF1, 0x45, 0xFF, 0x88, 0xFF, 0x94, 0xFF, 0x97, 0xFF, 0xA0, 0xFF, 0xAD,
-    0xFF, 0xC1, 0xFF, 0xD4, 0xFF, 0xE5, 0xFF, 0xF4, 0x42, 0x2E, 0x73, 0xED, 0x91, 0xED, 0x91, 0x42,
-    0x6C, 0x6E, 0xFF, 0xF9, 0xED, 0x8A, 0x41, 0x74, 0xED, 0x83, 0xC3, 0x03, 0xE2, 0x65, 0x69, 0x72,
-    0xFF, 0xF5, 0xFF, 0xFC, 0xEC, 0xDD, 0x42, 0x64, 0x6E, 0xED, 0x73, 0xE6, 0x59, 0x41, 0x73, 0xEE,
-    0x8E, 0xA1, 0x02, 0xB1, 0x73, 0xFC, 0x42, 0x63, 0x65, 0xEC, 0x6C, 0xEC, 0x4E, 0x42, 0x69, 0x79,
-    0xFF, 0xF9, 0xEC, 0x47, 0xC1, 0x00, 0x51, 0x65, 0xEC, 0x38, 0xC4, 0x02, 0x81, 0x62, 0x66, 0x6D,
-    0x74, 0xED, 0x4F, 0xFF, 0xF3, 0xEC, 0x71, 0xFF, 0xFA, 0x41, 0x6D, 0xED, 0x40, 0x42, 0x61, 0x75,
-    0xFF, 0xFC, 0xEE, 0x40, 0x41, 0x65, 0xED, 0x35, 0x42, 0x6D, 0x70, 0xED, 0x31, 0xFF, 0xFC, 0xC2,
-    0x02, 0x11, 0x61, 0x6F, 0xEC, 0x4C, 0xE5, 0x51, 0x44, 0x6C, 0x6D, 0x6E, 0x72, 0xEC, 0x61, 0xFF,
-    0xF0, 0xF1, 0x37, 0xFF, 0xF7, 0xA1, 0x02, 0xB1, 0x65, 0xD4, 0x42, 0x61, 0x65, 0xEC, 0xA0, 0xEC,
-    0x87, 0xC1, 0x01, 0x41, 0x61, 0xEC, 0x2A, 0xA1, 0x02, 0xB1, 0x6C, 0xFA, 0x41, 0x61, 0xEE, 0xBD,
-    0x4A, 0x61, 0x63, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x74, 0x75, 0x68, 0xFF, 0x86, 0xE8, 0x75, 0xFF,
-    0x91, 0xFF, 0xAA, 0xFF, 0xBD, 0xFF, 0xD8, 0xFF, 0xE5, 0xFF, 0xEA, 0xFF, 0xF7, 0xFF, 0xFC, 0xA0,
-    0x03, 0x42, 0x42, 0x72, 0x73, 0xEE, 0x94, 0xE4, 0xE6, 0xC6, 0x01, 0x91, 0x61, 0x62, 0x63, 0x6D,
-    0x74, 0x7A, 0xEC, 0x2E, 0xEB, 0xF2, 0xEC, 0x6E, 0xEB, 0xF2, 0xEC, 0x1F, 0xE4, 0xF7, 0xC2, 0x01,
-    0x91, 0x6C, 0x6E, 0xEC, 0xBB, 0xE5, 0x85, 0x41, 0x67, 0xEC, 0x01, 0x21, 0x6E, 0xFC, 0xC2, 0x01,
-    0x41, 0x6F, 0x69, 0xEB, 0x96, 0xFF, 0xFD, 0x21, 0x6C, 0xF7, 0x41, 0x6C, 0xE4, 0xBA, 0x48, 0x61,
-    0x64, 0x65, 0x69, 0x6F, 0x72, 0x75, 0x67, 0xFF, 0xC1, 0xF7, 0x18, 0xFF, 0xC4, 0xFF, 0xCB, 0xFF,
-    0xE0, 0xED, 0x34, 0xFF, 0xF9, 0xFF, 0xFC, 0x42, 0x69, 0x79, 0xE4, 0xA3, 0xEB, 0xFA, 0xA0, 0x08,
-    0xB2, 0xC1, 0x02, 0x82, 0x74, 0xE4, 0x81, 0x4A, 0x63, 0x64, 0x66, 0x6C, 0x6D, 0x6E, 0x70, 0x73,
-    0x74, 0x78, 0xEE, 0x86, 0xE7, 0x60, 0xEE, 0x86, 0xFF, 0xF0, 0xEE, 0x86, 0xF5, 0x1E, 0xFF, 0xF7,
-    0xFF, 0xFA, 0xF2, 0x38, 0xEB, 0x55, 0x41, 0x65, 0xFE, 0x82, 0x21, 0x72, 0xFC, 0xC1, 0x01, 0x41,
-    0x69, 0xED, 0x23, 0x41, 0x65, 0xEB, 0x52, 0x21, 0x74, 0xFC, 0x42, 0x65, 0x69, 0xEB, 0x9D, 0xFF,
-    0xFD, 0x44, 0x63, 0x6C, 0x6E, 0x74, 0xFF, 0xEC, 0xE4, 0x41, 0xFF, 0xF9, 0xEC, 0x53, 0x41, 0x65,
-    0xEA, 0x0C, 0x21, 0x72, 0xFC, 0x41, 0x2E, 0xEC, 0x24, 0x21, 0x65, 0xFC, 0x21, 0x73, 0xFD, 0xC5,
-    0x02, 0xB1, 0x65, 0x66, 0x69, 0x6F, 0x75, 0xFF, 0xCB, 0xF9, 0x92, 0xFF, 0xE2, 0xFF, 0xF3, 0xFF,
-    0xFD, 0x41, 0x6C, 0xEA, 0xE8, 0xA0, 0x08, 0xD2, 0x44, 0x62, 0x63, 0x6E, 0x74, 0xEA, 0xEC, 0xEB,
-    0x79, 0xEB, 0x1B, 0xFF, 0xFD, 0x42, 0x6C, 0x72, 0xEB, 0x43, 0xEA, 0xD7, 0x47, 0x61, 0x65, 0x69,
-    0x6E, 0x6F, 0x75, 0x79, 0xFF, 0xE5, 0xE5, 0x96, 0xFF, 0xEC, 0xEA, 0xD8, 0xFE, 0x5C, 0xFF, 0xF9,
-    0xEC, 0xC4, 0xC1, 0x07, 0x42, 0x65, 0xE5, 0x80, 0xC1, 0x00, 0xD1, 0x6C, 0xEA, 0xBC, 0x43, 0x66,
-    0x67, 0x73, 0xEB, 0x29, 0xEC, 0x4C, 0xEB, 0x22, 0x43, 0x65, 0x68, 0x79, 0xE3, 0xE2, 0xEA, 0xE3,
-    0xEA, 0xA4, 0xC7, 0x02, 0x81, 0x63, 0x64, 0x67, 0x6D, 0x6E, 0x72, 0x74, 0xEA, 0x9A, 0xEA, 0xA2,
-    0xFF, 0xE6, 0xFC, 0xD4, 0xFF, 0xEC, 0xE8, 0xC3, 0xFF, 0xF6, 0xC1, 0x01, 0x41, 0x69, 0xEA, 0x8A,
-    0x21, 0x64, 0xFA, 0xA1, 0x02, 0xB1, 0x75, 0xFD, 0x41, 0x6E, 0xE3, 0xA0, 0x42, 0x69, 0x6C, 0xFF,
-    0xFC, 0xF4, 0x39, 0x41, 0x64, 0xE3, 0x8F, 0x41, 0x69, 0xEC, 0x3D, 0x41, 0x61, 0xE8, 0xD6, 0xC6,
-    0x02, 0xB1, 0x2E, 0x63, 0x6E, 0x74, 0x77, 0x78, 0xEB, 0x7A, 0xEB, 0x7A, 0xFF, 0xF4, 0xFF, 0xF8,
-    0xEB, 0x7A, 0xFF, 0xFC, 0x41, 0x72, 0xEC, 0x87, 0x48, 0x61, 0x62, 0x63, 0x64, 0x67, 0x6E, 0x72,
-    0x73, 0xEA, 0xBF, 0xFF, 0xFC, 0xEC, 0x38, 0xEB, 0x61, 0xEA, 0xFF, 0xEA, 0x44, 0xED, 0x1E, 0xEB,
-    0xE2, 0x42, 0x2E, 0x61, 0xEC, 0x50, 0xEA, 0x6A, 0x41, 0x67, 0xFD, 0x70, 0xC1, 0x02, 0x11, 0x68,
-    0xEA, 0x28, 0xA0, 0x08, 0xF2, 0x41, 0x73, 0xE9, 0xA3, 0x21, 0x69, 0xFC, 0xCA, 0x02, 0x81, 0x62,
-    0x63, 0x65, 0x67, 0x6D, 0x6E, 0x6F, 0x73, 0x76, 0x74, 0xFC, 0x71, 0xFF, 0xE5, 0xED, 0xDD, 0xF0,
-    0x96, 0xEA, 0x10, 0xFF, 0xEC, 0xEA, 0x8B, 0xFF, 0xF0, 0xFF, 0xF6, 0xFF, 0xFD, 0xC1, 0x01, 0x91,
-    0x62, 0xEA, 0x84, 0x42, 0x61, 0x6F, 0xFF, 0xFA, 0xE3, 0x0F, 0x44, 0x63, 0x67, 0x70, 0x61, 0xE9,
-    0xE2, 0xE9, 0xEA, 0xEF, 0x7B, 0xEB, 0x80, 0x41, 0x68, 0xED, 0x06, 0x42, 0x64, 0x67, 0xE9, 0xD1,
-    0xE9, 0xD9, 0x49, 0x61, 0x65, 0x66, 0x69, 0x6C, 0x6F, 0x73, 0x74, 0x75, 0xFF, 0x6D, 0xFF, 0x86,
-    0xEC, 0xFB, 0xFF, 0xBA, 0xFF, 0xE1, 0xFF, 0xE8, 0xFF, 0xF5, 0xF3, 0x93, 0xFF, 0xF9, 0xC1, 0x01,
-    0x71, 0x61, 0xE9, 0xB6, 0x43, 0x63, 0x67, 0x6E, 0xEA, 0xC5, 0xEA, 0xC5, 0xFF, 0xFA, 0xC2, 0x02,
-    0xB1, 0x6C, 0x74, 0xE9, 0xFB, 0xEA, 0xBB, 0xC2, 0x09, 0x12, 0x65, 0x69, 0xE9, 0x9D, 0xEC, 0x76,
-    0xC2, 0x01, 0x41, 0x68, 0x73, 0xE9, 0x94, 0xE9, 0x8C, 0x46, 0x63, 0x65, 0x67, 0x6E, 0x73, 0x7A,
-    0xEA, 0x3E, 0xE2, 0xAF, 0xFF, 0x3B, 0xFF, 0xEE, 0xFF, 0xF7, 0xE9, 0xC2, 0x41, 0x6F, 0xE2, 0xC3,
-    0x21, 0x69, 0xFC, 0x42, 0x67, 0x6E, 0xE2, 0x95, 0xFF, 0xFD, 0xC1, 0x01, 0x41, 0x61, 0xE9, 0x6A,
-    0x42, 0x6C, 0x6E, 0xFF, 0xFA, 0xE2, 0x9A, 0x49, 0x61, 0x62, 0x65, 0x69, 0x6E, 0x6F, 0x70, 0x75,
-    0x79, 0xFF, 0xAD, 0xE9, 0x5D, 0xFF, 0xB7, 0xFF, 0xD2, 0xEC, 0x72, 0xFF, 0xEC, 0xEA, 0x90, 0xFF,
-    0xF9, 0xE9, 0xD0, 0x42, 0x6D, 0x6E, 0xEC, 0xF1, 0xFC, 0xD3, 0x41, 0x65, 0xE3, 0xF8, 0x21, 0x68,
-    0xFC, 0x42, 0x63, 0x78, 0xE9, 0x6A, 0xE9, 0x97, 0x21, 0x69, 0xF9, 0x42, 0x69, 0x74, 0xE9, 0x29,
-    0xE9, 0x29, 0x47, 0x61, 0x65, 0x6D, 0x72, 0x73, 0x74, 0x77, 0xE9, 0x1A, 0xE9, 0x1A, 0xE9, 0x59,
-    0xEC, 0xD2, 0xFF, 0xF9, 0xF1, 0xAB, 0xE9, 0x95, 0x48, 0x63, 0x65, 0x6C, 0x6F, 0x73, 0x74, 0x75,
-    0x7A, 0xED, 0x2E, 0xE9, 0x04, 0xE9, 0x04, 0xE9, 0x7F, 0xEB, 0xF3, 0xE9, 0x43, 0xE9, 0x04, 0xEA,
-    0xF8, 0xC3, 0x01, 0x91, 0x67, 0x73, 0x76, 0xE2, 0x17, 0xEA, 0x08, 0xE9, 0x2A, 0x41, 0x67, 0xE6,
-    0x28, 0x41, 0x73, 0xE8, 0xD8, 0x21, 0x65, 0xFC, 0x22, 0x61, 0x68, 0xF5, 0xFD, 0x42, 0x61, 0x66,
-    0xE9, 0x0E, 0xE8, 0xD7, 0x4C, 0x61, 0x63, 0x64, 0x65, 0x69, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0x79,
-    0x7A, 0xFF, 0x8F, 0xFF, 0x9A, 0xFF, 0xA4, 0xFF, 0xAE, 0xFF, 0xC4, 0xE8, 0xC5, 0xFF, 0xDD, 0xEB,
-    0x75, 0xFF, 0xF4, 0xFF, 0xF9, 0xEA, 0x3F, 0xF4, 0x62, 0x41, 0x70, 0xE8, 0xE2, 0x21, 0x61, 0xFC,
-    0xA1, 0x02, 0x81, 0x72, 0xFD, 0xA0, 0x09, 0x32, 0x41, 0x61, 0xE4, 0x60, 0xC2, 0x02, 0xB1, 0x65,
-    0x6F, 0xE8, 0xCF, 0xE9, 0xB7, 0xC1, 0x01, 0x41, 0x6F, 0xE9, 0x1C, 0x4A, 0x66, 0x67, 0x69, 0x6C,
-    0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0xE8, 0x81, 0xFF, 0xE5, 0xFF, 0xEA, 0xE8, 0xFC, 0xFF, 0xED,
-    0xFF, 0xF1, 0xE1, 0xAD, 0xFF, 0xFA, 0xE8, 0xF5, 0xE8, 0x81, 0xC2, 0x02, 0x11, 0x69, 0x6E, 0xE8,
-    0xDD, 0xEA, 0x7F, 0x41, 0x69, 0xEC, 0x11, 0x21, 0x74, 0xFC, 0x21, 0x69, 0xFD, 0x43, 0x6C, 0x6E,
-    0x74, 0xE8, 0x4F, 0xEC, 0xFE, 0xFF, 0xFD, 0x43, 0x63, 0x64, 0x68, 0xFE, 0xE3, 0xE9, 0x62, 0xE8,
-    0x84, 0xC1, 0x02, 0x21, 0x62, 0xE9, 0x58, 0x22, 0x65, 0x6F, 0xF0, 0xFA, 0x41, 0x69, 0xE8, 0x46,
-    0x41, 0x74, 0xFE, 0xCA, 0xA0, 0x18, 0x55, 0x21, 0x68, 0xFD, 0x21, 0x70, 0xFD, 0x21, 0x65, 0xFD,
-    0x21, 0x6E, 0xFD, 0x4A, 0x61, 0x65, 0x68, 0x6C, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x69, 0xFF, 0xB7,
-    0xFF, 0xCA, 0xE1, 0xDC, 0xE9, 0xCF, 0xE9, 0xB7, 0xFF, 0xE4, 0xED, 0x54, 0xFF, 0xE9, 0xFF, 0xED,
-    0xFF, 0xFD, 0xA0, 0x09, 0x53, 0x42, 0x6C, 0x73, 0xE2, 0xB2, 0xFF, 0xFD, 0x21, 0x69, 0xF9, 0xA1,
-    0x02, 0xB1, 0x75, 0xFD, 0x41, 0x64, 0xE7, 0xE5, 0x41, 0x69, 0xF7, 0x55, 0xC4, 0x01, 0xF1, 0x62,
-    0x6E, 0x72, 0x74, 0xE1, 0x0C, 0xFF, 0xF8, 0xE8, 0x1F, 0xFF, 0xFC, 0xC1, 0x02, 0x41, 0x6C, 0xE8,
-    0x66, 0xC1, 0x01, 0xE1, 0x65, 0xE8, 0x60, 0x21, 0x68, 0xFA, 0x41, 0x6C, 0xE8, 0x3D, 0x44, 0x61,
-    0x63, 0x65, 0x74, 0xE7, 0xC6, 0xEC, 0x40, 0xE7, 0xBB, 0xE7, 0xFD, 0x42, 0x73, 0x74, 0xE7, 0xB9,
-    0xE7, 0xF0, 0x4A, 0x2E, 0x61, 0x63, 0x69, 0x6C, 0x6D, 0x6E, 0x71, 0x73, 0x74, 0xEF, 0xFE, 0xFF,
-    0xE8, 0xE1, 0x81, 0xF2, 0x21, 0xE8, 0x5E, 0xED, 0x2A, 0xFF, 0xEC, 0xE0, 0xD6, 0xFF, 0xF9, 0xE0,
-    0xD0, 0xA0, 0x18, 0xA3, 0x21, 0x2E, 0xFD, 0xA1, 0x09, 0x82, 0x6E, 0xFD, 0x41, 0x6B, 0xE9, 0x74,
-    0x42, 0x6E, 0x72, 0xE7, 0xF7, 0xE0, 0xA8, 0xC1, 0x00, 0x51, 0x61, 0xE8, 0x92, 0xC8, 0x01, 0xF1,
-    0x61, 0x63, 0x65, 0x6E, 0x6F, 0x74, 0x75, 0x76, 0xFF, 0xEA, 0xFF, 0xEF, 0xFF, 0xF3, 0xE9, 0xEF,
-    0xE9, 0x0D, 0xE7, 0x6C, 0xE8, 0x04, 0xFF, 0xFA, 0xA0, 0x07, 0xE2, 0x43, 0x73, 0x74, 0x7A, 0xE7,
-    0xE6, 0xE7, 0x4E, 0xE9, 0x45, 0x42, 0x69, 0x6F, 0xFF, 0xF6, 0xE7, 0x86, 0xC4, 0x02, 0x41, 0x62,
-    0x63, 0x72, 0x75, 0xE7, 0x48, 0xE7, 0x40, 0xE0, 0x6C, 0xE7, 0xAC, 0xC1, 0x01, 0xF1, 0x65, 0xEB,
-    0x57, 0x43, 0x65, 0x6C, 0x77, 0xE2, 0xF7, 0xE7, 0x28, 0xE7, 0x6A, 0xC1, 0x01, 0x91, 0x74, 0xE0,
-    0x4D, 0x41, 0x75, 0xE9, 0x0F, 0x21, 0x61, 0xFC, 0x4D, 0x61, 0x62, 0x63, 0x65, 0x68, 0x69, 0x6D,
-    0x6E, 0x6F, 0x73, 0x74, 0x75, 0x77, 0xFF, 0x34, 0xFF, 0x43, 0xFF, 0x4F, 0xFF, 0x6A, 0xE7, 0x80,
-    0xFF, 0xA5, 0xFF, 0xC0, 0xFF, 0xCD, 0xFF, 0xD4, 0xFF, 0xE3, 0xFF, 0xE9, 0xFF, 0xF3, 0xFF, 0xFD,
-    0x41, 0x65, 0xFA, 0x78, 0xA1, 0x07, 0x42, 0x67, 0xFC, 0xC1, 0x02, 0x11, 0x6E, 0xE6, 0xEB, 0xC3,
-    0x02, 0x81, 0x61, 0x72, 0x75, 0xFF, 0xFA, 0xE7, 0x58, 0xE6, 0xE5, 0xC1, 0x02, 0x11, 0x72, 0xE6,
-    0xD9, 0x41, 0x61, 0xE7, 0xE8, 0x42, 0x74, 0x76, 0xFA, 0x53, 0xFF, 0xFC, 0xC3, 0x07, 0x82, 0x63,
-    0x6E, 0x72, 0xFF, 0xEF, 0xE8, 0xDD, 0xFF, 0xF9, 0xC2, 0x01, 0x91, 0x61, 0x65, 0xE7, 0x2F, 0xE2,
-    0xB1, 0xC1, 0x02, 0x11, 0x65, 0xE7, 0x86, 0x41, 0x6E, 0xE8, 0xE4, 0xA0, 0x09, 0x42, 0x41, 0x74,
-    0xE0, 0x61, 0xC7, 0x02, 0xB1, 0x63, 0x64, 0x67, 0x6D, 0x6E, 0x73, 0x75, 0xE6, 0xF7, 0xFF, 0xEF,
-    0xFF, 0xF5, 0xF5, 0xC2, 0xFF, 0xF9, 0xFF, 0xFC, 0xDF, 0xC6, 0x41, 0x6E, 0xE6, 0x82, 0x21, 0x69,
-    0xFC, 0xC1, 0x02, 0x11, 0x75, 0xE6, 0xBA, 0xC1, 0x02, 0x11, 0x61, 0xE6, 0x7D, 0x22, 0x6C, 0x6E,
-    0xF4, 0xFA, 0xA0, 0x18, 0xD2, 0x21, 0x69, 0xFD, 0x21, 0x63, 0xFD, 0xC4, 0x02, 0xB1, 0x65, 0x69,
-    0x72, 0x61, 0xEE, 0xF2, 0xFC, 0x19, 0xE7, 0x35, 0xFF, 0xFD, 0xA0, 0x03, 0xA2, 0x21, 0x62, 0xFD,
-    0xA1, 0x02, 0x41, 0x69, 0xFD, 0x42, 0x67, 0x6D, 0xE6, 0x86, 0xE6, 0x4F, 0xC1, 0x04, 0x22, 0x6E,
-    0xE6, 0xBB, 0x41, 0x63, 0xDF, 0xB0, 0xC2, 0x02, 0x41, 0x6F, 0x75, 0xE6, 0x36, 0xFF, 0xFC, 0x44,
-    0x61, 0x69, 0x6F, 0x72, 0xF5, 0x74, 0xFF, 0xE6, 0xFF, 0xED, 0xFF, 0xF7, 0x41, 0x72, 0xFF, 0x4F,
-    0x4D, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6B, 0x6D, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x77, 0xFF, 0x34,
-    0xFF, 0x3F, 0xFF, 0x5C, 0xFF, 0x68, 0xFF, 0x82, 0xFF, 0x9E, 0xE9, 0x2E, 0xFF, 0xAD, 0xFF, 0xBB,
-    0xFF, 0xD0, 0xFF, 0xEF, 0xFF, 0xFC, 0xE6, 0xB1, 0x41, 0x62, 0xDF, 0x20, 0x42, 0x6E, 0x6F, 0xFB,
-    0x87, 0xE6, 0x6B, 0xA0, 0x18, 0xF3, 0x21, 0x65, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21,
-    0x6C, 0xFD, 0x42, 0x6F, 0x79, 0xEF, 0x4E, 0xFF, 0xFD, 0xC1, 0x00, 0x41, 0x6F, 0xDE, 0xFF, 0x41,
-    0x69, 0xEA, 0x0D, 0x45, 0x63, 0x64, 0x6E, 0x72, 0x74, 0xE6, 0x35, 0xE8, 0xB4, 0xFF, 0xF6, 0xE5,
-    0xC9, 0xFF, 0xFC, 0x42, 0x63, 0x66, 0xE5, 0xF8, 0xE5, 0xC1, 0x42, 0x67, 0x73, 0xE5, 0xF1, 0xE5,
-    0xBA, 0x44, 0x61, 0x65, 0x69, 0x6F, 0xE6, 0x26, 0xE6, 0x26, 0xFF, 0xF2, 0xFF, 0xF9, 0x4A, 0x61,
-    0x65, 0x68, 0x69, 0x6E, 0x6F, 0x72, 0x75, 0x79, 0x7A, 0xFF, 0xAA, 0xFF, 0xAE, 0xFF, 0xC4, 0xFF,
-    0xD5, 0xE5, 0x9B, 0xFE, 0xF9, 0xFF, 0xF3, 0xE6, 0x59, 0xF0, 0xF7, 0xE5, 0xA6, 0x43, 0x65, 0x69,
-    0x72, 0xDE, 0xA5, 0xDF, 0x8D, 0xE5, 0x87, 0xA0, 0x19, 0x23, 0x21, 0x64, 0xFD, 0x21, 0x69, 0xFD,
-    0x21, 0x6C, 0xFD, 0xC6, 0x01, 0x91, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x63, 0xE5, 0x69, 0xE5, 0xE4,
-    0xEA, 0xE9, 0xDE, 0x95, 0xFF, 0xEA, 0xFF, 0xFD, 0xA0, 0x09, 0xC2, 0xC1, 0x02, 0x11, 0x74, 0xE5,
-    0x59, 0x22, 0x70, 0x73, 0xF7, 0xFA, 0x42, 0x6C, 0x6F, 0xE5, 0x85, 0xE0, 0x01, 0x42, 0x67, 0x69,
-    0xE5, 0x3F, 0xDE, 0x65, 0xC1, 0x01, 0xF1, 0x62, 0xE5, 0x38, 0x44, 0x61, 0x6C, 0x6E, 0x72, 0xE5,
-    0x32, 0xFF, 0xEC, 0xFF, 0xF3, 0xFF, 0xFA, 0xC4, 0x02, 0xB1, 0x64, 0x6C, 0x6E, 0x76, 0xE5, 0x64,
-    0xDE, 0x51, 0xE6, 0x42, 0xDE, 0x51, 0x41, 0x63, 0xE5, 0x16, 0x45, 0x61, 0x65, 0x69, 0x6F, 0x75,
-    0xFF, 0xC7, 0xFF, 0xE0, 0xFF, 0xED, 0xFF, 0xFC, 0xE5, 0x12, 0xC1, 0x02, 0xB1, 0x67, 0xE6, 0x1F,
-    0x41, 0x67, 0xE5, 0x3B, 0x43, 0x6C, 0x6E, 0x74, 0xDE, 0x45, 0xFF, 0xFC, 0xE5, 0x73, 0x44, 0x61,
-    0x65, 0x68, 0x69, 0xFF, 0xEC, 0xE7, 0xD9, 0xE5, 0x69, 0xFF, 0xF6, 0x41, 0x70, 0xF3, 0x76, 0x43,
-    0x63, 0x65, 0x73, 0xE6, 0xD1, 0xF1, 0x07, 0xDE, 0x09, 0x59, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
-    0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
-    0x77, 0x78, 0x79, 0xF8, 0x3D, 0xF8, 0x71, 0xF8, 0xF7, 0xF9, 0x55, 0xF9, 0x7E, 0xF9, 0xD6, 0xFA,
-    0x03, 0xFA, 0x19, 0xFA, 0x39, 0xFA, 0x5A, 0xFA, 0x63, 0xFB, 0x09, 0xFB, 0x7E, 0xFC, 0x0B, 0xFC,
-    0x52, 0xFC, 0xBA, 0xFC, 0xE6, 0xFD, 0xBF, 0xFE, 0xB7, 0xFF, 0x35, 0xFF, 0x6A, 0xFF, 0xC1, 0xFF,
-    0xE5, 0xFF, 0xF2, 0xFF, 0xF6, 0x42, 0x6C, 0x72, 0xE4, 0xC6, 0xDD, 0xC5, 0x41, 0x6C, 0xDF, 0x7E,
-    0x42, 0x61, 0x69, 0xE5, 0xB1, 0xE8, 0x7E, 0x41, 0x68, 0xDD, 0xB9, 0xA1, 0x02, 0xE1, 0x74, 0xFC,
-    0x43, 0x61, 0x68, 0x6F, 0xE4, 0xAB, 0xE6, 0xEC, 0xE4, 0x69, 0x41, 0x6C, 0xE3, 0x71, 0xC9, 0x03,
-    0xD1, 0x62, 0x63, 0x67, 0x69, 0x6C, 0x6D, 0x72, 0x74, 0x75, 0xFF, 0xD7, 0xE5, 0x32, 0xE4, 0x5B,
-    0xDD, 0xF4, 0xFF, 0xDE, 0xFF, 0xE2, 0xFF, 0xED, 0xFF, 0xF2, 0xFF, 0xFC, 0x42, 0x73, 0x74, 0xDD,
-    0x66, 0xED, 0xDE, 0x41, 0x75, 0xEB, 0x9F, 0xA1, 0x02, 0x31, 0x72, 0xFC, 0x42, 0x61, 0x74, 0xE4,
-    0x2D, 0xE6, 0x24, 0xC1, 0x00, 0xD1, 0x65, 0xDD, 0x76, 0x21, 0x64, 0xFA, 0x41, 0x69, 0xE2, 0xB2,
-    0xC2, 0x00, 0x61, 0x72, 0x6D, 0xE6, 0x10, 0xFF, 0xFC, 0x4A, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x6C,
-    0x6D, 0x6E, 0x72, 0x76, 0xE4, 0x10, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xE3, 0xEC, 0x67, 0xE5, 0x4E,
-    0xE7, 0x47, 0xFF, 0xF0, 0xFF, 0xF7, 0xDD, 0x3F, 0x43, 0x65, 0x6E, 0x73, 0xE5, 0x11, 0xE5, 0xD9,
-    0xF3, 0x1C, 0x41, 0x79, 0xE5, 0x07, 0xC4, 0x04, 0x02, 0x65, 0x69, 0x6C, 0x79, 0xE6, 0x07, 0xFF,
-    0xF2, 0xFF, 0xFC, 0xE4, 0x43, 0x41, 0x65, 0xE3, 0xD4, 0x43, 0x6C, 0x6E, 0x74, 0xEC, 0x2A, 0xE4,
-    0x4E, 0xFF, 0xFC, 0x42, 0x6E, 0x72, 0xE4, 0x44, 0xE4, 0x08, 0xC2, 0x00, 0x51, 0x61, 0x65, 0xE5,
-    0xB6, 0xE5, 0xB6, 0x47, 0x2E, 0x61, 0x65, 0x69, 0x73, 0x75, 0x68, 0xEC, 0x27, 0xFF, 0xE6, 0xFF,
-    0xF0, 0xFF, 0xF7, 0xE3, 0xB6, 0xE3, 0xF8, 0xE4, 0xF1, 0x41, 0x65, 0xE4, 0xCA, 0x41, 0x68, 0xE2,
-    0xAE, 0x41, 0x69, 0xE1, 0x2A, 0x43, 0x69, 0x6C, 0x79, 0xDC, 0xDB, 0xFF, 0xFC, 0xE3, 0x94, 0xA0,
-    0x09, 0xE2, 0xC5, 0x02, 0x41, 0x61, 0x64, 0x65, 0x67, 0x6E, 0xE5, 0x7E, 0xFE, 0x36, 0xE6, 0xBB,
-    0xFF, 0xFD, 0xDC, 0xB6, 0x41, 0x74, 0xDD, 0x0A, 0x41, 0x2E, 0xDC, 0xB8, 0x21, 0x64, 0xFC, 0x21,
-    0x65, 0xFD, 0x21, 0x74, 0xFD, 0xC8, 0x03, 0xD1, 0x61, 0x63, 0x64, 0x67, 0x6C, 0x6E, 0x73, 0x74,
-    0xE3, 0xA6, 0xFF, 0xAE, 0xFF, 0xC4, 0xFF, 0xC8, 0xFF, 0xD0, 0xFF, 0xDD, 0xFF, 0xEF, 0xFF, 0xFD,
-    0x41, 0x73, 0xE7, 0xDC, 0x42, 0x72, 0x77, 0xE2, 0x82, 0xEA, 0xED, 0xA0, 0x03, 0x52, 0xA0, 0x18,
-    0xF2, 0x21, 0x6C, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x67, 0xFD, 0x41, 0x72, 0xE4, 0x6A, 0x21, 0x6F,
-    0xFC, 0xC6, 0x0A, 0x02, 0x65, 0x69, 0x6F, 0x79, 0x61, 0x75, 0xFF, 0xDF, 0xDC, 0xC1, 0xFF, 0xE3,
-    0xFF, 0xEA, 0xFF, 0xF6, 0xFF, 0xFD, 0xC2, 0x02, 0xE1, 0x64, 0x74, 0xDC, 0x7F, 0xDC, 0x42, 0x42,
-    0x74, 0x79, 0xE3, 0x15, 0xDC, 0x51, 0xC4, 0x02, 0x81, 0x61, 0x65, 0x69, 0x74, 0xFF, 0xF9, 0xE1,
-    0x1D, 0xDC, 0x32, 0xDF, 0x9F, 0xC3, 0x03, 0xD1, 0x6E, 0x72, 0x73, 0xFF, 0xE1, 0xFF, 0xF1, 0xDC,
-    0x3B, 0x42, 0x61, 0x73, 0xE2, 0xEB, 0xDC, 0xEE, 0xC1, 0x00, 0xD1, 0x6C, 0xDC, 0x0A, 0x44, 0x61,
-    0x65, 0x69, 0x6F, 0xDD, 0x73, 0xFF, 0xF3, 0xFF, 0xFA, 0xDC, 0xEC, 0xC2, 0x02, 0x41, 0x6F, 0x79,
-    0xE3, 0xEE, 0xE3, 0x2E, 0x42, 0x69, 0x73, 0xDB, 0xEE, 0xDB, 0xF4, 0x41, 0x61, 0xE2, 0xBE, 0xC7,
-    0x02, 0x71, 0x65, 0x67, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0xE3, 0xE4, 0xE2, 0xBA, 0xE3, 0x6E, 0xE7,
-    0x3F, 0xE3, 0xF8, 0xFF, 0xF5, 0xFF, 0xFC, 0x51, 0x61, 0x62, 0x64, 0x65, 0x66, 0x68, 0x69, 0x6C,
-    0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x79, 0xFE, 0x47, 0xEC, 0xD2, 0xE2, 0xA2, 0xFE,
-    0x92, 0xFE, 0xBF, 0xE2, 0xA2, 0xFF, 0x3E, 0xFF, 0x7A, 0xE2, 0xA2, 0xE2, 0xA2, 0xFF, 0xAE, 0xEC,
-    0xD2, 0xFF, 0xC7, 0xEB, 0x13, 0xFF, 0xD4, 0xFF, 0xE8, 0xF1, 0x3A, 0x43, 0x2E, 0x69, 0x6F, 0xE4,
-    0x65, 0xE3, 0xA9, 0xE2, 0xB0, 0xC2, 0x02, 0x41, 0x65, 0x6F, 0xE2, 0x8A, 0xE2, 0x67, 0xC1, 0x01,
-    0xE1, 0x61, 0xDB, 0xAB, 0x42, 0x73, 0x7A, 0xDB, 0x9C, 0xFF, 0xFA, 0x42, 0x69, 0x6F, 0xFF, 0xF9,
-    0xE2, 0x4E, 0x41, 0x6E, 0xF0, 0x92, 0x42, 0x68, 0x69, 0xDD, 0x01, 0xED, 0x1F, 0xC8, 0x03, 0xD1,
-    0x66, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x7A, 0xDB, 0x6B, 0xFF, 0xCE, 0xFF, 0xD8, 0xFF, 0xEE,
-    0xFF, 0xF5, 0xE4, 0xE4, 0xFF, 0xF9, 0xE2, 0x3C, 0x41, 0x7A, 0xDB, 0x4A, 0x43, 0x6E, 0x73, 0x7A,
-    0xDB, 0x4C, 0xE2, 0x28, 0xE2, 0x28, 0x42, 0x69, 0x79, 0xFF, 0xF6, 0xE2, 0x13, 0x41, 0x74, 0xE2,
-    0xA4, 0x41, 0x79, 0xEC, 0x04, 0xC5, 0x03, 0xD1, 0x61, 0x69, 0x6F, 0x79, 0x63, 0xFF, 0xF8, 0xE8,
-    0x08, 0xE2, 0x04, 0xE2, 0x04, 0xFF, 0xFC, 0xA0, 0x09, 0x72, 0xC2, 0x03, 0xD1, 0x6D, 0x64, 0xE2,
-    0x31, 0xFF, 0xFD, 0x41, 0x63, 0xEB, 0xE2, 0x44, 0x68, 0x6F, 0x79, 0x69, 0xDB, 0x32, 0xE1, 0xE2,
-    0xE2, 0x7A, 0xFF, 0xFC, 0x4A, 0x2E, 0x64, 0x65, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x76, 0xEA,
-    0x2C, 0xEA, 0x2C, 0xFF, 0xB4, 0xFF, 0xC2, 0xFF, 0xD1, 0xFF, 0xE6, 0xFD, 0xEE, 0xF3, 0xE7, 0xFF,
-    0xF3, 0xE2, 0x6D, 0xC3, 0x0A, 0x23, 0x65, 0x6C, 0x6F, 0xE9, 0x83, 0xDF, 0xC5, 0xDA, 0xE5, 0x41,
-    0x75, 0xE1, 0xD0, 0x41, 0x65, 0xDA, 0xE1, 0x42, 0x6F, 0x77, 0xE2, 0x3A, 0xFF, 0xFC, 0x43, 0x69,
-    0x6F, 0x74, 0xE6, 0xDD, 0xFF, 0xF1, 0xFF, 0xF9, 0xC1, 0x0A, 0x52, 0x72, 0xDA, 0xD8, 0x41, 0x61,
-    0xE3, 0x82, 0xC2, 0x02, 0xB1, 0x69, 0x6F, 0xFF, 0xFC, 0xE2, 0xA7, 0x42, 0x6E, 0x73, 0xDA, 0xCE,
-    0xED, 0xAB, 0x41, 0x6E, 0xE1, 0xF5, 0x21, 0x65, 0xFC, 0xA0, 0x06, 0xB2, 0xA0, 0x0A, 0x72, 0x43,
-    0x2E, 0x67, 0x73, 0xFF, 0xFA, 0xDE, 0xB6, 0xFF, 0xFD, 0xC1, 0x02, 0x71, 0x6C, 0xDA, 0x8F, 0x4D,
-    0x2E, 0x61, 0x63, 0x65, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x75, 0x76, 0x7A, 0xE3, 0x51, 0xFF,
-    0xC9, 0xFF, 0xD3, 0xFF, 0xDC, 0xDA, 0x89, 0xFF, 0xE7, 0xFF, 0xF0, 0xE3, 0x51, 0xFF, 0xFA, 0xF9,
-    0x9B, 0xE1, 0xF2, 0xE3, 0x51, 0xE2, 0x95, 0xC2, 0x00, 0x51, 0x64, 0x73, 0xDD, 0xD2, 0xE3, 0x29,
-    0x41, 0x64, 0xE2, 0xCA, 0xA1, 0x03, 0xD1, 0x61, 0xFC, 0x41, 0x68, 0xE9, 0x01, 0x43, 0x62, 0x67,
-    0x73, 0xDA, 0x4B, 0xE1, 0x9A, 0xFF, 0xFC, 0xA0, 0x0A, 0xF2, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD,
-    0xC2, 0x02, 0x71, 0x72, 0x62, 0xDA, 0x4A, 0xFF, 0xFD, 0xA4, 0x02, 0x81, 0x61, 0x65, 0x69, 0x6F,
-    0xCE, 0xDB, 0xE4, 0xF7, 0xC1, 0x02, 0xB1, 0x79, 0xE2, 0x15, 0xA0, 0x06, 0xD2, 0xC2, 0x02, 0x31,
-    0x2E, 0x63, 0xE2, 0x0C, 0xFF, 0xFD, 0x41, 0x73, 0xDE, 0x83, 0x42, 0x74, 0x69, 0xDA, 0x08, 0xFF,
-    0xFC, 0x21, 0x74, 0xF9, 0xC2, 0x02, 0xB1, 0x6E, 0x6F, 0xE1, 0x35, 0xE1, 0xF5, 0xA0, 0x07, 0x32,
-    0x41, 0x70, 0xE1, 0x29, 0x21, 0x73, 0xFC, 0x22, 0x2E, 0x65, 0xF6, 0xFD, 0xC3, 0x02, 0xB1, 0x6E,
-    0x6D, 0x72, 0xE1, 0xDD, 0xDA, 0x97, 0xFF, 0xFB, 0x24, 0x61, 0x65, 0x69, 0x6F, 0xC5, 0xD9, 0xDC,
-    0xF4, 0xA0, 0x0A, 0x93, 0xA0, 0x0A, 0xC3, 0xA0, 0x19, 0x55, 0x21, 0x61, 0xFD, 0xA1, 0x01, 0xE1,
-    0x7A, 0xFD, 0xC3, 0x00, 0xD1, 0x61, 0x64, 0x69, 0xFF, 0xF2, 0xF7, 0x2A, 0xFF, 0xFB, 0x41, 0x75,
-    0xD9, 0xD2, 0x42, 0x69, 0x6F, 0xE6, 0x8B, 0xFF, 0xFC, 0xCA, 0x03, 0xD1, 0x2E, 0x62, 0x65, 0x67,
-    0x69, 0x6E, 0x6F, 0x72, 0x73, 0x76, 0xE1, 0xBB, 0xD9, 0xC7, 0xE2, 0x77, 0xFF, 0xD8, 0xE3, 0x2C,
-    0xFF, 0xE9, 0xE2, 0x77, 0xFF, 0xF9, 0xEC, 0xAD, 0xD9, 0xBB, 0xC1, 0x01, 0x71, 0x2E, 0xD9, 0xB5,
-    0x21, 0x72, 0xFA, 0x44, 0x2E, 0x65, 0x69, 0x79, 0xE2, 0x4D, 0xFF, 0xFD, 0xED, 0xC9, 0xE0, 0x56,
-    0x21, 0x68, 0xF3, 0x45, 0x64, 0x69, 0x6E, 0x70, 0x79, 0xFD, 0x88, 0xE1, 0x66, 0xDA, 0x30, 0xFF,
-    0xFD, 0xE0, 0x46, 0x41, 0x73, 0xEF, 0xAA, 0x42, 0x6E, 0x73, 0xD9, 0x61, 0xFF, 0xFC, 0x41, 0x76,
-    0xDD, 0xD9, 0x42, 0x74, 0x65, 0xE0, 0x27, 0xFF, 0xFC, 0x41, 0x66, 0xD9, 0x49, 0xC5, 0x03, 0xD1,
-    0x61, 0x65, 0x69, 0x6F, 0x75, 0xFF, 0xD6, 0xFF, 0xEA, 0xFF, 0xF5, 0xE1, 0x3C, 0xFF, 0xFC, 0xC1,
-    0x02, 0x81, 0x74, 0xE2, 0xF8, 0x41, 0x68, 0xD9, 0x45, 0x41, 0x64, 0xE1, 0x3B, 0xA1, 0x02, 0x31,
-    0x72, 0xFC, 0x41, 0x74, 0xFE, 0xE5, 0x41, 0x6E, 0xE1, 0x94, 0xA1, 0x02, 0x52, 0x61, 0xFC, 0x46,
-    0x61, 0x65, 0x69, 0x6E, 0x73, 0x74, 0xFF, 0xEE, 0xE8, 0x41, 0xFF, 0xF3, 0xE1, 0x25, 0xE1, 0x25,
-    0xFF, 0xFB, 0xA0, 0x0B, 0x13, 0xC2, 0x03, 0xD1, 0x6E, 0x72, 0xFF, 0xFD, 0xE2, 0x16, 0x52, 0x61,
-    0x62, 0x64, 0x65, 0x67, 0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77,
-    0x79, 0xFD, 0x8F, 0xE0, 0x49, 0xE0, 0x63, 0xFD, 0xF6, 0xFE, 0x15, 0xFE, 0x30, 0xFE, 0x71, 0xFE,
-    0xCB, 0xFE, 0xD6, 0xFF, 0x1A, 0xFF, 0x4B, 0xE0, 0x49, 0xFF, 0xAF, 0xFF, 0xC1, 0xFF, 0xC7, 0xFF,
-    0xE1, 0xE0, 0x49, 0xFF, 0xF7, 0x41, 0x6C, 0xEF, 0xF9, 0x42, 0x6D, 0x74, 0xD8, 0xBF, 0xD8, 0xBF,
-    0xC1, 0x01, 0xE1, 0x6D, 0xDA, 0x47, 0x21, 0x61, 0xFA, 0x42, 0x69, 0x79, 0xD8, 0xAF, 0xD8, 0xAF,
-    0xC2, 0x00, 0x51, 0x65, 0x6F, 0xD9, 0xB7, 0xD8, 0xC9, 0xA0, 0x0B, 0x42, 0x21, 0x7A, 0xFD, 0x46,
-    0x63, 0x64, 0x67, 0x69, 0x6B, 0x74, 0xFF, 0xEA, 0xEB, 0x97, 0xFF, 0xF1, 0xFF, 0xFD, 0xD8, 0x99,
-    0xD8, 0xD6, 0xA0, 0x19, 0xA3, 0x21, 0x72, 0xFD, 0x21, 0x72, 0xFD, 0x43, 0x6C, 0x74, 0x61, 0xD8,
-    0x8F, 0xD8, 0x95, 0xFF, 0xFD, 0x42, 0x6E, 0x73, 0xDF, 0x86, 0xDF, 0x4F, 0x41, 0x65, 0xDC, 0xCF,
-    0x45, 0x61, 0x64, 0x6C, 0x70, 0x74, 0xFF, 0xF5, 0xF2, 0x61, 0xD8, 0xA5, 0xFF, 0xFC, 0xE6, 0x9B,
-    0xC1, 0x02, 0xE1, 0x61, 0xD8, 0x6A, 0x41, 0x73, 0xDB, 0x7A, 0x21, 0x72, 0xFC, 0x41, 0x68, 0xDC,
-    0xCA, 0x21, 0x63, 0xFC, 0x4E, 0x62, 0x63, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x75,
-    0x7A, 0x69, 0x74, 0xFF, 0x81, 0xD8, 0x41, 0xFF, 0x85, 0xDF, 0x80, 0xFF, 0x92, 0xDF, 0xAD, 0xFF,
-    0xAB, 0xFF, 0xC7, 0xFF, 0xDC, 0xE3, 0x1A, 0xD8, 0xAE, 0xFF, 0xEC, 0xFF, 0xF6, 0xFF, 0xFD, 0x42,
-    0x64, 0x72, 0xED, 0x82, 0xE0, 0x25, 0x42, 0x6E, 0x74, 0xDF, 0x7B, 0xDE, 0xE6, 0x21, 0x61, 0xF9,
-    0xC1, 0x01, 0x41, 0x6F, 0xDE, 0xEF, 0x42, 0x69, 0x79, 0xEC, 0xFB, 0xD8, 0x02, 0x43, 0x69, 0x6C,
-    0x6F, 0xF7, 0x7B, 0xFF, 0xF9, 0xDE, 0xCF, 0xC1, 0x00, 0x41, 0x74, 0xD8, 0x09, 0xA1, 0x02, 0x81,
-    0x61, 0xFA, 0xC1, 0x01, 0x41, 0x70, 0xD9, 0x75, 0x46, 0x61, 0x62, 0x65, 0x6E, 0x6F, 0x79, 0xFF,
-    0xFA, 0xD8, 0xD9, 0xDB, 0x4D, 0xDF, 0x2F, 0xDF, 0x1C, 0xDF, 0x2F, 0xC1, 0x02, 0xB1, 0x70, 0xEA,
-    0xBB, 0xC1, 0x02, 0x31, 0x65, 0xDC, 0xC4, 0x41, 0x61, 0xDE, 0x0C, 0x4D, 0x61, 0x63, 0x64, 0x6C,
-    0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x78, 0xFF, 0xA4, 0xFF, 0xB2, 0xFF, 0xB5, 0xFF,
-    0xC2, 0xF0, 0x07, 0xFF, 0xD2, 0xDA, 0xB8, 0xD7, 0xD5, 0xFF, 0xDD, 0xFF, 0xF0, 0xFF, 0xF6, 0xD7,
-    0xBD, 0xFF, 0xFC, 0x41, 0x68, 0xD7, 0xB6, 0xA0, 0x07, 0x12, 0x41, 0x72, 0xDC, 0xD7, 0x21, 0x65,
-    0xFC, 0x41, 0x6E, 0xD8, 0x1E, 0xA0, 0x19, 0xD4, 0x21, 0x61, 0xFD, 0x21, 0x6C, 0xFD, 0xA1, 0x02,
-    0x31, 0x65, 0xFD, 0x44, 0x6C, 0x6F, 0x70, 0x72, 0xD7, 0x75, 0xDE, 0x88, 0xD7, 0x75, 0xD7, 0x75,
-    0x42, 0x65, 0x73, 0xEE, 0x4C, 0xD7, 0x68, 0x41, 0x64, 0xD8, 0xF0, 0x21, 0x69, 0xFC, 0x21, 0x73,
-    0xFD, 0x42, 0x68, 0x65, 0xD8, 0x6F, 0xFF, 0xFD, 0x4C, 0x61, 0x63, 0x67, 0x6C, 0x6D, 0x6E, 0x6F,
-    0x70, 0x72, 0x73, 0x74, 0x76, 0xDE, 0xFF, 0xE1, 0x58, 0xFF, 0xBB, 0xFF, 0xBF, 0xFF, 0xC6, 0xF7,
-    0x59, 0xFF, 0xC9, 0xFF, 0xD6, 0xFF, 0xDB, 0xFF, 0xE8, 0xFF, 0xF9, 0xE1, 0x55, 0xC1, 0x02, 0x11,
-    0x72, 0xDA, 0x0A, 0xC2, 0x08, 0x33, 0x61, 0x6F, 0xD7, 0x8F, 0xFF, 0xFA, 0xC1, 0x04, 0x02, 0x65,
-    0xDB, 0xBB, 0x41, 0x7A, 0xD8, 0xA5, 0x21, 0x75, 0xFC, 0xA1, 0x03, 0xE2, 0x61, 0xFD, 0x41, 0x7A,
-    0xDD, 0xDE, 0x42, 0x69, 0x73, 0xFF, 0xFC, 0xDD, 0xDA, 0xC1, 0x02, 0x31, 0x65, 0xD6, 0xF9, 0xA0,
-    0x0B, 0x62, 0x42, 0x61, 0x65, 0xD9, 0xF1, 0xFF, 0xFD, 0x42, 0x61, 0x65, 0xDE, 0x58, 0xD8, 0x7E,
-    0x42, 0x61, 0x79, 0xD6, 0xE8, 0xDD, 0xC4, 0x42, 0x64, 0x6E, 0xDE, 0xED, 0xD6, 0xDB, 0x41, 0x2E,
-    0xE5, 0x29, 0x42, 0x73, 0x63, 0xDD, 0xB2, 0xFF, 0xFC, 0x44, 0x61, 0x69, 0x74, 0x75, 0xD6, 0xEA,
-    0xFF, 0xF9, 0xDA, 0x94, 0xDD, 0xAB, 0xC1, 0x00, 0x51, 0x6E, 0xDD, 0x9E, 0x42, 0x65, 0x70, 0xFF,
-    0xFA, 0xD6, 0xC8, 0xC1, 0x03, 0xD1, 0x65, 0xD8, 0x61, 0x21, 0x73, 0xFA, 0x41, 0x65, 0xE8, 0x6D,
-    0x2A, 0x64, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x75, 0x76, 0xA2, 0xA9, 0xB2, 0xB9, 0xC0,
-    0xC7, 0xD9, 0xEC, 0xF9, 0xFC, 0x42, 0x6E, 0x70, 0xEE, 0xCE, 0xDA, 0x5C, 0xC2, 0x02, 0x52, 0x65,
-    0x6F, 0xD8, 0x5E, 0xFF, 0xF9, 0xC1, 0x0A, 0x23, 0x68, 0xDE, 0x74, 0x41, 0x72, 0xDE, 0x6E, 0x41,
-    0x75, 0xFC, 0x7E, 0x43, 0x6E, 0x73, 0x6F, 0xDD, 0xB5, 0xDD, 0x51, 0xFF, 0xFC, 0x43, 0x61, 0x65,
-    0x79, 0xFF, 0xEE, 0xFF, 0xF6, 0xDE, 0x5C, 0x42, 0x6B, 0x74, 0xDA, 0x7E, 0xD6, 0x61, 0xA0, 0x0B,
-    0x82, 0x21, 0x74, 0xFD, 0x45, 0x67, 0x6D, 0x6E, 0x73, 0x74, 0xDD, 0xBD, 0xDD, 0xD9, 0xFF, 0xF3,
-    0xFF, 0xFD, 0xDD, 0xBD, 0x41, 0x72, 0xF0, 0xB2, 0xA1, 0x02, 0xB1, 0x61, 0xFC, 0x41, 0x61, 0xD9,
-    0x63, 0x21, 0x68, 0xFC, 0x21, 0x74, 0xFD, 0x43, 0x65, 0x68, 0x6F, 0xDD, 0x44, 0xDD, 0x44, 0xFF,
-    0xFD, 0x42, 0x70, 0x73, 0xFF, 0xF6, 0xE0, 0x2C, 0x52, 0x61, 0x62, 0x65, 0x66, 0x68, 0x69, 0x6B,
-    0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0x79, 0xFD, 0xDC, 0xDE, 0x92, 0xFE,
-    0x63, 0xDE, 0x92, 0xDE, 0x92, 0xFE, 0xD0, 0xDC, 0xF1, 0xFE, 0xFB, 0xFF, 0x04, 0xFF, 0x11, 0xFF,
-    0x78, 0xE7, 0x21, 0xFF, 0x94, 0xFF, 0x9D, 0xFF, 0xB5, 0xFF, 0xCC, 0xFF, 0xE0, 0xFF, 0xF9, 0xC1,
-    0x00, 0x51, 0x65, 0xDA, 0x0A, 0xC3, 0x02, 0x11, 0x63, 0x69, 0x74, 0xDC, 0xB4, 0xD5, 0xF5, 0xE7,
-    0x46, 0x41, 0x76, 0xDD, 0xC8, 0x41, 0x63, 0xDD, 0x3C, 0x21, 0x69, 0xFC, 0x43, 0x69, 0x72, 0x75,
-    0xFF, 0xF5, 0xFF, 0xFD, 0xDD, 0xBD, 0xC6, 0x03, 0xE2, 0x6C, 0x6D, 0x6E, 0x70, 0x73, 0x74, 0xDC,
-    0xF3, 0xFF, 0xD9, 0xFF, 0xDF, 0xE1, 0x18, 0xDF, 0x3B, 0xFF, 0xF6, 0x42, 0x61, 0x74, 0xDC, 0xC0,
-    0xDC, 0x89, 0xA1, 0x00, 0x51, 0x72, 0xF9, 0x42, 0x2E, 0x65, 0xDC, 0x7D, 0xDC, 0x7D, 0x43, 0x61,
-    0x6E, 0x74, 0xDC, 0x76, 0xDC, 0xAD, 0xFF, 0xF9, 0xC1, 0x02, 0xB1, 0x69, 0xDC, 0xA3, 0xC1, 0x02,
-    0xB1, 0x69, 0xEB, 0x86, 0x46, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x75, 0xFF, 0xDE, 0xFF, 0xEA, 0xFF,
-    0xF4, 0xDC, 0x58, 0xFF, 0xFA, 0xF5, 0xD6, 0xC2, 0x01, 0x91, 0x2E, 0x61, 0xDD, 0x62, 0xDD, 0x62,
-    0x45, 0x6D, 0x70, 0x72, 0x73, 0x79, 0xDC, 0x39, 0xDE, 0x30, 0xFF, 0xF7, 0xD5, 0x89, 0xDD, 0x59,
-    0x41, 0x75, 0xD5, 0x52, 0x41, 0x6F, 0xDC, 0x25, 0xC1, 0x02, 0x11, 0x61, 0xDC, 0x63, 0xC3, 0x02,
-    0x41, 0x64, 0x6E, 0x70, 0xDC, 0x1E, 0xDE, 0x5D, 0xFF, 0xFA, 0x41, 0x63, 0xEB, 0x3A, 0xC2, 0x04,
-    0x02, 0x61, 0x79, 0xDE, 0x02, 0xDD, 0x2B, 0xC1, 0x00, 0xC1, 0x61, 0xEF, 0x13, 0x42, 0x65, 0x75,
-    0xDC, 0x94, 0xFF, 0xFA, 0x44, 0x6C, 0x6D, 0x6F, 0x72, 0xDC, 0xB3, 0xDC, 0x8D, 0xDC, 0x00, 0xDC,
-    0x73, 0x4A, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x74, 0x75, 0xFF, 0xAF, 0xFF, 0xBF,
-    0xFF, 0xC3, 0xDB, 0xE8, 0xFF, 0xCD, 0xF8, 0x01, 0xFF, 0xD9, 0xFF, 0xDD, 0xFF, 0xEC, 0xFF, 0xF3,
-    0x42, 0x69, 0x6E, 0xDC, 0xE9, 0xDD, 0xE9, 0x42, 0x61, 0x73, 0xEB, 0xD5, 0xD4, 0xF1, 0x42, 0x6E,
-    0x72, 0xDB, 0xC6, 0xD4, 0xEA, 0xC2, 0x01, 0xE1, 0x75, 0x73, 0xD4, 0xFB, 0xDC, 0x4C, 0xC5, 0x02,
-    0x11, 0x61, 0x65, 0x6F, 0x74, 0x75, 0xFF, 0xF0, 0xDB, 0xAE, 0xFF, 0xF7, 0xDC, 0x1A, 0xDB, 0xB6,
-    0x42, 0x6D, 0x77, 0xDC, 0xB9, 0xDB, 0xDB, 0xC1, 0x02, 0x11, 0x6F, 0xDB, 0x9D, 0xC8, 0x02, 0x41,
-    0x61, 0x64, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x75, 0xFF, 0xC3, 0xDB, 0x97, 0xFF, 0xCA, 0xFF, 0xE1,
-    0xED, 0xF0, 0xFF, 0xF3, 0xDC, 0xAC, 0xFF, 0xFA, 0xA0, 0x0B, 0xE2, 0x21, 0x61, 0xFD, 0x44, 0x61,
-    0x65, 0x6E, 0x74, 0xE9, 0xB6, 0xD4, 0x9A, 0xDB, 0x6E, 0xDE, 0x06, 0x41, 0x2E, 0xDC, 0xFF, 0x42,
-    0x63, 0x74, 0xDB, 0xD8, 0xDC, 0xFB, 0xC7, 0x0B, 0xC2, 0x64, 0x67, 0x6C, 0x6E, 0x72, 0x73, 0x74,
-    0xD4, 0xBF, 0xFF, 0xE5, 0xFD, 0x21, 0xFF, 0xE8, 0xFF, 0xF5, 0xFF, 0xF9, 0xDB, 0xD1, 0x41, 0x72,
-    0xDE, 0xF6, 0x42, 0x65, 0x72, 0xD7, 0x37, 0xDB, 0xCF, 0x42, 0x63, 0x65, 0xEA, 0xA4, 0xDB, 0xAE,
-    0x41, 0x74, 0xD7, 0x80, 0x21, 0x65, 0xFC, 0x21, 0x63, 0xFD, 0x47, 0x2E, 0x65, 0x66, 0x69, 0x6C,
-    0x74, 0x61, 0xDB, 0x1F, 0xFF, 0xE4, 0xFF, 0xE8, 0xFF, 0xEF, 0xDB, 0x9D, 0xDB, 0x1F, 0xFF, 0xFD,
-    0x41, 0x62, 0xD4, 0x50, 0x41, 0x72, 0xDB, 0xC3, 0x41, 0x74, 0xD5, 0xC2, 0xC4, 0x01, 0x91, 0x62,
-    0x6C, 0x6E, 0x74, 0xDB, 0x7B, 0xDB, 0x3F, 0xDB, 0x3F, 0xDB, 0x3F, 0xA0, 0x02, 0x92, 0xC2, 0x02,
-    0x11, 0x72, 0x74, 0xDB, 0x2D, 0xDA, 0xF6, 0x42, 0x69, 0x72, 0xD4, 0x29, 0xDB, 0x51, 0x41, 0x72,
-    0xD8, 0x89, 0xA1, 0x00, 0x51, 0x65, 0xFC, 0x21, 0x74, 0xFB, 0x21, 0x69, 0xFD, 0xC9, 0x02, 0x41,
-    0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x75, 0x6E, 0xFF, 0xC3, 0xFF, 0xC7, 0xFF, 0xCB, 0xFF,
-    0xCF, 0xFF, 0xDE, 0xFF, 0xE1, 0xDD, 0xBA, 0xFF, 0xEA, 0xFF, 0xFD, 0xA0, 0x0C, 0x03, 0xC1, 0x02,
-    0x21, 0x6B, 0xDB, 0xCB, 0xC4, 0x02, 0xB1, 0x62, 0x64, 0x6D, 0x72, 0xF3, 0x54, 0xEE, 0x90, 0xE9,
-    0xD0, 0xD4, 0x67, 0x43, 0x67, 0x72, 0x76, 0xDB, 0x14, 0xDB, 0x05, 0xD3, 0xBF, 0xC6, 0x01, 0xF1,
-    0x61, 0x62, 0x6F, 0x73, 0x74, 0x7A, 0xDA, 0xCE, 0xDD, 0xC0, 0xDA, 0xCE, 0xF8, 0x80, 0xE2, 0xE3,
-    0xDD, 0xC0, 0x41, 0x61, 0xFF, 0x6E, 0x41, 0x71, 0xDA, 0xB5, 0x4A, 0x61, 0x65, 0x66, 0x69, 0x6C,
-    0x6E, 0x6F, 0x74, 0x75, 0x76, 0xFF, 0xCA, 0xFF, 0xD9, 0xDA, 0x7A, 0xFF, 0xE3, 0xFF, 0xF8, 0xDA,
-    0x6F, 0xFF, 0xFC, 0xE1, 0x55, 0xE2, 0x80, 0xDA, 0xB1, 0xC1, 0x01, 0x41, 0x65, 0xDA, 0x92, 0x41,
-    0x79, 0xD3, 0x91, 0x22, 0x67, 0x72, 0xF6, 0xFC, 0x41, 0x61, 0xD3, 0xBD, 0x21, 0x74, 0xFC, 0x42,
-    0x6E, 0x74, 0xFF, 0xFD, 0xDA, 0x3A, 0xC4, 0x01, 0xF1, 0x64, 0x6C, 0x6E, 0x74, 0xDC, 0x75, 0xD7,
-    0x7F, 0xDF, 0x02, 0xDA, 0x33, 0xC1, 0x02, 0x11, 0x6C, 0xDA, 0xE2, 0x41, 0x61, 0xEA, 0x3A, 0x21,
-    0x64, 0xFC, 0x21, 0x65, 0xFD, 0x47, 0x61, 0x65, 0x69, 0x6E, 0x6F, 0x75, 0x70, 0xFF, 0xCE, 0xFF,
-    0xDA, 0xFF, 0xE1, 0xDD, 0x29, 0xF8, 0x9D, 0xFF, 0xF0, 0xFF, 0xFD, 0x42, 0x75, 0x76, 0xED, 0x4D,
-    0xD9, 0xFE, 0x42, 0x6C, 0x72, 0xD8, 0x6F, 0xDA, 0x39, 0x21, 0x65, 0xF9, 0x41, 0x6E, 0xDA, 0x27,
-    0x21, 0x69, 0xFC, 0xA1, 0x01, 0x91, 0x6C, 0xFD, 0x41, 0x61, 0xD4, 0xAA, 0xC3, 0x02, 0x41, 0x65,
-    0x72, 0x73, 0xDA, 0x5B, 0xFF, 0xFC, 0xDE, 0x70, 0xC1, 0x01, 0x91, 0x6E, 0xD9, 0xDC, 0x46, 0x61,
-    0x65, 0x69, 0x6C, 0x6F, 0x75, 0xD9, 0xCB, 0xFF, 0xFA, 0xD9, 0xCB, 0xFF, 0xE2, 0xD9, 0xCB, 0xD9,
-    0xCB, 0x41, 0x79, 0xDB, 0xA0, 0x42, 0x2E, 0x6C, 0xD9, 0xB7, 0xFF, 0xFC, 0x41, 0x6F, 0xDB, 0xA4,
-    0x43, 0x65, 0x69, 0x79, 0xFF, 0xF5, 0xFF, 0xFC, 0xD9, 0xEB, 0xC5, 0x02, 0x41, 0x2E, 0x61, 0x6F,
-    0x73, 0x74, 0xD9, 0xA2, 0xDA, 0xBF, 0xD9, 0xE1, 0xDA, 0x0E, 0xFF, 0xF6, 0xC3, 0x03, 0xE2, 0x63,
-    0x73, 0x74, 0xF0, 0xF9, 0xD2, 0xBC, 0xDA, 0xAD, 0x41, 0x61, 0xD2, 0xD7, 0x21, 0x72, 0xFC, 0xC2,
-    0x02, 0x41, 0x65, 0x75, 0xD9, 0xBC, 0xFF, 0xFD, 0xA0, 0x0B, 0xC2, 0x42, 0x2E, 0x68, 0xE1, 0xC5,
-    0xFF, 0xFD, 0xC1, 0x01, 0xF1, 0x73, 0xD9, 0x6A, 0xA0, 0x1A, 0x12, 0x21, 0x73, 0xFD, 0x21, 0x61,
-    0xFD, 0x21, 0x72, 0xFD, 0x50, 0x2E, 0x61, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6B, 0x6C, 0x6E, 0x6F,
-    0x73, 0x74, 0x75, 0x79, 0x66, 0xE1, 0xAC, 0xFF, 0x57, 0xFF, 0x65, 0xFF, 0x6F, 0xFF, 0x78, 0xFF,
-    0x8A, 0xFF, 0xB6, 0xD9, 0x55, 0xD9, 0x55, 0xE1, 0xAC, 0xFF, 0xC8, 0xFF, 0xDB, 0xFF, 0xE7, 0xFF,
-    0xEE, 0xD9, 0x55, 0xFF, 0xFD, 0x42, 0x65, 0x72, 0xD2, 0x4D, 0xDC, 0x58, 0x41, 0x72, 0xD5, 0x5F,
-    0x43, 0x61, 0x65, 0x69, 0xD2, 0x5D, 0xFF, 0xFC, 0xD2, 0x5A, 0x43, 0x68, 0x69, 0x6F, 0xD9, 0x1A,
-    0xD9, 0x12, 0xD9, 0xA7, 0xCA, 0x02, 0x41, 0x2E, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74,
-    0x75, 0xD9, 0x05, 0xFF, 0xE1, 0xDA, 0xA6, 0xD9, 0x9D, 0xFF, 0xEC, 0xDE, 0x3F, 0xD5, 0x13, 0xDA,
-    0x25, 0xFF, 0xF6, 0xFB, 0xB7, 0x41, 0x73, 0xD7, 0x31, 0x21, 0x61, 0xFC, 0x21, 0x72, 0xFD, 0xC1,
-    0x01, 0xE1, 0x63, 0xD9, 0x72, 0x41, 0x65, 0xF2, 0x85, 0xC5, 0x02, 0x41, 0x65, 0x68, 0x69, 0x72,
-    0x75, 0xD1, 0xFF, 0xFF, 0xF3, 0xFF, 0xF6, 0xFF, 0xFC, 0xD9, 0x15, 0xA0, 0x0C, 0x42, 0x42, 0x64,
-    0x74, 0xD8, 0xFD, 0xFF, 0xFD, 0x43, 0x61, 0x65, 0x69, 0xD9, 0x32, 0xE8, 0x2C, 0xFF, 0xF9, 0x21,
-    0x75, 0xF6, 0xC2, 0x02, 0xB1, 0x62, 0x63, 0xD1, 0xD6, 0xD9, 0xC7, 0xA0, 0x0C, 0x62, 0x44, 0x64,
-    0x66, 0x6C, 0x73, 0xD2, 0x07, 0xD9, 0xBB, 0xFF, 0xFD, 0xD9, 0xBB, 0x41, 0x69, 0xD8, 0x99, 0xA0,
-    0x0C, 0x83, 0xC4, 0x01, 0xF1, 0x64, 0x73, 0x74, 0x7A, 0xD5, 0xD3, 0xD9, 0x1F, 0xE4, 0x81, 0xFF,
-    0xFD, 0x42, 0x67, 0x6E, 0xD1, 0xA7, 0xE4, 0xA5, 0xA0, 0x1A, 0x32, 0x21, 0x63, 0xFD, 0x21, 0x6F,
-    0xFD, 0x21, 0x76, 0xFD, 0x21, 0x65, 0xFD, 0xC9, 0x01, 0x91, 0x61, 0x64, 0x65, 0x67, 0x69, 0x6D,
-    0x6F, 0x75, 0x72, 0xFF, 0xBB, 0xD5, 0xAE, 0xFF, 0xC7, 0xFF, 0xD4, 0xFF, 0xDB, 0xD9, 0x16, 0xFF,
-    0xEA, 0xD9, 0x8C, 0xFF, 0xFD, 0x43, 0x67, 0x72, 0x73, 0xD8, 0x4F, 0xD8, 0x86, 0xD1, 0x94, 0xC1,
-    0x0C, 0xB2, 0x68, 0xD8, 0x7C, 0xC1, 0x01, 0x91, 0x72, 0xD8, 0x76, 0x42, 0x6E, 0x70, 0xD8, 0x70,
-    0xD1, 0x75, 0x42, 0x61, 0x6F, 0xD9, 0x05, 0xFF, 0xF9, 0x44, 0x62, 0x64, 0x73, 0x74, 0xD8, 0x62,
-    0xD1, 0x4F, 0xD8, 0x23, 0xED, 0xBE, 0x41, 0x61, 0xE7, 0x5D, 0xC1, 0x02, 0x11, 0x6D, 0xDF, 0x71,
-    0xC2, 0x01, 0xF1, 0x69, 0x79, 0xDB, 0x3D, 0xD8, 0xA1, 0x42, 0x6E, 0x73, 0xD6, 0x78, 0xD8, 0x98,
-    0xC2, 0x05, 0xD2, 0x61, 0x65, 0xE7, 0x47, 0xFF, 0xF9, 0x41, 0x61, 0xED, 0x08, 0x45, 0x61, 0x65,
-    0x69, 0x6C, 0x72, 0xD9, 0xBA, 0xD8, 0x5B, 0xD8, 0x5B, 0xD4, 0x2E, 0xFF, 0xFC, 0xC1, 0x02, 0x11,
-    0x73, 0xD7, 0xE7, 0x4F, 0x2E, 0x61, 0x63, 0x65, 0x66, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6F, 0x70,
-    0x73, 0x74, 0x75, 0xE0, 0x2D, 0xFF, 0x92, 0xFF, 0x9C, 0xFF, 0xA2, 0xD9, 0x11, 0xFF, 0xAF, 0xFF,
-    0xB6, 0xD9, 0x0E, 0xFF, 0xC3, 0xEE, 0xFE, 0xFF, 0xC7, 0xFF, 0xCD, 0xFF, 0xDD, 0xFF, 0xEA, 0xFF,
-    0xFA, 0xA0, 0x0C, 0xD2, 0x46, 0x2E, 0x62, 0x67, 0x6D, 0x6E, 0x74, 0xD7, 0xA5, 0xD1, 0x3A, 0xD8,
-    0xC5, 0xFF, 0xFD, 0xD8, 0x23, 0xD8, 0x23, 0x42, 0x61, 0x69, 0xD7, 0xD4, 0xD7, 0x95, 0x41, 0x61,
-    0xD9, 0x2C, 0x21, 0x6D, 0xFC, 0xA1, 0x02, 0x31, 0x69, 0xFD, 0xA2, 0x02, 0x41, 0x72, 0x73, 0xED,
-    0xFB, 0x41, 0x6C, 0xD3, 0x8A, 0xA1, 0x02, 0x41, 0x69, 0xFC, 0xC2, 0x02, 0x02, 0x61, 0x6B, 0xD7,
-    0xB1, 0xD9, 0x5E, 0xC1, 0x01, 0x91, 0x6D, 0xD8, 0x86, 0xA0, 0x11, 0x02, 0x21, 0x72, 0xFD, 0x21,
-    0x61, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0xC8, 0x02, 0xB1, 0x61, 0x63, 0x67, 0x6C, 0x6D,
-    0x6F, 0x73, 0x6E, 0xD7, 0x51, 0xFF, 0xE2, 0xD7, 0x93, 0xD8, 0x7B, 0xD7, 0xB1, 0xDF, 0xA8, 0xFF,
-    0xEB, 0xFF, 0xFD, 0xA0, 0x0C, 0xF3, 0x42, 0x6D, 0x6E, 0xFF, 0xFD, 0xD7, 0x33, 0x42, 0x61, 0x79,
-    0xEB, 0x0C, 0xD7, 0x37, 0x43, 0x61, 0x64, 0x6C, 0xDB, 0x4E, 0xD7, 0x28, 0xD7, 0x67, 0x49, 0x61,
-    0x65, 0x68, 0x69, 0x6F, 0x72, 0x74, 0x75, 0x7A, 0xFF, 0x76, 0xFF, 0x9C, 0xFF, 0xA7, 0xFF, 0xCA,
-    0xFF, 0xE8, 0xFF, 0xEF, 0xD7, 0x1B, 0xFF, 0xF6, 0xE6, 0x8F, 0x42, 0x2E, 0x73, 0xEA, 0x4E, 0xEB,
-    0xFB, 0x43, 0x6C, 0x6E, 0x72, 0xD7, 0x3D, 0xDC, 0x94, 0xFF, 0xF9, 0x43, 0x6C, 0x6F, 0x74, 0xD7,
-    0xA5, 0xD6, 0xF9, 0xD7, 0x5D, 0x42, 0x65, 0x6F, 0xD6, 0xE7, 0xD9, 0xC8, 0x42, 0x72, 0x74, 0xFF,
-    0xF9, 0xEA, 0x2C, 0xA3, 0x02, 0x41, 0x65, 0x69, 0x6F, 0xDE, 0xE8, 0xF9, 0x41, 0x74, 0xD8, 0xC4,
-    0x21, 0x6E, 0xFC, 0x43, 0x61, 0x69, 0x6F, 0xE2, 0xEF, 0xCF, 0xF5, 0xFF, 0xFD, 0x5A, 0x61, 0x62,
-    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72,
-    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xFA, 0x29, 0xFA, 0x67, 0xFA, 0xD4, 0xFB, 0x30,
-    0xFB, 0x69, 0xFB, 0x9D, 0xFB, 0xF0, 0xD7, 0x3A, 0xFC, 0x0E, 0xFC, 0x11, 0xD6, 0xBC, 0xFC, 0x4D,
-    0xFC, 0xA8, 0xFD, 0x67, 0xFD, 0xB7, 0xFD, 0xEC, 0xFE, 0x12, 0xFE, 0x5A, 0xFE, 0xE6, 0xFF, 0xA1,
-    0xD8, 0x5D, 0xFF, 0xE6, 0xE0, 0xEC, 0xD9, 0xF3, 0xD6, 0xBC, 0xFF, 0xF6, 0x41, 0x71, 0xCF, 0x9C,
-    0x41, 0x65, 0xFD, 0x0B, 0x21, 0x6E, 0xFC, 0xA1, 0x02, 0x31, 0x61, 0xFD, 0x41, 0x61, 0xD1, 0x1B,
-    0x21, 0x75, 0xFC, 0xA3, 0x02, 0xE1, 0x63, 0x70, 0x6E, 0xE9, 0xF4, 0xFD, 0xA0, 0x18, 0x22, 0x21,
-    0x6D, 0xFD, 0x42, 0x73, 0x65, 0xCF, 0x8E, 0xFF, 0xFD, 0x42, 0x69, 0x79, 0xF2, 0x6C, 0xD6, 0x40,
-    0x21, 0x74, 0xF9, 0xC3, 0x03, 0xD1, 0x72, 0x73, 0x77, 0xFF, 0xEF, 0xFF, 0xFD, 0xCF, 0x77, 0x41,
-    0x70, 0xD6, 0xC2, 0x41, 0x67, 0xD8, 0x1D, 0x21, 0x64, 0xFC, 0x24, 0x61, 0x65, 0x6F, 0x75, 0xC9,
-    0xE9, 0xF5, 0xFD, 0x45, 0x2E, 0x62, 0x67, 0x69, 0x6C, 0xD7, 0x51, 0xD6, 0x94, 0xD6, 0x19, 0xD8,
-    0xBE, 0xCF, 0x45, 0xA0, 0x1A, 0x52, 0x21, 0x67, 0xFD, 0xA1, 0x01, 0x21, 0x6E, 0xFD, 0x21, 0x69,
-    0xFB, 0x41, 0x64, 0xE6, 0x5D, 0xC1, 0x00, 0x51, 0x74, 0xD7, 0x6E, 0x48, 0x64, 0x65, 0x67, 0x6C,
-    0x6E, 0x72, 0x73, 0x74, 0xD6, 0x4E, 0xE4, 0x86, 0xD6, 0x86, 0xFF, 0xF3, 0xFF, 0xF6, 0xD7, 0x8F,
-    0xFF, 0xFA, 0xDC, 0xD4, 0xA0, 0x0D, 0x22, 0x42, 0x6C, 0x6F, 0xD6, 0xF2, 0xCF, 0x22, 0xA0, 0x1A,
-    0x72, 0x21, 0x63, 0xFD, 0x21, 0x69, 0xFD, 0x42, 0x73, 0x74, 0xDA, 0x55, 0xFF, 0xFD, 0x44, 0x2E,
-    0x64, 0x65, 0x67, 0xD6, 0xDB, 0xCF, 0x27, 0xFF, 0xF9, 0xCE, 0xEA, 0xC1, 0x00, 0x51, 0x68, 0xD5,
-    0xB1, 0xC7, 0x02, 0xB1, 0x2E, 0x63, 0x6C, 0x6D, 0x6E, 0x70, 0x73, 0xD7, 0x9F, 0xFF, 0xD3, 0xFF,
-    0xD6, 0xD6, 0xC8, 0xFF, 0xED, 0xD6, 0x40, 0xFF, 0xFA, 0x41, 0x79, 0xD5, 0x90, 0xC2, 0x02, 0xB1,
-    0x65, 0x79, 0xFF, 0xFC, 0xD5, 0x8C, 0x42, 0x65, 0x6F, 0xDA, 0x16, 0xF4, 0x94, 0x41, 0x6E, 0xE4,
-    0x14, 0x21, 0x61, 0xFC, 0x21, 0x69, 0xFD, 0x44, 0x72, 0x73, 0x75, 0x76, 0xD5, 0x7D, 0xCE, 0x9E,
-    0xD5, 0xF0, 0xFF, 0xFD, 0x41, 0x6F, 0xD1, 0x65, 0x41, 0x61, 0xD5, 0xDF, 0xC4, 0x0A, 0x23, 0x63,
-    0x6C, 0x79, 0x68, 0xD6, 0x7D, 0xD5, 0xF5, 0xD6, 0x7D, 0xFF, 0xFC, 0x4F, 0x61, 0x62, 0x65, 0x66,
-    0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x77, 0xFF, 0x38, 0xD6, 0xEF, 0xFF,
-    0x60, 0xD5, 0xCC, 0xD5, 0xE6, 0xFF, 0xA6, 0xD5, 0xE6, 0xFF, 0xC2, 0xD6, 0xEF, 0xFF, 0xCB, 0xFF,
-    0xDC, 0xFF, 0xE9, 0xFF, 0xF1, 0xD5, 0x51, 0xD6, 0xEF, 0x42, 0x69, 0x6F, 0xDE, 0x54, 0xD6, 0x40,
-    0xA0, 0x1A, 0x93, 0xA1, 0x00, 0x41, 0x65, 0xFD, 0x21, 0x69, 0xFB, 0x42, 0x65, 0x79, 0xD6, 0x2E,
-    0xD5, 0x50, 0x43, 0x64, 0x65, 0x74, 0xF3, 0xA7, 0xCE, 0x51, 0xCE, 0x73, 0x41, 0x6E, 0xD0, 0x6E,
-    0x21, 0x65, 0xFC, 0x43, 0x67, 0x69, 0x63, 0xCE, 0x25, 0xCE, 0x37, 0xFF, 0xFD, 0x41, 0x6C, 0xD6,
-    0xA1, 0x43, 0x61, 0x65, 0x69, 0xD5, 0xC6, 0xFF, 0xFC, 0xDF, 0xC4, 0xC1, 0x01, 0x91, 0x61, 0xEE,
-    0x40, 0x41, 0x73, 0xD1, 0xF9, 0x21, 0x73, 0xFC, 0x21, 0x65, 0xFD, 0x21, 0x6E, 0xFD, 0x4B, 0x62,
-    0x63, 0x64, 0x67, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x76, 0x69, 0xFF, 0xAB, 0xFF, 0xBA, 0xFF, 0xBD,
-    0xEA, 0x5A, 0xD1, 0xC3, 0xFF, 0xC4, 0xFF, 0xD5, 0xCE, 0x37, 0xFF, 0xE3, 0xFF, 0xED, 0xFF, 0xFD,
-    0xC1, 0x03, 0xE2, 0x69, 0xCE, 0x42, 0xA0, 0x1A, 0xC3, 0x21, 0x64, 0xFD, 0x21, 0x6C, 0xFD, 0x42,
-    0x61, 0x69, 0xD7, 0x35, 0xFF, 0xFD, 0xC3, 0x0A, 0x23, 0x65, 0x69, 0x68, 0xCD, 0xC2, 0xD5, 0x11,
-    0xFF, 0xF9, 0x42, 0x65, 0x69, 0xD5, 0x1F, 0xD5, 0x1F, 0xA1, 0x02, 0x11, 0x72, 0xF9, 0xC1, 0x00,
-    0x51, 0x73, 0xD4, 0x86, 0xC1, 0x02, 0x21, 0x69, 0xD5, 0x95, 0xA3, 0x02, 0x41, 0x65, 0x69, 0x72,
-    0xEF, 0xF4, 0xFA, 0x41, 0x2E, 0xD6, 0xED, 0x21, 0x72, 0xFC, 0x21, 0x65, 0xFD, 0xA0, 0x11, 0xC2,
-    0x21, 0x61, 0xFD, 0xA2, 0x02, 0x81, 0x64, 0x73, 0xF7, 0xFD, 0xA0, 0x1B, 0x23, 0x21, 0x65, 0xFD,
-    0x21, 0x72, 0xFD, 0x21, 0x64, 0xFD, 0x21, 0x6E, 0xFD, 0x43, 0x2E, 0x67, 0x65, 0xD6, 0x37, 0xD6,
-    0x37, 0xFF, 0xFD, 0x41, 0x63, 0xCD, 0x7D, 0xA1, 0x02, 0x31, 0x69, 0xFC, 0x21, 0x74, 0xFB, 0x21,
-    0x61, 0xFD, 0x41, 0x64, 0xE5, 0x0D, 0x21, 0x69, 0xFC, 0x45, 0x2E, 0x63, 0x65, 0x74, 0x6F, 0xD4,
-    0x20, 0xD5, 0x5B, 0xE0, 0x4D, 0xE2, 0xB8, 0xFF, 0xFD, 0x42, 0x68, 0x72, 0xD4, 0x52, 0xD4, 0xA8,
-    0x41, 0x62, 0xCD, 0x59, 0x45, 0x61, 0x65, 0x67, 0x69, 0x6F, 0xFF, 0xFC, 0xCD, 0x34, 0xD5, 0x40,
-    0xF2, 0x95, 0xD5, 0x25, 0xC1, 0x02, 0x71, 0x2E, 0xD5, 0xEC, 0xC3, 0x00, 0xD1, 0x63, 0x71, 0x73,
-    0xD7, 0xAA, 0xD5, 0xE6, 0xFF, 0xFA, 0x43, 0x2E, 0x61, 0x73, 0xCD, 0x12, 0xCD, 0x12, 0xCD, 0x12,
-    0x21, 0x72, 0xF6, 0x42, 0x61, 0x65, 0xD4, 0x54, 0xFF, 0xFD, 0xC1, 0x02, 0x71, 0x65, 0xD3, 0xCF,
-    0xA0, 0x1A, 0xF3, 0x21, 0x62, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x74, 0xFD, 0x4C, 0x61, 0x62, 0x66,
-    0x67, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x76, 0x79, 0x63, 0xFF, 0x67, 0xD6, 0xD2, 0xD1, 0xD7, 0xFF,
-    0x7D, 0xFF, 0x93, 0xFF, 0x9D, 0xFF, 0xAD, 0xFF, 0xB8, 0xFF, 0xCE, 0xFF, 0xE7, 0xFF, 0xEE, 0xFF,
-    0xFD, 0xC1, 0x02, 0x41, 0x72, 0xD3, 0x9B, 0xC1, 0x01, 0x71, 0x72, 0xCE, 0x50, 0xC3, 0x08, 0x33,
-    0x61, 0x65, 0x6F, 0xFF, 0xFA, 0xD5, 0xB0, 0xCC, 0xCD, 0x45, 0x67, 0x6D, 0x72, 0x73, 0x74, 0xD4,
-    0x18, 0xD6, 0xB4, 0xE3, 0x5A, 0xD4, 0x18, 0xD6, 0xB7, 0x46, 0x69, 0x6F, 0x73, 0x74, 0x75, 0x79,
-    0xF9, 0xC3, 0xD6, 0xB1, 0xD3, 0x70, 0xE2, 0xE4, 0xD4, 0x90, 0xD3, 0xEE, 0x43, 0x61, 0x65, 0x69,
-    0xD3, 0xDB, 0xCF, 0x87, 0xD4, 0x98, 0x43, 0x65, 0x66, 0x6C, 0xCF, 0x22, 0xD4, 0x73, 0xD3, 0xEB,
-    0x41, 0x65, 0xD5, 0x40, 0x21, 0x74, 0xFC, 0x43, 0x61, 0x68, 0x72, 0xFF, 0xFD, 0xD4, 0x7D, 0xDD,
-    0x0E, 0xA0, 0x0D, 0x43, 0x44, 0x62, 0x69, 0x6F, 0x70, 0xD0, 0x99, 0xCC, 0x76, 0xD3, 0xCD, 0xEA,
-    0xA1, 0xC1, 0x06, 0x32, 0x61, 0xCC, 0x69, 0x44, 0x61, 0x65, 0x69, 0x6B, 0xD4, 0x42, 0xFF, 0xFA,
-    0xCC, 0x63, 0xCD, 0x69, 0xA0, 0x0D, 0x42, 0x42, 0x61, 0x73, 0xD5, 0x09, 0xF3, 0xA2, 0x21, 0x63,
-    0xF9, 0x41, 0x67, 0xE4, 0xD3, 0x21, 0x6F, 0xFC, 0xC3, 0x02, 0xB1, 0x2E, 0x69, 0x68, 0xD3, 0x61,
-    0xFF, 0xF6, 0xFF, 0xFD, 0x50, 0x61, 0x62, 0x63, 0x64, 0x66, 0x67, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
-    0x71, 0x73, 0x74, 0x76, 0x7A, 0xFF, 0x75, 0xFA, 0x67, 0xFF, 0x85, 0xFF, 0x98, 0xFF, 0xA2, 0xFF,
-    0xB3, 0xD4, 0x30, 0xFF, 0xBD, 0xFF, 0xC0, 0xFF, 0xD3, 0xD3, 0x2F, 0xFF, 0xE0, 0xE4, 0x6E, 0xFF,
-    0xF4, 0xE6, 0x02, 0xD4, 0x96, 0xC2, 0x00, 0x71, 0x6C, 0x74, 0xD3, 0x42, 0xCB, 0xF3, 0x21, 0x61,
-    0xF7, 0x41, 0x77, 0xD3, 0xD8, 0xC6, 0x02, 0x11, 0x61, 0x63, 0x67, 0x6C, 0x6E, 0x74, 0xD2, 0xB7,
-    0xD3, 0x32, 0xD3, 0x32, 0xD3, 0x32, 0xE3, 0x19, 0xE3, 0x19, 0xC1, 0x0D, 0x72, 0x61, 0xD2, 0xA2,
-    0xA0, 0x02, 0x12, 0x21, 0x68, 0xFD, 0xA2, 0x02, 0x81, 0x6E, 0x73, 0xF4, 0xFD, 0x41, 0x75, 0xCC,
-    0xBB, 0xC3, 0x02, 0x31, 0x71, 0x75, 0x77, 0xFF, 0xFC, 0xD2, 0xAE, 0xD2, 0x8B, 0x41, 0x6C, 0xD2,
-    0xEB, 0xA5, 0x02, 0xB1, 0x61, 0x65, 0x69, 0x6F, 0x66, 0xC0, 0xC4, 0xE5, 0xF0, 0xFC, 0x41, 0x6E,
-    0xED, 0x72, 0xA0, 0x01, 0xD2, 0x21, 0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0xA1, 0x00, 0x41, 0x65, 0xFD,
-    0x42, 0x64, 0x6E, 0xD3, 0x79, 0xFF, 0xFB, 0xC3, 0x02, 0x41, 0x65, 0x69, 0x6F, 0xD2, 0xC9, 0xFF,
-    0xE7, 0xFF, 0xF9, 0xA0, 0x08, 0x63, 0xA0, 0x1B, 0x53, 0x21, 0x6F, 0xFD, 0x21, 0x74, 0xFD, 0x42,
-    0x61, 0x6F, 0xDD, 0x2A, 0xFF, 0xFD, 0x41, 0x63, 0xD3, 0x6E, 0x41, 0x73, 0xE4, 0x77, 0x44, 0x69,
-    0x6F, 0x75, 0x65, 0xFF, 0xF8, 0xD2, 0x2E, 0xD3, 0x66, 0xFF, 0xFC, 0xA0, 0x0A, 0xD2, 0xA1, 0x00,
-    0x51, 0x7A, 0xFD, 0x42, 0x67, 0x69, 0xD4, 0x0D, 0xFF, 0xFB, 0x43, 0x65, 0x69, 0x6D, 0xDE, 0x3C,
-    0xCB, 0x50, 0xD2, 0x8D, 0xC1, 0x00, 0x41, 0x74, 0xD5, 0x3C, 0x43, 0x61, 0x69, 0x6F, 0xFF, 0xFA,
-    0xD6, 0x84, 0xF1, 0x74, 0x42, 0x69, 0x79, 0xD5, 0x11, 0xD3, 0xEC, 0x21, 0x68, 0xF9, 0x21, 0x70,
-    0xFD, 0x44, 0x2E, 0x65, 0x6F, 0x74, 0xD3, 0xDF, 0xCB, 0x32, 0xFF, 0xFD, 0xCB, 0x17, 0x42, 0x6E,
-    0x74, 0xCF, 0xF9, 0xDA, 0x32, 0x41, 0x2E, 0xCA, 0xFD, 0x42, 0x64, 0x72, 0xFF, 0xFC, 0xFD, 0x6A,
-    0x21, 0x65, 0xF9, 0x21, 0x64, 0xFD, 0x4F, 0x2E, 0x62, 0x63, 0x66, 0x67, 0x6D, 0x6E, 0x6F, 0x70,
-    0x72, 0x73, 0x74, 0x75, 0x76, 0x61, 0xD2, 0xFE, 0xFF, 0x89, 0xD4, 0xD8, 0xD1, 0xC3, 0xFF, 0x98,
-    0xE4, 0xD0, 0xFF, 0xAD, 0xCF, 0xE1, 0xFF, 0xB4, 0xFF, 0xC4, 0xFF, 0xDB, 0xDB, 0x8F, 0xFF, 0xE8,
-    0xD1, 0xC3, 0xFF, 0xFD, 0x42, 0x61, 0x69, 0xD2, 0x13, 0xD1, 0x98, 0x42, 0x6E, 0x74, 0xD1, 0xC8,
-    0xD2, 0x0C, 0xC5, 0x02, 0x41, 0x61, 0x68, 0x69, 0x6C, 0x72, 0xF6, 0x7E, 0xFF, 0xF2, 0xFF, 0xF9,
-    0xD2, 0xA7, 0xD1, 0x8A, 0xC3, 0x08, 0x63, 0x63, 0x65, 0x69, 0xD2, 0x95, 0xD1, 0xD5, 0xE5, 0x60,
-    0x41, 0x65, 0xCA, 0xBF, 0x42, 0x67, 0x6E, 0xD1, 0x70, 0xFF, 0xFC, 0xC3, 0x02, 0xB1, 0x6E, 0x72,
-    0x61, 0xCA, 0x87, 0xE7, 0x00, 0xD1, 0xDC, 0x41, 0x79, 0xCD, 0x64, 0xA1, 0x00, 0x71, 0x6C, 0xFC,
-    0x21, 0x69, 0xFB, 0x41, 0x73, 0xD3, 0x2E, 0x42, 0x65, 0x73, 0xFF, 0xFC, 0xCA, 0x6B, 0xC1, 0x00,
-    0xD1, 0x72, 0xFA, 0xDE, 0xC6, 0x01, 0x91, 0x61, 0x65, 0x68, 0x69, 0x72, 0x75, 0xFF, 0xD0, 0xFF,
-    0xD7, 0xFF, 0xEC, 0xFF, 0xF3, 0xD2, 0xD6, 0xFF, 0xFA, 0x42, 0x68, 0x69, 0xCA, 0x49, 0xD1, 0x62,
-    0x42, 0x6E, 0x70, 0xD1, 0x5B, 0xCA, 0x54, 0x42, 0x2E, 0x69, 0xD1, 0x15, 0xEF, 0x87, 0xA0, 0x1B,
-    0xA2, 0x21, 0x2E, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x69, 0xFD, 0x44, 0x61, 0x69, 0x6E, 0x62, 0xD1,
-    0x97, 0xD2, 0xF6, 0xFF, 0xED, 0xFF, 0xFD, 0xC1, 0x01, 0xE1, 0x72, 0xCA, 0x33, 0x42, 0x73, 0x74,
-    0xCA, 0x15, 0xD0, 0x29, 0xA0, 0x1B, 0x82, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6B, 0xFD,
-    0x4C, 0x61, 0x62, 0x63, 0x65, 0x66, 0x69, 0x6D, 0x6F, 0x70, 0x73, 0x74, 0x6E, 0xD0, 0xE4, 0xD9,
-    0x6D, 0xFF, 0xB9, 0xFF, 0xC0, 0xCA, 0x08, 0xD0, 0xE7, 0xFF, 0xDA, 0xFF, 0xE7, 0xD0, 0xD9, 0xFF,
-    0xED, 0xDF, 0x71, 0xFF, 0xFD, 0xA0, 0x0D, 0x92, 0x42, 0x6E, 0x74, 0xD0, 0xB4, 0xFF, 0xFD, 0x21,
-    0x65, 0xF9, 0x41, 0x79, 0xD8, 0xB8, 0xC2, 0x05, 0x92, 0x65, 0x74, 0xD0, 0xA6, 0xFF, 0xFC, 0xA0,
-    0x1B, 0xC3, 0x21, 0x69, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0x61, 0xFD, 0xC6, 0x03, 0xD1, 0x61, 0x62,
-    0x6D, 0x6E, 0x73, 0x67, 0xD0, 0x8E, 0xD0, 0x8E, 0xD5, 0x13, 0xD6, 0x11, 0xFF, 0xEB, 0xFF, 0xFD,
-    0x57, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
-    0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0xFB, 0xAE, 0xFB, 0xD0, 0xFB, 0xE6, 0xFC, 0x0A,
-    0xFC, 0xBC, 0xFC, 0xE1, 0xFC, 0xED, 0xD8, 0xEA, 0xFD, 0x84, 0xD0, 0x79, 0xFD, 0xBE, 0xFE, 0x01,
-    0xFE, 0x27, 0xFE, 0x33, 0xFE, 0xB6, 0xFE, 0xF2, 0xD8, 0x5A, 0xFF, 0x04, 0xFF, 0x44, 0xFF, 0xA0,
-    0xFF, 0xCF, 0xDF, 0xEA, 0xFF, 0xEB, 0x41, 0x69, 0xD4, 0xBC, 0x43, 0x61, 0x68, 0x6C, 0xD3, 0x63,
-    0xFF, 0xFC, 0xD0, 0xC7, 0x42, 0x69, 0x6E, 0xCC, 0x25, 0xD2, 0x1C, 0x42, 0x67, 0x6E, 0xD0, 0x60,
-    0xD0, 0x29, 0x41, 0x70, 0xF9, 0xCA, 0x45, 0x64, 0x69, 0x6C, 0x74, 0x61, 0xD0, 0x13, 0xFF, 0xF5,
-    0xC9, 0xA8, 0xCC, 0x55, 0xFF, 0xFC, 0x43, 0x61, 0x73, 0x7A, 0xD1, 0xFA, 0xC9, 0x4A, 0xC9, 0x44,
-    0xA0, 0x1B, 0xF2, 0x21, 0x63, 0xFD, 0x21, 0x73, 0xFD, 0x43, 0x69, 0x2E, 0x75, 0xFF, 0xED, 0xD0,
-    0x50, 0xFF, 0xFD, 0xA0, 0x1C, 0xF3, 0x21, 0x6F, 0xFD, 0x21, 0x72, 0xFD, 0xA1, 0x01, 0x91, 0x68,
-    0xFD, 0x41, 0x65, 0xD0, 0x8F, 0x42, 0x6E, 0x7A, 0xFF, 0xFC, 0xCF, 0xDF, 0xA0, 0x1C, 0x12, 0x21,
-    0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x44, 0x69, 0x6C, 0x76, 0x67, 0xFF, 0xF0, 0xCC, 0x06, 0xC9, 0x05,
-    0xFF, 0xFD, 0x43, 0x63, 0x65, 0x74, 0xD4, 0x3C, 0xC8, 0xE6, 0xC8, 0xF2, 0x42, 0x73, 0x7A, 0xCF,
-    0xEF, 0xEC, 0xEF, 0x43, 0x65, 0x68, 0x69, 0xD1, 0x9D, 0xCA, 0x64, 0xFF, 0xF9, 0xCB, 0x03, 0xD1,
-    0x62, 0x63, 0x67, 0x68, 0x69, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74, 0xD7, 0xF3, 0xFF, 0x6D, 0xFF,
-    0x77, 0xD7, 0xF3, 0xCD, 0xBA, 0xFF, 0x89, 0xFF, 0xAC, 0xFF, 0xBF, 0xFF, 0xD8, 0xFF, 0xE5, 0xFF,
-    0xF6, 0xA0, 0x0D, 0x82, 0x21, 0x74, 0xFD, 0x43, 0x6C, 0x6E, 0x76, 0xCF, 0x75, 0xE5, 0x51, 0xC8,
-    0xA1, 0xA2, 0x04, 0x02, 0x61, 0x69, 0xF3, 0xF6, 0x41, 0x6E, 0xDB, 0xDA, 0xA1, 0x00, 0xC1, 0x69,
-    0xFC, 0xA0, 0x1C, 0x32, 0x21, 0x63, 0xFD, 0x44, 0x61, 0x65, 0x63, 0x6F, 0xD1, 0x49, 0xCF, 0x94,
-    0xFF, 0xF5, 0xFF, 0xFD, 0xC3, 0x02, 0x41, 0x2E, 0x69, 0x79, 0xCF, 0x45, 0xFF, 0xF3, 0xEF, 0xD5,
-    0xA0, 0x1C, 0x52, 0x21, 0x6E, 0xFD, 0x21, 0x61, 0xFD, 0xA1, 0x02, 0x81, 0x72, 0xFD, 0x42, 0x6F,
-    0x74, 0xCB, 0x2B, 0xC8, 0x5A, 0xA0, 0x0D, 0xB2, 0xA1, 0x02, 0x81, 0x6F, 0xFD, 0xC1, 0x00, 0x51,
-    0x63, 0xC8, 0x63, 0xC1, 0x00, 0x41, 0x75, 0xC8, 0x6C, 0xC1, 0x02, 0x71, 0x65, 0xC8, 0x3F, 0xC7,
-    0x03, 0xD1, 0x61, 0x64, 0x65, 0x69, 0x73, 0x74, 0x2E, 0xFF, 0xEE, 0xC8, 0x76, 0xCF, 0x0A, 0xC8,
-    0x39, 0xFF, 0xF4, 0xFF, 0xFA, 0xCF, 0x6A, 0x41, 0x61, 0xCE, 0xF5, 0x21, 0x73, 0xFC, 0xC1, 0x02,
-    0x41, 0x74, 0xDA, 0x9E, 0xC1, 0x02, 0x31, 0x6C, 0xC8, 0x26, 0x42, 0x63, 0x65, 0xD0, 0xD6, 0xCE,
-    0xEA, 0xC2, 0x01, 0x41, 0x69, 0x79, 0xFF, 0xF9, 0xCF, 0x1A, 0x44, 0x61, 0x65, 0x68, 0x72, 0xFF,
-    0xEA, 0xCF, 0x3E, 0xF6, 0x41, 0xFF, 0xF7, 0x4B, 0x2E, 0x64, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x72,
-    0x73, 0x74, 0x76, 0xCE, 0xC2, 0xFF, 0x7D, 0xFF, 0x92, 0xFF, 0x97, 0xFF, 0xA1, 0xFF, 0xB8, 0xCF,
-    0xA0, 0xFF, 0xD4, 0xFF, 0xD7, 0xFF, 0xF3, 0xCF, 0x5A, 0xA0, 0x1C, 0x73, 0xA1, 0x00, 0x51, 0x62,
-    0xFD, 0x42, 0x61, 0x67, 0xFF, 0xFB, 0xC7, 0xC7, 0x41, 0x61, 0xCF, 0xCC, 0x43, 0x61, 0x65, 0x74,
-    0xCF, 0xC8, 0xEF, 0x1D, 0xFF, 0xFC, 0x41, 0x67, 0xCE, 0x12, 0x41, 0x69, 0xC9, 0x6A, 0x21, 0x6C,
-    0xFC, 0xA2, 0x01, 0x41, 0x61, 0x69, 0xF5, 0xFD, 0x22, 0x69, 0x6C, 0xE4, 0xF9, 0xC2, 0x01, 0x41,
-    0x69, 0x79, 0xC7, 0xB3, 0xCE, 0x6F, 0x21, 0x6C, 0xF7, 0xA0, 0x1C, 0xC3, 0x21, 0x74, 0xFD, 0x22,
-    0x72, 0x73, 0xFA, 0xFD, 0x21, 0x65, 0xFB, 0xA1, 0x01, 0x41, 0x74, 0xFD, 0xA0, 0x1C, 0xA2, 0x21,
-    0x2E, 0xFD, 0x21, 0x73, 0xFD, 0x47, 0x61, 0x64, 0x65, 0x67, 0x74, 0x75, 0x69, 0xC7, 0x73, 0xCF,
-    0x7F, 0xD1, 0x32, 0xFF, 0xE1, 0xC7, 0x73, 0xFF, 0xF2, 0xFF, 0xFD, 0x41, 0x2E, 0xC7, 0x5D, 0x21,
-    0x72, 0xFC, 0x41, 0x79, 0xCE, 0x2A, 0x42, 0x69, 0x72, 0xC7, 0x52, 0xFF, 0xFC, 0xC3, 0x02, 0x11,
-    0x65, 0x6C, 0x74, 0xFF, 0xF2, 0xC7, 0x63, 0xFF, 0xF9, 0x41, 0x68, 0xCE, 0x10, 0x4A, 0x2E, 0x61,
-    0x64, 0x67, 0x6C, 0x6E, 0x6F, 0x73, 0x74, 0x7A, 0xD0, 0x03, 0xCE, 0x4E, 0xFF, 0x74, 0xC7, 0x3B,
-    0xFF, 0x9B, 0xFF, 0xC8, 0xCB, 0xDA, 0xFF, 0xF0, 0xFF, 0xFC, 0xCE, 0x6C, 0xA0, 0x1C, 0xB2, 0x42,
-    0x72, 0x62, 0xF3, 0xA0, 0xFF, 0xFD, 0xA1, 0x02, 0xB1, 0x61, 0xF9, 0x41, 0x6E, 0xCE, 0xFE, 0xC3,
-    0x04, 0x02, 0x61, 0x69, 0x6F, 0xCE, 0x72, 0xFF, 0xFC, 0xCE, 0x72, 0xC1, 0x1D, 0x23, 0x69, 0xD0,
-    0xEA, 0x21, 0x74, 0xFA, 0xA1, 0x01, 0x91, 0x61, 0xFD, 0x21, 0x72, 0xFB, 0xA0, 0x0D, 0xD2, 0xC1,
-    0x00, 0xC1, 0x65, 0xC7, 0x01, 0x21, 0x73, 0xFA, 0xA0, 0x1D, 0x52, 0x42, 0x73, 0x63, 0xCD, 0xD4,
-    0xFF, 0xFD, 0x21, 0x65, 0xF9, 0x42, 0x74, 0x79, 0xC6, 0xEB, 0xCA, 0x69, 0x43, 0x61, 0x73, 0x7A,
-    0xC8, 0x5B, 0xEE, 0x0D, 0xCD, 0xDF, 0xA0, 0x1D, 0x72, 0x21, 0x6E, 0xFD, 0xA0, 0x11, 0x72, 0x44,
-    0x6C, 0x63, 0x65, 0x73, 0xCC, 0x02, 0xCA, 0xF7, 0xFF, 0xFA, 0xFF, 0xFD, 0x45, 0x65, 0x67, 0x69,
-    0x6F, 0x79, 0xFF, 0xD9, 0xCA, 0xC9, 0xFF, 0xE0, 0xFF, 0xF3, 0xD3, 0x19, 0xA0, 0x1D, 0x92, 0x21,
-    0x73, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x6E, 0xFD, 0xC2, 0x02, 0x81, 0x61, 0x6F, 0xDC, 0xD5, 0xFF,
-    0xFD, 0xC2, 0x00, 0xD1, 0x65, 0x70, 0xCE, 0xD6, 0xCD, 0x9A, 0xA0, 0x10, 0x12, 0x21, 0x74, 0xFD,
-    0xA1, 0x00, 0xF1, 0x65, 0xFD, 0x21, 0x68, 0xFB, 0x41, 0x6E, 0xE9, 0xB7, 0xA1, 0x02, 0x71, 0x69,
-    0xFC, 0x42, 0x66, 0x73, 0xCD, 0x3B, 0xFF, 0xFB, 0x41, 0x73, 0xD5, 0x8E, 0x21, 0x61, 0xFC, 0x21,
-    0x6C, 0xFD, 0xCE, 0x03, 0xD1, 0x63, 0x64, 0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74,
-    0x75, 0x76, 0x65, 0xFF, 0x67, 0xFF, 0x6A, 0xD0, 0x5E, 0xFF, 0x73, 0xCD, 0x27, 0xFF, 0x80, 0xCF,
-    0xAA, 0xFF, 0xAA, 0xFF, 0xC6, 0xFF, 0xCF, 0xFF, 0xE3, 0xFF, 0xEF, 0xD0, 0x5B, 0xFF, 0xFD, 0xC1,
-    0x00, 0xA1, 0x62, 0xC6, 0x41, 0x42, 0x61, 0x69, 0xFF, 0xFA, 0xC6, 0x44, 0x21, 0x72, 0xF9, 0x41,
-    0x73, 0xCB, 0x62, 0x21, 0x61, 0xFC, 0xC5, 0x02, 0x11, 0x61, 0x65, 0x6E, 0x72, 0x73, 0xC6, 0x12,
-    0xD1, 0x10, 0xCF, 0xC0, 0xCC, 0xE6, 0xCC, 0xEE, 0x41, 0x74, 0xC7, 0xD2, 0x21, 0x69, 0xFC, 0x44,
-    0x72, 0x73, 0x75, 0x76, 0xC8, 0xD8, 0xFF, 0xFD, 0xCE, 0xEE, 0xC6, 0x1A, 0xC7, 0x04, 0x02, 0x61,
-    0x65, 0x68, 0x69, 0x6F, 0x74, 0x79, 0xFF, 0xD0, 0xD1, 0x6F, 0xFF, 0xD7, 0xFF, 0xDA, 0xFF, 0xF3,
-    0xCF, 0xFE, 0xCD, 0x1D, 0xA0, 0x1D, 0xB2, 0x21, 0x6B, 0xFD, 0x21, 0x63, 0xFD, 0xA1, 0x01, 0x41,
-    0x61, 0xFD, 0xC2, 0x0A, 0x23, 0x68, 0x69, 0xFF, 0xFB, 0xCC, 0x9A, 0xA0, 0x1D, 0xD2, 0xA1, 0x01,
-    0x01, 0x75, 0xFD, 0xA1, 0x02, 0xE1, 0x69, 0xFB, 0x42, 0x61, 0x74, 0xD5, 0x07, 0xFF, 0xFB, 0x41,
-    0x6F, 0xCF, 0xAE, 0x21, 0x72, 0xFC, 0xC6, 0x03, 0xD1, 0x6C, 0x6D, 0x6E, 0x70, 0x75, 0x64, 0xFF,
-    0xF2, 0xCD, 0xAE, 0xC7, 0x40, 0xCC, 0x73, 0xCD, 0x0B, 0xFF, 0xFD, 0x52, 0x61, 0x62, 0x63, 0x65,
-    0x66, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0xFC, 0xC2,
-    0xFC, 0xF6, 0xD6, 0x8E, 0xFD, 0x9C, 0xD4, 0x3F, 0xD4, 0xB5, 0xFE, 0x52, 0xCC, 0x5E, 0xD4, 0x3F,
-    0xFE, 0x7B, 0xFE, 0x84, 0xFF, 0x37, 0xFF, 0xA1, 0xD4, 0xB8, 0xFF, 0xC7, 0xCC, 0x5E, 0xFF, 0xEB,
-    0xCC, 0x5E, 0xC1, 0x08, 0x63, 0x75, 0xCD, 0x47, 0x43, 0x2E, 0x61, 0x74, 0xCC, 0x21, 0xCC, 0xB9,
-    0xCC, 0x24, 0x41, 0x72, 0xE8, 0xA6, 0x21, 0x65, 0xFC, 0xC1, 0x02, 0x31, 0x61, 0xCC, 0x1B, 0x42,
-    0x69, 0x74, 0xFF, 0xFA, 0xCC, 0x0A, 0x41, 0x69, 0xCC, 0x29, 0x41, 0x69, 0xCA, 0x77, 0xC3, 0x02,
-    0x11, 0x63, 0x69, 0x6B, 0xFF, 0xFC, 0xC6, 0x93, 0xC5, 0x24, 0x41, 0x2E, 0xDC, 0x54, 0x21, 0x73,
-    0xFC, 0xA1, 0x00, 0x71, 0x68, 0xFD, 0x45, 0x63, 0x65, 0x69, 0x6C, 0x6D, 0xFF, 0xFB, 0xCB, 0xE3,
-    0xC5, 0x24, 0xC5, 0x12, 0xCB, 0xE6, 0xC2, 0x01, 0x41, 0x63, 0x74, 0xC5, 0x02, 0xD2, 0xDE, 0x41,
-    0x6D, 0xDB, 0xA4, 0xC2, 0x02, 0x11, 0x61, 0x6F, 0xCC, 0x0B, 0xFF, 0xFC, 0xC2, 0x02, 0x11, 0x73,
-    0x74, 0xCA, 0xFA, 0xCC, 0xF8, 0xCC, 0x03, 0xD1, 0x62, 0x63, 0x67, 0x6B, 0x6C, 0x6D, 0x6E, 0x72,
-    0x73, 0x74, 0x75, 0x76, 0xFF, 0x8D, 0xFF, 0x93, 0xFF, 0xA1, 0xC4, 0xE3, 0xFF, 0xAA, 0xFF, 0xB1,
-    0xFF, 0xB9, 0xFF, 0xD1, 0xFF, 0xE1, 0xFF, 0xEE, 0xFF, 0xF7, 0xC5, 0x20, 0x41, 0x73, 0xE0, 0x89,
-    0xA0, 0x1D, 0xF3, 0x21, 0x74, 0xFD, 0x42, 0x6F, 0x73, 0xCB, 0x86, 0xFF, 0xFD, 0x42, 0x6C, 0x73,
-    0xCB, 0x7F, 0xCB, 0xFA, 0x43, 0x61, 0x65, 0x69, 0xCB, 0xF3, 0xFF, 0xF2, 0xFF, 0xF9, 0x42, 0x6E,
-    0x74, 0xCB, 0xDA, 0xCC, 0x03, 0x41, 0x75, 0xF1, 0xE7, 0x47, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72,
-    0x75, 0xC5, 0x9E, 0xFF, 0xD3, 0xFF, 0xEB, 0xFF, 0xF5, 0xFF, 0xFC, 0xCD, 0x01, 0xCD, 0x01, 0x42,
-    0x69, 0x6E, 0xCC, 0x6A, 0xCB, 0x4D, 0xC1, 0x02, 0xB1, 0x73, 0xCE, 0x06, 0x41, 0x6B, 0xCC, 0xDE,
-    0x21, 0x63, 0xFC, 0x45, 0x62, 0x66, 0x74, 0x7A, 0x65, 0xC4, 0x65, 0xDC, 0x5F, 0xCC, 0xD7, 0xCB,
-    0xB4, 0xFF, 0xFD, 0x42, 0x63, 0x72, 0xCB, 0x29, 0xC4, 0x55, 0x41, 0x68, 0xD3, 0xB3, 0x46, 0x61,
-    0x65, 0x69, 0x75, 0x77, 0x74, 0xFF, 0xD1, 0xFF, 0xD8, 0xFF, 0xE5, 0xFF, 0xF5, 0xCF, 0xF8, 0xFF,
-    0xFC, 0x41, 0x6B, 0xCB, 0x4A, 0x21, 0x63, 0xFC, 0xC2, 0x02, 0x81, 0x75, 0x61, 0xC4, 0x42, 0xFF,
-    0xFD, 0xC1, 0x02, 0x81, 0x6B, 0xCC, 0xEF, 0x41, 0x76, 0xC4, 0x39, 0xA1, 0x02, 0x31, 0x69, 0xFC,
-    0x21, 0x74, 0xFB, 0x42, 0x61, 0x65, 0xFF, 0xFD, 0xCC, 0xDD, 0x42, 0x61, 0x69, 0xCB, 0x77, 0xD2,
-    0xFD, 0x42, 0x69, 0x6F, 0xCA, 0xE3, 0xCB, 0x70, 0xC1, 0x03, 0xD1, 0x65, 0xCA, 0xD1, 0x42, 0x62,
-    0x72, 0xC4, 0x1B, 0xCB, 0xEB, 0xC4, 0x02, 0xB1, 0x61, 0x65, 0x69, 0x72, 0xFF, 0xF9, 0xCB, 0x24,
-    0xCE, 0x83, 0xC3, 0xF3, 0xA0, 0x0C, 0xB2, 0x21, 0x69, 0xFD, 0xC5, 0x03, 0xD1, 0x2E, 0x70, 0x74,
-    0x77, 0x6B, 0xD3, 0x06, 0xCA, 0xAF, 0xD3, 0x06, 0xCA, 0xAF, 0xFF, 0xFD, 0x41, 0x69, 0xF8, 0x6A,
-    0xC1, 0x02, 0x31, 0x65, 0xCA, 0x9C, 0x51, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x67, 0x6C, 0x6D, 0x6E,
-    0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0xD2, 0xEA, 0xCE, 0x63, 0xFF, 0x92, 0xFF, 0x9B,
-    0xD2, 0xEA, 0xFF, 0xAD, 0xFF, 0xB4, 0xFF, 0xBB, 0xFF, 0xC2, 0xCB, 0xCE, 0xCD, 0xCA, 0xCD, 0xC7,
-    0xFF, 0xCF, 0xFF, 0xE4, 0xFF, 0xF6, 0xFF, 0xFA, 0xCB, 0x2B, 0x41, 0x65, 0xF5, 0x87, 0x21, 0x74,
-    0xFC, 0x21, 0x69, 0xFD, 0x21, 0x6E, 0xFD, 0xA1, 0x02, 0x21, 0x69, 0xFD, 0x41, 0x62, 0xCB, 0x6D,
-    0xC1, 0x0E, 0x12, 0x73, 0xC3, 0x90, 0x21, 0x65, 0xFA, 0x42, 0x65, 0x69, 0xCA, 0x43, 0xCA, 0xBE,
-    0x43, 0x6C, 0x6E, 0x72, 0xCA, 0xB7, 0xFF, 0xF6, 0xFF, 0xF9, 0x42, 0x61, 0x6F, 0xCA, 0x3A, 0xCA,
-    0x9E, 0x43, 0x62, 0x6E, 0x74, 0xCA, 0xA6, 0xCA, 0x97, 0xCA, 0x2B, 0x41, 0x76, 0xC3, 0x47, 0x41,
-    0x72, 0xCA, 0x89, 0x42, 0x68, 0x70, 0xCA, 0x21, 0xFF, 0xFC, 0xC1, 0x02, 0xB1, 0x6D, 0xCB, 0x2F,
-    0x49, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x73, 0x75, 0x79, 0xFF, 0xBC, 0xFF, 0xD0, 0xFF, 0xDA,
-    0xFF, 0xE1, 0xE3, 0x41, 0xFF, 0xEB, 0xFF, 0xF3, 0xFF, 0xFA, 0xCA, 0x69, 0xC1, 0x00, 0x51, 0x62,
-    0xC4, 0xAB, 0xC2, 0x08, 0x33, 0x61, 0x65, 0xFF, 0xFA, 0xC3, 0x16, 0xC1, 0x01, 0xE1, 0x2E, 0xEF,
-    0x30, 0xC2, 0x06, 0xB2, 0x6E, 0x70, 0xFF, 0xFA, 0xCA, 0x70, 0x42, 0x61, 0x6C, 0xCA, 0x11, 0xCA,
-    0x67, 0xC1, 0x02, 0x31, 0x69, 0xC9, 0xD3, 0xC1, 0x02, 0x81, 0x63, 0xC9, 0xEB, 0x21, 0x69, 0xFA,
-    0xC1, 0x02, 0xB1, 0x69, 0xD2, 0x2D, 0xC2, 0x02, 0xB1, 0x65, 0x67, 0xD5, 0xE0, 0xC2, 0xE2, 0x42,
-    0x2E, 0x74, 0xCB, 0xA1, 0xC3, 0xD2, 0xC4, 0x02, 0x11, 0x68, 0x69, 0x6F, 0x72, 0xCA, 0xC3, 0xD3,
-    0x9B, 0xCD, 0x73, 0xC9, 0xE5, 0x4C, 0x61, 0x62, 0x64, 0x65, 0x66, 0x67, 0x6B, 0x6D, 0x6E, 0x6F,
-    0x73, 0x74, 0xFF, 0xBC, 0xFF, 0xC5, 0xFF, 0xCC, 0xCC, 0xD5, 0xFF, 0xD8, 0xCA, 0xDD, 0xC2, 0xC3,
-    0xFF, 0xDB, 0xFF, 0xE1, 0xCA, 0x2C, 0xFF, 0xEA, 0xFF, 0xF1, 0x42, 0x72, 0x74, 0xD6, 0x24, 0xC9,
-    0xED, 0x41, 0x75, 0xE0, 0xC8, 0xC4, 0x04, 0x22, 0x65, 0x69, 0x6C, 0x72, 0xFF, 0xF5, 0xCE, 0xA6,
-    0xCB, 0x05, 0xFF, 0xFC, 0xC1, 0x04, 0x02, 0x65, 0xE6, 0x0C, 0xC1, 0x00, 0x51, 0x74, 0xC2, 0x78,
-    0xA1, 0x01, 0x71, 0x65, 0xFA, 0x42, 0x61, 0x76, 0xD9, 0x57, 0xC2, 0x73, 0xC2, 0x0A, 0x23, 0x65,
-    0x69, 0xC2, 0x6C, 0xFF, 0xF9, 0xC1, 0x00, 0x51, 0x65, 0xC9, 0x76, 0x21, 0x6C, 0xFA, 0xA0, 0x1E,
-    0x23, 0x21, 0x73, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x72, 0xFD, 0x42, 0x6C, 0x65, 0xC9, 0x22, 0xFF,
-    0xFD, 0xC1, 0x01, 0x91, 0x65, 0xC2, 0x41, 0x41, 0x73, 0xC5, 0xB2, 0xA0, 0x0E, 0x32, 0x41, 0x73,
-    0xCB, 0x02, 0x21, 0x69, 0xFC, 0x21, 0x67, 0xFD, 0x22, 0x69, 0x6F, 0xF3, 0xFD, 0xA0, 0x08, 0x92,
-    0x21, 0x74, 0xFD, 0x43, 0x63, 0x7A, 0x73, 0xCA, 0x31, 0xE9, 0x86, 0xFF, 0xFD, 0x41, 0x6F, 0xD3,
-    0x71, 0x21, 0x6E, 0xFC, 0x45, 0x69, 0x6F, 0x79, 0x61, 0x65, 0xFF, 0xEF, 0xC9, 0x7D, 0xC9, 0x27,
-    0xE5, 0xAD, 0xFF, 0xFD, 0x41, 0x67, 0xC2, 0x04, 0x41, 0x6F, 0xC5, 0xA5, 0xC2, 0x00, 0x81, 0x7A,
-    0x73, 0xC8, 0xD0, 0xFF, 0xFC, 0x41, 0x71, 0xC1, 0xFF, 0xA3, 0x02, 0x31, 0x61, 0x69, 0x65, 0xEB,
-    0xF3, 0xFC, 0xA0, 0x0E, 0x53, 0xA0, 0x1D, 0x22, 0x21, 0x2E, 0xFD, 0x22, 0x69, 0x79, 0xF7, 0xFD,
-    0x21, 0x6C, 0xFB, 0xA1, 0x01, 0x91, 0x6F, 0xFD, 0x42, 0x62, 0x72, 0xC1, 0xE8, 0xCF, 0x87, 0x21,
-    0x61, 0xF9, 0x43, 0x63, 0x65, 0x74, 0xC8, 0x97, 0xC1, 0xC6, 0xC1, 0xDE, 0xC1, 0x03, 0xD1, 0x6E,
-    0xC9, 0xC8, 0xA0, 0x0E, 0x82, 0x41, 0x62, 0xC8, 0xF3, 0x22, 0x6C, 0x6D, 0xF9, 0xFC, 0x21, 0x65,
-    0xFB, 0x41, 0x6C, 0xC3, 0x36, 0x50, 0x62, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70,
-    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0xFF, 0x46, 0xFF, 0x55, 0xD6, 0x56, 0xC9, 0xAF, 0xFF, 0x5C,
-    0xFF, 0x62, 0xFF, 0x73, 0xFF, 0x8F, 0xFF, 0xB4, 0xFF, 0xCE, 0xFF, 0xDA, 0xFF, 0xDD, 0xCA, 0xB6,
-    0xFF, 0xE7, 0xFF, 0xF9, 0xFF, 0xFC, 0x41, 0x65, 0xC2, 0xBB, 0xC2, 0x07, 0x42, 0x69, 0x72, 0xC1,
-    0x6E, 0xFF, 0xFC, 0xC1, 0x02, 0xB1, 0x75, 0xC1, 0x65, 0x42, 0x62, 0x74, 0xC8, 0x3B, 0xFC, 0x31,
-    0xC1, 0x02, 0x31, 0x65, 0xDD, 0xC7, 0xC1, 0x02, 0x11, 0x73, 0xDB, 0x72, 0x42, 0x64, 0x67, 0xC4,
-    0x74, 0xC1, 0x46, 0xC1, 0x01, 0xE1, 0x6F, 0xCB, 0x4D, 0x41, 0x61, 0xC6, 0x93, 0xC9, 0x08, 0x63,
-    0x61, 0x63, 0x65, 0x69, 0x6C, 0x6D, 0x6F, 0x70, 0x74, 0xFF, 0xDC, 0xFF, 0xE3, 0xFF, 0xE9, 0xFF,
-    0xEF, 0xC8, 0x6C, 0xFF, 0xF6, 0xCD, 0x42, 0xCA, 0xF3, 0xFF, 0xFC, 0x41, 0x72, 0xC3, 0x3B, 0x42,
-    0x65, 0x67, 0xC8, 0x68, 0xDB, 0x39, 0xC5, 0x02, 0x81, 0x62, 0x65, 0x66, 0x6E, 0x70, 0xC7, 0xE6,
-    0xC1, 0x15, 0xC2, 0xB0, 0xFF, 0xF9, 0xC1, 0x12, 0x41, 0x6C, 0xC3, 0x6A, 0x21, 0x6C, 0xFC, 0x41,
-    0x70, 0xC4, 0x21, 0x22, 0x6F, 0x65, 0xF9, 0xFC, 0x41, 0x6D, 0xC6, 0xFE, 0xC6, 0x02, 0xB1, 0x61,
-    0x65, 0x69, 0x72, 0x73, 0x75, 0xE1, 0xCC, 0xFF, 0xCF, 0xFF, 0xDA, 0xFF, 0xF7, 0xC8, 0x55, 0xFF,
-    0xFC, 0x41, 0x66, 0xC1, 0x14, 0x42, 0x6E, 0x74, 0xC8, 0x22, 0xD0, 0x50, 0xC2, 0x01, 0x41, 0x65,
-    0x69, 0xC8, 0x0C, 0xC7, 0xA0, 0xA0, 0x0E, 0xA2, 0x49, 0x61, 0x64, 0x65, 0x66, 0x69, 0x6D, 0x6E,
-    0x6F, 0x74, 0xC8, 0x00, 0xC8, 0x29, 0xC8, 0x6F, 0xFF, 0xE9, 0xFF, 0xED, 0xFF, 0xF4, 0xFF, 0xFD,
-    0xC8, 0x0F, 0xD0, 0x25, 0x42, 0x6D, 0x70, 0xC0, 0xA4, 0xC0, 0xA4, 0xC1, 0x01, 0x91, 0x61, 0xC7,
-    0xEC, 0x59, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
-    0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0xFB, 0xB4, 0xD8, 0xC5, 0xFC,
-    0x08, 0xFC, 0x4D, 0xFC, 0xD5, 0xFD, 0x16, 0xFD, 0x5F, 0xFD, 0x81, 0xFD, 0xD4, 0xC9, 0x09, 0xFE,
-    0x04, 0xFE, 0x13, 0xFE, 0x1F, 0xFE, 0x2B, 0xFE, 0xF4, 0xFF, 0x29, 0xC9, 0x09, 0xFF, 0x32, 0xFF,
-    0x5C, 0xFF, 0xAB, 0xFF, 0xD7, 0xD7, 0xE0, 0xDA, 0x5A, 0xFF, 0xF3, 0xFF, 0xFA, 0x41, 0x73, 0xE7,
-    0xAC, 0x21, 0x65, 0xFC, 0x42, 0x65, 0x74, 0xC0, 0x44, 0xC2, 0x16, 0xC5, 0x01, 0x91, 0x64, 0x6C,
-    0x72, 0x73, 0x74, 0xC0, 0x4F, 0xFF, 0xF6, 0xE8, 0xDC, 0xFF, 0xF9, 0xCE, 0x19, 0x42, 0x62, 0x72,
-    0xC9, 0xE0, 0xC6, 0xFF, 0xC1, 0x02, 0x11, 0x67, 0xC7, 0x00, 0xA1, 0x02, 0xB1, 0x6E, 0xFA, 0x41,
-    0x67, 0xCF, 0xD6, 0x21, 0x69, 0xFC, 0x46, 0x61, 0x65, 0x69, 0x72, 0x75, 0x6C, 0xFF, 0xE7, 0xC4,
-    0x47, 0xFF, 0xF4, 0xC7, 0x61, 0xC7, 0x28, 0xFF, 0xFD, 0xC2, 0x00, 0x51, 0x65, 0x61, 0xCB, 0x82,
-    0xC9, 0xB0, 0x42, 0x66, 0x6C, 0xC1, 0x85, 0xC7, 0xE7, 0x41, 0x61, 0xDA, 0xA0, 0x41, 0x64, 0xC7,
-    0xDC, 0x41, 0x69, 0xCC, 0xBC, 0x42, 0x63, 0x74, 0xC6, 0xF6, 0xFF, 0xFC, 0x43, 0x61, 0x65, 0x69,
-    0xFF, 0xF9, 0xC1, 0x6B, 0xEF, 0xE0, 0x41, 0x6F, 0xED, 0x26, 0x42, 0x6C, 0x72, 0xC7, 0x5D, 0xC9,
-    0x8D, 0x48, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x74, 0x75, 0xC8, 0x39, 0xFF, 0xC8, 0xFF, 0xD1,
-    0xFF, 0xD8, 0xFF, 0xDC, 0xFF, 0xEB, 0xFF, 0xF5, 0xFF, 0xF9, 0x41, 0x65, 0xC6, 0x8D, 0x41, 0x63,
-    0xC2, 0xD2, 0x21, 0x69, 0xFC, 0x43, 0x63, 0x6F, 0x74, 0xC6, 0xB6, 0xBF, 0xB5, 0xFF, 0xFD, 0xC1,
-    0x0E, 0xC2, 0x72, 0xC1, 0x28, 0x42, 0x2E, 0x73, 0xC6, 0x6F, 0xC6, 0x6F, 0x21, 0x74, 0xF9, 0x21,
-    0x63, 0xFD, 0x41, 0x6C, 0xC1, 0x18, 0x21, 0x6C, 0xFC, 0x25, 0x64, 0x69, 0x6F, 0x75, 0x65, 0xD1,
-    0xDC, 0xE6, 0xF6, 0xFD, 0x41, 0x67, 0xC6, 0x48, 0xA0, 0x1D, 0xC1, 0x21, 0x74, 0xFD, 0xA1, 0x02,
-    0x21, 0x73, 0xFD, 0x45, 0x6C, 0x6E, 0x72, 0x74, 0x76, 0xC7, 0x56, 0xFF, 0xF1, 0xFF, 0xFB, 0xD0,
-    0x02, 0xC6, 0xB4, 0x42, 0x65, 0x74, 0xC6, 0x31, 0xBF, 0x4F, 0xA1, 0x02, 0x11, 0x74, 0xF9, 0x21,
-    0x69, 0xFB, 0x42, 0x69, 0x6F, 0xC7, 0xF2, 0xC7, 0x37, 0x42, 0x72, 0x74, 0xEE, 0xDA, 0xFF, 0xF9,
-    0xC3, 0x02, 0xB1, 0x6E, 0x6F, 0x72, 0xC8, 0xF7, 0xC6, 0x0C, 0xC7, 0x29, 0xA0, 0x0E, 0xE2, 0x43,
-    0x65, 0x73, 0x74, 0xC6, 0x78, 0xFF, 0xFD, 0xC6, 0x3C, 0xC1, 0x01, 0x41, 0x79, 0xD7, 0x19, 0x41,
-    0x7A, 0xC7, 0x25, 0x21, 0x69, 0xFC, 0x41, 0x6F, 0xC7, 0x03, 0xC1, 0x03, 0xD1, 0x6E, 0xCE, 0x36,
-    0x48, 0x61, 0x65, 0x69, 0x6C, 0x6E, 0x72, 0x75, 0x79, 0xFF, 0xC9, 0xFF, 0xD0, 0xFF, 0xDF, 0xFF,
-    0xE9, 0xFF, 0xF3, 0xFF, 0xF6, 0xCC, 0xE4, 0xFF, 0xFA, 0xC1, 0x07, 0x82, 0x61, 0xF1, 0xB7, 0x41,
-    0x73, 0xBE, 0xFB, 0x21, 0x65, 0xFC, 0x41, 0x65, 0xCE, 0x47, 0x41, 0x65, 0xC5, 0xD5, 0x42, 0x67,
-    0x74, 0xC6, 0x29, 0xBF, 0xF2, 0x43, 0x6D, 0x6F, 0x74, 0xC5, 0xA7, 0xC6, 0x82, 0xE6, 0x67, 0xC8,
-    0x02, 0x81, 0x63, 0x64, 0x66, 0x67, 0x6C, 0x6E, 0x73, 0x74, 0xFF, 0xE4, 0xFF, 0xE7, 0xE5, 0x7A,
-    0xBE, 0xC9, 0xFF, 0xEB, 0xFF, 0xEF, 0xFF, 0xF6, 0xFF, 0xE7, 0x42, 0x6E, 0x73, 0xC5, 0xFD, 0xBE,
-    0xBD, 0xC2, 0x02, 0x41, 0x65, 0x69, 0xFF, 0xF9, 0xC9, 0xFD, 0xC2, 0x02, 0xB1, 0x6E, 0x73, 0xC6,
-    0x8F, 0xF8, 0x85, 0xC1, 0x02, 0x81, 0x65, 0xBE, 0xA1, 0x41, 0x72, 0xDB, 0x49, 0x21, 0x65, 0xFC,
-    0x42, 0x63, 0x74, 0xC5, 0xD7, 0xFF, 0xFD, 0x43, 0x72, 0x73, 0x74, 0xC5, 0x94, 0xFF, 0xF9, 0xC5,
-    0xD0, 0x42, 0x2E, 0x68, 0xC5, 0x4B, 0xC5, 0x8A, 0x42, 0x65, 0x69, 0xC5, 0x44, 0xD1, 0xF6, 0xA0,
-    0x1E, 0x53, 0x21, 0x6F, 0xFD, 0x21, 0x70, 0xFD, 0x21, 0x6F, 0xFD, 0xCB, 0x02, 0x81, 0x61, 0x63,
-    0x64, 0x66, 0x6C, 0x6E, 0x6F, 0x73, 0x74, 0x76, 0x67, 0xC5, 0xAC, 0xD7, 0x92, 0xC5, 0xE5, 0xD5,
-    0x93, 0xC5, 0x31, 0xE0, 0x35, 0xC5, 0x31, 0xFF, 0xE6, 0xFF, 0xED, 0xC5, 0x31, 0xFF, 0xFD, 0x41,
-    0x69, 0xBE, 0xD0, 0xA0, 0x09, 0xE3, 0x21, 0x6D, 0xFD, 0x21, 0x6F, 0xFD, 0x43, 0x67, 0x72, 0x6E,
-    0xFE, 0x45, 0xBE, 0x2C, 0xFF, 0xFD, 0x44, 0x62, 0x6D, 0x6E, 0x73, 0xC5, 0x35, 0xC7, 0x76, 0xC5,
-    0x35, 0xC4, 0xF6, 0x4C, 0x61, 0x64, 0x65, 0x66, 0x69, 0x6C, 0x6F, 0x70, 0x74, 0x75, 0x76, 0x79,
-    0xFF, 0x77, 0xFF, 0x80, 0xFF, 0x94, 0xC7, 0xFB, 0xFF, 0xB8, 0xFF, 0xDC, 0xFF, 0xE9, 0xC6, 0x10,
-    0xC8, 0x1A, 0xFF, 0xF3, 0xC8, 0x1A, 0xC5, 0x46, 0x43, 0x68, 0x6C, 0x74, 0xC4, 0xCC, 0xBE, 0x08,
-    0xFE, 0x09, 0x42, 0x65, 0x6C, 0xC7, 0xEB, 0xC5, 0x4F, 0x41, 0x73, 0xC9, 0x35, 0xC1, 0x01, 0x41,
-    0x72, 0xC6, 0x2A, 0xA0, 0x1E, 0x82, 0x21, 0x61, 0xFD, 0x21, 0x68, 0xFD, 0xC4, 0x02, 0x11, 0x6E,
-    0x72, 0x74, 0x63, 0xC5, 0x5B, 0xFF, 0xED, 0xFF, 0xF1, 0xFF, 0xFD, 0x42, 0x2E, 0x61, 0xC4, 0xD0,
-    0xC4, 0xD0, 0xC1, 0x01, 0xF1, 0x69, 0xC4, 0x8A, 0x44, 0x61, 0x63, 0x64, 0x6E, 0xC4, 0xFF, 0xFF,
-    0xF3, 0xC4, 0x84, 0xFF, 0xFA, 0x41, 0x64, 0xC6, 0x6B, 0x21, 0x6E, 0xFC, 0x21, 0x65, 0xFD, 0x42,
-    0x67, 0x6E, 0xBD, 0xD6, 0xC5, 0x8A, 0x42, 0x69, 0x72, 0xC4, 0xA5, 0xDA, 0xF6, 0x47, 0x61, 0x62,
-    0x65, 0x69, 0x6D, 0x6F, 0x70, 0xFF, 0x9B, 0xFF, 0xA5, 0xFF, 0xBF, 0xFF, 0xDB, 0xFF, 0xEF, 0xFF,
-    0xF2, 0xFF, 0xF9, 0xC2, 0x01, 0xF1, 0x63, 0x6E, 0xC4, 0xDE, 0xC4, 0xC4, 0x41, 0x6C, 0xC5, 0x78,
-    0xA1, 0x01, 0xF1, 0x69, 0xFC, 0xC1, 0x02, 0x41, 0x6F, 0xC4, 0x3F, 0x42, 0x6E, 0x73, 0xC4, 0xAC,
-    0xC4, 0x54, 0x44, 0x63, 0x6F, 0x73, 0x75, 0xC4, 0x96, 0xC4, 0xA5, 0xC4, 0x96, 0xC4, 0x2A, 0x41,
-    0x79, 0xC4, 0x5C, 0x21, 0x65, 0xFC, 0x42, 0x79, 0x69, 0xC4, 0x55, 0xFD, 0x98, 0x41, 0x6D, 0xEE,
-    0xAB, 0xA0, 0x1E, 0xA4, 0x21, 0x6E, 0xFD, 0x21, 0x6F, 0xFD, 0x45, 0x64, 0x6D, 0x72, 0x74, 0x75,
-    0xC7, 0x14, 0xFF, 0xEC, 0xFF, 0xF3, 0xFF, 0xFD, 0xC4, 0x7D, 0xC1, 0x01, 0x81, 0x72, 0xC1, 0xC1,
-    0x21, 0x69, 0xFA, 0xC2, 0x01, 0xE1, 0x70, 0x75, 0xFF, 0xFD, 0xBD, 0x0F, 0xC1, 0x07, 0xE2, 0x66,
-    0xBD, 0x33, 0x42, 0x65, 0x69, 0xD3, 0x21, 0xFF, 0xFA, 0xCC, 0x02, 0x11, 0x61, 0x63, 0x64, 0x65,
-    0x67, 0x69, 0x6B, 0x6F, 0x73, 0x74, 0x75, 0x76, 0xFF, 0x8A, 0xFF, 0x97, 0xFF, 0x9C, 0xFF, 0xA2,
-    0xC4, 0xB5, 0xFF, 0xA9, 0xFF, 0xBA, 0xFF, 0xD1, 0xFF, 0xEA, 0xFF, 0xF9, 0xCF, 0x2C, 0xC0, 0x6C,
-    0x42, 0x65, 0x69, 0xBC, 0xF0, 0xBC, 0xF0, 0x41, 0x64, 0xC4, 0x20, 0xC5, 0x02, 0x81, 0x64, 0x6B,
-    0x70, 0x72, 0x73, 0xFF, 0xF5, 0xC4, 0x36, 0xBF, 0xAC, 0xFF, 0xFC, 0xC1, 0xB8, 0xC1, 0x02, 0x71,
-    0x67, 0xC3, 0x8C, 0xA1, 0x01, 0xF1, 0x61, 0xFA, 0x42, 0x64, 0x72, 0xBC, 0xC8, 0xFF, 0xFB, 0xC2,
-    0x02, 0x41, 0x61, 0x65, 0xDC, 0xFB, 0xC4, 0xC3, 0x41, 0x2E, 0xC3, 0xE0, 0x21, 0x6D, 0xFC, 0x43,
-    0x6E, 0x74, 0x73, 0xDE, 0x71, 0xC3, 0xE8, 0xFF, 0xFD, 0x42, 0x6E, 0x73, 0xC3, 0x63, 0xC5, 0x19,
-    0x48, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x75, 0x79, 0xC3, 0xB9, 0xFF, 0xD8, 0xFF, 0xDF, 0xFF,
-    0xEF, 0xFF, 0xF9, 0xC4, 0xFA, 0xC3, 0xC8, 0xBC, 0xA0, 0x41, 0x67, 0xC7, 0xC5, 0xC4, 0x02, 0xB1,
-    0x2E, 0x67, 0x6C, 0x6E, 0xC3, 0x3F, 0xD6, 0x8B, 0xFC, 0x84, 0xFF, 0xFC, 0xC1, 0x00, 0x81, 0x6C,
-    0xC3, 0x30, 0x42, 0x68, 0x74, 0xBC, 0x6E, 0xC3, 0xDE, 0x44, 0x61, 0x69, 0x73, 0x77, 0xFF, 0xF3,
-    0xC3, 0x62, 0xFF, 0xF9, 0xBC, 0x49, 0x47, 0x61, 0x63, 0x6C, 0x6E, 0x6F, 0x74, 0x75, 0xCD, 0x43,
-    0xC3, 0xD1, 0xC3, 0x16, 0xC3, 0x82, 0xC4, 0xB4, 0xFE, 0xF9, 0xC3, 0x91, 0x41, 0x65, 0xBD, 0xCA,
-    0x42, 0x66, 0x75, 0xC2, 0xFC, 0xDE, 0x00, 0x41, 0x68, 0xC4, 0x2D, 0xC1, 0x02, 0x31, 0x6E, 0xBC,
-    0x35, 0x42, 0x65, 0x74, 0xFF, 0xFA, 0xBC, 0x11, 0xA0, 0x1E, 0xE3, 0x21, 0x74, 0xFD, 0x21, 0x69,
-    0xFD, 0x21, 0x6E, 0xFD, 0x41, 0x69, 0xBF, 0x2C, 0x44, 0x69, 0x79, 0x6F, 0x72, 0xC3, 0x13, 0xC3,
-    0x13, 0xFF, 0xF9, 0xFF, 0xFC, 0x41, 0x6C, 0xC4, 0x42, 0x21, 0x65, 0xFC, 0x21, 0x76, 0xFD, 0x43,
-    0x68, 0x79, 0x69, 0xFF, 0xE9, 0xC3, 0x52, 0xFF, 0xFD, 0x41, 0x6D, 0xC2, 0xB3, 0x4D, 0x61, 0x65,
-    0x67, 0x69, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x79, 0xFF, 0x70, 0xFF, 0x8C, 0xC3,
-    0x91, 0xFF, 0x99, 0xC7, 0x77, 0xFF, 0xAF, 0xFF, 0xB3, 0xC7, 0x31, 0xFF, 0xBA, 0xFF, 0xC4, 0xFF,
-    0xF2, 0xFF, 0xFC, 0xC4, 0x4D, 0xC1, 0x02, 0x21, 0x69, 0xC2, 0x84, 0x21, 0x70, 0xFA, 0xC3, 0x02,
-    0x81, 0x65, 0x6F, 0x72, 0xC3, 0x13, 0xFF, 0xFD, 0xC2, 0x7E, 0x43, 0x69, 0x6F, 0x79, 0xC4, 0x4A,
-    0xC2, 0xB1, 0xC2, 0xB1, 0x43, 0x65, 0x74, 0x75, 0xDB, 0xC7, 0xFF, 0xF6, 0xBB, 0x94, 0x41, 0x72,
-    0xD5, 0xAA, 0x21, 0x65, 0xFC, 0x43, 0x61, 0x6F, 0x68, 0xC2, 0xEC, 0xC2, 0xEC, 0xFF, 0xFD, 0xC1,
-    0x02, 0x81, 0x74, 0xC7, 0x19, 0x42, 0x6C, 0x74, 0xC2, 0x4F, 0xC2, 0x4F, 0x22, 0x61, 0x69, 0xF3,
-    0xF9, 0x47, 0x61, 0x63, 0x69, 0x6C, 0x6F, 0x70, 0x74, 0xC2, 0x7D, 0xFF, 0xBD, 0xFF, 0xD3, 0xC2,
-    0xD0, 0xC2, 0x98, 0xFF, 0xE4, 0xFF, 0xFB, 0x41, 0x65, 0xC0, 0x9D, 0x42, 0x2E, 0x73, 0xC2, 0x60,
-    0xC2, 0x29, 0xA0, 0x1F, 0x12, 0x21, 0x72, 0xFD, 0xA0, 0x0E, 0x72, 0x21, 0x72, 0xFD, 0x22, 0x65,
-    0x6F, 0xF7, 0xFD, 0xA1, 0x01, 0x41, 0x74, 0xFB, 0x23, 0x6C, 0x72, 0x73, 0xDF, 0xE3, 0xFB, 0xA0,
-    0x1F, 0x33, 0x21, 0x73, 0xFD, 0x42, 0x73, 0x6F, 0xC8, 0xFF, 0xFF, 0xFD, 0xC2, 0x01, 0x91, 0x65,
-    0x69, 0xFF, 0xF9, 0xE4, 0xC2, 0x43, 0x2E, 0x61, 0x65, 0xC2, 0x26, 0xC1, 0xEF, 0xC2, 0x62, 0x43,
-    0x63, 0x66, 0x73, 0xFF, 0xF6, 0xC2, 0x58, 0xC2, 0x58, 0x45, 0x61, 0x65, 0x68, 0x69, 0x6F, 0xF3,
-    0xF2, 0xFF, 0xCF, 0xFF, 0xE3, 0xFF, 0xF6, 0xC5, 0xD5, 0x41, 0x6F, 0xE9, 0x02, 0x21, 0x64, 0xFC,
-    0x42, 0x6C, 0x61, 0xC1, 0xFB, 0xFF, 0xFD, 0x41, 0x68, 0xBE, 0x52, 0x42, 0x63, 0x64, 0xBB, 0xF5,
-    0xBC, 0x7B, 0xC6, 0x02, 0x81, 0x62, 0x63, 0x65, 0x6C, 0x6E, 0x76, 0xFF, 0xEE, 0xFF, 0xF5, 0xC1,
-    0xCD, 0xC2, 0x3F, 0xFF, 0xF9, 0xC1, 0xB2, 0x43, 0x6E, 0x73, 0x74, 0xBB, 0x58, 0xBC, 0x50, 0xC2,
-    0x2A, 0x42, 0x6E, 0x72, 0xC2, 0x20, 0xFF, 0xF6, 0xA0, 0x1F, 0x63, 0x21, 0x2E, 0xFD, 0x21, 0x6E,
-    0xFD, 0x43, 0x73, 0x74, 0x61, 0xC1, 0xF6, 0xF5, 0x79, 0xFF, 0xFD, 0x41, 0x6C, 0xCC, 0xE4, 0x23,
-    0x65, 0x69, 0x6F, 0xE2, 0xF2, 0xFC, 0x42, 0x6C, 0x73, 0xC1, 0xA5, 0xC1, 0x89, 0x45, 0x64, 0x65,
-    0x69, 0x6E, 0x6F, 0xFB, 0xA9, 0xFF, 0xF9, 0xC1, 0xCB, 0xC8, 0x67, 0xC2, 0x7C, 0x41, 0x61, 0xC1,
-    0xBB, 0xA0, 0x12, 0x52, 0x21, 0x63, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x64, 0xFD, 0x21, 0x69, 0xFD,
-    0x59, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
-    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x78, 0xFA, 0x2B, 0xFA, 0x56, 0xFA, 0xA1,
-    0xFA, 0xE9, 0xFB, 0x03, 0xFB, 0x1F, 0xFB, 0x60, 0xFB, 0x79, 0xFB, 0x9F, 0xC1, 0x3C, 0xFB, 0xC1,
-    0xFC, 0x53, 0xFC, 0xDD, 0xFD, 0x69, 0xFD, 0x9B, 0xFD, 0xE0, 0xC2, 0xDA, 0xFE, 0x8D, 0xFF, 0x01,
-    0xFF, 0x69, 0xFF, 0x92, 0xFF, 0xCF, 0xFF, 0xDD, 0xFF, 0xED, 0xFF, 0xFD, 0x43, 0x61, 0x65, 0x74,
-    0xC1, 0x85, 0xC1, 0x85, 0xBA, 0x1C, 0x42, 0x6E, 0x74, 0xC2, 0xDA, 0xC1, 0x61, 0x21, 0x61, 0xF9,
-    0xC1, 0x01, 0x41, 0x6E, 0xBA, 0x02, 0x41, 0x74, 0xBD, 0x2D, 0x21, 0x61, 0xFC, 0xA1, 0x01, 0x41,
-    0x6D, 0xFD, 0x44, 0x61, 0x65, 0x74, 0x79, 0xB9, 0xF6, 0xD0, 0xDA, 0xBD, 0x09, 0xC1, 0x09, 0xC1,
-    0x01, 0xF1, 0x75, 0xC1, 0x52, 0xA0, 0x1F, 0x92, 0x21, 0x61, 0xFD, 0x42, 0x65, 0x72, 0xB9, 0xF5,
-    0xFF, 0xFD, 0x41, 0x65, 0xEC, 0x4B, 0xC1, 0x01, 0x81, 0x65, 0xBB, 0x61, 0x44, 0x62, 0x67, 0x6C,
-    0x6D, 0xBA, 0xAE, 0xFF, 0xEF, 0xFF, 0xF6, 0xFF, 0xFA, 0xC1, 0x02, 0x71, 0x6C, 0xB9, 0xD7, 0xC1,
-    0x02, 0x92, 0x73, 0xB9, 0xB9, 0x44, 0x61, 0x64, 0x65, 0x69, 0xFF, 0xE7, 0xC7, 0x8F, 0xFF, 0xF4,
-    0xFF, 0xFA, 0xC1, 0x02, 0x81, 0x72, 0xC0, 0x82, 0x42, 0x69, 0x79, 0xCD, 0xE4, 0xC0, 0x7C, 0x43,
-    0x65, 0x68, 0x72, 0xFF, 0xF3, 0xFF, 0xF9, 0xE3, 0xCA, 0xCB, 0x03, 0xD1, 0x63, 0x64, 0x67, 0x69,
-    0x6C, 0x6E, 0x70, 0x72, 0x74, 0x76, 0x79, 0xFF, 0x73, 0xC1, 0x80, 0xFF, 0x84, 0xFF, 0x87, 0xFF,
-    0x94, 0xFF, 0x99, 0xFF, 0xA6, 0xFF, 0xDC, 0xFF, 0xF6, 0xB9, 0x8F, 0xC1, 0x9B, 0xC1, 0x0E, 0xA2,
-    0x72, 0xC6, 0xA8, 0xC2, 0x02, 0x71, 0x61, 0x63, 0xBE, 0xAE, 0xB9, 0x65, 0xC2, 0x03, 0x42, 0x65,
-    0x69, 0xC1, 0x68, 0xFF, 0xF7, 0xC2, 0x01, 0x41, 0x64, 0x76, 0xB9, 0x53, 0xBF, 0xB3, 0x42, 0x61,
-    0x69, 0xC0, 0xB3, 0xB9, 0xE1, 0x41, 0x68, 0xB9, 0x43, 0x43, 0x61, 0x63, 0x74, 0xC0, 0xC1, 0xC1,
-    0x30, 0xFF, 0xFC, 0x43, 0x2E, 0x62, 0x67, 0xC1, 0x26, 0xBA, 0x17, 0xC1, 0x26, 0xC1, 0x01, 0x41,
-    0x73, 0xBE, 0x16, 0x42, 0x61, 0x65, 0xBD, 0x5A, 0xB9, 0x4C, 0x48, 0x61, 0x69, 0x6D, 0x6E, 0x6F,
-    0x74, 0x75, 0x76, 0xFF, 0xE9, 0xFF, 0xF3, 0xFF, 0xF9, 0xC1, 0x0F, 0xB9, 0x30, 0xBB, 0xFD, 0xBF,
-    0xFA, 0xB9, 0x2A, 0xC2, 0x02, 0x81, 0x65, 0x69, 0xC0, 0xB4, 0xC5, 0xDA, 0x4B, 0x2E, 0x61, 0x63,
-    0x64, 0x65, 0x6B, 0x6C, 0x6E, 0x6F, 0x72, 0x74, 0xBF, 0xCD, 0xFF, 0x91, 0xC3, 0x01, 0xFF, 0xA0,
-    0xFF, 0xA9, 0xB8, 0xFC, 0xFF, 0xB2, 0xFF, 0xBD, 0xC0, 0xAB, 0xFF, 0xDE, 0xFF, 0xF7, 0x41, 0x72,
-    0xBC, 0x4B, 0x43, 0x6E, 0x72, 0x73, 0xBC, 0x9F, 0xC0, 0x3F, 0xC1, 0x75, 0x41, 0x74, 0xD1, 0xAF,
-    0x41, 0x74, 0xBF, 0x13, 0xA0, 0x1F, 0xB3, 0x21, 0x6C, 0xFD, 0x21, 0x65, 0xFD, 0x22, 0x6E, 0x74,
-    0xF3, 0xFD, 0x21, 0x61, 0xFB, 0x46, 0x63, 0x65, 0x6E, 0x73, 0x7A, 0x6C, 0xBF, 0xF3, 0xC1, 0x7B,
-    0xBF, 0xBE, 0xFF, 0xE7, 0xC0, 0xBF, 0xFF, 0xFD, 0x42, 0x65, 0x69, 0xC0, 0xAC, 0xC1, 0x68, 0x43,
-    0x62, 0x6E, 0x72, 0xC0, 0xA5, 0xFF, 0xF9, 0xB8, 0x99, 0x4A, 0x2E, 0x61, 0x65, 0x69, 0x6C, 0x6F,
-    0x73, 0x74, 0x75, 0x79, 0xBF, 0x60, 0xFF, 0xB5, 0xFF, 0xB9, 0xFF, 0xDC, 0xC2, 0x94, 0xFF, 0xF6,
-    0xBF, 0x60, 0xBF, 0xA2, 0xC1, 0x57, 0xCD, 0xF8, 0xC1, 0x01, 0xE1, 0x6E, 0xB8, 0x6A, 0xA0, 0x1E,
-    0xB3, 0x21, 0x64, 0xFD, 0x43, 0x69, 0x79, 0x61, 0xC0, 0x0C, 0xBF, 0xCD, 0xFF, 0xFD, 0xC3, 0x01,
-    0x41, 0x61, 0x65, 0x69, 0xBF, 0x2E, 0xBF, 0x6D, 0xC1, 0x22, 0x42, 0x63, 0x6E, 0xC0, 0x5A, 0xBF,
-    0x61, 0x41, 0x61, 0xE8, 0xEE, 0x21, 0x72, 0xFC, 0xC3, 0x02, 0x81, 0x2E, 0x64, 0x6F, 0xC0, 0x31,
-    0xB8, 0x3A, 0xC0, 0x31, 0xC1, 0x0F, 0x02, 0x6E, 0xB8, 0x2E, 0xC1, 0x02, 0x21, 0x61, 0xBF, 0x0A,
-    0x42, 0x68, 0x75, 0xFF, 0xFA, 0xC2, 0x2D, 0x49, 0x61, 0x63, 0x64, 0x65, 0x67, 0x6C, 0x6E, 0x6F,
-    0x74, 0xFF, 0xB1, 0xFF, 0xBD, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xDE, 0xC4, 0x75, 0xFF, 0xE1, 0xFF,
-    0xED, 0xFF, 0xF9, 0xA0, 0x0F, 0x23, 0x42, 0x6E, 0x73, 0xC0, 0x0E, 0xBC, 0xED, 0xC1, 0x00, 0x51,
-    0x61, 0xBA, 0xF6, 0x41, 0x62, 0xBE, 0x55, 0x21, 0x61, 0xFC, 0x45, 0x61, 0x65, 0x67, 0x6E, 0x63,
-    0xB8, 0x00, 0xBA, 0xE9, 0xBE, 0xBF, 0xFF, 0xF3, 0xFF, 0xFD, 0xC1, 0x00, 0x51, 0x62, 0xB7, 0xD8,
-    0x21, 0x6D, 0xFA, 0xC4, 0x0F, 0x53, 0x61, 0x69, 0x6F, 0x75, 0xFF, 0xD3, 0xFF, 0xE7, 0xB8, 0x96,
-    0xFF, 0xFD, 0xA0, 0x0F, 0x82, 0x42, 0x6D, 0x74, 0xBE, 0x9F, 0xFF, 0xFD, 0xA0, 0x0F, 0xA2, 0xC2,
-    0x00, 0xC1, 0x74, 0x63, 0xC0, 0x81, 0xE8, 0x2D, 0x21, 0x6E, 0xF7, 0xA0, 0x1F, 0xE2, 0x21, 0x6F,
-    0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x68, 0xFD, 0x43, 0x74, 0x65, 0x70, 0xB7, 0xBF,
-    0xBA, 0xC6, 0xFF, 0xFD, 0x41, 0x2E, 0xCC, 0xFD, 0x22, 0x79, 0x65, 0xF2, 0xFC, 0xC1, 0x06, 0x32,
-    0x79, 0xBE, 0xF4, 0xC1, 0x03, 0xD1, 0x73, 0xB7, 0x91, 0xC1, 0x01, 0x41, 0x61, 0xBE, 0xE8, 0x41,
-    0x6E, 0xC0, 0x41, 0x4C, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75,
-    0xBE, 0xDE, 0xCA, 0x73, 0xFF, 0xB2, 0xFF, 0xB9, 0xFF, 0xC5, 0xFF, 0xE5, 0xC1, 0x5B, 0xBE, 0xDE,
-    0xFF, 0xEA, 0xFF, 0xF0, 0xFF, 0xF6, 0xFF, 0xFC, 0xC5, 0x02, 0x11, 0x64, 0x6C, 0x6E, 0x72, 0x74,
-    0xBF, 0x41, 0xBE, 0x24, 0xBE, 0x9F, 0xBE, 0x9F, 0xBE, 0x9F, 0x41, 0x69, 0xBB, 0x5F, 0x21, 0x73,
-    0xFC, 0xC3, 0x04, 0x02, 0x61, 0x65, 0x6F, 0xCE, 0xA0, 0xFF, 0xE7, 0xFF, 0xFD, 0x41, 0x79, 0xB7,
-    0xC2, 0x42, 0x69, 0x6F, 0xBF, 0xEF, 0xB7, 0x3F, 0x41, 0x61, 0xB7, 0xF7, 0x41, 0x6C, 0xB7, 0xDA,
-    0x43, 0x65, 0x73, 0x70, 0xBE, 0x67, 0xBF, 0x24, 0xFF, 0xFC, 0xA0, 0x20, 0x02, 0x21, 0x63, 0xFD,
-    0x21, 0x61, 0xFD, 0x41, 0x75, 0xB7, 0x11, 0x21, 0x65, 0xFC, 0x4A, 0x63, 0x65, 0x66, 0x6C, 0x72,
-    0x73, 0x74, 0x76, 0x6D, 0x6E, 0xFF, 0xD7, 0xB8, 0x9F, 0xFF, 0xDE, 0xB7, 0xF7, 0xB7, 0x10, 0xFF,
-    0xE6, 0xBF, 0x5A, 0xB7, 0x10, 0xFF, 0xF6, 0xFF, 0xFD, 0xA0, 0x0F, 0xC2, 0x21, 0x74, 0xFD, 0xC1,
-    0x00, 0x51, 0x6F, 0xB8, 0x68, 0x43, 0x65, 0x6E, 0x73, 0xC7, 0x05, 0xFF, 0xF7, 0xFF, 0xFA, 0x41,
-    0x73, 0xB8, 0x67, 0x21, 0x73, 0xFC, 0xA0, 0x20, 0x22, 0x21, 0x2E, 0xFD, 0x21, 0x79, 0xFD, 0x21,
-    0x74, 0xFD, 0x43, 0x61, 0x65, 0x69, 0xBE, 0x05, 0xFF, 0xF1, 0xFF, 0xFD, 0x41, 0x69, 0xBB, 0x97,
-    0x41, 0x65, 0xBD, 0x08, 0x46, 0x63, 0x66, 0x6C, 0x73, 0x74, 0x67, 0xFF, 0xEE, 0xFF, 0xF8, 0xB6,
-    0xB6, 0xBA, 0x69, 0xB6, 0xB0, 0xFF, 0xFC, 0xC4, 0x02, 0x81, 0x61, 0x65, 0x69, 0x6F, 0xFF, 0x66,
-    0xFF, 0x93, 0xFF, 0xBE, 0xFF, 0xED, 0xA0, 0x20, 0x64, 0x22, 0x64, 0x66, 0xFD, 0xFD, 0xA1, 0x20,
-    0x42, 0x6F, 0xFB, 0x21, 0x64, 0xFB, 0xA1, 0x02, 0x11, 0x75, 0xFD, 0xC3, 0x08, 0x63, 0x65, 0x68,
-    0x69, 0xFF, 0xFB, 0xBD, 0xD6, 0xF2, 0xF1, 0x41, 0x62, 0xF4, 0x24, 0xA0, 0x20, 0xA2, 0x21, 0x74,
-    0xFD, 0x21, 0x61, 0xFD, 0x21, 0x6D, 0xFD, 0xA0, 0x20, 0xC2, 0x21, 0x6C, 0xFD, 0x21, 0x6F, 0xFD,
-    0xC8, 0x03, 0xE2, 0x61, 0x65, 0x68, 0x69, 0x75, 0x77, 0x6F, 0x72, 0xFF, 0xE7, 0xBD, 0x79, 0xBD,
-    0x79, 0xB7, 0xE9, 0xB6, 0x4B, 0xBE, 0x39, 0xFF, 0xF4, 0xFF, 0xFD, 0xA0, 0x13, 0xE2, 0x21, 0x63,
-    0xFD, 0x21, 0x73, 0xFD, 0xA1, 0x00, 0x71, 0x65, 0xFD, 0x42, 0x65, 0x69, 0xBB, 0x1C, 0xD2, 0x7F,
-    0xC3, 0x02, 0x81, 0x65, 0x72, 0x74, 0xC9, 0xE0, 0xBD, 0x2B, 0xFF, 0xF9, 0x49, 0x62, 0x65, 0x66,
-    0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0xFF, 0xE8, 0xB6, 0x0C, 0xB6, 0x0C, 0xC6, 0x11, 0xBD, 0x75,
-    0xC0, 0x11, 0xB6, 0x0F, 0xBE, 0xD4, 0xFF, 0xF4, 0x53, 0x61, 0x62, 0x64, 0x65, 0x66, 0x67, 0x68,
-    0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0xFC, 0x61, 0xC4, 0xA2,
-    0xBD, 0x59, 0xFC, 0xF4, 0xBC, 0xC1, 0xBC, 0xC1, 0xFD, 0x61, 0xFD, 0xCF, 0xFD, 0xEB, 0xFE, 0x1B,
-    0xC4, 0xA2, 0xC5, 0x32, 0xFE, 0x7B, 0xFE, 0xB9, 0xFF, 0x5F, 0xFF, 0x83, 0xFF, 0xA8, 0xFF, 0xE4,
-    0xBD, 0x3F, 0xA0, 0x20, 0xE2, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0xC2, 0x21,
-    0x03, 0x72, 0x73, 0xBA, 0xC5, 0xBA, 0xC5, 0x21, 0x69, 0xF7, 0x43, 0x76, 0x69, 0x73, 0xB5, 0xB6,
-    0xFF, 0xF1, 0xFF, 0xFD, 0x43, 0x2E, 0x72, 0x74, 0xC4, 0xBC, 0xBD, 0xA0, 0xBD, 0xA0, 0xA0, 0x21,
-    0x32, 0x21, 0x73, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD, 0x41, 0x72, 0xDF,
-    0x21, 0x21, 0x61, 0xFC, 0x22, 0x6E, 0x76, 0xF6, 0xFD, 0xA3, 0x02, 0x81, 0x61, 0x65, 0x69, 0xD1,
-    0xDB, 0xFB, 0x21, 0x75, 0xF7, 0x41, 0x63, 0xBD, 0xD5, 0x42, 0x69, 0x6F, 0xFF, 0xFC, 0xEB, 0x99,
-    0x21, 0x6C, 0xF9, 0xC2, 0x02, 0x41, 0x69, 0x6F, 0xBC, 0x68, 0xFF, 0xFD, 0x42, 0x65, 0x75, 0xB5,
-    0x46, 0xBC, 0x5F, 0x42, 0x68, 0x6C, 0xFF, 0xF9, 0xBC, 0x19, 0x42, 0x66, 0x74, 0xC3, 0x1A, 0xB5,
-    0x3E, 0xA0, 0x21, 0x54, 0x21, 0x7A, 0xFD, 0x21, 0x69, 0xFD, 0xA1, 0x00, 0x71, 0x72, 0xFD, 0x42,
-    0x74, 0x6E, 0xFF, 0xFB, 0xBC, 0x5A, 0x43, 0x65, 0x69, 0x6F, 0xFF, 0xF9, 0xBC, 0x53, 0xC1, 0xDD,
-    0x45, 0x65, 0x67, 0x69, 0x6F, 0x68, 0xB8, 0x81, 0xB5, 0x55, 0xBD, 0x09, 0xBB, 0xF4, 0xEE, 0xBC,
-    0x42, 0x65, 0x68, 0xB7, 0xA8, 0xC2, 0xBB, 0xC1, 0x00, 0x41, 0x66, 0xB5, 0x19, 0x43, 0x63, 0x65,
-    0x69, 0xB5, 0x13, 0xFF, 0xFA, 0xD0, 0xE4, 0x41, 0x6E, 0xBA, 0x0F, 0x21, 0x6F, 0xFC, 0x21, 0x69,
-    0xFD, 0x42, 0x61, 0x65, 0xE3, 0x2A, 0xCB, 0xCB, 0x41, 0x69, 0xC0, 0x36, 0x41, 0x67, 0xEE, 0x20,
-    0x42, 0x67, 0x6F, 0xE9, 0x8B, 0xFF, 0xFC, 0x21, 0x69, 0xF9, 0x50, 0x62, 0x63, 0x66, 0x69, 0x6C,
-    0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x7A, 0x64, 0x6F, 0xFF, 0x79, 0xFF, 0x89, 0xFF,
-    0x90, 0xBB, 0xFF, 0xBE, 0xD6, 0xFF, 0xAC, 0xFF, 0xB6, 0xFF, 0xC6, 0xFF, 0xD3, 0xBB, 0xFF, 0xFF,
-    0xE4, 0xB6, 0x37, 0xFF, 0xE7, 0xFF, 0xEE, 0xFF, 0xFD, 0xF1, 0x85, 0x42, 0x62, 0x67, 0xBC, 0x8E,
-    0xBC, 0x8E, 0xA0, 0x21, 0x92, 0x42, 0x2E, 0x65, 0xBB, 0x6F, 0xFF, 0xFD, 0xC2, 0x02, 0x11, 0x65,
-    0x67, 0xBB, 0x60, 0xFF, 0xF9, 0xC2, 0x00, 0xD1, 0x66, 0x6E, 0xB4, 0x83, 0xFF, 0xF7, 0xC3, 0x02,
-    0xB1, 0x61, 0x69, 0x6F, 0xFF, 0xDD, 0xFF, 0xF7, 0xBB, 0xE3, 0xC1, 0x02, 0x11, 0x6E, 0xB4, 0x68,
-    0x42, 0x61, 0x65, 0xBB, 0xB7, 0xB4, 0x6B, 0x42, 0x62, 0x74, 0xD2, 0x9E, 0xBB, 0xCA, 0x41, 0x6D,
-    0xB5, 0xE9, 0xA4, 0x02, 0xB1, 0x65, 0x68, 0x69, 0x75, 0xE8, 0xEE, 0xF5, 0xFC, 0x41, 0x6C, 0xBC,
-    0x3C, 0xC1, 0x00, 0x41, 0x67, 0xBB, 0x5A, 0xC3, 0x02, 0x81, 0x61, 0x65, 0x6E, 0xB4, 0x41, 0xB4,
-    0x44, 0xFF, 0xFA, 0x22, 0x61, 0x69, 0xEA, 0xF4, 0x45, 0x6C, 0x6E, 0x72, 0x76, 0x77, 0xBB, 0x70,
-    0xBB, 0x43, 0xC3, 0x12, 0xBC, 0xF8, 0xBB, 0x99, 0x41, 0x61, 0xBB, 0x68, 0x21, 0x72, 0xFC, 0x41,
-    0x70, 0xB8, 0x36, 0x42, 0x6C, 0x6D, 0xC5, 0xD6, 0xFF, 0xFC, 0xA0, 0x21, 0xB3, 0x21, 0x72, 0xFD,
-    0x21, 0x70, 0xFD, 0xA0, 0x21, 0xE2, 0x21, 0x67, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x61, 0xFD, 0x44,
-    0x6F, 0x72, 0x69, 0x74, 0xFF, 0xE4, 0xBB, 0xA1, 0xFF, 0xF1, 0xFF, 0xFD, 0x42, 0x73, 0x74, 0xBA,
-    0xFF, 0xB4, 0x04, 0xC2, 0x03, 0x42, 0x65, 0x69, 0xBB, 0x25, 0xFF, 0xF9, 0xC1, 0x02, 0x81, 0x72,
-    0xBB, 0x64, 0x44, 0x61, 0x65, 0x69, 0x79, 0xDE, 0x03, 0xFF, 0xFA, 0xBA, 0xE9, 0xBB, 0x3F, 0x41,
-    0x69, 0xF4, 0xE0, 0x42, 0x69, 0x75, 0xBB, 0x05, 0xBA, 0xA1, 0x42, 0x61, 0x65, 0xD1, 0xFB, 0xB3,
-    0xBE, 0x21, 0x74, 0xF9, 0x41, 0x73, 0xBD, 0x9A, 0x43, 0x69, 0x6F, 0x75, 0xBB, 0x5F, 0xFF, 0xFC,
-    0xBA, 0xF0, 0xC3, 0x08, 0xA2, 0x69, 0x6F, 0x75, 0xBB, 0x97, 0xB3, 0xA0, 0xBA, 0x82, 0x41, 0x69,
-    0xE6, 0x62, 0xC2, 0x00, 0xD1, 0x61, 0x72, 0xBB, 0x91, 0xBA, 0xA9, 0x44, 0x2E, 0x70, 0x73, 0x74,
-    0xBB, 0x7E, 0xBD, 0x73, 0xFF, 0xF3, 0xFF, 0xF7, 0x41, 0x7A, 0xD4, 0x02, 0x41, 0x75, 0xCE, 0xF2,
-    0xA1, 0x01, 0xE1, 0x62, 0xFC, 0x21, 0x69, 0xFB, 0x43, 0x65, 0x69, 0x72, 0xBD, 0x82, 0xFF, 0xF0,
-    0xFF, 0xFD, 0xC1, 0x00, 0xD1, 0x74, 0xE1, 0xA9, 0x43, 0x2E, 0x73, 0x74, 0xBB, 0xF5, 0xBA, 0x3C,
-    0xBA, 0x3C, 0x42, 0x6C, 0x72, 0xB3, 0x68, 0xFF, 0xF6, 0x41, 0x6C, 0xD9, 0x95, 0xC4, 0x00, 0xD1,
-    0x61, 0x65, 0x69, 0x6F, 0xC9, 0x6A, 0xFF, 0xF5, 0xBB, 0x46, 0xFF, 0xFC, 0x52, 0x2E, 0x61, 0x62,
-    0x63, 0x64, 0x66, 0x67, 0x69, 0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0xC2,
-    0x64, 0xFF, 0x0C, 0xFF, 0x20, 0xFF, 0x43, 0xFF, 0x57, 0xFF, 0x66, 0xFF, 0x73, 0xBA, 0x33, 0xFF,
-    0x77, 0xFF, 0x85, 0xBA, 0x7C, 0xFF, 0x8C, 0xFF, 0x96, 0xFF, 0xAF, 0xFF, 0xCC, 0xFF, 0xD6, 0xFF,
-    0xF1, 0xBF, 0x4B, 0xC2, 0x02, 0xB1, 0x75, 0x79, 0xB3, 0x05, 0xBA, 0xF6, 0x42, 0x72, 0x74, 0xBA,
-    0x0F, 0xBA, 0x4B, 0xC1, 0x00, 0x51, 0x67, 0xBA, 0x08, 0x44, 0x63, 0x6E, 0x73, 0x74, 0xBA, 0x3E,
-    0xFF, 0xFA, 0xB9, 0xC3, 0xB9, 0xC3, 0xC5, 0x02, 0x81, 0x65, 0x69, 0x6C, 0x6F, 0x75, 0xFF, 0xE6,
-    0xFF, 0xF3, 0xBB, 0x54, 0xCF, 0x42, 0xBA, 0x31, 0xC2, 0x02, 0x31, 0x2E, 0x61, 0xB9, 0xA1, 0xCE,
-    0xB9, 0xC3, 0x01, 0xE1, 0x62, 0x67, 0x6C, 0xB2, 0xC7, 0xBA, 0x30, 0xBB, 0x12, 0xC1, 0x01, 0x41,
-    0x61, 0xB2, 0xCD, 0xC2, 0x01, 0x91, 0x64, 0x65, 0xBB, 0x7D, 0xBA, 0x1E, 0x44, 0x61, 0x65, 0x69,
-    0x6F, 0xBD, 0x82, 0xBA, 0x9D, 0xFF, 0xF7, 0xBA, 0x9D, 0x42, 0x63, 0x74, 0xB9, 0xB2, 0xB9, 0xB2,
-    0x43, 0x6E, 0x72, 0x74, 0xFF, 0xF9, 0xB9, 0xD8, 0xB9, 0x74, 0x42, 0x61, 0x69, 0xB5, 0x5F, 0xBB,
-    0x56, 0x41, 0x69, 0xC5, 0xC8, 0x44, 0x61, 0x69, 0x6F, 0x70, 0xFB, 0x0A, 0xB2, 0x9B, 0xBA, 0x8F,
-    0xB2, 0xC0, 0xC1, 0x02, 0x11, 0x2E, 0xBB, 0x3E, 0x44, 0x61, 0x64, 0x65, 0x67, 0xFF, 0xFA, 0xB2,
-    0x70, 0xB2, 0x70, 0xB2, 0x70, 0xC1, 0x02, 0xE1, 0x65, 0xB2, 0x84, 0xC1, 0x02, 0x81, 0x69, 0xE4,
-    0xF8, 0x22, 0x68, 0x6C, 0xF4, 0xFA, 0xC4, 0x02, 0x11, 0x2E, 0x63, 0x68, 0x70, 0xBA, 0x43, 0xB2,
-    0x52, 0xB9, 0xA1, 0xB2, 0x52, 0x41, 0x62, 0xE0, 0x56, 0x42, 0x2E, 0x73, 0xB2, 0x57, 0xB2, 0x57,
-    0x42, 0x64, 0x72, 0xBA, 0xF1, 0xFF, 0xF9, 0xC1, 0x02, 0x81, 0x72, 0xB2, 0x49, 0x44, 0x61, 0x65,
-    0x69, 0x75, 0xFF, 0xE8, 0xFF, 0xF3, 0xC2, 0x30, 0xFF, 0xFA, 0x42, 0x6C, 0x74, 0xB2, 0x36, 0xB2,
-    0x30, 0xA0, 0x16, 0x42, 0x21, 0x6C, 0xFD, 0x43, 0x65, 0x69, 0x6F, 0xFF, 0xF3, 0xB2, 0x23, 0xFF,
-    0xFD, 0x4F, 0x61, 0x62, 0x63, 0x64, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x73, 0x74,
-    0x76, 0xFF, 0x40, 0xFF, 0x4C, 0xFF, 0x5B, 0xC0, 0x3A, 0xFF, 0x6F, 0xFF, 0x79, 0xFF, 0x80, 0xFF,
-    0x84, 0xFF, 0x97, 0xB9, 0x47, 0xFF, 0xB0, 0xB9, 0xF8, 0xFF, 0xB5, 0xFF, 0xDC, 0xFF, 0xF6, 0x42,
-    0x65, 0x69, 0xB9, 0x42, 0xB9, 0x5B, 0xA0, 0x22, 0x01, 0x41, 0x6F, 0xB9, 0x0F, 0x41, 0x75, 0xBA,
-    0x3D, 0x21, 0x61, 0xFC, 0x21, 0x2E, 0xF2, 0x46, 0x65, 0x6C, 0x2E, 0x68, 0x72, 0x73, 0xBD, 0x44,
-    0xFF, 0xE8, 0xFF, 0xEF, 0xFF, 0xF2, 0xFF, 0xFA, 0xFF, 0xFD, 0x41, 0x75, 0xBA, 0x43, 0xC2, 0x00,
-    0x51, 0x64, 0x71, 0xB8, 0xDB, 0xFF, 0xFC, 0xC1, 0x01, 0x41, 0x68, 0xB8, 0x7D, 0x42, 0x67, 0x73,
-    0xB9, 0x8C, 0xFF, 0xFA, 0xC3, 0x02, 0xB1, 0x65, 0x69, 0x6F, 0xFF, 0xEA, 0xFF, 0xF9, 0xC8, 0xCA,
-    0xC2, 0x02, 0x11, 0x6E, 0x72, 0xB8, 0xD7, 0xBC, 0x86, 0xC1, 0x01, 0xE1, 0x2E, 0xB9, 0x70, 0x21,
-    0x67, 0xFA, 0x43, 0x6E, 0x6F, 0x74, 0xFF, 0xFD, 0xB9, 0x67, 0xB8, 0xC5, 0xC4, 0x02, 0xB1, 0x61,
-    0x65, 0x69, 0x79, 0xE4, 0x07, 0xFF, 0xE4, 0xFF, 0xF6, 0xB9, 0x5D, 0x44, 0x6C, 0x72, 0x74, 0x79,
-    0xB8, 0xAC, 0xB9, 0x4E, 0xB8, 0x31, 0xB8, 0xAC, 0xA0, 0x09, 0x82, 0x44, 0x63, 0x73, 0x74, 0x76,
-    0xB8, 0x21, 0xFF, 0xFD, 0xB8, 0x9C, 0xB8, 0x9C, 0xC1, 0x00, 0x51, 0x75, 0xB9, 0x31, 0x45, 0x61,
-    0x65, 0x69, 0x6F, 0x75, 0xDA, 0xBD, 0xFF, 0xDD, 0xFF, 0xED, 0xFF, 0xFA, 0xB8, 0x89, 0xA0, 0x1B,
-    0x52, 0x21, 0x74, 0xFD, 0x42, 0x6C, 0x6F, 0xB1, 0x36, 0xFF, 0xFD, 0xC1, 0x02, 0x11, 0x72, 0xB8,
-    0x30, 0xA0, 0x22, 0x12, 0x21, 0x65, 0xFD, 0x21, 0x64, 0xFD, 0x21, 0x69, 0xFD, 0xC2, 0x02, 0x31,
-    0x6C, 0x70, 0xEA, 0xAF, 0xFF, 0xFD, 0x42, 0x65, 0x69, 0xB8, 0x42, 0xB8, 0xFD, 0xC1, 0x00, 0xD1,
-    0x65, 0xBF, 0xDD, 0x41, 0x65, 0xC3, 0xF3, 0x42, 0x74, 0x73, 0xB5, 0x0E, 0xBA, 0xB4, 0x43, 0x65,
-    0x69, 0x70, 0xFF, 0xF9, 0xB0, 0xEA, 0xB0, 0xEA, 0x41, 0x73, 0xEE, 0xA3, 0x44, 0x61, 0x65, 0x69,
-    0x74, 0xB5, 0x11, 0xB0, 0xDC, 0xFF, 0xFC, 0xB1, 0xD5, 0x42, 0x6D, 0x74, 0xC6, 0x38, 0xB9, 0x97,
-    0x42, 0x65, 0x69, 0xB7, 0xDE, 0xC0, 0xCD, 0x42, 0x69, 0x6F, 0xB0, 0xD3, 0xB7, 0x9D, 0x42, 0x70,
-    0x73, 0xBE, 0xED, 0xB0, 0xBA, 0x41, 0x6F, 0xB9, 0x28, 0x43, 0x68, 0x79, 0x72, 0xB8, 0x57, 0xB8,
-    0x18, 0xFF, 0xFC, 0x42, 0x61, 0x65, 0xB8, 0x0E, 0xC2, 0x66, 0x4F, 0x62, 0x63, 0x65, 0x66, 0x6B,
-    0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x76, 0x78, 0xFF, 0x7A, 0xFF, 0x81, 0xFF, 0x93,
-    0xFF, 0x9C, 0xFF, 0xA3, 0xFF, 0xA9, 0xFF, 0xB4, 0xFF, 0xC2, 0xFF, 0xCF, 0xFF, 0xD6, 0xFF, 0xDD,
-    0xFF, 0xE4, 0xFF, 0xEF, 0xFF, 0xF9, 0xB0, 0xB6, 0x44, 0x61, 0x6E, 0x72, 0x74, 0xB8, 0x61, 0xB7,
-    0xB8, 0xB7, 0xF8, 0xB7, 0xBF, 0xA0, 0x22, 0x32, 0x21, 0x69, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x75,
-    0xFD, 0xC5, 0x02, 0xB1, 0x65, 0x68, 0x69, 0x6F, 0x61, 0xFF, 0xE7, 0xD0, 0x8A, 0xE4, 0xBD, 0xB7,
-    0xA6, 0xFF, 0xFD, 0x44, 0x63, 0x66, 0x6F, 0x73, 0xB0, 0x45, 0xB0, 0x45, 0xB8, 0x36, 0xB1, 0xAE,
-    0x42, 0x6F, 0x76, 0xB0, 0x38, 0xB0, 0x38, 0x42, 0x6E, 0x73, 0xB0, 0x2B, 0xB0, 0x2B, 0xC4, 0x07,
-    0x42, 0x65, 0x69, 0x6F, 0x79, 0xFF, 0xE5, 0xFF, 0xF2, 0xFF, 0xF9, 0xB9, 0xA3, 0xC1, 0x02, 0xB1,
-    0x74, 0xBD, 0xF7, 0xC1, 0x02, 0x21, 0x72, 0xB0, 0x15, 0x41, 0x69, 0xE7, 0x13, 0x21, 0x64, 0xFC,
-    0x42, 0x2E, 0x61, 0xB6, 0xE4, 0xFF, 0xFD, 0xC4, 0x02, 0x11, 0x63, 0x72, 0x73, 0x76, 0xFF, 0xEC,
-    0xFF, 0xF9, 0xB7, 0x14, 0xB2, 0xE4, 0xC1, 0x02, 0xB1, 0x61, 0xB6, 0xC6, 0xC1, 0x02, 0xB1, 0x62,
-    0xCE, 0x29, 0xC8, 0x04, 0x22, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6F, 0x70, 0x77, 0xFF, 0xCB, 0xB7,
-    0x4F, 0xFF, 0xE5, 0xFF, 0xF4, 0xFF, 0xFA, 0xC3, 0xDE, 0xB8, 0x58, 0xB6, 0xBA, 0x41, 0x68, 0xB5,
-    0x14, 0x42, 0x63, 0x67, 0xFF, 0xFC, 0xB7, 0xB8, 0x43, 0x62, 0x6E, 0x6F, 0xB7, 0x0F, 0xCC, 0x2B,
-    0xAF, 0xD8, 0x43, 0x69, 0x6C, 0x79, 0xB1, 0x45, 0xAF, 0xB0, 0xB7, 0xA7, 0xC7, 0x02, 0xB1, 0x62,
-    0x64, 0x65, 0x67, 0x6C, 0x73, 0x76, 0xB6, 0x88, 0xAF, 0xAC, 0xD9, 0x2F, 0xB6, 0xFB, 0xFF, 0xF6,
-    0xCA, 0x1A, 0xB7, 0x9D, 0x41, 0x68, 0xB4, 0xB2, 0x21, 0x70, 0xFC, 0x43, 0x69, 0x6F, 0x65, 0xB6,
-    0xDC, 0xFF, 0xFD, 0xFD, 0xC2, 0x41, 0x6F, 0xFD, 0xB8, 0x46, 0x61, 0x65, 0x69, 0x72, 0x73, 0x68,
-    0xFF, 0xB8, 0xFF, 0xBF, 0xFF, 0xD3, 0xFF, 0xF2, 0xBB, 0x8E, 0xFF, 0xFC, 0x42, 0x6C, 0x6E, 0xCE,
-    0xEC, 0xB6, 0x7F, 0x41, 0x70, 0xC6, 0x49, 0xC2, 0x02, 0x81, 0x6B, 0x74, 0xAF, 0x82, 0xB2, 0x74,
-    0x48, 0x61, 0x65, 0x67, 0x69, 0x6D, 0x6E, 0x73, 0x74, 0xB6, 0x6B, 0xFF, 0xEC, 0xC5, 0x77, 0xBB,
-    0x6B, 0xFF, 0xF3, 0xFF, 0xF7, 0xD1, 0x16, 0xD2, 0x91, 0x41, 0x6C, 0xB7, 0xB1, 0xC6, 0x02, 0x31,
-    0x6C, 0x6E, 0x72, 0x73, 0x79, 0x69, 0xAF, 0xFC, 0xB6, 0x8A, 0xB6, 0xC3, 0xB6, 0x83, 0xB6, 0x8A,
-    0xFF, 0xFC, 0x42, 0x63, 0x76, 0xB6, 0x75, 0xAF, 0x26, 0x43, 0x65, 0x69, 0x6F, 0xFF, 0xE4, 0xFF,
-    0xF9, 0xB6, 0x6E, 0x41, 0x67, 0xE2, 0x9D, 0x43, 0x63, 0x6E, 0x74, 0xB6, 0x7A, 0xFF, 0xFC, 0xB6,
-    0x24, 0x41, 0x63, 0xB6, 0x47, 0x21, 0x73, 0xFC, 0x58, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
-    0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79,
-    0x7A, 0xFA, 0x32, 0xFA, 0x86, 0xFA, 0xAA, 0xFA, 0xCB, 0xFB, 0xC4, 0xFB, 0xFB, 0xFC, 0x1E, 0xFC,
-    0x30, 0xFC, 0xF9, 0xB6, 0x4F, 0xFD, 0x3F, 0xFD, 0x6C, 0xFD, 0x94, 0xFD, 0xC6, 0xFE, 0x62, 0xFE,
-    0xA9, 0xFE, 0xD6, 0xFF, 0x1A, 0xFF, 0x81, 0xFF, 0xA8, 0xFF, 0xE1, 0xB7, 0x72, 0xFF, 0xEF, 0xFF,
-    0xFD, 0x43, 0x6B, 0x72, 0x74, 0xB7, 0x7F, 0xB1, 0x96, 0xB6, 0x06, 0x42, 0x63, 0x77, 0xB0, 0x59,
-    0xAE, 0xD4, 0x21, 0x73, 0xF9, 0x45, 0x61, 0x6D, 0x6F, 0x74, 0x65, 0xD7, 0x15, 0xAE, 0xA3, 0xB5,
-    0x7F, 0xAE, 0xA3, 0xFF, 0xFD, 0x42, 0x63, 0x64, 0xB6, 0x9F, 0xAE, 0xD0, 0xA0, 0x22, 0x53, 0x21,
-    0x6C, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x72, 0xFD, 0xA1, 0x02, 0xB1, 0x61, 0xFD, 0x41, 0x6F, 0xC5,
-    0xDE, 0x43, 0x61, 0x69, 0x75, 0xB5, 0x53, 0xFF, 0xFC, 0xAE, 0x89, 0x41, 0x6F, 0xBD, 0x4F, 0xCA,
-    0x02, 0x81, 0x62, 0x63, 0x69, 0x6C, 0x6E, 0x70, 0x74, 0x75, 0x76, 0x77, 0xC4, 0xAB, 0xFF, 0xB2,
-    0xB7, 0x31, 0xFF, 0xC6, 0xFF, 0xD6, 0xFF, 0xE9, 0xFF, 0xF2, 0xAE, 0x69, 0xFF, 0xFC, 0xB7, 0x31,
-    0xA0, 0x0F, 0xE2, 0x21, 0x74, 0xFD, 0x41, 0x72, 0xF3, 0xCB, 0xA1, 0x00, 0x51, 0x65, 0xFC, 0x41,
-    0x6F, 0xB4, 0x9C, 0x44, 0x6E, 0x70, 0x76, 0x74, 0xFF, 0xF0, 0xFF, 0xF7, 0xAE, 0x56, 0xFF, 0xFC,
-    0x43, 0x64, 0x69, 0x73, 0xB6, 0x19, 0xB4, 0xF9, 0xB6, 0x19, 0x41, 0x7A, 0xB6, 0x0F, 0x21, 0x74,
-    0xFC, 0xA0, 0x22, 0x82, 0x21, 0x67, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x64, 0xFD,
-    0x21, 0x6F, 0xFD, 0xC3, 0x00, 0xD1, 0x6F, 0x69, 0x72, 0xB5, 0xF6, 0xFF, 0xEB, 0xFF, 0xFD, 0xA0,
-    0x10, 0x02, 0x21, 0x64, 0xFD, 0xA0, 0x22, 0xA2, 0x21, 0x74, 0xFD, 0x21, 0x74, 0xFD, 0x43, 0x65,
-    0x6E, 0x75, 0xD3, 0x4B, 0xFF, 0xF4, 0xFF, 0xFD, 0x42, 0x65, 0x69, 0xAE, 0x01, 0xB5, 0xD1, 0x43,
-    0x66, 0x70, 0x75, 0xAD, 0xD3, 0xDF, 0x1A, 0xDB, 0x2D, 0x41, 0x2E, 0xB3, 0x18, 0x21, 0x72, 0xFC,
-    0x21, 0x65, 0xFD, 0x21, 0x70, 0xFD, 0x21, 0x61, 0xFD, 0x41, 0x68, 0xB1, 0x52, 0x21, 0x74, 0xFC,
-    0x49, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x75, 0x72, 0x79, 0xFF, 0x83, 0xFF, 0x90, 0xFF, 0xB3,
-    0xFF, 0xCE, 0xFF, 0xD8, 0xFF, 0xDF, 0xB6, 0x2A, 0xFF, 0xF6, 0xFF, 0xFD, 0xC2, 0x02, 0x31, 0x73,
-    0x77, 0xAD, 0x96, 0xAD, 0xB4, 0xA0, 0x10, 0x22, 0x42, 0x6F, 0x74, 0xFF, 0xFD, 0xB5, 0x9C, 0xC2,
-    0x0D, 0x42, 0x65, 0x6C, 0xCD, 0xBC, 0xB4, 0x5D, 0xC1, 0x02, 0x81, 0x72, 0xAD, 0x92, 0x43, 0x65,
-    0x66, 0x76, 0xB4, 0xBA, 0xB6, 0x42, 0xB6, 0x42, 0xA0, 0x22, 0xC2, 0x21, 0x74, 0xFD, 0xA1, 0x01,
-    0x91, 0x73, 0xFD, 0x41, 0x68, 0xFB, 0x4E, 0x21, 0x70, 0xFC, 0xA0, 0x22, 0xE3, 0x21, 0x63, 0xFD,
-    0x21, 0x69, 0xFD, 0x21, 0x74, 0xFD, 0x44, 0x65, 0x6F, 0x61, 0x69, 0xFF, 0xE8, 0xC3, 0x71, 0xFF,
-    0xF1, 0xFF, 0xFD, 0x41, 0x64, 0xB4, 0x19, 0x42, 0x64, 0x6C, 0xB4, 0x12, 0xB4, 0x12, 0x47, 0x61,
-    0x63, 0x64, 0x65, 0x67, 0x69, 0x74, 0xAD, 0x55, 0xB4, 0x0B, 0xAD, 0x3A, 0xFF, 0xF5, 0xAD, 0x52,
-    0xCD, 0x8C, 0xFF, 0xF9, 0x41, 0x62, 0xAD, 0x36, 0x21, 0x6D, 0xFC, 0x21, 0x65, 0xFD, 0x42, 0x61,
-    0x74, 0xC0, 0x64, 0xFF, 0xFD, 0x44, 0x2E, 0x6C, 0x6F, 0x76, 0xBB, 0xC5, 0xB5, 0x04, 0xAD, 0x13,
-    0xD7, 0xBF, 0xC2, 0x07, 0x42, 0x68, 0x74, 0xB3, 0xE2, 0xAD, 0x1E, 0x41, 0x6D, 0xD8, 0x5D, 0xC1,
-    0x02, 0xE1, 0x65, 0xBE, 0x44, 0x50, 0x2E, 0x61, 0x63, 0x64, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70,
-    0x72, 0x73, 0x75, 0x76, 0x77, 0x78, 0xB3, 0xC4, 0xFF, 0x57, 0xFF, 0x63, 0xFF, 0x6A, 0xFF, 0x73,
-    0xB5, 0xBB, 0xFF, 0x79, 0xFF, 0xA1, 0xFF, 0xB9, 0xFF, 0xD9, 0xFF, 0xE0, 0xFF, 0xED, 0xFF, 0xF6,
-    0xFF, 0xFA, 0xAD, 0x59, 0xB5, 0xBB, 0x42, 0x72, 0x76, 0xB4, 0x02, 0xB5, 0x8A, 0x44, 0x6E, 0x6F,
-    0x70, 0x76, 0xB3, 0xFB, 0xB3, 0xCE, 0xB4, 0xC7, 0xAC, 0xDC, 0xC1, 0x00, 0x41, 0x74, 0xAC, 0xD5,
-    0x41, 0x73, 0xD8, 0x50, 0xC4, 0x00, 0x51, 0x6C, 0x6E, 0x72, 0x65, 0xB3, 0x83, 0xAE, 0x33, 0xFF,
-    0xF6, 0xFF, 0xFC, 0xC5, 0x02, 0x11, 0x2E, 0x65, 0x69, 0x6F, 0x77, 0xBB, 0xBD, 0xFF, 0xD3, 0xFF,
-    0xDA, 0xFF, 0xF1, 0xB3, 0x66, 0xC2, 0x02, 0xE1, 0x74, 0x77, 0xAC, 0xA4, 0xAC, 0xA4, 0x43, 0x2E,
-    0x73, 0x64, 0xB4, 0x86, 0xFF, 0xF7, 0xBD, 0x47, 0x42, 0x65, 0x69, 0xFF, 0xF6, 0xC3, 0xED, 0x41,
-    0x6E, 0xD0, 0x7C, 0x42, 0x65, 0x79, 0xAC, 0x65, 0xB3, 0x36, 0xC3, 0x03, 0xE2, 0x61, 0x65, 0x67,
-    0xB3, 0x8F, 0xBF, 0x5C, 0xB3, 0xAD, 0xC1, 0x02, 0xE1, 0x61, 0xAC, 0x73, 0xA1, 0x03, 0xD1, 0x6E,
-    0xFA, 0x41, 0x69, 0xB3, 0x26, 0x21, 0x73, 0xFC, 0xC2, 0x02, 0x81, 0x61, 0x65, 0xAC, 0x58, 0xFF,
-    0xFD, 0x41, 0x69, 0xBD, 0x00, 0x4D, 0x62, 0x63, 0x64, 0x67, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74,
-    0x75, 0x76, 0x7A, 0xB3, 0x73, 0xCD, 0xF1, 0xFF, 0xC3, 0xFF, 0xCA, 0xFF, 0xCE, 0xFF, 0xD5, 0xFF,
-    0xE7, 0xFF, 0xF3, 0xC1, 0x9C, 0xFF, 0xFC, 0xB4, 0xFB, 0xC1, 0x9C, 0xB4, 0xFB, 0xC1, 0x01, 0x91,
-    0x74, 0xB3, 0x5A, 0x42, 0x65, 0x67, 0xB2, 0xE1, 0xB2, 0xE1, 0x21, 0x6E, 0xF9, 0x41, 0x63, 0xAC,
-    0x07, 0x21, 0x73, 0xFC, 0xA3, 0x02, 0x81, 0x65, 0x69, 0x79, 0xE9, 0xF6, 0xFD, 0x41, 0x74, 0xBB,
-    0xA4, 0xA0, 0x23, 0x12, 0x21, 0x61, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x6B, 0xFD, 0x21, 0x61, 0xFD,
-    0x21, 0x76, 0xFD, 0xC4, 0x07, 0x82, 0x61, 0x65, 0x69, 0x6F, 0xB7, 0x58, 0xB3, 0x06, 0xFF, 0xEA,
-    0xFF, 0xFD, 0xC2, 0x02, 0x21, 0x6C, 0x6E, 0xAE, 0x8C, 0xAD, 0x55, 0x42, 0x6C, 0x6E, 0xAB, 0xB7,
-    0xB2, 0x91, 0x41, 0x68, 0xB4, 0x7E, 0x21, 0x74, 0xFC, 0x41, 0x64, 0xAD, 0x23, 0x21, 0x6C, 0xFC,
-    0xA4, 0x03, 0xE2, 0x61, 0x65, 0x69, 0x6F, 0xE2, 0xEB, 0xF6, 0xFD, 0x41, 0x62, 0xB3, 0x06, 0xA0,
-    0x10, 0x62, 0x41, 0x74, 0xB7, 0x44, 0x45, 0x61, 0x64, 0x69, 0x76, 0x75, 0xFF, 0xF5, 0xFF, 0xF9,
-    0xBF, 0x51, 0xB4, 0x5A, 0xFF, 0xFC, 0x43, 0x2E, 0x61, 0x67, 0xD0, 0xE3, 0xAB, 0x7C, 0xAB, 0x82,
-    0x42, 0x63, 0x7A, 0xB4, 0x40, 0xB2, 0x4C, 0x42, 0x69, 0x79, 0xFF, 0xF9, 0xB2, 0x45, 0xA1, 0x01,
-    0x41, 0x68, 0xF9, 0x42, 0x63, 0x64, 0xAB, 0x7D, 0xAB, 0x7D, 0xC1, 0x01, 0x91, 0x69, 0xB2, 0x3A,
-    0xA0, 0x23, 0x34, 0x21, 0x79, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0x61, 0xFD, 0xC9, 0x03, 0xD1, 0x63,
-    0x66, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x76, 0x67, 0xB2, 0xF4, 0xAF, 0x8E, 0xFF, 0xBA, 0xB3, 0x58,
-    0xFF, 0xCA, 0xFF, 0xE2, 0xFF, 0xE7, 0xFF, 0xEE, 0xFF, 0xFD, 0xA0, 0x23, 0x32, 0x41, 0x6E, 0xD1,
-    0x0D, 0x22, 0x65, 0x69, 0xF9, 0xFC, 0xC3, 0x02, 0x41, 0x69, 0x6E, 0x63, 0xB3, 0xEA, 0xAB, 0x22,
-    0xFF, 0xFB, 0x41, 0x69, 0xAE, 0xDF, 0x44, 0x6E, 0x6F, 0x72, 0x63, 0xC7, 0x7D, 0xBC, 0x78, 0xBA,
-    0x3A, 0xFF, 0xFC, 0xC1, 0x02, 0x71, 0x6F, 0xAF, 0x84, 0xA1, 0x02, 0x11, 0x72, 0xFA, 0x42, 0x65,
-    0x6F, 0xFF, 0xFB, 0xAB, 0x1B, 0x41, 0x69, 0xB1, 0x56, 0x44, 0x6C, 0x6E, 0x6F, 0x63, 0xAA, 0xE9,
-    0xB1, 0xFA, 0xB1, 0xC0, 0xFF, 0xFC, 0xA0, 0x23, 0x71, 0x22, 0x63, 0x77, 0xFD, 0xFD, 0x21, 0x73,
-    0xFB, 0xA1, 0x00, 0x41, 0x74, 0xFD, 0x41, 0x77, 0xAB, 0x1C, 0x21, 0x73, 0xFC, 0x21, 0x65, 0xFD,
-    0x44, 0x6E, 0x72, 0x74, 0x6B, 0xB2, 0xB9, 0xFF, 0xF1, 0xB1, 0x99, 0xFF, 0xFD, 0x46, 0x61, 0x65,
-    0x68, 0x69, 0x6C, 0x6F, 0xFF, 0x99, 0xFF, 0xA9, 0xFF, 0xC1, 0xFF, 0xCC, 0xCD, 0xA5, 0xFF, 0xF3,
-    0x41, 0x6C, 0xB4, 0xD7, 0x41, 0x6F, 0xC7, 0x5E, 0x21, 0x74, 0xFC, 0x22, 0x61, 0x69, 0xF5, 0xFD,
-    0x21, 0x75, 0xFB, 0xA0, 0x23, 0x84, 0x21, 0x75, 0xFD, 0x21, 0x68, 0xFD, 0xC2, 0x02, 0xB1, 0x73,
-    0x63, 0xAC, 0x1B, 0xFF, 0xFD, 0x44, 0x6C, 0x6E, 0x73, 0x74, 0xB1, 0xD2, 0xEB, 0x0F, 0xC6, 0x50,
-    0xB1, 0x57, 0xC1, 0x01, 0x41, 0x72, 0xAA, 0x76, 0x41, 0x6E, 0xC9, 0xBC, 0xA0, 0x23, 0xC3, 0x21,
-    0x62, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x6E, 0xFD, 0xC4, 0x02, 0xB1, 0x65, 0x6C, 0x61, 0x67, 0xFF,
-    0xEA, 0xB2, 0xAF, 0xFF, 0xF0, 0xFF, 0xFD, 0xC1, 0x01, 0x41, 0x69, 0xB1, 0xBA, 0x41, 0x64, 0xAF,
-    0x69, 0x21, 0x6E, 0xFC, 0x21, 0x65, 0xFD, 0x41, 0x61, 0xB5, 0x3B, 0xCB, 0x02, 0x41, 0x61, 0x63,
-    0x65, 0x69, 0x6C, 0x6E, 0x70, 0x74, 0x75, 0x77, 0x68, 0xFF, 0xB1, 0xC0, 0x39, 0xFF, 0xBA, 0xFF,
-    0xDD, 0xFF, 0xEC, 0xB2, 0x2E, 0xFF, 0xF9, 0xB4, 0x42, 0xB6, 0x5B, 0xB1, 0x19, 0xFF, 0xFC, 0x42,
-    0x69, 0x70, 0xAA, 0x13, 0xCF, 0xFB, 0xA0, 0x23, 0xF3, 0x21, 0x69, 0xFD, 0x21, 0x68, 0xFD, 0x21,
-    0x73, 0xFD, 0x42, 0x64, 0x74, 0xB2, 0xCE, 0xFF, 0xFD, 0x42, 0x2E, 0x69, 0xB2, 0xC7, 0xAA, 0x0B,
-    0x41, 0x74, 0xEA, 0x72, 0x47, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x74, 0x72, 0xB1, 0x25, 0xB1, 0x25,
-    0xFF, 0xDB, 0xFF, 0xEE, 0xC8, 0x31, 0xFF, 0xF5, 0xFF, 0xFC, 0x42, 0x6E, 0x6F, 0xAC, 0x48, 0xB0,
-    0xB2, 0xC1, 0x00, 0xD1, 0x61, 0xA9, 0xF8, 0x43, 0x64, 0x72, 0x77, 0xB1, 0xC2, 0xFF, 0xF3, 0xFF,
-    0xFA, 0xC1, 0x02, 0xB1, 0x6B, 0xB2, 0x8F, 0xC7, 0x02, 0x81, 0x2E, 0x61, 0x63, 0x65, 0x66, 0x6E,
-    0x72, 0xB1, 0xB2, 0xB0, 0x95, 0xFF, 0xFA, 0xB1, 0xB2, 0xB1, 0x10, 0xCB, 0x99, 0xB2, 0x89, 0x41,
-    0x65, 0xB2, 0x1B, 0xA0, 0x24, 0x22, 0x21, 0x62, 0xFD, 0x42, 0x65, 0x61, 0xB1, 0xAB, 0xFF, 0xFD,
-    0x45, 0x63, 0x6D, 0x6E, 0x70, 0x72, 0xC8, 0xEC, 0xDA, 0x0C, 0xDD, 0x20, 0xB1, 0x89, 0xFF, 0xF9,
-    0xA0, 0x24, 0x42, 0x21, 0x67, 0xFD, 0x42, 0x75, 0x61, 0xB2, 0x4A, 0xFF, 0xFD, 0x43, 0x64, 0x74,
-    0x79, 0xB1, 0x6C, 0xFF, 0xF9, 0xB1, 0x6C, 0x42, 0x64, 0x62, 0xB1, 0x62, 0xAF, 0x58, 0xC3, 0x02,
-    0x31, 0x61, 0x69, 0x79, 0xFF, 0xEF, 0xFF, 0xF9, 0xB0, 0x3B, 0x41, 0x69, 0xD1, 0x0C, 0xA1, 0x02,
-    0x11, 0x6C, 0xFC, 0x41, 0x63, 0xB8, 0x37, 0xA0, 0x24, 0x63, 0x21, 0x64, 0xFD, 0x21, 0x69, 0xFD,
-    0x21, 0x70, 0xFD, 0x4D, 0x2E, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x77, 0x79, 0x62, 0x73,
-    0x75, 0xB8, 0x6D, 0xFF, 0x51, 0xFF, 0x74, 0xC2, 0x7A, 0xFF, 0x84, 0xFF, 0x9C, 0xFF, 0xAD, 0xFF,
-    0xDB, 0xBB, 0xB3, 0xFF, 0xEB, 0xB0, 0x21, 0xFF, 0xF0, 0xFF, 0xFD, 0x42, 0x73, 0x74, 0xAF, 0xF9,
-    0xAA, 0xAC, 0xC1, 0x02, 0x81, 0x69, 0xA9, 0x28, 0xA0, 0x24, 0x93, 0x21, 0x65, 0xFD, 0x21, 0x72,
-    0xFD, 0x21, 0x65, 0xFD, 0xC9, 0x03, 0xD1, 0x61, 0x62, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x72, 0x70,
-    0xDD, 0x59, 0xC2, 0xE6, 0xFB, 0x71, 0xFF, 0xE7, 0xB0, 0xF5, 0xFF, 0xEE, 0xB3, 0x09, 0xB3, 0x09,
-    0xFF, 0xFD, 0xA0, 0x1C, 0x31, 0x21, 0x6D, 0xFD, 0x21, 0x6D, 0xFD, 0xC2, 0x02, 0x81, 0x6F, 0x69,
-    0xAF, 0xAE, 0xFF, 0xFD, 0x42, 0x6F, 0x63, 0xA8, 0xEC, 0xBE, 0x3D, 0x41, 0x69, 0xB0, 0x7C, 0xA0,
-    0x24, 0xC3, 0x21, 0x69, 0xFD, 0x21, 0x68, 0xFD, 0xC5, 0x01, 0x41, 0x63, 0x6C, 0x6E, 0x72, 0x74,
-    0xAF, 0x91, 0xB0, 0xCC, 0xFF, 0xEC, 0xFF, 0xF3, 0xFF, 0xFD, 0x57, 0x61, 0x62, 0x63, 0x64, 0x65,
-    0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
-    0x77, 0x79, 0xFA, 0x45, 0xB9, 0xAF, 0xFA, 0xF6, 0xB9, 0xAF, 0xFB, 0xBB, 0xB7, 0xD9, 0xB7, 0xF0,
-    0xFC, 0x19, 0xFC, 0x7B, 0xFC, 0xBA, 0xFC, 0xD9, 0xFD, 0x06, 0xC2, 0x71, 0xFD, 0x62, 0xFD, 0xF3,
-    0xFE, 0x16, 0xB1, 0x20, 0xFE, 0x71, 0xFF, 0x69, 0xFF, 0xAA, 0xAF, 0x7F, 0xFF, 0xD1, 0xFF, 0xEE,
-    0x41, 0x65, 0xB3, 0x66, 0xA0, 0x24, 0xF3, 0x21, 0x6D, 0xFD, 0x42, 0x7A, 0x73, 0xB1, 0x26, 0xFF,
-    0xFD, 0x21, 0x69, 0xF9, 0x21, 0x6C, 0xFD, 0xA2, 0x02, 0x41, 0x6C, 0x6F, 0xE9, 0xFD, 0x41, 0x6C,
-    0xA8, 0xF5, 0xC1, 0x01, 0x91, 0x61, 0xC0, 0xE2, 0x41, 0x69, 0xBD, 0x39, 0xC6, 0x02, 0x81, 0x61,
-    0x65, 0x69, 0x6B, 0x6C, 0x6F, 0xAF, 0x18, 0xAB, 0x0D, 0xA8, 0x4E, 0xFF, 0xF6, 0xFF, 0xFC, 0xAF,
-    0x47, 0x41, 0x6E, 0xE5, 0xFC, 0x42, 0x6F, 0x69, 0xAE, 0xFF, 0xFF, 0xFC, 0x41, 0x61, 0xA9, 0xC8,
-    0x42, 0x64, 0x74, 0xA8, 0x55, 0xFF, 0xFC, 0xA0, 0x25, 0x22, 0x21, 0x68, 0xFD, 0x21, 0x74, 0xFD,
-    0x43, 0x65, 0x6C, 0x61, 0xB6, 0xEA, 0xAE, 0xE4, 0xFF, 0xFD, 0xA0, 0x25, 0x42, 0x21, 0x68, 0xFD,
-    0x45, 0x61, 0x63, 0x65, 0x69, 0x72, 0xA7, 0xF8, 0xAE, 0xC9, 0xAE, 0xC9, 0xB7, 0x3D, 0xFF, 0xFD,
-    0x42, 0x65, 0x79, 0xA7, 0xE8, 0xAE, 0xC4, 0x42, 0x69, 0x75, 0xB0, 0x91, 0xB1, 0xF3, 0x41, 0x6E,
-    0xB4, 0x47, 0x21, 0x6F, 0xFC, 0xD2, 0x03, 0xD1, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x69, 0x6C, 0x6D,
-    0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x67, 0xAF, 0xDF, 0xFF, 0x82, 0xB0, 0x59,
-    0xB2, 0x5F, 0xB9, 0x36, 0xFF, 0x89, 0xFF, 0x97, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xCB, 0xFF, 0xDB,
-    0xFF, 0xEB, 0xFF, 0xF2, 0xA8, 0x3D, 0xA7, 0xD3, 0xB6, 0xFB, 0xFF, 0x93, 0xFF, 0xFD, 0x41, 0x72,
-    0xDE, 0x72, 0x21, 0x65, 0xFC, 0xC3, 0x01, 0x41, 0x65, 0x63, 0x69, 0xA7, 0xAE, 0xA7, 0x9F, 0xFF,
-    0xFD, 0xC2, 0x01, 0x91, 0x68, 0x72, 0xFF, 0xF4, 0xAF, 0xF9, 0x41, 0x68, 0xF9, 0xB6, 0x43, 0x64,
-    0x74, 0x63, 0xA8, 0x3B, 0xAE, 0x4B, 0xFF, 0xFC, 0x42, 0x65, 0x74, 0xA7, 0x6A, 0xB0, 0x38, 0xC1,
-    0x03, 0xE2, 0x69, 0xAE, 0x45, 0xC2, 0x00, 0x51, 0x65, 0x69, 0xB6, 0x45, 0xAE, 0x3F, 0x41, 0x6F,
-    0xE0, 0x9E, 0x42, 0x67, 0x72, 0xA8, 0x11, 0xFF, 0xFC, 0x44, 0x2E, 0x69, 0x73, 0x65, 0xAF, 0x5B,
-    0xA7, 0x49, 0xB0, 0x17, 0xFF, 0xF9, 0xC1, 0x10, 0x82, 0x74, 0xA7, 0x54, 0x21, 0x61, 0xFA, 0x41,
-    0x6E, 0xAF, 0x45, 0xC1, 0x03, 0xD1, 0x61, 0xE5, 0x31, 0x45, 0x61, 0x63, 0x64, 0x65, 0x74, 0xFF,
-    0xF6, 0xAF, 0x3B, 0xAF, 0x3B, 0xC5, 0x28, 0xFF, 0xFA, 0xC1, 0x02, 0x31, 0x65, 0xAD, 0xFB, 0xA0,
-    0x10, 0xA2, 0xC4, 0x03, 0xD1, 0x65, 0x73, 0x7A, 0x63, 0xB1, 0xEC, 0xA7, 0x28, 0xAA, 0x83, 0xB7,
-    0xE3, 0x41, 0x69, 0xD7, 0x0B, 0xA0, 0x1B, 0xC2, 0x21, 0x69, 0xFD, 0x21, 0x65, 0xFD, 0x46, 0x63,
-    0x64, 0x69, 0x6E, 0x76, 0x67, 0xA7, 0x0C, 0xFF, 0xE1, 0xFF, 0xE4, 0xFF, 0xF3, 0xA7, 0x12, 0xFF,
-    0xFD, 0xA0, 0x14, 0x22, 0x21, 0x73, 0xFD, 0xC2, 0x01, 0x91, 0x2E, 0x65, 0xAE, 0x30, 0xFF, 0xFD,
-    0x42, 0x2E, 0x73, 0xAD, 0xA9, 0xFF, 0xF7, 0x41, 0x68, 0xA8, 0xA3, 0x51, 0x2E, 0x61, 0x63, 0x64,
-    0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x78, 0x79, 0xAD, 0x9E, 0xFF,
-    0x53, 0xFF, 0x5D, 0xFF, 0x64, 0xBC, 0x36, 0xFF, 0x6A, 0xFF, 0x7E, 0xFF, 0x91, 0xFF, 0x9E, 0xBC,
-    0x36, 0xFF, 0xAE, 0xFF, 0xD3, 0xFF, 0xF5, 0xFF, 0xFC, 0xAE, 0xD9, 0xAE, 0xD9, 0xAD, 0x9E, 0x41,
-    0x6D, 0xD9, 0x0E, 0x21, 0x61, 0xFC, 0x42, 0x6E, 0x6C, 0xA6, 0x8C, 0xFF, 0xFD, 0xC2, 0x01, 0x91,
-    0x73, 0x74, 0xAD, 0x9E, 0xA6, 0xA3, 0xC3, 0x02, 0x81, 0x61, 0x69, 0x74, 0xFF, 0xF7, 0xE7, 0x99,
-    0xAE, 0x8E, 0x42, 0x2E, 0x61, 0xAD, 0x52, 0xAD, 0x52, 0x43, 0x63, 0x6C, 0x6E, 0xFF, 0xF9, 0xAD,
-    0x40, 0xC5, 0xC3, 0x43, 0x65, 0x69, 0x6F, 0xAD, 0x41, 0xBA, 0xA9, 0xB7, 0xB0, 0x42, 0x74, 0x7A,
-    0xA6, 0x7C, 0xA6, 0x73, 0x21, 0x69, 0xF9, 0xA0, 0x25, 0x63, 0x21, 0x69, 0xFD, 0x21, 0x6E, 0xFD,
-    0x21, 0x65, 0xFD, 0xA0, 0x25, 0x92, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x45, 0x64, 0x6F, 0x72,
-    0x67, 0x6B, 0xFF, 0xD7, 0xAD, 0x0D, 0xFF, 0xE8, 0xFF, 0xF4, 0xFF, 0xFD, 0x41, 0x6E, 0xD8, 0xA1,
-    0x21, 0x61, 0xFC, 0x42, 0x6C, 0x73, 0xFF, 0xFD, 0xB6, 0x2A, 0x48, 0x2E, 0x61, 0x65, 0x69, 0x6C,
-    0x6F, 0x73, 0x79, 0xB5, 0x46, 0xFF, 0x8C, 0xFF, 0x9C, 0xFF, 0xAF, 0xAC, 0xEF, 0xFF, 0xE2, 0xB5,
-    0x46, 0xFF, 0xF9, 0x41, 0x2E, 0xBB, 0xA2, 0xC3, 0x03, 0xD1, 0x62, 0x74, 0x6E, 0xAD, 0x6A, 0xB0,
-    0x09, 0xFF, 0xFC, 0xA0, 0x10, 0xC2, 0xA0, 0x10, 0xE2, 0x43, 0x6B, 0x6F, 0x75, 0xAC, 0xC0, 0xAD,
-    0xE0, 0xFF, 0xFD, 0xC1, 0x00, 0xD1, 0x79, 0xAC, 0xC1, 0xC1, 0x02, 0x41, 0x75, 0xAE, 0xA7, 0x41,
-    0x6C, 0xC9, 0x12, 0xC2, 0x03, 0xD1, 0x70, 0x75, 0xAC, 0xA6, 0xB7, 0x96, 0x41, 0x6D, 0xF1, 0xBE,
-    0xC4, 0x03, 0xE2, 0x61, 0x65, 0x69, 0x6F, 0xAC, 0xF9, 0xBD, 0x41, 0xAD, 0xD4, 0xFF, 0xFC, 0x41,
-    0x65, 0xA7, 0x8B, 0xC2, 0x03, 0xD1, 0x63, 0x6E, 0xAC, 0x91, 0xFF, 0xFC, 0x41, 0x63, 0xCA, 0xF2,
-    0x21, 0x69, 0xFC, 0x46, 0x61, 0x65, 0x6D, 0x6F, 0x70, 0x74, 0xAC, 0xB8, 0xAD, 0xB1, 0xA5, 0xA5,
-    0xAC, 0x81, 0xA5, 0xA5, 0xFF, 0xFD, 0xC1, 0x03, 0xD1, 0x61, 0xA5, 0x92, 0xC2, 0x03, 0xD1, 0x61,
-    0x65, 0xAC, 0x9F, 0xB1, 0x9F, 0x51, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x6C, 0x6D, 0x6E,
-    0x6F, 0x71, 0x73, 0x74, 0x75, 0x76, 0x7A, 0xFF, 0x82, 0xFF, 0x8E, 0xFF, 0x94, 0xBE, 0x66, 0xFE,
-    0x4A, 0xFF, 0x9E, 0xFF, 0xA4, 0xFF, 0xAA, 0xFF, 0xAE, 0xFF, 0xBB, 0xFF, 0xCE, 0xAE, 0x4B, 0xFF,
-    0xDE, 0xAC, 0x99, 0xAC, 0xEC, 0xFF, 0xF1, 0xFF, 0xF7, 0xC1, 0x01, 0x71, 0x6E, 0xA5, 0x49, 0x44,
-    0x2E, 0x64, 0x73, 0x74, 0xAD, 0x55, 0xAD, 0x55, 0xBC, 0xC2, 0xAE, 0x02, 0xA0, 0x17, 0x72, 0x21,
-    0x72, 0xFD, 0x21, 0x65, 0xFD, 0xC4, 0x02, 0x41, 0x61, 0x65, 0x6F, 0x69, 0xFF, 0xE4, 0xFF, 0xEA,
-    0xAC, 0x07, 0xFF, 0xFD, 0xC1, 0x04, 0x02, 0x65, 0xA5, 0x24, 0x41, 0x72, 0xAC, 0x18, 0x41, 0x72,
-    0xAF, 0x1F, 0x43, 0x61, 0x62, 0x79, 0xAF, 0x1B, 0xA5, 0x16, 0xAC, 0x29, 0x42, 0x6C, 0x74, 0xA5,
-    0x72, 0xAC, 0x1F, 0x43, 0x61, 0x6F, 0x79, 0xFF, 0xF9, 0xAB, 0xD6, 0xAB, 0xD6, 0x42, 0x65, 0x7A,
-    0xAC, 0x0E, 0xA5, 0x13, 0x42, 0x61, 0x69, 0xAE, 0xF9, 0xFF, 0xF9, 0x42, 0x72, 0x74, 0xAD, 0xB5,
-    0xAB, 0xBE, 0x41, 0x61, 0xB4, 0x4B, 0x41, 0x79, 0xA5, 0x9D, 0x21, 0x67, 0xFC, 0x21, 0x6F, 0xFD,
-    0xCE, 0x03, 0xD1, 0x62, 0x63, 0x64, 0x66, 0x67, 0x69, 0x6D, 0x6E, 0x72, 0x73, 0x75, 0x77, 0x6C,
-    0x74, 0xAB, 0xEB, 0xFF, 0xBA, 0xCF, 0x84, 0xB4, 0x00, 0xFF, 0xBE, 0xAD, 0xC9, 0xFF, 0xC2, 0xFF,
-    0xD3, 0xFF, 0xE4, 0xA6, 0x76, 0xFF, 0xEB, 0xFF, 0xF2, 0xFF, 0xFD, 0xB4, 0xE1, 0xC1, 0x01, 0x81,
-    0x74, 0xA4, 0xA5, 0x43, 0x68, 0x69, 0x74, 0xA4, 0xBD, 0xFF, 0xFA, 0xA5, 0x3C, 0xA0, 0x25, 0xD2,
-    0x21, 0x62, 0xFD, 0xA1, 0x00, 0x61, 0x61, 0xFD, 0x21, 0x73, 0xFB, 0x43, 0x6E, 0x73, 0x72, 0xA4,
-    0xA5, 0xD3, 0xFE, 0xFF, 0xFD, 0x21, 0x65, 0xF6, 0xA0, 0x25, 0xB2, 0x21, 0x72, 0xFD, 0x21, 0x6F,
-    0xFD, 0x21, 0x74, 0xFD, 0xC5, 0x03, 0xD1, 0x62, 0x63, 0x73, 0x76, 0x69, 0xA4, 0x86, 0xFF, 0xCF,
-    0xA4, 0x6E, 0xFF, 0xF1, 0xFF, 0xFD, 0xC1, 0x00, 0x51, 0x69, 0xA4, 0x83, 0xA0, 0x25, 0xF1, 0x21,
-    0x65, 0xFD, 0x21, 0x68, 0xFD, 0x21, 0x63, 0xFD, 0x43, 0x66, 0x6D, 0x61, 0xA4, 0x68, 0xFF, 0xEE,
-    0xFF, 0xFD, 0xC1, 0x02, 0xE1, 0x6C, 0xAC, 0xE5, 0x43, 0x65, 0x69, 0x73, 0xAF, 0x16, 0xC9, 0x86,
-    0xAB, 0x11, 0x44, 0x61, 0x63, 0x6D, 0x76, 0xFF, 0xF0, 0xFF, 0xF6, 0xB3, 0x5E, 0xA4, 0x36, 0x42,
-    0x69, 0x79, 0xA4, 0x4A, 0xAA, 0xFA, 0x41, 0x73, 0xFD, 0xDD, 0xA0, 0x26, 0x33, 0x21, 0x73, 0xFD,
-    0xA0, 0x26, 0x63, 0x22, 0x73, 0x74, 0xF7, 0xFD, 0x22, 0x65, 0x69, 0xF5, 0xFB, 0x21, 0x6C, 0xFB,
-    0x43, 0x68, 0x69, 0x6F, 0xA8, 0x25, 0xFF, 0xE6, 0xFF, 0xFD, 0x41, 0x70, 0xA4, 0x10, 0xA0, 0x26,
-    0x03, 0x21, 0x6D, 0xFD, 0x21, 0x75, 0xFD, 0x21, 0x65, 0xFD, 0x42, 0x63, 0x74, 0xD8, 0xEB, 0xA4,
-    0x00, 0x21, 0x69, 0xF9, 0x47, 0x6D, 0x6E, 0x70, 0x73, 0x76, 0x6C, 0x66, 0xB1, 0xC0, 0xFF, 0xBB,
-    0xFF, 0xDC, 0xFF, 0xE6, 0xA3, 0xF6, 0xFF, 0xF3, 0xFF, 0xFD, 0x42, 0x69, 0x73, 0xA3, 0xE6, 0xA3,
-    0xC8, 0x45, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xFF, 0x53, 0xFF, 0x77, 0xFF, 0x91, 0xFF, 0xE3, 0xFF,
-    0xF9, 0xC1, 0x01, 0x41, 0x68, 0xA8, 0xC3, 0xC3, 0x0A, 0x23, 0x63, 0x68, 0x77, 0xFF, 0xFA, 0xA3,
-    0xB1, 0xAB, 0xA2, 0xA0, 0x26, 0x92, 0x21, 0x74, 0xFD, 0x21, 0x75, 0xFD, 0x21, 0x62, 0xFD, 0x21,
-    0x69, 0xFD, 0xC4, 0x06, 0x63, 0x65, 0x6F, 0x75, 0x72, 0xAC, 0x8B, 0xAA, 0x6A, 0xA3, 0x96, 0xFF,
-    0xFD, 0xC1, 0x01, 0xF1, 0x72, 0xAA, 0x9A, 0x41, 0x69, 0xB9, 0xEC, 0x41, 0x2E, 0xB2, 0xBF, 0xC1,
-    0x02, 0xE1, 0x73, 0xA3, 0x8B, 0x41, 0x72, 0xA5, 0x02, 0x21, 0x61, 0xFC, 0x45, 0x65, 0x69, 0x6F,
-    0x79, 0x6E, 0xAB, 0x78, 0xFF, 0xF3, 0xA3, 0x84, 0xAA, 0x48, 0xFF, 0xFD, 0xCB, 0x03, 0xD1, 0x61,
-    0x62, 0x64, 0x65, 0x66, 0x69, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0xFF, 0xD5, 0xAD, 0x42, 0xA4, 0xFA,
-    0xAA, 0x2D, 0xB4, 0xBF, 0xBA, 0xBF, 0xAB, 0x68, 0xFF, 0xDB, 0xFF, 0xDF, 0xFF, 0xF0, 0xAB, 0x68,
-    0xC4, 0x02, 0x31, 0x61, 0x69, 0x6F, 0x68, 0xB1, 0xEA, 0xAC, 0xB1, 0xAA, 0x09, 0xAB, 0xAA, 0x41,
-    0x6C, 0xB6, 0x17, 0x43, 0x65, 0x68, 0x61, 0xA4, 0xB4, 0xAA, 0x01, 0xFF, 0xFC, 0xC3, 0x03, 0xD1,
-    0x61, 0x6C, 0x70, 0xA9, 0xEC, 0xB2, 0x43, 0xFF, 0xF6, 0x56, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
-    0x67, 0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A,
-    0xFB, 0x3C, 0xB9, 0x51, 0xFB, 0x88, 0xB1, 0xC1, 0xFC, 0x42, 0xB9, 0x51, 0xB1, 0xC1, 0xFC, 0xF1,
-    0xFD, 0x8C, 0xFD, 0xDC, 0xFD, 0xEB, 0xD7, 0x9A, 0xFE, 0x37, 0xB1, 0xC1, 0xFF, 0x48, 0xFF, 0x5E,
-    0xFF, 0x79, 0xFF, 0xB3, 0xA9, 0xE0, 0xFF, 0xD7, 0xFF, 0xF4, 0xBC, 0x4C, 0x42, 0x61, 0x69, 0xA9,
-    0xA8, 0xA2, 0xCC, 0x41, 0x6E, 0xA2, 0xE0, 0x44, 0x61, 0x64, 0x69, 0x74, 0xFF, 0xFC, 0xA4, 0x5F,
-    0xA2, 0xD3, 0xA2, 0xD3, 0x42, 0x69, 0x75, 0xA9, 0xC7, 0xA2, 0xC0, 0x21, 0x74, 0xF9, 0x21, 0x61,
-    0xFD, 0x21, 0x72, 0xFD, 0x47, 0x62, 0x63, 0x6E, 0x72, 0x74, 0x76, 0x64, 0xA9, 0x75, 0xA2, 0xA4,
-    0xFF, 0xD8, 0xFF, 0xE3, 0xAB, 0x16, 0xA2, 0xA4, 0xFF, 0xFD, 0xC1, 0x02, 0x21, 0x6F, 0xAA, 0x7F,
-    0xC2, 0x02, 0x31, 0x6C, 0x72, 0xAA, 0x79, 0xFF, 0xFA, 0x41, 0x67, 0xAB, 0x78, 0xA1, 0x07, 0x42,
-    0x6E, 0xFC, 0x41, 0x65, 0xAA, 0xC1, 0x23, 0x65, 0x69, 0x6C, 0xEA, 0xF7, 0xFC, 0x42, 0x62, 0x74,
-    0xA2, 0x6B, 0xA9, 0xD4, 0x46, 0x61, 0x69, 0x6C, 0x72, 0x75, 0x79, 0xA9, 0xB3, 0xFF, 0xF9, 0xA6,
-    0x29, 0xA9, 0xB3, 0xA9, 0xB3, 0xAA, 0x55, 0x43, 0x72, 0x73, 0x76, 0xA9, 0x64, 0xA9, 0x48, 0xA2,
-    0x4B, 0x42, 0x64, 0x73, 0xA9, 0x5A, 0xA9, 0x5A, 0x44, 0x63, 0x65, 0x73, 0x74, 0xAA, 0xB2, 0xFF,
-    0xF9, 0xA9, 0x1C, 0xA9, 0x14, 0xC1, 0x01, 0x41, 0x79, 0xD6, 0x9D, 0x21, 0x6E, 0xFA, 0x46, 0x64,
-    0x65, 0x69, 0x6F, 0x73, 0x75, 0xA9, 0x06, 0xFF, 0xD9, 0xFF, 0xEA, 0xFF, 0xFD, 0xAC, 0x10, 0xAA,
-    0x1B, 0x43, 0x65, 0x73, 0x74, 0xAA, 0x08, 0xA2, 0x11, 0xA2, 0x54, 0x41, 0x69, 0xA6, 0x42, 0x41,
-    0x6D, 0xA2, 0x15, 0x23, 0x6E, 0x72, 0x61, 0xEE, 0xF8, 0xFC, 0x42, 0x61, 0x6C, 0xAA, 0x0A, 0xA9,
-    0x4D, 0x41, 0x65, 0xB3, 0x42, 0x42, 0x68, 0x69, 0xFF, 0xFC, 0xA9, 0xA2, 0xC1, 0x02, 0x31, 0x67,
-    0xAA, 0x5E, 0x41, 0x6D, 0xA1, 0xE6, 0xC1, 0x00, 0x71, 0x65, 0xDA, 0x89, 0xC5, 0x10, 0xC2, 0x6C,
-    0x6E, 0x72, 0x74, 0x76, 0xBA, 0x17, 0xFF, 0xF0, 0xFF, 0xF6, 0xA5, 0x61, 0xFF, 0xFA, 0xC2, 0x02,
-    0xB1, 0x62, 0x74, 0xA1, 0xE2, 0xAD, 0x6A, 0xC1, 0x00, 0x41, 0x65, 0xAA, 0x89, 0x21, 0x68, 0xFA,
-    0xC1, 0x02, 0x31, 0x6E, 0xAA, 0x2A, 0xC3, 0x02, 0x81, 0x61, 0x6E, 0x73, 0xA8, 0x86, 0xC3, 0x8A,
-    0xAD, 0xBD, 0x42, 0x62, 0x73, 0xC2, 0x28, 0xA9, 0x0F, 0x42, 0x61, 0x69, 0xAB, 0xB1, 0xFF, 0xF9,
-    0xC1, 0x01, 0x91, 0x65, 0xAC, 0x6E, 0x43, 0x69, 0x72, 0x75, 0xA8, 0xD2, 0xF9, 0x76, 0xA8, 0x63,
-    0xC1, 0x02, 0x21, 0x6C, 0xA8, 0x64, 0x4D, 0x61, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6C, 0x6D, 0x6F,
-    0x73, 0x74, 0x75, 0x76, 0xFF, 0xB8, 0xFF, 0xC7, 0xE2, 0xA0, 0xFF, 0xCA, 0xAB, 0x68, 0xFF, 0xD0,
-    0xFF, 0xE3, 0xB3, 0xF0, 0xBB, 0x45, 0xFF, 0xEA, 0xFF, 0xF0, 0xFF, 0xFA, 0xA8, 0x5E, 0x42, 0x69,
-    0x6C, 0xA8, 0xC3, 0xAF, 0x11, 0xC1, 0x02, 0xB1, 0x6E, 0xBE, 0x03, 0x41, 0x72, 0xA4, 0xB6, 0x45,
-    0x61, 0x62, 0x69, 0x6F, 0x70, 0xA8, 0xA4, 0xFF, 0xEF, 0xFF, 0xF6, 0xFF, 0xFC, 0xAB, 0x4E, 0xC1,
-    0x02, 0x11, 0x72, 0xA8, 0xA2, 0xC4, 0x02, 0xB1, 0x6D, 0x6E, 0x73, 0x76, 0xA8, 0x9C, 0xA8, 0x64,
-    0xAD, 0x3E, 0xA1, 0x45, 0xC1, 0x07, 0xE2, 0x77, 0xA8, 0x8D, 0x42, 0x72, 0x73, 0xA9, 0xBD, 0xA8,
-    0x87, 0x42, 0x61, 0x65, 0xF3, 0xF3, 0xFF, 0xF9, 0x48, 0x61, 0x65, 0x69, 0x73, 0x74, 0x75, 0x79,
-    0x7A, 0xA5, 0xAF, 0xFF, 0xD7, 0xFF, 0xDD, 0xFF, 0xEC, 0xFF, 0xF9, 0xA1, 0x10, 0xA7, 0xEC, 0xA7,
-    0xEC, 0x43, 0x72, 0x73, 0x75, 0xA9, 0xEC, 0xA7, 0xCB, 0xA9, 0x69, 0xC1, 0x02, 0xB1, 0x72, 0xA6,
-    0xBF, 0x42, 0x61, 0x6E, 0xA7, 0xBB, 0xC2, 0xBF, 0x41, 0x74, 0xA1, 0x2A, 0x21, 0x72, 0xFC, 0xA1,
-    0x01, 0xE1, 0x6F, 0xFD, 0x42, 0x69, 0x75, 0xCC, 0x9C, 0xA0, 0xCE, 0x45, 0x65, 0x69, 0x6C, 0x70,
-    0x74, 0xFF, 0xE0, 0xFF, 0xE6, 0xA8, 0x1C, 0xFF, 0xF4, 0xFF, 0xF9, 0x41, 0x2E, 0xC6, 0xC2, 0xC4,
-    0x02, 0xB1, 0x2E, 0x67, 0x73, 0x6C, 0xA7, 0x8A, 0xA8, 0xAA, 0xA8, 0xAA, 0xFF, 0xFC, 0x42, 0x65,
-    0x72, 0xAA, 0xBC, 0xA8, 0x13, 0xC1, 0x02, 0x21, 0x69, 0xA4, 0x91, 0x41, 0x6C, 0xD9, 0x40, 0x46,
-    0x66, 0x6E, 0x6F, 0x74, 0x7A, 0x61, 0xFF, 0xF6, 0xA7, 0xD9, 0xA7, 0xE8, 0xA9, 0x0B, 0xA7, 0xAC,
-    0xFF, 0xFC, 0x41, 0x67, 0xC3, 0xE6, 0x21, 0x6E, 0xFC, 0xA1, 0x02, 0x81, 0x69, 0xFD, 0xC1, 0x00,
-    0x41, 0x65, 0xA7, 0xE3, 0x43, 0x65, 0x68, 0x69, 0xAB, 0x72, 0xA9, 0xC8, 0xFF, 0xFA, 0x4E, 0x61,
-    0x62, 0x63, 0x64, 0x65, 0x66, 0x69, 0x6C, 0x6E, 0x6F, 0x70, 0x73, 0x74, 0x75, 0xFF, 0xB1, 0xA8,
-    0x12, 0xA0, 0x6A, 0xA7, 0xAA, 0xA0, 0x88, 0xFF, 0xC0, 0xFF, 0xD1, 0xFF, 0xEB, 0xAA, 0x72, 0xA9,
-    0xE3, 0xD2, 0xB4, 0xAE, 0x9D, 0xFF, 0xF6, 0xA7, 0xB9, 0x43, 0x64, 0x6E, 0x70, 0xA7, 0x13, 0xA7,
-    0x13, 0xA7, 0xA8, 0xC1, 0x00, 0xD1, 0x69, 0xA7, 0x48, 0x42, 0x61, 0x72, 0xA0, 0x47, 0xB9, 0x48,
-    0x42, 0x61, 0x63, 0xA6, 0xFC, 0xA7, 0x77, 0x41, 0x72, 0xAB, 0x77, 0x42, 0x65, 0x72, 0xFF, 0xFC,
-    0xA7, 0x5D, 0xC1, 0x02, 0x11, 0x72, 0xA0, 0x10, 0xC9, 0x02, 0x41, 0x61, 0x63, 0x65, 0x69, 0x6C,
-    0x70, 0x73, 0x74, 0x75, 0xFF, 0xD1, 0xFF, 0xDB, 0xFF, 0xE1, 0xFF, 0xE8, 0xA7, 0x95, 0xA7, 0x50,
-    0xA8, 0x0B, 0xFF, 0xF3, 0xFF, 0xFA, 0x42, 0x62, 0x74, 0x9F, 0xF2, 0xA7, 0x41, 0xC1, 0x01, 0x91,
-    0x69, 0x9F, 0xE5, 0x43, 0x2E, 0x6C, 0x6E, 0xA6, 0xB6, 0xA6, 0xB6, 0xFF, 0xFA, 0x42, 0x65, 0x67,
-    0xA7, 0x2A, 0xA6, 0xEE, 0x41, 0x6E, 0xCD, 0x24, 0xC5, 0x0A, 0x23, 0x6C, 0x6E, 0x6F, 0x73, 0x7A,
-    0xB8, 0x0B, 0xFF, 0xF5, 0xFF, 0xFC, 0xA7, 0xC1, 0xA8, 0x90, 0x41, 0x69, 0xD2, 0x59, 0x21, 0x74,
-    0xFC, 0x21, 0x61, 0xFD, 0x45, 0x66, 0x67, 0x6D, 0x6E, 0x75, 0xA6, 0x90, 0x9F, 0xCC, 0xFF, 0xFD,
-    0xA6, 0x88, 0xA7, 0xA5, 0x46, 0x61, 0x65, 0x69, 0x6C, 0x6F, 0x73, 0xFF, 0xB2, 0xFF, 0xBF, 0xFF,
-    0xD4, 0xA9, 0x52, 0xFF, 0xF0, 0x9F, 0xA4, 0xC1, 0x02, 0x21, 0x6D, 0xA6, 0xFA, 0x56, 0x61, 0x62,
-    0x63, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74,
-    0x75, 0x76, 0x78, 0x7A, 0xFC, 0xE7, 0xFD, 0x19, 0xFD, 0x27, 0xFD, 0x61, 0xFD, 0x86, 0xFD, 0x8D,
-    0xFD, 0x98, 0xFD, 0xAF, 0xA6, 0x5F, 0xA6, 0x5C, 0xFE, 0x09, 0xFE, 0x42, 0xFE, 0x7B, 0xFE, 0x94,
-    0xFE, 0xBE, 0xFF, 0x21, 0xFF, 0x7B, 0xFF, 0xE7, 0xFF, 0xFA, 0xB6, 0xD4, 0xB2, 0x56, 0xA7, 0x33,
-    0xA0, 0x11, 0x23, 0x42, 0x69, 0x75, 0xB1, 0x06, 0x9F, 0x57, 0x41, 0x72, 0xA7, 0x1C, 0x21, 0x65,
-    0xFC, 0xC2, 0x00, 0x51, 0x65, 0x75, 0xA6, 0xA0, 0xFF, 0xFD, 0x43, 0x69, 0x6F, 0x75, 0xAA, 0x84,
-    0x9F, 0x46, 0x9F, 0x3A, 0x41, 0x65, 0xAC, 0x7A, 0x21, 0x69, 0xFC, 0x41, 0x76, 0xA7, 0x8F, 0xA1,
-    0x02, 0x71, 0x69, 0xFC, 0x41, 0x76, 0xA0, 0xC0, 0x21, 0x65, 0xFC, 0x21, 0x64, 0xFD, 0xCB, 0x03,
-    0xD1, 0x2E, 0x62, 0x63, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x74, 0x75, 0xA7, 0xD2, 0xFF, 0xC2,
-    0xFF, 0xC5, 0xFF, 0xD3, 0xFF, 0xDC, 0xA9, 0x96, 0xDF, 0x23, 0xCD, 0x4D, 0xFF, 0xEA, 0xFF, 0xF1,
-    0xFF, 0xFD, 0x44, 0x2E, 0x6C, 0x6F, 0x79, 0xA6, 0x35, 0xA1, 0xC5, 0xA6, 0x4F, 0xA6, 0xD7, 0x42,
-    0x6F, 0x75, 0xA0, 0x7A, 0xA8, 0x98, 0xC1, 0x01, 0x41, 0x79, 0xE7, 0x3E, 0xE1, 0x02, 0x21, 0x63,
-    0x7F, 0x9E, 0xE4, 0xA0, 0x11, 0xD2, 0x21, 0x67, 0xFD, 0x45, 0x2E, 0x6C, 0x6E, 0x73, 0x69, 0xA7,
-    0x87, 0xFF, 0xED, 0xFF, 0xF3, 0xA6, 0xB0, 0xFF, 0xFD, 0x41, 0x69, 0xB4, 0xCA, 0x41, 0x65, 0xA6,
-    0xB7, 0x46, 0x64, 0x65, 0x69, 0x6D, 0x73, 0x74, 0xA6, 0x98, 0xFF, 0xE8, 0xA4, 0xB5, 0xFF, 0xF8,
-    0xFF, 0xFC, 0xC5, 0x74, 0x41, 0x74, 0xC3, 0xBF, 0x62, 0x65, 0x69, 0x7F, 0x9E, 0x90, 0x7F, 0xFF,
-    0xFC, 0xC2, 0x0A, 0x02, 0x2E, 0x74, 0xA5, 0x58, 0xFF, 0xF7, 0xE1, 0x02, 0x31, 0x72, 0x7F, 0x9E,
-    0x90, 0x42, 0x65, 0x79, 0xFF, 0xF9, 0xA5, 0xE0, 0x68, 0x2E, 0x64, 0x67, 0x6C, 0x6E, 0x72, 0x73,
-    0x74, 0x7F, 0xA5, 0x41, 0x7F, 0xA5, 0x41, 0x7F, 0x9E, 0x82, 0x7F, 0xFF, 0x8A, 0x7F, 0xFF, 0x97,
-    0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xE9, 0x7F, 0xFF, 0xF9, 0x42, 0x6C, 0x6E, 0xCC, 0x92, 0xA7, 0x17,
-    0x44, 0x2E, 0x64, 0x6E, 0x73, 0xA7, 0x10, 0xA7, 0x10, 0xAD, 0x73, 0xA7, 0x10, 0x42, 0x65, 0x69,
-    0xFF, 0xF3, 0xA7, 0x03, 0x42, 0x74, 0x7A, 0xA6, 0xFC, 0xD2, 0xE7, 0xA1, 0x02, 0x41, 0x69, 0xF9,
-    0xE4, 0x02, 0xB1, 0x61, 0x63, 0x64, 0x67, 0x7F, 0xA6, 0x31, 0x7F, 0xA5, 0x59, 0x7F, 0x9E, 0x40,
-    0x7F, 0xA4, 0xF9, 0x63, 0x6C, 0x72, 0x75, 0x7F, 0x9E, 0x27, 0x7F, 0xB5, 0x4B, 0x7F, 0xA5, 0x55,
-    0x63, 0x69, 0x6F, 0x75, 0x7F, 0x9E, 0x1D, 0x7F, 0xA5, 0x1B, 0x7F, 0xA5, 0x1B, 0x63, 0x69, 0x72,
-    0x79, 0x7F, 0xA4, 0xCC, 0x7F, 0x9E, 0x0D, 0x7F, 0xA4, 0xCC, 0xA0, 0x26, 0xE3, 0x21, 0x72, 0xFD,
-    0x21, 0x61, 0xFD, 0x21, 0x70, 0xFD, 0xA1, 0x02, 0x71, 0x69, 0xFD, 0x6D, 0x61, 0x64, 0x66, 0x67,
-    0x6B, 0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x76, 0x7F, 0xFF, 0x8E, 0x7F, 0xFF, 0xA2, 0x7F,
-    0xA5, 0x2C, 0x7F, 0xA5, 0x8C, 0x7F, 0x9D, 0xDD, 0x7F, 0xFF, 0xB0, 0x7F, 0xFF, 0xB5, 0x7F, 0xFF,
-    0xC8, 0x7F, 0xA5, 0x46, 0x7F, 0xA8, 0x69, 0x7F, 0xFF, 0xD5, 0x7F, 0xFF, 0xE2, 0x7F, 0xFF, 0xFB,
-    0xA0, 0x26, 0xB3, 0x21, 0x75, 0xFD, 0x21, 0x64, 0xFD, 0x41, 0x70, 0xA2, 0x1E, 0x21, 0x65, 0xFC,
-    0xA2, 0x00, 0x51, 0x72, 0x63, 0xF6, 0xFD, 0x44, 0x61, 0x65, 0x74, 0x76, 0xA4, 0xFA, 0xA4, 0x65,
-    0xA6, 0x59, 0xA5, 0x9D, 0x63, 0x61, 0x69, 0x79, 0x7F, 0xC9, 0x4C, 0x7F, 0x9D, 0x7E, 0x7F, 0xA4,
-    0xED, 0x42, 0x61, 0x65, 0xA4, 0xE0, 0xC0, 0x74, 0x47, 0x2E, 0x69, 0x6B, 0x6C, 0x6D, 0x72, 0x74,
-    0xA6, 0x38, 0xFF, 0xD8, 0xA5, 0x7C, 0xFF, 0xDF, 0xAB, 0x4C, 0xFF, 0xEC, 0xFF, 0xF9, 0x46, 0x61,
-    0x65, 0x69, 0x6F, 0x76, 0x79, 0xFE, 0x50, 0xFE, 0xEA, 0xFF, 0x7D, 0xFF, 0xEA, 0xA5, 0x63, 0xA5,
-    0x4B, 0x41, 0x6C, 0xA4, 0x1B, 0x62, 0x65, 0x6F, 0x7F, 0xAC, 0x25, 0x7F, 0x9D, 0x5B, 0xA0, 0x27,
-    0x13, 0x21, 0x61, 0xFD, 0x21, 0x77, 0xFD, 0xA1, 0x00, 0x51, 0x65, 0xFD, 0x21, 0x74, 0xFB, 0x41,
-    0x65, 0xA4, 0x69, 0xA0, 0x27, 0x42, 0x42, 0x72, 0x67, 0xA3, 0xFE, 0xFF, 0xFD, 0x21, 0x65, 0xF9,
-    0x6A, 0x62, 0x63, 0x67, 0x69, 0x6C, 0x6D, 0x72, 0x73, 0x74, 0x76, 0x7F, 0xFF, 0xD1, 0x7F, 0xAC,
-    0x40, 0x7F, 0xFF, 0xD5, 0x7F, 0xA2, 0x03, 0x7F, 0xA5, 0xD1, 0x7F, 0x9D, 0x18, 0x7F, 0x9E, 0x81,
-    0x7F, 0xFF, 0xEC, 0x7F, 0xFF, 0xEF, 0x7F, 0xFF, 0xFD, 0x42, 0x72, 0x74, 0xA2, 0x06, 0xAD, 0x61,
-    0x41, 0x6E, 0xA0, 0x10, 0x63, 0x74, 0x76, 0x6B, 0x7F, 0x9E, 0x73, 0x7F, 0x9C, 0xFC, 0x7F, 0xFF,
-    0xFC, 0x47, 0x61, 0x64, 0x65, 0x6C, 0x72, 0x73, 0x76, 0xFF, 0xE8, 0xB9, 0x37, 0xFF, 0xF3, 0xA1,
-    0x0C, 0xA5, 0x49, 0xA1, 0x19, 0xA4, 0x26, 0xC1, 0x00, 0xD1, 0x6C, 0xBF, 0xFA, 0x62, 0x64, 0x67,
-    0x7F, 0x9C, 0xF8, 0x7F, 0x9C, 0xBB, 0x61, 0x70, 0x7F, 0x9C, 0xD3, 0x21, 0x73, 0xFB, 0x21, 0x65,
-    0xFD, 0xE7, 0x02, 0x81, 0x6C, 0x6E, 0x72, 0x73, 0x74, 0x7A, 0x64, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF,
-    0xEC, 0x7F, 0x9C, 0xA7, 0x7F, 0xFD, 0xFC, 0x7F, 0xA0, 0xE5, 0x7F, 0x9C, 0xBF, 0x7F, 0xFF, 0xFD,
-    0x42, 0x65, 0x69, 0xB2, 0xF3, 0xA8, 0x9B, 0x41, 0x65, 0xA4, 0x30, 0x41, 0x6E, 0xB7, 0xF3, 0x21,
-    0x65, 0xFC, 0xE3, 0x11, 0x52, 0x6D, 0x76, 0x6B, 0x7F, 0x9C, 0x82, 0x7F, 0xFF, 0xF5, 0x7F, 0xFF,
-    0xFD, 0x61, 0x6F, 0x7F, 0x9D, 0xF6, 0x21, 0x72, 0xFB, 0x21, 0x61, 0xFD, 0xA1, 0x00, 0x51, 0x70,
-    0xFD, 0x42, 0x61, 0x65, 0xA1, 0xA0, 0xCE, 0xC6, 0xA1, 0x00, 0x51, 0x74, 0xF9, 0x22, 0x61, 0x69,
-    0xEF, 0xFB, 0x44, 0x68, 0x6C, 0x70, 0x74, 0xA3, 0x95, 0xA3, 0xAF, 0xA3, 0xEE, 0xAE, 0x8D, 0x6F,
-    0x61, 0x62, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x79, 0x63, 0x7F,
-    0xFF, 0x21, 0x7F, 0xA4, 0xAB, 0x7F, 0xFF, 0x62, 0x7F, 0x9C, 0x9F, 0x7F, 0xFF, 0x92, 0x7F, 0xA4,
-    0x2A, 0x7F, 0xFF, 0xB1, 0x7F, 0xDD, 0x27, 0x7F, 0xFF, 0xC3, 0x7F, 0xA3, 0x0D, 0x7F, 0xFF, 0xEE,
-    0x7F, 0xFF, 0xF3, 0x7F, 0xA3, 0x0A, 0x7F, 0xA3, 0xA2, 0x7F, 0xA3, 0x88, 0xE5, 0x02, 0xB1, 0x63,
-    0x67, 0x6D, 0x70, 0x73, 0x7F, 0xA0, 0x19, 0x7F, 0xDC, 0xEA, 0x7F, 0x9C, 0x0E, 0x7F, 0xA3, 0xED,
-    0x7F, 0x9C, 0x14, 0xA0, 0x06, 0x72, 0x41, 0x75, 0xB3, 0x54, 0x62, 0x69, 0x6F, 0x7F, 0x9B, 0xDE,
-    0x7F, 0xA2, 0xBA, 0xC3, 0x02, 0xB1, 0x63, 0x64, 0x72, 0xFF, 0xF3, 0xA3, 0x06, 0xFF, 0xF7, 0xE1,
-    0x00, 0xD1, 0x6C, 0x7F, 0x9B, 0xEA, 0xE2, 0x02, 0xB1, 0x69, 0x75, 0x7F, 0xFF, 0xF9, 0x7F, 0x9B,
-    0xC2, 0x42, 0x65, 0x69, 0xA3, 0xA8, 0xA8, 0x8C, 0xC4, 0x02, 0x21, 0x61, 0x63, 0x64, 0x6D, 0xA2,
-    0x8C, 0xA2, 0x8C, 0xC9, 0xF3, 0xFF, 0xF9, 0x41, 0x6E, 0xB8, 0x0C, 0x61, 0x6F, 0x7F, 0x9B, 0xE7,
-    0x21, 0x74, 0xFB, 0x62, 0x63, 0x64, 0x7F, 0xFF, 0xFD, 0x7F, 0x9B, 0xA7, 0xA2, 0x02, 0x21, 0x61,
-    0x65, 0xEB, 0xF7, 0xC1, 0x07, 0x82, 0x69, 0xA2, 0xD4, 0xC1, 0x02, 0xB1, 0x61, 0xA2, 0x92, 0x61,
-    0x73, 0x7F, 0x9D, 0x25, 0x21, 0x69, 0xFB, 0xA1, 0x02, 0xB1, 0x75, 0xFD, 0x4B, 0x61, 0x63, 0x65,
-    0x68, 0x69, 0x6F, 0x70, 0x74, 0x75, 0x78, 0x71, 0xFF, 0x70, 0xFF, 0x87, 0xFF, 0x97, 0xFF, 0xAA,
-    0xFF, 0xBC, 0xBA, 0x05, 0xFF, 0xE0, 0xFF, 0xE7, 0xFF, 0xED, 0xA2, 0xD5, 0xFF, 0xFB, 0x43, 0x63,
-    0x72, 0x74, 0xA2, 0x1E, 0xC4, 0x51, 0xA2, 0x1E, 0xC1, 0x00, 0x51, 0x64, 0xE0, 0x00, 0xA1, 0x02,
-    0x21, 0x65, 0xFA, 0x62, 0x6D, 0x74, 0x7F, 0x9B, 0x2F, 0x7F, 0x9B, 0x2F, 0xC3, 0x02, 0xB1, 0x65,
-    0x68, 0x6F, 0xBB, 0x2F, 0xFF, 0xF2, 0xFF, 0xF7, 0xC1, 0x02, 0xB1, 0x66, 0xA3, 0x11, 0x41, 0x79,
-    0xA0, 0xA2, 0x21, 0x72, 0xFC, 0x21, 0x65, 0xFD, 0xA1, 0x00, 0x51, 0x74, 0xFD, 0x44, 0x65, 0x72,
-    0x73, 0x74, 0xA1, 0xDF, 0xFF, 0xEB, 0xFF, 0xFB, 0xA2, 0x74, 0x44, 0x61, 0x6C, 0x6F, 0x75, 0xA2,
-    0x4D, 0xD9, 0xBF, 0xA2, 0x4D, 0xA1, 0xD2, 0x61, 0x6C, 0x7F, 0x9B, 0x18, 0x21, 0x6F, 0xFB, 0x41,
-    0x79, 0xA1, 0xE6, 0x21, 0x72, 0xFC, 0xA1, 0x00, 0x51, 0x74, 0xFD, 0x43, 0x62, 0x65, 0x70, 0xFF,
-    0xF1, 0xFF, 0xFB, 0xCB, 0x51, 0x45, 0x63, 0x64, 0x67, 0x69, 0x78, 0xD6, 0x85, 0xA1, 0xAF, 0xA1,
-    0xAF, 0xA3, 0xC4, 0xA3, 0x9B, 0x42, 0x65, 0x73, 0xA1, 0xBA, 0xA2, 0xB4, 0xE5, 0x07, 0x42, 0x64,
-    0x67, 0x6D, 0x6E, 0x73, 0x7F, 0xA1, 0x98, 0x7F, 0xA3, 0xB5, 0x7F, 0x9A, 0xBC, 0x7F, 0xFF, 0xF9,
-    0x7F, 0xA2, 0xAD, 0x62, 0x64, 0x72, 0x7F, 0xA2, 0x96, 0x7F, 0x9A, 0xC6, 0xC1, 0x02, 0x21, 0x63,
-    0xA2, 0x8D, 0x41, 0x61, 0xA4, 0x9B, 0x45, 0x65, 0x69, 0x6F, 0x74, 0x75, 0xFF, 0xED, 0xA1, 0xA5,
-    0xFF, 0xF6, 0xFF, 0xFC, 0xA1, 0x66, 0x44, 0x61, 0x69, 0x6F, 0x72, 0xAC, 0x1A, 0xA3, 0x95, 0xA1,
-    0xD1, 0xA1, 0xEB, 0x43, 0x63, 0x6F, 0x73, 0xA2, 0x04, 0xA1, 0x88, 0xA2, 0x81, 0x41, 0x6F, 0xA2,
-    0xDD, 0xC2, 0x01, 0xF1, 0x61, 0x72, 0xA1, 0x7A, 0xFF, 0xFC, 0x67, 0x63, 0x65, 0x69, 0x6F, 0x73,
-    0x74, 0x75, 0x7F, 0xA1, 0xC7, 0x7F, 0xFE, 0x79, 0x7F, 0xFF, 0xE9, 0x7F, 0xA2, 0x4F, 0x7F, 0x9A,
-    0x5E, 0x7F, 0xFF, 0xF7, 0x7F, 0x9B, 0xF8, 0x41, 0x69, 0xBF, 0x9B, 0x42, 0x68, 0x69, 0xFF, 0xFC,
-    0xAD, 0xFC, 0x51, 0x61, 0x62, 0x63, 0x64, 0x65, 0x67, 0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
-    0x72, 0x73, 0x74, 0x77, 0xFE, 0xEC, 0xA2, 0xA8, 0xFF, 0x0A, 0xA2, 0xA8, 0xFF, 0x2B, 0xA5, 0xD6,
-    0xA9, 0x61, 0xA2, 0xA8, 0xFF, 0x38, 0xFF, 0x59, 0xFF, 0x63, 0xFF, 0x7A, 0xFF, 0xA4, 0xFF, 0xB4,
-    0xFF, 0xD8, 0xFF, 0xF9, 0xA2, 0xA8, 0xE2, 0x01, 0xF1, 0x62, 0x72, 0x7F, 0xB1, 0xFC, 0x7F, 0x9B,
-    0xA0, 0xC1, 0x02, 0xB1, 0x6F, 0xA1, 0x0A, 0xE4, 0x02, 0x41, 0x6E, 0x70, 0x72, 0x74, 0x7F, 0xA1,
-    0x5A, 0x7F, 0xA1, 0x5A, 0x7F, 0xFF, 0xFA, 0x7F, 0x99, 0xF1, 0x41, 0x6E, 0xA2, 0x29, 0xC3, 0x03,
-    0xE2, 0x6C, 0x73, 0x61, 0xA1, 0xCB, 0xA1, 0xCB, 0xFF, 0xFC, 0xA0, 0x19, 0x82, 0x21, 0x72, 0xFD,
-    0x21, 0x68, 0xFD, 0xC3, 0x03, 0xD1, 0x6D, 0x6F, 0x70, 0xA1, 0x2E, 0xA1, 0xC0, 0xFF, 0xFD, 0xC2,
-    0x0A, 0x23, 0x79, 0x77, 0xA1, 0xAA, 0xCD, 0xF1, 0x69, 0x61, 0x62, 0x65, 0x69, 0x6C, 0x6D, 0x6F,
-    0x74, 0x7A, 0x7F, 0xFF, 0xAE, 0x7F, 0xA0, 0x81, 0x7F, 0xFF, 0xBF, 0x7F, 0xFF, 0xD6, 0x7F, 0xA2,
-    0x78, 0x7F, 0xA0, 0x81, 0x7F, 0xFF, 0xEB, 0x7F, 0x99, 0xED, 0x7F, 0xFF, 0xF7, 0x5B, 0x2E, 0x61,
-    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71,
-    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xA0, 0x16, 0xA7, 0x72, 0xAA, 0x96, 0xAE,
-    0xF7, 0xB3, 0x08, 0xBB, 0x8C, 0xBD, 0xBA, 0xC0, 0x91, 0xC3, 0x6B, 0xC9, 0xA0, 0xCA, 0x3D, 0xCB,
-    0x0E, 0xCF, 0xE3, 0xD3, 0xFE, 0xD8, 0xF4, 0xDF, 0x23, 0xE3, 0x9B, 0xE4, 0x25, 0xEA, 0x8B, 0xF0,
-    0xDD, 0xF6, 0x7C, 0xFA, 0x00, 0xFC, 0x31, 0xFD, 0x52, 0xFE, 0x1F, 0xFF, 0x55, 0xFF, 0xDB,
+    0x04, 0x0B, 0x0C, 0x0C, 0x0D, 0x0E, 0x22, 0x01, 0x0D, 0x0B, 0x19, 0x18, 0x05, 0x02, 0x0B, 0x17,
+    0x15, 0x20, 0x0F, 0x0C, 0x2C, 0x03, 0x0D, 0x0C, 0x23, 0x16, 0x2D, 0x0B, 0x0E, 0x0E, 0x0F, 0x2B,
+    0x19, 0x0F, 0x37, 0x04, 0x0D, 0x23, 0x1F, 0x0F, 0x21, 0x03, 0x22, 0x35, 0x41, 0x0F, 0x0E, 0x2E,
+    0x36, 0x01, 0x16, 0x18, 0x0B, 0x29, 0x29, 0x0E, 0x35, 0x10, 0x0C, 0x04, 0x18, 0x33, 0x0B, 0x23,
+    0x15, 0x15, 0x21, 0x0D, 0x0D, 0x18, 0x0E, 0x0C, 0x0B, 0x15, 0x1A, 0x02, 0x0B, 0x0E, 0x0E, 0x0B,
+    0x05, 0x0F, 0x17, 0x0E, 0x0E, 0x0D, 0x04, 0x17, 0x18, 0x18, 0x02, 0x16, 0x16, 0x0F, 0x02, 0x0D,
+    0x05, 0x17, 0x04, 0x22, 0x04, 0x0D, 0x0C, 0x33, 0x15, 0x03, 0x1F, 0x15, 0x0B, 0x15, 0x21, 0x03,
+    0x29, 0x0F, 0x1F, 0x0C, 0x3D, 0x2B, 0x1F, 0x49, 0x0D, 0x2D, 0x19, 0x2A, 0x02, 0x0B, 0x0C, 0x0B,
+    0x16, 0x16, 0x0D, 0x0B, 0x0E, 0x15, 0x02, 0x0D, 0x0E, 0x22, 0x0B, 0x15, 0x0F, 0x1F, 0x0D, 0x20,
+    0x05, 0x21, 0x29, 0x10, 0x21, 0x0B, 0x05, 0x20, 0x10, 0x1A, 0x0B, 0x0B, 0x05, 0x1F, 0x0B, 0x01,
+    0x2B, 0x0C, 0x38, 0x16, 0x1F, 0x10, 0x18, 0x0D, 0x1F, 0x18, 0x0B, 0x01, 0x29, 0x0E, 0x18, 0x0C,
+    0x0B, 0x23, 0x01, 0x0C, 0x40, 0x0F, 0x2D, 0x0D, 0x0C, 0x0F, 0x0C, 0x0B, 0x0D, 0x1F, 0x0D, 0x21,
+    0x3F, 0x20, 0x0B, 0x02, 0x0F, 0x03, 0x0C, 0x03, 0x0C, 0x15, 0x0B, 0x03, 0x0E, 0x21, 0x0C, 0x2D,
+    0x0E, 0x03, 0x33, 0x05, 0x19, 0x15, 0x1A, 0x0F, 0x17, 0x1F, 0x04, 0x0E, 0x04, 0x0F, 0x22, 0x15,
+    0x01, 0x20, 0x05, 0x2C, 0x33, 0x29, 0x24, 0x0B, 0x2C, 0x0F, 0x05, 0x17, 0x23, 0x04, 0x16, 0x23,
+    0x0C, 0x1F, 0x1F, 0x19, 0x0E, 0x19, 0x33, 0x19, 0x0C, 0x15, 0x1F, 0x0B, 0x22, 0x0F, 0x19, 0x06,
+    0x17, 0x17, 0x0B, 0x18, 0x02, 0x0C, 0x23, 0x10, 0x03, 0x18, 0x0F, 0x0B, 0x03, 0x1F, 0x0B, 0x21,
+    0x0E, 0x2D, 0x23, 0x1A, 0x0D, 0x17, 0x42, 0x34, 0x0B, 0x19, 0x23, 0x21, 0x22, 0x03, 0x2A, 0x2B,
+    0x10, 0x0D, 0x0C, 0x2B, 0x0D, 0x2C, 0x0D, 0x05, 0x22, 0x01, 0x35, 0x01, 0x0E, 0x17, 0x29, 0x05,
+    0x18, 0x17, 0x19, 0x01, 0x0C, 0x0C, 0x02, 0x0D, 0x0C, 0x03, 0x15, 0x16, 0x0B, 0x0D, 0x23, 0x1F,
+    0x0D, 0x20, 0x0D, 0x38, 0x18, 0x10, 0x0D, 0x0E, 0x21, 0x0B, 0x0B, 0x0F, 0x29, 0x18, 0x21, 0x18,
+    0x0D, 0x16, 0x0B, 0x0D, 0x0B, 0x17, 0x0E, 0x21, 0x1F, 0x0B, 0x01, 0x0B, 0x0C, 0x0F, 0x0F, 0x0C,
+    0x18, 0x2A, 0x0B, 0x17, 0x0D, 0x03, 0x17, 0x21, 0x17, 0x05, 0x23, 0x0F, 0x1F, 0x0E, 0x23, 0x0B,
+    0x05, 0x21, 0x15, 0x04, 0x0F, 0x0E, 0x04, 0x0B, 0x0E, 0x22, 0x0E, 0x24, 0x0D, 0x02, 0x15, 0x0D,
+    0x16, 0x15, 0x20, 0x19, 0x0F, 0x34, 0x2C, 0x16, 0x2E, 0x0F, 0x18, 0x15, 0x05, 0x1F, 0x15, 0x0D,
+    0x15, 0x15, 0x0C, 0x15, 0x23, 0x19, 0x03, 0x17, 0x19, 0x17, 0x2B, 0x38, 0x0B, 0x05, 0x29, 0x15,
+    0x02, 0x22, 0x01, 0x23, 0x0C, 0x22, 0x04, 0x0E, 0x0E, 0x01, 0x21, 0x1A, 0x01, 0x15, 0x17, 0x10,
+    0x16, 0x0D, 0x2E, 0x0B, 0x18, 0x0D, 0x0F, 0x01, 0x19, 0x05, 0x0C, 0x01, 0x1A, 0x33, 0x0C, 0x04,
+    0x0C, 0x04, 0x23, 0x04, 0x15, 0x2E, 0x0D, 0x05, 0x0F, 0x0C, 0x02, 0x18, 0x23, 0x0E, 0x0D, 0x0F,
+    0x1F, 0x0E, 0x0E, 0x16, 0x19, 0x19, 0x16, 0x0D, 0x19, 0x02, 0x0F, 0x0D, 0x02, 0x0B, 0x0E, 0x0D,
+    0x0B, 0x04, 0x0D, 0x0D, 0x03, 0x0E, 0x0E, 0x05, 0x0E, 0x01, 0x18, 0x0C, 0x19, 0x05, 0x16, 0x29,
+    0x1F, 0x10, 0x0B, 0x0E, 0x0D, 0x17, 0x01, 0x10, 0x0D, 0x0D, 0x29, 0x0F, 0x23, 0x16, 0x0E, 0x15,
+    0x15, 0x0B, 0x2B, 0x0F, 0x0B, 0x17, 0x2D, 0x03, 0x19, 0x02, 0x0B, 0x16, 0x01, 0x0E, 0x0D, 0x19,
+    0x29, 0x16, 0x0C, 0x01, 0x16, 0x0B, 0x0C, 0x21, 0x1A, 0x29, 0x0B, 0x1A, 0x15, 0x0D, 0x01, 0x0E,
+    0x0E, 0x03, 0x20, 0x1F, 0x0B, 0x0C, 0x24, 0x0C, 0x02, 0x0F, 0x0C, 0x16, 0x0B, 0x0B, 0x2A, 0x0C,
+    0x03, 0x23, 0x04, 0x19, 0x21, 0x15, 0x0B, 0x05, 0x0F, 0x18, 0x17, 0x15, 0x0C, 0x15, 0x17, 0x19,
+    0x24, 0x0B, 0x15, 0x2A, 0x0D, 0x23, 0x23, 0x21, 0x19, 0x2D, 0x0F, 0x2E, 0x15, 0x2E, 0x18, 0x2D,
+    0x15, 0x29, 0x0C, 0x2D, 0x0C, 0x0B, 0x21, 0x10, 0x2B, 0x0E, 0x37, 0x19, 0x29, 0x10, 0x0B, 0x4B,
+    0x00, 0x03, 0x26, 0x00, 0x09, 0x70, 0x00, 0x09, 0x3B, 0x00, 0x0A, 0x44, 0x00, 0x09, 0x30, 0x00,
+    0x09, 0xC5, 0x00, 0x09, 0xAD, 0x00, 0x09, 0x33, 0x00, 0x0A, 0xEE, 0x00, 0x03, 0x3E, 0x00, 0x03,
+    0x38, 0x00, 0x03, 0x20, 0x00, 0x0A, 0x59, 0x00, 0x0A, 0xA6, 0x00, 0x09, 0x9F, 0x00, 0x03, 0x47,
+    0x00, 0x0B, 0xEF, 0x00, 0x04, 0x90, 0x00, 0x09, 0x8A, 0x00, 0x10, 0x1B, 0x00, 0x03, 0x32, 0x00,
+    0x03, 0x63, 0x00, 0x03, 0x4D, 0x00, 0x04, 0x9E, 0x00, 0x15, 0x4D, 0x00, 0x0C, 0xFC, 0x00, 0x09,
+    0x54, 0x00, 0x06, 0xE3, 0x00, 0x07, 0xE7, 0x00, 0x0A, 0x03, 0x00, 0x06, 0x14, 0x00, 0x0F, 0xBE,
+    0x00, 0x0A, 0x4C, 0x00, 0x0B, 0xD3, 0x00, 0x09, 0xEB, 0x00, 0x0B, 0xF2, 0x00, 0x03, 0xB4, 0x00,
+    0x11, 0xB0, 0x00, 0x03, 0x8B, 0x00, 0x0F, 0xE3, 0x00, 0x05, 0xA6, 0x00, 0x13, 0x51, 0x00, 0x0B,
+    0x37, 0x00, 0x09, 0xFD, 0x00, 0x0F, 0x00, 0x00, 0x05, 0xC8, 0x00, 0x03, 0x29, 0x00, 0x04, 0xA9,
+    0x00, 0x0C, 0x65, 0x00, 0x0B, 0xB8, 0x00, 0x05, 0xB1, 0x00, 0x03, 0x41, 0x00, 0x19, 0x36, 0x00,
+    0x09, 0x68, 0x00, 0x09, 0xE5, 0x00, 0x07, 0x9A, 0x00, 0x16, 0xCF, 0x00, 0x0B, 0xFA, 0x00, 0x0C,
+    0x96, 0x00, 0x10, 0x33, 0x00, 0x09, 0x73, 0x00, 0x04, 0xEB, 0x00, 0x0C, 0xB3, 0x00, 0x06, 0x46,
+    0x80, 0x01, 0x41, 0x01, 0x68, 0x0B, 0x80, 0x00, 0x61, 0x01, 0x72, 0x00, 0x01, 0x65, 0x2E, 0x01,
+    0x64, 0x7D, 0x80, 0x02, 0x61, 0x01, 0x74, 0x14, 0x80, 0x02, 0x81, 0x01, 0x74, 0x0A, 0x80, 0x01,
+    0x81, 0x01, 0x74, 0x09, 0x01, 0x61, 0x33, 0x80, 0x01, 0xA1, 0x01, 0x6D, 0x0F, 0x80, 0x02, 0x21,
+    0x01, 0x73, 0x16, 0x82, 0x01, 0x41, 0x65, 0x69, 0x0A, 0x7D, 0x04, 0x63, 0x67, 0x69, 0x74, 0x09,
+    0x0B, 0x70, 0x79, 0x01, 0x65, 0x00, 0x02, 0x69, 0x79, 0x15, 0x00, 0x02, 0x73, 0x74, 0x09, 0x7B,
+    0x80, 0x02, 0xC1, 0x01, 0x72, 0x7D, 0x01, 0x65, 0x7D, 0x04, 0x63, 0x70, 0x73, 0x74, 0x0A, 0x14,
+    0x14, 0x7D, 0x01, 0x6D, 0x16, 0x01, 0x6F, 0x7D, 0x01, 0x64, 0x14, 0x01, 0x69, 0x00, 0x01, 0x6E,
+    0x0B, 0x0C, 0x63, 0x64, 0x66, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0xBF, 0x92,
+    0xBF, 0x9E, 0xBF, 0xA4, 0xBF, 0xAA, 0xBF, 0xB3, 0xBF, 0xC9, 0xBF, 0xDA, 0x68, 0x74, 0x77, 0x26,
+    0x7D, 0x01, 0x61, 0x09, 0x01, 0x65, 0x0B, 0x03, 0x67, 0x6E, 0x73, 0x00, 0x7A, 0x24, 0x81, 0x01,
+    0x41, 0x61, 0x09, 0x01, 0x6F, 0x09, 0x02, 0x6D, 0x74, 0x0A, 0x7D, 0x02, 0x72, 0x73, 0x73, 0x7B,
+    0x80, 0x07, 0xB1, 0x01, 0x69, 0x7D, 0x01, 0x69, 0x0B, 0x01, 0x74, 0x7D, 0x01, 0x74, 0x7D, 0x04,
+    0x61, 0x65, 0x72, 0x75, 0xBF, 0xD8, 0x6C, 0x74, 0x7D, 0x01, 0x70, 0x24, 0x01, 0x63, 0x0F, 0x01,
+    0x62, 0x16, 0x01, 0x61, 0x7D, 0x01, 0x6C, 0x0F, 0x01, 0x6F, 0x7D, 0x05, 0x6D, 0x6E, 0x70, 0x72,
+    0x74, 0x6E, 0x71, 0x77, 0x7D, 0x00, 0x01, 0x61, 0x00, 0x01, 0x6C, 0x7D, 0x01, 0x69, 0xBF, 0x64,
+    0x01, 0x6C, 0x7C, 0x01, 0x6C, 0x7D, 0x81, 0x00, 0x61, 0x69, 0x7D, 0x01, 0x72, 0x0F, 0x81, 0x01,
+    0x11, 0x74, 0x7D, 0x01, 0x67, 0x78, 0x01, 0x65, 0x75, 0x81, 0x00, 0x61, 0x6E, 0x7D, 0x03, 0x65,
+    0x6E, 0x72, 0x0A, 0x75, 0x7B, 0x05, 0x61, 0x65, 0x68, 0x69, 0x6F, 0xBF, 0xC6, 0xBF, 0xD4, 0x61,
+    0x69, 0x79, 0x01, 0x6F, 0x26, 0x81, 0x02, 0x81, 0x76, 0xBF, 0x6C, 0x02, 0x61, 0x69, 0x0A, 0x7A,
+    0x01, 0x63, 0x0B, 0x04, 0x6D, 0x6F, 0x72, 0x73, 0x6F, 0x0A, 0x78, 0x7D, 0x80, 0x25, 0xF1, 0x01,
+    0x6F, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x74, 0x7D, 0x01, 0x63, 0x7D, 0x01, 0x74, 0x00, 0x80, 0x0C,
+    0xF2, 0x01, 0x76, 0x7D, 0x01, 0x69, 0x7D, 0x02, 0x63, 0x6D, 0x00, 0xBF, 0x78, 0x05, 0x65, 0x69,
+    0x6F, 0x72, 0x75, 0xBF, 0xD6, 0x6B, 0x6E, 0x77, 0x7A, 0x01, 0x68, 0xBE, 0xE7, 0x01, 0x74, 0x7C,
+    0x80, 0x01, 0xF1, 0x01, 0x69, 0x11, 0x02, 0x72, 0x73, 0x77, 0x7D, 0x01, 0x72, 0x0B, 0x80, 0x01,
+    0x11, 0x01, 0x6D, 0x0A, 0x02, 0x64, 0x65, 0x09, 0x7D, 0x80, 0x02, 0xB1, 0x01, 0x6D, 0x2F, 0x03,
+    0x61, 0x67, 0x73, 0x7D, 0x0A, 0x0A, 0x80, 0x19, 0x42, 0x01, 0x74, 0x7D, 0x01, 0x69, 0x7D, 0x01,
+    0x75, 0x7D, 0x01, 0x72, 0x26, 0x80, 0x25, 0xC3, 0x01, 0x6C, 0x7D, 0x01, 0x79, 0x7D, 0x01, 0x68,
+    0x7D, 0x81, 0x02, 0x81, 0x6C, 0xBE, 0x5B, 0x80, 0x25, 0xA2, 0x01, 0x62, 0x7D, 0x01, 0x69, 0x7D,
+    0x01, 0x73, 0x7D, 0x01, 0x72, 0x7D, 0x81, 0x01, 0x11, 0x65, 0x7D, 0x01, 0x65, 0x0F, 0x0D, 0x61,
+    0x62, 0x65, 0x67, 0x6C, 0x6E, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x79, 0xBF, 0xA8, 0x00, 0xBF,
+    0xAD, 0x17, 0xBF, 0xB6, 0xBF, 0xC1, 0xBF, 0xD1, 0xBF, 0xD4, 0x0A, 0x60, 0x63, 0x78, 0x3D, 0x01,
+    0x73, 0x11, 0x01, 0x6D, 0xBF, 0x14, 0x01, 0x72, 0x7C, 0x02, 0x65, 0x6F, 0x76, 0x7D, 0x80, 0x08,
+    0x93, 0x01, 0x6D, 0x7D, 0x01, 0x6F, 0x7D, 0x81, 0x01, 0x11, 0x73, 0x7D, 0x80, 0x25, 0x82, 0x01,
+    0x74, 0x7D, 0x80, 0x03, 0xF2, 0x03, 0x67, 0x6D, 0x74, 0x09, 0x15, 0x7D, 0x82, 0x01, 0x11, 0x6E,
+    0x6F, 0x73, 0x79, 0x02, 0x61, 0x62, 0x09, 0x00, 0x04, 0x61, 0x65, 0x69, 0x6F, 0xBF, 0xDF, 0x74,
+    0x7B, 0x2E, 0x01, 0x69, 0x16, 0x02, 0x64, 0x6B, 0x7D, 0x0F, 0x01, 0x6E, 0x7B, 0x80, 0x17, 0x12,
+    0x01, 0x6F, 0x7D, 0x80, 0x25, 0x62, 0x01, 0x61, 0x7D, 0x02, 0x65, 0x69, 0x0A, 0x16, 0x01, 0x6F,
+    0x7B, 0x85, 0x01, 0x11, 0x6D, 0x70, 0x72, 0x73, 0x74, 0x6F, 0x75, 0x7D, 0x11, 0x11, 0x01, 0x72,
+    0x0A, 0x02, 0x62, 0x65, 0x0A, 0x7D, 0x01, 0x79, 0x0F, 0x02, 0x65, 0x6F, 0x7D, 0x11, 0x02, 0x6E,
+    0x76, 0x7B, 0x0F, 0x04, 0x61, 0x65, 0x69, 0x6F, 0xBF, 0xC7, 0xBF, 0xDE, 0x6E, 0x7B, 0x01, 0x6C,
+    0x2F, 0x02, 0x6C, 0x6F, 0x00, 0x7D, 0x01, 0x6E, 0x09, 0x01, 0x69, 0x28, 0x02, 0x6D, 0x70, 0x0A,
+    0x7D, 0x01, 0x69, 0x0A, 0x80, 0x0E, 0xF2, 0x01, 0x74, 0x7D, 0x85, 0x02, 0x61, 0x63, 0x65, 0x6B,
+    0x73, 0x75, 0x32, 0xBE, 0x16, 0x17, 0x0A, 0x7D, 0x01, 0x72, 0x09, 0x05, 0x64, 0x6D, 0x6E, 0x72,
+    0x73, 0xBF, 0xD6, 0x61, 0x6F, 0x2D, 0x26, 0x01, 0x75, 0xBF, 0xA7, 0x80, 0x24, 0x32, 0x01, 0x69,
+    0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x6C, 0x7D, 0x80, 0x24, 0x03, 0x01, 0x65, 0x7D, 0x01, 0x74, 0x7D,
+    0x01, 0x72, 0x7D, 0x02, 0x69, 0x6F, 0x71, 0x7D, 0x01, 0x79, 0x00, 0x02, 0x65, 0x68, 0xBE, 0x20,
+    0x16, 0x03, 0x63, 0x6D, 0x74, 0x77, 0x00, 0x7A, 0x80, 0x0E, 0x61, 0x01, 0x73, 0x7D, 0x01, 0x65,
+    0x7D, 0x01, 0x63, 0x7D, 0x80, 0x03, 0x51, 0x85, 0x01, 0x11, 0x67, 0x69, 0x6E, 0x70, 0x76, 0x3D,
+    0x7A, 0x0B, 0x0F, 0x1E, 0x81, 0x00, 0x61, 0x61, 0x0F, 0x04, 0x67, 0x6E, 0x6F, 0x74, 0x7B, 0x17,
+    0x0A, 0x00, 0x03, 0x61, 0x65, 0x69, 0xBF, 0xCF, 0x65, 0x77, 0x80, 0x24, 0x92, 0x01, 0x61, 0x7D,
+    0x01, 0x6F, 0x0F, 0x01, 0x61, 0x0F, 0x01, 0x69, 0x0F, 0x01, 0x74, 0x3F, 0x04, 0x67, 0x6C, 0x6E,
+    0x72, 0x71, 0x74, 0x77, 0x7D, 0x80, 0x0D, 0xE2, 0x01, 0x6C, 0x7D, 0x01, 0x61, 0x7D, 0x01, 0x63,
+    0x11, 0x01, 0x61, 0x0B, 0x01, 0x6C, 0x7D, 0x02, 0x61, 0x65, 0x7D, 0x2D, 0x83, 0x01, 0x11, 0x67,
+    0x72, 0x74, 0x6F, 0x72, 0x7B, 0x80, 0x25, 0x33, 0x01, 0x63, 0x7D, 0x01, 0x69, 0x7D, 0x80, 0x16,
+    0xC2, 0x01, 0x73, 0x7D, 0x01, 0x72, 0x7D, 0x82, 0x03, 0x51, 0x65, 0x74, 0x7D, 0xBE, 0xCB, 0x02,
+    0x6D, 0x73, 0x6C, 0x78, 0x01, 0x65, 0x11, 0x01, 0x6F, 0x0A, 0x02, 0x6E, 0x72, 0x7A, 0x7D, 0x81,
+    0x01, 0x81, 0x62, 0x16, 0x01, 0x61, 0x7B, 0x01, 0x74, 0x7D, 0x05, 0x61, 0x65, 0x69, 0x6F, 0x75,
+    0xBF, 0xA2, 0xBF, 0xC2, 0x65, 0x70, 0x7D, 0x80, 0x17, 0xB2, 0x01, 0x66, 0x7D, 0x01, 0x6F, 0x7D,
+    0x01, 0x63, 0x00, 0x01, 0x68, 0x1E, 0x01, 0x74, 0x7D, 0x80, 0x25, 0x12, 0x01, 0x6D, 0x7D, 0x01,
+    0x65, 0x7D, 0x02, 0x65, 0x6E, 0x74, 0x7D, 0x03, 0x65, 0x69, 0x6F, 0x66, 0x69, 0x7B, 0x81, 0x01,
+    0x11, 0x64, 0x0F, 0x01, 0x65, 0x09, 0x01, 0x74, 0x1B, 0x01, 0x74, 0xBC, 0xDA, 0x04, 0x61, 0x63,
+    0x64, 0x74, 0x7C, 0x0A, 0x14, 0x0A, 0x01, 0x6C, 0x00, 0x81, 0x02, 0x81, 0x74, 0x7D, 0x01, 0x68,
+    0x11, 0x01, 0x74, 0x11, 0x06, 0x64, 0x66, 0x72, 0x73, 0x74, 0x75, 0xBF, 0xDA, 0x62, 0x69, 0x75,
+    0x7A, 0x7D, 0x01, 0x61, 0xBC, 0xE3, 0x02, 0x65, 0x69, 0x09, 0x33, 0x02, 0x64, 0x74, 0x77, 0x7B,
+    0x01, 0x6E, 0x0F, 0x03, 0x65, 0x6F, 0x74, 0x00, 0x7D, 0x17, 0x80, 0x03, 0xD1, 0x01, 0x73, 0x7D,
+    0x01, 0x79, 0x7D, 0x01, 0x6D, 0x77, 0x01, 0x61, 0x7D, 0x01, 0x74, 0x7D, 0x02, 0x6C, 0x73, 0x74,
+    0x7D, 0x01, 0x6D, 0x1E, 0x02, 0x61, 0x6D, 0x7D, 0x11, 0x01, 0x65, 0x7B, 0x04, 0x65, 0x69, 0x6F,
+    0x72, 0xBF, 0xCF, 0xBF, 0xD7, 0x70, 0x7D, 0x01, 0x74, 0x0B, 0x01, 0x61, 0xBC, 0x16, 0x01, 0x6E,
+    0x7C, 0x01, 0x6F, 0x7D, 0x01, 0x69, 0x7D, 0x80, 0x24, 0xF2, 0x01, 0x6F, 0x7D, 0x01, 0x6E, 0x7D,
+    0x01, 0x65, 0x7D, 0x04, 0x63, 0x6E, 0x74, 0x76, 0x00, 0x64, 0x71, 0x7D, 0x81, 0x07, 0xB1, 0x63,
+    0xBF, 0x02, 0x01, 0x69, 0x33, 0x81, 0x07, 0xB1, 0x74, 0xBB, 0xBF, 0x03, 0x65, 0x6D, 0x73, 0x71,
+    0x77, 0x7A, 0x01, 0x75, 0x0F, 0x02, 0x67, 0x74, 0x00, 0x7D, 0x01, 0x74, 0x0F, 0x01, 0x64, 0x0F,
+    0x03, 0x71, 0x73, 0x77, 0x00, 0x37, 0x7D, 0x01, 0x64, 0x00, 0x05, 0x61, 0x65, 0x69, 0x6F, 0x75,
+    0xBF, 0xC9, 0x61, 0x6B, 0x76, 0x7D, 0x01, 0x69, 0xBE, 0xDE, 0x02, 0x66, 0x6C, 0x16, 0x16, 0x80,
+    0x11, 0x61, 0x80, 0x0B, 0x41, 0x80, 0x24, 0xD2, 0x86, 0x02, 0x21, 0x63, 0x64, 0x70, 0x72, 0x73,
+    0x76, 0x0B, 0x77, 0x7A, 0x7A, 0x7D, 0x7A, 0x01, 0x69, 0x71, 0x01, 0x69, 0x1B, 0x04, 0x6C, 0x6D,
+    0x6E, 0x72, 0xBF, 0xDD, 0x7A, 0x17, 0x7D, 0x80, 0x03, 0x01, 0x01, 0x67, 0x1C, 0x81, 0x01, 0x11,
+    0x6E, 0x7D, 0x80, 0x24, 0xB2, 0x01, 0x6E, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x6F, 0xBF, 0x2F, 0x01,
+    0x6E, 0x7C, 0x02, 0x68, 0x69, 0x76, 0x7D, 0x01, 0x62, 0xBB, 0xEE, 0x81, 0x00, 0x61, 0x61, 0x7C,
+    0x07, 0x63, 0x65, 0x68, 0x69, 0x70, 0x74, 0x79, 0xBF, 0xA6, 0xBF, 0xCD, 0x17, 0xBF, 0xDD, 0x72,
+    0x7B, 0x17, 0x80, 0x02, 0x52, 0x01, 0x72, 0x7D, 0x01, 0x74, 0x7D, 0x01, 0x73, 0x7D, 0x01, 0x65,
+    0x7D, 0x81, 0x00, 0x61, 0x70, 0x7D, 0x01, 0x67, 0xBD, 0x48, 0x01, 0x65, 0x7C, 0x01, 0x61, 0xBE,
+    0xE3, 0x82, 0x00, 0x61, 0x6C, 0x6E, 0x79, 0x7C, 0x01, 0x6F, 0xBD, 0xF2, 0x02, 0x67, 0x6B, 0x1C,
+    0x0F, 0x83, 0x01, 0x11, 0x6C, 0x6D, 0x6E, 0x0B, 0x77, 0x7B, 0x01, 0x67, 0xBD, 0xAE, 0x82, 0x00,
+    0x61, 0x69, 0x6F, 0x0F, 0x7C, 0x01, 0x73, 0x0F, 0x04, 0x6E, 0x70, 0x71, 0x75, 0xBD, 0xF9, 0x76,
+    0x17, 0x7D, 0x01, 0x74, 0x16, 0x01, 0x75, 0x7D, 0x01, 0x62, 0x7D, 0x01, 0x69, 0x7D, 0x06, 0x61,
+    0x65, 0x68, 0x69, 0x6F, 0x72, 0xBF, 0xB3, 0xBF, 0xC3, 0x17, 0xBF, 0xD3, 0x6A, 0x7D, 0x80, 0x24,
+    0x72, 0x01, 0x74, 0x7D, 0x81, 0x02, 0x61, 0x74, 0x7D, 0x01, 0x65, 0x0A, 0x80, 0x24, 0x52, 0x01,
+    0x72, 0x7D, 0x81, 0x02, 0x61, 0x72, 0x7D, 0x07, 0x61, 0x63, 0x64, 0x65, 0x6B, 0x6F, 0x75, 0x6D,
+    0x72, 0xBA, 0xCF, 0x7B, 0x09, 0x09, 0x0A, 0x04, 0x6E, 0x70, 0x72, 0x73, 0x70, 0x0A, 0xBD, 0xDD,
+    0xBA, 0xFA, 0x01, 0x64, 0x24, 0x02, 0x6E, 0x72, 0x7D, 0xBA, 0xEC, 0x80, 0x14, 0x12, 0x01, 0x72,
+    0x7D, 0x01, 0x61, 0x7D, 0x01, 0x63, 0x7D, 0x02, 0x65, 0x69, 0x6E, 0x7D, 0x80, 0x0C, 0x12, 0x01,
+    0x6C, 0x7D, 0x01, 0x62, 0x7D, 0x01, 0x6C, 0x3F, 0x02, 0x65, 0x69, 0x7A, 0x7D, 0x17, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73,
+    0x74, 0x75, 0x76, 0x77, 0x79, 0xBA, 0xA4, 0xBA, 0xF2, 0xBB, 0x48, 0xBB, 0x90, 0xBC, 0x01, 0xBC,
+    0x2C, 0xBC, 0x5B, 0xBC, 0xA6, 0xBC, 0xDE, 0xBC, 0xEA, 0xBD, 0x06, 0xBD, 0x45, 0xBD, 0xBD, 0xBD,
+    0xEA, 0xBE, 0x17, 0xBE, 0x5F, 0xBE, 0xBD, 0xBF, 0x23, 0xBF, 0x91, 0xBF, 0xCA, 0x6A, 0x7B, 0x15,
+    0x80, 0x00, 0x01, 0x80, 0x01, 0x21, 0x02, 0x6C, 0x6E, 0x07, 0x07, 0x80, 0x00, 0xA1, 0x01, 0x64,
+    0x02, 0x81, 0x01, 0x11, 0x72, 0x7D, 0x80, 0x1D, 0x42, 0x01, 0x62, 0x7D, 0x01, 0x61, 0x7D, 0x02,
+    0x61, 0x74, 0x09, 0x7D, 0x01, 0x74, 0x02, 0x01, 0x61, 0x1A, 0x80, 0x02, 0x02, 0x02, 0x63, 0x7A,
+    0x07, 0x7D, 0x01, 0x69, 0x7B, 0x01, 0x6C, 0x7D, 0x01, 0x67, 0x02, 0x81, 0x00, 0x01, 0x6F, 0x35,
+    0x80, 0x00, 0xF1, 0x01, 0x6C, 0x01, 0x08, 0x2E, 0x61, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x75, 0x04,
+    0xBF, 0xC0, 0xBF, 0xCB, 0xBF, 0xD9, 0x61, 0x6F, 0x75, 0x3C, 0x80, 0x00, 0x21, 0x01, 0x6C, 0x12,
+    0x82, 0x00, 0x51, 0x64, 0x6F, 0x02, 0x02, 0x02, 0x62, 0x72, 0x76, 0x79, 0x01, 0x75, 0x07, 0x80,
+    0x01, 0x01, 0x02, 0x6F, 0x72, 0x7A, 0x0E, 0x01, 0x74, 0x07, 0x01, 0x65, 0x7D, 0x80, 0x00, 0x41,
+    0x83, 0x1B, 0xF2, 0x65, 0x6E, 0x6F, 0x06, 0x0E, 0x06, 0x01, 0x62, 0x02, 0x01, 0x6F, 0x7D, 0x01,
+    0x66, 0x09, 0x01, 0x69, 0x7D, 0x80, 0x00, 0xB1, 0x02, 0x6C, 0x6D, 0x01, 0x05, 0x07, 0x61, 0x65,
+    0x68, 0x69, 0x72, 0x74, 0x75, 0xBF, 0xCA, 0xBF, 0xD5, 0xBF, 0xDD, 0x63, 0x6F, 0x75, 0x7B, 0x01,
+    0x6E, 0x05, 0x01, 0x69, 0x7D, 0x01, 0x2E, 0x02, 0x01, 0x72, 0x36, 0x01, 0x61, 0x01, 0x86, 0x00,
+    0xD1, 0x61, 0x63, 0x65, 0x6F, 0x74, 0x75, 0x06, 0x22, 0x2E, 0x06, 0x06, 0x07, 0x01, 0x65, 0x05,
+    0x01, 0x77, 0x01, 0x01, 0x6E, 0x02, 0x01, 0x61, 0x1D, 0x01, 0x75, 0x05, 0x82, 0x00, 0x01, 0x63,
+    0x6D, 0x06, 0x02, 0x88, 0x00, 0x21, 0x64, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x73, 0x75, 0xBF, 0xCF,
+    0xBF, 0xD5, 0xBF, 0xDB, 0x2B, 0x6D, 0x73, 0x76, 0x79, 0x81, 0x00, 0xB1, 0x69, 0x24, 0x01, 0x72,
+    0x7B, 0x80, 0x04, 0xA1, 0x01, 0x68, 0x7D, 0x01, 0x73, 0x7D, 0x81, 0x00, 0x61, 0x69, 0x7D, 0x81,
+    0x00, 0x21, 0x66, 0x7B, 0x80, 0x00, 0x51, 0x02, 0x62, 0x6E, 0x03, 0x00, 0x01, 0x6C, 0x02, 0x03,
+    0x6C, 0x6F, 0x75, 0x20, 0x00, 0x04, 0x80, 0x03, 0xB2, 0x80, 0x01, 0x51, 0x01, 0x69, 0x01, 0x82,
+    0x00, 0x21, 0x67, 0x6E, 0x0C, 0x7D, 0x01, 0x72, 0x07, 0x02, 0x65, 0x6C, 0x7D, 0x02, 0x08, 0x61,
+    0x65, 0x69, 0x6C, 0x6E, 0x6F, 0x75, 0x79, 0xBF, 0xD9, 0x61, 0x0E, 0x68, 0x0E, 0x71, 0x7B, 0x03,
+    0x04, 0x61, 0x65, 0x6C, 0x6F, 0x06, 0x06, 0x05, 0x06, 0x01, 0x2E, 0x06, 0x01, 0x79, 0x02, 0x82,
+    0x01, 0xC2, 0x69, 0x6F, 0x28, 0x09, 0x01, 0x65, 0x28, 0x85, 0x01, 0x91, 0x61, 0x63, 0x6C, 0x6E,
+    0x74, 0x07, 0x70, 0x73, 0x76, 0x7D, 0x80, 0x00, 0x11, 0x01, 0x6E, 0x0E, 0x01, 0x65, 0x7D, 0x03,
+    0x62, 0x64, 0x72, 0x02, 0x01, 0x03, 0x01, 0x69, 0x04, 0x01, 0x69, 0x03, 0x02, 0x64, 0x74, 0x01,
+    0x7D, 0x80, 0x0F, 0xD2, 0x82, 0x00, 0xD1, 0x6E, 0x6F, 0x78, 0x7D, 0x01, 0x2E, 0x05, 0x82, 0x01,
+    0x01, 0x61, 0x65, 0x7D, 0x00, 0x01, 0x76, 0x02, 0x01, 0x63, 0x04, 0x02, 0x65, 0x69, 0x7A, 0x7D,
+    0x01, 0x2E, 0x07, 0x01, 0x67, 0x7D, 0x80, 0x05, 0x02, 0x81, 0x00, 0x01, 0x74, 0x7D, 0x80, 0x00,
+    0xC1, 0x04, 0x2E, 0x73, 0x74, 0x7A, 0x03, 0x78, 0x08, 0x0C, 0x08, 0x61, 0x64, 0x65, 0x69, 0x6C,
+    0x6D, 0x6F, 0x79, 0xBF, 0xB5, 0xBF, 0xBC, 0xBF, 0xCA, 0xBF, 0xD4, 0x61, 0x04, 0x69, 0x77, 0x01,
+    0x63, 0x02, 0x01, 0x73, 0x03, 0x80, 0x01, 0xD2, 0x02, 0x69, 0x6F, 0x7A, 0x7D, 0x85, 0x00, 0x01,
+    0x62, 0x67, 0x72, 0x73, 0x74, 0x02, 0x01, 0xB8, 0x94, 0x72, 0x7B, 0x80, 0x23, 0xD3, 0x01, 0x62,
+    0x7D, 0x01, 0x61, 0x7D, 0x01, 0x74, 0x7D, 0x01, 0x61, 0x02, 0x02, 0x6E, 0x72, 0x7A, 0x2A, 0x81,
+    0x01, 0x01, 0x6F, 0x00, 0x04, 0x63, 0x66, 0x6C, 0x6E, 0x01, 0x02, 0xBF, 0x48, 0x7B, 0x82, 0x00,
+    0x21, 0x6E, 0x72, 0x07, 0x3F, 0x05, 0x61, 0x65, 0x69, 0x6F, 0x70, 0xBF, 0xC8, 0x65, 0x6F, 0x79,
+    0xBF, 0x41, 0x01, 0x65, 0x01, 0x80, 0x02, 0xF1, 0x81, 0x01, 0x51, 0x73, 0x7D, 0x01, 0x79, 0x7B,
+    0x82, 0x00, 0x41, 0x63, 0x69, 0x01, 0x0B, 0x01, 0x69, 0x06, 0x04, 0x67, 0x6C, 0x72, 0x74, 0x68,
+    0x73, 0x76, 0x7D, 0x01, 0x73, 0x0B, 0x01, 0x73, 0x01, 0x01, 0x77, 0x05, 0x84, 0x00, 0x01, 0x65,
+    0x69, 0x6C, 0x6F, 0x77, 0x7A, 0x0E, 0x7D, 0x01, 0x74, 0x36, 0x04, 0x65, 0x6E, 0x73, 0x75, 0x07,
+    0x06, 0x7D, 0x06, 0x82, 0x00, 0xD1, 0x69, 0x6C, 0x1B, 0x0E, 0x80, 0x04, 0xE2, 0x01, 0x73, 0x06,
+    0x80, 0x16, 0x32, 0x02, 0x65, 0x69, 0x05, 0x07, 0x01, 0x65, 0x07, 0x01, 0x68, 0x01, 0x0A, 0x63,
+    0x65, 0x66, 0x6D, 0x6E, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x6C, 0x6F, 0x72, 0x75, 0x31, 0x01, 0x06,
+    0x7D, 0x01, 0x06, 0x01, 0x69, 0x05, 0x01, 0x6C, 0x21, 0x01, 0x7A, 0x08, 0x01, 0x69, 0x7D, 0x01,
+    0x63, 0xB9, 0xD5, 0x81, 0x00, 0xA1, 0x68, 0x16, 0x82, 0x00, 0x61, 0x61, 0x74, 0x77, 0x7B, 0x80,
+    0x01, 0x91, 0x01, 0x6F, 0x05, 0x81, 0x01, 0x91, 0x6F, 0x0A, 0x01, 0x72, 0x05, 0x08, 0x61, 0x63,
+    0x67, 0x6E, 0x70, 0x74, 0x75, 0x76, 0x10, 0x23, 0x2D, 0x05, 0x78, 0x05, 0x39, 0x0A, 0x01, 0x6C,
+    0x1C, 0x80, 0x23, 0xA3, 0x01, 0x65, 0x1E, 0x04, 0x64, 0x65, 0x6E, 0x72, 0x1E, 0x05, 0x7A, 0x7D,
+    0x05, 0x61, 0x69, 0x6F, 0x72, 0x77, 0x6E, 0x77, 0x04, 0x10, 0x05, 0x03, 0x61, 0x6C, 0x72, 0x01,
+    0x01, 0x07, 0x8B, 0x00, 0x21, 0x61, 0x64, 0x65, 0x67, 0x69, 0x6B, 0x6E, 0x6F, 0x73, 0x74, 0x75,
+    0xBF, 0x48, 0xBF, 0x5A, 0xBF, 0x68, 0xBF, 0x71, 0xBF, 0x8C, 0xBF, 0xA4, 0xBF, 0xAA, 0xBF, 0xB6,
+    0xBF, 0xCB, 0x6E, 0x79, 0x02, 0x72, 0x74, 0x0B, 0x02, 0x80, 0x0F, 0x42, 0x01, 0x65, 0x7D, 0x01,
+    0x6C, 0x7D, 0x01, 0x62, 0x7D, 0x01, 0x6F, 0x02, 0x02, 0x61, 0x72, 0x7A, 0x30, 0x01, 0x72, 0x06,
+    0x02, 0x65, 0x69, 0x7D, 0x04, 0x81, 0x00, 0x51, 0x72, 0x02, 0x01, 0x61, 0x7B, 0x01, 0x6C, 0x7D,
+    0x02, 0x61, 0x75, 0x01, 0x06, 0x03, 0x6C, 0x6E, 0x74, 0x78, 0x01, 0x7B, 0x04, 0x63, 0x6C, 0x72,
+    0x73, 0x0F, 0x2A, 0x3F, 0xBA, 0x75, 0x01, 0x73, 0x09, 0x01, 0x65, 0x3A, 0x08, 0x61, 0x65, 0x68,
+    0x69, 0x6C, 0x6F, 0x73, 0x75, 0xBF, 0xB8, 0xBF, 0xCC, 0xBF, 0xD4, 0x69, 0x12, 0x70, 0x7D, 0x06,
+    0x01, 0x75, 0x3D, 0x01, 0x74, 0x01, 0x01, 0x73, 0x02, 0x02, 0x65, 0x69, 0x07, 0x7D, 0x01, 0x74,
+    0x31, 0x01, 0x65, 0x7D, 0x01, 0x67, 0x0B, 0x02, 0x6F, 0x76, 0x07, 0x02, 0x81, 0x00, 0xB1, 0x69,
+    0x7B, 0x80, 0x00, 0xA2, 0x0A, 0x63, 0x64, 0x6C, 0x6D, 0x6E, 0x70, 0x74, 0x75, 0x76, 0x77, 0x3E,
+    0x65, 0x01, 0x6D, 0x70, 0x0A, 0x78, 0x07, 0x7D, 0x0B, 0x01, 0x61, 0xBF, 0x25, 0x80, 0x0E, 0xB2,
+    0x01, 0x74, 0x7D, 0x02, 0x61, 0x65, 0xBC, 0xEC, 0x7D, 0x01, 0x68, 0x7A, 0x01, 0x65, 0x02, 0x01,
+    0x6E, 0x19, 0x02, 0x69, 0x72, 0x7D, 0x05, 0x01, 0x73, 0x07, 0x04, 0x61, 0x65, 0x6E, 0x73, 0xBF,
+    0xAC, 0x06, 0x3E, 0x7D, 0x02, 0x69, 0x6C, 0x05, 0x05, 0x02, 0x6C, 0x6E, 0x02, 0x01, 0x01, 0x74,
+    0x06, 0x86, 0x01, 0x01, 0x61, 0x65, 0x6D, 0x6E, 0x6F, 0x7A, 0x78, 0x7D, 0x05, 0xBC, 0x36, 0x01,
+    0x10, 0x01, 0x69, 0x10, 0x01, 0x69, 0x07, 0x03, 0x64, 0x6E, 0x6F, 0xBC, 0x23, 0x7D, 0x06, 0x01,
+    0x65, 0x10, 0x01, 0x67, 0x7D, 0x01, 0x6E, 0x7D, 0x02, 0x61, 0x65, 0x7D, 0x0B, 0x02, 0x61, 0x68,
+    0x05, 0x10, 0x8D, 0x10, 0x42, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x69, 0x6D, 0x6F, 0x70, 0x71,
+    0x72, 0x73, 0xBF, 0x82, 0xBF, 0x97, 0xBF, 0xA7, 0xBF, 0xB0, 0xBF, 0xB8, 0xBF, 0xC2, 0xBF, 0xCF,
+    0xBF, 0xDF, 0x65, 0x10, 0x01, 0x76, 0x7B, 0x02, 0x62, 0x6E, 0x05, 0x3E, 0x80, 0x23, 0x73, 0x04,
+    0x61, 0x62, 0x63, 0x74, 0xBD, 0x61, 0x06, 0x06, 0x7D, 0x01, 0x63, 0x03, 0x01, 0x68, 0x02, 0x01,
+    0x68, 0x05, 0x01, 0x6E, 0x01, 0x02, 0x65, 0x72, 0x7D, 0x0E, 0x01, 0x72, 0xB8, 0xA9, 0x01, 0x6F,
+    0x1A, 0x01, 0x74, 0x7D, 0x01, 0x70, 0x7D, 0x01, 0x6D, 0x7D, 0x0C, 0x2E, 0x61, 0x68, 0x69, 0x6B,
+    0x6C, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x79, 0x04, 0xBF, 0xCD, 0xB6, 0x2C, 0xBF, 0xD5, 0x32, 0x05,
+    0xBF, 0xDF, 0x62, 0x65, 0x6B, 0x70, 0x7D, 0x01, 0x6F, 0x01, 0x84, 0x00, 0x21, 0x62, 0x63, 0x6C,
+    0x70, 0x3C, 0x02, 0x7D, 0x02, 0x81, 0x01, 0x81, 0x68, 0x02, 0x01, 0x2E, 0x01, 0x81, 0x01, 0xA1,
+    0x61, 0x07, 0x02, 0x61, 0x6E, 0x01, 0x7B, 0x06, 0x63, 0x67, 0x6E, 0x72, 0x73, 0x76, 0x6E, 0x60,
+    0x73, 0x7B, 0x3E, 0x02, 0x80, 0x23, 0x43, 0x01, 0x73, 0x7D, 0x01, 0x6F, 0x7D, 0x03, 0x6D, 0x6E,
+    0x72, 0x09, 0x07, 0x7D, 0x81, 0x00, 0xB1, 0x6D, 0x09, 0x82, 0x00, 0x01, 0x65, 0x6F, 0x74, 0x7B,
+    0x01, 0x72, 0x16, 0x01, 0x61, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x75, 0x01, 0x07, 0x2E, 0x61, 0x62,
+    0x63, 0x66, 0x6F, 0x74, 0x04, 0x07, 0xBB, 0x3E, 0x0E, 0x01, 0x7A, 0x7D, 0x01, 0x7A, 0x02, 0x81,
+    0x00, 0x21, 0x69, 0x7D, 0x04, 0x67, 0x6D, 0x70, 0x73, 0x03, 0x7B, 0x03, 0x03, 0x01, 0x70, 0x02,
+    0x81, 0x00, 0x11, 0x6F, 0x7D, 0x01, 0x6B, 0x05, 0x01, 0x67, 0x05, 0x01, 0x2E, 0xBB, 0xE6, 0x81,
+    0x00, 0xA1, 0x73, 0x7C, 0x03, 0x61, 0x65, 0x68, 0x74, 0x7B, 0x05, 0x84, 0x00, 0x21, 0x61, 0x65,
+    0x6C, 0x72, 0x02, 0x02, 0x01, 0x22, 0x0A, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x73, 0x74, 0x75,
+    0x79, 0xBF, 0x64, 0xBF, 0x81, 0xBF, 0xA3, 0xBF, 0xB6, 0xBF, 0xCE, 0xBF, 0xDA, 0xBF, 0xDF, 0x6E,
+    0x75, 0x12, 0x01, 0x6C, 0x0B, 0x81, 0x01, 0xF1, 0x74, 0x7D, 0x02, 0x68, 0x75, 0x7B, 0x01, 0x01,
+    0x66, 0xBA, 0xB7, 0x81, 0x0A, 0xE2, 0x69, 0x7C, 0x01, 0x64, 0x09, 0x01, 0x69, 0xBB, 0x1E, 0x02,
+    0x65, 0x68, 0x28, 0x0E, 0x07, 0x62, 0x67, 0x6C, 0x6E, 0x72, 0x73, 0x74, 0x05, 0x66, 0x6F, 0x74,
+    0x01, 0x77, 0x7B, 0x82, 0x00, 0x21, 0x67, 0x6E, 0x01, 0x07, 0x01, 0x6F, 0x00, 0x03, 0x61, 0x6E,
+    0x79, 0x01, 0x02, 0x02, 0x02, 0x6E, 0x72, 0x76, 0x79, 0x83, 0x01, 0x01, 0x65, 0x67, 0x6F, 0x2E,
+    0x01, 0xBF, 0x50, 0x02, 0x63, 0x72, 0x02, 0x0D, 0x04, 0x61, 0x65, 0x69, 0x6F, 0xBF, 0xDB, 0x6C,
+    0x71, 0x7B, 0x01, 0x79, 0x0C, 0x01, 0x79, 0x05, 0x04, 0x61, 0x69, 0x6C, 0x73, 0x7A, 0x01, 0x7D,
+    0x00, 0x02, 0x63, 0x64, 0x05, 0x05, 0x01, 0x69, 0x7B, 0x03, 0x61, 0x65, 0x73, 0x20, 0x00, 0x00,
+    0x01, 0x69, 0x09, 0x02, 0x69, 0x7A, 0xB4, 0x29, 0x2C, 0x19, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7A, 0xBA, 0x6D, 0xBA, 0xC4, 0xBB, 0x0A, 0xBB, 0x25, 0xBB, 0x36, 0xBB, 0x65, 0xBB,
+    0x77, 0xBB, 0x90, 0x0D, 0xBB, 0xA3, 0xBB, 0xF1, 0xBC, 0x4C, 0xBD, 0x29, 0x04, 0xBD, 0x93, 0xBD,
+    0xA7, 0xBE, 0x49, 0xBE, 0xA1, 0xBF, 0x5D, 0xBF, 0x9B, 0xBF, 0xCF, 0xBF, 0xDF, 0x6D, 0x70, 0x7A,
+    0x01, 0x2E, 0xB4, 0x80, 0x01, 0x72, 0x7C, 0x01, 0x65, 0x7D, 0x01, 0x6B, 0x7D, 0x01, 0x65, 0x2D,
+    0x01, 0x67, 0x7D, 0x01, 0x61, 0x14, 0x01, 0x67, 0x09, 0x01, 0x61, 0x7D, 0x03, 0x64, 0x65, 0x69,
+    0x7D, 0x00, 0x0A, 0x80, 0x09, 0x92, 0x01, 0x65, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x6E, 0x7D, 0x03,
+    0x62, 0x69, 0x6F, 0xB5, 0xD3, 0xB6, 0xE2, 0x7D, 0x01, 0x73, 0x26, 0x01, 0x79, 0x0E, 0x81, 0x00,
+    0x71, 0x68, 0x7D, 0x0A, 0x2E, 0x63, 0x64, 0x67, 0x6C, 0x6E, 0x72, 0x73, 0x74, 0x7A, 0x08, 0xBF,
+    0xC7, 0xBF, 0xCD, 0x2B, 0xBF, 0xD0, 0xBF, 0xD9, 0x6C, 0x75, 0x7B, 0x05, 0x81, 0x00, 0x21, 0x72,
+    0x06, 0x02, 0x6E, 0x74, 0xB4, 0x55, 0x00, 0x82, 0x00, 0xD2, 0x65, 0x69, 0x75, 0x7A, 0x80, 0x00,
+    0x02, 0x02, 0x6B, 0x74, 0x0B, 0x11, 0x83, 0x0E, 0xD2, 0x61, 0x65, 0x69, 0x01, 0x01, 0x01, 0x02,
+    0x69, 0x75, 0x01, 0x02, 0x82, 0x00, 0x71, 0x69, 0x6F, 0x0E, 0x01, 0x80, 0x23, 0x22, 0x02, 0x69,
+    0x75, 0x35, 0x02, 0x01, 0x72, 0x02, 0x82, 0x06, 0x22, 0x70, 0x74, 0x01, 0x27, 0x01, 0x7A, 0x09,
+    0x83, 0x01, 0x51, 0x69, 0x72, 0x77, 0x7D, 0x02, 0x01, 0x01, 0x69, 0xBD, 0x46, 0x0C, 0x2E, 0x61,
+    0x64, 0x67, 0x6C, 0x6D, 0x6E, 0x73, 0x74, 0x76, 0x77, 0x79, 0x04, 0xBF, 0xC4, 0xBF, 0xC9, 0xBF,
+    0xD2, 0xBF, 0xD7, 0xBF, 0xDE, 0x61, 0x69, 0x73, 0x7C, 0x01, 0x30, 0x80, 0x00, 0xD1, 0x80, 0x02,
+    0x32, 0x80, 0x0F, 0x72, 0x01, 0x66, 0x7D, 0x81, 0x00, 0xB1, 0x69, 0x7D, 0x82, 0x01, 0x51, 0x6E,
+    0x72, 0x02, 0x05, 0x80, 0x05, 0xE2, 0x01, 0x7A, 0x01, 0x01, 0x62, 0x17, 0x01, 0x61, 0x7D, 0x82,
+    0x00, 0x71, 0x69, 0x6C, 0x77, 0x7D, 0x01, 0x72, 0xB4, 0x28, 0x03, 0x61, 0x64, 0x65, 0x7C, 0x00,
+    0x1A, 0x01, 0x72, 0x01, 0x02, 0x62, 0x68, 0x0E, 0x14, 0x04, 0x67, 0x6D, 0x72, 0x75, 0x78, 0x09,
+    0x7B, 0x02, 0x80, 0x16, 0x52, 0x80, 0x0B, 0xB2, 0x01, 0x65, 0x7D, 0x02, 0x6F, 0x76, 0x77, 0x7D,
+    0x80, 0x23, 0x02, 0x01, 0x61, 0x7D, 0x84, 0x01, 0x91, 0x69, 0x72, 0x75, 0x7A, 0x75, 0x01, 0x7D,
+    0x07, 0x08, 0x62, 0x64, 0x65, 0x66, 0x6C, 0x6E, 0x6F, 0x74, 0x10, 0xBF, 0xA6, 0xBF, 0xAB, 0x3B,
+    0xBF, 0xBE, 0xBF, 0xC9, 0xBF, 0xD8, 0x75, 0x80, 0x16, 0x12, 0x01, 0x64, 0x7D, 0x01, 0x68, 0x16,
+    0x02, 0x6E, 0x74, 0x7A, 0x7D, 0x01, 0x70, 0x08, 0x03, 0x2E, 0x6E, 0x73, 0x03, 0x0B, 0x7D, 0x02,
+    0x6E, 0x73, 0x6B, 0x06, 0x80, 0x22, 0xE2, 0x01, 0x64, 0x7D, 0x81, 0x00, 0x51, 0x6E, 0x7D, 0x01,
+    0x6E, 0xB6, 0x98, 0x85, 0x00, 0x22, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xBF, 0xDD, 0x65, 0x6C, 0x77,
+    0x7C, 0x81, 0x02, 0x32, 0x65, 0xBE, 0x95, 0x81, 0x01, 0x51, 0x69, 0x0A, 0x01, 0x63, 0x0A, 0x01,
+    0x69, 0x7D, 0x01, 0x62, 0x26, 0x81, 0x00, 0x61, 0x74, 0x09, 0x01, 0x61, 0x7B, 0x80, 0x0F, 0x22,
+    0x01, 0x6F, 0x7D, 0x06, 0x2E, 0x61, 0x64, 0x65, 0x69, 0x6E, 0x08, 0x1F, 0x09, 0x08, 0x08, 0x7D,
+    0x80, 0x12, 0x72, 0x80, 0x22, 0xB3, 0x01, 0x6C, 0x7D, 0x04, 0x61, 0x68, 0x6F, 0x75, 0x07, 0x0F,
+    0x05, 0x7D, 0x01, 0x64, 0x2F, 0x01, 0x6E, 0x7D, 0x0A, 0x64, 0x65, 0x6C, 0x6D, 0x6E, 0x6F, 0x72,
+    0x73, 0x74, 0x75, 0xBF, 0xBF, 0x05, 0xBF, 0xC7, 0xBF, 0xCA, 0xBF, 0xD2, 0x0C, 0xBF, 0xDB, 0x68,
+    0x71, 0x7D, 0x01, 0x74, 0x04, 0x01, 0x68, 0x2F, 0x01, 0x74, 0x7D, 0x01, 0x71, 0x0B, 0x01, 0x73,
+    0x7D, 0x03, 0x69, 0x6F, 0x75, 0x71, 0x77, 0x7D, 0x81, 0x22, 0x83, 0x6F, 0xB3, 0x53, 0x83, 0x00,
+    0xD1, 0x6C, 0x6F, 0x72, 0x05, 0x03, 0x06, 0x01, 0x66, 0xB1, 0xD5, 0x01, 0x61, 0x05, 0x81, 0x00,
+    0xB1, 0x74, 0xB2, 0x78, 0x80, 0x22, 0x62, 0x82, 0x01, 0x81, 0x72, 0x73, 0x7D, 0x7D, 0x01, 0x65,
+    0x79, 0x01, 0x6E, 0xBB, 0x53, 0x02, 0x65, 0x69, 0x0B, 0x7C, 0x03, 0x69, 0x73, 0x74, 0x74, 0x7B,
+    0x08, 0x01, 0x2E, 0x17, 0x01, 0x64, 0x7D, 0x01, 0x6F, 0x0C, 0x01, 0x65, 0xB6, 0x1D, 0x05, 0x61,
+    0x65, 0x69, 0x6F, 0x74, 0x04, 0x76, 0x79, 0x07, 0x7C, 0x08, 0x66, 0x67, 0x6C, 0x6D, 0x6E, 0x72,
+    0x73, 0x74, 0xBF, 0xBE, 0xBF, 0xC2, 0xB8, 0xC3, 0xB2, 0x3D, 0xBF, 0xC5, 0xB9, 0xC9, 0x61, 0x75,
+    0x80, 0x0D, 0xC2, 0x02, 0x2E, 0x73, 0x08, 0x00, 0x15, 0x61, 0x62, 0x64, 0x65, 0x66, 0x68, 0x69,
+    0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0xBD, 0xDB,
+    0xBD, 0xFF, 0x1F, 0xBE, 0x45, 0x13, 0xBE, 0x66, 0xBE, 0xC9, 0x0D, 0x05, 0xBF, 0x0B, 0x1F, 0xBF,
+    0x19, 0xBF, 0x60, 0x04, 0xBF, 0x89, 0xBF, 0x90, 0xBF, 0x96, 0x61, 0x0D, 0x25, 0x7B, 0x01, 0x6E,
+    0x0A, 0x02, 0x69, 0x6C, 0x7D, 0x0E, 0x80, 0x16, 0xE2, 0x02, 0x6D, 0x6E, 0x7D, 0x02, 0x01, 0x65,
+    0x7B, 0x80, 0x06, 0x22, 0x80, 0x0C, 0x32, 0x02, 0x61, 0x69, 0x00, 0xB5, 0x19, 0x03, 0x61, 0x6C,
+    0x6F, 0x3E, 0x7A, 0x04, 0x03, 0x63, 0x73, 0x7A, 0x00, 0x09, 0x0A, 0x05, 0x64, 0x65, 0x69, 0x74,
+    0x79, 0x09, 0x00, 0x79, 0xB3, 0xDD, 0x0B, 0x01, 0x65, 0x27, 0x01, 0x6D, 0x09, 0x01, 0x6F, 0x7D,
+    0x02, 0x65, 0x69, 0xB1, 0xEB, 0xBD, 0x36, 0x02, 0x74, 0x79, 0x79, 0x04, 0x80, 0x22, 0x33, 0x01,
+    0x73, 0x7D, 0x01, 0x76, 0x04, 0x03, 0x61, 0x68, 0x69, 0x7A, 0x05, 0x7D, 0x01, 0x6C, 0x09, 0x01,
+    0x61, 0x7D, 0x8C, 0x00, 0x71, 0x62, 0x63, 0x64, 0x67, 0x68, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74,
+    0x76, 0xBF, 0x9F, 0xB0, 0xD1, 0xBF, 0xAC, 0xBF, 0xAF, 0xBF, 0xB2, 0xBF, 0xBB, 0xBF, 0xC9, 0xBF,
+    0xD5, 0xBF, 0xDB, 0x65, 0x73, 0x7D, 0x01, 0x70, 0xB4, 0xE4, 0x03, 0x6D, 0x6E, 0x75, 0x7C, 0x0B,
+    0xB4, 0x87, 0x83, 0x00, 0x41, 0x68, 0x69, 0x6F, 0xB3, 0xC1, 0xB1, 0x84, 0x78, 0x01, 0x6E, 0x04,
+    0x02, 0x2E, 0x65, 0x04, 0x7D, 0x02, 0x2E, 0x6C, 0x08, 0x0C, 0x80, 0x1A, 0x02, 0x84, 0x00, 0x71,
+    0x63, 0x65, 0x69, 0x74, 0x0C, 0x7D, 0x04, 0x0C, 0x01, 0x6D, 0x02, 0x01, 0x61, 0x7D, 0x81, 0x01,
+    0x51, 0x62, 0xB2, 0x08, 0x01, 0x69, 0x7A, 0x03, 0x61, 0x73, 0x74, 0x04, 0x7D, 0x09, 0x80, 0x02,
+    0xD2, 0x81, 0x00, 0x61, 0x61, 0x7D, 0x0A, 0x2E, 0x64, 0x69, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74,
+    0x77, 0x13, 0xBF, 0xCA, 0x0C, 0xBF, 0xCF, 0xBF, 0xD7, 0x0C, 0x65, 0x71, 0x7B, 0x00, 0x80, 0x05,
+    0x62, 0x02, 0x63, 0x73, 0x08, 0xB6, 0x79, 0x01, 0x69, 0x7A, 0x02, 0x62, 0x6E, 0x74, 0x7D, 0x01,
+    0x70, 0x2F, 0x01, 0x69, 0x0C, 0x02, 0x2E, 0x73, 0x01, 0x01, 0x86, 0x01, 0x11, 0x61, 0x64, 0x6C,
+    0x6D, 0x6E, 0x72, 0x75, 0x04, 0xB0, 0xC9, 0x78, 0x19, 0x7B, 0x01, 0x76, 0xB3, 0x36, 0x02, 0x2E,
+    0x73, 0x08, 0xB9, 0xA8, 0x82, 0x1C, 0x32, 0x65, 0x69, 0x7A, 0x08, 0x05, 0x65, 0x6E, 0x6F, 0x74,
+    0x7A, 0x6F, 0x79, 0x08, 0x0C, 0x17, 0x80, 0x22, 0x12, 0x01, 0x75, 0x0A, 0x02, 0x2E, 0x68, 0x04,
+    0x7D, 0x87, 0x00, 0xD1, 0x2E, 0x61, 0x65, 0x69, 0x6F, 0x73, 0x74, 0x04, 0xBF, 0xB9, 0xBF, 0xC9,
+    0x6A, 0x75, 0x7B, 0x21, 0x80, 0x05, 0xC2, 0x82, 0x01, 0x51, 0x62, 0x72, 0x7D, 0x09, 0x01, 0x72,
+    0x04, 0x01, 0x2E, 0x08, 0x01, 0x63, 0x29, 0x01, 0x69, 0x7D, 0x80, 0x04, 0x22, 0x01, 0x72, 0x7D,
+    0x01, 0x61, 0x7D, 0x02, 0x61, 0x69, 0x05, 0x0C, 0x81, 0x00, 0x51, 0x74, 0x0C, 0x81, 0x00, 0x11,
+    0x2E, 0x07, 0x85, 0x00, 0xD1, 0x61, 0x65, 0x67, 0x6F, 0x71, 0x76, 0xB1, 0x2F, 0x7B, 0x08, 0x17,
+    0x03, 0x65, 0x68, 0x69, 0x04, 0x01, 0xB7, 0x58, 0x02, 0x61, 0x69, 0x04, 0x04, 0x01, 0x74, 0x7B,
+    0x01, 0x7A, 0x0A, 0x81, 0x00, 0xD2, 0x69, 0x7D, 0x8E, 0x00, 0x71, 0x61, 0x63, 0x65, 0x66, 0x67,
+    0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x73, 0x74, 0x7A, 0xBF, 0xAF, 0x02, 0xBF, 0xB6, 0xBF, 0xBF,
+    0xBF, 0xC8, 0x04, 0xBF, 0xCB, 0x13, 0xBF, 0xDA, 0xAF, 0xF6, 0x68, 0x75, 0x7B, 0x08, 0x81, 0x01,
+    0x01, 0x69, 0x01, 0x01, 0x6F, 0x07, 0x01, 0x69, 0x7D, 0x01, 0x74, 0x7D, 0x82, 0x00, 0x01, 0x61,
+    0x65, 0x7D, 0x08, 0x01, 0x72, 0x79, 0x02, 0x61, 0x6D, 0x2E, 0x00, 0x02, 0x63, 0x6D, 0x04, 0x0B,
+    0x84, 0x21, 0xE3, 0x61, 0x65, 0x69, 0x79, 0x73, 0x76, 0x7B, 0x00, 0x81, 0x00, 0xD1, 0x72, 0x05,
+    0x01, 0x63, 0x01, 0x81, 0x00, 0x61, 0x6E, 0x7D, 0x81, 0x00, 0xC1, 0x72, 0x0A, 0x02, 0x69, 0x6F,
+    0x09, 0x7B, 0x04, 0x61, 0x65, 0x67, 0x74, 0x00, 0x03, 0x0A, 0x09, 0x80, 0x21, 0xB3, 0x01, 0x6E,
+    0x7D, 0x01, 0x6F, 0x7D, 0x04, 0x61, 0x68, 0x69, 0x6C, 0x01, 0x7D, 0xBC, 0xC8, 0x05, 0x01, 0x6E,
+    0x11, 0x02, 0x62, 0x6F, 0x04, 0x7D, 0x01, 0x74, 0xAF, 0xAD, 0x01, 0x73, 0x7C, 0x81, 0x02, 0x61,
+    0x65, 0x0B, 0x02, 0x65, 0x69, 0x09, 0x02, 0x8E, 0x00, 0x71, 0x61, 0x65, 0x67, 0x69, 0x6C, 0x6D,
+    0x6E, 0x70, 0x72, 0x73, 0x75, 0x76, 0x77, 0x7A, 0x35, 0x17, 0xBF, 0xB4, 0xBF, 0xBC, 0xBF, 0xC6,
+    0xBB, 0x26, 0xBF, 0xCB, 0xBF, 0xDD, 0x6A, 0x15, 0x73, 0x76, 0xAF, 0x7A, 0x7B, 0x01, 0x63, 0x08,
+    0x02, 0x2E, 0x69, 0x08, 0x7D, 0x02, 0x73, 0x74, 0x37, 0x7B, 0x01, 0x61, 0xBB, 0xB4, 0x04, 0x61,
+    0x64, 0x74, 0x76, 0xAE, 0xCD, 0x08, 0x7C, 0x00, 0x81, 0x00, 0xC1, 0x65, 0x0A, 0x01, 0x69, 0x7B,
+    0x84, 0x01, 0x11, 0x66, 0x6E, 0x73, 0x74, 0x09, 0x03, 0x0B, 0x7D, 0x80, 0x21, 0x92, 0x01, 0x64,
+    0x7D, 0x01, 0x6F, 0x7D, 0x01, 0x6F, 0xB1, 0x20, 0x01, 0x63, 0x7C, 0x02, 0x6C, 0x6F, 0x00, 0x0F,
+    0x04, 0x63, 0x65, 0x70, 0x73, 0x71, 0x78, 0x7B, 0x24, 0x05, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xBF,
+    0xBC, 0xBF, 0xC5, 0xBF, 0xD7, 0x77, 0xB2, 0xFE, 0x80, 0x06, 0x43, 0x02, 0x67, 0x74, 0x02, 0x07,
+    0x02, 0x62, 0x6E, 0x00, 0x7B, 0x01, 0x75, 0x03, 0x02, 0x63, 0x6D, 0x7D, 0xAF, 0xCB, 0x80, 0x21,
+    0x63, 0x01, 0x63, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x6D, 0x7D, 0x01, 0x6F, 0x7D, 0x86, 0x00, 0xD2,
+    0x61, 0x65, 0x69, 0x72, 0x75, 0x77, 0x63, 0xBA, 0xCF, 0x6B, 0x7D, 0x2E, 0x03, 0x81, 0x00, 0x51,
+    0x74, 0xB5, 0x9F, 0x01, 0x73, 0x00, 0x02, 0x69, 0x75, 0x7D, 0x0C, 0x02, 0x69, 0x74, 0x08, 0x7B,
+    0x03, 0x61, 0x65, 0x69, 0x10, 0x06, 0x05, 0x02, 0x69, 0x79, 0x01, 0x02, 0x80, 0x1C, 0xC2, 0x80,
+    0x21, 0x33, 0x01, 0x65, 0x7D, 0x01, 0x63, 0x7D, 0x02, 0x62, 0x6E, 0x74, 0x7D, 0x02, 0x61, 0x69,
+    0x7B, 0x2A, 0x81, 0x00, 0x71, 0x73, 0xAE, 0xB4, 0x02, 0x65, 0x76, 0x05, 0x25, 0x82, 0x0C, 0xB2,
+    0x69, 0x72, 0x7B, 0x04, 0x0A, 0x64, 0x66, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x09,
+    0x03, 0xBF, 0xB9, 0xBF, 0xC7, 0xBF, 0xCC, 0x0C, 0xBF, 0xD3, 0x69, 0x6E, 0x79, 0x80, 0x00, 0x71,
+    0x10, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6E, 0x6F, 0x71, 0x72, 0x73, 0x74, 0x75, 0x79,
+    0x7A, 0xBD, 0x02, 0xBD, 0x32, 0xBD, 0x76, 0xBD, 0xE1, 0xBE, 0x48, 0xBE, 0x6E, 0xBE, 0x90, 0x07,
+    0xBE, 0xE7, 0x0D, 0xBF, 0x59, 0xBF, 0x68, 0xBF, 0x8D, 0x64, 0x18, 0x15, 0x80, 0x08, 0x63, 0x01,
+    0x65, 0x3B, 0x01, 0x6E, 0x7D, 0x01, 0x6F, 0x7D, 0x80, 0x21, 0x12, 0x01, 0x67, 0x0A, 0x03, 0x64,
+    0x6B, 0x79, 0x0F, 0x0F, 0x04, 0x01, 0x62, 0x1E, 0x83, 0x01, 0x51, 0x61, 0x69, 0x6F, 0x7D, 0xBC,
+    0xAA, 0x04, 0x81, 0x12, 0x72, 0x65, 0x09, 0x8C, 0x0B, 0x22, 0x2E, 0x62, 0x63, 0x66, 0x67, 0x6C,
+    0x6D, 0x6E, 0x72, 0x74, 0x76, 0x79, 0x08, 0xBF, 0xD5, 0xAD, 0x7C, 0x04, 0x13, 0xBF, 0xDE, 0x61,
+    0x64, 0x67, 0x71, 0x7B, 0x08, 0x01, 0x62, 0xB3, 0x95, 0x80, 0x0B, 0x82, 0x01, 0x62, 0x7D, 0x82,
+    0x01, 0xB2, 0x61, 0x69, 0x76, 0x7D, 0x01, 0x73, 0xB4, 0xF5, 0x02, 0x66, 0x6C, 0x0F, 0x7C, 0x02,
+    0x69, 0x6F, 0x33, 0xB4, 0x00, 0x01, 0x6E, 0x1C, 0x01, 0x6C, 0x05, 0x80, 0x20, 0xF2, 0x01, 0x72,
+    0x7D, 0x01, 0x61, 0xBD, 0x53, 0x01, 0x6E, 0x7C, 0x02, 0x61, 0x69, 0x76, 0x7D, 0x04, 0x61, 0x69,
+    0x6C, 0x6F, 0x68, 0x6B, 0x7B, 0xBC, 0xAB, 0x80, 0x00, 0xD2, 0x01, 0x2E, 0x04, 0x80, 0x16, 0x62,
+    0x01, 0x69, 0x7D, 0x01, 0x74, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x69, 0x7D, 0x01,
+    0x66, 0x02, 0x80, 0x16, 0xA2, 0x02, 0x65, 0x71, 0x0B, 0x7D, 0x02, 0x69, 0x6F, 0x7B, 0x02, 0x81,
+    0x01, 0x51, 0x2E, 0x09, 0x02, 0x63, 0x6C, 0x7B, 0x02, 0x01, 0x73, 0x05, 0x03, 0x6E, 0x72, 0x73,
+    0x7D, 0x16, 0x10, 0x83, 0x00, 0x51, 0x2E, 0x69, 0x6F, 0x08, 0x71, 0x79, 0x01, 0x66, 0x16, 0x01,
+    0x69, 0x7D, 0x84, 0x00, 0x71, 0x61, 0x6F, 0x74, 0x75, 0x39, 0x01, 0x7D, 0x01, 0x83, 0x01, 0x01,
+    0x61, 0x69, 0x75, 0x01, 0x0B, 0x10, 0x01, 0x7A, 0x0F, 0x01, 0x69, 0x7D, 0x04, 0x68, 0x6D, 0x6E,
+    0x73, 0x03, 0x08, 0x7D, 0x09, 0x02, 0x69, 0x72, 0x0A, 0x01, 0x86, 0x01, 0x11, 0x2E, 0x63, 0x69,
+    0x6F, 0x74, 0x75, 0x12, 0x0E, 0xBA, 0x62, 0xBC, 0xCA, 0x7B, 0x05, 0x01, 0x63, 0x10, 0x82, 0x01,
+    0x01, 0x69, 0x6F, 0x7D, 0x10, 0x01, 0x6C, 0x0A, 0x81, 0x01, 0x01, 0x69, 0x7D, 0x12, 0x2E, 0x61,
+    0x62, 0x63, 0x64, 0x65, 0x66, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x79,
+    0x13, 0xBF, 0x3D, 0xBF, 0x42, 0xBF, 0x60, 0xBF, 0x6A, 0xBF, 0x6D, 0xBF, 0x7F, 0xBF, 0x82, 0xBF,
+    0x8D, 0xBF, 0xA6, 0xBF, 0xB5, 0xBF, 0xC0, 0x06, 0xBF, 0xCF, 0xBF, 0xDD, 0x71, 0x7B, 0x04, 0x80,
+    0x04, 0x42, 0x01, 0x74, 0x38, 0x04, 0x61, 0x65, 0x69, 0x79, 0x03, 0x7D, 0x0E, 0x12, 0x80, 0x00,
+    0x12, 0x81, 0x20, 0xC3, 0x62, 0x09, 0x02, 0x69, 0x6D, 0xAC, 0xA2, 0x05, 0x03, 0x61, 0x65, 0x74,
+    0x7A, 0x03, 0x0C, 0x80, 0x06, 0x02, 0x01, 0x6E, 0x7D, 0x01, 0x72, 0xAC, 0xB8, 0x81, 0x00, 0x11,
+    0x66, 0x7C, 0x01, 0x74, 0x23, 0x01, 0x61, 0x7D, 0x80, 0x13, 0x92, 0x01, 0x79, 0x7D, 0x01, 0x68,
+    0x7D, 0x01, 0x74, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x2E, 0x0C, 0x81, 0x00, 0xC1, 0x7A, 0x02, 0x83,
+    0x00, 0x11, 0x61, 0x65, 0x69, 0x18, 0x78, 0x7B, 0x81, 0x00, 0x71, 0x67, 0x09, 0x82, 0x01, 0x01,
+    0x6E, 0x72, 0x10, 0x10, 0x82, 0x01, 0x11, 0x65, 0x74, 0x79, 0x3F, 0x80, 0x12, 0xC2, 0x82, 0x02,
+    0x61, 0x69, 0x74, 0x08, 0x7D, 0x01, 0x69, 0x12, 0x80, 0x1A, 0xC2, 0x10, 0x2E, 0x61, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x76, 0x08, 0xBF, 0x96, 0xBF,
+    0xA1, 0x0C, 0xBF, 0xAB, 0xBF, 0xB2, 0xB4, 0x17, 0xBF, 0xBA, 0xBF, 0xC9, 0xBF, 0xD4, 0xBF, 0xDD,
+    0xBE, 0x9D, 0x69, 0x73, 0x7A, 0x7D, 0x80, 0x01, 0x22, 0x01, 0x64, 0xBE, 0x8E, 0x02, 0x2E, 0x73,
+    0x0C, 0x04, 0x04, 0x2E, 0x61, 0x64, 0x73, 0x0C, 0x77, 0x0C, 0x7B, 0x80, 0x20, 0x93, 0x01, 0x65,
+    0x7D, 0x06, 0x61, 0x65, 0x69, 0x6F, 0x75, 0x79, 0x25, 0x71, 0x7D, 0x3B, 0x25, 0x13, 0x80, 0x17,
+    0x63, 0x03, 0x61, 0x69, 0x6F, 0x05, 0x0B, 0x27, 0x01, 0x69, 0xB8, 0x45, 0x02, 0x61, 0x69, 0x3E,
+    0x0B, 0x01, 0x64, 0x0A, 0x01, 0x70, 0x00, 0x01, 0x74, 0x25, 0x80, 0x20, 0x72, 0x01, 0x64, 0x7D,
+    0x01, 0x72, 0x7D, 0x01, 0x6F, 0x7D, 0x90, 0x00, 0x71, 0x2E, 0x64, 0x65, 0x66, 0x67, 0x6C, 0x6D,
+    0x6E, 0x6F, 0x70, 0x72, 0x73, 0x75, 0x76, 0x77, 0x78, 0x0C, 0x19, 0x08, 0xBA, 0x3E, 0x03, 0xBF,
+    0xDB, 0x62, 0x66, 0x6B, 0x6E, 0x03, 0x0C, 0x71, 0x05, 0x7D, 0x0C, 0x01, 0x6F, 0xAF, 0x35, 0x02,
+    0x67, 0x69, 0x7C, 0x04, 0x80, 0x07, 0x02, 0x01, 0x6C, 0x7D, 0x81, 0x00, 0xC1, 0x61, 0x7D, 0x82,
+    0x00, 0x61, 0x61, 0x6E, 0xAC, 0x1C, 0x7B, 0x01, 0x61, 0xB8, 0x90, 0x01, 0x74, 0x7C, 0x80, 0x20,
+    0x43, 0x01, 0x67, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x6C, 0x7D, 0x04, 0x62, 0x66, 0x6C, 0x70, 0x00,
+    0x71, 0x0B, 0x7D, 0x80, 0x20, 0x22, 0x01, 0x64, 0x7D, 0x01, 0x65, 0x7D, 0x03, 0x6D, 0x70, 0x77,
+    0x7D, 0x00, 0x04, 0x01, 0x69, 0x08, 0x01, 0x6C, 0x7D, 0x01, 0x70, 0x7D, 0x86, 0x00, 0x71, 0x61,
+    0x65, 0x69, 0x6F, 0x75, 0x79, 0xBF, 0xB3, 0xBF, 0xC3, 0xBF, 0xDE, 0x70, 0x7D, 0x04, 0x83, 0x07,
+    0xC3, 0x70, 0x77, 0x79, 0x05, 0x03, 0x03, 0x01, 0x62, 0x06, 0x02, 0x61, 0x68, 0x7D, 0x12, 0x01,
+    0x2E, 0x10, 0x81, 0x09, 0xA2, 0x6C, 0x7D, 0x02, 0x2E, 0x73, 0x04, 0x04, 0x83, 0x01, 0x91, 0x61,
+    0x65, 0x74, 0x0D, 0x2D, 0x7B, 0x01, 0x65, 0x06, 0x01, 0x62, 0x15, 0x80, 0x1F, 0xF3, 0x01, 0x6C,
+    0x7D, 0x01, 0x6F, 0x7D, 0x01, 0x70, 0x7D, 0x81, 0x00, 0x01, 0x65, 0x05, 0x89, 0x00, 0x71, 0x61,
+    0x63, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0xBF, 0xD6, 0x60, 0x20, 0x05, 0x69, 0x6C, 0x05,
+    0x78, 0x7B, 0x02, 0x65, 0x70, 0x05, 0x09, 0x82, 0x00, 0x21, 0x6E, 0x73, 0x08, 0x7B, 0x17, 0x61,
+    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0xBC, 0xF9, 0x0D, 0x07, 0xBD, 0x21, 0xBD, 0xEF, 0x1F, 0xBE,
+    0x27, 0xBE, 0x30, 0xBE, 0x9D, 0x0D, 0xBE, 0xC8, 0xBE, 0xE3, 0x0D, 0xBE, 0xF0, 0xBF, 0x18, 0x0D,
+    0xBF, 0x8E, 0xBF, 0xA0, 0xBF, 0xAC, 0xBF, 0xDE, 0x0D, 0x0D, 0x79, 0x80, 0x01, 0xB2, 0x81, 0x02,
+    0x61, 0x69, 0x1B, 0x81, 0x00, 0xB1, 0x72, 0x02, 0x01, 0x65, 0x7B, 0x82, 0x00, 0xB1, 0x65, 0x6F,
+    0x2D, 0xBA, 0x2E, 0x01, 0x65, 0xAC, 0x7B, 0x80, 0x0A, 0x62, 0x01, 0x73, 0x7D, 0x01, 0x65, 0x7D,
+    0x02, 0x64, 0x69, 0x07, 0x7D, 0x02, 0x63, 0x6C, 0x00, 0x00, 0x81, 0x01, 0x11, 0x65, 0x11, 0x06,
+    0x61, 0x63, 0x65, 0x69, 0x6B, 0x74, 0x0A, 0x00, 0x3A, 0x76, 0x09, 0x7B, 0x03, 0x70, 0x73, 0x74,
+    0x02, 0x06, 0x11, 0x01, 0x66, 0x07, 0x80, 0x05, 0x42, 0x84, 0x01, 0x91, 0x65, 0x68, 0x69, 0x75,
+    0x28, 0xAB, 0x5A, 0x7A, 0x34, 0x83, 0x01, 0x91, 0x65, 0x69, 0x6F, 0xB8, 0xA9, 0x09, 0x09, 0x0B,
+    0x62, 0x63, 0x64, 0x67, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x76, 0xBF, 0x9C, 0xB3, 0xCF, 0xBF,
+    0x9F, 0xBF, 0xA9, 0xBF, 0xAC, 0xBF, 0xB4, 0xBF, 0xC1, 0xBF, 0xD0, 0xBF, 0xDD, 0x6A, 0x76, 0x02,
+    0x2E, 0x73, 0x03, 0x03, 0x02, 0x6C, 0x6E, 0x7B, 0x03, 0x01, 0x74, 0x03, 0x83, 0x00, 0xD2, 0x65,
+    0x69, 0x72, 0x78, 0x7D, 0x06, 0x02, 0x64, 0x6E, 0x03, 0xAA, 0x67, 0x01, 0x73, 0x2A, 0x81, 0x00,
+    0x11, 0x73, 0x7D, 0x01, 0x61, 0xB2, 0x1A, 0x02, 0x63, 0x65, 0xAF, 0xC0, 0x02, 0x02, 0x69, 0x79,
+    0x7A, 0x02, 0x81, 0x00, 0x61, 0x65, 0x07, 0x84, 0x01, 0x91, 0x62, 0x66, 0x6D, 0x74, 0x03, 0x76,
+    0x01, 0x7B, 0x01, 0x6D, 0x03, 0x02, 0x61, 0x75, 0x7D, 0xB1, 0x5D, 0x01, 0x65, 0x03, 0x02, 0x6D,
+    0x70, 0x03, 0x7D, 0x82, 0x00, 0x21, 0x61, 0x6F, 0x01, 0x09, 0x04, 0x6C, 0x6D, 0x6E, 0x72, 0x12,
+    0x74, 0xB3, 0xBF, 0x79, 0x81, 0x00, 0x11, 0x65, 0xBF, 0xDE, 0x02, 0x61, 0x65, 0xB0, 0x05, 0x05,
+    0x81, 0x00, 0x51, 0x61, 0x01, 0x81, 0x00, 0x11, 0x6C, 0x7B, 0x0A, 0x61, 0x63, 0x65, 0x68, 0x69,
+    0x6C, 0x6F, 0x72, 0x74, 0x75, 0xBF, 0x9B, 0xAC, 0x59, 0xBF, 0xA4, 0xBF, 0xA9, 0xBF, 0xBD, 0xBF,
+    0xCB, 0x60, 0x6A, 0x70, 0x7B, 0x80, 0x10, 0x42, 0x02, 0x72, 0x73, 0xB1, 0xA2, 0x00, 0x01, 0x6C,
+    0x14, 0x86, 0x00, 0x01, 0x61, 0x62, 0x63, 0x6D, 0x74, 0x7A, 0x06, 0x01, 0x22, 0x01, 0x0E, 0x09,
+    0x82, 0x00, 0x01, 0x6C, 0x6E, 0x03, 0xA9, 0xB0, 0x01, 0x67, 0x0E, 0x01, 0x6E, 0x7D, 0x82, 0x00,
+    0x51, 0x69, 0x6F, 0x7D, 0x02, 0x01, 0x6C, 0x79, 0x08, 0x61, 0x64, 0x65, 0x67, 0x69, 0x6F, 0x72,
+    0x75, 0xBF, 0xCD, 0xB8, 0xA6, 0xBF, 0xD0, 0xBF, 0xD6, 0xBF, 0xD9, 0x68, 0xB0, 0x81, 0x7D, 0x02,
+    0x69, 0x79, 0x0A, 0x05, 0x80, 0x03, 0x32, 0x81, 0x1F, 0xD2, 0x74, 0x0B, 0x0A, 0x63, 0x64, 0x66,
+    0x6C, 0x6D, 0x6E, 0x70, 0x73, 0x74, 0x78, 0x10, 0x32, 0x10, 0x73, 0x10, 0xB6, 0xFF, 0x78, 0x7B,
+    0xB4, 0x89, 0x07, 0x01, 0x65, 0x34, 0x01, 0x72, 0x7D, 0x81, 0x00, 0x51, 0x69, 0x08, 0x01, 0x65,
+    0xAE, 0xDC, 0x01, 0x74, 0x7C, 0x02, 0x65, 0x69, 0x06, 0x7D, 0x04, 0x63, 0x6C, 0x6E, 0x74, 0x6F,
+    0x0B, 0x7B, 0x0C, 0x01, 0x65, 0xAD, 0xD2, 0x01, 0x72, 0x7C, 0x01, 0x2E, 0x03, 0x01, 0x65, 0x7D,
+    0x01, 0x73, 0x7D, 0x85, 0x00, 0x11, 0x65, 0x66, 0x69, 0x6F, 0x75, 0xBF, 0xD3, 0x18, 0x67, 0x74,
+    0x7D, 0x01, 0x6C, 0x04, 0x80, 0x1F, 0xB2, 0x04, 0x62, 0x63, 0x6E, 0x74, 0x02, 0x05, 0x35, 0x7D,
+    0x02, 0x6C, 0x72, 0x0E, 0x07, 0x07, 0x61, 0x65, 0x69, 0x6E, 0x6F, 0x75, 0x79, 0x6C, 0xA9, 0xD6,
+    0x72, 0x02, 0xBE, 0xAA, 0x7B, 0x08, 0x81, 0x01, 0xB2, 0x65, 0xA9, 0xC5, 0x81, 0x01, 0x11, 0x6C,
+    0x02, 0x03, 0x66, 0x67, 0x73, 0x06, 0x0D, 0xAE, 0xC6, 0x03, 0x65, 0x68, 0x79, 0x0A, 0x01, 0x07,
+    0x87, 0x01, 0x91, 0x63, 0x64, 0x67, 0x6D, 0x6E, 0x72, 0x74, 0x07, 0x02, 0x6C, 0xBD, 0x67, 0x71,
+    0xAC, 0xB7, 0x79, 0x81, 0x00, 0x51, 0x69, 0x02, 0x01, 0x64, 0x7B, 0x81, 0x00, 0x11, 0x75, 0x7D,
+    0x01, 0x6E, 0x00, 0x02, 0x69, 0x6C, 0x7D, 0xB6, 0x48, 0x01, 0x64, 0x0B, 0x01, 0x69, 0xAF, 0xB9,
+    0x01, 0x61, 0x1C, 0x86, 0x00, 0x11, 0x2E, 0x63, 0x6E, 0x74, 0x77, 0x78, 0x03, 0x03, 0x76, 0x79,
+    0x03, 0x7D, 0x01, 0x72, 0x2A, 0x08, 0x61, 0x62, 0x63, 0x64, 0x67, 0x6E, 0x72, 0x73, 0x06, 0x7D,
+    0x08, 0x03, 0x22, 0x07, 0xB0, 0x75, 0x0D, 0x02, 0x2E, 0x61, 0xAF, 0xCE, 0x01, 0x01, 0x67, 0x34,
+    0x81, 0x00, 0x21, 0x68, 0x02, 0x01, 0x73, 0xAD, 0x87, 0x01, 0x69, 0x7C, 0x80, 0x0B, 0xE2, 0x8A,
+    0x01, 0x91, 0x62, 0x63, 0x65, 0x67, 0x6D, 0x6E, 0x6F, 0x73, 0x74, 0x76, 0xBD, 0x16, 0x68, 0xB1,
+    0x0E, 0xB3, 0x3C, 0x07, 0x6E, 0x06, 0x71, 0x7A, 0x7D, 0x81, 0x00, 0x01, 0x62, 0x05, 0x02, 0x61,
+    0x6F, 0x7B, 0x0B, 0x04, 0x61, 0x63, 0x67, 0x70, 0x0D, 0x07, 0x02, 0xB2, 0x57, 0x01, 0x68, 0x10,
+    0x02, 0x64, 0x67, 0x07, 0x02, 0x09, 0x61, 0x65, 0x66, 0x69, 0x6C, 0x6F, 0x73, 0x74, 0x75, 0xBF,
+    0x8E, 0xBF, 0xA0, 0x10, 0xBF, 0xCA, 0x69, 0x6E, 0x78, 0xB5, 0xC6, 0x7B, 0x81, 0x01, 0x21, 0x61,
+    0x02, 0x03, 0x63, 0x67, 0x6E, 0x03, 0x03, 0x7B, 0x82, 0x00, 0x11, 0x6C, 0x74, 0x12, 0x03, 0x82,
+    0x13, 0xA2, 0x65, 0x69, 0x02, 0xAF, 0xF1, 0x82, 0x00, 0x51, 0x68, 0x73, 0x02, 0x07, 0x06, 0x63,
+    0x65, 0x67, 0x6E, 0x73, 0x7A, 0x22, 0x00, 0xBF, 0x64, 0x71, 0x79, 0x01, 0x01, 0x6F, 0x16, 0x01,
+    0x69, 0x7D, 0x02, 0x67, 0x6E, 0x00, 0x7D, 0x81, 0x00, 0x51, 0x61, 0x02, 0x02, 0x6C, 0x6E, 0x7B,
+    0x0A, 0x09, 0x61, 0x62, 0x65, 0x69, 0x6E, 0x6F, 0x70, 0x75, 0x79, 0xBF, 0xC0, 0x02, 0xBF, 0xC7,
+    0xBF, 0xDD, 0xAF, 0xEB, 0x71, 0xAE, 0x6B, 0x7B, 0x06, 0x02, 0x6D, 0x6E, 0x30, 0xBD, 0x70, 0x01,
+    0x65, 0xA8, 0x8C, 0x01, 0x68, 0x7C, 0x02, 0x63, 0x78, 0x01, 0x0E, 0x01, 0x69, 0x7B, 0x02, 0x69,
+    0x74, 0x02, 0x02, 0x07, 0x61, 0x65, 0x6D, 0x72, 0x73, 0x74, 0x77, 0x07, 0x07, 0x01, 0x30, 0x7B,
+    0xB4, 0x2E, 0x06, 0x08, 0x63, 0x65, 0x6C, 0x6F, 0x73, 0x74, 0x75, 0x7A, 0xB0, 0x83, 0x07, 0x07,
+    0x06, 0xAF, 0x88, 0x01, 0x07, 0x08, 0x83, 0x00, 0x01, 0x67, 0x73, 0x76, 0x00, 0x03, 0x01, 0x01,
+    0x67, 0x1B, 0x01, 0x73, 0x04, 0x01, 0x65, 0x7D, 0x02, 0x61, 0x68, 0x77, 0x7D, 0x02, 0x61, 0x66,
+    0x01, 0x02, 0x0C, 0x61, 0x63, 0x64, 0x65, 0x69, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0x79, 0x7A, 0xBF,
+    0xA7, 0xBF, 0xB1, 0xBF, 0xB9, 0xBF, 0xC1, 0xBF, 0xD1, 0x04, 0x64, 0xAF, 0x27, 0x76, 0x7B, 0xAE,
+    0x27, 0xB6, 0x7C, 0x01, 0x70, 0x01, 0x01, 0x61, 0x7D, 0x81, 0x01, 0x91, 0x72, 0x7D, 0x80, 0x0A,
+    0xD2, 0x01, 0x61, 0xA8, 0xED, 0x82, 0x00, 0x11, 0x65, 0x6F, 0x01, 0x20, 0x81, 0x00, 0x51, 0x6F,
+    0x05, 0x0A, 0x66, 0x67, 0x69, 0x6C, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0x07, 0x68, 0x6D, 0x06,
+    0x70, 0x74, 0x00, 0x7B, 0xAD, 0x06, 0x07, 0x82, 0x00, 0x21, 0x69, 0x6E, 0x06, 0xAE, 0x58, 0x01,
+    0x69, 0x30, 0x01, 0x74, 0x7D, 0x01, 0x69, 0x7D, 0x03, 0x6C, 0x6E, 0x74, 0x07, 0xB0, 0x56, 0x7D,
+    0x80, 0x1F, 0x65, 0x01, 0x68, 0x7D, 0x01, 0x70, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x6E, 0x7D, 0x03,
+    0x63, 0x64, 0x68, 0xBF, 0x08, 0x03, 0x01, 0x81, 0x00, 0x41, 0x62, 0x03, 0x02, 0x65, 0x6F, 0x73,
+    0x7B, 0x01, 0x69, 0xAC, 0x58, 0x01, 0x74, 0xBE, 0xF2, 0x0A, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F,
+    0x72, 0x73, 0x74, 0x75, 0xBF, 0xBE, 0xBF, 0xCF, 0x24, 0x63, 0xAD, 0xC0, 0x0D, 0x73, 0xB0, 0x96,
+    0x78, 0x7C, 0x80, 0x1F, 0x33, 0x02, 0x6C, 0x73, 0x11, 0x7D, 0x01, 0x69, 0x7B, 0x81, 0x00, 0x11,
+    0x75, 0x7D, 0x01, 0x64, 0x04, 0x01, 0x69, 0xB8, 0xE5, 0x84, 0x01, 0x01, 0x62, 0x6E, 0x72, 0x74,
+    0x00, 0x79, 0x01, 0x7C, 0x81, 0x00, 0xD1, 0x6C, 0x05, 0x81, 0x00, 0xF1, 0x65, 0x05, 0x01, 0x68,
+    0x7B, 0x01, 0x6C, 0x06, 0x04, 0x61, 0x63, 0x65, 0x74, 0x02, 0x19, 0x04, 0x01, 0x02, 0x73, 0x74,
+    0x02, 0x01, 0x0A, 0x2E, 0x61, 0x63, 0x69, 0x6C, 0x6D, 0x6E, 0x71, 0x73, 0x74, 0x13, 0x6F, 0xA6,
+    0x71, 0xB4, 0x9C, 0x36, 0xB0, 0x75, 0x72, 0x00, 0x7B, 0x0B, 0x80, 0x00, 0x33, 0x01, 0x2E, 0x7D,
+    0x81, 0x0F, 0xB2, 0x6E, 0x7D, 0x01, 0x6B, 0x08, 0x02, 0x6E, 0x72, 0x06, 0x00, 0x81, 0x00, 0x61,
+    0x61, 0x03, 0x88, 0x01, 0x01, 0x61, 0x63, 0x65, 0x6E, 0x6F, 0x74, 0x75, 0x76, 0x6E, 0x73, 0x76,
+    0xAD, 0xE0, 0x0D, 0x04, 0x05, 0x7B, 0x80, 0x05, 0x22, 0x03, 0x73, 0x74, 0x7A, 0x05, 0x04, 0x08,
+    0x02, 0x69, 0x6F, 0x79, 0x01, 0x84, 0x00, 0xD1, 0x62, 0x63, 0x72, 0x75, 0x02, 0x07, 0x00, 0x0E,
+    0x81, 0x01, 0x01, 0x65, 0x3E, 0x03, 0x65, 0x6C, 0x77, 0xA7, 0xC9, 0x04, 0x01, 0x81, 0x00, 0x01,
+    0x74, 0x00, 0x01, 0x75, 0x08, 0x01, 0x61, 0x7D, 0x0D, 0x61, 0x62, 0x63, 0x65, 0x68, 0x69, 0x6D,
+    0x6E, 0x6F, 0x73, 0x74, 0x75, 0x77, 0xBF, 0x61, 0xBF, 0x6C, 0xBF, 0x76, 0xBF, 0x8A, 0x0E, 0xBF,
+    0xBA, 0xBF, 0xCE, 0xBF, 0xD8, 0xBF, 0xDD, 0x68, 0x6D, 0x75, 0x7D, 0x01, 0x65, 0xBB, 0x84, 0x81,
+    0x01, 0xB2, 0x67, 0x7C, 0x81, 0x00, 0x21, 0x6E, 0x02, 0x83, 0x01, 0x91, 0x61, 0x72, 0x75, 0x7B,
+    0x06, 0x02, 0x81, 0x00, 0x21, 0x72, 0x02, 0x01, 0x61, 0x03, 0x02, 0x74, 0x76, 0xBB, 0x65, 0x7D,
+    0x83, 0x00, 0x12, 0x63, 0x6E, 0x72, 0x72, 0xAC, 0xFF, 0x7A, 0x82, 0x00, 0x01, 0x61, 0x65, 0x06,
+    0x28, 0x81, 0x00, 0x21, 0x65, 0x1D, 0x01, 0x6E, 0x2A, 0x80, 0x04, 0x52, 0x01, 0x74, 0x24, 0x87,
+    0x00, 0x11, 0x63, 0x64, 0x67, 0x6D, 0x6E, 0x73, 0x75, 0x12, 0x72, 0x77, 0xB7, 0x9A, 0x7A, 0x7D,
+    0x00, 0x01, 0x6E, 0x07, 0x01, 0x69, 0x7D, 0x81, 0x00, 0x21, 0x75, 0x01, 0x81, 0x00, 0x21, 0x61,
+    0x02, 0x02, 0x6C, 0x6E, 0x76, 0x7B, 0x80, 0x1B, 0x12, 0x01, 0x69, 0x7D, 0x01, 0x63, 0x7D, 0x84,
+    0x00, 0x11, 0x61, 0x65, 0x69, 0x72, 0x7D, 0xB1, 0xF2, 0xBC, 0xD3, 0x2B, 0x80, 0x05, 0x82, 0x01,
+    0x62, 0x7D, 0x81, 0x00, 0xD1, 0x69, 0x7D, 0x02, 0x67, 0x6D, 0x01, 0x02, 0x81, 0x0E, 0xD2, 0x6E,
+    0x06, 0x01, 0x63, 0xA4, 0xEF, 0x82, 0x00, 0xD1, 0x6F, 0x75, 0x07, 0x7C, 0x04, 0x61, 0x69, 0x6F,
+    0x72, 0xB7, 0x59, 0x6B, 0x70, 0x79, 0x01, 0x72, 0xBF, 0x6C, 0x0D, 0x61, 0x63, 0x65, 0x68, 0x69,
+    0x6B, 0x6D, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x77, 0xBF, 0x55, 0xBF, 0x5F, 0xBF, 0x76, 0xBF, 0x80,
+    0xBF, 0x95, 0xBF, 0xAA, 0x21, 0xBF, 0xB7, 0xBF, 0xC5, 0xBF, 0xD8, 0x72, 0x7C, 0x05, 0x01, 0x62,
+    0x00, 0x02, 0x6E, 0x6F, 0xBC, 0x58, 0x06, 0x80, 0x1F, 0x03, 0x01, 0x65, 0x7D, 0x01, 0x6E, 0x7D,
+    0x01, 0x65, 0x7D, 0x01, 0x6C, 0x7D, 0x02, 0x6F, 0x79, 0xB2, 0x3C, 0x7D, 0x81, 0x01, 0x41, 0x6F,
+    0x00, 0x01, 0x69, 0xAD, 0xE6, 0x05, 0x63, 0x64, 0x6E, 0x72, 0x74, 0x0E, 0x31, 0x77, 0x07, 0x7C,
+    0x02, 0x63, 0x66, 0x01, 0x02, 0x02, 0x67, 0x73, 0x01, 0x02, 0x04, 0x61, 0x65, 0x69, 0x6F, 0x06,
+    0x06, 0x76, 0x7B, 0x0A, 0x61, 0x65, 0x68, 0x69, 0x6E, 0x6F, 0x72, 0x75, 0x79, 0x7A, 0xBF, 0xBB,
+    0xBF, 0xBE, 0xBF, 0xD3, 0x62, 0x04, 0xBF, 0x23, 0x77, 0x22, 0xB3, 0xA5, 0x02, 0x80, 0x1E, 0xD3,
+    0x01, 0x64, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x6C, 0x7D, 0x03, 0x65, 0x69, 0x72, 0x0B, 0xA4, 0xCC,
+    0x02, 0x86, 0x00, 0x01, 0x63, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x07, 0x06, 0xAE, 0x96, 0x00,
+    0x78, 0x80, 0x01, 0x12, 0x81, 0x00, 0x21, 0x74, 0x02, 0x02, 0x70, 0x73, 0x78, 0x7B, 0x02, 0x6C,
+    0x6F, 0x01, 0x11, 0x02, 0x67, 0x69, 0x07, 0x0B, 0x81, 0x01, 0x01, 0x62, 0x07, 0x04, 0x61, 0x6C,
+    0x6E, 0x72, 0x07, 0x71, 0x76, 0x7B, 0x84, 0x00, 0x11, 0x64, 0x6C, 0x6E, 0x76, 0x01, 0x00, 0x03,
+    0x00, 0x01, 0x63, 0x07, 0x05, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xBF, 0xD5, 0x69, 0x72, 0x7D, 0x07,
+    0x81, 0x00, 0x11, 0x67, 0x03, 0x01, 0x67, 0x01, 0x03, 0x6C, 0x6E, 0x74, 0x0F, 0x7D, 0x06, 0x04,
+    0x61, 0x65, 0x68, 0x69, 0x71, 0x31, 0x06, 0x79, 0x01, 0x70, 0x18, 0x03, 0x63, 0x65, 0x73, 0x08,
+    0x29, 0x00, 0x19, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D,
+    0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0xB9, 0xAD, 0xB9, 0xDA,
+    0xBA, 0x48, 0xBA, 0x96, 0xBA, 0xBA, 0xBB, 0x01, 0xBB, 0x23, 0xBB, 0x34, 0xBB, 0x4E, 0xBB, 0x69,
+    0xBB, 0x71, 0xBB, 0xF3, 0xBC, 0x4F, 0xBC, 0xC0, 0xBC, 0xFF, 0xBD, 0x57, 0xBD, 0x7B, 0xBE, 0x26,
+    0xBE, 0xF8, 0xBF, 0x61, 0xBF, 0x8F, 0xBF, 0xD2, 0x6D, 0x76, 0x79, 0x02, 0x6C, 0x72, 0x01, 0x0A,
+    0x01, 0x6C, 0x3D, 0x02, 0x61, 0x69, 0xAA, 0x63, 0x3A, 0x01, 0x68, 0x09, 0x81, 0x00, 0xC1, 0x74,
+    0x7D, 0x03, 0x61, 0x68, 0x6F, 0x01, 0xAB, 0x61, 0x04, 0x01, 0x6C, 0xA8, 0x69, 0x89, 0x00, 0x71,
+    0x62, 0x63, 0x67, 0x69, 0x6C, 0x6D, 0x72, 0x74, 0x75, 0xBF, 0xDE, 0x2B, 0x04, 0xA3, 0x81, 0x63,
+    0x66, 0x6F, 0x74, 0x7C, 0x02, 0x73, 0x74, 0x0B, 0xB1, 0x11, 0x01, 0x75, 0xAF, 0x39, 0x81, 0x00,
+    0xB1, 0x72, 0x7C, 0x02, 0x61, 0x74, 0x04, 0x08, 0x81, 0x01, 0x11, 0x65, 0x0F, 0x01, 0x64, 0x7B,
+    0x01, 0x69, 0xA7, 0xBB, 0x82, 0x02, 0x61, 0x6D, 0x72, 0x7C, 0x08, 0x0A, 0x2E, 0x61, 0x62, 0x63,
+    0x64, 0x6C, 0x6D, 0x6E, 0x72, 0x76, 0x04, 0xBF, 0xD9, 0x63, 0x68, 0x13, 0xAA, 0x11, 0x23, 0x72,
+    0x79, 0x00, 0x03, 0x65, 0x6E, 0x73, 0x03, 0xAA, 0x7E, 0xB5, 0x67, 0x01, 0x79, 0x03, 0x84, 0x00,
+    0x02, 0x65, 0x69, 0x6C, 0x79, 0xAA, 0xA4, 0x74, 0x7D, 0x12, 0x01, 0x65, 0x04, 0x03, 0x6C, 0x6E,
+    0x74, 0xAF, 0xA1, 0x06, 0x7D, 0x02, 0x6E, 0x72, 0x06, 0x01, 0x82, 0x00, 0x61, 0x61, 0x65, 0x08,
+    0x08, 0x07, 0x2E, 0x61, 0x65, 0x68, 0x69, 0x73, 0x75, 0x3B, 0x6C, 0x74, 0x0C, 0x79, 0x04, 0x01,
+    0x01, 0x65, 0x20, 0x01, 0x68, 0xA7, 0xCF, 0x01, 0x69, 0xA6, 0x79, 0x03, 0x69, 0x6C, 0x79, 0x09,
+    0x7C, 0x04, 0x80, 0x00, 0xE2, 0x85, 0x00, 0xD1, 0x61, 0x64, 0x65, 0x67, 0x6E, 0x08, 0xBE, 0x8C,
+    0x10, 0x7D, 0x00, 0x01, 0x74, 0x26, 0x01, 0x2E, 0x09, 0x01, 0x64, 0x7D, 0x01, 0x65, 0x7D, 0x01,
+    0x74, 0x7D, 0x88, 0x00, 0x71, 0x61, 0x63, 0x64, 0x67, 0x6C, 0x6E, 0x73, 0x74, 0x01, 0xBF, 0xBF,
+    0xBF, 0xCE, 0xBF, 0xD1, 0xBF, 0xD9, 0x63, 0x71, 0x7D, 0x80, 0x0A, 0x42, 0x01, 0x6C, 0x7D, 0x01,
+    0x65, 0x7D, 0x01, 0x67, 0x7D, 0x01, 0x73, 0xAC, 0x12, 0x02, 0x72, 0x77, 0xA7, 0xA0, 0xAE, 0x5E,
+    0x01, 0x72, 0x0C, 0x01, 0x6F, 0x7D, 0x80, 0x1E, 0xB2, 0x86, 0x04, 0x62, 0x61, 0x65, 0x69, 0x6F,
+    0x75, 0x79, 0x69, 0x6C, 0xA2, 0x85, 0x70, 0x7A, 0x7D, 0x82, 0x00, 0xC1, 0x64, 0x74, 0x15, 0x00,
+    0x02, 0x74, 0x79, 0x02, 0x09, 0x84, 0x01, 0x91, 0x61, 0x65, 0x69, 0x74, 0x7B, 0x37, 0x00, 0xA5,
+    0x1E, 0x83, 0x00, 0x71, 0x6E, 0x72, 0x73, 0x68, 0x74, 0x09, 0x02, 0x61, 0x73, 0x07, 0xA2, 0xB2,
+    0x81, 0x01, 0x11, 0x6C, 0x0B, 0x04, 0x61, 0x65, 0x69, 0x6F, 0xA3, 0x26, 0x75, 0x7B, 0xA2, 0xB0,
+    0x82, 0x00, 0xD1, 0x6F, 0x79, 0x03, 0x12, 0x02, 0x69, 0x73, 0x0B, 0x00, 0x01, 0x61, 0x04, 0x87,
+    0x01, 0x51, 0x65, 0x67, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x20, 0x04, 0xA8, 0x83, 0x19, 0xA8, 0xFD,
+    0x78, 0x7D, 0x11, 0x61, 0x62, 0x64, 0x65, 0x66, 0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72,
+    0x73, 0x74, 0x75, 0x79, 0xBE, 0x9B, 0x25, 0x04, 0xBE, 0xD9, 0xBE, 0xFC, 0x04, 0xBF, 0x60, 0xBF,
+    0x97, 0x04, 0x04, 0xBF, 0xBF, 0x25, 0xBF, 0xD3, 0x3B, 0xBF, 0xDE, 0x6D, 0x18, 0x03, 0x2E, 0x69,
+    0x6F, 0x08, 0x0C, 0x01, 0x82, 0x00, 0xD1, 0x65, 0x6F, 0x1A, 0x07, 0x81, 0x00, 0xF1, 0x61, 0x0F,
+    0x02, 0x73, 0x7A, 0x09, 0x7B, 0x02, 0x69, 0x6F, 0x7B, 0x04, 0x01, 0x6E, 0xB3, 0x52, 0x02, 0x68,
+    0x69, 0x11, 0xB0, 0x84, 0x88, 0x00, 0x71, 0x66, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x7A, 0x00,
+    0xBF, 0xD9, 0x60, 0x71, 0x76, 0xA9, 0xBF, 0x7A, 0x04, 0x01, 0x7A, 0x0B, 0x03, 0x6E, 0x73, 0x7A,
+    0x00, 0x02, 0x02, 0x02, 0x69, 0x79, 0x79, 0x04, 0x01, 0x74, 0x05, 0x01, 0x79, 0xAF, 0x96, 0x85,
+    0x00, 0x71, 0x61, 0x63, 0x69, 0x6F, 0x79, 0x79, 0x7C, 0xAC, 0x3D, 0x04, 0x04, 0x80, 0x10, 0x12,
+    0x82, 0x00, 0x71, 0x64, 0x6D, 0x7D, 0x01, 0x01, 0x63, 0xAF, 0x7A, 0x04, 0x68, 0x69, 0x6F, 0x79,
+    0x0F, 0x7C, 0x04, 0x05, 0x0A, 0x2E, 0x64, 0x65, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x76, 0x13,
+    0x13, 0xBF, 0xC5, 0xBF, 0xCF, 0xBF, 0xDB, 0x6C, 0xBE, 0x57, 0xB6, 0x1F, 0x77, 0x05, 0x83, 0x00,
+    0x03, 0x65, 0x6C, 0x6F, 0xAD, 0x7E, 0xA5, 0x64, 0x00, 0x01, 0x75, 0x1A, 0x01, 0x65, 0x14, 0x02,
+    0x6F, 0x77, 0x05, 0x7D, 0x03, 0x69, 0x6F, 0x74, 0xAB, 0x4E, 0x75, 0x7B, 0x81, 0x1E, 0x92, 0x72,
+    0x09, 0x01, 0x61, 0x08, 0x82, 0x00, 0x11, 0x69, 0x6F, 0x7D, 0x03, 0x02, 0x6E, 0x73, 0x0F, 0x29,
+    0x01, 0x6E, 0x06, 0x01, 0x65, 0x7D, 0x80, 0x0C, 0xB2, 0x80, 0x1E, 0x72, 0x03, 0x2E, 0x67, 0x73,
+    0x7A, 0x1B, 0x7D, 0x81, 0x01, 0x51, 0x6C, 0x00, 0x0D, 0x2E, 0x61, 0x63, 0x65, 0x6C, 0x6D, 0x6E,
+    0x6F, 0x72, 0x73, 0x75, 0x76, 0x7A, 0x08, 0xBF, 0xD4, 0xBF, 0xDC, 0x63, 0x00, 0x6B, 0x74, 0x08,
+    0x7B, 0xBA, 0xC9, 0x05, 0x08, 0x0C, 0x82, 0x00, 0x61, 0x64, 0x73, 0x3F, 0x08, 0x01, 0x64, 0x0D,
+    0x81, 0x00, 0x71, 0x61, 0x7D, 0x01, 0x68, 0x1F, 0x03, 0x62, 0x67, 0x73, 0x00, 0x06, 0x7D, 0x80,
+    0x16, 0x92, 0x01, 0x6E, 0x7D, 0x01, 0x69, 0x7D, 0x82, 0x01, 0x51, 0x62, 0x72, 0x7D, 0x0A, 0x84,
+    0x01, 0x91, 0x61, 0x65, 0x69, 0x6F, 0xBF, 0xD7, 0x61, 0x69, 0x79, 0x81, 0x00, 0x11, 0x79, 0x03,
+    0x80, 0x0B, 0x22, 0x82, 0x00, 0xB1, 0x2E, 0x63, 0x03, 0x7D, 0x01, 0x73, 0xA4, 0x67, 0x02, 0x69,
+    0x74, 0x7C, 0x0B, 0x01, 0x74, 0x7B, 0x82, 0x00, 0x11, 0x6E, 0x6F, 0x12, 0x03, 0x80, 0x04, 0x72,
+    0x01, 0x70, 0x12, 0x01, 0x73, 0x7D, 0x02, 0x2E, 0x65, 0x77, 0x7D, 0x83, 0x00, 0x11, 0x6D, 0x6E,
+    0x72, 0xA0, 0xC8, 0x03, 0x7B, 0x04, 0x61, 0x65, 0x69, 0x6F, 0xBF, 0xCE, 0xBF, 0xDE, 0x61, 0x76,
+    0x80, 0x1E, 0x43, 0x80, 0x1E, 0x13, 0x80, 0x1D, 0xC5, 0x01, 0x61, 0x7D, 0x81, 0x00, 0xF1, 0x7A,
+    0x7D, 0x83, 0x01, 0x11, 0x61, 0x64, 0x69, 0x72, 0xB8, 0xBB, 0x7B, 0x01, 0x75, 0x09, 0x02, 0x69,
+    0x6F, 0xAA, 0xFE, 0x7D, 0x8A, 0x00, 0x71, 0x2E, 0x62, 0x65, 0x67, 0x69, 0x6E, 0x6F, 0x72, 0x73,
+    0x76, 0x0C, 0x09, 0x08, 0xBF, 0xDC, 0xA8, 0x52, 0x6D, 0x08, 0x7A, 0x29, 0x14, 0x81, 0x01, 0x21,
+    0x2E, 0x16, 0x01, 0x72, 0x7B, 0x04, 0x2E, 0x65, 0x69, 0x79, 0x08, 0x7D, 0xB1, 0x08, 0x04, 0x01,
+    0x68, 0x76, 0x05, 0x64, 0x69, 0x6E, 0x70, 0x79, 0xBD, 0xFA, 0x03, 0xA0, 0x6E, 0x7D, 0x04, 0x01,
+    0x73, 0xB2, 0x9B, 0x02, 0x6E, 0x73, 0x00, 0x7C, 0x01, 0x76, 0xA3, 0xB2, 0x02, 0x65, 0x74, 0x7C,
+    0x04, 0x01, 0x66, 0x0B, 0x85, 0x00, 0x71, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xBF, 0xDE, 0x6F, 0x78,
+    0x03, 0x7D, 0x81, 0x01, 0x91, 0x74, 0x31, 0x01, 0x68, 0x0A, 0x01, 0x64, 0x0C, 0x81, 0x00, 0xB1,
+    0x72, 0x7D, 0x01, 0x74, 0xBF, 0x0D, 0x01, 0x6E, 0x0D, 0x81, 0x03, 0xB2, 0x61, 0x7D, 0x06, 0x61,
+    0x65, 0x69, 0x6E, 0x73, 0x74, 0x6F, 0x13, 0x74, 0x0C, 0x0C, 0x7B, 0x80, 0x1D, 0x93, 0x82, 0x00,
+    0x71, 0x6E, 0x72, 0x7D, 0x2A, 0x12, 0x61, 0x62, 0x64, 0x65, 0x67, 0x68, 0x69, 0x6C, 0x6D, 0x6E,
+    0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0x79, 0xBD, 0xFF, 0x06, 0x05, 0xBE, 0x4F, 0xBE, 0x69,
+    0xBE, 0x7F, 0xBE, 0xB3, 0xBE, 0xFA, 0xBF, 0x06, 0xBF, 0x40, 0xBF, 0x6F, 0x06, 0xBF, 0xBF, 0xBF,
+    0xCD, 0xBF, 0xD2, 0x69, 0x06, 0x79, 0x01, 0x6C, 0x38, 0x02, 0x6D, 0x74, 0x00, 0x00, 0x01, 0x73,
+    0x1E, 0x01, 0x72, 0x7D, 0x81, 0x00, 0xF1, 0x6D, 0x11, 0x01, 0x61, 0x7B, 0x02, 0x69, 0x79, 0x00,
+    0x00, 0x82, 0x00, 0x61, 0x65, 0x6F, 0xA0, 0x0A, 0x0F, 0x80, 0x15, 0xD2, 0x01, 0x7A, 0x7D, 0x06,
+    0x63, 0x64, 0x67, 0x69, 0x6B, 0x74, 0x6D, 0x29, 0x72, 0x7D, 0x00, 0x15, 0x80, 0x1D, 0x63, 0x01,
+    0x72, 0x7D, 0x01, 0x72, 0x7D, 0x03, 0x61, 0x6C, 0x74, 0x7D, 0x0A, 0x09, 0x02, 0x6E, 0x73, 0x01,
+    0x02, 0x01, 0x65, 0xA2, 0xDF, 0x05, 0x61, 0x64, 0x6C, 0x70, 0x74, 0x77, 0xB4, 0xD5, 0x15, 0x7C,
+    0xAB, 0x18, 0x01, 0x68, 0xA2, 0xD8, 0x01, 0x63, 0x7C, 0x81, 0x00, 0xC1, 0x61, 0x0A, 0x0E, 0x62,
+    0x63, 0x65, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x7A, 0xBF, 0x98, 0xC0,
+    0x03, 0x23, 0xBF, 0x9B, 0xA5, 0x3E, 0xBF, 0xA3, 0xBF, 0xAB, 0x05, 0xBF, 0xC1, 0xBF, 0xD7, 0x67,
+    0x3A, 0x78, 0xC0, 0x03, 0x8E, 0x7B, 0x02, 0x64, 0x72, 0x18, 0x0C, 0x02, 0x6E, 0x74, 0x05, 0x07,
+    0x01, 0x61, 0x7B, 0x81, 0x00, 0x51, 0x6F, 0xA4, 0xB3, 0x02, 0x69, 0x79, 0xB0, 0x5A, 0x00, 0x03,
+    0x69, 0x6C, 0x6F, 0xB8, 0xF7, 0x7A, 0x07, 0x81, 0x01, 0x41, 0x74, 0x09, 0x81, 0x01, 0x91, 0x61,
+    0x7B, 0x81, 0x00, 0x51, 0x70, 0x11, 0x06, 0x61, 0x62, 0x65, 0x6E, 0x6F, 0x79, 0x7B, 0xC0, 0x04,
+    0x06, 0xA1, 0x8D, 0x06, 0xA4, 0xE6, 0x06, 0x81, 0x00, 0x11, 0x70, 0xAE, 0x7D, 0x81, 0x00, 0xB1,
+    0x65, 0xA2, 0xDA, 0x01, 0x61, 0xA3, 0xF8, 0x0D, 0x61, 0x63, 0x64, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+    0x72, 0x73, 0x74, 0x75, 0x78, 0xBF, 0xAF, 0xBF, 0xB9, 0xBF, 0xBC, 0xBF, 0xC8, 0xB2, 0xDD, 0xBF,
+    0xD5, 0x2D, 0x09, 0xBF, 0xDF, 0x70, 0x76, 0x00, 0x7C, 0x01, 0x68, 0x0F, 0x80, 0x1D, 0x22, 0x01,
+    0x72, 0x1C, 0x01, 0x65, 0x7D, 0x01, 0x6E, 0x24, 0x80, 0x1C, 0xE4, 0x01, 0x61, 0x7D, 0x01, 0x6C,
+    0x7D, 0x81, 0x00, 0xB1, 0x65, 0x7D, 0x04, 0x6C, 0x6F, 0x70, 0x72, 0x00, 0x01, 0x00, 0x00, 0x02,
+    0x65, 0x73, 0xB1, 0x76, 0x00, 0x01, 0x64, 0x11, 0x01, 0x69, 0x7D, 0x01, 0x73, 0x7D, 0x02, 0x65,
+    0x68, 0x7D, 0xC0, 0x04, 0x26, 0x0C, 0x61, 0x63, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73,
+    0x74, 0x76, 0x1D, 0x23, 0xBF, 0xC4, 0xBF, 0xC7, 0xBF, 0xCD, 0xB8, 0xD2, 0xBF, 0xD0, 0xBF, 0xDC,
+    0x61, 0x6A, 0x79, 0x10, 0x81, 0x00, 0x21, 0x72, 0x32, 0x82, 0x17, 0x63, 0x61, 0x6F, 0xC0, 0x03,
+    0x8E, 0x7B, 0x81, 0x00, 0x02, 0x65, 0xA1, 0xF5, 0x01, 0x7A, 0x11, 0x01, 0x75, 0x7D, 0x81, 0x00,
+    0xD2, 0x61, 0x7D, 0x01, 0x7A, 0x07, 0x02, 0x69, 0x73, 0x7D, 0x07, 0x81, 0x00, 0xB1, 0x65, 0x0B,
+    0x80, 0x02, 0x92, 0x02, 0x61, 0x65, 0x2D, 0x7D, 0x02, 0x61, 0x65, 0x05, 0x11, 0x02, 0x61, 0x79,
+    0x00, 0x02, 0x02, 0x64, 0x6E, 0x0C, 0x0B, 0x01, 0x2E, 0xA9, 0xDC, 0x02, 0x63, 0x73, 0x7C, 0x02,
+    0x04, 0x61, 0x69, 0x74, 0x75, 0x33, 0x7B, 0xA0, 0xF4, 0x02, 0x81, 0x00, 0x61, 0x6E, 0x02, 0x02,
+    0x65, 0x70, 0x7B, 0x14, 0x81, 0x00, 0x71, 0x65, 0x2F, 0x01, 0x73, 0x7B, 0x01, 0x65, 0xAC, 0x90,
+    0x0A, 0x64, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x75, 0x76, 0xBF, 0xB6, 0xBF, 0xBB, 0xBF,
+    0xC3, 0xBF, 0xC8, 0xBF, 0xCD, 0xBF, 0xD2, 0x60, 0x6F, 0x79, 0x7C, 0x02, 0x6E, 0x70, 0xB1, 0xCD,
+    0xA0, 0xBC, 0x82, 0x03, 0xB2, 0x65, 0x6F, 0x3D, 0x79, 0x81, 0x00, 0x03, 0x68, 0x03, 0x01, 0x72,
+    0x03, 0x01, 0x75, 0xBC, 0xFC, 0x03, 0x6E, 0x6F, 0x73, 0x0E, 0x7C, 0x02, 0x03, 0x61, 0x65, 0x79,
+    0x72, 0x79, 0x03, 0x02, 0x6B, 0x74, 0x1B, 0x00, 0x80, 0x10, 0xF2, 0x01, 0x74, 0x7D, 0x05, 0x67,
+    0x6D, 0x6E, 0x73, 0x74, 0x05, 0xA3, 0xD4, 0x75, 0x7D, 0x05, 0x01, 0x72, 0xB3, 0x5F, 0x81, 0x00,
+    0x11, 0x61, 0x7C, 0x01, 0x61, 0x1E, 0x01, 0x68, 0x7D, 0x01, 0x74, 0x7D, 0x03, 0x65, 0x68, 0x6F,
+    0x01, 0x01, 0x7D, 0x02, 0x70, 0x73, 0x79, 0x10, 0x12, 0x61, 0x62, 0x65, 0x66, 0x68, 0x69, 0x6B,
+    0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0x79, 0xBE, 0x26, 0x0D, 0xBE, 0x9F,
+    0x0D, 0x0D, 0xBE, 0xFD, 0x04, 0xBF, 0x21, 0xBF, 0x2A, 0xBF, 0x36, 0xBF, 0x88, 0x25, 0xBF, 0xAA,
+    0xBF, 0xB1, 0xBF, 0xC4, 0xBF, 0xD6, 0x66, 0x7B, 0x81, 0x00, 0x61, 0x65, 0xA0, 0x7E, 0x83, 0x00,
+    0x21, 0x63, 0x69, 0x74, 0x04, 0x0A, 0xAB, 0x93, 0x01, 0x76, 0x03, 0x01, 0x63, 0x05, 0x01, 0x69,
+    0x7D, 0x03, 0x69, 0x72, 0x75, 0x77, 0x7D, 0x03, 0x86, 0x00, 0xD2, 0x6C, 0x6D, 0x6E, 0x70, 0x73,
+    0x74, 0x12, 0x60, 0x66, 0x19, 0xA4, 0xFB, 0x79, 0x02, 0x61, 0x74, 0x01, 0x02, 0x81, 0x00, 0x61,
+    0x72, 0x7B, 0x02, 0x2E, 0x65, 0x02, 0x02, 0x03, 0x61, 0x6E, 0x74, 0x02, 0x01, 0x7B, 0x81, 0x00,
+    0x11, 0x69, 0x01, 0x81, 0x00, 0x11, 0x69, 0xAF, 0x16, 0x06, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x75,
+    0x64, 0x6E, 0x75, 0x07, 0x7A, 0xB7, 0x88, 0x82, 0x00, 0x01, 0x2E, 0x61, 0x03, 0x03, 0x05, 0x6D,
+    0x70, 0x72, 0x73, 0x79, 0x04, 0x08, 0x79, 0x0F, 0x03, 0x01, 0x75, 0x0B, 0x01, 0x6F, 0x04, 0x81,
+    0x00, 0x21, 0x61, 0x01, 0x83, 0x00, 0xD1, 0x64, 0x6E, 0x70, 0x07, 0x2A, 0x7B, 0x01, 0x63, 0xAE,
+    0xDC, 0x82, 0x00, 0x02, 0x61, 0x79, 0x08, 0x03, 0x81, 0x07, 0xB1, 0x61, 0xB2, 0x0F, 0x02, 0x65,
+    0x75, 0x05, 0x7A, 0x04, 0x6C, 0x6D, 0x6F, 0x72, 0x22, 0x05, 0x02, 0x06, 0x0A, 0x61, 0x63, 0x65,
+    0x68, 0x69, 0x6C, 0x6F, 0x72, 0x74, 0x75, 0xBF, 0xC2, 0xBF, 0xCD, 0xBF, 0xD0, 0x04, 0xBF, 0xD8,
+    0xB9, 0x5F, 0x61, 0x65, 0x72, 0x77, 0x02, 0x69, 0x6E, 0x03, 0xA3, 0xE9, 0x02, 0x61, 0x73, 0xAF,
+    0x69, 0x00, 0x02, 0x6E, 0x72, 0x02, 0x00, 0x82, 0x00, 0xF1, 0x73, 0x75, 0x05, 0x09, 0x85, 0x00,
+    0x21, 0x61, 0x65, 0x6F, 0x74, 0x75, 0x74, 0x07, 0x79, 0x0E, 0x02, 0x02, 0x6D, 0x77, 0x03, 0x01,
+    0x81, 0x00, 0x21, 0x6F, 0x02, 0x88, 0x00, 0xD1, 0x61, 0x64, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x75,
+    0xBF, 0xD1, 0x02, 0xBF, 0xD7, 0x69, 0xB1, 0x20, 0x76, 0x03, 0x7B, 0x80, 0x0D, 0x32, 0x01, 0x61,
+    0x7D, 0x04, 0x61, 0x65, 0x6E, 0x74, 0xAD, 0x9B, 0x00, 0x07, 0xA4, 0x06, 0x01, 0x2E, 0x0D, 0x02,
+    0x63, 0x74, 0x06, 0x0D, 0x87, 0x1C, 0xA2, 0x64, 0x67, 0x6C, 0x6E, 0x72, 0x73, 0x74, 0x15, 0x6A,
+    0xBD, 0xA1, 0x6D, 0x78, 0x7B, 0x06, 0x01, 0x74, 0x1E, 0x01, 0x65, 0x7D, 0x01, 0x63, 0x7D, 0x01,
+    0x72, 0x30, 0x02, 0x65, 0x72, 0x28, 0x05, 0x02, 0x63, 0x65, 0xAE, 0x63, 0x06, 0x07, 0x2E, 0x61,
+    0x65, 0x66, 0x69, 0x6C, 0x74, 0x04, 0x6F, 0x72, 0x75, 0x7A, 0x06, 0x04, 0x01, 0x62, 0x09, 0x01,
+    0x72, 0x22, 0x01, 0x74, 0xC0, 0x04, 0x93, 0x84, 0x00, 0x01, 0x62, 0x6C, 0x6E, 0x74, 0x06, 0x01,
+    0x01, 0x01, 0x80, 0x01, 0xC2, 0x01, 0x72, 0xC0, 0x07, 0x2A, 0x81, 0x00, 0x61, 0x65, 0x7B, 0x01,
+    0x74, 0x7B, 0x01, 0x69, 0x7D, 0x82, 0x00, 0x21, 0x72, 0x74, 0x01, 0x02, 0x02, 0x69, 0x72, 0x09,
+    0x0E, 0x89, 0x00, 0xD1, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6E, 0x6F, 0x72, 0x75, 0xBF, 0xCB, 0xBF,
+    0xCE, 0xBF, 0xD1, 0xBF, 0xD6, 0x61, 0x71, 0x74, 0x31, 0x7B, 0x80, 0x17, 0x33, 0x81, 0x00, 0x41,
+    0x6B, 0x03, 0x84, 0x00, 0x11, 0x62, 0x64, 0x6D, 0x72, 0xB5, 0x84, 0xB1, 0xA9, 0xAD, 0xB7, 0xC0,
+    0x03, 0xB1, 0x03, 0x67, 0x72, 0x76, 0x06, 0x0E, 0x0B, 0x86, 0x01, 0x01, 0x61, 0x62, 0x6F, 0x73,
+    0x74, 0x7A, 0x01, 0x10, 0x01, 0xB9, 0xBF, 0x13, 0x10, 0x01, 0x61, 0xBF, 0x83, 0x01, 0x71, 0x01,
+    0x0A, 0x61, 0x65, 0x66, 0x69, 0x6C, 0x6E, 0x6F, 0x74, 0x75, 0x76, 0xBF, 0xD2, 0x62, 0x02, 0x69,
+    0x79, 0x04, 0x7D, 0xA6, 0xA5, 0x27, 0x01, 0x81, 0x00, 0x51, 0x65, 0x01, 0x01, 0x79, 0x09, 0x02,
+    0x67, 0x72, 0x78, 0x7D, 0x01, 0x61, 0xC0, 0x03, 0x73, 0x01, 0x74, 0x7B, 0x02, 0x6E, 0x74, 0x7D,
+    0x04, 0x84, 0x01, 0x01, 0x64, 0x6C, 0x6E, 0x74, 0x2A, 0x1B, 0xA4, 0xC3, 0x04, 0x01, 0x61, 0xAD,
+    0x90, 0x01, 0x64, 0x7C, 0x01, 0x65, 0x7D, 0x81, 0x00, 0x21, 0x6C, 0x22, 0x07, 0x61, 0x65, 0x69,
+    0x6E, 0x6F, 0x70, 0x75, 0xBF, 0xD3, 0x60, 0x65, 0x21, 0xB9, 0xD4, 0x78, 0x7B, 0x02, 0x75, 0x76,
+    0x34, 0x04, 0x02, 0x6C, 0x72, 0x1C, 0x01, 0x01, 0x65, 0x7B, 0x01, 0x6E, 0x35, 0x01, 0x69, 0x7D,
+    0x81, 0x00, 0x01, 0x6C, 0x7D, 0x01, 0x61, 0xC0, 0x04, 0x9B, 0x83, 0x00, 0xD1, 0x65, 0x72, 0x73,
+    0x06, 0x7B, 0xA4, 0x4D, 0x80, 0x1B, 0xD2, 0x01, 0x73, 0x7D, 0x01, 0x61, 0x7D, 0x01, 0x72, 0x7D,
+    0x81, 0x00, 0x01, 0x6E, 0x02, 0x06, 0x61, 0x65, 0x69, 0x6C, 0x6F, 0x75, 0x04, 0x7B, 0x04, 0xBF,
+    0xD8, 0x04, 0x04, 0x01, 0x79, 0xA1, 0xFD, 0x02, 0x2E, 0x6C, 0x07, 0x7C, 0x01, 0x6F, 0x08, 0x03,
+    0x65, 0x69, 0x79, 0x78, 0x7D, 0x01, 0x85, 0x00, 0xD1, 0x2E, 0x61, 0x6F, 0x73, 0x74, 0x07, 0x03,
+    0x01, 0x0E, 0x79, 0x83, 0x00, 0xD2, 0x63, 0x73, 0x74, 0xB3, 0x8B, 0x00, 0x03, 0x01, 0x61, 0x16,
+    0x01, 0x72, 0x7D, 0x82, 0x00, 0xD1, 0x65, 0x75, 0x01, 0x7D, 0x80, 0x1C, 0xA2, 0x02, 0x2E, 0x68,
+    0x13, 0x7D, 0x81, 0x01, 0x01, 0x73, 0x07, 0x10, 0x2E, 0x61, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69,
+    0x6B, 0x6C, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0x79, 0x13, 0xBF, 0x76, 0xBF, 0x80, 0xBF, 0x89, 0xBF,
+    0x93, 0xBF, 0xA6, 0xBF, 0xAE, 0xBF, 0xCF, 0x04, 0x04, 0x13, 0xBF, 0xDC, 0x6C, 0x76, 0x7B, 0x04,
+    0x02, 0x65, 0x72, 0x0B, 0x10, 0x01, 0x72, 0xC0, 0x05, 0xF8, 0x03, 0x61, 0x65, 0x69, 0xC0, 0x03,
+    0x3B, 0x7B, 0x0A, 0x03, 0x68, 0x69, 0x6F, 0x02, 0x07, 0x05, 0x8A, 0x00, 0xD1, 0x2E, 0x67, 0x6C,
+    0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x04, 0x66, 0x0D, 0x05, 0x70, 0xA4, 0x22, 0x32, 0x03,
+    0x79, 0xBC, 0x84, 0x01, 0x73, 0xC0, 0x07, 0xC2, 0x01, 0x61, 0x7B, 0x01, 0x72, 0x7D, 0x81, 0x00,
+    0xF1, 0x63, 0x05, 0x01, 0x65, 0xB4, 0xD9, 0x85, 0x00, 0xD1, 0x65, 0x68, 0x69, 0x72, 0x75, 0x00,
+    0x74, 0x77, 0x7C, 0x3C, 0x80, 0x10, 0x02, 0x02, 0x64, 0x74, 0x01, 0x7D, 0x03, 0x61, 0x65, 0x69,
+    0x06, 0xAC, 0x73, 0x7B, 0x01, 0x75, 0x78, 0x82, 0x00, 0x11, 0x62, 0x63, 0x00, 0x03, 0x80, 0x00,
+    0x52, 0x04, 0x64, 0x66, 0x6C, 0x73, 0x15, 0x03, 0x7D, 0x03, 0x01, 0x69, 0x02, 0x80, 0x1C, 0x73,
+    0x84, 0x01, 0x01, 0x64, 0x73, 0x74, 0x7A, 0x1B, 0x05, 0xA9, 0x59, 0x7D, 0x02, 0x67, 0x6E, 0x00,
+    0x29, 0x80, 0x1C, 0x52, 0x01, 0x63, 0x7D, 0x01, 0x6F, 0x7D, 0x01, 0x76, 0x7D, 0x01, 0x65, 0x7D,
+    0x89, 0x00, 0x01, 0x61, 0x64, 0x65, 0x67, 0x69, 0x6D, 0x6F, 0x72, 0x75, 0xBF, 0xC7, 0x1B, 0xBF,
+    0xD1, 0xBF, 0xDA, 0x60, 0xC0, 0x09, 0xE2, 0x6C, 0x7D, 0x20, 0x03, 0x67, 0x72, 0x73, 0x02, 0x01,
+    0x0F, 0x81, 0x17, 0xD2, 0x68, 0x01, 0x81, 0x00, 0x01, 0x72, 0x01, 0x02, 0x6E, 0x70, 0x01, 0x09,
+    0x02, 0x61, 0x6F, 0x1D, 0x7B, 0x04, 0x62, 0x64, 0x73, 0x74, 0x01, 0x00, 0x07, 0xB0, 0xF7, 0x01,
+    0x61, 0xAB, 0xB6, 0x81, 0x00, 0x21, 0x6D, 0xA5, 0x2A, 0x82, 0x01, 0x01, 0x69, 0x79, 0x10, 0x05,
+    0x02, 0x6E, 0x73, 0x1C, 0x05, 0x82, 0x1C, 0x32, 0x61, 0x65, 0xAB, 0xA3, 0x7B, 0x01, 0x61, 0xB0,
+    0x64, 0x05, 0x61, 0x65, 0x69, 0x6C, 0x72, 0xA0, 0x7A, 0x0E, 0x0E, 0xC0, 0x05, 0xF8, 0x7C, 0x81,
+    0x00, 0x21, 0x73, 0x02, 0x0F, 0x2E, 0x61, 0x63, 0x65, 0x66, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6F,
+    0x70, 0x73, 0x74, 0x75, 0x13, 0xBF, 0xA6, 0xBF, 0xAD, 0xBF, 0xB2, 0x0C, 0xBF, 0xBC, 0xBF, 0xC1,
+    0xC0, 0x0A, 0x56, 0xBF, 0xCB, 0xB1, 0xEE, 0xBF, 0xCF, 0xBF, 0xD5, 0x61, 0x6D, 0x7B, 0x80, 0x1C,
+    0x12, 0x06, 0x2E, 0x62, 0x67, 0x6D, 0x6E, 0x74, 0x04, 0x26, 0x03, 0x7D, 0x06, 0x06, 0x02, 0x61,
+    0x69, 0x01, 0x07, 0x01, 0x61, 0x0D, 0x01, 0x6D, 0x7D, 0x81, 0x00, 0xB1, 0x69, 0x7D, 0x82, 0x00,
+    0xD1, 0x72, 0x73, 0x70, 0x7B, 0x01, 0x6C, 0xC0, 0x05, 0xB4, 0x81, 0x00, 0xD1, 0x69, 0x7B, 0x82,
+    0x1B, 0xF2, 0x61, 0x6B, 0x01, 0xA0, 0x27, 0x80, 0x07, 0x92, 0x01, 0x72, 0x7D, 0x01, 0x61, 0x7D,
+    0x01, 0x72, 0x7D, 0x01, 0x65, 0x7D, 0x81, 0x00, 0x01, 0x6D, 0x03, 0x88, 0x00, 0x11, 0x61, 0x63,
+    0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x73, 0x04, 0x64, 0x01, 0x20, 0x12, 0x78, 0x13, 0x7B, 0x80, 0x15,
+    0xC3, 0x02, 0x6D, 0x6E, 0x7D, 0x04, 0x02, 0x61, 0x79, 0xAE, 0xBC, 0x02, 0x03, 0x61, 0x64, 0x6C,
+    0x3E, 0x07, 0x01, 0x09, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x74, 0x75, 0x7A, 0xBF, 0x8E, 0xBF,
+    0xAB, 0xBF, 0xB7, 0xBF, 0xD8, 0x6E, 0x73, 0x04, 0x79, 0xAB, 0x07, 0x02, 0x2E, 0x73, 0x34, 0xAF,
+    0x7F, 0x03, 0x6C, 0x6E, 0x72, 0x3C, 0xA2, 0xB9, 0x7A, 0x03, 0x6C, 0x6F, 0x74, 0x36, 0x02, 0x0E,
+    0x02, 0x65, 0x6F, 0x07, 0xA0, 0x80, 0x02, 0x72, 0x74, 0x7A, 0x34, 0x83, 0x00, 0xD1, 0x65, 0x69,
+    0x6F, 0x66, 0x6E, 0x7B, 0x01, 0x74, 0x08, 0x01, 0x6E, 0x7D, 0x03, 0x61, 0x69, 0x6F, 0xA8, 0x04,
+    0x00, 0x7D, 0x1A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D,
+    0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xBB, 0x36, 0xBB,
+    0x67, 0xBB, 0xBA, 0xBC, 0x03, 0xBC, 0x32, 0xBC, 0x5B, 0xBC, 0x9F, 0x06, 0xBC, 0xB8, 0xBC, 0xBB,
+    0x04, 0xBC, 0xEE, 0xBD, 0x3A, 0xBD, 0xD5, 0xBE, 0x18, 0xBE, 0x45, 0xBE, 0x62, 0xBE, 0x9E, 0xBF,
+    0x12, 0xBF, 0xB1, 0x0D, 0x69, 0x25, 0x23, 0x04, 0x78, 0x01, 0x71, 0x00, 0x01, 0x61, 0x11, 0x01,
+    0x75, 0x7D, 0x01, 0x65, 0xBD, 0x25, 0x01, 0x6E, 0x7C, 0x81, 0x00, 0xB1, 0x61, 0x7D, 0x83, 0x00,
+    0xC1, 0x63, 0x6E, 0x70, 0x6B, 0x71, 0x7B, 0x80, 0x04, 0x02, 0x01, 0x6D, 0x7D, 0x02, 0x65, 0x73,
+    0x7D, 0x09, 0x02, 0x69, 0x79, 0xB4, 0xB8, 0x04, 0x01, 0x74, 0x7A, 0x83, 0x00, 0x71, 0x72, 0x73,
+    0x77, 0x72, 0x7D, 0x0A, 0x01, 0x70, 0x05, 0x01, 0x67, 0x08, 0x01, 0x64, 0x7D, 0x04, 0x61, 0x65,
+    0x6F, 0x75, 0xBF, 0xD1, 0x6E, 0x77, 0x7D, 0x05, 0x2E, 0x62, 0x67, 0x69, 0x6C, 0x0C, 0x06, 0x07,
+    0xC0, 0x0B, 0x83, 0x00, 0x80, 0x1B, 0xB2, 0x01, 0x67, 0x7D, 0x81, 0x00, 0xA1, 0x6E, 0x7D, 0x01,
+    0x69, 0x7B, 0x01, 0x64, 0x38, 0x81, 0x00, 0x61, 0x74, 0xC0, 0x0A, 0x89, 0x08, 0x64, 0x65, 0x67,
+    0x6C, 0x6E, 0x72, 0x73, 0x74, 0x12, 0x18, 0x05, 0x73, 0x76, 0x0D, 0x79, 0xA2, 0xD9, 0x80, 0x1B,
+    0x92, 0x02, 0x6C, 0x6F, 0x03, 0x0F, 0x80, 0x1B, 0x72, 0x01, 0x63, 0x7D, 0x01, 0x69, 0x7D, 0x02,
+    0x73, 0x74, 0xA0, 0xD8, 0x7D, 0x04, 0x2E, 0x64, 0x65, 0x67, 0x03, 0x15, 0x7A, 0x00, 0x81, 0x00,
+    0x61, 0x68, 0x07, 0x87, 0x00, 0x11, 0x2E, 0x63, 0x6C, 0x6D, 0x6E, 0x70, 0x73, 0x08, 0xBF, 0xDB,
+    0xBF, 0xDE, 0x03, 0x72, 0x05, 0x7B, 0x01, 0x79, 0x04, 0x82, 0x00, 0x11, 0x65, 0x79, 0x7D, 0x04,
+    0x02, 0x65, 0x6F, 0xA0, 0xA7, 0xB6, 0x70, 0x01, 0x6E, 0x18, 0x01, 0x61, 0x7D, 0x01, 0x69, 0x7D,
+    0x04, 0x72, 0x73, 0x75, 0x76, 0x02, 0xC0, 0x03, 0x23, 0x06, 0x7D, 0x01, 0x6F, 0x28, 0x01, 0x61,
+    0x06, 0x84, 0x00, 0x03, 0x63, 0x68, 0x6C, 0x79, 0x03, 0x7D, 0x05, 0x03, 0x0F, 0x61, 0x62, 0x65,
+    0x66, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x77, 0xBF, 0x5B, 0x0D, 0xBF,
+    0x80, 0x06, 0x05, 0xBF, 0xB7, 0x05, 0xBF, 0xCD, 0x0D, 0xBF, 0xD4, 0x64, 0x6F, 0x75, 0x07, 0x0D,
+    0x02, 0x69, 0x6F, 0xA4, 0x2C, 0x03, 0x80, 0x1B, 0x43, 0x81, 0x01, 0x41, 0x65, 0x7D, 0x01, 0x69,
+    0x7B, 0x02, 0x65, 0x79, 0x03, 0x01, 0x01, 0x73, 0xC0, 0x06, 0xB7, 0x01, 0x73, 0x7B, 0x01, 0x65,
+    0x7D, 0x01, 0x6E, 0x7D, 0x03, 0x64, 0x65, 0x74, 0xB5, 0x9F, 0x33, 0x15, 0x01, 0x6E, 0xC0, 0x05,
+    0x32, 0x01, 0x65, 0x7B, 0x03, 0x63, 0x67, 0x69, 0x7D, 0x00, 0x0A, 0x01, 0x6C, 0xC0, 0x0A, 0xB6,
+    0x03, 0x61, 0x65, 0x69, 0x1D, 0x7B, 0xA5, 0x52, 0x81, 0x00, 0x01, 0x61, 0xB1, 0x31, 0x0B, 0x62,
+    0x63, 0x64, 0x67, 0x69, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x76, 0xBF, 0xB2, 0xBF, 0xC0, 0xBF, 0xC3,
+    0xAE, 0x12, 0xBF, 0xD3, 0xC0, 0x06, 0x97, 0xBF, 0xD6, 0x66, 0x15, 0x72, 0x7A, 0x81, 0x00, 0xD2,
+    0x69, 0xC0, 0x03, 0x8E, 0x80, 0x1B, 0x13, 0x01, 0x64, 0x7D, 0x01, 0x6C, 0x7D, 0x02, 0x61, 0x69,
+    0xC0, 0x0B, 0x77, 0x7D, 0x83, 0x00, 0x03, 0x65, 0x68, 0x69, 0x00, 0x79, 0x06, 0x02, 0x65, 0x69,
+    0x05, 0x05, 0x81, 0x00, 0x21, 0x72, 0x7B, 0x81, 0x00, 0x61, 0x73, 0x02, 0x81, 0x00, 0x41, 0x69,
+    0x03, 0x83, 0x00, 0xD1, 0x65, 0x69, 0x72, 0x71, 0x76, 0x7B, 0x01, 0x2E, 0xC0, 0x0B, 0x65, 0x01,
+    0x72, 0x7B, 0x01, 0x65, 0x7D, 0x80, 0x08, 0x92, 0x01, 0x61, 0x7D, 0x82, 0x01, 0x91, 0x64, 0x73,
+    0x77, 0x7D, 0x80, 0x1A, 0x93, 0x01, 0x62, 0x7D, 0x01, 0x61, 0x7D, 0x01, 0x74, 0x7D, 0x80, 0x1A,
+    0xE3, 0x01, 0x65, 0x7D, 0x01, 0x72, 0x7D, 0x01, 0x64, 0x7D, 0x01, 0x6E, 0x7D, 0x03, 0x2E, 0x65,
+    0x67, 0x08, 0x7D, 0x08, 0x01, 0x63, 0x09, 0x81, 0x00, 0xB1, 0x69, 0x7D, 0x01, 0x74, 0x7B, 0x01,
+    0x61, 0x7D, 0x01, 0x64, 0xA9, 0xA6, 0x01, 0x69, 0x7C, 0x05, 0x2E, 0x63, 0x65, 0x6F, 0x74, 0x04,
+    0x0C, 0x29, 0x7D, 0x18, 0x02, 0x68, 0x72, 0x01, 0x05, 0x01, 0x62, 0x0F, 0x05, 0x61, 0x65, 0x67,
+    0x69, 0x6F, 0x7D, 0x00, 0x0C, 0xB4, 0xAA, 0x03, 0x81, 0x01, 0x51, 0x2E, 0x08, 0x83, 0x01, 0x11,
+    0x63, 0x71, 0x73, 0x30, 0x08, 0x7B, 0x03, 0x2E, 0x61, 0x73, 0x00, 0x00, 0x00, 0x01, 0x72, 0x79,
+    0x02, 0x61, 0x65, 0x06, 0x7D, 0x81, 0x01, 0x51, 0x65, 0x04, 0x0C, 0x61, 0x62, 0x63, 0x66, 0x67,
+    0x6D, 0x6E, 0x70, 0x72, 0x73, 0x76, 0x79, 0xBF, 0x81, 0x21, 0xBF, 0x91, 0x37, 0xBF, 0xA3, 0xBF,
+    0xB5, 0xBF, 0xBF, 0xBF, 0xCA, 0xBF, 0xD2, 0x63, 0x76, 0x7B, 0x81, 0x00, 0xD1, 0x72, 0x07, 0x81,
+    0x01, 0x21, 0x72, 0x11, 0x83, 0x17, 0x63, 0x61, 0x65, 0x6F, 0x7B, 0xC0, 0x0B, 0x12, 0x0A, 0x05,
+    0x67, 0x6D, 0x72, 0x73, 0x74, 0x05, 0x10, 0xA8, 0x4A, 0x05, 0x23, 0x06, 0x69, 0x6F, 0x73, 0x74,
+    0x75, 0x79, 0xBA, 0xC1, 0x39, 0x04, 0xA7, 0xDF, 0x03, 0x06, 0x03, 0x61, 0x65, 0x69, 0x06, 0x2D,
+    0x0C, 0x03, 0x65, 0x66, 0x6C, 0xC0, 0x05, 0x7E, 0x03, 0x05, 0x01, 0x65, 0x08, 0x01, 0x74, 0x7D,
+    0x03, 0x61, 0x68, 0x72, 0x7D, 0x0C, 0xA3, 0x0B, 0x80, 0x1A, 0x63, 0x04, 0x62, 0x69, 0x6F, 0x70,
+    0xC0, 0x06, 0xF6, 0x0A, 0x05, 0xAE, 0x33, 0x81, 0x12, 0xB2, 0x61, 0x0A, 0x04, 0x61, 0x65, 0x69,
+    0x6B, 0x03, 0x7B, 0x0A, 0xC0, 0x04, 0x26, 0x80, 0x0D, 0xA2, 0x01, 0x67, 0xA9, 0x7A, 0x01, 0x6F,
+    0x7C, 0x02, 0x61, 0x73, 0x08, 0xB5, 0x98, 0x01, 0x63, 0x7A, 0x83, 0x00, 0x11, 0x2E, 0x68, 0x69,
+    0x12, 0x74, 0x7D, 0x10, 0x61, 0x62, 0x63, 0x64, 0x66, 0x67, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x71,
+    0x73, 0x74, 0x76, 0x7A, 0xBF, 0x8C, 0xBB, 0x37, 0xBF, 0x98, 0xBF, 0xA7, 0xBF, 0xAE, 0xBF, 0xBD,
+    0x0C, 0xBF, 0xC5, 0xBF, 0xC8, 0xBF, 0xD9, 0x35, 0x64, 0xA9, 0x21, 0x77, 0xAA, 0x70, 0x0D, 0x82,
+    0x02, 0x81, 0x6C, 0x74, 0x06, 0x00, 0x01, 0x61, 0x79, 0x01, 0x77, 0x03, 0x86, 0x00, 0x21, 0x61,
+    0x63, 0x67, 0x6C, 0x6E, 0x74, 0x07, 0x06, 0x06, 0x06, 0x38, 0x38, 0x01, 0x6C, 0x0E, 0x81, 0x1A,
+    0x42, 0x61, 0x07, 0x80, 0x00, 0x32, 0x01, 0x68, 0x7D, 0x82, 0x01, 0x91, 0x6E, 0x73, 0x75, 0x7D,
+    0x01, 0x75, 0xC0, 0x04, 0x0C, 0x83, 0x00, 0xB1, 0x71, 0x75, 0x77, 0x7B, 0x1A, 0x07, 0x85, 0x00,
+    0x11, 0x61, 0x65, 0x66, 0x69, 0x6F, 0xBF, 0xCB, 0xBF, 0xCE, 0xBF, 0xDD, 0x6B, 0x77, 0x01, 0x6E,
+    0xB0, 0x77, 0x80, 0x05, 0x12, 0x01, 0x6C, 0x7D, 0x01, 0x6C, 0x7D, 0x81, 0x01, 0x41, 0x65, 0x7D,
+    0x02, 0x64, 0x6E, 0x03, 0x7B, 0x83, 0x00, 0xD1, 0x65, 0x69, 0x6F, 0xC0, 0x09, 0xA7, 0x69, 0x7B,
+    0x80, 0x07, 0xC3, 0x01, 0x2E, 0x0B, 0x02, 0x64, 0x72, 0x7D, 0xBE, 0x24, 0x01, 0x65, 0x7A, 0x01,
+    0x64, 0x7D, 0x80, 0x0F, 0x93, 0x01, 0x6F, 0x7D, 0x01, 0x74, 0x7D, 0x02, 0x61, 0x6F, 0xA3, 0x01,
+    0x7D, 0x01, 0x73, 0xA9, 0x0E, 0x01, 0x63, 0x0C, 0x04, 0x65, 0x69, 0x6F, 0x75, 0x79, 0x7D, 0x07,
+    0x0C, 0x80, 0x04, 0x32, 0x81, 0x00, 0x61, 0x7A, 0x7D, 0x02, 0x67, 0x69, 0x08, 0x7B, 0x03, 0x65,
+    0x69, 0x6D, 0x29, 0x0A, 0x06, 0x81, 0x01, 0x41, 0x74, 0x23, 0x03, 0x61, 0x69, 0x6F, 0x7B, 0x19,
+    0xB3, 0xB1, 0x02, 0x69, 0x79, 0xC0, 0x0B, 0xD9, 0x08, 0x01, 0x68, 0x79, 0x01, 0x70, 0x7D, 0x04,
+    0x2E, 0x65, 0x6F, 0x74, 0x08, 0x33, 0x7D, 0x00, 0x02, 0x6E, 0x74, 0xC0, 0x07, 0x9D, 0x13, 0x0F,
+    0x2E, 0x61, 0x62, 0x63, 0x66, 0x67, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x0C,
+    0xBF, 0xA0, 0xBF, 0xAC, 0x21, 0x04, 0xBF, 0xB9, 0xA9, 0x64, 0xBF, 0xCA, 0xC0, 0x07, 0x9D, 0xBF,
+    0xCF, 0xBF, 0xDB, 0x70, 0xA1, 0xBC, 0x79, 0x04, 0x02, 0x61, 0x69, 0x06, 0x07, 0x02, 0x6E, 0x74,
+    0x35, 0x06, 0x85, 0x00, 0xD1, 0x61, 0x68, 0x69, 0x6C, 0x72, 0xB7, 0xEA, 0x76, 0x7B, 0x03, 0x07,
+    0x83, 0x07, 0xC3, 0x63, 0x65, 0x69, 0x03, 0x12, 0xA9, 0xDB, 0x01, 0x65, 0x16, 0x02, 0x67, 0x6E,
+    0x02, 0x7D, 0x83, 0x00, 0x11, 0x61, 0x6E, 0x72, 0x06, 0x0B, 0xAB, 0x2E, 0x01, 0x79, 0xC0, 0x05,
+    0xB4, 0x81, 0x02, 0x81, 0x6C, 0x7B, 0x01, 0x69, 0x7B, 0x01, 0x73, 0xC0, 0x0A, 0xE0, 0x02, 0x65,
+    0x73, 0x7B, 0x0B, 0x81, 0x01, 0x11, 0x72, 0xBB, 0x89, 0x86, 0x00, 0x01, 0x61, 0x65, 0x68, 0x69,
+    0x72, 0x75, 0xBF, 0xD4, 0xBF, 0xD9, 0x6D, 0x75, 0x0D, 0x7A, 0x02, 0x68, 0x69, 0x0B, 0x01, 0x02,
+    0x6E, 0x70, 0x01, 0x14, 0x80, 0x1A, 0x22, 0x01, 0x2E, 0x7D, 0x01, 0x61, 0x7D, 0x01, 0x69, 0x7D,
+    0x02, 0x2E, 0x69, 0x07, 0xB2, 0x11, 0x04, 0x61, 0x62, 0x69, 0x6E, 0x05, 0x77, 0x08, 0x7A, 0x80,
+    0x09, 0xF2, 0x01, 0x72, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x6B, 0x7D, 0x81, 0x00, 0xF1, 0x72, 0x0A,
+    0x02, 0x73, 0x74, 0x0B, 0xC0, 0x08, 0x99, 0x0C, 0x61, 0x62, 0x63, 0x65, 0x66, 0x69, 0x6D, 0x6E,
+    0x6F, 0x70, 0x73, 0x74, 0x02, 0xC0, 0x10, 0x51, 0xBF, 0xC3, 0xBF, 0xC8, 0x00, 0xC0, 0x09, 0x3E,
+    0xBF, 0xDF, 0x71, 0x74, 0x04, 0x79, 0x18, 0x80, 0x0D, 0xD2, 0x02, 0x6E, 0x74, 0x07, 0x7D, 0x01,
+    0x65, 0x7B, 0x80, 0x10, 0xC3, 0x01, 0x69, 0x7D, 0x01, 0x6D, 0x7D, 0x01, 0x61, 0x7D, 0x01, 0x79,
+    0x27, 0x82, 0x1A, 0x02, 0x65, 0x74, 0x07, 0x7D, 0x86, 0x00, 0x71, 0x61, 0x62, 0x67, 0x6D, 0x6E,
+    0x73, 0x04, 0x04, 0x73, 0x19, 0xC0, 0x0D, 0xC7, 0x79, 0x17, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
+    0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x79, 0xBC, 0x45, 0xBC, 0x64, 0xBC, 0x7B, 0xBC, 0x98, 0xBD, 0x31, 0xBD, 0x51, 0xBD, 0x5B, 0x3B,
+    0xBD, 0xDA, 0x04, 0xBE, 0x0D, 0xBE, 0x45, 0xBE, 0x6C, 0xBE, 0x77, 0xBE, 0xE6, 0xBF, 0x19, 0x1F,
+    0xBF, 0x27, 0xBF, 0x60, 0xBF, 0xAE, 0xBF, 0xD6, 0xA5, 0x4E, 0x6F, 0x01, 0x69, 0xC0, 0x0C, 0xFF,
+    0x03, 0x61, 0x68, 0x6C, 0x10, 0x7B, 0x05, 0x02, 0x69, 0x6E, 0x28, 0x08, 0x01, 0x70, 0xBA, 0xAB,
+    0x02, 0x67, 0x6E, 0x01, 0x02, 0x05, 0x61, 0x64, 0x69, 0x6C, 0x74, 0x77, 0x04, 0x7B, 0x26, 0xC0,
+    0x05, 0xF8, 0x03, 0x61, 0x73, 0x7A, 0x08, 0x09, 0x0A, 0x80, 0x09, 0x42, 0x01, 0x63, 0x7D, 0x01,
+    0x73, 0x7D, 0x03, 0x2E, 0x69, 0x75, 0x12, 0x70, 0x7D, 0x80, 0x19, 0xD3, 0x01, 0x6F, 0x7D, 0x01,
+    0x72, 0x7D, 0x81, 0x00, 0x01, 0x68, 0x7D, 0x80, 0x0F, 0x12, 0x01, 0x6E, 0x7D, 0x01, 0x69, 0x7D,
+    0x01, 0x65, 0x36, 0x02, 0x6E, 0x7A, 0x7D, 0x02, 0x04, 0x67, 0x69, 0x6C, 0x76, 0x75, 0x7B, 0xC0,
+    0x05, 0xF8, 0x0A, 0x03, 0x63, 0x65, 0x74, 0x19, 0x00, 0x14, 0x02, 0x73, 0x7A, 0x01, 0xAF, 0xF2,
+    0x03, 0x65, 0x68, 0x69, 0x08, 0x11, 0x7A, 0x8B, 0x00, 0x71, 0x62, 0x63, 0x67, 0x68, 0x69, 0x6C,
+    0x6E, 0x70, 0x72, 0x73, 0x74, 0x13, 0xBF, 0x89, 0xBF, 0x90, 0x13, 0xC0, 0x07, 0x9D, 0xBF, 0x9E,
+    0xBF, 0xBB, 0xBF, 0xCB, 0x61, 0x6C, 0x79, 0x80, 0x0F, 0xC2, 0x01, 0x74, 0x7D, 0x03, 0x6C, 0x6E,
+    0x76, 0x07, 0xA9, 0xB0, 0x00, 0x82, 0x00, 0x02, 0x61, 0x69, 0x75, 0x78, 0x01, 0x6E, 0xA1, 0xAE,
+    0x81, 0x07, 0xB1, 0x69, 0x7C, 0x80, 0x19, 0xB2, 0x01, 0x63, 0x7D, 0x04, 0x61, 0x63, 0x65, 0x6F,
+    0x08, 0x75, 0x01, 0x7D, 0x83, 0x00, 0xD1, 0x2E, 0x69, 0x79, 0x04, 0x77, 0xB2, 0x55, 0x80, 0x19,
+    0x92, 0x01, 0x6E, 0x7D, 0x01, 0x61, 0x7D, 0x81, 0x01, 0x91, 0x72, 0x7D, 0x02, 0x6F, 0x74, 0x28,
+    0x00, 0x80, 0x08, 0xD2, 0x81, 0x01, 0x91, 0x6F, 0x7D, 0x81, 0x00, 0x61, 0x63, 0x09, 0x81, 0x01,
+    0x41, 0x75, 0x16, 0x81, 0x01, 0x51, 0x65, 0x00, 0x87, 0x00, 0x71, 0x2E, 0x61, 0x64, 0x65, 0x69,
+    0x73, 0x74, 0x12, 0x71, 0x15, 0x04, 0x00, 0x76, 0x7B, 0x01, 0x61, 0x07, 0x01, 0x73, 0x7D, 0x81,
+    0x00, 0xD1, 0x74, 0xA0, 0xE3, 0x81, 0x00, 0xB1, 0x6C, 0x0A, 0x02, 0x63, 0x65, 0x08, 0x02, 0x82,
+    0x00, 0x51, 0x69, 0x79, 0x7B, 0x01, 0x04, 0x61, 0x65, 0x68, 0x72, 0x6F, 0x0E, 0xB7, 0xA4, 0x79,
+    0x0B, 0x2E, 0x64, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x76, 0x04, 0xBF, 0x94, 0xBF,
+    0xA7, 0xBF, 0xAC, 0xBF, 0xB4, 0xBF, 0xC8, 0x1D, 0xBF, 0xDC, 0xBF, 0xDF, 0x76, 0x05, 0x80, 0x19,
+    0x63, 0x81, 0x00, 0x61, 0x62, 0x7D, 0x02, 0x61, 0x67, 0x7B, 0x00, 0x01, 0x61, 0x0C, 0x03, 0x61,
+    0x65, 0x74, 0x0C, 0xB1, 0xBB, 0x7D, 0x01, 0x67, 0xC0, 0x08, 0xDC, 0x01, 0x69, 0xC0, 0x04, 0xB6,
+    0x01, 0x6C, 0x7B, 0x82, 0x00, 0x51, 0x61, 0x69, 0x73, 0x7D, 0x02, 0x69, 0x6C, 0x64, 0x79, 0x82,
+    0x00, 0x51, 0x69, 0x79, 0x09, 0x07, 0x01, 0x6C, 0x79, 0x80, 0x11, 0x32, 0x01, 0x2E, 0x7D, 0x01,
+    0x73, 0x7D, 0x80, 0x19, 0x13, 0x01, 0x74, 0x7D, 0x02, 0x72, 0x73, 0x7A, 0x7D, 0x01, 0x65, 0x7B,
+    0x81, 0x00, 0x51, 0x74, 0x7D, 0x07, 0x61, 0x64, 0x65, 0x67, 0x69, 0x74, 0x75, 0x00, 0x0C, 0x31,
+    0x61, 0x6A, 0x00, 0x7B, 0x01, 0x2E, 0x00, 0x01, 0x72, 0x7D, 0x01, 0x79, 0x07, 0x02, 0x69, 0x72,
+    0x00, 0x7D, 0x83, 0x00, 0x21, 0x65, 0x6C, 0x74, 0x75, 0x09, 0x7B, 0x01, 0x68, 0x04, 0x0A, 0x2E,
+    0x61, 0x64, 0x67, 0x6C, 0x6E, 0x6F, 0x73, 0x74, 0x7A, 0x08, 0x01, 0xBF, 0x88, 0x00, 0xBF, 0xAC,
+    0xBF, 0xD7, 0xC0, 0x07, 0x57, 0x74, 0x7D, 0x12, 0x80, 0x18, 0xF2, 0x02, 0x62, 0x72, 0x7D, 0xB5,
+    0x71, 0x81, 0x00, 0x11, 0x61, 0x7A, 0x01, 0x6E, 0x03, 0x83, 0x00, 0x02, 0x61, 0x69, 0x6F, 0x05,
+    0x7D, 0x05, 0x81, 0x18, 0xC3, 0x69, 0xC0, 0x0B, 0xD9, 0x01, 0x74, 0x79, 0x81, 0x00, 0x01, 0x61,
+    0x7D, 0x01, 0x72, 0x7B, 0x80, 0x13, 0xB2, 0x01, 0x73, 0xC0, 0x10, 0x21, 0x01, 0x61, 0x7B, 0x01,
+    0x6C, 0x7D, 0x81, 0x07, 0xB1, 0x65, 0x09, 0x01, 0x73, 0x7B, 0x80, 0x02, 0x62, 0x02, 0x63, 0x73,
+    0x7D, 0x1A, 0x01, 0x65, 0x7B, 0x02, 0x74, 0x79, 0x09, 0xC0, 0x06, 0x58, 0x03, 0x61, 0x73, 0x7A,
+    0x11, 0xB0, 0xBD, 0x01, 0x80, 0x18, 0xA2, 0x01, 0x6E, 0x7D, 0x80, 0x09, 0x22, 0x04, 0x63, 0x65,
+    0x6C, 0x73, 0xC0, 0x06, 0xFE, 0x7A, 0x1C, 0x7D, 0x05, 0x65, 0x67, 0x69, 0x6F, 0x79, 0xBF, 0xDD,
+    0x1B, 0x64, 0x75, 0xC0, 0x0D, 0xDA, 0x80, 0x18, 0x82, 0x01, 0x73, 0x7D, 0x01, 0x69, 0x7D, 0x01,
+    0x6E, 0x7D, 0x82, 0x01, 0x91, 0x61, 0x6F, 0xA2, 0x98, 0x7D, 0x82, 0x01, 0x11, 0x65, 0x70, 0xC0,
+    0x0A, 0x8C, 0x01, 0x80, 0x18, 0x62, 0x01, 0x74, 0x7D, 0x81, 0x01, 0xF1, 0x65, 0x7D, 0x01, 0x68,
+    0x7B, 0x01, 0x6E, 0xAD, 0x21, 0x81, 0x01, 0x51, 0x69, 0x7C, 0x02, 0x66, 0x73, 0x07, 0x7B, 0x8E,
+    0x00, 0x71, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0xBF, 0x72, 0xBF, 0x75, 0xBF, 0x80, 0x23, 0xBF, 0x88, 0x04, 0xBF, 0x93, 0xC0, 0x0B, 0x62, 0xBF,
+    0xB9, 0xBF, 0xD3, 0xBF, 0xDB, 0x6F, 0x7B, 0x10, 0x81, 0x02, 0x21, 0x62, 0x09, 0x02, 0x61, 0x69,
+    0x7B, 0x0F, 0x01, 0x72, 0x7B, 0x01, 0x73, 0x1C, 0x01, 0x61, 0x7D, 0x85, 0x00, 0x21, 0x61, 0x65,
+    0x6E, 0x72, 0x73, 0x00, 0xC0, 0x0C, 0xB6, 0xC0, 0x0B, 0xAA, 0x07, 0x02, 0x01, 0x74, 0x3D, 0x01,
+    0x69, 0x7D, 0x04, 0x72, 0x73, 0x75, 0x76, 0x32, 0x7D, 0xC0, 0x0B, 0x12, 0x0F, 0x87, 0x00, 0x02,
+    0x61, 0x65, 0x68, 0x69, 0x6F, 0x74, 0x79, 0xBF, 0xD5, 0xC0, 0x0D, 0x1E, 0xBF, 0xDB, 0xBF, 0xDE,
+    0x75, 0x39, 0x12, 0x80, 0x18, 0x42, 0x01, 0x6B, 0x7D, 0x01, 0x63, 0x7D, 0x81, 0x00, 0x51, 0x61,
+    0x7D, 0x82, 0x00, 0x03, 0x68, 0x69, 0x7B, 0x07, 0x01, 0x6F, 0x10, 0x01, 0x72, 0x7D, 0x80, 0x18,
+    0x22, 0x81, 0x02, 0xB1, 0x75, 0x7D, 0x81, 0x00, 0xC1, 0x69, 0x7B, 0x02, 0x61, 0x74, 0xC0, 0x10,
+    0x46, 0x7B, 0x86, 0x00, 0x71, 0x64, 0x6C, 0x6D, 0x6E, 0x70, 0x75, 0x69, 0x79, 0x0C, 0x17, 0x04,
+    0x05, 0x12, 0x61, 0x62, 0x63, 0x65, 0x66, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72,
+    0x73, 0x74, 0x75, 0x77, 0xBD, 0x26, 0xBD, 0x54, 0x25, 0xBD, 0xDF, 0x1F, 0x13, 0xBE, 0x7D, 0x04,
+    0x1F, 0xBE, 0xA0, 0xBE, 0xA8, 0xBF, 0x4E, 0xBF, 0xAC, 0xC0, 0x10, 0x1E, 0xBF, 0xD0, 0x04, 0x71,
+    0x04, 0x81, 0x07, 0xC3, 0x75, 0x03, 0x03, 0x2E, 0x61, 0x74, 0x04, 0x05, 0x07, 0x01, 0x72, 0xAC,
+    0x39, 0x01, 0x65, 0x7C, 0x81, 0x00, 0xB1, 0x61, 0x02, 0x02, 0x69, 0x74, 0x7B, 0x04, 0x01, 0x69,
+    0x1A, 0x01, 0x69, 0x1C, 0x83, 0x00, 0x21, 0x63, 0x69, 0x6B, 0x7D, 0xC0, 0x04, 0x6B, 0x0B, 0x01,
+    0x2E, 0x38, 0x01, 0x73, 0x7D, 0x81, 0x02, 0x81, 0x68, 0x7D, 0x05, 0x63, 0x65, 0x69, 0x6C, 0x6D,
+    0x7B, 0x04, 0x0A, 0x00, 0x07, 0x82, 0x00, 0x51, 0x63, 0x74, 0x00, 0x2C, 0x01, 0x6D, 0xA1, 0x9D,
+    0x82, 0x00, 0x21, 0x61, 0x6F, 0x3C, 0x7C, 0x82, 0x00, 0x21, 0x73, 0x74, 0xC0, 0x08, 0x99, 0x0C,
+    0x8C, 0x00, 0x71, 0x62, 0x63, 0x67, 0x6B, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x75, 0x76, 0xBF,
+    0xA1, 0xBF, 0xA6, 0xBF, 0xB1, 0x00, 0xBF, 0xB9, 0xBF, 0xBE, 0xBF, 0xC4, 0xBF, 0xDA, 0x65, 0x70,
+    0x77, 0x15, 0x01, 0x73, 0xA5, 0x98, 0x80, 0x17, 0xF3, 0x01, 0x74, 0x7D, 0x02, 0x6F, 0x73, 0x07,
+    0x7D, 0x02, 0x6C, 0x73, 0x07, 0x06, 0x03, 0x61, 0x65, 0x69, 0x06, 0x76, 0x7B, 0x02, 0x6E, 0x74,
+    0x0E, 0x05, 0x01, 0x75, 0xB3, 0xEE, 0x07, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x75, 0xC0, 0x04,
+    0x1B, 0xBF, 0xDC, 0x70, 0x77, 0x7C, 0x0D, 0x0D, 0x02, 0x69, 0x6E, 0x03, 0x07, 0x81, 0x00, 0x11,
+    0x73, 0xC0, 0x0B, 0x97, 0x01, 0x6B, 0x0D, 0x01, 0x63, 0x7D, 0x05, 0x62, 0x65, 0x66, 0x74, 0x7A,
+    0x00, 0x7D, 0xA2, 0x2C, 0x0D, 0x06, 0x01, 0x68, 0xC0, 0x10, 0x51, 0x02, 0x63, 0x72, 0x07, 0x00,
+    0x06, 0x61, 0x65, 0x69, 0x74, 0x75, 0x77, 0xBF, 0xD8, 0xBF, 0xDD, 0x6A, 0x76, 0x7B, 0xC0, 0x0D,
+    0x3F, 0x01, 0x6B, 0x01, 0x01, 0x63, 0x7D, 0x82, 0x01, 0x91, 0x61, 0x75, 0x7D, 0x0A, 0x81, 0x01,
+    0x91, 0x6B, 0x08, 0x01, 0x76, 0x09, 0x81, 0x00, 0xB1, 0x69, 0x7D, 0x01, 0x74, 0x7B, 0x02, 0x61,
+    0x65, 0x7D, 0x08, 0x02, 0x61, 0x69, 0x05, 0xC0, 0x0F, 0xED, 0x02, 0x69, 0x6F, 0x02, 0x05, 0x81,
+    0x00, 0x71, 0x65, 0x04, 0x02, 0x62, 0x72, 0x0F, 0x03, 0x84, 0x00, 0x11, 0x61, 0x65, 0x69, 0x72,
+    0x7B, 0x12, 0xC0, 0x0C, 0x59, 0x00, 0x80, 0x17, 0xD2, 0x01, 0x69, 0x7D, 0x85, 0x00, 0x71, 0x2E,
+    0x6B, 0x70, 0x74, 0x77, 0x13, 0x7D, 0x04, 0x13, 0x04, 0x01, 0x69, 0xB9, 0x8C, 0x81, 0x00, 0xB1,
+    0x65, 0x07, 0x11, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x76, 0x77, 0x13, 0xC0, 0x0C, 0x6D, 0xBF, 0xA5, 0xBF, 0xAC, 0x13, 0xBF, 0xBC, 0xBF,
+    0xC1, 0xBF, 0xC8, 0xBF, 0xCD, 0x0C, 0x23, 0x10, 0xBF, 0xD7, 0x6A, 0x77, 0x7B, 0x05, 0x01, 0x65,
+    0xB6, 0xC8, 0x01, 0x74, 0x7C, 0x01, 0x69, 0x7D, 0x01, 0x6E, 0x7D, 0x81, 0x00, 0x41, 0x69, 0x7D,
+    0x01, 0x62, 0x03, 0x81, 0x17, 0x92, 0x73, 0x09, 0x01, 0x65, 0x7B, 0x02, 0x65, 0x69, 0x07, 0x06,
+    0x03, 0x6C, 0x6E, 0x72, 0x06, 0x78, 0x7B, 0x02, 0x61, 0x6F, 0x02, 0x0E, 0x03, 0x62, 0x6E, 0x74,
+    0x06, 0x0E, 0x07, 0x01, 0x76, 0x0B, 0x01, 0x72, 0x0E, 0x02, 0x68, 0x70, 0x02, 0x7D, 0x81, 0x00,
+    0x11, 0x6D, 0x03, 0x09, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x73, 0x75, 0x79, 0xBF, 0xCD, 0xBF,
+    0xDD, 0x64, 0x69, 0xA7, 0xC4, 0x70, 0x76, 0x7B, 0x12, 0x81, 0x00, 0x61, 0x62, 0x11, 0x82, 0x17,
+    0x63, 0x61, 0x65, 0x7B, 0x00, 0x81, 0x00, 0xF1, 0x2E, 0xB1, 0xA5, 0x82, 0x0C, 0xB2, 0x6E, 0x70,
+    0x7A, 0x05, 0x02, 0x61, 0x6C, 0x01, 0x05, 0x81, 0x00, 0xB1, 0x69, 0x02, 0x81, 0x01, 0x91, 0x63,
+    0xC0, 0x09, 0x57, 0x01, 0x69, 0x79, 0x81, 0x00, 0x11, 0x69, 0xC0, 0x10, 0x36, 0x82, 0x00, 0x11,
+    0x65, 0x67, 0x29, 0x00, 0x02, 0x2E, 0x74, 0x08, 0xC0, 0x04, 0x06, 0x84, 0x00, 0x21, 0x68, 0x69,
+    0x6F, 0x72, 0x03, 0xC0, 0x11, 0x87, 0xC0, 0x0C, 0x6D, 0x01, 0x0C, 0x61, 0x62, 0x64, 0x65, 0x66,
+    0x67, 0x6B, 0x6D, 0x6E, 0x6F, 0x73, 0x74, 0xBF, 0xC1, 0xBF, 0xC8, 0xBF, 0xCD, 0x39, 0xBF, 0xD9,
+    0xC0, 0x0A, 0x66, 0x00, 0xBF, 0xDC, 0x63, 0x05, 0x6A, 0x71, 0x02, 0x72, 0x74, 0xC0, 0x13, 0xC3,
+    0x06, 0x01, 0x75, 0xA5, 0xB2, 0x84, 0x0E, 0xD2, 0x65, 0x69, 0x6C, 0x72, 0x75, 0xC0, 0x0D, 0x92,
+    0x0D, 0x7C, 0x81, 0x00, 0x02, 0x65, 0xAA, 0x13, 0x81, 0x00, 0x61, 0x74, 0x0B, 0x81, 0x01, 0x21,
+    0x65, 0x7B, 0x02, 0x61, 0x76, 0xC0, 0x16, 0x95, 0x00, 0x82, 0x00, 0x03, 0x65, 0x69, 0x00, 0x79,
+    0x81, 0x00, 0x61, 0x65, 0x01, 0x01, 0x6C, 0x7B, 0x80, 0x17, 0x03, 0x01, 0x73, 0x7D, 0x01, 0x6F,
+    0x7D, 0x01, 0x72, 0x7D, 0x02, 0x65, 0x6C, 0x7D, 0x07, 0x81, 0x00, 0x01, 0x65, 0x0B, 0x01, 0x73,
+    0x3F, 0x80, 0x0F, 0x32, 0x01, 0x73, 0x08, 0x01, 0x69, 0x7D, 0x01, 0x67, 0x7D, 0x02, 0x69, 0x6F,
+    0x74, 0x7D, 0x01, 0x6F, 0xC0, 0x11, 0xF6, 0x01, 0x6E, 0x7B, 0x80, 0x09, 0xA2, 0x01, 0x74, 0x7D,
+    0x03, 0x63, 0x73, 0x7A, 0x0C, 0x7D, 0xAC, 0xD9, 0x05, 0x61, 0x65, 0x69, 0x6F, 0x79, 0xA9, 0xA4,
+    0x6F, 0x78, 0x05, 0x01, 0x01, 0x67, 0x00, 0x01, 0x71, 0x14, 0x01, 0x6F, 0xC0, 0x06, 0x7E, 0x82,
+    0x01, 0x81, 0x73, 0x7A, 0x7B, 0x07, 0x83, 0x00, 0xB1, 0x61, 0x65, 0x69, 0x6E, 0x71, 0x79, 0x80,
+    0x16, 0x93, 0x80, 0x09, 0xC2, 0x01, 0x2E, 0x7D, 0x02, 0x69, 0x79, 0x77, 0x7D, 0x01, 0x6C, 0x7B,
+    0x81, 0x00, 0x01, 0x6F, 0x7D, 0x02, 0x62, 0x72, 0x09, 0xC0, 0x0E, 0xE5, 0x01, 0x61, 0x79, 0x03,
+    0x63, 0x65, 0x74, 0x04, 0x00, 0x09, 0x81, 0x00, 0x71, 0x6E, 0x0C, 0x80, 0x16, 0x72, 0x01, 0x62,
+    0x0E, 0x02, 0x6C, 0x6D, 0x7A, 0x7D, 0x01, 0x65, 0x7B, 0x01, 0x6C, 0x11, 0x10, 0x62, 0x63, 0x64,
+    0x65, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0xBF, 0x59, 0xBF,
+    0x68, 0xC0, 0x14, 0xB8, 0x0C, 0xBF, 0x6D, 0xBF, 0x72, 0xBF, 0x81, 0xBF, 0x9C, 0xBF, 0xBA, 0xBF,
+    0xD4, 0x60, 0x63, 0x2A, 0x6A, 0x7A, 0x7D, 0x01, 0x65, 0xC0, 0x04, 0x50, 0x82, 0x01, 0xB2, 0x69,
+    0x72, 0x00, 0x7B, 0x81, 0x00, 0x11, 0x75, 0x00, 0x02, 0x62, 0x74, 0x02, 0xBC, 0xB9, 0x81, 0x00,
+    0xB1, 0x65, 0xA3, 0x2E, 0x81, 0x00, 0x21, 0x73, 0x34, 0x02, 0x64, 0x67, 0x1E, 0x0B, 0x81, 0x00,
+    0xF1, 0x6F, 0x23, 0x01, 0x61, 0xC0, 0x08, 0x07, 0x89, 0x07, 0xC3, 0x61, 0x63, 0x65, 0x69, 0x6C,
+    0x6D, 0x6F, 0x70, 0x74, 0x60, 0x66, 0x6C, 0x71, 0x12, 0x76, 0xC0, 0x0D, 0x89, 0xC0, 0x0B, 0xB3,
+    0x7B, 0x01, 0x72, 0xC0, 0x05, 0x0F, 0x02, 0x65, 0x67, 0x06, 0x34, 0x85, 0x01, 0x91, 0x62, 0x65,
+    0x66, 0x6E, 0x70, 0x07, 0x2E, 0x17, 0x7B, 0x00, 0x01, 0x70, 0x1E, 0x01, 0x6C, 0xC0, 0x05, 0x52,
+    0x01, 0x6C, 0x7B, 0x02, 0x65, 0x6F, 0x75, 0x7D, 0x01, 0x6D, 0xC0, 0x08, 0x99, 0x86, 0x00, 0x11,
+    0x61, 0x65, 0x69, 0x72, 0x73, 0x75, 0xA6, 0x71, 0xBF, 0xD4, 0xBF, 0xDE, 0x76, 0x05, 0x7B, 0x01,
+    0x66, 0x15, 0x02, 0x6E, 0x74, 0x06, 0xC0, 0x10, 0x62, 0x82, 0x00, 0x51, 0x65, 0x69, 0x0E, 0x07,
+    0x80, 0x10, 0x82, 0x09, 0x61, 0x64, 0x65, 0x66, 0x69, 0x6D, 0x6E, 0x6F, 0x74, 0x0E, 0x05, 0x1D,
+    0x6C, 0x6F, 0x76, 0x7D, 0x06, 0xC0, 0x10, 0x51, 0x02, 0x6D, 0x70, 0x00, 0x00, 0x81, 0x00, 0x01,
+    0x61, 0x06, 0x19, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D,
+    0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0xBC, 0x4E, 0xC0, 0x17,
+    0x9E, 0xBC, 0x94, 0xBC, 0xCE, 0xBD, 0x40, 0xBD, 0x79, 0xBD, 0xB1, 0xBD, 0xCC, 0xBE, 0x18, 0x0D,
+    0xBE, 0x43, 0xBE, 0x50, 0xBE, 0x5B, 0xBE, 0x67, 0xBF, 0x1A, 0xBF, 0x4A, 0x0D, 0xBF, 0x51, 0xBF,
+    0x76, 0xBF, 0xBB, 0x61, 0xC0, 0x16, 0xDE, 0xA0, 0x59, 0x76, 0x7B, 0x01, 0x73, 0xAB, 0x3E, 0x01,
+    0x65, 0x7C, 0x02, 0x65, 0x74, 0x00, 0x3D, 0x85, 0x00, 0x01, 0x64, 0x6C, 0x72, 0x73, 0x74, 0x0A,
+    0x78, 0xAC, 0x3E, 0x7B, 0x2C, 0x02, 0x62, 0x72, 0xC0, 0x0B, 0xB0, 0x07, 0x81, 0x00, 0x21, 0x67,
+    0x02, 0x81, 0x00, 0x11, 0x6E, 0x7B, 0x01, 0x67, 0xC0, 0x10, 0x97, 0x01, 0x69, 0x7B, 0x06, 0x61,
+    0x65, 0x69, 0x6C, 0x72, 0x75, 0x67, 0xC0, 0x06, 0xF6, 0x73, 0x7D, 0x06, 0x3C, 0x82, 0x00, 0x61,
+    0x61, 0x65, 0xC0, 0x0B, 0xAD, 0xC0, 0x0D, 0x1E, 0x02, 0x66, 0x6C, 0x11, 0x03, 0x01, 0x61, 0xA0,
+    0x85, 0x01, 0x64, 0x03, 0x01, 0x69, 0xC0, 0x0E, 0x2C, 0x02, 0x63, 0x74, 0x01, 0x7B, 0x03, 0x61,
+    0x65, 0x69, 0x7B, 0x11, 0xB2, 0x06, 0x01, 0x6F, 0xAF, 0xCA, 0x02, 0x6C, 0x72, 0x22, 0x31, 0x08,
+    0x65, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x74, 0x75, 0x0D, 0xBF, 0xCE, 0xBF, 0xD9, 0xBF, 0xDE, 0x62,
+    0x6F, 0x77, 0x7B, 0x01, 0x65, 0xC0, 0x09, 0x3E, 0x01, 0x6C, 0xC0, 0x04, 0x93, 0x01, 0x6C, 0x7B,
+    0x01, 0x63, 0x1E, 0x01, 0x69, 0x7D, 0x03, 0x63, 0x6F, 0x74, 0x01, 0x0A, 0x7D, 0x81, 0x15, 0xF2,
+    0x72, 0x11, 0x02, 0x2E, 0x73, 0x02, 0x02, 0x01, 0x74, 0x7B, 0x01, 0x63, 0x7D, 0x05, 0x64, 0x65,
+    0x69, 0x6F, 0x75, 0xBF, 0xD6, 0x60, 0x69, 0x70, 0x7D, 0x01, 0x67, 0x07, 0x80, 0x11, 0x71, 0x01,
+    0x74, 0x7D, 0x81, 0x00, 0x41, 0x73, 0x7D, 0x05, 0x6C, 0x6E, 0x72, 0x74, 0x76, 0x03, 0x72, 0x7B,
+    0xC0, 0x11, 0x5B, 0x06, 0x02, 0x65, 0x74, 0x02, 0x0B, 0x81, 0x00, 0x21, 0x74, 0x7B, 0x01, 0x69,
+    0x7B, 0x02, 0x69, 0x6F, 0xC0, 0x0A, 0xD5, 0x03, 0x02, 0x72, 0x74, 0xB1, 0x26, 0x79, 0x83, 0x00,
+    0x11, 0x6E, 0x6F, 0x72, 0x31, 0x07, 0x03, 0x80, 0x15, 0xA2, 0x03, 0x65, 0x73, 0x74, 0x06, 0x7D,
+    0x01, 0x81, 0x00, 0x51, 0x79, 0xC0, 0x17, 0x76, 0x01, 0x7A, 0x0C, 0x01, 0x69, 0x7D, 0x01, 0x6F,
+    0x03, 0x81, 0x00, 0x71, 0x6E, 0x13, 0x08, 0x61, 0x65, 0x69, 0x6C, 0x6E, 0x72, 0x75, 0x79, 0xBF,
+    0xD2, 0xBF, 0xD8, 0x64, 0x6B, 0x75, 0x78, 0x2C, 0x7B, 0x81, 0x00, 0x12, 0x61, 0xB3, 0xB0, 0x01,
+    0x73, 0x0A, 0x01, 0x65, 0x7D, 0x01, 0x65, 0xC0, 0x10, 0x51, 0x01, 0x65, 0x1A, 0x02, 0x67, 0x74,
+    0x06, 0xC0, 0x04, 0x26, 0x03, 0x6D, 0x6F, 0x74, 0x07, 0x1D, 0xAA, 0x1D, 0x88, 0x01, 0x91, 0x63,
+    0x64, 0x66, 0x67, 0x6C, 0x6E, 0x73, 0x74, 0x66, 0x69, 0xA9, 0x55, 0x00, 0x6E, 0x71, 0x78, 0x69,
+    0x02, 0x6E, 0x73, 0x06, 0xC0, 0x03, 0x35, 0x82, 0x00, 0xD1, 0x65, 0x69, 0x79, 0x19, 0x82, 0x00,
+    0x11, 0x6E, 0x73, 0x03, 0xB9, 0x87, 0x81, 0x01, 0x91, 0x65, 0x14, 0x01, 0x72, 0xA1, 0x01, 0x01,
+    0x65, 0x7C, 0x02, 0x63, 0x74, 0x06, 0x7D, 0x03, 0x72, 0x73, 0x74, 0x01, 0x7B, 0x06, 0x80, 0x15,
+    0x73, 0x01, 0x6F, 0x7D, 0x01, 0x70, 0x7D, 0x01, 0x6F, 0x7D, 0x02, 0x2E, 0x68, 0x07, 0x01, 0x02,
+    0x65, 0x69, 0x07, 0xC0, 0x13, 0xC3, 0x8B, 0x01, 0x91, 0x61, 0x63, 0x64, 0x66, 0x67, 0x6C, 0x6E,
+    0x6F, 0x73, 0x74, 0x76, 0x06, 0xC0, 0x18, 0x75, 0x36, 0x38, 0x71, 0x07, 0xA4, 0xFF, 0x07, 0x74,
+    0x79, 0x07, 0x01, 0x69, 0x24, 0x80, 0x15, 0x43, 0x01, 0x6D, 0x7D, 0x01, 0x6F, 0x7D, 0x03, 0x67,
+    0x6E, 0x72, 0xBE, 0x86, 0x7D, 0x00, 0x04, 0x62, 0x6D, 0x6E, 0x73, 0x01, 0xC0, 0x0B, 0x62, 0x01,
+    0x07, 0x0C, 0x61, 0x64, 0x65, 0x66, 0x69, 0x6C, 0x6F, 0x70, 0x74, 0x75, 0x76, 0x79, 0xBF, 0x8D,
+    0xBF, 0x95, 0xBF, 0xA6, 0x21, 0xBF, 0xC5, 0x61, 0x6D, 0x20, 0x10, 0x75, 0x10, 0x12, 0x03, 0x68,
+    0x6C, 0x74, 0x02, 0x09, 0xBE, 0x56, 0x02, 0x65, 0x6C, 0x10, 0x05, 0x80, 0x14, 0x22, 0x01, 0x61,
+    0x7D, 0x01, 0x68, 0x7D, 0x01, 0x73, 0x19, 0x81, 0x00, 0x51, 0x72, 0xC0, 0x0A, 0x8C, 0x84, 0x00,
+    0x21, 0x63, 0x6E, 0x72, 0x74, 0x73, 0x22, 0x76, 0x79, 0x02, 0x2E, 0x61, 0x01, 0x01, 0x81, 0x01,
+    0x01, 0x69, 0x07, 0x04, 0x61, 0x63, 0x64, 0x6E, 0x06, 0x76, 0x07, 0x7B, 0x01, 0x64, 0x08, 0x01,
+    0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x02, 0x67, 0x6E, 0x15, 0x03, 0x02, 0x69, 0x72, 0x01, 0xA0, 0xB2,
+    0x07, 0x61, 0x62, 0x65, 0x69, 0x6D, 0x6F, 0x70, 0xBF, 0xAE, 0xBF, 0xB6, 0xBF, 0xCE, 0x63, 0x72,
+    0x75, 0x7A, 0x82, 0x01, 0x01, 0x63, 0x6E, 0x05, 0x06, 0x01, 0x6C, 0x0C, 0x81, 0x01, 0x01, 0x69,
+    0x7D, 0x81, 0x00, 0xD1, 0x6F, 0x02, 0x02, 0x6E, 0x73, 0x06, 0x1A, 0x04, 0x63, 0x6F, 0x73, 0x75,
+    0x0E, 0x06, 0x0E, 0x07, 0x01, 0x79, 0x01, 0x01, 0x65, 0x7D, 0x02, 0x69, 0x79, 0xBE, 0x06, 0x01,
+    0x01, 0x6D, 0xB1, 0x0E, 0x80, 0x15, 0x04, 0x01, 0x6E, 0x7D, 0x01, 0x6F, 0x7D, 0x05, 0x64, 0x6D,
+    0x72, 0x74, 0x75, 0x21, 0x6D, 0x73, 0x7D, 0x06, 0x81, 0x03, 0x01, 0x72, 0xC0, 0x07, 0x5A, 0x01,
+    0x69, 0x79, 0x82, 0x00, 0xF1, 0x70, 0x75, 0x7D, 0x0B, 0x81, 0x05, 0x22, 0x66, 0x16, 0x02, 0x65,
+    0x69, 0xC0, 0x15, 0xE5, 0x7B, 0x8C, 0x00, 0x21, 0x61, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6B, 0x6F,
+    0x73, 0x74, 0x75, 0x76, 0xBF, 0x9D, 0xBF, 0xA7, 0xBF, 0xAC, 0xBF, 0xB1, 0xC0, 0x0A, 0x09, 0xBF,
+    0xB6, 0xBF, 0xC2, 0xBF, 0xD8, 0x6D, 0x79, 0xC0, 0x12, 0xA8, 0xC0, 0x06, 0x43, 0x02, 0x65, 0x69,
+    0x09, 0x09, 0x01, 0x64, 0x06, 0x85, 0x01, 0x91, 0x64, 0x6B, 0x70, 0x72, 0x73, 0x78, 0x05, 0x32,
+    0x7D, 0x37, 0x81, 0x01, 0x51, 0x67, 0x04, 0x81, 0x01, 0x01, 0x61, 0x7B, 0x02, 0x64, 0x72, 0x09,
+    0x7B, 0x82, 0x00, 0xD1, 0x61, 0x65, 0xA2, 0x50, 0xC0, 0x0A, 0x66, 0x01, 0x2E, 0x0E, 0x01, 0x6D,
+    0x7D, 0x03, 0x6E, 0x73, 0x74, 0xA3, 0x84, 0x7D, 0x06, 0x02, 0x6E, 0x73, 0x07, 0xC0, 0x0A, 0xB9,
+    0x08, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x75, 0x79, 0x12, 0xBF, 0xDC, 0x61, 0x71, 0x79, 0x0D,
+    0x0E, 0x09, 0x01, 0x67, 0x19, 0x84, 0x00, 0x11, 0x2E, 0x67, 0x6C, 0x6E, 0x07, 0x34, 0xBD, 0x0F,
+    0x7D, 0x81, 0x01, 0x81, 0x6C, 0x07, 0x02, 0x68, 0x74, 0x09, 0x36, 0x04, 0x61, 0x69, 0x73, 0x77,
+    0x76, 0x01, 0x7B, 0x0B, 0x07, 0x61, 0x63, 0x6C, 0x6E, 0x6F, 0x74, 0x75, 0x25, 0x22, 0x07, 0x0E,
+    0x0D, 0xBF, 0x20, 0x06, 0x01, 0x65, 0x17, 0x02, 0x66, 0x75, 0x07, 0xA3, 0x2E, 0x01, 0x68, 0x0C,
+    0x81, 0x00, 0xB1, 0x6E, 0x09, 0x02, 0x65, 0x74, 0x7B, 0x0B, 0x80, 0x14, 0xD3, 0x01, 0x74, 0x7D,
+    0x01, 0x69, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x69, 0x1E, 0x04, 0x69, 0x6F, 0x72, 0x79, 0x01, 0x7A,
+    0x7D, 0x01, 0x01, 0x6C, 0xC0, 0x0A, 0x8C, 0x01, 0x65, 0x7B, 0x01, 0x76, 0x7D, 0x03, 0x68, 0x69,
+    0x79, 0x6C, 0x7D, 0x05, 0x01, 0x6D, 0x07, 0x0D, 0x61, 0x65, 0x67, 0x69, 0x6D, 0x6E, 0x6F, 0x70,
+    0x72, 0x73, 0x74, 0x75, 0x79, 0xBF, 0x8E, 0xBF, 0xA4, 0xC0, 0x0A, 0x09, 0xBF, 0xAD, 0xC0, 0x0D,
+    0x31, 0xBF, 0xBD, 0xBF, 0xC0, 0x19, 0xBF, 0xC6, 0xBF, 0xCE, 0x76, 0x7D, 0x0D, 0x81, 0x00, 0x41,
+    0x69, 0x04, 0x01, 0x70, 0x7B, 0x83, 0x01, 0x91, 0x65, 0x6F, 0x72, 0x05, 0x7D, 0x07, 0x03, 0x69,
+    0x6F, 0x79, 0xC0, 0x0A, 0xD5, 0x01, 0x01, 0x03, 0x65, 0x74, 0x75, 0xA1, 0x52, 0x77, 0x00, 0x01,
+    0x72, 0x34, 0x01, 0x65, 0x7D, 0x03, 0x61, 0x68, 0x6F, 0x05, 0x7D, 0x05, 0x81, 0x01, 0x91, 0x74,
+    0xC0, 0x0D, 0x34, 0x02, 0x6C, 0x74, 0x02, 0x02, 0x02, 0x61, 0x69, 0x74, 0x7B, 0x07, 0x61, 0x63,
+    0x69, 0x6C, 0x6F, 0x70, 0x74, 0x3C, 0xBF, 0xC8, 0xBF, 0xDA, 0x05, 0x12, 0x68, 0x7B, 0x01, 0x65,
+    0xC0, 0x07, 0xEA, 0x02, 0x2E, 0x73, 0x01, 0x02, 0x80, 0x14, 0xB2, 0x01, 0x72, 0x7D, 0x80, 0x02,
+    0x72, 0x01, 0x72, 0x7D, 0x02, 0x65, 0x6F, 0x77, 0x7D, 0x81, 0x00, 0x51, 0x74, 0x7B, 0x03, 0x6C,
+    0x72, 0x73, 0x60, 0x65, 0x7B, 0x80, 0x14, 0x83, 0x01, 0x73, 0x7D, 0x02, 0x6F, 0x73, 0x7D, 0x2C,
+    0x82, 0x00, 0x01, 0x65, 0x69, 0x7B, 0xA8, 0xC8, 0x03, 0x2E, 0x61, 0x65, 0x01, 0x02, 0x06, 0x03,
+    0x63, 0x66, 0x73, 0x79, 0x06, 0x06, 0x05, 0x61, 0x65, 0x68, 0x69, 0x6F, 0xB5, 0xA0, 0xBF, 0xD8,
+    0x6A, 0x79, 0x3A, 0x01, 0x6F, 0xAC, 0x41, 0x01, 0x64, 0x7C, 0x02, 0x61, 0x6C, 0x7D, 0x01, 0x01,
+    0x68, 0x3F, 0x02, 0x63, 0x64, 0xC0, 0x04, 0x26, 0x17, 0x86, 0x01, 0x91, 0x62, 0x63, 0x65, 0x6C,
+    0x6E, 0x76, 0x71, 0x76, 0x1A, 0x05, 0x79, 0x02, 0x03, 0x6E, 0x73, 0x74, 0x24, 0x11, 0x05, 0x02,
+    0x6E, 0x72, 0x05, 0x79, 0x80, 0x14, 0x53, 0x01, 0x2E, 0x7D, 0x01, 0x6E, 0x7D, 0x03, 0x61, 0x73,
+    0x74, 0x7D, 0x06, 0xB7, 0x04, 0x01, 0x6C, 0xC0, 0x12, 0xBE, 0x03, 0x65, 0x69, 0x6F, 0x65, 0x73,
+    0x7B, 0x02, 0x6C, 0x73, 0x01, 0x1A, 0x05, 0x64, 0x65, 0x69, 0x6E, 0x6F, 0xBC, 0x5F, 0x7B, 0x0E,
+    0x2C, 0x03, 0x80, 0x0E, 0x62, 0x01, 0x63, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x64, 0x7D, 0x01, 0x69,
+    0x7D, 0x01, 0x61, 0x0E, 0x19, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B,
+    0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0xBB, 0x13,
+    0xBB, 0x3A, 0xBB, 0x7B, 0xBB, 0xB9, 0xBB, 0xD3, 0xBB, 0xEA, 0xBC, 0x22, 0xBC, 0x35, 0xBC, 0x58,
+    0x07, 0xBC, 0x73, 0xBC, 0xED, 0xBD, 0x5C, 0xBD, 0xD1, 0xBE, 0x01, 0xBE, 0x3C, 0x0D, 0xBE, 0xC3,
+    0xBF, 0x29, 0xBF, 0x82, 0xBF, 0xA5, 0xBF, 0xD6, 0x62, 0x7A, 0x7D, 0x03, 0x61, 0x65, 0x74, 0x05,
+    0x05, 0x00, 0x02, 0x6E, 0x74, 0x08, 0x06, 0x01, 0x61, 0x7B, 0x81, 0x00, 0x51, 0x6E, 0x0B, 0x01,
+    0x74, 0xC0, 0x06, 0x08, 0x01, 0x61, 0x7B, 0x81, 0x00, 0x51, 0x6D, 0x7D, 0x04, 0x61, 0x65, 0x74,
+    0x79, 0x00, 0xC0, 0x16, 0x95, 0xC0, 0x05, 0xF8, 0x01, 0x81, 0x01, 0x01, 0x75, 0x05, 0x80, 0x14,
+    0x32, 0x01, 0x61, 0x7D, 0x02, 0x65, 0x72, 0x09, 0x7D, 0x01, 0x65, 0xAF, 0x0C, 0x81, 0x03, 0x01,
+    0x65, 0x11, 0x04, 0x62, 0x67, 0x6C, 0x6D, 0xC0, 0x03, 0xF5, 0x72, 0x77, 0x7B, 0x81, 0x01, 0x51,
+    0x6C, 0x09, 0x81, 0x01, 0xC2, 0x73, 0x00, 0x04, 0x61, 0x64, 0x65, 0x69, 0x6B, 0x2C, 0x76, 0x7B,
+    0x81, 0x01, 0x91, 0x72, 0x02, 0x02, 0x69, 0x79, 0xC0, 0x14, 0x5D, 0x02, 0x03, 0x65, 0x68, 0x72,
+    0x74, 0x79, 0xA7, 0xF2, 0x8B, 0x00, 0x71, 0x63, 0x64, 0x67, 0x69, 0x6C, 0x6E, 0x70, 0x72, 0x74,
+    0x76, 0x79, 0xBF, 0x87, 0x03, 0xBF, 0x93, 0xBF, 0x96, 0xBF, 0xA3, 0xBF, 0xA8, 0xBF, 0xB5, 0x63,
+    0x78, 0x00, 0x0C, 0x81, 0x10, 0x82, 0x72, 0xC0, 0x0E, 0x82, 0x82, 0x01, 0x51, 0x61, 0x63, 0x1C,
+    0x00, 0x82, 0x10, 0x42, 0x65, 0x69, 0x0C, 0x79, 0x82, 0x00, 0x51, 0x64, 0x76, 0x00, 0xC0, 0x08,
+    0xDC, 0x02, 0x61, 0x69, 0x05, 0x24, 0x01, 0x68, 0x00, 0x03, 0x61, 0x63, 0x74, 0xC0, 0x09, 0xDF,
+    0x03, 0x7D, 0x03, 0x2E, 0x62, 0x67, 0x03, 0xC0, 0x03, 0xF5, 0x03, 0x81, 0x00, 0x51, 0x73, 0x37,
+    0x02, 0x61, 0x65, 0xC0, 0x06, 0xF6, 0x16, 0x08, 0x61, 0x69, 0x6D, 0x6E, 0x6F, 0x74, 0x75, 0x76,
+    0x6B, 0x74, 0x79, 0x03, 0x0A, 0x32, 0x02, 0x14, 0x82, 0x01, 0x91, 0x65, 0x69, 0x1D, 0xC0, 0x0E,
+    0x2C, 0x0B, 0x2E, 0x61, 0x63, 0x64, 0x65, 0x6B, 0x6C, 0x6E, 0x6F, 0x72, 0x74, 0x04, 0xBF, 0xA2,
+    0x10, 0xBF, 0xB0, 0xBF, 0xB7, 0x00, 0xBF, 0xC0, 0xBF, 0xC8, 0x1D, 0x66, 0x77, 0x01, 0x72, 0x3F,
+    0x03, 0x6E, 0x72, 0x73, 0xC0, 0x06, 0x97, 0x05, 0xC0, 0x0A, 0xCB, 0x01, 0x74, 0xC0, 0x08, 0xCB,
+    0x80, 0x13, 0xE3, 0x01, 0x6C, 0x7D, 0x01, 0x65, 0x7D, 0x02, 0x6E, 0x74, 0x72, 0x7D, 0x01, 0x61,
+    0x7B, 0x01, 0x74, 0xC0, 0x18, 0x33, 0x06, 0x63, 0x65, 0x6C, 0x6E, 0x73, 0x7A, 0x0E, 0x08, 0x78,
+    0x35, 0x7B, 0x0C, 0x02, 0x65, 0x69, 0x0C, 0x08, 0x03, 0x62, 0x6E, 0x72, 0x0C, 0x7B, 0x00, 0x0A,
+    0x2E, 0x61, 0x65, 0x69, 0x6C, 0x6F, 0x73, 0x74, 0x75, 0x79, 0x04, 0xBF, 0xBE, 0xBF, 0xC1, 0x67,
+    0x10, 0x79, 0x04, 0x01, 0x08, 0x18, 0x81, 0x00, 0xF1, 0x6E, 0x0B, 0x80, 0x13, 0xB3, 0x01, 0x64,
+    0x7D, 0x03, 0x61, 0x69, 0x79, 0x7D, 0x2B, 0x05, 0x83, 0x00, 0x51, 0x61, 0x65, 0x69, 0x07, 0x01,
+    0x08, 0x02, 0x63, 0x6E, 0x0C, 0x01, 0x01, 0x61, 0xAC, 0x2E, 0x01, 0x72, 0x7C, 0x83, 0x01, 0x91,
+    0x2E, 0x64, 0x6F, 0x03, 0x0B, 0x03, 0x81, 0x13, 0x92, 0x6E, 0x0B, 0x81, 0x00, 0x41, 0x61, 0x02,
+    0x02, 0x68, 0x75, 0x7B, 0x10, 0x09, 0x61, 0x63, 0x64, 0x65, 0x67, 0x6C, 0x6E, 0x6F, 0x74, 0xBF,
+    0xC1, 0xBF, 0xCC, 0xBF, 0xD3, 0xBF, 0xDC, 0x65, 0xC0, 0x0D, 0xC7, 0x68, 0x71, 0x7B, 0x80, 0x13,
+    0x63, 0x02, 0x6E, 0x73, 0x0C, 0x37, 0x01, 0x62, 0xC0, 0x08, 0xDC, 0x01, 0x61, 0x7B, 0x81, 0x00,
+    0x61, 0x61, 0x2D, 0x05, 0x61, 0x63, 0x65, 0x67, 0x6E, 0x0A, 0x78, 0x2D, 0x04, 0x7B, 0x81, 0x00,
+    0x61, 0x62, 0x0B, 0x01, 0x6D, 0x7B, 0x84, 0x13, 0x33, 0x61, 0x69, 0x6F, 0x75, 0xBF, 0xDB, 0x6D,
+    0xC0, 0x03, 0xD6, 0x7D, 0x80, 0x13, 0x12, 0x02, 0x6D, 0x74, 0x02, 0x7D, 0x80, 0x12, 0xF2, 0x82,
+    0x07, 0xB1, 0x63, 0x74, 0xAB, 0x7D, 0x08, 0x01, 0x6E, 0x78, 0x01, 0x2E, 0x18, 0x80, 0x12, 0xD2,
+    0x01, 0x6F, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x6F, 0x7D, 0x01, 0x68, 0x7D, 0x03, 0x65, 0x70, 0x74,
+    0x1E, 0x7D, 0x0F, 0x02, 0x65, 0x79, 0x67, 0x79, 0x81, 0x12, 0xB2, 0x79, 0x05, 0x81, 0x00, 0x71,
+    0x73, 0x14, 0x81, 0x00, 0x51, 0x61, 0x05, 0x01, 0x6E, 0x08, 0x0C, 0x63, 0x64, 0x65, 0x67, 0x69,
+    0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x05, 0x29, 0xBF, 0xBD, 0xBF, 0xC2, 0xBF, 0xCD, 0x69,
+    0x21, 0x05, 0x6E, 0x73, 0x78, 0x7D, 0x85, 0x00, 0x21, 0x64, 0x6C, 0x6E, 0x72, 0x74, 0x03, 0x07,
+    0x06, 0x06, 0x06, 0x01, 0x69, 0xC0, 0x06, 0xE6, 0x01, 0x73, 0x7B, 0x83, 0x00, 0x02, 0x61, 0x65,
+    0x6F, 0xC0, 0x16, 0xF9, 0x6B, 0x7D, 0x01, 0x79, 0x24, 0x02, 0x69, 0x6F, 0x08, 0x09, 0x01, 0x61,
+    0xC0, 0x03, 0xEC, 0x80, 0x12, 0x92, 0x01, 0x63, 0x7D, 0x01, 0x61, 0x7D, 0x01, 0x75, 0x14, 0x01,
+    0x65, 0x7D, 0x01, 0x6C, 0xC0, 0x03, 0xD3, 0x03, 0x65, 0x70, 0x73, 0x06, 0x7B, 0x0C, 0x0A, 0x63,
+    0x65, 0x66, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x76, 0xBF, 0xDB, 0xC0, 0x04, 0xA1, 0x60, 0xC0,
+    0x04, 0x06, 0x6B, 0x71, 0x0A, 0x79, 0xC0, 0x0A, 0x96, 0x0A, 0x80, 0x12, 0x52, 0x01, 0x74, 0x7D,
+    0x81, 0x00, 0x61, 0x6F, 0x11, 0x03, 0x65, 0x6E, 0x73, 0xC0, 0x11, 0x00, 0x78, 0x7B, 0x01, 0x73,
+    0x17, 0x01, 0x73, 0x7D, 0x80, 0x12, 0x32, 0x01, 0x2E, 0x7D, 0x01, 0x79, 0x7D, 0x01, 0x74, 0x7D,
+    0x03, 0x61, 0x65, 0x69, 0x06, 0x71, 0x7D, 0x01, 0x69, 0x37, 0x01, 0x65, 0xC0, 0x08, 0xDC, 0x06,
+    0x63, 0x66, 0x67, 0x6C, 0x73, 0x74, 0x71, 0x78, 0x7B, 0x0A, 0xC0, 0x06, 0x94, 0x14, 0x84, 0x01,
+    0x91, 0x61, 0x65, 0x69, 0x6F, 0xBF, 0x78, 0xBF, 0xA0, 0xBF, 0xC7, 0x71, 0x80, 0x11, 0xF4, 0x02,
+    0x64, 0x66, 0x7D, 0x7D, 0x81, 0x11, 0xD2, 0x6F, 0x7B, 0x01, 0x64, 0x7B, 0x81, 0x00, 0x21, 0x75,
+    0x7D, 0x83, 0x07, 0xC3, 0x65, 0x68, 0x69, 0x7B, 0x05, 0xB4, 0xCF, 0x01, 0x62, 0xB5, 0xD6, 0x80,
+    0x11, 0xB2, 0x01, 0x74, 0x7D, 0x01, 0x61, 0x7D, 0x01, 0x6D, 0x7D, 0x80, 0x01, 0xE2, 0x01, 0x6C,
+    0x7D, 0x01, 0x6F, 0x7D, 0x88, 0x00, 0xD2, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x75, 0x77, 0x67,
+    0x12, 0x12, 0xC0, 0x04, 0xA1, 0x74, 0x7D, 0x2E, 0x03, 0x80, 0x11, 0x92, 0x01, 0x63, 0x7D, 0x01,
+    0x73, 0x7D, 0x81, 0x02, 0x81, 0x65, 0x7D, 0x02, 0x65, 0x69, 0xC0, 0x07, 0xA7, 0xC0, 0x1B, 0x10,
+    0x83, 0x01, 0x91, 0x65, 0x72, 0x74, 0xC0, 0x13, 0xF8, 0x01, 0x77, 0x09, 0x62, 0x65, 0x66, 0x6C,
+    0x6D, 0x6E, 0x72, 0x73, 0x74, 0x67, 0x00, 0x00, 0xC0, 0x10, 0xDC, 0x05, 0x10, 0x2E, 0x08, 0x75,
+    0x13, 0x61, 0x62, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72,
+    0x73, 0x74, 0x75, 0x77, 0xBC, 0xE4, 0x1F, 0x05, 0xBD, 0x61, 0x04, 0x04, 0xBD, 0xBF, 0xBE, 0x15,
+    0xBE, 0x2E, 0xBE, 0x56, 0x1F, 0x3B, 0xBE, 0xAA, 0xBE, 0xDB, 0xBF, 0x6E, 0xBF, 0x91, 0xBF, 0xB4,
+    0x6B, 0x06, 0x80, 0x11, 0x72, 0x01, 0x65, 0x7D, 0x01, 0x74, 0x7D, 0x01, 0x6E, 0x7D, 0x82, 0x11,
+    0x33, 0x72, 0x73, 0xC0, 0x07, 0xBF, 0xC0, 0x07, 0xBF, 0x01, 0x69, 0x75, 0x03, 0x69, 0x73, 0x76,
+    0x6F, 0x7D, 0x09, 0x03, 0x2E, 0x72, 0x74, 0x13, 0x0C, 0x0C, 0x80, 0x11, 0x12, 0x01, 0x73, 0x7D,
+    0x01, 0x73, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x74, 0x7D, 0x01, 0x72, 0xA3, 0xEF, 0x01, 0x61, 0x7C,
+    0x02, 0x6E, 0x76, 0x76, 0x7D, 0x83, 0x01, 0x91, 0x61, 0x65, 0x69, 0xBF, 0xD7, 0xBF, 0xDE, 0x7B,
+    0x01, 0x75, 0x75, 0x01, 0x63, 0x0D, 0x02, 0x69, 0x6F, 0x7D, 0xAE, 0x5F, 0x01, 0x6C, 0x7A, 0x82,
+    0x00, 0xD1, 0x69, 0x6F, 0x01, 0x7D, 0x02, 0x65, 0x75, 0x0B, 0x01, 0x02, 0x68, 0x6C, 0x7B, 0x07,
+    0x01, 0x67, 0xB0, 0xFA, 0x02, 0x67, 0x6F, 0xAD, 0x0D, 0x7C, 0x01, 0x69, 0x7A, 0x02, 0x66, 0x74,
+    0x2C, 0x00, 0x80, 0x10, 0x84, 0x01, 0x7A, 0x7D, 0x01, 0x69, 0x7D, 0x81, 0x02, 0x81, 0x72, 0x7D,
+    0x02, 0x6E, 0x74, 0x12, 0x7B, 0x03, 0x65, 0x69, 0x6F, 0x7B, 0x12, 0xC0, 0x0E, 0x19, 0x05, 0x65,
+    0x67, 0x68, 0x69, 0x6F, 0xC0, 0x06, 0x40, 0x15, 0xB0, 0x9E, 0x03, 0x02, 0x02, 0x65, 0x68, 0xC0,
+    0x05, 0x7E, 0xC0, 0x0E, 0xE2, 0x81, 0x01, 0x41, 0x66, 0x09, 0x03, 0x63, 0x65, 0x69, 0x09, 0x7B,
+    0xC0, 0x1A, 0xB1, 0x01, 0x6E, 0xC0, 0x07, 0xC2, 0x01, 0x6F, 0x7B, 0x01, 0x69, 0x7D, 0x02, 0x61,
+    0x65, 0xA7, 0x1C, 0xC0, 0x16, 0x95, 0x01, 0x69, 0x19, 0x10, 0x62, 0x63, 0x64, 0x66, 0x69, 0x6C,
+    0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x7A, 0xBF, 0x86, 0xBF, 0x92, 0xBF, 0xA1,
+    0xBF, 0xA4, 0x12, 0x23, 0xBF, 0xBC, 0xBF, 0xC5, 0xB3, 0x7D, 0xBF, 0xD3, 0x61, 0x12, 0x72, 0xC0,
+    0x04, 0x6B, 0x75, 0x7D, 0x02, 0x62, 0x67, 0x03, 0x03, 0x80, 0x0A, 0x72, 0x02, 0x2E, 0x65, 0x02,
+    0x7D, 0x82, 0x00, 0x21, 0x65, 0x67, 0x07, 0x7B, 0x82, 0x01, 0x11, 0x66, 0x6E, 0x00, 0x79, 0x83,
+    0x00, 0x11, 0x61, 0x69, 0x6F, 0x65, 0x79, 0x05, 0x81, 0x00, 0x21, 0x6E, 0x0B, 0x02, 0x61, 0x65,
+    0x06, 0x2E, 0x02, 0x62, 0x74, 0xC0, 0x1C, 0x8E, 0x05, 0x01, 0x6D, 0x11, 0x84, 0x00, 0x11, 0x65,
+    0x68, 0x69, 0x75, 0x6C, 0x71, 0x76, 0x7D, 0x01, 0x6C, 0x03, 0x81, 0x01, 0x41, 0x67, 0x01, 0x83,
+    0x01, 0x91, 0x61, 0x65, 0x6E, 0x00, 0x2E, 0x7B, 0x02, 0x61, 0x69, 0x6F, 0x77, 0x05, 0x6C, 0x6E,
+    0x72, 0x76, 0x77, 0x0E, 0x01, 0x27, 0x08, 0x05, 0x01, 0x61, 0xC0, 0x09, 0xA7, 0x01, 0x72, 0x7B,
+    0x80, 0x08, 0x13, 0x01, 0x72, 0x7D, 0x01, 0x70, 0x7D, 0x01, 0x70, 0x1B, 0x02, 0x6C, 0x6D, 0xC0,
+    0x12, 0x4C, 0x7D, 0x80, 0x10, 0x62, 0x01, 0x67, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x61, 0x7D, 0x04,
+    0x69, 0x6F, 0x72, 0x74, 0x67, 0x6D, 0x2B, 0x7D, 0x02, 0x73, 0x74, 0x01, 0x09, 0x82, 0x10, 0x42,
+    0x65, 0x69, 0x0E, 0x7B, 0x81, 0x01, 0x91, 0x72, 0x36, 0x04, 0x61, 0x65, 0x69, 0x79, 0xA2, 0xF2,
+    0x7B, 0x01, 0x05, 0x01, 0x69, 0xB6, 0x7C, 0x02, 0x69, 0x75, 0x0E, 0x02, 0x02, 0x61, 0x65, 0xC0,
+    0x1C, 0x8E, 0x00, 0x01, 0x74, 0x79, 0x01, 0x73, 0x21, 0x03, 0x69, 0x6F, 0x75, 0x1D, 0x7D, 0x0E,
+    0x83, 0x10, 0x22, 0x69, 0x6F, 0x75, 0x03, 0x0B, 0x02, 0x01, 0x69, 0xAA, 0x00, 0x82, 0x01, 0x11,
+    0x61, 0x72, 0x20, 0x01, 0x04, 0x2E, 0x70, 0x73, 0x74, 0x03, 0x21, 0x75, 0x79, 0x01, 0x7A, 0xC0,
+    0x1E, 0x6C, 0x01, 0x75, 0xC0, 0x1A, 0x54, 0x81, 0x00, 0xF1, 0x62, 0x7B, 0x01, 0x69, 0x7B, 0x03,
+    0x65, 0x69, 0x72, 0x39, 0x6E, 0x7D, 0x81, 0x01, 0x11, 0x74, 0xA5, 0xE4, 0x03, 0x2E, 0x73, 0x74,
+    0xC0, 0x0A, 0xC1, 0x02, 0x02, 0x02, 0x6C, 0x72, 0x0A, 0x77, 0x01, 0x6C, 0xC0, 0x23, 0x2B, 0x84,
+    0x01, 0x11, 0x61, 0x65, 0x69, 0x6F, 0xC0, 0x15, 0xE8, 0x76, 0x20, 0x7B, 0x12, 0x2E, 0x61, 0x62,
+    0x63, 0x64, 0x66, 0x67, 0x69, 0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x13,
+    0xBF, 0x31, 0xBF, 0x41, 0xBF, 0x63, 0xBF, 0x71, 0xBF, 0x7D, 0xBF, 0x87, 0x1A, 0xBF, 0x8B, 0xBF,
+    0x97, 0x0E, 0xBF, 0x9D, 0xBF, 0xA4, 0xBF, 0xB8, 0xBF, 0xD3, 0xBF, 0xDA, 0x73, 0xC0, 0x0D, 0x8F,
+    0x82, 0x00, 0x11, 0x75, 0x79, 0x00, 0x03, 0x02, 0x72, 0x74, 0x01, 0x06, 0x81, 0x00, 0x61, 0x67,
+    0x01, 0x04, 0x63, 0x6E, 0x73, 0x74, 0x06, 0x7B, 0x07, 0x07, 0x85, 0x01, 0x91, 0x65, 0x69, 0x6C,
+    0x6F, 0x75, 0x6D, 0x77, 0x0D, 0xC0, 0x1B, 0x10, 0x06, 0x82, 0x00, 0xB1, 0x2E, 0x61, 0x04, 0xC0,
+    0x1A, 0xB1, 0x83, 0x00, 0xF1, 0x62, 0x67, 0x6C, 0x00, 0x05, 0xC0, 0x0A, 0x89, 0x81, 0x00, 0x51,
+    0x61, 0x0A, 0x82, 0x00, 0x01, 0x64, 0x65, 0x08, 0x05, 0x04, 0x61, 0x65, 0x69, 0x6F, 0x3A, 0x03,
+    0x79, 0x03, 0x02, 0x63, 0x74, 0x01, 0x01, 0x03, 0x6E, 0x72, 0x74, 0x7B, 0x0E, 0x02, 0x02, 0x61,
+    0x69, 0x28, 0x08, 0x01, 0x69, 0xC0, 0x13, 0x90, 0x04, 0x61, 0x69, 0x6F, 0x70, 0xBB, 0xAF, 0x09,
+    0x0C, 0x15, 0x81, 0x00, 0x21, 0x2E, 0x08, 0x04, 0x61, 0x64, 0x65, 0x67, 0x7B, 0x00, 0x00, 0x00,
+    0x81, 0x00, 0xC1, 0x65, 0x0F, 0x81, 0x01, 0x91, 0x69, 0xA8, 0xCF, 0x02, 0x68, 0x6C, 0x75, 0x7A,
+    0x84, 0x00, 0x21, 0x2E, 0x63, 0x68, 0x70, 0x03, 0x00, 0x06, 0x00, 0x01, 0x62, 0xA4, 0xC9, 0x02,
+    0x2E, 0x73, 0x09, 0x09, 0x02, 0x64, 0x72, 0xC0, 0x0A, 0xE0, 0x7B, 0x81, 0x01, 0x91, 0x72, 0x09,
+    0x04, 0x61, 0x65, 0x69, 0x75, 0x6B, 0x74, 0xC0, 0x10, 0xDC, 0x7B, 0x02, 0x6C, 0x74, 0x09, 0x0A,
+    0x80, 0x09, 0xD2, 0x01, 0x6C, 0x7D, 0x03, 0x65, 0x69, 0x6F, 0x75, 0x0A, 0x7D, 0x0F, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x73, 0x74, 0x76, 0xBF, 0x65, 0xBF,
+    0x70, 0xBF, 0x7C, 0xC0, 0x0F, 0x5D, 0xBF, 0x8A, 0xBF, 0x91, 0xBF, 0x96, 0xBF, 0x9B, 0xBF, 0xAA,
+    0x0E, 0xBF, 0xBE, 0x03, 0xBF, 0xC3, 0x63, 0x79, 0x80, 0x0F, 0xF1, 0x01, 0x6F, 0x0E, 0x02, 0x65,
+    0x69, 0x05, 0xC0, 0x09, 0xDF, 0x01, 0x75, 0x0D, 0x01, 0x61, 0x7D, 0x01, 0x2E, 0x6D, 0x06, 0x2E,
+    0x65, 0x68, 0x6C, 0x72, 0x73, 0x6A, 0xC0, 0x0D, 0x1E, 0x6D, 0x70, 0x7A, 0x7D, 0x01, 0x75, 0xC0,
+    0x0A, 0xC1, 0x82, 0x00, 0x61, 0x64, 0x71, 0x12, 0x7B, 0x81, 0x00, 0x51, 0x68, 0x02, 0x02, 0x67,
+    0x73, 0x03, 0x7B, 0x83, 0x00, 0x11, 0x65, 0x69, 0x6F, 0x6F, 0x7B, 0x38, 0x82, 0x00, 0x21, 0x6E,
+    0x72, 0x06, 0xC0, 0x0C, 0xB6, 0x81, 0x00, 0xF1, 0x2E, 0x03, 0x01, 0x67, 0x7B, 0x03, 0x6E, 0x6F,
+    0x74, 0x7D, 0x03, 0x06, 0x84, 0x00, 0x11, 0x61, 0x65, 0x69, 0x79, 0xA8, 0x00, 0x68, 0x79, 0x03,
+    0x04, 0x6C, 0x72, 0x74, 0x79, 0x06, 0x03, 0x07, 0x06, 0x80, 0x0F, 0xB2, 0x04, 0x63, 0x73, 0x74,
+    0x76, 0x07, 0x7D, 0x06, 0x06, 0x81, 0x00, 0x61, 0x75, 0x03, 0x05, 0x61, 0x65, 0x69, 0x6F, 0x75,
+    0xA0, 0x34, 0x66, 0x72, 0x7B, 0x06, 0x80, 0x0F, 0x92, 0x01, 0x74, 0x7D, 0x02, 0x6C, 0x6F, 0x0A,
+    0x7D, 0x81, 0x00, 0x21, 0x72, 0x01, 0x80, 0x0F, 0x52, 0x01, 0x65, 0x7D, 0x01, 0x64, 0x7D, 0x01,
+    0x69, 0x7D, 0x82, 0x00, 0xB1, 0x6C, 0x70, 0xAD, 0x3A, 0x7D, 0x02, 0x65, 0x69, 0x0E, 0x20, 0x81,
+    0x01, 0x11, 0x65, 0x27, 0x01, 0x65, 0x29, 0x02, 0x73, 0x74, 0xC0, 0x0B, 0xBB, 0x1B, 0x03, 0x65,
+    0x69, 0x70, 0x79, 0x00, 0x00, 0x01, 0x73, 0xB1, 0x1C, 0x04, 0x61, 0x65, 0x69, 0x74, 0xC0, 0x06,
+    0xF6, 0x00, 0x7C, 0xC0, 0x04, 0x06, 0x02, 0x6D, 0x74, 0x18, 0x08, 0x02, 0x65, 0x69, 0x3C, 0xC0,
+    0x10, 0xDC, 0x02, 0x69, 0x6F, 0x0A, 0x02, 0x02, 0x70, 0x73, 0xC0, 0x0F, 0x5D, 0x00, 0x01, 0x6F,
+    0xC0, 0x0A, 0xA9, 0x03, 0x68, 0x72, 0x79, 0x2B, 0x7B, 0x05, 0x02, 0x61, 0x65, 0x05, 0xC0, 0x12,
+    0x4C, 0x0F, 0x62, 0x63, 0x65, 0x66, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x76,
+    0x78, 0xBF, 0x8B, 0xBF, 0x90, 0xBF, 0xA1, 0xBF, 0xA9, 0xBF, 0xAE, 0xBF, 0xB3, 0xBF, 0xBD, 0xBF,
+    0xC8, 0xBF, 0xD5, 0xBF, 0xDA, 0x61, 0x66, 0x72, 0x79, 0x09, 0x80, 0x02, 0x42, 0x01, 0x69, 0x7D,
+    0x01, 0x6C, 0x7D, 0x01, 0x75, 0x7D, 0x04, 0x61, 0x6E, 0x72, 0x74, 0x03, 0xC0, 0x09, 0xA7, 0x36,
+    0x06, 0x85, 0x00, 0x11, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x75, 0xC0, 0x1E, 0x29, 0xA8, 0x8D,
+    0x06, 0x04, 0x63, 0x66, 0x6F, 0x73, 0x00, 0x00, 0x03, 0xC0, 0x04, 0x6B, 0x02, 0x6F, 0x76, 0x00,
+    0x00, 0x02, 0x6E, 0x73, 0x0B, 0x0B, 0x84, 0x01, 0xB2, 0x65, 0x69, 0x6F, 0x79, 0x6B, 0x76, 0x7B,
+    0xC0, 0x0B, 0x83, 0x81, 0x00, 0x11, 0x74, 0x2C, 0x81, 0x00, 0x41, 0x72, 0x00, 0x01, 0x69, 0xAA,
+    0x8A, 0x01, 0x64, 0x7C, 0x02, 0x2E, 0x61, 0x02, 0x7D, 0x84, 0x00, 0x21, 0x63, 0x72, 0x73, 0x76,
+    0x6F, 0x7B, 0x01, 0xC0, 0x05, 0xB4, 0x81, 0x00, 0x11, 0x61, 0x07, 0x81, 0x00, 0x11, 0x62, 0xC0,
+    0x1C, 0x8E, 0x88, 0x0E, 0xD2, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6F, 0x70, 0x77, 0xBF, 0xD1, 0x05,
+    0x67, 0x74, 0x79, 0xC0, 0x14, 0x1E, 0x0D, 0x07, 0x01, 0x68, 0x1C, 0x02, 0x63, 0x67, 0x7D, 0x03,
+    0x03, 0x62, 0x6E, 0x6F, 0x06, 0xC0, 0x1B, 0x19, 0x09, 0x01, 0x6F, 0xBE, 0x3C, 0x03, 0x69, 0x6C,
+    0x79, 0x11, 0x0B, 0x03, 0x87, 0x00, 0x11, 0x62, 0x64, 0x65, 0x67, 0x6C, 0x73, 0x76, 0x02, 0x00,
+    0xC0, 0x25, 0xEE, 0x06, 0x79, 0xC0, 0x19, 0x79, 0x03, 0x01, 0x68, 0xC0, 0x07, 0xC2, 0x01, 0x70,
+    0x7B, 0x03, 0x65, 0x69, 0x6F, 0xBE, 0x14, 0x06, 0x7D, 0x06, 0x61, 0x65, 0x68, 0x69, 0x72, 0x73,
+    0xBF, 0xC2, 0xBF, 0xC7, 0xBF, 0xD0, 0xBF, 0xDB, 0x78, 0xC0, 0x0D, 0x8F, 0x02, 0x6C, 0x6E, 0xC0,
+    0x1D, 0x96, 0x01, 0x01, 0x70, 0xC0, 0x16, 0x95, 0x82, 0x01, 0x91, 0x6B, 0x74, 0x0F, 0xC0, 0x05,
+    0xF8, 0x08, 0x61, 0x65, 0x67, 0x69, 0x6D, 0x6E, 0x73, 0x74, 0x01, 0x6B, 0xC0, 0x15, 0xE8, 0xC0,
+    0x0D, 0x92, 0x72, 0x77, 0xC0, 0x1F, 0x71, 0xC0, 0x20, 0xA7, 0x01, 0x6C, 0x0D, 0x86, 0x00, 0xB1,
+    0x69, 0x6C, 0x6E, 0x72, 0x73, 0x79, 0x7D, 0xC0, 0x03, 0xD6, 0x06, 0x36, 0xC0, 0x09, 0xA7, 0x06,
+    0x02, 0x63, 0x76, 0x06, 0x00, 0x03, 0x65, 0x69, 0x6F, 0x68, 0x7B, 0x06, 0x01, 0x67, 0xA6, 0xAE,
+    0x03, 0x63, 0x6E, 0x74, 0x05, 0x7C, 0x01, 0x01, 0x63, 0x0E, 0x01, 0x73, 0x7D, 0x18, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73,
+    0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0xBB, 0x0C, 0xBB, 0x52, 0xBB, 0x6F, 0xBB, 0x8B, 0xBC, 0x5F,
+    0xBC, 0x93, 0xBC, 0xAD, 0xBC, 0xBC, 0xBD, 0x60, 0x06, 0xBD, 0xA1, 0xBD, 0xC6, 0xBD, 0xE7, 0xBE,
+    0x0D, 0xBE, 0x94, 0xBE, 0xD4, 0xBE, 0xF9, 0xBF, 0x35, 0xBF, 0x8C, 0xBF, 0xB4, 0x68, 0x0D, 0x73,
+    0x7D, 0x03, 0x6B, 0x72, 0x74, 0x08, 0x32, 0x06, 0x02, 0x63, 0x77, 0x2F, 0x16, 0x01, 0x73, 0x7B,
+    0x05, 0x61, 0x65, 0x6D, 0x6F, 0x74, 0xC0, 0x24, 0xFF, 0x7D, 0x00, 0x02, 0x00, 0x02, 0x63, 0x64,
+    0x0C, 0x15, 0x80, 0x0E, 0xA3, 0x01, 0x6C, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x72, 0x7D, 0x81, 0x00,
+    0x11, 0x61, 0x7D, 0x01, 0x6F, 0xC0, 0x16, 0xF3, 0x03, 0x61, 0x69, 0x75, 0x02, 0x7B, 0x0A, 0x01,
+    0x6F, 0x27, 0x8A, 0x01, 0x91, 0x62, 0x63, 0x69, 0x6C, 0x6E, 0x70, 0x74, 0x75, 0x76, 0x77, 0xC0,
+    0x16, 0x07, 0xBF, 0xBF, 0x08, 0xBF, 0xCE, 0xBF, 0xDB, 0x6C, 0x76, 0x00, 0x7D, 0x08, 0x80, 0x0E,
+    0x82, 0x01, 0x74, 0x7D, 0x01, 0x72, 0xB5, 0x6E, 0x81, 0x00, 0x61, 0x65, 0x7C, 0x01, 0x6F, 0xC0,
+    0x08, 0xDF, 0x04, 0x6E, 0x70, 0x74, 0x76, 0x6F, 0x76, 0x7B, 0x0F, 0x03, 0x64, 0x69, 0x73, 0x03,
+    0x04, 0x03, 0x01, 0x7A, 0x03, 0x01, 0x74, 0x7D, 0x80, 0x0E, 0x42, 0x01, 0x67, 0x7D, 0x01, 0x6E,
+    0x7D, 0x01, 0x69, 0x7D, 0x01, 0x64, 0x7D, 0x01, 0x6F, 0x7D, 0x83, 0x01, 0x11, 0x69, 0x6F, 0x72,
+    0x6B, 0x03, 0x7D, 0x80, 0x0E, 0x22, 0x01, 0x64, 0x7D, 0x80, 0x0E, 0x02, 0x01, 0x74, 0x7D, 0x01,
+    0x74, 0x7D, 0x03, 0x65, 0x6E, 0x75, 0xC0, 0x22, 0x66, 0x74, 0x7D, 0x02, 0x65, 0x69, 0x0F, 0x03,
+    0x03, 0x66, 0x70, 0x75, 0x0B, 0xA3, 0xA6, 0xA0, 0x60, 0x01, 0x2E, 0x1C, 0x01, 0x72, 0x7D, 0x01,
+    0x65, 0x7D, 0x01, 0x70, 0x7D, 0x01, 0x61, 0x7D, 0x01, 0x68, 0xC0, 0x06, 0x55, 0x01, 0x74, 0x7B,
+    0x09, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x75, 0x79, 0xBF, 0x92, 0xBF, 0x9B, 0xBF, 0xBA,
+    0xBF, 0xD2, 0xBF, 0xDB, 0x60, 0x75, 0x0D, 0x7D, 0x82, 0x00, 0xB1, 0x73, 0x77, 0x0B, 0x09, 0x80,
+    0x08, 0x12, 0x02, 0x6F, 0x74, 0x7D, 0x0C, 0x82, 0x0D, 0xA2, 0x65, 0x6C, 0xC0, 0x1E, 0x29, 0x07,
+    0x81, 0x01, 0x91, 0x72, 0x0A, 0x03, 0x65, 0x66, 0x76, 0x0E, 0x08, 0x08, 0x01, 0x68, 0xBB, 0xF4,
+    0x01, 0x70, 0x7C, 0x80, 0x0D, 0x82, 0x01, 0x74, 0x7D, 0x81, 0x00, 0x01, 0x73, 0x7D, 0x80, 0x0D,
+    0x53, 0x01, 0x63, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x74, 0x7D, 0x04, 0x61, 0x65, 0x69, 0x6F, 0x66,
+    0x6F, 0x7D, 0xC0, 0x15, 0xE8, 0x01, 0x64, 0x07, 0x02, 0x64, 0x6C, 0x04, 0x04, 0x07, 0x61, 0x63,
+    0x64, 0x65, 0x67, 0x69, 0x74, 0x33, 0x04, 0x00, 0x78, 0x09, 0xC0, 0x1E, 0x41, 0x7B, 0x01, 0x62,
+    0x0A, 0x01, 0x6D, 0x7D, 0x01, 0x65, 0x7D, 0x02, 0x61, 0x74, 0xC0, 0x13, 0x5A, 0x7D, 0x04, 0x2E,
+    0x6C, 0x6F, 0x76, 0x1F, 0x03, 0x00, 0xC0, 0x26, 0xDC, 0x82, 0x01, 0xB2, 0x68, 0x74, 0x02, 0x09,
+    0x01, 0x6D, 0xC0, 0x27, 0x6B, 0x81, 0x00, 0xC1, 0x65, 0xC0, 0x11, 0xEE, 0x10, 0x2E, 0x61, 0x63,
+    0x64, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x75, 0x76, 0x77, 0x78, 0x04, 0xBF, 0x6C,
+    0xBF, 0x76, 0xBF, 0x7B, 0xBF, 0x84, 0x08, 0xBF, 0x89, 0xBF, 0xAE, 0xBF, 0xC1, 0xBF, 0xDB, 0x62,
+    0x6D, 0x74, 0x79, 0x26, 0x08, 0x02, 0x72, 0x76, 0x0E, 0x08, 0x04, 0x6E, 0x6F, 0x70, 0x76, 0x0E,
+    0x01, 0x0C, 0x0F, 0x01, 0x73, 0xC0, 0x27, 0x96, 0x81, 0x01, 0x41, 0x74, 0x16, 0x84, 0x00, 0x61,
+    0x65, 0x6C, 0x6E, 0x72, 0x76, 0xC0, 0x09, 0x3E, 0x11, 0x7B, 0x85, 0x00, 0x21, 0x2E, 0x65, 0x69,
+    0x6F, 0x77, 0x13, 0xBF, 0xDB, 0x60, 0x73, 0x04, 0x82, 0x00, 0xC1, 0x74, 0x77, 0x0F, 0x0F, 0x03,
+    0x2E, 0x64, 0x73, 0x0C, 0xC0, 0x11, 0x81, 0x79, 0x02, 0x65, 0x69, 0x77, 0xC0, 0x17, 0x1A, 0x01,
+    0x6E, 0xC0, 0x21, 0x5C, 0x02, 0x65, 0x79, 0x00, 0x04, 0x83, 0x00, 0xD2, 0x61, 0x65, 0x67, 0x12,
+    0x29, 0x06, 0x81, 0x00, 0xC1, 0x61, 0x0F, 0x81, 0x00, 0x71, 0x6E, 0x7B, 0x01, 0x69, 0xC0, 0x09,
+    0x3E, 0x01, 0x73, 0x7B, 0x82, 0x01, 0x91, 0x61, 0x65, 0x09, 0x7D, 0x01, 0x69, 0xC0, 0x11, 0x87,
+    0x0D, 0x62, 0x63, 0x64, 0x67, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x76, 0x7A, 0x0E, 0xC0,
+    0x1F, 0x71, 0xBF, 0xC8, 0xBF, 0xCF, 0xBF, 0xD4, 0xBF, 0xD9, 0x67, 0x74, 0x18, 0x7B, 0x08, 0x18,
+    0x08, 0x81, 0x00, 0x01, 0x74, 0x06, 0x02, 0x65, 0x67, 0x02, 0x02, 0x01, 0x6E, 0x7B, 0x01, 0x63,
+    0x14, 0x01, 0x73, 0x7D, 0x83, 0x01, 0x91, 0x65, 0x69, 0x79, 0x6D, 0x77, 0x7D, 0x01, 0x74, 0xC0,
+    0x10, 0x9D, 0x80, 0x0D, 0x12, 0x01, 0x61, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x6B, 0x7D, 0x01, 0x61,
+    0x7D, 0x01, 0x76, 0x7D, 0x84, 0x00, 0x12, 0x61, 0x65, 0x69, 0x6F, 0xC0, 0x0D, 0x1E, 0x12, 0x69,
+    0x7D, 0x82, 0x00, 0x41, 0x6C, 0x6E, 0xC0, 0x05, 0x9E, 0x11, 0x02, 0x6C, 0x6E, 0x0B, 0x07, 0x01,
+    0x68, 0x08, 0x01, 0x74, 0x7D, 0x01, 0x64, 0xC0, 0x04, 0x6E, 0x01, 0x6C, 0x7B, 0x84, 0x00, 0xD2,
+    0x61, 0x65, 0x69, 0x6F, 0x64, 0x6D, 0x75, 0x7D, 0x80, 0x0C, 0x74, 0x01, 0x79, 0x7D, 0x01, 0x6D,
+    0x7D, 0x01, 0x61, 0x7D, 0x01, 0x62, 0x05, 0x80, 0x0C, 0xD2, 0x01, 0x74, 0xC0, 0x0D, 0x3F, 0x05,
+    0x61, 0x64, 0x69, 0x75, 0x76, 0x75, 0x78, 0xC0, 0x13, 0xF0, 0x7B, 0x08, 0x03, 0x2E, 0x61, 0x67,
+    0xC0, 0x22, 0x66, 0x0B, 0x00, 0x02, 0x63, 0x7A, 0x08, 0x07, 0x02, 0x69, 0x79, 0x7B, 0x07, 0x81,
+    0x00, 0x51, 0x68, 0x7B, 0x02, 0x63, 0x64, 0x09, 0x09, 0x81, 0x00, 0x01, 0x69, 0x02, 0x89, 0x00,
+    0x71, 0x63, 0x66, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x76, 0x2B, 0xC0, 0x07, 0x01, 0xBF, 0xC3,
+    0xBF, 0xD1, 0x0C, 0xBF, 0xDE, 0x71, 0x76, 0x7B, 0x80, 0x0C, 0x52, 0x01, 0x6E, 0xC0, 0x22, 0xD0,
+    0x02, 0x65, 0x69, 0x78, 0x7B, 0x83, 0x00, 0xD1, 0x63, 0x69, 0x6E, 0x7B, 0x08, 0x00, 0x01, 0x69,
+    0xC0, 0x06, 0x97, 0x04, 0x63, 0x6E, 0x6F, 0x72, 0x7B, 0xC0, 0x1B, 0x19, 0xC0, 0x12, 0x04, 0x13,
+    0x81, 0x01, 0x51, 0x6F, 0xC0, 0x07, 0x2A, 0x81, 0x00, 0x21, 0x72, 0x79, 0x02, 0x65, 0x6F, 0x7B,
+    0x0F, 0x01, 0x69, 0xC0, 0x08, 0xDF, 0x04, 0x63, 0x6C, 0x6E, 0x6F, 0x7B, 0x0B, 0x35, 0x04, 0x01,
+    0x77, 0xC0, 0x03, 0x70, 0x01, 0x73, 0x7B, 0x01, 0x65, 0x7D, 0x80, 0x0C, 0x01, 0x02, 0x63, 0x77,
+    0x7D, 0x7D, 0x01, 0x73, 0x7B, 0x81, 0x01, 0x41, 0x74, 0x7D, 0x04, 0x6B, 0x6E, 0x72, 0x74, 0x6D,
+    0x03, 0x7B, 0x04, 0x06, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0xBF, 0xA2, 0xBF, 0xB0, 0xBF, 0xC9,
+    0xBF, 0xD3, 0xC0, 0x20, 0x6B, 0x77, 0x01, 0x6C, 0xC0, 0x0C, 0x0E, 0x01, 0x6F, 0xC0, 0x1B, 0x5C,
+    0x01, 0x74, 0x7B, 0x02, 0x61, 0x69, 0x73, 0x7D, 0x01, 0x75, 0x7B, 0x80, 0x0B, 0xA4, 0x01, 0x75,
+    0x7D, 0x01, 0x68, 0x7D, 0x82, 0x00, 0x11, 0x63, 0x73, 0x7D, 0x11, 0x04, 0x6C, 0x6E, 0x73, 0x74,
+    0x06, 0xAD, 0xEE, 0xC0, 0x1A, 0x9A, 0x07, 0x01, 0x61, 0x3E, 0x01, 0x6E, 0xC0, 0x1D, 0x6D, 0x81,
+    0x00, 0x51, 0x72, 0x00, 0x80, 0x0B, 0x53, 0x01, 0x62, 0x7D, 0x01, 0x61, 0x7D, 0x01, 0x6E, 0x7D,
+    0x84, 0x00, 0x11, 0x61, 0x65, 0x67, 0x6C, 0x6A, 0x6F, 0x7D, 0xC0, 0x0A, 0x8C, 0x81, 0x00, 0x51,
+    0x69, 0x05, 0x01, 0x64, 0xC0, 0x07, 0xC2, 0x01, 0x6E, 0x7B, 0x01, 0x65, 0x7D, 0x8B, 0x00, 0xD1,
+    0x61, 0x63, 0x65, 0x68, 0x69, 0x6C, 0x6E, 0x70, 0x74, 0x75, 0x77, 0xBF, 0xB7, 0xC0, 0x15, 0xC9,
+    0xBF, 0xBE, 0xBF, 0xCA, 0x63, 0x70, 0x03, 0x7D, 0x10, 0xC0, 0x0D, 0x9A, 0x02, 0x02, 0x69, 0x70,
+    0x0B, 0xC0, 0x22, 0xD0, 0x80, 0x0A, 0xF3, 0x01, 0x69, 0x7D, 0x01, 0x68, 0x7D, 0x01, 0x73, 0x7D,
+    0x02, 0x64, 0x74, 0x08, 0x7D, 0x01, 0x74, 0xAD, 0x43, 0x02, 0x2E, 0x69, 0x08, 0x14, 0x07, 0x67,
+    0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x74, 0x12, 0x12, 0xBF, 0xDF, 0x72, 0xC0, 0x1C, 0x8E, 0x77, 0x7B,
+    0x02, 0x6E, 0x6F, 0xC0, 0x05, 0x52, 0x07, 0x81, 0x01, 0x11, 0x61, 0x0F, 0x03, 0x64, 0x72, 0x77,
+    0x03, 0x74, 0x7B, 0x81, 0x00, 0x11, 0x6B, 0x08, 0x87, 0x01, 0x91, 0x2E, 0x61, 0x63, 0x65, 0x66,
+    0x6E, 0x72, 0x03, 0x07, 0x7B, 0x03, 0x06, 0xC0, 0x1F, 0x85, 0x08, 0x01, 0x65, 0x0D, 0x80, 0x0A,
+    0xB2, 0x01, 0x62, 0x7D, 0x02, 0x61, 0x65, 0x7D, 0x0C, 0x05, 0x63, 0x6D, 0x6E, 0x70, 0x72, 0xC0,
+    0x1D, 0x75, 0xC0, 0x2B, 0x9C, 0xA1, 0xD1, 0x03, 0x7B, 0x80, 0x03, 0xD2, 0x01, 0x67, 0x7D, 0x02,
+    0x61, 0x75, 0x7D, 0x08, 0x03, 0x64, 0x74, 0x79, 0x03, 0x7B, 0x03, 0x02, 0x62, 0x64, 0xC0, 0x08,
+    0x75, 0x03, 0x83, 0x00, 0xB1, 0x61, 0x69, 0x79, 0x72, 0x79, 0x04, 0x01, 0x63, 0x27, 0x80, 0x0A,
+    0x83, 0x01, 0x64, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x70, 0x7D, 0x01, 0x69, 0xC0, 0x23, 0xFE, 0x81,
+    0x00, 0x21, 0x6C, 0x7B, 0x0D, 0x2E, 0x61, 0x62, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x73, 0x75,
+    0x77, 0x79, 0x13, 0xBF, 0x6A, 0x02, 0xBF, 0x88, 0xC0, 0x18, 0x75, 0xBF, 0x94, 0xBF, 0xA7, 0xBF,
+    0xB5, 0xBF, 0xDE, 0x67, 0x73, 0xC0, 0x12, 0xDE, 0x7B, 0x02, 0x73, 0x74, 0x02, 0x11, 0x81, 0x01,
+    0x91, 0x69, 0x0A, 0x80, 0x0A, 0x33, 0x01, 0x65, 0x7D, 0x01, 0x72, 0x7D, 0x01, 0x65, 0x7D, 0x89,
+    0x00, 0x71, 0x61, 0x62, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0xA1, 0xDC, 0xC0, 0x19, 0x07,
+    0xBB, 0xF0, 0x6A, 0x03, 0x6F, 0x10, 0x7D, 0x10, 0x80, 0x0A, 0x21, 0x01, 0x6D, 0x7D, 0x01, 0x6D,
+    0x7D, 0x82, 0x01, 0x91, 0x69, 0x6F, 0x7D, 0x04, 0x02, 0x63, 0x6F, 0x18, 0x09, 0x01, 0x69, 0x1D,
+    0x80, 0x09, 0xF3, 0x01, 0x69, 0x7D, 0x01, 0x68, 0x7D, 0x85, 0x00, 0x51, 0x63, 0x6C, 0x6E, 0x72,
+    0x74, 0x04, 0x0C, 0x6F, 0x74, 0x7D, 0x17, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0xBA, 0xEC,
+    0x25, 0xBB, 0x8A, 0x25, 0xBC, 0x36, 0xC0, 0x10, 0x1E, 0x3B, 0xBC, 0x84, 0xBC, 0xDA, 0xBD, 0x0E,
+    0xBD, 0x2E, 0xBD, 0x57, 0xC0, 0x18, 0xEB, 0xBD, 0xA8, 0xBE, 0x2D, 0xBE, 0x52, 0x0D, 0xBE, 0xA7,
+    0xBF, 0x7E, 0xBF, 0xB9, 0x04, 0xBF, 0xDB, 0x73, 0x01, 0x65, 0xC0, 0x0C, 0xB6, 0x80, 0x09, 0xC3,
+    0x01, 0x6D, 0x7D, 0x02, 0x73, 0x7A, 0x7D, 0x08, 0x01, 0x69, 0x7B, 0x01, 0x6C, 0x7D, 0x82, 0x00,
+    0xD1, 0x6C, 0x6F, 0x6A, 0x7D, 0x01, 0x6E, 0xC0, 0x0D, 0xDA, 0x01, 0x6F, 0x7B, 0x01, 0x6C, 0xC0,
+    0x03, 0xC3, 0x81, 0x00, 0x01, 0x61, 0xC0, 0x17, 0xF4, 0x01, 0x69, 0xC0, 0x14, 0xF3, 0x86, 0x01,
+    0x91, 0x61, 0x65, 0x69, 0x6B, 0x6C, 0x6F, 0x02, 0x28, 0x0A, 0x74, 0x7B, 0x35, 0x01, 0x6E, 0xA9,
+    0x6D, 0x02, 0x69, 0x6F, 0x7C, 0x02, 0x01, 0x61, 0x2F, 0x02, 0x64, 0x74, 0x15, 0x7D, 0x80, 0x09,
+    0x82, 0x01, 0x68, 0x7D, 0x01, 0x74, 0x7D, 0x03, 0x61, 0x65, 0x6C, 0x7D, 0x27, 0x02, 0x80, 0x09,
+    0x62, 0x01, 0x68, 0x7D, 0x05, 0x61, 0x63, 0x65, 0x69, 0x72, 0x00, 0x04, 0x04, 0xC0, 0x10, 0x36,
+    0x7D, 0x02, 0x65, 0x79, 0x00, 0x02, 0x02, 0x69, 0x75, 0xC0, 0x0A, 0xD8, 0x39, 0x92, 0x00, 0x71,
+    0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x0C, 0xBF, 0x91, 0xC0, 0x0A, 0xB6, 0x30, 0xC0, 0x12, 0x01, 0xBF, 0x9D, 0xBF, 0xA0,
+    0xBF, 0xB1, 0xBF, 0xC4, 0xBF, 0xCC, 0xBF, 0xDA, 0x67, 0x74, 0x79, 0xC0, 0x03, 0x8E, 0x00, 0x13,
+    0xBF, 0xAC, 0x01, 0x72, 0xA2, 0xE7, 0x01, 0x65, 0x7C, 0x83, 0x00, 0x51, 0x63, 0x65, 0x69, 0x14,
+    0x33, 0x7D, 0x82, 0x00, 0x01, 0x68, 0x72, 0x77, 0x0D, 0x01, 0x68, 0xBA, 0x66, 0x03, 0x63, 0x64,
+    0x74, 0x7C, 0xC0, 0x03, 0xD6, 0x04, 0x02, 0x65, 0x74, 0x0B, 0x08, 0x81, 0x00, 0xD2, 0x69, 0x02,
+    0x82, 0x00, 0x61, 0x65, 0x69, 0x27, 0x02, 0x01, 0x6F, 0xA4, 0xD3, 0x02, 0x67, 0x72, 0xC0, 0x03,
+    0xD0, 0x7C, 0x04, 0x2E, 0x65, 0x69, 0x73, 0x0C, 0x79, 0x0B, 0x08, 0x81, 0x05, 0xB2, 0x74, 0x0A,
+    0x01, 0x61, 0x7B, 0x01, 0x6E, 0x0C, 0x81, 0x00, 0x71, 0x61, 0xA8, 0xBE, 0x05, 0x61, 0x63, 0x64,
+    0x65, 0x74, 0x77, 0x0C, 0x0C, 0xC0, 0x1C, 0x52, 0x7A, 0x81, 0x00, 0xB1, 0x65, 0x02, 0x80, 0x09,
+    0x02, 0x80, 0x06, 0x92, 0x01, 0x69, 0x7D, 0x01, 0x65, 0x7D, 0x84, 0x00, 0x71, 0x63, 0x65, 0x73,
+    0x7A, 0xC0, 0x11, 0x81, 0x3A, 0x0A, 0xC0, 0x06, 0x43, 0x01, 0x69, 0xC0, 0x2B, 0x44, 0x06, 0x63,
+    0x64, 0x67, 0x69, 0x6E, 0x76, 0x0A, 0x60, 0x69, 0x6C, 0x7B, 0x09, 0x80, 0x08, 0xE2, 0x01, 0x73,
+    0x7D, 0x82, 0x00, 0x01, 0x2E, 0x65, 0x06, 0x7D, 0x02, 0x2E, 0x73, 0x04, 0x79, 0x01, 0x68, 0x3D,
+    0x11, 0x2E, 0x61, 0x63, 0x64, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75,
+    0x78, 0x79, 0x04, 0xBF, 0x6D, 0xBF, 0x76, 0xBF, 0x7B, 0x18, 0xBF, 0x80, 0xBF, 0x92, 0xBF, 0xA0,
+    0xBF, 0xAC, 0x18, 0xBF, 0xB9, 0xBF, 0xDE, 0x78, 0x7D, 0x0C, 0x0C, 0x04, 0x01, 0x6D, 0xC0, 0x2D,
+    0x65, 0x01, 0x61, 0x7B, 0x02, 0x6C, 0x6E, 0x7D, 0x0B, 0x82, 0x00, 0x01, 0x73, 0x74, 0x01, 0x09,
+    0x83, 0x01, 0x91, 0x61, 0x69, 0x74, 0x79, 0xAA, 0xDF, 0x0C, 0x02, 0x2E, 0x61, 0x02, 0x02, 0x03,
+    0x63, 0x6C, 0x6E, 0x7B, 0x04, 0xC0, 0x1D, 0x75, 0x03, 0x65, 0x69, 0x6F, 0x02, 0xC0, 0x14, 0x5D,
+    0xC0, 0x11, 0xEE, 0x80, 0x08, 0xB3, 0x01, 0x69, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x80,
+    0x07, 0x22, 0x01, 0x72, 0x7D, 0x01, 0x65, 0x7D, 0x02, 0x74, 0x7A, 0x0F, 0x09, 0x01, 0x69, 0x7B,
+    0x05, 0x64, 0x67, 0x6B, 0x6F, 0x72, 0xBF, 0xD8, 0x6C, 0x75, 0x04, 0x7D, 0x01, 0x6E, 0xC0, 0x2D,
+    0x65, 0x01, 0x61, 0x7B, 0x02, 0x6C, 0x73, 0x7D, 0xC0, 0x10, 0xDC, 0x08, 0x2E, 0x61, 0x65, 0x69,
+    0x6C, 0x6F, 0x73, 0x79, 0x13, 0xBF, 0x99, 0xBF, 0xA5, 0xBF, 0xB4, 0x04, 0x65, 0x13, 0x79, 0x01,
+    0x2E, 0xC0, 0x15, 0x7C, 0x83, 0x00, 0x71, 0x62, 0x6E, 0x74, 0x05, 0x7B, 0x23, 0x80, 0x05, 0xA2,
+    0x80, 0x08, 0x42, 0x03, 0x6B, 0x6F, 0x75, 0x04, 0x03, 0x7D, 0x81, 0x01, 0x11, 0x79, 0x02, 0x81,
+    0x00, 0xD1, 0x75, 0x08, 0x01, 0x6C, 0xC0, 0x20, 0xA7, 0x82, 0x00, 0x71, 0x70, 0x75, 0x04, 0xC0,
+    0x12, 0x4C, 0x01, 0x6D, 0xB3, 0x7E, 0x84, 0x00, 0xD2, 0x61, 0x65, 0x69, 0x6F, 0x12, 0xC0, 0x17,
+    0x17, 0x0C, 0x7C, 0x01, 0x65, 0x3D, 0x82, 0x00, 0x71, 0x63, 0x6E, 0x02, 0x7D, 0x01, 0x63, 0xC0,
+    0x22, 0x51, 0x01, 0x69, 0x7B, 0x06, 0x61, 0x65, 0x6D, 0x6F, 0x70, 0x74, 0x01, 0x0C, 0x00, 0x02,
+    0x00, 0x7D, 0x81, 0x00, 0x71, 0x61, 0x00, 0x82, 0x00, 0x71, 0x61, 0x65, 0x01, 0xC0, 0x0D, 0x92,
+    0x11, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x71, 0x73, 0x74, 0x75,
+    0x76, 0x7A, 0xBF, 0x94, 0xBF, 0x9D, 0xBF, 0xA3, 0xC0, 0x18, 0x33, 0xBE, 0x83, 0xBF, 0xAA, 0xBF,
+    0xAF, 0xBF, 0xB4, 0xBF, 0xB9, 0xBF, 0xC6, 0xBF, 0xD6, 0x08, 0x65, 0x3C, 0x05, 0x72, 0x77, 0x81,
+    0x01, 0x21, 0x6E, 0x0B, 0x04, 0x2E, 0x64, 0x73, 0x74, 0x0C, 0x0C, 0xC0, 0x17, 0x17, 0xC0, 0x0A,
+    0xE0, 0x80, 0x07, 0xF2, 0x01, 0x72, 0x7D, 0x01, 0x65, 0x7D, 0x84, 0x00, 0xD1, 0x61, 0x65, 0x69,
+    0x6F, 0x65, 0x6A, 0x7D, 0x07, 0x81, 0x00, 0x02, 0x65, 0x00, 0x01, 0x72, 0xC0, 0x09, 0x57, 0x01,
+    0x72, 0x10, 0x01, 0x79, 0xC0, 0x03, 0xD0, 0x01, 0x67, 0x7B, 0x01, 0x6F, 0x7D, 0x03, 0x61, 0x62,
+    0x79, 0x10, 0x00, 0x01, 0x02, 0x6C, 0x74, 0x26, 0x01, 0x03, 0x61, 0x6F, 0x79, 0x7B, 0x04, 0x04,
+    0x02, 0x65, 0x7A, 0x01, 0x09, 0x02, 0x61, 0x69, 0x10, 0x7B, 0x02, 0x72, 0x74, 0x08, 0x04, 0x01,
+    0x61, 0xC0, 0x10, 0x51, 0x8E, 0x00, 0x71, 0x62, 0x63, 0x64, 0x66, 0x67, 0x69, 0x6C, 0x6D, 0x6E,
+    0x72, 0x73, 0x74, 0x75, 0x77, 0x01, 0xBF, 0xC6, 0xC0, 0x26, 0xDC, 0x13, 0xBF, 0xCB, 0xC0, 0x0B,
+    0x0F, 0xBF, 0xD6, 0xBF, 0xD9, 0x65, 0x71, 0x17, 0xC0, 0x10, 0xDF, 0x76, 0x7B, 0x81, 0x03, 0x01,
+    0x74, 0x0B, 0x03, 0x68, 0x69, 0x74, 0x09, 0x7B, 0x24, 0x80, 0x07, 0x52, 0x01, 0x72, 0x7D, 0x01,
+    0x6F, 0x7D, 0x01, 0x74, 0x7D, 0x80, 0x07, 0x72, 0x01, 0x62, 0x7D, 0x81, 0x02, 0x61, 0x61, 0x7D,
+    0x01, 0x73, 0x7B, 0x03, 0x6E, 0x72, 0x73, 0x09, 0x7D, 0xC0, 0x2A, 0xC7, 0x01, 0x65, 0x77, 0x85,
+    0x00, 0x71, 0x62, 0x63, 0x69, 0x73, 0x76, 0x0A, 0xBF, 0xD3, 0x63, 0x0B, 0x7D, 0x80, 0x07, 0x41,
+    0x01, 0x65, 0x7D, 0x01, 0x68, 0x7D, 0x01, 0x63, 0x7D, 0x81, 0x00, 0x61, 0x69, 0x0F, 0x03, 0x61,
+    0x66, 0x6D, 0x78, 0x09, 0x7B, 0x81, 0x00, 0xC1, 0x6C, 0xC0, 0x0A, 0xCB, 0x03, 0x65, 0x69, 0x73,
+    0x3A, 0xC0, 0x22, 0x51, 0x04, 0x04, 0x61, 0x63, 0x6D, 0x76, 0x70, 0x77, 0x13, 0x00, 0x02, 0x63,
+    0x74, 0xC0, 0x2F, 0x33, 0x0A, 0x01, 0x69, 0x79, 0x80, 0x06, 0x93, 0x01, 0x6D, 0x7D, 0x01, 0x75,
+    0x7D, 0x01, 0x65, 0x7D, 0x02, 0x69, 0x79, 0x0F, 0x04, 0x01, 0x73, 0xBE, 0x06, 0x80, 0x06, 0xF3,
+    0x01, 0x73, 0x7D, 0x80, 0x06, 0xC3, 0x02, 0x73, 0x74, 0x77, 0x7D, 0x02, 0x65, 0x69, 0x75, 0x7B,
+    0x01, 0x6C, 0x7B, 0x03, 0x68, 0x69, 0x6F, 0x1B, 0x66, 0x7D, 0x01, 0x70, 0x0A, 0x07, 0x66, 0x6C,
+    0x6D, 0x6E, 0x70, 0x73, 0x76, 0xBF, 0xC8, 0xBF, 0xD4, 0x2C, 0xBF, 0xD7, 0x76, 0x7D, 0x0A, 0x02,
+    0x69, 0x73, 0x09, 0x0B, 0x05, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xBF, 0x6B, 0xBF, 0x8A, 0xBF, 0xA1,
+    0x69, 0x7B, 0x81, 0x00, 0x51, 0x68, 0xC0, 0x07, 0xB6, 0x83, 0x00, 0x03, 0x63, 0x68, 0x77, 0x79,
+    0x00, 0x03, 0x80, 0x06, 0x72, 0x01, 0x74, 0x7D, 0x01, 0x75, 0x7D, 0x01, 0x62, 0x7D, 0x01, 0x69,
+    0x7D, 0x84, 0x06, 0x43, 0x65, 0x6F, 0x72, 0x75, 0xC0, 0x0B, 0x12, 0x07, 0x7D, 0x00, 0x81, 0x01,
+    0x01, 0x72, 0x01, 0x01, 0x69, 0xC0, 0x16, 0x39, 0x01, 0x2E, 0x3B, 0x81, 0x00, 0xC1, 0x73, 0x0A,
+    0x01, 0x72, 0x11, 0x01, 0x61, 0x7D, 0x05, 0x65, 0x69, 0x6E, 0x6F, 0x79, 0x0C, 0x75, 0x7D, 0x09,
+    0x02, 0x8B, 0x00, 0x71, 0x61, 0x62, 0x64, 0x65, 0x66, 0x69, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0xBF,
+    0xDD, 0x21, 0x17, 0x04, 0xC0, 0x12, 0x01, 0xC0, 0x16, 0xF3, 0x0C, 0x62, 0x67, 0x75, 0x0C, 0x84,
+    0x00, 0xB1, 0x61, 0x68, 0x69, 0x6F, 0x1F, 0x0D, 0xC0, 0x0B, 0x83, 0x04, 0x01, 0x6C, 0xC0, 0x13,
+    0x44, 0x03, 0x61, 0x65, 0x68, 0x7B, 0x11, 0x02, 0x83, 0x00, 0x71, 0x61, 0x6C, 0x70, 0x04, 0x13,
+    0x79, 0x16, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0xBB, 0xDC, 0xC0, 0x16, 0x07, 0xBC, 0x21, 0x1F,
+    0xBC, 0xBF, 0xC0, 0x16, 0x07, 0x1F, 0xBD, 0x5A, 0xBD, 0xDF, 0xBE, 0x29, 0xBE, 0x34, 0xC0, 0x2F,
+    0x30, 0xBE, 0x73, 0x1F, 0xBF, 0x63, 0xBF, 0x78, 0xBF, 0x90, 0xBF, 0xC0, 0x04, 0xBF, 0xDE, 0x77,
+    0xC0, 0x18, 0x87, 0x02, 0x69, 0x75, 0x01, 0x14, 0x01, 0x74, 0x7B, 0x01, 0x61, 0x7D, 0x01, 0x72,
+    0x7D, 0x02, 0x61, 0x69, 0x02, 0x00, 0x01, 0x6E, 0x33, 0x04, 0x61, 0x64, 0x69, 0x74, 0x7D, 0x17,
+    0x0A, 0x0A, 0x07, 0x62, 0x63, 0x64, 0x6E, 0x72, 0x74, 0x76, 0x04, 0x00, 0x6C, 0x6F, 0x77, 0x0D,
+    0x00, 0x81, 0x00, 0x41, 0x6F, 0x03, 0x82, 0x00, 0xB1, 0x6C, 0x72, 0x03, 0x7B, 0x01, 0x67, 0xC0,
+    0x0B, 0x15, 0x81, 0x01, 0xB2, 0x6E, 0x7B, 0x01, 0x65, 0xC0, 0x0A, 0x89, 0x03, 0x65, 0x69, 0x6C,
+    0x6A, 0x76, 0x7B, 0x02, 0x62, 0x74, 0x00, 0x05, 0x06, 0x61, 0x69, 0x6C, 0x72, 0x75, 0x79, 0x06,
+    0x7B, 0xC0, 0x06, 0x94, 0x06, 0x06, 0x03, 0x03, 0x72, 0x73, 0x76, 0x01, 0x1A, 0x0B, 0x02, 0x64,
+    0x73, 0x01, 0x01, 0x04, 0x63, 0x65, 0x73, 0x74, 0x0D, 0x7B, 0x02, 0x07, 0x81, 0x00, 0x51, 0x79,
+    0xC0, 0x2F, 0x12, 0x01, 0x6E, 0x79, 0x06, 0x64, 0x65, 0x69, 0x6F, 0x73, 0x75, 0x02, 0x61, 0x6D,
+    0x7D, 0x21, 0x03, 0x01, 0x6D, 0x14, 0x03, 0x65, 0x73, 0x74, 0x03, 0x0B, 0x15, 0x01, 0x69, 0xC0,
+    0x06, 0xF6, 0x03, 0x61, 0x6E, 0x72, 0x71, 0x74, 0x7B, 0x02, 0x61, 0x6C, 0x0C, 0x06, 0x01, 0x65,
+    0xC0, 0x11, 0xEE, 0x02, 0x68, 0x69, 0x7B, 0x1D, 0x81, 0x00, 0xB1, 0x67, 0x0D, 0x01, 0x6D, 0x00,
+    0x81, 0x02, 0x81, 0x65, 0xC0, 0x32, 0xB7, 0x85, 0x05, 0xA2, 0x6C, 0x6E, 0x72, 0x74, 0x76, 0xC0,
+    0x17, 0xA8, 0x71, 0x76, 0xC0, 0x06, 0x61, 0x79, 0x82, 0x00, 0x11, 0x62, 0x74, 0x09, 0xC0, 0x0D,
+    0x34, 0x81, 0x01, 0x41, 0x65, 0x08, 0x01, 0x68, 0x7B, 0x81, 0x00, 0xB1, 0x6E, 0x0D, 0x83, 0x01,
+    0x91, 0x61, 0x6E, 0x73, 0x07, 0xC0, 0x1F, 0x85, 0xC0, 0x0D, 0x8C, 0x02, 0x62, 0x73, 0xC0, 0x1E,
+    0x6C, 0x05, 0x02, 0x61, 0x69, 0x39, 0x79, 0x81, 0x00, 0x01, 0x65, 0x3A, 0x03, 0x69, 0x72, 0x75,
+    0x0E, 0xBA, 0x5A, 0x04, 0x81, 0x00, 0x41, 0x6C, 0x02, 0x0D, 0x61, 0x63, 0x64, 0x65, 0x67, 0x69,
+    0x6C, 0x6D, 0x6F, 0x73, 0x74, 0x75, 0x76, 0xBF, 0xBF, 0xBF, 0xCD, 0xA6, 0x8C, 0xBF, 0xD0, 0x21,
+    0xBF, 0xD5, 0x69, 0xC0, 0x12, 0xDE, 0xC0, 0x18, 0xEB, 0x6E, 0x73, 0x7B, 0x02, 0x02, 0x69, 0x6C,
+    0x05, 0xC0, 0x0E, 0xE5, 0x81, 0x00, 0x11, 0x6E, 0xC0, 0x1B, 0x4D, 0x01, 0x72, 0xC0, 0x06, 0x40,
+    0x05, 0x61, 0x62, 0x69, 0x6F, 0x70, 0xC0, 0x09, 0xB9, 0x6D, 0x74, 0x7B, 0x10, 0x81, 0x00, 0x21,
+    0x72, 0x05, 0x84, 0x00, 0x11, 0x6D, 0x6E, 0x73, 0x76, 0x05, 0x12, 0xC0, 0x0D, 0x8C, 0x0A, 0x81,
+    0x05, 0x22, 0x77, 0x05, 0x02, 0x72, 0x73, 0xC0, 0x0A, 0xCB, 0x05, 0x02, 0x61, 0x65, 0xB5, 0x63,
+    0x79, 0x08, 0x61, 0x65, 0x69, 0x73, 0x74, 0x75, 0x79, 0x7A, 0xC0, 0x07, 0x57, 0xBF, 0xDC, 0x61,
+    0x6E, 0x7A, 0x00, 0x02, 0x02, 0x03, 0x72, 0x73, 0x75, 0xC0, 0x0B, 0x12, 0x07, 0x0D, 0x81, 0x00,
+    0x11, 0x72, 0xC0, 0x08, 0x65, 0x02, 0x61, 0x6E, 0x07, 0xC0, 0x1F, 0x85, 0x01, 0x74, 0xC0, 0x03,
+    0x70, 0x01, 0x72, 0x7B, 0x81, 0x00, 0xF1, 0x6F, 0x7D, 0x02, 0x69, 0x75, 0xC0, 0x27, 0xBC, 0x0B,
+    0x05, 0x65, 0x69, 0x6C, 0x70, 0x74, 0xBF, 0xDE, 0x65, 0x06, 0x74, 0x79, 0x01, 0x2E, 0xC0, 0x22,
+    0xED, 0x84, 0x00, 0x11, 0x2E, 0x67, 0x6C, 0x73, 0x04, 0x03, 0x7B, 0x03, 0x02, 0x65, 0x72, 0x39,
+    0x05, 0x01, 0x6C, 0xC0, 0x32, 0xB4, 0x81, 0x00, 0x41, 0x69, 0xC0, 0x06, 0xC0, 0x06, 0x61, 0x66,
+    0x6E, 0x6F, 0x74, 0x7A, 0x74, 0x79, 0x0E, 0x06, 0x0D, 0x01, 0x01, 0x67, 0xC0, 0x20, 0xC6, 0x01,
+    0x6E, 0x7B, 0x81, 0x01, 0x91, 0x69, 0x7D, 0x81, 0x01, 0x41, 0x65, 0x05, 0x03, 0x65, 0x68, 0x69,
+    0xC0, 0x0C, 0xB6, 0xC0, 0x0B, 0x62, 0x7B, 0x0E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x69, 0x6C,
+    0x6E, 0x6F, 0x70, 0x73, 0x74, 0x75, 0xBF, 0xBA, 0x2B, 0x00, 0x0E, 0xC0, 0x03, 0x44, 0xBF, 0xC5,
+    0xBF, 0xD6, 0x6B, 0x23, 0xC0, 0x0B, 0x83, 0xC0, 0x2D, 0x3D, 0xC0, 0x0F, 0x5D, 0x75, 0x06, 0x03,
+    0x64, 0x6E, 0x70, 0x07, 0x07, 0x05, 0x81, 0x01, 0x11, 0x69, 0x01, 0x02, 0x61, 0x72, 0x09, 0xC0,
+    0x18, 0x5F, 0x02, 0x61, 0x63, 0x07, 0x06, 0x01, 0x72, 0x19, 0x02, 0x65, 0x72, 0x7D, 0x0E, 0x81,
+    0x00, 0x21, 0x72, 0x0B, 0x89, 0x00, 0xD1, 0x61, 0x63, 0x65, 0x69, 0x6C, 0x70, 0x73, 0x74, 0x75,
+    0xBF, 0xDB, 0x62, 0x67, 0x6E, 0xC0, 0x09, 0xE2, 0x0E, 0x20, 0x76, 0x7B, 0x02, 0x62, 0x74, 0x00,
+    0x06, 0x81, 0x00, 0x01, 0x69, 0x0B, 0x03, 0x2E, 0x6C, 0x6E, 0x04, 0x04, 0x7B, 0x02, 0x65, 0x67,
+    0x06, 0x01, 0x01, 0x6E, 0xC0, 0x29, 0x0D, 0x85, 0x00, 0x03, 0x6C, 0x6E, 0x6F, 0x73, 0x7A, 0xC0,
+    0x17, 0xA8, 0x76, 0x7B, 0x03, 0xC0, 0x0A, 0xE6, 0x01, 0x69, 0xC0, 0x2D, 0x94, 0x01, 0x74, 0x7B,
+    0x01, 0x61, 0x7D, 0x05, 0x66, 0x67, 0x6D, 0x6E, 0x75, 0x02, 0x09, 0x7D, 0x07, 0x03, 0x06, 0x61,
+    0x65, 0x69, 0x6C, 0x6F, 0x73, 0xBF, 0xBE, 0xBF, 0xC8, 0xBF, 0xD9, 0xC0, 0x0B, 0xAA, 0x75, 0x00,
+    0x81, 0x00, 0x41, 0x6D, 0x05, 0x16, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6A, 0x6B,
+    0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x78, 0x7A, 0xBD, 0x4D, 0xBD, 0x77,
+    0xBD, 0x83, 0xBD, 0xB1, 0xBD, 0xCD, 0xBD, 0xD4, 0xBD, 0xDE, 0xBD, 0xF2, 0x07, 0x04, 0xBE, 0x44,
+    0xBE, 0x7B, 0xBE, 0xAC, 0xBE, 0xC0, 0xBE, 0xEB, 0xBF, 0x42, 0xBF, 0x8F, 0x69, 0x7B, 0xC0, 0x16,
+    0xDE, 0xC0, 0x13, 0x29, 0x2B, 0x80, 0x04, 0xB3, 0x02, 0x69, 0x75, 0xC0, 0x12, 0x4C, 0x0A, 0x01,
+    0x72, 0xC0, 0x0A, 0x31, 0x01, 0x65, 0x7B, 0x82, 0x00, 0x61, 0x65, 0x75, 0x05, 0x7D, 0x03, 0x69,
+    0x6F, 0x75, 0x19, 0x09, 0x14, 0x01, 0x65, 0xC0, 0x0E, 0x98, 0x01, 0x69, 0x7B, 0x01, 0x76, 0x0D,
+    0x81, 0x01, 0x51, 0x69, 0x7D, 0x01, 0x76, 0x2F, 0x01, 0x65, 0x7D, 0x01, 0x64, 0x7D, 0x8B, 0x00,
+    0x71, 0x2E, 0x62, 0x63, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x74, 0x75, 0x08, 0xBF, 0xC7, 0xBF,
+    0xCA, 0xBF, 0xD9, 0x60, 0x30, 0xA3, 0x76, 0xC0, 0x29, 0xCA, 0x6C, 0x72, 0x7D, 0x04, 0x2E, 0x6C,
+    0x6F, 0x79, 0x06, 0x32, 0x05, 0x03, 0x02, 0x6F, 0x75, 0xC0, 0x04, 0xA1, 0x31, 0x80, 0x04, 0x82,
+    0x01, 0x67, 0x7D, 0x81, 0x00, 0x51, 0x79, 0xAA, 0x37, 0x81, 0x00, 0x41, 0x63, 0x09, 0x05, 0x2E,
+    0x69, 0x6C, 0x6E, 0x73, 0x08, 0x72, 0x75, 0x7B, 0x03, 0x01, 0x69, 0xC0, 0x15, 0xE5, 0x01, 0x65,
+    0x0C, 0x06, 0x64, 0x65, 0x69, 0x6D, 0x73, 0x74, 0x03, 0x6D, 0xC0, 0x08, 0x99, 0x78, 0x7D, 0xC0,
+    0x23, 0x97, 0x01, 0x74, 0xC0, 0x22, 0x3C, 0x02, 0x65, 0x69, 0x00, 0x7B, 0x82, 0x04, 0x62, 0x2E,
+    0x74, 0x04, 0x7B, 0x81, 0x00, 0xB1, 0x72, 0x0A, 0x02, 0x65, 0x79, 0x7B, 0x05, 0x08, 0x2E, 0x64,
+    0x67, 0x6C, 0x6E, 0x72, 0x73, 0x74, 0x04, 0x04, 0x0A, 0xBF, 0xA0, 0xBF, 0xA9, 0xBF, 0xD4, 0x6F,
+    0x7B, 0x02, 0x6C, 0x6E, 0xC0, 0x29, 0xCA, 0x08, 0x04, 0x2E, 0x64, 0x6E, 0x73, 0x08, 0x08, 0xC0,
+    0x10, 0x1E, 0x08, 0x02, 0x65, 0x69, 0x75, 0x08, 0x02, 0x74, 0x7A, 0x08, 0xC0, 0x2F, 0x61, 0x81,
+    0x00, 0xD1, 0x69, 0x79, 0x84, 0x00, 0x11, 0x61, 0x63, 0x64, 0x67, 0xC0, 0x0A, 0x56, 0x12, 0x09,
+    0x04, 0x03, 0x6C, 0x72, 0x75, 0x0A, 0x38, 0x0E, 0x03, 0x69, 0x6F, 0x75, 0xC0, 0x03, 0x3B, 0x01,
+    0x01, 0x03, 0x69, 0x72, 0x79, 0x04, 0x0A, 0x04, 0x80, 0x04, 0x13, 0x01, 0x72, 0x7D, 0x01, 0x61,
+    0x7D, 0x01, 0x70, 0x7D, 0x81, 0x01, 0x51, 0x69, 0x7D, 0x0D, 0x61, 0x64, 0x66, 0x67, 0x6B, 0x6C,
+    0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x76, 0xBF, 0xA8, 0xBF, 0xBA, 0x06, 0x1D, 0x00, 0xBF, 0xC6,
+    0xBF, 0xCB, 0xBF, 0xD8, 0x05, 0x30, 0xBF, 0xDF, 0x68, 0x7B, 0x01, 0x70, 0xC0, 0x07, 0x2A, 0x01,
+    0x65, 0x7B, 0x80, 0x03, 0xE3, 0x01, 0x75, 0x7D, 0x01, 0x64, 0x7D, 0x82, 0x00, 0x61, 0x63, 0x72,
+    0x74, 0x7D, 0x04, 0x61, 0x65, 0x74, 0x76, 0x05, 0x07, 0x08, 0x0C, 0x03, 0x61, 0x69, 0x79, 0xC0,
+    0x27, 0xBC, 0x0B, 0x05, 0x02, 0x61, 0x65, 0x05, 0xC0, 0x20, 0x7A, 0x07, 0x2E, 0x69, 0x6B, 0x6C,
+    0x6D, 0x72, 0x74, 0x08, 0x60, 0x0C, 0x67, 0x2C, 0x70, 0x79, 0x06, 0x61, 0x65, 0x69, 0x6F, 0x76,
+    0x79, 0xBE, 0xB4, 0xBF, 0x33, 0xBF, 0x9F, 0x71, 0xC0, 0x0A, 0x56, 0x03, 0x01, 0x6C, 0x07, 0x02,
+    0x65, 0x6F, 0x27, 0x09, 0x80, 0x03, 0x83, 0x01, 0x61, 0x7D, 0x01, 0x77, 0x7D, 0x81, 0x00, 0x61,
+    0x65, 0x7D, 0x01, 0x74, 0x7B, 0x01, 0x65, 0x0E, 0x80, 0x03, 0x62, 0x02, 0x67, 0x72, 0x7D, 0x02,
+    0x01, 0x65, 0x7B, 0x0A, 0x62, 0x63, 0x67, 0x69, 0x6C, 0x6D, 0x72, 0x73, 0x74, 0x76, 0xBF, 0xD9,
+    0x13, 0xBF, 0xDC, 0x37, 0xC0, 0x0A, 0xE0, 0x00, 0xC0, 0x04, 0x6B, 0x6F, 0x72, 0x7D, 0x02, 0x72,
+    0x74, 0xC0, 0x07, 0xDA, 0xC0, 0x11, 0x35, 0x01, 0x6E, 0x1E, 0x03, 0x6B, 0x74, 0x76, 0x7D, 0x11,
+    0x09, 0x07, 0x61, 0x64, 0x65, 0x6C, 0x72, 0x73, 0x76, 0x6D, 0xC0, 0x1B, 0x10, 0x79, 0xC0, 0x06,
+    0xF6, 0x0D, 0xC0, 0x07, 0x01, 0x06, 0x01, 0x70, 0x0F, 0x01, 0x73, 0x7D, 0x01, 0x65, 0x7D, 0x81,
+    0x01, 0x11, 0x6C, 0xC0, 0x20, 0xA7, 0x02, 0x64, 0x67, 0x15, 0x00, 0x87, 0x01, 0x91, 0x64, 0x6C,
+    0x6E, 0x72, 0x73, 0x74, 0x7A, 0x71, 0x74, 0x7B, 0x00, 0xBE, 0x73, 0xC0, 0x06, 0xFE, 0x09, 0x02,
+    0x65, 0x69, 0xC0, 0x16, 0x39, 0xC0, 0x0D, 0x92, 0x01, 0x6E, 0xC0, 0x1A, 0x54, 0x01, 0x65, 0x7B,
+    0x01, 0x65, 0x1D, 0x83, 0x03, 0x12, 0x6B, 0x6D, 0x76, 0x7A, 0x14, 0x7D, 0x01, 0x6F, 0x11, 0x01,
+    0x72, 0x7D, 0x01, 0x61, 0x7D, 0x81, 0x00, 0x61, 0x70, 0x7D, 0x02, 0x61, 0x65, 0x1C, 0xC0, 0x2D,
+    0x5F, 0x81, 0x00, 0x61, 0x74, 0x79, 0x02, 0x61, 0x69, 0x6F, 0x7B, 0x04, 0x68, 0x6C, 0x70, 0x74,
+    0x06, 0x05, 0x2B, 0xC0, 0x12, 0xBE, 0x0F, 0x61, 0x62, 0x63, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6E,
+    0x6F, 0x70, 0x72, 0x73, 0x74, 0x79, 0xBF, 0x4D, 0x0D, 0x06, 0xBF, 0x7B, 0x26, 0xBF, 0xA5, 0x03,
+    0xBF, 0xB9, 0xA1, 0xF8, 0xBF, 0xCD, 0x07, 0x70, 0x75, 0x04, 0x05, 0x85, 0x00, 0x11, 0x63, 0x67,
+    0x6D, 0x70, 0x73, 0x1B, 0xA1, 0xD3, 0x0A, 0x03, 0x09, 0x80, 0x01, 0x62, 0x01, 0x75, 0xC0, 0x17,
+    0x02, 0x02, 0x69, 0x6F, 0x00, 0x02, 0x83, 0x00, 0x11, 0x63, 0x64, 0x72, 0x76, 0x12, 0x7B, 0x81,
+    0x01, 0x11, 0x6C, 0x0F, 0x82, 0x00, 0x11, 0x69, 0x75, 0x7B, 0x00, 0x02, 0x65, 0x69, 0x03, 0xC0,
+    0x0E, 0x2C, 0x84, 0x00, 0x41, 0x61, 0x63, 0x64, 0x6D, 0x02, 0x02, 0xC0, 0x29, 0xCA, 0x79, 0x01,
+    0x6E, 0xC0, 0x1B, 0x19, 0x01, 0x6F, 0xC0, 0x03, 0x70, 0x01, 0x74, 0x7B, 0x02, 0x63, 0x64, 0x7D,
+    0x0A, 0x82, 0x00, 0x41, 0x61, 0x65, 0x6E, 0x7B, 0x01, 0x73, 0x2F, 0x01, 0x69, 0x7D, 0x81, 0x00,
+    0x11, 0x75, 0x7D, 0x81, 0x00, 0x12, 0x69, 0x06, 0x81, 0x00, 0x11, 0x61, 0x01, 0x0B, 0x61, 0x63,
+    0x65, 0x68, 0x69, 0x6F, 0x70, 0x71, 0x74, 0x75, 0x78, 0xBF, 0x8E, 0xBF, 0x9C, 0xBF, 0xA9, 0xBF,
+    0xB7, 0xBF, 0xC5, 0xC0, 0x1C, 0xE7, 0x64, 0x71, 0x76, 0x7B, 0x05, 0x03, 0x63, 0x72, 0x74, 0x07,
+    0xC0, 0x25, 0x80, 0x07, 0x81, 0x00, 0x61, 0x64, 0xA4, 0x6A, 0x81, 0x00, 0x41, 0x65, 0x7A, 0x02,
+    0x6D, 0x74, 0x0B, 0x0B, 0x83, 0x00, 0x11, 0x65, 0x68, 0x6F, 0xC0, 0x1E, 0x02, 0x76, 0x7B, 0x81,
+    0x00, 0x11, 0x66, 0x03, 0x01, 0x79, 0xC0, 0x08, 0x22, 0x01, 0x72, 0x7B, 0x01, 0x65, 0x7D, 0x81,
+    0x00, 0x61, 0x74, 0x7D, 0x04, 0x65, 0x72, 0x73, 0x74, 0x07, 0x6B, 0x7B, 0x05, 0x04, 0x61, 0x6C,
+    0x6F, 0x75, 0x06, 0xC0, 0x38, 0x03, 0x06, 0x07, 0x01, 0x6C, 0x16, 0x01, 0x6F, 0x7D, 0x01, 0x79,
+    0xC0, 0x09, 0x5A, 0x01, 0x72, 0x7B, 0x81, 0x00, 0x61, 0x74, 0x7D, 0x03, 0x62, 0x65, 0x70, 0x70,
+    0x7B, 0xC0, 0x2B, 0x9C, 0x05, 0x63, 0x64, 0x67, 0x69, 0x78, 0xC0, 0x35, 0x56, 0x02, 0x02, 0xC0,
+    0x0B, 0x0F, 0x08, 0x02, 0x65, 0x73, 0x1A, 0x03, 0x85, 0x01, 0xB2, 0x64, 0x67, 0x6D, 0x6E, 0x73,
+    0x02, 0xC0, 0x0B, 0x15, 0x00, 0x7B, 0x03, 0x02, 0x64, 0x72, 0x03, 0x0F, 0x81, 0x00, 0x41, 0x63,
+    0x03, 0x01, 0x61, 0x10, 0x05, 0x65, 0x69, 0x6F, 0x74, 0x75, 0x73, 0x01, 0x78, 0x7D, 0x07, 0x04,
+    0x61, 0x69, 0x6F, 0x72, 0xC0, 0x12, 0x2A, 0x2A, 0x06, 0x05, 0x03, 0x63, 0x6F, 0x73, 0x22, 0x01,
+    0x0C, 0x01, 0x6F, 0x0D, 0x82, 0x01, 0x01, 0x61, 0x72, 0x01, 0x7D, 0x07, 0x63, 0x65, 0x69, 0x6F,
+    0x73, 0x74, 0x75, 0x05, 0xBE, 0xBE, 0x6F, 0x03, 0x00, 0x79, 0xC0, 0x04, 0x9B, 0x01, 0x69, 0xC0,
+    0x22, 0x60, 0x02, 0x68, 0x69, 0x7B, 0xC0, 0x13, 0xF0, 0x11, 0x61, 0x62, 0x63, 0x64, 0x65, 0x67,
+    0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x77, 0xBF, 0x22, 0x0D, 0xBF, 0x3B,
+    0x0D, 0xBF, 0x5B, 0xC0, 0x0D, 0x34, 0xC0, 0x10, 0x1E, 0x0D, 0xBF, 0x64, 0xBF, 0x82, 0xBF, 0x8B,
+    0xBF, 0x9F, 0xBF, 0xBB, 0xBF, 0xC6, 0x62, 0x79, 0x0D, 0x82, 0x01, 0x01, 0x62, 0x72, 0xC0, 0x17,
+    0x76, 0x17, 0x81, 0x00, 0x11, 0x6F, 0x01, 0x84, 0x00, 0xD1, 0x6E, 0x70, 0x72, 0x74, 0x05, 0x05,
+    0x7B, 0x00, 0x01, 0x6E, 0xC0, 0x0A, 0x89, 0x83, 0x00, 0xD2, 0x61, 0x6C, 0x73, 0x7B, 0x03, 0x03,
+    0x80, 0x00, 0x82, 0x01, 0x72, 0x7D, 0x01, 0x68, 0x7D, 0x83, 0x00, 0x71, 0x6D, 0x6F, 0x70, 0x05,
+    0x20, 0x7D, 0x82, 0x00, 0x03, 0x77, 0x79, 0xC0, 0x2E, 0xE3, 0x03, 0x09, 0x61, 0x62, 0x65, 0x69,
+    0x6C, 0x6D, 0x6F, 0x74, 0x7A, 0xBF, 0xBE, 0x04, 0xBF, 0xCC, 0xBF, 0xDC, 0x08, 0x04, 0x6E, 0x15,
+    0x77, 0x1B, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D,
+    0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xC0, 0x08, 0xED,
+    0xC0, 0x0F, 0x09, 0xC0, 0x11, 0xB8, 0xC0, 0x15, 0x50, 0xC0, 0x18, 0xAE, 0xC0, 0x1F, 0xA2, 0xC0,
+    0x21, 0x72, 0xC0, 0x23, 0xC5, 0xC0, 0x26, 0x38, 0xC0, 0x2B, 0x52, 0xC0, 0x2B, 0xDD, 0xC0, 0x2C,
+    0x8C, 0xC0, 0x30, 0xB9, 0xC0, 0x34, 0x51, 0xC0, 0x38, 0x92, 0xA3, 0xC3, 0xA7, 0x9F, 0xA8, 0x1F,
+    0xAD, 0x9C, 0xB3, 0x35, 0xB8, 0x20, 0xBB, 0x34, 0xBC, 0xF9, 0xBD, 0xE5, 0xBE, 0x7C, 0xBF, 0x78,
+    0x6A,
 };
 
 constexpr SerializedHyphenationPatterns en_patterns = {
-    0x68EDu,
+    0x5A11u,
+    0x260u,
     en_trie_data,
     sizeof(en_trie_data),
 };
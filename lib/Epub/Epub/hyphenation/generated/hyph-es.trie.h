@@ -7,863 +7,766 @@
 
 // Auto-generated by generate_hyphenation_trie.py. Do not edit manually.
 alignas(4) constexpr uint8_t es_trie_data[] = {
-    0x01, 0x04, 0x16, 0x02, 0x0E, 0x0C, 0x02, 0x16, 0x02, 0x0D, 0x0C, 0x22, 0x0F, 0x2C, 0x0F, 0x22,
-    0x0D, 0x2C, 0x0D, 0x0B, 0x16, 0x0B, 0x20, 0x15, 0x16, 0x15, 0x0C, 0x02, 0x0C, 0x17, 0x0E, 0x04,
-    0x2C, 0x05, 0x04, 0x0D, 0x04, 0x21, 0x04, 0x18, 0x0D, 0x04, 0x17, 0x04, 0x0D, 0x17, 0x04, 0x0E,
-    0x0D, 0x04, 0x0D, 0x21, 0x04, 0x0D, 0x21, 0x21, 0x0F, 0x0E, 0x0F, 0x0E, 0x0D, 0x0F, 0x0E, 0x17,
-    0x33, 0x33, 0x0C, 0x33, 0x16, 0x29, 0x29, 0x0C, 0x29, 0x16, 0x21, 0x0C, 0x21, 0x0E, 0x34, 0x0D,
-    0x3E, 0x36, 0x0D, 0x3F, 0x2B, 0x16, 0x0D, 0x3D, 0x3D, 0x0C, 0x3D, 0x16, 0x1F, 0x1F, 0x16, 0x2A,
-    0x2C, 0x0D, 0x0E, 0x0E, 0x21, 0x1F, 0x0C, 0x2A, 0x0D, 0x2A, 0x0B, 0x2A, 0x0B, 0x0C, 0x2A, 0x0B,
-    0x16, 0x37, 0x20, 0x0C, 0x20, 0x16, 0x35, 0x24, 0x47, 0x47, 0x0C, 0x47, 0x16, 0x20, 0x0B, 0x20,
-    0x0D, 0x0C, 0x20, 0x0D, 0x16, 0x20, 0x20, 0x03, 0x17, 0x0E, 0x0D, 0x23, 0x0E, 0x17, 0x17, 0x17,
-    0x21, 0x16, 0x0D, 0x18, 0x48, 0x49, 0x16, 0x0C, 0x0C, 0x16, 0x0C, 0x16, 0x2D, 0x2B, 0x0E, 0x0D,
-    0x2B, 0x0E, 0x17, 0x17, 0x2B, 0x34, 0x0B, 0x34, 0x0B, 0x0C, 0x34, 0x0B, 0x16, 0x21, 0x20, 0x0D,
-    0x21, 0x0E, 0x17, 0x20, 0x0D, 0x04, 0x0F, 0x19, 0x0C, 0x0D, 0x2E, 0x0F, 0x0E, 0x21, 0x17, 0x0E,
-    0x2D, 0x0E, 0x2B, 0x0E, 0x22, 0x17, 0x17, 0x0E, 0x22, 0x0D, 0x0E, 0x38, 0x19, 0x18, 0x03, 0x0C,
-    0x22, 0x0B, 0x0E, 0x22, 0x0B, 0x18, 0x40, 0x2A, 0x0C, 0x0C, 0x2A, 0x0C, 0x16, 0x18, 0x0D, 0x0C,
-    0x18, 0x0D, 0x0E, 0x2B, 0x21, 0x2B, 0x17, 0x2A, 0x16, 0x02, 0x33, 0x02, 0x33, 0x0C, 0x02, 0x33,
-    0x16, 0x35, 0x0E, 0x04, 0x0C, 0x20, 0x0C, 0x0C, 0x20, 0x0C, 0x16, 0x2B, 0x0E, 0x0E, 0x2B, 0x0E,
-    0x18, 0x04, 0x0D, 0x0E, 0x0D, 0x19, 0x0E, 0x41, 0x10, 0x2A, 0x20, 0x04, 0x0C, 0x0D, 0x03, 0x0E,
-    0x16, 0x0D, 0x0E, 0x18, 0x0F, 0x05, 0x0E, 0x07, 0x0E, 0xA0, 0x00, 0x51, 0xA0, 0x00, 0x71, 0xA0,
-    0x00, 0xC3, 0xA3, 0x00, 0x71, 0x74, 0x6E, 0x7A, 0xFD, 0xFD, 0xFD, 0xA1, 0x00, 0x71, 0x74, 0xF4,
-    0xA1, 0x00, 0x71, 0x6E, 0xEF, 0xA3, 0x00, 0x71, 0x74, 0x73, 0x6E, 0xEA, 0xEA, 0xEA, 0xA2, 0x00,
-    0x71, 0x7A, 0x73, 0xE1, 0xE1, 0xA0, 0x00, 0xA2, 0xB6, 0x00, 0x91, 0x2E, 0x62, 0x63, 0x64, 0x66,
+    0x05, 0x0E, 0x07, 0x0E, 0x33, 0x16, 0x33, 0x0C, 0x04, 0x0E, 0x19, 0x02, 0x0D, 0x2D, 0x0E, 0x2B,
+    0x0E, 0x36, 0x17, 0x17, 0x0E, 0x2B, 0x0E, 0x22, 0x2E, 0x0F, 0x0E, 0x3D, 0x16, 0x3D, 0x0C, 0x18,
+    0x21, 0x1F, 0x16, 0x1F, 0x0C, 0x04, 0x0D, 0x04, 0x0C, 0x04, 0x0D, 0x21, 0x04, 0x0D, 0x21, 0x21,
+    0x03, 0x0E, 0x40, 0x29, 0x16, 0x29, 0x0C, 0x0E, 0x0D, 0x0F, 0x0E, 0x0D, 0x04, 0x0D, 0x0E, 0x0D,
+    0x04, 0x0D, 0x17, 0x0F, 0x0E, 0x17, 0x15, 0x20, 0x0C, 0x47, 0x16, 0x47, 0x0C, 0x15, 0x0C, 0x15,
+    0x16, 0x23, 0x3E, 0x04, 0x0E, 0x0D, 0x38, 0x0B, 0x20, 0x0B, 0x16, 0x04, 0x0C, 0x0D, 0x2C, 0x0D,
+    0x04, 0x17, 0x04, 0x21, 0x04, 0x18, 0x0D, 0x01, 0x02, 0x0D, 0x0C, 0x02, 0x16, 0x16, 0x0D, 0x02,
+    0x0C, 0x2A, 0x20, 0x2A, 0x16, 0x2A, 0x0B, 0x35, 0x2B, 0x17, 0x21, 0x17, 0x16, 0x0D, 0x0E, 0x24,
+    0x2A, 0x0B, 0x16, 0x2B, 0x0E, 0x17, 0x2B, 0x0E, 0x18, 0x2A, 0x0B, 0x0C, 0x2B, 0x0E, 0x0E, 0x2A,
+    0x0D, 0x35, 0x0E, 0x02, 0x33, 0x16, 0x02, 0x33, 0x0C, 0x22, 0x0F, 0x18, 0x0D, 0x0E, 0x18, 0x0D,
+    0x0C, 0x36, 0x0D, 0x2C, 0x0F, 0x41, 0x10, 0x19, 0x0E, 0x17, 0x0E, 0x0D, 0x04, 0x2C, 0x03, 0x0C,
+    0x04, 0x0F, 0x19, 0x0C, 0x0D, 0x19, 0x18, 0x2B, 0x0E, 0x0D, 0x49, 0x18, 0x0F, 0x16, 0x0D, 0x18,
+    0x23, 0x0E, 0x37, 0x22, 0x0D, 0x34, 0x0B, 0x16, 0x34, 0x0B, 0x0C, 0x21, 0x20, 0x0D, 0x34, 0x0D,
+    0x21, 0x17, 0x0E, 0x16, 0x0C, 0x16, 0x16, 0x0C, 0x0C, 0x16, 0x0B, 0x3F, 0x21, 0x0E, 0x21, 0x0C,
+    0x20, 0x0C, 0x16, 0x20, 0x0C, 0x0C, 0x20, 0x16, 0x2A, 0x0C, 0x2A, 0x0C, 0x16, 0x2B, 0x21, 0x2A,
+    0x0C, 0x0C, 0x22, 0x0B, 0x22, 0x0B, 0x18, 0x22, 0x0B, 0x0E, 0x22, 0x0D, 0x0E, 0x48, 0x20, 0x20,
+    0x20, 0x0D, 0x16, 0x21, 0x0E, 0x17, 0x20, 0x0D, 0x20, 0x0D, 0x0C, 0x2C, 0x0D, 0x0E, 0x00, 0x0F,
+    0x91, 0x00, 0x11, 0xA5, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xF0, 0x00, 0x0E, 0xD7, 0x00, 0x15, 0x85,
+    0x00, 0x08, 0xB8, 0x00, 0x08, 0x0E, 0x00, 0x0F, 0x1A, 0x00, 0x14, 0x31, 0x00, 0x01, 0xCE, 0x00,
+    0x0E, 0xEB, 0x00, 0x01, 0xF7, 0x00, 0x0F, 0x32, 0x00, 0x14, 0x6E, 0x00, 0x15, 0x54, 0x00, 0x11,
+    0x1A, 0x00, 0x07, 0xD0, 0x00, 0x11, 0x09, 0x00, 0x0E, 0xE8, 0x00, 0x08, 0x11, 0x00, 0x09, 0xCF,
+    0x00, 0x08, 0x1F, 0x00, 0x0E, 0xEE, 0x00, 0x19, 0xF3, 0x00, 0x05, 0x93, 0x00, 0x12, 0xB3, 0x00,
+    0x03, 0x6A, 0x00, 0x0F, 0x2C, 0x00, 0x02, 0xDF, 0x00, 0x11, 0x0C, 0x00, 0x11, 0x15, 0x00, 0x14,
+    0xB9, 0x00, 0x12, 0xB0, 0x00, 0x05, 0x19, 0x00, 0x11, 0x57, 0x00, 0x0F, 0x2F, 0x00, 0x19, 0xF0,
+    0x00, 0x11, 0xD7, 0x00, 0x11, 0xA8, 0x00, 0x09, 0x03, 0x00, 0x03, 0x06, 0x00, 0x01, 0xE2, 0x00,
+    0x01, 0xD1, 0x00, 0x01, 0xD4, 0x00, 0x01, 0xFA, 0x00, 0x11, 0x5A, 0x00, 0x10, 0xAE, 0x00, 0x08,
+    0xC7, 0x00, 0x03, 0xF1, 0x00, 0x11, 0xE7, 0x00, 0x20, 0x05, 0x00, 0x02, 0xED, 0x00, 0x08, 0xB5,
+    0x00, 0x0F, 0x3E, 0x00, 0x11, 0xE0, 0x00, 0x03, 0xE3, 0x00, 0x02, 0x06, 0x00, 0x1F, 0xA2, 0x00,
+    0x20, 0x86, 0x00, 0x02, 0x83, 0x00, 0x04, 0xCA, 0x00, 0x1D, 0x9F, 0x00, 0x02, 0xFB, 0x80, 0x00,
+    0x62, 0x80, 0x00, 0x41, 0x80, 0x00, 0x42, 0x05, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x2C, 0x2C, 0x2C,
+    0x2C, 0x2C, 0x07, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x0A, 0x0A, 0x2B, 0x0A, 0x0A, 0x0A,
+    0x75, 0x01, 0x65, 0x2A, 0x01, 0x72, 0x7D, 0x01, 0x6F, 0x2A, 0x01, 0x72, 0x0C, 0x80, 0x02, 0x01,
+    0x01, 0x6F, 0x02, 0x01, 0x72, 0x7D, 0x80, 0x0D, 0xE2, 0x01, 0x68, 0x39, 0x01, 0x6F, 0x7D, 0x01,
+    0x63, 0x7D, 0x01, 0x69, 0x6E, 0x01, 0x6E, 0x7D, 0x03, 0x65, 0x6C, 0x6D, 0x6B, 0x77, 0x7D, 0x01,
+    0x72, 0x39, 0x01, 0x67, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x70, 0x7D, 0x80, 0x0D, 0xC2, 0x01, 0xB3,
+    0x7D, 0x02, 0x6F, 0xC3, 0x7A, 0x7D, 0x01, 0x73, 0x7B, 0x80, 0x0C, 0xE2, 0x01, 0x65, 0x7D, 0x80,
+    0x0D, 0xB1, 0x01, 0x73, 0x7D, 0x01, 0x65, 0x7D, 0x02, 0x6A, 0x6E, 0x74, 0x7D, 0x01, 0x6F, 0x7B,
+    0x02, 0x65, 0x69, 0x7D, 0x2A, 0x04, 0x61, 0x65, 0x69, 0x74, 0xBF, 0xC3, 0xBF, 0xD3, 0x61, 0x7B,
+    0x01, 0x74, 0x0C, 0x84, 0x01, 0xF1, 0x62, 0x63, 0x6E, 0x74, 0xBF, 0x91, 0x2D, 0x72, 0x7D, 0x80,
+    0x02, 0x11, 0x01, 0x6C, 0x7D, 0x01, 0x61, 0x7D, 0x01, 0x75, 0x7D, 0x01, 0x72, 0x74, 0x02, 0x6E,
+    0x75, 0x7A, 0x7D, 0x80, 0x05, 0xE2, 0x01, 0x64, 0x3C, 0x80, 0x10, 0xB3, 0x01, 0x61, 0x7D, 0x01,
+    0x65, 0x7A, 0x03, 0x6E, 0x70, 0x76, 0x74, 0x7A, 0x7D, 0x01, 0x74, 0x3C, 0x01, 0x73, 0x7D, 0x01,
+    0x6E, 0x7A, 0x01, 0x69, 0x6D, 0x01, 0x6C, 0x7D, 0x04, 0x61, 0x65, 0x69, 0x6F, 0x6A, 0x74, 0x77,
+    0x7D, 0x01, 0x6E, 0x77, 0x01, 0x78, 0xBF, 0xBB, 0x01, 0x6E, 0xBF, 0xB7, 0x80, 0x02, 0x12, 0x01,
+    0x78, 0x7D, 0x01, 0xB3, 0x7D, 0x05, 0x61, 0x65, 0x6F, 0x75, 0xC3, 0xBF, 0xB9, 0x6C, 0x6F, 0x73,
+    0x7D, 0x81, 0x00, 0x51, 0x69, 0x74, 0x80, 0x00, 0xD1, 0x01, 0x74, 0x7D, 0x01, 0x75, 0x7D, 0x01,
+    0x72, 0x02, 0x01, 0x65, 0x02, 0x01, 0x65, 0x7D, 0x02, 0x65, 0x72, 0x1D, 0x7D, 0x01, 0x6E, 0x02,
+    0x80, 0x00, 0xF1, 0x01, 0x6C, 0x03, 0x02, 0x65, 0x75, 0x34, 0x7D, 0x01, 0x63, 0x03, 0x01, 0x73,
+    0x3F, 0x02, 0x65, 0x69, 0x7D, 0x3F, 0x01, 0x74, 0x02, 0x01, 0x73, 0x29, 0x01, 0xB3, 0x7D, 0x01,
+    0xC3, 0x7D, 0x01, 0x64, 0x02, 0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x72, 0x7D, 0x01, 0x74,
+    0xBE, 0xE2, 0x01, 0x61, 0xBF, 0xD1, 0x01, 0x69, 0x7C, 0x87, 0x04, 0x72, 0x63, 0x67, 0x6C, 0x70,
+    0x72, 0x75, 0x78, 0xBF, 0xBF, 0xBF, 0xCD, 0xBF, 0xD8, 0x66, 0x72, 0x75, 0x7D, 0x02, 0x63, 0x74,
+    0x02, 0x02, 0x01, 0x63, 0x02, 0x02, 0x69, 0x75, 0x78, 0x7D, 0x01, 0x69, 0x02, 0x01, 0x63, 0x7D,
+    0x01, 0x69, 0x7D, 0x01, 0xA1, 0x03, 0x01, 0xC3, 0x7D, 0x01, 0x73, 0x02, 0x01, 0x69, 0x7D, 0x84,
+    0x04, 0x72, 0x64, 0x66, 0x74, 0x78, 0x66, 0x71, 0x77, 0x7D, 0x80, 0x01, 0x71, 0x01, 0x68, 0x1B,
+    0x01, 0x74, 0x1B, 0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x02, 0x69, 0x6F, 0x1B, 0x1B, 0x04, 0x63,
+    0x72, 0x73, 0x74, 0x6F, 0x78, 0x7B, 0x1B, 0x80, 0x07, 0xF1, 0x01, 0x62, 0x7D, 0x82, 0x02, 0x11,
+    0x65, 0x69, 0x71, 0x7D, 0x01, 0x75, 0x29, 0x01, 0x70, 0x7D, 0x01, 0x6F, 0x03, 0x82, 0x04, 0x72,
+    0x6D, 0x74, 0x7A, 0x7D, 0x80, 0x04, 0x71, 0x01, 0x62, 0x7D, 0x01, 0x72, 0x7D, 0x01, 0x75, 0x7D,
+    0x80, 0x09, 0x92, 0x01, 0x69, 0x7D, 0x80, 0x0C, 0x32, 0x01, 0x72, 0x7D, 0x01, 0xA9, 0x7D, 0x03,
+    0x65, 0x74, 0xC3, 0x7A, 0x1B, 0x7D, 0x01, 0x6E, 0x1B, 0x01, 0xAD, 0x7D, 0x03, 0x65, 0x69, 0xC3,
+    0x7A, 0x7A, 0x7D, 0x01, 0x64, 0x79, 0x83, 0x0D, 0xC2, 0x6B, 0x70, 0x72, 0xBF, 0xDD, 0x69, 0x7D,
+    0x80, 0x04, 0x72, 0x80, 0x07, 0x71, 0x01, 0x6C, 0x38, 0x01, 0x75, 0x7D, 0x81, 0x0E, 0x62, 0x67,
+    0x7D, 0x80, 0x0E, 0x62, 0x81, 0x0E, 0x62, 0x70, 0xBF, 0x7C, 0x05, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA,
+    0x72, 0x31, 0x31, 0x7A, 0x31, 0x08, 0x61, 0x65, 0x68, 0x69, 0x6E, 0x6F, 0x75, 0xC3, 0xBF, 0x24,
+    0xBF, 0x5A, 0xBF, 0x88, 0xBF, 0x98, 0xBF, 0xA8, 0xBF, 0xD1, 0xBF, 0xDB, 0x75, 0x82, 0x00, 0x51,
+    0x61, 0x6F, 0xBE, 0xBF, 0x68, 0x80, 0x10, 0x83, 0x82, 0x0E, 0x62, 0x6D, 0x6E, 0x03, 0x03, 0x80,
+    0x05, 0x82, 0x80, 0x10, 0x35, 0x03, 0xA1, 0xA9, 0xB3, 0x7D, 0x7D, 0x7D, 0x04, 0x61, 0x65, 0x6F,
+    0xC3, 0x76, 0x76, 0x76, 0x79, 0x01, 0x73, 0x77, 0x01, 0x65, 0x7D, 0x01, 0x72, 0x7D, 0x01, 0x65,
+    0x7D, 0x01, 0x74, 0x7D, 0x81, 0x0E, 0x62, 0x6E, 0x7D, 0x80, 0x10, 0x03, 0x80, 0x0F, 0xE2, 0x05,
+    0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x7A, 0x7D, 0x7D, 0x7D, 0x7D, 0x07, 0x61, 0x65, 0x68, 0x69, 0x6F,
+    0x75, 0xC3, 0xBF, 0xBB, 0xBF, 0xBE, 0xBF, 0xC5, 0x6A, 0x31, 0x31, 0x75, 0x02, 0x73, 0x75, 0x6E,
+    0xBE, 0x5D, 0x80, 0x0B, 0xA1, 0x01, 0x68, 0x7D, 0x81, 0x0F, 0xD1, 0x63, 0x7D, 0x01, 0x6F, 0x7B,
+    0x01, 0x69, 0x7D, 0x01, 0x63, 0x7D, 0x01, 0x65, 0x7D, 0x82, 0x00, 0x51, 0x65, 0x69, 0x63, 0x7D,
+    0x01, 0x69, 0x29, 0x01, 0x65, 0x7D, 0x01, 0x6E, 0x03, 0x01, 0xA9, 0x7D, 0x02, 0x65, 0xC3, 0x7A,
+    0x7D, 0x01, 0x72, 0x03, 0x01, 0xB3, 0x1D, 0x02, 0x6F, 0xC3, 0x7A, 0x7D, 0x01, 0x62, 0x02, 0x84,
+    0x0D, 0x63, 0x63, 0x6A, 0x6D, 0x72, 0x64, 0x6D, 0x78, 0x7D, 0x01, 0x74, 0x03, 0x01, 0x73, 0x3D,
+    0x01, 0xAD, 0x7D, 0x02, 0x69, 0xC3, 0x7A, 0x7D, 0x81, 0x0D, 0x63, 0x6D, 0x7B, 0x01, 0x74, 0xBE,
+    0xC7, 0x01, 0x73, 0x7C, 0x81, 0x0D, 0x92, 0x65, 0x7D, 0x80, 0x0D, 0x63, 0x81, 0x00, 0xF1, 0x72,
+    0x03, 0x03, 0xA1, 0xA9, 0xB3, 0x03, 0x03, 0x03, 0x04, 0x61, 0x65, 0x6F, 0xC3, 0x74, 0x03, 0x03,
+    0x79, 0x81, 0x0D, 0x63, 0x6A, 0x77, 0x03, 0x61, 0x65, 0xC3, 0x03, 0x03, 0xBE, 0x4D, 0x01, 0x72,
+    0x78, 0x01, 0x65, 0x7D, 0x81, 0x0D, 0x63, 0x6D, 0x7D, 0x80, 0x0D, 0x33, 0x81, 0x0D, 0x33, 0x6A,
+    0x38, 0x05, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x22, 0x22, 0x22, 0x7B, 0x22, 0x07, 0x61, 0x65, 0x68,
+    0x69, 0x6F, 0x75, 0xC3, 0xBF, 0x93, 0xBF, 0xAC, 0xBF, 0xB8, 0xBF, 0xBD, 0xBF, 0xD5, 0x68, 0x75,
+    0x01, 0x73, 0xBE, 0x64, 0x02, 0x6C, 0x75, 0xBE, 0x60, 0x7C, 0x01, 0x72, 0xBF, 0x93, 0x01, 0x6D,
+    0xBE, 0x56, 0x01, 0x6C, 0xBE, 0x52, 0x04, 0xA1, 0xAD, 0xB3, 0xBA, 0x7C, 0xBE, 0x51, 0x74, 0x78,
+    0x85, 0x0D, 0x92, 0x61, 0x69, 0x6F, 0x75, 0xC3, 0x64, 0xBE, 0x47, 0x6A, 0x6E, 0x76, 0x05, 0xA1,
+    0xA9, 0xAD, 0xB3, 0xBA, 0x22, 0x22, 0x22, 0x22, 0x22, 0x07, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75,
+    0xC3, 0xBF, 0x70, 0xBF, 0x70, 0x67, 0xBF, 0x70, 0xBF, 0x70, 0xBF, 0x70, 0x75, 0x02, 0x6E, 0x78,
+    0xBF, 0x9F, 0x6C, 0x80, 0x00, 0x51, 0x01, 0x65, 0x1B, 0x01, 0x65, 0x7D, 0x01, 0x6D, 0x7D, 0x02,
+    0x61, 0x6F, 0x1B, 0x1B, 0x01, 0x65, 0x7B, 0x01, 0x6D, 0x7D, 0x02, 0x65, 0x75, 0x72, 0x7D, 0x01,
+    0x72, 0xBD, 0x93, 0x01, 0x72, 0xBD, 0x5F, 0x02, 0x61, 0x6F, 0x78, 0x7C, 0x02, 0x6E, 0x70, 0x29,
+    0x29, 0x01, 0x65, 0x7B, 0x01, 0x70, 0x29, 0x02, 0x61, 0x6F, 0x7D, 0x7D, 0x01, 0x63, 0x29, 0x01,
+    0x65, 0x7D, 0x01, 0x6E, 0x29, 0x01, 0x61, 0x7D, 0x01, 0x75, 0x7D, 0x01, 0x65, 0x34, 0x01, 0x6D,
+    0xBE, 0xDE, 0x01, 0xA1, 0x7C, 0x02, 0x69, 0xC3, 0x76, 0x7D, 0x01, 0x62, 0x03, 0x01, 0x69, 0x7D,
+    0x01, 0x76, 0x7D, 0x01, 0x6F, 0x7D, 0x01, 0x7A, 0x02, 0x01, 0x69, 0x7D, 0x01, 0x6C, 0x7D, 0x02,
+    0x63, 0x6D, 0x03, 0x02, 0x02, 0x61, 0x69, 0x78, 0x7B, 0x01, 0x61, 0xBE, 0xB3, 0x01, 0x67, 0x7C,
+    0x01, 0x6C, 0x02, 0x02, 0x61, 0x69, 0x63, 0xBD, 0x2F, 0x03, 0x63, 0x68, 0x6E, 0xBD, 0x31, 0xBF,
+    0xC2, 0xBD, 0x40, 0x01, 0x65, 0x76, 0x04, 0x61, 0x65, 0x6C, 0x72, 0x67, 0x6A, 0x6D, 0x7D, 0x01,
+    0xB3, 0x34, 0x01, 0xC3, 0x7D, 0x01, 0x67, 0x02, 0x01, 0x75, 0x7D, 0x02, 0x6D, 0x72, 0x77, 0x7D,
+    0x01, 0x69, 0xBC, 0xC9, 0x01, 0x65, 0xBF, 0x8E, 0x8C, 0x0D, 0x63, 0x62, 0x63, 0x64, 0x66, 0x67,
+    0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0xBF, 0x6F, 0xBF, 0x79, 0xBF, 0x7F, 0xBF, 0x87, 0xBF,
+    0x90, 0xBF, 0x9D, 0xBF, 0xAB, 0xBF, 0xBC, 0xBF, 0xDE, 0x73, 0x78, 0x7C, 0x81, 0x02, 0x01, 0x69,
+    0x02, 0x01, 0x63, 0x7B, 0x01, 0x69, 0x7D, 0x01, 0x64, 0xBC, 0xD3, 0x02, 0x65, 0x75, 0xBF, 0xBA,
+    0x7C, 0x01, 0x72, 0xBE, 0x30, 0x01, 0x6F, 0xBF, 0x4D, 0x02, 0x61, 0x63, 0x78, 0x7C, 0x01, 0x76,
+    0x03, 0x01, 0xAD, 0x7D, 0x02, 0x69, 0xC3, 0xBC, 0x7E, 0x7D, 0x01, 0x75, 0x7A, 0x01, 0x61, 0x02,
+    0x82, 0x02, 0x01, 0x61, 0x68, 0xBF, 0x2C, 0x7D, 0x86, 0x0D, 0x63, 0x66, 0x6C, 0x6E, 0x71, 0x76,
+    0x78, 0xBF, 0xCC, 0xBF, 0xD3, 0x61, 0x72, 0xBD, 0xF8, 0x78, 0x80, 0x0D, 0x92, 0x02, 0x61, 0x6F,
+    0x03, 0x03, 0x01, 0x75, 0x7B, 0x01, 0x6C, 0xBF, 0x44, 0x01, 0x61, 0x7C, 0x01, 0x75, 0x7D, 0x83,
+    0x0D, 0x63, 0x63, 0x67, 0x6E, 0x73, 0x7D, 0x02, 0x01, 0x65, 0x1D, 0x01, 0x73, 0x7D, 0x02, 0x63,
+    0x74, 0x03, 0x03, 0x01, 0x6E, 0x7B, 0x04, 0x61, 0x65, 0x74, 0xC3, 0x03, 0x03, 0x02, 0xBC, 0x6D,
+    0x03, 0x61, 0x6C, 0x6F, 0x03, 0x76, 0x03, 0x02, 0x65, 0x75, 0x6C, 0x79, 0x01, 0x73, 0x03, 0x01,
+    0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x72, 0x29, 0x01, 0x6F, 0x7D, 0x84, 0x0D, 0x63, 0x62, 0x63,
+    0x66, 0x70, 0xBF, 0xD0, 0x6C, 0x77, 0x7D, 0x80, 0x0C, 0x83, 0x80, 0x0C, 0xB3, 0x03, 0xA1, 0xA9,
+    0xB3, 0x7D, 0x7D, 0x7D, 0x04, 0x61, 0x65, 0x6F, 0xC3, 0x76, 0x76, 0x76, 0x79, 0x81, 0x0C, 0x83,
+    0x73, 0x77, 0x80, 0x0C, 0x52, 0x80, 0x0D, 0x03, 0x01, 0x67, 0x7D, 0x01, 0x70, 0x7A, 0x02, 0x63,
+    0x74, 0x77, 0x77, 0x02, 0x6D, 0x70, 0x78, 0x7B, 0x82, 0x0C, 0xE2, 0x6F, 0x75, 0x70, 0x7B, 0x80,
+    0x0C, 0x53, 0x05, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x08, 0x61, 0x65,
+    0x68, 0x69, 0x6F, 0x72, 0x75, 0xC3, 0xBF, 0xBA, 0xBF, 0xD0, 0xBF, 0xD5, 0xBF, 0xBA, 0xBF, 0xBA,
+    0x6B, 0xBF, 0xBA, 0x75, 0x01, 0x72, 0x69, 0x01, 0x65, 0x7D, 0x01, 0x7A, 0x03, 0x01, 0x69, 0x7D,
+    0x01, 0x6C, 0x7D, 0x01, 0x69, 0x7D, 0x81, 0x0D, 0x63, 0x74, 0x7D, 0x01, 0x6D, 0x38, 0x01, 0x69,
+    0x7D, 0x81, 0x0D, 0x33, 0x6E, 0x7D, 0x01, 0x74, 0x38, 0x01, 0x69, 0x7D, 0x81, 0x0D, 0x33, 0x64,
+    0x7D, 0x01, 0x69, 0xBC, 0x45, 0x81, 0x0D, 0x33, 0x74, 0x7C, 0x05, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA,
+    0x67, 0x72, 0x22, 0x22, 0x7B, 0x08, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x74, 0x75, 0xC3, 0xBE, 0x93,
+    0xBE, 0xF3, 0xBF, 0x05, 0xBF, 0x1A, 0xBF, 0x56, 0xBF, 0xC2, 0xBF, 0xD1, 0x75, 0x01, 0x6E, 0x68,
+    0x80, 0x03, 0x31, 0x02, 0x6E, 0x73, 0x11, 0x11, 0x01, 0x6F, 0x7B, 0x02, 0x74, 0x7A, 0x11, 0x11,
+    0x01, 0x6E, 0x7B, 0x01, 0x61, 0x7D, 0x01, 0x64, 0x7D, 0x03, 0x63, 0x65, 0x6E, 0x6F, 0x2B, 0x7D,
+    0x80, 0x0F, 0xA3, 0x01, 0x75, 0x7D, 0x01, 0x74, 0x11, 0x02, 0x64, 0x73, 0x7A, 0x7D, 0x01, 0x6E,
+    0x78, 0x03, 0x61, 0x65, 0x69, 0x68, 0x78, 0x7D, 0x01, 0x6C, 0x79, 0x01, 0x69, 0x2A, 0x80, 0x03,
+    0x52, 0x80, 0x03, 0x32, 0x05, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x14, 0x14, 0x14, 0x14, 0x14, 0x07,
+    0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x07, 0x07, 0x11, 0x07, 0x07, 0x07, 0x75, 0x02, 0x6C,
+    0x6F, 0xBF, 0xDD, 0x16, 0x82, 0x00, 0x51, 0x61, 0x69, 0xBF, 0xD4, 0x7A, 0x80, 0x0F, 0x73, 0x01,
+    0x69, 0x7D, 0x01, 0x72, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x62, 0x74, 0x01, 0xA1, 0x7D, 0x02, 0x61,
+    0xC3, 0x7A, 0x7D, 0x03, 0x66, 0x6D, 0x72, 0x6F, 0x72, 0x7B, 0x80, 0x0F, 0x22, 0x01, 0x70, 0x7D,
+    0x01, 0x6F, 0x7D, 0x01, 0x72, 0x7D, 0x01, 0x75, 0x7D, 0x01, 0x6C, 0x71, 0x01, 0x70, 0xBB, 0x44,
+    0x01, 0x73, 0x7C, 0x02, 0x65, 0x69, 0x76, 0x7D, 0x01, 0x6D, 0x62, 0x01, 0xA1, 0x7D, 0x02, 0x61,
+    0xC3, 0x7A, 0x7D, 0x01, 0x6C, 0x7B, 0x01, 0x73, 0x7D, 0x80, 0x0F, 0x43, 0x01, 0x62, 0x7D, 0x01,
+    0x61, 0x7D, 0x01, 0x72, 0x7D, 0x01, 0x69, 0xBF, 0xC5, 0x01, 0x74, 0x7C, 0x01, 0x70, 0x7D, 0x02,
+    0xA1, 0xB3, 0x73, 0x7D, 0x05, 0x61, 0x65, 0x68, 0x69, 0xC3, 0xBF, 0xAF, 0xBF, 0xC2, 0xBF, 0xCF,
+    0x62, 0x7B, 0x01, 0x6E, 0x72, 0x01, 0x69, 0x03, 0x80, 0x07, 0x82, 0x01, 0x65, 0x06, 0x83, 0x0E,
+    0xF3, 0x63, 0x6A, 0x72, 0x35, 0x7D, 0x03, 0x80, 0x08, 0xF2, 0x81, 0x07, 0x82, 0x61, 0x06, 0x02,
+    0x63, 0x72, 0x30, 0x7B, 0x01, 0x65, 0x7B, 0x81, 0x07, 0x82, 0x73, 0x06, 0x03, 0x61, 0x65, 0x69,
+    0x7B, 0x06, 0x06, 0x01, 0x6F, 0x06, 0x01, 0xAD, 0x7D, 0x03, 0x67, 0x69, 0xC3, 0x03, 0x06, 0x7D,
+    0x01, 0x61, 0x06, 0x86, 0x0E, 0xF3, 0x61, 0x6C, 0x6D, 0x6F, 0x72, 0x74, 0xBB, 0xBE, 0x61, 0x69,
+    0x03, 0x76, 0x7D, 0x80, 0x07, 0x52, 0x01, 0x72, 0x06, 0x01, 0x65, 0x7D, 0x81, 0x07, 0x82, 0x6F,
+    0x06, 0x03, 0xA1, 0xA9, 0xB3, 0x06, 0x06, 0x06, 0x05, 0x61, 0x65, 0x6C, 0x6F, 0xC3, 0x06, 0x06,
+    0x74, 0x06, 0x79, 0x01, 0x72, 0x30, 0x01, 0x70, 0x7D, 0x01, 0x6F, 0xB9, 0x16, 0x01, 0x64, 0x7C,
+    0x83, 0x00, 0xF1, 0x64, 0x65, 0x75, 0x3C, 0x06, 0x7D, 0x01, 0x61, 0x03, 0x02, 0x6D, 0x74, 0x03,
+    0x7D, 0x02, 0x61, 0x6F, 0x06, 0x06, 0x87, 0x0E, 0xF3, 0x63, 0x67, 0x6C, 0x6D, 0x6E, 0x73, 0x7A,
+    0xBF, 0xC3, 0xBF, 0x9D, 0xBF, 0xD2, 0x60, 0x6A, 0x76, 0x7B, 0x01, 0x65, 0x30, 0x82, 0x0E, 0xF3,
+    0x70, 0x72, 0x7D, 0xB8, 0xE8, 0x01, 0x76, 0x30, 0x01, 0x6D, 0x30, 0x02, 0x65, 0x6F, 0x7A, 0x7D,
+    0x04, 0x61, 0x65, 0x6F, 0xC3, 0x06, 0x06, 0x06, 0xBF, 0xA1, 0x02, 0x61, 0x65, 0x06, 0xBF, 0x69,
+    0x82, 0x0E, 0xF3, 0x6C, 0x72, 0x70, 0x7A, 0x80, 0x0E, 0xA3, 0x81, 0x0E, 0xA3, 0x6E, 0x03, 0x80,
+    0x0E, 0xD2, 0x81, 0x00, 0xF1, 0x69, 0x7D, 0x81, 0x0E, 0xA3, 0x6E, 0x7B, 0x05, 0xA1, 0xA9, 0xAD,
+    0xB3, 0xBA, 0x6B, 0x6B, 0x6E, 0x7B, 0x6B, 0x08, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x75, 0xC3,
+    0xBF, 0x17, 0xBF, 0x4C, 0x28, 0xBF, 0x9F, 0xBF, 0xB6, 0xBF, 0xC4, 0xBF, 0xD9, 0x75, 0x01, 0x74,
+    0x69, 0x01, 0x73, 0x7D, 0x01, 0x70, 0x3C, 0x01, 0xBA, 0x7D, 0x02, 0x75, 0xC3, 0x7A, 0x7D, 0x80,
+    0x05, 0xE1, 0x01, 0x6E, 0x15, 0x01, 0xAD, 0x7D, 0x02, 0x69, 0xC3, 0x7A, 0x7D, 0x01, 0x64, 0x7B,
+    0x82, 0x03, 0x52, 0x63, 0x72, 0x6A, 0x7D, 0x01, 0x6C, 0x15, 0x01, 0x75, 0x7D, 0x01, 0x62, 0x7D,
+    0x81, 0x03, 0x32, 0x6D, 0x7D, 0x05, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x7B, 0x14, 0x14, 0x14, 0x14,
+    0x07, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x07, 0x07, 0x11, 0x07, 0x60, 0x07, 0x75, 0x01,
+    0x72, 0x3D, 0x01, 0x6F, 0x7D, 0x81, 0x0E, 0x82, 0x62, 0x7D, 0x01, 0x61, 0xBC, 0x67, 0x81, 0x0E,
+    0x82, 0x74, 0x7C, 0x02, 0xA1, 0xAD, 0x15, 0x15, 0x04, 0x61, 0x65, 0x69, 0xC3, 0x15, 0x15, 0x15,
+    0x7B, 0x01, 0x62, 0x77, 0x82, 0x05, 0xE1, 0x61, 0x6F, 0x15, 0x15, 0x01, 0x62, 0x79, 0x01, 0xAD,
+    0x7D, 0x82, 0x03, 0x31, 0x69, 0xC3, 0x70, 0x7D, 0x80, 0x0E, 0x82, 0x80, 0x07, 0x32, 0x05, 0xA1,
+    0xA9, 0xAD, 0xB3, 0xBA, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x07, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75,
+    0xC3, 0xBF, 0xBC, 0xBF, 0xC5, 0x68, 0x6F, 0x6F, 0x6F, 0x75, 0x02, 0x65, 0x6F, 0xBF, 0x96, 0x6F,
+    0x83, 0x00, 0x51, 0x61, 0x6F, 0x72, 0xBE, 0x42, 0xBF, 0x51, 0x7A, 0x01, 0x65, 0xBC, 0x8A, 0x02,
+    0x6F, 0xC3, 0x1D, 0xBA, 0x35, 0x03, 0x69, 0x72, 0x73, 0x76, 0x02, 0x7A, 0x01, 0x69, 0xB8, 0xB6,
+    0x01, 0x64, 0x7C, 0x01, 0x6E, 0x7D, 0x01, 0xB1, 0x02, 0x01, 0xC3, 0x7D, 0x01, 0xBA, 0x7D, 0x03,
+    0x6F, 0x75, 0xC3, 0x74, 0x7A, 0x7D, 0x02, 0x73, 0x74, 0x02, 0x02, 0x01, 0xAD, 0x29, 0x02, 0x69,
+    0xC3, 0x78, 0x7D, 0x01, 0x6D, 0x7B, 0x01, 0x67, 0x39, 0x01, 0x6D, 0x02, 0x01, 0x72, 0x7D, 0x01,
+    0xAD, 0x7D, 0x02, 0x69, 0xC3, 0x7A, 0x7D, 0x01, 0x76, 0x02, 0x01, 0x70, 0x39, 0x01, 0xA1, 0x7A,
+    0x03, 0x61, 0x75, 0xC3, 0x77, 0x7A, 0x7D, 0x01, 0x72, 0x79, 0x01, 0xBA, 0xB9, 0xF3, 0x02, 0x75,
+    0xC3, 0xB8, 0x2B, 0x7C, 0x01, 0x67, 0x1D, 0x02, 0x6D, 0x74, 0x03, 0x03, 0x02, 0x61, 0xC3, 0x03,
+    0xB8, 0x67, 0x03, 0x6D, 0x73, 0x7A, 0x02, 0x75, 0x7A, 0x01, 0x6A, 0x02, 0x01, 0x7A, 0xBE, 0x3D,
+    0x03, 0xA9, 0xAD, 0xB3, 0x64, 0x7C, 0x79, 0x05, 0x65, 0x69, 0x6F, 0x71, 0xC3, 0xBF, 0xDD, 0x6B,
+    0x72, 0x02, 0x79, 0x03, 0xA1, 0xA9, 0xB3, 0x02, 0x02, 0x02, 0x04, 0x61, 0x65, 0x6F, 0xC3, 0x02,
+    0x02, 0x02, 0x79, 0x01, 0xAD, 0xBF, 0x96, 0x02, 0x69, 0xC3, 0xBF, 0x92, 0x7C, 0x01, 0x65, 0xB8,
+    0x15, 0x01, 0x72, 0x7C, 0x02, 0x6E, 0x74, 0xB7, 0xDE, 0x02, 0x80, 0x00, 0x00, 0x01, 0x74, 0x7D,
+    0x01, 0x65, 0x7D, 0x02, 0xA9, 0xAD, 0xB7, 0xD2, 0x7D, 0x02, 0x65, 0xC3, 0x6B, 0x7A, 0x02, 0x61,
+    0x72, 0x63, 0x7B, 0x01, 0xBA, 0xBF, 0x66, 0x02, 0x75, 0xC3, 0xBF, 0x62, 0x7C, 0x8E, 0x04, 0x72,
+    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x6A, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x73, 0x7A, 0xBF, 0x28,
+    0xBF, 0x42, 0xBF, 0x56, 0xBF, 0x59, 0xBF, 0x65, 0xBF, 0x7A, 0xBF, 0x81, 0xBF, 0xAA, 0xBF, 0xBD,
+    0xBF, 0xCA, 0x71, 0x39, 0x7A, 0x39, 0x09, 0x61, 0x63, 0x66, 0x67, 0x69, 0x6F, 0x73, 0x74, 0x76,
+    0x03, 0x02, 0x02, 0x02, 0xB7, 0xBC, 0x03, 0x02, 0x02, 0x02, 0x01, 0x64, 0x03, 0x01, 0x6E, 0x7D,
+    0x01, 0x69, 0x7D, 0x83, 0x04, 0x72, 0x6D, 0x6E, 0x76, 0x39, 0x63, 0x7D, 0x02, 0x67, 0x69, 0xBA,
+    0xF1, 0xBA, 0x98, 0x84, 0x04, 0x72, 0x62, 0x63, 0x6A, 0x72, 0x39, 0x02, 0xB8, 0x03, 0x79, 0x02,
+    0xA1, 0xB3, 0x02, 0x02, 0x03, 0x61, 0x6F, 0xC3, 0x02, 0x02, 0x7B, 0x02, 0x63, 0x71, 0x79, 0x02,
+    0x02, 0x63, 0x71, 0xBA, 0xCD, 0x02, 0x01, 0xAD, 0x7A, 0x02, 0x69, 0xC3, 0x72, 0x7D, 0x81, 0x00,
+    0xF1, 0x74, 0x35, 0x01, 0x74, 0x35, 0x01, 0xA1, 0x7D, 0x02, 0x61, 0xC3, 0x75, 0x7D, 0x02, 0xA9,
+    0xB3, 0x03, 0x03, 0x08, 0x61, 0x64, 0x65, 0x66, 0x6D, 0x72, 0x73, 0xC3, 0x03, 0x03, 0x03, 0x02,
+    0xBF, 0x47, 0x03, 0x03, 0x7B, 0x02, 0xA1, 0xAD, 0x03, 0xB8, 0xE7, 0x03, 0x69, 0x74, 0xC3, 0x68,
+    0x02, 0x7A, 0x01, 0xA1, 0x1D, 0x02, 0x61, 0xC3, 0x1D, 0x7D, 0x01, 0xAD, 0xB9, 0xDC, 0x02, 0x69,
+    0xC3, 0xB9, 0xD8, 0x7C, 0x01, 0x6C, 0x7A, 0x01, 0x69, 0x7D, 0x85, 0x04, 0x72, 0x62, 0x6D, 0x6E,
+    0x73, 0x74, 0xBF, 0xAF, 0xBF, 0xBF, 0x61, 0x6B, 0x7D, 0x03, 0x61, 0x65, 0x6F, 0x02, 0x02, 0x02,
+    0x82, 0x0E, 0x62, 0x62, 0x6D, 0x1D, 0x79, 0x05, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x79, 0x31, 0x31,
+    0x31, 0x31, 0x06, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xBF, 0x0B, 0xB5, 0xD9, 0xBF, 0x51, 0xBF,
+    0x61, 0xBF, 0xD8, 0x75, 0x81, 0x00, 0x51, 0x65, 0x6E, 0x01, 0x61, 0xBF, 0x31, 0x01, 0x72, 0x7C,
+    0x01, 0x74, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x62, 0x7D, 0x01, 0x73, 0xB5, 0xAF,
+    0x01, 0x61, 0x7C, 0x02, 0x70, 0x74, 0x3F, 0x03, 0x01, 0xA1, 0x3D, 0x01, 0xC3, 0x7D, 0x02, 0x65,
+    0x75, 0x75, 0x7D, 0x01, 0x65, 0x03, 0x01, 0x75, 0x7D, 0x01, 0x6C, 0x7D, 0x01, 0x61, 0x35, 0x01,
+    0x6E, 0x3D, 0x01, 0x65, 0x7D, 0x01, 0x6D, 0x7D, 0x03, 0x63, 0x69, 0x74, 0x74, 0x7D, 0xBA, 0x30,
+    0x01, 0xA1, 0x02, 0x04, 0x61, 0x65, 0x6F, 0xC3, 0x02, 0x02, 0x02, 0x7D, 0x01, 0x74, 0x77, 0x01,
+    0x69, 0x3F, 0x01, 0x6D, 0x7D, 0x01, 0xB3, 0x7D, 0x01, 0xC3, 0x7D, 0x86, 0x0E, 0x33, 0x63, 0x66,
+    0x6C, 0x72, 0x73, 0x74, 0xBF, 0xC3, 0xBF, 0xCE, 0xBF, 0xDD, 0xB7, 0xE6, 0x71, 0x7D, 0x01, 0x75,
+    0x3D, 0x01, 0x63, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x65, 0xB7, 0xBF, 0x01, 0x6D, 0x7C, 0x01, 0x65,
+    0x7D, 0x01, 0x6C, 0xBF, 0xA2, 0x01, 0x70, 0x7C, 0x01, 0x74, 0x6F, 0x01, 0x65, 0x3F, 0x01, 0x6D,
+    0x03, 0x01, 0x75, 0x3F, 0x01, 0xAD, 0x7A, 0x04, 0x61, 0x69, 0x72, 0xC3, 0x3F, 0x77, 0x7A, 0x7D,
+    0x02, 0x70, 0x74, 0x6B, 0x77, 0x85, 0x0E, 0x33, 0x6A, 0x6C, 0x6D, 0x6E, 0x73, 0xBF, 0xCF, 0xBF,
+    0xD9, 0x60, 0x63, 0x7B, 0x80, 0x07, 0xA2, 0x81, 0x07, 0xA2, 0x72, 0x7D, 0x01, 0x6E, 0x78, 0x01,
+    0xB3, 0x7D, 0x03, 0x61, 0x6F, 0xC3, 0x72, 0x75, 0x7D, 0x03, 0x6E, 0x72, 0x73, 0xB4, 0xF2, 0x02,
+    0x02, 0x01, 0x65, 0x6B, 0x01, 0x69, 0x7D, 0x01, 0x70, 0x03, 0x01, 0x64, 0xBF, 0x9D, 0x01, 0x6E,
+    0x7C, 0x01, 0x65, 0x7D, 0x02, 0x73, 0x74, 0x73, 0x7D, 0x01, 0xA9, 0x34, 0x87, 0x0E, 0x33, 0x64,
+    0x65, 0x6C, 0x6D, 0x6E, 0x72, 0xC3, 0xBF, 0xD6, 0xBF, 0xDD, 0xB6, 0x8A, 0x68, 0x78, 0x02, 0x7D,
+    0x01, 0x69, 0x3D, 0x01, 0x70, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x63, 0x7D, 0x01, 0x63, 0x35, 0x01,
+    0x69, 0x7D, 0x01, 0xAD, 0x34, 0x02, 0x69, 0xC3, 0x34, 0x7D, 0x01, 0x64, 0x7B, 0x83, 0x0E, 0x33,
+    0x63, 0x66, 0x72, 0x6C, 0x72, 0x7D, 0x01, 0x79, 0xB6, 0x20, 0x01, 0x61, 0x7C, 0x01, 0x62, 0xBB,
+    0x9C, 0x81, 0x0E, 0x33, 0x72, 0x7C, 0x01, 0x74, 0xBF, 0x19, 0x02, 0xA9, 0xB3, 0x02, 0x02, 0x02,
+    0x61, 0xC3, 0x02, 0x7B, 0x01, 0x74, 0x7B, 0x82, 0x0E, 0x03, 0x72, 0x73, 0x6F, 0x7D, 0x80, 0x0E,
+    0x03, 0x83, 0x0E, 0x03, 0x6D, 0x6E, 0x72, 0x35, 0xBD, 0xD9, 0x02, 0x05, 0xA1, 0xA9, 0xAD, 0xB3,
+    0xBA, 0x6C, 0x73, 0x76, 0x73, 0x73, 0x08, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x75, 0xC3, 0xBE,
+    0xF5, 0xBF, 0x3F, 0xB6, 0x59, 0xBF, 0x86, 0xBF, 0xB7, 0xBF, 0xC4, 0xBF, 0xCB, 0x75, 0x01, 0x74,
+    0xB6, 0x41, 0x01, 0x73, 0x7C, 0x01, 0x73, 0xB6, 0x3A, 0x01, 0x65, 0x7C, 0x02, 0x65, 0x6F, 0x76,
+    0x7D, 0x02, 0x62, 0x72, 0xBF, 0xD5, 0x7B, 0x83, 0x00, 0x51, 0x65, 0x6F, 0x75, 0xBE, 0x72, 0xBE,
+    0x79, 0x7A, 0x01, 0x70, 0x2B, 0x01, 0x6D, 0x7D, 0x01, 0x6A, 0x2B, 0x80, 0x0A, 0x12, 0x01, 0x74,
+    0x7D, 0x01, 0xB3, 0x7D, 0x01, 0xC3, 0x7D, 0x02, 0x62, 0x6C, 0x71, 0x7D, 0x02, 0x69, 0x6F, 0x69,
+    0x7B, 0x01, 0x65, 0x7B, 0x01, 0x6C, 0x7D, 0x81, 0x07, 0x32, 0x67, 0x06, 0x01, 0x67, 0x03, 0x81,
+    0x07, 0x32, 0x65, 0x7D, 0x01, 0xB1, 0x06, 0x81, 0x07, 0x32, 0xC3, 0x7D, 0x04, 0x61, 0x65, 0x6F,
+    0xC3, 0x03, 0x03, 0x03, 0xB6, 0xA5, 0x01, 0x74, 0x76, 0x82, 0x07, 0x32, 0x64, 0x6E, 0xBB, 0x17,
+    0x7D, 0x80, 0x07, 0x12, 0x05, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x07,
+    0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0xBB, 0xDC, 0xBF, 0xC8, 0x28, 0xBF, 0xD0, 0xBF, 0xD8,
+    0x6A, 0x75, 0x01, 0x73, 0x6D, 0x01, 0x78, 0x14, 0x01, 0xB3, 0x7D, 0x01, 0xC3, 0x7D, 0x02, 0x61,
+    0x69, 0x74, 0x7D, 0x82, 0x00, 0x51, 0x65, 0x72, 0xBF, 0xA1, 0x7B, 0x18, 0x61, 0x62, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76,
+    0x77, 0x78, 0x79, 0x7A, 0xB3, 0xC8, 0xB4, 0x36, 0xB5, 0x82, 0xB5, 0xFE, 0xB6, 0xF2, 0x19, 0x19,
+    0xB7, 0x0F, 0xB9, 0x32, 0x19, 0x19, 0x19, 0xB9, 0x99, 0x19, 0xBB, 0xD5, 0x19, 0xBD, 0xC9, 0xBF,
+    0x6C, 0x78, 0x19, 0x19, 0x19, 0x19, 0x19, 0x80, 0x00, 0x81, 0x80, 0x05, 0x92, 0x80, 0x05, 0x72,
+    0x01, 0xB3, 0x7D, 0x02, 0x65, 0xC3, 0x77, 0x7D, 0x80, 0x02, 0x52, 0x01, 0x2E, 0x13, 0x01, 0x73,
+    0x0B, 0x04, 0x2E, 0x69, 0x6E, 0x73, 0x13, 0x17, 0x0B, 0x0B, 0x01, 0x61, 0x77, 0x80, 0x05, 0x21,
+    0x01, 0x65, 0x7D, 0x01, 0x74, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x65, 0x17, 0x01, 0x6E, 0x7D, 0x01,
+    0x6E, 0x0B, 0x01, 0xB3, 0x7D, 0x02, 0x6F, 0xC3, 0x77, 0x7D, 0x01, 0x6F, 0x16, 0x03, 0x61, 0x69,
+    0x74, 0x69, 0x78, 0x08, 0x02, 0x2E, 0x73, 0x13, 0x0B, 0x01, 0x6E, 0x0C, 0x01, 0x2E, 0x04, 0x01,
+    0x73, 0x1C, 0x02, 0x2E, 0x73, 0x04, 0x1C, 0x03, 0x61, 0x65, 0x6F, 0x24, 0x0D, 0x0D, 0x01, 0x65,
+    0x1C, 0x01, 0x6F, 0x24, 0x03, 0x2E, 0x61, 0x65, 0x13, 0x60, 0x17, 0x03, 0x2E, 0x72, 0x73, 0x13,
+    0x79, 0x0B, 0x08, 0x2E, 0x61, 0x65, 0x6C, 0x6D, 0x6E, 0x6F, 0x74, 0x04, 0xBF, 0xD2, 0xBF, 0xD7,
+    0x65, 0x36, 0x6F, 0x79, 0x36, 0x01, 0x72, 0x08, 0x80, 0x03, 0x02, 0x01, 0x64, 0x7D, 0x01, 0x61,
+    0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x6F, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x63, 0x7D, 0x02, 0x69, 0x72,
+    0x7D, 0x08, 0x80, 0x05, 0x33, 0x01, 0x2E, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x61, 0x7D, 0x01, 0x67,
+    0x7D, 0x80, 0x00, 0xB1, 0x01, 0x2E, 0x00, 0x01, 0x73, 0x7D, 0x02, 0x2E, 0x65, 0x00, 0x7D, 0x01,
+    0x6E, 0xBF, 0xC9, 0x01, 0x61, 0x7C, 0x01, 0x63, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x72, 0x7D, 0x80,
+    0x05, 0x61, 0x01, 0x61, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x6C, 0x7D, 0x03, 0x65, 0x69, 0x6F, 0x71,
+    0x7D, 0x17, 0x02, 0x6F, 0x72, 0x04, 0x0C, 0x01, 0x69, 0x16, 0x01, 0x6C, 0x0C, 0x01, 0x65, 0x16,
+    0x05, 0x2E, 0x64, 0x66, 0x67, 0x74, 0x04, 0x72, 0x77, 0x7A, 0x7D, 0x01, 0x63, 0x0C, 0x01, 0x69,
+    0x7D, 0x01, 0x68, 0xB8, 0x2A, 0x01, 0x6F, 0x17, 0x05, 0x2E, 0x69, 0x6D, 0x6E, 0x73, 0x13, 0x17,
+    0x7D, 0x0B, 0x0B, 0x82, 0x00, 0xC1, 0x2E, 0x73, 0x13, 0x0B, 0x02, 0x61, 0x6F, 0x79, 0x79, 0x02,
+    0x2E, 0x73, 0xBF, 0x83, 0xBF, 0x86, 0x03, 0x61, 0x65, 0x6F, 0x79, 0x79, 0x79, 0x80, 0x00, 0x82,
+    0x01, 0x2E, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x73, 0xBF, 0x6F, 0x01, 0x6F, 0x7C, 0x02, 0x6E, 0x73,
+    0x0B, 0x0B, 0x01, 0x65, 0xBF, 0x63, 0x03, 0x2E, 0x6E, 0x73, 0x13, 0x0B, 0x0B, 0x03, 0x2E, 0x69,
+    0x73, 0x13, 0x17, 0x0B, 0x01, 0x73, 0x13, 0x05, 0x2E, 0x69, 0x6D, 0x6E, 0x73, 0x13, 0x7D, 0xBF,
+    0xAE, 0x0B, 0x0B, 0x02, 0x61, 0x73, 0x74, 0x0B, 0x03, 0xA1, 0xA9, 0xAD, 0xBF, 0xDE, 0x65, 0x7B,
+    0x0C, 0x2E, 0x61, 0x63, 0x65, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x73, 0x74, 0xC3, 0x04, 0xBE, 0xA1,
+    0xBF, 0x91, 0xBF, 0x98, 0xBF, 0xAA, 0xBF, 0xB6, 0xBF, 0xC3, 0xBF, 0xCA, 0xBF, 0xCD, 0xBF, 0xD2,
+    0xBF, 0xD2, 0x78, 0x03, 0x2E, 0x69, 0x73, 0x04, 0x24, 0x1C, 0x01, 0x65, 0x79, 0x03, 0x2E, 0x65,
+    0x74, 0x04, 0xBE, 0x74, 0x7D, 0x01, 0x65, 0x24, 0x01, 0x69, 0x0C, 0x80, 0x01, 0xD2, 0x80, 0x01,
+    0xB1, 0x80, 0x01, 0xB2, 0x05, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x07,
+    0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x6C, 0x6C, 0x6F, 0x6C, 0x6C, 0x6C, 0x75, 0x01, 0x6F,
+    0x71, 0x01, 0x72, 0x2F, 0x01, 0x74, 0x7D, 0x03, 0x64, 0x73, 0x74, 0xBF, 0xD1, 0x7D, 0x08, 0x80,
+    0x05, 0x11, 0x01, 0x2E, 0x7D, 0x02, 0x2E, 0x73, 0x7A, 0x7D, 0x01, 0x6F, 0x7B, 0x01, 0x73, 0x7D,
+    0x01, 0xAD, 0x7D, 0x13, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6C, 0x6D, 0x6E,
+    0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0xC3, 0x04, 0xBE, 0x10, 0xBE, 0x27, 0xBE, 0x4A, 0xBE, 0x7F,
+    0xBE, 0x92, 0xBE, 0xAA, 0xBE, 0x92, 0xBE, 0xBB, 0xBE, 0xC7, 0xBE, 0xE8, 0xBE, 0xFD, 0x24, 0xBF,
+    0x0B, 0xBF, 0x7D, 0xBF, 0xAA, 0xBF, 0xB2, 0x64, 0x7D, 0x80, 0x06, 0x83, 0x83, 0x00, 0xB1, 0x6E,
+    0x74, 0x7A, 0x12, 0x12, 0x12, 0x81, 0x00, 0xB1, 0x74, 0x12, 0x81, 0x00, 0xB1, 0x6E, 0x12, 0x01,
+    0x69, 0x2F, 0x01, 0x6C, 0x7D, 0x80, 0x0D, 0xD2, 0x01, 0x2E, 0x7D, 0x01, 0x73, 0x7D, 0x82, 0x00,
+    0xF1, 0x61, 0x6F, 0x7D, 0x7A, 0x8E, 0x07, 0x11, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6C, 0x6D,
+    0x70, 0x71, 0x73, 0x74, 0x76, 0x7A, 0x03, 0x03, 0x79, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x01, 0x6E, 0x61, 0x80, 0x02, 0x32, 0x80, 0x00, 0x01, 0x01, 0x61, 0x2E,
+    0x01, 0xAD, 0x7D, 0x01, 0xC3, 0x7D, 0x01, 0x67, 0x7D, 0x01, 0x6F, 0x7D, 0x05, 0xA1, 0xA9, 0xAD,
+    0xB3, 0xBA, 0xB1, 0x50, 0xB1, 0x50, 0xB1, 0x50, 0xB1, 0x50, 0xB1, 0x50, 0x08, 0x61, 0x65, 0x68,
+    0x69, 0x6C, 0x6F, 0x75, 0xC3, 0x23, 0x23, 0xB0, 0xF3, 0x23, 0x6D, 0x23, 0x23, 0x70, 0x80, 0x04,
+    0xD2, 0x01, 0xAD, 0x7D, 0x01, 0xC3, 0x7D, 0x01, 0x6E, 0x7D, 0x04, 0x62, 0x65, 0x6F, 0x75, 0xBF,
+    0x88, 0xBF, 0xBA, 0x62, 0x7D, 0x80, 0x06, 0xB2, 0x96, 0x00, 0x71, 0x2E, 0x62, 0x63, 0x64, 0x66,
     0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79,
-    0x7A, 0xD1, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xA0, 0x01, 0xD2, 0x21, 0xAD, 0xFD, 0x21, 0xC3, 0xFD,
-    0x21, 0x6E, 0xFD, 0xA0, 0x05, 0xB1, 0xA0, 0x05, 0xC2, 0xA0, 0x05, 0xE2, 0x25, 0xA1, 0xA9, 0xAD,
-    0xB3, 0xBA, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x27, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xEC,
-    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF5, 0x21, 0x6F, 0xF1, 0x21, 0x69, 0xFD, 0x21, 0x6C, 0xFD, 0xA0,
-    0x05, 0x81, 0xA0, 0x06, 0x72, 0x21, 0x2E, 0xFD, 0x21, 0x73, 0xFD, 0xA2, 0x05, 0x81, 0x6F, 0x61,
-    0xFA, 0xFD, 0xAE, 0x06, 0x31, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6C, 0x6D, 0x70, 0x71, 0x73,
-    0x74, 0x76, 0x7A, 0xED, 0xED, 0xF9, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED,
-    0xED, 0x21, 0x6E, 0xE1, 0xA0, 0x06, 0x01, 0xA0, 0x06, 0x92, 0xA0, 0x06, 0x12, 0x25, 0xA1, 0xA9,
-    0xAD, 0xB3, 0xBA, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xA0, 0x02, 0x51, 0x21, 0x61, 0xFD, 0x21, 0xAD,
-    0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x67, 0xFD, 0x21, 0x6F, 0xFD, 0x28, 0x68, 0x61, 0x65, 0x69, 0x6F,
-    0x75, 0xC3, 0x6C, 0xDA, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xE3, 0xFD, 0x44, 0x75, 0x62, 0x65, 0x6F,
-    0xFF, 0x65, 0xFF, 0x91, 0xFF, 0xC6, 0xFF, 0xEF, 0xA0, 0x04, 0x41, 0xA0, 0x04, 0x52, 0xA0, 0x04,
-    0x72, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x27, 0x68, 0x61, 0x65,
-    0x69, 0x6F, 0x75, 0xC3, 0xEC, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF5, 0x21, 0x61, 0xF1, 0x21, 0x63,
-    0xFD, 0x21, 0x73, 0xFD, 0xD8, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B,
-    0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x6C, 0x72, 0x69, 0x75, 0xFE,
-    0xC5, 0xFE, 0xC8, 0xFE, 0xCE, 0xFE, 0xC8, 0xFE, 0xD7, 0xFE, 0xDC, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE,
-    0xC8, 0xFE, 0xDC, 0xFE, 0xC8, 0xFE, 0xE1, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xEA, 0xFE, 0xC8, 0xFE,
-    0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xF4, 0xFE, 0xF4, 0xFF, 0xC7, 0xFF, 0xFD, 0x41,
-    0x6C, 0xFF, 0x45, 0x21, 0x61, 0xFC, 0x21, 0x75, 0xFD, 0x41, 0x72, 0xFF, 0x3B, 0x22, 0x6E, 0x75,
-    0xF9, 0xFC, 0x41, 0x78, 0xFF, 0x32, 0x41, 0x78, 0xFF, 0x34, 0x21, 0xB3, 0xFC, 0x41, 0x6E, 0xFF,
-    0x27, 0xA0, 0x01, 0x52, 0x21, 0x64, 0xFD, 0xA0, 0x06, 0x43, 0x21, 0x61, 0xFD, 0x21, 0x65, 0xFA,
-    0x23, 0x6E, 0x70, 0x76, 0xF4, 0xFA, 0xFD, 0x21, 0x74, 0xEA, 0x21, 0x73, 0xFD, 0x21, 0x6E, 0xFA,
-    0x21, 0x69, 0xED, 0x21, 0x6C, 0xFD, 0x24, 0x61, 0x65, 0x69, 0x6F, 0xEA, 0xF4, 0xF7, 0xFD, 0x21,
-    0x6E, 0xF7, 0x25, 0x61, 0x6F, 0xC3, 0x75, 0x65, 0xBB, 0xC0, 0xC8, 0xCB, 0xFD, 0xA1, 0x00, 0x61,
-    0x69, 0xF5, 0xA0, 0x07, 0xB1, 0x21, 0x62, 0xFD, 0xA0, 0x00, 0xF1, 0x21, 0x68, 0xFD, 0x22, 0x69,
-    0x6F, 0xFA, 0xFA, 0x21, 0x74, 0xF5, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x24, 0x63, 0x73, 0x72,
-    0x74, 0xEF, 0xF2, 0xFD, 0xEC, 0xA2, 0x06, 0x01, 0x69, 0x65, 0xE0, 0xF7, 0xA0, 0x02, 0x91, 0x21,
-    0x72, 0xFD, 0x21, 0x65, 0xFA, 0x21, 0x65, 0xFD, 0x22, 0x65, 0x72, 0xF7, 0xFD, 0x21, 0x6E, 0xEF,
-    0x41, 0x6C, 0xFE, 0x6F, 0x22, 0x65, 0x75, 0xF9, 0xFC, 0x21, 0x74, 0xE3, 0x21, 0x73, 0xFD, 0x21,
-    0xB3, 0xFD, 0x21, 0xC3, 0xFD, 0x41, 0x63, 0xFE, 0x5A, 0x21, 0x73, 0xFC, 0x22, 0x65, 0x69, 0xFD,
-    0xF9, 0x21, 0x64, 0xCB, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x61, 0xD3,
-    0x21, 0x69, 0xFD, 0x21, 0x6F, 0xB9, 0x21, 0x74, 0xFD, 0xA7, 0x07, 0x62, 0x63, 0x67, 0x70, 0x6C,
-    0x72, 0x78, 0x75, 0xBF, 0xCB, 0xD9, 0xE3, 0xF1, 0xF7, 0xFD, 0x42, 0x63, 0x74, 0xFF, 0xA2, 0xFF,
-    0xA2, 0x41, 0x63, 0xFF, 0x9B, 0x22, 0x69, 0x75, 0xF5, 0xFC, 0x41, 0x69, 0xFF, 0x92, 0x21, 0x63,
-    0xFC, 0x21, 0x69, 0xFD, 0x41, 0xA1, 0xFE, 0x0B, 0x21, 0xC3, 0xFC, 0x41, 0x73, 0xFF, 0x81, 0x21,
-    0x69, 0xFC, 0xA4, 0x07, 0x62, 0x64, 0x66, 0x74, 0x78, 0xE3, 0xEF, 0xF6, 0xFD, 0x41, 0x75, 0xFF,
-    0x8C, 0x21, 0x70, 0xFC, 0x41, 0x6F, 0xFD, 0xEB, 0xA2, 0x07, 0x62, 0x6D, 0x74, 0xF9, 0xFC, 0xA0,
-    0x00, 0xF2, 0x21, 0x69, 0xFD, 0xA0, 0x01, 0x32, 0x21, 0x72, 0xFD, 0x21, 0xA9, 0xFD, 0x43, 0x65,
-    0xC3, 0x74, 0xFF, 0xFA, 0xFF, 0xFD, 0xFF, 0x2A, 0x41, 0x6E, 0xFF, 0x20, 0x21, 0xAD, 0xFC, 0x23,
-    0x65, 0x69, 0xC3, 0xF9, 0xF9, 0xFD, 0x21, 0x64, 0xF9, 0xA3, 0x05, 0x02, 0x6B, 0x70, 0x72, 0xD9,
-    0xE5, 0xFD, 0xA0, 0x07, 0x62, 0xA0, 0x07, 0xA1, 0x21, 0x6C, 0xFD, 0x21, 0x75, 0xFD, 0xA1, 0x07,
-    0x82, 0x67, 0xFD, 0xA0, 0x07, 0x82, 0xC1, 0x07, 0x82, 0x70, 0xFE, 0xFD, 0x25, 0xA1, 0xA9, 0xAD,
-    0xB3, 0xBA, 0xF2, 0xF7, 0xF7, 0xFA, 0xF7, 0xA0, 0x01, 0xA1, 0x21, 0x62, 0xFD, 0x21, 0x72, 0xFD,
-    0x21, 0x75, 0xFD, 0x48, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0x6E, 0xFE, 0xF2, 0xFF, 0x46,
-    0xFF, 0x7F, 0xFF, 0x95, 0xFF, 0xC6, 0xFF, 0xCF, 0xFF, 0xE9, 0xFF, 0xFD, 0xA0, 0x0A, 0x01, 0x21,
-    0x74, 0xFD, 0x21, 0x75, 0xFD, 0xA2, 0x00, 0x61, 0x6F, 0x61, 0xDE, 0xFD, 0xA0, 0x08, 0x12, 0xA0,
-    0x08, 0x33, 0xC2, 0x07, 0x82, 0x6D, 0x6E, 0xFD, 0x4D, 0xFD, 0x4D, 0xA0, 0x0B, 0x45, 0x23, 0xA1,
-    0xA9, 0xB3, 0xFD, 0xFD, 0xFD, 0x24, 0x61, 0x65, 0x6F, 0xC3, 0xF6, 0xF6, 0xF6, 0xF9, 0x21, 0x73,
-    0xF7, 0x21, 0x65, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD, 0xA1, 0x07, 0x82,
-    0x6E, 0xFD, 0xA0, 0x08, 0x63, 0xA0, 0x08, 0x92, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFA, 0xFD,
-    0xFD, 0xFD, 0xFD, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xFF, 0xB9, 0xFF, 0xBC, 0xFF,
-    0xBF, 0xFF, 0xEA, 0xFF, 0x70, 0xFF, 0x70, 0xFF, 0xF5, 0x42, 0x73, 0x75, 0xFF, 0xEA, 0xFF, 0x96,
-    0xA0, 0x09, 0x91, 0x21, 0x68, 0xFD, 0xA1, 0x09, 0x81, 0x63, 0xFD, 0x21, 0x6F, 0xFB, 0x21, 0x69,
-    0xFD, 0x21, 0x63, 0xFD, 0x21, 0x65, 0xFD, 0xA2, 0x00, 0x61, 0x65, 0x69, 0xE2, 0xFD, 0xA0, 0x00,
-    0x61, 0xA0, 0x0C, 0xC3, 0x21, 0x75, 0xFD, 0xA0, 0x04, 0x91, 0x21, 0x74, 0xFD, 0x22, 0x64, 0x73,
-    0xF7, 0xFD, 0x22, 0x6E, 0x73, 0xF5, 0xF5, 0x21, 0x6F, 0xFB, 0x22, 0x74, 0x7A, 0xED, 0xED, 0x21,
-    0x6E, 0xFB, 0x21, 0x61, 0xFD, 0x21, 0x64, 0xFD, 0x43, 0x63, 0x65, 0x6E, 0xFF, 0xEF, 0xFD, 0x20,
-    0xFF, 0xFD, 0x21, 0x6E, 0xD8, 0x23, 0x65, 0x61, 0x69, 0xD8, 0xF3, 0xFD, 0x21, 0x6C, 0xF9, 0x41,
-    0x69, 0xFD, 0x1D, 0xA0, 0x04, 0xA2, 0xA0, 0x04, 0xC2, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0x27, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xB3, 0xEF, 0xEF, 0xEF,
-    0xEF, 0xEF, 0xF5, 0x22, 0x6C, 0x6F, 0xDC, 0xF1, 0xA2, 0x00, 0x61, 0x61, 0x69, 0xD4, 0xFB, 0xA0,
-    0x0D, 0x43, 0x21, 0x69, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x62, 0xF4, 0x21, 0xA1,
-    0xFD, 0x22, 0xC3, 0x61, 0xFD, 0xFA, 0x23, 0x66, 0x6D, 0x72, 0xEF, 0xF2, 0xFB, 0xA0, 0x0D, 0x73,
-    0x21, 0x62, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x72, 0xFD, 0xA0, 0x0D, 0x42, 0x21, 0x69, 0xFD, 0x21,
-    0x74, 0xFD, 0x21, 0x70, 0xFD, 0x22, 0xA1, 0xB3, 0xF1, 0xFD, 0x21, 0x70, 0xEF, 0x21, 0x6F, 0xFD,
-    0x21, 0x72, 0xFD, 0x21, 0x75, 0xFD, 0x21, 0x6D, 0xE3, 0x21, 0xA1, 0xFD, 0x22, 0x61, 0xC3, 0xFA,
-    0xFD, 0x21, 0x6C, 0xFB, 0x21, 0x73, 0xFD, 0x41, 0x70, 0xFE, 0x28, 0x21, 0x73, 0xFC, 0x21, 0x6C,
-    0xCB, 0x22, 0x69, 0x65, 0xFA, 0xFD, 0x45, 0x61, 0xC3, 0x65, 0x69, 0x68, 0xFF, 0xB0, 0xFF, 0xCF,
-    0xFF, 0xDD, 0xFF, 0xEE, 0xFF, 0xFB, 0x21, 0x6E, 0xF0, 0xA0, 0x06, 0xD2, 0x41, 0x69, 0xFB, 0xE3,
-    0xA0, 0x0E, 0x92, 0x21, 0x65, 0xFD, 0xC3, 0x0D, 0xB3, 0x63, 0x72, 0x6A, 0xFF, 0xF6, 0xFB, 0xD9,
-    0xFF, 0xFD, 0x21, 0x6F, 0xEE, 0x21, 0xAD, 0xFD, 0x43, 0x67, 0x69, 0xC3, 0xFB, 0xC7, 0xFF, 0xE8,
-    0xFF, 0xFD, 0xA0, 0x06, 0xB2, 0xA1, 0x0E, 0x92, 0x61, 0xDB, 0x22, 0x63, 0x72, 0xF8, 0xFB, 0x21,
-    0x65, 0xFB, 0x41, 0x72, 0xFB, 0xAD, 0xA1, 0x0E, 0x92, 0x73, 0xCA, 0x23, 0x65, 0x61, 0x69, 0xC5,
-    0xFB, 0xC5, 0x21, 0x61, 0xBE, 0xC6, 0x0D, 0xB3, 0x72, 0x6C, 0x61, 0x6D, 0x74, 0x6F, 0xFF, 0xD3,
-    0xFF, 0xEA, 0xFF, 0xED, 0xFF, 0xF6, 0xFF, 0xFD, 0xFB, 0x9A, 0xA0, 0x05, 0x71, 0x21, 0x6F, 0xFD,
-    0x21, 0x64, 0xFD, 0xC3, 0x05, 0x81, 0x64, 0x65, 0x75, 0xFC, 0x8E, 0xFF, 0x9D, 0xFF, 0xFD, 0xC1,
-    0x0E, 0x92, 0x6F, 0xFF, 0x91, 0x43, 0xA1, 0xA9, 0xB3, 0xFF, 0x8B, 0xFF, 0x8B, 0xFF, 0x8B, 0x45,
-    0x61, 0x65, 0x6C, 0x6F, 0xC3, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0xF0, 0xFF, 0x81, 0xFF, 0xF6, 0x42,
-    0x61, 0x6F, 0xFF, 0x71, 0xFF, 0x71, 0x41, 0x72, 0xFF, 0x8C, 0x21, 0x70, 0xFC, 0x41, 0x72, 0xFF,
-    0x63, 0x21, 0x65, 0xFC, 0x41, 0x61, 0xFB, 0x3B, 0x42, 0x6D, 0x74, 0xFB, 0x37, 0xFF, 0xFC, 0xC7,
-    0x0D, 0xB3, 0x6E, 0x67, 0x6C, 0x7A, 0x6D, 0x63, 0x73, 0xFF, 0xB4, 0xFF, 0x63, 0xFF, 0xD0, 0xFF,
-    0xE0, 0xFF, 0xEB, 0xFF, 0xF2, 0xFF, 0xF9, 0x41, 0x65, 0xFF, 0x5B, 0x41, 0x73, 0xFF, 0x8F, 0x21,
-    0x65, 0xFC, 0xA2, 0x0D, 0xB3, 0x70, 0x72, 0xF5, 0xFD, 0x42, 0x61, 0x65, 0xFF, 0x27, 0xFF, 0x39,
-    0x44, 0x61, 0xC3, 0x65, 0x6F, 0xFF, 0x20, 0xFF, 0x95, 0xFF, 0x20, 0xFF, 0x20, 0xA2, 0x0D, 0xB3,
-    0x72, 0x6C, 0xEC, 0xF3, 0xA0, 0x0D, 0xE3, 0xC1, 0x0D, 0xE3, 0x6E, 0xFA, 0xE8, 0xA0, 0x0E, 0x72,
-    0xA1, 0x05, 0x81, 0x69, 0xFD, 0xA1, 0x0D, 0xE3, 0x6E, 0xFB, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA,
-    0xEA, 0xEA, 0xED, 0xFB, 0xEA, 0x41, 0x76, 0xFF, 0x0D, 0x41, 0x6D, 0xFF, 0x09, 0x22, 0x65, 0x6F,
-    0xF8, 0xFC, 0x48, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0x72, 0xFE, 0xD7, 0xFE, 0xE4, 0xFF,
-    0x23, 0xFF, 0x8D, 0xFF, 0xB0, 0xFF, 0xCB, 0xFF, 0xE8, 0xFF, 0xFB, 0x21, 0x74, 0xE7, 0x21, 0x73,
-    0xFD, 0x41, 0x70, 0xFB, 0xB0, 0x21, 0xBA, 0xFC, 0x22, 0x75, 0xC3, 0xF9, 0xFD, 0xA0, 0x01, 0x11,
-    0x21, 0x6E, 0xFD, 0x21, 0xAD, 0xFD, 0x22, 0x69, 0xC3, 0xFA, 0xFD, 0x21, 0x64, 0xFB, 0xA2, 0x04,
-    0xA2, 0x63, 0x72, 0xEA, 0xFD, 0x21, 0x6C, 0xE8, 0x21, 0x75, 0xFD, 0x21, 0x62, 0xFD, 0xA1, 0x04,
-    0xC2, 0x6D, 0xFD, 0x45, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFF, 0xFB, 0xFD, 0xE3, 0xFD, 0xE3, 0xFD,
-    0xE3, 0xFD, 0xE3, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xFD, 0x94, 0xFD, 0xD0, 0xFD,
-    0xD0, 0xFD, 0xD0, 0xFF, 0xDB, 0xFD, 0xD0, 0xFF, 0xF0, 0x22, 0xA1, 0xAD, 0xB4, 0xB4, 0x24, 0x61,
-    0xC3, 0x65, 0x69, 0xAF, 0xFB, 0xAF, 0xAF, 0x21, 0x62, 0xF7, 0xC2, 0x01, 0x11, 0x61, 0x6F, 0xFF,
-    0xA3, 0xFF, 0xA3, 0x21, 0x62, 0xF7, 0x21, 0xAD, 0xFD, 0xA2, 0x04, 0x91, 0x69, 0xC3, 0xEE, 0xFD,
-    0x41, 0x74, 0xFA, 0x1F, 0x21, 0x72, 0xFC, 0x21, 0x6F, 0xFD, 0xA1, 0x0D, 0xB2, 0x62, 0xFD, 0x41,
-    0x72, 0xFE, 0x63, 0x21, 0x61, 0xFC, 0xA1, 0x0D, 0xB2, 0x74, 0xFD, 0xA0, 0x0D, 0xB2, 0xA0, 0x0E,
-    0xB2, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x27, 0x68, 0x61, 0x65,
-    0x69, 0x6F, 0x75, 0xC3, 0xCD, 0xDE, 0xEA, 0xEF, 0xEF, 0xEF, 0xF5, 0x42, 0x65, 0x6F, 0xFF, 0x88,
-    0xFF, 0xF1, 0xC3, 0x00, 0x61, 0x61, 0x6F, 0x72, 0xFD, 0xF4, 0xFF, 0x3C, 0xFF, 0xF9, 0x41, 0x72,
-    0xFB, 0x6B, 0x21, 0x65, 0xFC, 0x41, 0xB3, 0xFB, 0x4A, 0x42, 0x6F, 0xC3, 0xFB, 0x46, 0xFF, 0xFC,
-    0x43, 0x72, 0x69, 0x73, 0xFB, 0x3C, 0xFF, 0xF2, 0xFF, 0xF9, 0x42, 0x73, 0x74, 0xFB, 0x32, 0xFB,
-    0x32, 0x41, 0xAD, 0xFB, 0x48, 0x22, 0x69, 0xC3, 0xF5, 0xFC, 0x21, 0x6D, 0xFB, 0x41, 0x6D, 0xFB,
-    0x1F, 0x21, 0x72, 0xFC, 0x21, 0xAD, 0xFD, 0x22, 0x69, 0xC3, 0xFA, 0xFD, 0x41, 0x76, 0xFB, 0x10,
-    0x21, 0xA1, 0xFC, 0xA0, 0x04, 0xE2, 0x21, 0x70, 0xFD, 0x23, 0x61, 0xC3, 0x75, 0xF3, 0xF7, 0xFD,
-    0x21, 0x72, 0xF9, 0x41, 0x69, 0xFB, 0x5E, 0x21, 0x64, 0xFC, 0x21, 0x6E, 0xFD, 0x41, 0xB1, 0xFA,
-    0xEF, 0x21, 0xC3, 0xFC, 0x21, 0xBA, 0xFD, 0x23, 0x6F, 0x75, 0xC3, 0xF3, 0xFA, 0xFD, 0x41, 0x73,
-    0xFF, 0x42, 0x21, 0xBA, 0xFC, 0x42, 0x75, 0xC3, 0xFA, 0xF7, 0xFF, 0xFD, 0x41, 0x67, 0xFA, 0xD3,
-    0x41, 0x7A, 0xFE, 0x14, 0x41, 0x6A, 0xFA, 0xC8, 0x23, 0xA9, 0xAD, 0xB3, 0xF4, 0xF8, 0xFC, 0x42,
-    0x61, 0xC3, 0xF9, 0x40, 0xFB, 0x35, 0x42, 0x6D, 0x74, 0xF9, 0x39, 0xF9, 0x39, 0x43, 0x7A, 0x6D,
-    0x73, 0xFF, 0xF2, 0xFA, 0xAF, 0xFF, 0xF9, 0x45, 0x65, 0xC3, 0x69, 0x6F, 0x71, 0xFF, 0xD5, 0xFF,
-    0xE1, 0xFF, 0xF6, 0xFF, 0xDD, 0xFA, 0xA5, 0x41, 0xAD, 0xFF, 0x76, 0x42, 0x69, 0xC3, 0xFF, 0x72,
-    0xFF, 0xFC, 0x43, 0xA1, 0xA9, 0xB3, 0xFA, 0x8A, 0xFA, 0x8A, 0xFA, 0x8A, 0x44, 0x61, 0xC3, 0x65,
-    0x6F, 0xFA, 0x80, 0xFF, 0xF6, 0xFA, 0x80, 0xFA, 0x80, 0x41, 0x65, 0xFA, 0xD8, 0x21, 0x72, 0xFC,
-    0x42, 0x6E, 0x74, 0xFA, 0xA1, 0xFA, 0x6C, 0xA0, 0x00, 0x40, 0x21, 0x74, 0xFD, 0x21, 0x65, 0xFD,
-    0x42, 0xA9, 0xAD, 0xFA, 0x94, 0xFF, 0xFD, 0x22, 0x65, 0xC3, 0xE9, 0xF9, 0x22, 0x61, 0x72, 0xE1,
-    0xFB, 0x41, 0x67, 0xFF, 0x42, 0x41, 0xBA, 0xFF, 0x28, 0x42, 0x75, 0xC3, 0xFF, 0x24, 0xFF, 0xFC,
-    0xCE, 0x07, 0x62, 0x62, 0x64, 0x66, 0x67, 0x63, 0x6A, 0x6C, 0x6E, 0x6D, 0x70, 0x65, 0x71, 0x7A,
-    0x73, 0xFF, 0x00, 0xFF, 0x1A, 0xFF, 0x27, 0xFF, 0x40, 0xFF, 0x57, 0xFF, 0x65, 0xFF, 0x97, 0xFF,
-    0xAB, 0xFF, 0xBC, 0xFF, 0xEC, 0xFF, 0xF1, 0xFF, 0x33, 0xFF, 0x33, 0xFF, 0xF9, 0xA0, 0x05, 0x02,
-    0x49, 0x6F, 0x63, 0x69, 0x66, 0x67, 0x76, 0x61, 0x73, 0x74, 0xF8, 0x8F, 0xFA, 0x0C, 0xFA, 0x71,
-    0xFA, 0x0C, 0xFA, 0x0C, 0xFA, 0x0C, 0xF8, 0x8F, 0xFA, 0x0C, 0xFA, 0x0C, 0x41, 0x64, 0xF8, 0x73,
-    0x21, 0x6E, 0xFC, 0x21, 0x69, 0xFD, 0xC3, 0x07, 0x62, 0x6E, 0x6D, 0x76, 0xFF, 0xDA, 0xFE, 0xDD,
-    0xFF, 0xFD, 0x41, 0x6E, 0xF9, 0xF7, 0x21, 0x65, 0xFC, 0x41, 0x61, 0xF9, 0xD3, 0x22, 0x69, 0x67,
-    0xF9, 0xFC, 0xC4, 0x07, 0x62, 0x62, 0x72, 0x63, 0x6A, 0xFE, 0xC1, 0xFF, 0xFB, 0xF9, 0xCA, 0xFA,
-    0x73, 0x42, 0xA1, 0xB3, 0xF9, 0xBB, 0xF9, 0xBB, 0x43, 0x61, 0xC3, 0x6F, 0xF9, 0xB4, 0xFF, 0xF9,
-    0xF9, 0xB4, 0x42, 0x63, 0x71, 0xFF, 0xF6, 0xF9, 0xAA, 0x42, 0x63, 0x71, 0xFF, 0xD0, 0xF9, 0xA3,
-    0x21, 0xAD, 0xF9, 0x22, 0x69, 0xC3, 0xEF, 0xFD, 0xC1, 0x05, 0x81, 0x74, 0xFC, 0x34, 0x41, 0x74,
-    0xFC, 0x2E, 0x21, 0xA1, 0xFC, 0x22, 0x61, 0xC3, 0xF3, 0xFD, 0x42, 0xA9, 0xB3, 0xF8, 0x05, 0xF8,
-    0x05, 0x48, 0x72, 0x61, 0x73, 0x6D, 0x65, 0xC3, 0x64, 0x66, 0xF7, 0xFE, 0xF7, 0xFE, 0xF7, 0xFE,
-    0xFF, 0x16, 0xF7, 0xFE, 0xFF, 0xF9, 0xF7, 0xFE, 0xF9, 0x7B, 0xC1, 0x05, 0x81, 0x72, 0xF7, 0xE5,
-    0x42, 0xAD, 0xA1, 0xFF, 0xFA, 0xF7, 0xDF, 0x43, 0x69, 0xC3, 0x74, 0xFF, 0xDA, 0xFF, 0xF9, 0xF9,
-    0x55, 0x41, 0xA1, 0xF9, 0x4E, 0x42, 0x61, 0xC3, 0xF9, 0x4A, 0xFF, 0xFC, 0x41, 0x7A, 0xF9, 0x40,
-    0x21, 0xAD, 0xFC, 0x22, 0x69, 0xC3, 0xF9, 0xFD, 0x21, 0x6C, 0xFB, 0x21, 0x69, 0xFD, 0xC5, 0x07,
-    0x62, 0x62, 0x6D, 0x6E, 0x73, 0x74, 0xFF, 0x95, 0xFF, 0xA7, 0xFF, 0xD9, 0xFF, 0xE7, 0xFF, 0xFD,
-    0x43, 0x61, 0x65, 0x6F, 0xF9, 0x1C, 0xF9, 0x1C, 0xF9, 0x1C, 0xC2, 0x07, 0x82, 0x62, 0x6D, 0xF9,
-    0x15, 0xFF, 0xF6, 0x45, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFF, 0xF7, 0xF9, 0xF0, 0xF9, 0xF0, 0xF9,
-    0xF0, 0xF9, 0xF0, 0x46, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xFE, 0xBD, 0xFE, 0xEA, 0xFF, 0x13,
-    0xFF, 0x2F, 0xFF, 0xCB, 0xFF, 0xF0, 0xA1, 0x00, 0x61, 0x65, 0xED, 0x43, 0x6E, 0x72, 0x73, 0xFE,
-    0xD2, 0xF8, 0xE1, 0xF8, 0xE1, 0xA0, 0x0C, 0x12, 0xA1, 0x0C, 0x12, 0x72, 0xFD, 0x21, 0x6E, 0xF8,
-    0x21, 0xB3, 0xFD, 0x23, 0x61, 0x6F, 0xC3, 0xF2, 0xF5, 0xFD, 0x41, 0x70, 0xF7, 0x45, 0x41, 0x6E,
-    0xF7, 0x41, 0x21, 0x65, 0xFC, 0x21, 0x64, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x22, 0x73,
-    0x74, 0xEC, 0xFD, 0x41, 0xA9, 0xF8, 0xBA, 0x21, 0x65, 0xD6, 0x21, 0x69, 0xFD, 0xC7, 0x0F, 0x93,
-    0x65, 0x6C, 0x64, 0x6E, 0x72, 0xC3, 0x6D, 0xFF, 0xBE, 0xF9, 0x7B, 0xFF, 0xD6, 0xFF, 0xF1, 0xF8,
-    0x9F, 0xFF, 0xF6, 0xFF, 0xFD, 0x41, 0xA1, 0xFC, 0xEB, 0x21, 0xC3, 0xFC, 0x42, 0x70, 0x74, 0xF8,
-    0xA9, 0xF7, 0x03, 0x22, 0x75, 0x65, 0xF6, 0xF9, 0x41, 0xA1, 0xF8, 0x74, 0x44, 0x61, 0xC3, 0x65,
-    0x6F, 0xF8, 0x70, 0xFF, 0xFC, 0xF8, 0x70, 0xF8, 0x70, 0x21, 0x74, 0xF3, 0x41, 0x65, 0xF6, 0xE3,
-    0x21, 0x75, 0xFC, 0x21, 0x6C, 0xFD, 0x41, 0x61, 0xFA, 0xF6, 0x41, 0x6E, 0xFC, 0xB6, 0x21, 0x65,
-    0xFC, 0x21, 0x6D, 0xFD, 0x41, 0x65, 0xF8, 0x4B, 0x23, 0x63, 0x69, 0x74, 0xEE, 0xF9, 0xFC, 0x41,
-    0x69, 0xF8, 0x66, 0x21, 0x6D, 0xFC, 0x21, 0xB3, 0xFD, 0x21, 0xC3, 0xFD, 0xC6, 0x0F, 0x93, 0x63,
-    0x73, 0x66, 0x6C, 0x72, 0x74, 0xFF, 0xB7, 0xFF, 0xCD, 0xFF, 0xD7, 0xFF, 0xEC, 0xFB, 0x06, 0xFF,
-    0xFD, 0x41, 0x75, 0xFC, 0x7F, 0x21, 0x63, 0xFC, 0x21, 0x65, 0xFD, 0x41, 0x6D, 0xFF, 0x57, 0x21,
-    0x65, 0xFC, 0x21, 0x6C, 0xAA, 0x21, 0x70, 0xFD, 0x41, 0x74, 0xFF, 0x4A, 0x41, 0x65, 0xF8, 0x29,
-    0x41, 0x6D, 0xF6, 0x7F, 0x21, 0xAD, 0xFC, 0x41, 0x75, 0xF8, 0x1E, 0x44, 0x61, 0x69, 0xC3, 0x72,
-    0xF8, 0x1A, 0xFF, 0xF5, 0xFF, 0xF9, 0xFF, 0xFC, 0x22, 0x70, 0x74, 0xE4, 0xF3, 0xA5, 0x0F, 0x93,
-    0x6A, 0x6C, 0x6D, 0x6E, 0x73, 0xCB, 0xD2, 0xD8, 0xDB, 0xFB, 0x41, 0x69, 0xFC, 0x36, 0x21, 0x70,
-    0xFC, 0x21, 0x69, 0xFD, 0x21, 0x63, 0xFD, 0x41, 0x63, 0xFA, 0x65, 0x21, 0x69, 0xFC, 0x41, 0xAD,
-    0xF7, 0xCF, 0x42, 0x69, 0xC3, 0xF7, 0xCB, 0xFF, 0xFC, 0x21, 0x64, 0xF9, 0xA3, 0x0F, 0x93, 0x63,
-    0x66, 0x72, 0xE8, 0xEF, 0xFD, 0x41, 0x62, 0xFA, 0xEF, 0xA1, 0x0F, 0x93, 0x72, 0xFC, 0x42, 0xA9,
-    0xB3, 0xF7, 0x9E, 0xF7, 0x9E, 0x42, 0x61, 0xC3, 0xF7, 0x97, 0xFF, 0xF9, 0x21, 0x74, 0xF9, 0x41,
-    0x74, 0xFF, 0x50, 0xA2, 0x0F, 0xC3, 0x73, 0x72, 0xF9, 0xFC, 0xA0, 0x0F, 0xC3, 0xC3, 0x0F, 0xC3,
-    0x6E, 0x6D, 0x72, 0xFD, 0x8F, 0xFA, 0x1F, 0xF7, 0x7F, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xEA,
-    0xF1, 0xF4, 0xF1, 0xF1, 0x41, 0x79, 0xF8, 0x11, 0x21, 0x61, 0xFC, 0x48, 0x69, 0x68, 0x61, 0x65,
-    0x6F, 0x75, 0xC3, 0x72, 0xFE, 0xC2, 0xF8, 0x91, 0xFF, 0x31, 0xFF, 0x82, 0xFF, 0xB1, 0xFF, 0xBE,
-    0xFF, 0xEE, 0xFF, 0xFD, 0x41, 0x74, 0xF8, 0x78, 0x21, 0x73, 0xFC, 0x41, 0x73, 0xF8, 0x71, 0x21,
-    0x65, 0xFC, 0x22, 0x65, 0x6F, 0xF6, 0xFD, 0x22, 0x62, 0x72, 0xD4, 0xFB, 0x41, 0x73, 0xFD, 0x21,
-    0x21, 0x61, 0xFC, 0x41, 0x61, 0xFD, 0x39, 0x21, 0x72, 0xFC, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD,
-    0x21, 0x65, 0xFD, 0x21, 0x62, 0xFD, 0xA3, 0x00, 0x61, 0x75, 0x6F, 0x65, 0xE1, 0xEA, 0xFD, 0x41,
-    0x70, 0xF6, 0x09, 0x21, 0x6D, 0xFC, 0x41, 0x6A, 0xF6, 0x02, 0xA0, 0x05, 0x52, 0x21, 0x74, 0xFD,
-    0x21, 0xB3, 0xFD, 0x21, 0xC3, 0xFD, 0x22, 0x62, 0x6C, 0xF0, 0xFD, 0x22, 0x69, 0x6F, 0xE8, 0xFB,
-    0x21, 0x65, 0xFB, 0x21, 0x6C, 0xFD, 0xC1, 0x0E, 0xB2, 0x67, 0xF9, 0x8A, 0x41, 0x67, 0xF5, 0x63,
-    0xA1, 0x0E, 0xB2, 0x65, 0xFC, 0x41, 0xB1, 0xF9, 0x7B, 0xA1, 0x0E, 0xB2, 0xC3, 0xFC, 0x43, 0xA1,
-    0xA9, 0xB3, 0xF5, 0x51, 0xF5, 0x51, 0xF5, 0x51, 0x44, 0x61, 0xC3, 0x65, 0x6F, 0xF5, 0x47, 0xFF,
-    0xF6, 0xF5, 0x47, 0xF5, 0x47, 0x21, 0x74, 0xF3, 0xC2, 0x0E, 0xB2, 0x64, 0x6E, 0xFA, 0x38, 0xFF,
-    0xFD, 0xA0, 0x10, 0xD2, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x47,
-    0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xF9, 0x3A, 0xFB, 0x1F, 0xFF, 0xB7, 0xFF, 0xC1, 0xFF,
-    0xCA, 0xFF, 0xE9, 0xFF, 0xF5, 0x21, 0x73, 0xEA, 0x41, 0x78, 0xF8, 0x7E, 0x21, 0xB3, 0xFC, 0x21,
-    0xC3, 0xFD, 0x22, 0x61, 0x69, 0xF3, 0xFD, 0xC2, 0x00, 0x61, 0x65, 0x72, 0xFF, 0x8C, 0xFF, 0xFB,
-    0x42, 0x61, 0x6F, 0xF6, 0x48, 0xF6, 0x48, 0x21, 0x65, 0xF9, 0x21, 0x6D, 0xFD, 0x41, 0x65, 0xF6,
-    0x3B, 0x21, 0x65, 0xFC, 0x21, 0x6D, 0xFD, 0x22, 0x75, 0x65, 0xF3, 0xFD, 0x41, 0x65, 0xF5, 0x60,
-    0x21, 0x72, 0xFC, 0x41, 0x6F, 0xF5, 0x59, 0x21, 0x72, 0xFC, 0x41, 0x72, 0xFB, 0x39, 0x21, 0x67,
-    0xFC, 0x21, 0x69, 0xFD, 0x21, 0x70, 0xFD, 0x41, 0x68, 0xFB, 0x2C, 0x21, 0x6F, 0xFC, 0x21, 0x63,
-    0xFD, 0x41, 0x69, 0xF6, 0x72, 0x21, 0x6E, 0xFC, 0x41, 0x72, 0xF6, 0x6B, 0x23, 0x6C, 0x6D, 0x65,
-    0xF2, 0xF9, 0xFC, 0x41, 0xB3, 0xFC, 0x0A, 0x42, 0x6F, 0xC3, 0xFC, 0x06, 0xFF, 0xFC, 0x21, 0x73,
-    0xF9, 0xA0, 0x05, 0x22, 0x21, 0x65, 0xFD, 0x42, 0x6A, 0x6E, 0xFF, 0xFD, 0xF9, 0x78, 0x21, 0x6F,
-    0xF9, 0x42, 0x65, 0x69, 0xFF, 0xFD, 0xF5, 0x0B, 0x24, 0x65, 0x61, 0x69, 0x74, 0xBC, 0xD4, 0xE6,
-    0xF9, 0x41, 0x74, 0xFF, 0xA2, 0xC4, 0x02, 0xB1, 0x62, 0x63, 0x6E, 0x74, 0xFF, 0x9B, 0xFF, 0xA2,
-    0xFF, 0xF3, 0xFF, 0xFC, 0x41, 0x74, 0xF6, 0xD3, 0x21, 0x73, 0xFC, 0xA1, 0x01, 0x82, 0x65, 0xFD,
-    0x42, 0x6F, 0xC3, 0xF8, 0xA2, 0xFA, 0x85, 0x41, 0x69, 0xF5, 0xE2, 0x21, 0x65, 0xFC, 0x41, 0xA9,
-    0xFD, 0x00, 0x42, 0x65, 0xC3, 0xFC, 0xFC, 0xFF, 0xFC, 0x41, 0x62, 0xF5, 0xB3, 0xA4, 0x09, 0xA3,
-    0x6D, 0x63, 0x6A, 0x72, 0xE3, 0xEE, 0xF5, 0xFC, 0x41, 0xAD, 0xFA, 0xC6, 0x42, 0x69, 0xC3, 0xFA,
-    0xC2, 0xFF, 0xFC, 0xA1, 0x09, 0xA3, 0x6D, 0xF9, 0xA0, 0x09, 0xA3, 0x44, 0x61, 0xC3, 0x65, 0x6F,
-    0xFC, 0x2F, 0xFE, 0xC3, 0xF4, 0x14, 0xF4, 0x14, 0xA1, 0x09, 0xA3, 0x6A, 0xF3, 0x43, 0x61, 0xC3,
-    0x65, 0xF4, 0x02, 0xF5, 0xF7, 0xF4, 0x02, 0x21, 0x72, 0xF6, 0x21, 0x65, 0xFD, 0xA1, 0x09, 0xA3,
-    0x6D, 0xFD, 0xA0, 0x09, 0xD3, 0xC1, 0x09, 0xD3, 0x6A, 0xF6, 0x40, 0x25, 0xA1, 0xA9, 0xAD, 0xB3,
-    0xBA, 0xF7, 0xF7, 0xF7, 0xFA, 0xF7, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xFF, 0x85,
-    0xFF, 0xA7, 0xFF, 0xBD, 0xFF, 0xC2, 0xFF, 0xD2, 0xFF, 0xE7, 0xFF, 0xF5, 0x41, 0x73, 0xF6, 0x3B,
-    0x42, 0x6C, 0x75, 0xF6, 0x37, 0xFF, 0xFC, 0x41, 0x6C, 0xF6, 0x30, 0x41, 0x72, 0xFF, 0x59, 0x41,
-    0x6D, 0xF6, 0x28, 0x44, 0xA1, 0xAD, 0xB3, 0xBA, 0xFF, 0xF4, 0xF6, 0x27, 0xFF, 0xF8, 0xFF, 0xFC,
-    0xC5, 0x01, 0x82, 0x61, 0xC3, 0x69, 0x6F, 0x75, 0xFF, 0xE0, 0xFF, 0xF3, 0xF6, 0x1A, 0xFF, 0xEB,
-    0xFF, 0xEF, 0x45, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFF, 0xA0, 0xFF, 0xA0, 0xFF, 0xA0, 0xFF, 0xA0,
-    0xFF, 0xA0, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xFF, 0xDE, 0xFF, 0x66, 0xFF, 0x66,
-    0xFF, 0x66, 0xFF, 0x66, 0xFF, 0x66, 0xFF, 0xF0, 0x42, 0x6E, 0x78, 0xFF, 0x8E, 0xFF, 0xEA, 0xA0,
-    0x01, 0x82, 0x41, 0x72, 0xF5, 0x3F, 0x41, 0x72, 0xF5, 0x0B, 0x22, 0x61, 0x6F, 0xF8, 0xFC, 0x42,
-    0x6E, 0x70, 0xF4, 0xEA, 0xF4, 0xEA, 0x21, 0x65, 0xF9, 0x41, 0x70, 0xF4, 0xE0, 0x22, 0x61, 0x6F,
-    0xFC, 0xFC, 0x41, 0x61, 0xFA, 0xE0, 0x21, 0x75, 0xFC, 0x41, 0x6D, 0xFF, 0x00, 0x21, 0xA1, 0xFC,
-    0x41, 0x65, 0xF4, 0xBD, 0x22, 0xC3, 0x69, 0xF9, 0xFC, 0x41, 0x69, 0xFB, 0x63, 0x21, 0x6C, 0xFC,
-    0x42, 0x6D, 0x63, 0xF4, 0x9C, 0xF3, 0x1F, 0x22, 0x61, 0x69, 0xF6, 0xF9, 0x41, 0x61, 0xFE, 0xDD,
-    0x21, 0x67, 0xFC, 0x41, 0x6C, 0xF4, 0x89, 0x42, 0x61, 0x69, 0xFB, 0x45, 0xF4, 0xEA, 0x43, 0x63,
-    0x68, 0x6E, 0xF4, 0xEC, 0xFF, 0xD2, 0xF4, 0xFD, 0x21, 0x65, 0xF6, 0x24, 0x61, 0x65, 0x6C, 0x72,
-    0xE5, 0xE8, 0xEC, 0xFD, 0x41, 0x63, 0xF4, 0x85, 0x21, 0x65, 0xFC, 0x41, 0xB3, 0xF4, 0x72, 0x21,
-    0xC3, 0xFC, 0x41, 0x67, 0xF4, 0x5A, 0x21, 0x75, 0xFC, 0x22, 0x6D, 0x72, 0xF6, 0xFD, 0x41, 0x69,
-    0xF4, 0x6E, 0x41, 0x62, 0xF2, 0xCD, 0x21, 0x69, 0xFC, 0x21, 0x76, 0xFD, 0x21, 0x6F, 0xFD, 0xCC,
-    0x09, 0xA3, 0x62, 0x63, 0x64, 0x67, 0x6C, 0x6E, 0x70, 0x66, 0x72, 0x73, 0x74, 0x6D, 0xFF, 0x6B,
-    0xFF, 0x77, 0xFF, 0x7E, 0xFF, 0x87, 0xFF, 0x95, 0xFF, 0xA8, 0xFF, 0xCC, 0xFF, 0xD9, 0xFF, 0xEA,
-    0xFF, 0xEF, 0xFA, 0x67, 0xFF, 0xFD, 0xC1, 0x02, 0x91, 0x69, 0xF4, 0x16, 0x21, 0x63, 0xFA, 0x21,
-    0x69, 0xFD, 0x41, 0x64, 0xF4, 0x78, 0x22, 0x75, 0x65, 0xFC, 0xAC, 0x41, 0x6F, 0xFA, 0x27, 0x42,
-    0x63, 0x61, 0xFF, 0xFC, 0xF8, 0x70, 0x41, 0x76, 0xF2, 0x79, 0x21, 0xAD, 0xFC, 0x42, 0x69, 0xC3,
-    0xF4, 0x24, 0xFF, 0xFD, 0x21, 0x75, 0xF9, 0xC2, 0x02, 0x91, 0x61, 0x68, 0xFF, 0x7D, 0xFA, 0x12,
-    0xC6, 0x09, 0xA3, 0x66, 0x6C, 0x6E, 0x71, 0x78, 0x76, 0xFF, 0xCF, 0xFF, 0xD6, 0xFF, 0xDF, 0xFF,
-    0xF4, 0xFF, 0xF7, 0xFE, 0x17, 0x42, 0x6F, 0x61, 0xF2, 0x4A, 0xF2, 0x4A, 0x21, 0x75, 0xF9, 0x41,
-    0x6C, 0xFF, 0x2D, 0x21, 0x61, 0xFC, 0x21, 0x75, 0xFD, 0xC3, 0x09, 0xA3, 0x63, 0x67, 0x6E, 0xFF,
-    0xF3, 0xFF, 0xFD, 0xF3, 0xB3, 0x41, 0x73, 0xFB, 0x5F, 0x44, 0x74, 0x61, 0xC3, 0x65, 0xF3, 0xA3,
-    0xF2, 0x26, 0xF4, 0x1B, 0xF2, 0x26, 0x43, 0x6F, 0x61, 0x6C, 0xF2, 0x19, 0xF2, 0x19, 0xFF, 0xF3,
-    0x42, 0x63, 0x74, 0xF2, 0x0F, 0xF2, 0x0F, 0x21, 0x6E, 0xF9, 0x22, 0x75, 0x65, 0xEC, 0xFD, 0x41,
-    0x73, 0xF2, 0x00, 0x21, 0x6E, 0xFC, 0x21, 0x65, 0xFD, 0x41, 0x6F, 0xF8, 0x25, 0xA4, 0x09, 0xA3,
-    0x62, 0x63, 0x66, 0x70, 0xC8, 0xED, 0xF9, 0xFC, 0x41, 0x7A, 0xF1, 0xE7, 0x21, 0x69, 0xFC, 0x21,
-    0x6C, 0xFD, 0x21, 0x69, 0xFD, 0xA1, 0x09, 0xA3, 0x74, 0xFD, 0x41, 0x6D, 0xF4, 0x2B, 0x21, 0x69,
-    0xFC, 0xA1, 0x09, 0xD3, 0x6E, 0xFD, 0x41, 0x74, 0xF4, 0x1F, 0x21, 0x69, 0xFC, 0xA1, 0x09, 0xD3,
-    0x64, 0xFD, 0x41, 0x69, 0xF4, 0x16, 0xA1, 0x09, 0xD3, 0x74, 0xFC, 0x45, 0xA1, 0xA9, 0xAD, 0xB3,
-    0xBA, 0xFF, 0xE6, 0xFF, 0xF2, 0xFD, 0xC7, 0xFD, 0xC7, 0xFF, 0xFB, 0xA0, 0x0C, 0x13, 0x21, 0x67,
-    0xFD, 0x22, 0x63, 0x74, 0xFA, 0xFA, 0x21, 0x70, 0xF5, 0x22, 0x70, 0x6D, 0xF8, 0xFD, 0xA2, 0x05,
-    0x22, 0x6F, 0x75, 0xF0, 0xFB, 0xA0, 0x0A, 0x92, 0xA0, 0x0A, 0xB3, 0xA0, 0x0B, 0x13, 0x23, 0xA1,
-    0xA9, 0xB3, 0xFD, 0xFD, 0xFD, 0x24, 0x61, 0x65, 0x6F, 0xC3, 0xF6, 0xF6, 0xF6, 0xF9, 0xA1, 0x0A,
-    0xB3, 0x73, 0xF7, 0xA0, 0x0A, 0xE3, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0x28, 0x72, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xCD, 0xD4, 0xD7, 0xED, 0xD7, 0xD7,
-    0xD7, 0xF5, 0x21, 0x72, 0xEF, 0x21, 0x65, 0xFD, 0x48, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3,
-    0x74, 0xFD, 0xE7, 0xFE, 0x87, 0xFE, 0xE8, 0xFF, 0x11, 0xFF, 0x55, 0xFF, 0x6D, 0xFF, 0x93, 0xFF,
-    0xFD, 0x21, 0x6E, 0xE7, 0x58, 0x62, 0x63, 0x64, 0x66, 0x67, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70,
-    0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x68, 0x61, 0x65, 0x69, 0xF2, 0x79, 0xF3,
-    0xD1, 0xF4, 0x53, 0xF4, 0x5A, 0xF4, 0x5A, 0xF4, 0x5A, 0xF4, 0x5A, 0xF4, 0x5A, 0xF4, 0xC4, 0xF4,
-    0x5A, 0xF7, 0x4E, 0xF4, 0x5A, 0xF9, 0xC2, 0xFB, 0x92, 0xFC, 0x33, 0xF4, 0x5A, 0xF4, 0x5A, 0xF4,
-    0x5A, 0xF4, 0x5A, 0xF4, 0x5A, 0xFC, 0x53, 0xFC, 0xC1, 0xFD, 0xC4, 0xFF, 0xFD, 0x41, 0x63, 0xFC,
-    0x16, 0xA0, 0x0D, 0x22, 0x21, 0x72, 0xFD, 0x21, 0x6F, 0xFD, 0xC3, 0x00, 0x71, 0x2E, 0x69, 0x65,
-    0xF0, 0x3F, 0xFF, 0xF3, 0xFF, 0xFD, 0xC3, 0x00, 0x71, 0x2E, 0x7A, 0x73, 0xF0, 0x33, 0xF0, 0x39,
-    0xF0, 0x39, 0xC1, 0x00, 0x71, 0x2E, 0xF0, 0x27, 0xD6, 0x00, 0x81, 0x2E, 0x62, 0x63, 0x64, 0x66,
-    0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79,
-    0x7A, 0xF0, 0x21, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
-    0x24, 0xF0, 0x24, 0xF3, 0xE6, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF3, 0xE6, 0xF0,
-    0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0x41, 0x74, 0xF0,
-    0x69, 0x21, 0x70, 0xFC, 0xD7, 0x00, 0x91, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B,
-    0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x65, 0xEF, 0xD5,
-    0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01,
-    0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01,
-    0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xFF, 0xFD, 0x42, 0x6F, 0x70, 0xF3,
-    0xA8, 0xFF, 0xB1, 0x41, 0x6E, 0xFB, 0x50, 0xD8, 0x00, 0x91, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67,
-    0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A,
-    0x69, 0x6F, 0xEF, 0x82, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE,
-    0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE,
-    0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xFF, 0xF5,
-    0xFF, 0xFC, 0x41, 0x74, 0xF1, 0xF3, 0x21, 0x70, 0xFC, 0x41, 0x6F, 0xFC, 0x90, 0x21, 0x6C, 0xFC,
-    0x41, 0x74, 0xF0, 0x5B, 0x41, 0x6D, 0xFA, 0xEF, 0x41, 0x61, 0xEF, 0x9F, 0x21, 0x72, 0xFC, 0x21,
-    0x74, 0xFD, 0x25, 0x6D, 0x75, 0x72, 0x73, 0x6E, 0xE4, 0xEB, 0xEE, 0xF2, 0xFD, 0xA0, 0x02, 0x32,
-    0x21, 0x61, 0xFD, 0x41, 0x2E, 0xEF, 0x06, 0xA1, 0x02, 0x32, 0x73, 0xFC, 0x22, 0x6F, 0x61, 0xF1,
-    0xFB, 0x41, 0x64, 0xEF, 0x88, 0x23, 0x63, 0x67, 0x72, 0xEB, 0xF7, 0xFC, 0x21, 0x6F, 0xE1, 0x41,
-    0x75, 0xEF, 0x68, 0x21, 0x72, 0xFC, 0x42, 0x64, 0x73, 0xFF, 0xFD, 0xF2, 0xE9, 0x22, 0x6C, 0x61,
-    0xEF, 0xF9, 0x41, 0x6C, 0xEF, 0x64, 0x21, 0x61, 0xFC, 0xA0, 0x07, 0x51, 0x21, 0x61, 0xFD, 0x21,
-    0x65, 0xFD, 0xA1, 0x04, 0x72, 0x72, 0xFD, 0x45, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFF, 0xFB, 0xEF,
-    0xD7, 0xEF, 0xD7, 0xEF, 0xD7, 0xEF, 0xD7, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xEF,
-    0xC1, 0xEF, 0xC4, 0xEF, 0xC4, 0xEF, 0xC4, 0xEF, 0xC4, 0xEF, 0xC4, 0xFF, 0xF0, 0x21, 0x69, 0xEA,
-    0x21, 0x74, 0xFD, 0x22, 0x66, 0x6E, 0xC3, 0xFD, 0x42, 0x68, 0x6F, 0xF2, 0x5F, 0xEF, 0xB4, 0x21,
-    0x6E, 0xF9, 0xA0, 0x06, 0xF3, 0xA0, 0x07, 0x23, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0x48, 0x72, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xF3, 0x4F, 0xF3, 0x26,
-    0xFF, 0xEF, 0xFF, 0xEF, 0xFF, 0xEF, 0xFF, 0xEF, 0xFF, 0xEF, 0xFF, 0xF5, 0x21, 0x72, 0xE7, 0x21,
-    0x65, 0xFD, 0x41, 0x6C, 0xFA, 0x21, 0x41, 0x6F, 0xF2, 0x6E, 0x24, 0x61, 0x62, 0x63, 0x74, 0xC5,
-    0xF5, 0xF8, 0xFC, 0x41, 0x6F, 0xEF, 0x25, 0x21, 0x63, 0xFC, 0x21, 0x69, 0xFD, 0x21, 0x72, 0xFD,
-    0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0xA9, 0xFD, 0xDC, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64,
-    0x66, 0x67, 0x6A, 0x6B, 0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x68,
-    0x6C, 0x72, 0x6F, 0x61, 0x75, 0x65, 0x69, 0xC3, 0xEE, 0x30, 0xEE, 0x33, 0xEE, 0x39, 0xEE, 0x33,
-    0xEE, 0x42, 0xEE, 0x47, 0xEE, 0x33, 0xEE, 0x33, 0xEE, 0x47, 0xFD, 0xF1, 0xEE, 0x4C, 0xEE, 0x33,
-    0xEE, 0x33, 0xFD, 0xFD, 0xEE, 0x33, 0xEE, 0x33, 0xEE, 0x33, 0xEE, 0x33, 0xFE, 0x09, 0xFE, 0x0F,
-    0xFE, 0x5B, 0xFE, 0xAE, 0xFF, 0x19, 0xFF, 0x3C, 0xFF, 0x54, 0xFF, 0x9A, 0xFF, 0xE1, 0xFF, 0xFD,
-    0x41, 0x74, 0xF2, 0xB2, 0x21, 0x6E, 0xFC, 0x21, 0x65, 0xFD, 0x21, 0x69, 0xFD, 0xA1, 0x04, 0xA2,
-    0x6D, 0xFD, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xF1, 0x95, 0xF1, 0xD1, 0xF1, 0xD1,
-    0xFF, 0xFB, 0xF1, 0xD1, 0xF1, 0xD1, 0xF1, 0xD7, 0x21, 0x61, 0xEA, 0xA0, 0x07, 0xC1, 0xA0, 0x07,
-    0xD2, 0xA0, 0x07, 0xF2, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x27,
-    0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xEC, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF5, 0x21, 0x6F,
-    0xF1, 0x21, 0x74, 0xFD, 0x42, 0x61, 0x6F, 0xFF, 0xFD, 0xEE, 0xA8, 0x21, 0x6D, 0xF9, 0xA0, 0x05,
-    0x92, 0x21, 0x65, 0xFD, 0x21, 0x64, 0xFD, 0xA0, 0x09, 0x32, 0x21, 0x61, 0xFD, 0x22, 0x72, 0x6C,
-    0xF7, 0xFD, 0xA0, 0x02, 0x12, 0x21, 0x69, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x75, 0xFD, 0x41, 0x61,
-    0xEF, 0x4A, 0x22, 0x68, 0x6C, 0xF9, 0xFC, 0x22, 0x61, 0x65, 0xE0, 0xE0, 0x21, 0x68, 0xFB, 0x21,
-    0x74, 0xE3, 0x22, 0x63, 0x72, 0xFA, 0xFD, 0x23, 0xB3, 0xA1, 0xA9, 0xD6, 0xEB, 0xFB, 0x21, 0x6A,
-    0xC0, 0x21, 0x6C, 0xBD, 0x21, 0x74, 0xBA, 0x21, 0x6E, 0xFD, 0x22, 0x6C, 0x65, 0xF7, 0xFD, 0xA0,
-    0x02, 0x11, 0x21, 0x6A, 0xFD, 0x21, 0x69, 0xFD, 0x41, 0x69, 0xFF, 0xA6, 0x21, 0x6E, 0xFC, 0x21,
-    0x61, 0xFD, 0x41, 0x6D, 0xFF, 0x9C, 0x21, 0x61, 0xFC, 0x46, 0x64, 0x65, 0x69, 0x74, 0x67, 0x6E,
-    0xFF, 0x98, 0xFF, 0xD5, 0xFF, 0xE1, 0xFF, 0xEC, 0xFF, 0xF6, 0xFF, 0xFD, 0x42, 0x63, 0x7A, 0xFF,
-    0x82, 0xFF, 0x82, 0x41, 0x6E, 0xFF, 0x7B, 0x21, 0x65, 0xFC, 0x22, 0x65, 0x69, 0xF2, 0xFD, 0x21,
-    0x64, 0xFB, 0x41, 0x67, 0xFF, 0x6C, 0x21, 0x69, 0xFC, 0x41, 0x72, 0xFF, 0x65, 0x21, 0x74, 0xFC,
-    0x23, 0x65, 0x6C, 0x73, 0xEF, 0xF6, 0xFD, 0xA0, 0x09, 0x12, 0x21, 0x73, 0xFD, 0x41, 0x70, 0xFF,
-    0x51, 0x21, 0xBA, 0xFC, 0x23, 0x61, 0x75, 0xC3, 0xF6, 0xF9, 0xFD, 0x21, 0x6F, 0xDE, 0xC2, 0x09,
-    0x12, 0x63, 0x64, 0xFF, 0x91, 0xFF, 0x91, 0x23, 0xA1, 0xA9, 0xB3, 0xE0, 0xE0, 0xE0, 0x45, 0x61,
-    0xC3, 0x65, 0x6F, 0x6C, 0xFF, 0xF0, 0xFF, 0xF9, 0xFF, 0xD9, 0xFF, 0xD9, 0xFF, 0x81, 0x41, 0x69,
-    0xFF, 0x84, 0x21, 0x72, 0xFC, 0x41, 0x65, 0xFF, 0x6A, 0x21, 0x63, 0xFC, 0x42, 0xA1, 0xA9, 0xFF,
-    0x12, 0xFF, 0x12, 0x43, 0x61, 0xC3, 0x69, 0xFF, 0x0B, 0xFF, 0xF9, 0xFF, 0x0B, 0x41, 0xA9, 0xFF,
-    0x01, 0x42, 0x65, 0xC3, 0xFE, 0xFD, 0xFF, 0xFC, 0x41, 0x67, 0xFF, 0x0A, 0x21, 0x65, 0xFC, 0x4B,
-    0x72, 0x62, 0x63, 0x64, 0x6C, 0x70, 0x6E, 0x76, 0x78, 0x79, 0x73, 0xFF, 0x5A, 0xFF, 0x91, 0xFF,
-    0xA5, 0xFF, 0xAC, 0xFF, 0xBF, 0xFF, 0xD3, 0xFF, 0xDA, 0xFF, 0xE4, 0xFF, 0x49, 0xFF, 0xF2, 0xFF,
-    0xFD, 0xA0, 0x08, 0xC3, 0x21, 0x64, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x72, 0xF7, 0x22, 0x72, 0x6F,
-    0xFA, 0xFD, 0x22, 0x7A, 0x63, 0xEF, 0xEF, 0x21, 0x69, 0xFB, 0x21, 0x6C, 0xFD, 0x21, 0x61, 0xFD,
-    0x21, 0x72, 0xFD, 0x23, 0xA1, 0xA9, 0xB3, 0xDE, 0xDE, 0xDE, 0x22, 0x61, 0xC3, 0xD7, 0xF9, 0x23,
-    0x61, 0x65, 0x6F, 0xD2, 0xD2, 0xD2, 0x21, 0xAD, 0xF9, 0x22, 0x69, 0xC3, 0xF1, 0xFD, 0xA0, 0x08,
-    0xF2, 0x21, 0x73, 0xC0, 0x22, 0x61, 0x69, 0xFA, 0xFD, 0x21, 0x75, 0xFB, 0x21, 0xAD, 0xC6, 0x22,
-    0x69, 0xC3, 0xC3, 0xFD, 0x42, 0x76, 0x6E, 0xFF, 0xAD, 0xFF, 0xFB, 0x42, 0x61, 0x69, 0xED, 0xDD,
-    0xFF, 0xF9, 0x41, 0x6C, 0xFE, 0x80, 0x42, 0x72, 0x65, 0xFE, 0x7C, 0xFF, 0xFC, 0x21, 0x67, 0xF9,
-    0x41, 0x76, 0xFF, 0x91, 0x21, 0x69, 0xFC, 0x21, 0x73, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD,
-    0x21, 0x72, 0xFD, 0x41, 0x6C, 0xFF, 0x7E, 0x21, 0x6C, 0xFC, 0x21, 0x6F, 0xFD, 0x21, 0x72, 0xFD,
-    0x41, 0x72, 0xFE, 0x52, 0x43, 0x61, 0x65, 0x74, 0xF1, 0xB9, 0xF1, 0xB9, 0xFF, 0xFC, 0x41, 0x73,
-    0xFF, 0xA0, 0x21, 0x65, 0xFC, 0x41, 0x6E, 0xFF, 0x5C, 0x21, 0x75, 0xFC, 0x21, 0xB3, 0xF9, 0x22,
-    0xC3, 0x6F, 0xFD, 0xF6, 0x4D, 0x62, 0x63, 0x66, 0x67, 0x68, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74,
-    0x79, 0x7A, 0xFF, 0x59, 0xFF, 0x6C, 0xFF, 0x85, 0xFF, 0x95, 0xFE, 0x37, 0xFF, 0xA7, 0xFF, 0xB9,
-    0xFF, 0xCC, 0xFF, 0xD9, 0xFF, 0xE0, 0xFF, 0xEE, 0xFF, 0xF5, 0xFF, 0xFB, 0x44, 0x61, 0xC3, 0x65,
-    0x6F, 0xFF, 0x25, 0xFF, 0x47, 0xFF, 0x25, 0xFF, 0x25, 0x21, 0x6A, 0xF3, 0x41, 0x6A, 0xFF, 0x43,
-    0x21, 0xA9, 0xFC, 0x41, 0xB1, 0xFD, 0xEF, 0x21, 0xC3, 0xFC, 0x21, 0xA9, 0xFD, 0x22, 0x65, 0xC3,
-    0xFA, 0xFD, 0x23, 0x65, 0xC3, 0x70, 0xE7, 0xEE, 0xFB, 0x41, 0x6E, 0xFD, 0xD9, 0x21, 0xA9, 0xFC,
-    0x22, 0x65, 0xC3, 0xF9, 0xFD, 0x21, 0x72, 0xFB, 0x21, 0x66, 0xFD, 0xC6, 0x02, 0x11, 0x6E, 0x72,
-    0x62, 0x64, 0x6D, 0x73, 0xFE, 0x04, 0xFE, 0x04, 0xFE, 0x04, 0xFE, 0x04, 0xFE, 0x04, 0xFE, 0x04,
-    0x46, 0x6E, 0x72, 0x62, 0x64, 0x6D, 0x73, 0xFD, 0xEF, 0xFD, 0xEF, 0xFD, 0xEF, 0xFD, 0xEF, 0xFD,
-    0xEF, 0xFD, 0xEF, 0x21, 0xA1, 0xED, 0xC6, 0x09, 0x12, 0x6E, 0x72, 0x62, 0x64, 0x6D, 0x73, 0xFE,
-    0x31, 0xFE, 0x31, 0xFE, 0x31, 0xFE, 0x31, 0xFE, 0x31, 0xFE, 0x31, 0x42, 0xA1, 0xB3, 0xFF, 0xEB,
-    0xFE, 0x1C, 0x44, 0x61, 0xC3, 0x65, 0x6F, 0xFE, 0x15, 0xFE, 0x35, 0xFE, 0x15, 0xFE, 0x15, 0x44,
-    0x6F, 0x61, 0xC3, 0x68, 0xFE, 0x08, 0xFF, 0xD7, 0xFF, 0xEC, 0xFF, 0xF3, 0x41, 0xA9, 0xFE, 0x85,
-    0x42, 0x65, 0xC3, 0xFE, 0x81, 0xFF, 0xFC, 0xA1, 0x05, 0x92, 0x75, 0xF9, 0x41, 0x66, 0xFD, 0x42,
-    0x42, 0x63, 0x71, 0xFD, 0x3E, 0xFD, 0x3E, 0x22, 0x69, 0x75, 0xF5, 0xF9, 0x41, 0x62, 0xFD, 0xCD,
-    0x21, 0x6D, 0xFC, 0x21, 0x6F, 0xFD, 0x41, 0x7A, 0xFD, 0x28, 0x42, 0x63, 0x6E, 0xFD, 0x75, 0xFF,
-    0xFC, 0x21, 0x61, 0xF9, 0x21, 0x72, 0xFD, 0x44, 0x61, 0x65, 0x69, 0x75, 0xFD, 0x17, 0xFF, 0xFD,
-    0xFD, 0x9C, 0xFD, 0x7B, 0x41, 0x69, 0xFD, 0x4D, 0x41, 0x69, 0xFD, 0x8B, 0x43, 0x62, 0x63, 0x6C,
-    0xFF, 0xF8, 0xFD, 0x5C, 0xFF, 0xFC, 0x41, 0x73, 0xFC, 0xF8, 0x41, 0x63, 0xFC, 0xF4, 0x22, 0x65,
-    0x75, 0xF8, 0xFC, 0x43, 0x61, 0x69, 0x72, 0xFF, 0xE9, 0xFD, 0x4F, 0xFF, 0xFB, 0x23, 0x63, 0x70,
-    0x74, 0xB6, 0xCA, 0xF6, 0x42, 0x63, 0x74, 0xFC, 0xF1, 0xFC, 0xEE, 0x4A, 0x6D, 0x6E, 0x6F, 0x61,
-    0xC3, 0x63, 0x71, 0x64, 0x73, 0x72, 0xFF, 0x07, 0xFF, 0x1D, 0xFD, 0x24, 0xFF, 0x20, 0xFF, 0x48,
-    0xFF, 0x74, 0xFF, 0x8C, 0xFF, 0x9C, 0xFF, 0xF2, 0xFF, 0xF9, 0x42, 0x72, 0x6F, 0xFD, 0x05, 0xFC,
-    0xF7, 0x42, 0x61, 0x6F, 0xFC, 0xFE, 0xFC, 0xFE, 0x22, 0x65, 0x69, 0xF2, 0xF9, 0x41, 0x74, 0xFC,
-    0xF2, 0x21, 0x72, 0xFC, 0x41, 0xA1, 0xFC, 0xDD, 0x42, 0x61, 0xC3, 0xFC, 0xD9, 0xFF, 0xFC, 0x42,
-    0x6E, 0x75, 0xFC, 0xE0, 0xFF, 0xF9, 0x41, 0xB3, 0xFD, 0x0D, 0x42, 0x6F, 0xC3, 0xFD, 0x09, 0xFF,
-    0xFC, 0x21, 0x69, 0xF9, 0x21, 0x73, 0xFD, 0x21, 0x75, 0xFD, 0x42, 0x67, 0x6E, 0xFF, 0x6E, 0xFC,
-    0x74, 0x41, 0x65, 0xFF, 0x75, 0x42, 0x6F, 0x72, 0xFC, 0xEE, 0xFF, 0xFC, 0x22, 0x61, 0x70, 0xEE,
-    0xF9, 0x41, 0x72, 0xFD, 0x0C, 0x41, 0x73, 0xFC, 0x9F, 0x21, 0x75, 0xFC, 0x44, 0x65, 0x6C, 0x6F,
-    0x72, 0xFC, 0x9B, 0xFF, 0x4C, 0xFF, 0xF5, 0xFF, 0xFD, 0x42, 0x63, 0x74, 0xFC, 0xEE, 0xFC, 0xEE,
-    0x21, 0x6E, 0xF9, 0x41, 0x63, 0xFC, 0x8C, 0x41, 0x72, 0xFC, 0x7D, 0xC1, 0x05, 0x92, 0x61, 0xFC,
-    0x97, 0x41, 0x72, 0xFC, 0x91, 0x24, 0x65, 0x61, 0x6C, 0x6F, 0xEE, 0xF2, 0xF6, 0xFC, 0x41, 0x62,
-    0xFC, 0x20, 0x21, 0x69, 0xFC, 0x41, 0x63, 0xFC, 0x5F, 0x41, 0x61, 0xFC, 0x58, 0x22, 0x65, 0x74,
-    0xF8, 0xFC, 0x42, 0x67, 0x72, 0xFD, 0xCE, 0xFC, 0x20, 0x41, 0x78, 0xFC, 0x05, 0x23, 0x65, 0x6F,
-    0x75, 0xF5, 0xFC, 0xE1, 0x41, 0x65, 0xFC, 0x95, 0x47, 0x63, 0x65, 0x66, 0x68, 0x73, 0x74, 0x76,
-    0xFF, 0xA4, 0xFF, 0xB8, 0xFF, 0xCD, 0xFF, 0xDA, 0xFF, 0xE5, 0xFF, 0xF5, 0xFF, 0xFC, 0x41, 0x6E,
-    0xFC, 0x31, 0x21, 0x65, 0xFC, 0x21, 0x74, 0xFD, 0x47, 0x64, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x73,
-    0xFF, 0x30, 0xFF, 0x39, 0xFF, 0x47, 0xFF, 0x5F, 0xFF, 0x74, 0xFF, 0xE0, 0xFF, 0xFD, 0x43, 0x72,
-    0x73, 0x6E, 0xFC, 0x69, 0xFC, 0x69, 0xFC, 0x69, 0x21, 0x61, 0xF6, 0x41, 0x6C, 0xFC, 0x04, 0x21,
-    0x6C, 0xFC, 0x41, 0x61, 0xFD, 0xE7, 0x21, 0x74, 0xFC, 0xA0, 0x09, 0x53, 0x22, 0x63, 0x71, 0xFD,
-    0xFD, 0x22, 0x73, 0x69, 0xF5, 0xFB, 0xC1, 0x05, 0x92, 0x61, 0xFB, 0x98, 0x43, 0x6E, 0x72, 0x73,
-    0xFB, 0x92, 0xFF, 0xFA, 0xFB, 0x92, 0x43, 0x6E, 0x72, 0x73, 0xFB, 0x88, 0xFB, 0x88, 0xFB, 0x88,
-    0x42, 0xA9, 0xB3, 0xFF, 0xF6, 0xFB, 0x7E, 0x45, 0x72, 0x64, 0x65, 0xC3, 0x6D, 0xFB, 0x77, 0xFB,
-    0x77, 0xFF, 0xE5, 0xFF, 0xF9, 0xFB, 0x77, 0x42, 0x6E, 0x73, 0xFB, 0x67, 0xFB, 0x67, 0x42, 0xA1,
-    0xAD, 0xFB, 0x60, 0xFF, 0xC8, 0x45, 0x69, 0x61, 0x65, 0x6F, 0xC3, 0xFF, 0xE2, 0xFF, 0xF2, 0xFB,
-    0x59, 0xFB, 0x59, 0xFF, 0xF9, 0x41, 0xA1, 0xFB, 0x49, 0x42, 0x61, 0xC3, 0xFB, 0x45, 0xFF, 0xFC,
-    0x21, 0xB1, 0xF9, 0x41, 0x62, 0xFB, 0x9C, 0x47, 0x64, 0x65, 0x62, 0x73, 0x6E, 0xC3, 0x72, 0xFF,
-    0x81, 0xFF, 0x88, 0xFF, 0x9A, 0xFF, 0x8F, 0xFF, 0xDE, 0xFF, 0xF9, 0xFF, 0xFC, 0x46, 0xC3, 0x6F,
-    0x61, 0x65, 0x69, 0x75, 0xFB, 0x5A, 0xFC, 0x32, 0xFD, 0x07, 0xFE, 0x4E, 0xFF, 0x4B, 0xFF, 0xEA,
-    0x41, 0x69, 0xFB, 0x5F, 0x21, 0x74, 0xFC, 0x21, 0x73, 0xFD, 0x45, 0x63, 0x6E, 0x72, 0x73, 0x69,
-    0xFA, 0xCE, 0xF4, 0xA7, 0xFB, 0x01, 0xFF, 0xE3, 0xFF, 0xFD, 0xA0, 0x11, 0x72, 0x21, 0x63, 0xFD,
-    0x21, 0xA9, 0xFD, 0x22, 0x65, 0xC3, 0xFA, 0xFD, 0x21, 0x6C, 0xFB, 0x21, 0x65, 0xFD, 0xD8, 0x00,
-    0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x73,
-    0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x72, 0x65, 0x69, 0xE8, 0x5B, 0xE8, 0x5E, 0xE8, 0x64, 0xE8,
-    0x5E, 0xE8, 0x6D, 0xE8, 0x72, 0xE8, 0x5E, 0xE8, 0x5E, 0xE8, 0x5E, 0xE8, 0x5E, 0xE8, 0x72, 0xE8,
-    0x5E, 0xE8, 0x77, 0xE8, 0x5E, 0xE8, 0x5E, 0xE8, 0x80, 0xE8, 0x5E, 0xE8, 0x5E, 0xE8, 0x5E, 0xE8,
-    0x5E, 0xE8, 0x5E, 0xE8, 0x8A, 0xFF, 0xDC, 0xFF, 0xFD, 0x42, 0x6D, 0x72, 0xF4, 0x38, 0xF3, 0xDE,
-    0x41, 0x69, 0xF3, 0xD3, 0x43, 0x6C, 0x73, 0x74, 0xF9, 0xB2, 0xFF, 0xFC, 0xF9, 0xB2, 0x42, 0x6E,
-    0x74, 0xF9, 0xA8, 0xF9, 0xA8, 0x41, 0x69, 0xEB, 0x9B, 0x21, 0x72, 0xFC, 0x21, 0x61, 0xFD, 0x21,
-    0x69, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x6D, 0xFD, 0xDA, 0x00, 0x41, 0x2E, 0x62,
-    0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77, 0x78,
-    0x79, 0x7A, 0x6C, 0x72, 0x65, 0x69, 0x6F, 0x61, 0xE7, 0xDE, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1,
-    0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1,
-    0xE7, 0xE1, 0xE7, 0xE1, 0xF7, 0xB7, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1,
-    0xE8, 0x0D, 0xE8, 0x0D, 0xFF, 0xCE, 0xFF, 0xD9, 0xFF, 0xE3, 0xFF, 0xFD, 0xD7, 0x00, 0x91, 0x2E,
-    0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74,
-    0x76, 0x77, 0x78, 0x79, 0x7A, 0x75, 0xE7, 0x8D, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9,
-    0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9,
-    0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9,
-    0xE7, 0xB9, 0xF7, 0x41, 0xA0, 0x08, 0xB1, 0x21, 0x2E, 0xFD, 0x49, 0x68, 0x61, 0x65, 0x69, 0x6F,
-    0x75, 0xC3, 0x2E, 0x73, 0xE8, 0x4E, 0xE8, 0x51, 0xE8, 0x51, 0xE8, 0x51, 0xE8, 0x51, 0xE8, 0x51,
-    0xE8, 0x57, 0xFF, 0xFA, 0xFF, 0xFD, 0x22, 0x2E, 0x73, 0xDE, 0xE1, 0x21, 0x61, 0xFB, 0x21, 0xAD,
-    0xFD, 0x23, 0x6F, 0x61, 0xC3, 0xD9, 0xF5, 0xFD, 0x21, 0x66, 0xF9, 0xD7, 0x00, 0x91, 0x2E, 0x62,
-    0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76,
-    0x77, 0x78, 0x79, 0x7A, 0x61, 0xE7, 0x0E, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7,
-    0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7,
-    0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7,
-    0x3A, 0xFF, 0xFD, 0x41, 0x73, 0xFF, 0x84, 0x42, 0x2E, 0x65, 0xFF, 0x7D, 0xFF, 0xFC, 0x21, 0x6C,
-    0xF9, 0x42, 0x6F, 0x61, 0xFF, 0x95, 0xFF, 0xFD, 0x21, 0x6E, 0xF9, 0x41, 0x72, 0xF9, 0x23, 0x42,
-    0x65, 0x72, 0xFF, 0xFC, 0xE7, 0x37, 0x21, 0x74, 0xF9, 0x42, 0x6C, 0x73, 0xF8, 0x4D, 0xFF, 0xFD,
-    0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xE7, 0x64, 0xE7, 0x67, 0xE7, 0x67, 0xE7, 0x67,
-    0xE7, 0x67, 0xE7, 0x67, 0xE7, 0x6D, 0x41, 0x6E, 0xF8, 0xFB, 0x21, 0x6F, 0xFC, 0x22, 0x6F, 0x72,
-    0xE3, 0xFD, 0x41, 0x63, 0xE7, 0x04, 0x21, 0x65, 0xFC, 0x41, 0x61, 0xEA, 0x8B, 0x22, 0x6E, 0x67,
-    0xF9, 0xFC, 0x41, 0x64, 0xF7, 0x46, 0x21, 0x72, 0xFC, 0x21, 0x61, 0xFD, 0xDB, 0x00, 0x41, 0x2E,
-    0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77,
-    0x78, 0x79, 0x7A, 0x6C, 0x72, 0x6F, 0x61, 0x65, 0x69, 0x75, 0xE6, 0x5D, 0xE6, 0x60, 0xE6, 0x60,
-    0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xF6, 0x36,
-    0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60,
-    0xE6, 0x60, 0xFE, 0xD0, 0xFF, 0x4F, 0xFF, 0xAC, 0xFF, 0xBD, 0xFF, 0xE1, 0xFF, 0xF1, 0xFF, 0xFD,
-    0x41, 0x2E, 0xE6, 0x0C, 0x42, 0x2E, 0x73, 0xE6, 0x08, 0xFF, 0xFC, 0x22, 0x6F, 0x61, 0xF9, 0xF9,
-    0x21, 0x6C, 0xFB, 0x42, 0x6F, 0x61, 0xE6, 0xD5, 0xE6, 0xD5, 0x21, 0x6E, 0xF9, 0x21, 0x61, 0xFD,
-    0x22, 0x65, 0x6D, 0xF0, 0xFD, 0x41, 0x65, 0xFE, 0x9F, 0x21, 0x74, 0xFC, 0x21, 0x6E, 0xFD, 0x21,
-    0x61, 0xFD, 0x21, 0x65, 0xFA, 0x22, 0x6C, 0x69, 0xFA, 0xFD, 0x42, 0x6C, 0x62, 0xF7, 0x7C, 0xFF,
-    0xFB, 0x42, 0x63, 0x6F, 0xE6, 0x55, 0xE6, 0xEB, 0x21, 0x69, 0xF9, 0x41, 0x2E, 0xE8, 0xAA, 0x42,
-    0x2E, 0x73, 0xE8, 0xA6, 0xFF, 0xFC, 0x21, 0x61, 0xF9, 0xA1, 0x04, 0xA2, 0x6C, 0xFD, 0x47, 0x68,
-    0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xE9, 0x79, 0xE9, 0xB5, 0xE9, 0xB5, 0xE9, 0xB5, 0xFF, 0xFB,
-    0xE9, 0xB5, 0xE9, 0xBB, 0x43, 0x61, 0x69, 0x6F, 0xF5, 0xB9, 0xFF, 0xEA, 0xE9, 0xB0, 0x42, 0x61,
-    0x74, 0xF5, 0xAF, 0xE6, 0xBD, 0x41, 0x72, 0xE6, 0x11, 0x21, 0x65, 0xFC, 0x46, 0x63, 0x6C, 0x6D,
-    0x70, 0x74, 0x78, 0xF1, 0xA5, 0xFF, 0xBC, 0xFF, 0xE8, 0xFF, 0xF2, 0xFF, 0xFD, 0xFF, 0x0D, 0xA0,
-    0x0A, 0x13, 0x21, 0x65, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0xAD, 0xFD, 0x21, 0xC3, 0xFD, 0xA1, 0x06,
-    0xF3, 0x63, 0xFD, 0x21, 0x69, 0xEC, 0x21, 0x6D, 0xFD, 0x21, 0xAD, 0xFD, 0x22, 0x69, 0xC3, 0xFA,
-    0xFD, 0x21, 0x61, 0xDE, 0x21, 0x69, 0xFD, 0xA2, 0x06, 0xF3, 0x6E, 0x78, 0xF5, 0xFD, 0xA0, 0x0A,
-    0x43, 0x21, 0x6F, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0x69, 0xFD, 0xA1, 0x07, 0x23, 0x6E, 0xFD, 0x45,
-    0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xF6, 0xA6, 0xF6, 0xA6, 0xF6, 0xA6, 0xFF, 0xFB, 0xF6, 0xA6, 0x48,
-    0x72, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xE9, 0xF3, 0xE9, 0xCA, 0xF6, 0x93, 0xF6, 0x93,
-    0xFF, 0xBF, 0xFF, 0xD8, 0xF6, 0x93, 0xFF, 0xF0, 0x21, 0x72, 0xE7, 0x42, 0x65, 0x6F, 0xFF, 0xFD,
-    0xE9, 0x19, 0x43, 0x64, 0x70, 0x73, 0xF0, 0xC5, 0xFF, 0xF9, 0xF1, 0x1F, 0x42, 0x6F, 0x65, 0xE9,
-    0x08, 0xF0, 0xB7, 0x42, 0x6C, 0x6D, 0xF6, 0x93, 0xFF, 0xF9, 0x5B, 0x2E, 0x62, 0x63, 0x64, 0x66,
-    0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79,
-    0x7A, 0x75, 0x61, 0x65, 0x69, 0x6F, 0xE4, 0xDF, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2,
-    0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2,
-    0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2,
-    0xE4, 0xE2, 0xFE, 0xF6, 0xFF, 0x10, 0xFF, 0x62, 0xFF, 0xE8, 0xFF, 0xF9, 0xD6, 0x00, 0x41, 0x2E,
-    0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74,
-    0x76, 0x77, 0x78, 0x79, 0x7A, 0xE4, 0x8D, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4,
-    0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4,
-    0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4,
-    0x90, 0x41, 0x6C, 0xF5, 0xF5, 0xD7, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A,
-    0x6B, 0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x6C, 0x72, 0x69, 0xE4,
-    0x44, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4,
-    0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4,
-    0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x73, 0xE4, 0x73, 0xFF, 0xFC, 0xD6, 0x00, 0x81,
+    0x7A, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x00, 0xB1, 0x6E, 0x73, 0x74, 0x12, 0x12, 0x12,
+    0x82, 0x00, 0xB1, 0x73, 0x7A, 0x12, 0x12, 0x01, 0x61, 0x2A, 0x01, 0x63, 0x32, 0x01, 0x73, 0x7D,
+    0x98, 0x06, 0x71, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x04, 0x00, 0x1E, 0x00, 0x1F,
+    0x10, 0x00, 0xBF, 0xAA, 0x00, 0x00, 0x27, 0x10, 0x00, 0x26, 0x00, 0x27, 0x00, 0x37, 0x7D, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x0A, 0xC2, 0x01, 0x61, 0x7D, 0x81, 0x0A, 0xC2, 0x73, 0x1C, 0x02,
+    0x61, 0x6F, 0x7B, 0x75, 0x01, 0x64, 0xBE, 0xEB, 0x03, 0x63, 0x67, 0x72, 0x6F, 0x77, 0x7C, 0x01,
+    0x6C, 0x2F, 0x01, 0x61, 0x7D, 0x80, 0x0C, 0x21, 0x01, 0x61, 0x7D, 0x01, 0x65, 0x7D, 0x81, 0x00,
+    0x42, 0x72, 0x7D, 0x05, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x7B, 0x2C, 0x2C, 0x2C, 0x2C, 0x07, 0x61,
+    0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x0A, 0x0A, 0x2B, 0x0A, 0x0A, 0x0A, 0x75, 0x01, 0x69, 0x71,
+    0x01, 0x74, 0x7D, 0x02, 0x66, 0x6E, 0xBF, 0xCF, 0x7D, 0x96, 0x00, 0x11, 0x2E, 0x62, 0x63, 0x64,
+    0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78,
+    0x79, 0x7A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x68, 0x6F, 0x11, 0x2A, 0x01, 0x6E, 0x7B,
+    0x80, 0x08, 0x93, 0x80, 0x08, 0x03, 0x05, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x08, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x75, 0xC3, 0x21, 0x21, 0x28, 0x21, 0x21, 0x30,
+    0x21, 0x75, 0x01, 0x72, 0x6F, 0x01, 0x65, 0x7D, 0x04, 0x61, 0x62, 0x63, 0x74, 0xBF, 0xD5, 0x7D,
+    0xBC, 0xF2, 0x08, 0x01, 0x74, 0x2F, 0x01, 0x70, 0x7D, 0x97, 0x00, 0x71, 0x2E, 0x62, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77,
+    0x78, 0x79, 0x7A, 0x04, 0x01, 0x01, 0x01, 0x7D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x0A, 0xE2, 0x01, 0x72, 0x7D,
+    0x01, 0x6F, 0x7D, 0x83, 0x00, 0xB1, 0x2E, 0x65, 0x69, 0x04, 0x7D, 0xBC, 0xB8, 0x01, 0x74, 0xB0,
+    0x89, 0x01, 0x70, 0x7C, 0x01, 0x61, 0xBD, 0x6B, 0x01, 0x72, 0x7C, 0x01, 0x74, 0x7D, 0x01, 0x74,
+    0x32, 0x01, 0x6D, 0x0C, 0x01, 0x6F, 0xB2, 0x9A, 0x01, 0x6C, 0x7C, 0x05, 0x6D, 0x6E, 0x72, 0x73,
+    0x75, 0x66, 0x70, 0x73, 0x76, 0x7D, 0x02, 0x6F, 0x70, 0x16, 0xBF, 0x8D, 0x98, 0x00, 0x71, 0x2E,
+    0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x7A, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0xBB, 0xCD, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x83, 0x00, 0xB1, 0x2E, 0x73, 0x7A, 0x04, 0x12, 0x12, 0x01, 0x75, 0xBD, 0x06, 0x01, 0x72, 0x7C,
+    0x02, 0x64, 0x73, 0x7D, 0xB4, 0x6B, 0x01, 0x6F, 0xBE, 0x7E, 0x02, 0x61, 0x6C, 0x76, 0x7C, 0x81,
+    0x00, 0xB1, 0x2E, 0x04, 0x01, 0x6F, 0x2E, 0x01, 0x63, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x72, 0x7D,
+    0x01, 0x74, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0xA9, 0x7D, 0x9C, 0x06, 0x71, 0x2E, 0x61, 0x62, 0x63,
+    0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73,
+    0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xC3, 0x04, 0xBE, 0x6F, 0x00, 0x1E, 0x00, 0xBE, 0xAA,
+    0x1F, 0x10, 0xBE, 0xB0, 0xBF, 0x0F, 0x00, 0x00, 0xBF, 0x20, 0x10, 0xBF, 0x5A, 0xBF, 0x82, 0x26,
+    0x00, 0xBF, 0x93, 0x00, 0xBF, 0xC7, 0x61, 0x00, 0x00, 0x00, 0x00, 0x66, 0x7D, 0x01, 0x74, 0x30,
+    0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x69, 0x7D, 0x81, 0x03, 0x52, 0x6D, 0x7D, 0x07, 0x61,
+    0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x07, 0x07, 0x11, 0x7B, 0x07, 0x07, 0xB3, 0xF6, 0x01, 0x61,
+    0x70, 0x80, 0x01, 0x21, 0x01, 0x69, 0x09, 0x01, 0x74, 0x7D, 0x01, 0x73, 0x7D, 0x80, 0x04, 0xB2,
+    0x80, 0x04, 0x91, 0x80, 0x04, 0x92, 0x05, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x7D, 0x7D, 0x7D, 0x7D,
+    0x7D, 0x07, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x6C, 0x6C, 0x6F, 0x6C, 0x6C, 0x6C, 0x75,
+    0x01, 0x6F, 0x71, 0x01, 0x74, 0x7D, 0x02, 0x61, 0x6F, 0x7D, 0x2A, 0x01, 0x6D, 0x7B, 0x80, 0x0A,
+    0x93, 0x01, 0x72, 0x0E, 0x01, 0x64, 0x0E, 0x01, 0x69, 0x7D, 0x02, 0x6F, 0x72, 0x77, 0x7D, 0x02,
+    0x63, 0x7A, 0x0E, 0x0E, 0x01, 0x69, 0x7B, 0x01, 0x6C, 0x7D, 0x01, 0x61, 0x7D, 0x01, 0x72, 0x7D,
+    0x03, 0xA1, 0xA9, 0xB3, 0x0E, 0x0E, 0x0E, 0x02, 0x61, 0xC3, 0x0E, 0x79, 0x03, 0x61, 0x65, 0x6F,
+    0x0E, 0x0E, 0x0E, 0x01, 0xAD, 0x79, 0x02, 0x69, 0xC3, 0x71, 0x7D, 0x80, 0x0C, 0x02, 0x01, 0x73,
+    0x0E, 0x02, 0x61, 0x69, 0x7A, 0x7D, 0x01, 0x75, 0x7B, 0x80, 0x01, 0x32, 0x01, 0x69, 0x20, 0x01,
+    0x63, 0x7D, 0x01, 0x75, 0x7D, 0x01, 0xAD, 0xBF, 0xBA, 0x02, 0x69, 0xC3, 0xBF, 0xB6, 0x7C, 0x02,
+    0x6E, 0x76, 0x7A, 0x0E, 0x02, 0x61, 0x69, 0x1B, 0x7B, 0x01, 0x6C, 0x20, 0x02, 0x65, 0x72, 0x7D,
+    0x20, 0x01, 0x67, 0x7B, 0x01, 0x76, 0x0E, 0x01, 0x69, 0x7D, 0x01, 0x73, 0x7D, 0x01, 0x6E, 0x7D,
+    0x01, 0x65, 0x7D, 0x01, 0x72, 0x7D, 0x01, 0x6C, 0x0E, 0x01, 0x6C, 0x7D, 0x01, 0x6F, 0x7D, 0x01,
+    0x72, 0x7D, 0x01, 0x72, 0x20, 0x03, 0x61, 0x65, 0x74, 0x15, 0x15, 0x7D, 0x01, 0x73, 0xBF, 0x9F,
+    0x01, 0x65, 0x7C, 0x01, 0x6E, 0x0E, 0x01, 0x75, 0x7D, 0x01, 0xB3, 0x7A, 0x02, 0x6F, 0xC3, 0x77,
+    0x7D, 0x0D, 0x62, 0x63, 0x66, 0x67, 0x68, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x79, 0x7A, 0xBF,
+    0x59, 0xBF, 0x6C, 0xBF, 0x85, 0xBF, 0x95, 0xBF, 0xA1, 0xBF, 0xB3, 0xBF, 0xC0, 0xBF, 0xD2, 0xBF,
+    0xDE, 0x64, 0x6F, 0x75, 0x7B, 0x86, 0x01, 0x21, 0x62, 0x64, 0x6D, 0x6E, 0x72, 0x73, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x80, 0x01, 0x22, 0x86, 0x01, 0x22, 0x62, 0x64, 0x6D, 0x6E, 0x72, 0x73,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0xA1, 0xA9, 0xB3, 0x0F, 0x0F, 0x0F, 0x04, 0x61, 0x65,
+    0x6F, 0xC3, 0x0F, 0x0F, 0x0F, 0x79, 0x02, 0xA1, 0xB3, 0x61, 0x0F, 0x04, 0x61, 0x68, 0x6F, 0xC3,
+    0xBF, 0xDC, 0x72, 0x0F, 0x7B, 0x80, 0x06, 0xD2, 0x01, 0x66, 0x05, 0x02, 0x63, 0x71, 0x05, 0x05,
+    0x02, 0x69, 0x75, 0x78, 0x7B, 0x04, 0x61, 0x65, 0x6F, 0xC3, 0x0E, 0x0E, 0x0E, 0xBE, 0xFB, 0x01,
+    0x6A, 0x76, 0x01, 0xB1, 0x20, 0x01, 0xC3, 0x7D, 0x01, 0xA9, 0x7D, 0x02, 0x65, 0xC3, 0x7A, 0x7D,
+    0x01, 0x6A, 0xBE, 0xEC, 0x01, 0xA9, 0x7C, 0x03, 0x65, 0x70, 0xC3, 0x68, 0x74, 0x7D, 0x01, 0x6E,
+    0x20, 0x01, 0xA9, 0x7D, 0x02, 0x65, 0xC3, 0x7A, 0x7D, 0x01, 0x72, 0x7B, 0x01, 0x66, 0x7D, 0x01,
+    0xA9, 0x0E, 0x02, 0x65, 0xC3, 0x0E, 0x7D, 0x81, 0x06, 0xD2, 0x75, 0x7B, 0x02, 0x63, 0x74, 0xBE,
+    0xE0, 0x20, 0x01, 0x72, 0x05, 0x01, 0x62, 0x7D, 0x01, 0x6D, 0x7D, 0x01, 0x6F, 0x7D, 0x01, 0x7A,
+    0x05, 0x02, 0x63, 0x6E, 0x09, 0x7D, 0x01, 0x61, 0x7B, 0x01, 0x72, 0x7D, 0x01, 0x6E, 0x05, 0x01,
+    0x6D, 0x05, 0x04, 0x61, 0x65, 0x69, 0x75, 0x05, 0x77, 0x7A, 0x7D, 0x01, 0x6C, 0x05, 0x01, 0x69,
+    0x7D, 0x01, 0x69, 0x05, 0x01, 0x69, 0x68, 0x03, 0x62, 0x63, 0x6C, 0x77, 0x7A, 0x7D, 0x01, 0x73,
+    0x05, 0x01, 0x63, 0x05, 0x02, 0x65, 0x75, 0x7A, 0x7D, 0x03, 0x61, 0x69, 0x72, 0x6E, 0xBF, 0xD6,
+    0x7B, 0x03, 0x63, 0x70, 0x74, 0xBF, 0xBA, 0xBF, 0xD1, 0x78, 0x06, 0x62, 0x64, 0x6D, 0x6E, 0x72,
+    0x73, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x01, 0xA1, 0x73, 0x0A, 0x61, 0x63, 0x64, 0x6D, 0x6E,
+    0x6F, 0x71, 0x72, 0x73, 0xC3, 0xBE, 0xFB, 0xBF, 0x31, 0xBF, 0x46, 0xBF, 0x6D, 0xBF, 0x82, 0x09,
+    0xBF, 0x8D, 0xBF, 0x92, 0x67, 0x7D, 0x02, 0x6F, 0x72, 0xBF, 0xA5, 0x09, 0x02, 0x61, 0x6F, 0x09,
+    0x09, 0x02, 0x65, 0x69, 0x75, 0x7B, 0x01, 0x74, 0x09, 0x01, 0x72, 0x7D, 0x01, 0xA1, 0xBF, 0x8F,
+    0x02, 0x61, 0xC3, 0xBF, 0x8B, 0x7C, 0x02, 0x6E, 0x75, 0x09, 0x7A, 0x01, 0xB3, 0xBF, 0x71, 0x02,
+    0x6F, 0xC3, 0xBF, 0x6D, 0x7C, 0x01, 0x69, 0x7A, 0x01, 0x73, 0x7D, 0x01, 0x75, 0x7D, 0x02, 0x67,
+    0x6E, 0xBF, 0x76, 0x05, 0x01, 0x65, 0xBF, 0x7A, 0x02, 0x6F, 0x72, 0xBF, 0x54, 0x7C, 0x02, 0x61,
+    0x70, 0x70, 0x7A, 0x01, 0x74, 0x05, 0x01, 0x6E, 0x7D, 0x01, 0x70, 0x05, 0x01, 0x72, 0x7D, 0x01,
+    0x73, 0x74, 0x01, 0x75, 0x7D, 0x04, 0x65, 0x6C, 0x6F, 0x72, 0x71, 0xBF, 0x4F, 0x77, 0x7D, 0x02,
+    0x63, 0x74, 0x0F, 0x0F, 0x01, 0x6E, 0x7B, 0x01, 0x72, 0xBF, 0xDC, 0x01, 0x63, 0x09, 0x81, 0x06,
+    0xD2, 0x61, 0xBF, 0x21, 0x01, 0x72, 0xBF, 0x1B, 0x04, 0x61, 0x65, 0x6C, 0x6F, 0x6F, 0x73, 0x76,
+    0x7C, 0x01, 0x62, 0x05, 0x01, 0x69, 0x7D, 0x01, 0x63, 0xBF, 0xBC, 0x01, 0x61, 0xBF, 0x10, 0x02,
+    0x65, 0x74, 0x78, 0x7C, 0x02, 0x67, 0x72, 0xBD, 0xFE, 0x20, 0x01, 0x78, 0x05, 0x03, 0x65, 0x6F,
+    0x75, 0x77, 0x7D, 0x64, 0x01, 0x65, 0xBE, 0xCE, 0x07, 0x63, 0x65, 0x66, 0x68, 0x73, 0x74, 0x76,
+    0xBF, 0xAD, 0xBF, 0xBC, 0xBF, 0xD0, 0xBF, 0xDC, 0x67, 0x75, 0x7C, 0x01, 0x6E, 0x09, 0x01, 0x65,
+    0x7D, 0x01, 0x74, 0x7D, 0x07, 0x64, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x73, 0xBF, 0x3D, 0xBF, 0x45,
+    0xBF, 0x52, 0xBF, 0x67, 0xBF, 0x7A, 0x64, 0x7D, 0x02, 0x63, 0x7A, 0x05, 0x05, 0x01, 0x65, 0xBE,
+    0xAF, 0x02, 0x65, 0x69, 0x77, 0x7C, 0x01, 0x64, 0x7B, 0x01, 0x67, 0x05, 0x01, 0x69, 0x7D, 0x01,
+    0x74, 0xBE, 0x83, 0x03, 0x65, 0x6C, 0x73, 0x73, 0x79, 0x7C, 0x01, 0x73, 0x0F, 0x01, 0xBA, 0xBF,
+    0x4C, 0x03, 0x61, 0x75, 0xC3, 0x79, 0xBF, 0x48, 0x7C, 0x01, 0x6F, 0xBE, 0x69, 0x82, 0x01, 0x22,
+    0x63, 0x64, 0x09, 0x09, 0x05, 0x61, 0x65, 0x6C, 0x6F, 0xC3, 0x79, 0x0F, 0x09, 0x0F, 0xBD, 0xE2,
+    0x01, 0x65, 0x09, 0x01, 0x63, 0x7D, 0x01, 0x69, 0xBE, 0x69, 0x01, 0x72, 0x7C, 0x01, 0x65, 0x05,
+    0x01, 0x6A, 0x05, 0x01, 0x6E, 0xBE, 0x6E, 0x01, 0x61, 0x7C, 0x02, 0x65, 0x6C, 0xBF, 0x0C, 0xBE,
+    0x61, 0x01, 0x61, 0xBE, 0x4E, 0x01, 0x6A, 0x09, 0x01, 0x69, 0x7D, 0x06, 0x64, 0x65, 0x67, 0x69,
+    0x6E, 0x74, 0x62, 0x65, 0x6C, 0x6F, 0x76, 0x7D, 0x01, 0x67, 0x20, 0x01, 0x65, 0x7D, 0x02, 0xA1,
+    0xA9, 0x05, 0x05, 0x03, 0x61, 0x69, 0xC3, 0x05, 0x05, 0x7B, 0x01, 0xA9, 0x05, 0x02, 0x65, 0xC3,
+    0x05, 0x7D, 0x0B, 0x62, 0x63, 0x64, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x76, 0x78, 0x79, 0xBF, 0x81,
+    0xBF, 0x8F, 0xBF, 0x97, 0xBF, 0xA2, 0xBF, 0xB1, 0xBF, 0xB8, 0xBF, 0xD9, 0x69, 0x71, 0xBE, 0x2F,
+    0x7B, 0x80, 0x0B, 0xD3, 0x02, 0x63, 0x71, 0x7D, 0x7D, 0x01, 0x61, 0xBD, 0xB5, 0x01, 0x74, 0x7C,
+    0x02, 0x69, 0x73, 0x74, 0x7D, 0x03, 0x6E, 0x72, 0x73, 0x0F, 0x0F, 0x0F, 0x01, 0x61, 0x79, 0x01,
+    0x6C, 0x09, 0x01, 0x6C, 0x7D, 0x02, 0x6E, 0x73, 0x05, 0x05, 0x81, 0x06, 0xD2, 0x61, 0x05, 0x03,
+    0x6E, 0x72, 0x73, 0x05, 0x7B, 0x05, 0x03, 0x6E, 0x72, 0x73, 0x05, 0x05, 0x05, 0x02, 0xA9, 0xB3,
+    0x79, 0x05, 0x05, 0x64, 0x65, 0x6D, 0x72, 0xC3, 0x05, 0x6D, 0x05, 0x05, 0x7B, 0x02, 0xA1, 0xAD,
+    0x05, 0xBF, 0xDD, 0x05, 0x61, 0x65, 0x69, 0x6F, 0xC3, 0xBF, 0xD2, 0x05, 0x6F, 0x05, 0x7A, 0x01,
+    0x62, 0xBF, 0x48, 0x01, 0xA1, 0x05, 0x02, 0x61, 0xC3, 0x05, 0x7D, 0x01, 0xB1, 0x7B, 0x07, 0x62,
+    0x64, 0x65, 0x6E, 0x72, 0x73, 0xC3, 0xBF, 0xA2, 0xBF, 0xAE, 0xBF, 0xB4, 0x65, 0x71, 0xBF, 0x9F,
+    0x7D, 0x01, 0x61, 0x1B, 0x02, 0x68, 0x6C, 0xBC, 0x3E, 0x7D, 0x80, 0x07, 0x92, 0x02, 0x61, 0x65,
+    0x7D, 0x7D, 0x01, 0x68, 0x7B, 0x01, 0x74, 0x20, 0x02, 0x63, 0x72, 0x7A, 0x7D, 0x01, 0x61, 0x6D,
+    0x01, 0x64, 0xBE, 0xFD, 0x02, 0x6C, 0x72, 0x79, 0x7C, 0x03, 0xA1, 0xA9, 0xB3, 0xBF, 0xDB, 0x6F,
+    0x7B, 0x06, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xBC, 0x70, 0xBD, 0x99, 0xBE, 0x83, 0xBF, 0x31,
+    0xBF, 0xBD, 0x78, 0x05, 0x63, 0x69, 0x6E, 0x72, 0x73, 0xBB, 0x6B, 0xBB, 0x77, 0xA9, 0x9D, 0xBB,
+    0xA8, 0x6E, 0x80, 0x0B, 0xB2, 0x01, 0x63, 0x7D, 0x01, 0xA9, 0x7D, 0x02, 0x65, 0xC3, 0x7A, 0x7D,
+    0x01, 0x6C, 0x7B, 0x01, 0x65, 0x7D, 0x98, 0x06, 0x71, 0x2E, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79,
+    0x7A, 0x04, 0x00, 0x1E, 0x00, 0xBF, 0xDD, 0x1F, 0x10, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x26, 0x00, 0x27, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2E, 0x09, 0x02, 0x2E, 0x73,
+    0x09, 0x7D, 0x02, 0x61, 0x6F, 0x7B, 0x7B, 0x01, 0x69, 0x7B, 0x01, 0x61, 0x1C, 0x01, 0x6C, 0x7D,
+    0x80, 0x03, 0x72, 0x01, 0x6F, 0x7D, 0x01, 0x74, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x01,
+    0x69, 0x7D, 0x03, 0x63, 0x64, 0x6D, 0x65, 0x6B, 0x7D, 0x07, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75,
+    0xC3, 0x23, 0x23, 0xA9, 0x26, 0x23, 0x23, 0x23, 0xB8, 0x23, 0x02, 0x6F, 0x72, 0x16, 0x0C, 0x80,
+    0x00, 0x02, 0x01, 0x6C, 0x7D, 0x01, 0x61, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x72, 0x7D, 0x01, 0x6F,
+    0x7D, 0x01, 0x74, 0x7D, 0x01, 0x61, 0x7D, 0x04, 0x61, 0x6F, 0x74, 0x75, 0xB5, 0xB2, 0xBF, 0xD2,
+    0x63, 0x7D, 0x01, 0x6F, 0xB5, 0xA2, 0x06, 0x2E, 0x6C, 0x6D, 0x6E, 0x72, 0x74, 0x04, 0xB5, 0xB1,
+    0x36, 0xB5, 0xBB, 0x7C, 0x36, 0x01, 0x64, 0xBF, 0x98, 0x01, 0x72, 0xB5, 0xCF, 0x01, 0x74, 0x7C,
+    0x01, 0x63, 0x7D, 0x01, 0xA9, 0x7D, 0x02, 0x65, 0xC3, 0x7A, 0x7D, 0x01, 0x61, 0x04, 0x01, 0x63,
+    0x7D, 0x01, 0x6F, 0x7D, 0x01, 0x6F, 0xAA, 0x2C, 0x03, 0x62, 0x69, 0x6F, 0x79, 0x7C, 0x17, 0x01,
+    0x61, 0x16, 0x80, 0x04, 0x61, 0x01, 0x72, 0x7D, 0x01, 0x62, 0x7D, 0x01, 0x65, 0x7D, 0x03, 0x65,
+    0x6F, 0x72, 0xB6, 0xE3, 0x16, 0xA8, 0x23, 0x05, 0x2E, 0x64, 0x65, 0x68, 0x74, 0x04, 0x08, 0x68,
+    0x74, 0x77, 0x80, 0x04, 0xF2, 0x01, 0xA1, 0x7D, 0x03, 0x65, 0x73, 0xC3, 0xB7, 0xA6, 0x1C, 0x7D,
+    0x80, 0x03, 0x93, 0x01, 0x2E, 0x25, 0x01, 0x73, 0x18, 0x04, 0x2E, 0x69, 0x6E, 0x73, 0x25, 0x7D,
+    0x18, 0x18, 0x80, 0x03, 0xC4, 0x01, 0x2E, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x74, 0x7D, 0x01, 0x6E,
+    0x7D, 0x01, 0x65, 0x7D, 0x03, 0x2E, 0x6D, 0x73, 0x6E, 0x7D, 0x71, 0x01, 0x65, 0x79, 0x02, 0x61,
+    0x6C, 0xBF, 0xDB, 0x7D, 0x80, 0x01, 0x92, 0x02, 0x2E, 0x73, 0x25, 0x18, 0x03, 0x2E, 0x61, 0x65,
+    0x25, 0x7B, 0xBF, 0xCA, 0x03, 0x2E, 0x72, 0x73, 0x25, 0x78, 0x18, 0x03, 0x2E, 0x61, 0x6F, 0x69,
+    0x6C, 0x79, 0x01, 0x6F, 0xBF, 0xB4, 0x01, 0x2E, 0xBF, 0xDE, 0x05, 0x2E, 0x69, 0x6D, 0x6E, 0x73,
+    0x25, 0xBF, 0xAC, 0x78, 0x18, 0x18, 0x01, 0x6E, 0x18, 0x03, 0x2E, 0x6E, 0x73, 0x25, 0x18, 0x18,
+    0x03, 0x2E, 0x69, 0x73, 0x25, 0xBF, 0x96, 0x18, 0x01, 0x73, 0x25, 0x05, 0x2E, 0x69, 0x6D, 0x6E,
+    0x73, 0x25, 0x7D, 0xBF, 0xD7, 0x18, 0x18, 0x02, 0x61, 0x73, 0x74, 0x18, 0x03, 0xA1, 0xA9, 0xAD,
+    0xBF, 0xDD, 0x64, 0x7B, 0x04, 0x61, 0x65, 0x6F, 0xC3, 0xBF, 0x75, 0xBF, 0xC6, 0xBF, 0xD2, 0x78,
+    0x01, 0x73, 0xBF, 0xB6, 0x03, 0x2E, 0x69, 0x73, 0xBF, 0x90, 0x7C, 0xBF, 0xB2, 0x01, 0x65, 0x77,
+    0x03, 0x2E, 0x65, 0x74, 0xBF, 0x84, 0xBF, 0x59, 0x7D, 0x01, 0x65, 0x67, 0x07, 0x62, 0x64, 0x6D,
+    0x6E, 0x72, 0x73, 0x74, 0xBF, 0x72, 0xBF, 0x8F, 0xBF, 0x96, 0xBF, 0x9A, 0xBF, 0xD8, 0x74, 0x7D,
+    0x80, 0x04, 0x03, 0x01, 0x2E, 0x7D, 0x01, 0x73, 0x7D, 0x01, 0x6F, 0x7D, 0x01, 0x6D, 0x7D, 0x02,
+    0x2E, 0x65, 0x13, 0x17, 0x01, 0x64, 0x7B, 0x01, 0x61, 0x7D, 0x01, 0x64, 0x7D, 0x01, 0x65, 0x0B,
+    0x01, 0x74, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x05, 0x2E, 0x61, 0x65, 0x69, 0x6D, 0x13,
+    0xB4, 0x3B, 0x17, 0x71, 0x7D, 0x01, 0x72, 0x74, 0x01, 0x6F, 0x7D, 0x03, 0x61, 0x65, 0x6F, 0x0D,
+    0x0D, 0x0D, 0x80, 0x04, 0x33, 0x01, 0x2E, 0x7D, 0x01, 0x73, 0x7D, 0x01, 0x6F, 0x7D, 0x01, 0x6D,
+    0x7D, 0x01, 0x61, 0x7D, 0x02, 0x61, 0x65, 0x7A, 0x7A, 0x02, 0x2E, 0x65, 0x13, 0x75, 0x06, 0x2E,
+    0x62, 0x69, 0x6E, 0x72, 0x73, 0x13, 0x73, 0xBF, 0x72, 0x0B, 0x76, 0x7B, 0x05, 0x2E, 0x69, 0x6D,
+    0x6E, 0x73, 0x13, 0x17, 0xB4, 0xB9, 0x0B, 0x0B, 0x02, 0x61, 0x73, 0x74, 0x0B, 0x03, 0xA1, 0xA9,
+    0xAD, 0x61, 0xB4, 0xF0, 0x7B, 0x0B, 0x2E, 0x61, 0x65, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x73, 0x74,
+    0xC3, 0x04, 0xBF, 0x67, 0xBF, 0x87, 0xBF, 0xB3, 0xBF, 0xB6, 0x36, 0xB3, 0xFC, 0x17, 0x36, 0x36,
+    0x78, 0x01, 0x72, 0xB8, 0xFF, 0x01, 0x65, 0x7C, 0x01, 0x6C, 0x7D, 0x01, 0x65, 0xB8, 0xF5, 0x01,
+    0x72, 0x7C, 0x01, 0x65, 0x7D, 0x03, 0x2E, 0x63, 0x74, 0x04, 0x73, 0x7D, 0x01, 0x6E, 0x08, 0x02,
+    0x63, 0x72, 0x08, 0x08, 0x01, 0x72, 0xA9, 0x38, 0x01, 0x65, 0x7C, 0x01, 0x6D, 0x09, 0x01, 0x75,
+    0x7D, 0x01, 0x69, 0x34, 0x04, 0x63, 0x67, 0x6C, 0x6D, 0x74, 0xAB, 0x44, 0x7A, 0x7D, 0x01, 0x74,
+    0xA7, 0xAC, 0x01, 0xA9, 0x7C, 0x01, 0xC3, 0x7D, 0x01, 0x69, 0xAA, 0xF5, 0x01, 0x75, 0x7C, 0x03,
+    0x63, 0x67, 0x71, 0x1D, 0x76, 0x7D, 0x01, 0xAD, 0x02, 0x03, 0x65, 0x69, 0xC3, 0x02, 0x02, 0x7D,
+    0x03, 0x61, 0x6F, 0xC3, 0x02, 0x02, 0xB0, 0xF0, 0x02, 0x61, 0x69, 0x1D, 0xAF, 0x52, 0x04, 0xA1,
+    0xA9, 0xAD, 0xB3, 0x02, 0x02, 0x02, 0x02, 0x05, 0x61, 0x65, 0x69, 0x6F, 0xC3, 0x02, 0x02, 0x02,
+    0x02, 0x77, 0x01, 0x6F, 0xA7, 0x77, 0x05, 0x67, 0x6A, 0x6C, 0x6D, 0x74, 0xBF, 0xD3, 0xBF, 0xDA,
+    0x62, 0x71, 0x7C, 0x01, 0xB3, 0x02, 0x01, 0xC3, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x72, 0xBF, 0x95,
+    0x01, 0x71, 0x02, 0x01, 0x73, 0x7D, 0x01, 0x6D, 0xA7, 0x44, 0x01, 0xA1, 0x7C, 0x02, 0x61, 0xC3,
+    0x79, 0x7D, 0x01, 0x61, 0x34, 0x01, 0x6C, 0x7D, 0x03, 0x63, 0x71, 0x73, 0x02, 0x02, 0xAE, 0xA1,
+    0x01, 0xA9, 0x1D, 0x02, 0x69, 0xC3, 0x75, 0x7D, 0x07, 0x62, 0x63, 0x65, 0x67, 0x6E, 0x70, 0x74,
+    0xBF, 0xD1, 0xBF, 0xD4, 0xBF, 0xDB, 0x65, 0xAA, 0xB0, 0x6D, 0x7B, 0x80, 0x03, 0x21, 0x01, 0x69,
+    0x7D, 0x01, 0x6C, 0x7D, 0x01, 0x6F, 0x7D, 0x01, 0x72, 0x32, 0x03, 0x63, 0x72, 0x74, 0x02, 0x02,
+    0x02, 0x01, 0x61, 0x79, 0x02, 0x62, 0x64, 0xAA, 0x84, 0x7D, 0x02, 0x6D, 0x72, 0xB0, 0x8D, 0x35,
+    0x01, 0x67, 0xB0, 0x33, 0x02, 0x61, 0x6F, 0x03, 0x03, 0x03, 0x61, 0x65, 0x6F, 0x03, 0x03, 0x03,
+    0x01, 0x69, 0x79, 0x04, 0x61, 0x65, 0x69, 0x6F, 0x03, 0x03, 0x03, 0x03, 0x04, 0x67, 0x6A, 0x6C,
+    0x6D, 0xB0, 0x17, 0x68, 0x74, 0x77, 0x04, 0xA1, 0xA9, 0xAD, 0xB3, 0xBF, 0xD4, 0xBF, 0xDA, 0x76,
+    0xAF, 0x5D, 0x08, 0x61, 0x65, 0x69, 0x6F, 0x70, 0x74, 0x75, 0xC3, 0xBF, 0x02, 0xBF, 0x1D, 0xBF,
+    0x54, 0xBF, 0x96, 0xBF, 0xB2, 0xBF, 0xB5, 0xBF, 0xC2, 0x74, 0x80, 0x00, 0x11, 0x01, 0x6F, 0x7D,
+    0x01, 0x64, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0xA1, 0x7D, 0x0F, 0x2E, 0x61, 0x63, 0x64, 0x65, 0x6C,
+    0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x78, 0xC3, 0x04, 0xBC, 0x89, 0xBC, 0xBE, 0xBC, 0xCD,
+    0xBC, 0xDC, 0xBC, 0xED, 0xBC, 0xFF, 0xBD, 0x1E, 0xBD, 0x2F, 0xBE, 0x8C, 0xBE, 0xBC, 0xBE, 0xC3,
+    0xBE, 0xC6, 0xBF, 0xD9, 0x7D, 0x01, 0x69, 0xA7, 0x9D, 0x01, 0x72, 0x7C, 0x01, 0x61, 0x7D, 0x01,
+    0x69, 0x7D, 0x01, 0x6C, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x6D, 0x7D, 0x02, 0x6D, 0x72, 0xA5, 0x65,
+    0x2D, 0x03, 0x6C, 0x73, 0x74, 0x08, 0xB3, 0x87, 0x08, 0x02, 0x6E, 0x74, 0x08, 0x08, 0x9A, 0x06,
+    0x71, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
+    0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x04, 0x6A, 0x00, 0x00, 0x00,
+    0x6D, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x27, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x27, 0x00, 0xB6,
+    0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x65, 0x72, 0xBE, 0x1B, 0x2F, 0x01, 0x74, 0x7A, 0x02,
+    0x6C, 0x73, 0x08, 0x7D, 0x01, 0x6E, 0xB7, 0x0F, 0x01, 0x6F, 0x7C, 0x02, 0x6F, 0x72, 0xBB, 0xEE,
+    0x7D, 0x01, 0x63, 0x2F, 0x01, 0x65, 0x7D, 0x02, 0x67, 0x6E, 0xBC, 0x58, 0x7D, 0x97, 0x00, 0x71,
     0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73,
-    0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xE3, 0xFC, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF,
-    0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF,
-    0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF,
-    0xE3, 0xFF, 0x41, 0x75, 0xF3, 0x6B, 0x41, 0x66, 0xEF, 0x7D, 0xA0, 0x0D, 0x02, 0x21, 0x61, 0xFD,
-    0x21, 0x65, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0xA1, 0xFD, 0x44, 0x6E, 0x70, 0x74, 0xC3, 0xFF, 0xED,
-    0xF5, 0x4D, 0xF5, 0x4D, 0xFF, 0xFD, 0x41, 0x61, 0xFC, 0x4E, 0x21, 0xAD, 0xFC, 0x21, 0xC3, 0xFD,
-    0x21, 0x67, 0xFD, 0xD9, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6D,
-    0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x6C, 0x65, 0x69, 0x6F, 0xE3,
-    0x86, 0xE3, 0x89, 0xE3, 0x8F, 0xE3, 0x89, 0xE3, 0x98, 0xE3, 0x9D, 0xE3, 0x89, 0xE3, 0x89, 0xE3,
-    0x89, 0xE3, 0x9D, 0xE3, 0x89, 0xE3, 0xA2, 0xE3, 0x89, 0xE3, 0x89, 0xE3, 0x89, 0xE3, 0xAB, 0xE3,
-    0x89, 0xE3, 0x89, 0xE3, 0x89, 0xE3, 0x89, 0xE3, 0x89, 0xFF, 0x8A, 0xFF, 0xCF, 0xFF, 0xE6, 0xFF,
-    0xFD, 0x42, 0x2E, 0x73, 0xE3, 0x38, 0xF4, 0x32, 0x21, 0x65, 0xF9, 0x21, 0x6C, 0xFD, 0x21, 0x62,
-    0xFD, 0x41, 0x2E, 0xE4, 0x07, 0x21, 0x65, 0xFC, 0x21, 0x74, 0xFD, 0x48, 0x6C, 0x68, 0x61, 0x65,
-    0x69, 0x6F, 0x75, 0xC3, 0xE3, 0xAB, 0xE6, 0xEC, 0xE7, 0x28, 0xE7, 0x28, 0xE7, 0x28, 0xE7, 0x28,
-    0xE7, 0x28, 0xE7, 0x2E, 0x21, 0x61, 0xE7, 0x41, 0x6E, 0xE3, 0x8F, 0x21, 0x61, 0xFC, 0x47, 0x6F,
-    0x61, 0x6E, 0x67, 0x6C, 0x73, 0x74, 0xF3, 0xF5, 0xFF, 0xD0, 0xFF, 0xDA, 0xFF, 0xF6, 0xFF, 0xFD,
-    0xF4, 0xA8, 0xFC, 0x8B, 0xA0, 0x05, 0x51, 0x21, 0x61, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD,
-    0xA0, 0x02, 0xB2, 0xCC, 0x01, 0xA1, 0x68, 0x62, 0x63, 0x64, 0x66, 0x67, 0x6D, 0x70, 0x71, 0x73,
-    0x74, 0x76, 0xFF, 0xFD, 0xE4, 0xE9, 0xE4, 0xE9, 0xE4, 0xE9, 0xE4, 0xE9, 0xE4, 0xE9, 0xE4, 0xE9,
-    0xE4, 0xE9, 0xE4, 0xE9, 0xE4, 0xE9, 0xE4, 0xE9, 0xE4, 0xE9, 0x41, 0x69, 0xE6, 0xCA, 0x44, 0x6E,
-    0x63, 0x6C, 0x78, 0xFF, 0xCF, 0xEE, 0x79, 0xFF, 0xD5, 0xFF, 0xFC, 0x41, 0x72, 0xE8, 0xA2, 0x21,
-    0x61, 0xFC, 0x21, 0x69, 0xFD, 0xA0, 0x01, 0x12, 0x21, 0x72, 0xFD, 0x21, 0x75, 0xFD, 0xA1, 0x04,
-    0xA2, 0x74, 0xFD, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xE6, 0x54, 0xFF, 0xFB, 0xE6,
-    0x90, 0xE6, 0x90, 0xE6, 0x90, 0xE6, 0x90, 0xE6, 0x96, 0x21, 0x69, 0xEA, 0x41, 0x69, 0xE3, 0x9F,
-    0x44, 0x63, 0x6C, 0x6E, 0x72, 0xEE, 0x37, 0xFF, 0xD2, 0xFF, 0xF9, 0xFF, 0xFC, 0x41, 0x74, 0xE6,
-    0x62, 0x21, 0x6C, 0xFC, 0x43, 0x6E, 0x72, 0x74, 0xF4, 0x02, 0xFE, 0xA2, 0xF4, 0x02, 0xDB, 0x00,
-    0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72,
-    0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x65, 0x61, 0x69, 0x75, 0x6F, 0xE2, 0x4B, 0xE2, 0x4E,
-    0xE2, 0x54, 0xE2, 0x4E, 0xE2, 0x5D, 0xE2, 0x62, 0xE2, 0x4E, 0xE2, 0x4E, 0xE2, 0x4E, 0xE2, 0x4E,
-    0xE2, 0x62, 0xF2, 0x24, 0xE2, 0x67, 0xE2, 0x4E, 0xE2, 0x4E, 0xE2, 0x4E, 0xE2, 0x70, 0xE2, 0x4E,
-    0xE2, 0x4E, 0xE2, 0x4E, 0xE2, 0x4E, 0xE2, 0x4E, 0xFF, 0x50, 0xFF, 0xA0, 0xFF, 0xE2, 0xFF, 0xF3,
-    0xFF, 0xF6, 0xA0, 0x0B, 0x95, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x72, 0xFD, 0xC3, 0x00,
-    0x71, 0x7A, 0x73, 0x65, 0xE1, 0xF1, 0xE1, 0xF1, 0xFF, 0xFD, 0x41, 0x74, 0xED, 0xA2, 0x42, 0x2E,
-    0x72, 0xE1, 0xDE, 0xFF, 0xFC, 0x43, 0x6D, 0x6E, 0x72, 0xF3, 0x81, 0xF3, 0x81, 0xF1, 0x88, 0x45,
-    0x63, 0x66, 0x6F, 0x74, 0x75, 0xED, 0x98, 0xED, 0x98, 0xFB, 0x31, 0xF3, 0x77, 0xF2, 0xA5, 0xD9,
-    0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71,
-    0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x6F, 0x61, 0x65, 0xE1, 0xBA, 0xE1, 0xBD, 0xE1,
-    0xC3, 0xE1, 0xBD, 0xE1, 0xCC, 0xE1, 0xD1, 0xE1, 0xBD, 0xE1, 0xBD, 0xE1, 0xBD, 0xE1, 0xBD, 0xE1,
-    0xD1, 0xE1, 0xBD, 0xE1, 0xD6, 0xE1, 0xBD, 0xE1, 0xBD, 0xE1, 0xBD, 0xFF, 0xCF, 0xE1, 0xBD, 0xE1,
-    0xBD, 0xE1, 0xBD, 0xE1, 0xBD, 0xE1, 0xBD, 0xFF, 0xDF, 0xFF, 0xE6, 0xFF, 0xF0, 0xC1, 0x0D, 0x22,
-    0x6F, 0xE2, 0x8F, 0x42, 0x63, 0x71, 0xFF, 0xFA, 0xF1, 0x1E, 0xC2, 0x00, 0x71, 0x2E, 0x69, 0xE1,
-    0x5F, 0xFF, 0xF9, 0xC2, 0x00, 0x71, 0x2E, 0x65, 0xE1, 0x56, 0xED, 0x24, 0x41, 0x74, 0xFE, 0xB9,
-    0x21, 0x63, 0xFC, 0x21, 0x6E, 0xFD, 0x41, 0x72, 0xE5, 0x49, 0xD8, 0x00, 0x91, 0x2E, 0x62, 0x63,
+    0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xB2, 0x6E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80,
+    0x03, 0x01, 0x01, 0x2E, 0x3E, 0x01, 0x73, 0x7D, 0x02, 0x2E, 0x65, 0x3E, 0x7D, 0x01, 0x6C, 0x7B,
+    0x02, 0x2E, 0x73, 0x3E, 0x72, 0x02, 0x61, 0x6F, 0x78, 0x7B, 0x01, 0x6E, 0x7B, 0x09, 0x2E, 0x61,
+    0x65, 0x68, 0x69, 0x6F, 0x73, 0x75, 0xC3, 0x3E, 0x0A, 0x0A, 0x2B, 0x0A, 0x0A, 0x65, 0x0A, 0xA4,
+    0x1A, 0x01, 0x61, 0xBF, 0xDF, 0x01, 0xAD, 0x7C, 0x03, 0x61, 0x6F, 0xC3, 0xBF, 0xD8, 0x65, 0x7D,
+    0x01, 0x66, 0x78, 0x97, 0x00, 0x71, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B,
+    0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x04, 0x7D, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x64, 0xB5, 0x20, 0x01, 0x72, 0x7C, 0x01, 0x61, 0x7D, 0x9B, 0x06,
+    0x71, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
+    0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x04, 0xBF, 0x31, 0x00,
+    0x00, 0x00, 0xBF, 0x3D, 0x00, 0x00, 0x00, 0xBF, 0x49, 0x00, 0x00, 0xBF, 0x4F, 0x00, 0xB5, 0x91,
+    0xBF, 0x9C, 0x00, 0x00, 0xBF, 0xC5, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x65,
+    0x3E, 0x01, 0x74, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x61, 0x7A, 0x02, 0x69, 0x6C,
+    0x7A, 0x7D, 0x02, 0x62, 0x6C, 0x7B, 0x08, 0x02, 0x63, 0x6F, 0x2F, 0x2A, 0x01, 0x69, 0x7B, 0x01,
+    0x2E, 0x38, 0x02, 0x2E, 0x73, 0x38, 0x7D, 0x01, 0x61, 0x7B, 0x81, 0x03, 0x52, 0x6C, 0x7D, 0x07,
+    0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x07, 0x07, 0x11, 0x07, 0x7B, 0x07, 0xA9, 0x85, 0x03,
+    0x61, 0x69, 0x6F, 0xB4, 0x44, 0x70, 0x16, 0x02, 0x61, 0x74, 0xB4, 0x3C, 0x32, 0x01, 0x65, 0xB2,
+    0x04, 0x06, 0x63, 0x6C, 0x6D, 0x70, 0x74, 0x78, 0xA3, 0xAF, 0xBF, 0xCB, 0x6E, 0x76, 0x7C, 0xBB,
+    0x0E, 0x80, 0x0B, 0x73, 0x01, 0x65, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0xAD, 0x7D, 0x01, 0xC3, 0x7D,
+    0x81, 0x08, 0x93, 0x63, 0x7D, 0x01, 0x69, 0x6C, 0x01, 0x6D, 0x7D, 0x01, 0xAD, 0x7D, 0x02, 0x69,
+    0xC3, 0x7A, 0x7D, 0x01, 0x61, 0xBF, 0xDE, 0x01, 0x69, 0x7C, 0x82, 0x08, 0x93, 0x6E, 0x78, 0x74,
+    0x7D, 0x80, 0x08, 0x33, 0x01, 0x6F, 0x7D, 0x01, 0x6D, 0x7D, 0x01, 0x69, 0x7D, 0x81, 0x08, 0x03,
+    0x6E, 0x7D, 0x05, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x1A, 0x1A, 0x1A, 0x7B, 0x1A, 0x08, 0x61, 0x65,
+    0x68, 0x69, 0x6F, 0x72, 0x75, 0xC3, 0x21, 0x21, 0x28, 0xBF, 0xC3, 0xBF, 0xDD, 0x30, 0x21, 0x75,
+    0x01, 0x72, 0x6D, 0x02, 0x65, 0x6F, 0x7D, 0x16, 0x03, 0x64, 0x70, 0x73, 0x2D, 0x7B, 0xA3, 0x38,
+    0x02, 0x65, 0x6F, 0x0C, 0x16, 0x02, 0x6C, 0x6D, 0x08, 0x7B, 0x02, 0x2E, 0x73, 0x00, 0xB0, 0x5A,
+    0x02, 0x61, 0x6F, 0x7A, 0x7A, 0x01, 0x6C, 0x7B, 0x02, 0x61, 0x6F, 0x2E, 0x2E, 0x01, 0x6E, 0x7B,
+    0x01, 0x61, 0x7D, 0x02, 0x65, 0x6D, 0x72, 0x7D, 0x1B, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
+    0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7A, 0x04, 0xBF, 0x1A, 0x00, 0x00, 0x00, 0xBF, 0x59, 0x00, 0x00, 0x00, 0xBF,
+    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x71, 0x02, 0x2E, 0x73, 0xB0, 0x77, 0xB0, 0x7A, 0x02, 0x61, 0x6F,
+    0x79, 0x79, 0x80, 0x00, 0xA1, 0x01, 0x2E, 0x3A, 0x01, 0x73, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x2E,
+    0x65, 0x04, 0x2E, 0x6E, 0x72, 0x73, 0x62, 0x6C, 0x7A, 0x7D, 0x01, 0x65, 0x2D, 0x80, 0x00, 0xB2,
+    0x01, 0x2E, 0x7D, 0x02, 0x2E, 0x73, 0x7A, 0x7D, 0x03, 0x2E, 0x6E, 0x73, 0x75, 0x0C, 0x78, 0x02,
+    0x61, 0x6F, 0x74, 0x79, 0x80, 0x02, 0x72, 0x01, 0x2E, 0x7D, 0x01, 0x73, 0x7D, 0x02, 0x2E, 0x65,
+    0x77, 0x7D, 0x01, 0x6C, 0x7B, 0x01, 0x69, 0x17, 0x01, 0x74, 0x7D, 0x03, 0x61, 0x65, 0x69, 0x77,
+    0xB9, 0x97, 0x7D, 0x01, 0x72, 0xB0, 0x1D, 0x03, 0x2E, 0x6D, 0x73, 0x13, 0xAF, 0xEE, 0x0B, 0x80,
+    0x02, 0x93, 0x01, 0x2E, 0x7D, 0x02, 0x2E, 0x73, 0x7A, 0x7D, 0x03, 0x61, 0x65, 0x6F, 0x33, 0x33,
+    0x33, 0x02, 0x2E, 0x6C, 0x6E, 0x79, 0x01, 0x73, 0x7B, 0x01, 0x6F, 0x7D, 0x01, 0x6C, 0x6E, 0x03,
+    0x61, 0x65, 0x6F, 0x33, 0x33, 0x33, 0x80, 0x02, 0xC4, 0x01, 0x2E, 0x7D, 0x02, 0x2E, 0x73, 0x7A,
+    0x7D, 0x03, 0x61, 0x65, 0x6F, 0x7B, 0x33, 0x33, 0x02, 0x2E, 0x6C, 0xBF, 0xC7, 0x79, 0x01, 0x65,
+    0x7A, 0x04, 0x65, 0x6C, 0x6D, 0x74, 0xBF, 0xDB, 0xBF, 0xDE, 0x7D, 0x7D, 0x03, 0x6E, 0x6F, 0x73,
+    0xBF, 0xCD, 0xBF, 0xCA, 0x75, 0x01, 0x6F, 0x77, 0x03, 0x69, 0x6D, 0x73, 0x17, 0x7D, 0x0B, 0x01,
+    0xA1, 0x79, 0x03, 0x61, 0x6F, 0xC3, 0xBF, 0x95, 0x0B, 0x7D, 0x01, 0x72, 0xB8, 0xF5, 0x01, 0x74,
+    0x7C, 0x01, 0x73, 0x7D, 0x01, 0x75, 0x7D, 0x01, 0x72, 0x2E, 0x01, 0x65, 0x7D, 0x01, 0x69, 0x7D,
+    0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x80, 0x01, 0xF1, 0x01, 0x6C, 0x3B, 0x01, 0x74, 0x3B, 0x01,
+    0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x02, 0x69, 0x74, 0x3B, 0x3B, 0x02, 0x72, 0x73, 0x78, 0x7B, 0x01,
+    0x73, 0x6D, 0x01, 0xA9, 0x7D, 0x03, 0x62, 0x65, 0xC3, 0x3B, 0x7A, 0x7D, 0x01, 0x6D, 0x3B, 0x01,
+    0x62, 0x3B, 0x01, 0x69, 0xBF, 0xDA, 0x01, 0x70, 0x7C, 0x01, 0x73, 0x7D, 0x05, 0xA1, 0xA9, 0xAD,
+    0xB3, 0xBA, 0xBF, 0xCD, 0x63, 0x73, 0x7D, 0x70, 0x05, 0x61, 0x65, 0x69, 0x75, 0xC3, 0xBF, 0xC1,
+    0xBF, 0xD2, 0xBF, 0xDD, 0x64, 0x74, 0x83, 0x02, 0x01, 0x61, 0x65, 0xC3, 0x02, 0x02, 0xAB, 0xDA,
+    0x01, 0x69, 0x76, 0x01, 0x63, 0x7D, 0x01, 0x6E, 0x2F, 0x01, 0x75, 0x7D, 0x80, 0x00, 0xF2, 0x01,
+    0x72, 0x7D, 0x01, 0x61, 0x7D, 0x01, 0x73, 0x7D, 0x80, 0x01, 0x23, 0x01, 0x2E, 0x7D, 0x80, 0x01,
+    0x83, 0x02, 0x74, 0x75, 0x7D, 0x7D, 0x02, 0x64, 0x73, 0x78, 0x7B, 0x80, 0x01, 0x53, 0x01, 0x72,
+    0x7D, 0x03, 0x6D, 0x6E, 0x6F, 0x6A, 0x75, 0x7D, 0x80, 0x00, 0xD2, 0x01, 0x6F, 0x7D, 0x01, 0x6E,
+    0x7D, 0x01, 0x67, 0x7D, 0x01, 0x65, 0x7D, 0x80, 0x01, 0x11, 0x01, 0x73, 0x7D, 0x01, 0xA9, 0x7D,
+    0x04, 0x65, 0x69, 0x72, 0xC3, 0xBF, 0xC5, 0x61, 0x74, 0x7D, 0x01, 0x72, 0x76, 0x02, 0x65, 0x72,
+    0x7D, 0x32, 0x81, 0x00, 0xF1, 0x61, 0x03, 0x01, 0x69, 0x7B, 0x01, 0x63, 0x7D, 0x01, 0xAD, 0x7D,
+    0x0A, 0x61, 0x64, 0x66, 0x67, 0x68, 0x69, 0x6D, 0x6F, 0x74, 0xC3, 0x0D, 0xBF, 0x24, 0xBA, 0xF7,
+    0xBF, 0x33, 0xBF, 0x78, 0xBF, 0x93, 0xBF, 0x99, 0x0D, 0x6D, 0x7D, 0x02, 0x2E, 0x73, 0xBE, 0x28,
+    0xBE, 0x43, 0x02, 0x69, 0x6F, 0x2E, 0xAF, 0x2D, 0x01, 0x6D, 0x7A, 0x01, 0x69, 0x2E, 0x01, 0x6D,
+    0x7D, 0x01, 0xA1, 0x7D, 0x02, 0x61, 0xC3, 0x74, 0x7D, 0x01, 0x6F, 0x0D, 0x01, 0x61, 0x0D, 0x04,
+    0x6C, 0x6D, 0x6F, 0x74, 0x75, 0x7A, 0xB7, 0xBA, 0x7D, 0x01, 0x61, 0xAE, 0x31, 0x0A, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x67, 0x6E, 0x6F, 0x73, 0x74, 0xBE, 0x14, 0xBE, 0x1D, 0xBE, 0x32, 0xBE, 0x4E,
+    0xBE, 0x56, 0xBE, 0xC5, 0xBF, 0xB3, 0xBF, 0xCE, 0x72, 0x7C, 0x96, 0x06, 0x71, 0x2E, 0x62, 0x63,
     0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77,
-    0x78, 0x79, 0x7A, 0x61, 0x75, 0xE1, 0x3F, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1,
-    0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1,
-    0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1,
-    0x6B, 0xFF, 0xF9, 0xFF, 0xFC, 0x41, 0x70, 0xE2, 0xB2, 0x42, 0x6D, 0x74, 0xFF, 0xFC, 0xEC, 0xBA,
-    0xD7, 0x00, 0x91, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70,
-    0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x6F, 0xE0, 0xE9, 0xE1, 0x15, 0xE1, 0x15,
-    0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15,
-    0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15,
-    0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xFF, 0xF9, 0x42, 0x61, 0x6F, 0xF1, 0x95, 0xF1, 0x95, 0x21,
-    0x74, 0xF9, 0x41, 0x61, 0xF4, 0x4F, 0x21, 0x69, 0xFC, 0x21, 0x6D, 0xFD, 0xA0, 0x10, 0x92, 0x21,
-    0x65, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0xA0, 0x10, 0xB2, 0x21, 0x72, 0xFD, 0x21, 0x64,
-    0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x6F, 0xFD, 0x23, 0x65, 0x61, 0x70, 0xE2, 0xEE, 0xFD, 0x44, 0x64,
-    0x72, 0x6E, 0x74, 0xF1, 0x7E, 0xFF, 0xF9, 0xF1, 0x42, 0xF9, 0xFB, 0x41, 0x6E, 0xEB, 0x6F, 0x21,
-    0x6F, 0xFC, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD, 0x41, 0x65, 0xEC, 0x1B, 0xA0, 0x06, 0x31, 0x41,
-    0xB1, 0xE1, 0xF2, 0x21, 0xC3, 0xFC, 0x22, 0x2E, 0x65, 0xF6, 0xFD, 0xA1, 0x04, 0xA2, 0x73, 0xFB,
-    0x41, 0x61, 0xE6, 0x3D, 0x21, 0x74, 0xFC, 0x21, 0x61, 0xFD, 0xA1, 0x04, 0xA2, 0x6C, 0xFD, 0x41,
-    0x6F, 0xE6, 0x2E, 0xA1, 0x04, 0xC2, 0x73, 0xFC, 0x45, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xE4, 0x2E,
-    0xE4, 0x2E, 0xFF, 0xFB, 0xE4, 0x2E, 0xE4, 0x2E, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3,
-    0xE3, 0xDF, 0xE4, 0x1B, 0xE4, 0x1B, 0xFF, 0xD3, 0xE4, 0x1B, 0xFF, 0xE2, 0xFF, 0xF0, 0x21, 0x61,
-    0xEA, 0x23, 0x6E, 0x6C, 0x72, 0xA4, 0xA7, 0xFD, 0x41, 0x7A, 0xEB, 0xBB, 0x43, 0x63, 0x65, 0x72,
-    0xF1, 0x9A, 0xFF, 0xFC, 0xF1, 0x9A, 0x42, 0x71, 0x63, 0xE5, 0xE7, 0xFF, 0xAA, 0x41, 0x65, 0xFF,
-    0xA3, 0x42, 0x64, 0x74, 0xFD, 0x3A, 0xFF, 0xFC, 0xA2, 0x04, 0xA2, 0x72, 0x6E, 0xEE, 0xF9, 0x41,
-    0x65, 0xFD, 0x36, 0x21, 0x69, 0xFC, 0xA1, 0x04, 0xA2, 0x6D, 0xFD, 0xC1, 0x04, 0xA2, 0x72, 0xE1,
-    0x66, 0x41, 0x71, 0xE5, 0xBC, 0xA1, 0x04, 0xC2, 0x72, 0xFC, 0x41, 0x65, 0xE5, 0xB3, 0x21, 0x74,
-    0xFC, 0xA1, 0x04, 0xC2, 0x73, 0xFD, 0x45, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFF, 0xEF, 0xFF, 0xFB,
-    0xE3, 0xB0, 0xE3, 0xB0, 0xE3, 0xB0, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xE3, 0x61,
-    0xFF, 0xC2, 0xE3, 0x9D, 0xE3, 0x9D, 0xFF, 0xD0, 0xFF, 0xD5, 0xFF, 0xF0, 0x21, 0x69, 0xEA, 0x41,
-    0x6F, 0xEA, 0x8B, 0xA1, 0x04, 0x52, 0x72, 0xFC, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3,
-    0xE0, 0x80, 0xE0, 0x83, 0xFF, 0xFB, 0xE0, 0x83, 0xE0, 0x83, 0xE0, 0x83, 0xE0, 0x89, 0x21, 0x61,
-    0xEA, 0x21, 0x74, 0xFD, 0x41, 0x72, 0xFC, 0x7C, 0x21, 0x70, 0xFC, 0x41, 0x64, 0xFC, 0x75, 0x22,
-    0x6D, 0x6E, 0xF9, 0xFC, 0xA0, 0x0E, 0x13, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x70, 0xFD,
-    0xA0, 0x0E, 0x43, 0x21, 0x74, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xD8, 0x22,
-    0x6C, 0x73, 0xFA, 0xFD, 0x41, 0x2E, 0xE1, 0x38, 0x42, 0x2E, 0x73, 0xE1, 0x34, 0xFF, 0xFC, 0x42,
-    0x61, 0x73, 0xFF, 0xF9, 0xE1, 0xD0, 0x24, 0x69, 0x6F, 0x65, 0x74, 0xC9, 0xD7, 0xE9, 0xF9, 0x43,
-    0x6C, 0x72, 0x73, 0xFF, 0x8D, 0xFF, 0xB2, 0xFF, 0xF7, 0xDB, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64,
-    0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A,
-    0x6C, 0x72, 0x75, 0x65, 0x61, 0x69, 0x6F, 0xDF, 0x00, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xDF,
-    0x03, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xEE, 0xD9, 0xDF, 0x03, 0xDF,
-    0x03, 0xFD, 0xA1, 0xFD, 0xAA, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xFD,
-    0xC1, 0xFE, 0x17, 0xFE, 0x66, 0xFE, 0x95, 0xFF, 0x08, 0xFF, 0x13, 0xFF, 0xF6, 0x42, 0x6D, 0x72,
-    0xDF, 0x3C, 0xEA, 0x76, 0x42, 0x65, 0x69, 0xFC, 0xC6, 0xFF, 0xF9, 0xD7, 0x00, 0x41, 0x2E, 0x62,
-    0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76,
-    0x77, 0x78, 0x79, 0x7A, 0x75, 0xDE, 0x9E, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE,
-    0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE,
-    0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE,
-    0xA1, 0xFF, 0xF9, 0xC2, 0x00, 0x71, 0x6E, 0x61, 0xDE, 0x5C, 0xEE, 0xD0, 0x41, 0xA1, 0xF0, 0xDB,
-    0x43, 0x61, 0xC3, 0x65, 0xF0, 0xD7, 0xFF, 0xFC, 0xF0, 0xD7, 0x21, 0x69, 0xF6, 0x21, 0x63, 0xFD,
-    0xA0, 0x0A, 0x72, 0x21, 0x61, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0xAD, 0xFD, 0x22,
-    0x69, 0xC3, 0xEE, 0xFD, 0x21, 0x6E, 0xFB, 0x42, 0x65, 0x72, 0xE2, 0x3D, 0xE9, 0xEC, 0x22, 0x69,
-    0x74, 0xF6, 0xF9, 0xA0, 0x0B, 0xB1, 0x23, 0xA1, 0xA9, 0xAD, 0xFD, 0xFD, 0xFD, 0x24, 0x61, 0xC3,
-    0x65, 0x6F, 0xF6, 0xF9, 0xF6, 0xF6, 0x43, 0x64, 0x6E, 0x72, 0xF5, 0xFA, 0xED, 0xB7, 0xFF, 0xF7,
-    0x41, 0x6D, 0xEF, 0xA6, 0xD9, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B,
-    0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x72, 0x65, 0x61, 0x6F,
-    0xDD, 0xF5, 0xDD, 0xF8, 0xDD, 0xFE, 0xDD, 0xF8, 0xDE, 0x07, 0xDE, 0x0C, 0xDD, 0xF8, 0xDD, 0xF8,
-    0xDD, 0xF8, 0xDD, 0xF8, 0xFF, 0x9F, 0xDD, 0xF8, 0xDE, 0x11, 0xDD, 0xF8, 0xDD, 0xF8, 0xDE, 0x1A,
-    0xDD, 0xF8, 0xDD, 0xF8, 0xDD, 0xF8, 0xDD, 0xF8, 0xDD, 0xF8, 0xDE, 0x24, 0xFF, 0xDA, 0xFF, 0xF2,
-    0xFF, 0xFC, 0xC4, 0x00, 0x71, 0x74, 0x73, 0x6E, 0x61, 0xDD, 0xAD, 0xDD, 0xAD, 0xDD, 0xAD, 0xEE,
-    0x21, 0xA0, 0x00, 0xD1, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73, 0xFA, 0xFD, 0xA0, 0x03, 0x02, 0x21,
-    0x2E, 0xFD, 0x21, 0x73, 0xFD, 0x22, 0x2E, 0x65, 0xEC, 0xFD, 0x21, 0x6C, 0xFB, 0x22, 0x2E, 0x73,
-    0xEF, 0xF2, 0x21, 0x6E, 0xED, 0x21, 0xB3, 0xFD, 0x21, 0x65, 0xEA, 0x21, 0x6E, 0xFD, 0x23, 0x61,
-    0xC3, 0x6F, 0xEF, 0xF7, 0xFD, 0x21, 0x6C, 0xF9, 0x21, 0x6C, 0xFD, 0x21, 0x73, 0xC9, 0x23, 0x2E,
-    0x61, 0x65, 0xC3, 0xC9, 0xFD, 0x21, 0x72, 0xF9, 0xC6, 0x00, 0x71, 0x7A, 0x73, 0x65, 0x61, 0x69,
-    0x6F, 0xDD, 0x57, 0xDD, 0x57, 0xFF, 0xBF, 0xFF, 0xD2, 0xFF, 0xF0, 0xFF, 0xFD, 0x41, 0x74, 0xDF,
-    0xF2, 0x21, 0x63, 0xFC, 0x41, 0x76, 0xDE, 0x67, 0x44, 0x6E, 0x2E, 0x73, 0x6C, 0xFF, 0xF9, 0xF5,
-    0xEC, 0xF5, 0xEF, 0xFF, 0xFC, 0x41, 0x65, 0xFA, 0x22, 0x41, 0x76, 0xE8, 0xEA, 0xA0, 0x0E, 0xD2,
-    0xA0, 0x0E, 0xF3, 0xA0, 0x0F, 0x23, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0x27, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xEC, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF5,
-    0x21, 0x6F, 0xF1, 0x21, 0x64, 0xFD, 0x44, 0x6C, 0x6D, 0x72, 0x75, 0xFF, 0xCF, 0xFA, 0x44, 0xFF,
-    0xD3, 0xFF, 0xFD, 0xA0, 0x0F, 0x52, 0xA1, 0x0F, 0x52, 0x73, 0xFD, 0x21, 0x61, 0xFB, 0xA1, 0x04,
-    0x52, 0x73, 0xFD, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xDD, 0xE5, 0xFF, 0xFB, 0xDD,
-    0xE8, 0xDD, 0xE8, 0xDD, 0xE8, 0xDD, 0xE8, 0xDD, 0xEE, 0x21, 0x65, 0xEA, 0x21, 0x72, 0xFD, 0x42,
-    0x62, 0x63, 0xFF, 0xFD, 0xF4, 0xB1, 0xA0, 0x0F, 0xF3, 0xA1, 0x06, 0xF3, 0x72, 0xFD, 0x41, 0x72,
-    0xF9, 0xC6, 0xA1, 0x06, 0xF3, 0x6F, 0xFC, 0xA0, 0x10, 0x23, 0x41, 0x2E, 0xF7, 0x64, 0x42, 0x2E,
-    0x73, 0xF7, 0x60, 0xFF, 0xFC, 0x21, 0x74, 0xF9, 0x21, 0x69, 0xFD, 0xA2, 0x07, 0x23, 0x72, 0x76,
-    0xEC, 0xFD, 0x45, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFF, 0xF9, 0xEE, 0x03, 0xEE, 0x03, 0xEE, 0x03,
-    0xEE, 0x03, 0x48, 0x72, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xE1, 0x50, 0xE1, 0x27, 0xFF,
-    0xC7, 0xED, 0xF0, 0xFF, 0xD0, 0xED, 0xF0, 0xED, 0xF0, 0xFF, 0xF0, 0x21, 0x72, 0xE7, 0xC7, 0x07,
-    0xB1, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xDD, 0x6A, 0xDD, 0x6D, 0xDD, 0x6D, 0xDD, 0x6D,
-    0xDD, 0x6D, 0xDD, 0x6D, 0xDD, 0x73, 0x21, 0x61, 0xE8, 0x22, 0x65, 0x72, 0xE2, 0xFD, 0xA0, 0x11,
-    0x43, 0x21, 0x6E, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x72, 0xFD,
-    0x21, 0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0x61, 0xFD, 0x23, 0x70, 0x64, 0x72, 0xE0, 0xFD, 0xFD,
-    0xDA, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70,
-    0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0x65, 0x6F, 0x75, 0xDC, 0x19, 0xDC,
-    0x1C, 0xDC, 0x22, 0xDC, 0x1C, 0xDC, 0x2B, 0xDC, 0x30, 0xDC, 0x1C, 0xDC, 0x1C, 0xDC, 0x1C, 0xDC,
-    0x1C, 0xDC, 0x30, 0xDC, 0x1C, 0xFE, 0x72, 0xDC, 0x1C, 0xDC, 0x1C, 0xDC, 0x1C, 0xFE, 0xC8, 0xDC,
-    0x1C, 0xDC, 0x1C, 0xDC, 0x1C, 0xDC, 0x1C, 0xDC, 0x1C, 0xFE, 0xE8, 0xFF, 0x26, 0xFF, 0x5F, 0xFF,
-    0xF9, 0x41, 0x65, 0xE1, 0x23, 0x41, 0x6E, 0xDF, 0x92, 0x21, 0x69, 0xFC, 0x22, 0x74, 0x64, 0xF5,
-    0xFD, 0x41, 0x6C, 0xDF, 0x86, 0x21, 0x65, 0xFC, 0x21, 0x75, 0xFD, 0x41, 0x62, 0xDF, 0x7C, 0x21,
-    0x6F, 0xFC, 0x41, 0x72, 0xDF, 0x75, 0x21, 0x61, 0xFC, 0x43, 0x63, 0x70, 0x74, 0xFF, 0xF6, 0xDF,
-    0x6E, 0xFF, 0xFD, 0x41, 0xA1, 0xDF, 0x8F, 0x21, 0xC3, 0xFC, 0x21, 0x6C, 0xFD, 0x24, 0x6E, 0x62,
-    0x6C, 0x74, 0xCF, 0xDB, 0xEC, 0xFD, 0x21, 0xA1, 0xBF, 0x21, 0xC3, 0xFD, 0x21, 0x65, 0xFD, 0x21,
-    0x63, 0xFD, 0x41, 0x2E, 0xE4, 0xB3, 0x42, 0x2E, 0x73, 0xE4, 0xAF, 0xFF, 0xFC, 0x22, 0x6F, 0x61,
-    0xF9, 0xF9, 0x21, 0x72, 0xFB, 0x23, 0x61, 0x6F, 0x65, 0xD8, 0xEA, 0xFD, 0x41, 0x73, 0xDE, 0x49,
-    0x21, 0x61, 0xFC, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x41, 0x64, 0xE0, 0x00, 0x41, 0x6C, 0xDF,
-    0xFC, 0x41, 0x69, 0xE9, 0x65, 0x42, 0x63, 0x74, 0xDF, 0xF7, 0xFF, 0xFC, 0xA4, 0x0E, 0xB2, 0x6D,
-    0x6E, 0x74, 0x63, 0xEA, 0xED, 0xF1, 0xF9, 0x41, 0xBA, 0xE4, 0x87, 0x41, 0x75, 0xDF, 0xE5, 0xA2,
-    0x0E, 0xB2, 0xC3, 0x78, 0xF8, 0xFC, 0x41, 0x6E, 0xDF, 0xDA, 0x21, 0x61, 0xFC, 0x21, 0x69, 0xFD,
-    0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0xB3, 0xF0, 0x22, 0x6F, 0xC3, 0xED, 0xFD, 0x21, 0x69,
-    0xFB, 0x41, 0x2E, 0xDB, 0x9E, 0x42, 0x2E, 0x73, 0xDB, 0x9A, 0xFF, 0xFC, 0x22, 0x6F, 0x61, 0xF9,
-    0xF9, 0x41, 0xAD, 0xDF, 0xAF, 0x43, 0x69, 0xC3, 0x65, 0xDF, 0xAB, 0xFF, 0xFC, 0xDF, 0xAB, 0x41,
-    0xA1, 0xDF, 0xA1, 0x43, 0x61, 0xC3, 0x6F, 0xDF, 0x9D, 0xFF, 0xFC, 0xDF, 0x9D, 0x41, 0x61, 0xE4,
-    0x31, 0x21, 0x76, 0xFC, 0x41, 0x74, 0xDD, 0x80, 0x41, 0x69, 0xDF, 0x88, 0xA1, 0x0E, 0x92, 0x72,
-    0xFC, 0x41, 0x76, 0xDF, 0x7F, 0x45, 0x61, 0xC3, 0x65, 0x6F, 0x69, 0xDF, 0x7B, 0xDF, 0xF0, 0xDF,
-    0x7B, 0xFF, 0xF7, 0xFF, 0xFC, 0xC8, 0x0E, 0xB2, 0x62, 0x63, 0x64, 0x67, 0x6A, 0x6C, 0x73, 0x74,
-    0xFF, 0x9E, 0xFF, 0xA9, 0xFF, 0xB7, 0xFF, 0xC0, 0xFF, 0xCE, 0xFF, 0xDC, 0xFF, 0xDF, 0xFF, 0xF0,
-    0x41, 0x65, 0xDF, 0x49, 0x41, 0x69, 0xDD, 0x81, 0x21, 0x63, 0xFC, 0x21, 0x61, 0xFD, 0xA2, 0x0E,
-    0xB2, 0x63, 0x72, 0xF2, 0xFD, 0xC3, 0x0E, 0xB2, 0x72, 0x62, 0x73, 0xDF, 0x34, 0xE1, 0xB9, 0xE0,
-    0xFB, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xDF, 0x28, 0xFF, 0x3B, 0xFF, 0x4E, 0xFF,
-    0xC4, 0xFF, 0xED, 0xFF, 0xF4, 0xE5, 0xE3, 0x21, 0x73, 0xEA, 0x42, 0x73, 0x6E, 0xFE, 0xFB, 0xFF,
-    0xFD, 0x41, 0x70, 0xE6, 0x22, 0xD8, 0x00, 0x91, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A,
-    0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0x6F,
-    0xDA, 0x54, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80,
-    0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80,
-    0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xFF, 0xF5, 0xFF, 0xFC,
-    0x41, 0x68, 0xEC, 0xA2, 0x21, 0x63, 0xFC, 0xC2, 0x01, 0xF2, 0x2E, 0x73, 0xDA, 0x02, 0xFF, 0xFD,
-    0xC1, 0x01, 0xF2, 0x2E, 0xD9, 0xF9, 0xA0, 0x01, 0xF2, 0x42, 0x61, 0x72, 0xF6, 0xB8, 0xDB, 0x22,
-    0x41, 0x65, 0xDE, 0x04, 0x42, 0x61, 0x6D, 0xDE, 0x00, 0xE5, 0xAF, 0x44, 0x74, 0x6C, 0x63, 0x72,
-    0xFF, 0xEE, 0xFF, 0xF5, 0xEA, 0x58, 0xFF, 0xF9, 0x41, 0x75, 0xEC, 0x56, 0x41, 0x6F, 0xEC, 0x52,
-    0x22, 0x71, 0x63, 0xF8, 0xFC, 0x21, 0x6F, 0xFB, 0x41, 0x6C, 0xEA, 0x9C, 0x41, 0x70, 0xEB, 0x6A,
-    0x41, 0x62, 0xE5, 0x83, 0x21, 0x72, 0xFC, 0x41, 0x63, 0xDA, 0x91, 0x21, 0x69, 0xFC, 0x21, 0x6E,
-    0xFD, 0x21, 0x63, 0xFD, 0x21, 0xA9, 0xFD, 0xDC, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67,
-    0x68, 0x6A, 0x6B, 0x6D, 0x6E, 0x70, 0x71, 0x74, 0x76, 0x77, 0x79, 0x72, 0x7A, 0x73, 0x6C, 0x78,
-    0x65, 0x69, 0x61, 0x6F, 0x75, 0xC3, 0xD9, 0xA2, 0xD9, 0xA5, 0xD9, 0xAB, 0xD9, 0xA5, 0xD9, 0xB4,
-    0xD9, 0xB9, 0xD9, 0xA5, 0xD9, 0xA5, 0xD9, 0xA5, 0xD9, 0xB9, 0xD9, 0xA5, 0xD9, 0xBE, 0xD9, 0xA5,
-    0xD9, 0xC7, 0xD9, 0xA5, 0xD9, 0xA5, 0xD9, 0xA5, 0xFF, 0x4E, 0xFF, 0xA0, 0xFF, 0xA9, 0xFF, 0xAF,
-    0xFF, 0xAF, 0xFF, 0xC4, 0xFF, 0xDE, 0xFF, 0xE1, 0xFF, 0xE5, 0xFF, 0xED, 0xFF, 0xFD, 0x42, 0x63,
-    0x64, 0xFF, 0x62, 0xF8, 0xFA, 0xD7, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A,
-    0x6B, 0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x6C, 0x72, 0x69, 0xD9,
-    0x44, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9,
-    0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9,
-    0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x73, 0xD9, 0x73, 0xFF, 0xF9, 0x41, 0x73, 0xFE,
-    0xF3, 0xD7, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
-    0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0xD8, 0xF8, 0xD8, 0xFB, 0xD8,
-    0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8,
-    0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8,
-    0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xFF, 0xFC, 0x42, 0x6E, 0x72, 0xEA, 0x5D, 0xEA, 0x5D,
-    0xD8, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70,
-    0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x65, 0x69, 0xD8, 0xA9, 0xD8, 0xAC, 0xD8,
-    0xB2, 0xD8, 0xAC, 0xD8, 0xBB, 0xD8, 0xC0, 0xD8, 0xAC, 0xD8, 0xAC, 0xD8, 0xAC, 0xD8, 0xAC, 0xD8,
-    0xC0, 0xD8, 0xAC, 0xD8, 0xC5, 0xD8, 0xAC, 0xD8, 0xAC, 0xD8, 0xAC, 0xD8, 0xCE, 0xD8, 0xAC, 0xD8,
-    0xAC, 0xD8, 0xAC, 0xD8, 0xAC, 0xD8, 0xAC, 0xFF, 0xF9, 0xF4, 0x61, 0xD6, 0x00, 0x41, 0x2E, 0x62,
-    0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76,
-    0x77, 0x78, 0x79, 0x7A, 0xD8, 0x5E, 0xD8, 0x61, 0xD8, 0x67, 0xD8, 0x61, 0xD8, 0x70, 0xD8, 0x75,
-    0xD8, 0x61, 0xD8, 0x61, 0xD8, 0x61, 0xD8, 0x61, 0xD8, 0x75, 0xD8, 0x61, 0xD8, 0x7A, 0xD8, 0x61,
-    0xD8, 0x61, 0xD8, 0x61, 0xD8, 0x83, 0xD8, 0x61, 0xD8, 0x61, 0xD8, 0x61, 0xD8, 0x61, 0xD8, 0x61,
-    0x41, 0x6F, 0xF1, 0x80, 0xD7, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B,
-    0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x6F, 0xD8, 0x15,
-    0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18,
-    0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18,
-    0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xFF, 0xFC, 0xC1, 0x00, 0x41, 0x2E,
-    0xD7, 0xCD, 0x41, 0x73, 0xE8, 0xC1, 0xA0, 0x02, 0x82, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73, 0xFA,
-    0xFD, 0x43, 0x65, 0x6F, 0x61, 0xF4, 0x80, 0xF4, 0x80, 0xFF, 0xFB, 0x21, 0x6C, 0xF6, 0x21, 0x65,
-    0xFD, 0x43, 0x65, 0x6F, 0x61, 0xF4, 0x70, 0xF4, 0x70, 0xF4, 0x70, 0x21, 0x6C, 0xF6, 0x21, 0x65,
-    0xFD, 0x21, 0x73, 0xFA, 0x21, 0x6F, 0xFD, 0xA0, 0x02, 0xD2, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73,
-    0xFA, 0xFD, 0x22, 0x6F, 0x61, 0xFB, 0xFB, 0x21, 0x63, 0xFB, 0x21, 0x69, 0xFD, 0x25, 0x6D, 0x74,
-    0x73, 0x6E, 0x72, 0xD1, 0xD1, 0xE1, 0xE7, 0xFD, 0x23, 0x65, 0x6F, 0x61, 0xE5, 0xE5, 0xE5, 0x21,
-    0x6C, 0xF9, 0x21, 0x73, 0xFD, 0x25, 0x6D, 0x74, 0x73, 0x6E, 0x6F, 0xB9, 0xB9, 0xC9, 0xCF, 0xFD,
-    0x46, 0x73, 0x69, 0x2E, 0x64, 0x6F, 0x72, 0xD7, 0x59, 0xFF, 0x92, 0xD7, 0x59, 0xFF, 0xDD, 0xFF,
-    0xC1, 0xFF, 0xF5, 0x41, 0x73, 0xFF, 0x86, 0x21, 0x6F, 0xFC, 0x45, 0x2E, 0x73, 0x6D, 0x69, 0x6E,
-    0xD7, 0x3F, 0xE8, 0x39, 0xFF, 0xFD, 0xFF, 0x78, 0xE8, 0x39, 0xA0, 0x02, 0xA3, 0x21, 0x2E, 0xFD,
-    0x23, 0x2E, 0x73, 0x69, 0xFA, 0xFD, 0xE3, 0x42, 0x6F, 0x61, 0xF3, 0xEA, 0xF3, 0xEA, 0x21, 0x63,
-    0xF9, 0x43, 0x65, 0x61, 0x69, 0xFF, 0xEF, 0xF3, 0xE0, 0xFF, 0xFD, 0x41, 0x6F, 0xF3, 0xD6, 0x22,
-    0x74, 0x6D, 0xF2, 0xFC, 0x41, 0x73, 0xFF, 0x76, 0x21, 0x65, 0xFC, 0x21, 0x6F, 0xF9, 0x41, 0x65,
-    0xFF, 0x6F, 0x21, 0x6C, 0xFC, 0x47, 0x61, 0x2E, 0x73, 0x74, 0x6D, 0x64, 0x62, 0xFF, 0xB5, 0xD6,
-    0xF4, 0xFF, 0xEA, 0xFF, 0xF3, 0xFF, 0xF6, 0xFF, 0x6D, 0xFF, 0xFD, 0x21, 0x6D, 0xE0, 0x42, 0x2E,
-    0x65, 0xD6, 0xDB, 0xFF, 0xFD, 0x21, 0x61, 0xF6, 0xA0, 0x02, 0xA2, 0x42, 0x2E, 0x73, 0xFF, 0xFD,
-    0xFF, 0xA2, 0x42, 0x2E, 0x73, 0xFF, 0x98, 0xFF, 0x9B, 0x23, 0x65, 0x6F, 0x61, 0xF2, 0xF2, 0xF9,
-    0x21, 0x6C, 0xF9, 0x21, 0x65, 0xFD, 0x23, 0x65, 0x6F, 0x61, 0xEC, 0xEC, 0xEC, 0x21, 0x6C, 0xF9,
-    0x21, 0x65, 0xFD, 0x21, 0x73, 0xFA, 0x21, 0x6F, 0xFD, 0x47, 0x61, 0x65, 0x6D, 0x74, 0x73, 0x6E,
-    0x6F, 0xFF, 0xC2, 0xFF, 0xC2, 0xFF, 0xEA, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFD, 0xFF, 0x08, 0x44,
-    0x6D, 0x74, 0x73, 0x6E, 0xFE, 0xDF, 0xFE, 0xDF, 0xFE, 0xEF, 0xFE, 0xF5, 0x41, 0x6F, 0xFE, 0xB6,
-    0x43, 0x6F, 0x61, 0x65, 0xF3, 0x41, 0xF3, 0x41, 0xF3, 0x41, 0x42, 0x2E, 0x6C, 0xD6, 0x6F, 0xFF,
-    0xF6, 0x21, 0x65, 0xF9, 0x41, 0x65, 0xE7, 0x5F, 0x44, 0x2E, 0x6D, 0x6C, 0x6E, 0xD6, 0x61, 0xFF,
-    0xFC, 0xFF, 0xE8, 0xFF, 0xE4, 0x21, 0x65, 0xF3, 0x46, 0x6C, 0x6E, 0x6F, 0x6D, 0x74, 0x73, 0xFE,
-    0xA9, 0xFF, 0xD4, 0xFE, 0x8A, 0xFF, 0xE9, 0xFF, 0xFD, 0xFF, 0xFD, 0x21, 0x6F, 0xED, 0x21, 0x64,
-    0xFD, 0x47, 0x73, 0x69, 0x62, 0x72, 0x64, 0x6F, 0x6E, 0xFF, 0x5D, 0xFE, 0x71, 0xFF, 0x64, 0xFF,
-    0x98, 0xFF, 0xAE, 0xFE, 0xA0, 0xFF, 0xFD, 0x41, 0x67, 0xFE, 0x9B, 0x21, 0x6F, 0xFC, 0x41, 0x63,
-    0xD6, 0x1E, 0x21, 0x69, 0xFC, 0x41, 0x65, 0xFF, 0x06, 0x21, 0x74, 0xFC, 0x45, 0x2E, 0x6C, 0x74,
-    0x6E, 0x73, 0xD6, 0x0D, 0xFF, 0xEF, 0xFF, 0xF6, 0xE7, 0x07, 0xFF, 0xFD, 0x45, 0xB1, 0xA9, 0xAD,
-    0xA1, 0xB3, 0xFE, 0x30, 0xFE, 0xA4, 0xFF, 0x09, 0xFF, 0xC5, 0xFF, 0xF0, 0xA0, 0x01, 0x72, 0xA0,
-    0x01, 0x92, 0x21, 0xB3, 0xFD, 0x22, 0x75, 0xC3, 0xF7, 0xFD, 0x21, 0x65, 0xF2, 0xA0, 0x02, 0x62,
-    0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73, 0xFA, 0xFD, 0x21, 0x6F, 0xFB, 0x21, 0x65, 0xF5, 0x21, 0x74,
-    0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x23, 0x2E, 0x73, 0x6D, 0xE6, 0xE9, 0xFD, 0x22, 0x6F,
-    0x61, 0xE5, 0xF9, 0x21, 0x63, 0xFB, 0x21, 0x69, 0xFD, 0x21, 0x67, 0xFD, 0x21, 0xB3, 0xFD, 0x21,
-    0x61, 0xD4, 0x21, 0xAD, 0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x67, 0xFD, 0x41, 0x67, 0xE1, 0x68, 0x23,
-    0xC3, 0x6F, 0x69, 0xED, 0xF9, 0xFC, 0xA0, 0x00, 0xC2, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73, 0xFA,
-    0xFD, 0x21, 0x65, 0xF8, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x23, 0x2E, 0x73,
-    0x6D, 0xE9, 0xEC, 0xFD, 0x44, 0x2E, 0x6F, 0x61, 0x74, 0xD5, 0x78, 0xFF, 0xE8, 0xFF, 0xF9, 0xF5,
-    0x24, 0x42, 0x6F, 0x61, 0xD9, 0x83, 0xD9, 0x83, 0x21, 0x74, 0xF9, 0x41, 0x6E, 0xF2, 0xAF, 0x43,
-    0x63, 0x74, 0x65, 0xE7, 0x07, 0xE7, 0x07, 0xFD, 0x93, 0x41, 0x74, 0xE6, 0xFD, 0x41, 0x69, 0xE5,
-    0x70, 0x41, 0x61, 0xD6, 0xF0, 0x21, 0xAD, 0xFC, 0x21, 0xC3, 0xFD, 0xA1, 0x04, 0xA2, 0x70, 0xFD,
-    0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xD9, 0x07, 0xD9, 0x43, 0xFF, 0xFB, 0xD9, 0x43,
-    0xD9, 0x43, 0xD9, 0x43, 0xD9, 0x49, 0x21, 0x6F, 0xEA, 0x22, 0x6E, 0x74, 0xD4, 0xFD, 0xA0, 0x00,
-    0x91, 0x21, 0x2E, 0xFD, 0x21, 0x73, 0xFD, 0xA0, 0x0F, 0x72, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73,
-    0xFA, 0xFD, 0x22, 0x6F, 0x61, 0xFB, 0xFB, 0xA0, 0x03, 0x32, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73,
-    0xFA, 0xFD, 0xA0, 0x10, 0xF3, 0x21, 0x2E, 0xFD, 0x23, 0x61, 0x2E, 0x73, 0xF5, 0xFA, 0xFD, 0x21,
-    0x73, 0xEB, 0x22, 0x2E, 0x65, 0xE5, 0xFD, 0x21, 0x6C, 0xFB, 0x22, 0x65, 0x61, 0xEE, 0xFD, 0x22,
-    0x63, 0x64, 0xD3, 0xFB, 0x4D, 0x65, 0x61, 0x2E, 0x78, 0x6C, 0x73, 0x63, 0x6D, 0x6E, 0x70, 0x72,
-    0x6F, 0x69, 0xFE, 0xF1, 0xFE, 0xF6, 0xD4, 0xD5, 0xFF, 0x04, 0xFF, 0x3B, 0xFF, 0x60, 0xFF, 0x74,
-    0xFF, 0x77, 0xFF, 0x7B, 0xFF, 0x85, 0xFF, 0xB5, 0xFF, 0xC0, 0xFF, 0xFB, 0x42, 0x65, 0xC3, 0xFE,
-    0xC0, 0xFE, 0xC6, 0xA0, 0x03, 0x23, 0x21, 0x2E, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x61, 0xFD, 0x21,
-    0x67, 0xFD, 0x43, 0x2E, 0x73, 0x69, 0xD4, 0x97, 0xE5, 0x91, 0xFC, 0xD0, 0x21, 0x65, 0xF6, 0x41,
-    0x73, 0xFE, 0xB1, 0x44, 0x2E, 0x73, 0x69, 0x6E, 0xFE, 0xAA, 0xFE, 0xAD, 0xFF, 0xFC, 0xFE, 0xAD,
-    0x43, 0x2E, 0x74, 0x65, 0xD4, 0x79, 0xFF, 0xEC, 0xFF, 0xF3, 0xA0, 0x0C, 0xF1, 0x21, 0x61, 0xFD,
-    0x21, 0x69, 0xFD, 0x21, 0x6C, 0xFD, 0xA0, 0x11, 0x22, 0x21, 0x6E, 0xFD, 0x21, 0x61, 0xFD, 0x21,
-    0x63, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x72, 0xFD, 0x23, 0x6F, 0x69, 0x65, 0xC7, 0xEB, 0xFD, 0x42,
-    0x6F, 0x72, 0xD4, 0x4A, 0xE0, 0x14, 0x45, 0x2E, 0x64, 0x66, 0x67, 0x74, 0xD4, 0x43, 0xFF, 0xF9,
-    0xF1, 0x94, 0xE5, 0xEC, 0xFA, 0x5A, 0x41, 0x65, 0xFC, 0x6C, 0x42, 0x6E, 0x73, 0xFE, 0x56, 0xFE,
-    0x56, 0x41, 0x6F, 0xFF, 0x9E, 0x41, 0x73, 0xFE, 0x48, 0x45, 0x2E, 0x73, 0x6D, 0x69, 0x6E, 0xFE,
-    0x44, 0xFE, 0x47, 0xFF, 0xF8, 0xFF, 0xFC, 0xFE, 0x47, 0x42, 0x61, 0x73, 0xFF, 0xF0, 0xFE, 0x37,
-    0x43, 0x2E, 0x73, 0x69, 0xFE, 0x2D, 0xFE, 0x30, 0xFF, 0x7F, 0x43, 0x73, 0x2E, 0x6E, 0xFE, 0x26,
-    0xFE, 0x23, 0xFE, 0x26, 0x23, 0xAD, 0xA9, 0xA1, 0xE5, 0xEC, 0xF6, 0x45, 0x6D, 0x2E, 0x73, 0x69,
-    0x6E, 0xFF, 0xC6, 0xFE, 0x12, 0xFE, 0x15, 0xFF, 0x64, 0xFE, 0x15, 0xA0, 0x03, 0x22, 0x21, 0x2E,
-    0xFD, 0x21, 0x65, 0xFD, 0x41, 0x65, 0xFF, 0x32, 0x42, 0x2E, 0x73, 0xFF, 0x2B, 0xFF, 0x2E, 0x23,
-    0x65, 0x61, 0x6F, 0xF9, 0xF9, 0xF9, 0x41, 0x73, 0xFF, 0x20, 0x21, 0x6F, 0xFC, 0x41, 0x68, 0xD7,
-    0xC2, 0xC2, 0x00, 0xD1, 0x2E, 0x73, 0xFD, 0xDC, 0xFD, 0xDF, 0x22, 0x6F, 0x61, 0xF7, 0xF7, 0x4C,
-    0x6F, 0xC3, 0x65, 0x61, 0x2E, 0x6D, 0x74, 0x6C, 0x73, 0x6E, 0x63, 0x69, 0xFF, 0x7B, 0xFF, 0xB5,
-    0xFF, 0xBC, 0xFF, 0x24, 0xD3, 0xAA, 0xFF, 0xD2, 0xFF, 0xD5, 0xFF, 0xE0, 0xFF, 0xD5, 0xFF, 0xEB,
-    0xFF, 0xEE, 0xFF, 0xFB, 0x41, 0x61, 0xFE, 0xFF, 0x43, 0x65, 0x6F, 0x61, 0xF0, 0x49, 0xF0, 0x49,
-    0xFB, 0xBA, 0x43, 0x2E, 0x61, 0x65, 0xFD, 0x9B, 0xFD, 0xA1, 0xFE, 0xED, 0x43, 0x2E, 0x73, 0x72,
-    0xFD, 0x91, 0xFD, 0x94, 0xFF, 0xF6, 0x48, 0x2E, 0x6D, 0x74, 0x6C, 0x6E, 0x6F, 0x61, 0x65, 0xD3,
-    0x63, 0xFC, 0xFE, 0xFC, 0xFE, 0xFF, 0xE2, 0xFC, 0xE6, 0xFF, 0xF6, 0xFD, 0x8D, 0xE3, 0xDD, 0xA0,
-    0x05, 0x41, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x41, 0x6E, 0xFD, 0x65, 0x21,
-    0xB3, 0xFC, 0x41, 0x65, 0xFE, 0xAD, 0x21, 0x6E, 0xFC, 0x22, 0xC3, 0x6F, 0xF6, 0xFD, 0x43, 0x74,
-    0x61, 0x69, 0xE4, 0xD8, 0xFF, 0xEA, 0xFF, 0xFB, 0x41, 0x72, 0xE4, 0xCE, 0x41, 0x64, 0xFE, 0xBA,
-    0x21, 0x61, 0xFC, 0x21, 0x6E, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x63, 0xFD, 0x42,
-    0x72, 0x69, 0xE4, 0xB7, 0xFF, 0xFD, 0x41, 0x69, 0xE2, 0xB7, 0x41, 0x74, 0xED, 0x7B, 0x43, 0x64,
-    0x73, 0x74, 0xEA, 0xF2, 0xFF, 0xFC, 0xE4, 0xA8, 0x41, 0x73, 0xEC, 0xE8, 0x42, 0x2E, 0x65, 0xD2,
-    0xF0, 0xFF, 0xFC, 0xA0, 0x08, 0xF1, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73, 0xFA, 0xFD, 0x21, 0x6F,
-    0xFB, 0x21, 0x73, 0xFD, 0x21, 0xAD, 0xFD, 0x53, 0x61, 0x69, 0x73, 0x2E, 0x6D, 0x6E, 0x74, 0x72,
-    0x62, 0x64, 0x6F, 0x63, 0x65, 0x66, 0x67, 0x70, 0x75, 0x6C, 0xC3, 0xFE, 0x25, 0xFE, 0x38, 0xFE,
-    0x59, 0xD2, 0xD2, 0xFE, 0x81, 0xFE, 0x8F, 0xFE, 0x9F, 0xFF, 0x28, 0xFF, 0x4D, 0xFF, 0x6F, 0xFB,
-    0x0B, 0xFF, 0xA7, 0xFF, 0xB1, 0xFF, 0xC8, 0xFF, 0xB1, 0xFF, 0xCF, 0xFF, 0xD7, 0xFF, 0xE5, 0xFF,
-    0xFD, 0xA0, 0x01, 0xB2, 0x21, 0xA1, 0xFD, 0x43, 0xC3, 0x65, 0x73, 0xFF, 0xFD, 0xD2, 0xF0, 0xE3,
-    0x8C, 0x41, 0x65, 0xEB, 0xDA, 0x21, 0x6C, 0xFC, 0x41, 0x65, 0xE4, 0xF6, 0x21, 0x72, 0xFC, 0x21,
-    0x65, 0xFD, 0x43, 0x2E, 0x63, 0x74, 0xD2, 0x77, 0xFF, 0xF3, 0xFF, 0xFD, 0x41, 0x61, 0xD2, 0x6D,
-    0x21, 0x63, 0xFC, 0x21, 0x6F, 0xFD, 0x41, 0x6F, 0xD5, 0x4C, 0x43, 0x6F, 0x62, 0x69, 0xFD, 0xD5,
-    0xFF, 0xF9, 0xFF, 0xFC, 0xA0, 0x01, 0xB1, 0x21, 0x72, 0xFD, 0x21, 0x62, 0xFD, 0x21, 0x65, 0xFD,
-    0x43, 0x65, 0x6F, 0x72, 0xEC, 0xC5, 0xD6, 0x64, 0xDE, 0x0C, 0x45, 0x2E, 0x68, 0x64, 0x65, 0x74,
-    0xD2, 0x3F, 0xFF, 0xF3, 0xE3, 0xEC, 0xEB, 0xCF, 0xFF, 0xF6, 0xA0, 0x04, 0x13, 0x21, 0x2E, 0xFD,
-    0x21, 0x73, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x6D, 0xFD, 0x42, 0x2E, 0x65, 0xFC, 0x44, 0xFF, 0xFD,
-    0xA0, 0x03, 0xC2, 0x21, 0x2E, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x61, 0xED, 0x22, 0x61, 0x65, 0xEA,
-    0xEA, 0x46, 0x73, 0x2E, 0x6E, 0x69, 0x62, 0x72, 0xFF, 0xE8, 0xFC, 0x2C, 0xFC, 0x2F, 0xFF, 0xF5,
-    0xFF, 0xF8, 0xFF, 0xFB, 0x45, 0x2E, 0x73, 0x6D, 0x69, 0x6E, 0xFC, 0x19, 0xFC, 0x1C, 0xFD, 0xCD,
-    0xFD, 0x6B, 0xFC, 0x1C, 0x42, 0x73, 0x61, 0xFC, 0x0C, 0xFF, 0xF0, 0x43, 0xA9, 0xA1, 0xAD, 0xFD,
-    0xD5, 0xFF, 0xD6, 0xFF, 0xF9, 0xA0, 0x02, 0xF3, 0x21, 0x2E, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x6F,
-    0xFD, 0x21, 0x6D, 0xFD, 0x43, 0x65, 0x61, 0x6F, 0xEE, 0x8D, 0xEE, 0x8D, 0xEE, 0x8D, 0x43, 0x2E,
-    0x73, 0x69, 0xFF, 0xA2, 0xFF, 0xA5, 0xFF, 0xA8, 0x21, 0x65, 0xF6, 0xA0, 0x03, 0xE3, 0x21, 0x2E,
-    0xFD, 0x21, 0x73, 0xFD, 0x24, 0x2E, 0x73, 0x69, 0x6E, 0xF7, 0xFA, 0xFD, 0xFA, 0x43, 0x2E, 0x74,
-    0x65, 0xFF, 0x83, 0xFF, 0xEB, 0xFF, 0xF7, 0x21, 0x6F, 0xEA, 0x41, 0x65, 0xFF, 0x7C, 0x21, 0x6E,
-    0xE0, 0x21, 0x73, 0xDA, 0x25, 0x2E, 0x73, 0x6D, 0x69, 0x6E, 0xD7, 0xDA, 0xF3, 0xFD, 0xDA, 0x22,
-    0x61, 0x73, 0xF5, 0xCF, 0x23, 0x2E, 0x73, 0x69, 0xC7, 0xCA, 0xCD, 0x23, 0x73, 0x2E, 0x6E, 0xC3,
-    0xC0, 0xC3, 0x23, 0xAD, 0xA9, 0xA1, 0xED, 0xF2, 0xF9, 0x45, 0x6D, 0x2E, 0x73, 0x69, 0x6E, 0xFF,
-    0xCE, 0xFF, 0xB2, 0xFF, 0xB5, 0xFF, 0xB8, 0xFF, 0xB5, 0x44, 0x6F, 0xC3, 0x65, 0x61, 0xFF, 0xC5,
-    0xFF, 0xE9, 0xFF, 0xF0, 0xFF, 0xAB, 0xA0, 0x10, 0x54, 0x21, 0x2E, 0xFD, 0x21, 0x65, 0xFD, 0x21,
-    0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x23, 0x2E, 0x73, 0x6D, 0xEE, 0xF1, 0xFD, 0x21,
-    0x65, 0xF9, 0x42, 0x61, 0x6C, 0xFF, 0x82, 0xFF, 0xFD, 0x42, 0x2E, 0x73, 0xFF, 0x72, 0xFF, 0x75,
-    0x43, 0x2E, 0x61, 0x65, 0xFF, 0x6B, 0xFF, 0xF9, 0xFF, 0x71, 0x43, 0x2E, 0x73, 0x72, 0xFF, 0x61,
-    0xFF, 0x64, 0xFF, 0xF6, 0x43, 0x2E, 0x6F, 0x61, 0xFE, 0xEC, 0xFF, 0xF6, 0xFF, 0xE5, 0x47, 0x73,
-    0x6D, 0x6E, 0x74, 0x72, 0x62, 0x64, 0xFF, 0x5F, 0xFF, 0x69, 0xFE, 0xE5, 0xFF, 0x6C, 0xFF, 0xAB,
-    0xFF, 0xD4, 0xFF, 0xF6, 0x42, 0x2E, 0x65, 0xFB, 0x09, 0xFC, 0x5B, 0x21, 0x64, 0xF9, 0x21, 0x61,
-    0xFD, 0x21, 0x64, 0xFD, 0x45, 0x2E, 0x65, 0x61, 0x6D, 0x69, 0xFA, 0xF9, 0xFC, 0x4B, 0xFA, 0xFF,
-    0xFB, 0x10, 0xFF, 0xFD, 0x21, 0x72, 0xF0, 0x21, 0x6F, 0xFD, 0x4B, 0xC3, 0x65, 0x2E, 0x6D, 0x74,
-    0x6C, 0x73, 0x6E, 0x6F, 0x61, 0x69, 0xFE, 0xE1, 0xFE, 0xF7, 0xD0, 0xBF, 0xFA, 0x5A, 0xFA, 0x5A,
-    0xFE, 0xFA, 0xFA, 0x5A, 0xFA, 0x42, 0xFC, 0x35, 0xFF, 0xC4, 0xFF, 0xFD, 0x46, 0x2E, 0x6D, 0x74,
-    0x6C, 0x6E, 0x72, 0xD0, 0x9D, 0xFA, 0x38, 0xFA, 0x38, 0xFD, 0x1C, 0xFA, 0x20, 0xFA, 0xCC, 0x41,
-    0x61, 0xE1, 0x84, 0x21, 0x6C, 0xFC, 0x21, 0x64, 0xFD, 0x41, 0x6F, 0xFB, 0x7E, 0x21, 0x74, 0xFC,
-    0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x69, 0xFD, 0x41, 0x2E, 0xE3, 0x46, 0x42, 0x2E, 0x73,
-    0xE3, 0x42, 0xFF, 0xFC, 0x22, 0x6F, 0x61, 0xF9, 0xF9, 0x21, 0x69, 0xFB, 0x23, 0x64, 0x6D, 0x63,
-    0xD7, 0xEA, 0xFD, 0xA0, 0x00, 0x81, 0x21, 0x6F, 0xFD, 0x21, 0x64, 0xFD, 0x21, 0x6E, 0xFD, 0x21,
-    0xA1, 0xFD, 0x42, 0x6F, 0x72, 0xD4, 0x62, 0xDC, 0x11, 0xA0, 0x11, 0x92, 0x21, 0x6C, 0xFD, 0x21,
-    0x61, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x61,
-    0xFD, 0x44, 0x61, 0x6F, 0x74, 0x75, 0xE0, 0xA2, 0xE9, 0x8F, 0xFF, 0xE1, 0xFF, 0xFD, 0x41, 0x6E,
-    0xE1, 0xC8, 0x42, 0x63, 0x72, 0xE1, 0xC4, 0xE1, 0xC4, 0x42, 0x6D, 0x72, 0xD9, 0x69, 0xD4, 0xC3,
-    0x41, 0x67, 0xD9, 0xBC, 0x42, 0x61, 0x6F, 0xD0, 0x9B, 0xD0, 0x9B, 0x43, 0x61, 0x65, 0x6F, 0xD0,
-    0x94, 0xD0, 0x94, 0xD0, 0x94, 0x21, 0x69, 0xF6, 0x44, 0x61, 0x69, 0x65, 0x6F, 0xD0, 0x87, 0xD0,
-    0x87, 0xD0, 0x87, 0xD0, 0x87, 0x44, 0x6A, 0x67, 0x6C, 0x6D, 0xFF, 0xDF, 0xD9, 0x97, 0xFF, 0xF0,
-    0xFF, 0xF3, 0x44, 0xA1, 0xA9, 0xB3, 0xAD, 0xFF, 0xC7, 0xFF, 0xCE, 0xD8, 0x5C, 0xFF, 0xF3, 0x41,
-    0x72, 0xDC, 0x2A, 0x21, 0x65, 0xFC, 0x41, 0x6D, 0xE2, 0x99, 0x21, 0x75, 0xFC, 0x41, 0x69, 0xD1,
-    0xE0, 0x44, 0x63, 0x67, 0x6C, 0x6D, 0xFF, 0xF2, 0xD9, 0x83, 0xFF, 0xF9, 0xFF, 0xFC, 0x41, 0x74,
-    0xD2, 0x2C, 0x21, 0xA9, 0xFC, 0x21, 0xC3, 0xFD, 0x41, 0x69, 0xD7, 0xE1, 0x21, 0x75, 0xFC, 0x43,
-    0x63, 0x67, 0x71, 0xD1, 0xB0, 0xFF, 0xF6, 0xFF, 0xFD, 0x43, 0x61, 0xC3, 0x6F, 0xD1, 0xA3, 0xD9,
-    0x2F, 0xD1, 0xA3, 0x41, 0xAD, 0xD1, 0x99, 0x43, 0x65, 0x69, 0xC3, 0xD1, 0x95, 0xD1, 0x95, 0xFF,
-    0xFC, 0x42, 0x69, 0x61, 0xD7, 0x0B, 0xD1, 0x8E, 0x44, 0xA1, 0xAD, 0xA9, 0xB3, 0xD1, 0x84, 0xD1,
-    0x84, 0xD1, 0x84, 0xD1, 0x84, 0x45, 0x61, 0xC3, 0x69, 0x65, 0x6F, 0xD1, 0x77, 0xFF, 0xF3, 0xD1,
-    0x77, 0xD1, 0x77, 0xD1, 0x77, 0x41, 0x6F, 0xD1, 0xE6, 0x25, 0x6A, 0x67, 0x6C, 0x6D, 0x74, 0xC0,
-    0xCE, 0xD8, 0xEC, 0xFC, 0x41, 0xB3, 0xD1, 0x58, 0x21, 0xC3, 0xFC, 0x21, 0x69, 0xFD, 0x41, 0x72,
-    0xFF, 0x7F, 0x41, 0xA9, 0xD1, 0x4D, 0x43, 0x63, 0x71, 0x73, 0xD1, 0x46, 0xD1, 0x46, 0xD6, 0x27,
-    0x22, 0xC3, 0x69, 0xF2, 0xF6, 0x41, 0x6D, 0xD1, 0xA5, 0x21, 0xA1, 0xFC, 0x22, 0x61, 0xC3, 0xF9,
-    0xFD, 0x41, 0x71, 0xD1, 0x2B, 0x21, 0x73, 0xFC, 0x41, 0x61, 0xD1, 0x35, 0x21, 0x6C, 0xFC, 0x47,
-    0x62, 0x6E, 0x63, 0x74, 0x67, 0x65, 0x70, 0xFF, 0xCC, 0xD8, 0xD5, 0xFF, 0xCF, 0xFF, 0xE1, 0xFF,
-    0xED, 0xFF, 0xF6, 0xFF, 0xFD, 0x43, 0x72, 0x74, 0x63, 0xD1, 0x07, 0xD1, 0x07, 0xD1, 0x07, 0x21,
-    0x61, 0xF6, 0x42, 0x62, 0x64, 0xD8, 0xB2, 0xFF, 0xFD, 0x41, 0x72, 0xD0, 0x12, 0xA0, 0x0D, 0xA1,
-    0x21, 0x69, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x6F, 0xFD, 0x48, 0xC3, 0x61, 0x65, 0x69, 0x6F, 0x75,
-    0x74, 0x70, 0xFE, 0xF9, 0xFF, 0x18, 0xFF, 0x36, 0xFF, 0x80, 0xFF, 0xC6, 0xFF, 0xE9, 0xFF, 0xF0,
-    0xFF, 0xFD, 0x41, 0x72, 0xFA, 0x54, 0x21, 0x74, 0xFC, 0x21, 0x63, 0xFD, 0x21, 0xA9, 0xFD, 0x22,
-    0x65, 0xC3, 0xFA, 0xFD, 0x4F, 0x6F, 0x73, 0x2E, 0x6D, 0x6E, 0x72, 0x64, 0x65, 0x61, 0xC3, 0x63,
-    0x74, 0x75, 0x78, 0x6C, 0xFC, 0x13, 0xFC, 0x2E, 0xCE, 0xA5, 0xFC, 0x46, 0xFC, 0x66, 0xFD, 0xE6,
-    0xFE, 0x08, 0xFE, 0x22, 0xFE, 0x48, 0xFE, 0x5B, 0xFE, 0x7D, 0xFE, 0x8A, 0xFE, 0x8E, 0xFF, 0xD5,
-    0xFF, 0xFB, 0x43, 0x2E, 0x73, 0x6D, 0xF8, 0x9B, 0xF8, 0x9E, 0xFA, 0x4F, 0xA0, 0x03, 0x53, 0x21,
-    0x2E, 0xFD, 0x22, 0x2E, 0x73, 0xFA, 0xFD, 0xA0, 0x03, 0x84, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73,
-    0xFA, 0xFD, 0x23, 0x65, 0x6F, 0x61, 0xF0, 0xF0, 0xFB, 0x22, 0x2E, 0x6C, 0xE3, 0xF9, 0x21, 0x65,
-    0xFB, 0x23, 0x65, 0x61, 0x6F, 0xE1, 0xE1, 0xE1, 0x23, 0x65, 0x6F, 0x61, 0xDA, 0xDA, 0xDA, 0x21,
-    0x6C, 0xF9, 0x24, 0x6D, 0x74, 0x6C, 0x65, 0xEC, 0xEC, 0xEF, 0xFD, 0x22, 0x2E, 0x6C, 0xC1, 0xED,
-    0x21, 0x73, 0xFB, 0x21, 0x6F, 0xFD, 0x23, 0x73, 0x6E, 0x6F, 0xEC, 0xFD, 0xFA, 0x21, 0x6F, 0xF9,
-    0x43, 0x73, 0x69, 0x6D, 0xF8, 0x40, 0xF9, 0x8F, 0xFF, 0xFD, 0x21, 0xA1, 0xF6, 0x43, 0x6F, 0x61,
-    0xC3, 0xF8, 0x33, 0xFF, 0x95, 0xFF, 0xFD, 0x41, 0x69, 0xF9, 0x78, 0x21, 0x74, 0xFC, 0x41, 0x73,
-    0xF8, 0xEC, 0x42, 0x2E, 0x65, 0xF8, 0xE5, 0xFF, 0xFC, 0x21, 0x6C, 0xF9, 0x43, 0x69, 0x61, 0x65,
-    0xFF, 0xEF, 0xFF, 0xFD, 0xF8, 0x1C, 0x41, 0x61, 0xEA, 0xAB, 0x42, 0x6F, 0x69, 0xCE, 0x5D, 0xCE,
-    0xBE, 0x21, 0x6D, 0xF9, 0x41, 0x69, 0xCE, 0xB4, 0x21, 0x6D, 0xFC, 0x21, 0xA1, 0xFD, 0x22, 0x61,
-    0xC3, 0xF3, 0xFD, 0x44, 0x6D, 0x74, 0x6C, 0x6F, 0xF6, 0xB8, 0xFF, 0xE3, 0xFF, 0xFB, 0xE7, 0x2D,
-    0xC3, 0x02, 0x91, 0x61, 0xC3, 0x65, 0xCF, 0xCC, 0xD7, 0x58, 0xCF, 0xCC, 0x21, 0x69, 0xF4, 0x21,
-    0x63, 0xFD, 0xC1, 0x05, 0x81, 0x61, 0xCE, 0x3D, 0x21, 0x69, 0xFA, 0x21, 0x63, 0xFD, 0x21, 0xAD,
-    0xFD, 0xA0, 0x02, 0xB1, 0x21, 0x74, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0xA9, 0xFD, 0x23, 0x62, 0x65,
-    0xC3, 0xF4, 0xFA, 0xFD, 0x21, 0x62, 0xED, 0x21, 0x6C, 0xEA, 0x21, 0x6D, 0xE7, 0x21, 0x69, 0xE7,
-    0x21, 0x70, 0xFD, 0x21, 0x73, 0xFD, 0x25, 0xAD, 0xA1, 0xA9, 0xBA, 0xB3, 0xEE, 0xF1, 0xE1, 0xF4,
-    0xFD, 0x22, 0x74, 0x69, 0xD0, 0xD0, 0x21, 0x6E, 0xCE, 0x21, 0x65, 0xFD, 0x22, 0x73, 0x72, 0xF5,
-    0xFD, 0x25, 0x69, 0xC3, 0x61, 0x65, 0x75, 0xCC, 0xE5, 0xD6, 0xFB, 0xD9, 0x41, 0x75, 0xEA, 0x4B,
-    0xA0, 0x0B, 0xE3, 0x22, 0x75, 0x74, 0xFD, 0xFD, 0x22, 0x73, 0x64, 0xFB, 0xF8, 0xA0, 0x0C, 0x63,
-    0x21, 0x72, 0xFD, 0xA0, 0x0C, 0x93, 0x21, 0x2E, 0xFD, 0x23, 0x6E, 0x6F, 0x6D, 0xEF, 0xF7, 0xFD,
-    0x41, 0x73, 0xEA, 0x44, 0x21, 0xA9, 0xFC, 0xA0, 0x0A, 0x12, 0x21, 0x72, 0xFD, 0x21, 0x61, 0xFD,
-    0x21, 0x73, 0xFD, 0xA0, 0x0C, 0x42, 0x21, 0x6F, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x67, 0xFD, 0x21,
-    0x65, 0xFD, 0x24, 0x69, 0xC3, 0x65, 0x72, 0xD7, 0xE2, 0xEE, 0xFD, 0x21, 0x72, 0xF7, 0x42, 0x65,
-    0x72, 0xFF, 0xFD, 0xCE, 0x2D, 0x41, 0x72, 0xFC, 0xB4, 0x21, 0x74, 0xFC, 0x21, 0x73, 0xFD, 0x21,
-    0x75, 0xFD, 0x41, 0x72, 0xCD, 0xC6, 0x21, 0x65, 0xFC, 0x21, 0x69, 0xFD, 0x21, 0x6E, 0xFD, 0x21,
-    0x65, 0xFD, 0x4A, 0x69, 0xC3, 0x68, 0x66, 0x6D, 0x74, 0x6F, 0x61, 0x64, 0x67, 0xFF, 0x2D, 0xFF,
-    0x3C, 0xFF, 0x7F, 0xFD, 0xF7, 0xFF, 0x8A, 0xFF, 0xDC, 0xE9, 0x9F, 0xE9, 0x9F, 0xFF, 0xED, 0xFF,
-    0xFD, 0x41, 0x65, 0xD8, 0x86, 0x43, 0x6E, 0x2E, 0x73, 0xD8, 0x7E, 0xF7, 0x21, 0xF7, 0x24, 0x42,
-    0x6F, 0x61, 0xFF, 0xF6, 0xF7, 0x1D, 0x42, 0x2E, 0x73, 0xF8, 0xC5, 0xF8, 0xC8, 0x22, 0x6F, 0x61,
-    0xF9, 0xF9, 0x41, 0x2E, 0xEE, 0x81, 0x21, 0x73, 0xFC, 0x21, 0x65, 0xFD, 0x44, 0x6E, 0x72, 0x2E,
-    0x73, 0xFF, 0xF1, 0xFF, 0xFD, 0xF7, 0x72, 0xF7, 0x75, 0x41, 0x61, 0xDE, 0x29, 0x41, 0x72, 0xF8,
-    0xA1, 0x42, 0x2E, 0x73, 0xF7, 0x5D, 0xF7, 0x60, 0x4A, 0x67, 0x64, 0x73, 0x6E, 0x62, 0x63, 0x61,
-    0x74, 0x65, 0x6F, 0xFE, 0x65, 0xFE, 0x84, 0xFE, 0xAB, 0xFF, 0x9A, 0xFF, 0xB9, 0xFF, 0xC7, 0xFF,
-    0xE4, 0xFF, 0xF1, 0xFF, 0xF5, 0xFF, 0xF9, 0x41, 0x69, 0xFB, 0xFC, 0x21, 0x72, 0xFC, 0x21, 0x65,
-    0xFD, 0x41, 0x74, 0xFD, 0x68, 0xA0, 0x11, 0xB2, 0x42, 0x64, 0x74, 0xFF, 0xFD, 0xFC, 0x01, 0x21,
-    0x69, 0xF9, 0x21, 0x73, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x76, 0xFD, 0x21, 0x69,
-    0xFD, 0x23, 0x74, 0x6C, 0x6E, 0xDD, 0xE0, 0xFD, 0x5C, 0x62, 0x2E, 0x63, 0x64, 0x66, 0x67, 0x68,
-    0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xC3,
-    0x6F, 0x61, 0x65, 0x69, 0x75, 0xCD, 0x5C, 0xDB, 0x8C, 0xDD, 0xF1, 0xE3, 0xC6, 0xE4, 0x43, 0xE5,
-    0xC4, 0xE7, 0x42, 0xE7, 0x94, 0xE7, 0xDD, 0xE8, 0x9B, 0xE9, 0xD6, 0xEA, 0x67, 0xED, 0x21, 0xED,
-    0x83, 0xEE, 0x2C, 0xF0, 0x08, 0xF2, 0x7F, 0xF2, 0xDD, 0xF3, 0x29, 0xF3, 0x78, 0xF3, 0xC3, 0xF4,
-    0x0C, 0xF6, 0x24, 0xF7, 0x4C, 0xF9, 0x4F, 0xFD, 0x7C, 0xFF, 0xB0, 0xFF, 0xF9,
+    0x78, 0x79, 0x7A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6C, 0x08, 0x97, 0x06, 0x71, 0x2E,
+    0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73,
+    0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
+    0x27, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x75, 0xAD,
+    0xBE, 0x01, 0x66, 0x0C, 0x80, 0x0B, 0x52, 0x01, 0x61, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x72, 0x7D,
+    0x01, 0xA1, 0x7D, 0x04, 0x6E, 0x70, 0x74, 0xC3, 0x6E, 0x08, 0x08, 0x7D, 0x96, 0x00, 0x11, 0x2E,
+    0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74,
+    0x76, 0x77, 0x78, 0x79, 0x7A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x61, 0x3E, 0x01, 0xAD,
+    0x7D, 0x01, 0xC3, 0x7D, 0x01, 0x67, 0x7D, 0x99, 0x06, 0x71, 0x2E, 0x62, 0x63, 0x64, 0x65, 0x66,
+    0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77,
+    0x78, 0x79, 0x7A, 0x04, 0x00, 0x1E, 0x00, 0xBF, 0xA6, 0x1F, 0x10, 0x00, 0xBF, 0xBC, 0x00, 0x00,
+    0xBF, 0xC5, 0x10, 0x00, 0x7D, 0x26, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x06, 0x52, 0x8C, 0x04, 0x71, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6D, 0x70, 0x71, 0x73, 0x74,
+    0x76, 0x02, 0x02, 0x02, 0x02, 0x02, 0x7D, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x61, 0xBE,
+    0x5A, 0x01, 0x65, 0x7C, 0x01, 0x74, 0x7D, 0x04, 0x63, 0x6C, 0x6E, 0x78, 0x2D, 0xBF, 0xDB, 0x7D,
+    0xAC, 0xF0, 0x01, 0x65, 0x0D, 0x01, 0x6C, 0x7D, 0x01, 0x62, 0x7D, 0x08, 0x61, 0x65, 0x68, 0x69,
+    0x6C, 0x6F, 0x75, 0xC3, 0x07, 0x07, 0x11, 0x07, 0x2F, 0x07, 0x07, 0xA5, 0x29, 0x01, 0x61, 0x6E,
+    0x01, 0x61, 0xBD, 0xE6, 0x01, 0x2E, 0x2E, 0x01, 0x65, 0x7D, 0x01, 0x74, 0x7D, 0x07, 0x61, 0x67,
+    0x6C, 0x6E, 0x6F, 0x73, 0x74, 0xBF, 0xDB, 0x70, 0x73, 0x7D, 0x1C, 0x08, 0xB6, 0xB2, 0x01, 0x72,
+    0x15, 0x01, 0x61, 0x7D, 0x01, 0x69, 0x7D, 0x80, 0x0A, 0x32, 0x01, 0x72, 0x7D, 0x01, 0x75, 0x7D,
+    0x81, 0x03, 0x52, 0x74, 0x7D, 0x07, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x7B, 0x07, 0x11,
+    0x07, 0x07, 0x07, 0xA4, 0xDF, 0x01, 0x69, 0x70, 0x01, 0x69, 0x32, 0x04, 0x63, 0x6C, 0x6E, 0x72,
+    0x2D, 0xBF, 0xD9, 0x7A, 0x7D, 0x03, 0x6E, 0x72, 0x74, 0x08, 0xBE, 0xCC, 0x08, 0x01, 0x74, 0xA4,
+    0xAE, 0x01, 0x6C, 0x7C, 0x9B, 0x06, 0x71, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7A, 0x04, 0xBF, 0x73, 0x00, 0x1E, 0x00, 0xBF, 0xA9, 0x1F, 0x10, 0x00, 0x67, 0x00, 0x00,
+    0x00, 0x10, 0xB0, 0x4B, 0x71, 0x26, 0x00, 0x00, 0x00, 0x37, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x6D, 0x6E, 0x72, 0x08, 0x08, 0xAC, 0x3B, 0x05, 0x63, 0x66, 0x6F, 0x74, 0x75, 0x2D, 0x2D,
+    0xB5, 0xA1, 0x08, 0xAF, 0x99, 0x01, 0x74, 0xC0, 0x01, 0xF1, 0x02, 0x2E, 0x72, 0x00, 0x7B, 0x80,
+    0x0B, 0x05, 0x01, 0x6E, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x72, 0x7D, 0x83, 0x00, 0xB1, 0x65, 0x73,
+    0x7A, 0x7D, 0x12, 0x12, 0x99, 0x06, 0x71, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A,
+    0x04, 0xBF, 0xCC, 0x00, 0x1E, 0x00, 0xBF, 0xD4, 0x1F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x66, 0x26, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0xAA, 0xCF, 0x02,
+    0x61, 0x6F, 0x16, 0x16, 0x01, 0x74, 0x7B, 0x02, 0x75, 0xC3, 0xAA, 0xC3, 0xAA, 0xC9, 0x02, 0x2E,
+    0x73, 0xBB, 0xB6, 0xBB, 0xB9, 0x02, 0x61, 0x6F, 0x79, 0x79, 0x01, 0x2E, 0xB5, 0x06, 0x01, 0x73,
+    0x7C, 0x02, 0x2E, 0x65, 0xB4, 0xFF, 0x7D, 0x01, 0x6C, 0x7A, 0x80, 0x05, 0xB3, 0x02, 0x2E, 0x73,
+    0xB4, 0xF3, 0x6D, 0x01, 0x2E, 0x77, 0x03, 0x2E, 0x61, 0x73, 0x74, 0x77, 0x7D, 0x02, 0x61, 0x65,
+    0x6A, 0x79, 0x02, 0x63, 0x64, 0xBF, 0xD3, 0x7B, 0x01, 0x67, 0x0C, 0x01, 0x61, 0xAA, 0xC9, 0x01,
+    0xAD, 0x7C, 0x01, 0xC3, 0x7D, 0x01, 0x67, 0x7D, 0x03, 0x2E, 0x6D, 0x73, 0x13, 0xB6, 0x7E, 0x0B,
+    0x02, 0x61, 0x6F, 0x78, 0xAA, 0xB4, 0x01, 0x63, 0x7A, 0x01, 0x69, 0x7D, 0x01, 0x67, 0x7D, 0x01,
+    0xB3, 0x7D, 0x03, 0x69, 0x6F, 0xC3, 0xBF, 0xD6, 0x63, 0x7D, 0x01, 0x6E, 0xAB, 0x3D, 0x03, 0x63,
+    0x65, 0x74, 0x08, 0x24, 0x08, 0x01, 0x73, 0xBB, 0x19, 0x01, 0x74, 0x08, 0x01, 0x69, 0xAE, 0x47,
+    0x01, 0x61, 0x3C, 0x01, 0xAD, 0x7D, 0x01, 0xC3, 0x7D, 0x81, 0x03, 0x52, 0x70, 0x7D, 0x07, 0x61,
+    0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x07, 0x7B, 0x11, 0x07, 0x07, 0x07, 0xA3, 0x66, 0x01, 0x6F,
+    0x70, 0x02, 0x6E, 0x74, 0xBF, 0xDB, 0x7D, 0x01, 0x65, 0xBA, 0xF9, 0x01, 0x74, 0x7C, 0x01, 0x6E,
+    0x7D, 0x01, 0x65, 0x7D, 0x03, 0x2E, 0x6D, 0x73, 0xBA, 0xE9, 0x7D, 0xBA, 0xEC, 0x01, 0x65, 0x0C,
+    0x04, 0x2E, 0x61, 0x6F, 0x74, 0x00, 0x74, 0xBA, 0xE3, 0x7D, 0x0D, 0x2E, 0x61, 0x63, 0x65, 0x69,
+    0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x78, 0x04, 0xBF, 0x21, 0xBF, 0x2A, 0xBF, 0x2D, 0xBF,
+    0x68, 0xBF, 0x98, 0xBF, 0xA0, 0xBF, 0xA4, 0xBF, 0xAB, 0xBF, 0xAF, 0xBF, 0xD7, 0x76, 0xB4, 0x98,
+    0x01, 0x6E, 0xA9, 0x0B, 0x01, 0x6F, 0x7C, 0x01, 0x65, 0x7D, 0x01, 0x74, 0x7D, 0x80, 0x07, 0x11,
+    0x01, 0xB1, 0x3C, 0x01, 0xC3, 0x7D, 0x02, 0x2E, 0x65, 0x77, 0x7D, 0x81, 0x03, 0x52, 0x73, 0x7B,
+    0x01, 0x61, 0x15, 0x01, 0x74, 0x7D, 0x01, 0x61, 0x7D, 0x81, 0x03, 0x52, 0x6C, 0x7D, 0x01, 0x6F,
+    0x15, 0x81, 0x03, 0x32, 0x73, 0x7D, 0x05, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x14, 0x14, 0x7B, 0x14,
+    0x14, 0x07, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x07, 0x07, 0x11, 0xBF, 0xDA, 0x07, 0x68,
+    0x75, 0x01, 0x61, 0x70, 0x03, 0x6C, 0x6E, 0x72, 0xBF, 0x79, 0xBF, 0xB6, 0x7D, 0x80, 0x0A, 0x72,
+    0x01, 0x65, 0x7D, 0x01, 0x74, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x61, 0x0E, 0x01, 0x69, 0x7D, 0x01,
+    0x6D, 0x7D, 0x80, 0x0A, 0x52, 0x01, 0x72, 0x7D, 0x01, 0x64, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x6F,
+    0x7D, 0x03, 0x61, 0x65, 0x70, 0x65, 0x6E, 0x7D, 0x04, 0x64, 0x6E, 0x72, 0x74, 0xAE, 0x0E, 0xAD,
+    0xA6, 0x79, 0xB4, 0x27, 0x01, 0x7A, 0x0C, 0x03, 0x63, 0x65, 0x72, 0x08, 0x7D, 0x08, 0x01, 0x74,
+    0xBD, 0x79, 0x01, 0x63, 0x7C, 0x01, 0x6E, 0x7D, 0x01, 0x72, 0xA2, 0x53, 0x98, 0x00, 0x71, 0x2E,
+    0x61, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73,
+    0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x04, 0x79, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x7C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x65, 0xBF, 0x41, 0x02, 0x64, 0x74, 0xBD, 0x2B, 0x7C, 0x02, 0x63, 0x71, 0xBF, 0x37, 0x15, 0x82,
+    0x03, 0x52, 0x6E, 0x72, 0x74, 0x7A, 0x01, 0x65, 0xBD, 0x21, 0x01, 0x69, 0x7C, 0x81, 0x03, 0x52,
+    0x6D, 0x7D, 0x81, 0x03, 0x52, 0x72, 0x3C, 0x01, 0x71, 0x15, 0x81, 0x03, 0x32, 0x72, 0x7D, 0x01,
+    0x65, 0x15, 0x01, 0x74, 0x7D, 0x81, 0x03, 0x32, 0x73, 0x7D, 0x05, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA,
+    0x70, 0x7B, 0x14, 0x14, 0x14, 0x07, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0xBF, 0xCA, 0x07,
+    0x11, 0x07, 0xBF, 0xD8, 0xBF, 0xDD, 0x75, 0x01, 0x69, 0x6E, 0x01, 0x6F, 0xA7, 0xD1, 0x81, 0x00,
+    0x62, 0x72, 0x7C, 0x07, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x0A, 0x7B, 0x2B, 0x0A, 0x0A,
+    0x0A, 0xC0, 0x01, 0xD7, 0x01, 0x61, 0x6F, 0x01, 0x74, 0x7D, 0x80, 0x09, 0xB3, 0x01, 0x74, 0x7D,
+    0x01, 0x63, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x72, 0xBC, 0x39, 0x01, 0x74, 0x7C, 0x02, 0x6C, 0x73,
+    0x76, 0x7D, 0x01, 0x70, 0x74, 0x01, 0x64, 0xBC, 0x2A, 0x02, 0x6D, 0x6E, 0x79, 0x7C, 0x80, 0x09,
+    0xE3, 0x01, 0x72, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x70, 0x7D, 0x01, 0x2E, 0x02, 0x02, 0x2E, 0x73,
+    0x02, 0x7D, 0x02, 0x61, 0x73, 0x7B, 0xC0, 0x03, 0xB0, 0x04, 0x65, 0x69, 0x6F, 0x74, 0xBF, 0xD4,
+    0x60, 0x6E, 0x79, 0x03, 0x6C, 0x72, 0x73, 0xBF, 0x94, 0xBF, 0xB4, 0x76, 0x01, 0x70, 0xC0, 0x02,
+    0x99, 0x02, 0x6D, 0x74, 0x7B, 0x0C, 0x97, 0x00, 0x71, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68,
+    0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A,
+    0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x7B, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0A, 0xE2, 0x6F, 0x2A, 0x02, 0x63, 0x71, 0x7B,
+    0xAC, 0x1E, 0x82, 0x00, 0xB1, 0x2E, 0x69, 0x04, 0x7A, 0x82, 0x00, 0xB1, 0x2E, 0x65, 0x04, 0x2D,
+    0x02, 0x61, 0x6F, 0xAB, 0x14, 0xAB, 0x14, 0x01, 0x74, 0x79, 0x9B, 0x06, 0x71, 0x2E, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x04, 0xBE, 0x4A, 0x00, 0x00, 0x00, 0xBE, 0x7E,
+    0x00, 0x00, 0x00, 0xBE, 0x8D, 0x00, 0x00, 0xBE, 0xA2, 0x00, 0xAC, 0x95, 0xBF, 0x99, 0x00, 0x00,
+    0xBF, 0xAC, 0x68, 0x6F, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6D, 0x72, 0xA9, 0xC5, 0x0C,
+    0x02, 0x65, 0x69, 0xBC, 0x55, 0x7A, 0x97, 0x06, 0x71, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68,
+    0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xA1, 0xA9, 0xAD, 0x3A, 0x3A, 0x3A, 0x04, 0x61,
+    0x65, 0x6F, 0xC3, 0x3A, 0x3A, 0x3A, 0x79, 0x03, 0x64, 0x6E, 0x72, 0xA8, 0xE1, 0xA8, 0x34, 0x77,
+    0x01, 0xA1, 0xB0, 0xDA, 0x03, 0x61, 0x65, 0xC3, 0xB0, 0xD6, 0xB0, 0xD6, 0x7C, 0x01, 0x69, 0x77,
+    0x01, 0x63, 0x7D, 0x80, 0x08, 0x52, 0x01, 0x61, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x63, 0x7D, 0x01,
+    0xAD, 0x7D, 0x02, 0x69, 0xC3, 0x6E, 0x7D, 0x01, 0x6E, 0x7B, 0x02, 0x65, 0x72, 0x16, 0x0C, 0x02,
+    0x69, 0x74, 0x78, 0x7B, 0x82, 0x00, 0xB1, 0x61, 0x6E, 0xA7, 0x45, 0x12, 0x01, 0x6D, 0x08, 0x99,
+    0x06, 0x71, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
+    0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x04, 0xBF, 0xB8, 0x00, 0x1E,
+    0x00, 0x70, 0x1F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x75, 0x00, 0x7D, 0x26, 0x00, 0x27, 0x00, 0x37,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x76, 0x32, 0x01, 0x74, 0xC0, 0x03, 0xB0, 0x01, 0x63, 0x7B,
+    0x04, 0x2E, 0x6C, 0x6E, 0x73, 0x3E, 0x75, 0x7D, 0xB5, 0x72, 0x01, 0x65, 0xB8, 0xAC, 0x01, 0x76,
+    0x0C, 0x80, 0x09, 0x63, 0x80, 0x09, 0x32, 0x80, 0x09, 0x33, 0x05, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA,
+    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x07, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x6C, 0x6C, 0x6F,
+    0x6C, 0x6C, 0x6C, 0x75, 0x01, 0x6F, 0x71, 0x01, 0x64, 0x7D, 0x04, 0x6C, 0x6D, 0x72, 0x75, 0xBF,
+    0xD0, 0xA7, 0x5D, 0xBF, 0xD4, 0x7D, 0x80, 0x09, 0x12, 0x81, 0x09, 0x12, 0x73, 0x7D, 0x01, 0x61,
+    0x7B, 0x81, 0x00, 0x62, 0x73, 0x7D, 0x07, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x7B, 0x0A,
+    0x2B, 0x0A, 0x0A, 0x0A, 0xC0, 0x01, 0xD7, 0x01, 0x65, 0x6F, 0x01, 0x72, 0x7D, 0x02, 0x62, 0x63,
+    0x7D, 0xA7, 0xEB, 0x84, 0x00, 0xB1, 0x61, 0x6E, 0x73, 0x74, 0xA6, 0x86, 0x12, 0x12, 0x12, 0x80,
+    0x00, 0xC1, 0x80, 0x04, 0x12, 0x01, 0x2E, 0x7D, 0x01, 0x73, 0x7D, 0x02, 0x2E, 0x65, 0x74, 0x7D,
+    0x01, 0x6C, 0x7B, 0x01, 0x2E, 0x6C, 0x02, 0x2E, 0x73, 0x69, 0x7D, 0x02, 0x2E, 0x73, 0x67, 0x6A,
+    0x01, 0x65, 0x68, 0x01, 0x6E, 0x7D, 0x01, 0x6E, 0xBF, 0xDF, 0x01, 0xB3, 0x7C, 0x03, 0x61, 0x6F,
+    0xC3, 0x6E, 0x76, 0x7D, 0x01, 0x6C, 0x79, 0x01, 0x6C, 0x7D, 0x01, 0x73, 0xBF, 0xD9, 0x03, 0x2E,
+    0x61, 0x65, 0xBF, 0xC1, 0xBF, 0xD8, 0x7C, 0x01, 0x72, 0x77, 0x86, 0x00, 0xB1, 0x61, 0x65, 0x69,
+    0x6F, 0x73, 0x7A, 0xBF, 0xC6, 0xBF, 0xCC, 0x6D, 0x7D, 0x12, 0x12, 0x80, 0x07, 0xC3, 0x01, 0x6E,
+    0x7D, 0x01, 0x61, 0x7D, 0x01, 0x63, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x72, 0x7D, 0x01, 0x65, 0x7D,
+    0x01, 0x6D, 0x7D, 0x01, 0x61, 0x7D, 0x80, 0x08, 0xC3, 0x81, 0x08, 0x93, 0x72, 0x7D, 0x01, 0x72,
+    0xB7, 0xF9, 0x81, 0x08, 0x93, 0x6F, 0x7C, 0x80, 0x08, 0x63, 0x01, 0x2E, 0xB5, 0xB7, 0x02, 0x2E,
+    0x73, 0xB5, 0xB3, 0x7C, 0x01, 0x74, 0x7A, 0x01, 0x69, 0x7D, 0x82, 0x08, 0x03, 0x72, 0x76, 0x6D,
+    0x7D, 0x05, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x79, 0x1A, 0x1A, 0x1A, 0x1A, 0x08, 0x61, 0x65, 0x68,
+    0x69, 0x6F, 0x72, 0x75, 0xC3, 0xBF, 0xCD, 0x21, 0x28, 0xBF, 0xD6, 0x21, 0x30, 0x21, 0x75, 0x01,
+    0x72, 0x6D, 0x87, 0x07, 0xF1, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x0A, 0x0A, 0x2B, 0x0A,
+    0x0A, 0x0A, 0xC0, 0x01, 0xD7, 0x01, 0x61, 0x6D, 0x02, 0x65, 0x72, 0x67, 0x7D, 0x03, 0x64, 0x70,
+    0x72, 0xBF, 0x96, 0x7B, 0xBF, 0x96, 0x9A, 0x06, 0x71, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
+    0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7A, 0x04, 0xBE, 0x9A, 0x00, 0x1E, 0x00, 0xBE, 0xD4, 0x1F, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0xBF, 0x07, 0xBF, 0x0D, 0x00, 0x00, 0x00, 0xBF, 0x64, 0x77, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x6C, 0xA9, 0x6F, 0x02, 0x61, 0x6D, 0x16, 0x0C, 0x02, 0x61, 0x72, 0x0D, 0x32,
+    0x04, 0x63, 0x6C, 0x72, 0x74, 0xA5, 0x49, 0xA5, 0xED, 0x76, 0x7B, 0x01, 0x6F, 0x05, 0x01, 0x75,
+    0x05, 0x02, 0x63, 0x71, 0x7A, 0x7D, 0x01, 0x6F, 0x7B, 0x80, 0x06, 0xF2, 0x01, 0x70, 0x08, 0x01,
+    0x69, 0xC0, 0x06, 0x8E, 0x02, 0x63, 0x74, 0x35, 0x7B, 0x01, 0x73, 0x38, 0x01, 0x61, 0x7D, 0x01,
+    0x6E, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x64, 0x28, 0x01, 0x6C, 0x28, 0x84, 0x07, 0x32, 0x63, 0x6D,
+    0x6E, 0x74, 0x69, 0x77, 0x7A, 0x7D, 0x01, 0x75, 0x06, 0x01, 0xBA, 0xC0, 0x04, 0xA6, 0x82, 0x07,
+    0x32, 0x78, 0xC3, 0x78, 0x7B, 0x01, 0x6E, 0x06, 0x01, 0x61, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x72,
+    0x7D, 0x01, 0x65, 0x7D, 0x01, 0xB3, 0x71, 0x02, 0x6F, 0xC3, 0x6E, 0x7D, 0x01, 0x69, 0x7B, 0x01,
+    0x2E, 0x03, 0x02, 0x2E, 0x73, 0x03, 0x7D, 0x02, 0x61, 0x6F, 0x7B, 0x7B, 0x01, 0xAD, 0x06, 0x03,
+    0x65, 0x69, 0xC3, 0x06, 0x06, 0x7D, 0x01, 0xA1, 0x06, 0x03, 0x61, 0x6F, 0xC3, 0x06, 0x06, 0x7D,
+    0x01, 0x61, 0xC0, 0x04, 0xA6, 0x01, 0x76, 0x7B, 0x01, 0x74, 0xC0, 0x03, 0x9A, 0x01, 0x76, 0x06,
+    0x01, 0x69, 0x06, 0x81, 0x07, 0x82, 0x72, 0x7D, 0x05, 0x61, 0x65, 0x69, 0x6F, 0xC3, 0x06, 0x06,
+    0x75, 0x7B, 0xC0, 0x09, 0x11, 0x88, 0x07, 0x32, 0x62, 0x63, 0x64, 0x67, 0x6A, 0x6C, 0x73, 0x74,
+    0xBF, 0xAC, 0xBF, 0xB7, 0xBF, 0xC2, 0xBF, 0xCA, 0xBF, 0xD4, 0x60, 0x63, 0x73, 0x01, 0x65, 0x28,
+    0x01, 0x69, 0x38, 0x01, 0x63, 0x7D, 0x01, 0x61, 0x7D, 0x82, 0x07, 0x32, 0x63, 0x72, 0x74, 0x7D,
+    0x83, 0x07, 0x32, 0x62, 0x72, 0x73, 0xC0, 0x04, 0xCD, 0x28, 0x3D, 0x07, 0x61, 0x65, 0x68, 0x69,
+    0x6F, 0x75, 0xC3, 0xBF, 0x50, 0xBF, 0x63, 0x28, 0xBF, 0xCA, 0x6E, 0x75, 0xA3, 0x99, 0x01, 0x73,
+    0x6D, 0x01, 0x6C, 0x11, 0x01, 0x65, 0x7D, 0x01, 0x75, 0x7D, 0x01, 0x62, 0x11, 0x01, 0x6F, 0x7D,
+    0x01, 0x72, 0x11, 0x01, 0x61, 0x7D, 0x03, 0x63, 0x70, 0x74, 0x77, 0x11, 0x7D, 0x01, 0x6E, 0x11,
+    0x01, 0x69, 0x7D, 0x01, 0x65, 0xC0, 0x09, 0x39, 0x02, 0x64, 0x74, 0x78, 0x7B, 0x01, 0xA1, 0xC0,
+    0x07, 0xFE, 0x01, 0xC3, 0x7B, 0x01, 0x6C, 0x7D, 0x04, 0x62, 0x6C, 0x6E, 0x74, 0xBF, 0xCF, 0xBF,
+    0xDE, 0x70, 0x7D, 0x01, 0x2E, 0xA2, 0x01, 0x02, 0x2E, 0x73, 0xA1, 0xFD, 0x7C, 0x02, 0x61, 0x6F,
+    0x7A, 0x7A, 0x01, 0x72, 0x7B, 0x01, 0xA1, 0xBF, 0xC8, 0x01, 0xC3, 0x7C, 0x01, 0x65, 0x7D, 0x01,
+    0x63, 0x7D, 0x03, 0x61, 0x65, 0x6F, 0xBF, 0xD6, 0x70, 0x7D, 0x02, 0x6E, 0x73, 0xBF, 0x94, 0x78,
+    0x01, 0x70, 0x0C, 0x98, 0x00, 0x71, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B,
+    0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x04, 0x77,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x7D, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x06, 0xF2, 0x2E, 0x04, 0x01, 0x62, 0x0C, 0x01, 0x72,
+    0x7D, 0x01, 0x68, 0x20, 0x01, 0x63, 0x7D, 0x82, 0x06, 0xF2, 0x2E, 0x73, 0x04, 0x7D, 0x01, 0x63,
+    0x2E, 0x01, 0x69, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x63, 0x7D, 0x01, 0xA9, 0x7D, 0x9C, 0x06, 0x71,
+    0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xC3, 0x04, 0xBE, 0x25, 0x00,
+    0x1E, 0x00, 0xBE, 0x33, 0x1F, 0x10, 0x00, 0xBE, 0x49, 0x00, 0x00, 0xBE, 0x4C, 0x10, 0x00, 0xBE,
+    0x4F, 0x26, 0x00, 0xBF, 0xA6, 0xBF, 0xD9, 0x37, 0x61, 0x00, 0x00, 0xBE, 0x4C, 0x00, 0x6A, 0x7D,
+    0x01, 0x74, 0xB0, 0x57, 0x80, 0x00, 0x22, 0x02, 0x64, 0x74, 0x7D, 0xAD, 0x68, 0x01, 0x69, 0x7A,
+    0x01, 0x73, 0x7D, 0x01, 0x72, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x76, 0x7D, 0x01, 0x69, 0x7D, 0x01,
+    0x69, 0xB0, 0x9B, 0x01, 0x72, 0x7C, 0x01, 0x65, 0x7D, 0x03, 0x6C, 0x6E, 0x74, 0xBF, 0xD7, 0x73,
+    0x7D, 0x02, 0x63, 0x64, 0xA3, 0xAC, 0xB8, 0xBC, 0x97, 0x06, 0x71, 0x2E, 0x62, 0x63, 0x64, 0x66,
+    0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78,
+    0x79, 0x7A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+    0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x73, 0xBF, 0x38, 0x97, 0x06, 0x71,
+    0x2E, 0x61, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x04, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6E,
+    0x72, 0x08, 0x08, 0x98, 0x06, 0x71, 0x2E, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A,
+    0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x04, 0x00,
+    0x1E, 0x00, 0x7B, 0x1F, 0x10, 0x00, 0xB5, 0x56, 0x00, 0x00, 0x00, 0x10, 0x00, 0x26, 0x00, 0x00,
+    0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x06, 0x71, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67,
+    0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A,
+    0x04, 0x00, 0x1E, 0x00, 0x1F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x26, 0x00, 0x00, 0x00,
+    0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6F, 0xAC, 0x53, 0x97, 0x06, 0x71, 0x2E, 0x62, 0x63,
+    0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76,
+    0x77, 0x78, 0x79, 0x7A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x06, 0x02, 0x01, 0x2E,
+    0x7D, 0x01, 0x73, 0x7D, 0x01, 0x6F, 0x7D, 0x01, 0x6D, 0x7D, 0x01, 0x61, 0x7D, 0x80, 0x06, 0x22,
+    0x01, 0x2E, 0x7D, 0x02, 0x2E, 0x73, 0x7A, 0x7D, 0x03, 0x61, 0x65, 0x6F, 0x7B, 0x0D, 0x0D, 0x01,
+    0x6C, 0x79, 0x01, 0x65, 0x7D, 0x03, 0x61, 0x65, 0x6F, 0x0D, 0x0D, 0x0D, 0x01, 0x6C, 0x79, 0x01,
+    0x73, 0x7D, 0x01, 0x6F, 0x7D, 0x01, 0x65, 0x77, 0x04, 0x6D, 0x6E, 0x73, 0x74, 0x6A, 0x7A, 0x7D,
+    0x6A, 0x03, 0x61, 0x65, 0x6F, 0x0D, 0x0D, 0x0D, 0x02, 0x2E, 0x6C, 0x04, 0x79, 0x01, 0x65, 0x7B,
+    0x04, 0x2E, 0x6C, 0x6D, 0x6E, 0x04, 0x71, 0x36, 0xA1, 0xC1, 0x01, 0x65, 0x76, 0x06, 0x6C, 0x6D,
+    0x6E, 0x6F, 0x73, 0x74, 0xBF, 0xC8, 0x70, 0xA1, 0xB4, 0x24, 0x7D, 0x7D, 0x01, 0x6F, 0x71, 0x01,
+    0x64, 0x7D, 0x80, 0x06, 0x43, 0x01, 0x2E, 0x7D, 0x02, 0x2E, 0x73, 0x7A, 0x7D, 0x80, 0x06, 0x42,
+    0x02, 0x2E, 0x73, 0x7D, 0x75, 0x03, 0x61, 0x65, 0x6F, 0x73, 0x7B, 0x7B, 0x01, 0x6C, 0x79, 0x01,
+    0x65, 0x7D, 0x03, 0x61, 0x65, 0x6F, 0x66, 0x66, 0x66, 0x01, 0x6C, 0x79, 0x01, 0x73, 0x7D, 0x01,
+    0x6F, 0x7D, 0x01, 0x65, 0x77, 0x07, 0x61, 0x65, 0x6D, 0x6E, 0x6F, 0x73, 0x74, 0xBF, 0x62, 0xBF,
+    0x62, 0x6A, 0x7A, 0xBF, 0x8A, 0x7D, 0x7D, 0x02, 0x2E, 0x65, 0x04, 0xBF, 0x50, 0x07, 0x62, 0x64,
+    0x69, 0x6E, 0x6F, 0x72, 0x73, 0xBF, 0x4D, 0xBF, 0x7B, 0x24, 0xBF, 0xB2, 0xBF, 0x72, 0x68, 0x7A,
+    0x02, 0x2E, 0x73, 0xBF, 0x2B, 0xBF, 0x2E, 0x02, 0x61, 0x6F, 0x79, 0x79, 0x01, 0x63, 0x7B, 0x01,
+    0x69, 0x7D, 0x05, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0xBF, 0x40, 0xBF, 0x50, 0x7D, 0xBF, 0x53, 0xBF,
+    0x40, 0x03, 0x61, 0x65, 0x6F, 0xBF, 0xDF, 0xBF, 0xDF, 0xBF, 0xDF, 0x01, 0x6C, 0x76, 0x01, 0x73,
+    0x7D, 0x05, 0x6D, 0x6E, 0x6F, 0x73, 0x74, 0xBF, 0x21, 0xBF, 0x31, 0x7D, 0xBF, 0x34, 0xBF, 0x21,
+    0x06, 0x2E, 0x64, 0x69, 0x6F, 0x72, 0x73, 0x04, 0xBF, 0xD2, 0x24, 0xBF, 0x1F, 0x71, 0x04, 0x01,
+    0x73, 0xBE, 0xF1, 0x01, 0x6F, 0x7C, 0x05, 0x2E, 0x69, 0x6D, 0x6E, 0x73, 0x04, 0x24, 0x7D, 0x1C,
+    0x1C, 0x01, 0x65, 0xBF, 0x9F, 0x01, 0x6C, 0x7C, 0x03, 0x2E, 0x69, 0x73, 0xBF, 0x3A, 0x67, 0xBF,
+    0x3D, 0x02, 0x61, 0x6F, 0x0D, 0x0D, 0x01, 0x63, 0x7B, 0x03, 0x61, 0x65, 0x69, 0x0D, 0x6F, 0x7D,
+    0x02, 0x6D, 0x74, 0xB3, 0x09, 0x79, 0x01, 0x65, 0xBE, 0xAB, 0x07, 0x2E, 0x61, 0x62, 0x64, 0x6D,
+    0x73, 0x74, 0x04, 0xBF, 0xCC, 0xBF, 0xDB, 0xBF, 0x7D, 0xBE, 0xAA, 0x76, 0x7C, 0x81, 0x06, 0x71,
+    0x2E, 0x04, 0x01, 0x67, 0xBF, 0x65, 0x01, 0x6F, 0x7C, 0x01, 0x65, 0xB2, 0xE0, 0x01, 0x74, 0x7C,
+    0x01, 0x63, 0x00, 0x01, 0x69, 0x7D, 0x05, 0x2E, 0x6C, 0x6E, 0x73, 0x74, 0x04, 0x70, 0x1C, 0x77,
+    0x7D, 0x05, 0xA1, 0xA9, 0xAD, 0xB1, 0xB3, 0xBF, 0x2C, 0xBF, 0x7F, 0xBF, 0xC9, 0xBF, 0xDC, 0x75,
+    0x1C, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
+    0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xC3, 0xC0, 0x0E, 0x9B,
+    0xA2, 0x03, 0xA3, 0x20, 0xA4, 0xF9, 0xAA, 0x16, 0xAD, 0xE9, 0xAE, 0x3E, 0xAF, 0x4E, 0xB0, 0x88,
+    0xB2, 0xCD, 0xB2, 0xEA, 0xB3, 0x1C, 0xB3, 0xA7, 0xB4, 0x94, 0xB5, 0x04, 0xB6, 0x1A, 0xB8, 0x4A,
+    0xB8, 0x96, 0xB9, 0x1F, 0xBA, 0xC6, 0xBC, 0xDD, 0xBD, 0x49, 0xBD, 0x58, 0xBD, 0x8D, 0xBD, 0xC3,
+    0xBD, 0xF7, 0xBE, 0x2A, 0x71,
 };
 
 constexpr SerializedHyphenationPatterns es_patterns = {
-    0x34F8u,
+    0x2ED0u,
+    0x10Eu,
     es_trie_data,
     sizeof(es_trie_data),
 };
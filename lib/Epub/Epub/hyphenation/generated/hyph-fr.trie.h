@@ -7,447 +7,410 @@
 
 // Auto-generated by generate_hyphenation_trie.py. Do not edit manually.
 alignas(4) constexpr uint8_t fr_trie_data[] = {
-    0x02, 0x0C, 0x18, 0x22, 0x16, 0x21, 0x0B, 0x16, 0x21, 0x0E, 0x01, 0x0C, 0x0B, 0x3D, 0x0C, 0x2B,
-    0x0E, 0x0C, 0x0C, 0x33, 0x0C, 0x33, 0x16, 0x34, 0x2A, 0x0D, 0x20, 0x0D, 0x0C, 0x0D, 0x2A, 0x17,
-    0x04, 0x1F, 0x0C, 0x29, 0x0C, 0x20, 0x0B, 0x0C, 0x17, 0x17, 0x0C, 0x3F, 0x35, 0x53, 0x4A, 0x36,
-    0x34, 0x21, 0x2A, 0x0D, 0x0C, 0x2A, 0x0D, 0x16, 0x02, 0x17, 0x15, 0x15, 0x0C, 0x15, 0x16, 0x2C,
-    0x47, 0x0C, 0x49, 0x2B, 0x0C, 0x0D, 0x34, 0x0D, 0x2A, 0x0B, 0x16, 0x2B, 0x0C, 0x17, 0x2A, 0x0B,
-    0x0C, 0x03, 0x0C, 0x16, 0x0D, 0x01, 0x16, 0x0C, 0x0B, 0x0C, 0x3E, 0x48, 0x2C, 0x0B, 0x29, 0x16,
-    0x37, 0x40, 0x1F, 0x16, 0x20, 0x17, 0x36, 0x0D, 0x52, 0x3D, 0x16, 0x1F, 0x0C, 0x16, 0x3E, 0x0D,
-    0x49, 0x0C, 0x03, 0x16, 0x35, 0x0C, 0x22, 0x0F, 0x02, 0x0D, 0x51, 0x0C, 0x21, 0x0C, 0x20, 0x0B,
-    0x16, 0x21, 0x0C, 0x17, 0x21, 0x0C, 0x0D, 0xA0, 0x00, 0x91, 0x21, 0x61, 0xFD, 0x21, 0xA9, 0xFD,
-    0x21, 0xC3, 0xFD, 0x21, 0x72, 0xFD, 0xA0, 0x00, 0xC2, 0x21, 0x68, 0xFD, 0x21, 0x63, 0xFD, 0x21,
-    0x73, 0xFD, 0xA0, 0x00, 0x51, 0x21, 0x6C, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x63,
-    0xFD, 0xA0, 0x01, 0x12, 0x21, 0x63, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x6E, 0xFD,
-    0x21, 0x69, 0xFD, 0xA0, 0x01, 0x32, 0x21, 0x72, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x73, 0xFD, 0xA0,
-    0x01, 0x52, 0x21, 0x69, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x68,
-    0xFD, 0x21, 0x74, 0xFD, 0x21, 0x73, 0xFD, 0xA0, 0x01, 0x72, 0xA0, 0x01, 0xB1, 0x21, 0x65, 0xFD,
-    0x21, 0x6E, 0xFD, 0xA1, 0x01, 0x72, 0x6E, 0xFD, 0xA0, 0x01, 0x92, 0x21, 0xA9, 0xFD, 0x24, 0x61,
-    0x65, 0xC3, 0x73, 0xE9, 0xF5, 0xFD, 0xE9, 0x21, 0x69, 0xF7, 0x23, 0x61, 0x65, 0x74, 0xC2, 0xDA,
-    0xFD, 0xA0, 0x01, 0xC2, 0x21, 0x61, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x6F, 0xFD,
-    0xA0, 0x01, 0xE1, 0x21, 0x61, 0xFD, 0x21, 0x74, 0xFD, 0x41, 0x2E, 0xFF, 0x5E, 0x21, 0x74, 0xFC,
-    0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x22, 0x67, 0x70, 0xFD, 0xFD, 0xA0, 0x05, 0x72, 0x21, 0x74,
-    0xFD, 0x21, 0x61, 0xFD, 0x21, 0x6E, 0xFD, 0xC9, 0x00, 0x61, 0x62, 0x65, 0x6C, 0x6D, 0x6E, 0x70,
-    0x73, 0x72, 0x67, 0xFF, 0x4C, 0xFF, 0x58, 0xFF, 0x67, 0xFF, 0x79, 0xFF, 0xC3, 0xFF, 0xD6, 0xFF,
-    0xDF, 0xFF, 0xEF, 0xFF, 0xFD, 0xA0, 0x00, 0x71, 0x27, 0xA2, 0xAA, 0xA9, 0xA8, 0xAE, 0xB4, 0xBB,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xA0, 0x02, 0x52, 0x22, 0x61, 0x6F, 0xFD, 0xFD, 0xA0,
-    0x02, 0x93, 0x21, 0x61, 0xFD, 0x21, 0x72, 0xFD, 0xA2, 0x00, 0x61, 0x6E, 0x75, 0xF2, 0xFD, 0x21,
-    0xA9, 0xAC, 0x42, 0xC3, 0x69, 0xFF, 0xFD, 0xFF, 0xA9, 0x21, 0x6E, 0xF9, 0x41, 0x74, 0xFF, 0x06,
-    0x21, 0x61, 0xFC, 0x21, 0x6D, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x6F, 0xFD, 0xA0, 0x01, 0xE2, 0x21,
-    0x74, 0xFD, 0x21, 0x69, 0xFD, 0x41, 0x72, 0xFF, 0x6B, 0x21, 0x75, 0xFC, 0x21, 0x67, 0xFD, 0xA2,
-    0x02, 0x52, 0x6E, 0x75, 0xF3, 0xFD, 0x41, 0x62, 0xFF, 0x5A, 0x21, 0x61, 0xFC, 0x21, 0x66, 0xFD,
-    0x41, 0x74, 0xFF, 0x50, 0x41, 0x72, 0xFF, 0x4F, 0x21, 0x6F, 0xFC, 0xC4, 0x02, 0x52, 0x66, 0x70,
-    0x72, 0x78, 0xFF, 0xF2, 0xFF, 0xF5, 0xFF, 0x45, 0xFF, 0xFD, 0xA0, 0x06, 0x82, 0x21, 0x61, 0xFD,
-    0x21, 0x74, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x75, 0xFD, 0x21, 0x72, 0xF4, 0x21, 0x72, 0xFD, 0x21,
-    0x61, 0xFD, 0xA2, 0x06, 0x62, 0x6C, 0x6E, 0xF4, 0xFD, 0x21, 0xA9, 0xF9, 0x41, 0x69, 0xFF, 0xA0,
-    0x21, 0x74, 0xFC, 0x21, 0x69, 0xFD, 0xC3, 0x02, 0x52, 0x6D, 0x71, 0x74, 0xFF, 0xFD, 0xFF, 0x96,
-    0xFF, 0x96, 0x41, 0x6C, 0xFF, 0x8A, 0x21, 0x75, 0xFC, 0x41, 0x64, 0xFE, 0xF7, 0xA2, 0x02, 0x52,
-    0x63, 0x6E, 0xF9, 0xFC, 0x41, 0x62, 0xFF, 0x43, 0x21, 0x61, 0xFC, 0x21, 0x74, 0xFD, 0xA0, 0x05,
-    0xF1, 0xA0, 0x06, 0xC1, 0x21, 0xA9, 0xFD, 0xA7, 0x06, 0xA2, 0x61, 0x65, 0xC3, 0x69, 0x6F, 0x75,
-    0x73, 0xF7, 0xF7, 0xFD, 0xF7, 0xF7, 0xF7, 0xF7, 0x21, 0x72, 0xEF, 0x21, 0x65, 0xFD, 0xC2, 0x02,
-    0x52, 0x69, 0x6C, 0xFF, 0x72, 0xFF, 0x4E, 0x49, 0x66, 0x61, 0x65, 0xC3, 0x69, 0x6F, 0x73, 0x74,
-    0x75, 0xFF, 0x42, 0xFF, 0x58, 0xFF, 0x74, 0xFF, 0xA2, 0xFF, 0xAF, 0xFF, 0xC6, 0xFF, 0xD4, 0xFF,
-    0xF4, 0xFF, 0xF7, 0xC2, 0x00, 0x61, 0x67, 0x6E, 0xFF, 0x16, 0xFF, 0xE4, 0x41, 0x75, 0xFE, 0xA7,
-    0x21, 0x67, 0xFC, 0x41, 0x65, 0xFF, 0x09, 0x21, 0x74, 0xFC, 0xA0, 0x02, 0x71, 0x21, 0x75, 0xFD,
-    0x21, 0x6F, 0xFD, 0x21, 0x61, 0xFD, 0xA0, 0x02, 0x72, 0x21, 0x63, 0xFD, 0x21, 0x73, 0xFD, 0x21,
-    0x69, 0xFD, 0xA4, 0x00, 0x61, 0x6E, 0x63, 0x75, 0x76, 0xDE, 0xE5, 0xF1, 0xFD, 0xA0, 0x00, 0x61,
-    0xC7, 0x00, 0x42, 0x61, 0xC3, 0x65, 0x69, 0x6F, 0x75, 0x79, 0xFE, 0x87, 0xFE, 0xA8, 0xFE, 0xC8,
-    0xFF, 0xC3, 0xFF, 0xF2, 0xFF, 0xFD, 0xFF, 0xFD, 0x42, 0x61, 0x74, 0xFD, 0xF4, 0xFE, 0x2F, 0x43,
-    0x64, 0x67, 0x70, 0xFE, 0x54, 0xFE, 0x54, 0xFE, 0x54, 0xC8, 0x00, 0x61, 0x62, 0x65, 0x6D, 0x6E,
-    0x70, 0x73, 0x72, 0x67, 0xFD, 0xAA, 0xFD, 0xB6, 0xFD, 0xD7, 0xFF, 0xEF, 0xFE, 0x34, 0xFE, 0x3D,
-    0xFF, 0xF6, 0xFE, 0x5B, 0xA0, 0x03, 0x01, 0x21, 0x2E, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD,
-    0x21, 0x65, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0xA1, 0x00, 0x71, 0x6D, 0xFD, 0x47, 0xA2,
-    0xAA, 0xA9, 0xA8, 0xAE, 0xB4, 0xBB, 0xFE, 0x47, 0xFE, 0x47, 0xFF, 0xFB, 0xFE, 0x47, 0xFE, 0x47,
-    0xFE, 0x47, 0xFE, 0x47, 0xA0, 0x02, 0x22, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x61, 0xFD,
-    0x21, 0x6D, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x69, 0xFD, 0xA0, 0x02, 0x51, 0x43,
-    0x63, 0x74, 0x75, 0xFE, 0x28, 0xFE, 0x28, 0xFF, 0xFD, 0x41, 0x61, 0xFF, 0x4D, 0x44, 0x61, 0x6F,
-    0x73, 0x75, 0xFF, 0xF2, 0xFF, 0xFC, 0xFE, 0x25, 0xFE, 0x1A, 0x22, 0x61, 0x69, 0xDF, 0xF3, 0xA0,
-    0x03, 0x42, 0x21, 0x65, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x75,
-    0xFD, 0x21, 0x65, 0xFD, 0x21, 0x66, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x76, 0xFD,
-    0x21, 0xA8, 0xFD, 0xA1, 0x00, 0x71, 0xC3, 0xFD, 0xA0, 0x02, 0x92, 0x21, 0x70, 0xFD, 0x21, 0x6C,
-    0xFD, 0x21, 0x61, 0xFD, 0x21, 0x73, 0xFD, 0xA0, 0x03, 0x31, 0xA0, 0x04, 0x42, 0x21, 0x63, 0xFD,
-    0xA0, 0x04, 0x61, 0x21, 0x65, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0xAE, 0xFD, 0x21,
-    0xC3, 0xFD, 0x21, 0x61, 0xFD, 0x22, 0x73, 0x6D, 0xE8, 0xFD, 0x21, 0x65, 0xFB, 0x21, 0x72, 0xFD,
-    0xA2, 0x04, 0x31, 0x73, 0x74, 0xD7, 0xFD, 0x41, 0x65, 0xFD, 0xD5, 0x21, 0x69, 0xFC, 0xA1, 0x02,
-    0x52, 0x6C, 0xFD, 0xA0, 0x01, 0x31, 0x21, 0x2E, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x21,
-    0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x23, 0x6E, 0x6F, 0x6D, 0xDB, 0xE9, 0xFD, 0xA0, 0x04, 0x31, 0x21,
-    0x6C, 0xFD, 0x44, 0x68, 0x69, 0x6F, 0x75, 0xFF, 0x91, 0xFF, 0xA2, 0xFF, 0xF3, 0xFF, 0xFD, 0x41,
-    0x61, 0xFF, 0x9B, 0x21, 0x6F, 0xFC, 0x21, 0x79, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x63, 0xFD, 0x41,
-    0x6F, 0xFE, 0x7B, 0xA0, 0x04, 0x73, 0x21, 0x72, 0xFD, 0xA0, 0x04, 0xA2, 0x21, 0x6C, 0xF7, 0x21,
-    0x6C, 0xFD, 0x21, 0x65, 0xFD, 0xA0, 0x04, 0x72, 0x21, 0x72, 0xFD, 0x21, 0x74, 0xFD, 0x24, 0x63,
-    0x6D, 0x74, 0x73, 0xE8, 0xEB, 0xF4, 0xFD, 0xA0, 0x04, 0xF3, 0x21, 0x72, 0xFD, 0xA1, 0x04, 0xC3,
-    0x67, 0xFD, 0x21, 0xA9, 0xFB, 0x21, 0x62, 0xE0, 0x21, 0x69, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x74,
-    0xD7, 0x21, 0x75, 0xD4, 0x23, 0x6E, 0x72, 0x78, 0xF7, 0xFA, 0xFD, 0x21, 0x6E, 0xB8, 0x21, 0x69,
-    0xB5, 0x21, 0x6F, 0xC4, 0x22, 0x65, 0x76, 0xF7, 0xFD, 0xC6, 0x05, 0x23, 0x64, 0x67, 0x6C, 0x6E,
-    0x72, 0x73, 0xFF, 0xAA, 0xFF, 0xF2, 0xFF, 0xF5, 0xFF, 0xFB, 0xFF, 0xAA, 0xFF, 0xE5, 0x41, 0xA9,
-    0xFF, 0x95, 0x21, 0xC3, 0xFC, 0x41, 0x69, 0xFF, 0x97, 0x42, 0x6D, 0x70, 0xFF, 0x9C, 0xFF, 0x9C,
-    0x41, 0x66, 0xFF, 0x98, 0x45, 0x64, 0x6C, 0x70, 0x72, 0x75, 0xFF, 0xEE, 0xFF, 0x7F, 0xFF, 0xF1,
-    0xFF, 0xF5, 0xFF, 0xFC, 0xA0, 0x04, 0xC2, 0x21, 0x93, 0xFD, 0xA0, 0x05, 0x23, 0x21, 0x6E, 0xFD,
-    0xCA, 0x01, 0xC1, 0x61, 0x63, 0xC3, 0x65, 0x69, 0x6F, 0xC5, 0x70, 0x74, 0x75, 0xFF, 0x7E, 0xFF,
-    0x75, 0xFF, 0x92, 0xFF, 0xA4, 0xFF, 0xB9, 0xFF, 0xE4, 0xFF, 0xF7, 0xFF, 0x75, 0xFF, 0x75, 0xFF,
-    0xFD, 0x44, 0x61, 0x69, 0x6F, 0x73, 0xFD, 0xC5, 0xFF, 0x3E, 0xFD, 0xC5, 0xFF, 0xDF, 0x21, 0xA9,
-    0xF3, 0x41, 0xA9, 0xFC, 0x86, 0x41, 0x64, 0xFC, 0x82, 0x22, 0xC3, 0x69, 0xF8, 0xFC, 0x41, 0x64,
-    0xFE, 0x4E, 0x41, 0x69, 0xFC, 0x75, 0x41, 0x6D, 0xFC, 0x71, 0x21, 0x6F, 0xFC, 0x24, 0x63, 0x6C,
-    0x6D, 0x74, 0xEC, 0xF1, 0xF5, 0xFD, 0x41, 0x6E, 0xFC, 0x61, 0x41, 0x68, 0xFC, 0x92, 0x23, 0x61,
-    0x65, 0x73, 0xEF, 0xF8, 0xFC, 0xC4, 0x01, 0xE2, 0x61, 0x69, 0x6F, 0x75, 0xFC, 0x5A, 0xFC, 0x5A,
-    0xFC, 0x5A, 0xFC, 0x5A, 0x21, 0x73, 0xF1, 0x41, 0x6C, 0xFB, 0xFC, 0x45, 0x61, 0xC3, 0x69, 0x79,
-    0x6F, 0xFE, 0xE1, 0xFF, 0xB3, 0xFF, 0xE3, 0xFF, 0xF9, 0xFF, 0xFC, 0x48, 0x61, 0x65, 0xC3, 0x69,
-    0x6F, 0x73, 0x74, 0x75, 0xFC, 0x74, 0xFC, 0x90, 0xFC, 0xBE, 0xFC, 0xCB, 0xFC, 0xE2, 0xFC, 0xF0,
-    0xFD, 0x10, 0xFD, 0x13, 0xC2, 0x00, 0x61, 0x67, 0x6E, 0xFC, 0x35, 0xFF, 0xE7, 0x41, 0x64, 0xFE,
-    0x6A, 0x21, 0x69, 0xFC, 0x41, 0x61, 0xFC, 0x3B, 0x21, 0x63, 0xFC, 0x21, 0x69, 0xFD, 0x22, 0x63,
-    0x66, 0xF3, 0xFD, 0x41, 0x6D, 0xFC, 0x29, 0x22, 0x69, 0x75, 0xF7, 0xFC, 0x21, 0x6E, 0xFB, 0x41,
-    0x73, 0xFB, 0x25, 0x21, 0x6F, 0xFC, 0x42, 0x6B, 0x72, 0xFC, 0x16, 0xFF, 0xFD, 0x41, 0x73, 0xFB,
-    0xE2, 0x42, 0x65, 0x6F, 0xFF, 0xFC, 0xFB, 0xDE, 0x21, 0x72, 0xF9, 0x41, 0xA9, 0xFD, 0xED, 0x21,
-    0xC3, 0xFC, 0x21, 0x73, 0xFD, 0x44, 0x64, 0x69, 0x70, 0x76, 0xFF, 0xF3, 0xFF, 0xFD, 0xFD, 0xE3,
-    0xFB, 0xCA, 0x41, 0x6E, 0xFD, 0xD6, 0x41, 0x74, 0xFD, 0xD2, 0x21, 0x6E, 0xFC, 0x42, 0x63, 0x64,
-    0xFD, 0xCB, 0xFB, 0xB2, 0x24, 0x61, 0x65, 0x69, 0x6F, 0xE1, 0xEE, 0xF6, 0xF9, 0x41, 0x78, 0xFD,
-    0xBB, 0x24, 0x67, 0x63, 0x6C, 0x72, 0xAB, 0xB5, 0xF3, 0xFC, 0x41, 0x68, 0xFE, 0xCA, 0x21, 0x6F,
-    0xFC, 0xC1, 0x01, 0xC1, 0x6E, 0xFD, 0xF2, 0x41, 0x73, 0xFE, 0xBD, 0x41, 0x73, 0xFE, 0xBF, 0x44,
-    0x61, 0x65, 0x69, 0x75, 0xFF, 0xF2, 0xFF, 0xF8, 0xFE, 0xB5, 0xFF, 0xFC, 0x41, 0x61, 0xFA, 0xA5,
-    0x21, 0x74, 0xFC, 0x21, 0x73, 0xFD, 0x21, 0x61, 0xFD, 0x23, 0x67, 0x73, 0x74, 0xD5, 0xE6, 0xFD,
-    0x21, 0xA9, 0xF9, 0xA0, 0x01, 0x11, 0x21, 0x6D, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x69, 0xFD, 0x21,
-    0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0x41, 0xC3, 0xFA, 0xC6, 0x21, 0x64, 0xFC, 0x42, 0xA9, 0xAF, 0xFA,
-    0xBC, 0xFF, 0xFD, 0x47, 0x61, 0x65, 0xC3, 0x69, 0x6F, 0x75, 0x73, 0xFA, 0xA4, 0xFA, 0xA4, 0xFF,
-    0xF9, 0xFA, 0xA4, 0xFA, 0xA4, 0xFA, 0xA4, 0xFA, 0xA4, 0x21, 0x6F, 0xEA, 0x21, 0x6E, 0xFD, 0x44,
-    0x61, 0xC3, 0x69, 0x6F, 0xFF, 0x82, 0xFF, 0xC1, 0xFF, 0xD3, 0xFF, 0xFD, 0x41, 0x68, 0xFA, 0xA5,
-    0x21, 0x74, 0xFC, 0x21, 0x61, 0xFD, 0x21, 0x6E, 0xFD, 0xA0, 0x06, 0x22, 0x21, 0xA9, 0xFD, 0x41,
-    0xA9, 0xFC, 0x27, 0x21, 0xC3, 0xFC, 0x21, 0x63, 0xFD, 0xA0, 0x07, 0x82, 0x21, 0x68, 0xFD, 0x21,
-    0x64, 0xFD, 0x24, 0x67, 0xC3, 0x73, 0x75, 0xE4, 0xEA, 0xF4, 0xFD, 0x41, 0x61, 0xFD, 0x8E, 0xC2,
-    0x01, 0x72, 0x6C, 0x75, 0xFF, 0xFC, 0xFA, 0x4B, 0x47, 0x61, 0xC3, 0x65, 0x69, 0x6F, 0x75, 0x73,
-    0xFF, 0xF7, 0xFA, 0x53, 0xFA, 0x3F, 0xFA, 0x3F, 0xFA, 0x3F, 0xFA, 0x3F, 0xFA, 0x3F, 0x21, 0xA9,
-    0xEA, 0x22, 0x6F, 0xC3, 0xD1, 0xFD, 0x41, 0xA9, 0xFA, 0xB9, 0x21, 0xC3, 0xFC, 0x43, 0x66, 0x6D,
-    0x72, 0xFA, 0xB2, 0xFF, 0xFD, 0xFA, 0xB5, 0x41, 0x73, 0xFC, 0xC1, 0x42, 0x68, 0x74, 0xFA, 0xA4,
-    0xFC, 0xBD, 0x21, 0x70, 0xF9, 0x23, 0x61, 0x69, 0x6F, 0xE8, 0xF2, 0xFD, 0x41, 0xA8, 0xFA, 0x93,
-    0x42, 0x65, 0xC3, 0xFA, 0x8F, 0xFF, 0xFC, 0x21, 0x68, 0xF9, 0x42, 0x63, 0x73, 0xFF, 0xFD, 0xF9,
-    0xED, 0x41, 0xA9, 0xFA, 0xAB, 0x21, 0xC3, 0xFC, 0x43, 0x61, 0x68, 0x65, 0xFF, 0xF2, 0xFF, 0xFD,
-    0xFA, 0x28, 0x43, 0x6E, 0x72, 0x74, 0xFF, 0xD3, 0xFF, 0xF6, 0xFA, 0x21, 0xA0, 0x01, 0xC1, 0x21,
-    0x61, 0xFD, 0x21, 0x74, 0xFD, 0xC6, 0x00, 0x71, 0x61, 0x65, 0xC3, 0x69, 0x6F, 0x75, 0xFB, 0x81,
-    0xFB, 0x81, 0xFF, 0x57, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x81, 0x22, 0x6E, 0x72, 0xE8, 0xEB, 0x41,
-    0x73, 0xFE, 0xE4, 0xA0, 0x07, 0x22, 0x21, 0x61, 0xFD, 0xA2, 0x01, 0x12, 0x73, 0x74, 0xFA, 0xFD,
-    0x43, 0x6F, 0x73, 0x75, 0xFF, 0xEF, 0xFF, 0xF9, 0xF9, 0x61, 0x21, 0x69, 0xF6, 0x21, 0x72, 0xFD,
-    0x21, 0xA9, 0xFD, 0xA0, 0x07, 0x42, 0x21, 0x74, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x6E, 0xFD, 0x21,
-    0x61, 0xFD, 0x21, 0x6C, 0xFD, 0xA1, 0x00, 0x71, 0x61, 0xFD, 0x41, 0x61, 0xFE, 0xA9, 0x21, 0x69,
-    0xFC, 0x21, 0x72, 0xFD, 0x21, 0x75, 0xFD, 0x41, 0x74, 0xFF, 0x95, 0x21, 0x65, 0xFC, 0x21, 0x74,
-    0xFD, 0x41, 0x6E, 0xFD, 0x23, 0x45, 0x68, 0x69, 0x6F, 0x72, 0x73, 0xF9, 0x7C, 0xFF, 0xFC, 0xFD,
-    0x25, 0xF9, 0x7C, 0xF9, 0x52, 0x21, 0x74, 0xF0, 0x22, 0x6E, 0x73, 0xE6, 0xFD, 0x41, 0x6E, 0xFB,
-    0xFD, 0x21, 0x61, 0xFC, 0x21, 0x6F, 0xFD, 0x21, 0x68, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x79, 0xFD,
-    0x41, 0x6C, 0xFA, 0xE6, 0x21, 0x64, 0xFC, 0x21, 0x64, 0xFD, 0x49, 0x72, 0x61, 0x65, 0xC3, 0x68,
-    0x6C, 0x6F, 0x73, 0x75, 0xFE, 0xF7, 0xFF, 0x48, 0xFF, 0x70, 0xFF, 0x96, 0xFF, 0xAB, 0xFF, 0xBA,
-    0xFF, 0xDE, 0xFF, 0xF3, 0xFF, 0xFD, 0x41, 0x6E, 0xF9, 0x2B, 0x21, 0x67, 0xFC, 0x41, 0x6C, 0xFB,
-    0x17, 0x21, 0x6C, 0xFC, 0x22, 0x61, 0x69, 0xF6, 0xFD, 0x41, 0x67, 0xFE, 0x7D, 0x21, 0x6E, 0xFC,
-    0x41, 0x72, 0xFB, 0xF2, 0x41, 0x65, 0xFF, 0x18, 0x21, 0x6C, 0xFC, 0x42, 0x72, 0x75, 0xFB, 0xE7,
-    0xFF, 0xFD, 0x41, 0x68, 0xFB, 0xEA, 0xA0, 0x08, 0x02, 0x21, 0x74, 0xFD, 0xA1, 0x02, 0x93, 0x6C,
-    0xFD, 0xA0, 0x08, 0x53, 0xA1, 0x08, 0x23, 0x72, 0xFD, 0x21, 0xA9, 0xFB, 0x41, 0x6E, 0xF9, 0x80,
-    0x21, 0x69, 0xFC, 0x42, 0x6D, 0x6E, 0xFF, 0xFD, 0xF9, 0x79, 0x42, 0x69, 0x75, 0xFF, 0xF9, 0xF9,
-    0x72, 0x41, 0x72, 0xFB, 0x57, 0x45, 0x61, 0xC3, 0x69, 0x6C, 0x75, 0xFF, 0xD7, 0xFF, 0xE4, 0xFD,
-    0x7D, 0xFF, 0xF5, 0xFF, 0xFC, 0xA0, 0x08, 0x83, 0xA1, 0x02, 0x93, 0x74, 0xFD, 0x21, 0x75, 0xB9,
-    0x21, 0x6C, 0xB6, 0xA3, 0x02, 0x93, 0x61, 0x6C, 0x74, 0xFA, 0xFD, 0xB3, 0xA0, 0x08, 0x23, 0x21,
-    0xA9, 0xFD, 0x42, 0x66, 0x74, 0xFB, 0x26, 0xFB, 0x26, 0x42, 0x6D, 0x6E, 0xF9, 0x06, 0xFF, 0xF9,
-    0x42, 0x66, 0x78, 0xFB, 0x18, 0xFB, 0x18, 0x46, 0x61, 0x65, 0xC3, 0x68, 0x69, 0x6F, 0xFF, 0xD1,
-    0xFF, 0xDC, 0xFF, 0xE8, 0xF9, 0x25, 0xFF, 0xF2, 0xFF, 0xF9, 0x22, 0x62, 0x72, 0xAB, 0xED, 0x41,
-    0x76, 0xFB, 0x50, 0x21, 0x75, 0xFC, 0x48, 0x74, 0x79, 0x61, 0x65, 0x63, 0x68, 0x75, 0x6F, 0xFF,
-    0x4E, 0xFF, 0x57, 0xFF, 0x5A, 0xFF, 0x65, 0xFF, 0x6C, 0xF8, 0xBF, 0xFF, 0xF4, 0xFF, 0xFD, 0xC3,
-    0x00, 0x61, 0x6E, 0x75, 0x76, 0xF9, 0xD1, 0xF9, 0xE4, 0xF9, 0xF0, 0x41, 0x68, 0xF8, 0x9A, 0x43,
-    0x63, 0x6E, 0x74, 0xF9, 0xD7, 0xF9, 0xD7, 0xF9, 0xD7, 0x41, 0x6E, 0xF9, 0xCD, 0x22, 0x61, 0x6F,
-    0xF2, 0xFC, 0x21, 0x69, 0xFB, 0x43, 0x61, 0x68, 0x72, 0xFC, 0x52, 0xF8, 0x80, 0xFF, 0xFD, 0x41,
-    0x2E, 0xFE, 0x2D, 0x21, 0x74, 0xFC, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x21,
-    0x6D, 0xFD, 0x21, 0x65, 0xFD, 0x41, 0x62, 0xFD, 0xD2, 0x21, 0x6F, 0xFC, 0x21, 0x6E, 0xFD, 0x21,
-    0x6F, 0xFD, 0x42, 0x73, 0x74, 0xF7, 0xFF, 0xF7, 0xFF, 0x42, 0x65, 0x69, 0xF7, 0xF8, 0xFF, 0xF9,
-    0x41, 0x78, 0xFD, 0xFC, 0xA2, 0x02, 0x72, 0x6C, 0x75, 0xF5, 0xFC, 0x41, 0x72, 0xFD, 0xF1, 0x42,
-    0xA9, 0xA8, 0xFD, 0x4A, 0xFF, 0xFC, 0xC2, 0x02, 0x72, 0x6C, 0x72, 0xFD, 0xE6, 0xFD, 0xE6, 0x41,
-    0x69, 0xF7, 0xD2, 0xA1, 0x02, 0x72, 0x66, 0xFC, 0x41, 0x73, 0xFD, 0xD4, 0xA1, 0x01, 0xB1, 0x73,
-    0xFC, 0x41, 0x72, 0xFA, 0xC2, 0x47, 0x61, 0xC3, 0x65, 0x69, 0x6F, 0x75, 0x74, 0xFF, 0xCF, 0xFF,
-    0xDA, 0xFF, 0xE1, 0xFF, 0xEE, 0xF9, 0x51, 0xFF, 0xF7, 0xFF, 0xFC, 0x21, 0xA9, 0xEA, 0x41, 0x70,
-    0xF8, 0x3E, 0x42, 0x69, 0x6F, 0xF8, 0x3A, 0xF8, 0x3A, 0x21, 0x73, 0xF9, 0x41, 0x75, 0xF8, 0x30,
-    0x44, 0x61, 0x69, 0x6F, 0x72, 0xFF, 0xEE, 0xFF, 0xF9, 0xFF, 0xFC, 0xF8, 0x8C, 0x41, 0x63, 0xF8,
-    0x22, 0x41, 0x72, 0xF8, 0x1B, 0x41, 0x64, 0xF8, 0x17, 0x21, 0x6E, 0xFC, 0x21, 0x65, 0xFD, 0x41,
-    0x73, 0xF8, 0x0D, 0x21, 0x6E, 0xFC, 0x24, 0x65, 0x69, 0x6C, 0x6F, 0xE7, 0xEB, 0xF6, 0xFD, 0x41,
-    0x69, 0xF8, 0x73, 0x21, 0x75, 0xFC, 0xC1, 0x01, 0xE2, 0x65, 0xFA, 0x36, 0x41, 0x64, 0xF6, 0xDA,
-    0x44, 0x62, 0x67, 0x6E, 0x74, 0xF6, 0xD6, 0xF6, 0xD6, 0xFF, 0xFC, 0xF6, 0xD6, 0x42, 0x6E, 0x72,
-    0xF6, 0xC9, 0xF6, 0xC9, 0x21, 0xA9, 0xF9, 0x42, 0x6D, 0x70, 0xF6, 0xBF, 0xF6, 0xBF, 0x42, 0x63,
-    0x70, 0xF6, 0xB8, 0xF6, 0xB8, 0xA0, 0x07, 0xA2, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x74,
-    0xF7, 0x22, 0x63, 0x6E, 0xFD, 0xF4, 0xA2, 0x00, 0xC2, 0x65, 0x69, 0xF5, 0xFB, 0xC7, 0x01, 0xE2,
-    0x61, 0xC3, 0x69, 0x6F, 0x72, 0x75, 0x79, 0xFF, 0xC3, 0xFF, 0xD7, 0xFF, 0xDA, 0xFF, 0xE1, 0xFF,
-    0xF9, 0xF6, 0x99, 0xF6, 0x99, 0xC5, 0x02, 0x52, 0x63, 0x70, 0x71, 0x73, 0x74, 0xFF, 0x6B, 0xFF,
-    0x91, 0xFF, 0x9E, 0xFF, 0xA1, 0xFF, 0xE8, 0x21, 0x73, 0xEE, 0x42, 0xC3, 0x65, 0xFF, 0x41, 0xFF,
-    0xFD, 0x41, 0x74, 0xF7, 0x02, 0x21, 0x61, 0xFC, 0x53, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x69,
-    0x6D, 0x70, 0x73, 0x6F, 0x6B, 0x74, 0x67, 0x6E, 0x72, 0x6C, 0x75, 0x79, 0xF8, 0xB1, 0xF8, 0xE6,
-    0xF9, 0x32, 0xF9, 0xCA, 0xFB, 0x03, 0xF7, 0x50, 0xFB, 0x2C, 0xFC, 0x27, 0xFD, 0x92, 0xFE, 0x6E,
-    0xFE, 0x87, 0xFE, 0x93, 0xFE, 0xAD, 0xFE, 0xCA, 0xFE, 0xD7, 0xFF, 0xF2, 0xFF, 0xFD, 0xF8, 0x85,
-    0xF8, 0x85, 0xA0, 0x00, 0x81, 0x41, 0xAE, 0xFE, 0x87, 0xA0, 0x02, 0x31, 0x21, 0x2E, 0xFD, 0x21,
-    0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x42, 0x74, 0x65, 0xF8, 0x91, 0xFF, 0xFD, 0x23, 0x68, 0xC3, 0x73,
-    0xE6, 0xE9, 0xF9, 0x21, 0x68, 0xDF, 0xA0, 0x00, 0xA2, 0x21, 0x65, 0xFD, 0x21, 0x72, 0xFD, 0x21,
-    0x64, 0xFD, 0x21, 0xA8, 0xFD, 0xA0, 0x00, 0xE1, 0x21, 0x6C, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x6F,
-    0xFD, 0xA0, 0x00, 0xF2, 0x21, 0x69, 0xFD, 0x21, 0x67, 0xFD, 0x21, 0x6C, 0xFD, 0x22, 0x63, 0x61,
-    0xF1, 0xFD, 0xA0, 0x00, 0xE2, 0x21, 0x69, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0xA9, 0xFD, 0x21, 0xC3,
-    0xFD, 0x21, 0x68, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x73, 0xFD, 0x41, 0x2E, 0xF6, 0x46, 0x21, 0x74,
-    0xFC, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x41, 0x2E, 0xF8, 0xC6, 0x21, 0x74,
-    0xFC, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD,
-    0x21, 0x66, 0xFD, 0x21, 0x69, 0xFD, 0x23, 0x65, 0x69, 0x74, 0xD1, 0xE1, 0xFD, 0x41, 0x74, 0xFE,
-    0x84, 0x21, 0x73, 0xFC, 0x41, 0x72, 0xF8, 0xDB, 0x21, 0x61, 0xFC, 0x22, 0x6F, 0x70, 0xF6, 0xFD,
-    0x41, 0x73, 0xF5, 0xD8, 0x21, 0x69, 0xFC, 0x21, 0x70, 0xFD, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD,
-    0x21, 0x69, 0xFD, 0x21, 0x68, 0xFD, 0xA0, 0x06, 0x41, 0x21, 0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0x41,
-    0x2E, 0xFF, 0x33, 0x21, 0x74, 0xFC, 0x21, 0x6E, 0xFD, 0x22, 0x69, 0x65, 0xF3, 0xFD, 0x22, 0x63,
-    0x6D, 0xE5, 0xFB, 0xA0, 0x02, 0x02, 0x21, 0x6F, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xEA, 0x22,
-    0x74, 0x6D, 0xFA, 0xFD, 0x41, 0x65, 0xFF, 0x1E, 0xA0, 0x03, 0x21, 0x21, 0x2E, 0xFD, 0x21, 0x74,
-    0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x65, 0xFD,
-    0x21, 0x69, 0xFD, 0x21, 0x75, 0xFD, 0x22, 0x63, 0x71, 0xDE, 0xFD, 0x21, 0x73, 0xC8, 0x21, 0x6F,
-    0xFD, 0x21, 0x6E, 0xFD, 0x41, 0x6C, 0xF8, 0x6B, 0x21, 0x69, 0xFC, 0xA0, 0x05, 0xE1, 0x21, 0x2E,
-    0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0x61, 0xFD,
-    0x21, 0x67, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x61, 0xFD, 0x41, 0x6D, 0xFF, 0xA3, 0x4E, 0x62, 0x64,
-    0xC3, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x63, 0x67, 0x76, 0x6D, 0x69, 0x75, 0xFE, 0xCF, 0xFE, 0xD6,
-    0xFE, 0xE5, 0xFF, 0x00, 0xFF, 0x49, 0xFF, 0x5E, 0xFF, 0x91, 0xFF, 0xA2, 0xFF, 0xC9, 0xFF, 0xD4,
-    0xFF, 0xDB, 0xFF, 0xF9, 0xFF, 0xFC, 0xFF, 0xFC, 0x47, 0xA2, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB,
-    0xFE, 0xBD, 0xFE, 0xBD, 0xFE, 0xBD, 0xFE, 0xBD, 0xFE, 0xBD, 0xFE, 0xBD, 0xFE, 0xBD, 0xA0, 0x02,
-    0x41, 0x21, 0x2E, 0xFD, 0xA0, 0x00, 0x41, 0x21, 0x2E, 0xFD, 0x21, 0x74, 0xFD, 0xA3, 0x00, 0xE1,
-    0x2E, 0x73, 0x6E, 0xF1, 0xF4, 0xFD, 0x23, 0x2E, 0x73, 0x6E, 0xE8, 0xEB, 0xF4, 0xA1, 0x00, 0xE2,
-    0x65, 0xF9, 0xA0, 0x02, 0xF1, 0x21, 0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x69, 0xFD, 0x42, 0x74,
-    0x6D, 0xFF, 0xFD, 0xFE, 0xB6, 0xA1, 0x00, 0xE1, 0x75, 0xF9, 0xC2, 0x00, 0xE2, 0x65, 0x75, 0xFF,
-    0xDC, 0xFE, 0xAD, 0x49, 0x61, 0xC3, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x75, 0x79, 0xFE, 0x62, 0xFF,
-    0xA5, 0xFF, 0xCA, 0xFE, 0x62, 0xFF, 0xDA, 0xFF, 0xF2, 0xFF, 0xF7, 0xFE, 0x62, 0xFE, 0x62, 0x43,
-    0x65, 0x69, 0x75, 0xFE, 0x23, 0xFC, 0x9D, 0xFC, 0x9D, 0x41, 0x69, 0xF4, 0xB7, 0xA0, 0x05, 0x92,
-    0x21, 0x65, 0xFD, 0x21, 0x75, 0xFD, 0x22, 0x65, 0x71, 0xF7, 0xFD, 0x21, 0x69, 0xFB, 0x43, 0x65,
-    0x68, 0x72, 0xFE, 0x04, 0xFF, 0xEB, 0xFF, 0xFD, 0x21, 0x72, 0xE5, 0x21, 0x74, 0xFD, 0x21, 0x63,
-    0xFD, 0x21, 0x74, 0xDC, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0xA9, 0xFD,
-    0x41, 0x75, 0xF7, 0x4F, 0x21, 0x71, 0xFC, 0x44, 0x65, 0xC3, 0x69, 0x6F, 0xFF, 0xE7, 0xFF, 0xF6,
-    0xFC, 0x55, 0xFF, 0xFD, 0x21, 0x67, 0xB9, 0x21, 0x72, 0xFD, 0x41, 0x74, 0xF7, 0x35, 0x22, 0x65,
-    0x69, 0xF9, 0xFC, 0xC1, 0x01, 0xC2, 0x65, 0xF4, 0x00, 0x21, 0x70, 0xFA, 0x21, 0x6F, 0xFD, 0x21,
-    0x63, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x69, 0xFD, 0x41, 0x6C, 0xF6, 0xCF, 0x21, 0x6C, 0xFC, 0x21,
-    0x69, 0xFD, 0x41, 0x6C, 0xFE, 0x92, 0x21, 0x61, 0xFC, 0x41, 0x74, 0xFE, 0x0B, 0x21, 0x6F, 0xFC,
-    0x22, 0x76, 0x70, 0xF6, 0xFD, 0x42, 0x69, 0x65, 0xFF, 0xFB, 0xFD, 0x8D, 0x21, 0x75, 0xF9, 0x48,
-    0x63, 0x64, 0x6C, 0x6E, 0x70, 0x6D, 0x71, 0x72, 0xFF, 0x60, 0xFF, 0x7F, 0xFF, 0xA8, 0xFF, 0xBF,
-    0xFF, 0xD6, 0xFF, 0xE0, 0xFF, 0xFD, 0xFE, 0x65, 0x45, 0xA7, 0xA9, 0xA2, 0xA8, 0xB4, 0xFD, 0x8D,
-    0xFF, 0xE7, 0xFE, 0xA1, 0xFE, 0xA1, 0xFE, 0xA1, 0xA0, 0x02, 0xC3, 0x21, 0x74, 0xFD, 0x21, 0x75,
-    0xFD, 0x41, 0x69, 0xFA, 0xC0, 0x41, 0x2E, 0xF3, 0xB5, 0x21, 0x74, 0xFC, 0x21, 0x6E, 0xFD, 0x21,
-    0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0xAA, 0xFD, 0x21, 0xC3, 0xFD, 0xA3, 0x00, 0xE1, 0x6F, 0x70,
-    0x72, 0xE3, 0xE6, 0xFD, 0xA0, 0x06, 0x51, 0x21, 0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x69, 0xFD,
-    0x44, 0x2E, 0x73, 0x6E, 0x76, 0xFE, 0x9E, 0xFE, 0xA1, 0xFE, 0xAA, 0xFF, 0xFD, 0x42, 0x2E, 0x73,
-    0xFE, 0x91, 0xFE, 0x94, 0xA0, 0x03, 0x63, 0x21, 0x63, 0xFD, 0xA0, 0x03, 0x93, 0x21, 0x74, 0xFD,
-    0x21, 0xA9, 0xFD, 0x22, 0x61, 0xC3, 0xF4, 0xFD, 0x21, 0x72, 0xFB, 0xA2, 0x00, 0x81, 0x65, 0x6F,
-    0xE2, 0xFD, 0xC2, 0x00, 0x81, 0x65, 0x6F, 0xFF, 0xDB, 0xFB, 0x6A, 0x41, 0x64, 0xF5, 0x75, 0x21,
-    0x6E, 0xFC, 0x21, 0x65, 0xFD, 0xCD, 0x00, 0xE2, 0x2E, 0x62, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x70,
-    0x72, 0x73, 0x74, 0x77, 0x69, 0xFE, 0x59, 0xFE, 0x5F, 0xFF, 0xBB, 0xFE, 0x5F, 0xFF, 0xE6, 0xFE,
-    0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFF, 0xED, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFF, 0xFD, 0x41,
-    0x6C, 0xF2, 0xB8, 0xA1, 0x00, 0xE1, 0x6C, 0xFC, 0xA0, 0x03, 0xC2, 0xC9, 0x00, 0xE2, 0x2E, 0x62,
-    0x65, 0x66, 0x67, 0x68, 0x70, 0x73, 0x74, 0xFE, 0x23, 0xFE, 0x29, 0xFE, 0x3B, 0xFE, 0x29, 0xFE,
-    0x29, 0xFF, 0xFD, 0xFE, 0x29, 0xFE, 0x29, 0xFE, 0x29, 0xC2, 0x00, 0xE2, 0x65, 0x61, 0xFE, 0x1D,
-    0xFC, 0xEE, 0xA0, 0x03, 0xE1, 0x22, 0x63, 0x71, 0xFD, 0xFD, 0xA0, 0x03, 0xF2, 0x21, 0x63, 0xF5,
-    0x21, 0x72, 0xF2, 0x22, 0x6F, 0x75, 0xFA, 0xFD, 0x21, 0x73, 0xFB, 0x27, 0x63, 0x64, 0x70, 0x72,
-    0x73, 0x75, 0x78, 0xEA, 0xEF, 0xE7, 0xE7, 0xFD, 0xE7, 0xE7, 0xA0, 0x04, 0x12, 0x21, 0xA9, 0xFD,
-    0x23, 0x66, 0x6E, 0x78, 0xD2, 0xD2, 0xD2, 0x41, 0x62, 0xFC, 0x3B, 0x21, 0x72, 0xFC, 0x41, 0x69,
-    0xFF, 0x5D, 0x41, 0x2E, 0xFD, 0xE0, 0x21, 0x74, 0xFC, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x42,
-    0x67, 0x65, 0xFF, 0xFD, 0xF4, 0xBE, 0x21, 0x6E, 0xF9, 0x21, 0x69, 0xFD, 0x41, 0x76, 0xF4, 0xB4,
-    0x21, 0x69, 0xFC, 0x24, 0x75, 0x66, 0x74, 0x6E, 0xD8, 0xDB, 0xF6, 0xFD, 0x41, 0x69, 0xF2, 0xCF,
-    0x21, 0x74, 0xFC, 0x21, 0x69, 0xFD, 0x21, 0x6E, 0xFD, 0x41, 0x6C, 0xF4, 0x97, 0x21, 0x75, 0xFC,
-    0x21, 0x70, 0xFD, 0x21, 0x74, 0xC9, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x70, 0xFD, 0xC7,
-    0x00, 0xE1, 0x61, 0xC3, 0x65, 0x6E, 0x67, 0x72, 0x6D, 0xFF, 0x8C, 0xFF, 0x9E, 0xFF, 0xA1, 0xFF,
-    0xD4, 0xFF, 0xE7, 0xFF, 0xF1, 0xFF, 0xFD, 0x41, 0x93, 0xFB, 0xFE, 0x41, 0x72, 0xF2, 0x88, 0xA1,
-    0x00, 0xE1, 0x72, 0xFC, 0xC1, 0x00, 0xE1, 0x72, 0xFE, 0x7D, 0x41, 0x64, 0xF2, 0x79, 0x21, 0x69,
-    0xFC, 0x4D, 0x61, 0xC3, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6F, 0xC5, 0x72, 0x75, 0x79, 0x63, 0xFE,
-    0x8A, 0xFD, 0x27, 0xFD, 0x4C, 0xFE, 0xE4, 0xFF, 0x12, 0xFF, 0x1A, 0xFF, 0x38, 0xFF, 0xCE, 0xFF,
-    0xE6, 0xFD, 0x5C, 0xFF, 0xEE, 0xFF, 0xF3, 0xFF, 0xFD, 0x41, 0x63, 0xFC, 0x7B, 0xC3, 0x00, 0xE1,
-    0x61, 0x6B, 0x65, 0xFF, 0xFC, 0xFD, 0x17, 0xFD, 0x29, 0x41, 0x63, 0xFF, 0x53, 0x21, 0x69, 0xFC,
-    0x21, 0x66, 0xFD, 0x21, 0x69, 0xFD, 0xA1, 0x00, 0xE1, 0x6E, 0xFD, 0x41, 0x74, 0xF2, 0x5A, 0xA1,
-    0x00, 0x91, 0x65, 0xFC, 0x21, 0x6C, 0xFB, 0xC3, 0x00, 0xE1, 0x6C, 0x6D, 0x74, 0xFF, 0xFD, 0xFC,
-    0x45, 0xFB, 0x1A, 0x41, 0x6C, 0xFF, 0x29, 0x21, 0x61, 0xFC, 0x21, 0x76, 0xFD, 0x41, 0x61, 0xF2,
-    0xF5, 0x21, 0xA9, 0xFC, 0x21, 0xC3, 0xFD, 0x21, 0x72, 0xFD, 0x22, 0x6F, 0x74, 0xF0, 0xFD, 0xA0,
-    0x04, 0xC3, 0x21, 0x67, 0xFD, 0x21, 0xA2, 0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65,
-    0xFD, 0xA2, 0x00, 0xE1, 0x6E, 0x79, 0xE9, 0xFD, 0x41, 0x6E, 0xFF, 0x2B, 0x21, 0x6F, 0xFC, 0xA1,
-    0x00, 0xE1, 0x63, 0xFD, 0x47, 0xA2, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB, 0xFB, 0x41, 0xFF, 0xFB,
-    0xFB, 0x41, 0xFB, 0x41, 0xFB, 0x41, 0xFB, 0x41, 0xFB, 0x41, 0xC2, 0x00, 0xE1, 0x2E, 0x73, 0xFC,
-    0x84, 0xFC, 0x87, 0x41, 0x6F, 0xFB, 0x3F, 0x42, 0x6D, 0x73, 0xFF, 0xFC, 0xFB, 0x3E, 0x41, 0x73,
-    0xFB, 0x34, 0x22, 0xA9, 0xA8, 0xF5, 0xFC, 0x21, 0xC3, 0xFB, 0xA0, 0x02, 0xA2, 0x4A, 0x75, 0x69,
-    0x6F, 0x61, 0xC3, 0x65, 0x6E, 0xC5, 0x73, 0x79, 0xFF, 0x69, 0xFF, 0x7A, 0xFF, 0xB4, 0xFB, 0x08,
-    0xFF, 0xC7, 0xFF, 0xDD, 0xFF, 0xFA, 0xFF, 0x0A, 0xFF, 0xFD, 0xFB, 0x08, 0x41, 0x63, 0xF3, 0x54,
-    0x21, 0x69, 0xFC, 0x41, 0x67, 0xFE, 0x89, 0x21, 0x72, 0xFC, 0x21, 0x75, 0xFD, 0x41, 0x61, 0xF3,
-    0x46, 0xC4, 0x00, 0xE1, 0x74, 0x67, 0x73, 0x6D, 0xFF, 0xEF, 0xF1, 0x62, 0xFF, 0xF9, 0xFF, 0xFC,
-    0x47, 0xA9, 0xA2, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB, 0xFF, 0xF1, 0xFA, 0xC5, 0xFA, 0xC5, 0xFA, 0xC5,
-    0xFA, 0xC5, 0xFA, 0xC5, 0xFA, 0xC5, 0x41, 0x67, 0xF1, 0x3D, 0xC2, 0x00, 0xE1, 0x6E, 0x6D, 0xFF,
-    0xFC, 0xFB, 0x62, 0x42, 0x65, 0x69, 0xFA, 0x7F, 0xF8, 0xF9, 0xC5, 0x00, 0xE1, 0x6C, 0x70, 0x2E,
-    0x73, 0x6E, 0xFF, 0xF9, 0xFB, 0x5A, 0xFB, 0xF4, 0xFB, 0xF7, 0xFC, 0x00, 0xC1, 0x00, 0xE1, 0x6C,
-    0xFB, 0x48, 0x41, 0x6D, 0xF1, 0x11, 0x41, 0x61, 0xF0, 0xC1, 0x21, 0x6F, 0xFC, 0x21, 0x69, 0xFD,
-    0xC3, 0x00, 0xE1, 0x6D, 0x69, 0x64, 0xFB, 0x2C, 0xFF, 0xF2, 0xFF, 0xFD, 0x41, 0x68, 0xF8, 0xC0,
-    0xA1, 0x00, 0xE1, 0x74, 0xFC, 0xA0, 0x07, 0xC2, 0x21, 0x72, 0xFD, 0x43, 0x2E, 0x73, 0x75, 0xFB,
-    0xB3, 0xFB, 0xB6, 0xFF, 0xFD, 0x21, 0x64, 0xF3, 0xA2, 0x00, 0xE2, 0x65, 0x79, 0xF3, 0xFD, 0x4A,
-    0xC3, 0x69, 0x63, 0x6D, 0x65, 0x75, 0x61, 0x79, 0x68, 0x6F, 0xFF, 0x81, 0xFF, 0x9B, 0xFB, 0x39,
-    0xFB, 0x39, 0xFF, 0xAB, 0xFF, 0xBD, 0xFF, 0xD1, 0xFF, 0xE1, 0xFF, 0xF9, 0xFA, 0x46, 0xA0, 0x03,
-    0x11, 0x21, 0x2E, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x22, 0x63, 0x7A,
-    0xFD, 0xFD, 0x21, 0x6F, 0xFB, 0x21, 0x64, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x76,
-    0xFD, 0x21, 0x6E, 0xE9, 0x21, 0x69, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0xA9, 0xFD, 0x42, 0xC3, 0x73,
-    0xFF, 0xFD, 0xF3, 0x42, 0x21, 0xA9, 0xF9, 0x41, 0x6E, 0xFA, 0x3D, 0x21, 0x69, 0xFC, 0x21, 0x6D,
-    0xFD, 0x21, 0xA9, 0xFD, 0x41, 0x74, 0xF4, 0xB0, 0x22, 0xC3, 0x73, 0xF9, 0xFC, 0xC5, 0x00, 0xE2,
-    0x69, 0x75, 0xC3, 0x6F, 0x65, 0xFF, 0xD1, 0xFD, 0xED, 0xFF, 0xE7, 0xFF, 0xFB, 0xFB, 0x49, 0x41,
-    0x65, 0xF0, 0x5C, 0x21, 0x6C, 0xFC, 0x42, 0x62, 0x63, 0xFF, 0xFD, 0xF0, 0x55, 0x21, 0x61, 0xF9,
-    0x21, 0x6E, 0xFD, 0xC3, 0x00, 0xE1, 0x67, 0x70, 0x73, 0xFF, 0xFD, 0xFC, 0x3E, 0xFC, 0x3E, 0x41,
-    0x6D, 0xF2, 0x05, 0x44, 0x61, 0x65, 0x69, 0x6F, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xFF, 0xFC,
-    0x21, 0x6C, 0xF3, 0x21, 0x6C, 0xFD, 0x21, 0x69, 0xFD, 0xA0, 0x06, 0xD2, 0x21, 0xA9, 0xFD, 0x21,
-    0xC3, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD, 0xA2, 0x00, 0xE1, 0x70, 0x6C,
-    0xEB, 0xFD, 0x42, 0xA9, 0xA8, 0xF5, 0x47, 0xF5, 0x47, 0x48, 0x76, 0x61, 0x65, 0xC3, 0x69, 0x6F,
-    0x73, 0x75, 0xFD, 0xEE, 0xF1, 0x6D, 0xF1, 0x6D, 0xFF, 0xF9, 0xF1, 0x6D, 0xF1, 0x6D, 0xF1, 0x6D,
-    0xF1, 0x6D, 0x21, 0x79, 0xE7, 0x41, 0x65, 0xFC, 0xAD, 0x21, 0x72, 0xFC, 0x21, 0x74, 0xFD, 0x21,
-    0x73, 0xFD, 0xA2, 0x00, 0xE1, 0x6C, 0x61, 0xF0, 0xFD, 0xC2, 0x00, 0xE2, 0x75, 0x65, 0xF9, 0x7E,
-    0xFA, 0xAD, 0x43, 0x6D, 0x74, 0x68, 0xFE, 0x5B, 0xF1, 0xA4, 0xEF, 0x15, 0xC4, 0x00, 0xE1, 0x72,
-    0x2E, 0x73, 0x6E, 0xFF, 0xF6, 0xFA, 0x82, 0xFA, 0x85, 0xFA, 0x8E, 0x41, 0x6C, 0xEF, 0x95, 0x21,
-    0x75, 0xFC, 0xA0, 0x06, 0xF3, 0x21, 0x71, 0xFD, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD, 0xA2, 0x00,
-    0xE1, 0x6E, 0x72, 0xF1, 0xFD, 0x47, 0xA2, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB, 0xF9, 0x00, 0xFF,
-    0xF9, 0xF9, 0x00, 0xF9, 0x00, 0xF9, 0x00, 0xF9, 0x00, 0xF9, 0x00, 0xC1, 0x00, 0x81, 0x65, 0xFB,
-    0xB2, 0x41, 0x73, 0xEF, 0x26, 0x21, 0x6F, 0xFC, 0x21, 0x74, 0xFD, 0xA0, 0x07, 0x62, 0x21, 0xA9,
-    0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x73, 0xF4, 0xA2, 0x00, 0x41, 0x61, 0x69, 0xFA,
-    0xFD, 0xC8, 0x00, 0xE2, 0x2E, 0x65, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0xFA, 0x1D, 0xFA, 0x35,
-    0xFF, 0xDA, 0xFA, 0x23, 0xFF, 0xE7, 0xFF, 0xDA, 0xFA, 0x23, 0xFF, 0xF9, 0x41, 0xA9, 0xF8, 0xC6,
-    0x41, 0x75, 0xF8, 0xC2, 0x22, 0xC3, 0x65, 0xF8, 0xFC, 0x41, 0x68, 0xF8, 0xB9, 0x21, 0x63, 0xFC,
-    0x21, 0x79, 0xFD, 0x41, 0x72, 0xF8, 0xAF, 0x22, 0xA8, 0xA9, 0xFC, 0xFC, 0x21, 0xC3, 0xFB, 0x4D,
-    0x72, 0x75, 0x61, 0x69, 0x6F, 0x6C, 0x65, 0xC3, 0x68, 0x6E, 0x73, 0x74, 0x79, 0xFE, 0xAE, 0xFE,
-    0xD4, 0xFF, 0x0C, 0xFC, 0x95, 0xFF, 0x43, 0xFF, 0x4A, 0xFF, 0x5D, 0xFF, 0x86, 0xFF, 0xC2, 0xFF,
-    0xE5, 0xFF, 0xF1, 0xFF, 0xFD, 0xF8, 0x86, 0x41, 0x63, 0xF1, 0xA8, 0x21, 0x6F, 0xFC, 0x41, 0x64,
-    0xF1, 0xA1, 0x21, 0x69, 0xFC, 0x41, 0x67, 0xF1, 0x9A, 0x41, 0x67, 0xF0, 0xB7, 0x21, 0x6C, 0xFC,
-    0x41, 0x6C, 0xF1, 0x8F, 0x23, 0x69, 0x75, 0x6F, 0xF1, 0xF9, 0xFC, 0x41, 0x67, 0xF8, 0x89, 0x21,
-    0x69, 0xFC, 0x21, 0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0x42, 0x65, 0x69, 0xFF, 0xFD, 0xF6, 0x84, 0x42,
-    0x74, 0x6F, 0xF9, 0xAC, 0xFF, 0xE1, 0x41, 0x74, 0xF8, 0x1F, 0x21, 0x61, 0xFC, 0x21, 0x6D, 0xFD,
-    0x21, 0x72, 0xFD, 0x21, 0x6F, 0xFD, 0x26, 0x6E, 0x63, 0x64, 0x74, 0x73, 0x66, 0xB5, 0xBC, 0xCE,
-    0xE2, 0xE9, 0xFD, 0x41, 0xA9, 0xF8, 0xB0, 0x42, 0x61, 0x6F, 0xF8, 0xAC, 0xF8, 0xAC, 0x22, 0xC3,
-    0x69, 0xF5, 0xF9, 0x42, 0x65, 0x68, 0xF7, 0xCF, 0xFF, 0xFB, 0x41, 0x74, 0xFC, 0xE0, 0x21, 0x61,
-    0xFC, 0x22, 0x63, 0x74, 0xF2, 0xFD, 0x41, 0x2E, 0xF0, 0xE1, 0x21, 0x74, 0xFC, 0x21, 0x6E, 0xFD,
-    0x21, 0x65, 0xFD, 0x21, 0x63, 0xFD, 0x42, 0x73, 0x6E, 0xFF, 0xFD, 0xF1, 0x19, 0x41, 0x6E, 0xF1,
-    0x12, 0x22, 0x69, 0x61, 0xF5, 0xFC, 0x42, 0x75, 0x6F, 0xFF, 0x68, 0xF9, 0xD4, 0x22, 0x6D, 0x70,
-    0xF4, 0xF9, 0xA0, 0x00, 0xA1, 0x21, 0x69, 0xFD, 0x21, 0x67, 0xFD, 0x21, 0x72, 0xF7, 0x21, 0x68,
-    0xFD, 0x21, 0x74, 0xFD, 0x22, 0x6C, 0x72, 0xF4, 0xFD, 0x41, 0x6C, 0xF7, 0x69, 0x41, 0x72, 0xFA,
-    0x24, 0x41, 0x74, 0xFA, 0xF9, 0x21, 0x63, 0xFC, 0x21, 0x79, 0xDA, 0x22, 0x61, 0x78, 0xFA, 0xFD,
-    0x41, 0x61, 0xF2, 0x17, 0x49, 0x6E, 0x73, 0x6D, 0x61, 0xC3, 0x6C, 0x62, 0x6F, 0x76, 0xFF, 0x72,
-    0xFF, 0x9D, 0xFF, 0xC9, 0xFF, 0xE0, 0xF7, 0x7E, 0xFF, 0xE5, 0xFF, 0xE9, 0xFF, 0xF7, 0xFF, 0xFC,
-    0x41, 0x70, 0xF8, 0x13, 0x43, 0x65, 0x6F, 0x68, 0xF7, 0x3E, 0xFF, 0xFC, 0xF8, 0x0F, 0x41, 0x69,
-    0xF5, 0xAE, 0x22, 0x63, 0x74, 0xF2, 0xFC, 0xA0, 0x05, 0xB3, 0x21, 0x72, 0xFD, 0x21, 0x76, 0xFD,
-    0x41, 0x65, 0xFE, 0xF9, 0x21, 0x72, 0xFC, 0x22, 0x69, 0x74, 0xF6, 0xFD, 0x41, 0x61, 0xFF, 0xA5,
-    0x21, 0x74, 0xFC, 0x21, 0x73, 0xFD, 0xC2, 0x01, 0x71, 0x63, 0x69, 0xED, 0x74, 0xED, 0x74, 0x21,
-    0x61, 0xF7, 0x21, 0x72, 0xFD, 0x21, 0x74, 0xFD, 0x45, 0x73, 0x6E, 0x75, 0x78, 0x72, 0xFF, 0xCA,
-    0xFF, 0xDF, 0xFF, 0xEB, 0xFF, 0xFD, 0xF8, 0x31, 0xC1, 0x00, 0xE1, 0x6D, 0xF7, 0xC4, 0x41, 0x61,
-    0xF9, 0xFD, 0x41, 0x6D, 0xFA, 0xAA, 0x21, 0x69, 0xFC, 0x21, 0x72, 0xFD, 0xA2, 0x00, 0xE1, 0x63,
-    0x74, 0xF2, 0xFD, 0x47, 0xA2, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB, 0xF6, 0xF2, 0xFF, 0xF9, 0xF6,
-    0xF2, 0xF6, 0xF2, 0xF6, 0xF2, 0xF6, 0xF2, 0xF6, 0xF2, 0x41, 0x68, 0xFB, 0xD1, 0x41, 0x70, 0xED,
-    0x6E, 0x21, 0x6F, 0xFC, 0x43, 0x73, 0x63, 0x74, 0xFA, 0x6A, 0xFF, 0xFD, 0xF8, 0x57, 0x41, 0x69,
-    0xFE, 0x77, 0x41, 0x2E, 0xEE, 0x5F, 0x21, 0x74, 0xFC, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21,
-    0x6D, 0xFD, 0x21, 0x67, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x68, 0xFD, 0x21, 0x70,
-    0xFD, 0xA3, 0x00, 0xE1, 0x73, 0x6C, 0x61, 0xD3, 0xDD, 0xFD, 0xA0, 0x05, 0x52, 0x21, 0x6C, 0xFD,
-    0x21, 0x64, 0xFA, 0x21, 0x75, 0xFD, 0x22, 0x61, 0x6F, 0xF7, 0xFD, 0x41, 0x6E, 0xF7, 0xEF, 0x21,
-    0x65, 0xFC, 0x4D, 0x27, 0x61, 0xC3, 0x64, 0x65, 0x69, 0x68, 0x6C, 0x6F, 0x72, 0x73, 0x75, 0x79,
-    0xF6, 0x83, 0xFF, 0x76, 0xFF, 0x91, 0xFF, 0xA7, 0xF7, 0xEB, 0xFF, 0xDF, 0xFF, 0xF4, 0xFF, 0xFD,
-    0xF6, 0x83, 0xF7, 0xFB, 0xFB, 0x78, 0xF6, 0x83, 0xF6, 0x83, 0x41, 0x63, 0xFA, 0x33, 0x41, 0x72,
-    0xF6, 0xA6, 0xA1, 0x01, 0xC2, 0x61, 0xFC, 0x41, 0x73, 0xEF, 0xDE, 0xC2, 0x05, 0x23, 0x63, 0x74,
-    0xF0, 0x03, 0xFF, 0xFC, 0x45, 0x70, 0x61, 0x68, 0x6F, 0x75, 0xFF, 0xEE, 0xFF, 0xF7, 0xEC, 0xAD,
-    0xF0, 0x56, 0xF0, 0x56, 0x21, 0x73, 0xF0, 0x21, 0x6E, 0xFD, 0xC4, 0x00, 0xE2, 0x69, 0x75, 0x61,
-    0x65, 0xFA, 0x40, 0xFF, 0xD0, 0xFF, 0xFD, 0xF7, 0x9C, 0x41, 0x79, 0xFB, 0x9D, 0x21, 0x68, 0xFC,
-    0xC3, 0x00, 0xE1, 0x6E, 0x6D, 0x63, 0xFB, 0x66, 0xF6, 0xCC, 0xFF, 0xFD, 0x41, 0x6D, 0xFB, 0xEE,
-    0x21, 0x61, 0xFC, 0x21, 0x72, 0xFD, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x70, 0xFD, 0x41,
-    0x6D, 0xEE, 0x61, 0x21, 0x61, 0xFC, 0x42, 0x74, 0x2E, 0xFF, 0xFD, 0xF7, 0x48, 0xC5, 0x00, 0xE1,
-    0x72, 0x6D, 0x73, 0x2E, 0x6E, 0xFB, 0x39, 0xFF, 0xEF, 0xFF, 0xF9, 0xF7, 0x41, 0xF7, 0x4D, 0xC2,
-    0x00, 0x81, 0x69, 0x65, 0xF3, 0x22, 0xF8, 0x9E, 0x41, 0x73, 0xEB, 0xD9, 0x21, 0x6F, 0xFC, 0x21,
-    0x6D, 0xFD, 0x44, 0x2E, 0x73, 0x72, 0x75, 0xF7, 0x1C, 0xF7, 0x1F, 0xFF, 0xFD, 0xFB, 0x66, 0xC7,
-    0x00, 0xE2, 0x72, 0x2E, 0x65, 0x6C, 0x6D, 0x6E, 0x73, 0xFF, 0xE0, 0xF7, 0x0F, 0xFF, 0xF3, 0xF7,
-    0x15, 0xF7, 0x15, 0xF7, 0x15, 0xF7, 0x15, 0x41, 0x62, 0xF9, 0x76, 0x41, 0x73, 0xEC, 0x06, 0x21,
-    0x67, 0xFC, 0xC3, 0x00, 0xE1, 0x72, 0x6D, 0x6E, 0xFF, 0xF5, 0xF6, 0x4A, 0xFF, 0xFD, 0xC2, 0x00,
-    0xE1, 0x6D, 0x72, 0xF6, 0x3E, 0xF9, 0x8D, 0x42, 0x62, 0x70, 0xEB, 0x8A, 0xEB, 0x8A, 0x44, 0x65,
-    0x69, 0x6F, 0x73, 0xEB, 0x83, 0xEB, 0x83, 0xFF, 0xF9, 0xEB, 0x83, 0x21, 0xA9, 0xF3, 0x21, 0xC3,
-    0xFD, 0xA1, 0x00, 0xE1, 0x6C, 0xFD, 0x48, 0xA2, 0xA0, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB, 0xF5,
-    0x5F, 0xF5, 0x5F, 0xFF, 0xFB, 0xF5, 0x5F, 0xF5, 0x5F, 0xF5, 0x5F, 0xF5, 0x5F, 0xF5, 0x5F, 0x41,
-    0x74, 0xF1, 0x2A, 0x21, 0x6E, 0xFC, 0x21, 0x69, 0xFD, 0x21, 0x68, 0xFD, 0x41, 0x6C, 0xFA, 0x2E,
-    0x4B, 0x72, 0x61, 0x65, 0x68, 0x75, 0x6F, 0xC3, 0x63, 0x69, 0x74, 0x79, 0xFF, 0x0A, 0xFF, 0x20,
-    0xFF, 0x4D, 0xFF, 0x7F, 0xFF, 0xA2, 0xFF, 0xAE, 0xFF, 0xD6, 0xFF, 0xF9, 0xF5, 0x35, 0xFF, 0xFC,
-    0xF5, 0x35, 0xC1, 0x00, 0xE1, 0x63, 0xF8, 0xEB, 0x47, 0xA2, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB,
-    0xF5, 0x0D, 0xFF, 0xFA, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0x41, 0x75,
-    0xFF, 0x01, 0x21, 0x68, 0xFC, 0xC2, 0x00, 0xE1, 0x72, 0x63, 0xF5, 0x32, 0xFF, 0xFD, 0xC2, 0x00,
-    0xE2, 0x65, 0x61, 0xF6, 0x58, 0xF3, 0x41, 0x41, 0x74, 0xF6, 0x64, 0xC2, 0x00, 0xE2, 0x65, 0x69,
-    0xF6, 0x4B, 0xFF, 0xFC, 0x4A, 0x61, 0xC3, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x73, 0x75, 0x79, 0xFD,
-    0xC4, 0xFF, 0xC4, 0xF6, 0x39, 0xFF, 0xE1, 0xFF, 0xEA, 0xF4, 0xD1, 0xFF, 0xF7, 0xF9, 0xC6, 0xFD,
-    0xC4, 0xF4, 0xD1, 0x45, 0x61, 0x65, 0x69, 0x6F, 0x79, 0xF4, 0xCF, 0xF4, 0xCF, 0xF4, 0xCF, 0xF4,
-    0xCF, 0xF4, 0xCF, 0x41, 0x75, 0xFA, 0x87, 0x21, 0x71, 0xFC, 0x21, 0x6F, 0xFD, 0x21, 0x6C, 0xFD,
-    0x21, 0x69, 0xFD, 0x21, 0x64, 0xFD, 0x42, 0x6D, 0x6E, 0xF2, 0xE6, 0xFF, 0xFD, 0xC2, 0x00, 0xE2,
-    0x65, 0x61, 0xF5, 0xF9, 0xFF, 0xF9, 0xC1, 0x00, 0xE1, 0x65, 0xF5, 0xF0, 0x4C, 0x61, 0xC3, 0x65,
-    0x68, 0x69, 0x6C, 0x6E, 0x6F, 0x72, 0x75, 0x73, 0x79, 0xF4, 0x79, 0xF5, 0xBC, 0xF5, 0xE1, 0xFF,
-    0xC7, 0xF7, 0xA7, 0xF5, 0xF1, 0xF5, 0xF1, 0xF4, 0x79, 0xFF, 0xF1, 0xFF, 0xFA, 0xF9, 0x6E, 0xF4,
-    0x79, 0x41, 0x69, 0xEF, 0xBB, 0x21, 0x75, 0xFC, 0x42, 0x71, 0x2E, 0xFF, 0xFD, 0xF5, 0xA6, 0xC5,
-    0x00, 0xE1, 0x72, 0x6D, 0x73, 0x2E, 0x6E, 0xEA, 0xD7, 0xF6, 0x80, 0xFF, 0xF9, 0xF5, 0x9F, 0xF5,
-    0xAB, 0x41, 0x69, 0xF6, 0xD1, 0x42, 0x6C, 0x73, 0xFF, 0xFC, 0xEB, 0x02, 0xA0, 0x02, 0xD2, 0x21,
-    0x68, 0xFD, 0x42, 0xC3, 0x61, 0xFA, 0x3F, 0xFF, 0xFD, 0xC2, 0x06, 0x02, 0x6F, 0x73, 0xF5, 0x12,
-    0xF5, 0x12, 0x21, 0x72, 0xF7, 0x21, 0x65, 0xFD, 0xC5, 0x00, 0xE1, 0x63, 0x62, 0x6D, 0x72, 0x70,
-    0xFD, 0xB2, 0xFF, 0xDD, 0xF4, 0xC4, 0xFF, 0xEA, 0xFF, 0xFD, 0x41, 0x6C, 0xFC, 0x26, 0xA1, 0x00,
-    0xE2, 0x75, 0xFC, 0x21, 0x72, 0xFB, 0x41, 0x61, 0xF4, 0x0C, 0x21, 0x69, 0xFC, 0x21, 0x74, 0xFD,
-    0x41, 0x6D, 0xF4, 0x02, 0x21, 0x72, 0xFC, 0x41, 0x6C, 0xF3, 0xFB, 0x41, 0x6F, 0xF8, 0xC3, 0x22,
-    0x65, 0x72, 0xF8, 0xFC, 0x45, 0x6F, 0x61, 0x65, 0x68, 0x69, 0xFF, 0xDF, 0xFF, 0xE9, 0xFF, 0xF0,
-    0xFB, 0x48, 0xFF, 0xFB, 0x41, 0x6F, 0xF6, 0x5E, 0x42, 0x6C, 0x76, 0xFF, 0xFC, 0xF3, 0xDA, 0x41,
-    0x76, 0xF3, 0xD3, 0x22, 0x61, 0x6F, 0xF5, 0xFC, 0x41, 0x70, 0xFB, 0x11, 0x41, 0xA9, 0xFB, 0x17,
-    0x21, 0xC3, 0xFC, 0x41, 0x70, 0xF3, 0xBF, 0xC3, 0x00, 0xE2, 0x2E, 0x65, 0x73, 0xF4, 0xF7, 0xF6,
-    0x66, 0xF4, 0xFD, 0x24, 0x61, 0x6C, 0x6F, 0x68, 0xE5, 0xED, 0xF0, 0xF4, 0x41, 0x6D, 0xF9, 0x29,
-    0xC6, 0x00, 0xE2, 0x2E, 0x65, 0x6D, 0x6F, 0x72, 0x73, 0xF4, 0xDE, 0xF4, 0xF6, 0xF4, 0xE4, 0xFF,
-    0xFC, 0xF4, 0xE4, 0xF4, 0xE4, 0x41, 0x64, 0xF3, 0x8D, 0x21, 0x72, 0xFC, 0x21, 0x61, 0xFD, 0x21,
-    0x64, 0xFD, 0x21, 0x6E, 0xFD, 0x41, 0x6E, 0xF3, 0x7D, 0x21, 0x69, 0xFC, 0xA0, 0x07, 0xE2, 0x21,
-    0x73, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0xA9,
-    0xFD, 0x41, 0x67, 0xFF, 0x5F, 0x41, 0x6B, 0xF3, 0x5D, 0x42, 0x63, 0x6D, 0xFF, 0xFC, 0xFF, 0x62,
-    0x41, 0x74, 0xFA, 0x90, 0x21, 0x63, 0xFC, 0x42, 0x6F, 0x75, 0xFF, 0x81, 0xFF, 0xFD, 0x41, 0x65,
-    0xF3, 0x44, 0x21, 0x6C, 0xFC, 0x27, 0x61, 0x65, 0xC3, 0x69, 0x6F, 0x72, 0x79, 0xBD, 0xC4, 0xD9,
-    0xDC, 0xE4, 0xF2, 0xFD, 0x4D, 0x65, 0x75, 0x70, 0x6C, 0x61, 0xC3, 0x63, 0x68, 0x69, 0x6F, 0xC5,
-    0x74, 0x79, 0xFE, 0xCB, 0xFF, 0x04, 0xFF, 0x40, 0xFF, 0x5F, 0xF3, 0x11, 0xF4, 0x54, 0xFF, 0x7F,
-    0xFF, 0x8C, 0xF3, 0x11, 0xF3, 0x11, 0xF7, 0x13, 0xFF, 0xF1, 0xF3, 0x11, 0x41, 0x69, 0xF3, 0x97,
-    0x21, 0x6E, 0xFC, 0x21, 0x6F, 0xFD, 0x22, 0x6D, 0x73, 0xFD, 0xF6, 0x21, 0x6F, 0xFB, 0x21, 0x6E,
-    0xFD, 0x41, 0x75, 0xED, 0x66, 0x41, 0x73, 0xEC, 0x54, 0x21, 0x64, 0xFC, 0x21, 0x75, 0xFD, 0x41,
-    0x6F, 0xF6, 0xA4, 0x42, 0x73, 0x70, 0xEA, 0xC3, 0xFF, 0xFC, 0x21, 0x69, 0xF9, 0x43, 0x6D, 0x62,
-    0x6E, 0xF3, 0x6F, 0xFF, 0xEF, 0xFF, 0xFD, 0x41, 0x67, 0xF3, 0x5C, 0x21, 0x6E, 0xFC, 0x21, 0x6F,
-    0xFD, 0x21, 0x6C, 0xFD, 0x41, 0x65, 0xFA, 0x82, 0x21, 0x74, 0xFC, 0x41, 0x6E, 0xFA, 0xEA, 0x21,
-    0x6F, 0xFC, 0x42, 0x73, 0x74, 0xF7, 0x88, 0xF7, 0x88, 0x41, 0x6F, 0xF7, 0x81, 0x21, 0x72, 0xFC,
-    0x21, 0xA9, 0xFD, 0x41, 0x6D, 0xF7, 0x77, 0x41, 0x75, 0xF7, 0x73, 0x42, 0x64, 0x74, 0xF7, 0x6F,
-    0xFF, 0xFC, 0x41, 0x6E, 0xF7, 0x68, 0x21, 0x6F, 0xFC, 0x21, 0x69, 0xFD, 0x21, 0x74, 0xFD, 0x21,
-    0x63, 0xFD, 0x22, 0x61, 0x69, 0xE9, 0xFD, 0x25, 0x61, 0xC3, 0x69, 0x6F, 0x72, 0xCB, 0xD9, 0xDC,
-    0xDC, 0xFB, 0x21, 0x74, 0xF5, 0x41, 0x61, 0xE9, 0x22, 0x21, 0x79, 0xFC, 0x4B, 0x67, 0x70, 0x6D,
-    0x72, 0x62, 0x63, 0x64, 0xC3, 0x69, 0x73, 0x78, 0xFF, 0x72, 0xFF, 0x75, 0xFF, 0x91, 0xF3, 0x5D,
-    0xFF, 0xA5, 0xFF, 0xAC, 0xFD, 0x10, 0xF2, 0x46, 0xFF, 0xB3, 0xFF, 0xF6, 0xFF, 0xFD, 0x41, 0x6E,
-    0xE8, 0xBD, 0xA1, 0x00, 0xE1, 0x67, 0xFC, 0x46, 0x61, 0x65, 0x69, 0x6F, 0x75, 0x72, 0xFF, 0xFB,
-    0xF3, 0x86, 0xF2, 0x1E, 0xF2, 0x1E, 0xF2, 0x1E, 0xF2, 0x3B, 0xA0, 0x01, 0x71, 0x21, 0xA9, 0xFD,
-    0x21, 0xC3, 0xFD, 0x41, 0x74, 0xE8, 0x44, 0x21, 0x70, 0xFC, 0x22, 0x69, 0x6F, 0xF6, 0xFD, 0xA1,
-    0x00, 0xE1, 0x6D, 0xFB, 0x47, 0xA2, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB, 0xF1, 0xF1, 0xFF, 0xFB,
-    0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0x41, 0xA9, 0xE9, 0x74, 0xC7, 0x06,
-    0x02, 0x61, 0x65, 0xC3, 0x69, 0x6F, 0x73, 0x75, 0xF2, 0xCD, 0xF2, 0xCD, 0xFF, 0xFC, 0xF2, 0xCD,
-    0xF2, 0xCD, 0xF2, 0xCD, 0xF2, 0xCD, 0x21, 0x72, 0xE8, 0x47, 0x61, 0x65, 0xC3, 0x69, 0x6F, 0x73,
-    0x75, 0xE9, 0xBD, 0xE9, 0xBD, 0xED, 0x93, 0xE9, 0xBD, 0xE9, 0xBD, 0xE9, 0xBD, 0xE9, 0xBD, 0x22,
-    0x65, 0x6F, 0xE7, 0xEA, 0xA1, 0x00, 0xE1, 0x70, 0xFB, 0x47, 0x61, 0xC3, 0x65, 0x69, 0x6F, 0x75,
-    0x79, 0xF1, 0x9C, 0xFF, 0xAB, 0xF6, 0x71, 0xF4, 0xCA, 0xF1, 0x9C, 0xFA, 0x8F, 0xFF, 0xFB, 0x41,
-    0x76, 0xF3, 0xC0, 0x41, 0x76, 0xE8, 0x54, 0x41, 0x78, 0xE8, 0x50, 0x22, 0x6F, 0x61, 0xF8, 0xFC,
-    0x21, 0x69, 0xFB, 0x41, 0x72, 0xF2, 0x20, 0x21, 0x74, 0xFC, 0x45, 0x63, 0x65, 0x76, 0x6E, 0x73,
-    0xF2, 0x5E, 0xFF, 0xE5, 0xF2, 0x5E, 0xFF, 0xF6, 0xFF, 0xFD, 0x42, 0x6E, 0x73, 0xE9, 0xBA, 0xE9,
-    0xBA, 0x21, 0x69, 0xF9, 0x21, 0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x69, 0xFD, 0xC2, 0x00, 0xE1,
-    0x63, 0x6E, 0xF3, 0x82, 0xFF, 0xFD, 0xC2, 0x00, 0xE1, 0x6C, 0x64, 0xF4, 0x69, 0xF9, 0xE8, 0x41,
-    0x74, 0xF7, 0x1B, 0x21, 0x6F, 0xFC, 0x21, 0x70, 0xFD, 0x21, 0x69, 0xFD, 0x42, 0x72, 0x2E, 0xFF,
-    0xFD, 0xF2, 0x88, 0x42, 0x69, 0x74, 0xEF, 0x79, 0xFF, 0xF9, 0xC3, 0x00, 0xE1, 0x6E, 0x2E, 0x73,
-    0xFF, 0xF9, 0xF2, 0x74, 0xF2, 0x77, 0x41, 0x69, 0xE7, 0x51, 0x21, 0x6B, 0xFC, 0x21, 0x73, 0xFD,
-    0x21, 0x6F, 0xFD, 0xA1, 0x00, 0xE1, 0x6C, 0xFD, 0x47, 0xA2, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB,
-    0xF0, 0xFD, 0xFF, 0xFB, 0xF0, 0xFD, 0xF0, 0xFD, 0xF0, 0xFD, 0xF0, 0xFD, 0xF0, 0xFD, 0x41, 0x6D,
-    0xE9, 0xDD, 0x21, 0x61, 0xFC, 0x21, 0x74, 0xFD, 0xA1, 0x00, 0xE1, 0x6C, 0xFD, 0x48, 0x61, 0x69,
-    0x65, 0xC3, 0x6F, 0x72, 0x75, 0x79, 0xFF, 0x90, 0xFF, 0x99, 0xFF, 0xBD, 0xFF, 0xDB, 0xFF, 0xFB,
-    0xF2, 0x50, 0xF0, 0xD8, 0xF0, 0xD8, 0xA0, 0x01, 0xD1, 0x21, 0x6E, 0xFD, 0x21, 0x6F, 0xFD, 0x42,
-    0x69, 0x75, 0xFF, 0xFD, 0xF0, 0xF8, 0x41, 0x72, 0xF6, 0xE9, 0xA1, 0x00, 0xE1, 0x77, 0xFC, 0x48,
-    0xA2, 0xA0, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB, 0xF0, 0xA6, 0xF0, 0xA6, 0xF0, 0xA6, 0xF0, 0xA6,
-    0xF0, 0xA6, 0xF0, 0xA6, 0xF0, 0xA6, 0xF0, 0xA6, 0x41, 0x2E, 0xE6, 0x8A, 0x21, 0x74, 0xFC, 0x21,
-    0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x4A, 0x69, 0x6C, 0x61, 0xC3, 0x65, 0x6F, 0x73, 0x75, 0x79, 0x6D,
-    0xF3, 0xAE, 0xFF, 0xCA, 0xFF, 0xD5, 0xFF, 0xDA, 0xF1, 0xE8, 0xF0, 0x80, 0xF8, 0x95, 0xF0, 0x80,
-    0xF0, 0x80, 0xFF, 0xFD, 0x41, 0x6C, 0xF3, 0x8B, 0x42, 0x69, 0x65, 0xFF, 0xFC, 0xF9, 0xD3, 0xC1,
-    0x00, 0xE2, 0x2E, 0xF1, 0xAF, 0x49, 0x61, 0xC3, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x75, 0x79, 0xF0,
-    0x50, 0xF1, 0x93, 0xF1, 0xB8, 0xFF, 0xFA, 0xF0, 0x50, 0xF0, 0x50, 0xF0, 0x6D, 0xF0, 0x50, 0xF0,
-    0x50, 0x42, 0x61, 0x65, 0xF0, 0x76, 0xF1, 0xA5, 0xA1, 0x00, 0xE1, 0x75, 0xF9, 0x41, 0x69, 0xFA,
-    0x32, 0x21, 0x72, 0xFC, 0xA1, 0x00, 0xE1, 0x74, 0xFD, 0xA0, 0x01, 0xF2, 0x21, 0x2E, 0xFD, 0x22,
-    0x2E, 0x73, 0xFA, 0xFD, 0x21, 0x74, 0xFB, 0x21, 0x61, 0xFD, 0x4A, 0x75, 0x61, 0xC3, 0x65, 0x69,
-    0x6F, 0xC5, 0x73, 0x78, 0x79, 0xFF, 0xEA, 0xF0, 0x0B, 0xF1, 0x4E, 0xF1, 0x73, 0xF0, 0x0B, 0xF0,
-    0x0B, 0xF4, 0x0D, 0xFF, 0xFD, 0xF8, 0x58, 0xF0, 0x0B, 0x41, 0x68, 0xF8, 0x39, 0x21, 0x74, 0xFC,
-    0x42, 0x73, 0x6C, 0xFF, 0xFD, 0xF8, 0x38, 0x41, 0x6F, 0xFD, 0x5C, 0x21, 0x74, 0xFC, 0x22, 0x61,
-    0x73, 0xF2, 0xFD, 0x42, 0xA9, 0xA8, 0xEF, 0xD2, 0xEF, 0xD2, 0x47, 0x61, 0x65, 0xC3, 0x69, 0x6F,
-    0x75, 0x79, 0xEF, 0xCB, 0xF1, 0x33, 0xFF, 0xF9, 0xEF, 0xCB, 0xEF, 0xCB, 0xEF, 0xCB, 0xEF, 0xCB,
-    0x5D, 0x27, 0x2E, 0x61, 0x62, 0xC3, 0x63, 0x6A, 0x6D, 0x72, 0x70, 0x69, 0x65, 0x64, 0x74, 0x66,
-    0x67, 0x73, 0x6F, 0x77, 0x68, 0x75, 0x76, 0x6C, 0x78, 0x6B, 0x71, 0x6E, 0x79, 0x7A, 0xE7, 0xD0,
-    0xEF, 0x48, 0xF0, 0xCD, 0xF1, 0x53, 0xF2, 0x28, 0xF3, 0xD1, 0xF3, 0xFD, 0xF4, 0xAD, 0xF5, 0x6F,
-    0xF7, 0x2F, 0xF8, 0x34, 0xF8, 0x98, 0xF9, 0x32, 0xFA, 0x80, 0xFA, 0xE4, 0xFB, 0x3C, 0xFC, 0xA4,
-    0xFD, 0x6C, 0xFD, 0x97, 0xFE, 0x19, 0xFE, 0x4A, 0xFE, 0xDD, 0xFF, 0x35, 0xFF, 0x58, 0xFF, 0x65,
-    0xFF, 0x88, 0xFF, 0xAA, 0xFF, 0xDE, 0xFF, 0xEA,
+    0x01, 0x02, 0x04, 0x0B, 0x0C, 0x0D, 0x0C, 0x35, 0x20, 0x01, 0x0C, 0x21, 0x16, 0x0D, 0x20, 0x0B,
+    0x33, 0x0C, 0x53, 0x2A, 0x36, 0x1F, 0x0C, 0x2C, 0x29, 0x0C, 0x29, 0x16, 0x2C, 0x0B, 0x3E, 0x48,
+    0x0B, 0x16, 0x3F, 0x34, 0x0D, 0x51, 0x0C, 0x02, 0x0D, 0x17, 0x0C, 0x49, 0x3D, 0x0C, 0x35, 0x0C,
+    0x2A, 0x0D, 0x2A, 0x0B, 0x0C, 0x2B, 0x0C, 0x03, 0x0C, 0x52, 0x15, 0x0C, 0x0C, 0x0B, 0x0C, 0x03,
+    0x16, 0x1F, 0x0C, 0x16, 0x3D, 0x16, 0x20, 0x0D, 0x2A, 0x0B, 0x16, 0x22, 0x15, 0x16, 0x02, 0x17,
+    0x2A, 0x0D, 0x16, 0x2A, 0x0D, 0x0C, 0x40, 0x17, 0x17, 0x0C, 0x4A, 0x2B, 0x0E, 0x01, 0x16, 0x37,
+    0x33, 0x16, 0x18, 0x21, 0x0E, 0x22, 0x0F, 0x47, 0x0C, 0x20, 0x0B, 0x0C, 0x20, 0x0B, 0x16, 0x21,
+    0x0C, 0x21, 0x0C, 0x0D, 0x21, 0x0C, 0x17, 0x49, 0x0C, 0x3E, 0x0D, 0x36, 0x0D, 0x1F, 0x16, 0x20,
+    0x17, 0x2B, 0x0C, 0x0D, 0x2B, 0x0C, 0x17, 0x34, 0x21, 0x2A, 0x17, 0x02, 0x0C, 0x00, 0x0A, 0xBA,
+    0x00, 0x03, 0x44, 0x00, 0x0B, 0xBA, 0x00, 0x0A, 0xE9, 0x00, 0x0B, 0xB7, 0x00, 0x02, 0x4C, 0x00,
+    0x01, 0xB9, 0x00, 0x03, 0x5F, 0x00, 0x0B, 0xCF, 0x00, 0x02, 0x29, 0x00, 0x02, 0x31, 0x00, 0x0D,
+    0xAD, 0x00, 0x04, 0x0A, 0x00, 0x01, 0xFD, 0x00, 0x01, 0x5C, 0x00, 0x05, 0xA7, 0x00, 0x04, 0x25,
+    0x00, 0x0C, 0xDA, 0x00, 0x0A, 0xA8, 0x00, 0x01, 0xE5, 0x00, 0x04, 0xDC, 0x00, 0x0B, 0xC6, 0x00,
+    0x0B, 0xC3, 0x00, 0x0A, 0x93, 0x00, 0x02, 0x05, 0x00, 0x05, 0x98, 0x00, 0x0A, 0xCB, 0x00, 0x01,
+    0x83, 0x00, 0x0B, 0xC0, 0x00, 0x09, 0x34, 0x00, 0x01, 0x68, 0x00, 0x0A, 0x57, 0x00, 0x04, 0xD3,
+    0x00, 0x09, 0xF7, 0x00, 0x0B, 0x0D, 0x00, 0x02, 0xBE, 0x00, 0x0A, 0xAB, 0x00, 0x0B, 0xF9, 0x00,
+    0x0B, 0xD6, 0x00, 0x0E, 0xFF, 0x00, 0x0D, 0x1F, 0x00, 0x0F, 0xB0, 0x00, 0x0B, 0x7F, 0x00, 0x0A,
+    0x4B, 0x00, 0x0C, 0x6A, 0x00, 0x01, 0xBC, 0x00, 0x0B, 0x1A, 0x00, 0x05, 0x48, 0x00, 0x0C, 0x24,
+    0x00, 0x0A, 0x6A, 0x00, 0x17, 0xFC, 0x00, 0x05, 0x5C, 0x00, 0x0D, 0x84, 0x00, 0x01, 0x4D, 0x00,
+    0x0C, 0xB6, 0x00, 0x14, 0xD4, 0x00, 0x0D, 0xA8, 0x00, 0x07, 0x20, 0x00, 0x04, 0xBE, 0x00, 0x0D,
+    0x56, 0x00, 0x0B, 0xE4, 0x00, 0x03, 0x5C, 0x00, 0x09, 0x42, 0x00, 0x12, 0x2A, 0x80, 0x00, 0xB1,
+    0x01, 0x61, 0x35, 0x01, 0xA9, 0x7D, 0x01, 0xC3, 0x7D, 0x01, 0x72, 0x7D, 0x80, 0x06, 0x32, 0x01,
+    0x68, 0x0E, 0x01, 0x63, 0x7D, 0x01, 0x73, 0x7D, 0x80, 0x00, 0xC2, 0x01, 0x74, 0x1E, 0x01, 0x61,
+    0x7D, 0x01, 0x6E, 0x7D, 0x80, 0x00, 0x41, 0x01, 0x6C, 0x7D, 0x01, 0x6F, 0x7D, 0x01, 0x6F, 0x7D,
+    0x01, 0x63, 0x7D, 0x80, 0x02, 0xC2, 0x01, 0x63, 0x1B, 0x01, 0x61, 0x7D, 0x01, 0x6F, 0x7D, 0x01,
+    0x6E, 0x7D, 0x01, 0x69, 0x7D, 0x80, 0x05, 0xB2, 0x01, 0x72, 0x7D, 0x01, 0x74, 0x7D, 0x01, 0x73,
+    0x7D, 0x80, 0x03, 0xB2, 0x01, 0x69, 0x7D, 0x01, 0x73, 0x7D, 0x01, 0xA9, 0x7D, 0x01, 0xC3, 0x7D,
+    0x01, 0x68, 0x7D, 0x01, 0x74, 0x7D, 0x01, 0x73, 0x7D, 0x80, 0x01, 0x02, 0x80, 0x02, 0x31, 0x01,
+    0x65, 0x2D, 0x01, 0x6E, 0x7D, 0x81, 0x01, 0x02, 0x6E, 0x7D, 0x80, 0x06, 0x02, 0x01, 0xA9, 0x7D,
+    0x04, 0x61, 0x65, 0x73, 0xC3, 0x06, 0x75, 0x06, 0x7D, 0x01, 0x69, 0x77, 0x03, 0x61, 0x65, 0x74,
+    0xBF, 0xC2, 0xBF, 0xDA, 0x7D, 0x80, 0x03, 0x02, 0x01, 0x61, 0x13, 0x01, 0x74, 0x7D, 0x01, 0x73,
+    0x7D, 0x01, 0x6F, 0x7D, 0x01, 0x2E, 0x35, 0x01, 0x74, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D,
+    0x02, 0x67, 0x70, 0x0D, 0x0D, 0x80, 0x00, 0x81, 0x01, 0x61, 0x18, 0x01, 0x74, 0x7D, 0x89, 0x06,
+    0x21, 0x62, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0xBF, 0x4B, 0xBF, 0x57, 0xBF, 0x63,
+    0xBF, 0x72, 0xBF, 0x84, 0xBF, 0xCE, 0x63, 0x72, 0x7D, 0x80, 0x01, 0x52, 0x02, 0x61, 0x6F, 0x09,
+    0x09, 0x80, 0x06, 0x93, 0x01, 0x61, 0x0A, 0x01, 0x72, 0x7D, 0x82, 0x06, 0x21, 0x6E, 0x75, 0x72,
+    0x7D, 0x01, 0xA9, 0x1E, 0x02, 0x69, 0xC3, 0x1E, 0x7D, 0x01, 0x6E, 0x7B, 0x80, 0x04, 0x62, 0x01,
+    0x74, 0x05, 0x01, 0x69, 0x7D, 0x01, 0x72, 0x18, 0x01, 0x75, 0x7D, 0x01, 0x67, 0x7D, 0x82, 0x01,
+    0x52, 0x6E, 0x75, 0x74, 0x7D, 0x01, 0x62, 0x18, 0x01, 0x61, 0x7D, 0x01, 0x66, 0x7D, 0x01, 0x74,
+    0x18, 0x01, 0x72, 0xBF, 0x97, 0x01, 0x6F, 0x7C, 0x84, 0x01, 0x52, 0x66, 0x70, 0x72, 0x78, 0x73,
+    0x76, 0x18, 0x7D, 0x01, 0x74, 0xBE, 0xF1, 0x01, 0x61, 0x7C, 0x01, 0x6D, 0x7D, 0x01, 0x72, 0x7D,
+    0x01, 0x6F, 0x7D, 0x01, 0x69, 0x05, 0x01, 0x74, 0x7D, 0x01, 0x69, 0x7D, 0x83, 0x01, 0x52, 0x6D,
+    0x71, 0x74, 0x7D, 0x05, 0x05, 0x01, 0x6C, 0x05, 0x01, 0x75, 0x7D, 0x01, 0x64, 0x18, 0x82, 0x01,
+    0x52, 0x63, 0x6E, 0x7A, 0x7D, 0x01, 0x62, 0x09, 0x01, 0x61, 0x7D, 0x01, 0x74, 0x7D, 0x80, 0x01,
+    0xF1, 0x80, 0x03, 0x91, 0x01, 0xA9, 0x7D, 0x87, 0x07, 0xB2, 0x61, 0x65, 0x69, 0x6F, 0x73, 0x75,
+    0xC3, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x7D, 0x01, 0x72, 0x6F, 0x01, 0x65, 0x7D, 0x82, 0x01,
+    0x52, 0x69, 0x6C, 0xBF, 0x90, 0x05, 0x80, 0x07, 0xF2, 0x01, 0x61, 0x7D, 0x01, 0x74, 0x7D, 0x01,
+    0x63, 0x7D, 0x01, 0x75, 0x7D, 0x01, 0x72, 0x74, 0x01, 0x72, 0x7D, 0x01, 0x61, 0x7D, 0x82, 0x07,
+    0xD2, 0x6C, 0x6E, 0x74, 0x7D, 0x01, 0xA9, 0x79, 0x09, 0x61, 0x65, 0x66, 0x69, 0x6F, 0x73, 0x74,
+    0x75, 0xC3, 0xBF, 0x56, 0xBF, 0x70, 0xBF, 0x88, 0xBF, 0x94, 0xBF, 0xA6, 0xBF, 0xB3, 0xBF, 0xD3,
+    0xBF, 0xD6, 0x7D, 0x82, 0x06, 0x21, 0x67, 0x6E, 0xBF, 0x26, 0x65, 0x01, 0x65, 0xBF, 0x58, 0x01,
+    0x74, 0x7C, 0x01, 0x75, 0x0D, 0x01, 0x67, 0x7D, 0x80, 0x01, 0x81, 0x01, 0x75, 0x7D, 0x01, 0x6F,
+    0x7D, 0x01, 0x61, 0x7D, 0x80, 0x01, 0x82, 0x01, 0x63, 0x01, 0x01, 0x73, 0x7D, 0x01, 0x69, 0x7D,
+    0x84, 0x06, 0x21, 0x63, 0x6E, 0x75, 0x76, 0xBF, 0xDF, 0x65, 0x71, 0x7D, 0x80, 0x06, 0x21, 0x80,
+    0x04, 0xB1, 0x07, 0xA2, 0xA8, 0xA9, 0xAA, 0xAE, 0xB4, 0xBB, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x87, 0x08, 0xB2, 0x61, 0x65, 0x69, 0x6F, 0x75, 0x79, 0xC3, 0xBE, 0x9D, 0xBE, 0xC9, 0xBF,
+    0xB2, 0xBF, 0xDF, 0x3D, 0x3D, 0x71, 0x02, 0x61, 0x74, 0xBE, 0x18, 0xBE, 0x53, 0x03, 0x64, 0x67,
+    0x70, 0x0D, 0x0D, 0x0D, 0x88, 0x06, 0x21, 0x62, 0x65, 0x67, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0xBD,
+    0xC5, 0xBD, 0xD1, 0xBD, 0xDD, 0xBD, 0xFE, 0x72, 0xBE, 0x5D, 0x79, 0xBE, 0x77, 0x80, 0x08, 0x92,
+    0x01, 0x6E, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x61, 0x7D, 0x01, 0x6D, 0x7D, 0x01, 0x65, 0x7D, 0x01,
+    0x73, 0x7D, 0x01, 0x69, 0x7D, 0x80, 0x01, 0x51, 0x03, 0x63, 0x74, 0x75, 0x09, 0x09, 0x7D, 0x01,
+    0x61, 0x01, 0x04, 0x61, 0x6F, 0x73, 0x75, 0x76, 0x7D, 0xBE, 0x62, 0x09, 0x02, 0x61, 0x69, 0x66,
+    0x76, 0x80, 0x08, 0x72, 0x01, 0x65, 0x7D, 0x01, 0x6C, 0x7D, 0x01, 0x6C, 0x7D, 0x01, 0x69, 0x7D,
+    0x01, 0x75, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x66, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x72, 0x7D, 0x01,
+    0x76, 0x7D, 0x01, 0xA8, 0x7D, 0x81, 0x04, 0xB1, 0xC3, 0x7D, 0x80, 0x00, 0xE2, 0x01, 0x70, 0x0C,
+    0x01, 0x6C, 0x7D, 0x01, 0x61, 0x7D, 0x01, 0x73, 0x7D, 0x80, 0x03, 0x51, 0x01, 0x2E, 0x7D, 0x01,
+    0x74, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x6D, 0x10, 0x80, 0x01, 0x41, 0x80, 0x02,
+    0xB1, 0x01, 0x65, 0x7D, 0x01, 0x72, 0x7D, 0x01, 0x74, 0x7D, 0x01, 0xAE, 0x7D, 0x01, 0xC3, 0x7D,
+    0x01, 0x61, 0x7D, 0x80, 0x06, 0x72, 0x01, 0x63, 0x7D, 0x02, 0x6D, 0x73, 0x77, 0x7D, 0x01, 0x65,
+    0x7B, 0x01, 0x72, 0x7D, 0x82, 0x01, 0x71, 0x73, 0x74, 0xBF, 0xD7, 0x7D, 0x01, 0x65, 0x05, 0x01,
+    0x69, 0x7D, 0x81, 0x01, 0x52, 0x6C, 0x7D, 0x03, 0x6D, 0x6E, 0x6F, 0xBF, 0xC1, 0x6D, 0x7B, 0x80,
+    0x01, 0x71, 0x01, 0x6C, 0x7D, 0x04, 0x68, 0x69, 0x6F, 0x75, 0xBF, 0x90, 0xBF, 0xA1, 0x72, 0x7D,
+    0x01, 0x61, 0xBF, 0xC3, 0x01, 0x6F, 0x7C, 0x01, 0x79, 0x7D, 0x01, 0x72, 0x7D, 0x01, 0x63, 0x7D,
+    0x01, 0x64, 0x09, 0x01, 0xA9, 0x09, 0x02, 0x69, 0xC3, 0x7A, 0x7D, 0x01, 0x64, 0xBF, 0x2A, 0x01,
+    0x69, 0x09, 0x01, 0x6D, 0x09, 0x01, 0x6F, 0x7D, 0x04, 0x63, 0x6C, 0x6D, 0x74, 0x6E, 0x73, 0x77,
+    0x7D, 0x01, 0x6E, 0x09, 0x01, 0x68, 0x05, 0x03, 0x61, 0x65, 0x73, 0x71, 0x7A, 0x7D, 0x01, 0x6C,
+    0x0D, 0x84, 0x04, 0x62, 0x61, 0x69, 0x6F, 0x75, 0x0A, 0x0A, 0x0A, 0x0A, 0x01, 0x73, 0x75, 0x01,
+    0x6F, 0xBE, 0x69, 0x80, 0x08, 0x13, 0x01, 0x72, 0x20, 0x80, 0x02, 0x32, 0x80, 0x03, 0x52, 0x01,
+    0x72, 0x14, 0x01, 0x74, 0x7D, 0x01, 0x6C, 0x20, 0x01, 0x6C, 0x7D, 0x01, 0x65, 0x7D, 0x04, 0x63,
+    0x6D, 0x73, 0x74, 0x68, 0x6B, 0x74, 0x7D, 0x01, 0x62, 0x14, 0x01, 0x69, 0x7D, 0x01, 0x73, 0x7D,
+    0x01, 0x74, 0x14, 0x01, 0x75, 0x14, 0x03, 0x6E, 0x72, 0x78, 0x77, 0x7A, 0x7D, 0x01, 0x6E, 0x20,
+    0x01, 0x69, 0x20, 0x01, 0x6F, 0x14, 0x02, 0x65, 0x76, 0x77, 0x7D, 0x86, 0x03, 0x23, 0x64, 0x67,
+    0x6C, 0x6E, 0x72, 0x73, 0x20, 0x72, 0x75, 0x7B, 0x20, 0x65, 0x01, 0xA9, 0x20, 0x01, 0xC3, 0x7D,
+    0x01, 0x69, 0xBF, 0xB5, 0x02, 0x6D, 0x70, 0x14, 0x14, 0x01, 0x66, 0xBF, 0xA6, 0x05, 0x64, 0x6C,
+    0x70, 0x72, 0x75, 0x70, 0x20, 0x73, 0x77, 0x7C, 0x80, 0x03, 0x23, 0x01, 0x6E, 0x2F, 0x80, 0x08,
+    0x43, 0x01, 0x72, 0x7D, 0x81, 0x04, 0x83, 0x67, 0x7D, 0x01, 0xA9, 0x7B, 0x80, 0x03, 0x22, 0x01,
+    0x93, 0x33, 0x8A, 0x01, 0x31, 0x61, 0x63, 0x65, 0x69, 0x6F, 0x70, 0x74, 0x75, 0xC3, 0xC5, 0xBF,
+    0x8C, 0x14, 0xBF, 0xA4, 0xBF, 0xB9, 0xBF, 0xDB, 0x14, 0x14, 0x69, 0x77, 0x7D, 0x04, 0x61, 0x69,
+    0x6F, 0x73, 0x01, 0xBF, 0x52, 0x01, 0x65, 0x01, 0xA9, 0x76, 0x05, 0x61, 0x69, 0x6F, 0x79, 0xC3,
+    0xBF, 0x03, 0xBF, 0x2D, 0x3A, 0xBF, 0x42, 0x7D, 0x80, 0x01, 0x31, 0x01, 0x2E, 0x19, 0x01, 0x74,
+    0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x6D, 0x7D, 0x01, 0x6D, 0x0F, 0x01, 0x65, 0x7D,
+    0x08, 0x61, 0x65, 0x69, 0x6F, 0x73, 0x74, 0x75, 0xC3, 0xBC, 0xAE, 0xBC, 0xC8, 0xBC, 0xEC, 0xBC,
+    0xFE, 0xBD, 0x0B, 0xBD, 0x2B, 0xBD, 0x2E, 0xBD, 0x55, 0x82, 0x06, 0x21, 0x67, 0x6E, 0xBC, 0x80,
+    0x67, 0x01, 0x68, 0x07, 0x01, 0x74, 0x0D, 0x01, 0x61, 0x7D, 0x01, 0x73, 0xBB, 0xAC, 0x01, 0x6F,
+    0x7C, 0x02, 0x6B, 0x72, 0x05, 0x7D, 0x01, 0x64, 0xBE, 0x76, 0x01, 0x69, 0x7C, 0x01, 0x61, 0xBC,
+    0x62, 0x01, 0x63, 0x7C, 0x01, 0x69, 0x7D, 0x02, 0x63, 0x66, 0x73, 0x7D, 0x01, 0x6D, 0x05, 0x02,
+    0x69, 0x75, 0x78, 0x7D, 0x01, 0x6E, 0x7B, 0x01, 0x73, 0x0A, 0x02, 0x65, 0x6F, 0x7D, 0x0A, 0x01,
+    0x72, 0x7B, 0x01, 0xA9, 0x0C, 0x01, 0xC3, 0x7D, 0x01, 0x73, 0x7D, 0x04, 0x64, 0x69, 0x70, 0x76,
+    0x74, 0x7D, 0x0C, 0x0A, 0x01, 0x6E, 0x0C, 0x01, 0x74, 0x0C, 0x01, 0x6E, 0x7D, 0x02, 0x63, 0x64,
+    0x0C, 0x0A, 0x04, 0x61, 0x65, 0x69, 0x6F, 0x69, 0x72, 0x78, 0x7B, 0x01, 0x78, 0x0C, 0x04, 0x63,
+    0x67, 0x6C, 0x72, 0xBF, 0xA3, 0xBF, 0xC6, 0x74, 0x7D, 0x80, 0x02, 0xC1, 0x01, 0x6D, 0x7D, 0x01,
+    0x61, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x6C, 0x7D, 0x01, 0x6C, 0x7D, 0x01, 0xC3, 0xBB, 0x72, 0x01,
+    0x64, 0x7C, 0x02, 0xA9, 0xAF, 0xBB, 0x68, 0x7D, 0x07, 0x61, 0x65, 0x69, 0x6F, 0x73, 0x75, 0xC3,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x7A, 0x01, 0x6F, 0x71, 0x01, 0x6E, 0x7D, 0x01, 0x68, 0x33,
+    0x01, 0x6F, 0x7D, 0x81, 0x01, 0x31, 0x6E, 0xBD, 0x96, 0x01, 0x73, 0x33, 0x01, 0x73, 0x2F, 0x04,
+    0x61, 0x65, 0x69, 0x75, 0x74, 0x7A, 0x33, 0x7D, 0x01, 0x61, 0x1B, 0x01, 0x74, 0x7D, 0x01, 0x73,
+    0x7D, 0x01, 0x61, 0x7D, 0x03, 0x67, 0x73, 0x74, 0xBF, 0xDC, 0x6B, 0x7D, 0x01, 0xA9, 0x78, 0x04,
+    0x61, 0x69, 0x6F, 0xC3, 0xBF, 0x8F, 0xBF, 0xA9, 0xBF, 0xCB, 0x7D, 0x01, 0x73, 0x0C, 0x01, 0x62,
+    0x7D, 0x01, 0x6F, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x6F, 0x7D, 0x83, 0x06, 0x21, 0x6E, 0x75, 0x76,
+    0xBC, 0x6B, 0xBC, 0x77, 0xBC, 0x83, 0x01, 0xA9, 0x0A, 0x01, 0xC3, 0x7D, 0x03, 0x66, 0x6D, 0x72,
+    0x0A, 0x7D, 0xBB, 0x58, 0x02, 0x68, 0x74, 0x0A, 0x0C, 0x01, 0x70, 0x7B, 0x03, 0x61, 0x69, 0x6F,
+    0x70, 0xBF, 0xCF, 0x7D, 0x01, 0xA8, 0x0A, 0x02, 0x65, 0xC3, 0x0A, 0x7D, 0x01, 0x68, 0x7B, 0x02,
+    0x63, 0x73, 0x7D, 0x06, 0x01, 0xA9, 0x05, 0x01, 0xC3, 0x7D, 0x03, 0x61, 0x65, 0x68, 0x75, 0xBA,
+    0xF0, 0x7D, 0x03, 0x6E, 0x72, 0x74, 0xBF, 0xDA, 0x78, 0x0D, 0x01, 0x61, 0x19, 0x01, 0x74, 0x7D,
+    0x80, 0x01, 0xA2, 0x01, 0xA9, 0x39, 0x86, 0x04, 0xB1, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x7D, 0x02, 0x6E, 0x72, 0x68, 0x71, 0x80, 0x07, 0x72, 0x01, 0x74, 0x7D,
+    0x01, 0x73, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x61, 0x7D, 0x01, 0x6C, 0x7D, 0x81, 0x04, 0xB1, 0x61,
+    0x7D, 0x01, 0x61, 0xBE, 0xF8, 0x01, 0x69, 0x7C, 0x01, 0x72, 0x7D, 0x01, 0x75, 0x7D, 0x01, 0x74,
+    0x19, 0x01, 0x65, 0x7D, 0x01, 0x74, 0x7D, 0x01, 0x6E, 0x33, 0x05, 0x68, 0x69, 0x6F, 0x72, 0x73,
+    0x13, 0x7D, 0x2F, 0x13, 0x06, 0x01, 0x74, 0x75, 0x02, 0x6E, 0x73, 0x6C, 0x7D, 0x01, 0x68, 0x13,
+    0x01, 0x74, 0x7D, 0x01, 0x61, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0xA9, 0x01, 0x01, 0xC3, 0x7D, 0x01,
+    0x63, 0x7D, 0x80, 0x02, 0xE2, 0x01, 0x68, 0x7D, 0x01, 0x64, 0x7D, 0x04, 0x67, 0x73, 0x75, 0xC3,
+    0x6B, 0x74, 0x7D, 0xBF, 0x88, 0x01, 0x61, 0xBD, 0x34, 0x82, 0x01, 0x02, 0x6C, 0x75, 0x7C, 0x2D,
+    0x07, 0x61, 0x65, 0x69, 0x6F, 0x73, 0x75, 0xC3, 0x79, 0x06, 0x06, 0x06, 0x06, 0x06, 0xBA, 0x1D,
+    0x01, 0xA9, 0x70, 0x02, 0x6F, 0xC3, 0xBF, 0xD8, 0x7D, 0x01, 0x6E, 0xBC, 0x7A, 0x01, 0x61, 0x7C,
+    0x01, 0x6F, 0x7D, 0x01, 0x68, 0x7D, 0x01, 0x63, 0x7D, 0x01, 0x79, 0x7D, 0x01, 0x6C, 0x01, 0x01,
+    0x64, 0x7D, 0x01, 0x64, 0x7D, 0x01, 0x73, 0xBE, 0x64, 0x80, 0x07, 0x92, 0x01, 0x61, 0x7D, 0x82,
+    0x02, 0xC2, 0x73, 0x74, 0x7A, 0x7D, 0x03, 0x6F, 0x73, 0x75, 0x6F, 0x79, 0x1B, 0x01, 0x69, 0x79,
+    0x01, 0x72, 0x7D, 0x01, 0xA9, 0x7D, 0x09, 0x61, 0x65, 0x68, 0x6C, 0x6F, 0x72, 0x73, 0x75, 0xC3,
+    0xBF, 0x0C, 0xBF, 0x2F, 0xBF, 0x46, 0xBF, 0x55, 0xBF, 0x72, 0xBF, 0xBD, 0xBF, 0xD3, 0xBF, 0xDC,
+    0x7D, 0x01, 0x70, 0x05, 0x02, 0x69, 0x6F, 0x05, 0x05, 0x01, 0x73, 0x7B, 0x01, 0x75, 0x05, 0x04,
+    0x61, 0x69, 0x6F, 0x72, 0x72, 0x7A, 0x7D, 0xBA, 0x64, 0x01, 0x63, 0xBA, 0x16, 0x01, 0x72, 0x05,
+    0x01, 0x64, 0x05, 0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x73, 0x05, 0x01, 0x6E, 0x7D, 0x04,
+    0x65, 0x69, 0x6C, 0x6F, 0x6A, 0x6E, 0x77, 0x7D, 0x01, 0x69, 0xBA, 0x4D, 0x01, 0x75, 0x7C, 0x81,
+    0x04, 0x62, 0x65, 0xBB, 0xC3, 0x01, 0x64, 0x0E, 0x04, 0x62, 0x67, 0x6E, 0x74, 0x0E, 0x0E, 0x7D,
+    0x0E, 0x02, 0x6D, 0x70, 0x0E, 0x0E, 0x02, 0x63, 0x70, 0x0E, 0x0E, 0x80, 0x06, 0x52, 0x01, 0x6E,
+    0x7D, 0x01, 0x69, 0x7D, 0x01, 0x74, 0x77, 0x02, 0x63, 0x6E, 0x7D, 0x74, 0x82, 0x06, 0x32, 0x65,
+    0x69, 0x75, 0x7B, 0x02, 0x6E, 0x72, 0x0E, 0x0E, 0x01, 0xA9, 0x7B, 0x87, 0x04, 0x62, 0x61, 0x69,
+    0x6F, 0x72, 0x75, 0x79, 0xC3, 0xBF, 0xCD, 0xBF, 0xD6, 0xBF, 0xDB, 0x71, 0x0E, 0x0E, 0x7D, 0x85,
+    0x01, 0x52, 0x63, 0x70, 0x71, 0x73, 0x74, 0xBF, 0x80, 0xBF, 0xA0, 0xBF, 0xAD, 0xBF, 0xB0, 0x6C,
+    0x01, 0x73, 0x6F, 0x02, 0x73, 0x74, 0x13, 0x13, 0x02, 0x65, 0x69, 0x13, 0x7B, 0x01, 0x78, 0x19,
+    0x82, 0x01, 0x82, 0x6C, 0x75, 0x78, 0x7D, 0x82, 0x01, 0x82, 0x6C, 0x72, 0x19, 0x19, 0x01, 0x69,
+    0x13, 0x81, 0x01, 0x82, 0x66, 0x7D, 0x01, 0x72, 0xBB, 0x9E, 0x01, 0x73, 0x19, 0x81, 0x02, 0x31,
+    0x73, 0x7D, 0x01, 0x72, 0x19, 0x02, 0xA8, 0xA9, 0x7D, 0x39, 0x07, 0x61, 0x65, 0x69, 0x6F, 0x74,
+    0x75, 0xC3, 0xBF, 0xD6, 0xBF, 0xDD, 0x67, 0x01, 0x6C, 0x73, 0x7B, 0x01, 0xA9, 0x6F, 0x02, 0x65,
+    0xC3, 0xBF, 0xB2, 0x7D, 0x01, 0x72, 0xBB, 0x14, 0x01, 0x68, 0xBB, 0x57, 0x01, 0x65, 0x19, 0x01,
+    0x6C, 0x7D, 0x02, 0x72, 0x75, 0xBB, 0x06, 0x7D, 0x01, 0x76, 0x10, 0x01, 0x75, 0x7D, 0x01, 0x6E,
+    0x13, 0x01, 0x67, 0x7D, 0x80, 0x00, 0x71, 0x01, 0x6C, 0x1D, 0x01, 0x6C, 0x7D, 0x02, 0x61, 0x69,
+    0x74, 0x7D, 0x80, 0x06, 0xF2, 0x01, 0x74, 0x3E, 0x81, 0x06, 0x93, 0x6C, 0x7D, 0x01, 0x6E, 0x05,
+    0x01, 0x69, 0x7D, 0x02, 0x6D, 0x6E, 0x7D, 0x05, 0x02, 0x69, 0x75, 0x7B, 0x05, 0x01, 0x72, 0x0C,
+    0x80, 0x07, 0x43, 0x81, 0x06, 0xC3, 0x72, 0x7D, 0x01, 0xA9, 0x7B, 0x05, 0x61, 0x69, 0x6C, 0x75,
+    0xC3, 0xBF, 0xDD, 0xBC, 0xB9, 0x6D, 0x72, 0x7D, 0x80, 0x07, 0x13, 0x81, 0x06, 0x93, 0x74, 0x7D,
+    0x01, 0x75, 0x3E, 0x01, 0x6C, 0x3E, 0x83, 0x06, 0x93, 0x61, 0x6C, 0x74, 0x7A, 0x7D, 0x3E, 0x02,
+    0x66, 0x74, 0x0C, 0x0C, 0x02, 0x6D, 0x6E, 0x0A, 0x7B, 0x02, 0x66, 0x78, 0x0C, 0x0C, 0x80, 0x06,
+    0xC3, 0x01, 0xA9, 0x7D, 0x06, 0x61, 0x65, 0x68, 0x69, 0x6F, 0xC3, 0xBF, 0xD7, 0x62, 0x05, 0x70,
+    0x75, 0x7D, 0x02, 0x62, 0x72, 0xBF, 0xB9, 0x72, 0x01, 0x67, 0xBD, 0xCE, 0x01, 0x6E, 0x7C, 0x08,
+    0x61, 0x63, 0x65, 0x68, 0x6F, 0x74, 0x75, 0x79, 0xBF, 0x55, 0xBF, 0x59, 0xBF, 0x63, 0x07, 0xBF,
+    0x6C, 0xBF, 0x7E, 0x73, 0x7D, 0x03, 0x63, 0x6E, 0x74, 0x01, 0x01, 0x01, 0x01, 0x6E, 0x01, 0x02,
+    0x61, 0x6F, 0x76, 0x7D, 0x01, 0x69, 0x7B, 0x03, 0x61, 0x68, 0x72, 0x3A, 0x07, 0x7D, 0x01, 0x2E,
+    0x1D, 0x01, 0x74, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x6E, 0x21, 0x01, 0x69, 0x7D,
+    0x81, 0x04, 0xB1, 0x6D, 0x7D, 0x07, 0xA2, 0xA8, 0xA9, 0xAA, 0xAE, 0xB4, 0xBB, 0x07, 0x07, 0x7B,
+    0x07, 0x07, 0x07, 0x07, 0x13, 0x61, 0x62, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6E,
+    0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x79, 0xC3, 0xB9, 0x80, 0xB9, 0xC8, 0xBA, 0x61, 0xBB, 0x76,
+    0xB8, 0x26, 0xBB, 0x99, 0xBB, 0xB5, 0xBB, 0xBD, 0xBB, 0xC3, 0xBC, 0x9B, 0xBC, 0xB3, 0xBC, 0xB6,
+    0xBD, 0xF2, 0xBE, 0xFA, 0xBF, 0xAB, 0xBF, 0xD3, 0x3D, 0x3D, 0x71, 0x80, 0x00, 0xC1, 0x80, 0x02,
+    0x91, 0x01, 0x2E, 0x7D, 0x01, 0x74, 0x7D, 0x01, 0x6E, 0x7D, 0x02, 0x65, 0x74, 0x1F, 0xBF, 0xA3,
+    0x01, 0xAE, 0x0F, 0x03, 0x68, 0x73, 0xC3, 0x2B, 0x77, 0x7D, 0x01, 0x65, 0x1F, 0x80, 0x05, 0xA1,
+    0x01, 0x2E, 0x7D, 0x01, 0x74, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x63, 0x7D, 0x01,
+    0x73, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x75, 0x7D, 0x02, 0x63, 0x71, 0x31, 0x7D,
+    0x01, 0x68, 0x2B, 0x80, 0x00, 0x42, 0x01, 0x73, 0x17, 0x01, 0x6F, 0x7D, 0x01, 0x6E, 0x7D, 0x01,
+    0x2E, 0x2B, 0x01, 0x74, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x6D, 0x12, 0x80, 0x03,
+    0xC2, 0x01, 0x69, 0x7D, 0x01, 0x67, 0x7D, 0x01, 0x6C, 0x7D, 0x80, 0x00, 0x01, 0x01, 0x6C, 0x00,
+    0x01, 0x6F, 0x7D, 0x01, 0x6F, 0x7D, 0x02, 0x61, 0x63, 0x71, 0x7D, 0x80, 0x01, 0xE1, 0x01, 0x2E,
+    0x1A, 0x01, 0x74, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x6D, 0x7D, 0x01, 0x61, 0x7D,
+    0x01, 0x67, 0x7D, 0x01, 0x6C, 0x7D, 0x01, 0x61, 0x7D, 0x80, 0x00, 0x92, 0x01, 0x69, 0x03, 0x01,
+    0x73, 0x7D, 0x01, 0xA9, 0x7D, 0x01, 0xC3, 0x7D, 0x01, 0x68, 0x7D, 0x01, 0x74, 0x7D, 0x01, 0x73,
+    0x7D, 0x01, 0x2E, 0x18, 0x01, 0x74, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x6D, 0x7D,
+    0x01, 0x2E, 0xB9, 0x1E, 0x01, 0x74, 0x7C, 0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x6D, 0x2E,
+    0x01, 0x72, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x66, 0x7D, 0x01, 0x69, 0x7D, 0x03, 0x65, 0x69, 0x74,
+    0xBF, 0xD2, 0x22, 0x7D, 0x01, 0x74, 0xBD, 0x09, 0x01, 0x73, 0x7C, 0x01, 0x72, 0x10, 0x01, 0x61,
+    0x7D, 0x02, 0x6F, 0x70, 0x77, 0x7D, 0x01, 0x73, 0xB6, 0x84, 0x01, 0x69, 0x7C, 0x01, 0x70, 0x7D,
+    0x01, 0xA9, 0x7D, 0x01, 0xC3, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x68, 0x7D, 0x80, 0x05, 0xF1, 0x01,
+    0x6C, 0x7D, 0x01, 0x6C, 0x7D, 0x02, 0x65, 0x69, 0xBF, 0x40, 0x7D, 0x02, 0x63, 0x6D, 0x6E, 0x7A,
+    0x01, 0x6F, 0x17, 0x01, 0x72, 0x7D, 0x02, 0x6D, 0x74, 0x12, 0x7D, 0x01, 0x6C, 0xB8, 0xF7, 0x01,
+    0x69, 0x7C, 0x80, 0x02, 0x02, 0x01, 0x65, 0x7D, 0x01, 0x72, 0x7D, 0x01, 0x64, 0x7D, 0x01, 0xA8,
+    0x7D, 0x0E, 0x62, 0x63, 0x64, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x75, 0x76, 0xC3,
+    0xBE, 0xD2, 0xBE, 0xFA, 0xBE, 0xFF, 0xBF, 0x0B, 0x24, 0xBF, 0x35, 0xBF, 0x55, 0xBF, 0x9B, 0xBF,
+    0xB0, 0xBF, 0xDA, 0x65, 0x24, 0x2A, 0x7D, 0x80, 0x00, 0x21, 0x80, 0x00, 0x11, 0x01, 0x2E, 0x02,
+    0x01, 0x74, 0x7D, 0x01, 0x2E, 0x04, 0x83, 0x00, 0x01, 0x2E, 0x6E, 0x73, 0x04, 0x1C, 0x16, 0x03,
+    0x2E, 0x6E, 0x73, 0x04, 0x1C, 0x16, 0x81, 0x00, 0x92, 0x65, 0x08, 0x80, 0x02, 0x21, 0x01, 0x6C,
+    0x7D, 0x01, 0x6C, 0x7D, 0x01, 0x69, 0x7D, 0x02, 0x6D, 0x74, 0xBF, 0x23, 0x3C, 0x81, 0x00, 0x01,
+    0x75, 0x7A, 0x82, 0x00, 0x92, 0x65, 0x75, 0x08, 0x22, 0x07, 0xA2, 0xA8, 0xA9, 0xAA, 0xAE, 0xB4,
+    0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x61, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x75,
+    0x79, 0xC3, 0x00, 0x15, 0x00, 0x26, 0x65, 0x6A, 0x00, 0x00, 0x25, 0x80, 0x05, 0x73, 0x01, 0x74,
+    0x7D, 0x01, 0x75, 0x7D, 0x01, 0x69, 0xBD, 0x16, 0x01, 0x2E, 0x2D, 0x01, 0x74, 0x7D, 0x01, 0x6E,
+    0x7D, 0x01, 0x65, 0x7D, 0x01, 0x6D, 0x7D, 0x01, 0xAA, 0x7D, 0x01, 0xC3, 0x7D, 0x83, 0x00, 0x01,
+    0x6F, 0x70, 0x72, 0x64, 0x30, 0x7D, 0x01, 0x64, 0x0D, 0x01, 0x69, 0x7D, 0x80, 0x05, 0x61, 0x01,
+    0x6C, 0x7D, 0x01, 0x6C, 0x7D, 0x01, 0x69, 0x7D, 0x04, 0x2E, 0x6E, 0x73, 0x76, 0x04, 0x1C, 0x16,
+    0x7D, 0x01, 0x64, 0x21, 0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x02, 0x2E, 0x73, 0x04, 0x16, 0x80,
+    0x05, 0x33, 0x01, 0x63, 0x7D, 0x80, 0x05, 0x03, 0x01, 0x74, 0x7D, 0x01, 0xA9, 0x7D, 0x02, 0x61,
+    0xC3, 0x74, 0x7D, 0x01, 0x72, 0x7B, 0x82, 0x00, 0xC1, 0x65, 0x6F, 0x2C, 0x7D, 0x82, 0x00, 0xC1,
+    0x65, 0x6F, 0x2C, 0x0F, 0x8D, 0x00, 0x92, 0x2E, 0x62, 0x65, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70,
+    0x72, 0x73, 0x74, 0x77, 0x04, 0x02, 0xBF, 0xC4, 0x02, 0xBF, 0xD3, 0x72, 0x02, 0x02, 0x02, 0x79,
+    0x02, 0x02, 0x02, 0x01, 0x6C, 0x35, 0x81, 0x00, 0x01, 0x6C, 0x7D, 0x80, 0x04, 0xE2, 0x89, 0x00,
+    0x92, 0x2E, 0x62, 0x65, 0x66, 0x67, 0x68, 0x70, 0x73, 0x74, 0x04, 0x02, 0x08, 0x02, 0x02, 0x7D,
+    0x02, 0x02, 0x02, 0x82, 0x00, 0x92, 0x61, 0x65, 0x22, 0x08, 0x80, 0x03, 0xA1, 0x02, 0x63, 0x71,
+    0x11, 0x11, 0x80, 0x03, 0xA2, 0x01, 0x63, 0x11, 0x01, 0x72, 0x11, 0x02, 0x6F, 0x75, 0x7A, 0x7D,
+    0x01, 0x73, 0x7B, 0x07, 0x63, 0x64, 0x70, 0x72, 0x73, 0x75, 0x78, 0x6A, 0x6F, 0x11, 0x11, 0x7D,
+    0x11, 0x11, 0x03, 0x66, 0x6E, 0x78, 0x11, 0x11, 0x11, 0x01, 0x69, 0x1E, 0x01, 0x74, 0x7D, 0x01,
+    0x69, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x2E, 0xBE, 0xC6, 0x01, 0x74, 0x7C, 0x01, 0x6E, 0x7D, 0x01,
+    0x65, 0x7D, 0x01, 0x74, 0x28, 0x01, 0xA9, 0x7D, 0x01, 0xC3, 0x7D, 0x01, 0x70, 0x7D, 0x01, 0x69,
+    0xBF, 0x33, 0x01, 0x76, 0x21, 0x01, 0x69, 0x7D, 0x02, 0x65, 0x67, 0xBC, 0xBC, 0x28, 0x01, 0x6E,
+    0x7A, 0x01, 0x69, 0x7D, 0x01, 0x62, 0x2B, 0x01, 0x72, 0x7D, 0x04, 0x66, 0x6E, 0x74, 0x75, 0x64,
+    0x6B, 0x77, 0x7D, 0x01, 0x6C, 0x21, 0x01, 0x75, 0x7D, 0x01, 0x70, 0x3B, 0x80, 0x04, 0xC2, 0x01,
+    0xA9, 0x7D, 0x87, 0x00, 0x01, 0x61, 0x65, 0x67, 0x6D, 0x6E, 0x72, 0xC3, 0xBF, 0x91, 0xBF, 0xA0,
+    0xBF, 0xB0, 0xBF, 0xC9, 0x68, 0x77, 0x7D, 0x01, 0x72, 0x0D, 0x81, 0x00, 0x01, 0x72, 0x7D, 0x81,
+    0x00, 0x01, 0x72, 0x30, 0x01, 0x93, 0x00, 0x0D, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6F,
+    0x72, 0x75, 0x79, 0xC3, 0xC5, 0xBE, 0xB6, 0xBE, 0xC2, 0x15, 0xBF, 0x0D, 0x36, 0xBF, 0x37, 0xBF,
+    0x4C, 0xBF, 0xDB, 0x26, 0x73, 0x78, 0x25, 0x34, 0x81, 0x00, 0x01, 0x6D, 0x12, 0x80, 0x00, 0x32,
+    0x01, 0x68, 0x0B, 0x80, 0x03, 0x72, 0x01, 0x6C, 0x7D, 0x01, 0x64, 0x7A, 0x01, 0x75, 0x7D, 0x02,
+    0x61, 0x6F, 0x77, 0x7D, 0x01, 0x2E, 0xB4, 0xFD, 0x01, 0x74, 0x7C, 0x01, 0x6E, 0x7D, 0x01, 0x65,
+    0x7D, 0x01, 0x6D, 0x7D, 0x01, 0x67, 0x7D, 0x01, 0x61, 0x7D, 0x01, 0x72, 0x7D, 0x01, 0x68, 0x7D,
+    0x01, 0x70, 0x7D, 0x01, 0x67, 0x10, 0x01, 0x69, 0x7D, 0x01, 0x70, 0x1E, 0x01, 0x6F, 0x7D, 0x03,
+    0x63, 0x73, 0x74, 0x7D, 0xBF, 0x3F, 0x3C, 0x83, 0x00, 0x01, 0x61, 0x6C, 0x73, 0x69, 0x6F, 0x78,
+    0x01, 0x6E, 0x1C, 0x01, 0x65, 0x7D, 0x01, 0x61, 0xBE, 0x5B, 0x01, 0x6D, 0x28, 0x01, 0x69, 0x7D,
+    0x01, 0x72, 0x7D, 0x82, 0x00, 0x01, 0x63, 0x74, 0x73, 0x7D, 0x07, 0xA2, 0xA8, 0xA9, 0xAA, 0xAE,
+    0xB4, 0xBB, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x27, 0x61, 0x64, 0x65, 0x68, 0x69,
+    0x6C, 0x6F, 0x72, 0x73, 0x75, 0x79, 0xC3, 0x00, 0x38, 0xBF, 0x87, 0x15, 0xBF, 0x96, 0xBF, 0xCE,
+    0xBF, 0xDA, 0x00, 0x26, 0x0B, 0x00, 0x00, 0x71, 0x80, 0x03, 0xC3, 0x01, 0x72, 0x7D, 0x01, 0x76,
+    0x7D, 0x01, 0x67, 0x21, 0x01, 0x65, 0x7D, 0x01, 0x72, 0x7D, 0x02, 0x69, 0x74, 0x74, 0x7D, 0x01,
+    0x70, 0x17, 0x03, 0x65, 0x68, 0x6F, 0x1F, 0x17, 0x7D, 0x01, 0x69, 0x0F, 0x02, 0x63, 0x74, 0x76,
+    0x7D, 0x01, 0x74, 0xBE, 0x71, 0x01, 0x61, 0x7C, 0x01, 0x74, 0x7D, 0x01, 0x73, 0x7D, 0x82, 0x01,
+    0x01, 0x63, 0x69, 0x2D, 0x2D, 0x01, 0x61, 0x79, 0x01, 0x72, 0x7D, 0x01, 0x74, 0x7D, 0x05, 0x6E,
+    0x72, 0x73, 0x75, 0x78, 0xBF, 0xCC, 0x24, 0xBF, 0xDE, 0x6D, 0x7D, 0x01, 0x6D, 0x21, 0x01, 0x75,
+    0x7D, 0x01, 0x68, 0x7D, 0x82, 0x00, 0x01, 0x63, 0x72, 0x7D, 0x22, 0x82, 0x00, 0x92, 0x61, 0x65,
+    0xB6, 0xFF, 0x08, 0x01, 0x74, 0x3C, 0x82, 0x00, 0x92, 0x65, 0x69, 0x08, 0x7D, 0x81, 0x00, 0x01,
+    0x63, 0x3B, 0x07, 0xA2, 0xA8, 0xA9, 0xAA, 0xAE, 0xB4, 0xBB, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0x61, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x73, 0x75, 0x79, 0xC3, 0x38, 0x15, 0xBF, 0xD3,
+    0xBF, 0xDA, 0x00, 0x65, 0x0B, 0x38, 0x00, 0x71, 0x05, 0x61, 0x65, 0x69, 0x6F, 0x79, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x80, 0x01, 0x21, 0x01, 0x2E, 0x7D, 0x01, 0x74, 0x7D, 0x01, 0x6E, 0x7D, 0x01,
+    0x65, 0x7D, 0x01, 0x75, 0x27, 0x01, 0x71, 0x7D, 0x01, 0x6F, 0x7D, 0x01, 0x6C, 0x7D, 0x01, 0x69,
+    0x7D, 0x01, 0x64, 0x7D, 0x02, 0x6D, 0x6E, 0x0F, 0x7D, 0x82, 0x00, 0x92, 0x61, 0x65, 0x7B, 0x08,
+    0x81, 0x00, 0x01, 0x65, 0x08, 0x0C, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x75,
+    0x79, 0xC3, 0x00, 0x15, 0xBF, 0xC3, 0x36, 0x26, 0x26, 0x00, 0x74, 0x0B, 0x7B, 0x00, 0x25, 0x82,
+    0x00, 0x01, 0x2E, 0x73, 0x04, 0x16, 0x01, 0xA9, 0x23, 0x87, 0x01, 0xC2, 0x61, 0x65, 0x69, 0x6F,
+    0x73, 0x75, 0xC3, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x7D, 0x01, 0x72, 0x6F, 0x07, 0x61, 0x65,
+    0x69, 0x6F, 0x73, 0x75, 0xC3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xB7, 0xC6, 0x02, 0x65, 0x6F,
+    0x6D, 0x70, 0x81, 0x00, 0x01, 0x70, 0x7B, 0x80, 0x01, 0x01, 0x01, 0xA9, 0x7D, 0x01, 0xC3, 0x7D,
+    0x01, 0x74, 0x06, 0x01, 0x70, 0x7D, 0x02, 0x69, 0x6F, 0x77, 0x7D, 0x81, 0x00, 0x01, 0x6D, 0x7B,
+    0x07, 0xA2, 0xA8, 0xA9, 0xAA, 0xAE, 0xB4, 0xBB, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x61, 0x65, 0x69, 0x6F, 0x75, 0x79, 0xC3, 0x00, 0xBF, 0xA0, 0x36, 0x00, 0x38, 0xBF, 0xD3, 0x71,
+    0x80, 0x00, 0x31, 0x01, 0x69, 0x29, 0x01, 0x67, 0x7D, 0x01, 0x72, 0x29, 0x01, 0x68, 0x7D, 0x01,
+    0x74, 0x7D, 0x02, 0x6C, 0x72, 0x74, 0x7D, 0x01, 0x72, 0x30, 0x01, 0x6C, 0x2B, 0x01, 0x6E, 0x10,
+    0x01, 0x2E, 0xB4, 0x5B, 0x01, 0x74, 0x7C, 0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x63, 0x7D,
+    0x02, 0x6E, 0x73, 0x10, 0x7D, 0x02, 0x61, 0x69, 0x68, 0x7B, 0x01, 0x74, 0x10, 0x01, 0x64, 0x10,
+    0x02, 0x6F, 0x75, 0x7A, 0x7D, 0x02, 0x6D, 0x70, 0x70, 0x7B, 0x01, 0x69, 0x73, 0x01, 0x6C, 0x10,
+    0x01, 0x6C, 0xBE, 0x51, 0x03, 0x69, 0x6F, 0x75, 0xBD, 0xDF, 0x79, 0x7C, 0x01, 0x74, 0x00, 0x01,
+    0x61, 0x7D, 0x01, 0x6D, 0x7D, 0x01, 0x72, 0x7D, 0x01, 0x6F, 0x7D, 0x01, 0x63, 0x10, 0x01, 0x6F,
+    0x7D, 0x02, 0x6F, 0x74, 0xBF, 0xDC, 0x3C, 0x01, 0x67, 0x2E, 0x01, 0x69, 0x7D, 0x01, 0x6C, 0x7D,
+    0x01, 0x6C, 0x7D, 0x02, 0x65, 0x69, 0x7D, 0x0F, 0x06, 0x63, 0x64, 0x66, 0x6E, 0x73, 0x74, 0xBF,
+    0xC2, 0xBF, 0xCC, 0x60, 0x66, 0x69, 0x7B, 0x01, 0x63, 0xBE, 0x2A, 0x01, 0x79, 0x29, 0x02, 0x61,
+    0x78, 0x79, 0x7D, 0x02, 0x61, 0x6F, 0x17, 0x17, 0x01, 0xA9, 0x17, 0x02, 0x69, 0xC3, 0x78, 0x7D,
+    0x02, 0x65, 0x68, 0x1F, 0x7B, 0x01, 0x74, 0x0B, 0x01, 0x61, 0x7D, 0x02, 0x63, 0x74, 0x75, 0x7D,
+    0x01, 0x61, 0x3A, 0x09, 0x61, 0x62, 0x6C, 0x6D, 0x6E, 0x6F, 0x73, 0x76, 0xC3, 0xBF, 0x4F, 0xBF,
+    0x54, 0xBF, 0x57, 0xBF, 0x82, 0xBF, 0xC5, 0xBF, 0xDB, 0x78, 0x7D, 0xBB, 0x1B, 0x01, 0x63, 0x31,
+    0x83, 0x00, 0x01, 0x61, 0x65, 0x6B, 0x7D, 0x08, 0x02, 0x81, 0x00, 0x92, 0x2E, 0x04, 0x09, 0x61,
+    0x65, 0x68, 0x69, 0x6F, 0x72, 0x75, 0x79, 0xC3, 0x00, 0x15, 0x7B, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x25, 0x01, 0x65, 0x1E, 0x01, 0x72, 0x7D, 0x81, 0x00, 0x01, 0x77, 0x7D, 0x80, 0x00, 0x51, 0x01,
+    0x6E, 0x7D, 0x01, 0x6F, 0x7D, 0x02, 0x69, 0x75, 0x7D, 0x22, 0x01, 0x2E, 0xB0, 0xAA, 0x01, 0x74,
+    0x7C, 0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x08, 0xA0, 0xA2, 0xA8, 0xA9, 0xAA, 0xAE, 0xB4, 0xBB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x61, 0x65, 0x69, 0x6C, 0x6D, 0x6F, 0x73,
+    0x75, 0x79, 0xC3, 0xBF, 0xCF, 0x15, 0x36, 0xBF, 0xDD, 0x6C, 0x00, 0xBF, 0x7D, 0x00, 0x00, 0x6F,
+    0x01, 0x74, 0x07, 0x81, 0x00, 0xB1, 0x65, 0x7D, 0x01, 0x6C, 0x7B, 0x83, 0x00, 0x01, 0x6C, 0x6D,
+    0x74, 0x7D, 0x12, 0xB4, 0xC9, 0x01, 0x73, 0x03, 0x01, 0x6F, 0x03, 0x02, 0x6D, 0x73, 0x7D, 0xB9,
+    0xD1, 0x02, 0xA8, 0xA9, 0x74, 0x7A, 0x01, 0xC3, 0x7B, 0x01, 0x6C, 0x28, 0x01, 0x61, 0x7D, 0x01,
+    0x76, 0x7D, 0x01, 0x61, 0xB1, 0x73, 0x01, 0xA9, 0x7C, 0x01, 0xC3, 0x7D, 0x01, 0x72, 0x7D, 0x02,
+    0x6F, 0x74, 0x70, 0x7D, 0x80, 0x04, 0x83, 0x01, 0x67, 0x7D, 0x01, 0xA2, 0x7D, 0x01, 0xC3, 0x7D,
+    0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x82, 0x00, 0x01, 0x6E, 0x79, 0x69, 0x7D, 0x01, 0x63, 0x28,
+    0x01, 0x69, 0x7D, 0x01, 0x66, 0x7D, 0x01, 0x69, 0x7D, 0x81, 0x00, 0x01, 0x6E, 0x7D, 0x01, 0x6E,
+    0xBB, 0xB4, 0x01, 0x6F, 0x7C, 0x81, 0x00, 0x01, 0x63, 0x7D, 0x07, 0xA2, 0xA8, 0xA9, 0xAA, 0xAE,
+    0xB4, 0xBB, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x61, 0x65, 0x69, 0x6E, 0x6F, 0x73,
+    0x75, 0x79, 0xC3, 0xC5, 0x00, 0xBD, 0xB6, 0xBF, 0x82, 0xBF, 0x9D, 0xBF, 0xCD, 0x0B, 0x60, 0x00,
+    0x71, 0x34, 0x80, 0x00, 0x52, 0x01, 0x2E, 0x7D, 0x02, 0x2E, 0x73, 0x7A, 0x7D, 0x01, 0x74, 0x7B,
+    0x01, 0x61, 0x7D, 0x01, 0x69, 0xBC, 0xE8, 0x01, 0x72, 0x7C, 0x81, 0x00, 0x01, 0x74, 0x7D, 0x0A,
+    0x61, 0x65, 0x69, 0x6F, 0x73, 0x75, 0x78, 0x79, 0xC3, 0xC5, 0x00, 0x15, 0x00, 0x00, 0x71, 0x7B,
+    0x29, 0x00, 0x25, 0x34, 0x01, 0x67, 0x17, 0x01, 0x6E, 0x7D, 0x01, 0x6F, 0x7D, 0x01, 0x6C, 0x7D,
+    0x01, 0x65, 0xBE, 0x2C, 0x01, 0x74, 0x7C, 0x01, 0x6C, 0x0B, 0x01, 0x69, 0x17, 0x01, 0x6E, 0x7D,
+    0x01, 0x6F, 0x7D, 0x02, 0x6D, 0x73, 0x7D, 0x77, 0x01, 0x6F, 0x7B, 0x01, 0x6E, 0x7D, 0x01, 0x6E,
+    0xBD, 0xB5, 0x01, 0x6F, 0x7C, 0x01, 0x73, 0xB2, 0xD4, 0x01, 0x64, 0x7C, 0x01, 0x75, 0x7D, 0x01,
+    0x6F, 0xBB, 0x13, 0x02, 0x70, 0x73, 0x7C, 0x01, 0x01, 0x69, 0x7B, 0x03, 0x62, 0x6D, 0x6E, 0x71,
+    0x12, 0x7D, 0x01, 0x75, 0x3A, 0x02, 0x73, 0x74, 0x0B, 0x0B, 0x01, 0x6D, 0x0B, 0x01, 0x75, 0x0B,
+    0x02, 0x64, 0x74, 0x0B, 0x7D, 0x01, 0x6E, 0x0B, 0x01, 0x6F, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x74,
+    0x7D, 0x01, 0x63, 0x7D, 0x02, 0x61, 0x69, 0x6C, 0x7D, 0x01, 0x6F, 0x0B, 0x01, 0x72, 0x7D, 0x01,
+    0xA9, 0x7D, 0x05, 0x61, 0x69, 0x6F, 0x72, 0xC3, 0xBF, 0xD3, 0x3F, 0x3F, 0x72, 0x7D, 0x01, 0x74,
+    0x74, 0x01, 0x61, 0x09, 0x01, 0x79, 0x7D, 0x0B, 0x62, 0x63, 0x64, 0x67, 0x69, 0x6D, 0x70, 0x72,
+    0x73, 0x78, 0xC3, 0xBF, 0x76, 0xBF, 0x7D, 0xBF, 0x80, 0xBF, 0x94, 0xBF, 0x9B, 0xBF, 0xB4, 0xBF,
+    0xBB, 0x24, 0x77, 0x7D, 0xB9, 0x27, 0x80, 0x04, 0x42, 0x01, 0xA9, 0x7D, 0x01, 0xC3, 0x7D, 0x01,
+    0x6F, 0x7D, 0x01, 0xA9, 0x7D, 0x01, 0xC3, 0x7D, 0x01, 0x6D, 0x1D, 0x04, 0x61, 0x65, 0x69, 0x6F,
+    0x1D, 0x1D, 0x1D, 0x7D, 0x01, 0x6C, 0x77, 0x01, 0x6C, 0x7D, 0x01, 0x69, 0x7D, 0x82, 0x00, 0x01,
+    0x6C, 0x70, 0x68, 0x7D, 0x01, 0x61, 0xB7, 0x46, 0x03, 0x68, 0x6D, 0x74, 0x35, 0x7C, 0xB7, 0x45,
+    0x84, 0x00, 0x01, 0x2E, 0x6E, 0x72, 0x73, 0x04, 0x1C, 0x78, 0x16, 0x81, 0x00, 0xC1, 0x65, 0x2C,
+    0x01, 0x73, 0x06, 0x01, 0x6F, 0x7D, 0x01, 0x74, 0x7D, 0x80, 0x03, 0xF2, 0x01, 0xA9, 0x7D, 0x01,
+    0xC3, 0x7D, 0x01, 0x6C, 0x7D, 0x01, 0x73, 0x74, 0x82, 0x00, 0x11, 0x61, 0x69, 0x7A, 0x7D, 0x88,
+    0x00, 0x92, 0x2E, 0x65, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x04, 0x08, 0xBF, 0xDC, 0x02, 0x67,
+    0xBF, 0xDC, 0x02, 0x79, 0x82, 0x00, 0x92, 0x65, 0x75, 0x08, 0x22, 0x01, 0x75, 0x03, 0x01, 0xA9,
+    0x03, 0x02, 0x65, 0xC3, 0x7A, 0x7D, 0x01, 0x65, 0x11, 0x01, 0x72, 0x7D, 0x01, 0x74, 0x7D, 0x01,
+    0x73, 0x7D, 0x02, 0xA8, 0xA9, 0x39, 0x39, 0x08, 0x61, 0x65, 0x69, 0x6F, 0x73, 0x75, 0x76, 0xC3,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xBE, 0x05, 0x7B, 0x01, 0x79, 0x6E, 0x82, 0x00, 0x01, 0x61,
+    0x6C, 0x63, 0x7D, 0x02, 0x63, 0x7A, 0x27, 0x27, 0x01, 0x6F, 0x7B, 0x01, 0x64, 0x7D, 0x01, 0x74,
+    0x7D, 0x01, 0x61, 0x7D, 0x01, 0x76, 0x7D, 0x01, 0x74, 0xB2, 0x96, 0x01, 0x6E, 0x2E, 0x01, 0x69,
+    0x7D, 0x01, 0x6D, 0x7D, 0x01, 0xA9, 0x7D, 0x02, 0x73, 0xC3, 0x70, 0x7D, 0x01, 0x6E, 0x27, 0x01,
+    0x69, 0x7D, 0x01, 0x6D, 0x7D, 0x01, 0xA9, 0x7D, 0x02, 0x73, 0xC3, 0x10, 0x7D, 0x01, 0xA9, 0x7B,
+    0x85, 0x00, 0x92, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0x08, 0xBF, 0xD4, 0x67, 0xB8, 0xC6, 0x7D, 0x01,
+    0x68, 0x03, 0x01, 0x63, 0x7D, 0x01, 0x79, 0x7D, 0x01, 0x72, 0x03, 0x02, 0xA8, 0xA9, 0x7D, 0x7D,
+    0x01, 0xC3, 0x7B, 0x01, 0x6C, 0xBD, 0x0E, 0x02, 0x62, 0x63, 0x7C, 0x1E, 0x01, 0x61, 0x7B, 0x01,
+    0x6E, 0x7D, 0x83, 0x00, 0x01, 0x67, 0x70, 0x73, 0x7D, 0x30, 0x30, 0x01, 0x6C, 0x18, 0x01, 0x75,
+    0x7D, 0x80, 0x04, 0x13, 0x01, 0x71, 0x7D, 0x01, 0xA9, 0x7D, 0x01, 0xC3, 0x7D, 0x82, 0x00, 0x01,
+    0x6E, 0x72, 0x71, 0x7D, 0x07, 0xA2, 0xA8, 0xA9, 0xAA, 0xAE, 0xB4, 0xBB, 0x00, 0x00, 0x79, 0x00,
+    0x00, 0x00, 0x00, 0x0D, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x79,
+    0xC3, 0xBE, 0xCA, 0xBE, 0xDD, 0xBF, 0x0C, 0xB9, 0x9C, 0xBF, 0x21, 0xBF, 0x2E, 0xBF, 0x59, 0xBF,
+    0x9D, 0xBF, 0xB2, 0xBF, 0xBD, 0xBF, 0xCF, 0x00, 0x71, 0x02, 0x61, 0x65, 0x22, 0x08, 0x81, 0x00,
+    0x01, 0x75, 0x7B, 0x01, 0x61, 0x06, 0x01, 0x6F, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x6D, 0x0D, 0x83,
+    0x00, 0x01, 0x64, 0x69, 0x6D, 0x7A, 0x7D, 0x12, 0x02, 0x65, 0x69, 0x1F, 0x0F, 0x85, 0x00, 0x01,
+    0x2E, 0x6C, 0x6E, 0x70, 0x73, 0x04, 0x7B, 0x1C, 0x31, 0x16, 0x80, 0x02, 0x72, 0x01, 0x72, 0x7D,
+    0x03, 0x2E, 0x73, 0x75, 0x04, 0x16, 0x7D, 0x01, 0x64, 0x76, 0x82, 0x00, 0x92, 0x65, 0x79, 0x76,
+    0x7D, 0x01, 0x67, 0x0D, 0x82, 0x00, 0x01, 0x6D, 0x6E, 0x12, 0x7D, 0x81, 0x00, 0x01, 0x6C, 0x31,
+    0x01, 0x68, 0x0F, 0x81, 0x00, 0x01, 0x74, 0x7D, 0x01, 0x67, 0x28, 0x01, 0x72, 0x7D, 0x01, 0x75,
+    0x7D, 0x01, 0x63, 0x21, 0x01, 0x69, 0x7D, 0x84, 0x00, 0x01, 0x67, 0x6D, 0x73, 0x74, 0x0D, 0xBE,
+    0x3D, 0x77, 0x7D, 0x07, 0xA2, 0xA8, 0xA9, 0xAA, 0xAE, 0xB4, 0xBB, 0x00, 0x00, 0x74, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6D, 0x6F, 0x75, 0x79, 0xC3, 0xBF, 0x8D, 0x2A,
+    0xBF, 0x9B, 0xBF, 0xB8, 0xBF, 0xC2, 0x2A, 0x00, 0xBF, 0xC9, 0xBF, 0xD1, 0x71, 0x01, 0x70, 0xBE,
+    0xE2, 0x83, 0x00, 0x92, 0x2E, 0x65, 0x73, 0x04, 0x2C, 0x02, 0x01, 0xA9, 0xBE, 0xDE, 0x01, 0xC3,
+    0x7C, 0x01, 0x70, 0x03, 0x04, 0x61, 0x68, 0x6C, 0x6F, 0x69, 0x6D, 0x7A, 0x7D, 0x01, 0x6C, 0xAF,
+    0x5E, 0x01, 0x6C, 0x7C, 0x01, 0x69, 0x7D, 0x01, 0x69, 0xB1, 0xC1, 0x01, 0x75, 0x7C, 0x02, 0x2E,
+    0x71, 0x04, 0x7D, 0x85, 0x00, 0x01, 0x2E, 0x6D, 0x6E, 0x72, 0x73, 0x04, 0x37, 0x1C, 0xAD, 0x1D,
+    0x7B, 0x01, 0x6D, 0xBF, 0x49, 0x86, 0x00, 0x92, 0x2E, 0x65, 0x6D, 0x6F, 0x72, 0x73, 0x04, 0x08,
+    0x02, 0x7C, 0x02, 0x02, 0x01, 0x6F, 0xB7, 0x30, 0x02, 0x6C, 0x76, 0x7C, 0x03, 0x01, 0x76, 0x03,
+    0x02, 0x61, 0x6F, 0x78, 0x7D, 0x01, 0x61, 0x03, 0x01, 0x69, 0x7D, 0x01, 0x74, 0x7D, 0x01, 0x6D,
+    0x03, 0x01, 0x72, 0x7D, 0x01, 0x6C, 0x03, 0x01, 0x6F, 0xBB, 0xEE, 0x02, 0x65, 0x72, 0x79, 0x7C,
+    0x01, 0x6C, 0xBA, 0xAA, 0x81, 0x00, 0x92, 0x75, 0x7C, 0x01, 0x72, 0x7B, 0x05, 0x61, 0x65, 0x68,
+    0x69, 0x6F, 0xBF, 0xDF, 0x65, 0xBE, 0x64, 0x6F, 0x7D, 0x01, 0x64, 0x03, 0x01, 0x72, 0x7D, 0x01,
+    0x61, 0x7D, 0x01, 0x64, 0x7D, 0x01, 0x6E, 0x7D, 0x01, 0x6E, 0x03, 0x01, 0x69, 0x7D, 0x01, 0x67,
+    0xBF, 0xC0, 0x01, 0x6B, 0x03, 0x02, 0x63, 0x6D, 0x7D, 0xBF, 0xC2, 0x01, 0x74, 0xBD, 0xA0, 0x01,
+    0x63, 0x7C, 0x02, 0x6F, 0x75, 0xBF, 0x3B, 0x7D, 0x01, 0x65, 0x03, 0x01, 0x6C, 0x7D, 0x80, 0x02,
+    0x52, 0x01, 0x73, 0x7D, 0x01, 0x6F, 0x7D, 0x01, 0xA9, 0x7D, 0x01, 0xC3, 0x7D, 0x01, 0x72, 0x7D,
+    0x01, 0xA9, 0x7D, 0x07, 0x61, 0x65, 0x69, 0x6F, 0x72, 0x79, 0xC3, 0xBF, 0xC2, 0xBF, 0xC8, 0xBF,
+    0xCB, 0xBF, 0xD2, 0xBF, 0xDF, 0x68, 0x7D, 0x01, 0x69, 0xB6, 0x8D, 0x02, 0x6C, 0x73, 0x7C, 0x09,
+    0x01, 0x63, 0x3B, 0x82, 0x01, 0xC2, 0x6F, 0x73, 0x1A, 0x1A, 0x01, 0x72, 0x79, 0x01, 0x65, 0x7D,
+    0x80, 0x02, 0x92, 0x01, 0x68, 0x7D, 0x02, 0x61, 0xC3, 0x7D, 0xBD, 0x9E, 0x85, 0x00, 0x01, 0x62,
+    0x63, 0x6D, 0x70, 0x72, 0xBF, 0xDF, 0x64, 0x12, 0x71, 0x7A, 0x0D, 0x61, 0x63, 0x65, 0x68, 0x69,
+    0x6C, 0x6F, 0x70, 0x74, 0x75, 0x79, 0xC3, 0xC5, 0x00, 0xBE, 0xEA, 0xBF, 0x09, 0xBF, 0x1B, 0x00,
+    0xBF, 0x36, 0x00, 0xBF, 0x62, 0xBF, 0xB9, 0x72, 0x00, 0x25, 0x34, 0x01, 0x79, 0xBE, 0x18, 0x01,
+    0x68, 0x7C, 0x83, 0x00, 0x01, 0x63, 0x6D, 0x6E, 0x7D, 0x12, 0xBE, 0x4F, 0x01, 0x74, 0xB1, 0x86,
+    0x01, 0x6E, 0x7C, 0x01, 0x69, 0x7D, 0x01, 0x68, 0x7D, 0x01, 0x6D, 0x27, 0x01, 0x61, 0x7D, 0x01,
+    0x72, 0x7D, 0x01, 0xA9, 0x7D, 0x01, 0xC3, 0x7D, 0x01, 0x70, 0x7D, 0x01, 0x61, 0xB8, 0x70, 0x02,
+    0x2E, 0x74, 0x04, 0x7C, 0x85, 0x00, 0x01, 0x2E, 0x6D, 0x6E, 0x72, 0x73, 0x04, 0x74, 0x1C, 0xBE,
+    0x1D, 0x7B, 0x01, 0x73, 0x1B, 0x01, 0x6F, 0x7D, 0x01, 0x6D, 0x7D, 0x04, 0x2E, 0x72, 0x73, 0x75,
+    0x04, 0x7D, 0x16, 0xBD, 0xF2, 0x82, 0x00, 0xC1, 0x65, 0x69, 0x2C, 0xB2, 0xE5, 0x87, 0x00, 0x92,
+    0x2E, 0x65, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x04, 0x6E, 0x02, 0x02, 0x02, 0x78, 0x02, 0x82, 0x00,
+    0x01, 0x6D, 0x72, 0x12, 0xB7, 0x09, 0x01, 0x73, 0x14, 0x82, 0x03, 0x23, 0x63, 0x74, 0xAE, 0x87,
+    0x7D, 0x01, 0x72, 0x2E, 0x81, 0x03, 0x02, 0x61, 0x7D, 0x05, 0x61, 0x68, 0x6F, 0x70, 0x75, 0x70,
+    0x13, 0x2F, 0x7B, 0x2F, 0x01, 0x73, 0x75, 0x01, 0x6E, 0x7D, 0x84, 0x00, 0x92, 0x61, 0x65, 0x69,
+    0x75, 0x7D, 0x08, 0xB5, 0xAC, 0xBF, 0x16, 0x01, 0x73, 0x13, 0x01, 0x67, 0x7D, 0x01, 0x62, 0x3B,
+    0x83, 0x00, 0x01, 0x6D, 0x6E, 0x72, 0x12, 0x7A, 0x7D, 0x02, 0x62, 0x70, 0x1B, 0x1B, 0x04, 0x65,
+    0x69, 0x6F, 0x73, 0x1B, 0x1B, 0x7B, 0x1B, 0x01, 0xA9, 0x77, 0x01, 0xC3, 0x7D, 0x81, 0x00, 0x01,
+    0x6C, 0x7D, 0x08, 0xA0, 0xA2, 0xA8, 0xA9, 0xAA, 0xAE, 0xB4, 0xBB, 0x00, 0x00, 0x00, 0x7B, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x74, 0x75, 0x79, 0xC3, 0xBF,
+    0x1F, 0xBF, 0x33, 0xBF, 0x51, 0xBF, 0x7A, 0x00, 0xBF, 0x8B, 0xBF, 0xB7, 0xBB, 0x04, 0xBF, 0xCD,
+    0x00, 0x6F, 0x01, 0x76, 0x37, 0x01, 0x78, 0x09, 0x01, 0x76, 0x09, 0x02, 0x61, 0x6F, 0x7A, 0x7D,
+    0x01, 0x69, 0x7B, 0x01, 0x72, 0x17, 0x01, 0x74, 0x7D, 0x05, 0x63, 0x65, 0x6E, 0x73, 0x76, 0x2A,
+    0x69, 0x77, 0x7D, 0x2A, 0x02, 0x6E, 0x73, 0x1D, 0x1D, 0x01, 0x69, 0x7B, 0x01, 0x6C, 0x7D, 0x01,
+    0x6C, 0x7D, 0x01, 0x69, 0x7D, 0x82, 0x00, 0x01, 0x63, 0x6E, 0x37, 0x7D, 0x01, 0x74, 0x27, 0x01,
+    0x6F, 0x7D, 0x01, 0x70, 0x7D, 0x01, 0x69, 0x7D, 0x02, 0x2E, 0x72, 0x02, 0x7D, 0x02, 0x69, 0x74,
+    0x0F, 0x7B, 0x83, 0x00, 0x01, 0x2E, 0x6E, 0x73, 0x04, 0x7B, 0x16, 0x82, 0x00, 0x01, 0x64, 0x6C,
+    0xB7, 0x0E, 0xB5, 0x58, 0x01, 0x6D, 0xAC, 0xA9, 0x01, 0x61, 0x7C, 0x01, 0x74, 0x7D, 0x81, 0x00,
+    0x01, 0x6C, 0x7D, 0x01, 0x69, 0x06, 0x01, 0x6B, 0x7D, 0x01, 0x73, 0x7D, 0x01, 0x6F, 0x7D, 0x81,
+    0x00, 0x01, 0x6C, 0x7D, 0x07, 0xA2, 0xA8, 0xA9, 0xAA, 0xAE, 0xB4, 0xBB, 0x00, 0x00, 0x7B, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x61, 0x65, 0x69, 0x6F, 0x72, 0x75, 0x79, 0xC3, 0xBF, 0xA2, 0xBF, 0xBF,
+    0xBF, 0xC8, 0xBF, 0xDB, 0x26, 0x00, 0x00, 0x71, 0x01, 0x6E, 0x1E, 0x81, 0x00, 0x01, 0x67, 0x7D,
+    0x06, 0x61, 0x65, 0x69, 0x6F, 0x72, 0x75, 0x7B, 0x15, 0x00, 0x00, 0x03, 0x00, 0x01, 0x6C, 0xB4,
+    0xF6, 0x02, 0x65, 0x69, 0xB6, 0x3F, 0x7C, 0x01, 0x68, 0x29, 0x01, 0x74, 0x7D, 0x02, 0x6C, 0x73,
+    0xB7, 0xE9, 0x7D, 0x01, 0x6F, 0x3F, 0x01, 0x74, 0x7D, 0x02, 0x61, 0x73, 0x74, 0x7D, 0x02, 0xA8,
+    0xA9, 0x00, 0x00, 0x07, 0x61, 0x65, 0x69, 0x6F, 0x75, 0x79, 0xC3, 0x00, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x7B, 0x03, 0x65, 0x69, 0x75, 0x1F, 0x0F, 0x0F, 0x01, 0x69, 0x18, 0x80, 0x05, 0xD2, 0x01,
+    0x65, 0x32, 0x01, 0x75, 0x7D, 0x02, 0x65, 0x71, 0x32, 0x7D, 0x01, 0x69, 0x7B, 0x03, 0x65, 0x68,
+    0x72, 0x1F, 0x6C, 0x7D, 0x01, 0x72, 0x32, 0x01, 0x74, 0x7D, 0x01, 0x63, 0x7D, 0x01, 0x75, 0x10,
+    0x01, 0x71, 0x7D, 0x01, 0x74, 0x32, 0x01, 0x6E, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x6D, 0x7D, 0x01,
+    0xA9, 0x7D, 0x04, 0x65, 0x69, 0x6F, 0xC3, 0x68, 0x0F, 0x6E, 0x7D, 0x01, 0x67, 0x32, 0x01, 0x72,
+    0x7D, 0x02, 0x65, 0x69, 0x7D, 0xB7, 0xA9, 0x81, 0x03, 0x02, 0x65, 0xA9, 0x4E, 0x01, 0x70, 0x7A,
+    0x01, 0x6F, 0x7D, 0x01, 0x63, 0x7D, 0x01, 0x73, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x74, 0x2E, 0x01,
+    0x6F, 0x7D, 0x01, 0x6C, 0xB2, 0x17, 0x01, 0x61, 0x7C, 0x02, 0x70, 0x76, 0x76, 0x7D, 0x02, 0x65,
+    0x69, 0x1F, 0x7B, 0x01, 0x75, 0x7B, 0x08, 0x63, 0x64, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0xBF,
+    0x7C, 0xBF, 0x97, 0xBF, 0xBC, 0x37, 0xBF, 0xCB, 0x63, 0x7D, 0x31, 0x05, 0xA2, 0xA7, 0xA8, 0xA9,
+    0xB4, 0x24, 0x00, 0x24, 0x6B, 0x24, 0x1D, 0x27, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7A, 0xC3, 0xAA, 0xDB, 0xB1, 0x7E, 0xB2, 0xFB, 0xB3, 0x72, 0xB4, 0xF1, 0xB5, 0x93,
+    0xB5, 0xF8, 0xB6, 0x3B, 0xB6, 0x8F, 0xB7, 0x09, 0xB7, 0xDD, 0xB7, 0xFA, 0xB8, 0x08, 0xB8, 0x52,
+    0xB8, 0xF3, 0xB9, 0x29, 0xB9, 0xD1, 0xBB, 0x4D, 0xBB, 0x78, 0xBB, 0xFC, 0xBD, 0x44, 0xBE, 0x4D,
+    0xBE, 0x83, 0xBE, 0xFD, 0xBF, 0x1A, 0xBF, 0x2B, 0xBF, 0x43, 0xBF, 0x4D, 0x75,
 };
 
 constexpr SerializedHyphenationPatterns fr_patterns = {
-    0x1AF0u,
+    0x1896u,
+    0x8Du,
     fr_trie_data,
     sizeof(fr_trie_data),
 };
@@ -7,107 +7,101 @@
 
 // Auto-generated by generate_hyphenation_trie.py. Do not edit manually.
 alignas(4) constexpr uint8_t it_trie_data[] = {
-    0x17, 0x0C, 0x33, 0x35, 0x0C, 0x29, 0x22, 0x0D, 0x3E, 0x0B, 0x47, 0x20, 0x0D, 0x16, 0x0B, 0x34,
-    0x0D, 0x21, 0x0C, 0x3D, 0x1F, 0x0C, 0x2A, 0x17, 0x2A, 0x0B, 0x02, 0x0C, 0x01, 0x02, 0x16, 0x02,
-    0x0D, 0x0C, 0x0C, 0x0D, 0x03, 0x0C, 0x01, 0x0C, 0x0E, 0x0D, 0x04, 0x02, 0x0B, 0xA0, 0x00, 0x42,
-    0x21, 0x6E, 0xFD, 0xA0, 0x00, 0x72, 0x21, 0x6E, 0xFD, 0xA1, 0x00, 0x61, 0x6D, 0xFD, 0x21, 0x69,
-    0xFB, 0x21, 0x74, 0xFD, 0x22, 0x70, 0x6E, 0xEC, 0xFD, 0xA0, 0x00, 0x91, 0x21, 0x6F, 0xFD, 0x21,
-    0x69, 0xFD, 0xA0, 0x00, 0xA2, 0x21, 0x73, 0xFD, 0x21, 0x70, 0xFD, 0xA0, 0x00, 0xC2, 0x21, 0x6D,
-    0xFD, 0x21, 0x75, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x72, 0xFD, 0xA0, 0x00, 0xE1, 0x21, 0x6F, 0xFD,
-    0x21, 0x72, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0xA3, 0x01, 0x11, 0x61, 0x69, 0x6F, 0xDF,
-    0xEE, 0xFD, 0xA0, 0x00, 0xF2, 0x21, 0x65, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x63,
-    0xFD, 0x21, 0x73, 0xFD, 0xA1, 0x01, 0x11, 0x69, 0xFD, 0xA0, 0x01, 0x12, 0x21, 0x75, 0xFD, 0x21,
-    0x65, 0xFD, 0x21, 0x78, 0xFD, 0xA0, 0x01, 0x32, 0x21, 0x6B, 0xFD, 0x21, 0x6E, 0xFD, 0xA0, 0x00,
-    0x71, 0x21, 0x65, 0xFD, 0x22, 0x61, 0x65, 0xF7, 0xFD, 0x21, 0x72, 0xFB, 0xA0, 0x01, 0x52, 0x21,
-    0x61, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x70, 0xFD, 0x21, 0x69, 0xFD, 0xA0, 0x01, 0x71, 0x21, 0x6F,
-    0xFD, 0x21, 0x63, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x61, 0xFD, 0xA0, 0x00, 0x61, 0x21, 0x6F, 0xFD,
-    0x21, 0x74, 0xFD, 0x41, 0x70, 0xFF, 0x50, 0x21, 0x6F, 0xFC, 0x21, 0x74, 0xFD, 0x22, 0x70, 0x72,
-    0xF3, 0xFD, 0x21, 0x61, 0xE8, 0x21, 0x72, 0xFD, 0xA0, 0x00, 0xF1, 0x22, 0x6C, 0x72, 0xFD, 0xFD,
-    0x21, 0x69, 0xE3, 0x21, 0x6C, 0xFD, 0x41, 0x65, 0xFF, 0x43, 0xA0, 0x01, 0x11, 0x25, 0x61, 0x68,
-    0x6F, 0x72, 0x73, 0xE8, 0xEE, 0xF6, 0xF9, 0xFD, 0xA0, 0x01, 0x82, 0x21, 0x72, 0xFD, 0x21, 0x63,
-    0xFD, 0x21, 0x73, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x65, 0xFD, 0xA0, 0x01, 0xA2, 0x21, 0x65, 0xFD,
-    0x21, 0x72, 0xFD, 0x21, 0x61, 0xFD, 0x41, 0x75, 0xFF, 0x4C, 0x42, 0x6C, 0x72, 0xFF, 0xFC, 0xFF,
-    0x48, 0x21, 0x62, 0xF9, 0x22, 0x68, 0x75, 0xEF, 0xFD, 0x47, 0x63, 0x64, 0x6C, 0x6E, 0x70, 0x72,
-    0x74, 0xFF, 0x5C, 0xFF, 0x5C, 0xFF, 0x5C, 0xFF, 0x5C, 0xFF, 0x5C, 0xFF, 0x5C, 0xFF, 0x5C, 0x21,
-    0x73, 0xEA, 0x21, 0x6E, 0xFD, 0x21, 0x61, 0xFD, 0xA1, 0x01, 0x11, 0x72, 0xFD, 0x41, 0x6E, 0xFF,
-    0x15, 0x21, 0x67, 0xFC, 0xA0, 0x01, 0xC2, 0x21, 0x74, 0xFD, 0x21, 0x6C, 0xFD, 0x22, 0x61, 0x65,
-    0xF4, 0xFD, 0x52, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74,
-    0x77, 0x68, 0x6A, 0x6B, 0x7A, 0xFE, 0xC2, 0xFE, 0xCD, 0xFE, 0xF7, 0xFF, 0x12, 0xFF, 0x20, 0xFF,
-    0x37, 0xFF, 0x46, 0xFF, 0x55, 0xFF, 0x6B, 0xFF, 0x8B, 0xFF, 0xA5, 0xFF, 0xC2, 0xFF, 0xE6, 0xFF,
-    0xFB, 0xFF, 0x88, 0xFF, 0x88, 0xFF, 0x88, 0xFF, 0x88, 0xA0, 0x01, 0xE2, 0xA0, 0x00, 0xD1, 0x24,
-    0x61, 0x65, 0x6F, 0x75, 0xFD, 0xFD, 0xFD, 0xFD, 0x21, 0x6F, 0xF4, 0x21, 0x61, 0xF1, 0xA0, 0x01,
-    0xE1, 0x21, 0x2E, 0xFD, 0x24, 0x69, 0x75, 0x79, 0x74, 0xEB, 0xF4, 0xF7, 0xFD, 0x21, 0x75, 0xDF,
-    0xA0, 0x00, 0x51, 0x22, 0x69, 0x77, 0xFA, 0xFD, 0x21, 0x69, 0xD7, 0xAE, 0x02, 0x01, 0x62, 0x63,
-    0x64, 0x66, 0x6D, 0x6E, 0x70, 0x73, 0x74, 0x76, 0x6C, 0x72, 0x2E, 0x27, 0xE3, 0xE3, 0xE3, 0xE3,
-    0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xF5, 0xF5, 0xE3, 0xE3, 0x22, 0x2E, 0x27, 0xC4, 0xC7, 0xC6,
-    0x00, 0x51, 0x68, 0x2E, 0x27, 0x62, 0x72, 0x6E, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xFB, 0xFF, 0xBF,
-    0xFE, 0xFB, 0xFF, 0xBF, 0xD0, 0x02, 0x01, 0x62, 0x63, 0x64, 0x66, 0x6B, 0x6D, 0x6E, 0x71, 0x73,
-    0x74, 0x7A, 0x68, 0x6C, 0x72, 0x2E, 0x27, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF,
-    0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xEB, 0xFF,
-    0xBC, 0xFF, 0xBC, 0xFF, 0xAA, 0xFF, 0xAA, 0xCE, 0x02, 0x01, 0x62, 0x64, 0x67, 0x6C, 0x6D, 0x6E,
-    0x70, 0x72, 0x73, 0x74, 0x76, 0x77, 0x2E, 0x27, 0xFF, 0x77, 0xFF, 0x77, 0xFF, 0x77, 0xFF, 0x77,
-    0xFF, 0x77, 0xFF, 0x77, 0xFF, 0x77, 0xFF, 0x89, 0xFF, 0x77, 0xFF, 0x77, 0xFF, 0x77, 0xFF, 0x77,
-    0xFF, 0x77, 0xFF, 0x77, 0xCA, 0x02, 0x01, 0x62, 0x67, 0x66, 0x6E, 0x6C, 0x72, 0x73, 0x74, 0x2E,
-    0x27, 0xFF, 0x4A, 0xFF, 0x4A, 0xFF, 0x4A, 0xFF, 0x4A, 0xFF, 0x5C, 0xFF, 0x5C, 0xFF, 0x4A, 0xFF,
-    0x4A, 0xFF, 0x4A, 0xFF, 0x4A, 0xA0, 0x02, 0x12, 0xA1, 0x00, 0x51, 0x74, 0xFD, 0xD1, 0x02, 0x01,
-    0x62, 0x64, 0x66, 0x67, 0x68, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x76, 0x77, 0x7A, 0x2E,
-    0x27, 0xFF, 0x21, 0xFF, 0x21, 0xFF, 0x21, 0xFF, 0x21, 0xFF, 0xFB, 0xFF, 0x33, 0xFF, 0x21, 0xFF,
-    0x33, 0xFF, 0x21, 0xFF, 0x33, 0xFF, 0x21, 0xFF, 0x21, 0xFF, 0x21, 0xFF, 0x21, 0xFF, 0x21, 0xFF,
-    0x21, 0xFF, 0x21, 0x41, 0x70, 0xFD, 0x4D, 0xCB, 0x02, 0x01, 0x62, 0x64, 0x68, 0x69, 0x6C, 0x6D,
-    0x6E, 0x72, 0x76, 0x2E, 0x27, 0xFE, 0xE7, 0xFE, 0xE7, 0xFE, 0xE7, 0xFF, 0xFC, 0xFE, 0xF9, 0xFE,
-    0xE7, 0xFE, 0xE7, 0xFE, 0xE7, 0xFE, 0xE7, 0xFE, 0xE7, 0xFE, 0xE7, 0xC2, 0x02, 0x01, 0x2E, 0x27,
-    0xFE, 0xC3, 0xFE, 0xC3, 0xCB, 0x02, 0x01, 0x67, 0x66, 0x68, 0x6B, 0x6C, 0x6D, 0x72, 0x73, 0x74,
-    0x2E, 0x27, 0xFE, 0xBA, 0xFE, 0xBA, 0xFE, 0xCC, 0xFE, 0xBA, 0xFE, 0xCC, 0xFE, 0xBA, 0xFE, 0xCC,
-    0xFE, 0xBA, 0xFE, 0xBA, 0xFE, 0xBA, 0xFE, 0xBA, 0xA0, 0x02, 0x33, 0x42, 0x2E, 0x27, 0xFE, 0x93,
-    0xFE, 0x93, 0xD5, 0x02, 0x01, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
-    0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x7A, 0x2E, 0x27, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C,
-    0xFF, 0xF6, 0xFE, 0x8C, 0xFE, 0x9E, 0xFE, 0x9E, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C,
-    0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C,
-    0xFE, 0x8C, 0xFF, 0xF9, 0xCF, 0x02, 0x01, 0x62, 0x63, 0x66, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72,
-    0x73, 0x74, 0x76, 0x77, 0x2E, 0x27, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A,
-    0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A,
-    0xFE, 0x4A, 0xFE, 0x4A, 0xA0, 0x02, 0x62, 0xA1, 0x01, 0xE1, 0x6E, 0xFD, 0x21, 0x72, 0xF8, 0x21,
-    0x65, 0xFD, 0xA1, 0x01, 0xE1, 0x66, 0xFD, 0x41, 0x74, 0xFE, 0x07, 0x21, 0x69, 0xFC, 0x21, 0x65,
-    0xFD, 0xD3, 0x02, 0x01, 0x62, 0x63, 0x64, 0x66, 0x67, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72,
-    0x73, 0x74, 0x76, 0x7A, 0x68, 0x2E, 0x27, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFF,
-    0xE6, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFF,
-    0xF1, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFF, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xA0, 0x02, 0x82,
-    0xA1, 0x01, 0xE1, 0x65, 0xFD, 0x21, 0x63, 0xF8, 0xA1, 0x01, 0xE1, 0x69, 0xFD, 0xCB, 0x02, 0x01,
-    0x64, 0x68, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x7A, 0x2E, 0x27, 0xFD, 0xB1, 0xFD, 0xC3, 0xFD,
-    0xC3, 0xFF, 0xF3, 0xFD, 0xB1, 0xFD, 0xC3, 0xFF, 0xFB, 0xFD, 0xB1, 0xFD, 0xB1, 0xFD, 0xB1, 0xFD,
-    0xB1, 0xC3, 0x02, 0x01, 0x71, 0x2E, 0x27, 0xFD, 0x8D, 0xFD, 0x8D, 0xFD, 0x8D, 0xA0, 0x02, 0x53,
-    0xA1, 0x01, 0xE1, 0x73, 0xFD, 0xD5, 0x02, 0x01, 0x62, 0x63, 0x64, 0x66, 0x68, 0x67, 0x6B, 0x6C,
-    0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x78, 0x77, 0x7A, 0x2E, 0x27, 0xFD, 0x79, 0xFD,
-    0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x8B, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFD,
-    0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFF, 0xFB, 0xFD, 0x79, 0xFD, 0x79, 0xFD,
-    0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x79, 0x43, 0x6D, 0x2E, 0x27, 0xFD, 0x37, 0xFD, 0x37, 0xFD,
-    0x37, 0xA0, 0x02, 0xC2, 0xA1, 0x02, 0x32, 0x6D, 0xFD, 0x41, 0x6E, 0xFE, 0x8F, 0x4B, 0x62, 0x63,
-    0x64, 0x66, 0x67, 0x6D, 0x6E, 0x70, 0x73, 0x74, 0x76, 0xFD, 0x21, 0xFD, 0x21, 0xFD, 0x21, 0xFD,
-    0x21, 0xFD, 0x21, 0xFD, 0x21, 0xFD, 0x21, 0xFD, 0x21, 0xFD, 0x21, 0xFD, 0x21, 0xFD, 0x21, 0xA0,
-    0x02, 0xE1, 0x22, 0x2E, 0x27, 0xFD, 0xFD, 0xC7, 0x02, 0xA2, 0x68, 0x73, 0x70, 0x74, 0x7A, 0x2E,
-    0x27, 0xFF, 0xC0, 0xFF, 0xCD, 0xFF, 0xD2, 0xFF, 0xD6, 0xFC, 0xF7, 0xFF, 0xF8, 0xFF, 0xFB, 0xC1,
-    0x00, 0x51, 0x2E, 0xFC, 0xDF, 0x41, 0x68, 0xFF, 0x18, 0xA1, 0x00, 0x51, 0x63, 0xFC, 0xC1, 0x01,
-    0xE1, 0x73, 0xFE, 0xB6, 0xC2, 0x00, 0x51, 0x6B, 0x73, 0xFC, 0xCA, 0xFC, 0x06, 0xD2, 0x02, 0x01,
-    0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x76, 0x77, 0x7A,
-    0x2E, 0x27, 0xFC, 0xC1, 0xFC, 0xC1, 0xFC, 0xC1, 0xFC, 0xC1, 0xFC, 0xC1, 0xFF, 0xE2, 0xFC, 0xD3,
-    0xFC, 0xC1, 0xFC, 0xC1, 0xFC, 0xC1, 0xFC, 0xD3, 0xFF, 0xEC, 0xFF, 0xF1, 0xFC, 0xC1, 0xFC, 0xC1,
-    0xFF, 0xF7, 0xFC, 0xC1, 0xFE, 0x2E, 0xC6, 0x02, 0x01, 0x63, 0x6C, 0x72, 0x76, 0x2E, 0x27, 0xFC,
-    0x88, 0xFC, 0x9A, 0xFC, 0x9A, 0xFC, 0x88, 0xFC, 0x88, 0xFD, 0xF5, 0x41, 0x72, 0xFB, 0xAF, 0xA0,
-    0x02, 0xF2, 0xC5, 0x02, 0x01, 0x68, 0x61, 0x79, 0x2E, 0x27, 0xFC, 0x7E, 0xFF, 0xF9, 0xFF, 0xFD,
-    0xFC, 0x6C, 0xFC, 0x6C, 0xCA, 0x02, 0x01, 0x62, 0x63, 0x66, 0x68, 0x6D, 0x70, 0x74, 0x77, 0x2E,
-    0x27, 0xFC, 0x5A, 0xFC, 0x5A, 0xFC, 0x5A, 0xFC, 0x5A, 0xFC, 0x5A, 0xFC, 0x5A, 0xFC, 0x5A, 0xFC,
-    0x5A, 0xFC, 0x5A, 0xFC, 0x5A, 0x42, 0x6F, 0x69, 0xFC, 0x48, 0xFC, 0x27, 0xCB, 0x02, 0x01, 0x62,
-    0x64, 0x6C, 0x6E, 0x70, 0x74, 0x73, 0x76, 0x7A, 0x2E, 0x27, 0xFC, 0x32, 0xFC, 0x32, 0xFC, 0x32,
-    0xFC, 0x32, 0xFC, 0x32, 0xFC, 0x32, 0xFC, 0x32, 0xFC, 0x32, 0xFC, 0x32, 0xFC, 0x32, 0xFD, 0x9F,
-    0x5A, 0x2E, 0x27, 0x61, 0x65, 0x6F, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D,
-    0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xFB, 0xC2, 0xFB, 0xF9, 0xFC,
-    0x14, 0xFC, 0x23, 0xFC, 0x28, 0xFC, 0x2B, 0xFC, 0x64, 0xFC, 0x97, 0xFC, 0xC4, 0xFC, 0xED, 0xFD,
-    0x27, 0xFD, 0x4B, 0xFD, 0x54, 0xFD, 0x82, 0xFD, 0xC4, 0xFE, 0x11, 0xFE, 0x5D, 0xFE, 0x81, 0xFE,
-    0x95, 0xFF, 0x17, 0xFF, 0x4D, 0xFF, 0x86, 0xFF, 0xA2, 0xFF, 0xB4, 0xFF, 0xD5, 0xFF, 0xDC,
+    0x01, 0x02, 0x0B, 0x16, 0x0C, 0x0C, 0x0D, 0x03, 0x0C, 0x01, 0x0C, 0x04, 0x02, 0x0D, 0x0C, 0x0E,
+    0x0D, 0x17, 0x0C, 0x02, 0x16, 0x02, 0x0C, 0x2A, 0x0B, 0x20, 0x0D, 0x34, 0x0D, 0x2A, 0x17, 0x1F,
+    0x0C, 0x29, 0x35, 0x0C, 0x33, 0x3D, 0x21, 0x0C, 0x16, 0x0B, 0x47, 0x3E, 0x0B, 0x22, 0x0D, 0x00,
+    0x02, 0x78, 0x00, 0x02, 0x8D, 0x00, 0x02, 0x6C, 0x00, 0x01, 0x82, 0x00, 0x01, 0x6B, 0x00, 0x03,
+    0x8D, 0x00, 0x01, 0x48, 0x00, 0x03, 0xE3, 0x00, 0x04, 0x2B, 0x00, 0x04, 0x92, 0x00, 0x03, 0x05,
+    0x00, 0x03, 0x92, 0x00, 0x01, 0x06, 0x00, 0x02, 0x7B, 0x00, 0x02, 0x6F, 0x00, 0x01, 0x0E, 0x00,
+    0x01, 0xAC, 0x00, 0x00, 0xF2, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xA3, 0x00, 0x00, 0xEF, 0x00, 0x02,
+    0x3B, 0x00, 0x02, 0x84, 0x00, 0x02, 0x90, 0x00, 0x02, 0xC3, 0x00, 0x02, 0xE6, 0x00, 0x03, 0x08,
+    0x00, 0x03, 0x0D, 0x00, 0x03, 0x2C, 0x00, 0x03, 0x54, 0x00, 0x03, 0x6D, 0x00, 0x03, 0x74, 0x00,
+    0x03, 0x95, 0x00, 0x03, 0xC2, 0x00, 0x03, 0xFF, 0x00, 0x04, 0x28, 0x00, 0x04, 0x3B, 0x00, 0x04,
+    0x54, 0x00, 0x04, 0x65, 0x00, 0x04, 0xC3, 0x00, 0x04, 0xED, 0x00, 0x05, 0x14, 0x00, 0x05, 0x29,
+    0x00, 0x05, 0x36, 0x00, 0x05, 0x4D, 0x00, 0x05, 0x52, 0x00, 0x05, 0x23, 0x00, 0x05, 0x26, 0x00,
+    0x04, 0xD4, 0x00, 0x04, 0xDC, 0x00, 0x04, 0xE1, 0x00, 0x04, 0xE6, 0x00, 0x04, 0xD9, 0x00, 0x04,
+    0x95, 0x00, 0x04, 0x9A, 0x00, 0x04, 0xA1, 0x00, 0x04, 0xA7, 0x00, 0x04, 0xAC, 0x00, 0x04, 0xA4,
+    0x00, 0x04, 0x60, 0x00, 0x04, 0x5D, 0x00, 0x04, 0x2E, 0x00, 0x04, 0x36, 0x00, 0x04, 0x33, 0x80,
+    0x01, 0x52, 0x80, 0x02, 0x22, 0x01, 0x6E, 0x11, 0x81, 0x02, 0x41, 0x6D, 0x7D, 0x01, 0x69, 0x7B,
+    0x01, 0x74, 0x7D, 0x80, 0x01, 0x12, 0x01, 0x6E, 0x7D, 0x02, 0x6E, 0x70, 0x77, 0x0C, 0x80, 0x02,
+    0x11, 0x01, 0x6F, 0x0F, 0x01, 0x69, 0x7D, 0x80, 0x02, 0xD2, 0x01, 0x73, 0x7D, 0x01, 0x70, 0x7D,
+    0x80, 0x02, 0xB2, 0x01, 0x6D, 0x7D, 0x01, 0x75, 0x7D, 0x01, 0x63, 0x7D, 0x01, 0x72, 0x7D, 0x80,
+    0x02, 0xA1, 0x01, 0x6F, 0x7D, 0x01, 0x72, 0x7D, 0x01, 0x74, 0x7D, 0x01, 0x6E, 0x7D, 0x83, 0x00,
+    0x31, 0x61, 0x69, 0x6F, 0xBF, 0xDF, 0x6E, 0x7D, 0x80, 0x01, 0x92, 0x01, 0x65, 0x06, 0x01, 0x6E,
+    0x7D, 0x01, 0x69, 0x7D, 0x01, 0x63, 0x7D, 0x01, 0x73, 0x7D, 0x81, 0x00, 0x31, 0x69, 0x7D, 0x80,
+    0x02, 0x82, 0x01, 0x75, 0x7D, 0x01, 0x65, 0x7D, 0x01, 0x78, 0x7D, 0x80, 0x01, 0xB2, 0x01, 0x6B,
+    0x04, 0x01, 0x6E, 0x7D, 0x80, 0x02, 0x21, 0x01, 0x65, 0x7D, 0x02, 0x61, 0x65, 0x77, 0x7D, 0x01,
+    0x72, 0x7B, 0x80, 0x00, 0x31, 0x80, 0x02, 0x62, 0x01, 0x61, 0x7D, 0x01, 0x73, 0x7D, 0x01, 0x70,
+    0x7D, 0x01, 0x69, 0x7D, 0x80, 0x02, 0x51, 0x01, 0x6F, 0x7D, 0x01, 0x63, 0x7D, 0x01, 0x72, 0x7D,
+    0x01, 0x61, 0x7D, 0x80, 0x02, 0x41, 0x01, 0x6F, 0x13, 0x01, 0x74, 0x7D, 0x01, 0x70, 0x11, 0x01,
+    0x6F, 0x10, 0x01, 0x74, 0x7D, 0x02, 0x70, 0x72, 0x74, 0x7D, 0x01, 0x61, 0x13, 0x01, 0x72, 0x7D,
+    0x80, 0x01, 0x91, 0x02, 0x6C, 0x72, 0x12, 0x12, 0x01, 0x69, 0x10, 0x01, 0x6C, 0x7D, 0x01, 0x65,
+    0x0F, 0x05, 0x61, 0x68, 0x6F, 0x72, 0x73, 0x6C, 0x72, 0x7A, 0x7D, 0x03, 0x80, 0x01, 0xF2, 0x01,
+    0x72, 0x7D, 0x01, 0x63, 0x7D, 0x01, 0x73, 0x7D, 0x01, 0x69, 0x7D, 0x01, 0x65, 0x7D, 0x80, 0x01,
+    0xD2, 0x01, 0x65, 0x7D, 0x01, 0x72, 0x7D, 0x01, 0x61, 0x7D, 0x01, 0x75, 0x06, 0x02, 0x6C, 0x72,
+    0x7D, 0x06, 0x01, 0x62, 0x7B, 0x02, 0x68, 0x75, 0x72, 0x7D, 0x07, 0x63, 0x64, 0x6C, 0x6E, 0x70,
+    0x72, 0x74, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x01, 0x73, 0x71, 0x01, 0x6E, 0x7D, 0x01,
+    0x61, 0x7D, 0x81, 0x00, 0x31, 0x72, 0x7D, 0x01, 0x6E, 0x06, 0x01, 0x67, 0x7D, 0x80, 0x01, 0x72,
+    0x01, 0x74, 0x7D, 0x01, 0x6C, 0x7D, 0x02, 0x61, 0x65, 0x74, 0x7D, 0x12, 0x61, 0x62, 0x63, 0x64,
+    0x65, 0x66, 0x68, 0x6A, 0x6B, 0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x77, 0x7A, 0xBE, 0xCE,
+    0xBE, 0xD9, 0xBF, 0x03, 0xBF, 0x1F, 0xBF, 0x2D, 0xBF, 0x44, 0x03, 0x03, 0x03, 0xBF, 0x56, 0xBF,
+    0x65, 0xBF, 0x7A, 0xBF, 0x96, 0xBF, 0xB0, 0xBF, 0xCA, 0x67, 0x7B, 0x03, 0x80, 0x00, 0x21, 0x04,
+    0x61, 0x65, 0x6F, 0x75, 0x02, 0x02, 0x02, 0x02, 0x80, 0x00, 0x11, 0x01, 0x2E, 0x00, 0x01, 0x6F,
+    0x02, 0x01, 0x61, 0x02, 0x04, 0x69, 0x74, 0x75, 0x79, 0x0E, 0x0D, 0x7A, 0x7D, 0x80, 0x00, 0x41,
+    0x8E, 0x00, 0x01, 0x27, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74,
+    0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02,
+    0x27, 0x2E, 0x0D, 0x00, 0x86, 0x00, 0x41, 0x27, 0x2E, 0x62, 0x68, 0x6E, 0x72, 0x7B, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x90, 0x00, 0x01, 0x27, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x68, 0x6B, 0x6C, 0x6D,
+    0x6E, 0x71, 0x72, 0x73, 0x74, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x01, 0x27, 0x2E, 0x62, 0x64, 0x67, 0x6C, 0x6D,
+    0x6E, 0x70, 0x72, 0x73, 0x74, 0x76, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x75, 0x02, 0x02, 0x69, 0x77, 0x0A, 0x01, 0x8A, 0x00, 0x01,
+    0x27, 0x2E, 0x62, 0x66, 0x67, 0x6C, 0x6E, 0x72, 0x73, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0x80, 0x01, 0x32, 0x81, 0x00, 0x41, 0x74, 0x7D, 0x91, 0x00, 0x01, 0x27,
+    0x2E, 0x62, 0x64, 0x66, 0x67, 0x68, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x76, 0x77, 0x7A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x70, 0x0C, 0x8B, 0x00, 0x01, 0x27, 0x2E, 0x62, 0x64, 0x68, 0x69, 0x6C, 0x6D, 0x6E,
+    0x72, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x01,
+    0x27, 0x2E, 0x00, 0x00, 0x8B, 0x00, 0x01, 0x27, 0x2E, 0x66, 0x67, 0x68, 0x6B, 0x6C, 0x6D, 0x72,
+    0x73, 0x74, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x02, 0x27, 0x2E,
+    0x00, 0x00, 0x80, 0x00, 0xC3, 0x95, 0x00, 0x01, 0x27, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68,
+    0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x7A, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x8F, 0x00, 0x01, 0x27, 0x2E, 0x62, 0x63, 0x66, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x76, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x52, 0x81, 0x00, 0x11, 0x6E, 0x07, 0x01, 0x74, 0x00, 0x01, 0x69,
+    0x7D, 0x01, 0x65, 0x7D, 0x01, 0x72, 0x07, 0x01, 0x65, 0x7D, 0x81, 0x00, 0x11, 0x66, 0x7D, 0x93,
+    0x00, 0x01, 0x27, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71,
+    0x72, 0x73, 0x74, 0x76, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x72, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x00, 0x01, 0x69, 0x0E, 0x80, 0x00, 0x72, 0x81, 0x00,
+    0x11, 0x65, 0x08, 0x01, 0x63, 0x08, 0x81, 0x00, 0x11, 0x69, 0x3F, 0x8B, 0x00, 0x01, 0x27, 0x2E,
+    0x64, 0x68, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x7A, 0x00, 0x00, 0x00, 0x01, 0x01, 0x3D, 0x00,
+    0x01, 0x3E, 0x00, 0x00, 0x83, 0x00, 0x01, 0x27, 0x2E, 0x71, 0x00, 0x00, 0x00, 0x80, 0x00, 0x43,
+    0x81, 0x00, 0x11, 0x73, 0x3C, 0x95, 0x00, 0x01, 0x27, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68,
+    0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x7A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0xB1, 0x02, 0x27, 0x2E, 0x09, 0x09, 0x03, 0x27, 0x2E, 0x6D, 0x00, 0x00,
+    0x00, 0x01, 0x6E, 0x0B, 0x80, 0x00, 0xF2, 0x81, 0x00, 0xC2, 0x6D, 0x3A, 0x0B, 0x62, 0x63, 0x64,
+    0x66, 0x67, 0x6D, 0x6E, 0x70, 0x73, 0x74, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x87, 0x00, 0x92, 0x27, 0x2E, 0x68, 0x70, 0x73, 0x74, 0x7A, 0x35, 0x09, 0x36,
+    0x37, 0x38, 0x39, 0x00, 0x81, 0x00, 0x41, 0x2E, 0x00, 0x01, 0x68, 0x08, 0x81, 0x00, 0x41, 0x63,
+    0x34, 0x81, 0x00, 0x11, 0x73, 0x07, 0x82, 0x00, 0x41, 0x6B, 0x73, 0x00, 0x03, 0x92, 0x00, 0x01,
+    0x27, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x76,
+    0x77, 0x7A, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x00, 0x01, 0x31,
+    0x32, 0x00, 0x00, 0x33, 0x86, 0x00, 0x01, 0x27, 0x2E, 0x63, 0x6C, 0x72, 0x76, 0x05, 0x00, 0x00,
+    0x01, 0x01, 0x00, 0x01, 0x72, 0x03, 0x80, 0x00, 0x12, 0x85, 0x00, 0x01, 0x27, 0x2E, 0x61, 0x68,
+    0x79, 0x00, 0x00, 0x2E, 0x01, 0x2F, 0x8A, 0x00, 0x01, 0x27, 0x2E, 0x62, 0x63, 0x66, 0x68, 0x6D,
+    0x70, 0x74, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6F,
+    0x02, 0x0A, 0x8B, 0x00, 0x01, 0x27, 0x2E, 0x62, 0x64, 0x6C, 0x6E, 0x70, 0x73, 0x74, 0x76, 0x7A,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x27, 0x2E, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73,
+    0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D,
+    0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D,
 };
 
 constexpr SerializedHyphenationPatterns it_patterns = {
-    0x5C0u,
+    0x56Bu,
+    0x2Fu,
     it_trie_data,
     sizeof(it_trie_data),
 };
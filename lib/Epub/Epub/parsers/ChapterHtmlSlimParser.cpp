@@ -8,11 +8,23 @@
 #include <XmlParserUtils.h>
 #include <expat.h>
 
+#include <algorithm>
+#include <cstring>
+#include <new>
+
 #include "../../Epub.h"
+#include "../ImagePack.h"
 #include "../Page.h"
 #include "../converters/ImageDecoderFactory.h"
 #include "../converters/ImageToFramebufferDecoder.h"
 #include "../htmlEntities.h"
+#include "XhtmlPullTokenizer.h"
+
+// Tokenize chapters with XhtmlPullTokenizer rather than expat. Both call the same handlers with the same byte
+// offsets, so section caches and checkpoints carry over; compare them with run_layout_benchmark.sh --pull-tokenizer.
+#ifndef XHTML_PULL_TOKENIZER
+#define XHTML_PULL_TOKENIZER 0
+#endif
 
 const char* HEADER_TAGS[] = {"h1", "h2", "h3", "h4", "h5", "h6"};
 constexpr int NUM_HEADER_TAGS = sizeof(HEADER_TAGS) / sizeof(HEADER_TAGS[0]);
@@ -20,6 +32,11 @@ constexpr int NUM_HEADER_TAGS = sizeof(HEADER_TAGS) / sizeof(HEADER_TAGS[0]);
 // Minimum file size (in bytes) to show indexing popup - smaller chapters don't benefit from it
 constexpr size_t MIN_SIZE_FOR_POPUP = 10 * 1024;  // 10KB
 constexpr size_t PARSE_BUFFER_SIZE = 1024;
+// Once an abort is requested, the parser keeps going until the next text block boundary so it can checkpoint.
+// Give up without a checkpoint if no boundary turns up within this many chunks.
+constexpr int MAX_CHUNKS_TO_CHECKPOINT = 4;
+// Words buffered between streaming layout passes over a long paragraph
+constexpr size_t STREAM_LAYOUT_WORDS = 64;
 
 const char* BLOCK_TAGS[] = {"p", "li", "div", "br", "blockquote"};
 constexpr int NUM_BLOCK_TAGS = sizeof(BLOCK_TAGS) / sizeof(BLOCK_TAGS[0]);
@@ -39,8 +56,49 @@ constexpr int NUM_IMAGE_TAGS = sizeof(IMAGE_TAGS) / sizeof(IMAGE_TAGS[0]);
 const char* SKIP_TAGS[] = {"head"};
 constexpr int NUM_SKIP_TAGS = sizeof(SKIP_TAGS) / sizeof(SKIP_TAGS[0]);
 
+// FB2 elements and the XHTML elements they are laid out as; the rest (p, strong, sub, sup, table, a, ...) are shared
+const char* FB2_TAG_ALIASES[][2] = {
+    {"section", "div"}, {"annotation", "div"}, {"poem", "div"}, {"stanza", "div"}, {"epigraph", "blockquote"},
+    {"cite", "blockquote"}, {"title", "h2"}, {"subtitle", "h3"}, {"v", "p"}, {"text-author", "p"},
+    {"emphasis", "em"}, {"empty-line", "br"}, {"image", "img"}};
+constexpr int NUM_FB2_TAG_ALIASES = sizeof(FB2_TAG_ALIASES) / sizeof(FB2_TAG_ALIASES[0]);
+// Attributes kept of an FB2 element; its elements have two or three
+constexpr int MAX_FB2_ATTRIBUTES = 8;
+
+const char* fb2TagAlias(const char* name) {
+  for (int i = 0; i < NUM_FB2_TAG_ALIASES; i++) {
+    if (strcmp(name, FB2_TAG_ALIASES[i][0]) == 0) {
+      return FB2_TAG_ALIASES[i][1];
+    }
+  }
+  return name;
+}
+
 bool isWhitespace(const char c) { return c == ' ' || c == '\r' || c == '\n' || c == '\t'; }
 
+// Bytes characterData has to look at one by one: whitespace, and the lead bytes of the no-break spaces and the BOM
+bool isWordStop(const char c) {
+  const auto b = static_cast<uint8_t>(c);
+  return isWhitespace(c) || b == 0xC2 || b == 0xE2 || b == 0xEF;
+}
+
+// The end of the run of word bytes starting at `from`, which is taken as part of the run whatever it is. Printable
+// ASCII is skipped four bytes at a time: a word without a byte below 0x21 or above 0x7F can't hold a stop.
+int wordRunEnd(const XML_Char* s, int from, const int len) {
+  int i = from + 1;
+  for (; i + 4 <= len; i += 4) {
+    uint32_t word;
+    memcpy(&word, s + i, sizeof(word));
+    if (((word - 0x21212121u) | word) & 0x80808080u) {
+      break;
+    }
+  }
+  while (i < len && !isWordStop(s[i])) {
+    i++;
+  }
+  return i;
+}
+
 // given the start and end of a tag, check to see if it matches a known tag
 bool matches(const char* tag_name, const char* possible_tags[], const int possible_tag_count) {
   for (int i = 0; i < possible_tag_count; i++) {
@@ -119,15 +177,58 @@ void ChapterHtmlSlimParser::flushPartWordBuffer() {
   }
 
   // flush the buffer
-  partWordBuffer[partWordBufferIndex] = '\0';
-  currentTextBlock->addWord(partWordBuffer, fontStyle, false, nextWordContinues);
+  currentTextBlock->addWord(std::string_view(partWordBuffer, partWordBufferIndex), fontStyle, false, nextWordContinues);
   partWordBufferIndex = 0;
   nextWordContinues = false;
 }
 
 // start a new text block if needed
-void ChapterHtmlSlimParser::startNewTextBlock(const BlockStyle& blockStyle) {
+void ChapterHtmlSlimParser::startNewTextBlock(const BlockStyle& blockStyle, const bool allowCheckpoint) {
   nextWordContinues = false;  // New block = new paragraph, no continuation
+  if (aborted) {
+    return;
+  }
+
+  if (table) {
+    // Blocks inside a table laid out as a grid only separate words, the cells are laid out with the table. Never a
+    // checkpoint: the buffered cells are not part of one.
+    if (!replaying && !pendingAnchorId.empty()) {
+      anchorData.push_back({std::move(pendingAnchorId), static_cast<uint16_t>(completedPageCount)});
+    }
+    pendingAnchorId.clear();
+    return;
+  }
+
+  if (replaying) {
+    const XML_Index at = parsing() ? static_cast<XML_Index>(currentSourceOffset()) : -1;
+    const auto resumeAt = static_cast<XML_Index>(resumePoint.byteOffset);
+    if (seeding ? at < resumeAt : at != resumeAt) {
+      // Still fast-forwarding: keep an empty block around for the structural code paths, but lay nothing out
+      pendingAnchorId.clear();
+      if (!currentTextBlock || !currentTextBlock->isEmpty()) {
+        currentTextBlock.reset(new ParsedText(extraParagraphSpacing, hyphenationEnabled, blockStyle,
+                                              widthCache.get(), hyphenationCache.get()));
+      }
+      return;
+    }
+    if (seeding) {
+      // The first block at or after the seed offset starts the first page
+      resumePoint.byteOffset = static_cast<uint32_t>(at);
+      resumePoint.nextBlockStyle = blockStyle;
+    }
+    restoreResumePoint();
+    if (!pendingAnchorId.empty()) {
+      anchorData.push_back({std::move(pendingAnchorId), static_cast<uint16_t>(completedPageCount)});
+      pendingAnchorId.clear();
+    }
+    currentTextBlock.reset(new ParsedText(extraParagraphSpacing, hyphenationEnabled, resumePoint.nextBlockStyle,
+                                          widthCache.get(), hyphenationCache.get()));
+    blockStartOffset = resumePoint.byteOffset;
+    wordsExtractedInBlock = 0;
+    streamLayoutAt = STREAM_LAYOUT_WORDS;
+    return;
+  }
+
   if (currentTextBlock) {
     // already have a text block running and it is empty - just reuse it
     if (currentTextBlock->isEmpty()) {
@@ -144,14 +245,218 @@ void ChapterHtmlSlimParser::startNewTextBlock(const BlockStyle& blockStyle) {
     }
 
     makePages();
+
+    // Everything before this element is laid out, so this is a safe place to stop and resume later
+    if (allowCheckpoint && parsing() && abortFn && abortFn()) {
+      takeCheckpoint(blockStyle);
+      return;
+    }
   }
   // Record deferred anchor after previous block is flushed
   if (!pendingAnchorId.empty()) {
     anchorData.push_back({std::move(pendingAnchorId), static_cast<uint16_t>(completedPageCount)});
     pendingAnchorId.clear();
   }
-  currentTextBlock.reset(new ParsedText(extraParagraphSpacing, hyphenationEnabled, blockStyle));
+  currentTextBlock.reset(new ParsedText(extraParagraphSpacing, hyphenationEnabled, blockStyle, widthCache.get(),
+                                        hyphenationCache.get()));
+  blockStartOffset = currentSourceOffset();
+  wordsExtractedInBlock = 0;
+  streamLayoutAt = STREAM_LAYOUT_WORDS;
+}
+
+void ChapterHtmlSlimParser::startFlattenedCell(const int row, const int column, const bool allowCheckpoint) {
+  auto tableCellBlockStyle = BlockStyle();
+  tableCellBlockStyle.textAlignDefined = true;
+  const auto align = (paragraphAlignment == static_cast<uint8_t>(CssTextAlign::None))
+                         ? CssTextAlign::Justify
+                         : static_cast<CssTextAlign>(paragraphAlignment);
+  tableCellBlockStyle.alignment = align;
+  startNewTextBlock(tableCellBlockStyle, allowCheckpoint);
+
+  const std::string headerText = "Tab Row " + std::to_string(row) + ", Cell " + std::to_string(column) + ":";
+  StyleStackEntry headerStyle;
+  headerStyle.depth = depth;
+  headerStyle.hasBold = true;
+  headerStyle.bold = false;
+  headerStyle.hasItalic = true;
+  headerStyle.italic = true;
+  headerStyle.hasUnderline = true;
+  headerStyle.underline = false;
+  inlineStyleStack.push_back(headerStyle);
+  updateEffectiveInlineStyle();
+  characterData(this, headerText.c_str(), static_cast<int>(headerText.length()));
+  if (partWordBufferIndex > 0) {
+    flushPartWordBuffer();
+  }
+  nextWordContinues = false;
+  inlineStyleStack.pop_back();
+  updateEffectiveInlineStyle();
+}
+
+void ChapterHtmlSlimParser::closeTableCell() {
+  if (!tableCellOpen) {
+    return;
+  }
+  if (partWordBufferIndex > 0) {
+    flushPartWordBuffer();
+  }
+  table->addCell(std::move(currentTextBlock));
+  currentTextBlock.reset(new ParsedText(extraParagraphSpacing, hyphenationEnabled, BlockStyle(), widthCache.get(),
+                                        hyphenationCache.get()));
+  tableCellOpen = false;
+}
+
+void ChapterHtmlSlimParser::flattenTable() {
+  const std::unique_ptr<TableLayout> grid = std::move(table);
+  std::unique_ptr<ParsedText> openCell = tableCellOpen ? std::move(currentTextBlock) : nullptr;
+  tableCellOpen = false;
+  if (replaying) {
+    // Nothing was buffered, and the flattened cells before the resume point are already laid out
+    if (openCell) {
+      currentTextBlock = std::move(openCell);
+    }
+    return;
+  }
+  LOG_DBG("EHP", "Table too big to lay out as a grid, flattening it");
+
+  // A word being collected belongs to the open cell, so it is put back once that cell is flattened
+  const std::string partWord(partWordBuffer, partWordBufferIndex);
+  const bool partWordContinues = nextWordContinues;
+  partWordBufferIndex = 0;
+
+  // The buffered cells have no source offset of their own to resume at, so none of them can be a checkpoint
+  auto& rows = grid->getRows();
+  for (size_t r = 0; r < rows.size(); r++) {
+    for (size_t c = 0; c < rows[r].size(); c++) {
+      startFlattenedCell(static_cast<int>(r + 1), static_cast<int>(c + 1), false);
+      currentTextBlock->append(std::move(*rows[r][c]));
+      rows[r][c].reset();
+    }
+  }
+  if (openCell) {
+    startFlattenedCell(tableRowIndex, tableColIndex, false);
+    currentTextBlock->append(std::move(*openCell));
+  }
+  memcpy(partWordBuffer, partWord.data(), partWord.size());
+  partWordBufferIndex = static_cast<int>(partWord.size());
+  nextWordContinues = partWordContinues;
+}
+
+void ChapterHtmlSlimParser::layoutTable() {
+  closeTableCell();
+  const std::unique_ptr<TableLayout> grid = std::move(table);
+  if (replaying || aborted) {
+    return;
+  }
+
+  blockStartOffset = tableStartOffset;
   wordsExtractedInBlock = 0;
+  if (!currentPage) {
+    startNewPage(blockStartOffset);
+  }
+  const int lineHeight = renderer.getLineHeight(fontId) * lineCompression;
+  grid->layout(
+      renderer, fontId, viewportWidth, [this](const std::shared_ptr<TextBlock>& line) { addLineToPage(line); },
+      [this, lineHeight]() { currentPageNextY += lineHeight / 4; });
+
+  if (!pendingFootnotes.empty() && currentPage) {
+    for (const auto& [idx, fn] : pendingFootnotes) {
+      currentPage->addFootnote(fn.number, fn.href);
+    }
+    pendingFootnotes.clear();
+  }
+  if (extraParagraphSpacing) {
+    currentPageNextY += lineHeight / 2;
+  }
+  // The block after the table starts its pages after it
+  if (currentTextBlock && currentTextBlock->isEmpty()) {
+    blockStartOffset = currentSourceOffset();
+  }
+}
+
+void ChapterHtmlSlimParser::enterElement(const char* tagName, const char* classAttr) {
+  while (!openElements.empty() && openElements.back().depth >= depth) {
+    openElements.pop_back();
+    openElementKeys.pop_back();
+  }
+  if (!cssParser->hasAncestorRules()) {
+    return;
+  }
+
+  const CssParser::ElementKey key = cssParser->makeElementKey(tagName, classAttr);
+  // FNV-1a over the parent's ancestry, then this element's name IDs
+  uint64_t hash = openElements.empty() ? 14695981039346656037ull : openElements.back().ancestryHash;
+  const auto mix = [&hash](const uint16_t id) {
+    hash ^= id & 0xFF;
+    hash *= 1099511628211ull;
+    hash ^= id >> 8;
+    hash *= 1099511628211ull;
+  };
+  mix(key.tagId);
+  for (uint8_t i = 0; i < key.classCount; ++i) {
+    mix(key.classIds[i]);
+  }
+  mix(CssParser::NO_NAME);  // Ends the element, so that classes cannot shift into the next one
+
+  openElementKeys.push_back(key);
+  openElements.push_back({depth, hash});
+}
+
+CssStyle ChapterHtmlSlimParser::resolveElementStyle(const char* tagName, const char* classAttr,
+                                                   const char* styleAttr) {
+  // Ancestors are the open elements outside this one, which enterElement() may already have pushed
+  size_t ancestorCount = openElements.size();
+  if (ancestorCount > 0 && openElements.back().depth == depth) {
+    ancestorCount--;
+  }
+  const uint64_t ancestry = ancestorCount > 0 ? openElements[ancestorCount - 1].ancestryHash : 0;
+
+  uint64_t key = 0;
+  CssStyle style;
+  if (styleCache) {
+    key = CssStyleCache::makeKey(tagName, classAttr, styleAttr, ancestry);
+    if (styleCache->lookup(key, style)) {
+      return style;
+    }
+  }
+
+  style =
+      cssParser->resolveStyle(cssParser->makeElementKey(tagName, classAttr), openElementKeys.data(), ancestorCount);
+  if (styleAttr != nullptr && *styleAttr != '\0') {
+    style.applyOver(CssParser::parseInlineStyle(styleAttr));
+  }
+  if (styleCache) {
+    styleCache->store(key, style);
+  }
+  return style;
+}
+
+void ChapterHtmlSlimParser::takeCheckpoint(const BlockStyle& nextBlockStyle) {
+  checkpoint.byteOffset = currentSourceOffset();
+  checkpoint.completedPageCount = static_cast<uint16_t>(completedPageCount);
+  checkpoint.currentPageNextY = currentPageNextY;
+  checkpoint.nextBlockStyle = nextBlockStyle;
+  checkpoint.currentPage = std::move(currentPage);
+  checkpoint.anchors = anchorData;
+  checkpoint.pageOffsets = pageOffsets;
+  checkpointTaken = true;
+  aborted = true;
+  if (tokenizer) {
+    tokenizer->stop();
+  } else {
+    XML_StopParser(xmlParser, XML_FALSE);
+  }
+  LOG_DBG("EHP", "Checkpoint at byte %u after %u pages", checkpoint.byteOffset, checkpoint.completedPageCount);
+}
+
+void ChapterHtmlSlimParser::restoreResumePoint() {
+  replaying = false;
+  completedPageCount = resumePoint.completedPageCount;
+  currentPageNextY = resumePoint.currentPageNextY;
+  currentPage = std::move(resumePoint.currentPage);
+  anchorData = std::move(resumePoint.anchors);
+  pageOffsets = std::move(resumePoint.pageOffsets);
+  LOG_DBG("EHP", "Resumed at byte %u after %u pages", resumePoint.byteOffset, resumePoint.completedPageCount);
 }
 
 void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char* name, const XML_Char** atts) {
@@ -163,9 +468,38 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     return;
   }
 
-  // Extract class, style, and id attributes
-  std::string classAttr;
-  std::string styleAttr;
+  // An FB2 link (l:href, xlink:href, whatever the prefix) is to "#id": an image's src, or a section of the book
+  std::string fb2Href;
+  const XML_Char* fb2Atts[MAX_FB2_ATTRIBUTES * 2 + 1];
+  if (self->fb2) {
+    name = fb2TagAlias(name);
+    if (atts != nullptr) {
+      int count = 0;
+      for (int i = 0; atts[i] && count < MAX_FB2_ATTRIBUTES; i += 2, count++) {
+        const char* colon = strchr(atts[i], ':');
+        if (colon && strcmp(colon + 1, "href") == 0) {
+          fb2Href = self->epub->resolveFb2Href(atts[i + 1]);
+          fb2Atts[count * 2] = strcmp(name, "img") == 0 ? "src" : "href";
+          fb2Atts[count * 2 + 1] = fb2Href.c_str();
+        } else {
+          fb2Atts[count * 2] = atts[i];
+          fb2Atts[count * 2 + 1] = atts[i + 1];
+        }
+      }
+      fb2Atts[count * 2] = nullptr;
+      atts = fb2Atts;
+    }
+  }
+
+  // Checked on elements as well as text, so a fast-forwarding parser, which skips text, flattens the table at an
+  // element no later than the one after where the full parse did
+  if (self->table && self->currentSourceOffset() - self->tableStartOffset > TableLayout::MAX_SOURCE_BYTES) {
+    self->flattenTable();
+  }
+
+  // Extract class, style, and id attributes; classAttr points into atts, valid for this call
+  const char* classAttr = nullptr;
+  const char* styleAttr = nullptr;
   if (atts != nullptr) {
     for (int i = 0; atts[i]; i += 2) {
       if (strcmp(atts[i], "class") == 0) {
@@ -187,11 +521,8 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
   // before tag-specific branches emit any content or metadata.
   CssStyle cssStyle;
   if (self->cssParser) {
-    cssStyle = self->cssParser->resolveStyle(name, classAttr);
-    if (!styleAttr.empty()) {
-      CssStyle inlineStyle = CssParser::parseInlineStyle(styleAttr);
-      cssStyle.applyOver(inlineStyle);
-    }
+    self->enterElement(name, classAttr);
+    cssStyle = self->resolveElementStyle(name, classAttr, styleAttr);
   }
 
   // Skip elements with display:none before all fast paths (tables, links, etc.).
@@ -201,7 +532,8 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     return;
   }
 
-  // Special handling for tables/cells: flatten into per-cell paragraphs with a prefixed header.
+  // Special handling for tables/cells: laid out as a grid once complete (see TableLayout), or flattened into
+  // per-cell paragraphs with a prefixed header.
   if (strcmp(name, "table") == 0) {
     // skip nested tables
     if (self->tableDepth > 0) {
@@ -215,6 +547,12 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     self->tableDepth += 1;
     self->tableRowIndex = 0;
     self->tableColIndex = 0;
+#if TABLE_GRID_LAYOUT
+    // Text before the table is laid out first, the cells are buffered until it ends
+    self->startNewTextBlock(BlockStyle());
+    self->table.reset(new TableLayout());
+    self->tableStartOffset = self->currentSourceOffset();
+#endif
     self->depth += 1;
     return;
   }
@@ -222,44 +560,50 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
   if (self->tableDepth == 1 && strcmp(name, "tr") == 0) {
     self->tableRowIndex += 1;
     self->tableColIndex = 0;
+    if (self->table) {
+      self->closeTableCell();
+      self->table->startRow();
+    }
     self->depth += 1;
     return;
   }
 
   if (self->tableDepth == 1 && (strcmp(name, "td") == 0 || strcmp(name, "th") == 0)) {
-    if (self->partWordBufferIndex > 0) {
-      self->flushPartWordBuffer();
+    if (self->table && self->table->rowCellCount() >= TableLayout::MAX_COLUMNS) {
+      self->flattenTable();
     }
     self->tableColIndex += 1;
 
-    auto tableCellBlockStyle = BlockStyle();
-    tableCellBlockStyle.textAlignDefined = true;
-    const auto align = (self->paragraphAlignment == static_cast<uint8_t>(CssTextAlign::None))
-                           ? CssTextAlign::Justify
-                           : static_cast<CssTextAlign>(self->paragraphAlignment);
-    tableCellBlockStyle.alignment = align;
-    self->startNewTextBlock(tableCellBlockStyle);
-
-    const std::string headerText =
-        "Tab Row " + std::to_string(self->tableRowIndex) + ", Cell " + std::to_string(self->tableColIndex) + ":";
-    StyleStackEntry headerStyle;
-    headerStyle.depth = self->depth;
-    headerStyle.hasBold = true;
-    headerStyle.bold = false;
-    headerStyle.hasItalic = true;
-    headerStyle.italic = true;
-    headerStyle.hasUnderline = true;
-    headerStyle.underline = false;
-    self->inlineStyleStack.push_back(headerStyle);
-    self->updateEffectiveInlineStyle();
-    self->characterData(userData, headerText.c_str(), static_cast<int>(headerText.length()));
+    if (self->table) {
+      self->closeTableCell();
+      const bool header = strcmp(name, "th") == 0;
+      auto cellBlockStyle = BlockStyle();
+      cellBlockStyle.textAlignDefined = true;
+      cellBlockStyle.alignment = header ? CssTextAlign::Center : CssTextAlign::Left;
+      std::unique_ptr<ParsedText> cell(new ParsedText(self->extraParagraphSpacing, self->hyphenationEnabled,
+                                                      cellBlockStyle, self->widthCache.get(),
+                                                      self->hyphenationCache.get()));
+      // Stray text between cells goes with the next one
+      if (self->currentTextBlock) {
+        if (self->partWordBufferIndex > 0) {
+          self->flushPartWordBuffer();
+        }
+        cell->append(std::move(*self->currentTextBlock));
+      }
+      self->currentTextBlock = std::move(cell);
+      self->tableCellOpen = true;
+      self->nextWordContinues = false;
+      if (header) {
+        self->boldUntilDepth = std::min(self->boldUntilDepth, self->depth);
+      }
+      self->depth += 1;
+      return;
+    }
+
     if (self->partWordBufferIndex > 0) {
       self->flushPartWordBuffer();
     }
-    self->nextWordContinues = false;
-    self->inlineStyleStack.pop_back();
-    self->updateEffectiveInlineStyle();
-
+    self->startFlattenedCell(self->tableRowIndex, self->tableColIndex, true);
     self->depth += 1;
     return;
   }
@@ -285,10 +629,7 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
 
       // Skip image if CSS display:none
       if (self->cssParser) {
-        CssStyle imgDisplayStyle = self->cssParser->resolveStyle("img", classAttr);
-        if (!styleAttr.empty()) {
-          imgDisplayStyle.applyOver(CssParser::parseInlineStyle(styleAttr));
-        }
+        const CssStyle imgDisplayStyle = self->resolveElementStyle("img", classAttr, styleAttr);
         if (imgDisplayStyle.hasDisplay() && imgDisplayStyle.display == CssDisplay::None) {
           self->skipUntilDepth = self->depth;
           self->depth += 1;
@@ -298,6 +639,10 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
 
       if (!src.empty() && self->imageRendering != 1) {
         LOG_DBG("EHP", "Found image: src=%s", src.c_str());
+        // Cells hold text only
+        if (self->table) {
+          self->flattenTable();
+        }
 
         {
           // Resolve the image path relative to the HTML file
@@ -311,163 +656,181 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
               ext = resolvedPath.substr(extPos);
             }
             std::string cachedImagePath = self->imageBasePath + std::to_string(self->imageCounter++) + ext;
+            if (self->replaying && self->seeding) {
+              // Not shown before a seeded start, so not worth extracting
+              self->depth += 1;
+              return;
+            }
 
-            // Extract image to cache file
-            FsFile cachedImageFile;
-            bool extractSuccess = false;
-            if (Storage.openFileForWrite("EHP", cachedImagePath, cachedImageFile)) {
-              extractSuccess = self->epub->readItemContentsToStream(resolvedPath, cachedImageFile, 4096);
-              cachedImageFile.flush();
-              cachedImageFile.close();
-              delay(50);  // Give SD card time to sync
+            // Layout only needs the image's size. Images are almost always stored uncompressed in the EPUB, so it is
+            // read from the image header in place and the image is extracted when a page showing it is first loaded
+            // (Section::loadPage). A deflated image would need a second inflate window next to the chapter's, so it
+            // is still extracted now and measured from the file.
+            ImageDimensions dims = {0, 0};
+            bool haveDimensions = false;
+            ZipFile::StoredEntry storedImage;
+            if (self->epub->openStoredItem(resolvedPath, storedImage)) {
+              haveDimensions = ImageDecoderFactory::readDimensions(
+                  resolvedPath, [&storedImage](void* buf, const size_t count) { return storedImage.read(buf, count); },
+                  dims);
+              storedImage.close();
+            } else {
+              // Already extracted by the aborted build when fast-forwarding
+              const bool extractSuccess =
+                  (self->replaying && ImagePack::contains(cachedImagePath)) ||
+                  ImagePack::append(cachedImagePath, [self, &resolvedPath](Print& out) {
+                    return self->epub->readItemContentsToStream(resolvedPath, out, Storage.getChunkSize());
+                  });
+              if (extractSuccess) {
+                ImageToFramebufferDecoder* decoder = ImageDecoderFactory::getDecoder(cachedImagePath);
+                haveDimensions = decoder && decoder->getDimensions(cachedImagePath, dims);
+              } else {
+                LOG_ERR("EHP", "Failed to extract image");
+              }
             }
 
-            if (extractSuccess) {
-              // Get image dimensions
-              ImageDimensions dims = {0, 0};
-              ImageToFramebufferDecoder* decoder = ImageDecoderFactory::getDecoder(cachedImagePath);
-              if (decoder && decoder->getDimensions(cachedImagePath, dims)) {
-                LOG_DBG("EHP", "Image dimensions: %dx%d", dims.width, dims.height);
-
-                int displayWidth = 0;
-                int displayHeight = 0;
-                const float emSize = static_cast<float>(self->renderer.getFontAscenderSize(self->fontId));
-                CssStyle imgStyle = self->cssParser ? self->cssParser->resolveStyle("img", classAttr) : CssStyle{};
-                // Merge inline style (e.g. style="height: 2em") so it overrides stylesheet rules
-                if (!styleAttr.empty()) {
-                  imgStyle.applyOver(CssParser::parseInlineStyle(styleAttr));
-                }
-                const bool hasCssHeight = imgStyle.hasImageHeight();
-                const bool hasCssWidth = imgStyle.hasImageWidth();
-
-                if (hasCssHeight && hasCssWidth && dims.width > 0 && dims.height > 0) {
-                  // Both CSS height and width set: resolve both, then clamp to viewport preserving requested ratio
-                  displayHeight = static_cast<int>(
-                      imgStyle.imageHeight.toPixels(emSize, static_cast<float>(self->viewportHeight)) + 0.5f);
-                  displayWidth = static_cast<int>(
-                      imgStyle.imageWidth.toPixels(emSize, static_cast<float>(self->viewportWidth)) + 0.5f);
-                  if (displayHeight < 1) displayHeight = 1;
+            if (haveDimensions) {
+              LOG_DBG("EHP", "Image dimensions: %dx%d", dims.width, dims.height);
+
+              int displayWidth = 0;
+              int displayHeight = 0;
+              const float emSize = static_cast<float>(self->renderer.getFontAscenderSize(self->fontId));
+              // Inline style (e.g. style="height: 2em") overrides stylesheet rules
+              const CssStyle imgStyle =
+                  self->cssParser ? self->resolveElementStyle("img", classAttr, styleAttr) : CssStyle{};
+              const bool hasCssHeight = imgStyle.hasImageHeight();
+              const bool hasCssWidth = imgStyle.hasImageWidth();
+
+              if (hasCssHeight && hasCssWidth && dims.width > 0 && dims.height > 0) {
+                // Both CSS height and width set: resolve both, then clamp to viewport preserving requested ratio
+                displayHeight = static_cast<int>(
+                    imgStyle.imageHeight.toPixels(emSize, static_cast<float>(self->viewportHeight)) + 0.5f);
+                displayWidth = static_cast<int>(
+                    imgStyle.imageWidth.toPixels(emSize, static_cast<float>(self->viewportWidth)) + 0.5f);
+                if (displayHeight < 1) displayHeight = 1;
+                if (displayWidth < 1) displayWidth = 1;
+                if (displayWidth > self->viewportWidth || displayHeight > self->viewportHeight) {
+                  float scaleX = (displayWidth > self->viewportWidth)
+                                     ? static_cast<float>(self->viewportWidth) / displayWidth
+                                     : 1.0f;
+                  float scaleY = (displayHeight > self->viewportHeight)
+                                     ? static_cast<float>(self->viewportHeight) / displayHeight
+                                     : 1.0f;
+                  float scale = (scaleX < scaleY) ? scaleX : scaleY;
+                  displayWidth = static_cast<int>(displayWidth * scale + 0.5f);
+                  displayHeight = static_cast<int>(displayHeight * scale + 0.5f);
                   if (displayWidth < 1) displayWidth = 1;
-                  if (displayWidth > self->viewportWidth || displayHeight > self->viewportHeight) {
-                    float scaleX = (displayWidth > self->viewportWidth)
-                                       ? static_cast<float>(self->viewportWidth) / displayWidth
-                                       : 1.0f;
-                    float scaleY = (displayHeight > self->viewportHeight)
-                                       ? static_cast<float>(self->viewportHeight) / displayHeight
-                                       : 1.0f;
-                    float scale = (scaleX < scaleY) ? scaleX : scaleY;
-                    displayWidth = static_cast<int>(displayWidth * scale + 0.5f);
-                    displayHeight = static_cast<int>(displayHeight * scale + 0.5f);
-                    if (displayWidth < 1) displayWidth = 1;
-                    if (displayHeight < 1) displayHeight = 1;
-                  }
-                  LOG_DBG("EHP", "Display size from CSS height+width: %dx%d", displayWidth, displayHeight);
-                } else if (hasCssHeight && !hasCssWidth && dims.width > 0 && dims.height > 0) {
-                  // Use CSS height (resolve % against viewport height) and derive width from aspect ratio
-                  displayHeight = static_cast<int>(
-                      imgStyle.imageHeight.toPixels(emSize, static_cast<float>(self->viewportHeight)) + 0.5f);
                   if (displayHeight < 1) displayHeight = 1;
+                }
+                LOG_DBG("EHP", "Display size from CSS height+width: %dx%d", displayWidth, displayHeight);
+              } else if (hasCssHeight && !hasCssWidth && dims.width > 0 && dims.height > 0) {
+                // Use CSS height (resolve % against viewport height) and derive width from aspect ratio
+                displayHeight = static_cast<int>(
+                    imgStyle.imageHeight.toPixels(emSize, static_cast<float>(self->viewportHeight)) + 0.5f);
+                if (displayHeight < 1) displayHeight = 1;
+                displayWidth =
+                    static_cast<int>(displayHeight * (static_cast<float>(dims.width) / dims.height) + 0.5f);
+                if (displayHeight > self->viewportHeight) {
+                  displayHeight = self->viewportHeight;
+                  // Rescale width to preserve aspect ratio when height is clamped
                   displayWidth =
                       static_cast<int>(displayHeight * (static_cast<float>(dims.width) / dims.height) + 0.5f);
-                  if (displayHeight > self->viewportHeight) {
-                    displayHeight = self->viewportHeight;
-                    // Rescale width to preserve aspect ratio when height is clamped
-                    displayWidth =
-                        static_cast<int>(displayHeight * (static_cast<float>(dims.width) / dims.height) + 0.5f);
-                    if (displayWidth < 1) displayWidth = 1;
-                  }
-                  if (displayWidth > self->viewportWidth) {
-                    displayWidth = self->viewportWidth;
-                    // Rescale height to preserve aspect ratio when width is clamped
-                    displayHeight =
-                        static_cast<int>(displayWidth * (static_cast<float>(dims.height) / dims.width) + 0.5f);
-                    if (displayHeight < 1) displayHeight = 1;
-                  }
-                  if (displayWidth < 1) displayWidth = 1;
-                  LOG_DBG("EHP", "Display size from CSS height: %dx%d", displayWidth, displayHeight);
-                } else if (hasCssWidth && !hasCssHeight && dims.width > 0 && dims.height > 0) {
-                  // Use CSS width (resolve % against viewport width) and derive height from aspect ratio
-                  displayWidth = static_cast<int>(
-                      imgStyle.imageWidth.toPixels(emSize, static_cast<float>(self->viewportWidth)) + 0.5f);
-                  if (displayWidth > self->viewportWidth) displayWidth = self->viewportWidth;
                   if (displayWidth < 1) displayWidth = 1;
+                }
+                if (displayWidth > self->viewportWidth) {
+                  displayWidth = self->viewportWidth;
+                  // Rescale height to preserve aspect ratio when width is clamped
                   displayHeight =
                       static_cast<int>(displayWidth * (static_cast<float>(dims.height) / dims.width) + 0.5f);
-                  if (displayHeight > self->viewportHeight) {
-                    displayHeight = self->viewportHeight;
-                    // Rescale width to preserve aspect ratio when height is clamped
-                    displayWidth =
-                        static_cast<int>(displayHeight * (static_cast<float>(dims.width) / dims.height) + 0.5f);
-                    if (displayWidth < 1) displayWidth = 1;
-                  }
                   if (displayHeight < 1) displayHeight = 1;
-                  LOG_DBG("EHP", "Display size from CSS width: %dx%d", displayWidth, displayHeight);
-                } else {
-                  // Scale to fit viewport while maintaining aspect ratio
-                  int maxWidth = self->viewportWidth;
-                  int maxHeight = self->viewportHeight;
-                  float scaleX = (dims.width > maxWidth) ? (float)maxWidth / dims.width : 1.0f;
-                  float scaleY = (dims.height > maxHeight) ? (float)maxHeight / dims.height : 1.0f;
-                  float scale = (scaleX < scaleY) ? scaleX : scaleY;
-                  if (scale > 1.0f) scale = 1.0f;
-
-                  displayWidth = (int)(dims.width * scale);
-                  displayHeight = (int)(dims.height * scale);
-                  LOG_DBG("EHP", "Display size: %dx%d (scale %.2f)", displayWidth, displayHeight, scale);
-                }
-
-                // Flush any pending text block so it appears before the image
-                if (self->partWordBufferIndex > 0) {
-                  self->flushPartWordBuffer();
                 }
-                if (self->currentTextBlock && !self->currentTextBlock->isEmpty()) {
-                  const BlockStyle parentBlockStyle = self->currentTextBlock->getBlockStyle();
-                  self->startNewTextBlock(parentBlockStyle);
+                if (displayWidth < 1) displayWidth = 1;
+                LOG_DBG("EHP", "Display size from CSS height: %dx%d", displayWidth, displayHeight);
+              } else if (hasCssWidth && !hasCssHeight && dims.width > 0 && dims.height > 0) {
+                // Use CSS width (resolve % against viewport width) and derive height from aspect ratio
+                displayWidth = static_cast<int>(
+                    imgStyle.imageWidth.toPixels(emSize, static_cast<float>(self->viewportWidth)) + 0.5f);
+                if (displayWidth > self->viewportWidth) displayWidth = self->viewportWidth;
+                if (displayWidth < 1) displayWidth = 1;
+                displayHeight =
+                    static_cast<int>(displayWidth * (static_cast<float>(dims.height) / dims.width) + 0.5f);
+                if (displayHeight > self->viewportHeight) {
+                  displayHeight = self->viewportHeight;
+                  // Rescale width to preserve aspect ratio when height is clamped
+                  displayWidth =
+                      static_cast<int>(displayHeight * (static_cast<float>(dims.width) / dims.height) + 0.5f);
+                  if (displayWidth < 1) displayWidth = 1;
                 }
+                if (displayHeight < 1) displayHeight = 1;
+                LOG_DBG("EHP", "Display size from CSS width: %dx%d", displayWidth, displayHeight);
+              } else {
+                // Scale to fit viewport while maintaining aspect ratio
+                int maxWidth = self->viewportWidth;
+                int maxHeight = self->viewportHeight;
+                float scaleX = (dims.width > maxWidth) ? (float)maxWidth / dims.width : 1.0f;
+                float scaleY = (dims.height > maxHeight) ? (float)maxHeight / dims.height : 1.0f;
+                float scale = (scaleX < scaleY) ? scaleX : scaleY;
+                if (scale > 1.0f) scale = 1.0f;
+
+                displayWidth = (int)(dims.width * scale);
+                displayHeight = (int)(dims.height * scale);
+                LOG_DBG("EHP", "Display size: %dx%d (scale %.2f)", displayWidth, displayHeight, scale);
+              }
 
-                // Create page for image - only break if image won't fit remaining space
-                if (self->currentPage && !self->currentPage->elements.empty() &&
-                    (self->currentPageNextY + displayHeight > self->viewportHeight)) {
-                  self->completePageFn(std::move(self->currentPage));
-                  self->completedPageCount++;
-                  self->currentPage.reset(new Page());
-                  if (!self->currentPage) {
-                    LOG_ERR("EHP", "Failed to create new page");
-                    return;
-                  }
-                  self->currentPageNextY = 0;
-                } else if (!self->currentPage) {
-                  self->currentPage.reset(new Page());
-                  if (!self->currentPage) {
-                    LOG_ERR("EHP", "Failed to create initial page");
-                    return;
-                  }
-                  self->currentPageNextY = 0;
-                }
+              if (self->replaying) {
+                self->depth += 1;
+                return;
+              }
+
+              // Flush any pending text block so it appears before the image
+              if (self->partWordBufferIndex > 0) {
+                self->flushPartWordBuffer();
+              }
+              if (self->currentTextBlock && !self->currentTextBlock->isEmpty()) {
+                const BlockStyle parentBlockStyle = self->currentTextBlock->getBlockStyle();
+                // Not a checkpoint: this block only exists when the page text was actually parsed, so a
+                // fast-forwarding parser could never find this boundary again
+                self->startNewTextBlock(parentBlockStyle, false);
+              }
 
-                // Create ImageBlock and add to page
-                auto imageBlock = std::make_shared<ImageBlock>(cachedImagePath, displayWidth, displayHeight);
-                if (!imageBlock) {
-                  LOG_ERR("EHP", "Failed to create ImageBlock");
+              // Create page for image - only break if image won't fit remaining space
+              if (self->currentPage && !self->currentPage->elements.empty() &&
+                  (self->currentPageNextY + displayHeight > self->viewportHeight)) {
+                self->completePageFn(std::move(self->currentPage));
+                self->completedPageCount++;
+                self->startNewPage(self->currentSourceOffset());
+                if (!self->currentPage) {
+                  LOG_ERR("EHP", "Failed to create new page");
                   return;
                 }
-                int xPos = (self->viewportWidth - displayWidth) / 2;
-                auto pageImage = std::make_shared<PageImage>(imageBlock, xPos, self->currentPageNextY);
-                if (!pageImage) {
-                  LOG_ERR("EHP", "Failed to create PageImage");
+              } else if (!self->currentPage) {
+                self->startNewPage(self->currentSourceOffset());
+                if (!self->currentPage) {
+                  LOG_ERR("EHP", "Failed to create initial page");
                   return;
                 }
-                self->currentPage->elements.push_back(pageImage);
-                self->currentPageNextY += displayHeight;
+              }
 
-                self->depth += 1;
+              // Create ImageBlock and add to page
+              auto imageBlock =
+                  std::make_shared<ImageBlock>(cachedImagePath, resolvedPath, displayWidth, displayHeight);
+              if (!imageBlock) {
+                LOG_ERR("EHP", "Failed to create ImageBlock");
+                return;
+              }
+              int xPos = (self->viewportWidth - displayWidth) / 2;
+              auto pageImage = std::make_shared<PageImage>(imageBlock, xPos, self->currentPageNextY);
+              if (!pageImage) {
+                LOG_ERR("EHP", "Failed to create PageImage");
                 return;
-              } else {
-                LOG_ERR("EHP", "Failed to get image dimensions");
-                Storage.remove(cachedImagePath.c_str());
               }
+              self->currentPage->elements.push_back(pageImage);
+              self->currentPageNextY += displayHeight;
+
+              self->depth += 1;
+              return;
             } else {
-              LOG_ERR("EHP", "Failed to extract image");
+              LOG_ERR("EHP", "Failed to get image dimensions");
             }
           }  // isFormatSupported
         }
@@ -685,6 +1048,11 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
 void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char* s, const int len) {
   auto* self = static_cast<ChapterHtmlSlimParser*>(userData);
 
+  // Text before the resume point is already laid out
+  if (self->replaying) {
+    return;
+  }
+
   // Skip content of nested table
   if (self->tableDepth > 1) {
     return;
@@ -695,6 +1063,10 @@ void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char
     return;
   }
 
+  if (self->table && self->currentSourceOffset() - self->tableStartOffset > TableLayout::MAX_SOURCE_BYTES) {
+    self->flattenTable();
+  }
+
   // Collect footnote link display text (for the number label)
   // Skip whitespace and brackets to normalize noterefs like "[1]" → "1"
   if (self->insideFootnoteLink) {
@@ -803,41 +1175,49 @@ void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char
       }
     }
 
-    // If we're about to run out of space, then cut the word off and start a new one.
-    // For CJK text (no spaces), this is the primary word-breaking mechanism.
-    // We must avoid splitting multi-byte UTF-8 sequences across word boundaries,
-    // otherwise the trailing bytes become orphaned continuation bytes that the
-    // decoder can't interpret.
-    if (self->partWordBufferIndex >= MAX_WORD_SIZE) {
-      int safeLen = utf8SafeTruncateBuffer(self->partWordBuffer, self->partWordBufferIndex);
-
-      if (safeLen < self->partWordBufferIndex && safeLen > 0) {
-        // Incomplete UTF-8 sequence at the end — save it before flushing
-        int overflow = self->partWordBufferIndex - safeLen;
-        char saved[4];
-        for (int j = 0; j < overflow; j++) {
-          saved[j] = self->partWordBuffer[safeLen + j];
-        }
-        self->partWordBufferIndex = safeLen;
-        self->flushPartWordBuffer();
-        for (int j = 0; j < overflow; j++) {
-          self->partWordBuffer[j] = saved[j];
+    // Copy the run of word bytes up to the next byte that needs a look of its own
+    const int runEnd = wordRunEnd(s, i, len);
+    while (i < runEnd) {
+      // If we're about to run out of space, then cut the word off and start a new one.
+      // For CJK text (no spaces), this is the primary word-breaking mechanism.
+      // We must avoid splitting multi-byte UTF-8 sequences across word boundaries,
+      // otherwise the trailing bytes become orphaned continuation bytes that the
+      // decoder can't interpret.
+      if (self->partWordBufferIndex >= MAX_WORD_SIZE) {
+        int safeLen = utf8SafeTruncateBuffer(self->partWordBuffer, self->partWordBufferIndex);
+
+        if (safeLen < self->partWordBufferIndex && safeLen > 0) {
+          // Incomplete UTF-8 sequence at the end — save it before flushing
+          int overflow = self->partWordBufferIndex - safeLen;
+          char saved[4];
+          for (int j = 0; j < overflow; j++) {
+            saved[j] = self->partWordBuffer[safeLen + j];
+          }
+          self->partWordBufferIndex = safeLen;
+          self->flushPartWordBuffer();
+          for (int j = 0; j < overflow; j++) {
+            self->partWordBuffer[j] = saved[j];
+          }
+          self->partWordBufferIndex = overflow;
+        } else {
+          self->flushPartWordBuffer();
         }
-        self->partWordBufferIndex = overflow;
-      } else {
-        self->flushPartWordBuffer();
       }
-    }
 
-    self->partWordBuffer[self->partWordBufferIndex++] = s[i];
+      const int n = std::min(runEnd - i, MAX_WORD_SIZE - self->partWordBufferIndex);
+      memcpy(self->partWordBuffer + self->partWordBufferIndex, s + i, n);
+      self->partWordBufferIndex += n;
+      i += n;
+    }
+    i--;  // The loop steps onto the stop byte
   }
 
-  // If we have > 750 words buffered up, perform the layout and consume out all but the last line
-  // There should be enough here to build out 1-2 full pages and doing this will free up a lot of
-  // memory.
-  // Spotted when reading Intermezzo, there are some really long text blocks in there.
-  if (self->currentTextBlock->size() > 750) {
-    LOG_DBG("EHP", "Text block too long, splitting into multiple pages");
+  // Lay out long paragraphs as they stream in: lines that later words can no longer change are emitted to pages and
+  // their words freed, so a paragraph never has to be buffered whole. The threshold moves past the buffered words
+  // each time, so a paragraph whose lines have not settled yet is not laid out again for every word.
+  // Cells of a table laid out as a grid are buffered whole
+  if (!self->tableCellOpen && self->currentTextBlock->size() >= self->streamLayoutAt) {
+    self->streamLayoutAt = self->currentTextBlock->size() + STREAM_LAYOUT_WORDS;
     const int horizontalInset = self->currentTextBlock->getBlockStyle().totalHorizontalInset();
     const uint16_t effectiveWidth = (horizontalInset < self->viewportWidth)
                                         ? static_cast<uint16_t>(self->viewportWidth - horizontalInset)
@@ -866,6 +1246,9 @@ void XMLCALL ChapterHtmlSlimParser::defaultHandlerExpand(void* userData, const X
 
 void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* name) {
   auto* self = static_cast<ChapterHtmlSlimParser*>(userData);
+  if (self->fb2) {
+    name = fb2TagAlias(name);
+  }
 
   // Check if any style state will change after we decrement depth
   // If so, we MUST flush the partWordBuffer with the CURRENT style first
@@ -909,6 +1292,11 @@ void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* n
 
   self->depth -= 1;
 
+  while (!self->openElements.empty() && self->openElements.back().depth >= self->depth) {
+    self->openElements.pop_back();
+    self->openElementKeys.pop_back();
+  }
+
   // Closing a footnote link — create entry from collected text and href
   if (self->insideFootnoteLink && self->depth == self->footnoteLinkDepth) {
     if (self->currentFootnoteLinkText[0] != '\0' && self->currentFootnoteLinkHref[0] != '\0') {
@@ -930,6 +1318,9 @@ void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* n
   }
 
   if (self->tableDepth == 1 && (strcmp(name, "td") == 0 || strcmp(name, "th") == 0)) {
+    if (self->table) {
+      self->closeTableCell();
+    }
     self->nextWordContinues = false;
   }
 
@@ -938,6 +1329,9 @@ void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* n
   }
 
   if (self->tableDepth == 1 && strcmp(name, "table") == 0) {
+    if (self->table) {
+      self->layoutTable();
+    }
     self->tableDepth -= 1;
     self->tableRowIndex = 0;
     self->tableColIndex = 0;
@@ -995,38 +1389,107 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
                          ? CssTextAlign::Justify
                          : static_cast<CssTextAlign>(this->paragraphAlignment);
   paragraphAlignmentBlockStyle.alignment = align;
+  // Layout still works without it, just measuring every word
+  widthCache.reset(new (std::nothrow) WordWidthCache());
+  if (hyphenationEnabled) {
+    hyphenationCache.reset(new (std::nothrow) HyphenationCache());
+  }
+  if (cssParser) {
+    styleCache.reset(new (std::nothrow) CssStyleCache());
+    if (cssParser->hasAncestorRules()) {
+      // Typical XHTML nesting depth; deeper documents grow the stacks
+      openElementKeys.reserve(16);
+      openElements.reserve(16);
+    }
+  }
   startNewTextBlock(paragraphAlignmentBlockStyle);
 
-  XML_Parser parser = XML_ParserCreate(nullptr);
+  fb2 = epub && epub->isFb2();
+  FsFile file;
+  if (!storedSource && !inflatedSource && !Storage.openFileForRead("EHP", filepath, file)) {
+    return false;
+  }
+  // An inflated source inflates straight into the parser's buffer, so inflating, parsing and laying out the chapter
+  // take turns a chunk at a time instead of the whole chapter going through a temp file on the SD card first
+  const auto chapterRead = [this, &file](void* buf, const size_t count) {
+    return storedSource     ? storedSource->read(buf, count)
+           : inflatedSource ? inflatedSource->read(buf, count)
+                            : file.read(buf, count);
+  };
+  const auto chapterAvailable = [this, &file]() {
+    return storedSource ? storedSource->available() : inflatedSource ? inflatedSource->available() : file.available();
+  };
+  // An FB2 section is a run of sibling elements cut out of the book, so it is read inside a root element, after the
+  // book's XML declaration for its encoding
+  std::string wrapPrefix;
+  std::string wrapSuffix;
+  if (fb2) {
+    const std::string& encoding = epub->getFb2Encoding();
+    wrapPrefix = encoding.empty() ? "<fb2>" : "<?xml version=\"1.0\" encoding=\"" + encoding + "\"?><fb2>";
+    wrapSuffix = "</fb2>";
+  }
+  sourcePrefixLength = wrapPrefix.size();
+  size_t prefixRead = 0;
+  size_t suffixRead = 0;
+  const auto sourceRead = [&](void* buf, const size_t count) {
+    if (prefixRead < wrapPrefix.size() || chapterAvailable() == 0) {
+      const std::string& wrap = prefixRead < wrapPrefix.size() ? wrapPrefix : wrapSuffix;
+      size_t& wrapRead = prefixRead < wrapPrefix.size() ? prefixRead : suffixRead;
+      const size_t length = std::min(count, wrap.size() - wrapRead);
+      memcpy(buf, wrap.data() + wrapRead, length);
+      wrapRead += length;
+      return static_cast<int>(length);
+    }
+    return chapterRead(buf, count);
+  };
+  const auto sourceAvailable = [&]() {
+    return static_cast<size_t>(chapterAvailable()) + (wrapPrefix.size() - prefixRead) +
+           (wrapSuffix.size() - suffixRead);
+  };
+
+  // Get file size to decide whether to show indexing popup.
+  const size_t sourceSize = storedSource ? storedSource->size() : inflatedSource ? inflatedSource->size() : file.size();
+  if (popupFn && sourceSize >= MIN_SIZE_FOR_POPUP) {
+    popupFn();
+  }
+
+  // Compute the time taken to parse and build pages
+  const uint32_t chapterStartTime = millis();
+#if XHTML_PULL_TOKENIZER
+  const bool parsed =
+      parseWithTokenizer(sourceRead, [&sourceAvailable]() { return sourceAvailable() == 0; }, chapterStartTime);
+  file.close();
+  if (!parsed) {
+    return false;
+  }
+#else
+  XML_Parser parser = createXmlParser();
   int done;
 
   if (!parser) {
     LOG_ERR("EHP", "Couldn't allocate memory for parser");
+    file.close();
     return false;
   }
 
   // Handle HTML entities (like &nbsp;) that aren't in XML spec or DTD
   // Using DefaultHandlerExpand preserves normal entity expansion from DOCTYPE
   XML_SetDefaultHandlerExpand(parser, defaultHandlerExpand);
-
-  FsFile file;
-  if (!Storage.openFileForRead("EHP", filepath, file)) {
-    destroyXmlParser(parser);
-    return false;
-  }
-
-  // Get file size to decide whether to show indexing popup.
-  if (popupFn && file.size() >= MIN_SIZE_FOR_POPUP) {
-    popupFn();
-  }
-
   XML_SetUserData(parser, this);
   XML_SetElementHandler(parser, startElement, endElement);
   XML_SetCharacterDataHandler(parser, characterData);
 
-  // Compute the time taken to parse and build pages
-  const uint32_t chapterStartTime = millis();
+  xmlParser = parser;
   do {
+    if (abortFn && abortFn() && (replaying || ++chunksSinceAbortRequest > MAX_CHUNKS_TO_CHECKPOINT)) {
+      aborted = true;
+      xmlParser = nullptr;
+      LOG_DBG("EHP", "Parse aborted after %lu ms", millis() - chapterStartTime);
+      destroyXmlParser(parser);
+      file.close();
+      return false;
+    }
+
     void* const buf = XML_GetBuffer(parser, PARSE_BUFFER_SIZE);
     if (!buf) {
       LOG_ERR("EHP", "Couldn't allocate memory for buffer");
@@ -1035,18 +1498,26 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
       return false;
     }
 
-    const size_t len = file.read(buf, PARSE_BUFFER_SIZE);
+    const int read = sourceRead(buf, PARSE_BUFFER_SIZE);
+    const size_t len = read > 0 ? static_cast<size_t>(read) : 0;
 
-    if (len == 0 && file.available() > 0) {
+    if (len == 0 && sourceAvailable() > 0) {
       LOG_ERR("EHP", "File read error");
       destroyXmlParser(parser);
       file.close();
       return false;
     }
 
-    done = file.available() == 0;
+    done = sourceAvailable() == 0;
 
     if (XML_ParseBuffer(parser, static_cast<int>(len), done) == XML_STATUS_ERROR) {
+      xmlParser = nullptr;
+      if (checkpointTaken) {
+        LOG_DBG("EHP", "Parse stopped at checkpoint after %lu ms", millis() - chapterStartTime);
+        destroyXmlParser(parser);
+        file.close();
+        return false;
+      }
       LOG_ERR("EHP", "Parse error at line %lu:\n%s", XML_GetCurrentLineNumber(parser),
               XML_ErrorString(XML_GetErrorCode(parser)));
       destroyXmlParser(parser);
@@ -1054,10 +1525,34 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
       return false;
     }
   } while (!done);
-  LOG_DBG("EHP", "Time to parse and build pages: %lu ms", millis() - chapterStartTime);
-
+  xmlParser = nullptr;
   destroyXmlParser(parser);
   file.close();
+#endif
+  LOG_DBG("EHP", "Time to parse and build pages: %lu ms", millis() - chapterStartTime);
+  if (widthCache) {
+    widthCache->logStats();
+  }
+  if (hyphenationCache) {
+    hyphenationCache->logStats();
+  }
+  if (styleCache) {
+    styleCache->logStats();
+  }
+
+  if (replaying) {
+    if (seeding) {
+      LOG_DBG("EHP", "No text block after byte %u", resumePoint.byteOffset);
+    } else {
+      LOG_ERR("EHP", "Resume point at byte %u not found", resumePoint.byteOffset);
+    }
+    return false;
+  }
+
+  // A table left open at the end of the document
+  if (table) {
+    layoutTable();
+  }
 
   // Process last page if there is still text
   if (currentTextBlock) {
@@ -1075,19 +1570,70 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
   return true;
 }
 
+bool ChapterHtmlSlimParser::parseWithTokenizer(const std::function<int(void*, size_t)>& sourceRead,
+                                               const std::function<bool()>& sourceExhausted, const uint32_t startTime) {
+  // Its buffer is the size of a few parse chunks, too much for the indexer's stack
+  std::unique_ptr<XhtmlPullTokenizer> tokens(new (std::nothrow) XhtmlPullTokenizer(lookupHtmlEntity));
+  if (!tokens) {
+    LOG_ERR("EHP", "Couldn't allocate memory for tokenizer");
+    return false;
+  }
+
+  tokenizer = tokens.get();
+  while (true) {
+    switch (tokens->next()) {
+      case XhtmlPullTokenizer::Token::StartTag:
+        startElement(this, tokens->name(), tokens->attributes());
+        continue;
+      case XhtmlPullTokenizer::Token::EndTag:
+        endElement(this, tokens->name());
+        continue;
+      case XhtmlPullTokenizer::Token::Text:
+        characterData(this, tokens->text(), static_cast<int>(tokens->textLength()));
+        continue;
+      case XhtmlPullTokenizer::Token::End:
+        tokenizer = nullptr;
+        if (checkpointTaken) {
+          LOG_DBG("EHP", "Parse stopped at checkpoint after %lu ms", millis() - startTime);
+          return false;
+        }
+        return true;
+      case XhtmlPullTokenizer::Token::NeedInput:
+        break;
+    }
+
+    if (abortFn && abortFn() && (replaying || ++chunksSinceAbortRequest > MAX_CHUNKS_TO_CHECKPOINT)) {
+      aborted = true;
+      tokenizer = nullptr;
+      LOG_DBG("EHP", "Parse aborted after %lu ms", millis() - startTime);
+      return false;
+    }
+
+    size_t capacity = 0;
+    char* const buf = tokens->inputBuffer(capacity);
+    const int read = sourceRead(buf, std::min(capacity, PARSE_BUFFER_SIZE));
+    const size_t len = read > 0 ? static_cast<size_t>(read) : 0;
+    const bool done = sourceExhausted();
+    if (len == 0 && !done) {
+      LOG_ERR("EHP", "File read error");
+      tokenizer = nullptr;
+      return false;
+    }
+    tokens->commitInput(len, done);
+  }
+}
+
 void ChapterHtmlSlimParser::addLineToPage(std::shared_ptr<TextBlock> line) {
   const int lineHeight = renderer.getLineHeight(fontId) * lineCompression;
 
   if (!currentPage) {
-    currentPage.reset(new Page());
-    currentPageNextY = 0;
+    startNewPage(blockStartOffset);
   }
 
   if (currentPageNextY + lineHeight > viewportHeight) {
     completePageFn(std::move(currentPage));
     completedPageCount++;
-    currentPage.reset(new Page());
-    currentPageNextY = 0;
+    startNewPage(blockStartOffset);
   }
 
   // Track cumulative words to assign footnotes to the page containing their anchor
@@ -1105,6 +1651,21 @@ void ChapterHtmlSlimParser::addLineToPage(std::shared_ptr<TextBlock> line) {
   currentPageNextY += lineHeight;
 }
 
+void ChapterHtmlSlimParser::startNewPage(const uint32_t sourceOffset) {
+  currentPage.reset(new Page());
+  currentPageNextY = 0;
+  // A page can start inside the block that began the previous one, never before it
+  pageOffsets.push_back(pageOffsets.empty() ? sourceOffset : std::max(sourceOffset, pageOffsets.back()));
+}
+
+uint32_t ChapterHtmlSlimParser::currentSourceOffset() const {
+  // Offsets are into the chapter itself, as for LinkTargetIndex, not counting the root wrapped around an FB2 section
+  const uint32_t offset = tokenizer   ? tokenizer->offset()
+                          : xmlParser ? static_cast<uint32_t>(XML_GetCurrentByteIndex(xmlParser))
+                                      : 0;
+  return offset > sourcePrefixLength ? offset - sourcePrefixLength : 0;
+}
+
 void ChapterHtmlSlimParser::makePages() {
   if (!currentTextBlock) {
     LOG_ERR("EHP", "!! No text block to make pages for !!");
@@ -1112,8 +1673,7 @@ void ChapterHtmlSlimParser::makePages() {
   }
 
   if (!currentPage) {
-    currentPage.reset(new Page());
-    currentPageNextY = 0;
+    startNewPage(blockStartOffset);
   }
 
   const int lineHeight = renderer.getLineHeight(fontId) * lineCompression;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <ZipFile.h>
 #include <expat.h>
 
 #include <climits>
@@ -10,23 +11,58 @@
 
 #include "../FootnoteEntry.h"
 #include "../ParsedText.h"
+#include "../TableLayout.h"
+#include "../WordWidthCache.h"
 #include "../blocks/ImageBlock.h"
 #include "../blocks/TextBlock.h"
 #include "../css/CssParser.h"
 #include "../css/CssStyle.h"
+#include "../css/CssStyleCache.h"
+#include "../hyphenation/HyphenationCache.h"
 
 class Page;
 class GfxRenderer;
 class Epub;
+class XhtmlPullTokenizer;
 
 #define MAX_WORD_SIZE 200
 
 class ChapterHtmlSlimParser {
+ public:
+  // Layout state at a text block boundary: everything needed to continue building pages in a later parse.
+  // Structural state (element depth, style stacks, tables, image numbering) is not stored; it is rebuilt by
+  // fast-forwarding through the document up to byteOffset without laying anything out.
+  struct Checkpoint {
+    uint32_t byteOffset = 0;  // Offset of the element event that started the next text block
+    uint16_t completedPageCount = 0;
+    int16_t currentPageNextY = 0;
+    BlockStyle nextBlockStyle;
+    std::unique_ptr<Page> currentPage;  // Partially filled page, may be null
+    std::vector<std::pair<std::string, uint16_t>> anchors;
+    std::vector<uint32_t> pageOffsets;
+  };
+
+ private:
   std::shared_ptr<Epub> epub;
   const std::string& filepath;
+  ZipFile::StoredEntry* storedSource = nullptr;      // Read instead of filepath when set
+  ZipFile::InflatedEntry* inflatedSource = nullptr;  // Likewise
   GfxRenderer& renderer;
   std::function<void(std::unique_ptr<Page>)> completePageFn;
   std::function<void()> popupFn;  // Popup callback
+  std::function<bool()> abortFn;  // Polled between parse chunks; returning true cancels the build
+  bool aborted = false;
+  int chunksSinceAbortRequest = 0;
+  // In place of xmlParser when parsing with XHTML_PULL_TOKENIZER
+  XhtmlPullTokenizer* tokenizer = nullptr;
+  XML_Parser xmlParser = nullptr;   // Only set while parsing, for byte offsets and stopping at a checkpoint
+  bool fb2 = false;                 // A section of an FB2 book, its elements laid out as the XHTML they stand for
+  uint32_t sourcePrefixLength = 0;  // Bytes read ahead of the chapter (the root around an FB2 section)
+  bool replaying = false;           // Fast-forwarding to resumePoint, no layout or image extraction
+  bool seeding = false;             // resumePoint is a seed offset rather than a checkpoint (see seedAt())
+  Checkpoint resumePoint;
+  Checkpoint checkpoint;
+  bool checkpointTaken = false;
   int depth = 0;
   int skipUntilDepth = INT_MAX;
   int boldUntilDepth = INT_MAX;
@@ -38,6 +74,9 @@ class ChapterHtmlSlimParser {
   int partWordBufferIndex = 0;
   bool nextWordContinues = false;  // true when next flushed word attaches to previous (inline element boundary)
   std::unique_ptr<ParsedText> currentTextBlock = nullptr;
+  std::unique_ptr<WordWidthCache> widthCache = nullptr;  // Null if it couldn't be allocated
+  std::unique_ptr<HyphenationCache> hyphenationCache = nullptr;  // Null unless hyphenating, or if allocation failed
+  std::unique_ptr<CssStyleCache> styleCache = nullptr;  // Null without a CSS parser, or if allocation failed
   std::unique_ptr<Page> currentPage = nullptr;
   int16_t currentPageNextY = 0;
   int fontId;
@@ -62,6 +101,13 @@ class ChapterHtmlSlimParser {
     bool hasUnderline = false, underline = false;
   };
   std::vector<StyleStackEntry> inlineStyleStack;
+  // Open elements for descendant/child selectors, innermost last; only kept when the stylesheet has such rules
+  struct OpenElement {
+    int depth = 0;
+    uint64_t ancestryHash = 0;  // Of this element's key and those of all its ancestors
+  };
+  std::vector<CssParser::ElementKey> openElementKeys;
+  std::vector<OpenElement> openElements;  // Parallel to openElementKeys
   CssStyle currentCssStyle;
   bool effectiveBold = false;
   bool effectiveItalic = false;
@@ -69,12 +115,20 @@ class ChapterHtmlSlimParser {
   int tableDepth = 0;
   int tableRowIndex = 0;
   int tableColIndex = 0;
+  // The table being buffered to be laid out as a grid; null outside tables and once a table is flattened
+  std::unique_ptr<TableLayout> table = nullptr;
+  uint32_t tableStartOffset = 0;
+  bool tableCellOpen = false;  // currentTextBlock is the cell being buffered
 
   // Anchor-to-page mapping: tracks which page each HTML id attribute lands on
   int completedPageCount = 0;
   std::vector<std::pair<std::string, uint16_t>> anchorData;
   std::string pendingAnchorId;  // deferred until after previous text block is flushed
 
+  // Source position of each page: byte offset in the chapter of the block (or image) its first line comes from
+  std::vector<uint32_t> pageOffsets;
+  uint32_t blockStartOffset = 0;
+
   // Footnote link tracking
   bool insideFootnoteLink = false;
   int footnoteLinkDepth = -1;
@@ -83,11 +137,32 @@ class ChapterHtmlSlimParser {
   char currentFootnoteLinkHref[64] = {};
   std::vector<std::pair<int, FootnoteEntry>> pendingFootnotes;  // <wordIndex, entry>
   int wordsExtractedInBlock = 0;
+  size_t streamLayoutAt = 0;  // Block size at which characterData next lays out the buffered words
 
   void updateEffectiveInlineStyle();
-  void startNewTextBlock(const BlockStyle& blockStyle);
+  // Push the element starting at the current depth to the open elements, dropping any that were not closed
+  void enterElement(const char* tagName, const char* classAttr);
+  // Stylesheet style of the element at the current depth with its inline style applied over it; requires cssParser
+  CssStyle resolveElementStyle(const char* tagName, const char* classAttr, const char* styleAttr);
+  void startNewTextBlock(const BlockStyle& blockStyle, bool allowCheckpoint = true);
+  void takeCheckpoint(const BlockStyle& nextBlockStyle);
+  void restoreResumePoint();
   void flushPartWordBuffer();
+  // Starts the paragraph of a table cell as tables that aren't laid out as a grid are, with a "Row, Cell" header
+  void startFlattenedCell(int row, int column, bool allowCheckpoint);
+  void closeTableCell();
+  // Lays out the cells buffered so far as flattened ones and the rest of the table likewise, for tables that outgrow
+  // TableLayout's limits
+  void flattenTable();
+  void layoutTable();
   void makePages();
+  void startNewPage(uint32_t sourceOffset);
+  bool parsing() const { return xmlParser || tokenizer; }
+  // Byte offset of the current parser event, 0 when not parsing
+  uint32_t currentSourceOffset() const;
+  // Drives the XML callbacks from XhtmlPullTokenizer instead of expat; false if the parse was aborted or failed
+  bool parseWithTokenizer(const std::function<int(void*, size_t)>& sourceRead,
+                          const std::function<bool()>& sourceExhausted, uint32_t startTime);
   // XML callbacks
   static void XMLCALL startElement(void* userData, const XML_Char* name, const XML_Char** atts);
   static void XMLCALL characterData(void* userData, const XML_Char* s, int len);
@@ -102,7 +177,8 @@ class ChapterHtmlSlimParser {
                                  const std::function<void(std::unique_ptr<Page>)>& completePageFn,
                                  const bool embeddedStyle, const std::string& contentBase,
                                  const std::string& imageBasePath, const uint8_t imageRendering = 0,
-                                 const std::function<void()>& popupFn = nullptr, const CssParser* cssParser = nullptr)
+                                 const std::function<void()>& popupFn = nullptr, const CssParser* cssParser = nullptr,
+                                 const std::function<bool()>& abortFn = nullptr)
 
       : epub(epub),
         filepath(filepath),
@@ -116,6 +192,7 @@ class ChapterHtmlSlimParser {
         hyphenationEnabled(hyphenationEnabled),
         completePageFn(completePageFn),
         popupFn(popupFn),
+        abortFn(abortFn),
         cssParser(cssParser),
         embeddedStyle(embeddedStyle),
         imageRendering(imageRendering),
@@ -126,4 +203,29 @@ class ChapterHtmlSlimParser {
   bool parseAndBuildPages();
   void addLineToPage(std::shared_ptr<TextBlock> line);
   const std::vector<std::pair<std::string, uint16_t>>& getAnchors() const { return anchorData; }
+  // One entry per completed page, ascending
+  const std::vector<uint32_t>& getPageOffsets() const { return pageOffsets; }
+  bool wasAborted() const { return aborted; }
+
+  // Parse a stored (uncompressed) chapter in place from the EPUB rather than from the file at filepath
+  void setStoredSource(ZipFile::StoredEntry& entry) { storedSource = &entry; }
+  // Parse a compressed chapter as it is inflated from the EPUB, with no temp file in between
+  void setInflatedSource(ZipFile::InflatedEntry& entry) { inflatedSource = &entry; }
+  // Continue a build that was aborted at the given checkpoint instead of starting from the first page.
+  void resumeFrom(Checkpoint&& from) {
+    resumePoint = std::move(from);
+    replaying = true;
+  }
+  // Start laying out at the first text block at or after a byte offset, as if the chapter began there: the pages are
+  // numbered from 0 and their breaks can differ from those of a layout of the whole chapter. For a provisional page
+  // in a chapter that has not been laid out up to the offset.
+  void seedAt(const uint32_t byteOffset) {
+    resumePoint = Checkpoint{};
+    resumePoint.byteOffset = byteOffset;
+    replaying = true;
+    seeding = true;
+  }
+  // After an abort: whether the parser stopped at a text block boundary, and the state to resume from.
+  bool hasCheckpoint() const { return checkpointTaken; }
+  Checkpoint& getCheckpoint() { return checkpoint; }
 };
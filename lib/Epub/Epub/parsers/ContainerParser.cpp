@@ -4,7 +4,7 @@
 #include <XmlParserUtils.h>
 
 bool ContainerParser::setup() {
-  parser = XML_ParserCreate(nullptr);
+  parser = createXmlParser();
   if (!parser) {
     LOG_ERR("CTR", "Couldn't allocate memory for parser");
     return false;
@@ -0,0 +1,403 @@
+#include "Fb2Parser.h"
+
+#include <FsHelpers.h>
+#include <Logging.h>
+#include <XmlParserUtils.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <new>
+
+namespace {
+constexpr size_t PARSE_BUFFER_SIZE = 4096;
+constexpr size_t SCAN_BUFFER_SIZE = 4096;
+// Titles and author names are cut at this, tags searched for binaries at their start
+constexpr size_t MAX_TEXT_LENGTH = 255;
+constexpr size_t MAX_TAG_LENGTH = 255;
+
+bool isWhitespace(const char c) { return c == ' ' || c == '\r' || c == '\n' || c == '\t'; }
+
+// Element names without the namespace prefix some books give them
+const char* localName(const char* name) {
+  const char* colon = strrchr(name, ':');
+  return colon ? colon + 1 : name;
+}
+
+const char* getAttribute(const XML_Char** atts, const char* attrName) {
+  for (int i = 0; atts[i]; i += 2) {
+    if (strcmp(atts[i], attrName) == 0) return atts[i + 1];
+  }
+  return nullptr;
+}
+
+// The target of an <image> or <a>, by the prefix its book gives the XLink namespace (l:href, xlink:href, ...)
+const char* getXlinkHref(const XML_Char** atts) {
+  for (int i = 0; atts[i]; i += 2) {
+    if (strcmp(localName(atts[i]), "href") == 0) return atts[i + 1];
+  }
+  return nullptr;
+}
+
+// The value of attrName in the text of a tag, or empty
+std::string tagAttribute(const std::string& tag, const char* attrName) {
+  const size_t nameLength = strlen(attrName);
+  for (size_t pos = tag.find(attrName); pos != std::string::npos; pos = tag.find(attrName, pos + 1)) {
+    if (pos == 0 || !isWhitespace(tag[pos - 1])) {
+      continue;
+    }
+    size_t i = pos + nameLength;
+    while (i < tag.size() && isWhitespace(tag[i])) i++;
+    if (i == tag.size() || tag[i] != '=') {
+      continue;
+    }
+    i++;
+    while (i < tag.size() && isWhitespace(tag[i])) i++;
+    if (i == tag.size() || (tag[i] != '"' && tag[i] != '\'')) {
+      continue;
+    }
+    const size_t end = tag.find(tag[i], i + 1);
+    return end == std::string::npos ? std::string() : tag.substr(i + 1, end - i - 1);
+  }
+  return {};
+}
+
+// Images are named with the extension the image decoders go by
+std::string imageHref(const std::string& id, const std::string& contentType) {
+  if (FsHelpers::hasJpgExtension(id) || FsHelpers::hasPngExtension(id)) {
+    return id;
+  }
+  if (contentType == "image/jpeg" || contentType == "image/jpg") {
+    return id + ".jpg";
+  }
+  if (contentType == "image/png") {
+    return id + ".png";
+  }
+  return id;
+}
+}  // namespace
+
+bool Fb2Parser::parse(FsFile& book) {
+  parser = createXmlParser();
+  if (!parser) {
+    LOG_ERR("FB2", "Couldn't allocate memory for parser");
+    return false;
+  }
+  XML_SetUserData(parser, this);
+  XML_SetXmlDeclHandler(parser, xmlDecl);
+  XML_SetElementHandler(parser, startElement, endElement);
+  XML_SetCharacterDataHandler(parser, characterData);
+
+  bool done = false;
+  while (!done) {
+    void* const buf = XML_GetBuffer(parser, PARSE_BUFFER_SIZE);
+    if (!buf) {
+      LOG_ERR("FB2", "Couldn't allocate memory for buffer");
+      destroyXmlParser(parser);
+      return false;
+    }
+    const int read = book.read(buf, PARSE_BUFFER_SIZE);
+    if (read < 0) {
+      LOG_ERR("FB2", "File read error");
+      destroyXmlParser(parser);
+      return false;
+    }
+    done = book.available() == 0;
+    if (XML_ParseBuffer(parser, read, done) == XML_STATUS_ERROR) {
+      if (binariesReached && XML_GetErrorCode(parser) == XML_ERROR_ABORTED) {
+        break;
+      }
+      LOG_ERR("FB2", "Parse error at line %lu: %s", XML_GetCurrentLineNumber(parser),
+              XML_ErrorString(XML_GetErrorCode(parser)));
+      destroyXmlParser(parser);
+      return false;
+    }
+  }
+  destroyXmlParser(parser);
+
+  if (binariesReached && !scanBinaries(book, binariesStart)) {
+    LOG_ERR("FB2", "Failed to read the images of the book");
+    return false;
+  }
+  if (const Fb2Index::Image* cover = index.findImageById(coverId.c_str())) {
+    coverHref = cover->href;
+  }
+  if (index.sections.empty()) {
+    LOG_ERR("FB2", "No sections found");
+    return false;
+  }
+  LOG_DBG("FB2", "Found %zu sections, %zu images, %zu link targets", index.sections.size(), index.images.size(),
+          index.linkTargets.size());
+  return true;
+}
+
+void XMLCALL Fb2Parser::xmlDecl(void* userData, const XML_Char*, const XML_Char* encoding, int) {
+  auto* self = static_cast<Fb2Parser*>(userData);
+  if (encoding && strcasecmp(encoding, "utf-8") != 0) {
+    self->index.encoding = encoding;
+  }
+}
+
+void Fb2Parser::collect(std::string& into) {
+  collecting = &into;
+  collectDepth = depth;
+  if (!into.empty()) {
+    into += ' ';
+  }
+}
+
+void XMLCALL Fb2Parser::startElement(void* userData, const XML_Char* name, const XML_Char** atts) {
+  auto* self = static_cast<Fb2Parser*>(userData);
+  self->depth++;
+  const char* local = localName(name);
+  // Words in sibling elements (the paragraphs of a title) stay apart
+  if (self->collecting && !self->collecting->empty() && self->collecting->back() != ' ') {
+    *self->collecting += ' ';
+  }
+
+  if (self->depth == 2) {
+    if (strcmp(local, "body") == 0) {
+      const char* bodyName = getAttribute(atts, "name");
+      self->inBody = true;
+      self->mainBody = !self->seenBody;
+      self->seenBody = true;
+      self->bodyName = bodyName ? bodyName : "";
+      self->bodyTitle.clear();
+      self->bodyFirstSection = self->index.sections.size();
+    } else if (strcmp(local, "binary") == 0) {
+      const char* id = getAttribute(atts, "id");
+      const char* contentType = getAttribute(atts, "content-type");
+      self->binariesReached = true;
+      self->binariesStart = static_cast<uint32_t>(XML_GetCurrentByteIndex(self->parser) +
+                                                  XML_GetCurrentByteCount(self->parser));
+      self->openBinary(id ? id : "", contentType ? contentType : "", self->binariesStart);
+      // Nothing but binaries follows; the rest of the file is only searched for their tags
+      XML_StopParser(self->parser, XML_FALSE);
+    }
+    return;
+  }
+
+  if (self->inBody) {
+    self->startBodyElement(local, atts, static_cast<uint32_t>(XML_GetCurrentByteIndex(self->parser)));
+    return;
+  }
+
+  // The description: only the title-info of the book itself, not that of its source or of the FB2 document
+  if (self->depth == 3) {
+    self->inTitleInfo = strcmp(local, "title-info") == 0;
+    return;
+  }
+  if (!self->inTitleInfo) {
+    return;
+  }
+  if (self->depth == 4) {
+    if (strcmp(local, "book-title") == 0 && self->title.empty()) {
+      self->collect(self->title);
+    } else if (strcmp(local, "lang") == 0 && self->language.empty()) {
+      self->collect(self->language);
+    }
+    return;
+  }
+  if (self->depth == 5 && !self->authorDone &&
+      (strcmp(local, "first-name") == 0 || strcmp(local, "middle-name") == 0 || strcmp(local, "last-name") == 0 ||
+       (strcmp(local, "nickname") == 0 && self->author.empty()))) {
+    self->collect(self->author);
+    return;
+  }
+  if (strcmp(local, "image") == 0 && self->coverId.empty()) {
+    const char* href = getXlinkHref(atts);
+    if (href && href[0] == '#') {
+      self->coverId = href + 1;
+    }
+  }
+}
+
+void Fb2Parser::startBodyElement(const char* name, const XML_Char** atts, const uint32_t offset) {
+  const bool section = strcmp(name, "section") == 0;
+  if (depth == 3) {
+    if (section) {
+      flushHead();
+      sectionStart = offset;
+    } else if (!headOpen) {
+      headOpen = true;
+      headStart = offset;
+    }
+    if (strcmp(name, "title") == 0 && !mainBody) {
+      collect(bodyTitle);
+    }
+  }
+
+  if (section) {
+    const char* id = getAttribute(atts, "id");
+    sectionIds.emplace_back(id ? id : "");
+    // The top-level section holding it is the next section of the index
+    if (id && id[0] != '\0') {
+      const size_t length = strlen(id);
+      index.linkTargets.push_back({Fb2Index::idHash(id, length), static_cast<uint16_t>(length),
+                                   static_cast<uint16_t>(index.sections.size())});
+    }
+    return;
+  }
+
+  // Sections are the children of a body or a section, so a section's title is an element deeper than it
+  if (mainBody && !sectionIds.empty() && depth == 3 + static_cast<int>(sectionIds.size()) &&
+      strcmp(name, "title") == 0) {
+    sectionTitle.clear();
+    collect(sectionTitle);
+  }
+}
+
+void XMLCALL Fb2Parser::characterData(void* userData, const XML_Char* s, const int len) {
+  auto* self = static_cast<Fb2Parser*>(userData);
+  std::string* into = self->collecting;
+  if (!into) {
+    return;
+  }
+  for (int i = 0; i < len; i++) {
+    // Cut at a character boundary
+    if (into->size() >= MAX_TEXT_LENGTH && (static_cast<uint8_t>(s[i]) & 0xC0) != 0x80) {
+      return;
+    }
+    if (!isWhitespace(s[i])) {
+      *into += s[i];
+    } else if (!into->empty() && into->back() != ' ') {
+      *into += ' ';
+    }
+  }
+}
+
+void XMLCALL Fb2Parser::endElement(void* userData, const XML_Char* name) {
+  auto* self = static_cast<Fb2Parser*>(userData);
+  if (self->collecting && self->depth == self->collectDepth) {
+    std::string& text = *self->collecting;
+    while (!text.empty() && text.back() == ' ') {
+      text.pop_back();
+    }
+    if (self->collecting == &self->sectionTitle && !text.empty()) {
+      const uint8_t level = static_cast<uint8_t>(std::min<size_t>(self->sectionIds.size(), UINT8_MAX));
+      // A top-level section starts its spine item, a nested one is found by its id if it has one
+      self->toc.push_back({text, static_cast<uint16_t>(self->index.sections.size()),
+                           level > 1 ? self->sectionIds.back() : std::string(), level});
+    }
+    self->collecting = nullptr;
+  }
+
+  if (self->depth == 2 && self->inBody) {
+    self->flushHead();
+    // The notes and comments go under one entry
+    const std::string& bodyLabel = self->bodyTitle.empty() ? self->bodyName : self->bodyTitle;
+    if (!self->mainBody && self->index.sections.size() > self->bodyFirstSection && !bodyLabel.empty()) {
+      self->toc.push_back({bodyLabel, static_cast<uint16_t>(self->bodyFirstSection), std::string(), 1});
+    }
+    self->inBody = false;
+  } else if (self->depth > 2 && self->inBody) {
+    const auto end = static_cast<uint32_t>(XML_GetCurrentByteIndex(self->parser) +
+                                           XML_GetCurrentByteCount(self->parser));
+    self->endBodyElement(localName(name), end);
+  } else if (self->depth == 3) {
+    self->inTitleInfo = false;
+  } else if (self->depth == 4 && self->inTitleInfo && strcmp(localName(name), "author") == 0) {
+    // The first author only
+    self->authorDone = !self->author.empty();
+  }
+  self->depth--;
+}
+
+void Fb2Parser::endBodyElement(const char* name, const uint32_t end) {
+  if (strcmp(name, "section") == 0 && !sectionIds.empty()) {
+    sectionIds.pop_back();
+    if (depth == 3) {
+      index.sections.push_back({sectionStart, end - sectionStart});
+    }
+    return;
+  }
+  if (depth == 3) {
+    headEnd = end;
+  }
+}
+
+void Fb2Parser::flushHead() {
+  if (headOpen && headEnd > headStart) {
+    index.sections.push_back({headStart, headEnd - headStart});
+  }
+  headOpen = false;
+}
+
+bool Fb2Parser::scanBinaries(FsFile& book, uint32_t offset) {
+  std::unique_ptr<char[]> buffer(new (std::nothrow) char[SCAN_BUFFER_SIZE]);
+  if (!buffer || !book.seek(offset)) {
+    return false;
+  }
+  // Base64 has no '<', so only the tags around the binaries are looked at
+  std::string tag;
+  bool inTag = false;
+  uint32_t tagStart = 0;
+  while (true) {
+    const int read = book.read(buffer.get(), SCAN_BUFFER_SIZE);
+    if (read < 0) {
+      return false;
+    }
+    if (read == 0) {
+      break;
+    }
+    const char* const chunk = buffer.get();
+    int i = 0;
+    while (i < read) {
+      if (!inTag) {
+        const auto* open = static_cast<const char*>(memchr(chunk + i, '<', read - i));
+        if (!open) {
+          break;
+        }
+        i = static_cast<int>(open - chunk) + 1;
+        tagStart = offset + i - 1;
+        tag.clear();
+        inTag = true;
+        continue;
+      }
+      const auto* close = static_cast<const char*>(memchr(chunk + i, '>', read - i));
+      const int end = close ? static_cast<int>(close - chunk) : read;
+      if (tag.size() < MAX_TAG_LENGTH) {
+        tag.append(chunk + i, std::min<size_t>(end - i, MAX_TAG_LENGTH - tag.size()));
+      }
+      i = end;
+      if (close) {
+        i++;
+        inTag = false;
+        binaryTag(tag, tagStart, offset + i);
+      }
+    }
+    offset += read;
+  }
+  if (binaryOpen) {
+    LOG_DBG("FB2", "Image %s is cut short, skipped", binaryId.c_str());
+  }
+  return true;
+}
+
+void Fb2Parser::binaryTag(const std::string& tag, const uint32_t tagStart, const uint32_t tagEnd) {
+  const bool closing = !tag.empty() && tag[0] == '/';
+  const size_t nameStart = closing ? 1 : 0;
+  size_t nameEnd = nameStart;
+  while (nameEnd < tag.size() && !isWhitespace(tag[nameEnd]) && tag[nameEnd] != '/') {
+    nameEnd++;
+  }
+  const std::string name = tag.substr(nameStart, nameEnd - nameStart);
+  if (strcmp(localName(name.c_str()), "binary") != 0) {
+    return;
+  }
+  if (closing) {
+    if (binaryOpen) {
+      index.images.push_back({binaryId, imageHref(binaryId, binaryType), {binaryStart, tagStart - binaryStart}});
+      binaryOpen = false;
+    }
+  } else if (tag.back() != '/') {
+    openBinary(tagAttribute(tag, "id"), tagAttribute(tag, "content-type"), tagEnd);
+  }
+}
+
+void Fb2Parser::openBinary(std::string id, std::string contentType, const uint32_t contentStart) {
+  binaryOpen = !id.empty();
+  binaryStart = contentStart;
+  binaryId = std::move(id);
+  binaryType = std::move(contentType);
+}
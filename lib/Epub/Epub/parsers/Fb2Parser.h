@@ -0,0 +1,87 @@
+#pragma once
+#include <HalStorage.h>
+#include <expat.h>
+
+#include <string>
+#include <vector>
+
+#include "../Fb2Index.h"
+
+/**
+ * Reads an FB2 book once, for its metadata, table of contents and Fb2Index. Each top-level <section> of a body is a
+ * spine item, as is a run of what comes before it (the title and epigraphs of a body); sections with a <title> are
+ * the table of contents, those of the bodies after the first (the notes) going under one entry for their body.
+ *
+ * expat reads the description and the bodies. The <binary> elements come last, base64 text making up most of an
+ * illustrated book, so at the first of them expat is stopped and the rest of the file only searched for the tags
+ * around them.
+ */
+class Fb2Parser {
+ public:
+  struct TocItem {
+    std::string title;
+    uint16_t section;
+    std::string anchor;
+    uint8_t level;
+  };
+
+  std::string title;
+  std::string author;
+  std::string language;
+  std::string coverHref;
+  std::vector<TocItem> toc;
+
+  explicit Fb2Parser(Fb2Index& index) : index(index) {}
+
+  bool parse(FsFile& book);
+
+ private:
+  Fb2Index& index;
+  XML_Parser parser = nullptr;
+  int depth = 0;
+
+  // Description
+  bool inTitleInfo = false;
+  bool authorDone = false;
+  std::string coverId;
+
+  // Bodies
+  bool inBody = false;
+  bool mainBody = false;
+  bool seenBody = false;
+  std::string bodyName;
+  std::string bodyTitle;
+  size_t bodyFirstSection = 0;
+  bool headOpen = false;  // Elements before a body's next section, laid out as a section of their own
+  uint32_t headStart = 0;
+  uint32_t headEnd = 0;
+  uint32_t sectionStart = 0;
+  std::vector<std::string> sectionIds;  // Of the open sections, outermost first
+  std::string sectionTitle;
+
+  // The text of the element being collected into, with whitespace collapsed
+  std::string* collecting = nullptr;
+  int collectDepth = 0;
+
+  // Where expat was stopped, after the start tag of the first <binary>
+  bool binariesReached = false;
+  uint32_t binariesStart = 0;
+  // The <binary> being searched through
+  bool binaryOpen = false;
+  uint32_t binaryStart = 0;
+  std::string binaryId;
+  std::string binaryType;
+
+  static void XMLCALL xmlDecl(void* userData, const XML_Char* version, const XML_Char* encoding, int standalone);
+  static void XMLCALL startElement(void* userData, const XML_Char* name, const XML_Char** atts);
+  static void XMLCALL characterData(void* userData, const XML_Char* s, int len);
+  static void XMLCALL endElement(void* userData, const XML_Char* name);
+
+  void collect(std::string& into);
+  void startBodyElement(const char* name, const XML_Char** atts, uint32_t offset);
+  void endBodyElement(const char* name, uint32_t end);
+  void flushHead();
+  bool scanBinaries(FsFile& book, uint32_t offset);
+  void binaryTag(const std::string& tag, uint32_t tagStart, uint32_t tagEnd);
+  void openBinary(std::string id, std::string contentType, uint32_t contentStart);
+};
@@ -0,0 +1,691 @@
+#include "MarkdownParser.h"
+
+#include <GfxRenderer.h>
+#include <Logging.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include "../Page.h"
+
+namespace {
+// Minimum file size (in bytes) to show indexing popup - smaller documents don't benefit from it
+constexpr size_t MIN_SIZE_FOR_POPUP = 10 * 1024;  // 10KB
+constexpr size_t READ_BUFFER_SIZE = 4 * 1024;
+// Words buffered between streaming layout passes over a long paragraph
+constexpr size_t STREAM_LAYOUT_WORDS = 64;
+// Deepest list nesting given its own indent
+constexpr size_t MAX_LIST_LEVEL = 4;
+
+bool isSpace(const char c) { return c == ' ' || c == '\t'; }
+
+// Letters and digits, counting every non-ASCII byte as a letter
+bool isAlnum(const char c) {
+  return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+         (static_cast<uint8_t>(c) & 0x80) != 0;
+}
+
+bool isAsciiPunct(const char c) {
+  return (c >= '!' && c <= '/') || (c >= ':' && c <= '@') || (c >= '[' && c <= '`') || (c >= '{' && c <= '~');
+}
+
+// Length of the run of c starting at text[pos]
+size_t runLength(const char* text, const size_t len, size_t pos, const char c) {
+  const size_t start = pos;
+  while (pos < len && text[pos] == c) {
+    pos++;
+  }
+  return pos - start;
+}
+
+// `***`, `- - -`, `___` and the like: three or more of one of those characters, optionally spaced
+bool isThematicBreak(const char* text, const size_t len) {
+  const char c = text[0];
+  if (c != '*' && c != '-' && c != '_') {
+    return false;
+  }
+  size_t count = 0;
+  for (size_t i = 0; i < len; i++) {
+    if (text[i] == c) {
+      count++;
+    } else if (!isSpace(text[i])) {
+      return false;
+    }
+  }
+  return count >= 3;
+}
+
+// `===` or `---` under a paragraph's first line
+bool isSetextUnderline(const char* text, const size_t len) {
+  if (text[0] != '=' && text[0] != '-') {
+    return false;
+  }
+  size_t i = runLength(text, len, 0, text[0]);
+  while (i < len && isSpace(text[i])) {
+    i++;
+  }
+  return i == len;
+}
+
+// Length of an ATX heading marker (`#` to `######`, then a space or the end of the line), or 0
+size_t atxMarkerLength(const char* text, const size_t len) {
+  const size_t level = runLength(text, len, 0, '#');
+  if (level == 0 || level > 6 || (level < len && !isSpace(text[level]))) {
+    return 0;
+  }
+  return level;
+}
+
+// Length of a list marker (`- `, `* `, `+ `, `1. `, `1) `) including the space after it, or 0
+size_t listMarkerLength(const char* text, const size_t len) {
+  if ((text[0] == '-' || text[0] == '*' || text[0] == '+') && len > 1 && isSpace(text[1])) {
+    return 2;
+  }
+  size_t digits = 0;
+  while (digits < len && digits < 9 && text[digits] >= '0' && text[digits] <= '9') {
+    digits++;
+  }
+  if (digits > 0 && digits + 1 < len && (text[digits] == '.' || text[digits] == ')') && isSpace(text[digits + 1])) {
+    return digits + 2;
+  }
+  return 0;
+}
+
+// Length of a code fence (three or more ` or ~), or 0
+size_t codeFenceLength(const char* text, const size_t len) {
+  if (text[0] != '`' && text[0] != '~') {
+    return 0;
+  }
+  const size_t run = runLength(text, len, 0, text[0]);
+  return run >= 3 ? run : 0;
+}
+
+// A table delimiter row such as `|---|:---:|`
+bool isTableDelimiterRow(const char* text, const size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    const char c = text[i];
+    if (c != '|' && c != '-' && c != ':' && !isSpace(c)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Position of the `](` closing a link or image text opened before text[from], or len
+size_t findLinkTextEnd(const char* text, const size_t len, const size_t from) {
+  for (size_t i = from; i + 1 < len; i++) {
+    if (text[i] == ']') {
+      return text[i + 1] == '(' ? i : len;
+    }
+  }
+  return len;
+}
+}  // namespace
+
+BlockStyle MarkdownParser::paragraphBlockStyle(const uint8_t quoteDepth) const {
+  // Same as a <p> without a stylesheet, indented by the enclosing block quotes
+  auto blockStyle =
+      BlockStyle::fromCssStyle(CssStyle(), emSize, static_cast<CssTextAlign>(paragraphAlignment), viewportWidth);
+  blockStyle.marginLeft = static_cast<int16_t>(quoteDepth * emSize);
+  return blockStyle;
+}
+
+BlockStyle MarkdownParser::headingBlockStyle(const uint8_t quoteDepth) const {
+  // Same as an <h1> to <h6> without a stylesheet
+  auto blockStyle = BlockStyle::fromCssStyle(CssStyle(), emSize, CssTextAlign::Center, viewportWidth);
+  blockStyle.textAlignDefined = true;
+  blockStyle.marginLeft = static_cast<int16_t>(quoteDepth * emSize);
+  return blockStyle;
+}
+
+BlockStyle MarkdownParser::listItemBlockStyle(const uint8_t quoteDepth, const size_t level) const {
+  // Same as an <li> without a stylesheet, indented by its nesting level
+  auto blockStyle = paragraphBlockStyle(quoteDepth);
+  blockStyle.marginLeft = static_cast<int16_t>(blockStyle.marginLeft + level * emSize);
+  return blockStyle;
+}
+
+BlockStyle MarkdownParser::verbatimBlockStyle(const uint8_t quoteDepth, const int16_t indent) const {
+  auto blockStyle = paragraphBlockStyle(quoteDepth);
+  blockStyle.marginLeft = static_cast<int16_t>(blockStyle.marginLeft + indent);
+  blockStyle.alignment = CssTextAlign::Left;
+  blockStyle.textAlignDefined = true;
+  blockStyle.textIndent = 0;
+  blockStyle.textIndentDefined = true;
+  return blockStyle;
+}
+
+void MarkdownParser::startNewTextBlock(const BlockKind kind, const BlockStyle& blockStyle, const uint8_t quoteDepth) {
+  flushWord();
+  if (currentTextBlock && !currentTextBlock->isEmpty()) {
+    makePages();
+  }
+  // Code and table cells keep their words as written
+  const bool hyphenate = hyphenationEnabled && kind != BlockKind::Code && kind != BlockKind::Table;
+  currentTextBlock.reset(
+      new ParsedText(extraParagraphSpacing, hyphenate, blockStyle, widthCache.get(), hyphenationCache.get()));
+  blockKind = kind;
+  blockQuoteDepth = quoteDepth;
+  streamLayoutAt = STREAM_LAYOUT_WORDS;
+  nextWordContinues = false;
+  hardBreakPending = false;
+}
+
+void MarkdownParser::endBlock() {
+  flushWord();
+  if (currentTextBlock && !currentTextBlock->isEmpty()) {
+    makePages();
+  }
+  currentTextBlock.reset();
+  blockKind = BlockKind::None;
+  hardBreakPending = false;
+  bold = false;
+  italic = false;
+  inCodeSpan = false;
+}
+
+void MarkdownParser::processLine(const char* line, const size_t len, const bool continuation, const bool truncated) {
+  if (continuation) {
+    // The rest of an overlong line: more text for whatever the line started
+    releaseHeldLine();
+    if (!currentTextBlock) {
+      startNewTextBlock(BlockKind::Paragraph, paragraphBlockStyle(0), 0);
+    }
+    addLineText(line, len, truncated, blockKind == BlockKind::Code);
+    return;
+  }
+
+  // Block quote markers; inside a fenced code block only those of the quote the fence is in
+  size_t pos = 0;
+  uint8_t quoteDepth = 0;
+  while (pos < len && (!fenceChar || quoteDepth < fenceQuoteDepth)) {
+    size_t markerPos = pos;
+    while (markerPos < len && markerPos - pos < 3 && line[markerPos] == ' ') {
+      markerPos++;
+    }
+    if (markerPos >= len || line[markerPos] != '>') {
+      break;
+    }
+    pos = markerPos + 1;
+    if (pos < len && isSpace(line[pos])) {
+      pos++;
+    }
+    quoteDepth++;
+  }
+
+  if (fenceChar) {
+    processFencedLine(line + pos, len - pos, truncated);
+  } else {
+    processBlockLine(line + pos, len - pos, quoteDepth, truncated);
+  }
+}
+
+void MarkdownParser::processFencedLine(const char* text, const size_t len, const bool truncated) {
+  size_t indent = 0;
+  while (indent < len && indent < 3 && text[indent] == ' ') {
+    indent++;
+  }
+  const size_t run = runLength(text, len, indent, fenceChar);
+  if (run >= fenceLength && indent + run == len) {
+    fenceChar = 0;
+    endBlock();
+    return;
+  }
+
+  startNewTextBlock(BlockKind::Code, verbatimBlockStyle(fenceQuoteDepth, static_cast<int16_t>(emSize)),
+                    fenceQuoteDepth);
+  addLineText(text, len, truncated, true);
+}
+
+void MarkdownParser::processBlockLine(const char* text, const size_t len, const uint8_t quoteDepth,
+                                      const bool truncated) {
+  size_t pos = 0;
+  size_t indent = 0;
+  while (pos < len && isSpace(text[pos])) {
+    indent += text[pos] == '\t' ? 4 - indent % 4 : 1;
+    pos++;
+  }
+  const char* rest = text + pos;
+  const size_t restLen = len - pos;
+
+  if (restLen == 0) {
+    // Blank line: ends the paragraph or list item
+    releaseHeldLine();
+    endBlock();
+    return;
+  }
+
+  if (hasHeldLine) {
+    if (quoteDepth == heldQuoteDepth && indent < 4 && isSetextUnderline(rest, restLen)) {
+      hasHeldLine = false;
+      startNewTextBlock(BlockKind::Heading, headingBlockStyle(quoteDepth), quoteDepth);
+      bold = true;
+      addLineText(heldLine.data(), heldLine.size(), false);
+      endBlock();
+      return;
+    }
+    releaseHeldLine();
+  }
+
+  const bool inParagraph = blockKind == BlockKind::Paragraph || blockKind == BlockKind::ListItem;
+  if (indent >= 4 && !inParagraph) {
+    // Indented code
+    startNewTextBlock(BlockKind::Code, verbatimBlockStyle(quoteDepth, static_cast<int16_t>(emSize)), quoteDepth);
+    addLineText(rest, restLen, truncated, true);
+    return;
+  }
+
+  if (const size_t fence = codeFenceLength(rest, restLen)) {
+    endBlock();
+    fenceChar = rest[0];
+    fenceLength = fence;
+    fenceQuoteDepth = quoteDepth;
+    return;
+  }
+
+  if (const size_t marker = atxMarkerLength(rest, restLen)) {
+    // Drop the optional closing sequence of #s
+    size_t end = restLen;
+    while (end > marker && isSpace(rest[end - 1])) {
+      end--;
+    }
+    const size_t closing = end;
+    while (end > marker && rest[end - 1] == '#') {
+      end--;
+    }
+    if (end != closing && end > marker && !isSpace(rest[end - 1])) {
+      end = closing;  // Part of the heading text, like `C#`
+    }
+    endBlock();
+    startNewTextBlock(BlockKind::Heading, headingBlockStyle(quoteDepth), quoteDepth);
+    bold = true;
+    addLineText(rest + marker, end - marker, truncated);
+    endBlock();
+    return;
+  }
+
+  if (isThematicBreak(rest, restLen)) {
+    endBlock();
+    startNewTextBlock(BlockKind::Heading, headingBlockStyle(quoteDepth), quoteDepth);
+    for (int i = 0; i < 3; i++) {
+      currentTextBlock->addWord("*", EpdFontFamily::REGULAR);
+    }
+    endBlock();
+    return;
+  }
+
+  if (const size_t marker = listMarkerLength(rest, restLen)) {
+    endBlock();
+    const size_t level = std::min(indent / 2, MAX_LIST_LEVEL);
+    startNewTextBlock(BlockKind::ListItem, listItemBlockStyle(quoteDepth, level), quoteDepth);
+    if (rest[0] == '-' || rest[0] == '*' || rest[0] == '+') {
+      currentTextBlock->addWord("\xe2\x80\xa2", EpdFontFamily::REGULAR);
+    } else {
+      currentTextBlock->addWord(std::string_view(rest, marker - 1), EpdFontFamily::REGULAR);
+    }
+    addLineText(rest + marker, restLen - marker, truncated);
+    return;
+  }
+
+  if (rest[0] == '|') {
+    // Table row: one line per row, cells separated by their pipes
+    endBlock();
+    if (isTableDelimiterRow(rest, restLen)) {
+      return;
+    }
+    size_t end = restLen;
+    while (end > 1 && (isSpace(rest[end - 1]) || rest[end - 1] == '|')) {
+      end--;
+    }
+    startNewTextBlock(BlockKind::Table, verbatimBlockStyle(quoteDepth, 0), quoteDepth);
+    addLineText(rest + 1, end - 1, truncated);
+    endBlock();
+    return;
+  }
+
+  if (inParagraph && quoteDepth == blockQuoteDepth) {
+    // Continuation line
+    if (hardBreakPending) {
+      auto blockStyle = currentTextBlock->getBlockStyle();
+      blockStyle.textIndent = 0;
+      blockStyle.textIndentDefined = true;
+      startNewTextBlock(blockKind, blockStyle, quoteDepth);
+    }
+    addLineText(rest, restLen, truncated);
+    return;
+  }
+
+  endBlock();
+  if (truncated) {
+    // Too long to be a setext heading
+    startNewTextBlock(BlockKind::Paragraph, paragraphBlockStyle(quoteDepth), quoteDepth);
+    addLineText(rest, restLen, truncated);
+    return;
+  }
+  heldLine.assign(rest, restLen);
+  heldQuoteDepth = quoteDepth;
+  hasHeldLine = true;
+}
+
+void MarkdownParser::releaseHeldLine() {
+  if (!hasHeldLine) {
+    return;
+  }
+  hasHeldLine = false;
+  startNewTextBlock(BlockKind::Paragraph, paragraphBlockStyle(heldQuoteDepth), heldQuoteDepth);
+  addLineText(heldLine.data(), heldLine.size(), false);
+}
+
+void MarkdownParser::addLineText(const char* text, const size_t len, const bool truncated, const bool literal) {
+  size_t end = len;
+  bool hardBreak = false;
+  if (!truncated && !literal) {
+    hardBreak = end >= 2 && text[end - 1] == ' ' && text[end - 2] == ' ';
+    while (end > 0 && isSpace(text[end - 1])) {
+      end--;
+    }
+    if (end > 0 && text[end - 1] == '\\') {
+      hardBreak = true;
+      end--;
+    }
+  }
+
+  addInlineText(text, end, literal);
+  if (!truncated) {
+    // The line break separates words
+    flushWord();
+    nextWordContinues = false;
+  }
+  hardBreakPending = hardBreak;
+  streamLayout();
+}
+
+void MarkdownParser::addInlineText(const char* text, const size_t len, const bool literal) {
+  for (size_t i = 0; i < len; i++) {
+    const char c = text[i];
+    if (isSpace(c)) {
+      flushWord();
+      nextWordContinues = false;
+      continue;
+    }
+    if (literal) {
+      appendToWord(c);
+      continue;
+    }
+    if (inCodeSpan) {
+      if (c == '`') {
+        inCodeSpan = false;
+      } else {
+        appendToWord(c);
+      }
+      continue;
+    }
+
+    switch (c) {
+      case '\\':
+        if (i + 1 < len && isAsciiPunct(text[i + 1])) {
+          appendToWord(text[++i]);
+          continue;
+        }
+        break;
+      case '`':
+        // A code span runs to the next backtick on the line; a lone backtick is text
+        if (memchr(text + i + 1, '`', len - i - 1)) {
+          inCodeSpan = true;
+          continue;
+        }
+        break;
+      case '*':
+      case '_': {
+        const size_t run = runLength(text, len, i, c);
+        if (applyEmphasis(text, len, i, run)) {
+          i += run - 1;
+          continue;
+        }
+        // Not emphasis: the whole run is text
+        for (size_t j = 0; j < run; j++) {
+          appendToWord(c);
+        }
+        i += run - 1;
+        continue;
+      }
+      case '!':
+        // Image: shown as its alt text
+        if (i + 1 < len && text[i + 1] == '[' && findLinkTextEnd(text, len, i + 2) < len) {
+          i++;
+          continue;
+        }
+        break;
+      case '[':
+        // Link: shown as its text
+        if (findLinkTextEnd(text, len, i + 1) < len) {
+          continue;
+        }
+        break;
+      case ']':
+        if (i + 1 < len && text[i + 1] == '(') {
+          const char* close = static_cast<const char*>(memchr(text + i + 2, ')', len - i - 2));
+          if (close) {
+            i = close - text;
+            continue;
+          }
+        }
+        break;
+      default:
+        break;
+    }
+    appendToWord(c);
+  }
+}
+
+bool MarkdownParser::applyEmphasis(const char* text, const size_t len, const size_t pos, const size_t run) {
+  if (run > 3) {
+    return false;
+  }
+  const char c = text[pos];
+  const char before = pos > 0 ? text[pos - 1] : ' ';
+  const char after = pos + run < len ? text[pos + run] : ' ';
+  // Underscores only delimit emphasis at word boundaries, so snake_case stays as written
+  const bool canOpen = !isSpace(after) && (c == '*' || !isAlnum(before));
+  const bool canClose = !isSpace(before) && (c == '*' || !isAlnum(after));
+
+  bool newBold = bold;
+  bool newItalic = italic;
+  if (run == 3) {
+    if (canClose && bold && italic) {
+      newBold = newItalic = false;
+    } else if (canOpen && !bold && !italic) {
+      newBold = newItalic = true;
+    } else {
+      return false;
+    }
+  } else {
+    bool& flag = run == 2 ? newBold : newItalic;
+    if (canClose && flag) {
+      flag = false;
+    } else if (canOpen && !flag) {
+      flag = true;
+    } else {
+      return false;
+    }
+  }
+
+  // The style changes here, so a word in progress is split and its rest attached to it
+  if (wordLength > 0) {
+    flushWord();
+    nextWordContinues = true;
+  }
+  bold = newBold;
+  italic = newItalic;
+  return true;
+}
+
+void MarkdownParser::appendToWord(const char c) {
+  // Split overlong words, but not inside a UTF-8 sequence
+  if (wordLength >= MAX_WORD_SIZE && (static_cast<uint8_t>(c) & 0xC0) != 0x80) {
+    flushWord();
+    nextWordContinues = true;
+  }
+  if (wordLength < sizeof(wordBuffer)) {
+    wordBuffer[wordLength++] = c;
+  }
+}
+
+void MarkdownParser::flushWord() {
+  if (wordLength == 0 || !currentTextBlock) {
+    wordLength = 0;
+    return;
+  }
+
+  EpdFontFamily::Style fontStyle = EpdFontFamily::REGULAR;
+  if (bold) {
+    fontStyle = static_cast<EpdFontFamily::Style>(fontStyle | EpdFontFamily::BOLD);
+  }
+  if (italic) {
+    fontStyle = static_cast<EpdFontFamily::Style>(fontStyle | EpdFontFamily::ITALIC);
+  }
+  currentTextBlock->addWord(std::string_view(wordBuffer, wordLength), fontStyle, false, nextWordContinues);
+  wordLength = 0;
+  nextWordContinues = false;
+}
+
+void MarkdownParser::streamLayout() {
+  // Lay out long paragraphs as they stream in, as ChapterHtmlSlimParser does, so that a paragraph never has to be
+  // buffered whole
+  if (!currentTextBlock || currentTextBlock->size() < streamLayoutAt) {
+    return;
+  }
+  streamLayoutAt = currentTextBlock->size() + STREAM_LAYOUT_WORDS;
+  const int horizontalInset = currentTextBlock->getBlockStyle().totalHorizontalInset();
+  const uint16_t effectiveWidth =
+      (horizontalInset < viewportWidth) ? static_cast<uint16_t>(viewportWidth - horizontalInset) : viewportWidth;
+  currentTextBlock->layoutAndExtractLines(
+      renderer, fontId, effectiveWidth,
+      [this](const std::shared_ptr<TextBlock>& textBlock) { addLineToPage(textBlock); }, false);
+}
+
+bool MarkdownParser::parseAndBuildPages() {
+  FsFile file;
+  if (!Storage.openFileForRead("MDP", filepath, file)) {
+    return false;
+  }
+  if (popupFn && file.size() >= MIN_SIZE_FOR_POPUP) {
+    popupFn();
+  }
+
+  auto* buffer = static_cast<char*>(malloc(READ_BUFFER_SIZE));
+  auto* line = static_cast<char*>(malloc(MAX_LINE_SIZE));
+  if (!buffer || !line) {
+    LOG_ERR("MDP", "Couldn't allocate memory for buffers");
+    free(buffer);
+    free(line);
+    return false;
+  }
+
+  // Layout still works without it, just measuring every word
+  widthCache.reset(new (std::nothrow) WordWidthCache());
+  if (hyphenationEnabled) {
+    hyphenationCache.reset(new (std::nothrow) HyphenationCache());
+  }
+  emSize = static_cast<float>(renderer.getFontAscenderSize(fontId));
+  heldLine.reserve(MAX_LINE_SIZE);
+
+  const uint32_t startTime = millis();
+  size_t lineLength = 0;
+  bool continuation = false;
+  bool success = true;
+  while (file.available() > 0) {
+    const int read = file.read(buffer, READ_BUFFER_SIZE);
+    if (read <= 0) {
+      LOG_ERR("MDP", "File read error");
+      success = false;
+      break;
+    }
+    for (int i = 0; i < read; i++) {
+      const char c = buffer[i];
+      if (c == '\n') {
+        processLine(line, lineLength, continuation, false);
+        lineLength = 0;
+        continuation = false;
+      } else if (c != '\r') {
+        if (lineLength == MAX_LINE_SIZE) {
+          processLine(line, lineLength, continuation, true);
+          lineLength = 0;
+          continuation = true;
+        }
+        line[lineLength++] = c;
+      }
+    }
+  }
+  free(buffer);
+
+  if (success) {
+    if (lineLength > 0) {
+      processLine(line, lineLength, continuation, false);
+    }
+    releaseHeldLine();
+    endBlock();
+    if (currentPage) {
+      completePageFn(std::move(currentPage));
+    }
+    LOG_DBG("MDP", "Time to parse and build pages: %lu ms", millis() - startTime);
+    if (widthCache) {
+      widthCache->logStats();
+    }
+    if (hyphenationCache) {
+      hyphenationCache->logStats();
+    }
+  }
+  free(line);
+  return success;
+}
+
+void MarkdownParser::addLineToPage(std::shared_ptr<TextBlock> line) {
+  const int lineHeight = renderer.getLineHeight(fontId) * lineCompression;
+
+  if (!currentPage) {
+    currentPage.reset(new Page());
+    currentPageNextY = 0;
+  }
+
+  if (currentPageNextY + lineHeight > viewportHeight) {
+    completePageFn(std::move(currentPage));
+    currentPage.reset(new Page());
+    currentPageNextY = 0;
+  }
+
+  // Apply horizontal left inset (margin + padding) as x position offset
+  const int16_t xOffset = line->getBlockStyle().leftInset();
+  currentPage->elements.push_back(std::make_shared<PageLine>(line, xOffset, currentPageNextY));
+  currentPageNextY += lineHeight;
+}
+
+void MarkdownParser::makePages() {
+  if (!currentPage) {
+    currentPage.reset(new Page());
+    currentPageNextY = 0;
+  }
+
+  const int lineHeight = renderer.getLineHeight(fontId) * lineCompression;
+  // Code lines and table rows are blocks of their own, but are set without paragraph spacing between them
+  const bool verbatim = blockKind == BlockKind::Code || blockKind == BlockKind::Table;
+  if (extraParagraphSpacing && !verbatim && previousBlockVerbatim) {
+    currentPageNextY += lineHeight / 2;
+  }
+  previousBlockVerbatim = verbatim;
+
+  const int horizontalInset = currentTextBlock->getBlockStyle().totalHorizontalInset();
+  const uint16_t effectiveWidth =
+      (horizontalInset < viewportWidth) ? static_cast<uint16_t>(viewportWidth - horizontalInset) : viewportWidth;
+
+  currentTextBlock->layoutAndExtractLines(
+      renderer, fontId, effectiveWidth,
+      [this](const std::shared_ptr<TextBlock>& textBlock) { addLineToPage(textBlock); });
+
+  // Extra paragraph spacing if enabled (default behavior)
+  if (extraParagraphSpacing && !verbatim) {
+    currentPageNextY += lineHeight / 2;
+  }
+}
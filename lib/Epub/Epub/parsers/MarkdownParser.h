@@ -0,0 +1,127 @@
+#pragma once
+
+#include <HalStorage.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "../ParsedText.h"
+#include "../WordWidthCache.h"
+#include "../blocks/TextBlock.h"
+#include "../hyphenation/HyphenationCache.h"
+
+class Page;
+class GfxRenderer;
+
+/**
+ * Streaming Markdown front end for the page layout shared with EPUB chapters.
+ *
+ * The document is read line by line in a single pass and turned straight into ParsedText blocks, with the block
+ * styles ChapterHtmlSlimParser gives the equivalent HTML elements, then laid out into pages. There is no HTML or DOM
+ * step: the only lookahead is one held line, which decides whether a paragraph's first line is a setext heading.
+ *
+ * Supported:
+ *   - ATX (# to ######) and setext (=== / ---) headings
+ *   - Paragraphs, with hard line breaks (two trailing spaces or a backslash)
+ *   - Bullet and numbered lists, nested by indentation
+ *   - Block quotes, nested
+ *   - Fenced (``` / ~~~) and indented code blocks, line by line
+ *   - Thematic breaks, and table rows as one line each
+ *   - Emphasis (* and _), strong emphasis, code spans, backslash escapes, links and images (their text)
+ *
+ * Everything else is shown as text.
+ */
+class MarkdownParser {
+  // Longest line handled as one; the rest of a longer line continues it as if it were a wrapped line
+  static constexpr size_t MAX_LINE_SIZE = 1024;
+  static constexpr size_t MAX_WORD_SIZE = 200;
+
+  enum class BlockKind : uint8_t { None, Paragraph, Heading, ListItem, Code, Table };
+
+  const std::string& filepath;
+  GfxRenderer& renderer;
+  std::function<void(std::unique_ptr<Page>)> completePageFn;
+  std::function<void()> popupFn;
+  int fontId;
+  float lineCompression;
+  bool extraParagraphSpacing;
+  uint8_t paragraphAlignment;
+  uint16_t viewportWidth;
+  uint16_t viewportHeight;
+  bool hyphenationEnabled;
+  float emSize = 0;
+
+  std::unique_ptr<ParsedText> currentTextBlock = nullptr;
+  std::unique_ptr<WordWidthCache> widthCache = nullptr;          // Null if it couldn't be allocated
+  std::unique_ptr<HyphenationCache> hyphenationCache = nullptr;  // Null unless hyphenating, or if allocation failed
+  std::unique_ptr<Page> currentPage = nullptr;
+  int16_t currentPageNextY = 0;
+  size_t streamLayoutAt = 0;  // Block size at which the buffered words are next laid out
+
+  // Block state
+  BlockKind blockKind = BlockKind::None;
+  uint8_t blockQuoteDepth = 0;
+  bool hardBreakPending = false;  // The previous line ended in a hard line break
+  bool previousBlockVerbatim = false;
+  char fenceChar = 0;  // Set while inside a fenced code block
+  size_t fenceLength = 0;
+  uint8_t fenceQuoteDepth = 0;
+  // A line that would start a paragraph is held until the next line shows whether it is a setext heading
+  std::string heldLine;
+  uint8_t heldQuoteDepth = 0;
+  bool hasHeldLine = false;
+
+  // Inline state, reset with each block
+  bool bold = false;
+  bool italic = false;
+  bool inCodeSpan = false;
+  char wordBuffer[MAX_WORD_SIZE + 4] = {};  // Room to finish a UTF-8 sequence past MAX_WORD_SIZE
+  size_t wordLength = 0;
+  bool nextWordContinues = false;
+
+  [[nodiscard]] BlockStyle paragraphBlockStyle(uint8_t quoteDepth) const;
+  [[nodiscard]] BlockStyle headingBlockStyle(uint8_t quoteDepth) const;
+  [[nodiscard]] BlockStyle listItemBlockStyle(uint8_t quoteDepth, size_t level) const;
+  // Left aligned and unindented, for code and table rows
+  [[nodiscard]] BlockStyle verbatimBlockStyle(uint8_t quoteDepth, int16_t indent) const;
+  void startNewTextBlock(BlockKind kind, const BlockStyle& blockStyle, uint8_t quoteDepth);
+  void endBlock();
+  // A truncated line continues in the next call, which then has continuation set
+  void processLine(const char* line, size_t len, bool continuation, bool truncated);
+  void processFencedLine(const char* text, size_t len, bool truncated);
+  void processBlockLine(const char* text, size_t len, uint8_t quoteDepth, bool truncated);
+  void releaseHeldLine();
+  // Adds the text of one line to the current block; literal text has no inline markup or hard line break
+  void addLineText(const char* text, size_t len, bool truncated, bool literal = false);
+  void addInlineText(const char* text, size_t len, bool literal);
+  // Toggles emphasis for the run of `run` * or _ at text[pos]; false if the run is not a delimiter there
+  bool applyEmphasis(const char* text, size_t len, size_t pos, size_t run);
+  void appendToWord(char c);
+  void flushWord();
+  void streamLayout();
+  void makePages();
+  void addLineToPage(std::shared_ptr<TextBlock> line);
+
+ public:
+  explicit MarkdownParser(const std::string& filepath, GfxRenderer& renderer, const int fontId,
+                          const float lineCompression, const bool extraParagraphSpacing,
+                          const uint8_t paragraphAlignment, const uint16_t viewportWidth,
+                          const uint16_t viewportHeight, const bool hyphenationEnabled,
+                          const std::function<void(std::unique_ptr<Page>)>& completePageFn,
+                          const std::function<void()>& popupFn = nullptr)
+      : filepath(filepath),
+        renderer(renderer),
+        completePageFn(completePageFn),
+        popupFn(popupFn),
+        fontId(fontId),
+        lineCompression(lineCompression),
+        extraParagraphSpacing(extraParagraphSpacing),
+        paragraphAlignment(paragraphAlignment),
+        viewportWidth(viewportWidth),
+        viewportHeight(viewportHeight),
+        hyphenationEnabled(hyphenationEnabled) {}
+
+  ~MarkdownParser() = default;
+  bool parseAndBuildPages();
+};
@@ -7,7 +7,7 @@
 #include "../BookMetadataCache.h"
 
 bool TocNcxParser::setup() {
-  parser = XML_ParserCreate(nullptr);
+  parser = createXmlParser();
   if (!parser) {
     LOG_DBG("TOC", "Couldn't allocate memory for parser");
     return false;
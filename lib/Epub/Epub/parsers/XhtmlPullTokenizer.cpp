@@ -0,0 +1,563 @@
+#include "XhtmlPullTokenizer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+namespace {
+// HTML elements without an end tag, empty even when written without the slash
+const char* const VOID_ELEMENTS[] = {"area", "base", "br", "col", "embed", "hr", "img", "input", "link", "meta",
+                                     "param", "source", "track", "wbr"};
+
+// Longest "&name;" taken for a reference: the longest HTML entity name is 31 characters
+constexpr size_t MAX_REFERENCE_LENGTH = 40;
+
+bool isSpace(const char c) { return c == ' ' || c == '\n' || c == '\t' || c == '\r'; }
+
+bool isNameStart(const char c) {
+  const auto b = static_cast<uint8_t>(c);
+  return ((b | 0x20) >= 'a' && (b | 0x20) <= 'z') || c == '_' || c == ':' || b >= 0x80;
+}
+
+bool isVoidElement(const char* name) {
+  return std::any_of(std::begin(VOID_ELEMENTS), std::end(VOID_ELEMENTS),
+                     [name](const char* element) { return strcmp(element, name) == 0; });
+}
+
+// Bytes at the end of text that begin a UTF-8 sequence it cuts short, left for the next chunk so handlers never see a
+// character split in two (expat doesn't split them either)
+size_t incompleteUtf8Tail(const char* text, const size_t len) {
+  for (size_t back = 1; back <= 3 && back <= len; back++) {
+    const auto b = static_cast<uint8_t>(text[len - back]);
+    if ((b & 0xC0) == 0x80) {
+      continue;
+    }
+    const size_t sequence = b >= 0xF0 ? 4 : b >= 0xE0 ? 3 : b >= 0xC0 ? 2 : 1;
+    return sequence > back ? back : 0;
+  }
+  return 0;
+}
+
+size_t encodeUtf8(const uint32_t cp, char* out) {
+  if (cp < 0x80) {
+    out[0] = static_cast<char>(cp);
+    return 1;
+  }
+  if (cp < 0x800) {
+    out[0] = static_cast<char>(0xC0 | (cp >> 6));
+    out[1] = static_cast<char>(0x80 | (cp & 0x3F));
+    return 2;
+  }
+  if (cp < 0x10000) {
+    out[0] = static_cast<char>(0xE0 | (cp >> 12));
+    out[1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+    out[2] = static_cast<char>(0x80 | (cp & 0x3F));
+    return 3;
+  }
+  out[0] = static_cast<char>(0xF0 | (cp >> 18));
+  out[1] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+  out[2] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+  out[3] = static_cast<char>(0x80 | (cp & 0x3F));
+  return 4;
+}
+
+// Decodes a predefined XML entity or a character reference ("&...;" of length len) to UTF-8 in out, which has room for
+// 4 bytes; returns its length, or 0 if ref is neither or stands for no character
+size_t decodeXmlReference(const char* ref, const size_t len, char* out) {
+  static constexpr struct {
+    const char* entity;
+    char value;
+  } PREDEFINED[] = {{"&amp;", '&'}, {"&lt;", '<'}, {"&gt;", '>'}, {"&quot;", '"'}, {"&apos;", '\''}};
+  for (const auto& predefined : PREDEFINED) {
+    if (strlen(predefined.entity) == len && memcmp(predefined.entity, ref, len) == 0) {
+      out[0] = predefined.value;
+      return 1;
+    }
+  }
+
+  if (len < 4 || ref[1] != '#') {
+    return 0;
+  }
+  const bool hex = ref[2] == 'x' || ref[2] == 'X';
+  size_t i = hex ? 3 : 2;
+  if (i >= len - 1) {
+    return 0;
+  }
+  uint32_t cp = 0;
+  for (; i < len - 1; i++) {
+    const char c = ref[i];
+    uint32_t digit;
+    if (c >= '0' && c <= '9') {
+      digit = c - '0';
+    } else if (hex && (c | 0x20) >= 'a' && (c | 0x20) <= 'f') {
+      digit = (c | 0x20) - 'a' + 10;
+    } else {
+      return 0;
+    }
+    cp = cp * (hex ? 16 : 10) + digit;
+    if (cp > 0x10FFFF) {
+      return 0;
+    }
+  }
+  if (cp == 0 || (cp >= 0xD800 && cp <= 0xDFFF)) {
+    return 0;
+  }
+  return encodeUtf8(cp, out);
+}
+}  // namespace
+
+char* XhtmlPullTokenizer::inputBuffer(size_t& capacity) {
+  if (start > 0) {
+    memmove(buffer, buffer + start, fill - start);
+    base += start;
+    fill -= start;
+    start = 0;
+  }
+  capacity = BUFFER_SIZE - fill;
+  return buffer + fill;
+}
+
+void XhtmlPullTokenizer::commitInput(const size_t length, const bool isFinal) {
+  fill += std::min(length, BUFFER_SIZE - fill);
+  final = isFinal;
+}
+
+XhtmlPullTokenizer::Token XhtmlPullTokenizer::next() {
+  if (stopped) {
+    return Token::End;
+  }
+  if (emptyElementOpen) {
+    // The name is still that of the start tag; the offset is just past it, as expat has it
+    emptyElementOpen = false;
+    tokenOffset = base + start;
+    return Token::EndTag;
+  }
+
+  while (true) {
+    tokenOffset = base + start;
+
+    if (mode == Mode::Cdata) {
+      size_t end = start;
+      while (end + 2 < fill && !(buffer[end] == ']' && buffer[end + 1] == ']' && buffer[end + 2] == '>')) {
+        end++;
+      }
+      const bool closed = end + 2 < fill;
+      size_t length;
+      if (closed || final) {
+        length = (closed ? end : fill) - start;
+        mode = Mode::Content;
+      } else {
+        // Up to the last two bytes, which could start the "]]>"
+        length = std::max(end, start) - start;
+        length -= incompleteUtf8Tail(buffer + start, length);
+      }
+      tokenText = buffer + start;
+      tokenTextLength = length;
+      start = closed ? end + 3 : start + length;
+      if (length > 0 && insideRoot()) {
+        return Token::Text;
+      }
+      if (length == 0 && mode == Mode::Cdata) {
+        return Token::NeedInput;
+      }
+      continue;
+    }
+
+    if (mode != Mode::Content) {
+      if (!skipMarkup()) {
+        if (!final) {
+          return Token::NeedInput;
+        }
+        // Left open at the end of the document
+        start = fill;
+        mode = Mode::Content;
+      }
+      continue;
+    }
+
+    if (start == fill) {
+      return final ? closeAtEnd() : Token::NeedInput;
+    }
+
+    if (tokenOffset == 0) {
+      const int bom = startsWith("\xEF\xBB\xBF");
+      if (bom < 0) {
+        return Token::NeedInput;
+      }
+      if (bom > 0) {
+        start += 3;
+        continue;
+      }
+    }
+
+    const char c = buffer[start];
+    if (c != '<') {
+      const Token token = c == '&' ? reference() : textRun();
+      if (token == Token::Text && !insideRoot()) {
+        // Whitespace around the root element, which expat doesn't pass on as text either
+        continue;
+      }
+      return token;
+    }
+
+    if (start + 1 == fill && !final) {
+      return Token::NeedInput;
+    }
+    const char c1 = start + 1 < fill ? buffer[start + 1] : '\0';
+    if (c1 == '!') {
+      int match = startsWith("<!--");
+      if (match < 0) {
+        return Token::NeedInput;
+      }
+      if (match > 0) {
+        start += 4;
+        mode = Mode::Comment;
+        continue;
+      }
+      match = startsWith("<![CDATA[");
+      if (match < 0) {
+        return Token::NeedInput;
+      }
+      start += match > 0 ? 9 : 2;
+      mode = match > 0 ? Mode::Cdata : Mode::Declaration;
+      declarationDepth = 0;
+      continue;
+    }
+    if (c1 == '?') {
+      start += 2;
+      mode = Mode::Instruction;
+      continue;
+    }
+    if (c1 == '/' || isNameStart(c1)) {
+      const size_t tagEnd = findTagEnd();
+      if (tagEnd == 0) {
+        if (final) {
+          // Cut off by the end of the document
+          start = fill;
+        } else if (fill - start >= BUFFER_SIZE) {
+          // Longer than the buffer: dropped
+          start = fill;
+          mode = Mode::SkipTag;
+        } else {
+          return Token::NeedInput;
+        }
+        continue;
+      }
+      if (c1 != '/') {
+        return startTag(tagEnd);
+      }
+      if (endTag(tagEnd)) {
+        return Token::EndTag;
+      }
+      continue;
+    }
+
+    // A '<' that starts no markup is text
+    tokenText = buffer + start;
+    tokenTextLength = 1;
+    start++;
+    if (insideRoot()) {
+      return Token::Text;
+    }
+  }
+}
+
+bool XhtmlPullTokenizer::skipMarkup() {
+  if (mode == Mode::Declaration) {
+    for (size_t i = start; i < fill; i++) {
+      if (buffer[i] == '[') {
+        declarationDepth++;
+      } else if (buffer[i] == ']') {
+        declarationDepth--;
+      } else if (buffer[i] == '>' && declarationDepth <= 0) {
+        start = i + 1;
+        mode = Mode::Content;
+        return true;
+      }
+    }
+    start = fill;
+    return false;
+  }
+
+  const char* terminator = mode == Mode::Comment ? "-->" : mode == Mode::Instruction ? "?>" : ">";
+  const size_t terminatorLength = strlen(terminator);
+  for (size_t i = start + terminatorLength - 1; i < fill; i++) {
+    if (buffer[i] == '>' && memcmp(buffer + i + 1 - terminatorLength, terminator, terminatorLength) == 0) {
+      start = i + 1;
+      mode = Mode::Content;
+      return true;
+    }
+  }
+  // Keeps what could be the start of the terminator
+  if (fill - start >= terminatorLength) {
+    start = fill - (terminatorLength - 1);
+  }
+  return false;
+}
+
+XhtmlPullTokenizer::Token XhtmlPullTokenizer::startTag(const size_t tagEnd) {
+  char* p = buffer + start + 1;
+  char* end = buffer + tagEnd;
+  start = tagEnd + 1;
+  const bool empty = end[-1] == '/';
+  if (empty) {
+    end--;
+  }
+
+  tokenName = p;
+  while (p < end && !isSpace(*p)) {
+    p++;
+  }
+  // Terminators are written over the byte that ends each name and value, at worst the tag's closing '/' or '>'
+  *p = '\0';
+  p = std::min(p + 1, end);
+
+  size_t count = 0;
+  while (true) {
+    while (p < end && isSpace(*p)) {
+      p++;
+    }
+    if (p >= end) {
+      break;
+    }
+    char* const attributeName = p;
+    while (p < end && *p != '=' && !isSpace(*p)) {
+      p++;
+    }
+    char* const attributeNameEnd = p;
+    while (p < end && isSpace(*p)) {
+      p++;
+    }
+
+    const char* value = "";
+    if (p < end && *p == '=') {
+      p++;
+      while (p < end && isSpace(*p)) {
+        p++;
+      }
+      char* valueStart = p;
+      if (p < end && (*p == '"' || *p == '\'')) {
+        const char quote = *p++;
+        valueStart = p;
+        while (p < end && *p != quote) {
+          p++;
+        }
+      } else {
+        while (p < end && !isSpace(*p)) {
+          p++;
+        }
+      }
+      char* const valueEnd = decodeAttribute(valueStart, p);
+      p = std::min(p + 1, end);
+      *valueEnd = '\0';
+      value = valueStart;
+    }
+
+    // Strays such as a '/' before the end or a '=' without a name are no attributes
+    const bool named = attributeNameEnd > attributeName && isNameStart(*attributeName);
+    *attributeNameEnd = '\0';
+    if (named && count < MAX_ATTRIBUTES) {
+      attributeList[2 * count] = attributeName;
+      attributeList[2 * count + 1] = value;
+      count++;
+    }
+  }
+  attributeList[2 * count] = nullptr;
+
+  if (empty || isVoidElement(tokenName)) {
+    emptyElementOpen = true;
+  } else {
+    pushOpen(tokenName);
+  }
+  return Token::StartTag;
+}
+
+bool XhtmlPullTokenizer::endTag(const size_t tagEnd) {
+  char* const endName = buffer + start + 2;
+  char* p = endName;
+  while (p < buffer + tagEnd && !isSpace(*p)) {
+    p++;
+  }
+  const size_t nameLength = p - endName;
+
+  if (untrackedDepth > 0) {
+    untrackedDepth--;
+    *p = '\0';
+    tokenName = endName;
+    start = tagEnd + 1;
+    return true;
+  }
+
+  size_t match = openCount;
+  while (match > 0) {
+    const char* openName = openNames + openStarts[match - 1];
+    if (strncmp(openName, endName, nameLength) == 0 && openName[nameLength] == '\0') {
+      break;
+    }
+    match--;
+  }
+  if (match == 0) {
+    // Closes no open element
+    start = tagEnd + 1;
+    return false;
+  }
+
+  // Closes the innermost open element; the end tag is left to be read again until that is the one it names
+  openCount--;
+  tokenName = openNames + openStarts[openCount];
+  if (openCount == match - 1) {
+    start = tagEnd + 1;
+  }
+  return true;
+}
+
+XhtmlPullTokenizer::Token XhtmlPullTokenizer::reference() {
+  const size_t limit = std::min(fill, start + MAX_REFERENCE_LENGTH);
+  size_t end = start + 1;
+  while (end < limit && buffer[end] != ';' && buffer[end] != '&' && buffer[end] != '<' && !isSpace(buffer[end])) {
+    end++;
+  }
+  if (end == fill && fill < start + MAX_REFERENCE_LENGTH && !final) {
+    // The ';' could still come
+    return Token::NeedInput;
+  }
+
+  tokenText = buffer + start;
+  if (end == limit || buffer[end] != ';') {
+    // A '&' that starts no reference is text
+    tokenTextLength = 1;
+    start++;
+    return Token::Text;
+  }
+
+  const size_t len = end + 1 - start;
+  tokenTextLength = decodeXmlReference(buffer + start, len, scratch);
+  if (tokenTextLength > 0) {
+    tokenText = scratch;
+  } else if (const char* value = lookup ? lookup(buffer + start, len) : nullptr) {
+    tokenText = value;
+    tokenTextLength = strlen(value);
+  } else {
+    // Unknown: kept as written
+    tokenTextLength = len;
+  }
+  start = end + 1;
+  return Token::Text;
+}
+
+XhtmlPullTokenizer::Token XhtmlPullTokenizer::textRun() {
+  size_t end = start;
+  while (end < fill && buffer[end] != '<' && buffer[end] != '&') {
+    end++;
+  }
+  size_t length = end - start;
+  if (end == fill && !final) {
+    length -= incompleteUtf8Tail(buffer + start, length);
+    if (length == 0) {
+      return Token::NeedInput;
+    }
+  }
+  tokenText = buffer + start;
+  tokenTextLength = length;
+  start += length;
+  return Token::Text;
+}
+
+XhtmlPullTokenizer::Token XhtmlPullTokenizer::closeAtEnd() {
+  if (openCount == 0) {
+    return Token::End;
+  }
+  openCount--;
+  tokenName = openNames + openStarts[openCount];
+  return Token::EndTag;
+}
+
+void XhtmlPullTokenizer::pushOpen(const char* elementName) {
+  const size_t namesEnd =
+      openCount > 0 ? openStarts[openCount - 1] + strlen(openNames + openStarts[openCount - 1]) + 1 : 0;
+  const size_t nameSize = strlen(elementName) + 1;
+  if (untrackedDepth > 0 || openCount == MAX_OPEN_ELEMENTS || namesEnd + nameSize > OPEN_NAMES_SIZE) {
+    untrackedDepth++;
+    return;
+  }
+  memcpy(openNames + namesEnd, elementName, nameSize);
+  openStarts[openCount++] = static_cast<uint16_t>(namesEnd);
+}
+
+int XhtmlPullTokenizer::startsWith(const char* literal) const {
+  for (size_t i = 0; literal[i] != '\0'; i++) {
+    if (start + i == fill) {
+      return final ? 0 : -1;
+    }
+    if (buffer[start + i] != literal[i]) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+size_t XhtmlPullTokenizer::findTagEnd() const {
+  const bool isEndTag = buffer[start + 1] == '/';
+  char quote = '\0';
+  bool afterEquals = false;
+  for (size_t i = start + 1; i < fill; i++) {
+    const char c = buffer[i];
+    if (quote != '\0') {
+      if (c == quote) {
+        quote = '\0';
+      }
+    } else if (c == '>') {
+      return i;
+    } else if (isEndTag) {
+      continue;
+    } else if ((c == '"' || c == '\'') && afterEquals) {
+      // Only a quote opening a value quotes, so a stray apostrophe doesn't swallow the rest of the chapter
+      quote = c;
+      afterEquals = false;
+    } else if (c == '=') {
+      afterEquals = true;
+    } else if (!isSpace(c)) {
+      afterEquals = false;
+    }
+  }
+  return 0;
+}
+
+char* XhtmlPullTokenizer::decodeAttribute(char* value, char* valueEnd) const {
+  char* out = value;
+  char* in = value;
+  while (in < valueEnd) {
+    if (isSpace(*in)) {
+      // A line break, CRLF included, is one space
+      in += *in == '\r' && in + 1 < valueEnd && in[1] == '\n' ? 2 : 1;
+      *out++ = ' ';
+      continue;
+    }
+    if (*in == '&') {
+      const char* semicolon = in + 1;
+      while (semicolon < valueEnd && semicolon < in + MAX_REFERENCE_LENGTH && *semicolon != ';' &&
+             *semicolon != '&') {
+        semicolon++;
+      }
+      if (semicolon < valueEnd && *semicolon == ';') {
+        const size_t len = semicolon + 1 - in;
+        char decoded[4];
+        const char* expansion = decoded;
+        size_t expansionLength = decodeXmlReference(in, len, decoded);
+        if (expansionLength == 0 && lookup) {
+          expansion = lookup(in, len);
+          expansionLength = expansion ? strlen(expansion) : 0;
+        }
+        // Decoded in place, so only what's no longer than the reference; the rest is kept as written
+        if (expansionLength > 0 && expansionLength <= len) {
+          memcpy(out, expansion, expansionLength);
+          out += expansionLength;
+          in += len;
+          continue;
+        }
+      }
+    }
+    *out++ = *in++;
+  }
+  return out;
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * A pull tokenizer for the XHTML of EPUB chapters, as an alternative to expat for ChapterHtmlSlimParser (built with
+ * XHTML_PULL_TOKENIZER). It knows only what chapters use: start, end and empty-element tags with their attributes,
+ * text, CDATA sections, and character and entity references. Comments, processing instructions and the DOCTYPE are
+ * skipped; nothing is validated.
+ *
+ * The input goes into a fixed buffer inside the tokenizer, a chunk at a time (inputBuffer(), then commitInput()), and
+ * next() returns the tokens it holds until it needs more. Tokens are views into that buffer: names and attribute
+ * values are NUL-terminated in place, with references decoded and whitespace normalized as XML does, so attributes()
+ * hands them over in the name, value, ..., nullptr form expat's handlers take. Nothing is allocated.
+ *
+ * Malformed markup is recovered from rather than failing the chapter: an end tag closes the elements left open inside
+ * the one it names and is dropped if that one isn't open, HTML void elements (<br>, <img>, ...) are empty without the
+ * slash, elements still open at the end are closed, a stray '<' or '&' is text, and a tag longer than the buffer is
+ * dropped.
+ */
+class XhtmlPullTokenizer {
+ public:
+  static constexpr size_t BUFFER_SIZE = 4096;   // Also the longest tag kept
+  static constexpr size_t MAX_ATTRIBUTES = 16;  // Further attributes of a tag are dropped
+  // Open elements tracked to match end tags with; deeper ones are passed through unchecked
+  static constexpr size_t MAX_OPEN_ELEMENTS = 48;
+  static constexpr size_t OPEN_NAMES_SIZE = 512;
+
+  enum class Token : uint8_t { NeedInput, StartTag, EndTag, Text, End };
+
+  // "&name;" (with '&' and ';') to its UTF-8 value, or nullptr if unknown; the predefined XML entities and character
+  // references are decoded without it
+  using EntityLookup = const char* (*)(const char* entity, size_t len);
+
+  explicit XhtmlPullTokenizer(EntityLookup lookup = nullptr) : lookup(lookup) {}
+
+  // Where the next chunk of input goes, with room for capacity bytes (never 0). Invalidates the current token.
+  char* inputBuffer(size_t& capacity);
+  // Takes length bytes written to inputBuffer(); final once the document has no more
+  void commitInput(size_t length, bool final);
+
+  // The next token, NeedInput once the buffered input is used up, End after the final input or stop()
+  Token next();
+  // Stops tokenizing: next() returns End from now on
+  void stop() { stopped = true; }
+
+  // The current token, valid until the next call of next() or inputBuffer()
+  const char* name() const { return tokenName; }       // StartTag, EndTag
+  const char** attributes() { return attributeList; }  // StartTag
+  const char* text() const { return tokenText; }       // Text, not NUL-terminated
+  size_t textLength() const { return tokenTextLength; }
+  // Document byte offset of the token, as XML_GetCurrentByteIndex gives it in expat's handlers: the '<' of a tag, the
+  // first byte of a text run, and for the EndTag of an empty element the byte after its tag. Elements closed by
+  // recovery take that of the end tag or the end of the document that closed them.
+  uint32_t offset() const { return tokenOffset; }
+
+ private:
+  enum class Mode : uint8_t { Content, Comment, Cdata, Instruction, Declaration, SkipTag };
+
+  EntityLookup lookup;
+  char buffer[BUFFER_SIZE + 1] = {};
+  size_t start = 0;   // Next byte to tokenize
+  size_t fill = 0;    // End of the input held
+  uint32_t base = 0;  // Document offset of buffer[0]
+  bool final = false;
+  bool stopped = false;
+  Mode mode = Mode::Content;
+  int declarationDepth = 0;  // '[' nesting of a DOCTYPE's internal subset
+
+  const char* tokenName = nullptr;
+  const char* attributeList[2 * MAX_ATTRIBUTES + 1] = {};
+  const char* tokenText = nullptr;
+  size_t tokenTextLength = 0;
+  uint32_t tokenOffset = 0;
+  char scratch[4] = {};           // A reference in text decoded to UTF-8
+  bool emptyElementOpen = false;  // The StartTag just returned still needs its EndTag
+
+  // Names of the open elements back to back, innermost last
+  char openNames[OPEN_NAMES_SIZE] = {};
+  uint16_t openStarts[MAX_OPEN_ELEMENTS] = {};
+  size_t openCount = 0;
+  size_t untrackedDepth = 0;  // Open elements past the tracked ones
+
+  // Skips the markup that's no token; false if it needs more input
+  bool skipMarkup();
+  bool insideRoot() const { return openCount > 0 || untrackedDepth > 0; }
+  Token startTag(size_t tagEnd);
+  // False if the end tag closes nothing and was dropped
+  bool endTag(size_t tagEnd);
+  Token reference();
+  Token textRun();
+  Token closeAtEnd();
+  void pushOpen(const char* elementName);
+  // 1 if the buffered input at start begins with literal, 0 if not, -1 if it's too short to tell yet
+  int startsWith(const char* literal) const;
+  // Index of the '>' ending the tag at start, or 0 if it isn't buffered yet
+  size_t findTagEnd() const;
+  // Decodes references and normalizes whitespace in [value, valueEnd) in place; returns the new end
+  char* decodeAttribute(char* value, char* valueEnd) const;
+};
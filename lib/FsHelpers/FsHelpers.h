@@ -43,6 +43,12 @@ inline bool hasEpubExtension(const String& fileName) {
   return hasEpubExtension(std::string_view{fileName.c_str(), fileName.length()});
 }
 
+// Check for .fb2 extension (case-insensitive)
+bool hasFb2Extension(std::string_view fileName);
+inline bool hasFb2Extension(const String& fileName) {
+  return hasFb2Extension(std::string_view{fileName.c_str(), fileName.length()});
+}
+
 // Check for either .xtc or .xtch extension (case-insensitive)
 bool hasXtcExtension(std::string_view fileName);
 
@@ -55,6 +61,9 @@ inline bool hasTxtExtension(const String& fileName) {
 // Check for .md extension (case-insensitive)
 bool hasMarkdownExtension(std::string_view fileName);
 
+// Check for .cbz extension (case-insensitive)
+bool hasCbzExtension(std::string_view fileName);
+
 std::string extractFolderPath(const std::string& filePath);
 
 }  // namespace FsHelpers
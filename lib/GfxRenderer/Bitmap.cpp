@@ -293,3 +293,17 @@ BmpReaderError Bitmap::rewindToData() const {
 
   return BmpReaderError::Ok;
 }
+
+BmpReaderError Bitmap::seekToRow(const int y) const {
+  const int fileRow = topDown ? y : height - 1 - y;
+  if (y < 0 || y >= height || !file.seek(bfOffBits + static_cast<uint32_t>(fileRow) * rowBytes)) {
+    return BmpReaderError::SeekPixelDataFailed;
+  }
+
+  // The error carried between rows belongs to the rows above, which were not read
+  prevRowY = fileRow - 1;
+  if (fsDitherer) fsDitherer->reset();
+  if (atkinsonDitherer) atkinsonDitherer->reset();
+
+  return BmpReaderError::Ok;
+}
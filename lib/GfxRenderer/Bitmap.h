@@ -69,6 +69,10 @@ class Bitmap {
   BmpReaderError parseHeaders();
   BmpReaderError readNextRow(uint8_t* data, uint8_t* rowBuffer) const;
   BmpReaderError rewindToData() const;
+  // Positions the reader at row y counted from the top of the image, whatever the row order of the file; as rows
+  // are a fixed size apart this is a single seek. readNextRow() then goes on in file order: down the image for a
+  // top-down file, up it otherwise.
+  BmpReaderError seekToRow(int y) const;
   int getWidth() const { return width; }
   int getHeight() const { return height; }
   bool isTopDown() const { return topDown; }
@@ -1,7 +1,9 @@
 #include "BitmapHelpers.h"
 
+#include <atomic>
 #include <cstdint>
 #include <cstring>  // Added for memset
+#include <new>
 
 #include "Bitmap.h"
 
@@ -52,6 +54,55 @@ int adjustPixel(int gray) {
 
   return gray;
 }
+
+namespace {
+// The error rows of a portrait-wide Atkinson ditherer; a larger block goes back to the heap
+constexpr size_t MAX_CACHED_SCRATCH = 3 * (480 + 4);
+
+struct ScratchBlock {
+  size_t capacity;  // int16_t values after the header
+};
+std::atomic<ScratchBlock*> cachedScratch{nullptr};
+}  // namespace
+
+int16_t* DitherScratch::acquire(const size_t count) {
+  ScratchBlock* block = cachedScratch.exchange(nullptr);
+  if (block && block->capacity < count) {
+    ::operator delete(block);
+    block = nullptr;
+  }
+  if (!block) {
+    // Out of memory ends here, as new int16_t[] did
+    block = static_cast<ScratchBlock*>(::operator new(sizeof(ScratchBlock) + count * sizeof(int16_t)));
+    block->capacity = count;
+  }
+  int16_t* rows = reinterpret_cast<int16_t*>(block + 1);
+  memset(rows, 0, count * sizeof(int16_t));
+  return rows;
+}
+
+void DitherScratch::release(int16_t* rows) {
+  if (!rows) return;
+  ScratchBlock* block = reinterpret_cast<ScratchBlock*>(rows) - 1;
+  ScratchBlock* expected = nullptr;
+  if (block->capacity > MAX_CACHED_SCRATCH || !cachedScratch.compare_exchange_strong(expected, block)) {
+    ::operator delete(block);
+  }
+}
+
+// Thresholds 30/50/140
+const uint8_t ditherLevelOf[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+const uint8_t ditherLevelGray[4] = {15, 30, 80, 210};
+
 // Simple quantization without dithering - divide into 4 levels
 // The thresholds are fine-tuned to the X4 display
 uint8_t quantizeSimple(int gray) {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 
@@ -16,6 +17,23 @@ enum class BmpRowOrder { BottomUp, TopDown };
 // Populates a 1-bit BMP header in the provided memory.
 void createBmpHeader(BmpHeader* bmpHeader, int width, int height, BmpRowOrder rowOrder);
 
+// Error rows of the ditherers below. A row of thumbnails (or a page of images) makes one ditherer after another, so the
+// last block given back is kept for the next one instead of going through the heap every time. acquire() returns count
+// zeroed values.
+namespace DitherScratch {
+int16_t* acquire(size_t count);
+void release(int16_t* rows);
+}  // namespace DitherScratch
+
+// Level (0-3) of each gray value and the gray the display shows for each level, fine-tuned to the X4 e-ink display.
+// The original thresholds were 43/128/213 for the values 0/85/170/255.
+extern const uint8_t ditherLevelOf[256];
+extern const uint8_t ditherLevelGray[4];
+
+// The ditherers take every pixel of a row from left to right, then nextRow(). The error a pixel gives its right
+// neighbours and the row below is carried in locals from one pixel to the next, so each pixel reads one error and
+// writes each of the rows below once.
+
 // 1-bit Atkinson dithering - better quality than noise dithering for thumbnails
 // Error distribution pattern (same as 2-bit but quantizes to 2 levels):
 //     X  1/8 1/8
@@ -23,17 +41,13 @@ void createBmpHeader(BmpHeader* bmpHeader, int width, int height, BmpRowOrder ro
 //     1/8
 class Atkinson1BitDitherer {
  public:
-  explicit Atkinson1BitDitherer(int width) : width(width) {
-    errorRow0 = new int16_t[width + 4]();  // Current row
-    errorRow1 = new int16_t[width + 4]();  // Next row
-    errorRow2 = new int16_t[width + 4]();  // Row after next
+  explicit Atkinson1BitDitherer(int width) : width(width), rows(DitherScratch::acquire(3 * (width + 4))) {
+    errorRow0 = rows;                    // Current row
+    errorRow1 = rows + (width + 4);      // Next row
+    errorRow2 = rows + 2 * (width + 4);  // Row after next
   }
 
-  ~Atkinson1BitDitherer() {
-    delete[] errorRow0;
-    delete[] errorRow1;
-    delete[] errorRow2;
-  }
+  ~Atkinson1BitDitherer() { DitherScratch::release(rows); }
 
   // EXPLICITLY DELETE THE COPY CONSTRUCTOR
   Atkinson1BitDitherer(const Atkinson1BitDitherer& other) = delete;
@@ -45,55 +59,49 @@ class Atkinson1BitDitherer {
     // Apply brightness/contrast/gamma adjustments
     gray = adjustPixel(gray);
 
-    // Add accumulated error
-    int adjusted = gray + errorRow0[x + 2];
+    // Add accumulated error: the rows above, then the two pixels to the left
+    int adjusted = gray + errorRow0[x + 2] + error1 + error2;
     if (adjusted < 0) adjusted = 0;
     if (adjusted > 255) adjusted = 255;
 
     // Quantize to 2 levels (1-bit): 0 = black, 1 = white
-    uint8_t quantized;
-    int quantizedValue;
-    if (adjusted < 128) {
-      quantized = 0;
-      quantizedValue = 0;
-    } else {
-      quantized = 1;
-      quantizedValue = 255;
-    }
+    const uint8_t quantized = adjusted >> 7;
+    const int quantizedValue = quantized ? 255 : 0;
 
     // Calculate error (only distribute 6/8 = 75%)
-    int error = (adjusted - quantizedValue) >> 3;  // error/8
+    const int error = (adjusted - quantizedValue) >> 3;  // error/8
 
-    // Distribute 1/8 to each of 6 neighbors
-    errorRow0[x + 3] += error;  // Right
-    errorRow0[x + 4] += error;  // Right+1
-    errorRow1[x + 1] += error;  // Bottom-left
-    errorRow1[x + 2] += error;  // Bottom
-    errorRow1[x + 3] += error;  // Bottom-right
-    errorRow2[x + 2] += error;  // Two rows down
+    // Bottom-left of this pixel is complete: bottom-right of x-2, bottom of x-1, bottom-left of x
+    errorRow1[x + 1] += error2 + error1 + error;
+    errorRow2[x + 2] = error;  // Two rows down, only this pixel reaches it
+    error2 = error1;
+    error1 = error;
 
     return quantized;
   }
 
   void nextRow() {
+    errorRow1[width + 1] += error2 + error1;  // Below the last pixel, which has no right neighbour
+    error1 = error2 = 0;
     int16_t* temp = errorRow0;
     errorRow0 = errorRow1;
     errorRow1 = errorRow2;
     errorRow2 = temp;
-    memset(errorRow2, 0, (width + 4) * sizeof(int16_t));
   }
 
   void reset() {
-    memset(errorRow0, 0, (width + 4) * sizeof(int16_t));
-    memset(errorRow1, 0, (width + 4) * sizeof(int16_t));
-    memset(errorRow2, 0, (width + 4) * sizeof(int16_t));
+    memset(rows, 0, 3 * (width + 4) * sizeof(int16_t));
+    error1 = error2 = 0;
   }
 
  private:
   int width;
+  int16_t* rows;
   int16_t* errorRow0;
   int16_t* errorRow1;
   int16_t* errorRow2;
+  int error1 = 0;  // Error of the pixel to the left
+  int error2 = 0;  // Error of the pixel before that
 };
 
 // Atkinson dithering - distributes only 6/8 (75%) of error for cleaner results
@@ -104,17 +112,13 @@ class Atkinson1BitDitherer {
 // Less error buildup = fewer artifacts than Floyd-Steinberg
 class AtkinsonDitherer {
  public:
-  explicit AtkinsonDitherer(int width) : width(width) {
-    errorRow0 = new int16_t[width + 4]();  // Current row
-    errorRow1 = new int16_t[width + 4]();  // Next row
-    errorRow2 = new int16_t[width + 4]();  // Row after next
+  explicit AtkinsonDitherer(int width) : width(width), rows(DitherScratch::acquire(3 * (width + 4))) {
+    errorRow0 = rows;                    // Current row
+    errorRow1 = rows + (width + 4);      // Next row
+    errorRow2 = rows + 2 * (width + 4);  // Row after next
   }
 
-  ~AtkinsonDitherer() {
-    delete[] errorRow0;
-    delete[] errorRow1;
-    delete[] errorRow2;
-  }
+  ~AtkinsonDitherer() { DitherScratch::release(rows); }
   // **1. EXPLICITLY DELETE THE COPY CONSTRUCTOR**
   AtkinsonDitherer(const AtkinsonDitherer& other) = delete;
 
@@ -122,77 +126,49 @@ class AtkinsonDitherer {
   AtkinsonDitherer& operator=(const AtkinsonDitherer& other) = delete;
 
   uint8_t processPixel(int gray, int x) {
-    // Add accumulated error
-    int adjusted = gray + errorRow0[x + 2];
+    // Add accumulated error: the rows above, then the two pixels to the left
+    int adjusted = gray + errorRow0[x + 2] + error1 + error2;
     if (adjusted < 0) adjusted = 0;
     if (adjusted > 255) adjusted = 255;
 
     // Quantize to 4 levels
-    uint8_t quantized;
-    int quantizedValue;
-    if (false) {  // original thresholds
-      if (adjusted < 43) {
-        quantized = 0;
-        quantizedValue = 0;
-      } else if (adjusted < 128) {
-        quantized = 1;
-        quantizedValue = 85;
-      } else if (adjusted < 213) {
-        quantized = 2;
-        quantizedValue = 170;
-      } else {
-        quantized = 3;
-        quantizedValue = 255;
-      }
-    } else {  // fine-tuned to X4 eink display
-      if (adjusted < 30) {
-        quantized = 0;
-        quantizedValue = 15;
-      } else if (adjusted < 50) {
-        quantized = 1;
-        quantizedValue = 30;
-      } else if (adjusted < 140) {
-        quantized = 2;
-        quantizedValue = 80;
-      } else {
-        quantized = 3;
-        quantizedValue = 210;
-      }
-    }
+    const uint8_t quantized = ditherLevelOf[adjusted];
+    const int quantizedValue = ditherLevelGray[quantized];
 
     // Calculate error (only distribute 6/8 = 75%)
-    int error = (adjusted - quantizedValue) >> 3;  // error/8
+    const int error = (adjusted - quantizedValue) >> 3;  // error/8
 
-    // Distribute 1/8 to each of 6 neighbors
-    errorRow0[x + 3] += error;  // Right
-    errorRow0[x + 4] += error;  // Right+1
-    errorRow1[x + 1] += error;  // Bottom-left
-    errorRow1[x + 2] += error;  // Bottom
-    errorRow1[x + 3] += error;  // Bottom-right
-    errorRow2[x + 2] += error;  // Two rows down
+    // Bottom-left of this pixel is complete: bottom-right of x-2, bottom of x-1, bottom-left of x
+    errorRow1[x + 1] += error2 + error1 + error;
+    errorRow2[x + 2] = error;  // Two rows down, only this pixel reaches it
+    error2 = error1;
+    error1 = error;
 
     return quantized;
   }
 
   void nextRow() {
+    errorRow1[width + 1] += error2 + error1;  // Below the last pixel, which has no right neighbour
+    error1 = error2 = 0;
     int16_t* temp = errorRow0;
     errorRow0 = errorRow1;
     errorRow1 = errorRow2;
     errorRow2 = temp;
-    memset(errorRow2, 0, (width + 4) * sizeof(int16_t));
   }
 
   void reset() {
-    memset(errorRow0, 0, (width + 4) * sizeof(int16_t));
-    memset(errorRow1, 0, (width + 4) * sizeof(int16_t));
-    memset(errorRow2, 0, (width + 4) * sizeof(int16_t));
+    memset(rows, 0, 3 * (width + 4) * sizeof(int16_t));
+    error1 = error2 = 0;
   }
 
  private:
   int width;
+  int16_t* rows;
   int16_t* errorRow0;
   int16_t* errorRow1;
   int16_t* errorRow2;
+  int error1 = 0;  // Error of the pixel to the left
+  int error2 = 0;  // Error of the pixel before that
 };
 
 // Floyd-Steinberg error diffusion dithering with serpentine scanning
@@ -205,15 +181,13 @@ class AtkinsonDitherer {
 //      7/16  X
 class FloydSteinbergDitherer {
  public:
-  explicit FloydSteinbergDitherer(int width) : width(width), rowCount(0) {
-    errorCurRow = new int16_t[width + 2]();  // +2 for boundary handling
-    errorNextRow = new int16_t[width + 2]();
+  explicit FloydSteinbergDitherer(int width)
+      : width(width), rowCount(0), rows(DitherScratch::acquire(2 * (width + 2))) {
+    errorCurRow = rows;  // +2 for boundary handling
+    errorNextRow = rows + (width + 2);
   }
 
-  ~FloydSteinbergDitherer() {
-    delete[] errorCurRow;
-    delete[] errorNextRow;
-  }
+  ~FloydSteinbergDitherer() { DitherScratch::release(rows); }
 
   // **1. EXPLICITLY DELETE THE COPY CONSTRUCTOR**
   FloydSteinbergDitherer(const FloydSteinbergDitherer& other) = delete;
@@ -225,82 +199,42 @@ class FloydSteinbergDitherer {
   // x is the logical x position (0 to width-1), direction handled internally
   uint8_t processPixel(int gray, int x) {
     // Add accumulated error to this pixel
-    int adjusted = gray + errorCurRow[x + 1];
+    int adjusted = gray + errorCurRow[x + 1] + errorRight;
 
     // Clamp to valid range
     if (adjusted < 0) adjusted = 0;
     if (adjusted > 255) adjusted = 255;
 
-    // Quantize to 4 levels (0, 85, 170, 255)
-    uint8_t quantized;
-    int quantizedValue;
-    if (false) {  // original thresholds
-      if (adjusted < 43) {
-        quantized = 0;
-        quantizedValue = 0;
-      } else if (adjusted < 128) {
-        quantized = 1;
-        quantizedValue = 85;
-      } else if (adjusted < 213) {
-        quantized = 2;
-        quantizedValue = 170;
-      } else {
-        quantized = 3;
-        quantizedValue = 255;
-      }
-    } else {  // fine-tuned to X4 eink display
-      if (adjusted < 30) {
-        quantized = 0;
-        quantizedValue = 15;
-      } else if (adjusted < 50) {
-        quantized = 1;
-        quantizedValue = 30;
-      } else if (adjusted < 140) {
-        quantized = 2;
-        quantizedValue = 80;
-      } else {
-        quantized = 3;
-        quantizedValue = 210;
-      }
-    }
+    // Quantize to 4 levels
+    const uint8_t quantized = ditherLevelOf[adjusted];
 
     // Calculate error
-    int error = adjusted - quantizedValue;
-
-    // Distribute error to neighbors (serpentine: direction-aware)
-    if (!isReverseRow()) {
-      // Left to right: standard distribution
-      // Right: 7/16
-      errorCurRow[x + 2] += (error * 7) >> 4;
-      // Bottom-left: 3/16
-      errorNextRow[x] += (error * 3) >> 4;
-      // Bottom: 5/16
-      errorNextRow[x + 1] += (error * 5) >> 4;
-      // Bottom-right: 1/16
-      errorNextRow[x + 2] += (error) >> 4;
-    } else {
-      // Right to left: mirrored distribution
-      // Left: 7/16
-      errorCurRow[x] += (error * 7) >> 4;
-      // Bottom-right: 3/16
-      errorNextRow[x + 2] += (error * 3) >> 4;
-      // Bottom: 5/16
-      errorNextRow[x + 1] += (error * 5) >> 4;
-      // Bottom-left: 1/16
-      errorNextRow[x] += (error) >> 4;
-    }
+    const int error = adjusted - ditherLevelGray[quantized];
+
+    // Distribute error to neighbors (serpentine: direction-aware). The left neighbour of a reversed row is already
+    // quantized, so its 7/16 goes nowhere.
+    const int error7 = (error * 7) >> 4;
+    const int error5 = (error * 5) >> 4;
+    const int error3 = (error * 3) >> 4;
+    const int error1 = error >> 4;
+    const bool reverse = isReverseRow();
+    errorRight = reverse ? 0 : error7;
+    // Below the left neighbour is complete now; the row below is written once per pixel, not added to
+    errorNextRow[x] = pendingLeft + (reverse ? error1 : error3);
+    pendingLeft = pendingBelow + error5;
+    pendingBelow = reverse ? error3 : error1;
 
     return quantized;
   }
 
   // Call at the end of each row to swap buffers
   void nextRow() {
-    // Swap buffers
+    errorNextRow[width] = pendingLeft;  // Below the last pixel
+    errorRight = pendingLeft = pendingBelow = 0;
+    // Swap buffers; every value of the row below is written before it's read
     int16_t* temp = errorCurRow;
     errorCurRow = errorNextRow;
     errorNextRow = temp;
-    // Clear the next row buffer
-    memset(errorNextRow, 0, (width + 2) * sizeof(int16_t));
     rowCount++;
   }
 
@@ -309,14 +243,18 @@ class FloydSteinbergDitherer {
 
   // Reset for a new image or MCU block
   void reset() {
-    memset(errorCurRow, 0, (width + 2) * sizeof(int16_t));
-    memset(errorNextRow, 0, (width + 2) * sizeof(int16_t));
+    memset(rows, 0, 2 * (width + 2) * sizeof(int16_t));
+    errorRight = pendingLeft = pendingBelow = 0;
     rowCount = 0;
   }
 
  private:
   int width;
   int rowCount;
+  int16_t* rows;
   int16_t* errorCurRow;
   int16_t* errorNextRow;
+  int errorRight = 0;    // Error carried to the right neighbour
+  int pendingLeft = 0;   // Error below the pixel to the left, from it and the one before
+  int pendingBelow = 0;  // Error below this pixel, from the one to the left
 };
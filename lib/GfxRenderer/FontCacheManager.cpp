@@ -1,11 +1,15 @@
 #include "FontCacheManager.h"
 
 #include <FontDecompressor.h>
+#include <GfxRenderer.h>
 #include <Logging.h>
+#include <Utf8.h>
 
+#include <algorithm>
+#include <cstdlib>
 #include <cstring>
 
-FontCacheManager::FontCacheManager(const std::map<int, EpdFontFamily>& fontMap) : fontMap_(fontMap) {}
+FontCacheManager::FontCacheManager(const FontTable& fontMap) : fontMap_(fontMap) {}
 
 void FontCacheManager::setFontDecompressor(FontDecompressor* d) { fontDecompressor_ = d; }
 
@@ -13,13 +17,18 @@ void FontCacheManager::clearCache() {
   if (fontDecompressor_) fontDecompressor_->clearCache();
 }
 
+void FontCacheManager::releaseMemory() {
+  if (fontDecompressor_) fontDecompressor_->releaseGroupCache();
+}
+
 void FontCacheManager::prewarmCache(int fontId, const char* utf8Text, uint8_t styleMask) {
-  if (!fontDecompressor_ || fontMap_.count(fontId) == 0) return;
+  const EpdFontFamily* font = fontMap_.find(fontId);
+  if (!fontDecompressor_ || !font) return;
 
   for (uint8_t i = 0; i < 4; i++) {
     if (!(styleMask & (1 << i))) continue;
     auto style = static_cast<EpdFontFamily::Style>(i);
-    const EpdFontData* data = fontMap_.at(fontId).getData(style);
+    const EpdFontData* data = font->getData(style);
     if (!data || !data->groups) continue;
     int missed = fontDecompressor_->prewarmCache(data, utf8Text);
     if (missed > 0) {
@@ -38,17 +47,78 @@ void FontCacheManager::resetStats() {
 
 bool FontCacheManager::isScanning() const { return scanMode_ == ScanMode::Scanning; }
 
+int FontCacheManager::scanSlot(const int fontId, const EpdFontFamily::Style style) {
+  if (!scanGlyphs_) return -1;
+  const EpdFontFamily* font = fontMap_.find(fontId);
+  if (!font) return -1;
+  const auto baseStyle = static_cast<EpdFontFamily::Style>(static_cast<uint8_t>(style) & 0x03);
+  const EpdFontData* data = font->getData(baseStyle);
+  if (!data || !data->groups) return -1;  // Uncompressed, nothing to prewarm
+
+  // Styles a family has no face for share the data of another, and with it the slot
+  uint8_t slot = 0;
+  while (slot < scanFontCount_ && scanFonts_[slot] != data) slot++;
+  if (slot == scanFontCount_) {
+    if (scanFontCount_ == MAX_SCAN_FONTS) return -1;
+    scanFonts_[scanFontCount_++] = data;
+  }
+  return slot;
+}
+
 void FontCacheManager::recordText(const char* text, int fontId, EpdFontFamily::Style style) {
-  scanText_ += text;
-  if (scanFontId_ < 0) scanFontId_ = fontId;
-  const uint8_t baseStyle = static_cast<uint8_t>(style) & 0x03;
-  const unsigned char* p = reinterpret_cast<const unsigned char*>(text);
-  uint32_t cpCount = 0;
-  while (*p) {
-    if ((*p & 0xC0) != 0x80) cpCount++;
-    p++;
+  const int slot = scanSlot(fontId, style);
+  if (slot < 0) return;
+  const EpdFontData* data = scanFonts_[slot];
+  size_t length = strlen(text);
+  uint32_t codepoints[32];
+  while (length > 0) {
+    size_t consumed;
+    const size_t count = utf8DecodeCodepoints(text, length, codepoints, 32, &consumed);
+    if (count == 0) break;
+    for (size_t i = 0; i < count; i++) {
+      const int32_t glyphIndex = FontDecompressor::findGlyphIndex(data, codepoints[i]);
+      if (glyphIndex < 0) continue;
+      addScanGlyph(static_cast<uint32_t>(slot) << SCAN_SLOT_SHIFT | static_cast<uint32_t>(glyphIndex));
+    }
+    text += consumed;
+    length -= consumed;
   }
-  scanStyleCounts_[baseStyle] += cpCount;
+}
+
+void FontCacheManager::recordGlyphs(const uint8_t* placedGlyphs, const uint16_t count, const int fontId,
+                                    const EpdFontFamily::Style style) {
+  const int slot = scanSlot(fontId, style);
+  if (slot < 0) return;
+  for (uint16_t i = 0; i < count; i++) {
+    PlacedGlyph glyph;
+    memcpy(&glyph, placedGlyphs + i * sizeof(PlacedGlyph), sizeof(glyph));
+    addScanGlyph(static_cast<uint32_t>(slot) << SCAN_SLOT_SHIFT | glyph.glyphIndex);
+  }
+}
+
+void FontCacheManager::addScanGlyph(const uint32_t key) {
+  uint32_t* const end = scanGlyphs_ + scanGlyphCount_;
+  uint32_t* const at = std::lower_bound(scanGlyphs_, end, key);
+  if (at != end && *at == key) return;
+  if (scanGlyphCount_ == MAX_SCAN_GLYPHS) {
+    if (!scanCapWarned_) {
+      LOG_DBG("FCM", "Glyph cap (%u) reached during scan; excess glyphs will use group cache fallback",
+              MAX_SCAN_GLYPHS);
+      scanCapWarned_ = true;
+    }
+    return;
+  }
+  memmove(at + 1, at, (end - at) * sizeof(*at));
+  *at = key;
+  scanGlyphCount_++;
+}
+
+void FontCacheManager::endScan() {
+  free(scanGlyphs_);
+  scanGlyphs_ = nullptr;
+  scanGlyphCount_ = 0;
+  scanFontCount_ = 0;
+  scanCapWarned_ = false;
 }
 
 // --- PrewarmScope implementation ---
@@ -57,33 +127,42 @@ FontCacheManager::PrewarmScope::PrewarmScope(FontCacheManager& manager) : manage
   manager_->scanMode_ = ScanMode::Scanning;
   manager_->clearCache();
   manager_->resetStats();
-  manager_->scanText_.clear();
-  manager_->scanText_.reserve(2048);  // Pre-allocate to avoid heap fragmentation from repeated concat
-  memset(manager_->scanStyleCounts_, 0, sizeof(manager_->scanStyleCounts_));
-  manager_->scanFontId_ = -1;
+  manager_->endScan();
+  // The one allocation of the scan; without it nothing is recorded and glyphs come from the group cache
+  manager_->scanGlyphs_ = static_cast<uint32_t*>(malloc(MAX_SCAN_GLYPHS * sizeof(uint32_t)));
+  if (!manager_->scanGlyphs_) {
+    LOG_ERR("FCM", "No memory for the prewarm scan");
+  }
 }
 
 void FontCacheManager::PrewarmScope::endScanAndPrewarm() {
   manager_->scanMode_ = ScanMode::None;
-  if (manager_->scanText_.empty()) return;
-
-  // Build style bitmask from all styles that appeared during the scan
-  uint8_t styleMask = 0;
-  for (uint8_t i = 0; i < 4; i++) {
-    if (manager_->scanStyleCounts_[i] > 0) styleMask |= (1 << i);
+  if (!manager_->scanGlyphs_) return;
+
+  if (manager_->fontDecompressor_) {
+    // Each font's glyphs are one run of the sorted set; the slot bits are stripped in place
+    uint32_t* const glyphs = manager_->scanGlyphs_;
+    const uint16_t count = manager_->scanGlyphCount_;
+    uint16_t first = 0;
+    for (uint8_t slot = 0; slot < manager_->scanFontCount_; slot++) {
+      uint16_t end = first;
+      while (end < count && glyphs[end] >> SCAN_SLOT_SHIFT == slot) {
+        glyphs[end++] &= (1u << SCAN_SLOT_SHIFT) - 1;
+      }
+      const int missed = manager_->fontDecompressor_->prewarmGlyphs(manager_->scanFonts_[slot], glyphs + first,
+                                                                    end - first);
+      if (missed > 0) {
+        LOG_DBG("FCM", "prewarm: %d glyph(s) not cached for font %u", missed, slot);
+      }
+      first = end;
+    }
   }
-  if (styleMask == 0) styleMask = 1;  // default to regular
-
-  manager_->prewarmCache(manager_->scanFontId_, manager_->scanText_.c_str(), styleMask);
-
-  // Free scan string memory
-  manager_->scanText_.clear();
-  manager_->scanText_.shrink_to_fit();
+  manager_->endScan();
 }
 
 FontCacheManager::PrewarmScope::~PrewarmScope() {
   if (active_) {
-    endScanAndPrewarm();  // no-op if already called (scanText_ is empty)
+    endScanAndPrewarm();  // no-op if already called (the scan set is freed)
     manager_->clearCache();
   }
 }
@@ -3,25 +3,30 @@
 #include <EpdFontFamily.h>
 
 #include <cstdint>
-#include <map>
-#include <string>
+
+#include "FontTable.h"
 
 class FontDecompressor;
 
 class FontCacheManager {
  public:
-  explicit FontCacheManager(const std::map<int, EpdFontFamily>& fontMap);
+  explicit FontCacheManager(const FontTable& fontMap);
 
   void setFontDecompressor(FontDecompressor* d);
 
   void clearCache();
+  // Also drops the decompressed font groups kept across pages
+  void releaseMemory();
   void prewarmCache(int fontId, const char* utf8Text, uint8_t styleMask = 0x0F);
   void logStats(const char* label = "render");
   void resetStats();
 
-  // Scan-mode API: called by GfxRenderer::drawText() during scan pass
+  // Scan-mode API: called by GfxRenderer::drawText() during scan pass. The glyphs of the text are looked up right
+  // away and added to a fixed-size set per font, which the prewarm then takes as is.
   bool isScanning() const;
   void recordText(const char* text, int fontId, EpdFontFamily::Style style);
+  // Same for glyphs resolved at layout time: count PlacedGlyph entries (not necessarily aligned) of the style's font
+  void recordGlyphs(const uint8_t* placedGlyphs, uint16_t count, int fontId, EpdFontFamily::Style style);
 
   // The FontDecompressor pointer, needed by GfxRenderer::getGlyphBitmap()
   FontDecompressor* getDecompressor() const { return fontDecompressor_; }
@@ -44,12 +49,25 @@ class FontCacheManager {
   PrewarmScope createPrewarmScope();
 
  private:
-  const std::map<int, EpdFontFamily>& fontMap_;
+  const FontTable& fontMap_;
   FontDecompressor* fontDecompressor_ = nullptr;
 
   enum class ScanMode : uint8_t { None, Scanning };
   ScanMode scanMode_ = ScanMode::None;
-  std::string scanText_;
-  uint32_t scanStyleCounts_[4] = {};
-  int scanFontId_ = -1;
+
+  // Glyphs recorded during the scan, as font slot << SCAN_SLOT_SHIFT | glyph index, sorted and distinct, so each
+  // font's glyphs are one ascending run. Allocated for MAX_SCAN_GLYPHS entries for the length of the scan.
+  static constexpr uint16_t MAX_SCAN_GLYPHS = 512;
+  static constexpr uint8_t MAX_SCAN_FONTS = 4;  // One per page buffer slot of the FontDecompressor
+  static constexpr uint8_t SCAN_SLOT_SHIFT = 30;
+  uint32_t* scanGlyphs_ = nullptr;
+  uint16_t scanGlyphCount_ = 0;
+  const EpdFontData* scanFonts_[MAX_SCAN_FONTS] = {};
+  uint8_t scanFontCount_ = 0;
+  bool scanCapWarned_ = false;
+
+  // Slot of the style's font in the scan, -1 if it has nothing to prewarm or all slots are taken
+  int scanSlot(int fontId, EpdFontFamily::Style style);
+  void addScanGlyph(uint32_t key);
+  void endScan();
 };
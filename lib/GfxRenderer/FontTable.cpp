@@ -0,0 +1,43 @@
+#include "FontTable.h"
+
+#include <Logging.h>
+
+bool FontTable::insert(const int fontId, const EpdFontFamily& family) {
+  Entry* reuse = nullptr;
+  for (uint8_t probe = 0, slot = home(fontId); probe < CAPACITY; probe++, slot = (slot + 1) & (CAPACITY - 1)) {
+    Entry& entry = entries[slot];
+    if (entry.state == State::Used && entry.id == fontId) {
+      return false;
+    }
+    if (entry.state != State::Used && !reuse) {
+      reuse = &entry;
+    }
+    if (entry.state == State::Empty) {
+      break;  // The id can't be further along
+    }
+  }
+  if (!reuse) {
+    LOG_ERR("GFX", "Font table full, can't add font %d", fontId);
+    return false;
+  }
+  reuse->id = fontId;
+  reuse->state = State::Used;
+  reuse->family = family;
+  used++;
+  return true;
+}
+
+void FontTable::erase(const int fontId) {
+  for (uint8_t probe = 0, slot = home(fontId); probe < CAPACITY; probe++, slot = (slot + 1) & (CAPACITY - 1)) {
+    Entry& entry = entries[slot];
+    if (entry.state == State::Empty) {
+      return;
+    }
+    if (entry.state == State::Used && entry.id == fontId) {
+      entry.state = State::Removed;
+      entry.family = EpdFontFamily(nullptr);
+      used--;
+      return;
+    }
+  }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <EpdFontFamily.h>
+
+#include <cstdint>
+
+// A registered font looked up once, for the many measurements of a paragraph. family is nullptr if no font has the
+// id; it stays valid until the font is removed.
+struct FontHandle {
+  int id;
+  const EpdFontFamily* family;
+};
+
+/**
+ * The fonts of a GfxRenderer by id. Ids are the hashes of fontIds.h (and of the SD card fonts), stored in settings and
+ * section caches, so they can't be renumbered; the table is a small open-addressed one instead, looked up with a
+ * multiply and usually a single compare where a std::map would walk its tree on every measurement.
+ *
+ * Entries never move: a removed font leaves a tombstone that a later insert reuses, so a FontHandle of another font
+ * stays valid.
+ */
+class FontTable {
+ public:
+  static constexpr uint8_t CAPACITY = 32;
+
+  // False if the id is taken (the font is left as it is, as std::map::insert does) or the table is full
+  bool insert(int fontId, const EpdFontFamily& family);
+  void erase(int fontId);
+
+  const EpdFontFamily* find(const int fontId) const {
+    for (uint8_t probe = 0, slot = home(fontId); probe < CAPACITY; probe++, slot = (slot + 1) & (CAPACITY - 1)) {
+      const Entry& entry = entries[slot];
+      if (entry.state == State::Empty) {
+        return nullptr;
+      }
+      if (entry.state == State::Used && entry.id == fontId) {
+        return &entry.family;
+      }
+    }
+    return nullptr;
+  }
+  bool count(const int fontId) const { return find(fontId) != nullptr; }
+  uint8_t size() const { return used; }
+
+ private:
+  enum class State : uint8_t { Empty, Used, Removed };
+  struct Entry {
+    int id = 0;
+    State state = State::Empty;
+    EpdFontFamily family{nullptr};
+  };
+  Entry entries[CAPACITY];
+  uint8_t used = 0;
+
+  static uint8_t home(const int fontId) {
+    return static_cast<uint8_t>((static_cast<uint32_t>(fontId) * 2654435761u) >> 27);  // Top 5 bits: 32 slots
+  }
+};
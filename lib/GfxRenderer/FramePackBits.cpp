@@ -0,0 +1,25 @@
+#include "FramePackBits.h"
+
+#include <cstdint>
+
+size_t FramePackBits::decode(const uint8_t* data, const size_t length, uint8_t* frame, size_t pos) const {
+  size_t i = 0;
+  while (i < length) {
+    const uint8_t header = data[i++];
+    if (header < 128) {
+      const size_t count = header + 1;
+      if (i + count > length || pos + count > size) return SIZE_MAX;
+      for (size_t k = 0; k < count; k++) {
+        frame[offset(pos++)] = data[i++];
+      }
+    } else if (header > 128) {
+      const size_t count = 257 - header;
+      if (i >= length || pos + count > size) return SIZE_MAX;
+      const uint8_t value = data[i++];
+      for (size_t k = 0; k < count; k++) {
+        frame[offset(pos++)] = value;
+      }
+    }
+  }
+  return pos;
+}
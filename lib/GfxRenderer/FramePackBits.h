@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * PackBits run-length coding of a frame buffer. A packet is a header byte n followed by n + 1 literal bytes (n < 128)
+ * or by one byte to repeat 257 - n times (n > 128).
+ *
+ * The frame is walked by rows, or by panel columns, which in portrait run along the lines of text and turn the gaps
+ * between them into long runs. Packets are handed out whole, so output split at packet boundaries can be decoded a
+ * piece at a time.
+ */
+class FramePackBits {
+ public:
+  static constexpr size_t MAX_PACKET = 129;
+
+  FramePackBits(const size_t size, const uint16_t rowBytes, const bool byColumns)
+      : size(size), rows(rowBytes ? size / rowBytes : 0), rowBytes(rowBytes), byColumns(byColumns && rowBytes) {}
+
+  // Calls put(packet, length) with each packet of frame. Stops as soon as put returns false, and returns false then.
+  template <typename Put>
+  bool encode(const uint8_t* frame, Put&& put) const;
+  // Decodes the packets in data into frame, starting at walk position pos. Returns the position after them, or
+  // SIZE_MAX if the data doesn't end on a packet boundary or runs past the frame.
+  size_t decode(const uint8_t* data, size_t length, uint8_t* frame, size_t pos) const;
+  size_t frameSize() const { return size; }
+
+ private:
+  size_t size;
+  size_t rows;
+  uint16_t rowBytes;
+  bool byColumns;
+
+  // Offset in the frame of the i-th byte in walking order
+  size_t offset(const size_t i) const { return byColumns ? (i % rows) * rowBytes + i / rows : i; }
+};
+
+template <typename Put>
+bool FramePackBits::encode(const uint8_t* frame, Put&& put) const {
+  constexpr size_t MAX_RUN = MAX_PACKET - 1;
+  uint8_t packet[MAX_PACKET];
+  size_t i = 0;
+  while (i < size) {
+    const uint8_t value = frame[offset(i)];
+    size_t run = 1;
+    while (i + run < size && run < MAX_RUN && frame[offset(i + run)] == value) {
+      run++;
+    }
+    if (run >= 3) {
+      packet[0] = static_cast<uint8_t>(257 - run);
+      packet[1] = value;
+      if (!put(packet, 2)) return false;
+      i += run;
+      continue;
+    }
+
+    // Literal bytes up to the next run worth a packet of its own
+    size_t length = 0;
+    while (i + length < size && length < MAX_RUN) {
+      const size_t k = i + length;
+      const uint8_t byte = frame[offset(k)];
+      if (k + 2 < size && byte == frame[offset(k + 1)] && byte == frame[offset(k + 2)]) break;
+      packet[1 + length++] = byte;
+    }
+    packet[0] = static_cast<uint8_t>(length - 1);
+    if (!put(packet, 1 + length)) return false;
+    i += length;
+  }
+  return true;
+}
@@ -2,10 +2,14 @@
 
 #include <FontDecompressor.h>
 #include <HalGPIO.h>
+#include <HalIram.h>
+#include <HalHeapTrace.h>
 #include <Logging.h>
+#include <MemoryBudget.h>
 #include <Utf8.h>
 
 #include "FontCacheManager.h"
+#include "FramePackBits.h"
 
 const uint8_t* GfxRenderer::getGlyphBitmap(const EpdFontData* fontData, const EpdGlyph* glyph) const {
   if (fontData->groups != nullptr) {
@@ -16,13 +20,21 @@ const uint8_t* GfxRenderer::getGlyphBitmap(const EpdFontData* fontData, const Ep
     }
     uint32_t glyphIndex = static_cast<uint32_t>(glyph - fontData->glyph);
     // For page-buffer hits the pointer is stable for the page lifetime.
-    // For hot-group hits it is valid only until the next getBitmap() call — callers
+    // For group-cache hits it is valid only until the next getBitmap() call — callers
     // must consume it (draw the glyph) before requesting another bitmap.
     return fd->getBitmap(fontData, glyph, glyphIndex);
   }
   return &fontData->bitmap[glyph->dataOffset];
 }
 
+bool GfxRenderer::glyphBitmapIsPlanar(const EpdFontData* fontData) const {
+  if (fontData->groups == nullptr || !fontCacheManager_) {
+    return false;
+  }
+  const auto* fd = fontCacheManager_->getDecompressor();
+  return fd && fd->planarGlyphs();
+}
+
 void GfxRenderer::begin() {
   frameBuffer = display.getFrameBuffer();
   if (!frameBuffer) {
@@ -34,9 +46,24 @@ void GfxRenderer::begin() {
   panelWidthBytes = display.getDisplayWidthBytes();
   frameBufferSize = display.getBufferSize();
   bwBufferChunks.assign((frameBufferSize + BW_BUFFER_CHUNK_SIZE - 1) / BW_BUFFER_CHUNK_SIZE, nullptr);
+  bwPackedChunks.reserve(frameBufferSize / 2 / BW_PACKED_CHUNK_SIZE + 1);
+  shownTileColumns = (panelWidthBytes + SHOWN_TILE_BYTES - 1) / SHOWN_TILE_BYTES;
+  const int shownTileRows = (panelHeight + SHOWN_TILE_ROWS - 1) / SHOWN_TILE_ROWS;
+  shownTileHashes.assign(static_cast<size_t>(shownTileColumns) * shownTileRows, 0);
+  shownTilesValid = false;
 }
 
-void GfxRenderer::insertFont(const int fontId, EpdFontFamily font) { fontMap.insert({fontId, font}); }
+void GfxRenderer::insertFont(const int fontId, EpdFontFamily font) {
+  fontMap.insert(fontId, font);
+  memset(truncationCache, 0, sizeof(truncationCache));
+  clearRotatedGlyphs();
+}
+
+void GfxRenderer::removeFont(const int fontId) {
+  fontMap.erase(fontId);
+  memset(truncationCache, 0, sizeof(truncationCache));
+  clearRotatedGlyphs();
+}
 
 // Translate logical (x,y) coordinates to physical panel coordinates based on current orientation
 // This should always be inlined for better performance
@@ -72,10 +99,199 @@ static inline void rotateCoordinates(const GfxRenderer::Orientation orientation,
   }
 }
 
+// Inverse of rotateCoordinates(): the logical (x,y) of a panel pixel
+static inline void unrotateCoordinates(const GfxRenderer::Orientation orientation, const int phyX, const int phyY,
+                                       int* x, int* y, const uint16_t panelWidth, const uint16_t panelHeight) {
+  switch (orientation) {
+    case GfxRenderer::Portrait:
+      *x = panelHeight - 1 - phyY;
+      *y = phyX;
+      break;
+    case GfxRenderer::LandscapeClockwise:
+      *x = panelWidth - 1 - phyX;
+      *y = panelHeight - 1 - phyY;
+      break;
+    case GfxRenderer::PortraitInverted:
+      *x = phyY;
+      *y = panelWidth - 1 - phyX;
+      break;
+    case GfxRenderer::LandscapeCounterClockwise:
+      *x = phyX;
+      *y = phyY;
+      break;
+  }
+}
+
 enum class TextRotation { None, Rotated90CW };
 
+namespace {
+// Whether a 2-bit glyph pixel puts anything down in a render mode, by raw value: 0 white, 1 light gray, 2 dark gray,
+// 3 black. BW draws anything but white (the grays too); the LSB plane flags dark gray, the MSB plane light and dark
+// gray (a dark gray pixel is in both); a split render marks light and dark gray, see drawGrayPixel().
+constexpr bool GLYPH_PIXEL_ON[4][4] = {
+    {false, true, true, true},    // BW
+    {false, false, true, false},  // GRAYSCALE_LSB
+    {false, true, true, false},   // GRAYSCALE_MSB
+    {false, true, true, false},   // GRAYSCALE_SPLIT
+};
+constexpr uint8_t RAW_DARK_GRAY = 2;
+
+// The same rules over a byte of four 2-bit pixels, for BW and the two planes: a nibble of the pixels put down, first
+// pixel in the high bit
+struct GlyphNibbleTable {
+  uint8_t nibbles[3][256];
+};
+constexpr GlyphNibbleTable makeGlyphNibbleTable() {
+  GlyphNibbleTable table{};
+  for (int mode = 0; mode < 3; mode++) {
+    for (int byte = 0; byte < 256; byte++) {
+      uint8_t nibble = 0;
+      for (int i = 0; i < 4; i++) {
+        if (GLYPH_PIXEL_ON[mode][(byte >> (6 - 2 * i)) & 3]) {
+          nibble |= 8 >> i;
+        }
+      }
+      table.nibbles[mode][byte] = nibble;
+    }
+  }
+  return table;
+}
+constexpr GlyphNibbleTable GLYPH_NIBBLES = makeGlyphNibbleTable();
+
+// How a glyph bitmap holds its pixels: 1 bit each, 2-bit pairs, or the high bits then the low bits in two planes
+// (compressed fonts, see FontDecompressor::setPlanarGlyphs)
+enum class GlyphFormat : uint8_t { OneBit, Packed2Bit, Planar2Bit };
+
+struct GlyphBits {
+  const uint8_t* data;
+  uint32_t planeBytes;  // The whole bitmap unless planar
+  GlyphFormat format;
+};
+
+GlyphBits glyphBits(const GfxRenderer& renderer, const EpdFontData* fontData, const EpdGlyph* glyph,
+                    const uint8_t* bitmap) {
+  const uint32_t pixels = static_cast<uint32_t>(glyph->width) * glyph->height;
+  if (!fontData->is2Bit) {
+    return {bitmap, (pixels + 7) / 8, GlyphFormat::OneBit};
+  }
+  if (renderer.glyphBitmapIsPlanar(fontData)) {
+    return {bitmap, (pixels + 7) / 8, GlyphFormat::Planar2Bit};
+  }
+  return {bitmap, (pixels * 2 + 7) / 8, GlyphFormat::Packed2Bit};
+}
+
+// Pixel loop of renderGlyphImpl, with the rotation, the render mode and the glyph format fixed so the loop body is a
+// table lookup and a store
+template <TextRotation rotation, GfxRenderer::RenderMode mode, GlyphFormat format>
+HOT_IRAM void renderGlyphPixels(const GfxRenderer& renderer, const GlyphBits& bits, const int width, const int height,
+                       const int outerBase, const int innerBase, const bool pixelState) {
+  constexpr bool is2Bit = format != GlyphFormat::OneBit;
+  // 2-bit glyphs only ever set bits of the gray planes
+  const bool state = is2Bit && mode != GfxRenderer::BW ? false : pixelState;
+  const uint8_t* bitmap = bits.data;
+  int pixelPosition = 0;
+  for (int glyphY = 0; glyphY < height; glyphY++) {
+    const int outerCoord = outerBase + glyphY;
+    for (int glyphX = 0; glyphX < width; glyphX++, pixelPosition++) {
+      int screenX, screenY;
+      if constexpr (rotation == TextRotation::Rotated90CW) {
+        screenX = outerCoord;
+        screenY = innerBase - glyphX;
+      } else {
+        screenX = innerBase + glyphX;
+        screenY = outerCoord;
+      }
+
+      if constexpr (is2Bit) {
+        uint8_t raw;
+        if constexpr (format == GlyphFormat::Planar2Bit) {
+          const int shift = 7 - (pixelPosition & 7);
+          const uint8_t* loPlane = bitmap + bits.planeBytes;
+          raw = ((bitmap[pixelPosition >> 3] >> shift) & 1) << 1 | ((loPlane[pixelPosition >> 3] >> shift) & 1);
+        } else {
+          raw = (bitmap[pixelPosition >> 2] >> ((3 - (pixelPosition & 3)) * 2)) & 0x3;
+        }
+        if (GLYPH_PIXEL_ON[mode][raw]) {
+          if constexpr (mode == GfxRenderer::GRAYSCALE_SPLIT) {
+            renderer.drawGrayPixel(screenX, screenY, raw == RAW_DARK_GRAY);
+          } else {
+            renderer.drawPixel(screenX, screenY, state);
+          }
+        }
+      } else if ((bitmap[pixelPosition >> 3] >> (7 - (pixelPosition & 7))) & 1) {
+        renderer.drawPixel(screenX, screenY, state);
+      }
+    }
+  }
+}
+
+template <TextRotation rotation, GlyphFormat format>
+void renderGlyphPixelsInMode(const GfxRenderer& renderer, const GfxRenderer::RenderMode renderMode,
+                             const GlyphBits& bits, const int width, const int height, const int outerBase,
+                             const int innerBase, const bool pixelState) {
+  switch (renderMode) {
+    case GfxRenderer::BW:
+      renderGlyphPixels<rotation, GfxRenderer::BW, format>(renderer, bits, width, height, outerBase, innerBase,
+                                                           pixelState);
+      break;
+    case GfxRenderer::GRAYSCALE_LSB:
+      renderGlyphPixels<rotation, GfxRenderer::GRAYSCALE_LSB, format>(renderer, bits, width, height, outerBase,
+                                                                      innerBase, pixelState);
+      break;
+    case GfxRenderer::GRAYSCALE_MSB:
+      renderGlyphPixels<rotation, GfxRenderer::GRAYSCALE_MSB, format>(renderer, bits, width, height, outerBase,
+                                                                      innerBase, pixelState);
+      break;
+    case GfxRenderer::GRAYSCALE_SPLIT:
+      renderGlyphPixels<rotation, GfxRenderer::GRAYSCALE_SPLIT, format>(renderer, bits, width, height, outerBase,
+                                                                        innerBase, pixelState);
+      break;
+  }
+}
+}  // namespace
+
 // Shared glyph rendering logic for normal and rotated text.
-// Coordinate mapping and cursor advance direction are selected at compile time via the template parameter.
+// Coordinate mapping and cursor advance direction are selected at compile time via the template parameter; the render
+// mode and glyph format once per glyph.
+template <TextRotation rotation>
+static void renderGlyphImpl(const GfxRenderer& renderer, GfxRenderer::RenderMode renderMode,
+                            const EpdFontData* fontData, const EpdGlyph* glyph, int cursorX, int cursorY,
+                            const bool pixelState) {
+  const uint8_t* bitmap = renderer.getGlyphBitmap(fontData, glyph);
+  if (bitmap == nullptr) {
+    return;
+  }
+
+  // For Normal:  outer loop advances screenY, inner loop advances screenX
+  // For Rotated: outer loop advances screenX, inner loop advances screenY (in reverse)
+  int outerBase, innerBase;
+  if constexpr (rotation == TextRotation::Rotated90CW) {
+    outerBase = cursorX + fontData->ascender - glyph->top;  // screenX = outerBase + glyphY
+    innerBase = cursorY - glyph->left;                      // screenY = innerBase - glyphX
+  } else {
+    outerBase = cursorY - glyph->top;   // screenY = outerBase + glyphY
+    innerBase = cursorX + glyph->left;  // screenX = innerBase + glyphX
+  }
+
+  const int width = glyph->width;
+  const int height = glyph->height;
+  const GlyphBits bits = glyphBits(renderer, fontData, glyph, bitmap);
+  switch (bits.format) {
+    case GlyphFormat::OneBit:
+      renderGlyphPixels<rotation, GfxRenderer::BW, GlyphFormat::OneBit>(renderer, bits, width, height, outerBase,
+                                                                        innerBase, pixelState);
+      break;
+    case GlyphFormat::Packed2Bit:
+      renderGlyphPixelsInMode<rotation, GlyphFormat::Packed2Bit>(renderer, renderMode, bits, width, height, outerBase,
+                                                                 innerBase, pixelState);
+      break;
+    case GlyphFormat::Planar2Bit:
+      renderGlyphPixelsInMode<rotation, GlyphFormat::Planar2Bit>(renderer, renderMode, bits, width, height, outerBase,
+                                                                 innerBase, pixelState);
+      break;
+  }
+}
+
 template <TextRotation rotation>
 static void renderCharImpl(const GfxRenderer& renderer, GfxRenderer::RenderMode renderMode,
                            const EpdFontFamily& fontFamily, const uint32_t cp, int cursorX, int cursorY,
@@ -85,92 +301,379 @@ static void renderCharImpl(const GfxRenderer& renderer, GfxRenderer::RenderMode
     LOG_ERR("GFX", "No glyph for codepoint %d", cp);
     return;
   }
+  renderGlyphImpl<rotation>(renderer, renderMode, fontFamily.getData(style), glyph, cursorX, cursorY, pixelState);
+}
 
-  const EpdFontData* fontData = fontFamily.getData(style);
-  const bool is2Bit = fontData->is2Bit;
-  const uint8_t width = glyph->width;
-  const uint8_t height = glyph->height;
-  const int left = glyph->left;
-  const int top = glyph->top;
+namespace {
+// The 8 bits of a bit stream of size bytes starting at bit, MSB first
+inline uint8_t bitsAt(const uint8_t* stream, const uint32_t size, const uint32_t bit) {
+  auto byteAt = [&](const uint32_t i) -> uint32_t { return i < size ? stream[i] : 0; };
+  const uint32_t wide = (byteAt(bit >> 3) << 8) | byteAt((bit >> 3) + 1);
+  return static_cast<uint8_t>((wide << (bit & 7)) >> 8);
+}
 
-  const uint8_t* bitmap = renderer.getGlyphBitmap(fontData, glyph);
+// Mask of the (up to 8) glyph pixels starting at pixel index p that a glyph draw puts down in renderMode (BW or one of
+// the planes), MSB first. Same rules as renderGlyphImpl: GLYPH_NIBBLES for 2-bit pairs, one operation over the high
+// and low bits of planar glyphs.
+inline uint8_t glyphPixelMask(const GlyphBits& bits, const uint32_t p, const int n,
+                              const GfxRenderer::RenderMode renderMode) {
+  const uint8_t* bitmap = bits.data;
+  const uint32_t bitmapBytes = bits.planeBytes;
+  auto byteAt = [&](const uint32_t i) -> uint32_t { return i < bitmapBytes ? bitmap[i] : 0; };
+  uint8_t mask;
+  if (bits.format == GlyphFormat::OneBit) {
+    mask = bitsAt(bitmap, bitmapBytes, p);
+  } else if (bits.format == GlyphFormat::Planar2Bit) {
+    const uint8_t hi = bitsAt(bitmap, bitmapBytes, p);
+    const uint8_t lo = bitsAt(bitmap + bitmapBytes, bitmapBytes, p);
+    // Raw 1 and 2 are the grays, 3 black
+    mask = static_cast<uint8_t>(renderMode == GfxRenderer::BW              ? hi | lo
+                                : renderMode == GfxRenderer::GRAYSCALE_LSB ? hi & ~lo
+                                                                           : hi ^ lo);
+  } else {
+    const uint32_t bit = p * 2;
+    const uint32_t wide = (byteAt(bit >> 3) << 16) | (byteAt((bit >> 3) + 1) << 8) | byteAt((bit >> 3) + 2);
+    const uint32_t pairs = ((wide << (bit & 7)) >> 8) & 0xFFFF;
+    const uint8_t* nibbles = GLYPH_NIBBLES.nibbles[renderMode];
+    mask = static_cast<uint8_t>(nibbles[pairs >> 8] << 4 | nibbles[pairs & 0xFF]);
+  }
+  return n >= 8 ? mask : static_cast<uint8_t>(mask & (0xFF << (8 - n)));
+}
+
+// Transposes an 8x8 bit tile: out[j] holds column j of in, with row 0 in the MSB (Hacker's Delight, transpose8)
+inline void transpose8x8(const uint8_t in[8], uint8_t out[8]) {
+  uint32_t x = (static_cast<uint32_t>(in[0]) << 24) | (in[1] << 16) | (in[2] << 8) | in[3];
+  uint32_t y = (static_cast<uint32_t>(in[4]) << 24) | (in[5] << 16) | (in[6] << 8) | in[7];
+  uint32_t t;
+  t = (x ^ (x >> 7)) & 0x00AA00AA;
+  x = x ^ t ^ (t << 7);
+  t = (y ^ (y >> 7)) & 0x00AA00AA;
+  y = y ^ t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000CCCC;
+  x = x ^ t ^ (t << 14);
+  t = (y ^ (y >> 14)) & 0x0000CCCC;
+  y = y ^ t ^ (t << 14);
+  t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+  y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+  x = t;
+  for (int i = 0; i < 4; i++) {
+    out[i] = static_cast<uint8_t>(x >> (24 - 8 * i));
+    out[4 + i] = static_cast<uint8_t>(y >> (24 - 8 * i));
+  }
+}
+
+inline uint8_t reverseBits(uint8_t b) {
+  b = static_cast<uint8_t>((b & 0xF0) >> 4 | (b & 0x0F) << 4);
+  b = static_cast<uint8_t>((b & 0xCC) >> 2 | (b & 0x33) << 2);
+  return static_cast<uint8_t>((b & 0xAA) >> 1 | (b & 0x55) << 1);
+}
+
+// Writes 8 pixels (MSB first) into the panel row starting at byte rowStart of a plane, beginning at physical x, which
+// may be unaligned. Bytes outside the row are skipped, so padding bits of a glyph's last tile may hang over the edge.
+template <typename PlaneByte>
+inline void blitRowByte(PlaneByte&& planeByte, const uint32_t rowStart, const int phyX, const uint8_t bits,
+                        const bool state, const int rowBytes) {
+  if (bits == 0) {
+    return;
+  }
+  const int byteIndex = phyX >> 3;
+  const uint16_t wide = static_cast<uint16_t>(bits << (8 - (phyX & 7)));
+  const uint8_t parts[2] = {static_cast<uint8_t>(wide >> 8), static_cast<uint8_t>(wide)};
+  for (int i = 0; i < 2; i++) {
+    const int index = byteIndex + i;
+    if (parts[i] == 0 || index < 0 || index >= rowBytes) continue;
+    uint8_t& target = planeByte(rowStart + index);
+    if (state) {
+      target &= ~parts[i];  // Clear bit = black
+    } else {
+      target |= parts[i];
+    }
+  }
+}
 
-  if (bitmap != nullptr) {
-    // For Normal:  outer loop advances screenY, inner loop advances screenX
-    // For Rotated: outer loop advances screenX, inner loop advances screenY (in reverse)
-    int outerBase, innerBase;
-    if constexpr (rotation == TextRotation::Rotated90CW) {
-      outerBase = cursorX + fontData->ascender - top;  // screenX = outerBase + glyphY
-      innerBase = cursorY - left;                      // screenY = innerBase - glyphX
+// Writes count bytes of pixels (MSB first) into the panel row starting at byte rowStart of a plane, beginning at
+// physical x, which may be unaligned: each plane byte is written once. Bytes outside the row are skipped.
+template <typename PlaneByte>
+inline void blitRowSpan(PlaneByte&& planeByte, const uint32_t rowStart, const int phyX, const uint8_t* bits,
+                        const int count, const bool state, const int rowBytes) {
+  const int shift = phyX & 7;
+  int index = phyX >> 3;
+  uint8_t carry = 0;
+  for (int k = 0; k <= count; k++, index++) {
+    const uint8_t next = k < count ? bits[k] : 0;
+    const uint8_t part = carry | static_cast<uint8_t>(next >> shift);
+    carry = shift ? static_cast<uint8_t>(next << (8 - shift)) : 0;
+    if (part == 0 || index < 0 || index >= rowBytes) continue;
+    uint8_t& target = planeByte(rowStart + index);
+    if (state) {
+      target &= ~part;
     } else {
-      outerBase = cursorY - top;   // screenY = outerBase + glyphY
-      innerBase = cursorX + left;  // screenX = innerBase + glyphX
-    }
-
-    if (is2Bit) {
-      int pixelPosition = 0;
-      for (int glyphY = 0; glyphY < height; glyphY++) {
-        const int outerCoord = outerBase + glyphY;
-        for (int glyphX = 0; glyphX < width; glyphX++, pixelPosition++) {
-          int screenX, screenY;
-          if constexpr (rotation == TextRotation::Rotated90CW) {
-            screenX = outerCoord;
-            screenY = innerBase - glyphX;
+      target |= part;
+    }
+  }
+}
+}  // namespace
+
+bool GfxRenderer::blitGlyph(const EpdFontData* fontData, const EpdGlyph* glyph, const uint8_t* bitmap,
+                            const int screenX, const int screenY, const bool pixelState) const {
+  const int width = glyph->width;
+  const int height = glyph->height;
+  const bool portrait = orientation == Portrait || orientation == PortraitInverted;
+  const int logicalWidth = portrait ? panelHeight : panelWidth;
+  const int logicalHeight = portrait ? panelWidth : panelHeight;
+  if (screenX < 0 || screenY < 0 || screenX + width > logicalWidth || screenY + height > logicalHeight) {
+    return false;  // Partly off-screen: let the per-pixel path clip it
+  }
+
+  const GlyphBits bits = glyphBits(*this, fontData, glyph, bitmap);
+  auto blitPlane = [&](const RenderMode planeMode, auto&& planeByte) {
+    // 2-bit glyphs only ever set bits of the gray planes, see renderGlyphImpl
+    const bool state = fontData->is2Bit && planeMode != BW ? false : pixelState;
+    auto rowMask = [&](const int gy, const int gx) {
+      if (gy >= height) return static_cast<uint8_t>(0);
+      return glyphPixelMask(bits, static_cast<uint32_t>(gy) * width + gx, width - gx, planeMode);
+    };
+
+    if (orientation == LandscapeCounterClockwise || orientation == LandscapeClockwise) {
+      // Glyph rows are panel rows: write whole bytes, mirrored for the 180 degree rotation
+      const bool mirrored = orientation == LandscapeClockwise;
+      for (int gy = 0; gy < height; gy++) {
+        const int phyY = mirrored ? panelHeight - 1 - (screenY + gy) : screenY + gy;
+        const uint32_t rowStart = static_cast<uint32_t>(phyY) * panelWidthBytes;
+        for (int gx = 0; gx < width; gx += 8) {
+          const uint8_t bits = rowMask(gy, gx);
+          if (mirrored) {
+            blitRowByte(planeByte, rowStart, panelWidth - 1 - (screenX + gx) - 7, reverseBits(bits), state,
+                        panelWidthBytes);
           } else {
-            screenX = innerBase + glyphX;
-            screenY = outerCoord;
-          }
-
-          const uint8_t byte = bitmap[pixelPosition >> 2];
-          const uint8_t bit_index = (3 - (pixelPosition & 3)) * 2;
-          // the direct bit from the font is 0 -> white, 1 -> light gray, 2 -> dark gray, 3 -> black
-          // we swap this to better match the way images and screen think about colors:
-          // 0 -> black, 1 -> dark grey, 2 -> light grey, 3 -> white
-          const uint8_t bmpVal = 3 - ((byte >> bit_index) & 0x3);
-
-          if (renderMode == GfxRenderer::BW && bmpVal < 3) {
-            // Black (also paints over the grays in BW mode)
-            renderer.drawPixel(screenX, screenY, pixelState);
-          } else if (renderMode == GfxRenderer::GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
-            // Light gray (also mark the MSB if it's going to be a dark gray too)
-            // Dedicated X3 gray LUTs now provide proper 4-level gray on both devices
-            // We have to flag pixels in reverse for the gray buffers, as 0 leave alone, 1 update
-            renderer.drawPixel(screenX, screenY, false);
-          } else if (renderMode == GfxRenderer::GRAYSCALE_LSB && bmpVal == 1) {
-            // Dark gray
-            renderer.drawPixel(screenX, screenY, false);
+            blitRowByte(planeByte, rowStart, screenX + gx, bits, state, panelWidthBytes);
           }
         }
       }
-    } else {
-      int pixelPosition = 0;
-      for (int glyphY = 0; glyphY < height; glyphY++) {
-        const int outerCoord = outerBase + glyphY;
-        for (int glyphX = 0; glyphX < width; glyphX++, pixelPosition++) {
-          int screenX, screenY;
-          if constexpr (rotation == TextRotation::Rotated90CW) {
-            screenX = outerCoord;
-            screenY = innerBase - glyphX;
+      return;
+    }
+
+    // Portrait: glyph columns are panel rows, so transpose 8x8 tiles and write each tile column as one byte
+    const bool inverted = orientation == PortraitInverted;
+    for (int gy = 0; gy < height; gy += 8) {
+      for (int gx = 0; gx < width; gx += 8) {
+        uint8_t tile[8], columns[8];
+        for (int k = 0; k < 8; k++) tile[k] = rowMask(gy + k, gx);
+        transpose8x8(tile, columns);
+        for (int j = 0; j < 8 && gx + j < width; j++) {
+          const int x = screenX + gx + j;
+          const int phyY = inverted ? x : panelHeight - 1 - x;
+          const uint32_t rowStart = static_cast<uint32_t>(phyY) * panelWidthBytes;
+          if (inverted) {
+            blitRowByte(planeByte, rowStart, panelWidth - 1 - (screenY + gy) - 7, reverseBits(columns[j]), state,
+                        panelWidthBytes);
           } else {
-            screenX = innerBase + glyphX;
-            screenY = outerCoord;
+            blitRowByte(planeByte, rowStart, screenY + gy, columns[j], state, panelWidthBytes);
           }
+        }
+      }
+    }
+  };
 
-          const uint8_t byte = bitmap[pixelPosition >> 3];
-          const uint8_t bit_index = 7 - (pixelPosition & 7);
+  auto frameBufferByte = [this](const uint32_t i) -> uint8_t& { return frameBuffer[i]; };
+  if (renderMode == GRAYSCALE_SPLIT) {
+    blitPlane(GRAYSCALE_LSB, frameBufferByte);
+    blitPlane(GRAYSCALE_MSB, [this](const uint32_t i) -> uint8_t& { return msbPlaneByte(i); });
+  } else {
+    blitPlane(renderMode, frameBufferByte);
+  }
+  return true;
+}
 
-          if ((byte >> bit_index) & 1) {
-            renderer.drawPixel(screenX, screenY, pixelState);
-          }
+void GfxRenderer::clearRotatedGlyphs() const {
+  if (rotatedGlyphSlots) {
+    memset(rotatedGlyphSlots, 0, ROTATED_GLYPH_SLOTS * sizeof(RotatedGlyphSlot));
+  }
+  rotatedGlyphArenaUsed = 0;
+  rotatedGlyphCount = 0;
+}
+
+void GfxRenderer::freeRotatedGlyphs() {
+  free(rotatedGlyphSlots);
+  rotatedGlyphSlots = nullptr;
+  rotatedGlyphArena = nullptr;
+  rotatedGlyphArenaUsed = 0;
+  rotatedGlyphCount = 0;
+}
+
+const uint8_t* GfxRenderer::rotatedGlyph(const EpdFontData* fontData, const EpdGlyph* glyph, RenderMode plane) const {
+  const int width = glyph->width;
+  const int height = glyph->height;
+  const int columnBytes = (height + 7) / 8;
+  const size_t size = static_cast<size_t>(width) * columnBytes;
+  // Large glyphs (drop caps, symbols) would crowd out the text
+  if (size == 0 || size > ROTATED_GLYPH_ARENA_SIZE / 16) {
+    return nullptr;
+  }
+  if (!rotatedGlyphSlots) {
+    void* memory = malloc(ROTATED_GLYPH_SLOTS * sizeof(RotatedGlyphSlot) + ROTATED_GLYPH_ARENA_SIZE);
+    if (!memory) {
+      return nullptr;
+    }
+    rotatedGlyphSlots = static_cast<RotatedGlyphSlot*>(memory);
+    rotatedGlyphArena = reinterpret_cast<uint8_t*>(rotatedGlyphSlots + ROTATED_GLYPH_SLOTS);
+    clearRotatedGlyphs();
+  }
+
+  if (!fontData->is2Bit) {
+    plane = BW;  // One mask for every plane
+  }
+  const uint32_t hash = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(glyph) / sizeof(EpdGlyph)) * 2654435761u;
+  size_t slot = ((hash >> 16) ^ plane) & (ROTATED_GLYPH_SLOTS - 1);
+  for (; rotatedGlyphSlots[slot].glyph; slot = (slot + 1) & (ROTATED_GLYPH_SLOTS - 1)) {
+    if (rotatedGlyphSlots[slot].glyph == glyph && rotatedGlyphSlots[slot].plane == plane) {
+      return rotatedGlyphArena + rotatedGlyphSlots[slot].offset;
+    }
+  }
+  if (rotatedGlyphCount >= ROTATED_GLYPH_SLOTS * 3 / 4 || rotatedGlyphArenaUsed + size > ROTATED_GLYPH_ARENA_SIZE) {
+    clearRotatedGlyphs();
+    slot = ((hash >> 16) ^ plane) & (ROTATED_GLYPH_SLOTS - 1);
+  }
+
+  const uint8_t* bitmap = getGlyphBitmap(fontData, glyph);
+  if (bitmap == nullptr) {
+    return nullptr;
+  }
+  const GlyphBits bits = glyphBits(*this, fontData, glyph, bitmap);
+  uint8_t* columns = rotatedGlyphArena + rotatedGlyphArenaUsed;
+  for (int gy = 0; gy < height; gy += 8) {
+    for (int gx = 0; gx < width; gx += 8) {
+      uint8_t tile[8], tileColumns[8];
+      for (int k = 0; k < 8; k++) {
+        tile[k] = gy + k < height
+                      ? glyphPixelMask(bits, static_cast<uint32_t>(gy + k) * width + gx, width - gx, plane)
+                      : 0;
+      }
+      transpose8x8(tile, tileColumns);
+      for (int j = 0; j < 8 && gx + j < width; j++) {
+        columns[(gx + j) * columnBytes + gy / 8] = tileColumns[j];
+      }
+    }
+  }
+  rotatedGlyphSlots[slot] = {glyph, rotatedGlyphArenaUsed, static_cast<uint8_t>(plane)};
+  rotatedGlyphArenaUsed += size;
+  rotatedGlyphCount++;
+  return columns;
+}
+
+bool GfxRenderer::blitRotatedGlyph(const EpdFontData* fontData, const EpdGlyph* glyph, const int screenX,
+                                   const int screenY, const bool pixelState) const {
+  if (orientation != Portrait && orientation != PortraitInverted) {
+    return false;
+  }
+  const int width = glyph->width;
+  const int height = glyph->height;
+  // Logical portrait is panelHeight wide
+  if (screenX < 0 || screenY < 0 || screenX + width > panelHeight || screenY + height > panelWidth) {
+    return false;
+  }
+
+  const bool inverted = orientation == PortraitInverted;
+  const int columnBytes = (height + 7) / 8;
+  auto blitPlane = [&](const RenderMode planeMode, auto&& planeByte) {
+    const uint8_t* columns = rotatedGlyph(fontData, glyph, planeMode);
+    if (!columns) {
+      return false;
+    }
+    // 2-bit glyphs only ever set bits of the gray planes, see renderGlyphImpl
+    const bool state = fontData->is2Bit && planeMode != BW ? false : pixelState;
+    uint8_t reversed[32];
+    for (int j = 0; j < width; j++, columns += columnBytes) {
+      const int x = screenX + j;
+      if (inverted) {
+        // The column runs right to left along the panel row
+        for (int k = 0; k < columnBytes; k++) {
+          reversed[k] = reverseBits(columns[columnBytes - 1 - k]);
         }
+        blitRowSpan(planeByte, static_cast<uint32_t>(x) * panelWidthBytes, panelWidth - screenY - 8 * columnBytes,
+                    reversed, columnBytes, state, panelWidthBytes);
+      } else {
+        blitRowSpan(planeByte, static_cast<uint32_t>(panelHeight - 1 - x) * panelWidthBytes, screenY, columns,
+                    columnBytes, state, panelWidthBytes);
       }
     }
+    return true;
+  };
+
+  auto frameBufferByte = [this](const uint32_t i) -> uint8_t& { return frameBuffer[i]; };
+  if (renderMode == GRAYSCALE_SPLIT) {
+    // The MSB masks may evict the LSB ones, so each plane looks its masks up right before drawing. Should the MSB plane
+    // fail, drawGlyph() draws both planes the other way; setting the LSB bits again changes nothing.
+    return blitPlane(GRAYSCALE_LSB, frameBufferByte) &&
+           blitPlane(GRAYSCALE_MSB, [this](const uint32_t i) -> uint8_t& { return msbPlaneByte(i); });
+  }
+  return blitPlane(renderMode, frameBufferByte);
+}
+
+void GfxRenderer::drawGlyph(const EpdFontData* fontData, const EpdGlyph* glyph, const int cursorX, const int cursorY,
+                            const bool pixelState) const {
+  if (blitRotatedGlyph(fontData, glyph, cursorX + glyph->left, cursorY - glyph->top, pixelState)) {
+    return;
+  }
+  const uint8_t* bitmap = getGlyphBitmap(fontData, glyph);
+  if (bitmap == nullptr) {
+    return;
+  }
+  if (!blitGlyph(fontData, glyph, bitmap, cursorX + glyph->left, cursorY - glyph->top, pixelState)) {
+    renderGlyphImpl<TextRotation::None>(*this, renderMode, fontData, glyph, cursorX, cursorY, pixelState);
+  }
+}
+
+// Walks text the way drawText() places it: ligature substitution, differential-rounded kerning and combining marks
+// centered over their base. fn(glyph, cp, glyphX, raiseBy) is called per glyph with glyphX relative to the start of
+// the text; glyph is nullptr for a base codepoint the font doesn't have.
+template <typename Fn>
+static void forEachPlacedGlyph(const EpdFontFamily& font, const char* text, const EpdFontFamily::Style style,
+                               Fn&& fn) {
+  int lastBaseX = 0;
+  int lastBaseLeft = 0;
+  int lastBaseWidth = 0;
+  int lastBaseTop = 0;
+  int32_t prevAdvanceFP = 0;  // 12.4 fixed-point: prev glyph's advance + next kern for snap
+
+  uint32_t cp;
+  uint32_t prevCp = 0;
+  while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
+    if (utf8IsCombiningMark(cp)) {
+      const EpdGlyph* combiningGlyph = font.getGlyph(cp, style);
+      if (!combiningGlyph) continue;
+      const int raiseBy = combiningMark::raiseAboveBase(combiningGlyph->top, combiningGlyph->height, lastBaseTop);
+      const int combiningX = combiningMark::centerOver(lastBaseX, lastBaseLeft, lastBaseWidth, combiningGlyph->left,
+                                                       combiningGlyph->width);
+      fn(combiningGlyph, cp, combiningX, raiseBy);
+      continue;
+    }
+
+    cp = font.applyLigatures(cp, text, style);
+
+    // Differential rounding: snap (previous advance + current kern) as one unit so
+    // identical character pairs always produce the same pixel step regardless of
+    // where they fall on the line.
+    if (prevCp != 0) {
+      const auto kernFP = font.getKerning(prevCp, cp, style);  // 4.4 fixed-point kern
+      lastBaseX += fp4::toPixel(prevAdvanceFP + kernFP);       // snap 12.4 fixed-point to nearest pixel
+    }
+
+    const EpdGlyph* glyph = font.getGlyph(cp, style);
+
+    lastBaseLeft = glyph ? glyph->left : 0;
+    lastBaseWidth = glyph ? glyph->width : 0;
+    lastBaseTop = glyph ? glyph->top : 0;
+    prevAdvanceFP = glyph ? glyph->advanceX : 0;  // 12.4 fixed-point
+
+    fn(glyph, cp, lastBaseX, 0);
+    prevCp = cp;
   }
 }
 
 // IMPORTANT: This function is in critical rendering path and is called for every pixel. Please keep it as simple and
 // efficient as possible.
-void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
+HOT_IRAM void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
   int phyX = 0;
   int phyY = 0;
 
@@ -192,17 +695,40 @@ void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
   } else {
     frameBuffer[byteIndex] |= 1 << bitPosition;  // Set bit
   }
+
+  if (renderMode == GRAYSCALE_SPLIT) {
+    // Same pixel in both gray planes
+    uint8_t& msb = msbPlaneByte(byteIndex);
+    msb = state ? msb & ~(1 << bitPosition) : msb | (1 << bitPosition);
+  }
+}
+
+HOT_IRAM void GfxRenderer::drawGrayPixel(const int x, const int y, const bool dark) const {
+  int phyX = 0;
+  int phyY = 0;
+  rotateCoordinates(orientation, x, y, &phyX, &phyY, panelWidth, panelHeight);
+  if (phyX < 0 || phyX >= panelWidth || phyY < 0 || phyY >= panelHeight) {
+    LOG_ERR("GFX", "!! Outside range (%d, %d) -> (%d, %d)", x, y, phyX, phyY);
+    return;
+  }
+
+  const uint32_t byteIndex = static_cast<uint32_t>(phyY) * panelWidthBytes + (phyX / 8);
+  const uint8_t bit = 1 << (7 - (phyX % 8));
+  msbPlaneByte(byteIndex) |= bit;  // Light or dark gray
+  if (dark) {
+    frameBuffer[byteIndex] |= bit;
+  }
 }
 
 int GfxRenderer::getTextWidth(const int fontId, const char* text, const EpdFontFamily::Style style) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
+  const EpdFontFamily* family = fontMap.find(fontId);
+  if (!family) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return 0;
   }
 
   int w = 0, h = 0;
-  fontIt->second.getTextDimensions(text, &w, &h, style);
+  family->getTextDimensions(text, &w, &h, style);
   return w;
 }
 
@@ -215,11 +741,6 @@ void GfxRenderer::drawCenteredText(const int fontId, const int y, const char* te
 void GfxRenderer::drawText(const int fontId, const int x, const int y, const char* text, const bool black,
                            const EpdFontFamily::Style style) const {
   const int yPos = y + getFontAscenderSize(fontId);
-  int lastBaseX = x;
-  int lastBaseLeft = 0;
-  int lastBaseWidth = 0;
-  int lastBaseTop = 0;
-  int32_t prevAdvanceFP = 0;  // 12.4 fixed-point: prev glyph's advance + next kern for snap
 
   // cannot draw a NULL / empty string
   if (text == nullptr || *text == '\0') {
@@ -231,64 +752,91 @@ void GfxRenderer::drawText(const int fontId, const int x, const int y, const cha
     return;
   }
 
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
+  const EpdFontFamily* family = fontMap.find(fontId);
+  if (!family) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return;
   }
-  const auto& font = fontIt->second;
+  const auto& font = *family;
+  const EpdFontData* fontData = font.getData(style);
+
+  forEachPlacedGlyph(font, text, style,
+                     [&](const EpdGlyph* glyph, const uint32_t cp, const int glyphX, const int raiseBy) {
+                       if (!glyph) {
+                         LOG_ERR("GFX", "No glyph for codepoint %d", cp);
+                         return;
+                       }
+                       drawGlyph(fontData, glyph, x + glyphX, yPos - raiseBy, black);
+                     });
+}
 
-  uint32_t cp;
-  uint32_t prevCp = 0;
-  while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
-    if (utf8IsCombiningMark(cp)) {
-      const EpdGlyph* combiningGlyph = font.getGlyph(cp, style);
-      if (!combiningGlyph) continue;
-      const int raiseBy = combiningMark::raiseAboveBase(combiningGlyph->top, combiningGlyph->height, lastBaseTop);
-      const int combiningX = combiningMark::centerOver(lastBaseX, lastBaseLeft, lastBaseWidth, combiningGlyph->left,
-                                                       combiningGlyph->width);
-      renderCharImpl<TextRotation::None>(*this, renderMode, font, cp, combiningX, yPos - raiseBy, black, style);
-      continue;
+bool GfxRenderer::resolveGlyphRun(const int fontId, const char* text, const EpdFontFamily::Style style,
+                                  std::vector<PlacedGlyph>& out) const {
+  const EpdFontFamily* family = fontMap.find(fontId);
+  if (!family || text == nullptr) {
+    return false;
+  }
+  const auto& font = *family;
+  const EpdGlyph* glyphTable = font.getData(style)->glyph;
+
+  const size_t start = out.size();
+  int prevX = 0;
+  bool representable = true;
+  forEachPlacedGlyph(font, text, style, [&](const EpdGlyph* glyph, uint32_t, const int glyphX, const int raiseBy) {
+    if (!glyph || !representable) {
+      return;  // drawText() skips missing glyphs as well
+    }
+    const auto glyphIndex = static_cast<uint32_t>(glyph - glyphTable);
+    const int dx = glyphX - prevX;
+    if (glyphIndex > UINT16_MAX || dx < INT8_MIN || dx > INT8_MAX || raiseBy < INT8_MIN || raiseBy > INT8_MAX) {
+      representable = false;
+      return;
     }
+    out.push_back({static_cast<uint16_t>(glyphIndex), static_cast<int8_t>(dx), static_cast<int8_t>(raiseBy)});
+    prevX = glyphX;
+  });
 
-    cp = font.applyLigatures(cp, text, style);
+  if (!representable) {
+    out.resize(start);
+  }
+  return representable;
+}
 
-    // Differential rounding: snap (previous advance + current kern) as one unit so
-    // identical character pairs always produce the same pixel step regardless of
-    // where they fall on the line.
-    if (prevCp != 0) {
-      const auto kernFP = font.getKerning(prevCp, cp, style);  // 4.4 fixed-point kern
-      lastBaseX += fp4::toPixel(prevAdvanceFP + kernFP);       // snap 12.4 fixed-point to nearest pixel
+void GfxRenderer::drawGlyphRun(const int fontId, const int x, const int y, const char* text, const uint8_t* glyphs,
+                               const uint16_t glyphCount, const bool black, const EpdFontFamily::Style style) const {
+  if (fontCacheManager_ && fontCacheManager_->isScanning()) {
+    if (text != nullptr && *text != '\0') {
+      fontCacheManager_->recordText(text, fontId, style);
     }
+    return;
+  }
 
-    const EpdGlyph* glyph = font.getGlyph(cp, style);
-
-    lastBaseLeft = glyph ? glyph->left : 0;
-    lastBaseWidth = glyph ? glyph->width : 0;
-    lastBaseTop = glyph ? glyph->top : 0;
-    prevAdvanceFP = glyph ? glyph->advanceX : 0;  // 12.4 fixed-point
+  const EpdFontFamily* family = fontMap.find(fontId);
+  if (!family) {
+    LOG_ERR("GFX", "Font %d not found", fontId);
+    return;
+  }
+  const EpdFontData* fontData = family->getData(style);
 
-    renderCharImpl<TextRotation::None>(*this, renderMode, font, cp, lastBaseX, yPos, black, style);
-    prevCp = cp;
+  const int yPos = y + family->getData(EpdFontFamily::REGULAR)->ascender;  // Same as getFontAscenderSize()
+  int glyphX = x;
+  for (uint16_t i = 0; i < glyphCount; i++) {
+    PlacedGlyph placed;
+    memcpy(&placed, glyphs + i * sizeof(PlacedGlyph), sizeof(placed));
+    if (placed.glyphIndex >= fontData->glyphCount) {  // Runs come from the SD card, so don't trust them blindly
+      LOG_ERR("GFX", "Glyph index %u out of range", placed.glyphIndex);
+      return;
+    }
+    glyphX += placed.dx;
+    drawGlyph(fontData, &fontData->glyph[placed.glyphIndex], glyphX, yPos - placed.dy, black);
   }
 }
 
 void GfxRenderer::drawLine(int x1, int y1, int x2, int y2, const bool state) const {
   if (fontCacheManager_ && fontCacheManager_->isScanning()) return;
-  if (x1 == x2) {
-    if (y2 < y1) {
-      std::swap(y1, y2);
-    }
-    for (int y = y1; y <= y2; y++) {
-      drawPixel(x1, y, state);
-    }
-  } else if (y1 == y2) {
-    if (x2 < x1) {
-      std::swap(x1, x2);
-    }
-    for (int x = x1; x <= x2; x++) {
-      drawPixel(x, y1, state);
-    }
+  if (x1 == x2 || y1 == y2) {
+    fillRectSpans(std::min(x1, x2), std::min(y1, y2), std::abs(x2 - x1) + 1, std::abs(y2 - y1) + 1,
+                  state ? Color::Black : Color::White);
   } else {
     // Bresenham's line algorithm — integer arithmetic only
     int dx = x2 - x1;
@@ -440,59 +988,80 @@ void GfxRenderer::drawRoundedRect(const int x, const int y, const int width, con
 }
 
 void GfxRenderer::fillRect(const int x, const int y, const int width, const int height, const bool state) const {
-  for (int fillY = y; fillY < y + height; fillY++) {
-    drawLine(x, fillY, x + width - 1, fillY, state);
-  }
-}
-
-// NOTE: Those are in critical path, and need to be templated to avoid runtime checks for every pixel.
-// Any branching must be done outside the loops to avoid performance degradation.
-template <>
-void GfxRenderer::drawPixelDither<Color::Clear>(const int x, const int y) const {
-  // Do nothing
-}
-
-template <>
-void GfxRenderer::drawPixelDither<Color::Black>(const int x, const int y) const {
-  drawPixel(x, y, true);
-}
-
-template <>
-void GfxRenderer::drawPixelDither<Color::White>(const int x, const int y) const {
-  drawPixel(x, y, false);
+  fillRectSpans(x, y, width, height, state ? Color::Black : Color::White);
 }
 
-template <>
-void GfxRenderer::drawPixelDither<Color::LightGray>(const int x, const int y) const {
-  drawPixel(x, y, x % 2 == 0 && y % 2 == 0);
-}
-
-template <>
-void GfxRenderer::drawPixelDither<Color::DarkGray>(const int x, const int y) const {
-  drawPixel(x, y, (x + y) % 2 == 0);  // TODO: maybe find a better pattern?
+// Whether a dithered fill draws the logical pixel (x,y) black, any other pixel it covers white
+static inline bool ditherPixelBlack(const Color color, const int x, const int y) {
+  switch (color) {
+    case Color::Black:
+      return true;
+    case Color::LightGray:
+      return x % 2 == 0 && y % 2 == 0;
+    case Color::DarkGray:
+      return (x + y) % 2 == 0;  // TODO: maybe find a better pattern?
+    default:
+      return false;
+  }
 }
 
-void GfxRenderer::fillRectDither(const int x, const int y, const int width, const int height, Color color) const {
-  if (color == Color::Clear) {
-  } else if (color == Color::Black) {
-    fillRect(x, y, width, height, true);
-  } else if (color == Color::White) {
-    fillRect(x, y, width, height, false);
-  } else if (color == Color::LightGray) {
-    for (int fillY = y; fillY < y + height; fillY++) {
-      for (int fillX = x; fillX < x + width; fillX++) {
-        drawPixelDither<Color::LightGray>(fillX, fillY);
+void GfxRenderer::fillRectSpans(const int x, const int y, const int width, const int height, const Color color) const {
+  if (color == Color::Clear || (fontCacheManager_ && fontCacheManager_->isScanning())) return;
+  const int left = std::max(x, 0);
+  const int top = std::max(y, 0);
+  const int right = std::min(x + width, getScreenWidth()) - 1;
+  const int bottom = std::min(y + height, getScreenHeight()) - 1;
+  if (left > right || top > bottom) return;
+
+  // A logical rectangle is a panel rectangle in every orientation
+  int ax, ay, bx, by;
+  rotateCoordinates(orientation, left, top, &ax, &ay, panelWidth, panelHeight);
+  rotateCoordinates(orientation, right, bottom, &bx, &by, panelWidth, panelHeight);
+  const int phyLeft = std::min(ax, bx);
+  const int phyRight = std::max(ax, bx);
+  const int firstByte = phyLeft / 8;
+  const int lastByte = phyRight / 8;
+  const uint8_t firstMask = 0xFF >> (phyLeft % 8);
+  const uint8_t lastMask = static_cast<uint8_t>(0xFF << (7 - phyRight % 8));
+  const int evenX = phyLeft & ~1;
+
+  for (int phyY = std::min(ay, by); phyY <= std::max(ay, by); phyY++) {
+    // The dither patterns repeat every 2 pixels along a panel row: white bits of an even and an odd column, repeated
+    int lx, ly;
+    unrotateCoordinates(orientation, evenX, phyY, &lx, &ly, panelWidth, panelHeight);
+    const bool evenBlack = ditherPixelBlack(color, lx, ly);
+    unrotateCoordinates(orientation, evenX + 1, phyY, &lx, &ly, panelWidth, panelHeight);
+    const bool oddBlack = ditherPixelBlack(color, lx, ly);
+    const uint8_t white = (evenBlack ? 0x00 : 0xAA) | (oddBlack ? 0x00 : 0x55);
+
+    const uint32_t rowStart = static_cast<uint32_t>(phyY) * panelWidthBytes;
+    auto writeByte = [&](uint8_t& target, const uint8_t mask) {
+      target = static_cast<uint8_t>((target & ~mask) | (white & mask));
+    };
+    for (int b = firstByte; b <= lastByte; b++) {
+      const uint8_t mask = (b == firstByte ? firstMask : 0xFF) & (b == lastByte ? lastMask : 0xFF);
+      if (mask == 0xFF && b < lastByte) {
+        // Whole bytes up to the last one
+        const int run = lastByte - b + (lastMask == 0xFF ? 1 : 0);
+        memset(&frameBuffer[rowStart + b], white, run);
+        if (renderMode == GRAYSCALE_SPLIT) {
+          for (int k = 0; k < run; k++) msbPlaneByte(rowStart + b + k) = white;
+        }
+        b += run - 1;
+        continue;
       }
-    }
-  } else if (color == Color::DarkGray) {
-    for (int fillY = y; fillY < y + height; fillY++) {
-      for (int fillX = x; fillX < x + width; fillX++) {
-        drawPixelDither<Color::DarkGray>(fillX, fillY);
+      writeByte(frameBuffer[rowStart + b], mask);
+      if (renderMode == GRAYSCALE_SPLIT) {
+        writeByte(msbPlaneByte(rowStart + b), mask);
       }
     }
   }
 }
 
+void GfxRenderer::fillRectDither(const int x, const int y, const int width, const int height, Color color) const {
+  fillRectSpans(x, y, width, height, color);
+}
+
 template <Color color>
 void GfxRenderer::fillArc(const int maxRadius, const int cx, const int cy, const int xDir, const int yDir) const {
   if (maxRadius <= 0) return;
@@ -628,8 +1197,37 @@ void GfxRenderer::drawImage(const uint8_t bitmap[], const int x, const int y, co
   display.drawImage(bitmap, rotatedX, rotatedY, width, height);
 }
 
-void GfxRenderer::drawIcon(const uint8_t bitmap[], const int x, const int y, const int width, const int height) const {
-  display.drawImageTransparent(bitmap, y, getScreenWidth() - width - x, height, width);
+// Copies the rows of the icon's variant for the orientation into the frame buffer a byte at a time, shifted to the
+// icon's bit offset on the panel; white bits leave the frame as it is
+void GfxRenderer::drawIcon(const Icon& icon, const int x, const int y, const int width, const int height) const {
+  if (fontCacheManager_ && fontCacheManager_->isScanning()) return;
+  if (width <= 0 || height <= 0) return;
+
+  int x0, y0, x1, y1;
+  rotateCoordinates(orientation, x, y, &x0, &y0, panelWidth, panelHeight);
+  rotateCoordinates(orientation, x + width - 1, y + height - 1, &x1, &y1, panelWidth, panelHeight);
+  const int left = std::min(x0, x1);
+  const int top = std::min(y0, y1);
+  const int rows = std::max(y0, y1) - top + 1;
+  const int rowBytes = (std::max(x0, x1) - left + 8) / 8;
+
+  // Each icon byte lands across two frame buffer bytes unless the icon starts on a byte boundary
+  const int firstByte = left >> 3;  // Rounds down for icons hanging off the left edge too
+  const int shift = left & 7;
+  const uint8_t* bitmap = icon.bitmaps[orientation];
+  for (int row = std::max(0, -top); row < rows && top + row < panelHeight; row++) {
+    const uint8_t* src = bitmap + row * rowBytes;
+    uint8_t* dst = frameBuffer + static_cast<uint32_t>(top + row) * panelWidthBytes;
+    for (int i = 0; i < rowBytes; i++) {
+      const int col = firstByte + i;
+      if (col >= 0 && col < panelWidthBytes) {
+        dst[col] &= static_cast<uint8_t>(src[i] >> shift | ~(0xFF >> shift));
+      }
+      if (shift && col + 1 >= 0 && col + 1 < panelWidthBytes) {
+        dst[col + 1] &= static_cast<uint8_t>(src[i] << (8 - shift) | 0xFF >> shift);
+      }
+    }
+  }
 }
 
 void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, const int maxWidth, const int maxHeight,
@@ -669,6 +1267,7 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
     isScaled = true;
   }
   LOG_DBG("GFX", "Scaling by %f - %s", scale, isScaled ? "scaled" : "not scaled");
+  const BitmapScale scaleKind = !isScaled ? BitmapScale::None : scale == 0.5f ? BitmapScale::Half : BitmapScale::Any;
 
   // Calculate output row size (2 bits per pixel, packed into bytes)
   // IMPORTANT: Use int, not uint8_t, to avoid overflow for images > 1020 pixels wide
@@ -711,29 +1310,7 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
       continue;
     }
 
-    for (int bmpX = cropPixX; bmpX < bitmap.getWidth() - cropPixX; bmpX++) {
-      int screenX = bmpX - cropPixX;
-      if (isScaled) {
-        screenX = std::floor(screenX * scale);
-      }
-      screenX += x;  // the offset should not be scaled
-      if (screenX >= getScreenWidth()) {
-        break;
-      }
-      if (screenX < 0) {
-        continue;
-      }
-
-      const uint8_t val = outputRow[bmpX / 4] >> (6 - ((bmpX * 2) % 8)) & 0x3;
-
-      if (renderMode == BW && val < 3) {
-        drawPixel(screenX, screenY);
-      } else if (renderMode == GRAYSCALE_MSB && (val == 1 || val == 2)) {
-        drawPixel(screenX, screenY, false);
-      } else if (renderMode == GRAYSCALE_LSB && val == 1) {
-        drawPixel(screenX, screenY, false);
-      }
-    }
+    drawBitmapRow(outputRow, cropPixX, bitmap.getWidth() - cropPixX, x, screenY, scaleKind, scale, false);
   }
 
   free(outputRow);
@@ -752,6 +1329,7 @@ void GfxRenderer::drawBitmap1Bit(const Bitmap& bitmap, const int x, const int y,
     scale = std::min(scale, static_cast<float>(maxHeight) / static_cast<float>(bitmap.getHeight()));
     isScaled = true;
   }
+  const BitmapScale scaleKind = !isScaled ? BitmapScale::None : scale == 0.5f ? BitmapScale::Half : BitmapScale::Any;
 
   // For 1-bit BMP, output is still 2-bit packed (for consistency with readNextRow)
   const int outputRowSize = (bitmap.getWidth() + 3) / 4;
@@ -784,29 +1362,99 @@ void GfxRenderer::drawBitmap1Bit(const Bitmap& bitmap, const int x, const int y,
       continue;
     }
 
-    for (int bmpX = 0; bmpX < bitmap.getWidth(); bmpX++) {
-      int screenX = x + (isScaled ? static_cast<int>(std::floor(bmpX * scale)) : bmpX);
-      if (screenX >= getScreenWidth()) {
-        break;
-      }
-      if (screenX < 0) {
-        continue;
-      }
+    drawBitmapRow(outputRow, 0, bitmap.getWidth(), x, screenY, scaleKind, scale, true);
+  }
 
-      // Get 2-bit value (result of readNextRow quantization)
-      const uint8_t val = outputRow[bmpX / 4] >> (6 - ((bmpX * 2) % 8)) & 0x3;
+  free(outputRow);
+  free(rowBytes);
+}
 
-      // For 1-bit source: 0 or 1 -> map to black (0,1,2) or white (3)
-      // val < 3 means black pixel (draw it)
-      if (val < 3) {
-        drawPixel(screenX, screenY, true);
+namespace {
+// Bitmap levels (bit n for level n, 0 = black .. 3 = white) each render mode draws
+constexpr uint8_t BW_LEVELS = 0b0111;
+constexpr uint8_t LSB_LEVELS = 0b0010;
+constexpr uint8_t MSB_LEVELS = 0b0110;
+}  // namespace
+
+void GfxRenderer::drawBitmapRow(const uint8_t* row, const int srcStart, const int srcEnd, const int screenX,
+                                const int screenY, const BitmapScale scaleKind, const float scale,
+                                const bool oneBit) const {
+  if (renderMode == GRAYSCALE_SPLIT) {
+    // Touches both gray planes, rare enough to stay on the per-pixel path
+    const int screenWidth = getScreenWidth();
+    for (int i = srcStart; i < srcEnd; i++) {
+      const int offset = i - srcStart;
+      const int px = screenX + (scaleKind == BitmapScale::None ? offset : static_cast<int>(std::floor(offset * scale)));
+      if (px >= screenWidth) break;
+      if (px < 0) continue;
+      const uint8_t val = row[i / 4] >> (6 - ((i * 2) % 8)) & 0x3;
+      if (oneBit && val < 3) {
+        drawPixel(px, screenY, true);
+      } else if (!oneBit && (val == 1 || val == 2)) {
+        drawGrayPixel(px, screenY, val == 1);
       }
-      // White pixels (val == 3) are not drawn (leave background)
     }
+    return;
   }
 
-  free(outputRow);
-  free(rowBytes);
+  // 1-bit sources draw every non-white pixel black whatever the mode; white pixels leave the background
+  uint8_t levelMask = BW_LEVELS;
+  bool state = true;
+  if (!oneBit && renderMode != BW) {
+    levelMask = renderMode == GRAYSCALE_LSB ? LSB_LEVELS : MSB_LEVELS;
+    state = false;
+  }
+
+  switch (scaleKind) {
+    case BitmapScale::None:
+      return blitBitmapRow<BitmapScale::None>(row, srcStart, srcEnd, screenX, screenY, scale, levelMask, state);
+    case BitmapScale::Half:
+      return blitBitmapRow<BitmapScale::Half>(row, srcStart, srcEnd, screenX, screenY, scale, levelMask, state);
+    case BitmapScale::Any:
+      return blitBitmapRow<BitmapScale::Any>(row, srcStart, srcEnd, screenX, screenY, scale, levelMask, state);
+  }
+}
+
+template <GfxRenderer::BitmapScale scaleKind>
+void GfxRenderer::blitBitmapRow(const uint8_t* row, const int srcStart, const int srcEnd, const int screenX,
+                                const int screenY, const float scale, const uint8_t levelMask,
+                                const bool state) const {
+  // Every orientation maps a logical row to one panel row or column, so a pixel's position is the position of the
+  // row's first logical pixel plus a fixed step per logical x
+  int originX, originY, nextX, nextY;
+  rotateCoordinates(orientation, 0, screenY, &originX, &originY, panelWidth, panelHeight);
+  rotateCoordinates(orientation, 1, screenY, &nextX, &nextY, panelWidth, panelHeight);
+  const int stepX = nextX - originX;
+  const int stepY = nextY - originY;
+  const int screenWidth = getScreenWidth();
+
+  for (int i = srcStart; i < srcEnd; i++) {
+    const int offset = i - srcStart;
+    int px = screenX;
+    if constexpr (scaleKind == BitmapScale::None) {
+      px += offset;
+    } else if constexpr (scaleKind == BitmapScale::Half) {
+      px += offset >> 1;
+    } else {
+      px += static_cast<int>(std::floor(offset * scale));
+    }
+    if (px >= screenWidth) {
+      break;
+    }
+    if (px < 0 || !(levelMask >> (row[i >> 2] >> (6 - ((i & 3) << 1)) & 0x3) & 1)) {
+      continue;
+    }
+
+    const int phyX = originX + stepX * px;
+    const int phyY = originY + stepY * px;
+    const uint32_t byteIndex = static_cast<uint32_t>(phyY) * panelWidthBytes + (phyX >> 3);
+    const uint8_t bit = 0x80 >> (phyX & 7);
+    if (state) {
+      frameBuffer[byteIndex] &= ~bit;
+    } else {
+      frameBuffer[byteIndex] |= bit;
+    }
+  }
 }
 
 void GfxRenderer::fillPolygon(const int* xPoints, const int* yPoints, int numPoints, bool state) const {
@@ -894,27 +1542,199 @@ void GfxRenderer::invertScreen() const {
 void GfxRenderer::displayBuffer(const HalDisplay::RefreshMode refreshMode) const {
   auto elapsed = millis() - start_ms;
   LOG_DBG("GFX", "Time = %lu ms from clearScreen to displayBuffer", elapsed);
-  display.displayBuffer(refreshMode, fadingFix);
+  const bool shownKnown = shownTilesValid;
+  present(refreshMode, shownKnown, updateShownTiles());
+}
+
+void GfxRenderer::displayPage(const int fullRefreshPages) const {
+  const bool shownKnown = shownTilesValid;
+  const ChangedTiles changed = updateShownTiles();
+  const uint32_t budget = static_cast<uint32_t>(std::max(fullRefreshPages - 1, 0)) * shownTileHashes.size();
+  const auto refreshMode = fullRefreshDue || ghostedTiles + changed.count > budget ? HalDisplay::HALF_REFRESH
+                                                                                    : HalDisplay::FAST_REFRESH;
+  LOG_DBG("GFX", "displayPage: %d tiles changed, %lu ghosted of %lu", changed.count,
+          static_cast<unsigned long>(ghostedTiles), static_cast<unsigned long>(budget));
+  present(refreshMode, shownKnown, changed);
+}
+
+void GfxRenderer::present(const HalDisplay::RefreshMode refreshMode, const bool shownKnown,
+                          const ChangedTiles& changed) const {
+  noteDisplayStart();
+  // A fast refresh only has to send the panel the part of the frame that differs from the one it shows
+  if (refreshMode != HalDisplay::FAST_REFRESH || !shownKnown || !displayChangedWindow(changed)) {
+    display.displayBuffer(refreshMode, fadingFix);
+  }
+  if (refreshMode == HalDisplay::FAST_REFRESH) {
+    ghostedTiles += changed.count;
+  } else {
+    ghostedTiles = 0;
+    fullRefreshDue = false;
+  }
+}
+
+bool GfxRenderer::displayChangedWindow(const ChangedTiles& changed) const {
+  if (changed.count == 0) {
+    return false;
+  }
+  const int x = changed.minColumn * SHOWN_TILE_BYTES * 8;
+  const int y = changed.minRow * SHOWN_TILE_ROWS;
+  const int width = std::min<int>((changed.maxColumn + 1) * SHOWN_TILE_BYTES * 8, panelWidthBytes * 8) - x;
+  const int height = std::min<int>((changed.maxRow + 1) * SHOWN_TILE_ROWS, panelHeight) - y;
+  // A window over most of the panel saves little SPI traffic, and a full refresh settles the whole screen evenly
+  constexpr int MAX_WINDOW_PERCENT = 60;
+  if (width * height * 100 > static_cast<int>(panelWidth) * panelHeight * MAX_WINDOW_PERCENT ||
+      !display.displayWindow(x, y, width, height, fadingFix)) {
+    return false;
+  }
+  LOG_DBG("GFX", "Sent a window %dx%d at (%d, %d)", width, height, x, y);
+  return true;
+}
+
+void GfxRenderer::noteDisplayStart() const {
+  const uint32_t pressUs = inputTimeUs;
+  if (pressUs == 0) {
+    return;
+  }
+  // Cleared without a lock; a press stamped in between is dropped, which only loses one measurement
+  inputTimeUs = 0;
+  inputLatencyUs = micros() - pressUs;
+  LOG_DBG("GFX", "Input to display: %lu ms", static_cast<unsigned long>(inputLatencyUs / 1000));
+}
+
+uint32_t GfxRenderer::hashFrameTile(const int tileRow, const int tileColumn) const {
+  const int firstRow = tileRow * SHOWN_TILE_ROWS;
+  const int lastRow = std::min<int>(firstRow + SHOWN_TILE_ROWS, panelHeight);
+  const int firstByte = tileColumn * SHOWN_TILE_BYTES;
+  const int lastByte = std::min<int>(firstByte + SHOWN_TILE_BYTES, panelWidthBytes);
+  uint32_t hash = 2166136261u;  // FNV-1a
+  for (int row = firstRow; row < lastRow; row++) {
+    const uint8_t* bytes = frameBuffer + static_cast<uint32_t>(row) * panelWidthBytes;
+    for (int i = firstByte; i < lastByte; i++) {
+      hash = (hash ^ bytes[i]) * 16777619u;
+    }
+  }
+  return hash;
+}
+
+GfxRenderer::ChangedTiles GfxRenderer::updateShownTiles() const {
+  const int tileRows = static_cast<int>(shownTileHashes.size()) / std::max(shownTileColumns, 1);
+  ChangedTiles changed = {0, tileRows, -1, shownTileColumns, -1};
+  for (int row = 0; row < tileRows; row++) {
+    for (int column = 0; column < shownTileColumns; column++) {
+      const uint32_t hash = hashFrameTile(row, column);
+      uint32_t& shown = shownTileHashes[row * shownTileColumns + column];
+      if (!shownTilesValid || hash != shown) {
+        shown = hash;
+        changed.count++;
+        changed.minRow = std::min(changed.minRow, row);
+        changed.maxRow = std::max(changed.maxRow, row);
+        changed.minColumn = std::min(changed.minColumn, column);
+        changed.maxColumn = std::max(changed.maxColumn, column);
+      }
+    }
+  }
+  shownTilesValid = !shownTileHashes.empty();
+  return changed;
+}
+
+void GfxRenderer::displayChanges() const {
+  const bool shownKnown = shownTilesValid;
+  const ChangedTiles changed = updateShownTiles();
+  if (shownKnown && changed.count == 0) {
+    LOG_DBG("GFX", "displayChanges: nothing changed");
+    return;
+  }
+  present(HalDisplay::FAST_REFRESH, shownKnown, changed);
+}
+
+bool GfxRenderer::displayRegion(const int x, const int y, const int width, const int height) const {
+  if (width <= 0 || height <= 0) {
+    return false;
+  }
+  int x0, y0, x1, y1;
+  rotateCoordinates(orientation, x, y, &x0, &y0, panelWidth, panelHeight);
+  rotateCoordinates(orientation, x + width - 1, y + height - 1, &x1, &y1, panelWidth, panelHeight);
+  // Whole bytes of the panel, clamped to it
+  const int left = std::max(0, std::min(x0, x1)) & ~7;
+  const int right = std::min<int>(panelWidth, (std::max(x0, x1) + 8) & ~7);
+  const int top = std::max(0, std::min(y0, y1));
+  const int bottom = std::min<int>(panelHeight, std::max(y0, y1) + 1);
+  if (left >= right || top >= bottom) {
+    return false;
+  }
+  noteDisplayStart();
+  if (!display.displayWindow(left, top, right - left, bottom - top, fadingFix)) {
+    return false;
+  }
+  // The panel now shows part of a frame it otherwise does not
+  shownTilesValid = false;
+  return true;
 }
 
 std::string GfxRenderer::truncatedText(const int fontId, const char* text, const int maxWidth,
                                        const EpdFontFamily::Style style) const {
   if (!text || maxWidth <= 0) return "";
 
-  std::string item = text;
   // U+2026 HORIZONTAL ELLIPSIS (UTF-8: 0xE2 0x80 0xA6)
   const char* ellipsis = "\xe2\x80\xa6";
-  int textWidth = getTextWidth(fontId, item.c_str(), style);
-  if (textWidth <= maxWidth) {
-    // Text fits, return as is
+  const size_t length = strlen(text);
+  const auto result = [&](const size_t kept, const bool truncated) {
+    std::string item(text, kept);
+    if (truncated) item += ellipsis;
     return item;
-  }
+  };
 
-  while (!item.empty() && getTextWidth(fontId, (item + ellipsis).c_str(), style) >= maxWidth) {
-    utf8RemoveLastChar(item);
+  const bool cacheable = length <= UINT16_MAX;
+  uint32_t hash = 2166136261u;  // FNV-1a
+  for (size_t i = 0; cacheable && i < length; i++) {
+    hash = (hash ^ static_cast<uint8_t>(text[i])) * 16777619u;
+  }
+  TruncationEntry* slot = &truncationCache[0];
+  for (auto& entry : truncationCache) {
+    if (cacheable && entry.lastUse != 0 && entry.textHash == hash && entry.textLength == length &&
+        entry.fontId == fontId && entry.maxWidth == maxWidth && entry.style == style) {
+      entry.lastUse = ++truncationClock;
+      return result(entry.keptLength, entry.truncated);
+    }
+    if (entry.lastUse < slot->lastUse) slot = &entry;
+  }
+
+  size_t kept = length;
+  bool truncated = false;
+  if (getTextWidth(fontId, text, style) > maxWidth) {
+    // The width of a prefix with the ellipsis only grows with the prefix, so the longest prefix that stays narrower
+    // than maxWidth is binary searched over the codepoint boundaries instead of dropping a codepoint at a time
+    const auto isContinuation = [&](const size_t i) { return (static_cast<uint8_t>(text[i]) & 0xC0) == 0x80; };
+    std::string candidate;
+    candidate.reserve(length + strlen(ellipsis));
+    size_t fits = 0;  // The empty prefix is taken even if the ellipsis alone doesn't fit
+    size_t mayFit = length;
+    while (fits < mayFit) {
+      size_t mid = fits + (mayFit - fits + 1) / 2;
+      while (mid > fits && isContinuation(mid)) mid--;
+      if (mid == fits) {
+        // Next boundary after fits, which is at most mayFit
+        mid = fits + 1;
+        while (mid < mayFit && isContinuation(mid)) mid++;
+      }
+      candidate.assign(text, mid);
+      candidate += ellipsis;
+      if (getTextWidth(fontId, candidate.c_str(), style) < maxWidth) {
+        fits = mid;
+      } else {
+        mayFit = mid - 1;
+        while (mayFit > fits && isContinuation(mayFit)) mayFit--;
+      }
+    }
+    kept = fits;
+    truncated = true;
   }
 
-  return item.empty() ? ellipsis : item + ellipsis;
+  if (cacheable) {
+    *slot = {++truncationClock, hash, static_cast<uint16_t>(length), static_cast<uint16_t>(kept), fontId, maxWidth,
+             static_cast<uint8_t>(style), truncated};
+  }
+  return result(kept, truncated);
 }
 
 std::vector<std::string> GfxRenderer::wrappedText(const int fontId, const char* text, const int maxWidth,
@@ -1011,21 +1831,28 @@ int GfxRenderer::getScreenHeight() const {
 }
 
 int GfxRenderer::getSpaceWidth(const int fontId, const EpdFontFamily::Style style) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
+  return getSpaceWidth(resolveFont(fontId), style);
+}
+
+int GfxRenderer::getSpaceWidth(const FontHandle& handle, const EpdFontFamily::Style style) const {
+  if (!handle.family) {
+    LOG_ERR("GFX", "Font %d not found", handle.id);
     return 0;
   }
 
-  const EpdGlyph* spaceGlyph = fontIt->second.getGlyph(' ', style);
+  const EpdGlyph* spaceGlyph = handle.family->getGlyph(' ', style);
   return spaceGlyph ? fp4::toPixel(spaceGlyph->advanceX) : 0;  // snap 12.4 fixed-point to nearest pixel
 }
 
 int GfxRenderer::getSpaceAdvance(const int fontId, const uint32_t leftCp, const uint32_t rightCp,
                                  const EpdFontFamily::Style style) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) return 0;
-  const auto& font = fontIt->second;
+  return getSpaceAdvance(resolveFont(fontId), leftCp, rightCp, style);
+}
+
+int GfxRenderer::getSpaceAdvance(const FontHandle& handle, const uint32_t leftCp, const uint32_t rightCp,
+                                 const EpdFontFamily::Style style) const {
+  if (!handle.family) return 0;
+  const auto& font = *handle.family;
   const EpdGlyph* spaceGlyph = font.getGlyph(' ', style);
   const int32_t spaceAdvanceFP = spaceGlyph ? static_cast<int32_t>(spaceGlyph->advanceX) : 0;
   // Combine space advance + flanking kern into one fixed-point sum before snapping.
@@ -1037,16 +1864,23 @@ int GfxRenderer::getSpaceAdvance(const int fontId, const uint32_t leftCp, const
 
 int GfxRenderer::getKerning(const int fontId, const uint32_t leftCp, const uint32_t rightCp,
                             const EpdFontFamily::Style style) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) return 0;
-  const int kernFP = fontIt->second.getKerning(leftCp, rightCp, style);  // 4.4 fixed-point
+  return getKerning(resolveFont(fontId), leftCp, rightCp, style);
+}
+
+int GfxRenderer::getKerning(const FontHandle& handle, const uint32_t leftCp, const uint32_t rightCp,
+                            const EpdFontFamily::Style style) const {
+  if (!handle.family) return 0;
+  const int kernFP = handle.family->getKerning(leftCp, rightCp, style);  // 4.4 fixed-point
   return fp4::toPixel(kernFP);                                           // snap 4.4 fixed-point to nearest pixel
 }
 
 int GfxRenderer::getTextAdvanceX(const int fontId, const char* text, EpdFontFamily::Style style) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
+  return getTextAdvanceX(resolveFont(fontId), text, style);
+}
+
+int GfxRenderer::getTextAdvanceX(const FontHandle& handle, const char* text, EpdFontFamily::Style style) const {
+  if (!handle.family) {
+    LOG_ERR("GFX", "Font %d not found", handle.id);
     return 0;
   }
 
@@ -1054,7 +1888,7 @@ int GfxRenderer::getTextAdvanceX(const int fontId, const char* text, EpdFontFami
   uint32_t prevCp = 0;
   int widthPx = 0;
   int32_t prevAdvanceFP = 0;  // 12.4 fixed-point: prev glyph's advance + next kern for snap
-  const auto& font = fontIt->second;
+  const auto& font = *handle.family;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
     if (utf8IsCombiningMark(cp)) {
       continue;
@@ -1077,32 +1911,32 @@ int GfxRenderer::getTextAdvanceX(const int fontId, const char* text, EpdFontFami
 }
 
 int GfxRenderer::getFontAscenderSize(const int fontId) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
+  const EpdFontFamily* family = fontMap.find(fontId);
+  if (!family) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return 0;
   }
 
-  return fontIt->second.getData(EpdFontFamily::REGULAR)->ascender;
+  return family->getData(EpdFontFamily::REGULAR)->ascender;
 }
 
 int GfxRenderer::getLineHeight(const int fontId) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
+  const EpdFontFamily* family = fontMap.find(fontId);
+  if (!family) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return 0;
   }
 
-  return fontIt->second.getData(EpdFontFamily::REGULAR)->advanceY;
+  return family->getData(EpdFontFamily::REGULAR)->advanceY;
 }
 
 int GfxRenderer::getTextHeight(const int fontId) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
+  const EpdFontFamily* family = fontMap.find(fontId);
+  if (!family) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return 0;
   }
-  return fontIt->second.getData(EpdFontFamily::REGULAR)->ascender;
+  return family->getData(EpdFontFamily::REGULAR)->ascender;
 }
 
 void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y, const char* text, const bool black,
@@ -1112,13 +1946,13 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
     return;
   }
 
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
+  const EpdFontFamily* family = fontMap.find(fontId);
+  if (!family) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return;
   }
 
-  const auto& font = fontIt->second;
+  const auto& font = *family;
 
   int lastBaseY = y;
   int lastBaseLeft = 0;
@@ -1172,7 +2006,10 @@ void GfxRenderer::copyGrayscaleLsbBuffers() const { display.copyGrayscaleLsbBuff
 
 void GfxRenderer::copyGrayscaleMsbBuffers() const { display.copyGrayscaleMsbBuffers(frameBuffer); }
 
-void GfxRenderer::displayGrayBuffer() const { display.displayGrayBuffer(fadingFix); }
+void GfxRenderer::displayGrayBuffer() const {
+  display.displayGrayBuffer(fadingFix);
+  shownTilesValid = false;  // The panel now shows gray levels the frame buffer doesn't hold
+}
 
 void GfxRenderer::freeBwBufferChunks() {
   for (auto& bwBufferChunk : bwBufferChunks) {
@@ -1183,13 +2020,164 @@ void GfxRenderer::freeBwBufferChunks() {
   }
 }
 
+void GfxRenderer::freeBwPackedChunks() {
+  for (const auto& chunk : bwPackedChunks) {
+    free(chunk.data);
+  }
+  bwPackedChunks.clear();
+}
+
+void GfxRenderer::freeGrayMsbBands() {
+  for (const auto& band : grayMsbPacked) {
+    free(band.data);
+  }
+  grayMsbPacked.clear();
+  free(grayMsbBand);
+  grayMsbBand = nullptr;
+  grayBandRows = 0;
+  grayBandCols = 0;
+}
+
+void GfxRenderer::panelRectOfRows(const int top, const int bottom, uint16_t* row, uint16_t* col, uint16_t* rows,
+                                  uint16_t* cols) const {
+  int x0, y0, x1, y1;
+  rotateCoordinates(orientation, 0, top, &x0, &y0, panelWidth, panelHeight);
+  rotateCoordinates(orientation, getScreenWidth() - 1, bottom - 1, &x1, &y1, panelWidth, panelHeight);
+  *row = std::min(y0, y1);
+  *rows = std::max(y0, y1) - *row + 1;
+  *col = std::min(x0, x1) / 8;
+  *cols = std::max(x0, x1) / 8 - *col + 1;
+}
+
+/**
+ * Switches to GRAYSCALE_SPLIT: renders write the LSB plane into the frame buffer and the MSB plane into a band
+ * buffer, so both come out of a single pass. The page is drawn once per band (beginGrayscaleBand() and
+ * endGrayscaleBand()); writes to the MSB plane outside the band are dropped, and each finished band is packed, which
+ * for text is a few hundred bytes. Both planes start cleared (like clearScreen(0x00)).
+ * Returns false, leaving the render mode alone, if the band buffer can't be allocated.
+ */
+bool GfxRenderer::beginGrayscaleSplit() {
+  freeGrayMsbBands();
+  grayBandsLost = false;
+
+  // Bands are whole bytes of the panel in every orientation when they are a multiple of 8 rows high
+  uint16_t row, col, rows, cols;
+  panelRectOfRows(0, 8, &row, &col, &rows, &cols);
+  const size_t bytesPer8Rows = static_cast<size_t>(rows) * cols;
+  grayBandHeight = 8 * static_cast<int>(std::max<size_t>(1, GRAY_BAND_BYTES / bytesPer8Rows));
+  const size_t bandSize = bytesPer8Rows * (grayBandHeight / 8);
+
+  grayMsbBand = static_cast<uint8_t*>(malloc(bandSize));
+  if (!grayMsbBand && fontCacheManager_) {
+    // The page's glyphs are already prewarmed, so the cached font groups and rotated glyphs can make room
+    fontCacheManager_->releaseMemory();
+    freeRotatedGlyphs();
+    grayMsbBand = static_cast<uint8_t*>(malloc(bandSize));
+  }
+  if (!grayMsbBand) {
+    LOG_DBG("GFX", "No memory for a split grayscale band (%zu bytes)", bandSize);
+    return false;
+  }
+  grayMsbPacked.reserve(getGrayscaleBandCount());
+
+  clearScreen(0x00);
+  renderMode = GRAYSCALE_SPLIT;
+  return true;
+}
+
+int GfxRenderer::getGrayscaleBandCount() const {
+  return grayBandHeight > 0 ? (getScreenHeight() + grayBandHeight - 1) / grayBandHeight : 0;
+}
+
+void GfxRenderer::beginGrayscaleBand(const int band, int* top, int* bottom) {
+  *top = band * grayBandHeight;
+  *bottom = std::min(*top + grayBandHeight, getScreenHeight());
+  panelRectOfRows(*top, *bottom, &grayBandRow, &grayBandCol, &grayBandRows, &grayBandCols);
+  memset(grayMsbBand, 0, static_cast<size_t>(grayBandRows) * grayBandCols);
+}
+
+void GfxRenderer::endGrayscaleBand() {
+  const size_t bandSize = static_cast<size_t>(grayBandRows) * grayBandCols;
+  PackedGrayBand packed = {nullptr, 0, grayBandRow, grayBandCol, grayBandRows, grayBandCols};
+  // Packed into the band buffer's size at most, beyond that the band is kept as it is
+  uint8_t* data = static_cast<uint8_t*>(malloc(bandSize));
+  size_t length = 0;
+  const auto putPacket = [&](const uint8_t* packet, const size_t packetLength) {
+    if (length + packetLength > bandSize) return false;
+    memcpy(data + length, packet, packetLength);
+    length += packetLength;
+    return true;
+  };
+  if (data && !FramePackBits(bandSize, grayBandCols, false).encode(grayMsbBand, putPacket)) {
+    memcpy(data, grayMsbBand, bandSize);
+    length = 0;
+  }
+  if (!data) {
+    LOG_ERR("GFX", "!! No memory to keep a split grayscale band");
+    grayBandsLost = true;
+  } else {
+    auto* shrunk = static_cast<uint8_t*>(realloc(data, length ? length : bandSize));
+    packed.data = shrunk ? shrunk : data;
+    packed.length = static_cast<uint16_t>(length);
+    grayMsbPacked.push_back(packed);
+  }
+  // No band until the next beginGrayscaleBand(), all MSB writes go to the sink
+  grayBandRows = 0;
+  grayBandCols = 0;
+}
+
+/**
+ * Sends both planes of a GRAYSCALE_SPLIT render to the display and frees the band buffers. The MSB plane is put
+ * together from its bands in the frame buffer, which is left holding it; restoreBwBuffer() or a re-render puts the BW
+ * image back as after a two-pass render.
+ */
+bool GfxRenderer::copyGrayscaleSplitBuffers() {
+  if (!grayMsbBand || grayBandsLost) {
+    LOG_ERR("GFX", "!! No complete split grayscale render to copy");
+    freeGrayMsbBands();
+    return false;
+  }
+
+  display.copyGrayscaleLsbBuffers(frameBuffer);
+  memset(frameBuffer, 0, frameBufferSize);
+  for (const auto& band : grayMsbPacked) {
+    const size_t bandSize = static_cast<size_t>(band.rows) * band.cols;
+    const uint8_t* plane = band.data;
+    if (band.length > 0) {
+      if (FramePackBits(bandSize, band.cols, false).decode(band.data, band.length, grayMsbBand, 0) != bandSize) {
+        LOG_ERR("GFX", "!! Split grayscale band is corrupt");
+        continue;
+      }
+      plane = grayMsbBand;
+    }
+    for (uint16_t r = 0; r < band.rows; r++) {
+      memcpy(frameBuffer + static_cast<size_t>(band.row + r) * panelWidthBytes + band.col, plane + r * band.cols,
+             band.cols);
+    }
+  }
+  display.copyGrayscaleMsbBuffers(frameBuffer);
+  freeGrayMsbBands();
+  return true;
+}
+
 /**
  * This should be called before grayscale buffers are populated.
  * A `restoreBwBuffer` call should always follow the grayscale render if this method was called.
- * Uses chunked allocation to avoid needing 48KB of contiguous memory.
+ * Text pages are mostly white and are kept compressed, in a few KB; other frames are copied into chunks, which
+ * avoids needing 48KB of contiguous memory.
  * Returns true if buffer was stored successfully, false if allocation failed.
  */
 bool GfxRenderer::storeBwBuffer() {
+  if (!bwPackedChunks.empty()) {
+    LOG_ERR("GFX", "!! Packed BW buffer already stored - this is likely a bug, freeing it");
+    freeBwPackedChunks();
+  }
+  if (storePackedBwBuffer()) {
+    return true;
+  }
+  // Caches make way for the grayscale render, with a chunk to spare for it
+  MemoryBudget::reserve(frameBufferSize + BW_BUFFER_CHUNK_SIZE, BW_BUFFER_CHUNK_SIZE);
+
   // Allocate and copy each chunk
   for (size_t i = 0; i < bwBufferChunks.size(); i++) {
     // Check if any chunks are already allocated
@@ -1205,6 +2193,7 @@ bool GfxRenderer::storeBwBuffer() {
 
     if (!bwBufferChunks[i]) {
       LOG_ERR("GFX", "!! Failed to allocate BW buffer chunk %zu (%zu bytes)", i, chunkSize);
+      HalHeapTrace::mark("storeBwBuffer failed");
       // Free previously allocated chunks
       freeBwBufferChunks();
       return false;
@@ -1217,12 +2206,56 @@ bool GfxRenderer::storeBwBuffer() {
   return true;
 }
 
+// Walks the frame by panel columns in portrait, where they follow the lines of text
+bool GfxRenderer::storePackedBwBuffer() {
+  const bool byColumns = orientation == Portrait || orientation == PortraitInverted;
+  const size_t maxPacked = frameBufferSize / 2;
+  size_t packed = 0;
+  const auto putPacket = [&](const uint8_t* packet, const size_t length) {
+    packed += length;
+    if (packed > maxPacked) return false;
+    if (bwPackedChunks.empty() || bwPackedChunks.back().length + length > BW_PACKED_CHUNK_SIZE) {
+      auto* data = static_cast<uint8_t*>(malloc(BW_PACKED_CHUNK_SIZE));
+      if (!data) return false;
+      bwPackedChunks.push_back({data, 0});
+    }
+    auto& chunk = bwPackedChunks.back();
+    memcpy(chunk.data + chunk.length, packet, length);
+    chunk.length += length;
+    return true;
+  };
+  const bool stored = FramePackBits(frameBufferSize, panelWidthBytes, byColumns).encode(frameBuffer, putPacket);
+  if (!stored) {
+    freeBwPackedChunks();
+    return false;
+  }
+  bwPackedByColumns = byColumns;
+  LOG_DBG("GFX", "Stored BW buffer packed in %zu bytes (%zu chunks)", packed, bwPackedChunks.size());
+  return true;
+}
+
 /**
  * This can only be called if `storeBwBuffer` was called prior to the grayscale render.
  * It should be called to restore the BW buffer state after grayscale rendering is complete.
  * Uses chunked restoration to match chunked storage.
  */
 void GfxRenderer::restoreBwBuffer() {
+  if (!bwPackedChunks.empty()) {
+    const FramePackBits codec(frameBufferSize, panelWidthBytes, bwPackedByColumns);
+    size_t restored = 0;
+    for (const auto& chunk : bwPackedChunks) {
+      restored = codec.decode(chunk.data, chunk.length, frameBuffer, restored);
+      if (restored == SIZE_MAX) break;
+    }
+    if (restored != frameBufferSize) {
+      LOG_ERR("GFX", "!! Packed BW buffer is corrupt");
+    }
+    display.cleanupGrayscaleBuffers(frameBuffer);
+    freeBwPackedChunks();
+    LOG_DBG("GFX", "Restored and freed packed BW buffer");
+    return;
+  }
+
   // Check if all chunks are allocated
   bool missingChunks = false;
   for (const auto& bwBufferChunk : bwBufferChunks) {
@@ -1249,6 +2282,88 @@ void GfxRenderer::restoreBwBuffer() {
   LOG_DBG("GFX", "Restored and freed BW buffer chunks");
 }
 
+bool GfxRenderer::panelRectOf(const int x, const int y, const int width, const int height, int* phyX0, int* phyY0,
+                              int* phyX1, int* phyY1) const {
+  if (width <= 0 || height <= 0 || x < 0 || y < 0 || x + width > getScreenWidth() || y + height > getScreenHeight()) {
+    return false;
+  }
+  int ax, ay, bx, by;
+  rotateCoordinates(orientation, x, y, &ax, &ay, panelWidth, panelHeight);
+  rotateCoordinates(orientation, x + width - 1, y + height - 1, &bx, &by, panelWidth, panelHeight);
+  *phyX0 = std::min(ax, bx);
+  *phyY0 = std::min(ay, by);
+  *phyX1 = std::max(ax, bx);
+  *phyY1 = std::max(ay, by);
+  return true;
+}
+
+bool GfxRenderer::captureLayer(const int x, const int y, const int width, const int height, Layer& layer) const {
+  int phyX0, phyY0, phyX1, phyY1;
+  if (renderMode != BW || !frameBuffer || !panelRectOf(x, y, width, height, &phyX0, &phyY0, &phyX1, &phyY1)) {
+    return false;
+  }
+  // The panel rows of the rectangle, in whole bytes, gathered into one block to pack
+  const size_t cols = phyX1 / 8 - phyX0 / 8 + 1;
+  const size_t rows = phyY1 - phyY0 + 1;
+  auto* block = static_cast<uint8_t*>(malloc(rows * cols));
+  if (!block) {
+    return false;
+  }
+  for (size_t row = 0; row < rows; row++) {
+    memcpy(block + row * cols, frameBuffer + (phyY0 + row) * panelWidthBytes + phyX0 / 8, cols);
+  }
+  layer.packed.clear();
+  FramePackBits(rows * cols, cols, false).encode(block, [&layer](const uint8_t* packet, const size_t length) {
+    layer.packed.insert(layer.packed.end(), packet, packet + length);
+    return true;
+  });
+  free(block);
+  layer.packed.shrink_to_fit();
+  layer.x = x;
+  layer.y = y;
+  layer.width = width;
+  layer.height = height;
+  layer.orientation = orientation;
+  return true;
+}
+
+bool GfxRenderer::blitLayer(const Layer& layer) const {
+  int phyX0, phyY0, phyX1, phyY1;
+  if (renderMode != BW || !frameBuffer || layer.orientation != orientation ||
+      !panelRectOf(layer.x, layer.y, layer.width, layer.height, &phyX0, &phyY0, &phyX1, &phyY1)) {
+    return false;
+  }
+  const size_t cols = phyX1 / 8 - phyX0 / 8 + 1;
+  const size_t rows = phyY1 - phyY0 + 1;
+  auto* block = static_cast<uint8_t*>(malloc(rows * cols));
+  if (!block) {
+    return false;
+  }
+  const FramePackBits codec(rows * cols, cols, false);
+  if (codec.decode(layer.packed.data(), layer.packed.size(), block, 0) != rows * cols) {
+    LOG_ERR("GFX", "!! Layer is corrupt");
+    free(block);
+    return false;
+  }
+  // The edge bytes are shared with the pixels either side of the rectangle, which are left as they are
+  const uint8_t firstMask = 0xFF >> (phyX0 % 8);
+  const uint8_t lastMask = 0xFF << (7 - phyX1 % 8);
+  for (size_t row = 0; row < rows; row++) {
+    uint8_t* dst = frameBuffer + (phyY0 + row) * panelWidthBytes + phyX0 / 8;
+    const uint8_t* src = block + row * cols;
+    if (cols == 1) {
+      const uint8_t mask = firstMask & lastMask;
+      dst[0] = (dst[0] & ~mask) | (src[0] & mask);
+      continue;
+    }
+    dst[0] = (dst[0] & ~firstMask) | (src[0] & firstMask);
+    memcpy(dst + 1, src + 1, cols - 2);
+    dst[cols - 1] = (dst[cols - 1] & ~lastMask) | (src[cols - 1] & lastMask);
+  }
+  free(block);
+  return true;
+}
+
 /**
  * Cleanup grayscale buffers using the current frame buffer.
  * Use this when BW buffer was re-rendered instead of stored/restored.
@@ -6,19 +6,30 @@
 class FontCacheManager;
 
 #include <cstring>
-#include <map>
 #include <string>
 #include <vector>
 
 #include "Bitmap.h"
+#include "FontTable.h"
 
 // Color representation: uint8_t mapped to 4x4 Bayer matrix dithering levels
 // 0 = transparent, 1-16 = gray levels (white to black)
 enum Color : uint8_t { Clear = 0x00, White = 0x01, LightGray = 0x05, DarkGray = 0x0A, Black = 0x10 };
 
+// A glyph placed at layout time, after ligature substitution and kerning (see GfxRenderer::resolveGlyphRun)
+struct PlacedGlyph {
+  uint16_t glyphIndex;  // Into EpdFontData::glyph of the style's font
+  int8_t dx;            // Pixel step from the previous glyph's origin, or from the start of the text
+  int8_t dy;            // Pixels the glyph is raised by (combining marks)
+};
+static_assert(sizeof(PlacedGlyph) == 4, "PlacedGlyph is stored as-is in section files");
+
 class GfxRenderer {
  public:
-  enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB };
+  // GRAYSCALE_SPLIT renders both gray planes in one pass over bands of the screen, see beginGrayscaleSplit(). Only the
+  // text, drawPixel() based primitives and drawBitmap() support it; images drawn through DirectPixelWriter need the
+  // separate LSB/MSB passes.
+  enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB, GRAYSCALE_SPLIT };
 
   // Logical screen orientation from the perspective of callers
   enum Orientation {
@@ -28,6 +39,12 @@ class GfxRenderer {
     LandscapeCounterClockwise  // 800x480 logical coordinates, native panel orientation
   };
 
+  // A 1-bit icon from scripts/convert_icon.py, pre-rotated: for each Orientation, the icon as the panel sees it, rows
+  // packed MSB first and padded to whole bytes, 1 for white (left alone) and 0 for black
+  struct Icon {
+    const uint8_t* bitmaps[4];
+  };
+
  private:
   static constexpr size_t BW_BUFFER_CHUNK_SIZE = 8000;  // 8KB chunks to allow for non-contiguous memory
 
@@ -41,25 +58,164 @@ class GfxRenderer {
   uint16_t panelWidthBytes = HalDisplay::DISPLAY_WIDTH_BYTES;
   uint32_t frameBufferSize = HalDisplay::BUFFER_SIZE;
   std::vector<uint8_t*> bwBufferChunks;
-  std::map<int, EpdFontFamily> fontMap;
+  // storeBwBuffer() keeps the BW frame PackBits compressed (see FramePackBits) when it packs into at most half its
+  // size, in chunks that each end on a packet boundary; bwBufferChunks are the plain copy otherwise
+  static constexpr size_t BW_PACKED_CHUNK_SIZE = 4096;
+  struct PackedChunk {
+    uint8_t* data;
+    uint16_t length;
+  };
+  std::vector<PackedChunk> bwPackedChunks;
+  bool bwPackedByColumns = false;
+  // MSB plane of a GRAYSCALE_SPLIT render. Only the band being drawn is held in full (grayMsbBand, a panel rectangle
+  // of grayBandCols bytes by grayBandRows rows); finished bands are kept PackBits compressed.
+  static constexpr size_t GRAY_BAND_BYTES = 6 * 1024;
+  struct PackedGrayBand {
+    uint8_t* data;
+    uint16_t length;
+    uint16_t row;
+    uint16_t col;
+    uint16_t rows;
+    uint16_t cols;
+  };
+  std::vector<PackedGrayBand> grayMsbPacked;
+  uint8_t* grayMsbBand = nullptr;
+  uint16_t grayBandRow = 0;
+  uint16_t grayBandCol = 0;
+  uint16_t grayBandRows = 0;
+  uint16_t grayBandCols = 0;
+  int grayBandHeight = 0;  // Logical rows per band
+  bool grayBandsLost = false;  // A band could not be kept, the split render can't be shown
+  mutable uint8_t grayMsbSink = 0;  // Takes the MSB writes outside the current band
+  FontTable fontMap;
+
+  // Hashes of the frame last sent to the panel, per tile of SHOWN_TILE_ROWS rows x SHOWN_TILE_BYTES bytes, so
+  // a fast refresh can send only the region that differs. Invalid after a grayscale display.
+  static constexpr int SHOWN_TILE_ROWS = 8;
+  static constexpr int SHOWN_TILE_BYTES = 8;
+  mutable std::vector<uint32_t> shownTileHashes;
+  mutable bool shownTilesValid = false;
+  int shownTileColumns = 0;
+  // Tiles changed by fast refreshes since the last half or full one: an estimate of the ghosting left on the panel,
+  // which only a slow refresh clears
+  mutable uint32_t ghostedTiles = 0;
+  mutable bool fullRefreshDue = false;
 
   // Mutable because drawText() is const but needs to delegate scan-mode
   // recording to the (non-const) FontCacheManager. Same pragmatic compromise
   // as before, concentrated in a single pointer instead of four fields.
   mutable FontCacheManager* fontCacheManager_ = nullptr;
 
+  // Recent truncatedText() results, kept as the length of the prefix shown, so list rows redrawn unchanged are not
+  // measured again. Least recently used entries are replaced; inserting or removing a font clears them all.
+  struct TruncationEntry {
+    uint32_t lastUse;  // 0: unused
+    uint32_t textHash;
+    uint16_t textLength;
+    uint16_t keptLength;
+    int fontId;
+    int maxWidth;
+    uint8_t style;
+    bool truncated;
+  };
+  static constexpr int TRUNCATION_CACHE_SIZE = 32;
+  mutable TruncationEntry truncationCache[TRUNCATION_CACHE_SIZE] = {};
+  mutable uint32_t truncationClock = 0;
+
+  // Glyphs turned into panel rows for the portrait orientations, where each glyph column is a panel row: per glyph and
+  // plane, the columns of its pixel mask, ceil(height / 8) bytes each with the top row in the MSB. Built the first
+  // time a glyph is drawn (see rotatedGlyph()), so later draws neither fetch the bitmap from the font decompressor
+  // nor transpose it. The slots and the arena are one allocation, made on first use; everything is dropped at once
+  // when either fills up or the fonts change.
+  static constexpr size_t ROTATED_GLYPH_SLOTS = 128;  // Power of 2, at most 3/4 used
+  static constexpr size_t ROTATED_GLYPH_ARENA_SIZE = 4096;
+  struct RotatedGlyphSlot {
+    const EpdGlyph* glyph;  // nullptr: free
+    uint16_t offset;        // Into the arena
+    uint8_t plane;          // RenderMode of the mask, BW for 1-bit fonts
+  };
+  mutable RotatedGlyphSlot* rotatedGlyphSlots = nullptr;
+  mutable uint8_t* rotatedGlyphArena = nullptr;
+  mutable uint16_t rotatedGlyphArenaUsed = 0;
+  mutable uint16_t rotatedGlyphCount = 0;
+
+  // Input-to-display latency; the press time is set by the main loop and taken by the render task
+  mutable volatile uint32_t inputTimeUs = 0;
+  mutable volatile uint32_t inputLatencyUs = 0;
+  // Called where a frame starts going to the panel: measures the latency of a pending input, if any
+  void noteDisplayStart() const;
+
   void renderChar(const EpdFontFamily& fontFamily, uint32_t cp, int* x, int* y, bool pixelState,
                   EpdFontFamily::Style style) const;
+  // Draws an unrotated glyph with its origin at (cursorX, cursorY), the baseline position
+  void drawGlyph(const EpdFontData* fontData, const EpdGlyph* glyph, int cursorX, int cursorY, bool pixelState) const;
+  // Writes a glyph whose top-left pixel lands at logical (screenX, screenY) straight into the framebuffer, a byte (or
+  // an 8x8 transposed tile in portrait) at a time. Returns false if the glyph isn't entirely on screen.
+  bool blitGlyph(const EpdFontData* fontData, const EpdGlyph* glyph, const uint8_t* bitmap, int screenX, int screenY,
+                 bool pixelState) const;
+  // Portrait orientations only: writes a glyph entirely on screen from its rotated masks, as blitGlyph() would. False,
+  // with nothing drawn, if the glyph isn't, or its masks can't be cached.
+  bool blitRotatedGlyph(const EpdFontData* fontData, const EpdGlyph* glyph, int screenX, int screenY,
+                        bool pixelState) const;
+  // The glyph's columns for a plane, built from its bitmap if not cached yet; nullptr if there's no room or bitmap
+  const uint8_t* rotatedGlyph(const EpdFontData* fontData, const EpdGlyph* glyph, RenderMode plane) const;
+  void clearRotatedGlyphs() const;
+  void freeRotatedGlyphs();
+  // Scaling of a bitmap row, picked per bitmap so the row loop has no per-pixel float math in the common cases
+  enum class BitmapScale : uint8_t { None, Half, Any };
+  // Draws source pixels [srcStart, srcEnd) of a row decoded by Bitmap::readNextRow (2 bits per pixel) onto logical row
+  // screenY, which must be on screen, starting at screenX. The first source pixel lands on screenX.
+  void drawBitmapRow(const uint8_t* row, int srcStart, int srcEnd, int screenX, int screenY, BitmapScale scaleKind,
+                     float scale, bool oneBit) const;
+  // Writes the pixels whose level is in levelMask straight into the frame buffer, stepping along the panel axis the
+  // orientation maps logical rows to instead of rotating every pixel
+  template <BitmapScale scaleKind>
+  void blitBitmapRow(const uint8_t* row, int srcStart, int srcEnd, int screenX, int screenY, float scale,
+                     uint8_t levelMask, bool state) const;
   void freeBwBufferChunks();
-  template <Color color>
-  void drawPixelDither(int x, int y) const;
+  bool storePackedBwBuffer();
+  void freeBwPackedChunks();
+  uint32_t hashFrameTile(int tileRow, int tileColumn) const;
+  // Tiles of the frame buffer that differ from the frame shown before, and their bounding box
+  struct ChangedTiles {
+    int count;
+    int minRow, maxRow, minColumn, maxColumn;
+  };
+  // Hashes the frame buffer into the shown tiles, returning those that changed (all of them if the frame shown is not
+  // known)
+  ChangedTiles updateShownTiles() const;
+  // Sends the frame buffer to the panel, through a window around the changed tiles if the refresh is a fast one of a
+  // known frame that changed in a small region only; then counts the tiles changed towards the ghosting estimate, or
+  // clears it if the refresh wasn't a fast one
+  void present(HalDisplay::RefreshMode refreshMode, bool shownKnown, const ChangedTiles& changed) const;
+  // Fast refresh of a window around the changed tiles; false if they cover most of the panel or the driver can't do
+  // windows, and nothing was sent
+  bool displayChangedWindow(const ChangedTiles& changed) const;
+  void freeGrayMsbBands();
+  // Panel pixel bounds of a logical rectangle; false if it isn't entirely on screen
+  bool panelRectOf(int x, int y, int width, int height, int* phyX0, int* phyY0, int* phyX1, int* phyY1) const;
+  // Panel rectangle, in whole bytes, of the logical rows [top, bottom)
+  void panelRectOfRows(int top, int bottom, uint16_t* row, uint16_t* col, uint16_t* rows, uint16_t* cols) const;
+  uint8_t& msbPlaneByte(const uint32_t index) const {
+    const uint32_t row = index / panelWidthBytes - grayBandRow;
+    const uint32_t col = index % panelWidthBytes - grayBandCol;
+    return row < grayBandRows && col < grayBandCols ? grayMsbBand[row * grayBandCols + col] : grayMsbSink;
+  }
+  // Fills the logical rectangle, clipped to the screen, a panel row at a time: edge masks and a memset of the row's
+  // dither byte in between
+  void fillRectSpans(int x, int y, int width, int height, Color color) const;
   template <Color color>
   void fillArc(int maxRadius, int cx, int cy, int xDir, int yDir) const;
 
  public:
   explicit GfxRenderer(HalDisplay& halDisplay)
       : display(halDisplay), renderMode(BW), orientation(Portrait), fadingFix(false) {}
-  ~GfxRenderer() { freeBwBufferChunks(); }
+  ~GfxRenderer() {
+    freeBwBufferChunks();
+    freeBwPackedChunks();
+    freeGrayMsbBands();
+    freeRotatedGlyphs();
+  }
 
   static constexpr int VIEWABLE_MARGIN_TOP = 9;
   static constexpr int VIEWABLE_MARGIN_RIGHT = 3;
@@ -69,9 +225,12 @@ class GfxRenderer {
   // Setup
   void begin();  // must be called right after display.begin()
   void insertFont(int fontId, EpdFontFamily font);
+  void removeFont(int fontId);
   void setFontCacheManager(FontCacheManager* m) { fontCacheManager_ = m; }
   FontCacheManager* getFontCacheManager() const { return fontCacheManager_; }
-  const std::map<int, EpdFontFamily>& getFontMap() const { return fontMap; }
+  const FontTable& getFontMap() const { return fontMap; }
+  // Looks the font up once for callers measuring a lot of text in it (see the FontHandle overloads below)
+  FontHandle resolveFont(const int fontId) const { return {fontId, fontMap.find(fontId)}; }
 
   // Orientation control (affects logical width/height and coordinate transforms)
   void setOrientation(const Orientation o) { orientation = o; }
@@ -83,15 +242,39 @@ class GfxRenderer {
   // Screen ops
   int getScreenWidth() const;
   int getScreenHeight() const;
+  // A fast refresh of a frame that changed only in a small region since the one last sent to the panel sends just
+  // that region
   void displayBuffer(HalDisplay::RefreshMode refreshMode = HalDisplay::FAST_REFRESH) const;
-  // EXPERIMENTAL: Windowed update - display only a rectangular region
-  // void displayWindow(int x, int y, int width, int height) const;
+  // Fast refresh as displayBuffer() does, but skipped altogether when nothing changed; for small UI updates such as
+  // cursor moves
+  void displayChanges() const;
+  // Shows a reader page with a fast refresh, or with a half refresh once the ghosting left by the fast refreshes since
+  // the last slow one adds up to more than fullRefreshPages - 1 pages turned over completely. Pages that change
+  // little, such as a short chapter end, count for less.
+  void displayPage(int fullRefreshPages) const;
+  // Makes the next displayPage() a half refresh, e.g. for the first page after a menu
+  void requestFullRefresh() { fullRefreshDue = true; }
+  // Fast refresh of only a logical rectangle of the frame buffer, leaving the rest of the panel as it is; for a small
+  // overlay over a frame that is not going to be shown. False if the driver can't do windows.
+  bool displayRegion(int x, int y, int width, int height) const;
+  // Stamps a button press, as micros(); the next display of the frame buffer measures the time from it
+  void markInput(const uint32_t pressTimeUs) { inputTimeUs = pressTimeUs | 1; }
+  // Takes the latency measured since the last call, in microseconds; 0 if no input was displayed meanwhile
+  uint32_t takeInputLatencyUs() const {
+    const uint32_t latencyUs = inputLatencyUs;
+    inputLatencyUs = 0;
+    return latencyUs;
+  }
   void invertScreen() const;
   void clearScreen(uint8_t color = 0xFF) const;
+  // The panel's unviewable edges in the current orientation. A 180 degree turn only swaps opposite edges, so the
+  // viewable width and height (and every layout keyed on them) are the same in both orientations of a pair.
   void getOrientedViewableTRBL(int* outTop, int* outRight, int* outBottom, int* outLeft) const;
 
   // Drawing
   void drawPixel(int x, int y, bool state = true) const;
+  // GRAYSCALE_SPLIT only: marks a light gray (MSB plane) or dark gray (both planes) pixel
+  void drawGrayPixel(int x, int y, bool dark) const;
   void drawLine(int x1, int y1, int x2, int y2, bool state = true) const;
   void drawLine(int x1, int y1, int x2, int y2, int lineWidth, bool state) const;
   void drawArc(int maxRadius, int cx, int cy, int xDir, int yDir, int lineWidth, bool state) const;
@@ -106,7 +289,7 @@ class GfxRenderer {
   void fillRoundedRect(int x, int y, int width, int height, int cornerRadius, bool roundTopLeft, bool roundTopRight,
                        bool roundBottomLeft, bool roundBottomRight, Color color) const;
   void drawImage(const uint8_t bitmap[], int x, int y, int width, int height) const;
-  void drawIcon(const uint8_t bitmap[], int x, int y, int width, int height) const;
+  void drawIcon(const Icon& icon, int x, int y, int width, int height) const;
   void drawBitmap(const Bitmap& bitmap, int x, int y, int maxWidth, int maxHeight, float cropX = 0,
                   float cropY = 0) const;
   void drawBitmap1Bit(const Bitmap& bitmap, int x, int y, int maxWidth, int maxHeight) const;
@@ -118,6 +301,13 @@ class GfxRenderer {
                         EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   void drawText(int fontId, int x, int y, const char* text, bool black = true,
                 EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
+  /// Appends the glyphs drawText() would draw for \p text to \p out. Returns false, leaving \p out as it was, if a
+  /// glyph can't be represented as a PlacedGlyph.
+  bool resolveGlyphRun(int fontId, const char* text, EpdFontFamily::Style style, std::vector<PlacedGlyph>& out) const;
+  /// Draws glyphs from resolveGlyphRun() without decoding \p text again. \p glyphs need not be aligned; \p text is
+  /// only recorded for the font prewarm scan.
+  void drawGlyphRun(int fontId, int x, int y, const char* text, const uint8_t* glyphs, uint16_t glyphCount,
+                    bool black = true, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   int getSpaceWidth(int fontId, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   /// Returns the total inter-word advance: fp4::toPixel(spaceAdvance + kern(leftCp,' ') + kern(' ',rightCp)).
   /// Using a single snap avoids the +/-1 px rounding error that arises when space advance and kern are
@@ -126,8 +316,14 @@ class GfxRenderer {
   /// Returns the kerning adjustment between two adjacent codepoints.
   int getKerning(int fontId, uint32_t leftCp, uint32_t rightCp, EpdFontFamily::Style style) const;
   int getTextAdvanceX(int fontId, const char* text, EpdFontFamily::Style style) const;
+  /// The same measurements in a font resolved beforehand, without a lookup per call
+  int getSpaceWidth(const FontHandle& font, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
+  int getSpaceAdvance(const FontHandle& font, uint32_t leftCp, uint32_t rightCp, EpdFontFamily::Style style) const;
+  int getKerning(const FontHandle& font, uint32_t leftCp, uint32_t rightCp, EpdFontFamily::Style style) const;
+  int getTextAdvanceX(const FontHandle& font, const char* text, EpdFontFamily::Style style) const;
   int getFontAscenderSize(int fontId) const;
   int getLineHeight(int fontId) const;
+  /// \p text if it fits \p maxWidth, otherwise its longest prefix that fits with an ellipsis (U+2026) appended
   std::string truncatedText(int fontId, const char* text, int maxWidth,
                             EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   /// Word-wrap \p text into at most \p maxLines lines, each no wider than
@@ -147,12 +343,36 @@ class GfxRenderer {
   void copyGrayscaleLsbBuffers() const;
   void copyGrayscaleMsbBuffers() const;
   void displayGrayBuffer() const;
+  bool beginGrayscaleSplit();  // Returns false if there's no memory for a band, render two passes then
+  int getGrayscaleBandCount() const;
+  // Starts drawing band, the logical rows [*top, *bottom); everything reaching into them has to be drawn
+  void beginGrayscaleBand(int band, int* top, int* bottom);
+  void endGrayscaleBand();
+  // False, with nothing sent, if a band could not be kept; render the two passes then
+  bool copyGrayscaleSplitBuffers();
   bool storeBwBuffer();    // Returns true if buffer was stored successfully
   void restoreBwBuffer();  // Restore and free the stored buffer
   void cleanupGrayscaleWithFrameBuffer() const;
 
+  // A logical rectangle of the BW frame buffer, PackBits compressed (see FramePackBits): UI chrome drawn the same way
+  // over and over is drawn once, captured, and blitted back from then on
+  struct Layer {
+    std::vector<uint8_t> packed;
+    int x = 0;
+    int y = 0;
+    int width = 0;
+    int height = 0;
+    Orientation orientation = Portrait;
+  };
+  // False, with layer unusable, outside BW mode or if the rectangle isn't entirely on screen
+  bool captureLayer(int x, int y, int width, int height, Layer& layer) const;
+  // Puts the captured pixels back in place. False, with nothing drawn, outside BW mode or in another orientation.
+  bool blitLayer(const Layer& layer) const;
+
   // Font helpers
   const uint8_t* getGlyphBitmap(const EpdFontData* fontData, const EpdGlyph* glyph) const;
+  // Whether getGlyphBitmap() returns fontData's glyphs as bit planes, see FontDecompressor::setPlanarGlyphs()
+  bool glyphBitmapIsPlanar(const EpdFontData* fontData) const;
 
   // Low level functions
   uint8_t* getFrameBuffer() const;
@@ -1,36 +1,82 @@
 #include "InflateReader.h"
 
+#include <MemoryBudget.h>
+
+#include <atomic>
+#include <cstdlib>
 #include <cstring>
 #include <type_traits>
 
 namespace {
 constexpr size_t INFLATE_DICT_SIZE = 32768;
+
+// Ring buffer of a streaming decompressor, with the Huffman lookup tables it uses
+struct InflateWindow {
+  uint8_t dict[INFLATE_DICT_SIZE];
+  uint16_t fastTables[2 * UZLIB_FAST_TABLE_SIZE];
+};
+
+InflateWindow windowPool[INFLATE_WINDOW_SLOTS];
+std::atomic_flag windowBusy[INFLATE_WINDOW_SLOTS] = {};
+
+int acquireWindow() {
+  for (int slot = 0; slot < INFLATE_WINDOW_SLOTS; slot++) {
+    if (!windowBusy[slot].test_and_set(std::memory_order_acquire)) return slot;
+  }
+  return -1;
 }
 
+void releaseWindow(const int slot) { windowBusy[slot].clear(std::memory_order_release); }
+}  // namespace
+
 // Guarantee the cast pattern in the header comment is valid.
 static_assert(std::is_standard_layout<InflateReader>::value,
               "InflateReader must be standard-layout for the uzlib callback cast to work");
 
-InflateReader::~InflateReader() { deinit(); }
+InflateReader::~InflateReader() {
+  deinit();
+  free(oneShotTables);
+}
 
-bool InflateReader::init(const bool streaming) {
+bool InflateReader::init(const bool streaming, const bool pooledWindowOnly) {
   deinit();  // free any previously allocated ring buffer and reset state
 
+  uint16_t* fastTables = nullptr;
   if (streaming) {
-    ringBuffer = static_cast<uint8_t*>(malloc(INFLATE_DICT_SIZE));
-    if (!ringBuffer) return false;
+    windowSlot = acquireWindow();
+    if (windowSlot < 0 && pooledWindowOnly) return false;
+    if (windowSlot < 0) {
+      MemoryBudget::reserve(sizeof(InflateWindow), sizeof(InflateWindow));
+    }
+    auto* window =
+        windowSlot >= 0 ? &windowPool[windowSlot] : static_cast<InflateWindow*>(malloc(sizeof(InflateWindow)));
+    if (!window) return false;
+    ringBuffer = window->dict;
+    fastTables = window->fastTables;
     memset(ringBuffer, 0, INFLATE_DICT_SIZE);
+  } else {
+    // Kept across init() calls, as one-shot readers are reused for many small streams (font groups)
+    if (!oneShotTables) {
+      oneShotTables = static_cast<uint16_t*>(malloc(2 * UZLIB_FAST_TABLE_SIZE * sizeof(uint16_t)));
+    }
+    fastTables = oneShotTables;  // Decodes bit by bit if the allocation failed
   }
 
   uzlib_uncompress_init(&decomp, ringBuffer, ringBuffer ? INFLATE_DICT_SIZE : 0);
+  if (fastTables) {
+    uzlib_uncompress_set_fast_tables(&decomp, fastTables, fastTables + UZLIB_FAST_TABLE_SIZE);
+  }
   return true;
 }
 
 void InflateReader::deinit() {
-  if (ringBuffer) {
-    free(ringBuffer);
-    ringBuffer = nullptr;
+  if (windowSlot >= 0) {
+    releaseWindow(windowSlot);
+    windowSlot = -1;
+  } else if (ringBuffer) {
+    free(ringBuffer);  // Start of the InflateWindow taken from the heap
   }
+  ringBuffer = nullptr;
   memset(&decomp, 0, sizeof(decomp));
 }
 
@@ -46,6 +92,39 @@ void InflateReader::skipZlibHeader() {
   uzlib_get_byte(&decomp);
 }
 
+// uzlib's own gzip parser lives in tinfgzip.c, which is not vendored
+bool InflateReader::skipGzipHeader() {
+  constexpr uint8_t FHCRC = 0x02;
+  constexpr uint8_t FEXTRA = 0x04;
+  constexpr uint8_t FNAME = 0x08;
+  constexpr uint8_t FCOMMENT = 0x10;
+
+  if (uzlib_get_byte(&decomp) != 0x1f || uzlib_get_byte(&decomp) != 0x8b || uzlib_get_byte(&decomp) != 8) {
+    return false;
+  }
+  const uint8_t flags = uzlib_get_byte(&decomp);
+  for (int i = 0; i < 6; i++) uzlib_get_byte(&decomp);  // MTIME, XFL, OS
+
+  if (flags & FEXTRA) {
+    size_t extraLen = uzlib_get_byte(&decomp);
+    extraLen |= static_cast<size_t>(uzlib_get_byte(&decomp)) << 8;
+    while (extraLen-- > 0 && !decomp.eof) uzlib_get_byte(&decomp);
+  }
+  if (flags & FNAME) {
+    while (uzlib_get_byte(&decomp) != 0 && !decomp.eof) {
+    }
+  }
+  if (flags & FCOMMENT) {
+    while (uzlib_get_byte(&decomp) != 0 && !decomp.eof) {
+    }
+  }
+  if (flags & FHCRC) {
+    uzlib_get_byte(&decomp);
+    uzlib_get_byte(&decomp);
+  }
+  return !decomp.eof;
+}
+
 bool InflateReader::read(uint8_t* dest, size_t len) {
   if (!ringBuffer) {
     // One-shot mode: back-references use absolute offset from dest_start.
@@ -4,6 +4,11 @@
 
 #include <cstddef>
 
+// Number of 32KB windows reserved at boot for streaming decompressors
+#ifndef INFLATE_WINDOW_SLOTS
+#define INFLATE_WINDOW_SLOTS 1
+#endif
+
 // Return value for readAtMost().
 enum class InflateStatus {
   Ok,     // Output buffer full; more compressed data remains.
@@ -15,9 +20,15 @@ enum class InflateStatus {
 //
 // Two modes:
 //   init(false)  — one-shot: input is a contiguous buffer, call read() once.
-//   init(true)   — streaming: allocates a 32KB ring buffer for back-references
+//   init(true)   — streaming: borrows a 32KB ring buffer for back-references
 //                  across multiple read() / readAtMost() calls.
 //
+// Ring buffers come from a pool of INFLATE_WINDOW_SLOTS windows reserved
+// statically, so the largest block a stream needs is there however fragmented
+// the heap is. Only when every window is borrowed is one taken from the heap.
+// The window is returned by deinit() or the destructor. Each window carries
+// the lookup tables uzlib uses to decode most Huffman codes in one step.
+//
 // Streaming callback pattern:
 //   The uzlib read callback receives a `struct uzlib_uncomp*` with no separate
 //   context pointer. To attach context, make InflateReader the *first member* of
@@ -44,12 +55,13 @@ class InflateReader {
   InflateReader(const InflateReader&) = delete;
   InflateReader& operator=(const InflateReader&) = delete;
 
-  // Initialise decompressor. streaming=true allocates a 32KB ring buffer needed
+  // Initialise decompressor. streaming=true borrows a 32KB ring buffer needed
   // when read() or readAtMost() will be called multiple times.
-  // Returns false only in streaming mode if the ring buffer allocation fails.
-  bool init(bool streaming = false);
+  // Returns false only in streaming mode if no window is free and the heap
+  // allocation fails, or isn't allowed with pooledWindowOnly.
+  bool init(bool streaming = false, bool pooledWindowOnly = false);
 
-  // Release the ring buffer and reset internal state.
+  // Return the ring buffer and reset internal state.
   void deinit();
 
   // Set the entire compressed input as a contiguous memory buffer.
@@ -64,6 +76,10 @@ class InflateReader {
   // Call this once before the first read() when input is zlib-wrapped (e.g. PNG IDAT).
   void skipZlibHeader();
 
+  // Consume a gzip member header (RFC 1952), including any optional fields.
+  // Returns false if the input does not start with a valid gzip header.
+  bool skipGzipHeader();
+
   // Decompress exactly len bytes into dest.
   // Returns false if the stream ends before producing len bytes, or on error.
   bool read(uint8_t* dest, size_t len);
@@ -82,4 +98,6 @@ class InflateReader {
  private:
   uzlib_uncomp decomp = {};
   uint8_t* ringBuffer = nullptr;
+  int windowSlot = -1;  // Pool slot of ringBuffer, or -1 when it came from the heap
+  uint16_t* oneShotTables = nullptr;  // Huffman lookup tables in one-shot mode; streaming uses the window's
 };
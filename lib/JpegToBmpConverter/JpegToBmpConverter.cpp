@@ -4,6 +4,7 @@
 #include <HalStorage.h>
 #include <JPEGDEC.h>
 #include <Logging.h>
+#include <MemoryBudget.h>
 
 #include <cstdio>
 #include <cstring>
@@ -196,6 +197,25 @@ int32_t bmpJpegSeek(JPEGFILE* pFile, int32_t pos) {
   return pos;
 }
 
+// Picks the strongest JPEGDEC scaled-IDCT reduction (1/2, 1/4 or 1/8) that still decodes at least outWidth x
+// outHeight pixels, so the area-averaging pass below only ever reduces. Returns the denominator.
+int chooseJpegScale(const int srcWidth, const int srcHeight, const int outWidth, const int outHeight,
+                    int& scaleOption) {
+  static constexpr struct {
+    int denom;
+    int option;
+  } SCALES[] = {{8, JPEG_SCALE_EIGHTH}, {4, JPEG_SCALE_QUARTER}, {2, JPEG_SCALE_HALF}};
+  for (const auto& scale : SCALES) {
+    if ((srcWidth + scale.denom - 1) / scale.denom >= outWidth &&
+        (srcHeight + scale.denom - 1) / scale.denom >= outHeight) {
+      scaleOption = scale.option;
+      return scale.denom;
+    }
+  }
+  scaleOption = 0;
+  return 1;
+}
+
 // Context passed to the JPEGDEC draw callback via setUserPointer()
 struct BmpConvertCtx {
   Print* bmpOut;
@@ -380,7 +400,7 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
                                                      bool oneBit, bool crop) {
   LOG_DBG("JPG", "Converting JPEG to %s BMP (target: %dx%d)", oneBit ? "1-bit" : "2-bit", targetWidth, targetHeight);
 
-  if (ESP.getFreeHeap() < MIN_FREE_HEAP) {
+  if (!MemoryBudget::reserve(MIN_FREE_HEAP, JPEG_DECODER_SIZE)) {
     LOG_ERR("JPG", "Not enough heap for JPEG decoder (%u free, need %u)", ESP.getFreeHeap(), MIN_FREE_HEAP);
     return false;
   }
@@ -400,32 +420,25 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
     return false;
   }
 
-  const int srcWidth = jpeg->getWidth();
-  const int srcHeight = jpeg->getHeight();
+  const int fullWidth = jpeg->getWidth();
+  const int fullHeight = jpeg->getHeight();
 
-  LOG_DBG("JPG", "JPEG dimensions: %dx%d", srcWidth, srcHeight);
-
-  constexpr int MAX_IMAGE_WIDTH = 2048;
-  constexpr int MAX_IMAGE_HEIGHT = 3072;
+  LOG_DBG("JPG", "JPEG dimensions: %dx%d", fullWidth, fullHeight);
 
-  if (srcWidth <= 0 || srcHeight <= 0 || srcWidth > MAX_IMAGE_WIDTH || srcHeight > MAX_IMAGE_HEIGHT) {
-    LOG_DBG("JPG", "Image too large or invalid (%dx%d), max supported: %dx%d", srcWidth, srcHeight, MAX_IMAGE_WIDTH,
-            MAX_IMAGE_HEIGHT);
+  if (fullWidth <= 0 || fullHeight <= 0) {
+    LOG_DBG("JPG", "Invalid JPEG dimensions: %dx%d", fullWidth, fullHeight);
     jpeg->close();
     delete jpeg;
     return false;
   }
 
   // Calculate output dimensions (pre-scale to fit display exactly)
-  int outWidth = srcWidth;
-  int outHeight = srcHeight;
-  uint32_t scaleX_fp = 65536;  // 1.0 in 16.16 fixed point
-  uint32_t scaleY_fp = 65536;
-  bool needsScaling = false;
+  int outWidth = fullWidth;
+  int outHeight = fullHeight;
 
-  if (targetWidth > 0 && targetHeight > 0 && (srcWidth != targetWidth || srcHeight != targetHeight)) {
-    const float scaleToFitWidth = static_cast<float>(targetWidth) / srcWidth;
-    const float scaleToFitHeight = static_cast<float>(targetHeight) / srcHeight;
+  if (targetWidth > 0 && targetHeight > 0 && (fullWidth != targetWidth || fullHeight != targetHeight)) {
+    const float scaleToFitWidth = static_cast<float>(targetWidth) / fullWidth;
+    const float scaleToFitHeight = static_cast<float>(targetHeight) / fullHeight;
     float scale = 1.0f;
     if (crop) {
       scale = (scaleToFitWidth > scaleToFitHeight) ? scaleToFitWidth : scaleToFitHeight;
@@ -433,19 +446,50 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
       scale = (scaleToFitWidth < scaleToFitHeight) ? scaleToFitWidth : scaleToFitHeight;
     }
 
-    outWidth = static_cast<int>(srcWidth * scale);
-    outHeight = static_cast<int>(srcHeight * scale);
+    outWidth = static_cast<int>(fullWidth * scale);
+    outHeight = static_cast<int>(fullHeight * scale);
     if (outWidth < 1) outWidth = 1;
     if (outHeight < 1) outHeight = 1;
+  }
+
+  // Let the decoder do the coarse reduction in the DCT domain: a thumbnail of a large cover decodes 1/64th of the
+  // pixels. Progressive JPEGs are only ever decoded at 1/8 (DC coefficients only), so the option has to match.
+  int scaleOption;
+  int scaleDenom;
+  if (jpeg->getJPEGType() == JPEG_MODE_PROGRESSIVE) {
+    scaleOption = JPEG_SCALE_EIGHTH;
+    scaleDenom = 8;
+  } else {
+    scaleDenom = chooseJpegScale(fullWidth, fullHeight, outWidth, outHeight, scaleOption);
+  }
+  const int srcWidth = (fullWidth + scaleDenom - 1) / scaleDenom;
+  const int srcHeight = (fullHeight + scaleDenom - 1) / scaleDenom;
 
+  constexpr int MAX_IMAGE_WIDTH = 2048;
+  constexpr int MAX_IMAGE_HEIGHT = 3072;
+
+  // Bounds the MCU row buffer, so it applies to the decoded size
+  if (srcWidth > MAX_IMAGE_WIDTH || srcHeight > MAX_IMAGE_HEIGHT) {
+    LOG_DBG("JPG", "Image too large (%dx%d decoded at 1/%d), max supported: %dx%d", fullWidth, fullHeight, scaleDenom,
+            MAX_IMAGE_WIDTH, MAX_IMAGE_HEIGHT);
+    jpeg->close();
+    delete jpeg;
+    return false;
+  }
+
+  uint32_t scaleX_fp = 65536;  // 1.0 in 16.16 fixed point
+  uint32_t scaleY_fp = 65536;
+  bool needsScaling = false;
+
+  if (srcWidth != outWidth || srcHeight != outHeight) {
     scaleX_fp = (static_cast<uint32_t>(srcWidth) << 16) / outWidth;
     scaleY_fp = (static_cast<uint32_t>(srcHeight) << 16) / outHeight;
     needsScaling = true;
-
-    LOG_DBG("JPG", "Scaling %dx%d -> %dx%d (target %dx%d)", srcWidth, srcHeight, outWidth, outHeight, targetWidth,
-            targetHeight);
   }
 
+  LOG_DBG("JPG", "Scaling %dx%d -> %dx%d (decoded at 1/%d, target %dx%d)", fullWidth, fullHeight, outWidth, outHeight,
+          scaleDenom, targetWidth, targetHeight);
+
   // Write BMP header with output dimensions
   int bytesPerRow;
   if (USE_8BIT_OUTPUT && !oneBit) {
@@ -526,7 +570,7 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
   jpeg->setPixelType(EIGHT_BIT_GRAYSCALE);
   jpeg->setUserPointer(&ctx);
 
-  rc = jpeg->decode(0, 0, 0);
+  rc = jpeg->decode(0, 0, scaleOption);
 
   if (rc != 1 || ctx.error) {
     LOG_ERR("JPG", "JPEG decode failed (rc=%d, err=%d)", rc, jpeg->getLastError());
@@ -6,7 +6,9 @@
 #include <ObfuscationUtils.h>
 #include <Serialization.h>
 
+#include "../../src/BinarySettingsIO.h"
 #include "../../src/JsonSettingsIO.h"
+#include "../../src/RecordStore.h"
 
 // Initialize the static instance
 KOReaderCredentialStore KOReaderCredentialStore::instance;
@@ -35,20 +37,23 @@ void legacyDeobfuscate(std::string& data) {
 }  // namespace
 
 bool KOReaderCredentialStore::saveToFile() const {
-  Storage.mkdir("/.crosspoint");
-  return JsonSettingsIO::saveKOReader(*this, KOREADER_FILE_JSON);
+  RecordStore::markDirty(RecordStore::KOREADER_SLOT);
+  return true;
 }
 
 bool KOReaderCredentialStore::loadFromFile() {
-  // Try JSON first
+  std::string record;
+  if (RecordStore::read(RecordStore::KOREADER_SLOT, record) && BinarySettingsIO::readKOReader(*this, record)) {
+    return true;
+  }
+
+  // Credentials from before the record store, moved into it on the next flush
   if (Storage.exists(KOREADER_FILE_JSON)) {
     String json = Storage.readFile(KOREADER_FILE_JSON);
     if (!json.isEmpty()) {
-      bool resave = false;
-      bool result = JsonSettingsIO::loadKOReader(*this, json.c_str(), &resave);
-      if (result && resave) {
+      const bool result = JsonSettingsIO::loadKOReader(*this, json.c_str());
+      if (result) {
         saveToFile();
-        LOG_DBG("KRS", "Resaved KOReader credentials to update format");
       }
       return result;
     }
@@ -57,9 +62,10 @@ bool KOReaderCredentialStore::loadFromFile() {
   // Fall back to binary migration
   if (Storage.exists(KOREADER_FILE_BIN)) {
     if (loadFromBinaryFile()) {
-      if (saveToFile()) {
+      saveToFile();
+      if (RecordStore::flush()) {
         Storage.rename(KOREADER_FILE_BIN, KOREADER_FILE_BAK);
-        LOG_DBG("KRS", "Migrated koreader.bin to koreader.json");
+        LOG_DBG("KRS", "Migrated koreader.bin to the record store");
         return true;
       } else {
         LOG_ERR("KRS", "Failed to save KOReader credentials during migration");
@@ -10,14 +10,17 @@ enum class DocumentMatchMethod : uint8_t {
 
 class KOReaderCredentialStore;
 namespace JsonSettingsIO {
-bool saveKOReader(const KOReaderCredentialStore& store, const char* path);
 bool loadKOReader(KOReaderCredentialStore& store, const char* json, bool* needsResave);
 }  // namespace JsonSettingsIO
+namespace BinarySettingsIO {
+void writeKOReader(const KOReaderCredentialStore& store, std::string& out);
+bool readKOReader(KOReaderCredentialStore& store, const std::string& in);
+}  // namespace BinarySettingsIO
 
 /**
  * Singleton class for storing KOReader sync credentials on the SD card.
  * Passwords are XOR-obfuscated with the device's unique hardware MAC address
- * and base64-encoded before writing to JSON (not cryptographically secure,
+ * before they are written to the record store (not cryptographically secure,
  * but prevents casual reading and ties credentials to the specific device).
  */
 class KOReaderCredentialStore {
@@ -27,24 +30,32 @@ class KOReaderCredentialStore {
   std::string password;
   std::string serverUrl;                                            // Custom sync server URL (empty = default)
   DocumentMatchMethod matchMethod = DocumentMatchMethod::FILENAME;  // Default to filename for compatibility
+  bool loaded = false;
 
   // Private constructor for singleton
   KOReaderCredentialStore() = default;
 
   bool loadFromBinaryFile();
 
-  friend bool JsonSettingsIO::saveKOReader(const KOReaderCredentialStore&, const char*);
   friend bool JsonSettingsIO::loadKOReader(KOReaderCredentialStore&, const char*, bool*);
+  friend void BinarySettingsIO::writeKOReader(const KOReaderCredentialStore&, std::string&);
+  friend bool BinarySettingsIO::readKOReader(KOReaderCredentialStore&, const std::string&);
 
  public:
   // Delete copy constructor and assignment
   KOReaderCredentialStore(const KOReaderCredentialStore&) = delete;
   KOReaderCredentialStore& operator=(const KOReaderCredentialStore&) = delete;
 
-  // Get singleton instance
-  static KOReaderCredentialStore& getInstance() { return instance; }
+  // Get singleton instance, loading it from the SD card on first use so boot does not have to
+  static KOReaderCredentialStore& getInstance() {
+    if (!instance.loaded) {
+      instance.loaded = true;
+      instance.loadFromFile();
+    }
+    return instance;
+  }
 
-  // Save/load from SD card
+  // Marks the record dirty; RecordStore::flush() writes it
   bool saveToFile() const;
   bool loadFromFile();
 
@@ -3,8 +3,60 @@
 #include <HalStorage.h>
 #include <Logging.h>
 #include <MD5Builder.h>
+#include <Serialization.h>
 
 namespace {
+constexpr uint8_t ID_CACHE_VERSION = 1;
+constexpr char ID_CACHE_FILE[] = "/kosync_id.bin";
+
+// Identifies the copy of the file a cached ID was computed from
+struct FileStamp {
+  uint64_t size = 0;
+  uint16_t date = 0;
+  uint16_t time = 0;
+
+  bool operator==(const FileStamp& other) const {
+    return size == other.size && date == other.date && time == other.time;
+  }
+};
+
+FileStamp stampOf(FsFile& file) {
+  FileStamp stamp;
+  stamp.size = file.fileSize();
+  file.getModifyDateTime(&stamp.date, &stamp.time);
+  return stamp;
+}
+
+bool readCachedId(const std::string& path, const FileStamp& stamp, std::string& id) {
+  FsFile file;
+  if (!Storage.exists(path.c_str()) || !Storage.openFileForRead("KODoc", path, file)) {
+    return false;
+  }
+  uint8_t version = 0;
+  FileStamp cached;
+  serialization::readPod(file, version);
+  serialization::readPod(file, cached.size);
+  serialization::readPod(file, cached.date);
+  serialization::readPod(file, cached.time);
+  if (version != ID_CACHE_VERSION || !(cached == stamp) || file.available() < 4 + 32) {
+    return false;
+  }
+  serialization::readString(file, id);
+  return id.size() == 32;
+}
+
+void writeCachedId(const std::string& path, const FileStamp& stamp, const std::string& id) {
+  FsFile file;
+  if (!Storage.openFileForWrite("KODoc", path, file)) {
+    return;
+  }
+  serialization::writePod(file, ID_CACHE_VERSION);
+  serialization::writePod(file, stamp.size);
+  serialization::writePod(file, stamp.date);
+  serialization::writePod(file, stamp.time);
+  serialization::writeString(file, id);
+}
+
 // Extract filename from path (everything after last '/')
 std::string getFilename(const std::string& path) {
   const size_t pos = path.rfind('/');
@@ -47,9 +99,39 @@ std::string KOReaderDocumentId::calculate(const std::string& filePath) {
     LOG_DBG("KODoc", "Failed to open file: %s", filePath.c_str());
     return "";
   }
+  LOG_DBG("KODoc", "Calculating hash for file: %s", filePath.c_str());
+  return hashFile(file);
+}
+
+std::string KOReaderDocumentId::calculate(const std::string& filePath, const std::string& cacheDir) {
+  FsFile file;
+  if (!Storage.openFileForRead("KODoc", filePath, file)) {
+    LOG_DBG("KODoc", "Failed to open file: %s", filePath.c_str());
+    return "";
+  }
+
+  const FileStamp stamp = stampOf(file);
+  const std::string cachePath = cacheDir + ID_CACHE_FILE;
+  std::string result;
+  if (readCachedId(cachePath, stamp, result)) {
+    LOG_DBG("KODoc", "Cached hash: %s", result.c_str());
+    return result;
+  }
+
+  LOG_DBG("KODoc", "Calculating hash for file: %s", filePath.c_str());
+  result = hashFile(file);
+  if (Storage.exists(cacheDir.c_str())) {
+    writeCachedId(cachePath, stamp, result);
+  }
+  return result;
+}
+
+bool KOReaderDocumentId::hasCachedId(const std::string& cacheDir) {
+  return Storage.exists((cacheDir + ID_CACHE_FILE).c_str());
+}
 
+std::string KOReaderDocumentId::hashFile(FsFile& file) {
   const size_t fileSize = file.fileSize();
-  LOG_DBG("KODoc", "Calculating hash for file: %s (size: %zu)", filePath.c_str(), fileSize);
 
   // Initialize MD5 builder
   MD5Builder md5;
@@ -88,7 +170,7 @@ std::string KOReaderDocumentId::calculate(const std::string& filePath) {
   md5.calculate();
   std::string result = md5.toString().c_str();
 
-  LOG_DBG("KODoc", "Hash calculated: %s (from %zu bytes)", result.c_str(), totalBytesRead);
+  LOG_DBG("KODoc", "Hash calculated: %s (from %zu bytes of %zu)", result.c_str(), totalBytesRead, fileSize);
 
   return result;
 }
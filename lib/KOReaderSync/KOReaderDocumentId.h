@@ -1,4 +1,6 @@
 #pragma once
+#include <HalStorage.h>
+
 #include <string>
 
 /**
@@ -24,6 +26,19 @@ class KOReaderDocumentId {
    */
   static std::string calculate(const std::string& filePath);
 
+  /**
+   * Same as calculate(filePath), remembered in the book's cache directory. The cached ID is used while the file's
+   * size and modification time are unchanged, so syncing a book does not seek across it every time.
+   *
+   * @param filePath Path to the file
+   * @param cacheDir The book's cache directory; nothing is cached if it does not exist
+   * @return 32-character lowercase hex string, or empty string on failure
+   */
+  static std::string calculate(const std::string& filePath, const std::string& cacheDir);
+
+  // Whether an ID was cached in the directory, without checking it is still current
+  static bool hasCachedId(const std::string& cacheDir);
+
   /**
    * Calculate document hash from filename only (filename-based sync mode).
    * This is simpler and works when files have the same name across devices.
@@ -42,4 +57,7 @@ class KOReaderDocumentId {
 
   // Calculate offset for index i: 1024 << (2*i)
   static size_t getOffset(int i);
+
+  // Partial MD5 of an open file
+  static std::string hashFile(FsFile& file);
 };
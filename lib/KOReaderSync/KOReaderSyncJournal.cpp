@@ -0,0 +1,171 @@
+#include "KOReaderSyncJournal.h"
+
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+
+#include "KOReaderCredentialStore.h"
+#include "KOReaderSyncClient.h"
+
+namespace {
+constexpr uint8_t JOURNAL_FILE_VERSION = 1;
+constexpr char JOURNAL_FILE[] = "/.crosspoint/kosync_journal.bin";
+constexpr char JOURNAL_FILE_TMP[] = "/.crosspoint/kosync_journal.tmp";
+// Hashes and generated xpaths are far shorter; anything longer means a damaged file
+constexpr uint32_t MAX_STRING_LENGTH = 512;
+
+bool readBoundedString(FsFile& file, std::string& s) {
+  uint32_t len = 0;
+  serialization::readPod(file, len);
+  if (len > MAX_STRING_LENGTH || static_cast<size_t>(file.available()) < len) {
+    return false;
+  }
+  s.resize(len);
+  return len == 0 || file.read(reinterpret_cast<uint8_t*>(&s[0]), len) == static_cast<int>(len);
+}
+}  // namespace
+
+bool KOReaderSyncJournal::load(std::vector<KOReaderJournalEntry>& entries) {
+  entries.clear();
+  if (!Storage.exists(JOURNAL_FILE)) {
+    return true;
+  }
+  FsFile file;
+  if (!Storage.openFileForRead("KOJ", JOURNAL_FILE, file)) {
+    return false;
+  }
+
+  uint8_t version = 0;
+  uint8_t count = 0;
+  serialization::readPod(file, version);
+  serialization::readPod(file, count);
+  if (version != JOURNAL_FILE_VERSION) {
+    LOG_DBG("KOJ", "Unknown journal version: %u", version);
+    return false;
+  }
+  entries.reserve(count);
+  for (uint8_t i = 0; i < count; i++) {
+    KOReaderJournalEntry entry;
+    if (!readBoundedString(file, entry.document) || !readBoundedString(file, entry.progress)) {
+      LOG_ERR("KOJ", "Journal truncated after %u entries", i);
+      break;
+    }
+    serialization::readPod(file, entry.percentage);
+    serialization::readPod(file, entry.timestamp);
+    entries.push_back(std::move(entry));
+  }
+  return true;
+}
+
+bool KOReaderSyncJournal::save(const std::vector<KOReaderJournalEntry>& entries) {
+  if (entries.empty()) {
+    Storage.remove(JOURNAL_FILE);
+    return true;
+  }
+
+  Storage.mkdir("/.crosspoint");
+  FsFile file;
+  if (!Storage.openFileForWrite("KOJ", JOURNAL_FILE_TMP, file)) {
+    return false;
+  }
+  serialization::writePod(file, JOURNAL_FILE_VERSION);
+  serialization::writePod(file, static_cast<uint8_t>(entries.size()));
+  for (const auto& entry : entries) {
+    serialization::writeString(file, entry.document);
+    serialization::writeString(file, entry.progress);
+    serialization::writePod(file, entry.percentage);
+    serialization::writePod(file, entry.timestamp);
+  }
+  file.close();
+
+  // Replaced in one step so a power cut never leaves half a journal
+  Storage.remove(JOURNAL_FILE);
+  return Storage.rename(JOURNAL_FILE_TMP, JOURNAL_FILE);
+}
+
+bool KOReaderSyncJournal::record(const KOReaderJournalEntry& entry) {
+  std::vector<KOReaderJournalEntry> entries;
+  load(entries);
+  entries.erase(std::remove_if(entries.begin(), entries.end(),
+                               [&](const KOReaderJournalEntry& e) { return e.document == entry.document; }),
+                entries.end());
+  entries.push_back(entry);
+  if (entries.size() > MAX_ENTRIES) {
+    entries.erase(entries.begin(), entries.end() - MAX_ENTRIES);
+  }
+  LOG_DBG("KOJ", "Recorded %.2f%% for %s (%u pending)", entry.percentage * 100, entry.document.c_str(),
+          static_cast<unsigned>(entries.size()));
+  return save(entries);
+}
+
+void KOReaderSyncJournal::remove(const std::string& document) {
+  std::vector<KOReaderJournalEntry> entries;
+  if (!load(entries)) {
+    return;
+  }
+  const size_t before = entries.size();
+  entries.erase(std::remove_if(entries.begin(), entries.end(),
+                               [&](const KOReaderJournalEntry& e) { return e.document == document; }),
+                entries.end());
+  if (entries.size() != before) {
+    save(entries);
+  }
+}
+
+bool KOReaderSyncJournal::hasPending() { return Storage.exists(JOURNAL_FILE); }
+
+KOReaderSyncJournal::FlushResult KOReaderSyncJournal::flush() {
+  FlushResult result;
+  std::vector<KOReaderJournalEntry> entries;
+  if (!KOREADER_STORE.hasCredentials() || !hasPending() || !load(entries) || entries.empty()) {
+    return result;
+  }
+  LOG_DBG("KOJ", "Flushing %u pending positions", static_cast<unsigned>(entries.size()));
+
+  std::vector<KOReaderJournalEntry> remaining;
+  bool stopped = false;
+  for (auto& entry : entries) {
+    if (stopped) {
+      remaining.push_back(std::move(entry));
+      continue;
+    }
+
+    KOReaderProgress remote;
+    auto error = KOReaderSyncClient::getProgress(entry.document, remote);
+    if (error == KOReaderSyncClient::OK) {
+      // Without a clock there is no telling which is newer; reading on only moves forward, so keep the further one
+      const bool remoteNewer =
+          entry.timestamp > 0 ? remote.timestamp > entry.timestamp : remote.percentage > entry.percentage;
+      if (remoteNewer) {
+        LOG_DBG("KOJ", "Server has newer progress for %s, dropping ours", entry.document.c_str());
+        result.superseded++;
+        continue;
+      }
+    }
+
+    if (error == KOReaderSyncClient::OK || error == KOReaderSyncClient::NOT_FOUND) {
+      KOReaderProgress progress;
+      progress.document = entry.document;
+      progress.progress = entry.progress;
+      progress.percentage = entry.percentage;
+      error = KOReaderSyncClient::updateProgress(progress);
+      if (error == KOReaderSyncClient::OK) {
+        result.uploaded++;
+        continue;
+      }
+    }
+
+    LOG_ERR("KOJ", "Sync of %s failed: %s", entry.document.c_str(), KOReaderSyncClient::errorString(error));
+    // The rest would fail the same way; keep them all for the next flush
+    stopped = error == KOReaderSyncClient::NETWORK_ERROR || error == KOReaderSyncClient::AUTH_FAILED ||
+              error == KOReaderSyncClient::NO_CREDENTIALS;
+    remaining.push_back(std::move(entry));
+  }
+
+  result.pending = static_cast<int>(remaining.size());
+  save(remaining);
+  LOG_DBG("KOJ", "Uploaded %d, superseded %d, pending %d", result.uploaded, result.superseded, result.pending);
+  return result;
+}
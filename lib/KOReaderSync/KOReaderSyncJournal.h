@@ -0,0 +1,56 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * A reading position waiting to be sent to the sync server.
+ */
+struct KOReaderJournalEntry {
+  std::string document;  // Document hash
+  std::string progress;  // XPath-like progress string
+  float percentage;      // Progress percentage (0.0 to 1.0)
+  int64_t timestamp;     // Unix time it was recorded, 0 if the clock was not set
+};
+
+/**
+ * Journal of reading positions on the SD card, so progress can be synced without turning WiFi on for it.
+ *
+ * The reader records the position of a book when leaving it. Screens that have WiFi up anyway (file transfer, OTA
+ * check) call flush(), which sends every pending position in one session. A position the server has a newer one for
+ * (by timestamp, or by percentage when the clock was not set) is dropped rather than uploaded; the interactive sync
+ * offers that one to the reader.
+ */
+class KOReaderSyncJournal {
+ public:
+  struct FlushResult {
+    int uploaded = 0;
+    int superseded = 0;  // The server had newer progress
+    int pending = 0;     // Left for the next flush after an error
+  };
+
+  /**
+   * Record a position, replacing any pending one for the same document.
+   * @return true if the journal was written
+   */
+  static bool record(const KOReaderJournalEntry& entry);
+
+  /**
+   * Drop the pending position of a document, e.g. after it was uploaded interactively.
+   */
+  static void remove(const std::string& document);
+
+  static bool hasPending();
+
+  /**
+   * Send pending positions to the sync server. Call with WiFi connected; does nothing without credentials.
+   */
+  static FlushResult flush();
+
+ private:
+  // Oldest entries are dropped beyond this
+  static constexpr size_t MAX_ENTRIES = 32;
+
+  static bool load(std::vector<KOReaderJournalEntry>& entries);
+  static bool save(const std::vector<KOReaderJournalEntry>& entries);
+};
@@ -2,14 +2,19 @@
 
 #include <Logging.h>
 
+#include <algorithm>
 #include <cmath>
 
 KOReaderPosition ProgressMapper::toKOReader(const std::shared_ptr<Epub>& epub, const CrossPointPosition& pos) {
   KOReaderPosition result;
 
-  // Calculate page progress within current spine item
+  // Calculate page progress within current spine item, exactly if the page's source position is known
   float intraSpineProgress = 0.0f;
-  if (pos.totalPages > 0) {
+  const size_t prevCumSize = pos.spineIndex > 0 ? epub->getCumulativeSpineItemSize(pos.spineIndex - 1) : 0;
+  const size_t spineSize = epub->getCumulativeSpineItemSize(pos.spineIndex) - prevCumSize;
+  if (pos.sourceOffset >= 0 && spineSize > 0) {
+    intraSpineProgress = std::min(1.0f, static_cast<float>(pos.sourceOffset) / static_cast<float>(spineSize));
+  } else if (pos.totalPages > 0) {
     intraSpineProgress = static_cast<float>(pos.pageNumber) / static_cast<float>(pos.totalPages);
   }
 
@@ -91,8 +96,10 @@ CrossPointPosition ProgressMapper::toCrossPoint(const std::shared_ptr<Epub>& epu
 
     result.totalPages = estimatedTotalPages;
 
+    const size_t bytesIntoSpine = (targetBytes > prevCumSize) ? (targetBytes - prevCumSize) : 0;
+    result.sourceOffset = static_cast<int32_t>(std::min(bytesIntoSpine, spineSize));
+
     if (spineSize > 0 && estimatedTotalPages > 0) {
-      const size_t bytesIntoSpine = (targetBytes > prevCumSize) ? (targetBytes - prevCumSize) : 0;
       const float intraSpineProgress = static_cast<float>(bytesIntoSpine) / static_cast<float>(spineSize);
       const float clampedProgress = std::max(0.0f, std::min(1.0f, intraSpineProgress));
       result.pageNumber = static_cast<int>(clampedProgress * estimatedTotalPages);
@@ -100,8 +107,8 @@ CrossPointPosition ProgressMapper::toCrossPoint(const std::shared_ptr<Epub>& epu
     }
   }
 
-  LOG_DBG("ProgressMapper", "KOReader -> CrossPoint: %.2f%% at %s -> spine=%d, page=%d", koPos.percentage * 100,
-          koPos.xpath.c_str(), result.spineIndex, result.pageNumber);
+  LOG_DBG("ProgressMapper", "KOReader -> CrossPoint: %.2f%% at %s -> spine=%d, page=%d, offset=%d",
+          koPos.percentage * 100, koPos.xpath.c_str(), result.spineIndex, result.pageNumber, result.sourceOffset);
 
   return result;
 }
@@ -11,6 +11,9 @@ struct CrossPointPosition {
   int spineIndex;  // Current spine item (chapter) index
   int pageNumber;  // Current page within the spine item
   int totalPages;  // Total pages in the current spine item
+  // Byte offset of the page's content in the spine item (Section::getPageSourceOffset), -1 if unknown.
+  // Exact where pageNumber / totalPages is an estimate; toCrossPoint() always sets it.
+  int32_t sourceOffset = -1;
 };
 
 /**
@@ -29,7 +32,8 @@ struct KOReaderPosition {
  *
  * Since CrossPoint discards HTML structure during parsing, we generate
  * synthetic XPath strings based on spine index, using percentage as the
- * primary sync mechanism.
+ * primary sync mechanism. The percentage is measured in bytes of the spine
+ * items, so with section page offsets it maps to and from pages exactly.
  */
 class ProgressMapper {
  public:
@@ -46,7 +50,8 @@ class ProgressMapper {
    * Convert KOReader position to CrossPoint format.
    *
    * Note: The returned pageNumber may be approximate since different
-   * rendering settings produce different page counts.
+   * rendering settings produce different page counts. Resolve sourceOffset
+   * with Section::getPageForSourceOffset() once the section is loaded.
    *
    * @param epub The EPUB book
    * @param koPos KOReader position
@@ -1,5 +1,11 @@
 #include "Logging.h"
 
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <cstring>
 #include <string>
 
 #define MAX_ENTRY_LEN 256
@@ -30,6 +36,130 @@ void addToLogRingBuffer(const char* message) {
   logHead = (logHead + 1) % MAX_LOG_LINES;
 }
 
+namespace {
+// Lines waiting for the writer task. Any task can log: it reserves room by advancing reserveHead with a CAS, copies
+// its line in and then publishes the record's header, so no task ever waits on another or on the USB link. Only the
+// writer task reads, at tail. A record is a 4-byte header (the text length, READY once published) followed by the
+// text padded to 4 bytes; records don't wrap, a line that doesn't fit before the end of the buffer is preceded by a
+// SKIP record covering the rest of it.
+constexpr uint32_t QUEUE_SIZE = 4096;  // Power of two, 16 lines of MAX_ENTRY_LEN
+constexpr uint32_t QUEUE_MASK = QUEUE_SIZE - 1;
+constexpr uint32_t LENGTH_MASK = 0xFFFF;
+constexpr uint32_t READY = 1u << 16;
+constexpr uint32_t SKIP = 1u << 17;
+constexpr uint32_t WRITER_STACK_SIZE = 2048;
+
+alignas(4) uint8_t queue[QUEUE_SIZE];
+std::atomic<uint32_t> reserveHead{0};
+std::atomic<uint32_t> tail{0};
+std::atomic<uint32_t> droppedLines{0};
+TaskHandle_t writerTask = nullptr;
+// Held by the writer task while it writes, and by a RawLogOutput
+SemaphoreHandle_t serialMutex = nullptr;
+
+uint32_t* headerAt(const uint32_t position) { return reinterpret_cast<uint32_t*>(queue + (position & QUEUE_MASK)); }
+
+uint32_t recordSize(const uint32_t header) {
+  const uint32_t length = header & LENGTH_MASK;
+  return (header & SKIP) ? length : (4 + length + 3) & ~3u;
+}
+
+// False if the queue is full; the line is then dropped rather than waited for
+bool enqueueLine(const char* text, const size_t length) {
+  const uint32_t size = recordSize(length);
+  uint32_t head = reserveHead.load(std::memory_order_relaxed);
+  uint32_t start;
+  do {
+    const uint32_t room = QUEUE_SIZE - (head & QUEUE_MASK);
+    start = room >= size ? head : head + room;
+    if (start + size - tail.load(std::memory_order_acquire) > QUEUE_SIZE) {
+      return false;
+    }
+  } while (!reserveHead.compare_exchange_weak(head, start + size, std::memory_order_relaxed));
+
+  if (start != head) {
+    __atomic_store_n(headerAt(head), (start - head) | SKIP | READY, __ATOMIC_RELEASE);
+  }
+  memcpy(queue + (start & QUEUE_MASK) + 4, text, length);
+  __atomic_store_n(headerAt(start), length | READY, __ATOMIC_RELEASE);
+  return true;
+}
+
+// Writes the published records in order, stopping at one that is still being copied in. Consumed records are zeroed,
+// so the header of the next record written over them reads as unpublished until its producer is done.
+void writeQueuedLines() {
+  uint32_t position = tail.load(std::memory_order_relaxed);
+  while (position != reserveHead.load(std::memory_order_acquire)) {
+    const uint32_t header = __atomic_load_n(headerAt(position), __ATOMIC_ACQUIRE);
+    if (!(header & READY)) {
+      break;
+    }
+    const uint32_t size = recordSize(header);
+    uint8_t* record = queue + (position & QUEUE_MASK);
+    if (!(header & SKIP)) {
+      logSerial.write(record + 4, header & LENGTH_MASK);
+    }
+    memset(record, 0, size);
+    position += size;
+    tail.store(position, std::memory_order_release);
+  }
+  const uint32_t dropped = droppedLines.exchange(0, std::memory_order_relaxed);
+  if (dropped > 0) {
+    logSerial.printf("[%lu] [ERR] [LOG] %lu lines dropped, the log queue was full\n", millis(),
+                     static_cast<unsigned long>(dropped));
+  }
+}
+
+void writerLoop(void*) {
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    xSemaphoreTake(serialMutex, portMAX_DELAY);
+    writeQueuedLines();
+    xSemaphoreGive(serialMutex);
+  }
+}
+}  // namespace
+
+void logStartWriter() {
+  if (writerTask) {
+    return;
+  }
+  serialMutex = xSemaphoreCreateMutex();
+  if (!serialMutex) {
+    return;
+  }
+  // Idle priority like the Workers: the lines are written whenever nothing else needs the CPU
+  if (xTaskCreate(writerLoop, "LogWriter", WRITER_STACK_SIZE, nullptr, tskIDLE_PRIORITY, &writerTask) != pdPASS) {
+    writerTask = nullptr;
+  }
+}
+
+void logFlush(const unsigned long timeoutMs) {
+  if (!writerTask) {
+    return;
+  }
+  const unsigned long start = millis();
+  while (tail.load(std::memory_order_acquire) != reserveHead.load(std::memory_order_acquire) &&
+         millis() - start < timeoutMs) {
+    xTaskNotifyGive(writerTask);
+    vTaskDelay(1);
+  }
+}
+
+RawLogOutput::RawLogOutput() {
+  if (writerTask) {
+    logFlush();
+    xSemaphoreTake(serialMutex, portMAX_DELAY);
+  }
+}
+
+RawLogOutput::~RawLogOutput() {
+  if (writerTask) {
+    xSemaphoreGive(serialMutex);
+    xTaskNotifyGive(writerTask);
+  }
+}
+
 // Since logging can take a large amount of flash, we want to make the format string as short as possible.
 // This logPrintf prepend the timestamp, level and origin to the user-provided message, so that the user only needs to
 // provide the format string for the message itself.
@@ -60,7 +190,13 @@ void logPrintf(const char* level, const char* origin, const char* format, ...) {
   }
   va_end(args);
   if (logSerial) {
-    logSerial.print(buf);
+    if (!writerTask) {
+      logSerial.print(buf);
+    } else if (enqueueLine(buf, strnlen(buf, sizeof(buf)))) {
+      xTaskNotifyGive(writerTask);
+    } else {
+      droppedLines.fetch_add(1, std::memory_order_relaxed);
+    }
   }
   addToLogRingBuffer(buf);
 }
@@ -20,7 +20,13 @@ special formatting), use the underlying logSerial object directly:
     logSerial.write(binaryData, length);
 
 The logSerial reference (defined below) points to the real Serial object and
-won't trigger deprecation warnings.
+won't trigger deprecation warnings. Raw writes bypass the log queue: hold a
+RawLogOutput while writing them so no queued line lands in the middle.
+
+Once Serial.begin() has run, LOG_* lines are queued and written to the serial
+port by a background task, so a caller never waits on the USB link. Lines that
+don't fit in the queue are dropped and counted; the count is logged with the
+next line that fits.
 */
 
 #ifndef LOG_LEVEL
@@ -30,6 +36,20 @@ won't trigger deprecation warnings.
 static HWCDC& logSerial = Serial;
 
 void logPrintf(const char* level, const char* origin, const char* format, ...);
+// Starts the task that writes queued lines to logSerial; before it runs, lines are written as they are logged
+void logStartWriter();
+// Waits up to timeoutMs for the queued lines to be written, e.g. before sleeping or restarting
+void logFlush(unsigned long timeoutMs = 200);
+
+// Writes the queued lines, then keeps the writer task off logSerial while raw output (a screenshot, a profile dump)
+// goes out; lines logged meanwhile are written once it is destroyed
+class RawLogOutput {
+ public:
+  RawLogOutput();
+  ~RawLogOutput();
+  RawLogOutput(const RawLogOutput&) = delete;
+  RawLogOutput& operator=(const RawLogOutput&) = delete;
+};
 
 #ifdef ENABLE_SERIAL_LOG
 #if LOG_LEVEL >= 0
@@ -65,7 +85,10 @@ bool sanitizeLogHead();
 
 class MySerialImpl : public Print {
  public:
-  void begin(unsigned long baud) { logSerial.begin(baud); }
+  void begin(unsigned long baud) {
+    logSerial.begin(baud);
+    logStartWriter();
+  }
 
   // Support boolean conversion for compatibility with code like:
   //   if (Serial) or while (!Serial)
@@ -0,0 +1,102 @@
+#include "MemoryBudget.h"
+
+#include <Arduino.h>
+#include <Logging.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include <utility>
+
+namespace {
+struct Cache {
+  const void* owner;
+  const char* name;
+  MemoryBudget::Priority priority;
+  MemoryBudget::Shrinker shrink;
+};
+
+Cache caches[MemoryBudget::MAX_CACHES];
+size_t cacheCount = 0;
+bool (*cacheLockHeld)() = nullptr;
+
+// Guards the registry. reserve() holds it while it shrinks, so a cache can't be unregistered and destroyed under it.
+class RegistryLock {
+  static SemaphoreHandle_t mutex() {
+    static const SemaphoreHandle_t handle = xSemaphoreCreateMutex();
+    return handle;
+  }
+
+ public:
+  RegistryLock() { xSemaphoreTake(mutex(), portMAX_DELAY); }
+  ~RegistryLock() { xSemaphoreGive(mutex()); }
+  RegistryLock(const RegistryLock&) = delete;
+  RegistryLock& operator=(const RegistryLock&) = delete;
+};
+
+bool fits(const size_t bytes, const size_t largestBlock) {
+  return ESP.getFreeHeap() >= bytes && ESP.getMaxAllocHeap() >= largestBlock;
+}
+}  // namespace
+
+bool MemoryBudget::registerCache(const void* owner, const char* name, const Priority priority, Shrinker shrink) {
+  RegistryLock lock;
+  size_t i = 0;
+  while (i < cacheCount && caches[i].owner != owner) {
+    i++;
+  }
+  if (i == MAX_CACHES) {
+    LOG_ERR("MBG", "No room to register cache %s", name);
+    return false;
+  }
+  caches[i] = {owner, name, priority, std::move(shrink)};
+  if (i == cacheCount) {
+    cacheCount++;
+  }
+  return true;
+}
+
+void MemoryBudget::unregisterCache(const void* owner) {
+  RegistryLock lock;
+  for (size_t i = 0; i < cacheCount; i++) {
+    if (caches[i].owner == owner) {
+      caches[i] = std::move(caches[cacheCount - 1]);
+      caches[cacheCount - 1] = {};
+      cacheCount--;
+      return;
+    }
+  }
+}
+
+bool MemoryBudget::reserve(const size_t bytes, const size_t largestBlock) {
+  if (fits(bytes, largestBlock)) {
+    return true;
+  }
+  if (!cacheLockHeld || !cacheLockHeld()) {
+    return false;
+  }
+
+  RegistryLock lock;
+  for (int priority = EVICT_FIRST; priority <= EVICT_LAST; priority++) {
+    for (size_t i = 0; i < cacheCount; i++) {
+      if (caches[i].priority != priority) {
+        continue;
+      }
+      bool shrunk = false;
+      while (!fits(bytes, largestBlock) && caches[i].shrink()) {
+        shrunk = true;
+      }
+      if (shrunk) {
+        LOG_DBG("MBG", "Shrank %s for %u bytes (largest block %u)", caches[i].name, static_cast<unsigned>(bytes),
+                static_cast<unsigned>(largestBlock));
+      }
+      if (fits(bytes, largestBlock)) {
+        return true;
+      }
+    }
+  }
+  LOG_DBG("MBG", "No room for %u bytes (largest block %u) with the caches emptied", static_cast<unsigned>(bytes),
+          static_cast<unsigned>(largestBlock));
+  return false;
+}
+
+void MemoryBudget::setCacheLockCheck(bool (*held)()) { cacheLockHeld = held; }
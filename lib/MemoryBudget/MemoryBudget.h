@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+/**
+ * Shares the heap between the render path's caches and the large allocations that have to succeed next to them: the
+ * BW buffer store of a grayscale render, an inflate window taken off the heap, a cover decode. Caches register with a
+ * priority and a shrink callback; reserve() checks whether an allocation fits and, if it doesn't, shrinks the caches
+ * lowest priority first until it does. The caches can then keep as much as the heap allows.
+ *
+ * The registered caches are only used with the render lock held, so reserve() only shrinks them on a task holding it
+ * (see setCacheLockCheck()); anywhere else it just tells whether the allocation fits.
+ */
+class MemoryBudget {
+ public:
+  enum Priority : uint8_t {
+    EVICT_FIRST,  // Cheap to rebuild
+    EVICT_NORMAL,
+    EVICT_LAST,  // A screen's worth of drawing to rebuild
+  };
+  // Frees the least valuable part of the cache; false once there is nothing left to free
+  using Shrinker = std::function<bool()>;
+
+  static constexpr size_t MAX_CACHES = 8;
+
+  // owner identifies the cache to unregisterCache(); the name is only logged and must outlive the registration
+  static bool registerCache(const void* owner, const char* name, Priority priority, Shrinker shrink);
+  static void unregisterCache(const void* owner);
+
+  // Makes room for bytes of allocations, none bigger than largestBlock, shrinking caches if needed. Returns whether
+  // the heap has the room now; the caller still checks its allocations.
+  static bool reserve(size_t bytes, size_t largestBlock);
+
+  // held() tells whether the calling task holds the lock the registered caches are used under
+  static void setCacheLockCheck(bool (*held)());
+};
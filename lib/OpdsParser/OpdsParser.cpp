@@ -6,7 +6,7 @@
 #include <cstring>
 
 OpdsParser::OpdsParser() {
-  parser = XML_ParserCreate(nullptr);
+  parser = createXmlParser();
   if (!parser) {
     errorOccured = true;
     LOG_DBG("OPDS", "Couldn't allocate memory for parser");
@@ -62,22 +62,24 @@ void OpdsParser::flush() {
 
 bool OpdsParser::error() const { return errorOccured; }
 
+void OpdsParser::setWindow(const size_t first, const size_t count) {
+  windowFirst = first;
+  windowCount = count;
+  entries.clear();
+  if (count != SIZE_MAX) {
+    entries.reserve(count);
+  }
+}
+
 void OpdsParser::clear() {
   entries.clear();
+  entryCount = 0;
   searchTemplate.clear();
   nextPageUrl.clear();
   prevPageUrl.clear();
   currentEntry = OpdsEntry{};
   currentText.clear();
-  inEntry = inTitle = inAuthor = inAuthorName = inId = false;
-}
-
-std::vector<OpdsEntry> OpdsParser::getBooks() const {
-  std::vector<OpdsEntry> books;
-  for (const auto& entry : entries) {
-    if (entry.type == OpdsEntryType::BOOK) books.push_back(entry);
-  }
-  return books;
+  inEntry = inTitle = inAuthor = inAuthorName = inId = haveThumbnail = false;
 }
 
 const char* OpdsParser::findAttribute(const XML_Char** atts, const char* name) {
@@ -107,6 +109,17 @@ void XMLCALL OpdsParser::startElement(void* userData, const XML_Char* name, cons
         self->prevPageUrl = href;
       }
 
+      if (self->inEntry && rel) {
+        if (strcmp(rel, "http://opds-spec.org/image/thumbnail") == 0 ||
+            strcmp(rel, "x-stanza-cover-image-thumbnail") == 0) {
+          self->currentEntry.thumbnailHref = href;
+          self->haveThumbnail = true;
+        } else if ((strcmp(rel, "http://opds-spec.org/image") == 0 || strcmp(rel, "x-stanza-cover-image") == 0) &&
+                   !self->haveThumbnail) {
+          self->currentEntry.thumbnailHref = href;
+        }
+      }
+
       if (self->inEntry) {
         if (rel && type && strstr(rel, "opds-spec.org/acquisition") != nullptr &&
             strcmp(type, "application/epub+zip") == 0) {
@@ -124,6 +137,7 @@ void XMLCALL OpdsParser::startElement(void* userData, const XML_Char* name, cons
 
   if (strcmp(name, "entry") == 0 || strstr(name, ":entry") != nullptr) {
     self->inEntry = true;
+    self->haveThumbnail = false;
     self->currentEntry = OpdsEntry{};
     return;
   }
@@ -149,7 +163,10 @@ void XMLCALL OpdsParser::endElement(void* userData, const XML_Char* name) {
 
   if (strcmp(name, "entry") == 0 || strstr(name, ":entry") != nullptr) {
     if (!self->currentEntry.title.empty() && !self->currentEntry.href.empty()) {
-      self->entries.push_back(self->currentEntry);
+      if (self->entryCount >= self->windowFirst && self->entries.size() < self->windowCount) {
+        self->entries.push_back(std::move(self->currentEntry));
+      }
+      self->entryCount++;
     }
     self->inEntry = false;
   } else if (self->inEntry) {
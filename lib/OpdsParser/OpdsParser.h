@@ -2,6 +2,8 @@
 #include <Print.h>
 #include <expat.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -22,6 +24,7 @@ struct OpdsEntry {
   std::string author;  // Only for books
   std::string href;    // Navigation URL or epub download URL
   std::string id;
+  std::string thumbnailHref;  // Cover thumbnail, or the full cover if the entry lists no thumbnail; may be empty
 };
 
 // Legacy alias for backward compatibility
@@ -29,17 +32,21 @@ using OpdsBook = OpdsEntry;
 
 /**
  * Parser for OPDS (Open Publication Distribution System) Atom feeds.
- * Uses the Expat XML parser to parse OPDS catalog entries.
+ * Uses the Expat XML parser to parse OPDS catalog entries as the feed is streamed in.
+ *
+ * Only the entries inside the window set with setWindow() are kept; the rest are counted and dropped as soon as they
+ * are parsed, so memory stays bounded by the window however large the feed is. The default window keeps everything.
  *
  * Usage:
  *   OpdsParser parser;
- *   if (parser.parse(xmlData, xmlLength)) {
+ *   parser.setWindow(firstEntry, PAGE_ITEMS);
+ *   {
+ *     OpdsParserStream stream{parser};
+ *     HttpDownloader::fetchUrl(url, stream);
+ *   }
+ *   if (parser) {
  *     for (const auto& entry : parser.getEntries()) {
- *       if (entry.type == OpdsEntryType::BOOK) {
- *         // Downloadable book
- *       } else {
- *         // Navigation link to another catalog
- *       }
+ *       // Entries firstEntry.. of the feed, parser.getEntryCount() in total
  *     }
  *   }
  */
@@ -65,17 +72,21 @@ class OpdsParser final : public Print {
   operator bool() { return !error(); }
 
   /**
-   * Get the parsed entries (both navigation and book entries).
+   * Keep only entries first .. first + count - 1 (in feed order). Call before writing any data.
+   */
+  void setWindow(size_t first, size_t count);
+
+  /**
+   * Get the parsed entries (both navigation and book entries) inside the window.
    * @return Vector of OpdsEntry entries
    */
   const std::vector<OpdsEntry>& getEntries() const& { return entries; }
   std::vector<OpdsEntry> getEntries() && { return std::move(entries); }
 
   /**
-   * Get only book entries (legacy compatibility).
-   * @return Vector of book entries
+   * Number of entries in the whole feed, including those outside the window.
    */
-  std::vector<OpdsEntry> getBooks() const;
+  size_t getEntryCount() const { return entryCount; }
 
   /**
    * Clear all parsed entries.
@@ -96,6 +107,9 @@ class OpdsParser final : public Print {
 
   XML_Parser parser = nullptr;
   std::vector<OpdsEntry> entries;
+  size_t windowFirst = 0;
+  size_t windowCount = SIZE_MAX;
+  size_t entryCount = 0;
   OpdsEntry currentEntry;
   std::string currentText;
 
@@ -105,6 +119,7 @@ class OpdsParser final : public Print {
   bool inAuthor = false;
   bool inAuthorName = false;
   bool inId = false;
+  bool haveThumbnail = false;  // thumbnailHref is a thumbnail rather than the full cover
 
   bool errorOccured = false;
 };
@@ -201,6 +201,7 @@ struct PngDecodeContext {
   // Palette for indexed color (type 3)
   uint8_t palette[256 * 3];
   int paletteSize;
+  uint8_t paletteGray[256];  // Gray of every index, out-of-range ones as index 0
 };
 
 // Read the next IDAT chunk header, skipping non-IDAT chunks
@@ -274,41 +275,75 @@ static bool decodeScanline(PngDecodeContext& ctx) {
   // Decompress raw row data into currentRow
   if (!ctx.reader.read(ctx.currentRow, ctx.rawRowBytes)) return false;
 
-  // Apply reverse filter
-  const int bpp = ctx.bytesPerPixel;
+  // Apply reverse filter. The first pixel has no left neighbour (a = c = 0), so it's done apart and the loops over
+  // the rest don't test for it; one byte per pixel (grey and palette images, most of an EPUB's PNGs) keeps the left
+  // neighbours in registers.
+  const uint32_t bpp = ctx.bytesPerPixel;
+  const uint32_t n = ctx.rawRowBytes;
+  uint8_t* cur = ctx.currentRow;
+  const uint8_t* prev = ctx.previousRow;
 
   switch (filterType) {
     case PNG_FILTER_NONE:
       break;
 
     case PNG_FILTER_SUB:
-      for (uint32_t i = bpp; i < ctx.rawRowBytes; i++) {
-        ctx.currentRow[i] += ctx.currentRow[i - bpp];
+      if (bpp == 1) {
+        uint8_t left = cur[0];
+        for (uint32_t i = 1; i < n; i++) {
+          left = cur[i] += left;
+        }
+      } else {
+        for (uint32_t i = bpp; i < n; i++) {
+          cur[i] += cur[i - bpp];
+        }
       }
       break;
 
     case PNG_FILTER_UP:
-      for (uint32_t i = 0; i < ctx.rawRowBytes; i++) {
-        ctx.currentRow[i] += ctx.previousRow[i];
+      for (uint32_t i = 0; i < n; i++) {
+        cur[i] += prev[i];
       }
       break;
 
-    case PNG_FILTER_AVERAGE:
-      for (uint32_t i = 0; i < ctx.rawRowBytes; i++) {
-        uint8_t a = (i >= static_cast<uint32_t>(bpp)) ? ctx.currentRow[i - bpp] : 0;
-        uint8_t b = ctx.previousRow[i];
-        ctx.currentRow[i] += (a + b) / 2;
+    case PNG_FILTER_AVERAGE: {
+      const uint32_t first = bpp < n ? bpp : n;
+      for (uint32_t i = 0; i < first; i++) {
+        cur[i] += prev[i] / 2;
+      }
+      if (bpp == 1) {
+        uint8_t left = cur[0];
+        for (uint32_t i = 1; i < n; i++) {
+          left = cur[i] += (left + prev[i]) / 2;
+        }
+      } else {
+        for (uint32_t i = bpp; i < n; i++) {
+          cur[i] += (cur[i - bpp] + prev[i]) / 2;
+        }
       }
       break;
+    }
 
-    case PNG_FILTER_PAETH:
-      for (uint32_t i = 0; i < ctx.rawRowBytes; i++) {
-        uint8_t a = (i >= static_cast<uint32_t>(bpp)) ? ctx.currentRow[i - bpp] : 0;
-        uint8_t b = ctx.previousRow[i];
-        uint8_t c = (i >= static_cast<uint32_t>(bpp)) ? ctx.previousRow[i - bpp] : 0;
-        ctx.currentRow[i] += paethPredictor(a, b, c);
+    case PNG_FILTER_PAETH: {
+      const uint32_t first = bpp < n ? bpp : n;
+      for (uint32_t i = 0; i < first; i++) {
+        cur[i] += prev[i];  // paethPredictor(0, b, 0) is b
+      }
+      if (bpp == 1) {
+        uint8_t left = cur[0];
+        uint8_t upLeft = prev[0];
+        for (uint32_t i = 1; i < n; i++) {
+          const uint8_t up = prev[i];
+          left = cur[i] += paethPredictor(left, up, upLeft);
+          upLeft = up;
+        }
+      } else {
+        for (uint32_t i = bpp; i < n; i++) {
+          cur[i] += paethPredictor(cur[i - bpp], prev[i], prev[i - bpp]);
+        }
       }
       break;
+    }
 
     default:
       LOG_ERR("PNG", "Unknown filter type: %d", filterType);
@@ -355,15 +390,16 @@ static void convertScanlineToGray(const PngDecodeContext& ctx, uint8_t* grayRow)
       break;
 
     case PNG_COLOR_PALETTE: {
-      const int ppb = 8 / ctx.bitDepth;
-      const uint8_t mask = (1 << ctx.bitDepth) - 1;
-      const uint8_t* pal = ctx.palette;
-      const int palSize = ctx.paletteSize;
-      for (uint32_t x = 0; x < w; x++) {
-        int shift = (ppb - 1 - (x % ppb)) * ctx.bitDepth;
-        uint8_t idx = (src[x / ppb] >> shift) & mask;
-        if (idx >= palSize) idx = 0;
-        grayRow[x] = (pal[idx * 3] * 25 + pal[idx * 3 + 1] * 50 + pal[idx * 3 + 2] * 25) / 100;
+      const uint8_t* palGray = ctx.paletteGray;
+      if (ctx.bitDepth == 8) {
+        for (uint32_t x = 0; x < w; x++) grayRow[x] = palGray[src[x]];
+      } else {
+        const int ppb = 8 / ctx.bitDepth;
+        const uint8_t mask = (1 << ctx.bitDepth) - 1;
+        for (uint32_t x = 0; x < w; x++) {
+          int shift = (ppb - 1 - (x % ppb)) * ctx.bitDepth;
+          grayRow[x] = palGray[(src[x / ppb] >> shift) & mask];
+        }
       }
       break;
     }
@@ -555,6 +591,13 @@ bool PngToBmpConverter::pngFileToBmpStreamInternal(FsFile& pngFile, Print& bmpOu
     return false;
   }
 
+  if (colorType == PNG_COLOR_PALETTE) {
+    for (int i = 0; i < 256; i++) {
+      const uint8_t* entry = &ctx.palette[(i < ctx.paletteSize ? i : 0) * 3];
+      ctx.paletteGray[i] = (entry[0] * 25 + entry[1] * 50 + entry[2] * 25) / 100;
+    }
+  }
+
   // Initialize streaming decompressor with 32KB ring buffer for back-reference history
   if (!ctx.reader.init(true)) {
     LOG_ERR("PNG", "Failed to init inflate reader");
@@ -0,0 +1,86 @@
+#pragma once
+#include <HalStorage.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+/**
+ * Read-ahead window over a file for deserializing many small fields: each read is served from a buffer refilled a
+ * window at a time, instead of taking the storage lock for every few bytes. Reads larger than the window go straight
+ * to the file. Seeks within the window keep it.
+ *
+ * The file's own position runs ahead of the reader's while it is in use; seek the file before reading it directly
+ * again. Without memory for the window, reads go straight to the file.
+ */
+class BufferedFileReader {
+ public:
+  explicit BufferedFileReader(FsFile& file, const size_t capacity = 512)
+      : file(file), buffer(static_cast<uint8_t*>(malloc(capacity))), capacity(capacity), windowStart(file.position()) {}
+  ~BufferedFileReader() { free(buffer); }
+  BufferedFileReader(const BufferedFileReader&) = delete;
+  BufferedFileReader& operator=(const BufferedFileReader&) = delete;
+
+  // Returns the number of bytes read, short at the end of the file
+  int read(void* out, const size_t count) {
+    auto* bytes = static_cast<uint8_t*>(out);
+    size_t done = 0;
+    while (done < count) {
+      if (offset == length) {
+        // The window is used up and the file is positioned just past it
+        windowStart += length;
+        offset = length = 0;
+        if (!buffer || count - done >= capacity) {
+          const int bytesRead = file.read(bytes + done, count - done);
+          if (bytesRead > 0) {
+            windowStart += bytesRead;
+            done += bytesRead;
+          }
+          break;
+        }
+        const int bytesRead = file.read(buffer, capacity);
+        if (bytesRead <= 0) {
+          break;
+        }
+        length = bytesRead;
+      }
+      const size_t chunk = std::min(count - done, length - offset);
+      memcpy(bytes + done, buffer + offset, chunk);
+      offset += chunk;
+      done += chunk;
+    }
+    return static_cast<int>(done);
+  }
+
+  bool seek(const size_t position) {
+    if (position >= windowStart && position <= windowStart + length) {
+      offset = position - windowStart;
+      return true;
+    }
+    if (!file.seek(position)) {
+      return false;
+    }
+    windowStart = position;
+    offset = length = 0;
+    return true;
+  }
+
+  bool skip(const size_t count) { return seek(position() + count); }
+
+  size_t position() const { return windowStart + offset; }
+
+  // Bytes left in the file after the reader's position
+  size_t available() {
+    const size_t size = file.size();
+    return size > position() ? size - position() : 0;
+  }
+
+ private:
+  FsFile& file;
+  uint8_t* buffer;
+  size_t capacity;
+  // File position of the first byte in the buffer; the reader is at windowStart + offset
+  size_t windowStart;
+  size_t length = 0;
+  size_t offset = 0;
+};
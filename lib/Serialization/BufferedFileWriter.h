@@ -0,0 +1,119 @@
+#pragma once
+#include <HalStorage.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+/**
+ * Write-combining buffer over a file for serializing many small fields: writes are collected and handed to the file
+ * in whole sectors, instead of one small write (and storage lock) per field. The first flush only fills up to the
+ * next sector boundary, so later ones each cover whole sectors. Writes larger than the buffer go straight to the
+ * file.
+ *
+ * Buffered bytes only reach the file on flush(): flush before seeking, reading or closing the file, and before
+ * taking its position. Destroying the writer drops what it still holds, so a file closed on an error path is never
+ * written to. Without memory for the buffer, writes go straight to the file.
+ *
+ * A writer made without a file keeps everything written to it in a buffer that grows as needed, for records that are
+ * transformed before they reach a file (see data()).
+ */
+class BufferedFileWriter {
+ public:
+  static constexpr size_t SECTOR_SIZE = 512;
+
+  explicit BufferedFileWriter(FsFile& file, const size_t capacity = 2048)
+      : file(&file),
+        buffer(static_cast<uint8_t*>(malloc(capacity))),
+        capacity(capacity),
+        filePosition(file.position()) {}
+  BufferedFileWriter() : file(nullptr), buffer(nullptr), capacity(0), filePosition(0) {}
+  ~BufferedFileWriter() { free(buffer); }
+  BufferedFileWriter(const BufferedFileWriter&) = delete;
+  BufferedFileWriter& operator=(const BufferedFileWriter&) = delete;
+
+  // Returns count, or 0 once a write to the file has failed
+  size_t write(const void* data, const size_t count) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    if (!file) {
+      return append(bytes, count) ? count : 0;
+    }
+    size_t done = 0;
+    while (done < count && !failed) {
+      // Fill up to the next sector boundary of the file
+      const size_t limit = buffer ? capacity - filePosition % SECTOR_SIZE : 0;
+      if (length == 0 && count - done >= limit) {
+        writeThrough(bytes + done, count - done);
+        break;
+      }
+      const size_t chunk = std::min(count - done, limit - length);
+      memcpy(buffer + length, bytes + done, chunk);
+      length += chunk;
+      done += chunk;
+      if (length == limit) {
+        flush();
+      }
+    }
+    return failed ? 0 : count;
+  }
+  size_t write(const uint8_t byte) { return write(&byte, 1); }
+
+  // Writes the buffered bytes out to the file; false if any write failed
+  bool flush() {
+    if (!file) {
+      return !failed;
+    }
+    if (length > 0 && !failed) {
+      writeThrough(buffer, length);
+    }
+    length = 0;
+    return !failed;
+  }
+
+  // Position in the file of the next byte written
+  size_t position() const { return filePosition + length; }
+
+  // Without a file: the bytes written since the last clear()
+  const uint8_t* data() const { return buffer; }
+  void clear() {
+    length = 0;
+    failed = false;
+  }
+
+ private:
+  bool append(const uint8_t* bytes, const size_t count) {
+    if (failed) {
+      return false;
+    }
+    if (length + count > capacity) {
+      // Grown a sector at a time: it only grows until it fits the largest record
+      const size_t grown = (length + count + SECTOR_SIZE - 1) / SECTOR_SIZE * SECTOR_SIZE;
+      auto* larger = static_cast<uint8_t*>(realloc(buffer, grown));
+      if (!larger) {
+        failed = true;
+        return false;
+      }
+      buffer = larger;
+      capacity = grown;
+    }
+    memcpy(buffer + length, bytes, count);
+    length += count;
+    return true;
+  }
+
+  void writeThrough(const uint8_t* bytes, const size_t count) {
+    if (file->write(bytes, count) != count) {
+      failed = true;
+      return;
+    }
+    filePosition += count;
+  }
+
+  FsFile* file;
+  uint8_t* buffer;
+  size_t capacity;
+  // File position of the first byte in the buffer
+  size_t filePosition;
+  size_t length = 0;
+  bool failed = false;
+};
@@ -0,0 +1,117 @@
+#include "LzCodec.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace lz {
+
+namespace {
+constexpr size_t MIN_MATCH = 4;
+constexpr uint32_t HASH_BITS = 10;
+static_assert(HASH_ENTRIES == 1u << HASH_BITS, "Hash table size mismatch");
+
+uint32_t hashAt(const uint8_t* p) {
+  uint32_t value;
+  memcpy(&value, p, sizeof(value));
+  return (value * 2654435761u) >> (32 - HASH_BITS);
+}
+
+// Writes a length beyond the 15 of its token nibble as 255-valued bytes and a final remainder
+bool putLength(BufferedFileWriter& out, size_t length) {
+  for (; length >= 255; length -= 255) {
+    out.write(static_cast<uint8_t>(255));
+  }
+  return out.write(static_cast<uint8_t>(length)) != 0;
+}
+
+bool getLength(const uint8_t*& ip, const uint8_t* end, size_t& length) {
+  uint8_t byte;
+  do {
+    if (ip == end) return false;
+    byte = *ip++;
+    length += byte;
+  } while (byte == 255);
+  return true;
+}
+
+// Once a write to the writer fails, so do all later ones: the last write of a sequence tells whether all of it and
+// everything before it were written
+bool putSequence(BufferedFileWriter& out, const uint8_t* literals, const size_t literalCount, const size_t matchLength,
+                 const uint16_t distance) {
+  const size_t length = matchLength - MIN_MATCH;
+  uint8_t token = static_cast<uint8_t>(std::min<size_t>(literalCount, 15) << 4);
+  if (matchLength > 0) {
+    token |= static_cast<uint8_t>(std::min<size_t>(length, 15));
+  }
+  bool written = out.write(token) != 0;
+  if (literalCount >= 15) {
+    written = putLength(out, literalCount - 15);
+  }
+  if (literalCount > 0) {
+    written = out.write(literals, literalCount) != 0;
+  }
+  if (matchLength == 0) {
+    return written;
+  }
+  const uint8_t distanceBytes[2] = {static_cast<uint8_t>(distance), static_cast<uint8_t>(distance >> 8)};
+  written = out.write(distanceBytes, sizeof(distanceBytes)) != 0;
+  return length >= 15 ? putLength(out, length - 15) : written;
+}
+}  // namespace
+
+bool compress(const uint8_t* in, const size_t size, BufferedFileWriter& out, uint16_t* table) {
+  if (size > UINT16_MAX) return false;
+  size_t anchor = 0;
+  size_t i = 0;
+  memset(table, 0, HASH_ENTRIES * sizeof(uint16_t));
+  // Position 0 reads as "no candidate", which only loses matches against the first byte
+  while (i + MIN_MATCH <= size) {
+    const uint32_t hash = hashAt(in + i);
+    const size_t candidate = table[hash];
+    table[hash] = static_cast<uint16_t>(i);
+    if (candidate == 0 || memcmp(in + candidate, in + i, MIN_MATCH) != 0) {
+      i++;
+      continue;
+    }
+
+    size_t length = MIN_MATCH;
+    while (i + length < size && in[candidate + length] == in[i + length]) {
+      length++;
+    }
+    putSequence(out, in + anchor, i - anchor, length, static_cast<uint16_t>(i - candidate));
+    i += length;
+    anchor = i;
+  }
+  return putSequence(out, in + anchor, size - anchor, 0, 0);
+}
+
+bool decompress(const uint8_t* in, const size_t size, uint8_t* out, const size_t outSize) {
+  const uint8_t* ip = in;
+  const uint8_t* const inEnd = in + size;
+  size_t pos = 0;
+  while (ip < inEnd) {
+    const uint8_t token = *ip++;
+    size_t literalCount = token >> 4;
+    if (literalCount == 15 && !getLength(ip, inEnd, literalCount)) return false;
+    if (static_cast<size_t>(inEnd - ip) < literalCount || outSize - pos < literalCount) return false;
+    memcpy(out + pos, ip, literalCount);
+    ip += literalCount;
+    pos += literalCount;
+    if (ip == inEnd) break;
+
+    if (inEnd - ip < 2) return false;
+    const size_t distance = ip[0] | ip[1] << 8;
+    ip += 2;
+    size_t length = token & 0x0F;
+    if (length == 15 && !getLength(ip, inEnd, length)) return false;
+    length += MIN_MATCH;
+    if (distance == 0 || distance > pos || outSize - pos < length) return false;
+    // Byte by byte: a match may overlap the bytes it produces
+    for (const uint8_t* match = out + pos - distance; length > 0; length--) {
+      out[pos++] = *match++;
+    }
+  }
+  return pos == outSize;
+}
+
+}  // namespace lz
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "BufferedFileWriter.h"
+
+/**
+ * Small-window LZ coding of cache records, in the LZ4 block layout: each sequence is a token byte (literal count in
+ * the high nibble, match length - 4 in the low one, 15 meaning more length bytes follow), the literals, and a
+ * little-endian 16-bit match distance. The last sequence has literals only.
+ *
+ * Decoding needs no state besides the output, and matches reach back at most 64KB, so a record is decoded straight
+ * into the buffer it is read into.
+ */
+namespace lz {
+
+// Entries of the match finder's hash table the caller passes to compress()
+constexpr size_t HASH_ENTRIES = 1024;
+
+// Compresses size bytes of in (at most 64KB) as they are written to out; data without repeats grows by about one
+// byte in 255. table must hold HASH_ENTRIES entries, its contents on entry don't matter. False if a write failed.
+bool compress(const uint8_t* in, size_t size, BufferedFileWriter& out, uint16_t* table);
+
+// Decodes size bytes of in into out, which must come out exactly outSize bytes long. False if the data is corrupt.
+bool decompress(const uint8_t* in, size_t size, uint8_t* out, size_t outSize);
+
+}  // namespace lz
@@ -1,6 +1,9 @@
 #pragma once
 #include <HalStorage.h>
 
+#include "BufferedFileReader.h"
+#include "BufferedFileWriter.h"
+
 #include <iostream>
 
 namespace serialization {
@@ -14,6 +17,11 @@ static void writePod(FsFile& file, const T& value) {
   file.write(reinterpret_cast<const uint8_t*>(&value), sizeof(T));
 }
 
+template <typename T>
+static void writePod(BufferedFileWriter& writer, const T& value) {
+  writer.write(&value, sizeof(T));
+}
+
 template <typename T>
 static void readPod(std::istream& is, T& value) {
   is.read(reinterpret_cast<char*>(&value), sizeof(T));
@@ -24,6 +32,21 @@ static void readPod(FsFile& file, T& value) {
   file.read(reinterpret_cast<uint8_t*>(&value), sizeof(T));
 }
 
+template <typename T>
+static void readPod(BufferedFileReader& reader, T& value) {
+  reader.read(&value, sizeof(T));
+}
+
+// FNV-1a over the raw bytes of a value, as written by writePod; start hash at 2166136261u
+template <typename T>
+static void hashPod(uint32_t& hash, const T& value) {
+  const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+  for (size_t i = 0; i < sizeof(T); i++) {
+    hash ^= bytes[i];
+    hash *= 16777619u;
+  }
+}
+
 static void writeString(std::ostream& os, const std::string& s) {
   const uint32_t len = s.size();
   writePod(os, len);
@@ -36,6 +59,12 @@ static void writeString(FsFile& file, const std::string& s) {
   file.write(reinterpret_cast<const uint8_t*>(s.data()), len);
 }
 
+static void writeString(BufferedFileWriter& writer, const std::string& s) {
+  const uint32_t len = s.size();
+  writePod(writer, len);
+  writer.write(s.data(), len);
+}
+
 static void readString(std::istream& is, std::string& s) {
   uint32_t len;
   readPod(is, len);
@@ -49,4 +78,54 @@ static void readString(FsFile& file, std::string& s) {
   s.resize(len);
   file.read(&s[0], len);
 }
+
+static void readString(BufferedFileReader& reader, std::string& s) {
+  uint32_t len;
+  readPod(reader, len);
+  s.resize(len);
+  reader.read(&s[0], len);
+}
+
+// Varints: 7 bits per byte, lowest first, with the top bit set on every byte but the last; values below 128 take one
+static constexpr size_t MAX_VARINT_SIZE = 5;
+
+static void writeVarint(BufferedFileWriter& writer, uint32_t value) {
+  uint8_t bytes[MAX_VARINT_SIZE];
+  size_t n = 0;
+  while (value >= 0x80) {
+    bytes[n++] = static_cast<uint8_t>(value) | 0x80;
+    value >>= 7;
+  }
+  bytes[n++] = static_cast<uint8_t>(value);
+  writer.write(bytes, n);
+}
+
+static bool readVarint(BufferedFileReader& reader, uint32_t& value) {
+  value = 0;
+  for (size_t i = 0; i < MAX_VARINT_SIZE; i++) {
+    uint8_t byte;
+    if (reader.read(&byte, 1) != 1) {
+      return false;
+    }
+    value |= static_cast<uint32_t>(byte & 0x7F) << (7 * i);
+    if ((byte & 0x80) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Signed values zigzag encoded (0, -1, 1, -2, ... as 0, 1, 2, 3, ...), so small ones of either sign take one byte
+static void writeSignedVarint(BufferedFileWriter& writer, const int32_t value) {
+  writeVarint(writer, (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31));
+}
+
+static bool readSignedVarint(BufferedFileReader& reader, int32_t& value) {
+  uint32_t zigzag;
+  if (!readVarint(reader, zigzag)) {
+    return false;
+  }
+  value = static_cast<int32_t>(zigzag >> 1) ^ -static_cast<int32_t>(zigzag & 1);
+  return true;
+}
 }  // namespace serialization
@@ -1,5 +1,9 @@
 #include "Utf8.h"
 
+#include <HalIram.h>
+
+#include <cstring>
+
 int utf8CodepointLen(const unsigned char c) {
   if (c < 0x80) return 1;          // 0xxxxxxx
   if ((c >> 5) == 0x6) return 2;   // 110xxxxx
@@ -8,11 +12,7 @@ int utf8CodepointLen(const unsigned char c) {
   return 1;                        // fallback for invalid
 }
 
-uint32_t utf8NextCodepoint(const unsigned char** string) {
-  if (**string == 0) {
-    return 0;
-  }
-
+HOT_IRAM uint32_t utf8NextMultibyteCodepoint(const unsigned char** string) {
   const unsigned char lead = **string;
   const int bytes = utf8CodepointLen(lead);
   const uint8_t* chr = *string;
@@ -25,7 +25,7 @@ uint32_t utf8NextCodepoint(const unsigned char** string) {
 
   if (bytes == 1) {
     (*string)++;
-    return chr[0];
+    return chr[0];  // ASCII, for callers that come here directly
   }
 
   // Validate continuation bytes before consuming them
@@ -56,6 +56,38 @@ uint32_t utf8NextCodepoint(const unsigned char** string) {
   return cp;
 }
 
+size_t utf8DecodeCodepoints(const char* text, const size_t length, uint32_t* out, const size_t maxCount,
+                            size_t* consumed) {
+  const auto* p = reinterpret_cast<const unsigned char*>(text);
+  const unsigned char* const end = p + length;
+  size_t count = 0;
+  while (count < maxCount && p < end) {
+    // Four ASCII bytes, none of them NUL: no high bit set, and no byte that borrows when 1 is subtracted from each
+    if (end - p >= 4 && maxCount - count >= 4) {
+      uint32_t word;
+      memcpy(&word, p, sizeof(word));
+      if (((word | ((word - 0x01010101u) & ~word)) & 0x80808080u) == 0) {
+        out[count] = p[0];
+        out[count + 1] = p[1];
+        out[count + 2] = p[2];
+        out[count + 3] = p[3];
+        count += 4;
+        p += 4;
+        continue;
+      }
+    }
+    const uint32_t cp = utf8NextCodepoint(&p);
+    if (cp == 0) {
+      break;
+    }
+    out[count++] = cp;
+  }
+  if (consumed) {
+    *consumed = p - reinterpret_cast<const unsigned char*>(text);
+  }
+  return count;
+}
+
 int utf8SafeTruncateBuffer(const char* buf, int len) {
   if (len <= 0) return 0;
 
@@ -4,7 +4,27 @@
 #include <string>
 #define REPLACEMENT_GLYPH 0xFFFD
 
-uint32_t utf8NextCodepoint(const unsigned char** string);
+// Decodes the sequence at *string that isn't ASCII: a multi-byte codepoint, or REPLACEMENT_GLYPH for an invalid one
+uint32_t utf8NextMultibyteCodepoint(const unsigned char** string);
+
+// Decodes the codepoint at *string and advances past it; 0 at the terminating NUL, which is not consumed. ASCII, most
+// of the text of Latin-script books, takes one compare and no call.
+inline uint32_t utf8NextCodepoint(const unsigned char** string) {
+  const unsigned char c = **string;
+  if (c < 0x80) {
+    if (c != 0) {
+      (*string)++;
+    }
+    return c;
+  }
+  return utf8NextMultibyteCodepoint(string);
+}
+
+// Decodes up to maxCount codepoints of text, which is NUL-terminated at length, into out, as many utf8NextCodepoint()
+// calls would; the NUL, if reached first, ends it. Runs of ASCII are checked and copied 4 bytes at a time. Returns the
+// number of codepoints written; *consumed (if given) is set to the bytes they took.
+size_t utf8DecodeCodepoints(const char* text, size_t length, uint32_t* out, size_t maxCount,
+                            size_t* consumed = nullptr);
 // Remove the last UTF-8 codepoint from a std::string and return the new size.
 size_t utf8RemoveLastChar(std::string& str);
 // Truncate string by removing N UTF-8 codepoints from the end.
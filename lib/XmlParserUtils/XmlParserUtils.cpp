@@ -0,0 +1,226 @@
+#include "XmlParserUtils.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <strings.h>
+
+namespace {
+
+// Peak expat usage for one document with XML_CONTEXT_BYTES=1024 is about 12KB (the 4KB parse buffer, tag and
+// attribute stacks, the DTD and the bindings); the rest is headroom for long attribute lists and deep nesting.
+constexpr size_t XML_PARSER_ARENA_SIZE = 16 * 1024;
+constexpr size_t ALIGNMENT = 8;
+
+// Every arena allocation is preceded by its block header. Free blocks form a list sorted by address so that
+// neighbours can be merged on free.
+struct Block {
+  size_t size;  // Including the header
+  Block* next;  // Only meaningful while the block is free
+};
+constexpr size_t HEADER_SIZE = (sizeof(Block) + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+
+uint8_t* arena = nullptr;
+Block* freeList = nullptr;
+
+XML_Parser sharedParser = nullptr;
+std::atomic<bool> sharedParserInUse{false};
+
+bool inArena(const void* ptr) {
+  const auto* p = static_cast<const uint8_t*>(ptr);
+  return arena && p >= arena && p < arena + XML_PARSER_ARENA_SIZE;
+}
+
+Block* headerOf(void* ptr) { return reinterpret_cast<Block*>(static_cast<uint8_t*>(ptr) - HEADER_SIZE); }
+
+void* payloadOf(Block* block) { return reinterpret_cast<uint8_t*>(block) + HEADER_SIZE; }
+
+void* arenaMalloc(const size_t size) {
+  const size_t needed = HEADER_SIZE + ((size + ALIGNMENT - 1) & ~(ALIGNMENT - 1));
+  // First fit
+  for (Block** link = &freeList; *link; link = &(*link)->next) {
+    Block* block = *link;
+    if (block->size < needed) {
+      continue;
+    }
+    if (block->size - needed >= HEADER_SIZE + ALIGNMENT) {
+      auto* rest = reinterpret_cast<Block*>(reinterpret_cast<uint8_t*>(block) + needed);
+      rest->size = block->size - needed;
+      rest->next = block->next;
+      *link = rest;
+      block->size = needed;
+    } else {
+      *link = block->next;
+    }
+    return payloadOf(block);
+  }
+  // Arena exhausted (an unusually large document): fall back to the heap
+  return malloc(size);
+}
+
+void arenaFree(void* ptr) {
+  if (!ptr) {
+    return;
+  }
+  if (!inArena(ptr)) {
+    free(ptr);
+    return;
+  }
+
+  Block* block = headerOf(ptr);
+  Block* prev = nullptr;
+  Block* next = freeList;
+  while (next && next < block) {
+    prev = next;
+    next = next->next;
+  }
+
+  block->next = next;
+  if (next && reinterpret_cast<uint8_t*>(block) + block->size == reinterpret_cast<uint8_t*>(next)) {
+    block->size += next->size;
+    block->next = next->next;
+  }
+  if (prev && reinterpret_cast<uint8_t*>(prev) + prev->size == reinterpret_cast<uint8_t*>(block)) {
+    prev->size += block->size;
+    prev->next = block->next;
+  } else if (prev) {
+    prev->next = block;
+  } else {
+    freeList = block;
+  }
+}
+
+void* arenaRealloc(void* ptr, const size_t size) {
+  if (!ptr) {
+    return arenaMalloc(size);
+  }
+  if (!inArena(ptr)) {
+    return realloc(ptr, size);
+  }
+
+  const size_t available = headerOf(ptr)->size - HEADER_SIZE;
+  if (size <= available) {
+    return ptr;
+  }
+  void* moved = arenaMalloc(size);
+  if (moved) {
+    memcpy(moved, ptr, available);
+    arenaFree(ptr);
+  }
+  return moved;
+}
+
+const XML_Memory_Handling_Suite arenaSuite = {arenaMalloc, arenaRealloc, arenaFree};
+
+bool createSharedParser() {
+  arena = static_cast<uint8_t*>(malloc(XML_PARSER_ARENA_SIZE));
+  if (!arena) {
+    return false;
+  }
+  freeList = reinterpret_cast<Block*>(arena);
+  freeList->size = XML_PARSER_ARENA_SIZE;
+  freeList->next = nullptr;
+
+  sharedParser = XML_ParserCreate_MM(nullptr, &arenaSuite, nullptr);
+  if (!sharedParser) {
+    free(arena);
+    arena = nullptr;
+    freeList = nullptr;
+    return false;
+  }
+  return true;
+}
+
+// windows-1251 bytes 0x80-0xFF, the usual encoding of Russian FB2 books; 0xFFFF where a byte is undefined
+constexpr uint16_t CP1251_HIGH[128] = {
+    0x0402, 0x0403, 0x201A, 0x0453, 0x201E, 0x2026, 0x2020, 0x2021,
+    0x20AC, 0x2030, 0x0409, 0x2039, 0x040A, 0x040C, 0x040B, 0x040F,
+    0x0452, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+    0xFFFF, 0x2122, 0x0459, 0x203A, 0x045A, 0x045C, 0x045B, 0x045F,
+    0x00A0, 0x040E, 0x045E, 0x0408, 0x00A4, 0x0490, 0x00A6, 0x00A7,
+    0x0401, 0x00A9, 0x0404, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x0407,
+    0x00B0, 0x00B1, 0x0406, 0x0456, 0x0491, 0x00B5, 0x00B6, 0x00B7,
+    0x0451, 0x2116, 0x0454, 0x00BB, 0x0458, 0x0405, 0x0455, 0x0457,
+    0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417,
+    0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F,
+    0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427,
+    0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F,
+    0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+    0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F,
+    0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+    0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F,
+};
+
+// Expat reads UTF-8, UTF-16, ISO-8859-1 and US-ASCII by itself and asks here for any other declared encoding
+int XMLCALL unknownEncoding(void*, const XML_Char* name, XML_Encoding* info) {
+  if (strcasecmp(name, "windows-1251") != 0 && strcasecmp(name, "cp1251") != 0 && strcasecmp(name, "x-cp1251") != 0) {
+    return XML_STATUS_ERROR;
+  }
+  for (int b = 0; b < 0x80; b++) {
+    info->map[b] = b;
+  }
+  for (int b = 0x80; b < 0x100; b++) {
+    const uint16_t cp = CP1251_HIGH[b - 0x80];
+    info->map[b] = cp == 0xFFFF ? -1 : cp;
+  }
+  info->data = nullptr;
+  info->convert = nullptr;
+  info->release = nullptr;
+  return XML_STATUS_OK;
+}
+
+XML_Parser withEncodings(XML_Parser parser) {
+  if (parser) {
+    XML_SetUnknownEncodingHandler(parser, unknownEncoding, nullptr);
+  }
+  return parser;
+}
+}  // namespace
+
+XML_Parser createXmlParser() {
+  if (!sharedParserInUse.exchange(true)) {
+    if (sharedParser || createSharedParser()) {
+      // Set again every time, as XML_ParserReset() drops it along with the other handlers
+      return withEncodings(sharedParser);
+    }
+    sharedParserInUse = false;
+  }
+  return withEncodings(XML_ParserCreate(nullptr));
+}
+
+void destroyXmlParser(XML_Parser& parser) {
+  if (!parser) return;
+  XML_StopParser(parser, XML_FALSE);
+  if (parser == sharedParser) {
+    // Reset drops the handlers and user data too; it only fails for external entity parsers, which we never create
+    if (!XML_ParserReset(parser, nullptr)) {
+      XML_ParserFree(parser);
+      sharedParser = nullptr;
+      free(arena);
+      arena = nullptr;
+      freeList = nullptr;
+    }
+    sharedParserInUse = false;
+  } else {
+    XML_SetElementHandler(parser, nullptr, nullptr);
+    XML_SetCharacterDataHandler(parser, nullptr);
+    XML_ParserFree(parser);
+  }
+  parser = nullptr;
+}
+
+void releaseSharedXmlParser() {
+  if (sharedParserInUse.exchange(true)) {
+    return;
+  }
+  if (sharedParser) {
+    XML_ParserFree(sharedParser);
+    sharedParser = nullptr;
+  }
+  free(arena);
+  arena = nullptr;
+  freeList = nullptr;
+  sharedParserInUse = false;
+}
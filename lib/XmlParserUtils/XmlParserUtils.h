@@ -2,12 +2,16 @@
 
 #include <expat.h>
 
-// Safely tear down an expat parser: stop processing, clear callbacks, free, and null the pointer.
-inline void destroyXmlParser(XML_Parser& parser) {
-  if (!parser) return;
-  XML_StopParser(parser, XML_FALSE);
-  XML_SetElementHandler(parser, nullptr, nullptr);
-  XML_SetCharacterDataHandler(parser, nullptr);
-  XML_ParserFree(parser);
-  parser = nullptr;
-}
+// Returns an expat parser for one document (UTF-8 by default, as XML_ParserCreate(nullptr)). Besides the encodings
+// expat knows, it reads documents declared as windows-1251, which is what most FB2 books are written in.
+// The first caller gets a shared parser whose memory comes from a fixed arena and is kept between documents; while
+// that one is in use (nested parses), callers get an ordinary heap parser. Either way, tear it down with
+// destroyXmlParser().
+XML_Parser createXmlParser();
+
+// Safely tear down an expat parser: stop processing, clear callbacks, and null the pointer.
+// The shared parser is reset with XML_ParserReset for the next document instead of being freed.
+void destroyXmlParser(XML_Parser& parser);
+
+// Frees the shared parser and its arena if no document is being parsed, e.g. when leaving an activity.
+void releaseSharedXmlParser();
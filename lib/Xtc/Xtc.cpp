@@ -9,8 +9,100 @@
 
 #include <Bitmap.h>
 #include <HalStorage.h>
+#include <KOReaderDocumentId.h>
 #include <Logging.h>
 
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace {
+// Set bits per byte value, so a box's pixels are counted a byte at a time
+struct PopcountTable {
+  uint8_t counts[256];
+  constexpr PopcountTable() : counts() {
+    for (int i = 1; i < 256; i++) {
+      counts[i] = (i & 1) + counts[i / 2];
+    }
+  }
+};
+constexpr PopcountTable POPCOUNT;
+
+// Set bits in [start, end) of an MSB-first bit line (a row of a 1-bit page, a column of a 2-bit plane)
+uint32_t countBits(const uint8_t* bits, const uint32_t start, const uint32_t end) {
+  const uint32_t first = start / 8;
+  const uint32_t last = (end - 1) / 8;
+  const uint8_t headMask = 0xFF >> (start % 8);
+  const uint8_t tailMask = static_cast<uint8_t>(0xFF << (7 - (end - 1) % 8));
+  if (first == last) {
+    return POPCOUNT.counts[bits[first] & headMask & tailMask];
+  }
+  uint32_t count = POPCOUNT.counts[bits[first] & headMask] + POPCOUNT.counts[bits[last] & tailMask];
+  for (uint32_t i = first + 1; i < last; i++) {
+    count += POPCOUNT.counts[bits[i]];
+  }
+  return count;
+}
+
+// Source edges of count boxes scaled down from size pixels: box i covers [bounds[i], bounds[i + 1])
+std::vector<uint16_t> boxBounds(const uint16_t count, const uint16_t size, const uint32_t scaleInv_fp) {
+  std::vector<uint16_t> bounds(count + 1);
+  for (uint32_t i = 0; i <= count; i++) {
+    bounds[i] = static_cast<uint16_t>(std::min<uint32_t>((i * scaleInv_fp) >> 16, size));
+  }
+  return bounds;
+}
+
+// Hash-based noise dithering to 1-bit: true for white
+bool ditherWhite(const uint32_t gray, const uint16_t dstX, const uint16_t dstY) {
+  uint32_t hash = static_cast<uint32_t>(dstX) * 374761393u + static_cast<uint32_t>(dstY) * 668265263u;
+  hash = (hash ^ (hash >> 13)) * 1274126177u;
+  const int threshold = static_cast<int>(hash >> 24);           // 0-255
+  const int adjustedThreshold = 128 + ((threshold - 128) / 2);  // Range: 64-192
+  return static_cast<int>(gray) >= adjustedThreshold;
+}
+
+void setBlack(uint8_t* row, const uint32_t x) { row[x / 8] &= ~(1 << (7 - x % 8)); }
+
+// Cuts a page's streamed chunks into whole lines: rows of a 1-bit page, columns of a 2-bit plane
+class LineAssembler {
+  std::unique_ptr<uint8_t[]> line;
+  size_t lineBytes;
+  size_t filled = 0;
+  uint32_t index = 0;
+
+ public:
+  explicit LineAssembler(const size_t lineBytes) : line(new (std::nothrow) uint8_t[lineBytes]), lineBytes(lineBytes) {}
+  bool ok() const { return line != nullptr; }
+  void restart() {
+    filled = 0;
+    index = 0;
+  }
+
+  template <typename OnLine>
+  void feed(const uint8_t* data, size_t size, OnLine&& onLine) {
+    while (size > 0) {
+      // Lines whole in the chunk are used where they are
+      if (filled == 0 && size >= lineBytes) {
+        onLine(index++, data);
+        data += lineBytes;
+        size -= lineBytes;
+        continue;
+      }
+      const size_t n = std::min(size, lineBytes - filled);
+      memcpy(line.get() + filled, data, n);
+      filled += n;
+      data += n;
+      size -= n;
+      if (filled == lineBytes) {
+        onLine(index++, line.get());
+        filled = 0;
+      }
+    }
+  }
+};
+}  // namespace
+
 bool Xtc::load() {
   LOG_DBG("XTC", "Loading XTC: %s", filepath.c_str());
 
@@ -25,6 +117,12 @@ bool Xtc::load() {
     return false;
   }
 
+  // First load of this copy: the file was just opened, so compute its sync document ID while it is warm
+  if (!KOReaderDocumentId::hasCachedId(cachePath)) {
+    setupCacheDir();
+    KOReaderDocumentId::calculate(filepath, cachePath);
+  }
+
   loaded = true;
   LOG_DBG("XTC", "Loaded XTC: %s (%lu pages)", filepath.c_str(), parser->getPageCount());
   return true;
@@ -36,7 +134,7 @@ bool Xtc::clearCache() const {
     return true;
   }
 
-  if (!Storage.removeDir(cachePath.c_str())) {
+  if (!Storage.discardDir(cachePath.c_str())) {
     LOG_ERR("XTC", "Failed to clear cache");
     return false;
   }
@@ -103,12 +201,25 @@ bool Xtc::hasChapters() const {
   return parser->hasChapters();
 }
 
-const std::vector<xtc::ChapterInfo>& Xtc::getChapters() {
-  static const std::vector<xtc::ChapterInfo> kEmpty;
+uint16_t Xtc::getChapterCount() {
   if (!loaded || !parser) {
-    return kEmpty;
+    return 0;
   }
-  return parser->getChapters();
+  return parser->getChapterCount();
+}
+
+bool Xtc::getChapter(const uint16_t index, xtc::ChapterInfo& chapter) {
+  if (!loaded || !parser) {
+    return false;
+  }
+  return parser->getChapter(index, chapter);
+}
+
+int Xtc::findChapterForPage(const uint32_t page) {
+  if (!loaded || !parser) {
+    return -1;
+  }
+  return parser->findChapterForPage(page);
 }
 
 std::string Xtc::getCoverBmpPath() const { return cachePath + "/cover.bmp"; }
@@ -142,26 +253,19 @@ bool Xtc::generateCoverBmp() const {
   // Get bit depth
   const uint8_t bitDepth = parser->getBitDepth();
 
-  // Allocate buffer for page data
+  // The page is streamed, never loaded whole
   // XTG (1-bit): Row-major, ((width+7)/8) * height bytes
   // XTH (2-bit): Two bit planes, column-major, ((width * height + 7) / 8) * 2 bytes
-  size_t bitmapSize;
+  const size_t dstRowSize = (pageInfo.width + 7) / 8;  // 1-bit destination row size
+  const size_t colBytes = (pageInfo.height + 7) / 8;   // Bytes per 2-bit column
+  LineAssembler lines(bitDepth == 2 ? colBytes : dstRowSize);
+  // 2-bit columns are turned into 1-bit rows, which needs the whole 1-bit cover (a quarter of the 2-bit page)
+  std::unique_ptr<uint8_t[]> cover;
   if (bitDepth == 2) {
-    bitmapSize = ((static_cast<size_t>(pageInfo.width) * pageInfo.height + 7) / 8) * 2;
-  } else {
-    bitmapSize = ((pageInfo.width + 7) / 8) * pageInfo.height;
+    cover.reset(new (std::nothrow) uint8_t[dstRowSize * pageInfo.height]);
   }
-  uint8_t* pageBuffer = static_cast<uint8_t*>(malloc(bitmapSize));
-  if (!pageBuffer) {
-    LOG_ERR("XTC", "Failed to allocate page buffer (%lu bytes)", bitmapSize);
-    return false;
-  }
-
-  // Load first page (cover)
-  size_t bytesRead = const_cast<xtc::XtcParser*>(parser.get())->loadPage(0, pageBuffer, bitmapSize);
-  if (bytesRead == 0) {
-    LOG_ERR("XTC", "Failed to load cover page");
-    free(pageBuffer);
+  if (!lines.ok() || (bitDepth == 2 && !cover)) {
+    LOG_ERR("XTC", "Failed to allocate cover buffers");
     return false;
   }
 
@@ -169,7 +273,6 @@ bool Xtc::generateCoverBmp() const {
   FsFile coverBmp;
   if (!Storage.openFileForWrite("XTC", getCoverBmpPath(), coverBmp)) {
     LOG_DBG("XTC", "Failed to create cover BMP file");
-    free(pageBuffer);
     return false;
   }
 
@@ -178,83 +281,74 @@ bool Xtc::generateCoverBmp() const {
   createBmpHeader(&bmpHeader, pageInfo.width, pageInfo.height, BmpRowOrder::TopDown);
   coverBmp.write(reinterpret_cast<const uint8_t*>(&bmpHeader), sizeof(bmpHeader));
 
-  const uint32_t rowSize = ((pageInfo.width + 31) / 32) * 4;
-
-  // Write bitmap data
   // BMP requires 4-byte row alignment
-  const size_t dstRowSize = (pageInfo.width + 7) / 8;  // 1-bit destination row size
+  const uint32_t rowSize = ((pageInfo.width + 31) / 32) * 4;
+  const uint8_t padding[4] = {0, 0, 0, 0};
+  const auto writeRow = [&](const uint8_t* row) {
+    coverBmp.write(row, dstRowSize);
+    if (rowSize > dstRowSize) {
+      coverBmp.write(padding, rowSize - dstRowSize);
+    }
+  };
 
+  xtc::XtcError err;
   if (bitDepth == 2) {
     // XTH 2-bit mode: Two bit planes, column-major order
     // - Columns scanned right to left (x = width-1 down to 0)
     // - 8 vertical pixels per byte (MSB = topmost pixel in group)
     // - First plane: Bit1, Second plane: Bit2
     // - Pixel value = (bit1 << 1) | bit2
+    // Threshold: 0=white; 1,2,3=black, so a pixel is black if it is set in either plane
     const size_t planeSize = (static_cast<size_t>(pageInfo.width) * pageInfo.height + 7) / 8;
-    const uint8_t* plane1 = pageBuffer;                 // Bit1 plane
-    const uint8_t* plane2 = pageBuffer + planeSize;     // Bit2 plane
-    const size_t colBytes = (pageInfo.height + 7) / 8;  // Bytes per column
-
-    // Allocate a row buffer for 1-bit output
-    uint8_t* rowBuffer = static_cast<uint8_t*>(malloc(dstRowSize));
-    if (!rowBuffer) {
-      free(pageBuffer);
-      return false;
-    }
-
-    for (uint16_t y = 0; y < pageInfo.height; y++) {
-      memset(rowBuffer, 0xFF, dstRowSize);  // Start with all white
-
-      for (uint16_t x = 0; x < pageInfo.width; x++) {
-        // Column-major, right to left: column index = (width - 1 - x)
-        const size_t colIndex = pageInfo.width - 1 - x;
-        const size_t byteInCol = y / 8;
-        const size_t bitInByte = 7 - (y % 8);  // MSB = topmost pixel
-
-        const size_t byteOffset = colIndex * colBytes + byteInCol;
-        const uint8_t bit1 = (plane1[byteOffset] >> bitInByte) & 1;
-        const uint8_t bit2 = (plane2[byteOffset] >> bitInByte) & 1;
-        const uint8_t pixelValue = (bit1 << 1) | bit2;
-
-        // Threshold: 0=white (1); 1,2,3=black (0)
-        if (pixelValue >= 1) {
-          // Set bit to 0 (black) in BMP format
-          const size_t dstByte = x / 8;
-          const size_t dstBit = 7 - (x % 8);
-          rowBuffer[dstByte] &= ~(1 << dstBit);
+    memset(cover.get(), 0xFF, dstRowSize * pageInfo.height);  // Start with all white
+    const auto onColumn = [&](const uint32_t colIndex, const uint8_t* column) {
+      if (colIndex >= pageInfo.width) {
+        return;
+      }
+      const uint32_t x = pageInfo.width - 1 - colIndex;
+      for (size_t byteInCol = 0; byteInCol < colBytes; byteInCol++) {
+        for (uint8_t bits = column[byteInCol]; bits != 0; bits &= bits - 1) {
+          const uint32_t y = byteInCol * 8 + 7 - __builtin_ctz(bits);
+          if (y < pageInfo.height) {
+            setBlack(cover.get() + y * dstRowSize, x);
+          }
         }
       }
-
-      // Write converted row
-      coverBmp.write(rowBuffer, dstRowSize);
-
-      // Pad to 4-byte boundary
-      uint8_t padding[4] = {0, 0, 0, 0};
-      size_t paddingSize = rowSize - dstRowSize;
-      if (paddingSize > 0) {
-        coverBmp.write(padding, paddingSize);
+    };
+    err = loadPageStreaming(0, [&](const uint8_t* data, size_t size, const size_t offset) {
+      // The second plane starts on a column of its own
+      if (offset < planeSize && offset + size > planeSize) {
+        lines.feed(data, planeSize - offset, onColumn);
+        data += planeSize - offset;
+        size -= planeSize - offset;
+        lines.restart();
+      } else if (offset == planeSize) {
+        lines.restart();
       }
-    }
-
-    free(rowBuffer);
-  } else {
-    // 1-bit source: write directly with proper padding
-    const size_t srcRowSize = (pageInfo.width + 7) / 8;
-
-    for (uint16_t y = 0; y < pageInfo.height; y++) {
-      // Write source row
-      coverBmp.write(pageBuffer + y * srcRowSize, srcRowSize);
-
-      // Pad to 4-byte boundary
-      uint8_t padding[4] = {0, 0, 0, 0};
-      size_t paddingSize = rowSize - srcRowSize;
-      if (paddingSize > 0) {
-        coverBmp.write(padding, paddingSize);
+      lines.feed(data, size, onColumn);
+    });
+    if (err == xtc::XtcError::OK) {
+      for (uint16_t y = 0; y < pageInfo.height; y++) {
+        writeRow(cover.get() + y * dstRowSize);
       }
     }
+  } else {
+    // 1-bit source: rows are written as they arrive, with proper padding
+    err = loadPageStreaming(0, [&](const uint8_t* data, const size_t size, size_t) {
+      lines.feed(data, size, [&](const uint32_t y, const uint8_t* row) {
+        if (y < pageInfo.height) {
+          writeRow(row);
+        }
+      });
+    });
   }
+  coverBmp.close();
 
-  free(pageBuffer);
+  if (err != xtc::XtcError::OK) {
+    LOG_ERR("XTC", "Failed to load cover page: %s", xtc::errorToString(err));
+    Storage.remove(getCoverBmpPath().c_str());
+    return false;
+  }
 
   LOG_DBG("XTC", "Generated cover BMP: %s", getCoverBmpPath().c_str());
   return true;
@@ -328,24 +422,30 @@ bool Xtc::generateThumbBmp(int height) const {
   LOG_DBG("XTC", "Generating thumb BMP: %dx%d -> %dx%d (scale: %.3f)", pageInfo.width, pageInfo.height, thumbWidth,
           thumbHeight, scale);
 
-  // Allocate buffer for page data
-  size_t bitmapSize;
+  // Area averaging by counting set bits a byte at a time over each thumb pixel's box of source pixels, as the page
+  // is streamed. Fixed-point scale factor (16.16); boxes tile the page from its top left corner.
+  const uint32_t scaleInv_fp = static_cast<uint32_t>(65536.0f / scale);
+  const std::vector<uint16_t> xBounds = boxBounds(thumbWidth, pageInfo.width, scaleInv_fp);
+  const std::vector<uint16_t> yBounds = boxBounds(thumbHeight, pageInfo.height, scaleInv_fp);
+  const auto boxArea = [&](const uint16_t dstX, const uint16_t dstY) {
+    return static_cast<uint32_t>(xBounds[dstX + 1] - xBounds[dstX]) * (yBounds[dstY + 1] - yBounds[dstY]);
+  };
+
+  const uint32_t rowSize = (thumbWidth + 31) / 32 * 4;
+  const size_t srcRowBytes = (pageInfo.width + 7) / 8;
+  const size_t colBytes = (pageInfo.height + 7) / 8;
+  LineAssembler lines(bitDepth == 2 ? colBytes : srcRowBytes);
+  std::unique_ptr<uint8_t[]> rowBuffer(new (std::nothrow) uint8_t[rowSize]);
+  // Set bits so far in the boxes of the thumb row (1-bit) or thumb column (2-bit) being filled
+  std::vector<uint16_t> counts(bitDepth == 2 ? thumbHeight : thumbWidth, 0);
+  // 2-bit: a nibble per thumb pixel, the first plane's share of its box (0-15), then whether it dithered to white
+  std::unique_ptr<uint8_t[]> levels;
+  const size_t levelsSize = (static_cast<size_t>(thumbWidth) * thumbHeight + 1) / 2;
   if (bitDepth == 2) {
-    bitmapSize = ((static_cast<size_t>(pageInfo.width) * pageInfo.height + 7) / 8) * 2;
-  } else {
-    bitmapSize = ((pageInfo.width + 7) / 8) * pageInfo.height;
-  }
-  uint8_t* pageBuffer = static_cast<uint8_t*>(malloc(bitmapSize));
-  if (!pageBuffer) {
-    LOG_ERR("XTC", "Failed to allocate page buffer (%lu bytes)", bitmapSize);
-    return false;
+    levels.reset(new (std::nothrow) uint8_t[levelsSize]);
   }
-
-  // Load first page (cover)
-  size_t bytesRead = const_cast<xtc::XtcParser*>(parser.get())->loadPage(0, pageBuffer, bitmapSize);
-  if (bytesRead == 0) {
-    LOG_ERR("XTC", "Failed to load cover page for thumb");
-    free(pageBuffer);
+  if (!lines.ok() || !rowBuffer || (bitDepth == 2 && !levels)) {
+    LOG_ERR("XTC", "Failed to allocate thumb buffers");
     return false;
   }
 
@@ -353,7 +453,6 @@ bool Xtc::generateThumbBmp(int height) const {
   FsFile thumbBmp;
   if (!Storage.openFileForWrite("XTC", getThumbBmpPath(height), thumbBmp)) {
     LOG_DBG("XTC", "Failed to create thumb BMP file");
-    free(pageBuffer);
     return false;
   }
 
@@ -362,119 +461,102 @@ bool Xtc::generateThumbBmp(int height) const {
   createBmpHeader(&bmpHeader, thumbWidth, thumbHeight, BmpRowOrder::TopDown);
   thumbBmp.write(reinterpret_cast<const uint8_t*>(&bmpHeader), sizeof(bmpHeader));
 
-  const uint32_t rowSize = (thumbWidth + 31) / 32 * 4;
-
-  // Allocate row buffer for 1-bit output
-  uint8_t* rowBuffer = static_cast<uint8_t*>(malloc(rowSize));
-  if (!rowBuffer) {
-    free(pageBuffer);
-    return false;
-  }
-
-  // Fixed-point scale factor (16.16)
-  uint32_t scaleInv_fp = static_cast<uint32_t>(65536.0f / scale);
-
-  // Pre-calculate plane info for 2-bit mode
-  const size_t planeSize = (bitDepth == 2) ? ((static_cast<size_t>(pageInfo.width) * pageInfo.height + 7) / 8) : 0;
-  const uint8_t* plane1 = (bitDepth == 2) ? pageBuffer : nullptr;
-  const uint8_t* plane2 = (bitDepth == 2) ? pageBuffer + planeSize : nullptr;
-  const size_t colBytes = (bitDepth == 2) ? ((pageInfo.height + 7) / 8) : 0;
-  const size_t srcRowBytes = (bitDepth == 1) ? ((pageInfo.width + 7) / 8) : 0;
-
-  for (uint16_t dstY = 0; dstY < thumbHeight; dstY++) {
-    memset(rowBuffer, 0xFF, rowSize);  // Start with all white (bit 1)
-
-    // Calculate source Y range with bounds checking
-    uint32_t srcYStart = (static_cast<uint32_t>(dstY) * scaleInv_fp) >> 16;
-    uint32_t srcYEnd = (static_cast<uint32_t>(dstY + 1) * scaleInv_fp) >> 16;
-    if (srcYStart >= pageInfo.height) srcYStart = pageInfo.height - 1;
-    if (srcYEnd > pageInfo.height) srcYEnd = pageInfo.height;
-    if (srcYEnd <= srcYStart) srcYEnd = srcYStart + 1;
-    if (srcYEnd > pageInfo.height) srcYEnd = pageInfo.height;
-
-    for (uint16_t dstX = 0; dstX < thumbWidth; dstX++) {
-      // Calculate source X range with bounds checking
-      uint32_t srcXStart = (static_cast<uint32_t>(dstX) * scaleInv_fp) >> 16;
-      uint32_t srcXEnd = (static_cast<uint32_t>(dstX + 1) * scaleInv_fp) >> 16;
-      if (srcXStart >= pageInfo.width) srcXStart = pageInfo.width - 1;
-      if (srcXEnd > pageInfo.width) srcXEnd = pageInfo.width;
-      if (srcXEnd <= srcXStart) srcXEnd = srcXStart + 1;
-      if (srcXEnd > pageInfo.width) srcXEnd = pageInfo.width;
-
-      // Area averaging: sum grayscale values (0-255 range)
-      uint32_t graySum = 0;
-      uint32_t totalCount = 0;
-
-      for (uint32_t srcY = srcYStart; srcY < srcYEnd && srcY < pageInfo.height; srcY++) {
-        for (uint32_t srcX = srcXStart; srcX < srcXEnd && srcX < pageInfo.width; srcX++) {
-          uint8_t grayValue = 255;  // Default: white
-
-          if (bitDepth == 2) {
-            // XTH 2-bit mode: pixel value 0-3
-            // Bounds check for column index
-            if (srcX < pageInfo.width) {
-              const size_t colIndex = pageInfo.width - 1 - srcX;
-              const size_t byteInCol = srcY / 8;
-              const size_t bitInByte = 7 - (srcY % 8);
-              const size_t byteOffset = colIndex * colBytes + byteInCol;
-              // Bounds check for buffer access
-              if (byteOffset < planeSize) {
-                const uint8_t bit1 = (plane1[byteOffset] >> bitInByte) & 1;
-                const uint8_t bit2 = (plane2[byteOffset] >> bitInByte) & 1;
-                const uint8_t pixelValue = (bit1 << 1) | bit2;
-                // Convert 2-bit (0-3) to grayscale: 0=black, 3=white
-                // pixelValue: 0=white, 1=light gray, 2=dark gray, 3=black (XTC polarity)
-                grayValue = (3 - pixelValue) * 85;  // 0->255, 1->170, 2->85, 3->0
-              }
-            }
-          } else {
-            // 1-bit mode
-            const size_t byteIdx = srcY * srcRowBytes + srcX / 8;
-            const size_t bitIdx = 7 - (srcX % 8);
-            // Bounds check for buffer access
-            if (byteIdx < bitmapSize) {
-              const uint8_t pixelBit = (pageBuffer[byteIdx] >> bitIdx) & 1;
-              // XTC 1-bit polarity: 0=black, 1=white (same as BMP palette)
-              grayValue = pixelBit ? 255 : 0;
-            }
-          }
-
-          graySum += grayValue;
-          totalCount++;
-        }
+  xtc::XtcError err;
+  if (bitDepth == 2) {
+    // XTH 2-bit mode: columns of a plane arrive right to left, so thumb columns fill from the right. Pixel value is
+    // (bit1 << 1) | bit2 with 0=white and 3=black, so a box's darkness is 170 per bit1 and 85 per bit2, averaged.
+    const size_t planeSize = (static_cast<size_t>(pageInfo.width) * pageInfo.height + 7) / 8;
+    memset(levels.get(), 0, levelsSize);
+    const auto level = [&](const size_t i) -> uint8_t { return (levels[i / 2] >> (i % 2 * 4)) & 0x0F; };
+    const auto setLevel = [&](const size_t i, const uint8_t value) {
+      levels[i / 2] = (levels[i / 2] & ~(0x0F << (i % 2 * 4))) | (value << (i % 2 * 4));
+    };
+    int plane = 0;
+    int dstX = thumbWidth - 1;
+    const auto onColumn = [&](const uint32_t colIndex, const uint8_t* column) {
+      const uint32_t srcX = pageInfo.width - 1 - colIndex;
+      if (colIndex >= pageInfo.width || srcX >= xBounds[thumbWidth] || dstX < 0) {
+        return;
       }
-
-      // Calculate average grayscale and quantize to 1-bit with noise dithering
-      uint8_t avgGray = (totalCount > 0) ? static_cast<uint8_t>(graySum / totalCount) : 255;
-
-      // Hash-based noise dithering for 1-bit output
-      uint32_t hash = static_cast<uint32_t>(dstX) * 374761393u + static_cast<uint32_t>(dstY) * 668265263u;
-      hash = (hash ^ (hash >> 13)) * 1274126177u;
-      const int threshold = static_cast<int>(hash >> 24);           // 0-255
-      const int adjustedThreshold = 128 + ((threshold - 128) / 2);  // Range: 64-192
-
-      // Quantize to 1-bit: 0=black, 1=white
-      uint8_t oneBit = (avgGray >= adjustedThreshold) ? 1 : 0;
-
-      // Pack 1-bit value into row buffer (MSB first, 8 pixels per byte)
-      const size_t byteIndex = dstX / 8;
-      const size_t bitOffset = 7 - (dstX % 8);
-      // Bounds check for row buffer access
-      if (byteIndex < rowSize) {
-        if (oneBit) {
-          rowBuffer[byteIndex] |= (1 << bitOffset);  // Set bit for white
+      for (uint16_t dstY = 0; dstY < thumbHeight; dstY++) {
+        counts[dstY] += countBits(column, yBounds[dstY], yBounds[dstY + 1]);
+      }
+      if (srcX > xBounds[dstX]) {
+        return;
+      }
+      // Leftmost column of the box: the thumb column is complete for this plane
+      for (uint16_t dstY = 0; dstY < thumbHeight; dstY++) {
+        const size_t i = static_cast<size_t>(dstY) * thumbWidth + dstX;
+        const uint32_t area = boxArea(dstX, dstY);
+        if (plane == 0) {
+          setLevel(i, (counts[dstY] * 15 + area / 2) / area);
         } else {
-          rowBuffer[byteIndex] &= ~(1 << bitOffset);  // Clear bit for black
+          const uint32_t darkness = (level(i) * 170 * area + 15 * 85 * counts[dstY]) / (15 * area);
+          setLevel(i, ditherWhite(255 - std::min<uint32_t>(darkness, 255), dstX, dstY) ? 1 : 0);
+        }
+        counts[dstY] = 0;
+      }
+      dstX--;
+    };
+    err = loadPageStreaming(0, [&](const uint8_t* data, size_t size, const size_t offset) {
+      if (offset + size > planeSize && plane == 0) {
+        // The second plane starts on a column of its own
+        const size_t head = offset < planeSize ? planeSize - offset : 0;
+        lines.feed(data, head, onColumn);
+        data += head;
+        size -= head;
+        lines.restart();
+        plane = 1;
+        dstX = thumbWidth - 1;
+        std::fill(counts.begin(), counts.end(), 0);
+      }
+      lines.feed(data, size, onColumn);
+    });
+    if (err == xtc::XtcError::OK) {
+      for (uint16_t dstY = 0; dstY < thumbHeight; dstY++) {
+        memset(rowBuffer.get(), 0xFF, rowSize);  // Start with all white (bit 1)
+        for (uint16_t x = 0; x < thumbWidth; x++) {
+          if (!level(static_cast<size_t>(dstY) * thumbWidth + x)) {
+            setBlack(rowBuffer.get(), x);
+          }
         }
+        thumbBmp.write(rowBuffer.get(), rowSize);
       }
     }
-
-    // Write row (already padded to 4-byte boundary by rowSize)
-    thumbBmp.write(rowBuffer, rowSize);
+  } else {
+    // 1-bit mode: rows arrive top to bottom, and each thumb row is written once its last source row is in.
+    // XTC 1-bit polarity: 0=black, 1=white (same as BMP palette), so the set bits are the white pixels.
+    uint16_t dstY = 0;
+    const auto onRow = [&](const uint32_t srcY, const uint8_t* row) {
+      if (dstY >= thumbHeight || srcY >= yBounds[thumbHeight]) {
+        return;
+      }
+      for (uint16_t dstX = 0; dstX < thumbWidth; dstX++) {
+        counts[dstX] += countBits(row, xBounds[dstX], xBounds[dstX + 1]);
+      }
+      if (srcY + 1 < yBounds[dstY + 1]) {
+        return;
+      }
+      memset(rowBuffer.get(), 0xFF, rowSize);  // Start with all white (bit 1)
+      for (uint16_t dstX = 0; dstX < thumbWidth; dstX++) {
+        if (!ditherWhite(counts[dstX] * 255 / boxArea(dstX, dstY), dstX, dstY)) {
+          setBlack(rowBuffer.get(), dstX);
+        }
+        counts[dstX] = 0;
+      }
+      // Write row (already padded to 4-byte boundary by rowSize)
+      thumbBmp.write(rowBuffer.get(), rowSize);
+      dstY++;
+    };
+    err = loadPageStreaming(0, [&](const uint8_t* data, const size_t size, size_t) { lines.feed(data, size, onRow); });
   }
+  thumbBmp.close();
 
-  free(rowBuffer);
-  free(pageBuffer);
+  if (err != xtc::XtcError::OK) {
+    LOG_ERR("XTC", "Failed to load cover page for thumb: %s", xtc::errorToString(err));
+    Storage.remove(getThumbBmpPath(height).c_str());
+    return false;
+  }
 
   LOG_DBG("XTC", "Generated thumb BMP (%dx%d): %s", thumbWidth, thumbHeight, getThumbBmpPath(height).c_str());
   return true;
@@ -58,7 +58,11 @@ class Xtc {
   std::string getTitle() const;
   std::string getAuthor() const;
   bool hasChapters() const;
-  const std::vector<xtc::ChapterInfo>& getChapters();
+  // Chapters by index, read from the file as they are asked for (see XtcParser::getChapter())
+  uint16_t getChapterCount();
+  bool getChapter(uint16_t index, xtc::ChapterInfo& chapter);
+  // Index of the chapter holding page, or -1
+  int findChapterForPage(uint32_t page);
 
   // Cover image support (for sleep screen)
   std::string getCoverBmpPath() const;
@@ -11,7 +11,11 @@
 #include <HalStorage.h>
 #include <Logging.h>
 
+#include <algorithm>
 #include <cstring>
+#include <new>
+
+#include "XtcRle.h"
 
 namespace xtc {
 
@@ -22,7 +26,10 @@ XtcParser::XtcParser()
       m_bitDepth(1),
       m_hasChapters(false),
       m_chaptersLoaded(false),
-      m_lastError(XtcError::OK) {
+      m_lastError(XtcError::OK),
+      m_pageTableCacheStart(0),
+      m_pageTableCacheCount(0),
+      m_chapterTableOffset(0) {
   memset(&m_header, 0, sizeof(m_header));
 }
 
@@ -100,10 +107,13 @@ void XtcParser::close() {
   closeFile();
   m_isOpen = false;
   m_chaptersLoaded = false;
-  m_chapters.clear();
+  m_chapterIndex.clear();
+  m_chapterIndex.shrink_to_fit();
+  m_chapterNames.reset();
   m_title.clear();
   m_author.clear();
   m_hasChapters = false;
+  m_pageTableCacheCount = 0;
   memset(&m_header, 0, sizeof(m_header));
 }
 
@@ -228,25 +238,34 @@ bool XtcParser::readPageTableEntry(uint32_t pageIndex, PageInfo& info) {
     return false;
   }
 
-  if (!ensureFileOpen()) {
-    LOG_DBG("XTC", "Failed to reopen file for page table read");
-    return false;
-  }
+  if (pageIndex < m_pageTableCacheStart || pageIndex >= m_pageTableCacheStart + m_pageTableCacheCount) {
+    if (!ensureFileOpen()) {
+      LOG_DBG("XTC", "Failed to reopen file for page table read");
+      return false;
+    }
 
-  // Seek to the specific page table entry on the SD card
-  const uint64_t entryOffset = m_header.pageTableOffset + static_cast<uint64_t>(pageIndex) * sizeof(PageTableEntry);
-  if (!m_file.seek(entryOffset)) {
-    LOG_DBG("XTC", "Failed to seek to page table entry %lu at %llu", pageIndex, entryOffset);
-    return false;
-  }
+    // Read the slice of the page table holding this entry from the SD card
+    const uint32_t sliceStart = pageIndex - pageIndex % PAGE_TABLE_CACHE_ENTRIES;
+    const uint16_t sliceCount =
+        static_cast<uint16_t>(std::min<uint32_t>(PAGE_TABLE_CACHE_ENTRIES, m_header.pageCount - sliceStart));
+    const uint64_t sliceOffset = m_header.pageTableOffset + static_cast<uint64_t>(sliceStart) * sizeof(PageTableEntry);
+    m_pageTableCacheCount = 0;
+    if (!m_file.seek(sliceOffset)) {
+      LOG_DBG("XTC", "Failed to seek to page table entry %lu at %llu", sliceStart, sliceOffset);
+      return false;
+    }
 
-  PageTableEntry entry;
-  size_t bytesRead = m_file.read(reinterpret_cast<uint8_t*>(&entry), sizeof(PageTableEntry));
-  if (bytesRead != sizeof(PageTableEntry)) {
-    LOG_DBG("XTC", "Failed to read page table entry %lu", pageIndex);
-    return false;
+    const size_t sliceSize = sliceCount * sizeof(PageTableEntry);
+    size_t bytesRead = m_file.read(reinterpret_cast<uint8_t*>(m_pageTableCache), sliceSize);
+    if (bytesRead != sliceSize) {
+      LOG_DBG("XTC", "Failed to read page table entries %lu-%lu", sliceStart, sliceStart + sliceCount - 1);
+      return false;
+    }
+    m_pageTableCacheStart = sliceStart;
+    m_pageTableCacheCount = sliceCount;
   }
 
+  const PageTableEntry& entry = m_pageTableCache[pageIndex - m_pageTableCacheStart];
   info.offset = static_cast<uint32_t>(entry.dataOffset);
   info.size = entry.dataSize;
   info.width = entry.width;
@@ -255,8 +274,8 @@ bool XtcParser::readPageTableEntry(uint32_t pageIndex, PageInfo& info) {
   return true;
 }
 
-XtcError XtcParser::readChapters() {
-  m_chapters.clear();
+XtcError XtcParser::indexChapters() {
+  m_chapterIndex.clear();
 
   if (!ensureFileOpen()) {
     return XtcError::READ_ERROR;
@@ -287,7 +306,7 @@ XtcError XtcParser::readChapters() {
   }
 
   const uint64_t fileSize = m_file.size();
-  if (chapterOffset < sizeof(XtcHeader) || chapterOffset >= fileSize || chapterOffset + 96 > fileSize) {
+  if (chapterOffset < sizeof(XtcHeader) || chapterOffset >= fileSize || chapterOffset + CHAPTER_ENTRY_SIZE > fileSize) {
     return XtcError::OK;
   }
 
@@ -303,9 +322,8 @@ XtcError XtcParser::readChapters() {
     return XtcError::OK;
   }
 
-  constexpr size_t chapterSize = 96;
   const uint64_t available = maxOffset - chapterOffset;
-  const size_t chapterCount = static_cast<size_t>(available / chapterSize);
+  const size_t chapterCount = static_cast<size_t>(std::min<uint64_t>(available / CHAPTER_ENTRY_SIZE, UINT16_MAX));
   if (chapterCount == 0) {
     return XtcError::OK;
   }
@@ -313,26 +331,20 @@ XtcError XtcParser::readChapters() {
   if (!m_file.seek(chapterOffset)) {
     return XtcError::READ_ERROR;
   }
+  m_chapterTableOffset = static_cast<uint32_t>(chapterOffset);
 
-  m_chapters.reserve(chapterCount);
-  std::vector<uint8_t> chapterBuf(chapterSize);
+  uint8_t chapterBuf[CHAPTER_ENTRY_SIZE];
   for (size_t i = 0; i < chapterCount; i++) {
-    if (m_file.read(chapterBuf.data(), chapterSize) != chapterSize) {
+    if (m_file.read(chapterBuf, CHAPTER_ENTRY_SIZE) != CHAPTER_ENTRY_SIZE) {
       return XtcError::READ_ERROR;
     }
 
-    char nameBuf[81];
-    memcpy(nameBuf, chapterBuf.data(), 80);
-    nameBuf[80] = '\0';
-    const size_t nameLen = strnlen(nameBuf, 80);
-    std::string name(nameBuf, nameLen);
-
     uint16_t startPage = 0;
     uint16_t endPage = 0;
-    memcpy(&startPage, chapterBuf.data() + 0x50, sizeof(startPage));
-    memcpy(&endPage, chapterBuf.data() + 0x52, sizeof(endPage));
+    memcpy(&startPage, chapterBuf + 0x50, sizeof(startPage));
+    memcpy(&endPage, chapterBuf + 0x52, sizeof(endPage));
 
-    if (name.empty() && startPage == 0 && endPage == 0) {
+    if (chapterBuf[0] == '\0' && startPage == 0 && endPage == 0) {
       break;
     }
 
@@ -355,69 +367,131 @@ XtcError XtcParser::readChapters() {
       continue;
     }
 
-    ChapterInfo chapter{std::move(name), startPage, endPage};
-    m_chapters.push_back(std::move(chapter));
+    m_chapterIndex.push_back({static_cast<uint16_t>(i), startPage, endPage});
   }
 
-  m_hasChapters = !m_chapters.empty();
-  LOG_DBG("XTC", "Chapters: %u", static_cast<unsigned int>(m_chapters.size()));
+  m_chapterIndex.shrink_to_fit();
+  m_hasChapters = !m_chapterIndex.empty();
+  LOG_DBG("XTC", "Chapters: %u", static_cast<unsigned int>(m_chapterIndex.size()));
   return XtcError::OK;
 }
 
-const std::vector<ChapterInfo>& XtcParser::getChapters() {
-  // Lazy load chapters on first access
+bool XtcParser::ensureChaptersIndexed() {
+  // Indexed on first access
   if (!m_chaptersLoaded && m_hasChapters) {
-    const XtcError err = readChapters();
+    const XtcError err = indexChapters();
     if (err != XtcError::OK) {
-      LOG_ERR("XTC", "Failed to lazy-load chapters: %s", errorToString(err));
+      LOG_ERR("XTC", "Failed to index chapters: %s", errorToString(err));
       m_hasChapters = false;
-      m_chapters.clear();
+      m_chapterIndex.clear();
     }
     m_chaptersLoaded = true;
     // Close file after chapter read to free buffers for rendering
     closeFile();
   }
-  return m_chapters;
+  return !m_chapterIndex.empty();
+}
+
+bool XtcParser::readChapterNames(const uint16_t first) {
+  if (!m_chapterNames) {
+    m_chapterNames.reset(new (std::nothrow) CachedChapterName[CHAPTER_NAME_CACHE_ENTRIES]);
+    if (!m_chapterNames || !ensureFileOpen()) {
+      return false;
+    }
+  } else if (!ensureFileOpen()) {
+    return false;
+  }
+
+  const size_t last = std::min<size_t>(m_chapterIndex.size(), first + CHAPTER_NAME_READ_AHEAD);
+  uint8_t chapterBuf[CHAPTER_ENTRY_SIZE];
+  int32_t nextSlot = -1;
+  bool ok = true;
+  for (size_t i = first; i < last && ok; i++) {
+    const uint16_t slot = m_chapterIndex[i].slot;
+    // Skipped table entries are seeked over, the others read in a row
+    if (slot != nextSlot) {
+      ok = m_file.seek(m_chapterTableOffset + static_cast<uint32_t>(slot) * CHAPTER_ENTRY_SIZE);
+    }
+    ok = ok && m_file.read(chapterBuf, CHAPTER_ENTRY_SIZE) == CHAPTER_ENTRY_SIZE;
+    if (ok) {
+      const auto* name = reinterpret_cast<const char*>(chapterBuf);
+      CachedChapterName& cached = m_chapterNames[i % CHAPTER_NAME_CACHE_ENTRIES];
+      cached.index = static_cast<int32_t>(i);
+      cached.name.assign(name, strnlen(name, CHAPTER_NAME_SIZE));
+    }
+    nextSlot = slot + 1;
+  }
+  closeFile();
+  return ok;
+}
+
+uint16_t XtcParser::getChapterCount() {
+  return ensureChaptersIndexed() ? static_cast<uint16_t>(m_chapterIndex.size()) : 0;
+}
+
+bool XtcParser::getChapter(const uint16_t index, ChapterInfo& chapter) {
+  if (!ensureChaptersIndexed() || index >= m_chapterIndex.size()) {
+    return false;
+  }
+  const auto isCached = [this, index]() {
+    return m_chapterNames && m_chapterNames[index % CHAPTER_NAME_CACHE_ENTRIES].index == index;
+  };
+  if (!isCached()) {
+    readChapterNames(index);
+    if (!isCached()) {
+      LOG_ERR("XTC", "Failed to read name of chapter %u", index);
+      return false;
+    }
+  }
+  chapter.name = m_chapterNames[index % CHAPTER_NAME_CACHE_ENTRIES].name;
+  chapter.startPage = m_chapterIndex[index].startPage;
+  chapter.endPage = m_chapterIndex[index].endPage;
+  return true;
+}
+
+int XtcParser::findChapterForPage(const uint32_t page) {
+  if (!ensureChaptersIndexed()) {
+    return -1;
+  }
+  for (size_t i = 0; i < m_chapterIndex.size(); i++) {
+    if (page >= m_chapterIndex[i].startPage && page <= m_chapterIndex[i].endPage) {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
 }
 
 bool XtcParser::getPageInfo(uint32_t pageIndex, PageInfo& info) { return readPageTableEntry(pageIndex, info); }
 
-size_t XtcParser::loadPage(uint32_t pageIndex, uint8_t* buffer, size_t bufferSize) {
+XtcError XtcParser::readPageHeader(uint32_t pageIndex, XtgPageHeader& pageHeader, size_t& bitmapSize) {
   if (!m_isOpen) {
-    m_lastError = XtcError::FILE_NOT_FOUND;
-    return 0;
+    return XtcError::FILE_NOT_FOUND;
   }
 
   if (pageIndex >= m_header.pageCount) {
-    m_lastError = XtcError::PAGE_OUT_OF_RANGE;
-    return 0;
+    return XtcError::PAGE_OUT_OF_RANGE;
   }
 
   PageInfo page;
   if (!readPageTableEntry(pageIndex, page)) {
-    m_lastError = XtcError::READ_ERROR;
-    return 0;
+    return XtcError::READ_ERROR;
   }
 
   if (!ensureFileOpen()) {
-    m_lastError = XtcError::FILE_NOT_FOUND;
-    return 0;
+    return XtcError::FILE_NOT_FOUND;
   }
 
   // Seek to page data
   if (!m_file.seek(page.offset)) {
     LOG_DBG("XTC", "Failed to seek to page %u at offset %lu", pageIndex, page.offset);
-    m_lastError = XtcError::READ_ERROR;
-    return 0;
+    return XtcError::READ_ERROR;
   }
 
   // Read page header (XTG for 1-bit, XTH for 2-bit - same structure)
-  XtgPageHeader pageHeader;
   size_t headerRead = m_file.read(reinterpret_cast<uint8_t*>(&pageHeader), sizeof(XtgPageHeader));
   if (headerRead != sizeof(XtgPageHeader)) {
     LOG_DBG("XTC", "Failed to read page header for page %u", pageIndex);
-    m_lastError = XtcError::READ_ERROR;
-    return 0;
+    return XtcError::READ_ERROR;
   }
 
   // Verify page magic (XTG for 1-bit, XTH for 2-bit)
@@ -425,20 +499,33 @@ size_t XtcParser::loadPage(uint32_t pageIndex, uint8_t* buffer, size_t bufferSiz
   if (pageHeader.magic != expectedMagic) {
     LOG_DBG("XTC", "Invalid page magic for page %u: 0x%08X (expected 0x%08X)", pageIndex, pageHeader.magic,
             expectedMagic);
-    m_lastError = XtcError::INVALID_MAGIC;
-    return 0;
+    return XtcError::INVALID_MAGIC;
+  }
+
+  if (pageHeader.compression != PAGE_COMPRESSION_NONE && pageHeader.compression != PAGE_COMPRESSION_RLE) {
+    LOG_DBG("XTC", "Unsupported compression %u for page %u", pageHeader.compression, pageIndex);
+    return XtcError::DECOMPRESSION_ERROR;
   }
 
   // Calculate bitmap size based on bit depth
   // XTG (1-bit): Row-major, ((width+7)/8) * height bytes
   // XTH (2-bit): Two bit planes, column-major, ((width * height + 7) / 8) * 2 bytes
-  size_t bitmapSize;
   if (m_bitDepth == 2) {
     // XTH: two bit planes, each containing (width * height) bits rounded up to bytes
     bitmapSize = ((static_cast<size_t>(pageHeader.width) * pageHeader.height + 7) / 8) * 2;
   } else {
     bitmapSize = ((pageHeader.width + 7) / 8) * pageHeader.height;
   }
+  return XtcError::OK;
+}
+
+size_t XtcParser::loadPage(uint32_t pageIndex, uint8_t* buffer, size_t bufferSize) {
+  XtgPageHeader pageHeader;
+  size_t bitmapSize;
+  m_lastError = readPageHeader(pageIndex, pageHeader, bitmapSize);
+  if (m_lastError != XtcError::OK) {
+    return 0;
+  }
 
   // Check buffer size
   if (bufferSize < bitmapSize) {
@@ -447,78 +534,103 @@ size_t XtcParser::loadPage(uint32_t pageIndex, uint8_t* buffer, size_t bufferSiz
     return 0;
   }
 
-  // Read bitmap data
-  size_t bytesRead = m_file.read(buffer, bitmapSize);
-  if (bytesRead != bitmapSize) {
-    LOG_DBG("XTC", "Page read error: expected %u, got %u", bitmapSize, bytesRead);
-    m_lastError = XtcError::READ_ERROR;
+  if (pageHeader.compression == PAGE_COMPRESSION_NONE) {
+    // Read bitmap data
+    size_t bytesRead = m_file.read(buffer, bitmapSize);
+    if (bytesRead != bitmapSize) {
+      LOG_DBG("XTC", "Page read error: expected %u, got %u", bitmapSize, bytesRead);
+      m_lastError = XtcError::READ_ERROR;
+      return 0;
+    }
+    m_lastError = XtcError::OK;
+    return bytesRead;
+  }
+
+  // Decode the compressed payload straight into the caller's buffer
+  uint8_t chunk[COMPRESSED_CHUNK_SIZE];
+  RleDecoder decoder;
+  size_t remaining = pageHeader.dataSize;
+  size_t decoded = 0;
+  while (remaining > 0 && decoded < bitmapSize) {
+    const size_t bytesRead = m_file.read(chunk, std::min(remaining, sizeof(chunk)));
+    if (bytesRead == 0) {
+      LOG_DBG("XTC", "Page read error: %u compressed bytes left", remaining);
+      m_lastError = XtcError::READ_ERROR;
+      return 0;
+    }
+    size_t written;
+    decoder.decode(chunk, bytesRead, buffer + decoded, bitmapSize - decoded, written);
+    decoded += written;
+    remaining -= bytesRead;
+  }
+  if (decoded != bitmapSize) {
+    LOG_DBG("XTC", "Page decode error: expected %u, got %u", bitmapSize, decoded);
+    m_lastError = XtcError::DECOMPRESSION_ERROR;
     return 0;
   }
 
   m_lastError = XtcError::OK;
-  return bytesRead;
+  return decoded;
 }
 
 XtcError XtcParser::loadPageStreaming(uint32_t pageIndex,
                                       std::function<void(const uint8_t* data, size_t size, size_t offset)> callback,
                                       size_t chunkSize) {
-  if (!m_isOpen) {
-    return XtcError::FILE_NOT_FOUND;
-  }
-
-  if (pageIndex >= m_header.pageCount) {
-    return XtcError::PAGE_OUT_OF_RANGE;
-  }
-
-  PageInfo page;
-  if (!readPageTableEntry(pageIndex, page)) {
-    return XtcError::READ_ERROR;
-  }
-
-  if (!ensureFileOpen()) {
-    return XtcError::FILE_NOT_FOUND;
-  }
-
-  // Seek to page data
-  if (!m_file.seek(page.offset)) {
-    return XtcError::READ_ERROR;
-  }
-
-  // Read and skip page header (XTG for 1-bit, XTH for 2-bit)
   XtgPageHeader pageHeader;
-  size_t headerRead = m_file.read(reinterpret_cast<uint8_t*>(&pageHeader), sizeof(XtgPageHeader));
-  const uint32_t expectedMagic = (m_bitDepth == 2) ? XTH_MAGIC : XTG_MAGIC;
-  if (headerRead != sizeof(XtgPageHeader) || pageHeader.magic != expectedMagic) {
-    return XtcError::READ_ERROR;
-  }
-
-  // Calculate bitmap size based on bit depth
-  // XTG (1-bit): Row-major, ((width+7)/8) * height bytes
-  // XTH (2-bit): Two bit planes, ((width * height + 7) / 8) * 2 bytes
   size_t bitmapSize;
-  if (m_bitDepth == 2) {
-    bitmapSize = ((static_cast<size_t>(pageHeader.width) * pageHeader.height + 7) / 8) * 2;
-  } else {
-    bitmapSize = ((pageHeader.width + 7) / 8) * pageHeader.height;
+  const XtcError err = readPageHeader(pageIndex, pageHeader, bitmapSize);
+  if (err != XtcError::OK) {
+    return err;
   }
 
   // Read in chunks
   std::vector<uint8_t> chunk(chunkSize);
   size_t totalRead = 0;
 
-  while (totalRead < bitmapSize) {
-    size_t toRead = std::min(chunkSize, bitmapSize - totalRead);
-    size_t bytesRead = m_file.read(chunk.data(), toRead);
+  if (pageHeader.compression == PAGE_COMPRESSION_NONE) {
+    while (totalRead < bitmapSize) {
+      size_t toRead = std::min(chunkSize, bitmapSize - totalRead);
+      size_t bytesRead = m_file.read(chunk.data(), toRead);
+
+      if (bytesRead == 0) {
+        return XtcError::READ_ERROR;
+      }
 
+      callback(chunk.data(), bytesRead, totalRead);
+      totalRead += bytesRead;
+    }
+    return XtcError::OK;
+  }
+
+  // Compressed: decode into chunkSize pieces, so callbacks see the same data as for an uncompressed page
+  uint8_t compressed[COMPRESSED_CHUNK_SIZE];
+  RleDecoder decoder;
+  size_t remaining = pageHeader.dataSize;
+  size_t pending = 0;  // Decoded bytes in chunk not passed on yet
+  while (remaining > 0 && totalRead < bitmapSize) {
+    const size_t bytesRead = m_file.read(compressed, std::min(remaining, sizeof(compressed)));
     if (bytesRead == 0) {
       return XtcError::READ_ERROR;
     }
-
-    callback(chunk.data(), bytesRead, totalRead);
-    totalRead += bytesRead;
+    remaining -= bytesRead;
+
+    size_t consumed = 0;
+    while (totalRead < bitmapSize) {
+      size_t written;
+      consumed += decoder.decode(compressed + consumed, bytesRead - consumed, chunk.data() + pending,
+                                 std::min(chunkSize, bitmapSize - totalRead) - pending, written);
+      pending += written;
+      if (pending == std::min(chunkSize, bitmapSize - totalRead)) {
+        callback(chunk.data(), pending, totalRead);
+        totalRead += pending;
+        pending = 0;
+      } else {
+        break;  // Input used up
+      }
+    }
   }
 
-  return XtcError::OK;
+  return totalRead == bitmapSize ? XtcError::OK : XtcError::DECOMPRESSION_ERROR;
 }
 
 bool XtcParser::isValidXtcFile(const char* filepath) {
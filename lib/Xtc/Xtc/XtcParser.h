@@ -48,7 +48,7 @@ class XtcParser {
   bool getPageInfo(uint32_t pageIndex, PageInfo& info);
 
   /**
-   * Load page bitmap (raw 1-bit data, skipping XTG header)
+   * Load page bitmap (raw 1-bit data, skipping XTG header; compressed pages are decoded)
    *
    * @param pageIndex Page index (0-based)
    * @param buffer Output buffer (caller allocated)
@@ -75,7 +75,12 @@ class XtcParser {
   std::string getAuthor() const { return m_author; }
 
   bool hasChapters() const { return m_hasChapters; }
-  const std::vector<ChapterInfo>& getChapters();
+  // Chapters are looked up by index in the file's chapter table rather than loaded as a list: only their page ranges
+  // are held, 6 bytes a chapter, and names are read as they are asked for
+  uint16_t getChapterCount();
+  bool getChapter(uint16_t index, ChapterInfo& chapter);
+  // Index of the first chapter whose pages include page, or -1
+  int findChapterForPage(uint32_t page);
 
   // Validation
   static bool isValidXtcFile(const char* filepath);
@@ -88,7 +93,6 @@ class XtcParser {
   std::string m_filepath;
   bool m_isOpen;
   XtcHeader m_header;
-  std::vector<ChapterInfo> m_chapters;
   std::string m_title;
   std::string m_author;
   uint16_t m_defaultWidth;
@@ -98,13 +102,45 @@ class XtcParser {
   bool m_chaptersLoaded;
   XtcError m_lastError;
 
+  // Page table entries around the last page looked up, read in one go so that page turns don't each seek back to the
+  // page table. PAGE_TABLE_CACHE_ENTRIES * 16 bytes, aligned to a multiple of PAGE_TABLE_CACHE_ENTRIES.
+  static constexpr uint16_t PAGE_TABLE_CACHE_ENTRIES = 32;
+  static constexpr size_t COMPRESSED_CHUNK_SIZE = 512;  // Stack buffer for reading compressed page data
+  PageTableEntry m_pageTableCache[PAGE_TABLE_CACHE_ENTRIES];
+  uint32_t m_pageTableCacheStart;
+  uint16_t m_pageTableCacheCount;
+
+  // Usable entries of the chapter table, indexed on first use: the table skips entries with no pages in the book
+  struct ChapterEntry {
+    uint16_t slot;  // Position in the chapter table
+    uint16_t startPage;
+    uint16_t endPage;
+  };
+  std::vector<ChapterEntry> m_chapterIndex;
+  uint32_t m_chapterTableOffset;
+  // Names of chapters read lately, chapter i in slot i % CHAPTER_NAME_CACHE_ENTRIES. A miss reads the names of
+  // CHAPTER_NAME_READ_AHEAD chapters from there on in one pass, so a screen of the chapter list takes a read or two.
+  // Allocated with the first name read.
+  static constexpr uint16_t CHAPTER_NAME_CACHE_ENTRIES = 32;
+  static constexpr uint16_t CHAPTER_NAME_READ_AHEAD = 16;
+  struct CachedChapterName {
+    int32_t index = -1;
+    std::string name;
+  };
+  std::unique_ptr<CachedChapterName[]> m_chapterNames;
+
   // Internal helper functions
   XtcError readHeader();
   XtcError readFirstPageInfo();
   XtcError readTitle();
   XtcError readAuthor();
-  XtcError readChapters();
+  XtcError indexChapters();
+  // Indexes the chapters unless done already; false if the book has none
+  bool ensureChaptersIndexed();
+  bool readChapterNames(uint16_t first);
   bool readPageTableEntry(uint32_t pageIndex, PageInfo& info);
+  // Seeks to a page, reads and checks its header and leaves the file at the page data
+  XtcError readPageHeader(uint32_t pageIndex, XtgPageHeader& pageHeader, size_t& bitmapSize);
 
   // File handle management — reopen on demand, close after use
   bool ensureFileOpen();
@@ -0,0 +1,64 @@
+/**
+ * XtcRle.cpp
+ *
+ * Streaming decoder for RLE compressed XTG/XTH page bitmaps
+ * XTC ebook support for CrossPoint Reader
+ */
+
+#include "XtcRle.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace xtc {
+
+size_t RleDecoder::decode(const uint8_t* in, const size_t inSize, uint8_t* out, const size_t outCapacity,
+                          size_t& outWritten) {
+  size_t consumed = 0;
+  outWritten = 0;
+
+  while (outWritten < outCapacity) {
+    if (m_literalLeft > 0) {
+      const size_t count = std::min({static_cast<size_t>(m_literalLeft), inSize - consumed, outCapacity - outWritten});
+      if (count == 0) {
+        break;  // Needs more input
+      }
+      memcpy(out + outWritten, in + consumed, count);
+      consumed += count;
+      outWritten += count;
+      m_literalLeft -= count;
+      continue;
+    }
+
+    if (m_repeatLeft > 0) {
+      if (m_needRepeatValue) {
+        if (consumed == inSize) {
+          break;
+        }
+        m_repeatValue = in[consumed++];
+        m_needRepeatValue = false;
+      }
+      const size_t count = std::min(static_cast<size_t>(m_repeatLeft), outCapacity - outWritten);
+      memset(out + outWritten, m_repeatValue, count);
+      outWritten += count;
+      m_repeatLeft -= count;
+      continue;
+    }
+
+    // Start of the next run
+    if (consumed == inSize) {
+      break;
+    }
+    const uint8_t control = in[consumed++];
+    if (control < 0x80) {
+      m_literalLeft = control + 1;
+    } else {
+      m_repeatLeft = control - 0x7D;
+      m_needRepeatValue = true;
+    }
+  }
+
+  return consumed;
+}
+
+}  // namespace xtc
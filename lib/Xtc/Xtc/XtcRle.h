@@ -0,0 +1,46 @@
+/**
+ * XtcRle.h
+ *
+ * Streaming decoder for RLE compressed XTG/XTH page bitmaps
+ * XTC ebook support for CrossPoint Reader
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace xtc {
+
+/**
+ * RLE page decoder (page header compression = PAGE_COMPRESSION_RLE)
+ *
+ * The payload is a sequence of runs, each starting with a control byte n:
+ *   n < 0x80:  n + 1 literal bytes follow
+ *   n >= 0x80: the next byte repeated n - 0x7D times (3 to 130)
+ *
+ * Page bitmaps are mostly white (0xFF bytes in XTG, 0x00 in both XTH planes), so blank areas shrink to 2 bytes per
+ * 130. The decoder keeps its state between calls, so the payload can be fed in chunks of any size as it is read.
+ */
+class RleDecoder {
+ public:
+  /**
+   * Decode from input into output until the input is used up or the output is full
+   *
+   * @param in Compressed input
+   * @param inSize Input size
+   * @param out Output buffer
+   * @param outCapacity Output buffer size
+   * @param outWritten Set to the number of bytes written to out
+   * @return Number of input bytes consumed
+   */
+  size_t decode(const uint8_t* in, size_t inSize, uint8_t* out, size_t outCapacity, size_t& outWritten);
+
+ private:
+  uint8_t m_literalLeft = 0;  // Literal bytes of the current run still to copy
+  uint8_t m_repeatLeft = 0;   // Repeats of the current run still to write
+  bool m_needRepeatValue = false;
+  uint8_t m_repeatValue = 0;
+};
+
+}  // namespace xtc
@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
@@ -27,6 +28,14 @@ constexpr uint32_t XTG_MAGIC = 0x00475458;  // "XTG\0" for 1-bit page data
 // "XTH\0" = 0x58, 0x54, 0x48, 0x00
 constexpr uint32_t XTH_MAGIC = 0x00485458;  // "XTH\0" for 2-bit page data
 
+// XTG/XTH page header compression values
+constexpr uint8_t PAGE_COMPRESSION_NONE = 0;
+constexpr uint8_t PAGE_COMPRESSION_RLE = 1;  // See RleDecoder
+
+// Chapter table entries: a NUL-padded name, then 1-based start and end pages at 0x50 and 0x52
+constexpr size_t CHAPTER_ENTRY_SIZE = 96;
+constexpr size_t CHAPTER_NAME_SIZE = 80;
+
 // XTeink X4 display resolution
 constexpr uint16_t DISPLAY_WIDTH = 480;
 constexpr uint16_t DISPLAY_HEIGHT = 800;
@@ -70,10 +79,11 @@ struct XtgPageHeader {
   uint16_t width;       // 0x04: Image width (pixels)
   uint16_t height;      // 0x06: Image height (pixels)
   uint8_t colorMode;    // 0x08: Color mode (0=monochrome)
-  uint8_t compression;  // 0x09: Compression (0=uncompressed)
-  uint32_t dataSize;    // 0x0A: Image data size (bytes)
+  uint8_t compression;  // 0x09: Compression (0=uncompressed, 1=RLE)
+  uint32_t dataSize;    // 0x0A: Image data size (bytes, compressed size if compressed)
   uint64_t md5;         // 0x0E: MD5 checksum (first 8 bytes, optional)
   // Followed by bitmap data at offset 0x16 (22)
+  // (or, if compressed, dataSize bytes that decode to it)
   //
   // XTG (1-bit): Row-major, 8 pixels/byte, MSB first
   //   dataSize = ((width + 7) / 8) * height
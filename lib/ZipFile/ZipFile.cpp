@@ -1,10 +1,14 @@
 #include "ZipFile.h"
 
+#include <Arduino.h>
 #include <HalStorage.h>
 #include <InflateReader.h>
 #include <Logging.h>
 
 #include <algorithm>
+#include <cstring>
+#include <new>
+#include <vector>
 
 struct ZipInflateCtx {
   InflateReader reader;  // Must be first — callback casts uzlib_uncomp* to ZipInflateCtx*
@@ -17,6 +21,24 @@ struct ZipInflateCtx {
 namespace {
 constexpr uint16_t ZIP_METHOD_STORED = 0;
 constexpr uint16_t ZIP_METHOD_DEFLATED = 8;
+// Reads of compressed data tried before an inflate gives up
+constexpr int ZIP_READ_ATTEMPTS = 3;
+// Compressed bytes read from the zip at a time by an InflatedEntry
+constexpr size_t INFLATED_ENTRY_READ_SIZE = 1024;
+
+constexpr char INDEX_MAGIC[4] = {'Z', 'I', 'X', '1'};
+constexpr size_t INDEX_ENTRIES_OFFSET =
+    sizeof(ZipFile::IndexHeader) + (ZipFile::INDEX_BUCKETS + 1) * sizeof(uint32_t);
+// Entries sorted in RAM at a time while building the index; larger zips are built in several passes
+constexpr size_t INDEX_BUILD_CHUNK = 512;
+constexpr size_t INDEX_READ_CHUNK = 16;
+static_assert(sizeof(ZipFile::IndexEntry) == 24, "IndexEntry is part of the index format");
+
+size_t indexBucket(const uint64_t hash) { return static_cast<size_t>(hash >> 56); }
+
+bool indexEntryLess(const ZipFile::IndexEntry& a, const ZipFile::IndexEntry& b) {
+  return a.hash < b.hash || (a.hash == b.hash && a.len < b.len);
+}
 
 // RAII zip: opens the zip if not already open, closes on destruction only if
 // it performed the open.  Removes the wasOpen/close boilerplate from every method.
@@ -45,11 +67,17 @@ int zipReadCallback(uzlib_uncomp* uncomp) {
   if (ctx->fileRemaining == 0) return -1;
 
   const size_t toRead = ctx->fileRemaining < ctx->readBufSize ? ctx->fileRemaining : ctx->readBufSize;
-  const size_t bytesRead = ctx->file->read(ctx->readBuf, toRead);
+  const size_t at = ctx->file->position();
+  int bytesRead = ctx->file->read(ctx->readBuf, toRead);
+  // The SD card can fail a read while it is busy; retry before failing the whole entry, as a temp file copy would
+  for (int attempt = 1; bytesRead <= 0 && attempt < ZIP_READ_ATTEMPTS; attempt++) {
+    LOG_DBG("ZIP", "Retrying read at %u (attempt %d)", static_cast<unsigned>(at), attempt + 1);
+    delay(50);
+    bytesRead = ctx->file->seek(at) ? ctx->file->read(ctx->readBuf, toRead) : -1;
+  }
+  if (bytesRead <= 0) return -1;
   ctx->fileRemaining -= bytesRead;
 
-  if (bytesRead == 0) return -1;
-
   uncomp->source = ctx->readBuf + 1;
   uncomp->source_limit = ctx->readBuf + bytesRead;
   return ctx->readBuf[0];
@@ -107,6 +135,192 @@ bool ZipFile::loadAllFileStatSlims() {
   return true;
 }
 
+bool ZipFile::forEachEntry(const std::function<void(const char* name, const FileStatSlim& stat)>& visit) {
+  const ScopedOpenClose zip{*this};
+  if (!zip) return false;
+
+  if (!loadZipDetails()) return false;
+
+  file.seek(zipDetails.centralDirOffset);
+  FileStatSlim fileStat = {};
+  char itemName[256];
+  uint16_t nameLen;
+  while (readCentralDirEntry(&fileStat, itemName, &nameLen)) {
+    if (nameLen < sizeof(itemName)) {
+      visit(itemName, fileStat);
+    }
+  }
+  return true;
+}
+
+bool ZipFile::readCentralDirEntry(FileStatSlim* fileStat, char* name, uint16_t* nameLen) {
+  uint32_t sig;
+  if (file.read(&sig, 4) != 4 || sig != 0x02014b50) return false;  // End of list
+
+  file.seekCur(6);
+  file.read(&fileStat->method, 2);
+  file.seekCur(8);
+  file.read(&fileStat->compressedSize, 4);
+  file.read(&fileStat->uncompressedSize, 4);
+  uint16_t m, k;
+  file.read(nameLen, 2);
+  file.read(&m, 2);
+  file.read(&k, 2);
+  file.seekCur(8);
+  file.read(&fileStat->localHeaderOffset, 4);
+
+  if (*nameLen < 256) {
+    file.read(name, *nameLen);
+    name[*nameLen] = '\0';
+  } else {
+    file.seekCur(*nameLen);
+  }
+  file.seekCur(m + k);
+  return true;
+}
+
+bool ZipFile::readIndexHeader(FsFile& index, IndexHeader& header) {
+  if (!Storage.exists(indexPath.c_str()) || !Storage.openFileForRead("ZIP", indexPath, index)) return false;
+
+  if (index.read(&header, sizeof(header)) != sizeof(header) || memcmp(header.magic, INDEX_MAGIC, 4) != 0 ||
+      header.zipSize != file.size() || header.centralDirOffset != zipDetails.centralDirOffset ||
+      index.size() != INDEX_ENTRIES_OFFSET + header.count * sizeof(IndexEntry)) {
+    index.close();
+    return false;
+  }
+  return true;
+}
+
+bool ZipFile::buildIndex() {
+  FsFile index;
+  if (!Storage.openFileForWrite("ZIP", indexPath, index)) return false;
+
+  // Header and bucket table are written once the entries are in place
+  std::vector<uint32_t> bucketStart(INDEX_BUCKETS + 1, 0);
+  const size_t tableBytes = bucketStart.size() * sizeof(uint32_t);
+  IndexHeader header = {};
+  index.write(&header, sizeof(header));
+  index.write(bucketStart.data(), tableBytes);
+
+  FileStatSlim fileStat = {};
+  char itemName[256];
+  uint16_t nameLen;
+
+  // With more entries than fit in one chunk, count them per bucket first so each pass covers a run of whole buckets
+  std::vector<uint32_t> bucketCount(INDEX_BUCKETS, 0);
+  const bool multiPass = zipDetails.totalEntries > INDEX_BUILD_CHUNK;
+  if (multiPass) {
+    file.seek(zipDetails.centralDirOffset);
+    while (readCentralDirEntry(&fileStat, itemName, &nameLen)) {
+      if (nameLen < 256) bucketCount[indexBucket(fnvHash64(itemName, nameLen))]++;
+    }
+  }
+
+  std::vector<IndexEntry> entries;
+  entries.reserve(std::min<size_t>(zipDetails.totalEntries, INDEX_BUILD_CHUNK));
+  uint32_t count = 0;
+  bool ok = true;
+  size_t firstBucket = 0;
+  while (ok && firstBucket < INDEX_BUCKETS) {
+    size_t endBucket = INDEX_BUCKETS;
+    if (multiPass) {
+      // At least one bucket per pass, however full it is
+      size_t passEntries = bucketCount[firstBucket];
+      endBucket = firstBucket + 1;
+      while (endBucket < INDEX_BUCKETS && passEntries + bucketCount[endBucket] <= INDEX_BUILD_CHUNK) {
+        passEntries += bucketCount[endBucket++];
+      }
+    }
+
+    file.seek(zipDetails.centralDirOffset);
+    while (readCentralDirEntry(&fileStat, itemName, &nameLen)) {
+      if (nameLen >= 256) continue;
+      const uint64_t hash = fnvHash64(itemName, nameLen);
+      const size_t bucket = indexBucket(hash);
+      if (bucket < firstBucket || bucket >= endBucket) continue;
+      entries.push_back({hash, nameLen, fileStat.method, fileStat.compressedSize, fileStat.uncompressedSize,
+                         fileStat.localHeaderOffset});
+    }
+
+    std::sort(entries.begin(), entries.end(), indexEntryLess);
+    for (const auto& entry : entries) bucketStart[indexBucket(entry.hash) + 1]++;
+    const size_t bytes = entries.size() * sizeof(IndexEntry);
+    ok = index.write(entries.data(), bytes) == bytes;
+    count += entries.size();
+    entries.clear();
+    firstBucket = endBucket;
+  }
+
+  for (size_t i = 1; i <= INDEX_BUCKETS; i++) bucketStart[i] += bucketStart[i - 1];
+  memcpy(header.magic, INDEX_MAGIC, 4);
+  header.zipSize = file.size();
+  header.centralDirOffset = zipDetails.centralDirOffset;
+  header.count = count;
+
+  if (ok) {
+    index.seek(sizeof(header));
+    ok = index.write(bucketStart.data(), tableBytes) == tableBytes;
+  }
+  if (ok) {
+    index.seek(0);
+    ok = index.write(&header, sizeof(header)) == sizeof(header);
+  }
+  index.close();
+
+  if (!ok) {
+    LOG_ERR("ZIP", "Failed to write entry index %s", indexPath.c_str());
+    Storage.remove(indexPath.c_str());
+    return false;
+  }
+  LOG_DBG("ZIP", "Indexed %u entries of %s", static_cast<unsigned>(count), filePath.c_str());
+  return true;
+}
+
+bool ZipFile::openIndex(FsFile& index, IndexHeader& header) {
+  if (indexPath.empty() || indexUnavailable) return false;
+  if (!loadZipDetails()) return false;
+
+  if (readIndexHeader(index, header)) return true;
+  if (buildIndex() && readIndexHeader(index, header)) return true;
+
+  indexUnavailable = true;
+  return false;
+}
+
+bool ZipFile::findInIndex(FsFile& index, const IndexHeader& header, const char* filename, FileStatSlim* fileStat) {
+  const size_t len = strlen(filename);
+  if (len >= 256) return false;
+  const uint64_t hash = fnvHash64(filename, len);
+
+  uint32_t range[2];
+  index.seek(sizeof(IndexHeader) + indexBucket(hash) * sizeof(uint32_t));
+  if (index.read(range, sizeof(range)) != sizeof(range) || range[0] > range[1] || range[1] > header.count) {
+    return false;
+  }
+
+  index.seek(INDEX_ENTRIES_OFFSET + range[0] * sizeof(IndexEntry));
+  IndexEntry entries[INDEX_READ_CHUNK];
+  uint32_t remaining = range[1] - range[0];
+  while (remaining > 0) {
+    const size_t n = std::min<size_t>(remaining, INDEX_READ_CHUNK);
+    const size_t bytes = n * sizeof(IndexEntry);
+    if (static_cast<size_t>(index.read(entries, bytes)) != bytes) return false;
+    for (size_t i = 0; i < n; i++) {
+      const auto& entry = entries[i];
+      if (entry.hash > hash) return false;
+      if (entry.hash == hash && entry.len == len) {
+        fileStat->method = entry.method;
+        fileStat->compressedSize = entry.compressedSize;
+        fileStat->uncompressedSize = entry.uncompressedSize;
+        fileStat->localHeaderOffset = entry.localHeaderOffset;
+        return true;
+      }
+    }
+    remaining -= n;
+  }
+  return false;
+}
+
 bool ZipFile::loadFileStatSlim(const char* filename, FileStatSlim* fileStat) {
   if (!fileStatSlimCache.empty()) {
     const auto it = fileStatSlimCache.find(filename);
@@ -120,6 +334,12 @@ bool ZipFile::loadFileStatSlim(const char* filename, FileStatSlim* fileStat) {
   const ScopedOpenClose zip{*this};
   if (!zip) return false;
 
+  FsFile index;
+  IndexHeader header;
+  if (openIndex(index, header)) {
+    return findInIndex(index, header, filename, fileStat);
+  }
+
   if (!loadZipDetails()) return false;
 
   // Phase 1: Try scanning from cursor position first
@@ -304,6 +524,38 @@ int ZipFile::fillUncompressedSizes(std::deque<SizeTarget>& targets, std::deque<u
   const ScopedOpenClose zip{*this};
   if (!zip) return 0;
 
+  const auto targetLess = [](const SizeTarget& a, const SizeTarget& b) {
+    return a.hash < b.hash || (a.hash == b.hash && a.len < b.len);
+  };
+
+  FsFile index;
+  IndexHeader header;
+  if (openIndex(index, header)) {
+    // Both lists are sorted by (hash, len), so one merge over the index finds every target
+    index.seek(INDEX_ENTRIES_OFFSET);
+    IndexEntry entries[INDEX_READ_CHUNK];
+    int matched = 0;
+    auto it = targets.begin();
+    uint32_t remaining = header.count;
+    while (remaining > 0 && it != targets.end()) {
+      const size_t n = std::min<size_t>(remaining, INDEX_READ_CHUNK);
+      const size_t bytes = n * sizeof(IndexEntry);
+      if (static_cast<size_t>(index.read(entries, bytes)) != bytes) break;
+      for (size_t i = 0; i < n && it != targets.end(); i++) {
+        const SizeTarget key = {entries[i].hash, entries[i].len, 0};
+        while (it != targets.end() && targetLess(*it, key)) ++it;
+        for (auto match = it; match != targets.end() && match->hash == key.hash && match->len == key.len; ++match) {
+          if (match->index < sizes.size()) {
+            sizes[match->index] = entries[i].uncompressedSize;
+            matched++;
+          }
+        }
+      }
+      remaining -= n;
+    }
+    return matched;
+  }
+
   if (!loadZipDetails()) return 0;
 
   file.seek(zipDetails.centralDirOffset);
@@ -339,9 +591,7 @@ int ZipFile::fillUncompressedSizes(std::deque<SizeTarget>& targets, std::deque<u
       uint64_t hash = fnvHash64(itemName, nameLen);
       SizeTarget key = {hash, nameLen, 0};
 
-      auto it = std::lower_bound(targets.begin(), targets.end(), key, [](const SizeTarget& a, const SizeTarget& b) {
-        return a.hash < b.hash || (a.hash == b.hash && a.len < b.len);
-      });
+      auto it = std::lower_bound(targets.begin(), targets.end(), key, targetLess);
 
       while (it != targets.end() && it->hash == hash && it->len == nameLen) {
         if (it->index < sizes.size()) {
@@ -559,3 +809,108 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
   LOG_ERR("ZIP", "Unsupported compression method");
   return false;
 }
+
+bool ZipFile::openStoredEntry(const char* filename, StoredEntry& entry) {
+  entry.close();
+
+  FileStatSlim fileStat = {};
+  long dataOffset;
+  {
+    const ScopedOpenClose zip{*this};
+    if (!zip) return false;
+    if (!loadFileStatSlim(filename, &fileStat) || fileStat.method != ZIP_METHOD_STORED) return false;
+    dataOffset = getDataOffset(fileStat);
+    if (dataOffset < 0) return false;
+  }
+
+  if (!Storage.openFileForRead("ZIP", filePath, entry.file)) return false;
+  entry.offset = static_cast<uint32_t>(dataOffset);
+  entry.length = fileStat.uncompressedSize;
+  entry.pos = 0;
+  if (!entry.file.seek(entry.offset)) {
+    entry.close();
+    return false;
+  }
+  return true;
+}
+
+bool ZipFile::openFileRange(const std::string& path, const uint32_t offset, const uint32_t length,
+                            StoredEntry& entry) {
+  entry.close();
+  if (!Storage.openFileForRead("ZIP", path, entry.file)) return false;
+  entry.offset = offset;
+  entry.length = length;
+  entry.pos = 0;
+  if (offset + length > entry.file.size() || !entry.file.seek(offset)) {
+    entry.close();
+    return false;
+  }
+  return true;
+}
+
+bool ZipFile::openInflatedEntry(const char* filename, InflatedEntry& entry) {
+  entry.close();
+
+  FileStatSlim fileStat = {};
+  long dataOffset;
+  {
+    const ScopedOpenClose zip{*this};
+    if (!zip) return false;
+    if (!loadFileStatSlim(filename, &fileStat) || fileStat.method != ZIP_METHOD_DEFLATED) return false;
+    dataOffset = getDataOffset(fileStat);
+    if (dataOffset < 0) return false;
+  }
+
+  entry.ctx = new (std::nothrow) ZipInflateCtx();
+  if (!entry.ctx) return false;
+  entry.ctx->readBuf = static_cast<uint8_t*>(malloc(INFLATED_ENTRY_READ_SIZE));
+  entry.ctx->readBufSize = INFLATED_ENTRY_READ_SIZE;
+  if (!entry.ctx->readBuf || !Storage.openFileForRead("ZIP", filePath, entry.file)) {
+    entry.close();
+    return false;
+  }
+  entry.ctx->file = &entry.file;
+  entry.offset = static_cast<uint32_t>(dataOffset);
+  entry.compressedLength = fileStat.compressedSize;
+  entry.length = fileStat.uncompressedSize;
+  if (!entry.rewind()) {
+    entry.close();
+    return false;
+  }
+  return true;
+}
+
+bool ZipFile::InflatedEntry::rewind() {
+  if (!ctx || !file.seek(offset) || !ctx->reader.init(true)) return false;
+  ctx->reader.setReadCallback(zipReadCallback);
+  ctx->fileRemaining = compressedLength;
+  pos = 0;
+  return true;
+}
+
+int ZipFile::InflatedEntry::read(void* buf, const size_t count) {
+  const size_t toRead = count < length - pos ? count : length - pos;
+  if (toRead == 0) return 0;
+  size_t produced = 0;
+  const InflateStatus status = ctx->reader.readAtMost(static_cast<uint8_t*>(buf), toRead, &produced);
+  if (status == InflateStatus::Error) {
+    LOG_ERR("ZIP", "Decompression failed at byte %u", static_cast<unsigned>(pos));
+    return -1;
+  }
+  if (status == InflateStatus::Done && pos + produced < length) {
+    LOG_ERR("ZIP", "Decompressed size mismatch (expected %u, got %u)", static_cast<unsigned>(length),
+            static_cast<unsigned>(pos + produced));
+    return -1;
+  }
+  pos += produced;
+  return static_cast<int>(produced);
+}
+
+void ZipFile::InflatedEntry::close() {
+  if (ctx) {
+    free(ctx->readBuf);
+    delete ctx;  // Returns the inflate window
+    ctx = nullptr;
+  }
+  file.close();
+}
@@ -2,9 +2,12 @@
 #include <HalStorage.h>
 
 #include <deque>
+#include <functional>
 #include <string>
 #include <unordered_map>
 
+struct ZipInflateCtx;
+
 class ZipFile {
  public:
   struct FileStatSlim {
@@ -27,6 +30,95 @@ class ZipFile {
     uint16_t index;  // Caller's index (e.g. spine index)
   };
 
+  /**
+   * Entry index persisted at indexPath, so a zip opened again looks an entry up with two small reads instead of a scan
+   * of the central directory. Built in one pass over the central directory the first time it is needed, and rebuilt
+   * when the zip's size or central directory offset no longer match.
+   *
+   * - IndexHeader
+   * - uint32_t bucketStart[INDEX_BUCKETS + 1] - first entry of each bucket; an entry's bucket is the top byte of hash
+   * - count IndexEntry, sorted by (hash, len)
+   */
+  struct IndexHeader {
+    char magic[4];  // "ZIX1", written last so an interrupted build is never used
+    uint32_t zipSize;
+    uint32_t centralDirOffset;
+    uint32_t count;
+  };
+
+  struct IndexEntry {
+    uint64_t hash;  // fnvHash64 of the entry name
+    uint16_t len;   // Length of the entry name
+    uint16_t method;
+    uint32_t compressedSize;
+    uint32_t uncompressedSize;
+    uint32_t localHeaderOffset;
+  };
+
+  static constexpr size_t INDEX_BUCKETS = 256;
+
+  /**
+   * Positioned-read view of a stored (uncompressed) entry: its bytes are read straight from the archive, with no
+   * intermediate buffer or inflate state. Holds its own handle on the zip, so it outlives the ZipFile that opened it.
+   */
+  class StoredEntry {
+    friend class ZipFile;
+    FsFile file;
+    uint32_t offset = 0;  // Of the entry's data in the zip
+    uint32_t length = 0;
+    uint32_t pos = 0;
+
+   public:
+    bool isOpen() const { return !!file; }
+    size_t size() const { return length; }
+    size_t position() const { return pos; }
+    int available() const { return static_cast<int>(length - pos); }
+    bool seek(const size_t target) {
+      if (target > length || !file.seek(offset + target)) return false;
+      pos = target;
+      return true;
+    }
+    int read(void* buf, const size_t count) {
+      const size_t toRead = count < length - pos ? count : length - pos;
+      if (toRead == 0) return 0;
+      const int bytesRead = file.read(buf, toRead);
+      if (bytesRead > 0) pos += bytesRead;
+      return bytesRead;
+    }
+    void close() { file.close(); }
+  };
+
+  /**
+   * Forward-only view of a deflated entry, inflated as it is read, so a parser can take its input straight from the
+   * archive rather than from a temp file the entry was first inflated to. Holds its own handle on the zip and a
+   * streaming inflate window until closed.
+   */
+  class InflatedEntry {
+    friend class ZipFile;
+    FsFile file;
+    ZipInflateCtx* ctx = nullptr;
+    uint32_t offset = 0;  // Of the entry's data in the zip
+    uint32_t compressedLength = 0;
+    uint32_t length = 0;
+    uint32_t pos = 0;
+
+   public:
+    InflatedEntry() = default;
+    ~InflatedEntry() { close(); }
+    InflatedEntry(const InflatedEntry&) = delete;
+    InflatedEntry& operator=(const InflatedEntry&) = delete;
+
+    bool isOpen() const { return ctx != nullptr; }
+    size_t size() const { return length; }
+    size_t position() const { return pos; }
+    int available() const { return static_cast<int>(length - pos); }
+    // Starts inflating again from the first byte
+    bool rewind();
+    // -1 if the entry can't be read or inflated; 0 only at its end
+    int read(void* buf, size_t count);
+    void close();
+  };
+
   // FNV-1a 64-bit hash computed from char buffer (no std::string allocation)
   static uint64_t fnvHash64(const char* s, size_t len) {
     uint64_t hash = 14695981039346656037ull;
@@ -47,12 +139,26 @@ class ZipFile {
   uint32_t lastCentralDirPos = 0;
   bool lastCentralDirPosValid = false;
 
+  // Empty when the zip has no persisted index
+  std::string indexPath;
+  bool indexUnavailable = false;  // Could not be read or built; lookups fall back to scanning
+
   bool loadFileStatSlim(const char* filename, FileStatSlim* fileStat);
   long getDataOffset(const FileStatSlim& fileStat);
   bool loadZipDetails();
+  // Reads the central directory entry at the cursor. nameLen is set even when the name is too long for name (256
+  // bytes), in which case the name is skipped and left unread.
+  bool readCentralDirEntry(FileStatSlim* fileStat, char* name, uint16_t* nameLen);
+  // Opens the index positioned after its header, building it first if missing or stale. Needs the zip open.
+  bool openIndex(FsFile& index, IndexHeader& header);
+  bool readIndexHeader(FsFile& index, IndexHeader& header);
+  bool buildIndex();
+  bool findInIndex(FsFile& index, const IndexHeader& header, const char* filename, FileStatSlim* fileStat);
 
  public:
-  explicit ZipFile(const std::string& filePath) : filePath(filePath) {}
+  // indexPath, when given, is where the entry index of this zip is kept (e.g. in the book's cache directory)
+  explicit ZipFile(const std::string& filePath, std::string indexPath = "")
+      : filePath(filePath), indexPath(std::move(indexPath)) {}
   ~ZipFile() = default;
   // Zip file can be opened and closed by hand in order to allow for quick calculation of inflated file size
   // It is NOT recommended to pre-open it for any kind of inflation due to memory constraints
@@ -60,8 +166,11 @@ class ZipFile {
   bool open();
   bool close();
   bool loadAllFileStatSlims();
+  // Calls visit for every entry of the central directory, in archive order, without keeping any of them. Entries whose
+  // names are 256 bytes or longer are passed over.
+  bool forEachEntry(const std::function<void(const char* name, const FileStatSlim& stat)>& visit);
   bool getInflatedFileSize(const char* filename, size_t* size);
-  // Batch lookup: scan ZIP central dir once and fill sizes for matching targets.
+  // Batch lookup: scan ZIP central dir (or the entry index) once and fill sizes for matching targets.
   // targets must be sorted by (hash, len). sizes[target.index] receives uncompressedSize.
   // Returns number of targets matched.
   int fillUncompressedSizes(std::deque<SizeTarget>& targets, std::deque<uint32_t>& sizes);
@@ -69,4 +178,10 @@ class ZipFile {
   // These functions will open and close the zip as needed
   uint8_t* readFileToMemory(const char* filename, size_t* size = nullptr, bool trailingNullByte = false);
   bool readFileToStream(const char* filename, Print& out, size_t chunkSize);
+  // Opens a view of a stored entry. False if the entry is missing or compressed, in which case it must be inflated.
+  bool openStoredEntry(const char* filename, StoredEntry& entry);
+  // Opens an inflating view of a deflated entry. False if the entry is missing, stored, or no inflate window is free.
+  bool openInflatedEntry(const char* filename, InflatedEntry& entry);
+  // Opens a view of length bytes at offset in any file, read like a stored entry: the sections of an FB2 book
+  static bool openFileRange(const std::string& path, uint32_t offset, uint32_t length, StoredEntry& entry);
 };
@@ -56,6 +56,45 @@ void HalDisplay::displayBuffer(HalDisplay::RefreshMode mode, bool turnOffScreen)
   }
 
   einkDisplay.displayBuffer(convertRefreshMode(mode), turnOffScreen);
+  countRefresh(mode);
+}
+
+void HalDisplay::countRefresh(const RefreshMode mode) {
+  switch (mode) {
+    case FULL_REFRESH:
+      refreshCounts.full++;
+      break;
+    case HALF_REFRESH:
+      refreshCounts.half++;
+      break;
+    case FAST_REFRESH:
+    default:
+      refreshCounts.fast++;
+      break;
+  }
+}
+
+namespace {
+// The windowed update only exists in some versions of the display driver
+template <typename Driver>
+bool driverDisplayWindow(Driver& driver, const uint16_t x, const uint16_t y, const uint16_t w, const uint16_t h,
+                         const bool turnOffScreen) {
+  if constexpr (requires { driver.displayWindow(x, y, w, h, turnOffScreen); }) {
+    driver.displayWindow(x, y, w, h, turnOffScreen);
+    return true;
+  } else {
+    return false;
+  }
+}
+}  // namespace
+
+bool HalDisplay::displayWindow(const uint16_t x, const uint16_t y, const uint16_t w, const uint16_t h,
+                               const bool turnOffScreen) {
+  if (!driverDisplayWindow(einkDisplay, x, y, w, h, turnOffScreen)) {
+    return false;
+  }
+  refreshCounts.window++;
+  return true;
 }
 
 void HalDisplay::refreshDisplay(HalDisplay::RefreshMode mode, bool turnOffScreen) {
@@ -64,6 +103,7 @@ void HalDisplay::refreshDisplay(HalDisplay::RefreshMode mode, bool turnOffScreen
   }
 
   einkDisplay.refreshDisplay(convertRefreshMode(mode), turnOffScreen);
+  countRefresh(mode);
 }
 
 void HalDisplay::deepSleep() { einkDisplay.deepSleep(); }
@@ -80,7 +120,10 @@ void HalDisplay::copyGrayscaleMsbBuffers(const uint8_t* msbBuffer) { einkDisplay
 
 void HalDisplay::cleanupGrayscaleBuffers(const uint8_t* bwBuffer) { einkDisplay.cleanupGrayscaleBuffers(bwBuffer); }
 
-void HalDisplay::displayGrayBuffer(bool turnOffScreen) { einkDisplay.displayGrayBuffer(turnOffScreen); }
+void HalDisplay::displayGrayBuffer(bool turnOffScreen) {
+  einkDisplay.displayGrayBuffer(turnOffScreen);
+  refreshCounts.gray++;
+}
 
 uint16_t HalDisplay::getDisplayWidth() const { return einkDisplay.getDisplayWidth(); }
 
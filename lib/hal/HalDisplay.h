@@ -34,6 +34,9 @@ class HalDisplay {
                             bool fromProgmem = false) const;
 
   void displayBuffer(RefreshMode mode = RefreshMode::FAST_REFRESH, bool turnOffScreen = false);
+  // Fast refresh of a panel-coordinate window of the frame buffer (x and width multiples of 8). Returns false if the
+  // display driver has no windowed update, in which case nothing was sent.
+  bool displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool turnOffScreen = false);
   void refreshDisplay(RefreshMode mode = RefreshMode::FAST_REFRESH, bool turnOffScreen = false);
 
   // Power management
@@ -49,6 +52,16 @@ class HalDisplay {
 
   void displayGrayBuffer(bool turnOffScreen = false);
 
+  // Panel updates since boot, by kind; a full refresh costs several times the energy of a fast one
+  struct RefreshCounts {
+    uint32_t full = 0;
+    uint32_t half = 0;
+    uint32_t fast = 0;
+    uint32_t window = 0;  // Fast refreshes of part of the panel
+    uint32_t gray = 0;    // Grayscale passes, each on top of a black and white update
+  };
+  const RefreshCounts& getRefreshCounts() const { return refreshCounts; }
+
   // Runtime geometry passthrough
   uint16_t getDisplayWidth() const;
   uint16_t getDisplayHeight() const;
@@ -57,6 +70,9 @@ class HalDisplay {
 
  private:
   EInkDisplay einkDisplay;
+  RefreshCounts refreshCounts;
+
+  void countRefresh(RefreshMode mode);
 };
 
 extern HalDisplay display;
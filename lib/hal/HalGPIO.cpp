@@ -204,6 +204,9 @@ void HalGPIO::begin() {
 
 void HalGPIO::update() {
   inputMgr.update();
+  if (inputMgr.wasAnyPressed()) {
+    lastPressUs = micros();
+  }
   const bool connected = isUsbConnected();
   usbStateChanged = (connected != lastUsbConnected);
   lastUsbConnected = connected;
@@ -231,6 +234,7 @@ void HalGPIO::startDeepSleep() {
   }
   // Arm the wakeup trigger *after* the button is released
   esp_deep_sleep_enable_gpio_wakeup(1ULL << InputManager::POWER_BUTTON_PIN, ESP_GPIO_WAKEUP_GPIO_LOW);
+  logFlush();
   // Enter Deep Sleep
   esp_deep_sleep_start();
 }
@@ -45,6 +45,7 @@ class HalGPIO {
 
   bool lastUsbConnected = false;
   bool usbStateChanged = false;
+  uint32_t lastPressUs = 0;
 
  public:
   enum class DeviceType : uint8_t { X4, X3 };
@@ -70,6 +71,8 @@ class HalGPIO {
   bool wasReleased(uint8_t buttonIndex) const;
   bool wasAnyReleased() const;
   unsigned long getHeldTime() const;
+  // micros() at the update() that saw the last button press
+  uint32_t getLastPressTime() const { return lastPressUs; }
 
   // Setup wake up GPIO and enter deep sleep
   void startDeepSleep();
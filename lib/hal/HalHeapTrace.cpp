@@ -0,0 +1,227 @@
+#include "HalHeapTrace.h"
+
+#ifdef HEAP_TRACE
+
+#include <Arduino.h>
+
+#include <cstdlib>
+#include <cstring>
+
+#include "HalStorage.h"
+#include "Logging.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+
+using HalHeapTrace::Event;
+using HalHeapTrace::Mark;
+
+namespace {
+constexpr uint32_t DUMP_MAGIC = 0x31525448;  // "HTR1"
+constexpr uint16_t DUMP_VERSION = 1;
+
+struct DumpHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint8_t eventSize;
+  uint8_t markSize;
+  uint32_t eventCount;
+  uint32_t firstSeq;  // Sequence number of the oldest event in the dump
+  uint32_t markCount;
+  uint32_t dropped;  // Events lost while earlier dumps were being written
+};
+static_assert(sizeof(DumpHeader) == 24, "DumpHeader is part of the dump format");
+
+Event events[HalHeapTrace::CAPACITY];
+Mark marks[HalHeapTrace::MARK_CAPACITY];
+size_t eventHead = 0;
+size_t eventCount = 0;
+size_t markHead = 0;
+size_t markCount = 0;
+uint32_t recorded = 0;
+uint32_t dropped = 0;
+// Set while a dump is being written, so the rings don't move under it
+bool paused = false;
+// Allocations come from every task; nothing in here may allocate or block
+portMUX_TYPE traceLock = portMUX_INITIALIZER_UNLOCKED;
+
+void record(const HalHeapTrace::Kind kind, const void* caller, const void* ptr, const size_t size) {
+  // Sampled outside the lock: it walks the heap, under the heap's own lock
+  const bool sample = kind == HalHeapTrace::FAILED || size >= HalHeapTrace::SAMPLE_BYTES;
+  const uint32_t largestFree = sample ? heap_caps_get_largest_free_block(MALLOC_CAP_8BIT) : 0;
+  const Event event = {static_cast<uint32_t>(millis()),
+                       static_cast<uint32_t>(reinterpret_cast<uintptr_t>(caller)),
+                       static_cast<uint32_t>(reinterpret_cast<uintptr_t>(ptr)),
+                       static_cast<uint32_t>(size),
+                       largestFree,
+                       kind,
+                       {}};
+
+  portENTER_CRITICAL_SAFE(&traceLock);
+  if (paused) {
+    dropped++;
+  } else {
+    events[eventHead] = event;
+    eventHead = (eventHead + 1) % HalHeapTrace::CAPACITY;
+    if (eventCount < HalHeapTrace::CAPACITY) {
+      eventCount++;
+    }
+    recorded++;
+  }
+  portEXIT_CRITICAL_SAFE(&traceLock);
+}
+
+void recordAlloc(const void* caller, const void* ptr, const size_t size) {
+  if (size > 0 || ptr) {
+    record(ptr ? HalHeapTrace::ALLOC : HalHeapTrace::FAILED, caller, ptr, size);
+  }
+}
+
+void setPaused(const bool pause) {
+  portENTER_CRITICAL_SAFE(&traceLock);
+  paused = pause;
+  portEXIT_CRITICAL_SAFE(&traceLock);
+}
+
+// Oldest first; a ring is at most two contiguous runs
+template <typename T, size_t N>
+void writeRing(Print& out, const T (&ring)[N], const size_t head, const size_t count) {
+  const size_t oldest = (head + N - count) % N;
+  const size_t firstRun = count < N - oldest ? count : N - oldest;
+  out.write(reinterpret_cast<const uint8_t*>(&ring[oldest]), firstRun * sizeof(T));
+  out.write(reinterpret_cast<const uint8_t*>(&ring[0]), (count - firstRun) * sizeof(T));
+}
+
+size_t dumpSize() { return sizeof(DumpHeader) + eventCount * sizeof(Event) + markCount * sizeof(Mark); }
+
+// Caller has paused recording
+void writeDump(Print& out) {
+  const DumpHeader header = {DUMP_MAGIC,
+                             DUMP_VERSION,
+                             sizeof(Event),
+                             sizeof(Mark),
+                             static_cast<uint32_t>(eventCount),
+                             recorded - static_cast<uint32_t>(eventCount),
+                             static_cast<uint32_t>(markCount),
+                             dropped};
+  out.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+  writeRing(out, events, eventHead, eventCount);
+  writeRing(out, marks, markHead, markCount);
+}
+}  // namespace
+
+extern "C" {
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+void __real_free(void* ptr);
+
+void* __wrap_malloc(const size_t size) {
+  void* ptr = __real_malloc(size);
+  recordAlloc(__builtin_return_address(0), ptr, size);
+  return ptr;
+}
+
+void* __wrap_calloc(const size_t count, const size_t size) {
+  void* ptr = __real_calloc(count, size);
+  recordAlloc(__builtin_return_address(0), ptr, count * size);
+  return ptr;
+}
+
+// Recorded as a free of the old block and an allocation of the new one
+void* __wrap_realloc(void* ptr, const size_t size) {
+  const size_t oldSize = ptr ? heap_caps_get_allocated_size(ptr) : 0;
+  void* moved = __real_realloc(ptr, size);
+  const void* caller = __builtin_return_address(0);
+  if (ptr && (moved || size == 0)) {
+    record(HalHeapTrace::FREE, caller, ptr, oldSize);
+  }
+  if (size > 0) {
+    recordAlloc(caller, moved, size);
+  }
+  return moved;
+}
+
+void __wrap_free(void* ptr) {
+  if (!ptr) {
+    return;
+  }
+  const size_t size = heap_caps_get_allocated_size(ptr);
+  __real_free(ptr);
+  record(HalHeapTrace::FREE, __builtin_return_address(0), ptr, size);
+}
+
+// operator new is wrapped too, otherwise every C++ allocation would be attributed to libstdc++. The throwing forms
+// abort on failure, which is what they do in a build without exceptions.
+void* __wrap__Znwj(const size_t size) {
+  void* ptr = __real_malloc(size > 0 ? size : 1);
+  recordAlloc(__builtin_return_address(0), ptr, size);
+  if (!ptr) {
+    abort();
+  }
+  return ptr;
+}
+
+void* __wrap__Znaj(const size_t size) {
+  void* ptr = __real_malloc(size > 0 ? size : 1);
+  recordAlloc(__builtin_return_address(0), ptr, size);
+  if (!ptr) {
+    abort();
+  }
+  return ptr;
+}
+
+void* __wrap__ZnwjRKSt9nothrow_t(const size_t size, const void*) {
+  void* ptr = __real_malloc(size > 0 ? size : 1);
+  recordAlloc(__builtin_return_address(0), ptr, size);
+  return ptr;
+}
+
+void* __wrap__ZnajRKSt9nothrow_t(const size_t size, const void*) {
+  void* ptr = __real_malloc(size > 0 ? size : 1);
+  recordAlloc(__builtin_return_address(0), ptr, size);
+  return ptr;
+}
+
+}  // extern "C"
+
+void HalHeapTrace::mark(const char* label) {
+  Mark entry = {};
+  strncpy(entry.label, label, sizeof(entry.label) - 1);
+  entry.ms = static_cast<uint32_t>(millis());
+
+  portENTER_CRITICAL_SAFE(&traceLock);
+  if (!paused) {
+    entry.seq = recorded;
+    marks[markHead] = entry;
+    markHead = (markHead + 1) % MARK_CAPACITY;
+    if (markCount < MARK_CAPACITY) {
+      markCount++;
+    }
+  }
+  portEXIT_CRITICAL_SAFE(&traceLock);
+}
+
+void HalHeapTrace::dump(Print& out) {
+  setPaused(true);
+  out.printf("HEAP_START:%u\n", static_cast<unsigned>(dumpSize()));
+  writeDump(out);
+  out.printf("HEAP_END\n");
+  setPaused(false);
+}
+
+bool HalHeapTrace::dumpToFile(const char* path) {
+  HalFile file;
+  if (!Storage.openFileForWrite("HTR", path, file)) {
+    LOG_ERR("HTR", "Can't write heap trace to %s", path);
+    return false;
+  }
+  setPaused(true);
+  writeDump(file);
+  setPaused(false);
+  file.close();
+  LOG_INF("HTR", "Heap trace written to %s", path);
+  return true;
+}
+
+#endif
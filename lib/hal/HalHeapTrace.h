@@ -0,0 +1,59 @@
+#pragma once
+
+#include <Print.h>
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Allocation tracer for the heap_trace build env. malloc, calloc, realloc, free and operator new are linked through
+ * wrappers (-Wl,--wrap=...) that record every heap operation into a fixed ring: call site, pointer, size, and for
+ * large or failed requests the largest free block right after. Activity changes and notable failures are recorded as
+ * labelled marks, so a dump shows which activity left the heap too fragmented for the next big allocation (e.g. the
+ * 8KB chunks of GfxRenderer::storeBwBuffer).
+ *
+ * The dump is requested with CMD:HEAP (serial) or CMD:HEAP_SD (/heap_trace.bin) and decoded by
+ * scripts/debugging_monitor.py. In other builds every function is an inline no-op.
+ */
+namespace HalHeapTrace {
+enum Kind : uint8_t { ALLOC, FREE, FAILED };
+
+struct Event {
+  uint32_t ms;
+  uint32_t caller;       // Return address of the allocating or freeing call
+  uint32_t ptr;          // 0 for FAILED
+  uint32_t size;         // Requested size, or the allocated size of a freed block
+  uint32_t largestFree;  // 0 if not sampled for this event
+  uint8_t kind;
+  uint8_t reserved[3];
+};
+static_assert(sizeof(Event) == 24, "Event is part of the dump format");
+
+struct Mark {
+  uint32_t seq;  // Number of events recorded before the mark
+  uint32_t ms;
+  char label[24];
+};
+static_assert(sizeof(Mark) == 32, "Mark is part of the dump format");
+
+constexpr size_t CAPACITY = 768;       // 18KB of static RAM, only in heap_trace builds
+constexpr size_t MARK_CAPACITY = 32;   // 1KB
+constexpr size_t SAMPLE_BYTES = 1024;  // Smaller operations don't get a largest-free-block sample
+
+#ifdef HEAP_TRACE
+constexpr bool enabled = true;
+
+// Records a labelled point in the trace (truncated to 23 characters)
+void mark(const char* label);
+// Writes HEAP_START:<size>, the binary dump (header, events oldest first, marks oldest first) and HEAP_END
+void dump(Print& out);
+// Writes the binary dump alone to a file on the SD card
+bool dumpToFile(const char* path);
+#else
+constexpr bool enabled = false;
+
+inline void mark(const char*) {}
+inline void dump(Print&) {}
+inline bool dumpToFile(const char*) { return false; }
+#endif
+}  // namespace HalHeapTrace
@@ -0,0 +1,22 @@
+#pragma once
+
+/**
+ * HOT_IRAM places a function in IRAM in the iram_hot build env (platformio.ini). Code otherwise runs from flash through
+ * the instruction cache, whose misses stall on the same flash reads that fetch font bitmaps from the builtin fonts, so
+ * the render path's innermost kernels are the ones marked: the glyph blitter, drawPixel(), uzlib's symbol decoding,
+ * UTF-8 decoding and the hyphenation trie walk.
+ *
+ * IRAM is carved out of the same SRAM as the heap, so every marked function costs heap in that env. Keep the list to
+ * kernels that show up in the BW_RENDER and GRAY_RENDER phases of CMD:PERF, and compare a dump from the default env
+ * against one from iram_hot before adding to it. uzlib, built without the HAL, has its own UZLIB_CONF_HOT for the same.
+ */
+#ifndef HOT_CODE_IN_IRAM
+#define HOT_CODE_IN_IRAM 0
+#endif
+
+#if HOT_CODE_IN_IRAM && defined(ESP_PLATFORM)
+#include <esp_attr.h>
+#define HOT_IRAM IRAM_ATTR
+#else
+#define HOT_IRAM
+#endif
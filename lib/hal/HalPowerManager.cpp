@@ -21,6 +21,7 @@ void HalPowerManager::begin() {
     pinMode(BAT_GPIO0, INPUT);
   }
   normalFreq = getCpuFrequencyMhz();
+  residencySinceMs = millis();
   modeMutex = xSemaphoreCreateMutex();
   assert(modeMutex != nullptr);
 }
@@ -36,28 +37,44 @@ void HalPowerManager::setPowerSaving(bool enabled) {
     enabled = false;
   }
 
-  // Note: We don't use mutex here to avoid too much overhead,
-  // it's not very important if we read a slightly stale value for currentLockMode
-  const LockMode mode = currentLockMode;
+  xSemaphoreTake(modeMutex, portMAX_DELAY);
+  powerSavingRequested = enabled;
+  applyFrequency();
+  xSemaphoreGive(modeMutex);
+}
 
-  if (mode == None && enabled && !isLowPower) {
-    LOG_DBG("PWR", "Going to low-power mode");
-    if (!setCpuFrequencyMhz(LOW_POWER_FREQ)) {
-      LOG_DBG("PWR", "Failed to set CPU frequency = %d MHz", LOW_POWER_FREQ);
-      return;
-    }
-    isLowPower = true;
+void HalPowerManager::applyFrequency() {
+  const bool lowPower = powerSavingRequested && lockCount == 0;
+  if (lowPower == isLowPower) {
+    return;
+  }
 
-  } else if ((!enabled || mode != None) && isLowPower) {
+  const int freq = lowPower ? LOW_POWER_FREQ : normalFreq;
+  if (lowPower) {
+    LOG_DBG("PWR", "Going to low-power mode");
+  } else {
     LOG_DBG("PWR", "Restoring normal CPU frequency");
-    if (!setCpuFrequencyMhz(normalFreq)) {
-      LOG_DBG("PWR", "Failed to set CPU frequency = %d MHz", normalFreq);
-      return;
-    }
-    isLowPower = false;
   }
+  if (!setCpuFrequencyMhz(freq)) {
+    LOG_DBG("PWR", "Failed to set CPU frequency = %d MHz", freq);
+    return;
+  }
+  const unsigned long now = millis();
+  (isLowPower ? lowPowerMs : normalFreqMs) += now - residencySinceMs;
+  residencySinceMs = now;
+  isLowPower = lowPower;
+}
 
-  // Otherwise, no change needed
+HalPowerManager::Residency HalPowerManager::getResidency() const {
+  xSemaphoreTake(modeMutex, portMAX_DELAY);
+  const unsigned long now = millis();
+  Residency residency = {normalFreq, normalFreqMs, lowPowerMs, boostedMs};
+  (isLowPower ? residency.lowPowerMs : residency.normalMs) += now - residencySinceMs;
+  if (lockCount > 0) {
+    residency.boostedMs += now - boostedSinceMs;
+  }
+  xSemaphoreGive(modeMutex);
+  return residency;
 }
 
 void HalPowerManager::startDeepSleep(HalGPIO& gpio) const {
@@ -81,6 +98,7 @@ void HalPowerManager::startDeepSleep(HalGPIO& gpio) const {
   // power button is hard-wired to briefly provide power to the MCU, waking it up regardless of the wakeup source
   // configuration
   esp_deep_sleep_enable_gpio_wakeup(1ULL << InputManager::POWER_BUTTON_PIN, ESP_GPIO_WAKEUP_GPIO_LOW);
+  logFlush();
   // Enter Deep Sleep
   esp_deep_sleep_start();
 }
@@ -125,25 +143,25 @@ uint16_t HalPowerManager::getBatteryPercentage() const {
 
 HalPowerManager::Lock::Lock() {
   xSemaphoreTake(powerManager.modeMutex, portMAX_DELAY);
-  // Current limitation: only one lock at a time
-  if (powerManager.currentLockMode != None) {
-    LOG_ERR("PWR", "Lock already held, ignore");
-    valid = false;
+  if (powerManager.lockCount == UINT8_MAX) {
+    LOG_ERR("PWR", "Too many locks held, ignore");
   } else {
-    powerManager.currentLockMode = NormalSpeed;
+    if (powerManager.lockCount++ == 0) {
+      powerManager.boostedSinceMs = millis();
+    }
     valid = true;
-  }
-  xSemaphoreGive(powerManager.modeMutex);
-  if (valid) {
     // Immediately restore normal CPU frequency if currently in low-power mode
-    powerManager.setPowerSaving(false);
+    powerManager.applyFrequency();
   }
+  xSemaphoreGive(powerManager.modeMutex);
 }
 
 HalPowerManager::Lock::~Lock() {
   xSemaphoreTake(powerManager.modeMutex, portMAX_DELAY);
-  if (valid) {
-    powerManager.currentLockMode = None;
+  if (valid && --powerManager.lockCount == 0) {
+    powerManager.boostedMs += millis() - powerManager.boostedSinceMs;
+    // Drop back now rather than at the next main loop iteration
+    powerManager.applyFrequency();
   }
   xSemaphoreGive(powerManager.modeMutex);
 }
@@ -17,15 +17,25 @@ extern HalPowerManager powerManager;  // Singleton
 class HalPowerManager {
   int normalFreq = 0;  // MHz
   bool isLowPower = false;
+  bool powerSavingRequested = false;  // Last setPowerSaving() request, applied once no lock is held
 
   // I2C fuel gauge configuration for X3 battery monitoring
   bool _batteryUseI2C = false;                   // True if using I2C fuel gauge (X3), false for ADC (X4)
   mutable int _batteryCachedPercent = 0;         // Last read battery percentage (0-100)
   mutable unsigned long _batteryLastPollMs = 0;  // Timestamp of last battery read in milliseconds
 
-  enum LockMode { None, NormalSpeed };
-  LockMode currentLockMode = None;
-  SemaphoreHandle_t modeMutex = nullptr;  // Protect access to currentLockMode
+  uint8_t lockCount = 0;                  // Held Lock instances; the CPU stays at normal frequency while nonzero
+  SemaphoreHandle_t modeMutex = nullptr;  // Protects lockCount and frequency changes
+
+  // Time spent at each frequency, for energy tuning; accumulated on every change
+  unsigned long residencySinceMs = 0;
+  unsigned long boostedSinceMs = 0;
+  uint32_t normalFreqMs = 0;
+  uint32_t lowPowerMs = 0;
+  uint32_t boostedMs = 0;
+
+  // Switch to the frequency the current request and locks call for; modeMutex must be held
+  void applyFrequency();
 
  public:
   static constexpr int LOW_POWER_FREQ = 10;                    // MHz
@@ -34,19 +44,29 @@ class HalPowerManager {
 
   void begin();
 
-  // Control CPU frequency for power saving
+  // Control CPU frequency for power saving. While a Lock is held the request is remembered and applied when the last
+  // Lock is released.
   void setPowerSaving(bool enabled);
 
+  struct Residency {
+    int normalMhz;
+    uint32_t normalMs;    // At normalMhz, boosted or not
+    uint32_t lowPowerMs;  // At LOW_POWER_FREQ
+    uint32_t boostedMs;   // While at least one Lock was held
+  };
+  // Time spent at each CPU frequency since begin()
+  Residency getResidency() const;
+
   // Setup wake up GPIO and enter deep sleep
-  // Should be called inside main loop() to handle the currentLockMode
   void startDeepSleep(HalGPIO& gpio) const;
 
   // Get battery percentage (range 0-100)
   uint16_t getBatteryPercentage() const;
 
-  // RAII helper class to manage power saving locks
-  // Usage: create an instance of Lock in a scope to disable power saving, for example when running a task that needs
-  // full performance. When the Lock instance is destroyed (goes out of scope), power saving will be re-enabled.
+  // RAII boost lease for compute-heavy work (rendering, layout, image decoding, inflating)
+  // Usage: create an instance of Lock in a scope to run it at normal CPU frequency. Any number of Locks can be held at
+  // once, from any task. When the last one is destroyed the CPU drops back to low power right away if power saving was
+  // requested meanwhile, so a background job should release its Lock whenever it yields.
   class Lock {
     friend class HalPowerManager;
     bool valid = false;
@@ -5,12 +5,28 @@
 #include <Logging.h>
 #include <SDCardManager.h>
 
+#include <algorithm>
 #include <cassert>
+#include <cstdio>
 
 #define SDCard SDCardManager::getInstance()
 
 HalStorage HalStorage::instance;
 
+// Generations of discarded directories, each named by a number, waiting to be deleted by removeTrash()
+constexpr char TRASH_DIR[] = "/.crosspoint/.trash";
+
+// The card's measured profile: a version byte followed by the CardProfile
+constexpr char PROFILE_FILE[] = "/.crosspoint/sdprofile.bin";
+constexpr uint8_t PROFILE_FILE_VERSION = 1;
+constexpr char PROFILE_TEST_FILE[] = "/.crosspoint/sdprofile.tmp";
+constexpr size_t PROFILE_TEST_SIZE = 64 * 1024;
+constexpr size_t PROFILE_BLOCK_SIZE = 4096;
+constexpr size_t PROFILE_SECTOR_SIZE = 512;
+constexpr int PROFILE_RANDOM_READS = 16;
+// Per-command latency allowed per transfer: 1 / PROFILE_LATENCY_SHARE of it
+constexpr uint32_t PROFILE_LATENCY_SHARE = 5;
+
 HalStorage::HalStorage() {
   storageMutex = xSemaphoreCreateMutex();
   assert(storageMutex != nullptr);
@@ -18,18 +34,41 @@ HalStorage::HalStorage() {
 
 // begin() and ready() are only called from setup, no need to acquire mutex for them
 
-bool HalStorage::begin() { return SDCard.begin(); }
+bool HalStorage::begin() {
+  if (!SDCard.begin()) {
+    return false;
+  }
+  // Left over from before the last reboot
+  trashPending = SDCard.exists(TRASH_DIR);
+  return true;
+}
 
 bool HalStorage::ready() const { return SDCard.ready(); }
 
 // For the rest of the methods, we acquire the mutex to ensure thread safety
 
 class HalStorage::StorageLock {
+  uint32_t startUs;
+
  public:
-  StorageLock() { xSemaphoreTake(HalStorage::getInstance().storageMutex, portMAX_DELAY); }
-  ~StorageLock() { xSemaphoreGive(HalStorage::getInstance().storageMutex); }
+  StorageLock() {
+    xSemaphoreTake(HalStorage::getInstance().storageMutex, portMAX_DELAY);
+    startUs = micros();
+  }
+  ~StorageLock() {
+    HalStorage& storage = HalStorage::getInstance();
+    storage.busyRemainderUs += micros() - startUs;
+    storage.busyMs = storage.busyMs + storage.busyRemainderUs / 1000;
+    storage.busyRemainderUs %= 1000;
+    xSemaphoreGive(storage.storageMutex);
+  }
 };
 
+// Longest transfer done under one hold of the lock. Workers run at idle priority and read or write on the card while
+// the render task may need it for a page; a released mutex goes to the highest priority task waiting for it, so
+// splitting large transfers bounds how long a page read can wait behind background work.
+constexpr size_t LOCKED_TRANSFER_SIZE = 4096;
+
 #define HAL_STORAGE_WRAPPED_CALL(method, ...) \
   HalStorage::StorageLock lock;               \
   return SDCard.method(__VA_ARGS__);
@@ -120,6 +159,176 @@ bool HalStorage::openFileForWrite(const char* moduleName, const String& path, Ha
 
 bool HalStorage::removeDir(const char* path) { HAL_STORAGE_WRAPPED_CALL(removeDir, path); }
 
+bool HalStorage::discardDir(const char* path) {
+  {
+    StorageLock lock;
+    SDCard.mkdir(TRASH_DIR, true);
+    char target[sizeof(TRASH_DIR) + 12];
+    do {
+      snprintf(target, sizeof(target), "%s/%lu", TRASH_DIR, static_cast<unsigned long>(trashGeneration++));
+    } while (SDCard.exists(target));
+    if (SDCard.rename(path, target)) {
+      trashPending = true;
+      return true;
+    }
+  }
+  LOG_ERR("SD", "Failed to move %s to the trash, removing it", path);
+  return removeDir(path);
+}
+
+bool HalStorage::removeTrash(int maxEntries) {
+  // Walks down to the first directory without subdirectories, deletes its files and then the directory, and starts
+  // over from the top; the trash is only ever a few levels deep
+  std::string dir = TRASH_DIR;
+  char name[128];
+  while (maxEntries > 0) {
+    auto current = open(dir.c_str());
+    if (!current || !current.isDirectory()) {
+      trashPending = false;
+      return true;
+    }
+    std::string subdir;
+    bool empty = true;
+    for (auto file = current.openNextFile(); file; file = current.openNextFile()) {
+      file.getName(name, sizeof(name));
+      if (file.isDirectory()) {
+        subdir = name;
+        break;
+      }
+      file.close();
+      if (maxEntries == 0) {
+        empty = false;
+        break;
+      }
+      remove((dir + "/" + name).c_str());
+      maxEntries--;
+    }
+    current.close();
+    if (!subdir.empty()) {
+      dir += "/" + subdir;
+      continue;
+    }
+    if (!empty) {
+      break;
+    }
+    if (!rmdir(dir.c_str())) {
+      // Leaves the rest for the next boot rather than retrying it forever
+      LOG_ERR("SD", "Failed to remove %s from the trash", dir.c_str());
+      trashPending = false;
+      return true;
+    }
+    maxEntries--;
+    if (dir == TRASH_DIR) {
+      trashPending = false;
+      return true;
+    }
+    dir = TRASH_DIR;
+  }
+  return false;
+}
+
+void HalStorage::tune() {
+  if (!loadProfile()) {
+    const unsigned long start = millis();
+    if (!measureProfile()) {
+      LOG_ERR("SD", "Failed to measure the card, using %u byte chunks", static_cast<unsigned>(chunkSize));
+      return;
+    }
+    LOG_INF("SD", "Measured the card in %lums", millis() - start);
+    saveProfile();
+  }
+
+  // Transfer time of a chunk at the read rate is chunk * 1000 / readKBps microseconds
+  const uint64_t wanted = static_cast<uint64_t>(profile.randomReadUs) * PROFILE_LATENCY_SHARE * profile.readKBps / 1000;
+  chunkSize = MIN_CHUNK_SIZE;
+  while (chunkSize < MAX_CHUNK_SIZE && chunkSize < wanted) {
+    chunkSize *= 2;
+  }
+  LOG_INF("SD", "Card writes %luKB/s, reads %luKB/s, %luus per scattered read: %u byte chunks",
+          static_cast<unsigned long>(profile.writeKBps), static_cast<unsigned long>(profile.readKBps),
+          static_cast<unsigned long>(profile.randomReadUs), static_cast<unsigned>(chunkSize));
+}
+
+bool HalStorage::loadProfile() {
+  auto file = open(PROFILE_FILE);
+  if (!file) {
+    return false;
+  }
+  uint8_t version = 0;
+  CardProfile loaded;
+  const bool ok = file.read(&version, 1) == 1 && version == PROFILE_FILE_VERSION &&
+                  file.read(&loaded, sizeof(loaded)) == sizeof(loaded) && loaded.readKBps > 0;
+  file.close();
+  if (ok) {
+    profile = loaded;
+  }
+  return ok;
+}
+
+bool HalStorage::measureProfile() {
+  auto* buffer = static_cast<uint8_t*>(malloc(PROFILE_BLOCK_SIZE));
+  if (!buffer) {
+    return false;
+  }
+  for (size_t i = 0; i < PROFILE_BLOCK_SIZE; i++) {
+    buffer[i] = static_cast<uint8_t>(i * 31 + 7);
+  }
+
+  mkdir("/.crosspoint");
+  auto file = open(PROFILE_TEST_FILE, O_RDWR | O_CREAT | O_TRUNC);
+  bool ok = static_cast<bool>(file);
+  uint32_t writeUs = 0;
+  uint32_t readUs = 0;
+  uint32_t randomUs = 0;
+  if (ok) {
+    uint32_t start = micros();
+    for (size_t done = 0; ok && done < PROFILE_TEST_SIZE; done += PROFILE_BLOCK_SIZE) {
+      ok = file.write(buffer, PROFILE_BLOCK_SIZE) == PROFILE_BLOCK_SIZE;
+    }
+    file.flush();
+    writeUs = micros() - start;
+
+    start = micros();
+    ok = ok && file.seek(0);
+    for (size_t done = 0; ok && done < PROFILE_TEST_SIZE; done += PROFILE_BLOCK_SIZE) {
+      ok = file.read(buffer, PROFILE_BLOCK_SIZE) == static_cast<int>(PROFILE_BLOCK_SIZE);
+    }
+    readUs = micros() - start;
+
+    // Strided so no read lands in the sector the previous one left cached
+    constexpr size_t sectors = PROFILE_TEST_SIZE / PROFILE_SECTOR_SIZE;
+    start = micros();
+    for (int i = 0; ok && i < PROFILE_RANDOM_READS; i++) {
+      ok = file.seek((i * 37 + 11) % sectors * PROFILE_SECTOR_SIZE) &&
+           file.read(buffer, PROFILE_SECTOR_SIZE) == static_cast<int>(PROFILE_SECTOR_SIZE);
+    }
+    randomUs = micros() - start;
+    file.close();
+  }
+  remove(PROFILE_TEST_FILE);
+  free(buffer);
+  if (!ok) {
+    return false;
+  }
+
+  // Bytes per microsecond times 1000 is close enough to KB/s
+  constexpr uint64_t scaledSize = static_cast<uint64_t>(PROFILE_TEST_SIZE) * 1000;
+  profile.writeKBps = static_cast<uint32_t>(scaledSize / std::max<uint32_t>(writeUs, 1));
+  profile.readKBps = static_cast<uint32_t>(scaledSize / std::max<uint32_t>(readUs, 1));
+  profile.randomReadUs = randomUs / PROFILE_RANDOM_READS;
+  return profile.readKBps > 0;
+}
+
+void HalStorage::saveProfile() {
+  auto file = open(PROFILE_FILE, O_WRONLY | O_CREAT | O_TRUNC);
+  if (!file) {
+    return;
+  }
+  file.write(PROFILE_FILE_VERSION);
+  file.write(&profile, sizeof(profile));
+  file.close();
+}
+
 // HalFile implementation
 // Allow doing file operations while ensuring thread safety via HalStorage's mutex.
 // Please keep the list below in sync with the HalFile.h header
@@ -142,12 +351,54 @@ bool HalFile::seekCur(int64_t offset) { HAL_FILE_WRAPPED_CALL(seekCur, offset);
 bool HalFile::seekSet(size_t offset) { HAL_FILE_WRAPPED_CALL(seekSet, offset); }
 int HalFile::available() const { HAL_FILE_WRAPPED_CALL(available, ); }
 size_t HalFile::position() const { HAL_FILE_WRAPPED_CALL(position, ); }
-int HalFile::read(void* buf, size_t count) { HAL_FILE_WRAPPED_CALL(read, buf, count); }
+int HalFile::read(void* buf, size_t count) {
+  assert(impl != nullptr);
+  auto* bytes = static_cast<uint8_t*>(buf);
+  size_t done = 0;
+  do {
+    const size_t chunk = std::min(count - done, LOCKED_TRANSFER_SIZE);
+    int bytesRead;
+    {
+      HalStorage::StorageLock lock;
+      bytesRead = impl->file.read(bytes + done, chunk);
+    }
+    if (bytesRead < 0) {
+      return done > 0 ? static_cast<int>(done) : bytesRead;
+    }
+    done += bytesRead;
+    if (static_cast<size_t>(bytesRead) < chunk) {
+      break;
+    }
+  } while (done < count);
+  return static_cast<int>(done);
+}
 int HalFile::read() { HAL_FILE_WRAPPED_CALL(read, ); }
-size_t HalFile::write(const void* buf, size_t count) { HAL_FILE_WRAPPED_CALL(write, buf, count); }
+size_t HalFile::write(const void* buf, size_t count) {
+  assert(impl != nullptr);
+  const auto* bytes = static_cast<const uint8_t*>(buf);
+  size_t done = 0;
+  while (done < count) {
+    const size_t chunk = std::min(count - done, LOCKED_TRANSFER_SIZE);
+    size_t written;
+    {
+      HalStorage::StorageLock lock;
+      written = impl->file.write(bytes + done, chunk);
+    }
+    done += written;
+    if (written < chunk) {
+      break;
+    }
+  }
+  return done;
+}
 size_t HalFile::write(uint8_t b) { HAL_FILE_WRAPPED_CALL(write, b); }
 bool HalFile::rename(const char* newPath) { HAL_FILE_WRAPPED_CALL(rename, newPath); }
+bool HalFile::preAllocate(size_t length) { HAL_FILE_WRAPPED_CALL(preAllocate, length); }
+bool HalFile::truncate() { HAL_FILE_WRAPPED_CALL(truncate, ); }
 bool HalFile::isDirectory() const { HAL_FILE_FORWARD_CALL(isDirectory, ); }  // already thread-safe, no need to wrap
+bool HalFile::getModifyDateTime(uint16_t* date, uint16_t* time) {
+  HAL_FILE_WRAPPED_CALL(getModifyDateTime, date, time);
+}
 void HalFile::rewindDirectory() { HAL_FILE_WRAPPED_CALL(rewindDirectory, ); }
 bool HalFile::close() { HAL_FILE_WRAPPED_CALL(close, ); }
 HalFile HalFile::openNextFile() {
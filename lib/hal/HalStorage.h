@@ -44,6 +44,36 @@ class HalStorage {
   bool openFileForWrite(const char* moduleName, const std::string& path, HalFile& file);
   bool openFileForWrite(const char* moduleName, const String& path, HalFile& file);
   bool removeDir(const char* path);
+  // Moves the directory at path into the trash with a single rename, so it is gone at once however many files it
+  // holds; removeTrash() deletes them later. Falls back to removeDir() when the move fails.
+  bool discardDir(const char* path);
+  // Deletes up to maxEntries files and directories from the trash, taking the lock for each one. Returns true once
+  // the trash is empty.
+  bool removeTrash(int maxEntries);
+  bool hasTrash() const { return trashPending; }
+
+  // Time the card has been in use since boot: how long the lock around card operations was held
+  uint32_t getBusyMs() const { return busyMs; }
+
+  // What the card in the slot was measured at: sequential rates over a 64KB file and the latency of a 512-byte read
+  // at a scattered offset, which is mostly the card's per-command cost
+  struct CardProfile {
+    uint32_t writeKBps = 0;
+    uint32_t readKBps = 0;
+    uint32_t randomReadUs = 0;
+  };
+  static constexpr size_t MIN_CHUNK_SIZE = 1024;
+  static constexpr size_t DEFAULT_CHUNK_SIZE = 4096;
+  // Bulk copies allocate up to two buffers of this size
+  static constexpr size_t MAX_CHUNK_SIZE = 8192;
+
+  // Loads the card's profile, measuring the card first if it hasn't been measured yet. The profile is kept on the card
+  // itself, so only a card that is new to the reader pays for the measurement, once. Called from setup after begin().
+  void tune();
+  const CardProfile& getCardProfile() const { return profile; }
+  // Bytes to move per call when copying in bulk (items out of a book's zip into the cache, extracted images): the
+  // smallest power of two that keeps the card's per-command latency to about a fifth of each transfer
+  size_t getChunkSize() const { return chunkSize; }
 
   static HalStorage& getInstance() { return instance; }
 
@@ -54,6 +84,17 @@ class HalStorage {
 
   bool initialized = false;
   SemaphoreHandle_t storageMutex = nullptr;
+  volatile bool trashPending = false;
+  uint32_t trashGeneration = 0;
+  // Updated under storageMutex
+  volatile uint32_t busyMs = 0;
+  uint32_t busyRemainderUs = 0;
+  CardProfile profile;
+  size_t chunkSize = DEFAULT_CHUNK_SIZE;
+
+  bool loadProfile();
+  bool measureProfile();
+  void saveProfile();
 };
 
 #define Storage HalStorage::getInstance()
@@ -86,7 +127,14 @@ class HalFile : public Print {
   size_t write(const void* buf, size_t count);
   size_t write(uint8_t b) override;
   bool rename(const char* newPath);
+  // Reserves one run of clusters for an empty file, so what is written can be read back in multi-sector transfers.
+  // Fails if the file isn't empty or the card has no free run that long; the file then grows cluster by cluster.
+  bool preAllocate(size_t length);
+  // Cuts the file at the current position, releasing whatever was reserved past it
+  bool truncate();
   bool isDirectory() const;
+  // FAT date and time of the last write; false if the entry has none
+  bool getModifyDateTime(uint16_t* date, uint16_t* time);
   void rewindDirectory();
   bool close();
   HalFile openNextFile();
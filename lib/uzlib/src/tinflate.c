@@ -122,29 +122,43 @@ static void tinf_build_bits_base(unsigned char *bits, unsigned short *base, int
 }
 #endif
 
-/* build the fixed huffman trees */
-static void tinf_build_fixed_trees(TINF_TREE *lt, TINF_TREE *dt)
+/* fill the fast lookup table of a tree from its code lengths */
+static void tinf_build_fast_table(TINF_TREE *t, const unsigned char *lengths, unsigned int num)
 {
-   int i;
+   unsigned short next_code[16];
+   unsigned int i, j, code = 0;
 
-   /* build fixed length tree */
-   for (i = 0; i < 7; ++i) lt->table[i] = 0;
+   memset(t->fast, 0, UZLIB_FAST_TABLE_SIZE * sizeof(*t->fast));
 
-   lt->table[7] = 24;
-   lt->table[8] = 152;
-   lt->table[9] = 112;
+   /* first canonical code of each length (t->table[0] is 0) */
+   for (i = 1; i < 16; ++i)
+   {
+      code = (code + t->table[i - 1]) << 1;
+      next_code[i] = code;
+   }
 
-   for (i = 0; i < 24; ++i) lt->trans[i] = 256 + i;
-   for (i = 0; i < 144; ++i) lt->trans[24 + i] = i;
-   for (i = 0; i < 8; ++i) lt->trans[24 + 144 + i] = 280 + i;
-   for (i = 0; i < 112; ++i) lt->trans[24 + 144 + 8 + i] = 144 + i;
+   for (i = 0; i < num; ++i)
+   {
+      unsigned int len = lengths[i], c, rev = 0;
 
-   /* build fixed distance tree */
-   for (i = 0; i < 5; ++i) dt->table[i] = 0;
+      if (!len) continue;
+      c = next_code[len]++;
+      if (len > UZLIB_CONF_FAST_BITS) continue;
 
-   dt->table[5] = 32;
+      /* codes are packed starting from their most significant bit, so the
+         next input bits hold the code reversed */
+      for (j = 0; j < len; ++j)
+      {
+         rev = (rev << 1) | (c & 1);
+         c >>= 1;
+      }
 
-   for (i = 0; i < 32; ++i) dt->trans[i] = i;
+      /* every entry whose low len bits are the code */
+      for (j = rev; j < UZLIB_FAST_TABLE_SIZE; j += 1u << len)
+      {
+         t->fast[j] = (unsigned short)(i << 4 | len);
+      }
+   }
 }
 
 /* given an array of code lengths, build a tree */
@@ -184,6 +198,26 @@ static void tinf_build_tree(TINF_TREE *t, const unsigned char *lengths, unsigned
    {
       if (lengths[i]) t->trans[offs[lengths[i]]++] = i;
    }
+
+   if (t->fast) tinf_build_fast_table(t, lengths, num);
+}
+
+/* build the fixed huffman trees */
+static void tinf_build_fixed_trees(TINF_TREE *lt, TINF_TREE *dt)
+{
+   unsigned char lengths[288];
+   int i;
+
+   /* fixed length tree */
+   for (i = 0; i < 144; ++i) lengths[i] = 8;
+   for (; i < 256; ++i) lengths[i] = 9;
+   for (; i < 280; ++i) lengths[i] = 7;
+   for (; i < 288; ++i) lengths[i] = 8;
+   tinf_build_tree(lt, lengths, 288);
+
+   /* fixed distance tree */
+   for (i = 0; i < 32; ++i) lengths[i] = 5;
+   tinf_build_tree(dt, lengths, 32);
 }
 
 /* ---------------------- *
@@ -236,6 +270,28 @@ uint32_t tinf_get_be_uint32(TINF_DATA *d)
     return val;
 }
 
+/* top up the bit buffer to num bits from bytes already in the source
+   buffer, without calling the read callback; bits above d->bitcount in
+   d->tag are always zero */
+static void tinf_refill(TINF_DATA *d, unsigned int num)
+{
+   while (d->bitcount < num && d->source < d->source_limit)
+   {
+      d->tag |= (unsigned int)*d->source++ << d->bitcount;
+      d->bitcount += 8;
+   }
+}
+
+/* hand whole bytes read ahead into the bit buffer back to the source
+   buffer, so that byte-level reads continue where the bit stream ends;
+   they were taken by tinf_refill() from the current source buffer */
+static void tinf_unread_bytes(TINF_DATA *d)
+{
+   d->source -= d->bitcount / 8;
+   d->bitcount %= 8;
+   d->tag &= (1u << d->bitcount) - 1;
+}
+
 /* get one bit from source stream */
 static int tinf_getbit(TINF_DATA *d)
 {
@@ -267,6 +323,16 @@ static unsigned int tinf_read_bits(TINF_DATA *d, int num, int base)
       unsigned int limit = 1 << (num);
       unsigned int mask;
 
+      /* all at once when the bit buffer holds them */
+      tinf_refill(d, num);
+      if (d->bitcount >= (unsigned int)num)
+      {
+         val = d->tag & (limit - 1);
+         d->tag >>= num;
+         d->bitcount -= num;
+         return val + base;
+      }
+
       for (mask = 1; mask < limit; mask *= 2)
          if (tinf_getbit(d)) val += mask;
    }
@@ -275,10 +341,27 @@ static unsigned int tinf_read_bits(TINF_DATA *d, int num, int base)
 }
 
 /* given a data stream and a tree, decode a symbol */
-static int tinf_decode_symbol(TINF_DATA *d, TINF_TREE *t)
+static UZLIB_CONF_HOT int tinf_decode_symbol(TINF_DATA *d, TINF_TREE *t)
 {
    int sum = 0, cur = 0, len = 0;
 
+   /* one lookup for codes up to UZLIB_CONF_FAST_BITS long. A short code
+      is found even with fewer bits buffered, since every entry whose low
+      bits are the code holds it. */
+   if (t->fast)
+   {
+      unsigned int entry;
+
+      tinf_refill(d, UZLIB_CONF_FAST_BITS);
+      entry = t->fast[d->tag & (UZLIB_FAST_TABLE_SIZE - 1)];
+      if (entry && (entry & 15) <= d->bitcount)
+      {
+         d->tag >>= entry & 15;
+         d->bitcount -= entry & 15;
+         return entry >> 4;
+      }
+   }
+
    /* get more bits while code value is above sum */
    do {
 
@@ -404,7 +487,7 @@ static int tinf_decode_trees(TINF_DATA *d, TINF_TREE *lt, TINF_TREE *dt)
  * ----------------------------- */
 
 /* given a stream and two trees, inflate next chunk of output (a byte or more) */
-static int tinf_inflate_block_data(TINF_DATA *d, TINF_TREE *lt, TINF_TREE *dt)
+static UZLIB_CONF_HOT int tinf_inflate_block_data(TINF_DATA *d, TINF_TREE *lt, TINF_TREE *dt)
 {
     if (d->curlen == 0) {
         unsigned int offs;
@@ -504,6 +587,11 @@ static int tinf_inflate_uncompressed_block(TINF_DATA *d)
     if (d->curlen == 0) {
         unsigned int length, invlength;
 
+        /* make sure we start next block on a byte boundary */
+        tinf_unread_bytes(d);
+        d->bitcount = 0;
+        d->tag = 0;
+
         /* get length */
         length = uzlib_get_byte(d);
         length += 256 * uzlib_get_byte(d);
@@ -516,9 +604,6 @@ static int tinf_inflate_uncompressed_block(TINF_DATA *d)
         /* increment length to properly return TINF_DONE below, without
            producing data at the same time */
         d->curlen = length + 1;
-
-        /* make sure we start next block on a byte boundary */
-        d->bitcount = 0;
     }
 
     if (--d->curlen == 0) {
@@ -552,6 +637,7 @@ void uzlib_init(void)
 void uzlib_uncompress_init(TINF_DATA *d, void *dict, unsigned int dictLen)
 {
    d->eof = 0;
+   d->tag = 0;
    d->bitcount = 0;
    d->bfinal = 0;
    d->btype = -1;
@@ -561,6 +647,12 @@ void uzlib_uncompress_init(TINF_DATA *d, void *dict, unsigned int dictLen)
    d->curlen = 0;
 }
 
+void uzlib_uncompress_set_fast_tables(TINF_DATA *d, unsigned short *lit, unsigned short *dist)
+{
+   d->ltree.fast = lit;
+   d->dtree.fast = dist;
+}
+
 /* inflate next output bytes from compressed stream */
 int uzlib_uncompress(TINF_DATA *d)
 {
@@ -616,6 +708,11 @@ next_blk:
             goto next_blk;
         }
 
+        if (res == TINF_DONE) {
+            /* leave the source just past the stream, e.g. at its checksum */
+            tinf_unread_bytes(d);
+        }
+
         if (res != TINF_OK) {
             return res;
         }
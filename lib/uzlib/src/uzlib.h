@@ -75,9 +75,14 @@ extern "C" {
 
 /* data structures */
 
+#define UZLIB_FAST_TABLE_SIZE (1 << UZLIB_CONF_FAST_BITS)
+
 typedef struct {
    unsigned short table[16];  /* table of code length counts */
    unsigned short trans[288]; /* code -> symbol translation table */
+   /* Optional, UZLIB_FAST_TABLE_SIZE entries indexed by the next bits of
+      input: symbol << 4 | code length, or 0 for codes too long for it */
+   unsigned short *fast;
 } TINF_TREE;
 
 struct uzlib_uncomp {
@@ -133,6 +138,10 @@ unsigned char TINFCC uzlib_get_byte(TINF_DATA *d);
 
 void TINFCC uzlib_init(void);
 void TINFCC uzlib_uncompress_init(TINF_DATA *d, void *dict, unsigned int dictLen);
+/* Optional, after uzlib_uncompress_init(): lookup tables of
+   UZLIB_FAST_TABLE_SIZE entries each for the length/literal and distance
+   trees. NULL keeps bit-by-bit decoding. */
+void TINFCC uzlib_uncompress_set_fast_tables(TINF_DATA *d, unsigned short *lit, unsigned short *dist);
 int  TINFCC uzlib_uncompress(TINF_DATA *d);
 int  TINFCC uzlib_uncompress_chksum(TINF_DATA *d);
 
@@ -29,4 +29,23 @@
 #define UZLIB_CONF_USE_MEMCPY 0
 #endif
 
+#ifndef UZLIB_CONF_FAST_BITS
+/* Huffman codes up to this many bits long are decoded with one lookup in
+   a table of (1 << UZLIB_CONF_FAST_BITS) entries, when the caller provides
+   the tables with uzlib_uncompress_set_fast_tables(); longer codes, and
+   decoders without tables, are decoded bit by bit. */
+#define UZLIB_CONF_FAST_BITS 9
+#endif
+
+#ifndef UZLIB_CONF_HOT
+/* Attribute of the symbol decoding loop: IRAM in the firmware's iram_hot
+   build env, like HOT_IRAM of lib/hal/HalIram.h. */
+#if defined(HOT_CODE_IN_IRAM) && HOT_CODE_IN_IRAM && defined(ESP_PLATFORM)
+#include <esp_attr.h>
+#define UZLIB_CONF_HOT IRAM_ATTR
+#else
+#define UZLIB_CONF_HOT
+#endif
+#endif
+
 #endif /* UZLIB_CONF_H_INCLUDED */
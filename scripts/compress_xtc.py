@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""
+Compress the pages of an XTC/XTCH book with the RLE page compression CrossPoint can decode.
+
+Each XTG/XTH page payload is replaced by its RLE encoding (page header compression = 1) when that is smaller. The
+page table and the header offsets of anything stored after the pages are updated; everything else is copied as is.
+
+RLE format (see lib/Xtc/Xtc/XtcRle.h), a sequence of runs each starting with a control byte n:
+  n < 0x80:  n + 1 literal bytes follow
+  n >= 0x80: the next byte repeated n - 0x7D times (3 to 130)
+
+Usage:
+    python compress_xtc.py input.xtc [output.xtc]
+    Default output: input file name with a .rle suffix before the extension
+"""
+
+import os
+import struct
+import sys
+
+HEADER_FORMAT = '<IBBHBBBBIQQQQII'  # 56 bytes, see XtcHeader
+PAGE_TABLE_ENTRY_FORMAT = '<QIHH'  # 16 bytes, see PageTableEntry
+PAGE_HEADER_FORMAT = '<IHHBBIQ'  # 22 bytes, see XtgPageHeader
+XTC_MAGICS = (0x00435458, 0x48435458)
+PAGE_COMPRESSION_NONE = 0
+PAGE_COMPRESSION_RLE = 1
+
+MAX_LITERAL = 128
+MIN_REPEAT = 3
+MAX_REPEAT = 130
+
+
+def rle_encode(data):
+    out = bytearray()
+    literal_start = 0
+    i = 0
+    n = len(data)
+
+    def flush_literals(end):
+        start = literal_start
+        while start < end:
+            count = min(MAX_LITERAL, end - start)
+            out.append(count - 1)
+            out.extend(data[start:start + count])
+            start += count
+
+    while i < n:
+        run = 1
+        while i + run < n and run < MAX_REPEAT and data[i + run] == data[i]:
+            run += 1
+        if run >= MIN_REPEAT:
+            flush_literals(i)
+            out.append(run + 0x7D)
+            out.append(data[i])
+            i += run
+            literal_start = i
+        else:
+            i += run
+    flush_literals(n)
+    return bytes(out)
+
+
+def rle_decode(data, size):
+    out = bytearray()
+    i = 0
+    while len(out) < size and i < len(data):
+        control = data[i]
+        i += 1
+        if control < 0x80:
+            out += data[i:i + control + 1]
+            i += control + 1
+        else:
+            out += bytes([data[i]]) * (control - 0x7D)
+            i += 1
+    return bytes(out[:size])
+
+
+def compress(src_path, dst_path):
+    with open(src_path, 'rb') as f:
+        src = f.read()
+
+    header = list(struct.unpack_from(HEADER_FORMAT, src, 0))
+    magic, page_count, page_table_offset = header[0], header[3], header[10]
+    if magic not in XTC_MAGICS:
+        sys.exit(f'{src_path}: not an XTC/XTCH file')
+
+    entries = [list(struct.unpack_from(PAGE_TABLE_ENTRY_FORMAT, src, page_table_offset + 16 * i))
+               for i in range(page_count)]
+    page_headers = [list(struct.unpack_from(PAGE_HEADER_FORMAT, src, entry[0])) for entry in entries]
+    data_start = min(entry[0] for entry in entries)
+    data_end = max(entry[0] + 22 + page_header[5] for entry, page_header in zip(entries, page_headers))
+    if data_start <= page_table_offset < data_end:
+        sys.exit(f'{src_path}: page table is inside the page data')
+
+    pages = bytearray()
+    for entry, page_header in zip(entries, page_headers):
+        offset = entry[0]
+        payload = src[offset + 22:offset + 22 + page_header[5]]
+        # Converters differ on whether the page table size counts the page header
+        counts_header = entry[1] == 22 + len(payload)
+        if page_header[4] == PAGE_COMPRESSION_NONE:
+            encoded = rle_encode(payload)
+            assert rle_decode(encoded, len(payload)) == payload
+            if len(encoded) < len(payload):
+                page_header[4] = PAGE_COMPRESSION_RLE
+                page_header[5] = len(encoded)
+                payload = encoded
+        entry[0] = data_start + len(pages)
+        entry[1] = (22 if counts_header else 0) + len(payload)
+        pages += struct.pack(PAGE_HEADER_FORMAT, *page_header) + payload
+
+    # Sections after the pages move by the size difference
+    delta = len(pages) - (data_end - data_start)
+    for field in (9, 10, 11, 12, 13):  # metadata, page table, data, thumbnail, chapter offsets
+        if header[field] >= data_end:
+            header[field] += delta
+        elif header[field] > data_start:
+            sys.exit(f'{src_path}: header offset {header[field]} is inside the page data')
+    header[11] = data_start
+
+    dst = bytearray(src[:data_start]) + pages + src[data_end:]
+    struct.pack_into(HEADER_FORMAT, dst, 0, *header)
+    table_offset = header[10]
+    for i, entry in enumerate(entries):
+        struct.pack_into(PAGE_TABLE_ENTRY_FORMAT, dst, table_offset + 16 * i, *entry)
+
+    with open(dst_path, 'wb') as f:
+        f.write(dst)
+    print(f'{src_path}: {len(src)} -> {len(dst)} bytes ({100 * len(dst) / len(src):.0f}%)')
+
+
+if __name__ == '__main__':
+    if len(sys.argv) < 2:
+        print(__doc__)
+        sys.exit(1)
+    src_path = sys.argv[1]
+    root, ext = os.path.splitext(src_path)
+    compress(src_path, sys.argv[2] if len(sys.argv) > 2 else f'{root}.rle{ext}')
@@ -25,13 +25,19 @@ def load_image(path, width, height):
         background = Image.new('RGBA', img.size, (255, 255, 255, 255))
         background.paste(img, mask=img.split()[3])
         img = background
-    # Rotate 90 degrees counterclockwise
-    img = img.rotate(90, expand=True)
     return img
 
-def image_to_c_array(img, array_name):
+# The icon as the panel sees it in each GfxRenderer::Orientation, in the order of that enum: GfxRenderer::drawIcon()
+# copies the rows of the variant for the current orientation straight into the frame buffer
+ORIENTATIONS = [
+    ('Portrait', Image.ROTATE_90),
+    ('LandscapeClockwise', Image.ROTATE_180),
+    ('PortraitInverted', Image.ROTATE_270),
+    ('LandscapeCounterClockwise', None),
+]
+
+def pack_rows(img):
     # Convert to grayscale, then threshold to get white=1, black=0
-    # Convert to grayscale
     img = img.convert('L')
     width, height = img.size
     pixels = list(img.getdata())
@@ -45,16 +51,28 @@ def image_to_c_array(img, array_name):
                     # 1 for white, 0 for black
                     bit = 1 if v >= threshold else 0
                     byte |= (bit << (7 - b))
+            # Rows are whole bytes, the bits past the edge white
+            if x + 8 > width:
+                byte |= 0xFF >> (width - x)
             packed.append(byte)
-    # Format as C array
-    c = f'#pragma once\n#include <cstdint>\n\n'
+    return packed
+
+def image_to_c_array(img, array_name):
+    width, height = img.size
+    c = f'#pragma once\n#include <GfxRenderer.h>\n\n#include <cstdint>\n\n'
     c += f'// size: {width}x{height}\n'
-    c += f'static const uint8_t {array_name}[] = {{\n    '
-    for i, v in enumerate(packed):
-        c += f'0x{v:02X}, '
-        if (i + 1) % 16 == 0:
-            c += '\n    '
-    c = c.rstrip(', \n') + '\n};\n'
+    names = []
+    for orientation, transpose in ORIENTATIONS:
+        name = f'{array_name}{orientation}'
+        names.append(name)
+        packed = pack_rows(img.transpose(transpose) if transpose is not None else img)
+        c += f'static const uint8_t {name}[] = {{\n    '
+        for i, v in enumerate(packed):
+            c += f'0x{v:02X}, '
+            if (i + 1) % 16 == 0:
+                c += '\n    '
+        c = c.rstrip(', \n') + '\n};\n'
+    c += f'static const GfxRenderer::Icon {array_name} = {{{{{", ".join(names)}}}}};\n'
     return c
 
 def main():
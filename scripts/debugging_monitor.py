@@ -11,6 +11,10 @@ Features:
 - Interactive memory usage graphing with matplotlib
 - Command input interface for sending commands to the ESP32 device
 - Screenshot capture and processing (1-bit black/white format)
+- Render profiler dump (CMD:PERF) with per-phase timing histograms, followed by the stack and heap low-water
+  marks per activity and per task
+- Renderer benchmark (CMD:RENDERBENCH): timing of the drawing primitives and golden-frame checks
+- Heap trace dump (CMD:HEAP, heap_trace builds) with failed allocations and fragmentation per activity
 - Graceful shutdown handling with Ctrl-C signal processing
 - Configurable filtering and suppression of log messages
 - Thread-safe operation with coordinated shutdown events
@@ -30,6 +34,8 @@ import glob
 import platform
 import re
 import signal
+import struct
+import subprocess
 import sys
 import threading
 from collections import deque
@@ -161,6 +167,174 @@ def signal_handler(signum, frame):
     plt.close("all")
 
 
+# Same order as PerfProfiler::Phase in src/util/PerfProfiler.h
+PERF_PHASES = [
+    "section_load",
+    "page_load",
+    "scan",
+    "prewarm",
+    "bw_render",
+    "display",
+    "bw_store",
+    "gray_render",
+    "gray_display",
+    "bw_restore",
+    "input_latency",
+]
+PERF_MAGIC = 0x31465250  # "PRF1"
+PERF_HEADER = struct.Struct("<IHBBI")
+PERF_SAMPLE = struct.Struct("<HBBI")
+
+
+def print_perf_report(data: bytes) -> None:
+    """
+    Decodes a PerfProfiler dump and prints per-phase statistics and a coarse histogram
+    of the per-frame times across the recorded session.
+    """
+    if len(data) < PERF_HEADER.size:
+        print(f"{Fore.RED}Perf dump too short{Style.RESET_ALL}")
+        return
+    magic, version, sample_size, _, count = PERF_HEADER.unpack_from(data)
+    if magic != PERF_MAGIC or version != 1 or sample_size != PERF_SAMPLE.size:
+        print(f"{Fore.RED}Unsupported perf dump (version {version}){Style.RESET_ALL}")
+        return
+
+    # Sum samples per (frame, phase) so split phases count once per frame
+    per_frame: dict[tuple[int, int], int] = {}
+    for i in range(count):
+        offset = PERF_HEADER.size + i * PERF_SAMPLE.size
+        if offset + PERF_SAMPLE.size > len(data):
+            break
+        frame_id, phase, _, duration_us = PERF_SAMPLE.unpack_from(data, offset)
+        per_frame[(frame_id, phase)] = per_frame.get((frame_id, phase), 0) + duration_us
+
+    frames = len({frame_id for frame_id, _ in per_frame})
+    print(f"{Fore.GREEN}Perf dump: {count} samples over {frames} frames{Style.RESET_ALL}")
+    buckets_ms = [10, 25, 50, 100, 250, 500, 1000]
+    print(f"{'phase':<14}{'n':>5}{'min':>8}{'med':>8}{'p90':>8}{'max':>8}  histogram (ms)")
+    for phase, name in enumerate(PERF_PHASES):
+        times = sorted(us / 1000 for (_, p), us in per_frame.items() if p == phase)
+        if not times:
+            continue
+        counts = [0] * (len(buckets_ms) + 1)
+        for t in times:
+            counts[next((i for i, b in enumerate(buckets_ms) if t < b), len(buckets_ms))] += 1
+        histogram = " ".join(f"<{b}:{c}" for b, c in zip(buckets_ms, counts) if c)
+        if counts[-1]:
+            histogram += f" >={buckets_ms[-1]}:{counts[-1]}"
+        print(
+            f"{name:<14}{len(times):>5}{times[0]:>8.1f}{times[len(times) // 2]:>8.1f}"
+            f"{times[min(len(times) - 1, (len(times) * 9) // 10)]:>8.1f}{times[-1]:>8.1f}  {histogram}"
+        )
+
+
+# Layout of the HalHeapTrace dump in lib/hal/HalHeapTrace.h
+HEAP_MAGIC = 0x31525448  # "HTR1"
+HEAP_HEADER = struct.Struct("<IHBBIIII")
+HEAP_EVENT = struct.Struct("<IIIIIB3x")
+HEAP_MARK = struct.Struct("<II24s")
+HEAP_KINDS = ["alloc", "free", "FAILED"]
+
+
+def symbolize(addresses: list[int], elf: str | None) -> dict[int, str]:
+    """
+    Maps return addresses to "function at file:line" with addr2line, when an ELF is given.
+    """
+    names = {address: f"0x{address:08x}" for address in addresses}
+    if not elf or not addresses:
+        return names
+    try:
+        result = subprocess.run(
+            ["riscv32-esp-elf-addr2line", "-f", "-C", "-p", "-e", elf]
+            + [f"0x{address:x}" for address in addresses],
+            capture_output=True,
+            text=True,
+            check=True,
+        )
+    except (OSError, subprocess.CalledProcessError) as e:
+        print(f"{Fore.YELLOW}addr2line failed, showing raw addresses: {e}{Style.RESET_ALL}")
+        return names
+    for address, line in zip(addresses, result.stdout.splitlines()):
+        names[address] = f"0x{address:08x} {line.strip()}"
+    return names
+
+
+# pylint: disable=R0914
+def print_heap_report(data: bytes, elf: str | None = None) -> None:
+    """
+    Decodes a HalHeapTrace dump: the lowest largest-free-block seen during each activity, every failed
+    allocation with the activity it happened in, and the call sites holding the most memory at the end.
+    """
+    if len(data) < HEAP_HEADER.size:
+        print(f"{Fore.RED}Heap dump too short{Style.RESET_ALL}")
+        return
+    magic, version, event_size, mark_size, count, first_seq, mark_count, dropped = HEAP_HEADER.unpack_from(data)
+    if magic != HEAP_MAGIC or version != 1 or event_size != HEAP_EVENT.size or mark_size != HEAP_MARK.size:
+        print(f"{Fore.RED}Unsupported heap dump (version {version}){Style.RESET_ALL}")
+        return
+    events = []
+    offset = HEAP_HEADER.size
+    for i in range(count):
+        if offset + HEAP_EVENT.size > len(data):
+            break
+        events.append((first_seq + i,) + HEAP_EVENT.unpack_from(data, offset))
+        offset += HEAP_EVENT.size
+    marks = []
+    for _ in range(mark_count):
+        if offset + HEAP_MARK.size > len(data):
+            break
+        seq, ms, label = HEAP_MARK.unpack_from(data, offset)
+        marks.append((seq, ms, label.split(b"\0", 1)[0].decode("utf-8", errors="replace")))
+        offset += HEAP_MARK.size
+
+    print(
+        f"{Fore.GREEN}Heap dump: {len(events)} events, {len(marks)} marks"
+        f"{f', {dropped} dropped during dumps' if dropped else ''}{Style.RESET_ALL}"
+    )
+
+    def mark_at(seq: int) -> str:
+        label = "(before first mark)"
+        for mark_seq, _, mark_label in marks:
+            if mark_seq > seq:
+                break
+            label = mark_label
+        return label
+
+    failed = [e for e in events if e[6] == 2]
+    live: dict[int, tuple[int, int]] = {}  # ptr -> (caller, size) for blocks allocated within the trace
+    lowest: dict[str, int] = {}
+    for seq, _, caller, ptr, size, largest_free, kind in events:
+        if kind == 0:
+            live[ptr] = (caller, size)
+        elif kind == 1:
+            live.pop(ptr, None)
+        if largest_free:
+            label = mark_at(seq)
+            lowest[label] = min(lowest.get(label, largest_free), largest_free)
+    held: dict[int, list[int]] = {}
+    for caller, size in live.values():
+        entry = held.setdefault(caller, [0, 0])
+        entry[0] += size
+        entry[1] += 1
+    top = sorted(held.items(), key=lambda item: -item[1][0])[:15]
+    names = symbolize(sorted({e[2] for e in failed} | {caller for caller, _ in top}), elf)
+
+    print(f"{'activity or mark':<26}{'lowest largest free':>20}")
+    for _, ms, label in marks:
+        if label in lowest:
+            print(f"{label:<26}{lowest.pop(label):>20}  (from {ms} ms)")
+    for label, value in lowest.items():
+        print(f"{label:<26}{value:>20}")
+    for seq, ms, caller, _, size, largest_free, _ in failed:
+        print(
+            f"{Fore.RED}FAILED {size} bytes at {ms} ms in {mark_at(seq)}, largest free {largest_free}: "
+            f"{names[caller]}{Style.RESET_ALL}"
+        )
+    print("Still allocated at the end of the trace, by call site:")
+    for caller, (size, blocks) in top:
+        print(f"{size:>10} bytes in {blocks:>4} blocks  {names[caller]}")
+
+
 # pylint: disable=R0912
 def get_color_for_line(line: str) -> str:
     """
@@ -222,6 +396,12 @@ def serial_worker(ser, kwargs: dict[str, str]) -> None:
     expecting_screenshot = False
     screenshot_size = 0
     screenshot_data = b""
+    expecting_perf = False
+    perf_size = 0
+    perf_data = b""
+    expecting_heap = False
+    heap_size = 0
+    heap_data = b""
 
     try:
         while not shutdown_event.is_set():
@@ -247,6 +427,30 @@ def serial_worker(ser, kwargs: dict[str, str]) -> None:
                         )
                     expecting_screenshot = False
                     screenshot_data = b""
+            elif expecting_perf:
+                data = ser.read(perf_size - len(perf_data))
+                if not data:
+                    continue
+                perf_data += data
+                if len(perf_data) == perf_size:
+                    with open("perf.bin", "wb") as f:
+                        f.write(perf_data)
+                    print(f"{Fore.GREEN}Perf dump saved to perf.bin{Style.RESET_ALL}")
+                    print_perf_report(perf_data)
+                    expecting_perf = False
+                    perf_data = b""
+            elif expecting_heap:
+                data = ser.read(heap_size - len(heap_data))
+                if not data:
+                    continue
+                heap_data += data
+                if len(heap_data) == heap_size:
+                    with open("heap_trace.bin", "wb") as f:
+                        f.write(heap_data)
+                    print(f"{Fore.GREEN}Heap dump saved to heap_trace.bin{Style.RESET_ALL}")
+                    print_heap_report(heap_data, kwargs.get("elf"))
+                    expecting_heap = False
+                    heap_data = b""
             else:
                 try:
                     raw_data = ser.readline().decode("utf-8", errors="replace")
@@ -264,6 +468,18 @@ def serial_worker(ser, kwargs: dict[str, str]) -> None:
                         continue
                     elif clean_line == "SCREENSHOT_END":
                         continue  # ignore
+                    elif clean_line.startswith("PERF_START:"):
+                        perf_size = int(clean_line.split(":")[1])
+                        expecting_perf = True
+                        continue
+                    elif clean_line == "PERF_END":
+                        continue  # ignore
+                    elif clean_line.startswith("HEAP_START:"):
+                        heap_size = int(clean_line.split(":")[1])
+                        expecting_heap = True
+                        continue
+                    elif clean_line == "HEAP_END":
+                        continue  # ignore
 
                     # Add PC timestamp
                     pc_time = datetime.now().strftime("%H:%M:%S")
@@ -429,7 +645,24 @@ def main() -> None:
         default="",
         help="Suppress lines containing this keyword (case-insensitive)",
     )
+    parser.add_argument(
+        "--elf",
+        type=str,
+        default=None,
+        help="Firmware ELF for resolving heap trace call sites (e.g. .pio/build/heap_trace/firmware.elf)",
+    )
+    parser.add_argument(
+        "--heap-report",
+        type=str,
+        default=None,
+        metavar="FILE",
+        help="Decode a saved heap trace (heap_trace.bin, or /heap_trace.bin from the SD card) and exit",
+    )
     args = parser.parse_args()
+    if args.heap_report:
+        with open(args.heap_report, "rb") as f:
+            print_heap_report(f.read(), args.elf)
+        return
     port = args.port
     if port is None:
         port_list = get_auto_detected_port()
@@ -0,0 +1,56 @@
+"""
+PlatformIO pre-build script: build the font partition image for envs with FONTS_IN_PARTITION.
+
+Bundles the reader fonts those builds leave out of the app image (every builtin reader family but Bookerly 14, see
+src/PartitionReaderFonts.h) into <build dir>/fonts.bin with lib/EpdFont/scripts/build_font_partition.py, and adds it
+to the images `pio run -t upload` flashes, at the offset of the "fonts" partition in partitions.csv.
+
+OTA updates write neither the partition table nor this partition, so a device gets both by being flashed over USB
+once; after that, font updates and app updates are independent.
+"""
+
+Import("env")
+import csv
+import glob
+import os
+import subprocess
+
+# Same families as src/PartitionReaderFonts.cpp
+FAMILIES = ["bookerly_12", "bookerly_16", "bookerly_18", "notosans_12", "notosans_14", "notosans_16", "notosans_18",
+            "opendyslexic_8", "opendyslexic_10", "opendyslexic_12", "opendyslexic_14"]
+
+
+def fonts_partition(project_dir):
+    """(offset, size) of the fonts partition in partitions.csv, or None."""
+    with open(os.path.join(project_dir, "partitions.csv")) as f:
+        rows = csv.reader(line for line in f if line.strip() and not line.lstrip().startswith("#"))
+        for row in rows:
+            fields = [v.strip() for v in row]
+            if fields[0] == "fonts":
+                return int(fields[3], 0), int(fields[4], 0)
+    return None
+
+
+def build_font_partition(env):
+    if "-DFONTS_IN_PARTITION" not in " ".join(env.Flatten(env.get("BUILD_FLAGS", []))):
+        return
+    project_dir = env["PROJECT_DIR"]
+    partition = fonts_partition(project_dir)
+    if partition is None:
+        raise SystemExit("font_partition.py: FONTS_IN_PARTITION is set but partitions.csv has no fonts partition")
+    offset, size = partition
+
+    scripts_dir = os.path.join(project_dir, "lib", "EpdFont", "scripts")
+    headers = sorted(path for family in FAMILIES
+                     for path in glob.glob(os.path.join(project_dir, "lib", "EpdFont", "builtinFonts",
+                                                        family + "_*.h")))
+    output = os.path.join(env.subst("$BUILD_DIR"), "fonts.bin")
+    inputs = headers + glob.glob(os.path.join(scripts_dir, "*.py"))
+    if not os.path.exists(output) or os.path.getmtime(output) < max(os.path.getmtime(p) for p in inputs):
+        os.makedirs(os.path.dirname(output), exist_ok=True)
+        subprocess.check_call([env.subst("$PYTHONEXE"), "build_font_partition.py", output, *headers,
+                               "--max-size", hex(size)], cwd=scripts_dir)
+    env.Append(FLASH_EXTRA_IMAGES=[(hex(offset), output)])
+
+
+build_font_partition(env)
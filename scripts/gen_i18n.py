@@ -17,9 +17,14 @@ automatically filled from English, with a warning.
 
 Usage:
     python gen_i18n.py <translations_dir> <output_dir>
+    python gen_i18n.py --ui-charset <output_file>
 
 Example:
     python gen_i18n.py lib/I18n/translations lib/I18n/
+
+--ui-charset writes every character any translation uses, as UTF-8 text, for
+fontconvert.py --charset to subset the UI fonts to (see
+lib/EpdFont/scripts/convert-builtin-fonts.sh).
 """
 
 import sys
@@ -365,6 +370,14 @@ def compute_character_set(translations: Dict[str, List[str]], lang_index: int) -
     return "".join(chr(cp) for cp in sorted(chars))
 
 
+def compute_ui_character_set(translations: Dict[str, List[str]], language_count: int) -> str:
+    """Return a sorted string of every unique character used in any language."""
+    chars = set()
+    for lang_index in range(language_count):
+        chars.update(compute_character_set(translations, lang_index))
+    return "".join(sorted(chars))
+
+
 # ---------------------------------------------------------------------------
 # Code generators
 # ---------------------------------------------------------------------------
@@ -592,6 +605,13 @@ def main(translations_dir=None, output_dir=None) -> None:
     default_translations_dir = "lib/I18n/translations"
     default_output_dir = "lib/I18n/"
 
+    if translations_dir is None and len(sys.argv) == 3 and sys.argv[1] == "--ui-charset":
+        languages, _, _, translations = load_translations(default_translations_dir)
+        with open(sys.argv[2], "w", encoding="utf-8") as f:
+            f.write(compute_ui_character_set(translations, len(languages)))
+        print(f"Wrote the UI character set to {sys.argv[2]}")
+        return
+
     if translations_dir is None or output_dir is None:
         if len(sys.argv) == 3:
             translations_dir = sys.argv[1]
@@ -1,10 +1,22 @@
 #!/usr/bin/env python3
-"""Embed hypher-generated `.bin` tries into constexpr headers."""
+"""Re-encode hypher-generated `.bin` tries into the compact format and embed them into constexpr headers.
+
+See docs/hyphenation-trie-format.md for both formats.
+"""
 
 from __future__ import annotations
 
 import argparse
 import pathlib
+from collections import Counter
+
+# Target encodings, selected by the top two bits of a target's first byte
+HUB_COUNT = 64
+SHORT_DELTA_BITS = 6
+LONG_DELTA_BITS = 14
+ADDRESS_BITS = 22
+LEVELS_OFFSET_LIMIT = 1 << 12
+LEVELS_LENGTH_LIMIT = 1 << 4
 
 
 def _format_bytes(blob: bytes, per_line: int = 16) -> str:
@@ -31,25 +43,158 @@ def _symbol_from_output(path: pathlib.Path) -> str:
     return name
 
 
-def write_header(path: pathlib.Path, blob: bytes, symbol: str) -> None:
-    # Emit a constexpr header containing the raw bytes plus a SerializedHyphenationPatterns descriptor.
-    # The binary format has:
-    #   - 4 bytes: big-endian root address
-    #   - levels tape: from byte 4 to root_addr
-    #   - nodes data: from root_addr onwards
-    
+def read_hypher(blob: bytes) -> tuple[int, dict[int, tuple[bytes | None, list[tuple[int, int]]]]]:
+    # Decode every node reachable from the root of a hypher blob into {address: (levels, [(letter, target)])}.
+    # The blob starts with the big-endian root address; all addresses, levels offsets included, count from the
+    # start of the blob.
     if len(blob) < 4:
         raise ValueError(f"Blob too small: {len(blob)} bytes")
-    
-    # Parse root address (big-endian uint32)
-    root_addr = (blob[0] << 24) | (blob[1] << 16) | (blob[2] << 8) | blob[3]
-    
-    if root_addr > len(blob):
-        raise ValueError(f"Root address {root_addr} exceeds blob size {len(blob)}")
-    
-    # Remove the 4-byte root address and adjust the offset
-    bytes_literal = _format_bytes(blob[4:])
-    root_addr_new = root_addr - 4
+    root = int.from_bytes(blob[:4], 'big')
+    if root >= len(blob):
+        raise ValueError(f"Root address {root} exceeds blob size {len(blob)}")
+
+    nodes = {}
+    pending = [root]
+    while pending:
+        addr = pending.pop()
+        if addr in nodes:
+            continue
+        pos = addr
+        header = blob[pos]
+        pos += 1
+        stride = (header >> 5) & 0x03 or 1
+        count = header & 0x1F
+        if count == 31:
+            count = blob[pos]
+            pos += 1
+        levels = None
+        if header & 0x80:
+            offset = (blob[pos] << 4) | (blob[pos + 1] >> 4)
+            levels = bytes(blob[offset : offset + (blob[pos + 1] & 0x0F)])
+            pos += 2
+        letters = blob[pos : pos + count]
+        pos += count
+        children = []
+        for i, letter in enumerate(letters):
+            raw = blob[pos + i * stride : pos + (i + 1) * stride]
+            if stride == 3:
+                delta = int.from_bytes(raw, 'big') - (1 << 23)
+            else:
+                delta = int.from_bytes(raw, 'big', signed=True)
+            children.append((letter, addr + delta))
+            pending.append(addr + delta)
+        # The runtime stops scanning a node's transitions at the first letter past the one it looks for
+        nodes[addr] = (levels, sorted(children))
+    return root, nodes
+
+
+def _post_order(root: int, nodes: dict) -> list[int]:
+    # Children before their parents, so most targets sit just below the node pointing at them.
+    order = []
+    seen = {root}
+    stack = [(root, iter(nodes[root][1]))]
+    while stack:
+        addr, children = stack[-1]
+        for _, child in children:
+            if child not in seen:
+                seen.add(child)
+                stack.append((child, iter(nodes[child][1])))
+                break
+        else:
+            stack.pop()
+            order.append(addr)
+    return order
+
+
+def _fits(value: int, bits: int) -> bool:
+    return -(1 << (bits - 1)) <= value < (1 << (bits - 1))
+
+
+def encode(root: int, nodes: dict) -> tuple[bytes, int, int]:
+    # Returns the compact blob, the root address and the hub table address.
+    # Levels tape: every distinct level run once, reusing runs contained in ones already on the tape.
+    tape = bytearray()
+    level_offsets = {}
+    for levels, _ in nodes.values():
+        if levels is None or levels in level_offsets:
+            continue
+        if len(levels) >= LEVELS_LENGTH_LIMIT:
+            raise ValueError(f"Levels run of {len(levels)} bytes does not fit the node header")
+        offset = tape.find(levels)
+        if offset < 0:
+            offset = len(tape)
+            tape += levels
+        level_offsets[levels] = offset
+    if len(tape) > LEVELS_OFFSET_LIMIT:
+        raise ValueError(f"Levels tape of {len(tape)} bytes exceeds the 12-bit offsets")
+
+    in_degree = Counter(child for _, children in nodes.values() for _, child in children)
+    hubs = [addr for addr, _ in in_degree.most_common(HUB_COUNT)]
+    hub_index = {addr: i for i, addr in enumerate(hubs)}
+    hubs_address = len(tape)
+    nodes_address = hubs_address + 3 * len(hubs)
+
+    order = _post_order(root, nodes)
+    # Start every target at its widest encoding and narrow until the layout settles. Narrowing a target only ever
+    # brings nodes closer together, so no target has to widen again.
+    widths = {addr: [3] * len(nodes[addr][1]) for addr in order}
+    while True:
+        address = {}
+        pos = nodes_address
+        for addr in order:
+            levels, children = nodes[addr]
+            address[addr] = pos
+            pos += 1 + (len(children) >= 31) + (2 if levels is not None else 0) + len(children)
+            pos += sum(widths[addr])
+        if pos > 1 << ADDRESS_BITS:
+            raise ValueError(f"Trie of {pos} bytes exceeds the {ADDRESS_BITS}-bit addresses")
+        narrowed = False
+        for addr in order:
+            for i, (_, child) in enumerate(nodes[addr][1]):
+                delta = address[child] - address[addr]
+                if child in hub_index or _fits(delta, SHORT_DELTA_BITS):
+                    width = 1
+                elif _fits(delta, LONG_DELTA_BITS):
+                    width = 2
+                else:
+                    width = 3
+                if width < widths[addr][i]:
+                    widths[addr][i] = width
+                    narrowed = True
+        if not narrowed:
+            break
+
+    out = bytearray(tape)
+    for addr in hubs:
+        out += address[addr].to_bytes(3, 'big')
+    for addr in order:
+        levels, children = nodes[addr]
+        assert len(out) == address[addr]
+        count = len(children)
+        out.append((0x80 if levels is not None else 0) | min(count, 31))
+        if count >= 31:
+            out.append(count)
+        if levels is not None:
+            offset = level_offsets[levels]
+            out += bytes([offset >> 4, ((offset & 0x0F) << 4) | len(levels)])
+        out += bytes(letter for letter, _ in children)
+        for i, (_, child) in enumerate(children):
+            delta = address[child] - address[addr]
+            width = widths[addr][i]
+            if width == 1 and child in hub_index:
+                out.append(hub_index[child])
+            elif width == 1:
+                out.append(0x40 | (delta & 0x3F))
+            elif width == 2:
+                out += (0x8000 | (delta & 0x3FFF)).to_bytes(2, 'big')
+            else:
+                out += (0xC00000 | address[child]).to_bytes(3, 'big')
+    return bytes(out), address[root], hubs_address
+
+
+def write_header(path: pathlib.Path, blob: bytes, root: int, hubs: int, symbol: str) -> None:
+    # Emit a constexpr header containing the compact trie plus a SerializedHyphenationPatterns descriptor.
+    bytes_literal = _format_bytes(blob)
 
     path.parent.mkdir(parents=True, exist_ok=True)
     data_symbol = f"{symbol}_trie_data"
@@ -68,7 +213,8 @@ alignas(4) constexpr uint8_t {data_symbol}[] = {{
 }};
 
 constexpr SerializedHyphenationPatterns {patterns_symbol} = {{
-    {f"0x{root_addr_new:02X}"}u,
+    {f"0x{root:02X}"}u,
+    {f"0x{hubs:02X}"}u,
     {data_symbol},
     sizeof({data_symbol}),
 }};
@@ -91,10 +237,12 @@ def main() -> None:
         # Process each input/output pair independently so mixed-language refreshes work in one invocation.
         src_path = pathlib.Path(src)
         blob = src_path.read_bytes()
+        root, nodes = read_hypher(blob)
+        compact, compact_root, hubs = encode(root, nodes)
         out_path = pathlib.Path(dst)
         symbol = _symbol_from_output(out_path)
-        write_header(out_path, blob, symbol)
-        print(f'wrote {dst} ({len(blob)} bytes payload)')
+        write_header(out_path, compact, compact_root, hubs, symbol)
+        print(f'wrote {dst} ({len(compact)} bytes payload, {len(blob)} bytes in hypher format)')
 
 
 if __name__ == '__main__':
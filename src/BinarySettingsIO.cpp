@@ -0,0 +1,371 @@
+#include "BinarySettingsIO.h"
+
+#include <Logging.h>
+#include <ObfuscationUtils.h>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#include "CrossPointSettings.h"
+#include "CrossPointState.h"
+#include "EnergyLedger.h"
+#include "KOReaderCredentialStore.h"
+#include "PerfHistory.h"
+#include "RecentBooksStore.h"
+#include "SettingsList.h"
+#include "WifiCredentialStore.h"
+
+namespace {
+constexpr uint8_t SETTINGS_RECORD_VERSION = 1;
+constexpr uint8_t STATE_RECORD_VERSION = 1;
+constexpr uint8_t WIFI_RECORD_VERSION = 3;  // 2: lastConnection, 3: without the DHCP lease
+constexpr uint8_t KOREADER_RECORD_VERSION = 1;
+constexpr uint8_t RECENT_BOOKS_RECORD_VERSION = 2;  // 2: thumbHeight
+constexpr uint8_t MAX_RECENT_BOOKS = 10;
+constexpr uint8_t ENERGY_RECORD_VERSION = 1;
+constexpr uint8_t PERF_HISTORY_RECORD_VERSION = 1;
+
+// Value kinds of a settings entry
+enum SettingKind : uint8_t { KIND_NUMBER = 0, KIND_STRING = 1 };
+
+struct FrontButtonKey {
+  const char* key;
+  uint8_t CrossPointSettings::* field;
+};
+
+// Managed by the RemapFrontButtons sub-activity, not in SettingsList
+constexpr FrontButtonKey FRONT_BUTTON_KEYS[] = {
+    {"frontButtonBack", &CrossPointSettings::frontButtonBack},
+    {"frontButtonConfirm", &CrossPointSettings::frontButtonConfirm},
+    {"frontButtonLeft", &CrossPointSettings::frontButtonLeft},
+    {"frontButtonRight", &CrossPointSettings::frontButtonRight},
+};
+
+// XOR with the hardware key, which undoes itself; no base64 needed in a binary record
+std::string xorObfuscated(std::string s) {
+  obfuscation::xorTransform(s);
+  return s;
+}
+
+const SettingInfo* findSetting(const std::string& key) {
+  for (const auto& info : getSettingsList()) {
+    if (info.key && (info.valuePtr || info.stringOffset) && key == info.key) {
+      return &info;
+    }
+  }
+  return nullptr;
+}
+
+uint8_t clampSetting(const SettingInfo& info, const uint8_t v, const uint8_t fallback) {
+  switch (info.type) {
+    case SettingType::ENUM:
+      return v < info.enumValues.size() ? v : fallback;
+    case SettingType::TOGGLE:
+      return v < 2 ? v : fallback;
+    case SettingType::VALUE:
+      if (v < info.valueRange.min) return info.valueRange.min;
+      if (v > info.valueRange.max) return info.valueRange.max;
+      return v;
+    default:
+      return v;
+  }
+}
+}  // namespace
+
+// ---- CrossPointSettings ----
+
+void BinarySettingsIO::writeSettings(const CrossPointSettings& s, std::string& out) {
+  Writer w(out);
+  w.pod(SETTINGS_RECORD_VERSION);
+
+  uint16_t count = 0;
+  for (const auto& info : getSettingsList()) {
+    // Dynamic entries (KOReader etc.) are stored in their own records
+    if (info.key && (info.valuePtr || info.stringOffset)) count++;
+  }
+  w.pod(static_cast<uint16_t>(count + std::size(FRONT_BUTTON_KEYS)));
+
+  for (const auto& info : getSettingsList()) {
+    if (!info.key || (!info.valuePtr && !info.stringOffset)) continue;
+    w.string(info.key);
+    if (info.stringOffset) {
+      const char* strPtr = reinterpret_cast<const char*>(&s) + info.stringOffset;
+      w.pod(KIND_STRING);
+      w.string(info.obfuscated ? xorObfuscated(strPtr) : std::string(strPtr));
+    } else {
+      w.pod(KIND_NUMBER);
+      w.pod(s.*(info.valuePtr));
+    }
+  }
+
+  for (const auto& button : FRONT_BUTTON_KEYS) {
+    w.string(button.key);
+    w.pod(KIND_NUMBER);
+    w.pod(s.*(button.field));
+  }
+}
+
+bool BinarySettingsIO::readSettings(CrossPointSettings& s, const std::string& in) {
+  Reader r(in);
+  if (r.pod<uint8_t>() != SETTINGS_RECORD_VERSION) {
+    LOG_ERR("CPS", "Unknown settings record version");
+    return false;
+  }
+
+  const auto count = r.pod<uint16_t>();
+  for (uint16_t i = 0; i < count && r.ok(); i++) {
+    const std::string key = r.string();
+    const auto kind = r.pod<uint8_t>();
+    if (kind == KIND_STRING) {
+      std::string val = r.string();
+      const SettingInfo* info = findSetting(key);
+      if (!info || !info->stringOffset || info->stringMaxLen == 0) continue;
+      if (info->obfuscated) val = xorObfuscated(std::move(val));
+      char* destPtr = reinterpret_cast<char*>(&s) + info->stringOffset;
+      strncpy(destPtr, val.c_str(), info->stringMaxLen - 1);
+      destPtr[info->stringMaxLen - 1] = '\0';
+    } else if (kind == KIND_NUMBER) {
+      const auto v = r.pod<uint8_t>();
+      if (const SettingInfo* info = findSetting(key)) {
+        if (info->valuePtr) s.*(info->valuePtr) = clampSetting(*info, v, s.*(info->valuePtr));
+        continue;
+      }
+      for (const auto& button : FRONT_BUTTON_KEYS) {
+        if (key == button.key) {
+          s.*(button.field) = v < CrossPointSettings::FRONT_BUTTON_HARDWARE_COUNT ? v : s.*(button.field);
+        }
+      }
+    } else {
+      // Entries are not self-delimiting beyond the known kinds
+      LOG_ERR("CPS", "Unknown settings entry kind %u for '%s'", kind, key.c_str());
+      break;
+    }
+  }
+  CrossPointSettings::validateFrontButtonMapping(s);
+
+  if (!r.ok()) {
+    LOG_ERR("CPS", "Settings record truncated");
+  }
+  LOG_DBG("CPS", "Settings loaded from record store");
+  return true;
+}
+
+// ---- CrossPointState ----
+
+void BinarySettingsIO::writeState(const CrossPointState& s, std::string& out) {
+  Writer w(out);
+  w.pod(STATE_RECORD_VERSION);
+  w.string(s.openEpubPath);
+  for (const auto image : s.recentSleepImages) w.pod(image);
+  w.pod(s.recentSleepPos);
+  w.pod(s.recentSleepFill);
+  w.pod(s.readerActivityLoadCount);
+  w.pod(s.lastSleepFromReader);
+}
+
+bool BinarySettingsIO::readState(CrossPointState& s, const std::string& in) {
+  Reader r(in);
+  if (r.pod<uint8_t>() != STATE_RECORD_VERSION) {
+    LOG_ERR("CPS", "Unknown state record version");
+    return false;
+  }
+  s.openEpubPath = r.string();
+  for (auto& image : s.recentSleepImages) image = r.pod<uint16_t>();
+  s.recentSleepPos = r.pod<uint8_t>() % CrossPointState::SLEEP_RECENT_COUNT;
+  s.recentSleepFill = std::min(r.pod<uint8_t>(), CrossPointState::SLEEP_RECENT_COUNT);
+  s.readerActivityLoadCount = r.pod<uint8_t>();
+  s.lastSleepFromReader = r.pod<bool>();
+  return r.ok();
+}
+
+// ---- KOReaderCredentialStore ----
+
+void BinarySettingsIO::writeKOReader(const KOReaderCredentialStore& store, std::string& out) {
+  Writer w(out);
+  w.pod(KOREADER_RECORD_VERSION);
+  w.string(store.username);
+  w.string(xorObfuscated(store.password));
+  w.string(store.serverUrl);
+  w.pod(static_cast<uint8_t>(store.matchMethod));
+}
+
+bool BinarySettingsIO::readKOReader(KOReaderCredentialStore& store, const std::string& in) {
+  Reader r(in);
+  if (r.pod<uint8_t>() != KOREADER_RECORD_VERSION) {
+    LOG_ERR("KRS", "Unknown KOReader record version");
+    return false;
+  }
+  store.username = r.string();
+  store.password = xorObfuscated(r.string());
+  store.serverUrl = r.string();
+  store.matchMethod = static_cast<DocumentMatchMethod>(r.pod<uint8_t>());
+  LOG_DBG("KRS", "Loaded KOReader credentials for user: %s", store.username.c_str());
+  return r.ok();
+}
+
+// ---- WifiCredentialStore ----
+
+void BinarySettingsIO::writeWifi(const WifiCredentialStore& store, std::string& out) {
+  Writer w(out);
+  w.pod(WIFI_RECORD_VERSION);
+  w.string(store.lastConnectedSsid);
+  w.pod(static_cast<uint8_t>(store.credentials.size()));
+  for (const auto& cred : store.credentials) {
+    w.string(cred.ssid);
+    w.string(xorObfuscated(cred.password));
+    w.pod(cred.lastConnection);
+  }
+}
+
+bool BinarySettingsIO::readWifi(WifiCredentialStore& store, const std::string& in) {
+  Reader r(in);
+  const auto version = r.pod<uint8_t>();
+  if (version < 1 || version > WIFI_RECORD_VERSION) {
+    LOG_ERR("WCS", "Unknown WiFi record version");
+    return false;
+  }
+  store.lastConnectedSsid = r.string();
+  const auto count = r.pod<uint8_t>();
+  store.credentials.clear();
+  for (uint8_t i = 0; i < count && r.ok() && store.credentials.size() < store.MAX_NETWORKS; i++) {
+    WifiCredential cred;
+    cred.ssid = r.string();
+    cred.password = xorObfuscated(r.string());
+    if (version == 2) {
+      // The lease that came first is no longer reused
+      for (int field = 0; field < 4; field++) r.pod<uint32_t>();
+    }
+    if (version >= 2) cred.lastConnection = r.pod<WifiConnectionInfo>();
+    if (r.ok()) store.credentials.push_back(std::move(cred));
+  }
+  LOG_DBG("WCS", "Loaded %zu WiFi credentials from record store", store.credentials.size());
+  return r.ok();
+}
+
+// ---- RecentBooksStore ----
+
+void BinarySettingsIO::writeRecentBooks(const RecentBooksStore& store, std::string& out) {
+  Writer w(out);
+  w.pod(RECENT_BOOKS_RECORD_VERSION);
+  w.pod(static_cast<uint8_t>(store.getCount()));
+  for (const auto& book : store.getBooks()) {
+    w.string(book.path);
+    w.string(book.title);
+    w.string(book.author);
+    w.string(book.coverBmpPath);
+    w.pod(book.thumbHeight);
+  }
+}
+
+bool BinarySettingsIO::readRecentBooks(RecentBooksStore& store, const std::string& in) {
+  Reader r(in);
+  const auto version = r.pod<uint8_t>();
+  if (version < 1 || version > RECENT_BOOKS_RECORD_VERSION) {
+    LOG_ERR("RBS", "Unknown recent books record version");
+    return false;
+  }
+  const auto count = r.pod<uint8_t>();
+  store.recentBooks.clear();
+  for (uint8_t i = 0; i < count && r.ok() && i < MAX_RECENT_BOOKS; i++) {
+    RecentBook book;
+    book.path = r.string();
+    book.title = r.string();
+    book.author = r.string();
+    book.coverBmpPath = r.string();
+    if (version >= 2) book.thumbHeight = r.pod<uint16_t>();
+    if (r.ok()) store.recentBooks.push_back(std::move(book));
+  }
+  LOG_DBG("RBS", "Recent books loaded from record store (%d entries)", store.getCount());
+  return r.ok();
+}
+
+// ---- EnergyLedger ----
+
+void BinarySettingsIO::writeEnergy(const EnergyLedger& ledger, std::string& out) {
+  Writer w(out);
+  w.pod(ENERGY_RECORD_VERSION);
+  w.pod(ledger.sleepCount);
+  // Counters added later are appended, so a record lists how many each account has
+  w.pod(static_cast<uint8_t>(EnergyLedger::COUNTER_COUNT));
+  w.pod(ledger.accountCount);
+  for (uint8_t i = 0; i < ledger.accountCount; i++) {
+    const auto& account = ledger.accounts[i];
+    w.string(account.name);
+    for (const uint32_t counter : account.counters) {
+      w.pod(counter);
+    }
+  }
+}
+
+bool BinarySettingsIO::readEnergy(EnergyLedger& ledger, const std::string& in) {
+  Reader r(in);
+  if (r.pod<uint8_t>() != ENERGY_RECORD_VERSION) {
+    LOG_ERR("NRG", "Unknown energy record version");
+    return false;
+  }
+  ledger.sleepCount = r.pod<uint32_t>();
+  const auto counterCount = r.pod<uint8_t>();
+  const auto count = std::min(r.pod<uint8_t>(), EnergyLedger::MAX_ACCOUNTS);
+  ledger.accountCount = 0;
+  for (uint8_t i = 0; i < count && r.ok(); i++) {
+    auto& account = ledger.accounts[i];
+    memset(&account, 0, sizeof(account));
+    const std::string name = r.string();
+    strncpy(account.name, name.c_str(), EnergyLedger::NAME_LENGTH - 1);
+    for (uint8_t c = 0; c < counterCount; c++) {
+      const auto value = r.pod<uint32_t>();
+      if (c < EnergyLedger::COUNTER_COUNT) account.counters[c] = value;
+    }
+    if (r.ok()) ledger.accountCount++;
+  }
+  return r.ok();
+}
+
+// ---- PerfHistory ----
+
+void BinarySettingsIO::writePerfHistory(const PerfHistory& history, std::string& out) {
+  Writer w(out);
+  w.pod(PERF_HISTORY_RECORD_VERSION);
+  // Metrics added later are appended, so a record lists how many histograms each entry has, and their size
+  w.pod(static_cast<uint8_t>(PerfHistory::METRIC_COUNT));
+  w.pod(PerfHistory::BUCKET_COUNT);
+  w.pod(history.entryCount);
+  for (uint8_t i = 0; i < history.entryCount; i++) {
+    const auto& entry = history.entries[i];
+    w.string(entry.version);
+    w.pod(entry.peakHeapUsed);
+    for (const auto& histogram : entry.histograms) {
+      for (const uint16_t count : histogram.counts) {
+        w.pod(count);
+      }
+    }
+  }
+}
+
+bool BinarySettingsIO::readPerfHistory(PerfHistory& history, const std::string& in) {
+  Reader r(in);
+  if (r.pod<uint8_t>() != PERF_HISTORY_RECORD_VERSION) {
+    LOG_ERR("PRF", "Unknown performance history record version");
+    return false;
+  }
+  const auto metricCount = r.pod<uint8_t>();
+  const auto bucketCount = r.pod<uint8_t>();
+  const auto count = std::min(r.pod<uint8_t>(), PerfHistory::MAX_VERSIONS);
+  history.entryCount = 0;
+  for (uint8_t i = 0; i < count && r.ok(); i++) {
+    auto& entry = history.entries[i];
+    memset(&entry, 0, sizeof(entry));
+    const std::string version = r.string();
+    strncpy(entry.version, version.c_str(), PerfHistory::VERSION_LENGTH - 1);
+    entry.peakHeapUsed = r.pod<uint32_t>();
+    for (uint8_t m = 0; m < metricCount; m++) {
+      for (uint8_t b = 0; b < bucketCount; b++) {
+        const auto value = r.pod<uint16_t>();
+        if (m < PerfHistory::METRIC_COUNT && b < PerfHistory::BUCKET_COUNT) entry.histograms[m].counts[b] = value;
+      }
+    }
+    if (r.ok()) history.entryCount++;
+  }
+  return r.ok();
+}
@@ -0,0 +1,103 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+class CrossPointSettings;
+class CrossPointState;
+class EnergyLedger;
+class PerfHistory;
+class WifiCredentialStore;
+class KOReaderCredentialStore;
+class RecentBooksStore;
+
+/**
+ * Record payloads of the stores kept in RecordStore. Each payload starts with its own version byte. Settings are
+ * stored as key/value pairs under the SettingsList keys, so adding, removing or reordering settings needs no new
+ * version; the other stores are small fixed layouts.
+ */
+namespace BinarySettingsIO {
+
+class Writer {
+ public:
+  explicit Writer(std::string& out) : out(out) {}
+
+  template <typename T>
+  void pod(const T& value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  void string(const std::string& s) {
+    pod(static_cast<uint32_t>(s.size()));
+    out.append(s);
+  }
+
+ private:
+  std::string& out;
+};
+
+// Once a read runs past the end of the payload ok() turns false, and all further reads return zeroes and empty strings
+class Reader {
+ public:
+  explicit Reader(const std::string& in) : in(in) {}
+
+  template <typename T>
+  T pod() {
+    T value{};
+    if (valid && sizeof(T) <= in.size() - pos) {
+      memcpy(&value, in.data() + pos, sizeof(T));
+      pos += sizeof(T);
+    } else {
+      valid = false;
+    }
+    return value;
+  }
+
+  std::string string() {
+    const auto len = pod<uint32_t>();
+    if (!valid || len > in.size() - pos) {
+      valid = false;
+      return {};
+    }
+    std::string s = in.substr(pos, len);
+    pos += len;
+    return s;
+  }
+
+  bool ok() const { return valid; }
+
+ private:
+  const std::string& in;
+  size_t pos = 0;
+  bool valid = true;
+};
+
+// CrossPointSettings
+void writeSettings(const CrossPointSettings& s, std::string& out);
+bool readSettings(CrossPointSettings& s, const std::string& in);
+
+// CrossPointState
+void writeState(const CrossPointState& s, std::string& out);
+bool readState(CrossPointState& s, const std::string& in);
+
+// WifiCredentialStore
+void writeWifi(const WifiCredentialStore& store, std::string& out);
+bool readWifi(WifiCredentialStore& store, const std::string& in);
+
+// KOReaderCredentialStore
+void writeKOReader(const KOReaderCredentialStore& store, std::string& out);
+bool readKOReader(KOReaderCredentialStore& store, const std::string& in);
+
+// RecentBooksStore
+void writeRecentBooks(const RecentBooksStore& store, std::string& out);
+bool readRecentBooks(RecentBooksStore& store, const std::string& in);
+
+// EnergyLedger
+void writeEnergy(const EnergyLedger& ledger, std::string& out);
+bool readEnergy(EnergyLedger& ledger, const std::string& in);
+
+// PerfHistory
+void writePerfHistory(const PerfHistory& history, std::string& out);
+bool readPerfHistory(PerfHistory& history, const std::string& in);
+
+}  // namespace BinarySettingsIO
@@ -0,0 +1,235 @@
+#include "CacheBudget.h"
+
+#include <Epub/ImagePack.h>
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "CrossPointSettings.h"
+
+namespace {
+constexpr uint8_t INDEX_FILE_VERSION = 1;
+constexpr char CACHE_DIR[] = "/.crosspoint";
+constexpr char INDEX_FILE[] = "/.crosspoint/cache_index.bin";
+constexpr uint32_t UNKNOWN_SIZE = UINT32_MAX;
+// The heavy artifacts are gone, only what the budget never removes is left
+constexpr uint8_t FLAG_TRIMMED = 0x01;
+
+struct Entry {
+  std::string name;
+  uint32_t size;
+  uint32_t lastRead;
+  uint8_t flags;
+};
+
+struct Index {
+  uint32_t clock = 0;
+  std::vector<Entry> entries;
+};
+
+bool isBookCacheDir(const char* name) {
+  return strncmp(name, "epub_", 5) == 0 || strncmp(name, "xtc_", 4) == 0 || strncmp(name, "txt_", 4) == 0 ||
+         strncmp(name, "cbz_", 4) == 0;
+}
+
+// Laid out sections, link targets, extracted images, page indices and leftover temp files: all rebuilt when the book
+// is read again
+bool isHeavyArtifact(const char* name, const bool isDirectory) {
+  return isDirectory || strncmp(name, "img_", 4) == 0 || strncmp(name, ".tmp", 4) == 0 ||
+         strcmp(name, "index.bin") == 0 || strcmp(name, "indexer.bin") == 0 || strcmp(name, "section.bin") == 0;
+}
+
+void loadIndex(Index& index) {
+  FsFile f;
+  if (!Storage.exists(INDEX_FILE) || !Storage.openFileForRead("CCB", INDEX_FILE, f)) {
+    return;
+  }
+  BufferedFileReader reader(f);
+  uint8_t version = 0;
+  uint16_t count = 0;
+  serialization::readPod(reader, version);
+  if (version != INDEX_FILE_VERSION) {
+    return;
+  }
+  serialization::readPod(reader, index.clock);
+  serialization::readPod(reader, count);
+  index.entries.resize(count);
+  for (auto& entry : index.entries) {
+    serialization::readString(reader, entry.name);
+    serialization::readPod(reader, entry.size);
+    serialization::readPod(reader, entry.lastRead);
+    serialization::readPod(reader, entry.flags);
+  }
+}
+
+void saveIndex(const Index& index) {
+  FsFile f;
+  if (!Storage.openFileForWrite("CCB", INDEX_FILE, f)) {
+    return;
+  }
+  BufferedFileWriter writer(f);
+  serialization::writePod(writer, INDEX_FILE_VERSION);
+  serialization::writePod(writer, index.clock);
+  serialization::writePod(writer, static_cast<uint16_t>(index.entries.size()));
+  for (const auto& entry : index.entries) {
+    serialization::writeString(writer, entry.name);
+    serialization::writePod(writer, entry.size);
+    serialization::writePod(writer, entry.lastRead);
+    serialization::writePod(writer, entry.flags);
+  }
+  if (!writer.flush()) {
+    LOG_ERR("CCB", "Failed to write cache index");
+  }
+}
+
+// Adds the book cache directories the index doesn't know yet and drops those that are gone
+void discover(Index& index) {
+  auto root = Storage.open(CACHE_DIR);
+  if (!root || !root.isDirectory()) {
+    return;
+  }
+  std::vector<std::string> names;
+  char name[64];
+  for (auto file = root.openNextFile(); file; file = root.openNextFile()) {
+    file.getName(name, sizeof(name));
+    if (file.isDirectory() && isBookCacheDir(name)) {
+      names.emplace_back(name);
+    }
+  }
+  root.close();
+
+  std::sort(names.begin(), names.end());
+  index.entries.erase(std::remove_if(index.entries.begin(), index.entries.end(),
+                                     [&](const Entry& entry) {
+                                       return !std::binary_search(names.begin(), names.end(), entry.name);
+                                     }),
+                      index.entries.end());
+  for (auto& dirName : names) {
+    const bool known = std::any_of(index.entries.begin(), index.entries.end(),
+                                   [&](const Entry& entry) { return entry.name == dirName; });
+    if (!known) {
+      index.entries.push_back({std::move(dirName), UNKNOWN_SIZE, 0, 0});
+    }
+  }
+}
+
+// Adds the size of every file under path to size
+void measure(const std::string& path, uint32_t& size) {
+  auto dir = Storage.open(path.c_str());
+  if (!dir || !dir.isDirectory()) {
+    return;
+  }
+  std::vector<std::string> subdirs;
+  char name[64];
+  for (auto file = dir.openNextFile(); file; file = dir.openNextFile()) {
+    if (file.isDirectory()) {
+      file.getName(name, sizeof(name));
+      subdirs.emplace_back(name);
+    } else {
+      size += static_cast<uint32_t>(file.fileSize());
+    }
+  }
+  dir.close();
+  for (const auto& subdir : subdirs) {
+    measure(path + "/" + subdir, size);
+  }
+}
+
+void trim(const std::string& path) {
+  auto dir = Storage.open(path.c_str());
+  if (!dir || !dir.isDirectory()) {
+    return;
+  }
+  std::vector<std::pair<std::string, bool>> artifacts;
+  char name[64];
+  for (auto file = dir.openNextFile(); file; file = dir.openNextFile()) {
+    file.getName(name, sizeof(name));
+    const bool isDirectory = file.isDirectory();
+    if (isHeavyArtifact(name, isDirectory)) {
+      artifacts.emplace_back(name, isDirectory);
+    }
+  }
+  dir.close();
+  ImagePack::forget();
+  for (const auto& [artifact, isDirectory] : artifacts) {
+    const std::string artifactPath = path + "/" + artifact;
+    if (isDirectory) {
+      Storage.discardDir(artifactPath.c_str());
+    } else {
+      Storage.remove(artifactPath.c_str());
+    }
+  }
+}
+
+std::string pathOf(const Entry& entry) { return std::string(CACHE_DIR) + "/" + entry.name; }
+}  // namespace
+
+void CacheBudget::onBookClosed(const std::string& cachePath) {
+  Index index;
+  loadIndex(index);
+  discover(index);
+
+  const std::string name = cachePath.substr(cachePath.find_last_of('/') + 1);
+  auto current = std::find_if(index.entries.begin(), index.entries.end(),
+                              [&](const Entry& entry) { return entry.name == name; });
+  if (current == index.entries.end()) {
+    // Nothing cached for the book
+    saveIndex(index);
+    return;
+  }
+  current->lastRead = ++index.clock;
+  current->flags &= ~FLAG_TRIMMED;
+  current->size = 0;
+  measure(cachePath, current->size);
+
+  // Directories found by discover() are measured one per closed book, oldest first
+  const auto unknown = std::find_if(index.entries.begin(), index.entries.end(),
+                                    [](const Entry& entry) { return entry.size == UNKNOWN_SIZE; });
+  if (unknown != index.entries.end()) {
+    unknown->size = 0;
+    measure(pathOf(*unknown), unknown->size);
+  }
+
+  const uint64_t budget = SETTINGS.getCacheBudgetBytes();
+  uint64_t total = 0;
+  for (const auto& entry : index.entries) {
+    total += entry.size == UNKNOWN_SIZE ? 0 : entry.size;
+  }
+  if (budget > 0 && total > budget) {
+    // Least recently read first; the book just closed is never trimmed
+    std::vector<Entry*> candidates;
+    for (auto& entry : index.entries) {
+      if (entry.name != name && !(entry.flags & FLAG_TRIMMED)) {
+        candidates.push_back(&entry);
+      }
+    }
+    std::sort(candidates.begin(), candidates.end(),
+              [](const Entry* a, const Entry* b) { return a->lastRead < b->lastRead; });
+    for (Entry* entry : candidates) {
+      if (total <= budget) {
+        break;
+      }
+      const uint32_t before = entry->size == UNKNOWN_SIZE ? 0 : entry->size;
+      trim(pathOf(*entry));
+      entry->size = 0;
+      measure(pathOf(*entry), entry->size);
+      entry->flags |= FLAG_TRIMMED;
+      total = total - before + entry->size;
+      LOG_DBG("CCB", "Trimmed %s to %u bytes", entry->name.c_str(), entry->size);
+    }
+  }
+  LOG_DBG("CCB", "Book caches: %llu bytes in %u books", static_cast<unsigned long long>(total),
+          static_cast<unsigned>(index.entries.size()));
+  saveIndex(index);
+}
+
+void CacheBudget::reset() {
+  ImagePack::forget();
+  if (Storage.exists(INDEX_FILE)) {
+    Storage.remove(INDEX_FILE);
+  }
+}
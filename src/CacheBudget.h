@@ -0,0 +1,23 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+/**
+ * Keeps the book caches under /.crosspoint within the size budget set in the settings.
+ *
+ * /.crosspoint/cache_index.bin lists the cache directories of the books (epub_, xtc_, txt_ and cbz_), each with its
+ * size and when it was last read: header (uint8_t version, uint32_t clock, uint16_t count), then count {string name,
+ * uint32_t size, uint32_t lastRead, uint8_t flags}. lastRead counts closed books rather than time, the device has no
+ * clock. Directories that appear without a book being read, e.g. pre-indexed by the home screen, join the index when
+ * the next book is closed; their size is measured one directory per closed book.
+ *
+ * Over budget, the least recently read books lose their heavy artifacts first (laid out sections, extracted images,
+ * page indices). Metadata, covers, thumbnails and reading progress stay, so such a book is only laid out again.
+ */
+class CacheBudget {
+ public:
+  // Called by the readers as they close a book: marks it read last, measures it and enforces the budget
+  static void onBookClosed(const std::string& cachePath);
+  // Forgets every book, after the caches were cleared
+  static void reset();
+};
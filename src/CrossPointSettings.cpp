@@ -1,5 +1,6 @@
 #include "CrossPointSettings.h"
 
+#include <BinarySettingsIO.h>
 #include <HalStorage.h>
 #include <JsonSettingsIO.h>
 #include <Logging.h>
@@ -8,6 +9,9 @@
 #include <cstring>
 #include <string>
 
+#include "PartitionReaderFonts.h"
+#include "RecordStore.h"
+#include "SdReaderFont.h"
 #include "fontIds.h"
 
 // Initialize the static instance
@@ -77,23 +81,23 @@ void CrossPointSettings::validateFrontButtonMapping(CrossPointSettings& settings
 }
 
 bool CrossPointSettings::saveToFile() const {
-  Storage.mkdir("/.crosspoint");
-  return JsonSettingsIO::saveSettings(*this, SETTINGS_FILE_JSON);
+  RecordStore::markDirty(RecordStore::SETTINGS_SLOT);
+  return true;
 }
 
 bool CrossPointSettings::loadFromFile() {
-  // Try JSON first
+  std::string record;
+  if (RecordStore::read(RecordStore::SETTINGS_SLOT, record) && BinarySettingsIO::readSettings(*this, record)) {
+    return true;
+  }
+
+  // Settings from before the record store, moved into it on the next flush
   if (Storage.exists(SETTINGS_FILE_JSON)) {
     String json = Storage.readFile(SETTINGS_FILE_JSON);
     if (!json.isEmpty()) {
-      bool resave = false;
-      bool result = JsonSettingsIO::loadSettings(*this, json.c_str(), &resave);
-      if (result && resave) {
-        if (saveToFile()) {
-          LOG_DBG("CPS", "Resaved settings to update format");
-        } else {
-          LOG_ERR("CPS", "Failed to resave settings after format update");
-        }
+      const bool result = JsonSettingsIO::loadSettings(*this, json.c_str());
+      if (result) {
+        saveToFile();
       }
       return result;
     }
@@ -102,12 +106,13 @@ bool CrossPointSettings::loadFromFile() {
   // Fall back to binary migration
   if (Storage.exists(SETTINGS_FILE_BIN)) {
     if (loadFromBinaryFile()) {
-      if (saveToFile()) {
+      saveToFile();
+      if (RecordStore::flush()) {
         Storage.rename(SETTINGS_FILE_BIN, SETTINGS_FILE_BAK);
-        LOG_DBG("CPS", "Migrated settings.bin to settings.json");
+        LOG_DBG("CPS", "Migrated settings.bin to the record store");
         return true;
       } else {
-        LOG_ERR("CPS", "Failed to save migrated settings to JSON");
+        LOG_ERR("CPS", "Failed to save migrated settings");
         return false;
       }
     }
@@ -291,7 +296,35 @@ int CrossPointSettings::getRefreshFrequency() const {
   }
 }
 
+uint64_t CrossPointSettings::getCacheBudgetBytes() const {
+  constexpr uint64_t MB = 1024 * 1024;
+  switch (cacheBudget) {
+    case CACHE_256_MB:
+      return 256 * MB;
+    case CACHE_512_MB:
+      return 512 * MB;
+    case CACHE_1_GB:
+    default:
+      return 1024 * MB;
+    case CACHE_4_GB:
+      return 4096 * MB;
+    case CACHE_UNLIMITED:
+      return 0;
+  }
+}
+
 int CrossPointSettings::getReaderFontId() const {
+  if (fontFamily == SD_CARD && SD_READER_FONT.isLoaded()) {
+    return SD_READER_FONT.getFontId();
+  }
+#ifdef FONTS_IN_PARTITION
+  return PARTITION_READER_FONTS.resolveFontId(getBuiltinReaderFontId(), BOOKERLY_14_FONT_ID);
+#else
+  return getBuiltinReaderFontId();
+#endif
+}
+
+int CrossPointSettings::getBuiltinReaderFontId() const {
   switch (fontFamily) {
     case BOOKERLY:
     default:
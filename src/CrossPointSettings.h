@@ -92,7 +92,8 @@ class CrossPointSettings {
   enum SIDE_BUTTON_LAYOUT { PREV_NEXT = 0, NEXT_PREV = 1, SIDE_BUTTON_LAYOUT_COUNT };
 
   // Font family options
-  enum FONT_FAMILY { BOOKERLY = 0, NOTOSANS = 1, OPENDYSLEXIC = 2, FONT_FAMILY_COUNT };
+  // SD_CARD reads the font from /fonts on the card (see SdReaderFont), falling back to Bookerly without one
+  enum FONT_FAMILY { BOOKERLY = 0, NOTOSANS = 1, OPENDYSLEXIC = 2, SD_CARD = 3, FONT_FAMILY_COUNT };
   // Font size options
   enum FONT_SIZE { SMALL = 0, MEDIUM = 1, LARGE = 2, EXTRA_LARGE = 3, FONT_SIZE_COUNT };
   enum LINE_COMPRESSION { TIGHT = 0, NORMAL = 1, WIDE = 2, LINE_COMPRESSION_COUNT };
@@ -134,9 +135,22 @@ class CrossPointSettings {
   // UI Theme
   enum UI_THEME { CLASSIC = 0, LYRA = 1, LYRA_3_COVERS = 2 };
 
+  // Text anti-aliasing; the EPUB reader can put the grayscale pass off until the page has been up for a moment
+  enum TEXT_ANTI_ALIASING { AA_OFF = 0, AA_ON = 1, AA_WHEN_IDLE = 2, TEXT_ANTI_ALIASING_COUNT };
+
   // Image rendering in EPUB reader
   enum IMAGE_RENDERING { IMAGES_DISPLAY = 0, IMAGES_PLACEHOLDER = 1, IMAGES_SUPPRESS = 2, IMAGE_RENDERING_COUNT };
 
+  // Size the book caches are kept within (see CacheBudget)
+  enum CACHE_BUDGET {
+    CACHE_256_MB = 0,
+    CACHE_512_MB = 1,
+    CACHE_1_GB = 2,
+    CACHE_4_GB = 3,
+    CACHE_UNLIMITED = 4,
+    CACHE_BUDGET_COUNT
+  };
+
   // Sleep screen settings
   uint8_t sleepScreen = DARK;
   // Sleep screen cover mode settings
@@ -146,6 +160,8 @@ class CrossPointSettings {
   // Status bar settings (statusBar retained for migration only)
   uint8_t statusBar = FULL;
   uint8_t statusBarChapterPageCount = 1;
+  // Number pages across the whole book instead of within the chapter (EPUB only)
+  uint8_t statusBarBookPageNumbers = 0;
   uint8_t statusBarBookProgressPercentage = 1;
   uint8_t statusBarProgressBar = HIDE_PROGRESS;
   uint8_t statusBarProgressBarThickness = PROGRESS_BAR_NORMAL;
@@ -153,7 +169,7 @@ class CrossPointSettings {
   uint8_t statusBarBattery = 1;
   // Text rendering settings
   uint8_t extraParagraphSpacing = 1;
-  uint8_t textAntiAliasing = 1;
+  uint8_t textAntiAliasing = AA_ON;
   // Short power button click behaviour
   uint8_t shortPwrBtn = IGNORE;
   // EPUB reading orientation settings
@@ -199,6 +215,7 @@ class CrossPointSettings {
   uint8_t showHiddenFiles = 0;
   // Image rendering mode in EPUB reader
   uint8_t imageRendering = IMAGES_DISPLAY;
+  uint8_t cacheBudget = CACHE_1_GB;
 
   ~CrossPointSettings() = default;
 
@@ -213,6 +230,7 @@ class CrossPointSettings {
   // If count_only is true, returns the number of settings items that would be written.
   uint8_t writeSettings(FsFile& file, bool count_only = false) const;
 
+  // Marks the record dirty; RecordStore::flush() writes it
   bool saveToFile() const;
   bool loadFromFile();
 
@@ -220,11 +238,15 @@ class CrossPointSettings {
 
  private:
   bool loadFromBinaryFile();
+  // The builtin family of the font family and size settings
+  int getBuiltinReaderFontId() const;
 
  public:
   float getReaderLineCompression() const;
   unsigned long getSleepTimeoutMs() const;
   int getRefreshFrequency() const;
+  // 0 when unlimited
+  uint64_t getCacheBudgetBytes() const;
 };
 
 // Helper macro to access settings
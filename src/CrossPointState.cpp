@@ -1,5 +1,6 @@
 #include "CrossPointState.h"
 
+#include <BinarySettingsIO.h>
 #include <HalStorage.h>
 #include <JsonSettingsIO.h>
 #include <Logging.h>
@@ -7,6 +8,8 @@
 
 #include <algorithm>
 
+#include "RecordStore.h"
+
 namespace {
 constexpr uint8_t STATE_FILE_VERSION = 4;
 constexpr char STATE_FILE_BIN[] = "/.crosspoint/state.bin";
@@ -32,25 +35,35 @@ void CrossPointState::pushRecentSleep(uint16_t idx) {
 }
 
 bool CrossPointState::saveToFile() const {
-  Storage.mkdir("/.crosspoint");
-  return JsonSettingsIO::saveState(*this, STATE_FILE_JSON);
+  RecordStore::markDirty(RecordStore::STATE_SLOT);
+  return true;
 }
 
 bool CrossPointState::loadFromFile() {
-  // Try JSON first
+  std::string record;
+  if (RecordStore::read(RecordStore::STATE_SLOT, record) && BinarySettingsIO::readState(*this, record)) {
+    return true;
+  }
+
+  // State from before the record store, moved into it on the next flush
   if (Storage.exists(STATE_FILE_JSON)) {
     String json = Storage.readFile(STATE_FILE_JSON);
     if (!json.isEmpty()) {
-      return JsonSettingsIO::loadState(*this, json.c_str());
+      const bool result = JsonSettingsIO::loadState(*this, json.c_str());
+      if (result) {
+        saveToFile();
+      }
+      return result;
     }
   }
 
   // Fall back to binary migration
   if (Storage.exists(STATE_FILE_BIN)) {
     if (loadFromBinaryFile()) {
-      if (saveToFile()) {
+      saveToFile();
+      if (RecordStore::flush()) {
         Storage.rename(STATE_FILE_BIN, STATE_FILE_BAK);
-        LOG_DBG("CPS", "Migrated state.bin to state.json");
+        LOG_DBG("CPS", "Migrated state.bin to the record store");
         return true;
       } else {
         LOG_ERR("CPS", "Failed to save state during migration");
@@ -26,6 +26,7 @@ class CrossPointState {
   // Get singleton instance
   static CrossPointState& getInstance() { return instance; }
 
+  // Marks the record dirty; RecordStore::flush() writes it
   bool saveToFile() const;
 
   bool loadFromFile();
@@ -0,0 +1,110 @@
+#include "EnergyLedger.h"
+
+#include <BinarySettingsIO.h>
+#include <HalStorage.h>
+#include <Logging.h>
+#include <WiFi.h>
+
+#include <cstring>
+
+#include "RecordStore.h"
+
+namespace {
+// From reset until the first activity is entered
+constexpr char BOOT_ACCOUNT[] = "Boot";
+constexpr char OTHER_ACCOUNT[] = "Other";
+}  // namespace
+
+EnergyLedger EnergyLedger::instance;
+
+uint8_t EnergyLedger::accountFor(const char* name) {
+  for (uint8_t i = 0; i < accountCount; i++) {
+    if (strncmp(accounts[i].name, name, NAME_LENGTH - 1) == 0) {
+      return i;
+    }
+  }
+  if (accountCount == MAX_ACCOUNTS) {
+    return MAX_ACCOUNTS - 1;
+  }
+  Account& account = accounts[accountCount];
+  memset(&account, 0, sizeof(account));
+  strncpy(account.name, accountCount == MAX_ACCOUNTS - 1 ? OTHER_ACCOUNT : name, NAME_LENGTH - 1);
+  return accountCount++;
+}
+
+void EnergyLedger::charge() {
+  if (accountCount == 0) {
+    current = accountFor(BOOT_ACCOUNT);
+  }
+  const unsigned long now = millis();
+  const HalPowerManager::Residency residency = powerManager.getResidency();
+  const HalDisplay::RefreshCounts& refreshes = display.getRefreshCounts();
+  const uint32_t sdBusyMs = Storage.getBusyMs();
+  const bool wifiOn = WiFi.getMode() != WIFI_OFF;
+
+  uint32_t* counters = accounts[current].counters;
+  counters[ACTIVE_MS] += now - lastSampleMs;
+  counters[CPU_NORMAL_MS] += residency.normalMs - lastResidency.normalMs;
+  counters[CPU_LOW_POWER_MS] += residency.lowPowerMs - lastResidency.lowPowerMs;
+  counters[CPU_BOOSTED_MS] += residency.boostedMs - lastResidency.boostedMs;
+  // On at either end of the stretch: activities turn WiFi off in onExit(), just before the next one is entered
+  if (wifiOn || wifiWasOn) {
+    counters[WIFI_MS] += now - lastSampleMs;
+  }
+  counters[SD_BUSY_MS] += sdBusyMs - lastSdBusyMs;
+  counters[FULL_REFRESHES] += refreshes.full - lastRefreshes.full;
+  counters[HALF_REFRESHES] += refreshes.half - lastRefreshes.half;
+  counters[FAST_REFRESHES] += refreshes.fast - lastRefreshes.fast;
+  counters[WINDOW_REFRESHES] += refreshes.window - lastRefreshes.window;
+  counters[GRAY_REFRESHES] += refreshes.gray - lastRefreshes.gray;
+
+  lastSampleMs = now;
+  lastResidency = residency;
+  lastRefreshes = refreshes;
+  lastSdBusyMs = sdBusyMs;
+  wifiWasOn = wifiOn;
+}
+
+void EnergyLedger::enter(const char* name) {
+  charge();
+  current = accountFor(name);
+}
+
+void EnergyLedger::sample() {
+  if (millis() - lastSampleMs >= SAMPLE_INTERVAL_MS) {
+    charge();
+  }
+}
+
+void EnergyLedger::reset() {
+  charge();  // Totals up to now are dropped with the accounts
+  char name[NAME_LENGTH];
+  memcpy(name, accounts[current].name, NAME_LENGTH);
+  memset(accounts, 0, sizeof(accounts));
+  accountCount = 0;
+  sleepCount = 0;
+  current = accountFor(name);
+  RecordStore::markDirty(RecordStore::ENERGY_SLOT);
+}
+
+bool EnergyLedger::saveForSleep() {
+  charge();
+  sleepCount++;
+  RecordStore::markDirty(RecordStore::ENERGY_SLOT);
+  return true;
+}
+
+bool EnergyLedger::loadFromFile() {
+  std::string record;
+  const bool loaded =
+      RecordStore::read(RecordStore::ENERGY_SLOT, record) && BinarySettingsIO::readEnergy(*this, record);
+  if (!loaded) {
+    accountCount = 0;
+    sleepCount = 0;
+  }
+  // Charged from reset, as nothing has been sampled yet
+  current = accountFor(BOOT_ACCOUNT);
+  LOG_DBG("NRG", "Energy ledger loaded (%u accounts, %lu sleeps)", accountCount,
+          static_cast<unsigned long>(sleepCount));
+  return loaded;
+}
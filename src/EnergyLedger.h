@@ -0,0 +1,89 @@
+#pragma once
+#include <HalDisplay.h>
+#include <HalPowerManager.h>
+
+#include <cstdint>
+#include <string>
+
+class EnergyLedger;
+namespace BinarySettingsIO {
+void writeEnergy(const EnergyLedger& ledger, std::string& out);
+bool readEnergy(EnergyLedger& ledger, const std::string& in);
+}  // namespace BinarySettingsIO
+
+/**
+ * Where the battery goes, by activity: time at each CPU frequency, WiFi-on time, SD card busy time and panel updates
+ * by refresh mode, each charged to the activity on screen while it happened. Work an activity leaves running in the
+ * background after it exits is charged to the one that follows.
+ *
+ * The activity manager calls enter() as activities change and the main loop calls sample() every pass; the HAL keeps
+ * the raw totals, which are read at most once a second. The power is cut in deep sleep, so the totals are saved to the
+ * record store on the way to sleep and keep adding up across sleeps until reset() (the energy screen's reset).
+ */
+class EnergyLedger {
+ public:
+  static constexpr uint8_t MAX_ACCOUNTS = 16;  // The last one takes all activities past it, as "Other"
+  static constexpr size_t NAME_LENGTH = 20;
+  static constexpr unsigned long SAMPLE_INTERVAL_MS = 1000;
+
+  enum Counter : uint8_t {
+    ACTIVE_MS,
+    CPU_NORMAL_MS,
+    CPU_LOW_POWER_MS,
+    CPU_BOOSTED_MS,  // Part of CPU_NORMAL_MS
+    WIFI_MS,
+    SD_BUSY_MS,
+    FULL_REFRESHES,
+    HALF_REFRESHES,
+    FAST_REFRESHES,
+    WINDOW_REFRESHES,
+    GRAY_REFRESHES,
+    COUNTER_COUNT
+  };
+
+  struct Account {
+    char name[NAME_LENGTH];
+    uint32_t counters[COUNTER_COUNT];
+  };
+
+  static EnergyLedger& getInstance() { return instance; }
+
+  // Charges everything since the last sample to the current activity, then makes name the current one
+  void enter(const char* name);
+  // Charges everything since the last sample to the current activity, if SAMPLE_INTERVAL_MS have passed
+  void sample();
+  void reset();
+
+  uint8_t getAccountCount() const { return accountCount; }
+  const Account& getAccount(uint8_t index) const { return accounts[index]; }
+  uint32_t getSleepCount() const { return sleepCount; }
+
+  // Charges the last stretch, counts the sleep and marks the record dirty; RecordStore::flush() writes it
+  bool saveForSleep();
+  bool loadFromFile();
+
+ private:
+  static EnergyLedger instance;
+
+  Account accounts[MAX_ACCOUNTS] = {};
+  uint8_t accountCount = 0;
+  uint8_t current = 0;
+  uint32_t sleepCount = 0;
+
+  // Totals at the last sample; the HAL's count from boot
+  unsigned long lastSampleMs = 0;
+  HalPowerManager::Residency lastResidency = {};
+  HalDisplay::RefreshCounts lastRefreshes;
+  uint32_t lastSdBusyMs = 0;
+  bool wifiWasOn = false;
+
+  EnergyLedger() = default;
+
+  uint8_t accountFor(const char* name);
+  void charge();
+
+  friend void BinarySettingsIO::writeEnergy(const EnergyLedger&, std::string&);
+  friend bool BinarySettingsIO::readEnergy(EnergyLedger&, const std::string&);
+};
+
+#define ENERGY_LEDGER EnergyLedger::getInstance()
@@ -6,26 +6,22 @@ class WifiCredentialStore;
 class KOReaderCredentialStore;
 class RecentBooksStore;
 
+// Reads the JSON files the stores used before RecordStore, so they can be moved into it
 namespace JsonSettingsIO {
 
 // CrossPointSettings
-bool saveSettings(const CrossPointSettings& s, const char* path);
 bool loadSettings(CrossPointSettings& s, const char* json, bool* needsResave = nullptr);
 
 // CrossPointState
-bool saveState(const CrossPointState& s, const char* path);
 bool loadState(CrossPointState& s, const char* json);
 
 // WifiCredentialStore
-bool saveWifi(const WifiCredentialStore& store, const char* path);
 bool loadWifi(WifiCredentialStore& store, const char* json, bool* needsResave = nullptr);
 
 // KOReaderCredentialStore
-bool saveKOReader(const KOReaderCredentialStore& store, const char* path);
 bool loadKOReader(KOReaderCredentialStore& store, const char* json, bool* needsResave = nullptr);
 
 // RecentBooksStore
-bool saveRecentBooks(const RecentBooksStore& store, const char* path);
 bool loadRecentBooks(RecentBooksStore& store, const char* json);
 
 }  // namespace JsonSettingsIO
@@ -0,0 +1,462 @@
+#include "LibraryDatabase.h"
+
+#include <Arduino.h>
+#include <HalStorage.h>
+#include <Logging.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+constexpr char LIBRARY_DIR[] = "/.crosspoint/library";
+constexpr char DB_FILE[] = "/.crosspoint/library/books.db";
+constexpr char PATH_INDEX_FILE[] = "/.crosspoint/library/path.idx";
+constexpr char TITLE_INDEX_FILE[] = "/.crosspoint/library/title.idx";
+constexpr char AUTHOR_INDEX_FILE[] = "/.crosspoint/library/author.idx";
+constexpr char DB_MAGIC[4] = {'L', 'D', 'B', '1'};
+constexpr char PATH_INDEX_MAGIC[4] = {'L', 'D', 'P', '1'};
+constexpr char SORTED_INDEX_MAGIC[4] = {'L', 'D', 'S', '1'};
+constexpr uint16_t DB_VERSION = 1;
+// Records appended since the path index was built are found by scanning; past this many the index is rebuilt
+constexpr uint32_t MAX_UNINDEXED_RECORDS = 32;
+// Sort keys are this many leading bytes, lowercased; books that only differ further in stay in record order
+constexpr size_t SORT_KEY_SIZE = 40;
+constexpr size_t AUTHOR_KEY_SIZE = 24;  // Author part of the AUTHOR key, followed by the title
+
+struct DbHeader {
+  char magic[4];
+  uint16_t version;
+  uint16_t recordSize;
+  uint32_t count;
+};
+static_assert(sizeof(DbHeader) == 12, "DbHeader is part of the database format");
+
+struct IndexHeader {
+  char magic[4];
+  uint32_t count;
+};
+static_assert(sizeof(IndexHeader) == 8, "IndexHeader is part of the index format");
+
+struct PathEntry {
+  uint64_t pathHash;
+  uint32_t record;
+  uint32_t reserved;
+};
+static_assert(sizeof(PathEntry) == 16, "PathEntry is part of the index format");
+
+struct SortKey {
+  uint32_t record;
+  char key[SORT_KEY_SIZE];
+};
+
+// Locks a FreeRTOS mutex for the enclosing scope
+class MutexGuard {
+  SemaphoreHandle_t mutex;
+
+ public:
+  explicit MutexGuard(SemaphoreHandle_t mutex) : mutex(mutex) { xSemaphoreTake(mutex, portMAX_DELAY); }
+  ~MutexGuard() { xSemaphoreGive(mutex); }
+  MutexGuard(const MutexGuard&) = delete;
+  MutexGuard& operator=(const MutexGuard&) = delete;
+};
+
+uint64_t hashPath(const std::string& path) {
+  uint64_t hash = 14695981039346656037ull;
+  for (const char c : path) {
+    hash = (hash ^ static_cast<uint8_t>(c)) * 1099511628211ull;
+  }
+  return hash;
+}
+
+// Copies src into a fixed field, cut at a UTF-8 character boundary and zero-padded
+void copyField(char* dst, const size_t size, const std::string& src) {
+  size_t length = std::min(src.size(), size - 1);
+  while (length > 0 && length < src.size() && (static_cast<uint8_t>(src[length]) & 0xC0) == 0x80) {
+    length--;
+  }
+  memset(dst, 0, size);
+  memcpy(dst, src.data(), length);
+}
+
+// Appends up to size bytes of a field to a sort key, lowercased
+size_t appendKey(char* key, size_t used, const char* field, const size_t size) {
+  for (size_t i = 0; i < size && used < SORT_KEY_SIZE && field[i]; i++) {
+    key[used++] = static_cast<char>(tolower(static_cast<unsigned char>(field[i])));
+  }
+  return used;
+}
+
+size_t recordOffset(const uint32_t number) {
+  return sizeof(DbHeader) + static_cast<size_t>(number) * sizeof(LibraryRecord);
+}
+
+uint32_t fileSizeOf(const std::string& path) {
+  auto file = Storage.open(path.c_str());
+  return file ? static_cast<uint32_t>(file.fileSize()) : 0;
+}
+
+bool readIndexHeader(FsFile& file, const char (&magic)[4], IndexHeader& header) {
+  return file.read(&header, sizeof(header)) == sizeof(header) && memcmp(header.magic, magic, sizeof(magic)) == 0;
+}
+
+// Writes header and body to a temporary file and moves it over path
+bool writeIndex(const char* path, const char (&magic)[4], const uint32_t count, const void* body,
+                const size_t bodySize) {
+  const std::string tempPath = std::string(path) + ".tmp";
+  FsFile file;
+  if (!Storage.openFileForWrite("LDB", tempPath, file)) {
+    return false;
+  }
+  IndexHeader header;
+  memcpy(header.magic, magic, sizeof(magic));
+  header.count = count;
+  const bool ok = file.write(&header, sizeof(header)) == sizeof(header) && file.write(body, bodySize) == bodySize;
+  file.close();
+  if (ok) {
+    Storage.remove(path);
+    if (Storage.rename(tempPath.c_str(), path)) {
+      return true;
+    }
+  }
+  Storage.remove(tempPath.c_str());
+  return false;
+}
+}  // namespace
+
+LibraryDatabase LibraryDatabase::instance;
+
+LibraryDatabase::LibraryDatabase() : mutex(xSemaphoreCreateMutex()) {}
+
+uint32_t LibraryDatabase::recordCount() {
+  FsFile file;
+  if (!Storage.exists(DB_FILE) || !Storage.openFileForRead("LDB", DB_FILE, file)) {
+    return 0;
+  }
+  DbHeader header;
+  if (file.read(&header, sizeof(header)) != sizeof(header) || memcmp(header.magic, DB_MAGIC, sizeof(DB_MAGIC)) != 0 ||
+      header.version != DB_VERSION || header.recordSize != sizeof(LibraryRecord)) {
+    return 0;
+  }
+  return header.count;
+}
+
+bool LibraryDatabase::readRecord(const uint32_t number, LibraryRecord& record) {
+  FsFile file;
+  return Storage.openFileForRead("LDB", DB_FILE, file) && file.seek(recordOffset(number)) &&
+         file.read(&record, sizeof(record)) == sizeof(record);
+}
+
+bool LibraryDatabase::writeRecord(const uint32_t number, const LibraryRecord& record) {
+  const uint32_t count = recordCount();
+  if (number > count) {
+    return false;
+  }
+  if (count == 0) {
+    // New or unreadable database: start over
+    dropSortedIndexes();
+    Storage.remove(PATH_INDEX_FILE);
+    Storage.ensureDirectoryExists(LIBRARY_DIR);
+    FsFile file;
+    DbHeader header = {{}, DB_VERSION, sizeof(LibraryRecord), 0};
+    memcpy(header.magic, DB_MAGIC, sizeof(DB_MAGIC));
+    if (!Storage.openFileForWrite("LDB", DB_FILE, file) || file.write(&header, sizeof(header)) != sizeof(header)) {
+      LOG_ERR("LDB", "Failed to create %s", DB_FILE);
+      return false;
+    }
+    file.close();
+  }
+
+  auto file = Storage.open(DB_FILE, O_RDWR);
+  bool ok = file && file.seek(recordOffset(number)) && file.write(&record, sizeof(record)) == sizeof(record);
+  if (ok && number == count) {
+    const uint32_t newCount = count + 1;
+    ok = file.seek(offsetof(DbHeader, count)) && file.write(&newCount, sizeof(newCount)) == sizeof(newCount);
+  }
+  if (!ok) {
+    LOG_ERR("LDB", "Failed to write library record %u", number);
+  }
+  return ok;
+}
+
+bool LibraryDatabase::findRecord(const std::string& path, uint32_t& number, LibraryRecord& record) {
+  const uint64_t hash = hashPath(path);
+  const uint32_t count = recordCount();
+  uint32_t indexed = 0;
+
+  FsFile index;
+  IndexHeader header;
+  if (Storage.exists(PATH_INDEX_FILE) && Storage.openFileForRead("LDB", PATH_INDEX_FILE, index) &&
+      readIndexHeader(index, PATH_INDEX_MAGIC, header) && header.count <= count) {
+    indexed = header.count;
+    // Lower bound of the hash, then every entry with it (a collision is compared by path)
+    uint32_t low = 0;
+    uint32_t high = indexed;
+    PathEntry entry;
+    while (low < high) {
+      const uint32_t mid = low + (high - low) / 2;
+      if (!index.seek(sizeof(header) + mid * sizeof(PathEntry)) || index.read(&entry, sizeof(entry)) != sizeof(entry)) {
+        return false;
+      }
+      if (entry.pathHash < hash) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    index.seek(sizeof(header) + low * sizeof(PathEntry));
+    for (; low < indexed && index.read(&entry, sizeof(entry)) == sizeof(entry) && entry.pathHash == hash; low++) {
+      if (readRecord(entry.record, record) && path == record.path) {
+        number = entry.record;
+        return true;
+      }
+    }
+  }
+  index.close();
+
+  // Records appended since the index was built
+  FsFile db;
+  if (indexed >= count || !Storage.openFileForRead("LDB", DB_FILE, db)) {
+    return false;
+  }
+  for (uint32_t i = indexed; i < count; i++) {
+    uint64_t recordHash;
+    if (!db.seek(recordOffset(i)) || db.read(&recordHash, sizeof(recordHash)) != sizeof(recordHash)) {
+      return false;
+    }
+    if (recordHash == hash && readRecord(i, record) && path == record.path) {
+      number = i;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool LibraryDatabase::putBook(const std::string& path, const std::string& title, const std::string& author,
+                              const std::string& language, const std::string& thumbPath) {
+  if (!mutex || path.empty()) {
+    return false;
+  }
+  MutexGuard guard(mutex);
+
+  LibraryRecord record;
+  uint32_t number;
+  const bool known = findRecord(path, number, record);
+  if (!known) {
+    memset(&record, 0, sizeof(record));
+    record.pathHash = hashPath(path);
+    record.progress = LibraryRecord::NO_PROGRESS;
+    copyField(record.path, sizeof(record.path), path);
+    number = recordCount();
+  }
+  // Sorted indexes only go stale if the book is new, comes back, or sorts differently
+  const bool resort = !known || (record.flags & LibraryRecord::FLAG_REMOVED) ||
+                      strncmp(record.title, title.c_str(), sizeof(record.title) - 1) != 0 ||
+                      strncmp(record.author, author.c_str(), sizeof(record.author) - 1) != 0;
+
+  record.fileSize = fileSizeOf(path);
+  record.flags &= ~LibraryRecord::FLAG_REMOVED;
+  copyField(record.title, sizeof(record.title), title);
+  copyField(record.author, sizeof(record.author), author);
+  copyField(record.language, sizeof(record.language), language);
+  copyField(record.thumbPath, sizeof(record.thumbPath), thumbPath);
+  if (!writeRecord(number, record)) {
+    return false;
+  }
+  if (resort) {
+    dropSortedIndexes();
+  }
+  if (!known && number + 1 > MAX_UNINDEXED_RECORDS) {
+    FsFile index;
+    IndexHeader header;
+    const bool indexed = Storage.exists(PATH_INDEX_FILE) && Storage.openFileForRead("LDB", PATH_INDEX_FILE, index) &&
+                         readIndexHeader(index, PATH_INDEX_MAGIC, header);
+    index.close();
+    if (!indexed || number + 1 - header.count > MAX_UNINDEXED_RECORDS) {
+      rebuildPathIndex();
+    }
+  }
+  LOG_DBG("LDB", "%s %s: %s", known ? "Updated" : "Added", path.c_str(), record.title);
+  return true;
+}
+
+bool LibraryDatabase::findBook(const std::string& path, LibraryRecord& record) {
+  if (!mutex) {
+    return false;
+  }
+  MutexGuard guard(mutex);
+  uint32_t number;
+  return findRecord(path, number, record) && !(record.flags & LibraryRecord::FLAG_REMOVED);
+}
+
+bool LibraryDatabase::hasCurrentRecord(const std::string& path) {
+  LibraryRecord record;
+  return findBook(path, record) && record.fileSize == fileSizeOf(path);
+}
+
+bool LibraryDatabase::setProgress(const std::string& path, const uint16_t progress) {
+  if (!mutex) {
+    return false;
+  }
+  MutexGuard guard(mutex);
+  LibraryRecord record;
+  uint32_t number;
+  if (!findRecord(path, number, record)) {
+    return false;
+  }
+  if (record.progress == progress) {
+    return true;
+  }
+  record.progress = progress;
+  return writeRecord(number, record);
+}
+
+void LibraryDatabase::dropSortedIndexes() {
+  if (Storage.exists(TITLE_INDEX_FILE)) {
+    Storage.remove(TITLE_INDEX_FILE);
+  }
+  if (Storage.exists(AUTHOR_INDEX_FILE)) {
+    Storage.remove(AUTHOR_INDEX_FILE);
+  }
+}
+
+bool LibraryDatabase::rebuildPathIndex() {
+  const uint32_t count = recordCount();
+  FsFile db;
+  if (count == 0 || !Storage.openFileForRead("LDB", DB_FILE, db)) {
+    return false;
+  }
+  auto* entries = static_cast<PathEntry*>(malloc(count * sizeof(PathEntry)));
+  if (!entries) {
+    LOG_ERR("LDB", "Not enough memory to index %u books", count);
+    return false;
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    entries[i] = {0, i, 0};
+    if (!db.seek(recordOffset(i)) || db.read(&entries[i].pathHash, sizeof(uint64_t)) != sizeof(uint64_t)) {
+      LOG_ERR("LDB", "Failed to read library record %u", i);
+      free(entries);
+      return false;
+    }
+  }
+  db.close();
+  std::sort(entries, entries + count,
+            [](const PathEntry& a, const PathEntry& b) { return a.pathHash < b.pathHash; });
+  const bool ok = writeIndex(PATH_INDEX_FILE, PATH_INDEX_MAGIC, count, entries, count * sizeof(PathEntry));
+  free(entries);
+  return ok;
+}
+
+bool LibraryDatabase::buildSortedIndex(const Order order) {
+  const unsigned long start = millis();
+  const uint32_t count = recordCount();
+  FsFile db;
+  if (!Storage.openFileForRead("LDB", DB_FILE, db) || !db.seek(sizeof(DbHeader))) {
+    return false;
+  }
+  auto* keys = static_cast<SortKey*>(malloc(std::max<uint32_t>(count, 1) * sizeof(SortKey)));
+  if (!keys) {
+    LOG_ERR("LDB", "Not enough memory to sort %u books", count);
+    return false;
+  }
+
+  // One sequential pass over the records, keeping only the leading bytes of the sort fields
+  uint32_t books = 0;
+  LibraryRecord record;
+  for (uint32_t i = 0; i < count; i++) {
+    if (db.read(&record, sizeof(record)) != sizeof(record)) {
+      LOG_ERR("LDB", "Failed to read library record %u", i);
+      free(keys);
+      return false;
+    }
+    if (record.flags & LibraryRecord::FLAG_REMOVED) {
+      continue;
+    }
+    SortKey& key = keys[books++];
+    memset(&key, 0, sizeof(key));
+    key.record = i;
+    size_t used = 0;
+    if (order == Order::AUTHOR) {
+      appendKey(key.key, 0, record.author, AUTHOR_KEY_SIZE);
+      used = AUTHOR_KEY_SIZE;  // Titles start at the same offset whatever the author's length
+    }
+    appendKey(key.key, used, record.title, sizeof(record.title));
+  }
+  db.close();
+
+  std::sort(keys, keys + books, [](const SortKey& a, const SortKey& b) {
+    const int cmp = memcmp(a.key, b.key, SORT_KEY_SIZE);
+    return cmp != 0 ? cmp < 0 : a.record < b.record;
+  });
+  // The record numbers replace the keys in place
+  auto* records = reinterpret_cast<uint32_t*>(keys);
+  for (uint32_t i = 0; i < books; i++) {
+    records[i] = keys[i].record;
+  }
+  const char* path = order == Order::AUTHOR ? AUTHOR_INDEX_FILE : TITLE_INDEX_FILE;
+  const bool ok = writeIndex(path, SORTED_INDEX_MAGIC, books, records, books * sizeof(uint32_t));
+  free(keys);
+  LOG_DBG("LDB", "Sorted %u books by %s in %lu ms", books, order == Order::AUTHOR ? "author" : "title",
+          millis() - start);
+  return ok;
+}
+
+size_t LibraryDatabase::getSortedCount(const Order order) {
+  if (!mutex) {
+    return 0;
+  }
+  MutexGuard guard(mutex);
+  const char* path = order == Order::AUTHOR ? AUTHOR_INDEX_FILE : TITLE_INDEX_FILE;
+  if (!Storage.exists(path) && (recordCount() == 0 || !buildSortedIndex(order))) {
+    return 0;
+  }
+  FsFile index;
+  IndexHeader header;
+  if (!Storage.openFileForRead("LDB", path, index) || !readIndexHeader(index, SORTED_INDEX_MAGIC, header)) {
+    return 0;
+  }
+  return header.count;
+}
+
+bool LibraryDatabase::getSorted(const Order order, const size_t position, LibraryRecord& record) {
+  if (!mutex) {
+    return false;
+  }
+  MutexGuard guard(mutex);
+  const char* path = order == Order::AUTHOR ? AUTHOR_INDEX_FILE : TITLE_INDEX_FILE;
+  if (!Storage.exists(path) && (recordCount() == 0 || !buildSortedIndex(order))) {
+    return false;
+  }
+  FsFile index;
+  IndexHeader header;
+  uint32_t number;
+  return Storage.openFileForRead("LDB", path, index) && readIndexHeader(index, SORTED_INDEX_MAGIC, header) &&
+         position < header.count && index.seek(sizeof(header) + position * sizeof(uint32_t)) &&
+         index.read(&number, sizeof(number)) == sizeof(number) && readRecord(number, record);
+}
+
+void LibraryDatabase::prune() {
+  if (!mutex) {
+    return;
+  }
+  MutexGuard guard(mutex);
+  const uint32_t count = recordCount();
+  LibraryRecord record;
+  uint32_t removed = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    if (!readRecord(i, record)) {
+      return;
+    }
+    if (!(record.flags & LibraryRecord::FLAG_REMOVED) && !Storage.exists(record.path)) {
+      record.flags |= LibraryRecord::FLAG_REMOVED;
+      if (writeRecord(i, record)) {
+        removed++;
+      }
+    }
+  }
+  if (removed > 0) {
+    dropSortedIndexes();
+  }
+  rebuildPathIndex();
+  LOG_DBG("LDB", "Library has %u records, %u newly removed", count, removed);
+}
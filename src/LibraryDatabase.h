@@ -0,0 +1,79 @@
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// One book of the library database. Fixed size, so a record is read or rewritten with one seek.
+struct LibraryRecord {
+  static constexpr uint16_t NO_PROGRESS = 0xFFFF;  // Never opened
+  static constexpr uint8_t FLAG_REMOVED = 0x01;    // No longer on the card; skipped by every query
+
+  uint64_t pathHash;
+  uint32_t fileSize;
+  uint16_t progress;  // Per mille, or NO_PROGRESS
+  uint8_t flags;
+  uint8_t reserved;
+  char path[192];
+  char title[128];
+  char author[96];
+  char language[16];
+  char thumbPath[64];  // As returned by getThumbBmpPath(), with the [HEIGHT] placeholder
+};
+static_assert(sizeof(LibraryRecord) == 512, "LibraryRecord is part of the database format");
+
+/**
+ * Title, author and progress of every book on the card, so screens can list and sort the library without opening
+ * any book. Filled by the library walk of ThumbnailGenerator and by the readers as books are opened.
+ *
+ * Files in /.crosspoint/library:
+ * - books.db - header (char magic[4] "LDB1", uint16_t version, uint16_t recordSize, uint32_t count), then count
+ *   LibraryRecords. Records are appended and rewritten in place, never moved.
+ * - path.idx - header (char magic[4] "LDP1", uint32_t count), then count {uint64_t pathHash, uint32_t record,
+ *   uint32_t reserved} sorted by hash. Covers the first count records; later ones are found by a scan of the tail.
+ * - title.idx, author.idx - header (char magic[4] "LDS1", uint32_t count), then the record numbers of the books in
+ *   order of title, or of author then title. Built on first use after the library changes.
+ *
+ * All methods may be called from any task.
+ */
+class LibraryDatabase {
+ public:
+  enum class Order : uint8_t { TITLE, AUTHOR };
+
+  static LibraryDatabase& getInstance() { return instance; }
+
+  // Adds the book at path, or updates its metadata and size (keeping its progress) if already known
+  bool putBook(const std::string& path, const std::string& title, const std::string& author,
+               const std::string& language, const std::string& thumbPath);
+  bool findBook(const std::string& path, LibraryRecord& record);
+  // Whether the book is known at its current size, i.e. needs no new metadata
+  bool hasCurrentRecord(const std::string& path);
+  bool setProgress(const std::string& path, uint16_t progress);
+
+  // Books in the given order; the first call after a change sorts the library into a new index
+  size_t getSortedCount(Order order);
+  bool getSorted(Order order, size_t position, LibraryRecord& record);
+
+  // Marks books no longer on the card as removed and rebuilds the path index; run after a full library walk
+  void prune();
+
+ private:
+  static LibraryDatabase instance;
+  SemaphoreHandle_t mutex = nullptr;
+
+  LibraryDatabase();
+
+  // All of the following run with the mutex held
+  uint32_t recordCount();
+  bool readRecord(uint32_t number, LibraryRecord& record);
+  bool writeRecord(uint32_t number, const LibraryRecord& record);
+  bool findRecord(const std::string& path, uint32_t& number, LibraryRecord& record);
+  bool rebuildPathIndex();
+  bool buildSortedIndex(Order order);
+  void dropSortedIndexes();
+};
+
+#define LIBRARY LibraryDatabase::getInstance()
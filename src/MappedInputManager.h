@@ -22,6 +22,8 @@ class MappedInputManager {
   bool wasAnyPressed() const;
   bool wasAnyReleased() const;
   unsigned long getHeldTime() const;
+  // micros() when the last button press was seen, for measuring input-to-display latency
+  uint32_t getPressTime() const { return gpio.getLastPressTime(); }
   Labels mapLabels(const char* back, const char* confirm, const char* previous, const char* next) const;
   // Returns the raw front button index that was pressed this frame (or -1 if none).
   int getPressedFrontButton() const;
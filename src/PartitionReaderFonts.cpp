@@ -0,0 +1,65 @@
+#include "PartitionReaderFonts.h"
+
+#include <GfxRenderer.h>
+#include <Logging.h>
+
+#include <string>
+
+#include "fontIds.h"
+
+PartitionReaderFonts PartitionReaderFonts::instance;
+
+namespace {
+struct FamilySpec {
+  int builtinId;
+  const char* name;  // Font names in the bundle are <name>_<style>, as the builtin headers are named
+};
+
+constexpr FamilySpec FAMILIES[] = {
+    {BOOKERLY_12_FONT_ID, "bookerly_12"},         {BOOKERLY_16_FONT_ID, "bookerly_16"},
+    {BOOKERLY_18_FONT_ID, "bookerly_18"},         {NOTOSANS_12_FONT_ID, "notosans_12"},
+    {NOTOSANS_14_FONT_ID, "notosans_14"},         {NOTOSANS_16_FONT_ID, "notosans_16"},
+    {NOTOSANS_18_FONT_ID, "notosans_18"},         {OPENDYSLEXIC_8_FONT_ID, "opendyslexic_8"},
+    {OPENDYSLEXIC_10_FONT_ID, "opendyslexic_10"}, {OPENDYSLEXIC_12_FONT_ID, "opendyslexic_12"},
+    {OPENDYSLEXIC_14_FONT_ID, "opendyslexic_14"},
+};
+static_assert(sizeof(FAMILIES) / sizeof(FAMILIES[0]) == PartitionReaderFonts::FAMILY_COUNT, "Family count changed");
+
+// Same order as EpdFontFamily::Style
+constexpr const char* STYLE_SUFFIXES[] = {"_regular", "_bold", "_italic", "_bolditalic"};
+}  // namespace
+
+void PartitionReaderFonts::insertFonts(GfxRenderer& renderer) {
+  if (!partition.mount()) {
+    LOG_ERR("FNP", "Reader fonts other than the default are unavailable");
+    return;
+  }
+  for (size_t i = 0; i < FAMILY_COUNT; i++) {
+    Family& family = families[i];
+    // FNV-1a over the builtin id and the style hashes, kept off 0 which means "not registered"
+    uint32_t hash = (2166136261u ^ static_cast<uint32_t>(FAMILIES[i].builtinId)) * 16777619u;
+    bool bound[4] = {};
+    for (int style = 0; style < 4; style++) {
+      const std::string name = std::string(FAMILIES[i].name) + STYLE_SUFFIXES[style];
+      bound[style] = partition.bind(family.styles[style], name.c_str());
+      hash = (hash ^ (bound[style] ? partition.getFontHash(name.c_str()) : 0)) * 16777619u;
+    }
+    if (!bound[0]) {
+      LOG_ERR("FNP", "Font partition has no %s%s", FAMILIES[i].name, STYLE_SUFFIXES[0]);
+      continue;
+    }
+    family.fontId = static_cast<int>(hash | 1u);
+    renderer.insertFont(family.fontId,
+                        EpdFontFamily(&family.styles[0], bound[1] ? &family.styles[1] : nullptr,
+                                      bound[2] ? &family.styles[2] : nullptr, bound[3] ? &family.styles[3] : nullptr));
+  }
+}
+
+int PartitionReaderFonts::resolveFontId(const int builtinId, const int fallbackId) const {
+  for (size_t i = 0; i < FAMILY_COUNT; i++) {
+    if (FAMILIES[i].builtinId == builtinId) {
+      return families[i].fontId != 0 ? families[i].fontId : fallbackId;
+    }
+  }
+  return builtinId;
+}
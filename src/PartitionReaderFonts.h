@@ -0,0 +1,42 @@
+#pragma once
+#include <EpdFont.h>
+#include <FontPartition.h>
+
+#include <cstddef>
+
+class GfxRenderer;
+
+/**
+ * The reader font families a FONTS_IN_PARTITION build keeps in the font partition (lib/EpdFont/FontPartition.h)
+ * rather than in the app image: every builtin reader family except Bookerly 14, which stays compiled in with the UI
+ * fonts so there is text to show without the partition. Uploading the font_partition env (platformio.ini) flashes it.
+ *
+ * A family's font id is derived from its builtin id and its fonts' contents, so section caches laid out before the
+ * partition was reflashed with other fonts are never mistaken for current ones. A family missing from the partition
+ * reads as the fallback family.
+ */
+class PartitionReaderFonts {
+  static PartitionReaderFonts instance;
+
+ public:
+  static constexpr size_t FAMILY_COUNT = 11;
+
+  static PartitionReaderFonts& getInstance() { return instance; }
+
+  // Maps the partition and registers every family it holds with renderer. Call once, at boot.
+  void insertFonts(GfxRenderer& renderer);
+  // The id builtinId's family is registered under: its own for families that aren't kept in the partition, fallbackId
+  // for one the partition doesn't have
+  int resolveFontId(int builtinId, int fallbackId) const;
+
+ private:
+  struct Family {
+    int fontId = 0;  // 0 unless registered
+    EpdFont styles[4] = {EpdFont(nullptr), EpdFont(nullptr), EpdFont(nullptr), EpdFont(nullptr)};
+  };
+
+  FontPartition partition;
+  Family families[FAMILY_COUNT];
+};
+
+#define PARTITION_READER_FONTS PartitionReaderFonts::getInstance()
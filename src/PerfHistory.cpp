@@ -0,0 +1,125 @@
+#include "PerfHistory.h"
+
+#include <Arduino.h>
+#include <BinarySettingsIO.h>
+#include <Logging.h>
+
+#include <cstring>
+
+#include "RecordStore.h"
+
+PerfHistory PerfHistory::instance;
+
+uint8_t PerfHistory::bucketOf(const uint32_t value) {
+  if (value == 0) {
+    return 0;
+  }
+  // Two buckets per power of two: [2^k, 1.5 * 2^k) and [1.5 * 2^k, 2^(k+1))
+  const int k = 31 - __builtin_clz(value);
+  const int upperHalf = k > 0 ? (value >> (k - 1)) & 1 : 0;
+  const int bucket = 1 + 2 * k + upperHalf;
+  return static_cast<uint8_t>(bucket < BUCKET_COUNT ? bucket : BUCKET_COUNT - 1);
+}
+
+uint32_t PerfHistory::bucketLowerBound(const uint8_t bucket) {
+  if (bucket == 0) {
+    return 0;
+  }
+  const int k = (bucket - 1) / 2;
+  const uint32_t base = 1u << k;
+  return (bucket - 1) % 2 ? base + (base >> 1) : base;
+}
+
+uint32_t PerfHistory::percentile(const Histogram& histogram, const uint8_t percent) {
+  uint32_t total = 0;
+  for (const uint16_t count : histogram.counts) {
+    total += count;
+  }
+  if (total == 0) {
+    return 0;
+  }
+  // The sample at rank ceil(total * percent / 100), counting from 1
+  const uint32_t rank = (total * percent + 99) / 100;
+  uint32_t seen = 0;
+  for (uint8_t bucket = 0; bucket < BUCKET_COUNT; bucket++) {
+    seen += histogram.counts[bucket];
+    if (seen >= rank) {
+      return bucketLowerBound(bucket);
+    }
+  }
+  return bucketLowerBound(BUCKET_COUNT - 1);
+}
+
+const char* PerfHistory::metricName(const Metric metric) {
+  switch (metric) {
+    case PAGE_TURN_MS:
+      return "pageTurnMs";
+    case INDEXING_US_PER_KB:
+      return "indexingUsPerKb";
+    case BOOT_MS:
+      return "bootMs";
+    case METRIC_COUNT:
+      break;
+  }
+  return "";
+}
+
+void PerfHistory::selectCurrentVersion() {
+  for (uint8_t i = 0; i < entryCount; i++) {
+    if (strncmp(entries[i].version, CROSSPOINT_VERSION, VERSION_LENGTH - 1) == 0) {
+      if (i > 0) {
+        const Entry entry = entries[i];
+        memmove(&entries[1], &entries[0], i * sizeof(Entry));
+        entries[0] = entry;
+      }
+      return;
+    }
+  }
+  if (entryCount < MAX_VERSIONS) {
+    entryCount++;
+  }
+  memmove(&entries[1], &entries[0], (entryCount - 1) * sizeof(Entry));
+  memset(&entries[0], 0, sizeof(Entry));
+  strncpy(entries[0].version, CROSSPOINT_VERSION, VERSION_LENGTH - 1);
+}
+
+void PerfHistory::record(const Metric metric, const uint32_t value) {
+  if (entryCount == 0) {
+    selectCurrentVersion();
+  }
+  uint16_t& count = entries[0].histograms[metric].counts[bucketOf(value)];
+  if (count < UINT16_MAX) {
+    count++;
+  }
+}
+
+void PerfHistory::recordBootDone() {
+  if (bootRecorded) {
+    return;
+  }
+  bootRecorded = true;
+  record(BOOT_MS, millis());
+}
+
+void PerfHistory::saveForSleep() {
+  if (entryCount == 0) {
+    selectCurrentVersion();
+  }
+  const uint32_t heapUsed = ESP.getHeapSize() - ESP.getMinFreeHeap();
+  if (heapUsed > entries[0].peakHeapUsed) {
+    entries[0].peakHeapUsed = heapUsed;
+  }
+  RecordStore::markDirty(RecordStore::PERF_HISTORY_SLOT);
+}
+
+bool PerfHistory::loadFromFile() {
+  std::string record;
+  const bool loaded =
+      RecordStore::read(RecordStore::PERF_HISTORY_SLOT, record) && BinarySettingsIO::readPerfHistory(*this, record);
+  if (!loaded) {
+    entryCount = 0;
+  }
+  selectCurrentVersion();
+  LOG_DBG("PRF", "Performance history loaded (%u versions)", entryCount);
+  return loaded;
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class PerfHistory;
+namespace BinarySettingsIO {
+void writePerfHistory(const PerfHistory& history, std::string& out);
+bool readPerfHistory(PerfHistory& history, const std::string& in);
+}  // namespace BinarySettingsIO
+
+/**
+ * How fast the device has been, by firmware version: histograms of page turn latency, chapter indexing time and boot
+ * time, and the peak heap use, kept for the last few versions run so an update that made reading slower shows up
+ * next to the one before it. The version is CROSSPOINT_VERSION, which in dev builds carries the git branch (see
+ * scripts/git_branch.py). The web server serves it at /api/perf.
+ *
+ * Histograms count samples in half-octave buckets, so a percentile read back is within a quarter of the true value.
+ * Samples are recorded under RenderLock, or on the main task on the way to sleep; like the energy ledger, the history
+ * is saved to the record store on the way to sleep.
+ */
+class PerfHistory {
+ public:
+  static constexpr uint8_t MAX_VERSIONS = 4;  // A new version drops the one run longest ago
+  static constexpr size_t VERSION_LENGTH = 32;
+  static constexpr uint8_t BUCKET_COUNT = 40;
+
+  enum Metric : uint8_t {
+    PAGE_TURN_MS,        // From the button press to the start of the display of the reader's page
+    INDEXING_US_PER_KB,  // Background layout of a whole chapter, per KB of its XHTML
+    BOOT_MS,             // From reset to the home screen's first frame
+    METRIC_COUNT
+  };
+
+  struct Histogram {
+    uint16_t counts[BUCKET_COUNT];  // Stop at the top rather than wrap
+  };
+
+  struct Entry {
+    char version[VERSION_LENGTH];
+    uint32_t peakHeapUsed;  // Bytes, the most any boot of the version had allocated at once
+    Histogram histograms[METRIC_COUNT];
+  };
+
+  static PerfHistory& getInstance() { return instance; }
+
+  void record(Metric metric, uint32_t value);
+  // Records the time since reset as BOOT_MS, the first time only
+  void recordBootDone();
+  // For a boot to another screen than home, which would have recordBootDone() count the time until home is opened
+  void skipBootTime() { bootRecorded = true; }
+  // Takes the boot's peak heap use and marks the record dirty; RecordStore::flush() writes it
+  void saveForSleep();
+  bool loadFromFile();
+
+  // This firmware's entry comes first, then the versions run before it, latest first
+  uint8_t getEntryCount() const { return entryCount; }
+  const Entry& getEntry(const uint8_t index) const { return entries[index]; }
+
+  static uint8_t bucketOf(uint32_t value);
+  static uint32_t bucketLowerBound(uint8_t bucket);
+  // Lower bound of the bucket holding the given percentile of the samples; 0 without samples
+  static uint32_t percentile(const Histogram& histogram, uint8_t percent);
+  static const char* metricName(Metric metric);
+
+ private:
+  static PerfHistory instance;
+
+  Entry entries[MAX_VERSIONS] = {};
+  uint8_t entryCount = 0;
+  bool bootRecorded = false;
+
+  PerfHistory() = default;
+
+  // Puts this firmware's entry first, making it if it is new
+  void selectCurrentVersion();
+
+  friend void BinarySettingsIO::writePerfHistory(const PerfHistory&, std::string&);
+  friend bool BinarySettingsIO::readPerfHistory(PerfHistory&, const std::string&);
+};
+
+#define PERF_HISTORY PerfHistory::getInstance()
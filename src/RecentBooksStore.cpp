@@ -1,5 +1,7 @@
 #include "RecentBooksStore.h"
 
+#include <BinarySettingsIO.h>
+#include <Cbz.h>
 #include <Epub.h>
 #include <FsHelpers.h>
 #include <HalStorage.h>
@@ -10,6 +12,9 @@
 
 #include <algorithm>
 
+#include "LibraryDatabase.h"
+#include "RecordStore.h"
+
 namespace {
 constexpr uint8_t RECENT_BOOKS_FILE_VERSION = 3;
 constexpr char RECENT_BOOKS_FILE_BIN[] = "/.crosspoint/recent.bin";
@@ -22,15 +27,19 @@ RecentBooksStore RecentBooksStore::instance;
 
 void RecentBooksStore::addBook(const std::string& path, const std::string& title, const std::string& author,
                                const std::string& coverBmpPath) {
-  // Remove existing entry if present
+  // Remove existing entry if present, keeping what is known of its thumbnail
+  uint16_t thumbHeight = 0;
   auto it =
       std::find_if(recentBooks.begin(), recentBooks.end(), [&](const RecentBook& book) { return book.path == path; });
   if (it != recentBooks.end()) {
+    if (it->coverBmpPath == coverBmpPath) {
+      thumbHeight = it->thumbHeight;
+    }
     recentBooks.erase(it);
   }
 
   // Add to front
-  recentBooks.insert(recentBooks.begin(), {path, title, author, coverBmpPath});
+  recentBooks.insert(recentBooks.begin(), {path, title, author, coverBmpPath, thumbHeight});
 
   // Trim to max size
   if (recentBooks.size() > MAX_RECENT_BOOKS) {
@@ -48,14 +57,26 @@ void RecentBooksStore::updateBook(const std::string& path, const std::string& ti
     RecentBook& book = *it;
     book.title = title;
     book.author = author;
-    book.coverBmpPath = coverBmpPath;
+    if (book.coverBmpPath != coverBmpPath) {
+      book.coverBmpPath = coverBmpPath;
+      book.thumbHeight = 0;
+    }
+    saveToFile();
+  }
+}
+
+void RecentBooksStore::setThumbHeight(const std::string& path, const uint16_t thumbHeight) {
+  auto it =
+      std::find_if(recentBooks.begin(), recentBooks.end(), [&](const RecentBook& book) { return book.path == path; });
+  if (it != recentBooks.end() && it->thumbHeight != thumbHeight) {
+    it->thumbHeight = thumbHeight;
     saveToFile();
   }
 }
 
 bool RecentBooksStore::saveToFile() const {
-  Storage.mkdir("/.crosspoint");
-  return JsonSettingsIO::saveRecentBooks(*this, RECENT_BOOKS_FILE_JSON);
+  RecordStore::markDirty(RecordStore::RECENT_BOOKS_SLOT);
+  return true;
 }
 
 RecentBook RecentBooksStore::getDataFromBook(std::string path) const {
@@ -70,9 +91,14 @@ RecentBook RecentBooksStore::getDataFromBook(std::string path) const {
   // If epub, try to load the metadata for title/author and cover.
   // Use buildIfMissing=false to avoid heavy epub loading on boot; getTitle()/getAuthor() may be
   // blank until the book is opened, and entries with missing title are omitted from recent list.
-  if (FsHelpers::hasEpubExtension(lastBookFileName)) {
+  if (FsHelpers::hasEpubExtension(lastBookFileName) || FsHelpers::hasFb2Extension(lastBookFileName)) {
     Epub epub(path, "/.crosspoint");
-    epub.load(false, true);
+    epub.load(false);
+    LibraryRecord record;
+    if (epub.getTitle().empty() && LIBRARY.findBook(path, record)) {
+      // Metadata cache cleared since, but the library scan has seen the book
+      return RecentBook{path, record.title, record.author, record.thumbPath};
+    }
     return RecentBook{path, epub.getTitle(), epub.getAuthor(), epub.getThumbBmpPath()};
   } else if (FsHelpers::hasXtcExtension(lastBookFileName)) {
     // Handle XTC file
@@ -82,16 +108,27 @@ RecentBook RecentBooksStore::getDataFromBook(std::string path) const {
     }
   } else if (FsHelpers::hasTxtExtension(lastBookFileName) || FsHelpers::hasMarkdownExtension(lastBookFileName)) {
     return RecentBook{path, lastBookFileName, "", ""};
+  } else if (FsHelpers::hasCbzExtension(lastBookFileName)) {
+    return RecentBook{path, Cbz(path, "/.crosspoint").getTitle(), "", ""};
   }
   return RecentBook{path, "", "", ""};
 }
 
 bool RecentBooksStore::loadFromFile() {
-  // Try JSON first
+  std::string record;
+  if (RecordStore::read(RecordStore::RECENT_BOOKS_SLOT, record) && BinarySettingsIO::readRecentBooks(*this, record)) {
+    return true;
+  }
+
+  // List from before the record store, moved into it on the next flush
   if (Storage.exists(RECENT_BOOKS_FILE_JSON)) {
     String json = Storage.readFile(RECENT_BOOKS_FILE_JSON);
     if (!json.isEmpty()) {
-      return JsonSettingsIO::loadRecentBooks(*this, json.c_str());
+      const bool result = JsonSettingsIO::loadRecentBooks(*this, json.c_str());
+      if (result) {
+        saveToFile();
+      }
+      return result;
     }
   }
 
@@ -99,8 +136,9 @@ bool RecentBooksStore::loadFromFile() {
   if (Storage.exists(RECENT_BOOKS_FILE_BIN)) {
     if (loadFromBinaryFile()) {
       saveToFile();
+      RecordStore::flush();
       Storage.rename(RECENT_BOOKS_FILE_BIN, RECENT_BOOKS_FILE_BAK);
-      LOG_DBG("RBS", "Migrated recent.bin to recent.json");
+      LOG_DBG("RBS", "Migrated recent.bin to the record store");
       return true;
     }
   }
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -7,6 +8,9 @@ struct RecentBook {
   std::string title;
   std::string author;
   std::string coverBmpPath;
+  // Cover height of the thumbnail last found on the card, 0 if none was. The home screen keys its cover cache on it
+  // instead of looking for every thumbnail before it can draw, and checks it once it has.
+  uint16_t thumbHeight = 0;
 
   bool operator==(const RecentBook& other) const { return path == other.path; }
 };
@@ -15,6 +19,9 @@ class RecentBooksStore;
 namespace JsonSettingsIO {
 bool loadRecentBooks(RecentBooksStore& store, const char* json);
 }  // namespace JsonSettingsIO
+namespace BinarySettingsIO {
+bool readRecentBooks(RecentBooksStore& store, const std::string& in);
+}  // namespace BinarySettingsIO
 
 class RecentBooksStore {
   // Static instance
@@ -23,6 +30,7 @@ class RecentBooksStore {
   std::vector<RecentBook> recentBooks;
 
   friend bool JsonSettingsIO::loadRecentBooks(RecentBooksStore&, const char*);
+  friend bool BinarySettingsIO::readRecentBooks(RecentBooksStore&, const std::string&);
 
  public:
   ~RecentBooksStore() = default;
@@ -37,12 +45,16 @@ class RecentBooksStore {
   void updateBook(const std::string& path, const std::string& title, const std::string& author,
                   const std::string& coverBmpPath);
 
+  // Records whether the book's thumbnail at a cover height is on the card (0: it isn't)
+  void setThumbHeight(const std::string& path, uint16_t thumbHeight);
+
   // Get the list of recent books (most recent first)
   const std::vector<RecentBook>& getBooks() const { return recentBooks; }
 
   // Get the count of recent books
   int getCount() const { return static_cast<int>(recentBooks.size()); }
 
+  // Marks the record dirty; RecordStore::flush() writes it
   bool saveToFile() const;
 
   bool loadFromFile();
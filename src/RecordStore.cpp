@@ -0,0 +1,176 @@
+#include "RecordStore.h"
+
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include "BinarySettingsIO.h"
+#include "CrossPointSettings.h"
+#include "CrossPointState.h"
+#include "EnergyLedger.h"
+#include "KOReaderCredentialStore.h"
+#include "PerfHistory.h"
+#include "RecentBooksStore.h"
+#include "WifiCredentialStore.h"
+
+namespace {
+constexpr uint32_t STORE_MAGIC = 0x31535043;  // "CPS1"
+constexpr uint8_t STORE_FILE_VERSION = 1;
+constexpr char STORE_FILE[] = "/.crosspoint/store.bin";
+constexpr char STORE_FILE_TMP[] = "/.crosspoint/store.tmp";
+// Largest record is the recent books list, well under this; anything bigger means a damaged file
+constexpr uint32_t MAX_RECORD_SIZE = 16 * 1024;
+
+struct SlotHeader {
+  uint8_t id;
+  uint32_t length;
+  uint32_t checksum;
+};
+
+// FNV-1a over the payload
+uint32_t checksumOf(const std::string& payload) {
+  uint32_t hash = 2166136261u;
+  for (const char c : payload) {
+    hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+  }
+  return hash;
+}
+
+// flush() removes the old file only once the new one is complete, so a new file without an old one is whole: a power
+// cut came between the remove and the rename
+void recoverInterruptedSwap() {
+  if (!Storage.exists(STORE_FILE) && Storage.exists(STORE_FILE_TMP)) {
+    LOG_INF("RST", "Recovering record store from %s", STORE_FILE_TMP);
+    Storage.rename(STORE_FILE_TMP, STORE_FILE);
+  }
+}
+
+template <typename T>
+bool writeAll(FsFile& file, const T& value) {
+  return file.write(&value, sizeof(T)) == sizeof(T);
+}
+
+bool readSlot(FsFile& file, const RecordStore::Slot slot, std::string& payload) {
+  uint32_t magic = 0;
+  uint8_t version = 0;
+  serialization::readPod(file, magic);
+  serialization::readPod(file, version);
+  if (magic != STORE_MAGIC || version != STORE_FILE_VERSION) {
+    LOG_ERR("RST", "Unknown record store format");
+    return false;
+  }
+
+  while (file.available() > 0) {
+    SlotHeader header;
+    serialization::readPod(file, header.id);
+    serialization::readPod(file, header.length);
+    serialization::readPod(file, header.checksum);
+    if (header.length > MAX_RECORD_SIZE || static_cast<uint32_t>(file.available()) < header.length) {
+      LOG_ERR("RST", "Record store truncated at slot %u", header.id);
+      return false;
+    }
+    if (header.id != slot) {
+      file.seekCur(header.length);
+      continue;
+    }
+    payload.resize(header.length);
+    if (header.length > 0 &&
+        file.read(reinterpret_cast<uint8_t*>(&payload[0]), header.length) != static_cast<int>(header.length)) {
+      return false;
+    }
+    if (checksumOf(payload) != header.checksum) {
+      LOG_ERR("RST", "Checksum mismatch in slot %u", header.id);
+      return false;
+    }
+    return true;
+  }
+  return false;
+}
+}  // namespace
+
+uint8_t RecordStore::dirty = 0;
+
+bool RecordStore::read(const Slot slot, std::string& payload) {
+  recoverInterruptedSwap();
+  FsFile file;
+  if (!Storage.exists(STORE_FILE) || !Storage.openFileForRead("RST", STORE_FILE, file)) {
+    return false;
+  }
+  return readSlot(file, slot, payload);
+}
+
+void RecordStore::serialize(const Slot slot, std::string& payload) {
+  switch (slot) {
+    case SETTINGS_SLOT:
+      BinarySettingsIO::writeSettings(SETTINGS, payload);
+      break;
+    case STATE_SLOT:
+      BinarySettingsIO::writeState(APP_STATE, payload);
+      break;
+    case RECENT_BOOKS_SLOT:
+      BinarySettingsIO::writeRecentBooks(RECENT_BOOKS, payload);
+      break;
+    case WIFI_SLOT:
+      BinarySettingsIO::writeWifi(WIFI_STORE, payload);
+      break;
+    case KOREADER_SLOT:
+      BinarySettingsIO::writeKOReader(KOREADER_STORE, payload);
+      break;
+    case ENERGY_SLOT:
+      BinarySettingsIO::writeEnergy(ENERGY_LEDGER, payload);
+      break;
+    case PERF_HISTORY_SLOT:
+      BinarySettingsIO::writePerfHistory(PERF_HISTORY, payload);
+      break;
+    case SLOT_COUNT:
+      break;
+  }
+}
+
+bool RecordStore::flush() {
+  if (!dirty) {
+    return true;
+  }
+
+  Storage.mkdir("/.crosspoint");
+  recoverInterruptedSwap();  // Before the new file is opened over it
+  FsFile file;
+  if (!Storage.openFileForWrite("RST", STORE_FILE_TMP, file)) {
+    return false;
+  }
+  bool ok = writeAll(file, STORE_MAGIC) && writeAll(file, STORE_FILE_VERSION);
+
+  int written = 0;
+  for (uint8_t i = 0; ok && i < SLOT_COUNT; i++) {
+    const auto slot = static_cast<Slot>(i);
+    // Clean slots are copied from the current file: a store that was never loaded (WiFi credentials until the WiFi
+    // screen is opened) must not be written out empty
+    std::string payload;
+    if (dirty & (1u << slot)) {
+      serialize(slot, payload);
+    } else if (!read(slot, payload)) {
+      continue;
+    }
+    ok = writeAll(file, static_cast<uint8_t>(slot)) && writeAll(file, static_cast<uint32_t>(payload.size())) &&
+         writeAll(file, checksumOf(payload)) && file.write(payload.data(), payload.size()) == payload.size();
+    written++;
+  }
+  ok = file.close() && ok;
+  if (!ok) {
+    // A short write (full card) must not replace a good file; the slots stay dirty for the next flush
+    LOG_ERR("RST", "Failed to write record store");
+    Storage.remove(STORE_FILE_TMP);
+    return false;
+  }
+
+  // Written aside and swapped in only once complete. FAT has no atomic replace, so a power cut between the remove and
+  // the rename leaves just the new file, which read() then moves into place.
+  Storage.remove(STORE_FILE);
+  if (!Storage.rename(STORE_FILE_TMP, STORE_FILE)) {
+    LOG_ERR("RST", "Failed to replace record store");
+    return false;
+  }
+  LOG_DBG("RST", "Wrote %d records (dirty mask 0x%02x)", written, dirty);
+  dirty = 0;
+  return true;
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+/**
+ * Single file (/.crosspoint/store.bin) holding the binary records of the settings, state and credential stores, one
+ * checksummed slot each.
+ *
+ * Stores mark their slot dirty when they change instead of writing right away. flush() rewrites the file once for all
+ * dirty slots, copying the others over as they are; the activity manager calls it when an activity exits and main
+ * before deep sleep, so a settings screen changing five options costs one write. A slot whose checksum does not match
+ * is ignored and its store falls back to its legacy JSON file, then to defaults.
+ */
+class RecordStore {
+ public:
+  enum Slot : uint8_t {
+    SETTINGS_SLOT,
+    STATE_SLOT,
+    RECENT_BOOKS_SLOT,
+    WIFI_SLOT,
+    KOREADER_SLOT,
+    ENERGY_SLOT,
+    PERF_HISTORY_SLOT,
+    SLOT_COUNT
+  };
+
+  // Reads the payload of a slot; false if the file, the slot or its checksum is missing or bad
+  static bool read(Slot slot, std::string& payload);
+
+  static void markDirty(Slot slot) { dirty |= static_cast<uint8_t>(1u << slot); }
+  static bool isDirty() { return dirty != 0; }
+
+  // Writes all dirty slots; does nothing when none are
+  static bool flush();
+
+ private:
+  // Serializes the in-memory store behind a slot
+  static void serialize(Slot slot, std::string& payload);
+
+  static uint8_t dirty;
+};
@@ -0,0 +1,77 @@
+#include "SdReaderFont.h"
+
+#include <FontCacheManager.h>
+#include <GfxRenderer.h>
+#include <Logging.h>
+
+#include <string>
+
+#include "CrossPointSettings.h"
+
+SdReaderFont SdReaderFont::instance;
+
+namespace {
+// Same order as CrossPointSettings::FONT_SIZE
+constexpr const char* SIZE_DIRS[] = {"small", "medium", "large", "xlarge"};
+// Same order as EpdFontFamily::Style
+constexpr const char* STYLE_FILES[] = {"regular", "bold", "italic", "bolditalic"};
+}  // namespace
+
+void SdReaderFont::release(GfxRenderer& renderer) {
+  if (fontId != 0) {
+    renderer.removeFont(fontId);
+    fontId = 0;
+  }
+  // Decompressed groups and page buffers are keyed by the EpdFontData about to be freed
+  if (auto* fcm = renderer.getFontCacheManager()) {
+    fcm->clearCache();
+    fcm->releaseMemory();
+  }
+  for (auto& style : styles) {
+    style.unload();
+  }
+  loadedSize = UINT8_MAX;
+}
+
+void SdReaderFont::sync(GfxRenderer& renderer) {
+  const bool wanted = SETTINGS.fontFamily == CrossPointSettings::SD_CARD;
+  if (!wanted) {
+    if (loadedSize != UINT8_MAX) {
+      release(renderer);
+    }
+    return;
+  }
+  if (loadedSize == SETTINGS.fontSize) {
+    return;
+  }
+
+  release(renderer);
+  loadedSize = SETTINGS.fontSize;  // Also marks a failed load as attempted, so it isn't retried on every open
+  if (SETTINGS.fontSize >= sizeof(SIZE_DIRS) / sizeof(SIZE_DIRS[0])) {
+    return;
+  }
+
+  const std::string dir = std::string(FONT_DIR) + "/" + SIZE_DIRS[SETTINGS.fontSize] + "/";
+  for (int i = 0; i < 4; i++) {
+    const std::string path = dir + STYLE_FILES[i] + ".epdfont";
+    if (i > 0 && !Storage.exists(path.c_str())) {
+      continue;
+    }
+    if (!styles[i].load(path.c_str()) && i == 0) {
+      LOG_ERR("SDF", "No reader font in %s, using the builtin one", dir.c_str());
+      return;
+    }
+  }
+
+  // FNV-1a over the style hashes and the size, kept off 0 which means "not loaded"
+  uint32_t hash = 2166136261u;
+  for (const auto& style : styles) {
+    hash = (hash ^ style.getContentHash()) * 16777619u;
+  }
+  hash = (hash ^ SETTINGS.fontSize) * 16777619u;
+  fontId = static_cast<int>(hash | 1u);
+
+  renderer.insertFont(fontId, EpdFontFamily(styles[0].getFont(), styles[1].getFont(), styles[2].getFont(),
+                                            styles[3].getFont()));
+  LOG_INF("SDF", "Using reader font from %s (id %d)", dir.c_str(), fontId);
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <SdFont.h>
+
+#include <cstdint>
+
+class GfxRenderer;
+
+/**
+ * The reader font family kept on the SD card, used when the font family setting is SD_CARD. One directory per font
+ * size setting under FONT_DIR holds the styles as produced by lib/EpdFont/scripts/build_sd_font.py:
+ *
+ *   /fonts/medium/regular.epdfont      (required)
+ *   /fonts/medium/bold.epdfont, italic.epdfont, bolditalic.epdfont      (optional, fall back like builtin families)
+ *
+ * Only the family for the current size is loaded. Its font id is derived from the file contents, so section caches
+ * built with a different font file are never mistaken for current ones.
+ */
+class SdReaderFont {
+  static SdReaderFont instance;
+
+  SdFont styles[4];  // Indexed by EpdFontFamily::Style
+  int fontId = 0;    // 0 while nothing is loaded
+  uint8_t loadedSize = UINT8_MAX;
+
+ public:
+  static constexpr const char* FONT_DIR = "/fonts";
+
+  static SdReaderFont& getInstance() { return instance; }
+
+  // Loads or unloads the family to match the font settings. Call before the reader lays out or renders anything.
+  void sync(GfxRenderer& renderer);
+  // Frees the family (its tables take RAM) when leaving the reader
+  void release(GfxRenderer& renderer);
+  bool isLoaded() const { return fontId != 0; }
+  int getFontId() const { return fontId; }
+};
+
+#define SD_READER_FONT SdReaderFont::getInstance()
@@ -1,11 +1,14 @@
 #include "WifiCredentialStore.h"
 
+#include <BinarySettingsIO.h>
 #include <HalStorage.h>
 #include <JsonSettingsIO.h>
 #include <Logging.h>
 #include <ObfuscationUtils.h>
 #include <Serialization.h>
 
+#include "RecordStore.h"
+
 // Initialize the static instance
 WifiCredentialStore WifiCredentialStore::instance;
 
@@ -30,19 +33,22 @@ void legacyDeobfuscate(std::string& data) {
 }  // namespace
 
 bool WifiCredentialStore::saveToFile() const {
-  Storage.mkdir("/.crosspoint");
-  return JsonSettingsIO::saveWifi(*this, WIFI_FILE_JSON);
+  RecordStore::markDirty(RecordStore::WIFI_SLOT);
+  return true;
 }
 
 bool WifiCredentialStore::loadFromFile() {
-  // Try JSON first
+  std::string record;
+  if (RecordStore::read(RecordStore::WIFI_SLOT, record) && BinarySettingsIO::readWifi(*this, record)) {
+    return true;
+  }
+
+  // Credentials from before the record store, moved into it on the next flush
   if (Storage.exists(WIFI_FILE_JSON)) {
     String json = Storage.readFile(WIFI_FILE_JSON);
     if (!json.isEmpty()) {
-      bool resave = false;
-      bool result = JsonSettingsIO::loadWifi(*this, json.c_str(), &resave);
-      if (result && resave) {
-        LOG_DBG("WCS", "Resaving JSON with obfuscated passwords");
+      const bool result = JsonSettingsIO::loadWifi(*this, json.c_str());
+      if (result) {
         saveToFile();
       }
       return result;
@@ -52,9 +58,10 @@ bool WifiCredentialStore::loadFromFile() {
   // Fall back to binary migration
   if (Storage.exists(WIFI_FILE_BIN)) {
     if (loadFromBinaryFile()) {
-      if (saveToFile()) {
+      saveToFile();
+      if (RecordStore::flush()) {
         Storage.rename(WIFI_FILE_BIN, WIFI_FILE_BAK);
-        LOG_DBG("WCS", "Migrated wifi.bin to wifi.json");
+        LOG_DBG("WCS", "Migrated wifi.bin to the record store");
         return true;
       } else {
         LOG_ERR("WCS", "Failed to save wifi during migration");
@@ -148,6 +155,15 @@ const WifiCredential* WifiCredentialStore::findCredential(const std::string& ssi
   return nullptr;
 }
 
+void WifiCredentialStore::setConnectionInfo(const std::string& ssid, const WifiConnectionInfo& info) {
+  const auto cred = find_if(credentials.begin(), credentials.end(),
+                            [&ssid](const WifiCredential& cred) { return cred.ssid == ssid; });
+  if (cred != credentials.end() && !(cred->lastConnection == info)) {
+    cred->lastConnection = info;
+    saveToFile();
+  }
+}
+
 bool WifiCredentialStore::hasSavedCredential(const std::string& ssid) const { return findCredential(ssid) != nullptr; }
 
 void WifiCredentialStore::setLastConnectedSsid(const std::string& ssid) {
@@ -1,22 +1,40 @@
 #pragma once
+#include <cstdint>
+#include <cstring>
 #include <string>
 #include <vector>
 
+// Where a saved network was last joined, so the next connection can go straight to that access point instead of
+// scanning every channel. channel 0 if unknown. The address still comes from DHCP: a lease reused as a static address
+// outlives its expiry, and the router may have given it to another device. Stored as is in the WiFi record.
+struct WifiConnectionInfo {
+  uint8_t bssid[6] = {};
+  uint8_t channel = 0;
+  uint8_t reserved = 0;
+
+  bool known() const { return channel != 0; }
+  bool operator==(const WifiConnectionInfo& other) const { return memcmp(this, &other, sizeof(*this)) == 0; }
+};
+
 struct WifiCredential {
   std::string ssid;
   std::string password;  // Plaintext in memory; obfuscated with hardware key on disk
+  WifiConnectionInfo lastConnection;
 };
 
 class WifiCredentialStore;
 namespace JsonSettingsIO {
-bool saveWifi(const WifiCredentialStore& store, const char* path);
 bool loadWifi(WifiCredentialStore& store, const char* json, bool* needsResave);
 }  // namespace JsonSettingsIO
+namespace BinarySettingsIO {
+void writeWifi(const WifiCredentialStore& store, std::string& out);
+bool readWifi(WifiCredentialStore& store, const std::string& in);
+}  // namespace BinarySettingsIO
 
 /**
  * Singleton class for storing WiFi credentials on the SD card.
  * Passwords are XOR-obfuscated with the device's unique hardware MAC address
- * and base64-encoded before writing to JSON (not cryptographically secure,
+ * before they are written to the record store (not cryptographically secure,
  * but prevents casual reading and ties credentials to the specific device).
  */
 class WifiCredentialStore {
@@ -32,8 +50,9 @@ class WifiCredentialStore {
 
   bool loadFromBinaryFile();
 
-  friend bool JsonSettingsIO::saveWifi(const WifiCredentialStore&, const char*);
   friend bool JsonSettingsIO::loadWifi(WifiCredentialStore&, const char*, bool*);
+  friend void BinarySettingsIO::writeWifi(const WifiCredentialStore&, std::string&);
+  friend bool BinarySettingsIO::readWifi(WifiCredentialStore&, const std::string&);
 
  public:
   // Delete copy constructor and assignment
@@ -43,7 +62,7 @@ class WifiCredentialStore {
   // Get singleton instance
   static WifiCredentialStore& getInstance() { return instance; }
 
-  // Save/load from SD card
+  // Marks the record dirty; RecordStore::flush() writes it
   bool saveToFile() const;
   bool loadFromFile();
 
@@ -58,6 +77,9 @@ class WifiCredentialStore {
   // Check if a network is saved
   bool hasSavedCredential(const std::string& ssid) const;
 
+  // Remembers how a saved network was joined; no-op for a network that isn't saved
+  void setConnectionInfo(const std::string& ssid, const WifiConnectionInfo& info);
+
   // Last connected network
   void setLastConnectedSsid(const std::string& ssid);
   const std::string& getLastConnectedSsid() const;
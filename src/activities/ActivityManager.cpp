@@ -1,6 +1,12 @@
 #include "ActivityManager.h"
 
 #include <HalPowerManager.h>
+#include <MemoryBudget.h>
+#include <XmlParserUtils.h>
+
+#include "EnergyLedger.h"
+#include "RecordStore.h"
+#include "util/ResourceMonitor.h"
 
 #include "boot_sleep/BootActivity.h"
 #include "boot_sleep/SleepActivity.h"
@@ -14,6 +20,14 @@
 #include "settings/SettingsActivity.h"
 #include "util/FullScreenMessageActivity.h"
 
+namespace {
+// Closes the outgoing activity's accounts before the next one runs
+void accountActivityChange(const std::string& name) {
+  ENERGY_LEDGER.enter(name.c_str());
+  ResourceMonitor::enter(name.c_str());
+}
+}  // namespace
+
 void ActivityManager::begin() {
   xTaskCreate(&renderTaskTrampoline, "ActivityManagerRender",
               8192,              // Stack size
@@ -22,6 +36,8 @@ void ActivityManager::begin() {
               &renderTaskHandle  // Task handle
   );
   assert(renderTaskHandle != nullptr && "Failed to create render task");
+  // The caches registered with MemoryBudget are the render path's, all used under RenderLock
+  MemoryBudget::setCacheLockCheck(&RenderLock::heldByCurrentTask);
 }
 
 void ActivityManager::renderTaskTrampoline(void* param) {
@@ -32,6 +48,7 @@ void ActivityManager::renderTaskTrampoline(void* param) {
 void ActivityManager::renderTaskLoop() {
   while (true) {
     ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    renderingRequestCount = updateRequestCount;
     // Acquire the lock before reading currentActivity to avoid a TOCTOU race
     // where the main task deletes the activity between the null-check and render().
     RenderLock lock;
@@ -52,6 +69,9 @@ void ActivityManager::renderTaskLoop() {
 }
 
 void ActivityManager::loop() {
+  if (mappedInput.wasAnyPressed()) {
+    renderer.markInput(mappedInput.getPressTime());
+  }
   if (currentActivity) {
     // Note: do not hold a lock here, the loop() method must be responsible for acquire one if needed
     currentActivity->loop();
@@ -83,6 +103,7 @@ void ActivityManager::loop() {
       } else {
         currentActivity = std::move(stackActivities.back());
         stackActivities.pop_back();
+        accountActivityChange(currentActivity->name);
         LOG_DBG("ACT", "Popped from activity stack, new size = %zu", stackActivities.size());
         // Handle result if necessary
         if (currentActivity->resultHandler) {
@@ -116,6 +137,9 @@ void ActivityManager::loop() {
           stackActivities.back()->onExit();
           stackActivities.pop_back();
         }
+        RecordStore::flush();
+        // Nothing parses XML between activities; hand the shared parser's arena back to the heap
+        releaseSharedXmlParser();
       } else if (pendingAction == PendingAction::Push) {
         // Move current activity to stack
         stackActivities.push_back(std::move(currentActivity));
@@ -123,6 +147,7 @@ void ActivityManager::loop() {
       }
       pendingAction = PendingAction::None;
       currentActivity = std::move(pendingActivity);
+      accountActivityChange(currentActivity->name);
 
       lock.unlock();  // onEnter may acquire its own lock
       currentActivity->onEnter();
@@ -134,11 +159,7 @@ void ActivityManager::loop() {
 
   if (requestedUpdate) {
     requestedUpdate = false;
-    // Using direct notification to signal the render task to update
-    // Increment counter so multiple rapid calls won't be lost
-    if (renderTaskHandle) {
-      xTaskNotify(renderTaskHandle, 1, eIncrement);
-    }
+    notifyRenderTask();
   }
 }
 
@@ -148,6 +169,8 @@ void ActivityManager::exitActivity(const RenderLock& lock) {
     currentActivity->onExit();
     currentActivity.reset();
   }
+  // Whatever the activity changed in settings and state goes to the SD card in one write
+  RecordStore::flush();
 }
 
 void ActivityManager::replaceActivity(std::unique_ptr<Activity>&& newActivity) {
@@ -160,6 +183,7 @@ void ActivityManager::replaceActivity(std::unique_ptr<Activity>&& newActivity) {
   } else {
     // No current activity, safe to launch immediately
     currentActivity = std::move(newActivity);
+    accountActivityChange(currentActivity->name);
     currentActivity->onEnter();
   }
 }
@@ -228,9 +252,7 @@ bool ActivityManager::skipLoopDelay() const { return currentActivity && currentA
 
 void ActivityManager::requestUpdate(bool immediate) {
   if (immediate) {
-    if (renderTaskHandle) {
-      xTaskNotify(renderTaskHandle, 1, eIncrement);
-    }
+    notifyRenderTask();
   } else {
     // Deferring the update until current loop is finished
     // This is to avoid multiple updates being requested in the same loop
@@ -263,10 +285,20 @@ void ActivityManager::requestUpdateAndWait() {
   // Cannot call while holding RenderLock or it will cause a deadlock
   assert(!holdingRenderLock && "Cannot call requestUpdateAndWait() while holding RenderLock");
 
-  xTaskNotify(renderTaskHandle, 1, eIncrement);
+  notifyRenderTask();
   ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
 }
 
+void ActivityManager::notifyRenderTask() {
+  if (!renderTaskHandle) {
+    return;
+  }
+  updateRequestCount = updateRequestCount + 1;
+  // Using direct notification to signal the render task to update
+  // Increment counter so multiple rapid calls won't be lost
+  xTaskNotify(renderTaskHandle, 1, eIncrement);
+}
+
 // RenderLock
 
 RenderLock::RenderLock() {
@@ -279,6 +311,10 @@ RenderLock::RenderLock([[maybe_unused]] Activity&) {
   isLocked = true;
 }
 
+RenderLock::RenderLock(const unsigned long timeoutMs) {
+  isLocked = xSemaphoreTake(activityManager.renderingMutex, pdMS_TO_TICKS(timeoutMs)) == pdTRUE;
+}
+
 RenderLock::~RenderLock() {
   if (isLocked) {
     xSemaphoreGive(activityManager.renderingMutex);
@@ -300,4 +336,8 @@ void RenderLock::unlock() {
  * @return true if renderingMutex is busy, otherwise false.
  *
  */
+bool RenderLock::heldByCurrentTask() {
+  return xSemaphoreGetMutexHolder(activityManager.renderingMutex) == xTaskGetCurrentTaskHandle();
+}
+
 bool RenderLock::peek() { return xQueuePeek(activityManager.renderingMutex, NULL, 0) != pdTRUE; };
@@ -43,13 +43,19 @@ class ActivityManager {
   // Pending activity to be launched on next loop iteration
   std::unique_ptr<Activity> pendingActivity;
   enum class PendingAction { None, Push, Pop, Replace };
-  PendingAction pendingAction = PendingAction::None;
+  // Set by the main loop; the render task reads it through isTransitionPending()
+  volatile PendingAction pendingAction = PendingAction::None;
 
   // Task to render and display the activity
   TaskHandle_t renderTaskHandle = nullptr;
   static void renderTaskTrampoline(void* param);
   [[noreturn]] virtual void renderTaskLoop();
 
+  // Render requests sent to the render task, and how many of them the render in progress covers
+  volatile uint32_t updateRequestCount = 0;
+  uint32_t renderingRequestCount = 0;
+  void notifyRenderTask();
+
   // Set by requestUpdateAndWait(); read and cleared by the render task after render completes.
   // Note: only one waiting task is supported at a time
   TaskHandle_t waitingTaskHandle = nullptr;
@@ -107,6 +113,15 @@ class ActivityManager {
   // Trigger a render and block until it completes.
   // Must NOT be called from the render task or while holding a RenderLock.
   void requestUpdateAndWait();
+
+  // Cancellation token of the render in progress, for the render task only: true once another render was requested
+  // since this one started, e.g. by a second page turn. A slow render may then stop before its display or grayscale
+  // pass, since the next render redraws the screen anyway. Never true while a task waits in requestUpdateAndWait().
+  bool isRenderSuperseded() const { return updateRequestCount != renderingRequestCount && !waitingTaskHandle; }
+
+  // True from the moment an activity asks to be pushed over, popped or replaced until the main loop has done it, which
+  // waits for the render in progress. Long renders stop early on it (see JobSlice).
+  bool isTransitionPending() const { return pendingAction != PendingAction::None; }
 };
 
 extern ActivityManager activityManager;  // singleton, to be defined in main.cpp
@@ -37,7 +37,8 @@ struct PageResult {
 
 struct SyncResult {
   int spineIndex = 0;
-  int page = 0;
+  int page = 0;               // Estimate, for when the section has no page offsets
+  int32_t sourceOffset = -1;  // Byte offset in the spine item, see Section::getPageForSourceOffset()
 };
 
 enum class NetworkMode;
@@ -50,8 +51,14 @@ struct FootnoteResult {
   std::string href;
 };
 
+struct SearchResult {
+  int spineIndex = 0;
+  int page = -1;              // Page in the section file, -1 to go by sourceOffset
+  int32_t sourceOffset = -1;  // Byte offset in the spine item, see Section::getPageForSourceOffset()
+};
+
 using ResultVariant = std::variant<std::monostate, WifiResult, KeyboardResult, MenuResult, ChapterResult, PercentResult,
-                                   PageResult, SyncResult, NetworkModeResult, FootnoteResult>;
+                                   PageResult, SyncResult, NetworkModeResult, FootnoteResult, SearchResult>;
 
 struct ActivityResult {
   bool isCancelled = false;
@@ -0,0 +1,28 @@
+#include "JobSlice.h"
+
+#include <Arduino.h>
+#include <Logging.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include "Activity.h"  // for the ActivityManager singleton
+
+JobSlice::JobSlice(const StopWhen stopWhen) : stopWhen(stopWhen), sliceStartMs(millis()) {}
+
+bool JobSlice::yieldIfNeeded() {
+  if (stop) {
+    return false;
+  }
+  if (millis() - sliceStartMs < SLICE_MS) {
+    return true;
+  }
+
+  vTaskDelay(1);
+  sliceStartMs = millis();
+  stop = activityManager.isTransitionPending() ||
+         (stopWhen == StopWhen::LEAVING_OR_SUPERSEDED && activityManager.isRenderSuperseded());
+  if (stop) {
+    LOG_DBG("JOB", "Job stopped, the activity manager has moved on");
+  }
+  return !stop;
+}
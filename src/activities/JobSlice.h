@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * JobSlice
+ *
+ * Budgeted checkpoint for long jobs on the render task, where a page turn or a Back press waits for them to finish:
+ * laying out a chapter on the way to a page, or the next chapter ahead of time. The job calls yieldIfNeeded() at the
+ * points it can stop at (the abortFn of Section::createSectionFile() is one). It runs in slices of SLICE_MS; between
+ * slices the task gives up a tick, so the idle task feeds the watchdog and the workers move on, and the job is told to
+ * stop if the activity manager has moved on: a transition is pending, or, for a job that is only a head start, another
+ * render was requested.
+ *
+ * Workers have Worker::shouldYield() for the same purpose.
+ */
+class JobSlice {
+ public:
+  enum class StopWhen : uint8_t {
+    LEAVING,                // An activity transition is pending
+    LEAVING_OR_SUPERSEDED,  // Or a newer render was requested, e.g. by a button press
+  };
+
+  static constexpr unsigned long SLICE_MS = 50;
+
+  explicit JobSlice(StopWhen stopWhen = StopWhen::LEAVING);
+
+  // Returns false once the job should stop; from then on it keeps returning false
+  bool yieldIfNeeded();
+  bool stopped() const { return stop; }
+
+ private:
+  StopWhen stopWhen;
+  unsigned long sliceStartMs;
+  bool stop = false;
+};
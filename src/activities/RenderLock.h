@@ -9,9 +9,15 @@ class RenderLock {
  public:
   explicit RenderLock();
   explicit RenderLock(Activity&);  // unused for now, but keep for compatibility
+  // Try to acquire the lock for at most timeoutMs; check isHeld() afterwards.
+  // Used by background tasks that must not block forever while an activity is exiting.
+  explicit RenderLock(unsigned long timeoutMs);
   RenderLock(const RenderLock&) = delete;
   RenderLock& operator=(const RenderLock&) = delete;
   ~RenderLock();
   void unlock();
+  bool isHeld() const { return isLocked; }
   static bool peek();
+  // Whether the calling task holds the lock
+  static bool heldByCurrentTask();
 };
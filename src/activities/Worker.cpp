@@ -0,0 +1,81 @@
+#include "Worker.h"
+
+#include <Logging.h>
+
+#include <cassert>
+
+Worker::~Worker() {
+  // Derived classes must stop the task before their members are destroyed; this is only a safety net.
+  assert(taskHandle == nullptr && "Worker destroyed while running, call stop() first");
+}
+
+void Worker::taskTrampoline(void* param) {
+  auto* self = static_cast<Worker*>(param);
+  self->run();
+  // Copy the handle before signalling: once the semaphore is given, the owner may destroy this object.
+  SemaphoreHandle_t done = self->doneSemaphore;
+  self->finished = true;
+  xSemaphoreGive(done);
+  vTaskDelete(nullptr);
+}
+
+bool Worker::start(const uint32_t stackSize, const UBaseType_t taskPriority) {
+  if (isRunning()) {
+    return true;
+  }
+  reap();
+
+  doneSemaphore = xSemaphoreCreateBinary();
+  if (!doneSemaphore) {
+    LOG_ERR("WRK", "Failed to create semaphore for %s", name);
+    return false;
+  }
+
+  stopFlag = false;
+  finished = false;
+  priority = taskPriority;
+  if (xTaskCreate(&taskTrampoline, name, stackSize, this, priority, &taskHandle) != pdPASS) {
+    LOG_ERR("WRK", "Failed to create task %s (%lu bytes)", name, static_cast<unsigned long>(stackSize));
+    vSemaphoreDelete(doneSemaphore);
+    doneSemaphore = nullptr;
+    taskHandle = nullptr;
+    return false;
+  }
+  LOG_DBG("WRK", "Started %s", name);
+  return true;
+}
+
+void Worker::stop() {
+  if (!taskHandle) {
+    return;
+  }
+  stopFlag = true;
+  if (!finished) {
+    // Wake the task if it is parked in sleepFor()
+    xTaskNotifyGive(taskHandle);
+  }
+  reap();
+  LOG_DBG("WRK", "Stopped %s", name);
+}
+
+void Worker::reap() {
+  if (!taskHandle) {
+    return;
+  }
+  xSemaphoreTake(doneSemaphore, portMAX_DELAY);
+  vSemaphoreDelete(doneSemaphore);
+  doneSemaphore = nullptr;
+  taskHandle = nullptr;
+}
+
+bool Worker::sleepFor(const unsigned long ms) const {
+  if (stopFlag) {
+    return false;
+  }
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ms));
+  return !stopFlag;
+}
+
+bool Worker::shouldYield() const {
+  return stopFlag || (taskHandle && uxTaskPriorityGet(taskHandle) > priority);
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <cstdint>
+
+/**
+ * Worker
+ *
+ * Lifecycle-aware background task owned by an activity. The owner calls start() once it has everything the job needs
+ * and must call stop() from onExit() (derived classes also call it from their destructor). stop() blocks until run()
+ * has returned, so a worker can never outlive the activity that owns it.
+ *
+ * Workers run at idle priority, below the main loop and the render task, and are expected to be cooperative: long
+ * units of work should poll shouldYield() and bail out early, then retry later. run() must never block indefinitely on
+ * RenderLock, since onExit() (and therefore stop()) is called while the activity manager holds it; use the timed
+ * RenderLock constructor instead.
+ */
+class Worker {
+  const char* name;
+  TaskHandle_t taskHandle = nullptr;
+  SemaphoreHandle_t doneSemaphore = nullptr;
+  UBaseType_t priority = PRIORITY;
+  volatile bool stopFlag = false;
+  volatile bool finished = false;
+
+  static void taskTrampoline(void* param);
+  void reap();
+
+ protected:
+  // Executed on the worker task. Returning ends the task; call start() again to re-run.
+  virtual void run() = 0;
+
+  // Sleep for up to ms, waking early when stop() is called. Returns false if the worker should exit.
+  bool sleepFor(unsigned long ms) const;
+
+ public:
+  static constexpr UBaseType_t PRIORITY = tskIDLE_PRIORITY;
+
+  explicit Worker(const char* name) : name(name) {}
+  virtual ~Worker();
+  Worker(const Worker&) = delete;
+  Worker& operator=(const Worker&) = delete;
+
+  // Stack size is in bytes. Returns false if the task could not be created (e.g. out of heap). Only a worker that
+  // serves requests as they come (the web server) runs above PRIORITY.
+  bool start(uint32_t stackSize, UBaseType_t taskPriority = PRIORITY);
+  void stop();
+
+  bool isRunning() const { return taskHandle != nullptr && !finished; }
+  bool stopRequested() const { return stopFlag; }
+
+  // True when the current unit of work should be abandoned: either stop() was requested, or a higher-priority task is
+  // blocked on a mutex this worker holds (e.g. the render task waiting for RenderLock), which FreeRTOS signals by
+  // temporarily raising our priority above the one it was started with through priority inheritance.
+  bool shouldYield() const;
+};
@@ -2,6 +2,7 @@
 #include "../Activity.h"
 
 class Bitmap;
+class SleepScreenCache;
 
 class SleepActivity final : public Activity {
  public:
@@ -13,6 +14,6 @@ class SleepActivity final : public Activity {
   void renderDefaultSleepScreen() const;
   void renderCustomSleepScreen() const;
   void renderCoverSleepScreen() const;
-  void renderBitmapSleepScreen(const Bitmap& bitmap) const;
+  void renderBitmapSleepScreen(const Bitmap& bitmap, SleepScreenCache& cache) const;
   void renderBlankSleepScreen() const;
 };
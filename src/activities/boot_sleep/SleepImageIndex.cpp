@@ -0,0 +1,119 @@
+#include "SleepImageIndex.h"
+
+#include <Bitmap.h>
+#include <FsHelpers.h>
+#include <Logging.h>
+
+#include <cstring>
+
+#include "util/DirectoryIndex.h"
+
+namespace {
+constexpr char MAGIC[4] = {'S', 'L', 'X', '1'};
+constexpr const char* INDEX_DIR = "/.crosspoint/sleep";
+constexpr const char* INDEX_PATH = "/.crosspoint/sleep/images.idx";
+// In order of preference
+constexpr const char* SLEEP_DIRS[] = {"/.sleep", "/sleep"};
+}  // namespace
+
+bool SleepImageIndex::open() {
+  file.close();
+  count = 0;
+  uint32_t fingerprint = 0;
+  for (uint8_t i = 0; i < sizeof(SLEEP_DIRS) / sizeof(SLEEP_DIRS[0]) && fingerprint == 0; i++) {
+    fingerprint = DirectoryIndex::fingerprint(SLEEP_DIRS[i]);
+    dir = SLEEP_DIRS[i];
+    dirIndex = i;
+  }
+  if (fingerprint == 0) {
+    return false;
+  }
+
+  if (Storage.exists(INDEX_PATH) && Storage.openFileForRead("SLX", INDEX_PATH, file)) {
+    Header header;
+    if (file.read(&header, sizeof(header)) == sizeof(header) && memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0 &&
+        header.fingerprint == fingerprint && header.dirIndex == dirIndex &&
+        file.fileSize() == sizeof(header) + header.count * sizeof(Record)) {
+      count = header.count;
+      return true;
+    }
+    file.close();
+  }
+  return build(fingerprint);
+}
+
+bool SleepImageIndex::build(const uint32_t fingerprint) {
+  auto source = Storage.open(dir);
+  Storage.mkdir(INDEX_DIR);
+  const std::string tmpPath = std::string(INDEX_PATH) + ".tmp";
+  FsFile out;
+  if (!source || !Storage.openFileForWrite("SLX", tmpPath, out)) {
+    LOG_ERR("SLX", "Could not build sleep image index of %s", dir);
+    return false;
+  }
+
+  Header header = {};
+  memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.fingerprint = fingerprint;
+  header.dirIndex = dirIndex;
+  bool written = out.write(&header, sizeof(header)) == sizeof(header);
+
+  Record record;
+  for (auto entry = source.openNextFile(); entry && written && header.count < UINT16_MAX;
+       entry = source.openNextFile()) {
+    if (entry.isDirectory()) {
+      continue;
+    }
+    memset(&record, 0, sizeof(record));
+    // One byte more than a record holds, so a name that doesn't fit is told from one that does
+    char name[sizeof(record.name) + 2];
+    const size_t nameLength = entry.getName(name, sizeof(name));
+    if (nameLength == 0 || nameLength > sizeof(record.name) || name[0] == '.') {
+      continue;
+    }
+    if (!FsHelpers::hasBmpExtension(std::string(name, nameLength))) {
+      LOG_DBG("SLX", "Skipping non-.bmp file name: %s", name);
+      continue;
+    }
+    Bitmap bitmap(entry);
+    if (bitmap.parseHeaders() != BmpReaderError::Ok) {
+      LOG_DBG("SLX", "Skipping invalid BMP file: %s", name);
+      continue;
+    }
+    record.size = static_cast<uint32_t>(entry.fileSize());
+    entry.getModifyDateTime(&record.date, &record.time);
+    record.nameLength = static_cast<uint8_t>(nameLength);
+    memcpy(record.name, name, nameLength);
+    written = out.write(&record, sizeof(record)) == sizeof(record);
+    header.count++;
+  }
+  source.close();
+
+  written = written && out.seek(0) && out.write(&header, sizeof(header)) == sizeof(header);
+  out.close();
+  // Written aside and swapped in, so a power cut leaves either the old index or none
+  if (Storage.exists(INDEX_PATH)) {
+    Storage.remove(INDEX_PATH);
+  }
+  if (!written || !Storage.rename(tmpPath.c_str(), INDEX_PATH) || !Storage.openFileForRead("SLX", INDEX_PATH, file)) {
+    LOG_ERR("SLX", "Could not store sleep image index of %s", dir);
+    Storage.remove(tmpPath.c_str());
+    return false;
+  }
+  count = header.count;
+  LOG_DBG("SLX", "Indexed %u sleep images in %s", count, dir);
+  return true;
+}
+
+bool SleepImageIndex::get(const uint16_t index, Image& image) {
+  Record record;
+  if (index >= count || !file.seek(sizeof(Header) + index * sizeof(Record)) ||
+      file.read(&record, sizeof(record)) != sizeof(record) || record.nameLength == 0) {
+    return false;
+  }
+  image.path = std::string(dir) + "/" + std::string(record.name, record.nameLength);
+  image.size = record.size;
+  image.date = record.date;
+  image.time = record.time;
+  return true;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <HalStorage.h>
+
+#include <cstdint>
+#include <string>
+
+/**
+ * The valid BMPs of the custom sleep image directory (/.sleep, or /sleep), listed once so going to sleep reads one
+ * record instead of walking the directory and parsing the header of every image in it.
+ *
+ * The list is bound to a fingerprint of the directory (see DirectoryIndex::fingerprint()), which is one sequential
+ * read of its entries, and is rebuilt when an image is added, removed, renamed or rewritten. Records have a fixed size,
+ * so picking the n-th image is one seek and one read. Each record carries the image's size and FAT write time, which
+ * is what SleepScreenCache binds a cache to, so a cached screen is shown without opening the image at all.
+ *
+ * File format (/.crosspoint/sleep/images.idx):
+ * - char magic[4] - "SLX1"
+ * - uint32_t fingerprint
+ * - uint8_t dirIndex - 0 for /.sleep, 1 for /sleep
+ * - uint8_t reserved
+ * - uint16_t count
+ * - count Records
+ */
+class SleepImageIndex {
+ public:
+  struct Image {
+    std::string path;
+    uint32_t size;
+    uint16_t date;
+    uint16_t time;
+  };
+
+  // Finds the sleep image directory and opens its list, rebuilding it if the directory changed; false if there is no
+  // directory
+  bool open();
+  uint16_t size() const { return count; }
+  bool get(uint16_t index, Image& image);
+
+ private:
+  struct Header {
+    char magic[4];
+    uint32_t fingerprint;
+    uint8_t dirIndex;
+    uint8_t reserved;
+    uint16_t count;
+  };
+  static_assert(sizeof(Header) == 12, "Header is part of the index format");
+
+  struct Record {
+    uint32_t size;
+    uint16_t date;
+    uint16_t time;
+    uint8_t nameLength;
+    char name[255];
+  };
+  static_assert(sizeof(Record) == 264, "Record is part of the index format");
+  // So any nameLength read back fits; build() checks a name against the record before storing its length
+  static_assert(sizeof(Record::name) == UINT8_MAX, "name holds every length nameLength can store");
+
+  FsFile file;
+  const char* dir = nullptr;
+  uint8_t dirIndex = 0;
+  uint16_t count = 0;
+
+  bool build(uint32_t fingerprint);
+};
@@ -0,0 +1,146 @@
+#include "SleepScreenCache.h"
+
+#include <GfxRenderer.h>
+#include <Logging.h>
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+
+#include "CrossPointSettings.h"
+
+namespace {
+constexpr char MAGIC[4] = {'S', 'L', 'C', '1'};
+constexpr const char* CACHE_DIR = "/.crosspoint/sleep";
+constexpr const char* BOOK_CACHE_PREFIX = "/.crosspoint/";
+constexpr uint8_t GREYSCALE_PLANES = 3;
+}  // namespace
+
+SleepScreenCache::SleepScreenCache(const std::string& sourcePath) {
+  auto source = Storage.open(sourcePath.c_str());
+  if (!source || source.isDirectory()) {
+    return;
+  }
+  uint16_t date = 0;
+  uint16_t time = 0;
+  source.getModifyDateTime(&date, &time);
+  const auto size = static_cast<uint32_t>(source.fileSize());
+  source.close();
+  bind(sourcePath, size, date, time);
+}
+
+SleepScreenCache::SleepScreenCache(const std::string& sourcePath, const uint32_t sourceSize, const uint16_t sourceDate,
+                                   const uint16_t sourceTime) {
+  bind(sourcePath, sourceSize, sourceDate, sourceTime);
+}
+
+void SleepScreenCache::bind(const std::string& sourcePath, const uint32_t sourceSize, const uint16_t sourceDate,
+                            const uint16_t sourceTime) {
+  memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.sourceSize = sourceSize;
+  header.sourceDate = sourceDate;
+  header.sourceTime = sourceTime;
+  header.coverMode = SETTINGS.sleepScreenCoverMode;
+  header.coverFilter = SETTINGS.sleepScreenCoverFilter;
+  cachePath = cachePathOf(sourcePath);
+}
+
+std::string SleepScreenCache::cachePathOf(const std::string& sourcePath) {
+  if (sourcePath.rfind(BOOK_CACHE_PREFIX, 0) == 0) {
+    return sourcePath + ".sleep";
+  }
+  return std::string(CACHE_DIR) + "/" + std::to_string(std::hash<std::string>{}(sourcePath)) + ".sleep";
+}
+
+void SleepScreenCache::forget(const std::string& sourcePath) {
+  const std::string path = cachePathOf(sourcePath);
+  if (Storage.exists(path.c_str())) {
+    Storage.remove(path.c_str());
+    LOG_DBG("SLC", "Forgot sleep screen of %s", sourcePath.c_str());
+  }
+}
+
+bool SleepScreenCache::show(const GfxRenderer& renderer) {
+  FsFile cache;
+  if (cachePath.empty() || !Storage.exists(cachePath.c_str()) || !Storage.openFileForRead("SLC", cachePath, cache)) {
+    return false;
+  }
+
+  Header cached;
+  const size_t planeSize = renderer.getBufferSize();
+  if (cache.read(&cached, sizeof(cached)) != sizeof(cached) ||
+      memcmp(&cached, &header, offsetof(Header, planeCount)) != 0 || cached.planeSize != planeSize ||
+      (cached.planeCount != 1 && cached.planeCount != GREYSCALE_PLANES) ||
+      cache.fileSize() != sizeof(cached) + cached.planeCount * planeSize) {
+    LOG_DBG("SLC", "Sleep screen cache is stale: %s", cachePath.c_str());
+    return false;
+  }
+
+  uint8_t* frameBuffer = renderer.getFrameBuffer();
+  if (cache.read(frameBuffer, planeSize) != static_cast<int>(planeSize)) {
+    return false;
+  }
+  renderer.displayBuffer(HalDisplay::HALF_REFRESH);
+
+  if (cached.planeCount == GREYSCALE_PLANES) {
+    if (cache.read(frameBuffer, planeSize) != static_cast<int>(planeSize)) {
+      LOG_ERR("SLC", "Could not read greyscale planes, showing black and white only");
+      return true;
+    }
+    renderer.copyGrayscaleLsbBuffers();
+    if (cache.read(frameBuffer, planeSize) != static_cast<int>(planeSize)) {
+      LOG_ERR("SLC", "Could not read greyscale planes, showing black and white only");
+      return true;
+    }
+    renderer.copyGrayscaleMsbBuffers();
+    renderer.displayGrayBuffer();
+  }
+  LOG_DBG("SLC", "Showed cached sleep screen: %s", cachePath.c_str());
+  return true;
+}
+
+void SleepScreenCache::begin(const bool greyscale, const size_t planeSize) {
+  if (cachePath.empty()) {
+    return;
+  }
+  if (cachePath.rfind(CACHE_DIR, 0) == 0) {
+    Storage.mkdir(CACHE_DIR);
+  }
+  if (!Storage.openFileForWrite("SLC", cachePath + ".tmp", file)) {
+    return;
+  }
+  header.planeCount = greyscale ? GREYSCALE_PLANES : 1;
+  header.planeSize = static_cast<uint32_t>(planeSize);
+  recordedPlanes = 0;
+  recording = file.write(&header, sizeof(header)) == sizeof(header);
+}
+
+void SleepScreenCache::record(const uint8_t* plane) {
+  if (!recording) {
+    return;
+  }
+  recording = file.write(plane, header.planeSize) == header.planeSize;
+  recordedPlanes++;
+}
+
+void SleepScreenCache::finish() {
+  if (!file) {
+    return;
+  }
+  file.close();
+  const std::string tmpPath = cachePath + ".tmp";
+  if (!recording || recordedPlanes != header.planeCount) {
+    LOG_ERR("SLC", "Could not record sleep screen cache");
+    Storage.remove(tmpPath.c_str());
+    return;
+  }
+  recording = false;
+  // Written aside and swapped in, so a power cut leaves either the old cache or none
+  if (Storage.exists(cachePath.c_str())) {
+    Storage.remove(cachePath.c_str());
+  }
+  if (!Storage.rename(tmpPath.c_str(), cachePath.c_str())) {
+    LOG_ERR("SLC", "Could not store sleep screen cache");
+    Storage.remove(tmpPath.c_str());
+  }
+}
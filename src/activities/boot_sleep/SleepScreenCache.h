@@ -0,0 +1,75 @@
+#pragma once
+
+#include <HalStorage.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class GfxRenderer;
+
+/**
+ * Sleep screen of one BMP (a book cover or a custom sleep image) as the frame buffer held it after rendering: the
+ * black and white plane and, for greyscale images, the LSB and MSB planes. They are already scaled, cropped, dithered,
+ * filtered and rotated to the panel, so showing a cached screen is reading them back into the frame buffer and
+ * refreshing, with no BMP decoding on the way to sleep.
+ *
+ * A cache is bound to the size and FAT write time of its BMP and to the cover mode and filter settings; if any of them
+ * changed it is rendered and recorded again. Files written on the device all get the same FAT time, so a BMP replaced
+ * by one of the same size looks unchanged; the web and WebDAV uploads forget() the cache of every BMP they write.
+ * Covers are cached next to their BMP in the book's cache directory, so clearing a book's cache drops its sleep screen
+ * too; custom images are cached in /.crosspoint/sleep.
+ *
+ * File format:
+ * - char magic[4] - "SLC1"
+ * - uint32_t sourceSize
+ * - uint16_t sourceDate, sourceTime - FAT timestamp of the BMP
+ * - uint8_t coverMode, coverFilter
+ * - uint8_t planeCount - 1 (black and white) or 3 (with greyscale)
+ * - uint8_t reserved
+ * - uint32_t planeSize
+ * - planeCount frame buffer planes, in the order black and white, LSB, MSB
+ */
+class SleepScreenCache {
+ public:
+  explicit SleepScreenCache(const std::string& sourcePath);
+  // For a BMP whose size and FAT write time are already known, without opening it
+  SleepScreenCache(const std::string& sourcePath, uint32_t sourceSize, uint16_t sourceDate, uint16_t sourceTime);
+  SleepScreenCache(const SleepScreenCache&) = delete;
+  SleepScreenCache& operator=(const SleepScreenCache&) = delete;
+
+  // Removes the cached screen of a BMP, for when it is replaced, moved or deleted
+  static void forget(const std::string& sourcePath);
+
+  // Shows the cached screen with the same refreshes a render would do; false if there is no current cache
+  bool show(const GfxRenderer& renderer);
+
+  // Recording while rendering: begin, then one record per plane as it is completed in the frame buffer, then finish.
+  // A recording that is not finished leaves no cache behind.
+  void begin(bool greyscale, size_t planeSize);
+  void record(const uint8_t* plane);
+  void finish();
+
+ private:
+  struct Header {
+    char magic[4];
+    uint32_t sourceSize;
+    uint16_t sourceDate;
+    uint16_t sourceTime;
+    uint8_t coverMode;
+    uint8_t coverFilter;
+    uint8_t planeCount;
+    uint8_t reserved;
+    uint32_t planeSize;
+  };
+  static_assert(sizeof(Header) == 20, "Header is part of the cache format");
+
+  Header header = {};
+  std::string cachePath;
+  FsFile file;
+  uint8_t recordedPlanes = 0;
+  bool recording = false;
+
+  static std::string cachePathOf(const std::string& sourcePath);
+  void bind(const std::string& sourcePath, uint32_t sourceSize, uint16_t sourceDate, uint16_t sourceTime);
+};
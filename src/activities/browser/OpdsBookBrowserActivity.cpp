@@ -1,5 +1,6 @@
 #include "OpdsBookBrowserActivity.h"
 
+#include <Bitmap.h>
 #include <Epub.h>
 #include <GfxRenderer.h>
 #include <I18n.h>
@@ -7,6 +8,8 @@
 #include <OpdsStream.h>
 #include <WiFi.h>
 
+#include <algorithm>
+
 #include "CrossPointSettings.h"
 #include "MappedInputManager.h"
 #include "activities/network/WifiSelectionActivity.h"
@@ -18,14 +21,23 @@
 #include "util/UrlUtils.h"
 
 namespace {
-constexpr int PAGE_ITEMS = 23;
+constexpr int PAGE_ITEMS = 11;
+constexpr int LIST_TOP = 60;
+constexpr int ROW_HEIGHT = OpdsThumbnailFetcher::THUMB_HEIGHT + 4;
+
+// Hrefs in a feed may be relative to the server
+std::string resolveUrl(const std::string& href) {
+  return href.find("http") == 0 ? href : UrlUtils::buildUrl(SETTINGS.opdsServerUrl, href);
 }
+}  // namespace
 
 void OpdsBookBrowserActivity::onEnter() {
   Activity::onEnter();
 
   state = BrowserState::CHECK_WIFI;
   entries.clear();
+  feedEntryCount = 0;
+  loadedPage = -1;
   navigationHistory.clear();
   searchTemplate = "";
   currentPath = "";
@@ -41,6 +53,8 @@ void OpdsBookBrowserActivity::onEnter() {
 
 void OpdsBookBrowserActivity::onExit() {
   Activity::onExit();
+  thumbnails.stop();
+  HttpDownloader::closeSession();
   WiFi.mode(WIFI_OFF);
   entries.clear();
   navigationHistory.clear();
@@ -66,7 +80,7 @@ void OpdsBookBrowserActivity::loop() {
         state = BrowserState::LOADING;
         statusMessage = tr(STR_LOADING);
         requestUpdate();
-        fetchFeed(currentPath);
+        fetchFeed();
       } else {
         launchWifiSelection();
       }
@@ -86,10 +100,14 @@ void OpdsBookBrowserActivity::loop() {
   if (state == BrowserState::DOWNLOADING) return;
 
   if (state == BrowserState::BROWSING) {
+    if (thumbnails.getFetchedCount() != thumbnailsDrawn) {
+      thumbnailsDrawn = thumbnails.getFetchedCount();
+      requestUpdate();
+    }
+
     if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
-      if (!entries.empty()) {
-        const auto& entry = entries[selectorIndex];
-        entry.type == OpdsEntryType::BOOK ? downloadBook(entry) : navigateToEntry(entry);
+      if (const OpdsEntry* entry = itemAt(selectorIndex)) {
+        entry->type == OpdsEntryType::BOOK ? downloadBook(*entry) : navigateToEntry(*entry);
       }
     } else if (mappedInput.wasReleased(MappedInputManager::Button::Back)) {
       navigateBack();
@@ -97,22 +115,24 @@ void OpdsBookBrowserActivity::loop() {
       if (!searchTemplate.empty() && selectorIndex == 0) launchSearch();
     }
 
-    if (!entries.empty()) {
+    if (itemCount() > 0) {
       buttonNavigator.onNextRelease([this] {
-        selectorIndex = ButtonNavigator::nextIndex(selectorIndex, entries.size());
-        requestUpdate();
+        selectorIndex = ButtonNavigator::nextIndex(selectorIndex, itemCount());
+        showSelection();
       });
       buttonNavigator.onPreviousRelease([this] {
-        selectorIndex = ButtonNavigator::previousIndex(selectorIndex, entries.size());
-        requestUpdate();
+        selectorIndex = ButtonNavigator::previousIndex(selectorIndex, itemCount());
+        showSelection();
       });
       buttonNavigator.onNextContinuous([this] {
-        selectorIndex = ButtonNavigator::nextPageIndex(selectorIndex, entries.size(), PAGE_ITEMS);
-        requestUpdate();
+        selectorIndex = ButtonNavigator::nextPageIndex(selectorIndex, itemCount(), PAGE_ITEMS,
+                                                       buttonNavigator.continuousStride());
+        showSelection();
       });
       buttonNavigator.onPreviousContinuous([this] {
-        selectorIndex = ButtonNavigator::previousPageIndex(selectorIndex, entries.size(), PAGE_ITEMS);
-        requestUpdate();
+        selectorIndex = ButtonNavigator::previousPageIndex(selectorIndex, itemCount(), PAGE_ITEMS,
+                                                           buttonNavigator.continuousStride());
+        showSelection();
       });
     }
   }
@@ -154,47 +174,103 @@ void OpdsBookBrowserActivity::render(RenderLock&&) {
     return;
   }
 
-  const char* confirmLabel =
-      (!entries.empty() && entries[selectorIndex].type == OpdsEntryType::BOOK) ? tr(STR_DOWNLOAD) : tr(STR_OPEN);
+  const OpdsEntry* selected = itemAt(selectorIndex);
+  const char* confirmLabel = (selected && selected->type == OpdsEntryType::BOOK) ? tr(STR_DOWNLOAD) : tr(STR_OPEN);
   const char* searchLabel = (!searchTemplate.empty() && selectorIndex == 0) ? tr(STR_SEARCH) : tr(STR_DIR_UP);
   const auto labels = mappedInput.mapLabels(tr(STR_BACK), confirmLabel, searchLabel, tr(STR_DIR_DOWN));
   GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
-  if (entries.empty()) {
+  const int count = itemCount();
+  if (count == 0) {
     renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2, tr(STR_NO_ENTRIES));
   } else {
     const auto pageStartIndex = selectorIndex / PAGE_ITEMS * PAGE_ITEMS;
-    renderer.fillRect(0, 60 + (selectorIndex % PAGE_ITEMS) * 30 - 2, pageWidth - 1, 30);
-
-    for (size_t i = pageStartIndex; i < entries.size() && i < static_cast<size_t>(pageStartIndex + PAGE_ITEMS); i++) {
-      const auto& entry = entries[i];
-      std::string displayText = (entry.type == OpdsEntryType::NAVIGATION) ? "> " + entry.title : entry.title;
-      if (entry.type == OpdsEntryType::BOOK && !entry.author.empty()) displayText += " - " + entry.author;
-      auto item = renderer.truncatedText(UI_10_FONT_ID, displayText.c_str(), pageWidth - 40);
-      renderer.drawText(UI_10_FONT_ID, 20, 60 + (i % PAGE_ITEMS) * 30, item.c_str(),
-                        i != static_cast<size_t>(selectorIndex));
+    const int lineHeight = renderer.getLineHeight(UI_10_FONT_ID);
+    renderer.fillRect(0, LIST_TOP + (selectorIndex % PAGE_ITEMS) * ROW_HEIGHT, pageWidth - 1, ROW_HEIGHT);
+
+    for (int i = pageStartIndex; i < count && i < pageStartIndex + PAGE_ITEMS; i++) {
+      const OpdsEntry* entry = itemAt(i);
+      if (!entry) continue;
+      const bool selected = i == selectorIndex;
+      const int rowY = LIST_TOP + (i % PAGE_ITEMS) * ROW_HEIGHT;
+      int textX = 20;
+
+      if (!entry->thumbnailHref.empty()) {
+        const int coverY = rowY + (ROW_HEIGHT - OpdsThumbnailFetcher::THUMB_HEIGHT) / 2;
+        FsFile file;
+        if (OpdsThumbnailFetcher::openCached(resolveUrl(entry->thumbnailHref), file)) {
+          Bitmap bitmap(file);
+          if (bitmap.parseHeaders() == BmpReaderError::Ok) {
+            renderer.fillRect(textX, coverY, OpdsThumbnailFetcher::THUMB_WIDTH, OpdsThumbnailFetcher::THUMB_HEIGHT,
+                              false);
+            renderer.drawBitmap(bitmap, textX, coverY, OpdsThumbnailFetcher::THUMB_WIDTH,
+                                OpdsThumbnailFetcher::THUMB_HEIGHT);
+          }
+          file.close();
+        } else {
+          // Not fetched yet, or the entry's cover is unusable
+          renderer.drawRect(textX, coverY, OpdsThumbnailFetcher::THUMB_WIDTH, OpdsThumbnailFetcher::THUMB_HEIGHT,
+                            !selected);
+        }
+        textX += OpdsThumbnailFetcher::THUMB_WIDTH + 10;
+      }
+
+      const std::string displayText = entry->type == OpdsEntryType::NAVIGATION ? "> " + entry->title : entry->title;
+      const auto title = renderer.truncatedText(UI_10_FONT_ID, displayText.c_str(), pageWidth - textX - 20);
+      if (entry->type == OpdsEntryType::BOOK && !entry->author.empty()) {
+        const auto author = renderer.truncatedText(UI_10_FONT_ID, entry->author.c_str(), pageWidth - textX - 20);
+        renderer.drawText(UI_10_FONT_ID, textX, rowY + ROW_HEIGHT / 2 - lineHeight, title.c_str(), !selected);
+        renderer.drawText(UI_10_FONT_ID, textX, rowY + ROW_HEIGHT / 2, author.c_str(), !selected);
+      } else {
+        renderer.drawText(UI_10_FONT_ID, textX, rowY + (ROW_HEIGHT - lineHeight) / 2, title.c_str(), !selected);
+      }
     }
   }
-  renderer.displayBuffer();
+  renderer.displayChanges();
+}
+
+int OpdsBookBrowserActivity::itemCount() const {
+  return static_cast<int>(feedEntryCount) + (prevPageEntry.href.empty() ? 0 : 1) + (nextPageEntry.href.empty() ? 0 : 1);
+}
+
+// Items are the feed's "previous" link, its entries, then its "next" link. Entries outside the loaded page are null.
+const OpdsEntry* OpdsBookBrowserActivity::itemAt(const int index) const {
+  int feedIndex = index;
+  if (!prevPageEntry.href.empty()) {
+    if (index == 0) return &prevPageEntry;
+    feedIndex--;
+  }
+  if (feedIndex == static_cast<int>(feedEntryCount) && !nextPageEntry.href.empty()) return &nextPageEntry;
+  if (feedIndex < static_cast<int>(windowFirst) || feedIndex >= static_cast<int>(windowFirst + entries.size())) {
+    return nullptr;
+  }
+  return &entries[feedIndex - windowFirst];
 }
 
-void OpdsBookBrowserActivity::fetchFeed(const std::string& path) {
+// Streams the current feed, keeping the entries shown on the given page. Sets the error state on failure.
+bool OpdsBookBrowserActivity::fetchPage(const int page, const HttpDownloader::CachePolicy cache) {
   if (strlen(SETTINGS.opdsServerUrl) == 0) {
     state = BrowserState::ERROR;
     errorMessage = tr(STR_NO_SERVER_URL);
     requestUpdate();
-    return;
+    return false;
   }
 
-  std::string url = (path.find("http") == 0) ? path : UrlUtils::buildUrl(SETTINGS.opdsServerUrl, path);
+  const std::string url = resolveUrl(currentPath);
+  const size_t first = std::max(0, page * PAGE_ITEMS - (prevPageEntry.href.empty() ? 0 : 1));
+  // Free the previous page before parsing the next one
+  std::vector<OpdsEntry>().swap(entries);
+  loadedPage = -1;
+
   OpdsParser parser;
+  parser.setWindow(first, PAGE_ITEMS);
   {
     OpdsParserStream stream{parser};
-    if (!HttpDownloader::fetchUrl(url, stream)) {
+    if (!HttpDownloader::fetchUrl(url, stream, cache)) {
       state = BrowserState::ERROR;
       errorMessage = tr(STR_FETCH_FEED_FAILED);
       requestUpdate();
-      return;
+      return false;
     }
   }
 
@@ -202,24 +278,60 @@ void OpdsBookBrowserActivity::fetchFeed(const std::string& path) {
     state = BrowserState::ERROR;
     errorMessage = tr(STR_PARSE_FEED_FAILED);
     requestUpdate();
-    return;
+    return false;
   }
 
   searchTemplate = parser.getSearchTemplate();
-  const auto& nextUrl = parser.getNextPageUrl();
   const auto& prevUrl = parser.getPrevPageUrl();
+  const auto& nextUrl = parser.getNextPageUrl();
+  prevPageEntry =
+      prevUrl.empty() ? OpdsEntry{} : OpdsEntry{OpdsEntryType::NAVIGATION, tr(STR_PREV_PAGE), "", prevUrl, ""};
+  nextPageEntry =
+      nextUrl.empty() ? OpdsEntry{} : OpdsEntry{OpdsEntryType::NAVIGATION, tr(STR_NEXT_PAGE), "", nextUrl, ""};
+  feedEntryCount = parser.getEntryCount();
   entries = std::move(parser).getEntries();
+  windowFirst = first;
+  loadedPage = page;
 
-  if (!prevUrl.empty()) {
-    entries.insert(entries.begin(), OpdsEntry{OpdsEntryType::NAVIGATION, tr(STR_PREV_PAGE), "", prevUrl, ""});
-  }
-  if (!nextUrl.empty()) {
-    entries.push_back(OpdsEntry{OpdsEntryType::NAVIGATION, tr(STR_NEXT_PAGE), "", nextUrl, ""});
+  std::vector<std::string> thumbnailUrls;
+  for (const auto& entry : entries) {
+    if (!entry.thumbnailHref.empty()) {
+      thumbnailUrls.push_back(resolveUrl(entry.thumbnailHref));
+    }
   }
+  thumbnails.fetch(std::move(thumbnailUrls));
+  return true;
+}
 
+void OpdsBookBrowserActivity::fetchFeed(const HttpDownloader::CachePolicy cache) {
   selectorIndex = 0;
-  state = entries.empty() ? BrowserState::ERROR : BrowserState::BROWSING;
-  if (entries.empty()) errorMessage = tr(STR_NO_ENTRIES);
+  feedEntryCount = 0;
+  prevPageEntry = OpdsEntry{};
+  nextPageEntry = OpdsEntry{};
+  if (!fetchPage(0, cache)) {
+    return;
+  }
+
+  state = itemCount() == 0 ? BrowserState::ERROR : BrowserState::BROWSING;
+  if (itemCount() == 0) errorMessage = tr(STR_NO_ENTRIES);
+  requestUpdate();
+}
+
+// Loads the page holding the selection if it is not the one in memory
+void OpdsBookBrowserActivity::showSelection() {
+  const int page = selectorIndex / PAGE_ITEMS;
+  if (page != loadedPage) {
+    state = BrowserState::LOADING;
+    statusMessage = tr(STR_LOADING);
+    requestUpdate(true);
+    // The feed was fetched for the first page moments ago
+    if (!fetchPage(page, HttpDownloader::CachePolicy::PREFER_CACHE)) {
+      return;
+    }
+    // The feed may have shrunk since the first page was fetched
+    selectorIndex = std::min(selectorIndex, std::max(0, itemCount() - 1));
+    state = BrowserState::BROWSING;
+  }
   requestUpdate();
 }
 
@@ -231,7 +343,7 @@ void OpdsBookBrowserActivity::navigateToEntry(const OpdsEntry& entry) {
   entries.clear();
   selectorIndex = 0;
   requestUpdate(true);
-  fetchFeed(currentPath);
+  fetchFeed();
 }
 
 void OpdsBookBrowserActivity::navigateBack() {
@@ -245,7 +357,7 @@ void OpdsBookBrowserActivity::navigateBack() {
     entries.clear();
     selectorIndex = 0;
     requestUpdate();
-    fetchFeed(currentPath);
+    fetchFeed(HttpDownloader::CachePolicy::PREFER_CACHE);
   }
 }
 
@@ -255,8 +367,7 @@ void OpdsBookBrowserActivity::downloadBook(const OpdsEntry& book) {
   downloadProgress = downloadTotal = 0;
   requestUpdate(true);
 
-  std::string downloadUrl =
-      (book.href.find("http") == 0) ? book.href : UrlUtils::buildUrl(SETTINGS.opdsServerUrl, book.href);
+  const std::string downloadUrl = resolveUrl(book.href);
   std::string filename =
       "/" + StringUtils::sanitizeFilename(book.title + (book.author.empty() ? "" : " - " + book.author)) + ".epub";
 
@@ -326,7 +437,7 @@ void OpdsBookBrowserActivity::performSearch(const std::string& query) {
   state = BrowserState::LOADING;
   statusMessage = tr(STR_LOADING);
   requestUpdate(true);
-  fetchFeed(url);
+  fetchFeed();
 }
 
 void OpdsBookBrowserActivity::checkAndConnectWifi() {
@@ -334,7 +445,7 @@ void OpdsBookBrowserActivity::checkAndConnectWifi() {
     state = BrowserState::LOADING;
     statusMessage = tr(STR_LOADING);
     requestUpdate();
-    fetchFeed(currentPath);
+    fetchFeed();
     return;
   }
   launchWifiSelection();
@@ -354,8 +465,9 @@ void OpdsBookBrowserActivity::onWifiSelectionComplete(const bool connected) {
     state = BrowserState::LOADING;
     statusMessage = tr(STR_LOADING);
     requestUpdate(true);
-    fetchFeed(currentPath);
+    fetchFeed();
   } else {
+    HttpDownloader::closeSession();
     WiFi.disconnect();
     WiFi.mode(WIFI_OFF);
     state = BrowserState::ERROR;
@@ -6,11 +6,23 @@
 #include <vector>
 
 #include "../Activity.h"
+#include "OpdsThumbnailFetcher.h"
+#include "network/HttpDownloader.h"
 #include "util/ButtonNavigator.h"
 
 /**
  * Activity for browsing and downloading books from an OPDS server.
  * Supports navigation through catalog hierarchy and downloading EPUBs.
+ *
+ * Only the entries of the page on screen are held. Moving to another page streams the feed again and keeps that
+ * page's entries, so large catalogs take no more memory than small ones. A feed's "previous"/"next" links are shown
+ * as the first and last items and only fetched when selected.
+ *
+ * Feeds are cached on the SD card: other pages of the same feed and feeds returned to with Back are read from the
+ * copy, feeds navigated into are revalidated with the server over the kept-alive connection.
+ *
+ * Books are listed with their cover thumbnails, fetched in the background for the page on screen and kept on the SD
+ * card; a cover is drawn once it is there.
  */
 class OpdsBookBrowserActivity final : public Activity {
  public:
@@ -27,7 +39,12 @@ class OpdsBookBrowserActivity final : public Activity {
  private:
   ButtonNavigator buttonNavigator;
   BrowserState state = BrowserState::LOADING;
-  std::vector<OpdsEntry> entries;
+  std::vector<OpdsEntry> entries;  // The loaded page of the feed
+  size_t feedEntryCount = 0;       // Entries in the whole feed
+  int loadedPage = -1;
+  size_t windowFirst = 0;  // Feed index of entries[0]
+  OpdsEntry prevPageEntry;  // href is empty when the feed has no such link
+  OpdsEntry nextPageEntry;
   std::vector<std::string> navigationHistory;
   std::string currentPath;
   std::string searchTemplate;
@@ -38,11 +55,18 @@ class OpdsBookBrowserActivity final : public Activity {
   std::string statusMessage;
   size_t downloadProgress = 0;
   size_t downloadTotal = 0;
+  OpdsThumbnailFetcher thumbnails;
+  uint32_t thumbnailsDrawn = 0;
 
   void checkAndConnectWifi();
   void launchWifiSelection();
   void onWifiSelectionComplete(bool connected);
-  void fetchFeed(const std::string& path);
+  // Loads the first page of currentPath
+  void fetchFeed(HttpDownloader::CachePolicy cache = HttpDownloader::CachePolicy::REVALIDATE);
+  bool fetchPage(int page, HttpDownloader::CachePolicy cache);
+  void showSelection();
+  int itemCount() const;
+  const OpdsEntry* itemAt(int index) const;
   void navigateToEntry(const OpdsEntry& entry);
   void navigateBack();
   void downloadBook(const OpdsEntry& book);
@@ -0,0 +1,223 @@
+#include "OpdsThumbnailFetcher.h"
+
+#include <JpegToBmpConverter.h>
+#include <Logging.h>
+#include <MemoryBudget.h>
+#include <PngToBmpConverter.h>
+
+#include <cstring>
+#include <functional>
+#include <iterator>
+
+#include "CrossPointSettings.h"
+#include "activities/RenderLock.h"
+#include "network/HttpDownloader.h"
+#include "util/UrlUtils.h"
+
+namespace {
+constexpr const char* CACHE_DIR = "/.crosspoint/opds/thumbs";
+constexpr size_t CACHE_SLOTS = 128;
+// The downloaded image and the BMP being written, replaced on every fetch
+constexpr const char* IMAGE_PATH = "/.crosspoint/opds/thumbs/fetch.img";
+constexpr const char* BMP_TEMP_PATH = "/.crosspoint/opds/thumbs/fetch.tmp";
+// bfReserved1 and bfReserved2 of the BMP file header hold the URL hash; the header up to them is all a stub has
+constexpr size_t KEY_OFFSET = 6;
+constexpr size_t STUB_SIZE = KEY_OFFSET + sizeof(uint32_t);
+constexpr size_t MIN_FREE_HEAP = 80 * 1024;
+constexpr unsigned long LOW_HEAP_RETRY_MS = 2000;
+constexpr unsigned long LOCK_TIMEOUT_MS = 100;
+
+enum class CacheState { MISSING, READY, UNAVAILABLE };
+
+// Locks a FreeRTOS mutex for the enclosing scope
+class MutexGuard {
+  SemaphoreHandle_t mutex;
+
+ public:
+  explicit MutexGuard(SemaphoreHandle_t mutex) : mutex(mutex) { xSemaphoreTake(mutex, portMAX_DELAY); }
+  ~MutexGuard() { xSemaphoreGive(mutex); }
+  MutexGuard(const MutexGuard&) = delete;
+  MutexGuard& operator=(const MutexGuard&) = delete;
+};
+
+uint32_t urlKey(const std::string& url) { return static_cast<uint32_t>(std::hash<std::string>{}(url)); }
+
+std::string slotPath(const uint32_t key) {
+  return std::string(CACHE_DIR) + "/" + std::to_string(key % CACHE_SLOTS) + ".bmp";
+}
+
+// Opens url's slot; the file is left open, at the start, only when READY
+CacheState openSlot(const std::string& url, FsFile& file) {
+  const uint32_t key = urlKey(url);
+  const std::string path = slotPath(key);
+  if (!Storage.exists(path.c_str()) || !Storage.openFileForRead("OPDS", path, file)) {
+    return CacheState::MISSING;
+  }
+  uint8_t header[STUB_SIZE];
+  uint32_t storedKey = 0;
+  const bool read = file.read(header, sizeof(header)) == sizeof(header);
+  memcpy(&storedKey, header + KEY_OFFSET, sizeof(storedKey));
+  if (!read || header[0] != 'B' || header[1] != 'M' || storedKey != key) {
+    file.close();  // Another URL's
+    return CacheState::MISSING;
+  }
+  if (file.size() == STUB_SIZE || !file.seekSet(0)) {
+    file.close();
+    return CacheState::UNAVAILABLE;
+  }
+  return CacheState::READY;
+}
+
+// Records that url has no usable thumbnail
+void writeStub(const std::string& url) {
+  const uint32_t key = urlKey(url);
+  uint8_t stub[STUB_SIZE] = {'B', 'M'};
+  memcpy(stub + KEY_OFFSET, &key, sizeof(key));
+  FsFile file;
+  if (Storage.openFileForWrite("OPDS", slotPath(key), file)) {
+    file.write(stub, sizeof(stub));
+    file.close();
+  }
+}
+}  // namespace
+
+OpdsThumbnailFetcher::OpdsThumbnailFetcher() : Worker("OpdsThumbnails"), queueMutex(xSemaphoreCreateMutex()) {}
+
+OpdsThumbnailFetcher::~OpdsThumbnailFetcher() {
+  stop();
+  if (queueMutex) {
+    vSemaphoreDelete(queueMutex);
+  }
+}
+
+void OpdsThumbnailFetcher::fetch(std::vector<std::string> urls) {
+  if (!queueMutex) {
+    return;
+  }
+  bool restart;
+  {
+    MutexGuard guard(queueMutex);
+    queue.assign(std::make_move_iterator(urls.begin()), std::make_move_iterator(urls.end()));
+    if (queue.empty()) {
+      return;
+    }
+    restart = exiting;
+    exiting = false;
+  }
+  if (restart || !isRunning()) {
+    // A task that found nothing left to do may still be on its way out; wait for it before starting a new one
+    stop();
+    start(STACK_SIZE);
+  }
+}
+
+bool OpdsThumbnailFetcher::openCached(const std::string& url, FsFile& file) {
+  return openSlot(url, file) == CacheState::READY;
+}
+
+// Returns false if the image couldn't be fetched, or stop() was called
+bool OpdsThumbnailFetcher::download(const std::string& url) {
+  if (!Storage.ensureDirectoryExists(CACHE_DIR)) {
+    return false;
+  }
+  // A part left by another image must not be resumed into this one
+  Storage.remove((std::string(IMAGE_PATH) + ".part").c_str());
+  Storage.remove((std::string(IMAGE_PATH) + ".part.info").c_str());
+
+  HttpDownloader::DownloadOptions options;
+  // The credentials are the OPDS server's, and covers may be served from elsewhere
+  options.sendCredentials = UrlUtils::extractHost(url) == UrlUtils::extractHost(SETTINGS.opdsServerUrl);
+  options.cancelled = [this] { return stopRequested(); };
+  const auto result = HttpDownloader::downloadToFile(url, IMAGE_PATH, nullptr, options);
+  if (result != HttpDownloader::OK && result != HttpDownloader::ABORTED) {
+    LOG_DBG("OPDS", "Couldn't fetch thumbnail %s: %d", url.c_str(), result);
+  }
+  return result == HttpDownloader::OK;
+}
+
+// Converts the downloaded image into url's slot. Returns whether a thumbnail was written; an image that isn't a
+// JPEG or PNG, or fails to decode, leaves a stub instead.
+bool OpdsThumbnailFetcher::convert(const std::string& url) {
+  FsFile image;
+  if (!Storage.openFileForRead("OPDS", IMAGE_PATH, image)) {
+    return false;
+  }
+  uint8_t magic[2] = {};
+  image.read(magic, sizeof(magic));
+  image.seekSet(0);
+  const bool jpeg = magic[0] == 0xFF && magic[1] == 0xD8;
+  const bool png = magic[0] == 0x89 && magic[1] == 'P';
+
+  bool converted = false;
+  FsFile bmp;
+  if ((jpeg || png) && Storage.openFileForWrite("OPDS", BMP_TEMP_PATH, bmp)) {
+    // 1-bit like the home screen's covers: the list is drawn with a fast refresh, with no grey passes
+    converted = jpeg ? JpegToBmpConverter::jpegFileTo1BitBmpStreamWithSize(image, bmp, THUMB_WIDTH, THUMB_HEIGHT)
+                     : PngToBmpConverter::pngFileTo1BitBmpStreamWithSize(image, bmp, THUMB_WIDTH, THUMB_HEIGHT);
+    const uint32_t key = urlKey(url);
+    converted = converted && bmp.seekSet(KEY_OFFSET) && bmp.write(&key, sizeof(key)) == sizeof(key);
+    bmp.close();
+  }
+  image.close();
+  Storage.remove(IMAGE_PATH);
+
+  const std::string path = slotPath(urlKey(url));
+  Storage.remove(path.c_str());
+  if (!converted) {
+    LOG_DBG("OPDS", "No usable thumbnail at %s", url.c_str());
+    Storage.remove(BMP_TEMP_PATH);
+    writeStub(url);
+    return false;
+  }
+  return Storage.rename(BMP_TEMP_PATH, path.c_str());
+}
+
+void OpdsThumbnailFetcher::run() {
+  std::string url;
+  bool downloaded = false;
+  while (!stopRequested()) {
+    if (url.empty()) {
+      {
+        MutexGuard guard(queueMutex);
+        if (queue.empty()) {
+          // Work handed over from now on restarts the task
+          exiting = true;
+          return;
+        }
+        url = std::move(queue.front());
+        queue.pop_front();
+      }
+      FsFile file;
+      if (openSlot(url, file) != CacheState::MISSING) {
+        file.close();
+        url.clear();
+        continue;
+      }
+      downloaded = false;
+    }
+
+    if (!downloaded) {
+      if (!download(url)) {
+        url.clear();  // Tried again when the page is next shown
+        continue;
+      }
+      downloaded = true;
+    }
+
+    // The cover decoders keep static state, and the browser reads the slots while rendering
+    RenderLock lock(LOCK_TIMEOUT_MS);
+    if (!lock.isHeld() || stopRequested()) {
+      continue;
+    }
+    // The decoders need their buffers on top of the TLS session; wait for the heap rather than fail the cover
+    if (!MemoryBudget::reserve(MIN_FREE_HEAP, 0)) {
+      lock.unlock();
+      sleepFor(LOW_HEAP_RETRY_MS);
+      continue;
+    }
+    if (convert(url)) {
+      fetchedCount = fetchedCount + 1;
+    }
+    url.clear();
+  }
+}
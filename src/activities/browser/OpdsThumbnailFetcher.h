@@ -0,0 +1,53 @@
+#pragma once
+
+#include <HalStorage.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "activities/Worker.h"
+
+/**
+ * Fetches the cover thumbnails of an OPDS catalog page in the background and keeps them on the SD card as small 1-bit
+ * BMPs, so the browser draws whichever covers are there and never waits on the network or a decode. Each image is
+ * fetched over HttpDownloader's kept-alive connection and converted once; later visits to the page read the BMP.
+ *
+ * The cache has a fixed set of slots picked by URL hash, like the feed cache, which bounds it without bookkeeping. A
+ * BMP's file header records the hash of its URL in the reserved bytes, so a slot taken over by another URL is told
+ * apart. An image that can't be converted leaves a header-only file, so it isn't fetched again.
+ */
+class OpdsThumbnailFetcher final : public Worker {
+  SemaphoreHandle_t queueMutex = nullptr;
+  // Guarded by queueMutex
+  std::deque<std::string> queue;
+  bool exiting = false;  // run() found no work and is returning
+
+  volatile uint32_t fetchedCount = 0;
+
+  bool download(const std::string& url);
+  bool convert(const std::string& url);
+
+ protected:
+  void run() override;
+
+ public:
+  static constexpr uint32_t STACK_SIZE = 8192;  // TLS and the JPEG decoder
+  static constexpr int THUMB_WIDTH = 40;
+  static constexpr int THUMB_HEIGHT = 56;
+
+  OpdsThumbnailFetcher();
+  ~OpdsThumbnailFetcher() override;
+
+  // Called from the main loop with the absolute thumbnail URLs of the page on screen, replacing those of the page
+  // before. Thumbnails already cached are skipped.
+  void fetch(std::vector<std::string> urls);
+
+  // Thumbnails written so far; the browser redraws when this changes
+  uint32_t getFetchedCount() const { return fetchedCount; }
+
+  // Opens the cached thumbnail of url, positioned at the start of the BMP. False if it isn't cached or is unusable.
+  static bool openCached(const std::string& url, FsFile& file);
+};
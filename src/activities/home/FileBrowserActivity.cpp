@@ -6,8 +6,6 @@
 #include <HalStorage.h>
 #include <I18n.h>
 
-#include <algorithm>
-
 #include "../util/ConfirmationActivity.h"
 #include "CrossPointSettings.h"
 #include "MappedInputManager.h"
@@ -18,87 +16,10 @@ namespace {
 constexpr unsigned long GO_HOME_MS = 1000;
 }  // namespace
 
-void sortFileList(std::vector<std::string>& strs) {
-  std::sort(begin(strs), end(strs), [](const std::string& str1, const std::string& str2) {
-    // Directories first
-    bool isDir1 = str1.back() == '/';
-    bool isDir2 = str2.back() == '/';
-    if (isDir1 != isDir2) return isDir1;
-
-    // Start naive natural sort
-    const char* s1 = str1.c_str();
-    const char* s2 = str2.c_str();
-
-    // Iterate while both strings have characters
-    while (*s1 && *s2) {
-      // Check if both are at the start of a number
-      if (isdigit(*s1) && isdigit(*s2)) {
-        // Skip leading zeros and track them
-        const char* start1 = s1;
-        const char* start2 = s2;
-        while (*s1 == '0') s1++;
-        while (*s2 == '0') s2++;
-
-        // Count digits to compare lengths first
-        int len1 = 0, len2 = 0;
-        while (isdigit(s1[len1])) len1++;
-        while (isdigit(s2[len2])) len2++;
-
-        // Different length so return smaller integer value
-        if (len1 != len2) return len1 < len2;
-
-        // Same length so compare digit by digit
-        for (int i = 0; i < len1; i++) {
-          if (s1[i] != s2[i]) return s1[i] < s2[i];
-        }
-
-        // Numbers equal so advance pointers
-        s1 += len1;
-        s2 += len2;
-      } else {
-        // Regular case-insensitive character comparison
-        char c1 = tolower(*s1);
-        char c2 = tolower(*s2);
-        if (c1 != c2) return c1 < c2;
-        s1++;
-        s2++;
-      }
-    }
-
-    // One string is prefix of other
-    return *s1 == '\0' && *s2 != '\0';
-  });
-}
-
 void FileBrowserActivity::loadFiles() {
-  files.clear();
-
-  auto root = Storage.open(basepath.c_str());
-  if (!root || !root.isDirectory()) {
-    return;
-  }
-
-  root.rewindDirectory();
-
-  char name[500];
-  for (auto file = root.openNextFile(); file; file = root.openNextFile()) {
-    file.getName(name, sizeof(name));
-    if ((!SETTINGS.showHiddenFiles && name[0] == '.') || strcmp(name, "System Volume Information") == 0) {
-      continue;
-    }
-
-    if (file.isDirectory()) {
-      files.emplace_back(std::string(name) + "/");
-    } else {
-      std::string_view filename{name};
-      if (FsHelpers::hasEpubExtension(filename) || FsHelpers::hasXtcExtension(filename) ||
-          FsHelpers::hasTxtExtension(filename) || FsHelpers::hasMarkdownExtension(filename) ||
-          FsHelpers::hasBmpExtension(filename)) {
-        files.emplace_back(filename);
-      }
-    }
-  }
-  sortFileList(files);
+  // The render task reads the listing while drawing
+  RenderLock lock(*this);
+  files.open(basepath, SETTINGS.showHiddenFiles);
 }
 
 void FileBrowserActivity::onEnter() {
@@ -119,7 +40,7 @@ void FileBrowserActivity::onEnter() {
 
     const auto pos = oldPath.find_last_of('/');
     const std::string fileName = oldPath.substr(pos + 1);
-    selectorIndex = findEntry(fileName);
+    selectorIndex = findEntry(fileName, false);
   } else {
     loadFiles();
   }
@@ -129,12 +50,12 @@ void FileBrowserActivity::onEnter() {
 
 void FileBrowserActivity::onExit() {
   Activity::onExit();
-  files.clear();
+  files.close();
 }
 
 void FileBrowserActivity::clearFileMetadata(const std::string& fullPath) {
-  // Only clear cache for .epub files
-  if (FsHelpers::hasEpubExtension(fullPath)) {
+  // Only clear cache for .epub and .fb2 files
+  if (FsHelpers::hasEpubExtension(fullPath) || FsHelpers::hasFb2Extension(fullPath)) {
     Epub(fullPath, "/.crosspoint").clearCache();
     LOG_DBG("FileBrowser", "Cleared metadata cache for: %s", fullPath.c_str());
   }
@@ -162,9 +83,14 @@ void FileBrowserActivity::loop() {
   const int pageItems = UITheme::getNumberOfItemsPerPage(renderer, true, false, true, false, pathReserved);
 
   if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
-    if (files.empty()) return;
+    if (files.size() == 0) return;
 
-    const std::string& entry = files[selectorIndex];
+    std::string entry;
+    {
+      RenderLock lock(*this);
+      entry = listName(selectorIndex);
+    }
+    if (entry.empty()) return;
     bool isDirectory = (entry.back() == '/');
 
     if (mappedInput.getHeldTime() >= GO_HOME_MS && !isDirectory) {
@@ -173,14 +99,20 @@ void FileBrowserActivity::loop() {
       if (cleanBasePath.back() != '/') cleanBasePath += "/";
       const std::string fullPath = cleanBasePath + entry;
 
-      auto handler = [this, fullPath](const ActivityResult& res) {
+      auto handler = [this, fullPath, entry](const ActivityResult& res) {
         if (!res.isCancelled) {
           LOG_DBG("FileBrowser", "Attempting to delete: %s", fullPath.c_str());
           clearFileMetadata(fullPath);
-          if (Storage.remove(fullPath.c_str())) {
+          bool removed;
+          {
+            DirectoryIndex::Edit edit(basepath);
+            removed = Storage.remove(fullPath.c_str());
+            if (removed) edit.removed(entry);
+          }
+          if (removed) {
             LOG_DBG("FileBrowser", "Deleted successfully");
             loadFiles();
-            if (files.empty()) {
+            if (files.size() == 0) {
               selectorIndex = 0;
             } else if (selectorIndex >= files.size()) {
               // Move selection to the new "last" item
@@ -227,8 +159,8 @@ void FileBrowserActivity::loop() {
         loadFiles();
 
         const auto pos = oldPath.find_last_of('/');
-        const std::string dirName = oldPath.substr(pos + 1) + "/";
-        selectorIndex = findEntry(dirName);
+        const std::string dirName = oldPath.substr(pos + 1);
+        selectorIndex = findEntry(dirName, true);
 
         requestUpdate();
       } else {
@@ -248,13 +180,23 @@ void FileBrowserActivity::loop() {
     requestUpdate();
   });
 
-  buttonNavigator.onNextContinuous([this, listSize, pageItems] {
-    selectorIndex = ButtonNavigator::nextPageIndex(static_cast<int>(selectorIndex), listSize, pageItems);
+  // Held long, the selection goes a page, then several, then an initial letter at a time
+  const auto initialKey = [this](const int index) { return listInitialKey(index); };
+  buttonNavigator.onNextContinuous([this, listSize, pageItems, &initialKey] {
+    RenderLock lock(*this);
+    selectorIndex = buttonNavigator.continuousGroupJumps()
+                        ? ButtonNavigator::nextGroupIndex(static_cast<int>(selectorIndex), listSize, initialKey)
+                        : ButtonNavigator::nextPageIndex(static_cast<int>(selectorIndex), listSize, pageItems,
+                                                         buttonNavigator.continuousStride());
     requestUpdate();
   });
 
-  buttonNavigator.onPreviousContinuous([this, listSize, pageItems] {
-    selectorIndex = ButtonNavigator::previousPageIndex(static_cast<int>(selectorIndex), listSize, pageItems);
+  buttonNavigator.onPreviousContinuous([this, listSize, pageItems, &initialKey] {
+    RenderLock lock(*this);
+    selectorIndex = buttonNavigator.continuousGroupJumps()
+                        ? ButtonNavigator::previousGroupIndex(static_cast<int>(selectorIndex), listSize, initialKey)
+                        : ButtonNavigator::previousPageIndex(static_cast<int>(selectorIndex), listSize, pageItems,
+                                                             buttonNavigator.continuousStride());
     requestUpdate();
   });
 }
@@ -294,14 +236,14 @@ void FileBrowserActivity::render(RenderLock&&) {
   const int contentTop = metrics.topPadding + metrics.headerHeight + metrics.verticalSpacing;
   const int contentHeight =
       pageHeight - contentTop - metrics.buttonHintsHeight - metrics.verticalSpacing - pathReserved;
-  if (files.empty()) {
+  if (files.size() == 0) {
     renderer.drawText(UI_10_FONT_ID, metrics.contentSidePadding, contentTop + 20, tr(STR_NO_FILES_FOUND));
   } else {
     GUI.drawList(
         renderer, Rect{0, contentTop, pageWidth, contentHeight}, files.size(), selectorIndex,
-        [this](int index) { return getFileName(files[index]); }, nullptr,
-        [this](int index) { return UITheme::getFileIcon(files[index]); },
-        [this](int index) { return getFileExtension(files[index]); }, false);
+        [this](int index) { return getFileName(listName(index)); }, nullptr,
+        [this](int index) { return UITheme::getFileIcon(listName(index)); },
+        [this](int index) { return getFileExtension(listName(index)); }, false);
   }
 
   // Full path display
@@ -333,15 +275,29 @@ void FileBrowserActivity::render(RenderLock&&) {
 
   // Help text
   const auto labels =
-      mappedInput.mapLabels(basepath == "/" ? tr(STR_HOME) : tr(STR_BACK), files.empty() ? "" : tr(STR_OPEN),
-                            files.empty() ? "" : tr(STR_DIR_UP), files.empty() ? "" : tr(STR_DIR_DOWN));
+      mappedInput.mapLabels(basepath == "/" ? tr(STR_HOME) : tr(STR_BACK), files.size() == 0 ? "" : tr(STR_OPEN),
+                            files.size() == 0 ? "" : tr(STR_DIR_UP), files.size() == 0 ? "" : tr(STR_DIR_DOWN));
   GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
-  renderer.displayBuffer();
+  renderer.displayChanges();
+}
+
+size_t FileBrowserActivity::findEntry(const std::string& name, const bool isDirectory) {
+  RenderLock lock(*this);
+  const size_t index = files.find(name, isDirectory);
+  return index == DirectoryIndex::npos ? 0 : index;
+}
+
+uint32_t FileBrowserActivity::listInitialKey(const size_t index) {
+  // The groups DirectoryIndex::less() sorts into: directories, then files, each by initial letter. Numbers sort by
+  // value, not by their first digit, so all of them are one group; less() compares signed chars, hence the flip.
+  const auto entry = files.at(index);
+  const char initial = entry.name.empty() ? '\0' : static_cast<char>(tolower(entry.name[0]));
+  const uint8_t ordered = static_cast<uint8_t>(isdigit(initial) ? '0' : initial) ^ 0x80;
+  return (entry.isDirectory ? 0 : 0x100) | ordered;
 }
 
-size_t FileBrowserActivity::findEntry(const std::string& name) const {
-  for (size_t i = 0; i < files.size(); i++)
-    if (files[i] == name) return i;
-  return 0;
+std::string FileBrowserActivity::listName(const size_t index) {
+  const auto& entry = files.at(index);
+  return entry.isDirectory ? entry.name + "/" : entry.name;
 }
@@ -2,11 +2,11 @@
 
 #include <functional>
 #include <string>
-#include <vector>
 
 #include "../Activity.h"
 #include "RecentBooksStore.h"
 #include "util/ButtonNavigator.h"
+#include "util/DirectoryIndex.h"
 
 class FileBrowserActivity final : public Activity {
  private:
@@ -21,11 +21,15 @@ class FileBrowserActivity final : public Activity {
 
   // Files state
   std::string basepath = "/";
-  std::vector<std::string> files;
+  DirectoryIndex files;
 
   // Data loading
   void loadFiles();
-  size_t findEntry(const std::string& name) const;
+  size_t findEntry(const std::string& name, bool isDirectory);
+  // Entry name as the list shows it: directories end in '/'
+  std::string listName(size_t index);
+  // Initial letter group of an entry, for jumping through the sorted listing (caller holds RenderLock)
+  uint32_t listInitialKey(size_t index);
 
  public:
   explicit FileBrowserActivity(GfxRenderer& renderer, MappedInputManager& mappedInput, std::string initialPath = "/")
@@ -1,13 +1,12 @@
 #include "HomeActivity.h"
 
 #include <Bitmap.h>
-#include <Epub.h>
-#include <FsHelpers.h>
 #include <GfxRenderer.h>
+#include <HalGPIO.h>
 #include <HalStorage.h>
 #include <I18n.h>
+#include <MemoryBudget.h>
 #include <Utf8.h>
-#include <Xtc.h>
 
 #include <cstring>
 #include <vector>
@@ -15,10 +14,33 @@
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
 #include "MappedInputManager.h"
+#include "PerfHistory.h"
 #include "RecentBooksStore.h"
 #include "components/UITheme.h"
 #include "fontIds.h"
 
+namespace {
+// Cover buffer of the last visit, so returning home does not redraw the covers from their thumbnails
+constexpr char COVER_CACHE_FILE[] = "/.crosspoint/home.fb";
+constexpr uint32_t COVER_CACHE_MAGIC = 0x31434648;  // "HFC1"
+
+struct CoverCacheHeader {
+  uint32_t magic;
+  uint32_t key;
+  uint32_t size;
+};
+
+uint32_t fnv1a(uint32_t hash, const void* data, const size_t size) {
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < size; i++) {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+  return hash;
+}
+
+uint32_t fnv1a(const uint32_t hash, const std::string& s) { return fnv1a(hash, s.c_str(), s.size() + 1); }
+}  // namespace
+
 int HomeActivity::getMenuItemCount() const {
   int count = 4;  // File Browser, Recents, File transfer, Settings
   if (!recentBooks.empty()) {
@@ -30,7 +52,9 @@ int HomeActivity::getMenuItemCount() const {
   return count;
 }
 
-void HomeActivity::loadRecentBooks(int maxBooks) {
+// The first render goes by the recents record alone, so the screen comes up without a file system lookup per book;
+// checkRecentBooks() looks at the card once it is shown
+void HomeActivity::loadRecentBooks(int maxBooks, const bool skipMissing) {
   recentBooks.clear();
   const auto& books = RECENT_BOOKS.getBooks();
   recentBooks.reserve(std::min(static_cast<int>(books.size()), maxBooks));
@@ -42,7 +66,7 @@ void HomeActivity::loadRecentBooks(int maxBooks) {
     }
 
     // Skip if file no longer exists
-    if (!Storage.exists(book.path.c_str())) {
+    if (skipMissing && !Storage.exists(book.path.c_str())) {
       continue;
     }
 
@@ -50,61 +74,87 @@ void HomeActivity::loadRecentBooks(int maxBooks) {
   }
 }
 
-void HomeActivity::loadRecentCovers(int coverHeight) {
-  recentsLoading = true;
-  bool showingLoading = false;
-  Rect popupRect;
-
-  int progress = 0;
+// Whether the thumbnails of the books the record says have one are there; updates the record, true if it was wrong
+bool HomeActivity::checkThumbnails(const int coverHeight) {
+  bool changed = false;
   for (RecentBook& book : recentBooks) {
-    if (!book.coverBmpPath.empty()) {
-      std::string coverPath = UITheme::getCoverThumbPath(book.coverBmpPath, coverHeight);
-      if (!Storage.exists(coverPath.c_str())) {
-        // If epub, try to load the metadata for title/author and cover
-        if (FsHelpers::hasEpubExtension(book.path)) {
-          Epub epub(book.path, "/.crosspoint");
-          // Skip loading css since we only need metadata here
-          epub.load(false, true);
-
-          // Try to generate thumbnail image for Continue Reading card
-          if (!showingLoading) {
-            showingLoading = true;
-            popupRect = GUI.drawPopup(renderer, tr(STR_LOADING_POPUP));
-          }
-          GUI.fillPopupProgress(renderer, popupRect, 10 + progress * (90 / recentBooks.size()));
-          bool success = epub.generateThumbBmp(coverHeight);
-          if (!success) {
-            RECENT_BOOKS.updateBook(book.path, book.title, book.author, "");
-            book.coverBmpPath = "";
-          }
-          coverRendered = false;
-          requestUpdate();
-        } else if (FsHelpers::hasXtcExtension(book.path)) {
-          // Handle XTC file
-          Xtc xtc(book.path, "/.crosspoint");
-          if (xtc.load()) {
-            // Try to generate thumbnail image for Continue Reading card
-            if (!showingLoading) {
-              showingLoading = true;
-              popupRect = GUI.drawPopup(renderer, tr(STR_LOADING_POPUP));
-            }
-            GUI.fillPopupProgress(renderer, popupRect, 10 + progress * (90 / recentBooks.size()));
-            bool success = xtc.generateThumbBmp(coverHeight);
-            if (!success) {
-              RECENT_BOOKS.updateBook(book.path, book.title, book.author, "");
-              book.coverBmpPath = "";
-            }
-            coverRendered = false;
-            requestUpdate();
-          }
-        }
-      }
+    const bool hasThumb = !book.coverBmpPath.empty() &&
+                          Storage.exists(UITheme::getCoverThumbPath(book.coverBmpPath, coverHeight).c_str());
+    const uint16_t thumbHeight = hasThumb ? coverHeight : 0;
+    if (book.thumbHeight != thumbHeight) {
+      book.thumbHeight = thumbHeight;
+      RECENT_BOOKS.setThumbHeight(book.path, thumbHeight);
+      changed = true;
+    }
+  }
+  return changed;
+}
+
+void HomeActivity::checkRecentBooks(int coverHeight) {
+  bool booksChanged = false;
+  for (const RecentBook& book : recentBooks) {
+    if (!Storage.exists(book.path.c_str())) {
+      // Deleted since: the next books of the record move up
+      loadRecentBooks(UITheme::getInstance().getMetrics().homeRecentBooksCount, true);
+      selectorIndex = std::min(selectorIndex, getMenuItemCount() - 1);
+      booksChanged = true;
+      break;
+    }
+  }
+  const bool thumbsChanged = checkThumbnails(coverHeight);
+
+  // Missing thumbnails are generated in the background; each one is drawn as soon as it lands (see loop())
+  for (const RecentBook& book : recentBooks) {
+    if (!book.coverBmpPath.empty() && book.thumbHeight != coverHeight) {
+      thumbnails->enqueue(book.path);
     }
-    progress++;
+  }
+
+  // Covers the first render drew from the thumbnails are right as they are; a cover buffer from the card was picked
+  // by what the record said
+  if (booksChanged || (thumbsChanged && coverBufferCached)) {
+    freeCoverBuffer();
+    coverRendered = false;
+    requestUpdate();
   }
 
   recentsLoaded = true;
-  recentsLoading = false;
+}
+
+void HomeActivity::pollThumbnails() {
+  if (!thumbnails) {
+    return;
+  }
+
+  // Queued from here rather than from render(), so the generator is only ever driven by the main loop
+  if (firstRenderDone && !recentsLoaded) {
+    checkRecentBooks(UITheme::getInstance().getMetrics().homeCoverHeight);
+  }
+
+  // While charging, use the time to prepare the rest of the library too
+  if (gpio.isUsbConnected()) {
+    thumbnails->scanLibrary();
+  }
+
+  std::string failedPath;
+  while (thumbnails->takeFailed(failedPath)) {
+    for (RecentBook& book : recentBooks) {
+      if (book.path == failedPath) {
+        RECENT_BOOKS.updateBook(book.path, book.title, book.author, "");
+        book.coverBmpPath = "";
+        book.thumbHeight = 0;
+        coverRendered = false;
+        requestUpdate();
+      }
+    }
+  }
+
+  if (thumbnails->getGeneratedCount() != thumbnailsDrawn) {
+    thumbnailsDrawn = thumbnails->getGeneratedCount();
+    checkThumbnails(UITheme::getInstance().getMetrics().homeCoverHeight);
+    coverRendered = false;
+    requestUpdate();
+  }
 }
 
 void HomeActivity::onEnter() {
@@ -116,7 +166,20 @@ void HomeActivity::onEnter() {
   selectorIndex = 0;
 
   const auto& metrics = UITheme::getInstance().getMetrics();
-  loadRecentBooks(metrics.homeRecentBooksCount);
+  loadRecentBooks(metrics.homeRecentBooksCount, false);
+  thumbnails = std::make_unique<ThumbnailGenerator>(metrics.homeCoverHeight);
+  thumbnailsDrawn = 0;
+
+  coverRendered = coverBufferStored = readCoverBufferCache();
+  // Dropped last: the next render then draws every cover again
+  MemoryBudget::registerCache(this, "home covers", MemoryBudget::EVICT_LAST, [this] {
+    if (!coverBuffer) {
+      return false;
+    }
+    freeCoverBuffer();
+    coverRendered = false;
+    return true;
+  });
 
   // Trigger first update
   requestUpdate();
@@ -124,11 +187,74 @@ void HomeActivity::onEnter() {
 
 void HomeActivity::onExit() {
   Activity::onExit();
+  MemoryBudget::unregisterCache(this);
+
+  if (thumbnails) {
+    thumbnails->stop();
+    thumbnails.reset();
+  }
 
+  if (coverBufferStored && !coverBufferCached) {
+    writeCoverBufferCache();
+  }
   // Free the stored cover buffer if any
   freeCoverBuffer();
 }
 
+// Everything the cover buffer is drawn from. The header is left out: it clears and redraws its area on every render.
+uint32_t HomeActivity::coverBufferKey() const {
+  const auto& metrics = UITheme::getInstance().getMetrics();
+  uint32_t key = 2166136261u;
+  const uint8_t layout[] = {SETTINGS.uiTheme, static_cast<uint8_t>(renderer.getOrientation())};
+  key = fnv1a(key, layout, sizeof(layout));
+  for (const RecentBook& book : recentBooks) {
+    key = fnv1a(key, book.path);
+    key = fnv1a(key, book.coverBmpPath);
+    // Thumbnails are generated in the background, possibly while another screen is shown; the record has been told
+    // by the last visit that saw them
+    const bool hasThumb = !book.coverBmpPath.empty() && book.thumbHeight == metrics.homeCoverHeight;
+    key = fnv1a(key, &hasThumb, sizeof(hasThumb));
+  }
+  return key;
+}
+
+bool HomeActivity::readCoverBufferCache() {
+  FsFile file;
+  if (!Storage.exists(COVER_CACHE_FILE) || !Storage.openFileForRead("HOME", COVER_CACHE_FILE, file)) {
+    return false;
+  }
+  const size_t bufferSize = renderer.getBufferSize();
+  CoverCacheHeader header;
+  if (file.read(&header, sizeof(header)) != sizeof(header) || header.magic != COVER_CACHE_MAGIC ||
+      header.size != bufferSize || header.key != coverBufferKey()) {
+    return false;
+  }
+
+  freeCoverBuffer();
+  coverBuffer = static_cast<uint8_t*>(malloc(bufferSize));
+  if (!coverBuffer || file.read(coverBuffer, bufferSize) != static_cast<int>(bufferSize)) {
+    freeCoverBuffer();
+    return false;
+  }
+  coverBufferCached = true;
+  LOG_DBG("HOME", "Restored cover buffer from cache");
+  return true;
+}
+
+void HomeActivity::writeCoverBufferCache() {
+  FsFile file;
+  if (!coverBuffer || !Storage.openFileForWrite("HOME", COVER_CACHE_FILE, file)) {
+    return;
+  }
+  const CoverCacheHeader header = {COVER_CACHE_MAGIC, coverBufferKey(),
+                                   static_cast<uint32_t>(renderer.getBufferSize())};
+  if (file.write(&header, sizeof(header)) != sizeof(header) || file.write(coverBuffer, header.size) != header.size) {
+    file.close();
+    Storage.remove(COVER_CACHE_FILE);
+    LOG_ERR("HOME", "Could not cache cover buffer");
+  }
+}
+
 bool HomeActivity::storeCoverBuffer() {
   uint8_t* frameBuffer = renderer.getFrameBuffer();
   if (!frameBuffer) {
@@ -145,6 +271,7 @@ bool HomeActivity::storeCoverBuffer() {
   }
 
   memcpy(coverBuffer, frameBuffer, bufferSize);
+  coverBufferCached = false;
   return true;
 }
 
@@ -169,9 +296,12 @@ void HomeActivity::freeCoverBuffer() {
     coverBuffer = nullptr;
   }
   coverBufferStored = false;
+  coverBufferCached = false;
 }
 
 void HomeActivity::loop() {
+  pollThumbnails();
+
   const int menuCount = getMenuItemCount();
 
   buttonNavigator.onNext([this, menuCount] {
@@ -247,14 +377,12 @@ void HomeActivity::render(RenderLock&&) {
   const auto labels = mappedInput.mapLabels("", tr(STR_SELECT), tr(STR_DIR_UP), tr(STR_DIR_DOWN));
   GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
-  renderer.displayBuffer();
+  renderer.displayChanges();
 
   if (!firstRenderDone) {
     firstRenderDone = true;
+    PERF_HISTORY.recordBootDone();
     requestUpdate();
-  } else if (!recentsLoaded && !recentsLoading) {
-    recentsLoading = true;
-    loadRecentCovers(metrics.homeCoverHeight);
   }
 }
 
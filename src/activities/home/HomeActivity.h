@@ -1,9 +1,11 @@
 #pragma once
 #include <functional>
+#include <memory>
 #include <vector>
 
 #include "../Activity.h"
 #include "./FileBrowserActivity.h"
+#include "ThumbnailGenerator.h"
 #include "util/ButtonNavigator.h"
 
 struct RecentBook;
@@ -12,14 +14,16 @@ struct Rect;
 class HomeActivity final : public Activity {
   ButtonNavigator buttonNavigator;
   int selectorIndex = 0;
-  bool recentsLoading = false;
   bool recentsLoaded = false;
   bool firstRenderDone = false;
   bool hasOpdsUrl = false;
   bool coverRendered = false;      // Track if cover has been rendered once
   bool coverBufferStored = false;  // Track if cover buffer is stored
+  bool coverBufferCached = false;  // Cover buffer matches the copy on the SD card
   uint8_t* coverBuffer = nullptr;  // HomeActivity's own buffer for cover image
   std::vector<RecentBook> recentBooks;
+  std::unique_ptr<ThumbnailGenerator> thumbnails;
+  uint32_t thumbnailsDrawn = 0;  // Generated count the covers were last redrawn for
   void onSelectBook(const std::string& path);
   void onFileBrowserOpen();
   void onRecentsOpen();
@@ -31,8 +35,13 @@ class HomeActivity final : public Activity {
   bool storeCoverBuffer();    // Store frame buffer for cover image
   bool restoreCoverBuffer();  // Restore frame buffer from stored cover
   void freeCoverBuffer();     // Free the stored cover buffer
-  void loadRecentBooks(int maxBooks);
-  void loadRecentCovers(int coverHeight);
+  uint32_t coverBufferKey() const;
+  bool readCoverBufferCache();  // Load the cover buffer composed on an earlier visit
+  void writeCoverBufferCache();
+  void loadRecentBooks(int maxBooks, bool skipMissing);
+  void checkRecentBooks(int coverHeight);
+  bool checkThumbnails(int coverHeight);
+  void pollThumbnails();
 
  public:
   explicit HomeActivity(GfxRenderer& renderer, MappedInputManager& mappedInput)
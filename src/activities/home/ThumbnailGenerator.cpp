@@ -0,0 +1,326 @@
+#include "ThumbnailGenerator.h"
+
+#include <Epub.h>
+#include <Epub/Section.h>
+#include <FsHelpers.h>
+#include <GfxRenderer.h>
+#include <HalPowerManager.h>
+#include <HalStorage.h>
+#include <Logging.h>
+#include <MemoryBudget.h>
+#include <Xtc.h>
+
+#include <cstring>
+#include <memory>
+
+#include "CrossPointSettings.h"
+#include "LibraryDatabase.h"
+#include "SdReaderFont.h"
+#include "activities/RenderLock.h"
+#include "activities/reader/ReaderUtils.h"
+
+namespace {
+constexpr unsigned long LOW_HEAP_RETRY_MS = 2000;
+constexpr unsigned long LOCK_TIMEOUT_MS = 100;
+constexpr const char* CACHE_DIR = "/.crosspoint";
+
+bool isEpubBook(const std::string& path) {
+  return FsHelpers::hasEpubExtension(path) || FsHelpers::hasFb2Extension(path);
+}
+bool isBook(const std::string& path) { return isEpubBook(path) || FsHelpers::hasXtcExtension(path); }
+
+// Locks a FreeRTOS mutex for the enclosing scope
+class MutexGuard {
+  SemaphoreHandle_t mutex;
+
+ public:
+  explicit MutexGuard(SemaphoreHandle_t mutex) : mutex(mutex) { xSemaphoreTake(mutex, portMAX_DELAY); }
+  ~MutexGuard() { xSemaphoreGive(mutex); }
+  MutexGuard(const MutexGuard&) = delete;
+  MutexGuard& operator=(const MutexGuard&) = delete;
+};
+}  // namespace
+
+ThumbnailGenerator::ThumbnailGenerator(const int coverHeight)
+    : Worker("ThumbnailGenerator"), coverHeight(coverHeight), queueMutex(xSemaphoreCreateMutex()) {}
+
+ThumbnailGenerator::~ThumbnailGenerator() {
+  stop();
+  if (queueMutex) {
+    vSemaphoreDelete(queueMutex);
+  }
+}
+
+void ThumbnailGenerator::enqueue(const std::string& bookPath) {
+  if (!queueMutex || !isBook(bookPath)) {
+    return;
+  }
+  bool restart;
+  {
+    MutexGuard guard(queueMutex);
+    queue.push_back(bookPath);
+    restart = exiting;
+    exiting = false;
+  }
+  ensureRunning(restart);
+}
+
+void ThumbnailGenerator::scanLibrary() {
+  if (!queueMutex || libraryScanRequested) {
+    return;
+  }
+  bool restart;
+  {
+    MutexGuard guard(queueMutex);
+    libraryScanRequested = true;
+    restart = exiting;
+    exiting = false;
+  }
+  ensureRunning(restart);
+}
+
+void ThumbnailGenerator::ensureRunning(const bool restart) {
+  if (restart || !isRunning()) {
+    // A task that found nothing left to do may still be on its way out; wait for it before starting a new one
+    stop();
+    start(STACK_SIZE);
+  }
+}
+
+bool ThumbnailGenerator::takeFailed(std::string& bookPath) {
+  if (!queueMutex) {
+    return false;
+  }
+  MutexGuard guard(queueMutex);
+  if (failed.empty()) {
+    return false;
+  }
+  bookPath = std::move(failed.back());
+  failed.pop_back();
+  return true;
+}
+
+ThumbnailGenerator::QueueStatus ThumbnailGenerator::getQueueStatus() const {
+  QueueStatus status;
+  if (!queueMutex) {
+    return status;
+  }
+  MutexGuard guard(queueMutex);
+  status.pending = queue.size() + (currentBook.empty() ? 0 : 1);
+  status.done = queuedDone;
+  status.current = currentBook;
+  return status;
+}
+
+bool ThumbnailGenerator::takeQueued(std::string& bookPath) {
+  MutexGuard guard(queueMutex);
+  if (queue.empty()) {
+    return false;
+  }
+  bookPath = std::move(queue.front());
+  queue.pop_front();
+  currentBook = bookPath;
+  return true;
+}
+
+void ThumbnailGenerator::finishQueued() {
+  MutexGuard guard(queueMutex);
+  currentBook.clear();
+  queuedDone++;
+}
+
+bool ThumbnailGenerator::nextLibraryBook(std::string& bookPath) {
+  if (!libraryScanStarted) {
+    libraryScanStarted = true;
+    pendingDirs.emplace_back("/");
+  }
+
+  // Depth-first. Each directory is listed in one go and closed before any other is opened, so the walk never holds
+  // more than one directory handle.
+  while (pendingBooks.empty()) {
+    if (stopRequested()) {
+      return false;
+    }
+    if (pendingDirs.empty()) {
+      if (!libraryPruned) {
+        // Every book on the card has been seen, so records of any others are stale
+        libraryPruned = true;
+        LIBRARY.prune();
+      }
+      return false;
+    }
+    const std::string dirPath = std::move(pendingDirs.back());
+    pendingDirs.pop_back();
+
+    auto dir = Storage.open(dirPath.c_str());
+    if (!dir || !dir.isDirectory()) {
+      continue;
+    }
+    char name[256];
+    for (auto file = dir.openNextFile(); file; file = dir.openNextFile()) {
+      file.getName(name, sizeof(name));
+      if (name[0] == '.' || strcmp(name, "System Volume Information") == 0) {
+        continue;
+      }
+      std::string path = dirPath == "/" ? "/" + std::string(name) : dirPath + "/" + name;
+      if (file.isDirectory()) {
+        pendingDirs.push_back(std::move(path));
+      } else if (isBook(path)) {
+        pendingBooks.push_back(std::move(path));
+      }
+    }
+  }
+
+  bookPath = std::move(pendingBooks.back());
+  pendingBooks.pop_back();
+  return true;
+}
+
+bool ThumbnailGenerator::needsThumbnail(const std::string& bookPath) const {
+  if (isEpubBook(bookPath)) {
+    // A stale cache still holds the thumbnail of the book's previous copy
+    const Epub epub(bookPath, CACHE_DIR);
+    return !Storage.exists(epub.getThumbBmpPath(coverHeight).c_str()) || epub.isCacheStale();
+  }
+  return !Storage.exists(Xtc(bookPath, CACHE_DIR).getThumbBmpPath(coverHeight).c_str());
+}
+
+// Returns whether a thumbnail was written
+bool ThumbnailGenerator::generate(const std::string& bookPath, const bool wantThumbnail, const bool wantRecord) {
+  LOG_DBG("THB", "Loading %s for its %s", bookPath.c_str(), wantThumbnail ? "thumbnail" : "library record");
+  if (isEpubBook(bookPath)) {
+    Epub epub(bookPath, CACHE_DIR);
+    // Books found on the card or just uploaded may never have been opened, so build the metadata cache if needed.
+    if (!epub.load(true)) {
+      return false;
+    }
+    if (wantRecord) {
+      LIBRARY.putBook(bookPath, epub.getTitle(), epub.getAuthor(), epub.getLanguage(), epub.getThumbBmpPath());
+    }
+    return wantThumbnail && epub.generateThumbBmp(coverHeight);
+  }
+
+  Xtc xtc(bookPath, CACHE_DIR);
+  if (!xtc.load()) {
+    return false;
+  }
+  if (wantRecord) {
+    LIBRARY.putBook(bookPath, xtc.getTitle(), xtc.getAuthor(), "", xtc.getThumbBmpPath());
+  }
+  return wantThumbnail && xtc.generateThumbBmp(coverHeight);
+}
+
+// Returns false if the layout gave way to the render task and has to be continued
+bool ThumbnailGenerator::preindex(const std::string& bookPath) {
+  const bool cropped = SETTINGS.sleepScreenCoverMode == CrossPointSettings::SLEEP_SCREEN_COVER_MODE::CROP;
+  if (FsHelpers::hasXtcExtension(bookPath)) {
+    Xtc xtc(bookPath, CACHE_DIR);
+    if (xtc.load()) {
+      xtc.generateCoverBmp();
+    }
+    return true;
+  }
+
+  // Loaded as the reader does, so the section is laid out with the same styles
+  const auto epub = std::make_shared<Epub>(bookPath, CACHE_DIR);
+  if (!epub->load(true)) {
+    return true;
+  }
+  epub->generateCoverBmp(cropped);
+
+  GfxRenderer& renderer = *preindexRenderer;
+  const auto orientation = renderer.getOrientation();
+  SD_READER_FONT.sync(renderer);
+  ReaderUtils::applyOrientation(renderer, SETTINGS.orientation);
+  const auto margins = ReaderUtils::getEpubMargins(renderer, false);
+  const uint16_t viewportWidth = renderer.getScreenWidth() - margins.left - margins.right;
+  const uint16_t viewportHeight = renderer.getScreenHeight() - margins.top - margins.bottom;
+
+  // The reader opens a new book at its text reference, so that chapter is the one to have ready
+  Section section(epub, epub->getSpineIndexForTextReference(), renderer);
+  bool complete = section.loadSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                                          SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
+                                          viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle,
+                                          SETTINGS.imageRendering);
+  if (!complete) {
+    LOG_DBG("THB", "Pre-indexing %s", bookPath.c_str());
+    complete = section.createSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                                         SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
+                                         viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle,
+                                         SETTINGS.imageRendering, nullptr, [this] { return shouldYield(); }) ||
+               !section.isPartial();
+  }
+
+  renderer.setOrientation(orientation);
+  SD_READER_FONT.release(renderer);
+  return complete;
+}
+
+void ThumbnailGenerator::run() {
+  std::string bookPath;
+  bool fromQueue = false;
+  bool wantThumbnail = false;
+  bool wantRecord = false;
+  bool wantPreindex = false;
+  while (!stopRequested()) {
+    if (bookPath.empty()) {
+      fromQueue = takeQueued(bookPath);
+      if (!fromQueue && !(libraryScanRequested && nextLibraryBook(bookPath))) {
+        MutexGuard guard(queueMutex);
+        if (!queue.empty() || (libraryScanRequested && !libraryScanStarted)) {
+          continue;  // Arrived since the check above
+        }
+        // Work handed over from now on restarts the task
+        exiting = true;
+        LOG_DBG("THB", "No more thumbnails to generate");
+        return;
+      }
+      wantThumbnail = needsThumbnail(bookPath);
+      wantRecord = !LIBRARY.hasCurrentRecord(bookPath);
+      wantPreindex = fromQueue && preindexRenderer;
+      if (!wantThumbnail && !wantRecord && !wantPreindex) {
+        if (fromQueue) {
+          finishQueued();
+        }
+        bookPath.clear();
+        continue;
+      }
+    }
+
+    RenderLock lock(LOCK_TIMEOUT_MS);
+    if (!lock.isHeld() || stopRequested()) {
+      continue;
+    }
+    // The cover decoders need ~50KB on top of the book's metadata; wait for the heap rather than fail the book
+    if (!MemoryBudget::reserve(MIN_FREE_HEAP, 0)) {
+      lock.unlock();
+      sleepFor(LOW_HEAP_RETRY_MS);
+      continue;
+    }
+    HalPowerManager::Lock powerLock;  // Decoding and layout run at full speed, until this iteration yields
+
+    if (wantThumbnail || wantRecord) {
+      if (generate(bookPath, wantThumbnail, wantRecord)) {
+        generatedCount = generatedCount + 1;
+      } else if (wantThumbnail) {
+        LOG_DBG("THB", "No thumbnail for %s", bookPath.c_str());
+        if (fromQueue) {
+          MutexGuard guard(queueMutex);
+          failed.push_back(bookPath);
+        }
+      }
+      wantThumbnail = false;
+      wantRecord = false;
+      if (wantPreindex) {
+        continue;  // Give the lock back between the stages
+      }
+    } else if (wantPreindex && !preindex(bookPath)) {
+      continue;  // Interrupted; the section build resumes from its checkpoint
+    }
+
+    if (fromQueue) {
+      finishQueued();
+    }
+    bookPath.clear();
+  }
+}
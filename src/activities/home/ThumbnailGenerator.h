@@ -0,0 +1,89 @@
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "activities/Worker.h"
+
+class GfxRenderer;
+
+/**
+ * Generates home-screen cover thumbnails (thumb_<height>.bmp in each book's cache directory) in the background, so
+ * the home screen draws whichever thumbnails exist and never waits on a cover decode. Books it loads are recorded in
+ * the library database on the way, so the library walk is also what fills the database.
+ *
+ * Books are taken from the queue first (the recent books, a file that was just uploaded), then, once scanLibrary() has
+ * been called, from a walk of the whole SD card. Each thumbnail is generated while holding RenderLock, because the home
+ * screen reads the same files while rendering and the cover decoders keep static state. A job waits while free heap is
+ * short (e.g. with WiFi up) rather than failing.
+ *
+ * With preindexQueued(), queued books are also prepared for their first open, as the web server screen does for
+ * uploads: the sleep screen cover and the chapter the reader opens at, laid out with the current reader settings. That
+ * layout gives the lock back whenever the render task wants it, and continues from its checkpoint.
+ */
+class ThumbnailGenerator final : public Worker {
+  const int coverHeight;
+
+  SemaphoreHandle_t queueMutex = nullptr;
+  // Guarded by queueMutex
+  std::deque<std::string> queue;
+  std::vector<std::string> failed;
+  bool exiting = false;  // run() found no work and is returning
+  std::string currentBook;  // Queued book being prepared, empty otherwise
+  uint32_t queuedDone = 0;
+
+  GfxRenderer* preindexRenderer = nullptr;
+
+  volatile bool libraryScanRequested = false;
+  volatile uint32_t generatedCount = 0;
+
+  // Worker-only library walk state
+  std::vector<std::string> pendingDirs;
+  std::vector<std::string> pendingBooks;
+  bool libraryScanStarted = false;
+  bool libraryPruned = false;
+
+  void ensureRunning(bool restart);
+  bool takeQueued(std::string& bookPath);
+  bool nextLibraryBook(std::string& bookPath);
+  bool needsThumbnail(const std::string& bookPath) const;
+  bool generate(const std::string& bookPath, bool wantThumbnail, bool wantRecord);
+  bool preindex(const std::string& bookPath);
+  void finishQueued();
+
+ protected:
+  void run() override;
+
+ public:
+  static constexpr uint32_t STACK_SIZE = 8192;  // Same as the render task, which used to generate them
+  static constexpr size_t MIN_FREE_HEAP = 80 * 1024;
+
+  struct QueueStatus {
+    size_t pending = 0;
+    uint32_t done = 0;
+    std::string current;
+  };
+
+  explicit ThumbnailGenerator(int coverHeight);
+  ~ThumbnailGenerator() override;
+
+  // Call before enqueueing anything. The renderer is used for layout only, while holding RenderLock.
+  void preindexQueued(GfxRenderer& renderer) { preindexRenderer = &renderer; }
+
+  // Called from the main loop. Queued books are generated in order, before any found by the library walk.
+  void enqueue(const std::string& bookPath);
+  // Called from the main loop. Walks the SD card for books without a thumbnail or library record once the queue is
+  // empty, building the book metadata cache where needed.
+  void scanLibrary();
+
+  // Thumbnails written so far; the home screen redraws its covers when this changes
+  uint32_t getGeneratedCount() const { return generatedCount; }
+  // Books whose cover could not be turned into a thumbnail (no usable cover image), one per call
+  bool takeFailed(std::string& bookPath);
+  // Progress through the queue, for the web UI
+  QueueStatus getQueueStatus() const;
+};
@@ -4,8 +4,8 @@
 #include <ESPmDNS.h>
 #include <GfxRenderer.h>
 #include <I18n.h>
+#include <KOReaderSyncJournal.h>
 #include <WiFi.h>
-#include <esp_task_wdt.h>
 
 #include <cstddef>
 
@@ -43,7 +43,6 @@ void CrossPointWebServerActivity::onEnter() {
   isApMode = false;
   connectedIP.clear();
   connectedSSID.clear();
-  lastHandleClientTime = 0;
   requestUpdate();
 
   // Launch network mode selection subactivity
@@ -65,9 +64,18 @@ void CrossPointWebServerActivity::onExit() {
 
   state = WebServerActivityState::SHUTTING_DOWN;
 
-  // Stop the web server first (before disconnecting WiFi)
+  // A background download stops at its next chunk; the part is resumed next session
+  otaJob.stop();
+
+  // Stop the web server first (before disconnecting WiFi, and before the thumbnail generator its upload callback
+  // feeds)
   stopWebServer();
 
+  if (thumbnails) {
+    thumbnails->stop();
+    thumbnails.reset();
+  }
+
   // Stop mDNS
   MDNS.end();
 
@@ -166,6 +174,13 @@ void CrossPointWebServerActivity::onWifiSelectionComplete(const bool connected)
 
     // Start the web server
     startWebServer();
+
+    // Station mode has internet access; send reading positions queued since the last sync
+    KOReaderSyncJournal::flush();
+    // and fetch a firmware update while the radio is on anyway
+    if (webServer) {
+      otaJob.start(OtaBackgroundJob::STACK_SIZE);
+    }
   } else {
     // User cancelled - go back to mode selection
     state = WebServerActivityState::MODE_SELECTION;
@@ -242,11 +257,30 @@ void CrossPointWebServerActivity::startWebServer() {
 
   // Create the web server instance
   webServer.reset(new CrossPointWebServer());
+
+  // Prepare home-screen thumbnails while the device sits on this screen, starting with anything uploaded, which is
+  // also made ready to read. Set up before the server starts, as its task calls these callbacks.
+  thumbnails.reset(new ThumbnailGenerator(UITheme::getInstance().getMetrics().homeCoverHeight));
+  thumbnails->preindexQueued(renderer);
+  webServer->setUploadCallback([this](const std::string& path) {
+    if (thumbnails) thumbnails->enqueue(path);
+  });
+  webServer->setIndexingStatusProvider([this] {
+    CrossPointWebServer::IndexingStatus status;
+    if (thumbnails) {
+      const auto queue = thumbnails->getQueueStatus();
+      status.pending = queue.pending;
+      status.done = queue.done;
+      status.current = queue.current;
+    }
+    return status;
+  });
   webServer->begin();
 
   if (webServer->isRunning()) {
     state = WebServerActivityState::SERVER_RUNNING;
     LOG_DBG("WEBACT", "Web server started successfully");
+    thumbnails->scanLibrary();
 
     // Force an immediate render since we're transitioning from a subactivity
     // that had its own rendering task. We need to make sure our display is shown.
@@ -254,6 +288,7 @@ void CrossPointWebServerActivity::startWebServer() {
   } else {
     LOG_ERR("WEBACT", "ERROR: Failed to start web server!");
     webServer.reset();
+    thumbnails.reset();
     // Go back on error
     onGoHome();
   }
@@ -297,44 +332,7 @@ void CrossPointWebServerActivity::loop() {
       }
     }
 
-    // Handle web server requests - maximize throughput with watchdog safety
-    if (webServer && webServer->isRunning()) {
-      const unsigned long timeSinceLastHandleClient = millis() - lastHandleClientTime;
-
-      // Log if there's a significant gap between handleClient calls (>100ms)
-      if (lastHandleClientTime > 0 && timeSinceLastHandleClient > 100) {
-        LOG_DBG("WEBACT", "WARNING: %lu ms gap since last handleClient", timeSinceLastHandleClient);
-      }
-
-      // Reset watchdog BEFORE processing - HTTP header parsing can be slow
-      esp_task_wdt_reset();
-
-      // Process HTTP requests in tight loop for maximum throughput
-      // More iterations = more data processed per main loop cycle
-      constexpr int MAX_ITERATIONS = 500;
-      for (int i = 0; i < MAX_ITERATIONS && webServer->isRunning(); i++) {
-        webServer->handleClient();
-        // Reset watchdog every 32 iterations
-        if ((i & 0x1F) == 0x1F) {
-          esp_task_wdt_reset();
-        }
-        // Yield and check for exit button every 64 iterations
-        if ((i & 0x3F) == 0x3F) {
-          yield();
-          // Force trigger an update of which buttons are being pressed so be have accurate state
-          // for back button checking
-          mappedInput.update();
-          // Check for exit button inside loop for responsiveness
-          if (mappedInput.wasPressed(MappedInputManager::Button::Back)) {
-            onGoHome();
-            return;
-          }
-        }
-      }
-      lastHandleClientTime = millis();
-    }
-
-    // Handle exit on Back button (also check outside loop)
+    // Requests are served on the web server's own task
     if (mappedInput.wasPressed(MappedInputManager::Button::Back)) {
       onGoHome();
       return;
@@ -6,7 +6,9 @@
 
 #include "NetworkModeSelectionActivity.h"
 #include "activities/Activity.h"
+#include "activities/home/ThumbnailGenerator.h"
 #include "network/CrossPointWebServer.h"
+#include "network/OtaBackgroundJob.h"
 
 // Web server activity states
 enum class WebServerActivityState {
@@ -24,7 +26,10 @@ enum class WebServerActivityState {
  * - For STA mode: Launches WifiSelectionActivity to connect to an existing network
  * - For AP mode: Creates an Access Point that clients can connect to
  * - Starts the CrossPointWebServer when connected
- * - Handles client requests in its loop() function
+ * - Leaves the requests to the server's own task; loop() only watches the connection and the Back button
+ * - Generates library cover thumbnails in the background while no upload is running, uploaded books first
+ * - Pre-indexes uploaded books (sleep cover, first chapter layout) so they open quickly, reported in /api/status
+ * - In station mode, downloads a newer firmware release in the background, for the update screen to offer
  * - Cleans up the server and shuts down WiFi on exit
  */
 class CrossPointWebServerActivity final : public Activity {
@@ -36,13 +41,14 @@ class CrossPointWebServerActivity final : public Activity {
 
   // Web server - owned by this activity
   std::unique_ptr<CrossPointWebServer> webServer;
+  std::unique_ptr<ThumbnailGenerator> thumbnails;
+  OtaBackgroundJob otaJob;
 
   // Server status
   std::string connectedIP;
   std::string connectedSSID;  // For STA mode: network name, For AP mode: AP name
 
   // Performance monitoring
-  unsigned long lastHandleClientTime = 0;
 
   void renderServerRunning() const;
 
@@ -59,6 +65,5 @@ class CrossPointWebServerActivity final : public Activity {
   void onExit() override;
   void loop() override;
   void render(RenderLock&&) override;
-  bool skipLoopDelay() override { return webServer && webServer->isRunning(); }
   bool preventAutoSleep() override { return webServer && webServer->isRunning(); }
 };
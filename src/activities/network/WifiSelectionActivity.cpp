@@ -35,6 +35,7 @@ void WifiSelectionActivity::onEnter() {
   savePromptSelection = 0;
   forgetPromptSelection = 0;
   autoConnecting = false;
+  directConnectFailed = false;
 
   // Cache MAC address for display
   uint8_t mac[6];
@@ -174,6 +175,7 @@ void WifiSelectionActivity::selectNetwork(const int index) {
   usedSavedPassword = false;
   enteredPassword.clear();
   autoConnecting = false;
+  directConnectFailed = false;
 
   // Check if we have saved credentials for this network
   const auto* savedCred = WIFI_STORE.findCredential(selectedSSID);
@@ -226,11 +228,30 @@ void WifiSelectionActivity::attemptConnection() {
   String hostname = "CrossPoint-Reader-" + mac;
   WiFi.setHostname(hostname.c_str());
 
-  if (selectedRequiresPassword && !enteredPassword.empty()) {
-    WiFi.begin(selectedSSID.c_str(), enteredPassword.c_str());
-  } else {
-    WiFi.begin(selectedSSID.c_str());
+  const char* password = selectedRequiresPassword && !enteredPassword.empty() ? enteredPassword.c_str() : nullptr;
+  const WifiCredential* saved = usedSavedPassword ? WIFI_STORE.findCredential(selectedSSID) : nullptr;
+  directConnecting = saved && saved->lastConnection.known() && !directConnectFailed;
+  if (directConnecting) {
+    // Skip the scan of every channel: join the access point we last joined, on its channel. The address comes from
+    // DHCP as usual (see WifiConnectionInfo).
+    const WifiConnectionInfo& info = saved->lastConnection;
+    LOG_DBG("WIFI", "Connecting directly on channel %u", info.channel);
+    WiFi.begin(selectedSSID.c_str(), password, info.channel, info.bssid);
+    return;
   }
+
+  WiFi.begin(selectedSSID.c_str(), password);
+}
+
+void WifiSelectionActivity::rememberConnection() const {
+  const uint8_t* bssid = WiFi.BSSID();
+  if (!bssid) {
+    return;
+  }
+  WifiConnectionInfo info;
+  memcpy(info.bssid, bssid, sizeof(info.bssid));
+  info.channel = static_cast<uint8_t>(WiFi.channel());
+  WIFI_STORE.setConnectionInfo(selectedSSID, info);
 }
 
 void WifiSelectionActivity::checkConnectionStatus() {
@@ -253,6 +274,7 @@ void WifiSelectionActivity::checkConnectionStatus() {
     {
       RenderLock lock(*this);
       WIFI_STORE.setLastConnectedSsid(selectedSSID);
+      rememberConnection();
     }
 
     // If we entered a new password, ask if user wants to save it
@@ -271,6 +293,14 @@ void WifiSelectionActivity::checkConnectionStatus() {
     return;
   }
 
+  if (directConnecting && (status == WL_CONNECT_FAILED || status == WL_NO_SSID_AVAIL ||
+                           millis() - connectionStartTime > DIRECT_CONNECT_TIMEOUT_MS)) {
+    LOG_DBG("WIFI", "Direct connection failed, scanning");
+    directConnectFailed = true;
+    attemptConnection();
+    return;
+  }
+
   if (status == WL_CONNECT_FAILED || status == WL_NO_SSID_AVAIL) {
     connectionError = tr(STR_ERROR_GENERAL_FAILURE);
     if (status == WL_NO_SSID_AVAIL) {
@@ -329,6 +359,7 @@ void WifiSelectionActivity::loop() {
         // User chose "Yes" - save the password
         RenderLock lock(*this);
         WIFI_STORE.addCredential(selectedSSID, enteredPassword);
+        rememberConnection();
       }
       // Complete - parent will start web server
       onComplete(true);
@@ -76,8 +76,16 @@ class WifiSelectionActivity final : public Activity {
   int savePromptSelection = 0;
   int forgetPromptSelection = 0;
 
+  // Whether the current attempt goes straight to the access point the saved network was last joined on, and whether
+  // that already failed (the next attempt scans)
+  bool directConnecting = false;
+  bool directConnectFailed = false;
+
   // Connection timeout
   static constexpr unsigned long CONNECTION_TIMEOUT_MS = 15000;
+  // A direct connection joins in well under a second, then waits on DHCP like any other; past this the access point or
+  // its channel has changed
+  static constexpr unsigned long DIRECT_CONNECT_TIMEOUT_MS = 8000;
   unsigned long connectionStartTime = 0;
 
   void renderNetworkList() const;
@@ -93,6 +101,7 @@ class WifiSelectionActivity final : public Activity {
   void selectNetwork(int index);
   void attemptConnection();
   void checkConnectionStatus();
+  void rememberConnection() const;
   std::string getSignalStrengthIndicator(int32_t rssi) const;
 
   void onComplete(bool connected);
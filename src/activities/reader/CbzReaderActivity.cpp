@@ -0,0 +1,280 @@
+/**
+ * CbzReaderActivity.cpp
+ *
+ * CBZ comic reader activity implementation
+ * Pages are decoded by the EPUB image decoders, which stream the source in bands at a reduced IDCT scale, so memory
+ * doesn't grow with the scan resolution. Each page leaves a dithered pixel cache behind on its first decode.
+ */
+
+#include "CbzReaderActivity.h"
+
+#include <Epub/blocks/ImageBlock.h>
+#include <Epub/converters/ImageDecoderFactory.h>
+#include <GfxRenderer.h>
+#include <HalStorage.h>
+#include <I18n.h>
+#include <Logging.h>
+
+#include <algorithm>
+
+#include "CacheBudget.h"
+#include "CrossPointSettings.h"
+#include "CrossPointState.h"
+#include "LibraryDatabase.h"
+#include "MappedInputManager.h"
+#include "ReaderUtils.h"
+#include "RecentBooksStore.h"
+#include "fontIds.h"
+
+namespace {
+constexpr unsigned long skipPageMs = 700;
+constexpr unsigned long goHomeMs = 1000;
+}  // namespace
+
+void CbzReaderActivity::onEnter() {
+  Activity::onEnter();
+  // The first page clears what was on screen before
+  renderer.requestFullRefresh();
+
+  if (!cbz) {
+    return;
+  }
+
+  loadProgress();
+
+  // Save current CBZ as last opened book and add to recent books
+  APP_STATE.openEpubPath = cbz->getPath();
+  APP_STATE.saveToFile();
+  RECENT_BOOKS.addBook(cbz->getPath(), cbz->getTitle(), "", "");
+  LIBRARY.putBook(cbz->getPath(), cbz->getTitle(), "", "", "");
+
+  // Trigger first update
+  requestUpdate();
+}
+
+void CbzReaderActivity::onExit() {
+  Activity::onExit();
+
+  if (cbz) {
+    saveProgress(true);
+  }
+  progressJournal.close();
+  APP_STATE.readerActivityLoadCount = 0;
+  APP_STATE.saveToFile();
+  if (cbz) {
+    CacheBudget::onBookClosed(cbz->getCachePath());
+  }
+  cbz.reset();
+}
+
+void CbzReaderActivity::loop() {
+  // Long press BACK (1s+) goes to file selection
+  if (mappedInput.isPressed(MappedInputManager::Button::Back) && mappedInput.getHeldTime() >= goHomeMs) {
+    activityManager.goToFileBrowser(cbz ? cbz->getPath() : "");
+    return;
+  }
+
+  // Short press BACK goes directly to home
+  if (mappedInput.wasReleased(MappedInputManager::Button::Back) && mappedInput.getHeldTime() < goHomeMs) {
+    onGoHome();
+    return;
+  }
+
+  // When long-press chapter skip is disabled, turn pages on press instead of release.
+  const bool usePressForPageTurn = !SETTINGS.longPressChapterSkip;
+  const bool prevTriggered = usePressForPageTurn ? (mappedInput.wasPressed(MappedInputManager::Button::PageBack) ||
+                                                    mappedInput.wasPressed(MappedInputManager::Button::Left))
+                                                 : (mappedInput.wasReleased(MappedInputManager::Button::PageBack) ||
+                                                    mappedInput.wasReleased(MappedInputManager::Button::Left));
+  const bool powerPageTurn = SETTINGS.shortPwrBtn == CrossPointSettings::SHORT_PWRBTN::PAGE_TURN &&
+                             mappedInput.wasReleased(MappedInputManager::Button::Power);
+  const bool nextTriggered = usePressForPageTurn
+                                 ? (mappedInput.wasPressed(MappedInputManager::Button::PageForward) || powerPageTurn ||
+                                    mappedInput.wasPressed(MappedInputManager::Button::Right))
+                                 : (mappedInput.wasReleased(MappedInputManager::Button::PageForward) || powerPageTurn ||
+                                    mappedInput.wasReleased(MappedInputManager::Button::Right));
+
+  if (!prevTriggered && !nextTriggered) {
+    return;
+  }
+
+  // At end of the book, forward button goes home and back button returns to last page
+  if (currentPage >= cbz->getPageCount()) {
+    if (nextTriggered) {
+      onGoHome();
+    } else {
+      currentPage = cbz->getPageCount() - 1;
+      requestUpdate();
+    }
+    return;
+  }
+
+  const bool skipPages = SETTINGS.longPressChapterSkip && mappedInput.getHeldTime() > skipPageMs;
+  const int skipAmount = skipPages ? 10 : 1;
+
+  lastTurnForward = nextTriggered;
+  if (prevTriggered) {
+    if (currentPage >= static_cast<uint32_t>(skipAmount)) {
+      currentPage -= skipAmount;
+    } else {
+      currentPage = 0;
+    }
+    requestUpdate();
+  } else if (nextTriggered) {
+    currentPage += skipAmount;
+    if (currentPage >= cbz->getPageCount()) {
+      currentPage = cbz->getPageCount();  // Allow showing "End of book"
+    }
+    requestUpdate();
+  }
+}
+
+void CbzReaderActivity::render(RenderLock&&) {
+  if (!cbz) {
+    return;
+  }
+
+  // Bounds check
+  if (currentPage >= cbz->getPageCount()) {
+    // Show end of book screen
+    renderer.clearScreen();
+    renderer.drawCenteredText(UI_12_FONT_ID, 300, tr(STR_END_OF_BOOK), true, EpdFontFamily::BOLD);
+    renderer.displayBuffer();
+    return;
+  }
+
+  renderPage();
+  saveProgress();
+}
+
+bool CbzReaderActivity::placePage(const uint32_t pageIndex, PagePlacement& placement) const {
+  if (!cbz->extractPage(pageIndex)) {
+    return false;
+  }
+  placement.imagePath = cbz->getPageImagePath(pageIndex);
+
+  FsFile file;
+  if (!Storage.openFileForRead("CBR", placement.imagePath, file)) {
+    return false;
+  }
+  ImageDimensions dims = {0, 0};
+  const bool measured = ImageDecoderFactory::readDimensions(
+      placement.imagePath, [&file](void* buf, const size_t count) { return file.read(buf, count); }, dims);
+  file.close();
+  if (!measured) {
+    LOG_ERR("CBR", "Can't read the size of page %lu", pageIndex);
+    return false;
+  }
+
+  // Fitted either way: small scans are scaled up to the screen too
+  const int screenWidth = renderer.getScreenWidth();
+  const int screenHeight = renderer.getScreenHeight();
+  if (dims.width * screenHeight <= dims.height * screenWidth) {
+    placement.height = screenHeight;
+    placement.width = std::max(1, dims.width * screenHeight / dims.height);
+  } else {
+    placement.width = screenWidth;
+    placement.height = std::max(1, dims.height * screenWidth / dims.width);
+  }
+  placement.x = (screenWidth - placement.width) / 2;
+  placement.y = (screenHeight - placement.height) / 2;
+  return true;
+}
+
+void CbzReaderActivity::renderPage() {
+  PagePlacement placement;
+  if (!placePage(currentPage, placement)) {
+    LOG_ERR("CBR", "Failed to load page %lu", currentPage);
+    renderer.clearScreen();
+    renderer.drawCenteredText(UI_12_FONT_ID, 300, tr(STR_PAGE_LOAD_ERROR), true, EpdFontFamily::BOLD);
+    renderer.displayBuffer();
+    return;
+  }
+
+  // Decodes the image the first time, later draws it from its pixel cache
+  ImageBlock image(placement.imagePath, "", placement.width, placement.height);
+  renderer.clearScreen();
+  image.render(renderer, placement.x, placement.y);
+  ImageDecoderFactory::releaseScratch();  // The grayscale pass needs the heap for the BW buffer
+  ReaderUtils::displayWithRefreshCycle(renderer);
+
+  // A page turn arrived meanwhile; the next render shows the page the turns end on
+  if (activityManager.isRenderSuperseded()) {
+    LOG_DBG("CBR", "Render superseded, skipping grayscale pass");
+    return;
+  }
+
+  // Scans are mostly gray: the gray levels always go up, drawn from the pixel cache the first pass left
+  if (!renderer.storeBwBuffer()) {
+    LOG_ERR("CBR", "Failed to store BW buffer for grayscale");
+    return;
+  }
+  renderer.clearScreen(0x00);
+  renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
+  image.render(renderer, placement.x, placement.y);
+  renderer.copyGrayscaleLsbBuffers();
+  renderer.clearScreen(0x00);
+  renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+  image.render(renderer, placement.x, placement.y);
+  renderer.copyGrayscaleMsbBuffers();
+  renderer.displayGrayBuffer();
+  renderer.setRenderMode(GfxRenderer::BW);
+
+  // The frame buffer is free until the BW frame is restored
+  prefetchNextPage();
+  renderer.restoreBwBuffer();
+
+  LOG_DBG("CBR", "Rendered page %lu/%lu", currentPage + 1, cbz->getPageCount());
+}
+
+void CbzReaderActivity::prefetchNextPage() {
+  if (lastTurnForward ? currentPage + 1 >= cbz->getPageCount() : currentPage == 0) {
+    return;
+  }
+  if (activityManager.isRenderSuperseded()) {
+    return;
+  }
+  const uint32_t nextPage = lastTurnForward ? currentPage + 1 : currentPage - 1;
+  const auto start = millis();
+  PagePlacement placement;
+  if (!placePage(nextPage, placement)) {
+    return;
+  }
+  ImageBlock image(placement.imagePath, "", placement.width, placement.height);
+  if (image.hasPixelCache()) {
+    return;
+  }
+  renderer.clearScreen();
+  image.render(renderer, placement.x, placement.y);
+  ImageDecoderFactory::releaseScratch();
+  LOG_DBG("CBR", "Decoded page %lu ahead in %lums", nextPage, millis() - start);
+}
+
+void CbzReaderActivity::saveProgress(const bool now) {
+  uint8_t data[4];
+  data[0] = currentPage & 0xFF;
+  data[1] = (currentPage >> 8) & 0xFF;
+  data[2] = (currentPage >> 16) & 0xFF;
+  data[3] = (currentPage >> 24) & 0xFF;
+  // Debounced: only every few page turns reach the SD card
+  if (!progressJournal.record(data, sizeof(data), now)) {
+    return;
+  }
+  const uint32_t pageCount = cbz->getPageCount();
+  if (pageCount > 0) {
+    LIBRARY.setProgress(cbz->getPath(), static_cast<uint16_t>(static_cast<uint64_t>(currentPage) * 1000 / pageCount));
+  }
+}
+
+void CbzReaderActivity::loadProgress() {
+  uint8_t data[4];
+  if (progressJournal.open(cbz->getCachePath(), data, sizeof(data)) == sizeof(data)) {
+    currentPage = data[0] | (data[1] << 8) | (data[2] << 16) | (data[3] << 24);
+    LOG_DBG("CBR", "Loaded progress: page %lu", currentPage);
+
+    // Validate page number
+    if (currentPage >= cbz->getPageCount()) {
+      currentPage = 0;
+    }
+  }
+}
@@ -0,0 +1,47 @@
+/**
+ * CbzReaderActivity.h
+ *
+ * CBZ comic reader activity for CrossPoint Reader
+ * Shows one page image per screen, fitted to the display
+ */
+
+#pragma once
+
+#include <Cbz.h>
+
+#include <memory>
+#include <string>
+
+#include "ProgressJournal.h"
+#include "activities/Activity.h"
+
+class CbzReaderActivity final : public Activity {
+  std::unique_ptr<Cbz> cbz;
+
+  uint32_t currentPage = 0;
+  bool lastTurnForward = true;
+  ProgressJournal progressJournal;
+
+  // A page's image fitted to the screen and centered on it
+  struct PagePlacement {
+    std::string imagePath;
+    int x, y, width, height;
+  };
+  // Extracts the page's image if needed and fits it to the screen; false if it can't be extracted or read
+  bool placePage(uint32_t pageIndex, PagePlacement& placement) const;
+  void renderPage();
+  // Decodes the page the reader is likely to show next while the frame buffer is free, which leaves its pixel cache
+  // behind: the turn to it then only reads the dithered page from the SD card
+  void prefetchNextPage();
+  void saveProgress(bool now = false);
+  void loadProgress();
+
+ public:
+  explicit CbzReaderActivity(GfxRenderer& renderer, MappedInputManager& mappedInput, std::unique_ptr<Cbz> cbz)
+      : Activity("CbzReader", renderer, mappedInput), cbz(std::move(cbz)) {}
+  void onEnter() override;
+  void onExit() override;
+  void loop() override;
+  void render(RenderLock&&) override;
+  bool isReaderActivity() const override { return true; }
+};
@@ -0,0 +1,281 @@
+#include "DictionaryLookupActivity.h"
+
+#include <Epub/ParsedText.h>
+#include <Epub/SearchIndex.h>
+#include <GfxRenderer.h>
+#include <I18n.h>
+
+#include <algorithm>
+
+#include "CrossPointSettings.h"
+#include "MappedInputManager.h"
+#include "components/UITheme.h"
+#include "fontIds.h"
+
+namespace {
+// Words laid out at a time while a long paragraph streams in
+constexpr size_t LAYOUT_BATCH_WORDS = 64;
+
+// Lays out text streamed into it with ParsedText as it arrives, a paragraph per line of text, into pages of lines
+class DefinitionLayout final : public Print {
+  const GfxRenderer& renderer;
+  const int fontId;
+  const uint16_t width;
+  const int pageHeight;
+  const int lineHeight;
+  const size_t maxPages;
+  std::vector<std::vector<DictionaryLookupActivity::DefinitionLine>>& pages;
+  ParsedText text;
+  std::string word;
+  EpdFontFamily::Style style = EpdFontFamily::REGULAR;
+  int y = 0;
+  bool full = false;
+
+  void addLine(std::shared_ptr<TextBlock> line) {
+    if (full) {
+      return;
+    }
+    if (y + lineHeight > pageHeight) {
+      if (pages.size() >= maxPages) {
+        full = true;
+        return;
+      }
+      pages.emplace_back();
+      y = 0;
+    }
+    pages.back().push_back({std::move(line), static_cast<int16_t>(y)});
+    y += lineHeight;
+  }
+
+  void layOut(const bool includeLastLine) {
+    text.layoutAndExtractLines(
+        renderer, fontId, width, [this](std::shared_ptr<TextBlock> line) { addLine(std::move(line)); },
+        includeLastLine);
+  }
+
+  void endWord() {
+    if (word.empty()) {
+      return;
+    }
+    text.addWord(word, style);
+    word.clear();
+    if (text.size() >= LAYOUT_BATCH_WORDS) {
+      layOut(false);
+    }
+  }
+
+  void endParagraph() {
+    endWord();
+    if (!text.isEmpty()) {
+      layOut(true);
+      if (y > 0) {
+        y += lineHeight / 2;
+      }
+    }
+  }
+
+  static BlockStyle leftAligned() {
+    BlockStyle blockStyle;
+    blockStyle.alignment = CssTextAlign::Left;
+    return blockStyle;
+  }
+
+ public:
+  DefinitionLayout(const GfxRenderer& renderer, const int fontId, const uint16_t width, const int pageHeight,
+                   const size_t maxPages, std::vector<std::vector<DictionaryLookupActivity::DefinitionLine>>& pages)
+      : renderer(renderer),
+        fontId(fontId),
+        width(width),
+        pageHeight(pageHeight),
+        lineHeight(renderer.getLineHeight(fontId)),
+        maxPages(maxPages),
+        pages(pages),
+        text(false, false, leftAligned()) {
+    pages.emplace_back();
+  }
+
+  using Print::write;
+  size_t write(const uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* buffer, const size_t size) override {
+    for (size_t i = 0; i < size && !full; i++) {
+      const char c = static_cast<char>(buffer[i]);
+      if (c == '\n') {
+        endParagraph();
+      } else if (c == ' ') {
+        endWord();
+      } else {
+        word += c;
+      }
+    }
+    return size;
+  }
+
+  void addHeading(const std::string& heading) {
+    style = EpdFontFamily::BOLD;
+    write(reinterpret_cast<const uint8_t*>(heading.c_str()), heading.size());
+    endParagraph();
+    style = EpdFontFamily::REGULAR;
+  }
+
+  void finish() { endParagraph(); }
+};
+}  // namespace
+
+void DictionaryLookupActivity::onEnter() {
+  Activity::onEnter();
+  page->forEachPlacedWord([this](const char* text, const int x, const int y, const EpdFontFamily::Style style) {
+    const auto terms = SearchIndex::terms(text);
+    if (terms.size() == 1) {
+      words.push_back({text, terms.front(), static_cast<int16_t>(x), static_cast<int16_t>(y),
+                       static_cast<uint16_t>(renderer.getTextWidth(fontId, text, style)), style});
+    }
+  });
+  {
+    RenderLock lock(*this);
+    dictionary.open([this]() { GUI.drawPopup(renderer, tr(STR_INDEXING)); });
+  }
+  requestUpdate();
+}
+
+void DictionaryLookupActivity::onExit() {
+  Activity::onExit();
+  definitionPages.clear();
+  words.clear();
+}
+
+void DictionaryLookupActivity::lookUpSelectedWord() {
+  std::vector<std::vector<DefinitionLine>> pages;
+  const int pageHeight = viewportHeight - renderer.getLineHeight(fontId);
+  DefinitionLayout layout(renderer, fontId, viewportWidth, pageHeight, MAX_DEFINITION_PAGES, pages);
+  std::vector<DictionaryEntry> entries;
+  if (!dictionary.isOpen()) {
+    layout.addHeading(tr(STR_NO_DICTIONARY));
+  } else if (!dictionary.find(words[selectedWord].key, entries)) {
+    layout.addHeading(words[selectedWord].key);
+    layout.write(tr(STR_NO_DEFINITION));
+  }
+  for (size_t i = 0; i < entries.size() && i < MAX_ENTRIES; i++) {
+    layout.addHeading(entries[i].word);
+    dictionary.readDefinition(entries[i], layout);
+  }
+  layout.finish();
+
+  RenderLock lock(*this);
+  definitionPages = std::move(pages);
+  definitionPage = 0;
+  showingDefinition = true;
+}
+
+int DictionaryLookupActivity::lineStart(int wordIndex) const {
+  while (wordIndex > 0 && words[wordIndex - 1].y == words[wordIndex].y) {
+    wordIndex--;
+  }
+  return wordIndex;
+}
+
+void DictionaryLookupActivity::loop() {
+  if (showingDefinition) {
+    if (mappedInput.wasReleased(MappedInputManager::Button::Back) ||
+        mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
+      RenderLock lock(*this);
+      showingDefinition = false;
+      definitionPages.clear();
+      requestUpdate();
+      return;
+    }
+    const int pageCount = static_cast<int>(definitionPages.size());
+    buttonNavigator.onNextRelease([this, pageCount] {
+      if (definitionPage + 1 < pageCount) {
+        definitionPage++;
+        requestUpdate();
+      }
+    });
+    buttonNavigator.onPreviousRelease([this] {
+      if (definitionPage > 0) {
+        definitionPage--;
+        requestUpdate();
+      }
+    });
+    return;
+  }
+
+  if (mappedInput.wasReleased(MappedInputManager::Button::Back)) {
+    ActivityResult result;
+    result.isCancelled = true;
+    setResult(std::move(result));
+    finish();
+    return;
+  }
+  const int totalWords = static_cast<int>(words.size());
+  if (totalWords == 0) {
+    return;
+  }
+  if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
+    lookUpSelectedWord();
+    requestUpdate();
+    return;
+  }
+
+  buttonNavigator.onNextRelease([this, totalWords] {
+    selectedWord = ButtonNavigator::nextIndex(selectedWord, totalWords);
+    requestUpdate();
+  });
+
+  buttonNavigator.onPreviousRelease([this, totalWords] {
+    selectedWord = ButtonNavigator::previousIndex(selectedWord, totalWords);
+    requestUpdate();
+  });
+
+  // Held buttons move to the first word of the next or previous line
+  buttonNavigator.onNextContinuous([this, totalWords] {
+    int next = selectedWord;
+    while (next < totalWords && words[next].y == words[selectedWord].y) {
+      next++;
+    }
+    selectedWord = next < totalWords ? next : 0;
+    requestUpdate();
+  });
+
+  buttonNavigator.onPreviousContinuous([this, totalWords] {
+    const int start = lineStart(selectedWord);
+    selectedWord = start > 0 ? lineStart(start - 1) : lineStart(totalWords - 1);
+    requestUpdate();
+  });
+}
+
+void DictionaryLookupActivity::render(RenderLock&&) {
+  renderer.clearScreen();
+  if (showingDefinition) {
+    renderDefinition();
+  } else {
+    renderPage();
+  }
+  renderer.displayChanges();
+}
+
+void DictionaryLookupActivity::renderPage() {
+  page->render(renderer, fontId, marginLeft, marginTop);
+  if (!words.empty()) {
+    const auto& word = words[selectedWord];
+    const int lineHeight = static_cast<int>(renderer.getLineHeight(fontId) * SETTINGS.getReaderLineCompression());
+    renderer.fillRect(marginLeft + word.x - 2, marginTop + word.y, word.width + 4, lineHeight);
+    renderer.drawText(fontId, marginLeft + word.x, marginTop + word.y, word.text.c_str(), false, word.style);
+  }
+
+  const auto labels = mappedInput.mapLabels(tr(STR_BACK), tr(STR_LOOKUP_WORD), tr(STR_DIR_LEFT), tr(STR_DIR_RIGHT));
+  GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
+}
+
+void DictionaryLookupActivity::renderDefinition() {
+  for (const auto& line : definitionPages[definitionPage]) {
+    line.block->render(renderer, fontId, marginLeft, marginTop + line.y);
+  }
+  if (definitionPages.size() > 1) {
+    const std::string position = std::to_string(definitionPage + 1) + "/" + std::to_string(definitionPages.size());
+    renderer.drawCenteredText(SMALL_FONT_ID, marginTop + viewportHeight - renderer.getLineHeight(SMALL_FONT_ID),
+                              position.c_str());
+  }
+
+  const auto labels = mappedInput.mapLabels(tr(STR_BACK), "", tr(STR_DIR_UP), tr(STR_DIR_DOWN));
+  GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <Dictionary.h>
+#include <Epub/Page.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../Activity.h"
+#include "util/ButtonNavigator.h"
+
+/**
+ * Looks up a word of the page being read in the dictionary (see Dictionary). The page is shown as the reader lays it
+ * out with one word highlighted; the buttons move the highlight word by word, or line by line when held, and Confirm
+ * shows the definitions of the word, laid out in pages with the reader's font.
+ */
+class DictionaryLookupActivity final : public Activity {
+ public:
+  // A line of a definition page, y from the top of the page
+  struct DefinitionLine {
+    std::shared_ptr<TextBlock> block;
+    int16_t y;
+  };
+
+ private:
+  struct PlacedWord {
+    std::string text;
+    // The word as looked up: without the punctuation around it, lowercased
+    std::string key;
+    int16_t x;
+    int16_t y;
+    uint16_t width;
+    EpdFontFamily::Style style;
+  };
+
+  std::shared_ptr<Page> page;
+  int fontId;
+  int marginLeft;
+  int marginTop;
+  uint16_t viewportWidth;
+  uint16_t viewportHeight;
+  std::vector<PlacedWord> words;
+  int selectedWord = 0;
+  Dictionary dictionary;
+  bool showingDefinition = false;
+  std::vector<std::vector<DefinitionLine>> definitionPages;
+  int definitionPage = 0;
+  ButtonNavigator buttonNavigator;
+
+  static constexpr size_t MAX_ENTRIES = 3;
+  static constexpr size_t MAX_DEFINITION_PAGES = 20;
+
+  void lookUpSelectedWord();
+  int lineStart(int wordIndex) const;
+  void renderPage();
+  void renderDefinition();
+
+ public:
+  explicit DictionaryLookupActivity(GfxRenderer& renderer, MappedInputManager& mappedInput, std::shared_ptr<Page> page,
+                                    const int fontId, const int marginLeft, const int marginTop,
+                                    const uint16_t viewportWidth, const uint16_t viewportHeight)
+      : Activity("DictionaryLookup", renderer, mappedInput),
+        page(std::move(page)),
+        fontId(fontId),
+        marginLeft(marginLeft),
+        marginTop(marginTop),
+        viewportWidth(viewportWidth),
+        viewportHeight(viewportHeight) {}
+  void onEnter() override;
+  void onExit() override;
+  void loop() override;
+  void render(RenderLock&&) override;
+  bool isReaderActivity() const override { return true; }
+};
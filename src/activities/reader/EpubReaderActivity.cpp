@@ -1,5 +1,6 @@
 #include "EpubReaderActivity.h"
 
+#include <Epub/LinkTargetIndex.h>
 #include <Epub/Page.h>
 #include <Epub/blocks/TextBlock.h>
 #include <FontCacheManager.h>
@@ -8,26 +9,47 @@
 #include <HalStorage.h>
 #include <I18n.h>
 #include <Logging.h>
+#include <esp_heap_caps.h>
 #include <esp_system.h>
 
+#include <algorithm>
+#include <optional>
+
+#include "CacheBudget.h"
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
+#include "DictionaryLookupActivity.h"
 #include "EpubReaderChapterSelectionActivity.h"
 #include "EpubReaderFootnotesActivity.h"
 #include "EpubReaderPercentSelectionActivity.h"
+#include "EpubReaderSearchActivity.h"
 #include "KOReaderCredentialStore.h"
+#include "KOReaderDocumentId.h"
 #include "KOReaderSyncActivity.h"
+#include "KOReaderSyncJournal.h"
+#include "LibraryDatabase.h"
 #include "MappedInputManager.h"
+#include "PerfHistory.h"
 #include "QrDisplayActivity.h"
 #include "ReaderUtils.h"
 #include "RecentBooksStore.h"
+#include "ResumeSnapshot.h"
+#include "SdReaderFont.h"
+#include "activities/JobSlice.h"
+#include "activities/util/KeyboardEntryActivity.h"
 #include "components/UITheme.h"
 #include "fontIds.h"
+#include "util/PerfProfiler.h"
+#include "util/ResourceMonitor.h"
 #include "util/ScreenshotUtil.h"
 
 namespace {
 // pagesPerRefresh now comes from SETTINGS.getRefreshFrequency()
 constexpr unsigned long skipChapterMs = 700;
+// Heap left free for the section indexer and the rest of the render while a page is rendered ahead
+constexpr size_t PRERENDER_HEAP_RESERVE = 32 * 1024;
+// With text anti-aliasing when idle, how long a page stays black and white before its grayscale pass
+constexpr unsigned long GRAY_PASS_IDLE_MS = 700;
 // pages per minute, first item is 1 to prevent division by zero if accessed
 const std::vector<int> PAGE_TURN_LABELS = {1, 1, 3, 6, 12};
 
@@ -45,6 +67,7 @@ int clampPercent(int percent) {
 
 void EpubReaderActivity::onEnter() {
   Activity::onEnter();
+  SD_READER_FONT.sync(renderer);
 
   if (!epub) {
     return;
@@ -54,12 +77,17 @@ void EpubReaderActivity::onEnter() {
   // NOTE: This affects layout math and must be applied before any render calls.
   ReaderUtils::applyOrientation(renderer, SETTINGS.orientation);
 
+  // Woken into the reader with the page already restored on screen, the first frame only adds the status bar;
+  // otherwise the first page clears what was on screen before
+  if (!ResumeSnapshot::takePageShown()) {
+    renderer.requestFullRefresh();
+  }
+
   epub->setupCacheDir();
 
-  FsFile f;
-  if (Storage.openFileForRead("ERS", epub->getCachePath() + "/progress.bin", f)) {
+  {
     uint8_t data[6];
-    int dataSize = f.read(data, 6);
+    const size_t dataSize = progressJournal.open(epub->getCachePath(), data, sizeof(data));
     if (dataSize == 4 || dataSize == 6) {
       currentSpineIndex = data[0] + (data[1] << 8);
       nextPageNumber = data[2] + (data[3] << 8);
@@ -84,6 +112,10 @@ void EpubReaderActivity::onEnter() {
   APP_STATE.openEpubPath = epub->getPath();
   APP_STATE.saveToFile();
   RECENT_BOOKS.addBook(epub->getPath(), epub->getTitle(), epub->getAuthor(), epub->getThumbBmpPath());
+  LIBRARY.putBook(epub->getPath(), epub->getTitle(), epub->getAuthor(), epub->getLanguage(), epub->getThumbBmpPath());
+
+  // Started from render() once the viewport is known
+  indexer = std::make_unique<EpubSectionIndexer>(epub, renderer);
 
   // Trigger first update
   requestUpdate();
@@ -92,13 +124,33 @@ void EpubReaderActivity::onEnter() {
 void EpubReaderActivity::onExit() {
   Activity::onExit();
 
+  saveResumeSnapshot();
+
   // Reset orientation back to portrait for the rest of the UI
   renderer.setOrientation(GfxRenderer::Orientation::Portrait);
 
   APP_STATE.readerActivityLoadCount = 0;
   APP_STATE.saveToFile();
+  if (indexer) {
+    indexer->stop();
+    indexer.reset();
+  }
+  if (section && provisionalPage) {
+    // In thousandths of the chapter, repositioned like after a layout change when the book is opened again
+    saveProgress(currentSpineIndex, static_cast<int>(pendingSpineProgress * 1000), 1000, true);
+  } else if (section) {
+    saveProgress(currentSpineIndex, section->currentPage, section->isPartial() ? 0 : section->pageCount, true);
+  }
+  progressJournal.close();
+  recordSyncPosition();
   section.reset();
+  pageCache.clear();
+  pageShadow.clear();
+  if (epub) {
+    CacheBudget::onBookClosed(epub->getCachePath());
+  }
   epub.reset();
+  SD_READER_FONT.release(renderer);
 }
 
 void EpubReaderActivity::loop() {
@@ -108,6 +160,21 @@ void EpubReaderActivity::loop() {
     return;
   }
 
+  // Keep background indexing out of the way while the user is interacting (or auto page turn is running)
+  if (indexer && (automaticPageTurnActive || mappedInput.wasAnyPressed() || mappedInput.wasAnyReleased())) {
+    indexer->notifyInteraction();
+  }
+
+  if (mappedInput.wasAnyPressed() || mappedInput.wasAnyReleased()) {
+    lastInputMs = millis();
+  }
+  // Skimming pages stays black and white; the page the reader settles on gets its grayscale pass
+  if (deferredGrayPage >= 0 && !grayPassDue && millis() - deferredGrayAt >= GRAY_PASS_IDLE_MS &&
+      millis() - lastInputMs >= GRAY_PASS_IDLE_MS) {
+    grayPassDue = true;
+    requestUpdate();
+  }
+
   if (automaticPageTurnActive) {
     if (mappedInput.wasReleased(MappedInputManager::Button::Confirm) ||
         mappedInput.wasReleased(MappedInputManager::Button::Back)) {
@@ -148,6 +215,11 @@ void EpubReaderActivity::loop() {
                                renderer, mappedInput, epub->getTitle(), currentPage, totalPages, bookProgressPercent,
                                SETTINGS.orientation, !currentPageFootnotes.empty()),
                            [this](const ActivityResult& result) {
+                             // Settings changed in the menu can show on the page rendered ahead
+                             {
+                               RenderLock lock(*this);
+                               pageShadow.clear();
+                             }
                              // Always apply orientation change even if the menu was cancelled
                              const auto& menu = std::get<MenuResult>(result.data);
                              applyOrientation(menu.orientation);
@@ -305,6 +377,38 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
           });
       break;
     }
+    case EpubReaderMenuActivity::MenuAction::SEARCH: {
+      startActivityForResult(
+          std::make_unique<KeyboardEntryActivity>(renderer, mappedInput, tr(STR_SEARCH_BOOK), lastSearchQuery, 64),
+          [this](const ActivityResult& result) {
+            if (!result.isCancelled) {
+              lastSearchQuery = std::get<KeyboardResult>(result.data).text;
+              startSearch();
+            }
+          });
+      break;
+    }
+    case EpubReaderMenuActivity::MenuAction::LOOKUP_WORD: {
+      if (section && section->currentPage >= 0 && section->currentPage < section->pageCount) {
+        std::shared_ptr<Page> p;
+        {
+          RenderLock lock(*this);  // Shares the section file handle and page cache with the render task
+          p = section->loadPageFromSectionFile();
+        }
+        if (p) {
+          const auto margins = ReaderUtils::getEpubMargins(renderer, automaticPageTurnActive);
+          const uint16_t viewportWidth = renderer.getScreenWidth() - margins.left - margins.right;
+          const uint16_t viewportHeight = renderer.getScreenHeight() - margins.top - margins.bottom;
+          startActivityForResult(std::make_unique<DictionaryLookupActivity>(renderer, mappedInput, std::move(p),
+                                                                            SETTINGS.getReaderFontId(), margins.left,
+                                                                            margins.top, viewportWidth, viewportHeight),
+                                 [this](const ActivityResult&) { requestUpdate(); });
+          break;
+        }
+      }
+      requestUpdate();
+      break;
+    }
     case EpubReaderMenuActivity::MenuAction::FOOTNOTES: {
       startActivityForResult(std::make_unique<EpubReaderFootnotesActivity>(renderer, mappedInput, currentPageFootnotes),
                              [this](const ActivityResult& result) {
@@ -318,7 +422,9 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
     }
     case EpubReaderMenuActivity::MenuAction::GO_TO_PERCENT: {
       float bookProgress = 0.0f;
-      if (epub && epub->getBookSize() > 0 && section && section->pageCount > 0) {
+      if (epub && epub->getBookSize() > 0 && provisionalPage) {
+        bookProgress = epub->calculateProgress(currentSpineIndex, pendingSpineProgress) * 100.0f;
+      } else if (epub && epub->getBookSize() > 0 && section && section->pageCount > 0) {
         const float chapterProgress = static_cast<float>(section->currentPage) / static_cast<float>(section->pageCount);
         bookProgress = epub->calculateProgress(currentSpineIndex, chapterProgress) * 100.0f;
       }
@@ -334,21 +440,17 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
     }
     case EpubReaderMenuActivity::MenuAction::DISPLAY_QR: {
       if (section && section->currentPage >= 0 && section->currentPage < section->pageCount) {
-        auto p = section->loadPageFromSectionFile();
+        std::shared_ptr<Page> p;
+        {
+          RenderLock lock(*this);  // Shares the section file handle and page cache with the render task
+          p = section->loadPageFromSectionFile();
+        }
         if (p) {
           std::string fullText;
-          for (const auto& el : p->elements) {
-            if (el->getTag() == TAG_PageLine) {
-              const auto& line = static_cast<const PageLine&>(*el);
-              if (line.getBlock()) {
-                const auto& words = line.getBlock()->getWords();
-                for (const auto& w : words) {
-                  if (!fullText.empty()) fullText += " ";
-                  fullText += w;
-                }
-              }
-            }
-          }
+          p->forEachWord([&fullText](const char* w) {
+            if (!fullText.empty()) fullText += " ";
+            fullText += w;
+          });
           if (!fullText.empty()) {
             startActivityForResult(std::make_unique<QrDisplayActivity>(renderer, mappedInput, fullText),
                                    [this](const ActivityResult& result) {});
@@ -374,7 +476,7 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
           section.reset();
           epub->clearCache();
           epub->setupCacheDir();
-          saveProgress(backupSpine, backupPage, backupPageCount);
+          saveProgress(backupSpine, backupPage, backupPageCount, true);
         }
       }
       onGoHome();
@@ -394,14 +496,20 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
         const int totalPages = section ? section->pageCount : 0;
         startActivityForResult(
             std::make_unique<KOReaderSyncActivity>(renderer, mappedInput, epub, epub->getPath(), currentSpineIndex,
-                                                   currentPage, totalPages),
+                                                   currentPage, totalPages, currentSourceOffset()),
             [this](const ActivityResult& result) {
               if (!result.isCancelled) {
                 const auto& sync = std::get<SyncResult>(result.data);
-                if (currentSpineIndex != sync.spineIndex || (section && section->currentPage != sync.page)) {
+                const bool sameSpine = currentSpineIndex == sync.spineIndex;
+                int page = sync.page;
+                if (sameSpine && section && sync.sourceOffset >= 0) {
+                  page = section->getPageForSourceOffset(sync.sourceOffset).value_or(page);
+                }
+                if (!sameSpine || (section && section->currentPage != page)) {
                   RenderLock lock(*this);
                   currentSpineIndex = sync.spineIndex;
-                  nextPageNumber = sync.page;
+                  nextPageNumber = page;
+                  pendingSourceOffset = sameSpine ? -1 : sync.sourceOffset;
                   section.reset();
                 }
               }
@@ -412,20 +520,35 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
   }
 }
 
+void EpubReaderActivity::startSearch() {
+  // Matches on laid out pages are looked up in the section files of the layout the reader shows
+  const auto margins = ReaderUtils::getEpubMargins(renderer, automaticPageTurnActive);
+  const uint16_t viewportWidth = renderer.getScreenWidth() - margins.left - margins.right;
+  const uint16_t viewportHeight = renderer.getScreenHeight() - margins.top - margins.bottom;
+  startActivityForResult(std::make_unique<EpubReaderSearchActivity>(renderer, mappedInput, epub, lastSearchQuery,
+                                                                    viewportWidth, viewportHeight),
+                         [this](const ActivityResult& result) {
+                           if (result.isCancelled) {
+                             return;
+                           }
+                           const auto& match = std::get<SearchResult>(result.data);
+                           RenderLock lock(*this);
+                           currentSpineIndex = match.spineIndex;
+                           nextPageNumber = std::max(0, match.page);
+                           pendingSourceOffset = match.page >= 0 ? -1 : match.sourceOffset;
+                           section.reset();
+                         });
+}
+
 void EpubReaderActivity::applyOrientation(const uint8_t orientation) {
   // No-op if the selected orientation matches current settings.
   if (SETTINGS.orientation == orientation) {
     return;
   }
 
-  // Preserve current reading position so we can restore after reflow.
   {
     RenderLock lock(*this);
-    if (section) {
-      cachedSpineIndex = currentSpineIndex;
-      cachedChapterTotalPageCount = section->pageCount;
-      nextPageNumber = section->currentPage;
-    }
+    const auto oldMargins = ReaderUtils::getEpubMargins(renderer, automaticPageTurnActive);
 
     // Persist the selection so the reader keeps the new orientation on next launch.
     SETTINGS.orientation = orientation;
@@ -434,6 +557,24 @@ void EpubReaderActivity::applyOrientation(const uint8_t orientation) {
     // Update renderer orientation to match the new logical coordinate system.
     ReaderUtils::applyOrientation(renderer, SETTINGS.orientation);
 
+    // Turned 180 degrees the viewport is the same, so the laid out pages are too: only where they are drawn changes
+    const auto margins = ReaderUtils::getEpubMargins(renderer, automaticPageTurnActive);
+    if (margins.left + margins.right == oldMargins.left + oldMargins.right &&
+        margins.top + margins.bottom == oldMargins.top + oldMargins.bottom) {
+      pageShadow.clear();
+      return;
+    }
+
+    // Preserve current reading position so we can restore after reflow.
+    if (provisionalPage) {
+      // Jumps again, to a provisional page in the new layout
+      pendingPercentJump = true;
+    } else if (section) {
+      cachedSpineIndex = currentSpineIndex;
+      cachedChapterTotalPageCount = section->isPartial() ? 0 : section->pageCount;
+      nextPageNumber = section->currentPage;
+    }
+
     // Reset section to force re-layout in the new orientation.
     section.reset();
   }
@@ -455,9 +596,11 @@ void EpubReaderActivity::toggleAutoPageTurn(const uint8_t selectedPageTurnOption
   if (statusBarHeight == 0 || statusBarHeight == UITheme::getInstance().getProgressBarHeight()) {
     // Preserve current reading position so we can restore after reflow.
     RenderLock lock(*this);
-    if (section) {
+    if (provisionalPage) {
+      pendingPercentJump = true;
+    } else if (section) {
       cachedSpineIndex = currentSpineIndex;
-      cachedChapterTotalPageCount = section->pageCount;
+      cachedChapterTotalPageCount = section->isPartial() ? 0 : section->pageCount;
       nextPageNumber = section->currentPage;
     }
     section.reset();
@@ -465,8 +608,16 @@ void EpubReaderActivity::toggleAutoPageTurn(const uint8_t selectedPageTurnOption
 }
 
 void EpubReaderActivity::pageTurn(bool isForwardTurn) {
-  if (isForwardTurn) {
-    if (section->currentPage < section->pageCount - 1) {
+  if (provisionalPage) {
+    // The turn is made from the page of the chapter's layout that starts where the provisional page does
+    RenderLock lock(*this);
+    pendingSourceOffset = static_cast<int32_t>(provisionalSourceOffset);
+    provisionalTurn = isForwardTurn ? 1 : -1;
+    nextPageNumber = 0;
+    section.reset();
+  } else if (isForwardTurn) {
+    // A partial section grows on demand in render(), so its provisional last page isn't the end of the chapter
+    if (section->currentPage < section->pageCount - 1 || section->isPartial()) {
       section->currentPage++;
     } else {
       // We don't want to delete the section mid-render, so grab the semaphore
@@ -500,6 +651,14 @@ void EpubReaderActivity::render(RenderLock&& lock) {
     return;
   }
 
+  if (grayPassDue) {
+    grayPassDue = false;
+    if (renderDeferredGrayscale()) {
+      return;
+    }
+  }
+  deferredGrayPage = -1;
+
   // edge case handling for sub-zero spine index
   if (currentSpineIndex < 0) {
     currentSpineIndex = 0;
@@ -518,53 +677,70 @@ void EpubReaderActivity::render(RenderLock&& lock) {
     return;
   }
 
-  // Apply screen viewable areas and additional padding
-  int orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft;
-  renderer.getOrientedViewableTRBL(&orientedMarginTop, &orientedMarginRight, &orientedMarginBottom,
-                                   &orientedMarginLeft);
-  orientedMarginTop += SETTINGS.screenMargin;
-  orientedMarginLeft += SETTINGS.screenMargin;
-  orientedMarginRight += SETTINGS.screenMargin;
-
-  const uint8_t statusBarHeight = UITheme::getInstance().getStatusBarHeight();
+  PerfProfiler::beginFrame();
 
-  // reserves space for automatic page turn indicator when no status bar or progress bar only
-  if (automaticPageTurnActive &&
-      (statusBarHeight == 0 || statusBarHeight == UITheme::getInstance().getProgressBarHeight())) {
-    orientedMarginBottom +=
-        std::max(SETTINGS.screenMargin,
-                 static_cast<uint8_t>(statusBarHeight + UITheme::getInstance().getMetrics().statusBarVerticalMargin));
-  } else {
-    orientedMarginBottom += std::max(SETTINGS.screenMargin, statusBarHeight);
-  }
+  // Apply screen viewable areas and additional padding
+  const auto margins = ReaderUtils::getEpubMargins(renderer, automaticPageTurnActive);
+  const int orientedMarginTop = margins.top;
+  const int orientedMarginRight = margins.right;
+  const int orientedMarginBottom = margins.bottom;
+  const int orientedMarginLeft = margins.left;
 
   const uint16_t viewportWidth = renderer.getScreenWidth() - orientedMarginLeft - orientedMarginRight;
   const uint16_t viewportHeight = renderer.getScreenHeight() - orientedMarginTop - orientedMarginBottom;
 
+  if (section && section->isPartial()) {
+    // Pick up the pages (or the finished chapter) the indexer has laid out since the last render
+    PerfProfiler::Scope sectionTimer(PerfProfiler::SECTION_LOAD);
+    section->loadSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                             SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth, viewportHeight,
+                             SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle, SETTINGS.imageRendering);
+  }
+
   if (!section) {
+    provisionalPage.reset();
     const auto filepath = epub->getSpineItem(currentSpineIndex).href;
     LOG_DBG("ERS", "Loading file: %s, index: %d", filepath.c_str(), currentSpineIndex);
-    section = std::unique_ptr<Section>(new Section(epub, currentSpineIndex, renderer));
+    section = std::unique_ptr<Section>(new Section(epub, currentSpineIndex, renderer, &pageCache));
+    PerfProfiler::Scope sectionTimer(PerfProfiler::SECTION_LOAD);
 
     if (!section->loadSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
                                   SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
                                   viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle,
                                   SETTINGS.imageRendering)) {
-      LOG_DBG("ERS", "Cache not found, building...");
-
-      const auto popupFn = [this]() { GUI.drawPopup(renderer, tr(STR_INDEXING)); };
-
-      if (!section->createSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
-                                      SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
-                                      viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle,
-                                      SETTINGS.imageRendering, popupFn)) {
-        LOG_ERR("ERS", "Failed to persist page data to SD");
-        section.reset();
-        return;
+      // A link target is found in the chapter's markup, then only the pages up to it have to be laid out
+      std::optional<uint32_t> targetOffset;
+      if (!pendingAnchor.empty() && indexer) {
+        targetOffset = LinkTargetIndex::findOffset(epub, currentSpineIndex, pendingAnchor);
+      }
+      if (pendingPercentJump && indexer && layOutProvisionalPage(viewportWidth, viewportHeight)) {
+        pendingPercentJump = false;
+      } else if (pendingSourceOffset >= 0 && indexer) {
+        targetOffset = static_cast<uint32_t>(pendingSourceOffset);
+      }
+      // Only the page about to be shown has to be laid out, unless positioning depends on the final page count
+      const bool needsPageCount = nextPageNumber == UINT16_MAX || (!pendingAnchor.empty() && !targetOffset) ||
+                                  pendingPercentJump || (pendingSourceOffset >= 0 && !targetOffset) ||
+                                  (cachedChapterTotalPageCount > 0 && currentSpineIndex == cachedSpineIndex);
+      const int targetPage = needsPageCount ? -1 : nextPageNumber;
+
+      if (provisionalPage) {
+        LOG_DBG("ERS", "Showing a provisional page, indexer lays out the chapter");
+      } else if (section->isPartial() && targetPage >= 0 && section->pageCount > targetPage &&
+                 (!targetOffset || section->getLaidOutSourceOffset() > *targetOffset)) {
+        LOG_DBG("ERS", "Partial cache has page %d, skipping build", targetPage);
+      } else {
+        LOG_DBG("ERS", "Cache not found, building...");
+        if (!buildSection(viewportWidth, viewportHeight, targetPage, targetOffset)) {
+          LOG_ERR("ERS", "Failed to persist page data to SD");
+          section.reset();
+          return;
+        }
       }
     } else {
       LOG_DBG("ERS", "Cache found, skipping build...");
     }
+    sectionTimer.end();
 
     if (nextPageNumber == UINT16_MAX) {
       section->currentPage = section->pageCount - 1;
@@ -602,14 +778,57 @@ void EpubReaderActivity::render(RenderLock&& lock) {
       section->currentPage = newPage;
       pendingPercentJump = false;
     }
+
+    if (pendingSourceOffset >= 0) {
+      if (const auto page = section->getPageForSourceOffset(pendingSourceOffset)) {
+        // Past the last page of a partial section, the pages up to it are laid out below
+        const int turned = std::max(0, *page + provisionalTurn);
+        section->currentPage = section->isPartial() ? turned : std::min(turned, section->pageCount - 1);
+        LOG_DBG("ERS", "Resolved source offset %d to page %d", pendingSourceOffset, *page);
+      }
+      pendingSourceOffset = -1;
+      provisionalTurn = 0;
+    }
+  }
+
+  if (provisionalPage) {
+    refreshBookPages();
+    renderer.clearScreen();
+    pageShadow.clear();
+    currentPageFootnotes = provisionalPage->footnotes;
+    renderContents(*provisionalPage, 0, orientedMarginTop, orientedMarginRight, orientedMarginBottom,
+                   orientedMarginLeft);
+    // The chapter on screen is laid out first
+    indexer->setLayout(viewportWidth, viewportHeight, currentSpineIndex, true);
+    saveProgress(currentSpineIndex, static_cast<int>(pendingSpineProgress * 1000), 1000);
+    return;
   }
 
+  if (section->isPartial() && section->currentPage >= section->pageCount) {
+    // Paged past what has been laid out so far
+    PerfProfiler::Scope sectionTimer(PerfProfiler::SECTION_LOAD);
+    if (!buildSection(viewportWidth, viewportHeight, section->currentPage)) {
+      LOG_ERR("ERS", "Failed to persist page data to SD");
+      section.reset();
+      return;
+    }
+    if (!section->isPartial() && section->currentPage >= section->pageCount) {
+      // The chapter ended exactly at the last page that was already shown, move on like pageTurn() would have
+      nextPageNumber = 0;
+      currentSpineIndex++;
+      section.reset();
+      requestUpdate();
+      return;
+    }
+  }
+
+  refreshBookPages();
   renderer.clearScreen();
 
   if (section->pageCount == 0) {
     LOG_DBG("ERS", "No pages to render");
     renderer.drawCenteredText(UI_12_FONT_ID, 300, tr(STR_EMPTY_CHAPTER), true, EpdFontFamily::BOLD);
-    renderStatusBar();
+    renderStatusBar(section->currentPage);
     renderer.displayBuffer();
     automaticPageTurnActive = false;
     return;
@@ -618,14 +837,23 @@ void EpubReaderActivity::render(RenderLock&& lock) {
   if (section->currentPage < 0 || section->currentPage >= section->pageCount) {
     LOG_DBG("ERS", "Page out of bounds: %d (max %d)", section->currentPage, section->pageCount);
     renderer.drawCenteredText(UI_12_FONT_ID, 300, tr(STR_OUT_OF_BOUNDS), true, EpdFontFamily::BOLD);
-    renderStatusBar();
+    renderStatusBar(section->currentPage);
     renderer.displayBuffer();
     automaticPageTurnActive = false;
     return;
   }
 
+  // More page turns came in while the section was loading; the page is drawn once they settle
+  if (activityManager.isRenderSuperseded()) {
+    renderPageTurnOverlay();
+    return;
+  }
+
   {
-    auto p = section->loadPageFromSectionFile();
+    PerfProfiler::Scope pageTimer(PerfProfiler::PAGE_LOAD);
+    const int pageIndex = section->currentPage;
+    auto p = section->loadPage(pageIndex);
+    pageTimer.end();
     if (!p) {
       LOG_ERR("ERS", "Failed to load page from SD - clearing section cache");
       section->clearCache();
@@ -637,14 +865,19 @@ void EpubReaderActivity::render(RenderLock&& lock) {
     }
 
     // Collect footnotes from the loaded page
-    currentPageFootnotes = std::move(p->footnotes);
+    currentPageFootnotes = p->footnotes;
 
     const auto start = millis();
-    renderContents(std::move(p), orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
+    renderContents(*p, pageIndex, orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
     LOG_DBG("ERS", "Rendered page in %dms", millis() - start);
+    PerfProfiler::logFrame(PerfProfiler::currentFrame());
   }
   silentIndexNextChapterIfNeeded(viewportWidth, viewportHeight);
-  saveProgress(currentSpineIndex, section->currentPage, section->pageCount);
+  if (indexer) {
+    indexer->setLayout(viewportWidth, viewportHeight, currentSpineIndex, section->isPartial());
+  }
+  // A partial page count isn't final, so don't let it drive the relative repositioning on the next open
+  saveProgress(currentSpineIndex, section->currentPage, section->isPartial() ? 0 : section->pageCount);
 
   if (pendingScreenshot) {
     pendingScreenshot = false;
@@ -652,8 +885,66 @@ void EpubReaderActivity::render(RenderLock&& lock) {
   }
 }
 
+bool EpubReaderActivity::buildSection(const uint16_t viewportWidth, const uint16_t viewportHeight,
+                                      const int targetPage, const std::optional<uint32_t> targetSourceOffset) {
+  const auto popupFn = [this]() { GUI.drawPopup(renderer, tr(STR_INDEXING)); };
+  // Leaving the reader stops the build at the next checkpoint; it continues when the chapter is opened again
+  JobSlice slice;
+  const bool stopAtTarget = targetPage >= 0 && indexer;
+  const auto stopFn = [this, &slice, stopAtTarget, targetPage, targetSourceOffset]() {
+    if (!slice.yieldIfNeeded()) {
+      return true;
+    }
+    return stopAtTarget && section->pageCount > targetPage &&
+           (!targetSourceOffset || section->getLaidOutSourceOffset() > *targetSourceOffset);
+  };
+
+  if (section->createSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                                 SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
+                                 viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle,
+                                 SETTINGS.imageRendering, popupFn, stopFn)) {
+    return true;
+  }
+  if (slice.stopped()) {
+    LOG_DBG("ERS", "Leaving the reader, chapter build stopped");
+    return false;
+  }
+  if (section->isPartial() && section->pageCount > targetPage) {
+    LOG_DBG("ERS", "Laid out %d pages, indexer continues the chapter", section->pageCount);
+    return true;
+  }
+  if (!stopAtTarget) {
+    return false;
+  }
+
+  // Stopped without a checkpoint (no paragraph boundary close enough), lay out the whole chapter instead
+  return section->createSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                                    SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
+                                    viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle,
+                                    SETTINGS.imageRendering, popupFn, [&slice]() { return !slice.yieldIfNeeded(); });
+}
+
+bool EpubReaderActivity::layOutProvisionalPage(const uint16_t viewportWidth, const uint16_t viewportHeight) {
+  // The spine sizes are those of the inflated XHTML, so the jump lands on a byte offset in the chapter's markup
+  const size_t previous = currentSpineIndex > 0 ? epub->getCumulativeSpineItemSize(currentSpineIndex - 1) : 0;
+  const size_t spineSize = epub->getCumulativeSpineItemSize(currentSpineIndex) - previous;
+  const auto offset = static_cast<uint32_t>(pendingSpineProgress * static_cast<float>(spineSize));
+  if (offset == 0 || (section->isPartial() && section->getLaidOutSourceOffset() > offset)) {
+    // The pages laid out so far reach it
+    pendingSourceOffset = static_cast<int32_t>(offset);
+    pendingPercentJump = false;
+    return false;
+  }
+
+  provisionalPage = section->layoutPageAt(offset, SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                                          SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
+                                          viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle,
+                                          SETTINGS.imageRendering, provisionalSourceOffset);
+  return provisionalPage != nullptr;
+}
+
 void EpubReaderActivity::silentIndexNextChapterIfNeeded(const uint16_t viewportWidth, const uint16_t viewportHeight) {
-  if (!epub || !section || section->pageCount < 2) {
+  if (!epub || !section || section->isPartial() || section->pageCount < 2) {
     return;
   }
 
@@ -676,136 +967,388 @@ void EpubReaderActivity::silentIndexNextChapterIfNeeded(const uint16_t viewportW
   }
 
   LOG_DBG("ERS", "Silently indexing next chapter: %d", nextSpineIndex);
+  // Only a head start: a page turn or leaving the reader stops it at the next checkpoint, and it continues from there
+  JobSlice slice(JobSlice::StopWhen::LEAVING_OR_SUPERSEDED);
   if (!nextSection.createSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
                                      SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
                                      viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle,
-                                     SETTINGS.imageRendering)) {
+                                     SETTINGS.imageRendering, nullptr, [&slice]() { return !slice.yieldIfNeeded(); }) &&
+      !slice.stopped()) {
     LOG_ERR("ERS", "Failed silent indexing for chapter: %d", nextSpineIndex);
   }
 }
 
-void EpubReaderActivity::saveProgress(int spineIndex, int currentPage, int pageCount) {
-  FsFile f;
-  if (Storage.openFileForWrite("ERS", epub->getCachePath() + "/progress.bin", f)) {
-    uint8_t data[6];
-    data[0] = currentSpineIndex & 0xFF;
-    data[1] = (currentSpineIndex >> 8) & 0xFF;
-    data[2] = currentPage & 0xFF;
-    data[3] = (currentPage >> 8) & 0xFF;
-    data[4] = pageCount & 0xFF;
-    data[5] = (pageCount >> 8) & 0xFF;
-    f.write(data, 6);
-    LOG_DBG("ERS", "Progress saved: Chapter %d, Page %d", spineIndex, currentPage);
-  } else {
-    LOG_ERR("ERS", "Could not save progress!");
+void EpubReaderActivity::saveResumeSnapshot() {
+  if (!section || provisionalPage || section->pageCount == 0) {
+    return;
+  }
+  ResumeSnapshot::Snapshot snapshot;
+  FsFile sectionFile;
+  if (!section->getPageRecord(section->currentPage, snapshot.pagePos, snapshot.pageEnd) ||
+      !Storage.openFileForRead("ERS", section->getFilePath(), sectionFile)) {
+    return;
+  }
+  const auto margins = ReaderUtils::getEpubMargins(renderer, automaticPageTurnActive);
+  snapshot.bookPath = epub->getPath();
+  snapshot.sectionPath = section->getFilePath();
+  snapshot.sectionSize = sectionFile.size();
+  snapshot.fontId = SETTINGS.getReaderFontId();
+  snapshot.orientation = SETTINGS.orientation;
+  snapshot.marginLeft = static_cast<int16_t>(margins.left);
+  snapshot.marginTop = static_cast<int16_t>(margins.top);
+  ResumeSnapshot::save(snapshot);
+}
+
+int32_t EpubReaderActivity::currentSourceOffset() const {
+  if (provisionalPage) {
+    return static_cast<int32_t>(provisionalSourceOffset);
+  }
+  if (!section || section->isPartial()) {
+    return -1;
   }
+  const auto offset = section->getPageSourceOffset(section->currentPage);
+  return offset ? static_cast<int32_t>(*offset) : -1;
 }
-void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int orientedMarginTop,
+
+void EpubReaderActivity::recordSyncPosition() {
+  if (!KOREADER_STORE.hasCredentials() || !epub || !section) {
+    return;
+  }
+  const std::string documentHash = KOREADER_STORE.getMatchMethod() == DocumentMatchMethod::FILENAME
+                                       ? KOReaderDocumentId::calculateFromFilename(epub->getPath())
+                                       : KOReaderDocumentId::calculate(epub->getPath(), epub->getCachePath());
+  if (documentHash.empty()) {
+    return;
+  }
+  CrossPointPosition current{currentSpineIndex, section->currentPage, section->pageCount, currentSourceOffset()};
+  if (provisionalPage) {
+    current.pageNumber = static_cast<int>(pendingSpineProgress * 1000);
+    current.totalPages = 1000;
+  }
+  const KOReaderPosition position = ProgressMapper::toKOReader(epub, current);
+  // Before the first NTP sync the clock counts from 1970
+  constexpr time_t MIN_VALID_TIME = 1600000000;
+  const time_t now = time(nullptr);
+  KOReaderSyncJournal::record({documentHash, position.xpath, position.percentage, now >= MIN_VALID_TIME ? now : 0});
+}
+
+void EpubReaderActivity::saveProgress(int spineIndex, int currentPage, int pageCount, const bool now) {
+  uint8_t data[6];
+  data[0] = spineIndex & 0xFF;
+  data[1] = (spineIndex >> 8) & 0xFF;
+  data[2] = currentPage & 0xFF;
+  data[3] = (currentPage >> 8) & 0xFF;
+  data[4] = pageCount & 0xFF;
+  data[5] = (pageCount >> 8) & 0xFF;
+  // Debounced: only every few page turns reach the SD card
+  if (!progressJournal.record(data, sizeof(data), now)) {
+    return;
+  }
+  LOG_DBG("ERS", "Progress saved: Chapter %d, Page %d", spineIndex, currentPage);
+  const float chapterProgress = pageCount > 0 ? static_cast<float>(currentPage) / pageCount : 0;
+  const float bookProgress = epub->calculateProgress(spineIndex, chapterProgress);
+  LIBRARY.setProgress(epub->getPath(), static_cast<uint16_t>(bookProgress * 1000));
+}
+void EpubReaderActivity::renderContents(const Page& page, const int pageIndex, const int orientedMarginTop,
                                         const int orientedMarginRight, const int orientedMarginBottom,
                                         const int orientedMarginLeft) {
-  const auto t0 = millis();
   auto* fcm = renderer.getFontCacheManager();
   fcm->resetStats();
 
-  // Font prewarm: scan pass accumulates text, then prewarm, then real render
-  const uint32_t heapBefore = esp_get_free_heap_size();
-  auto scope = fcm->createPrewarmScope();
-  page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);  // scan pass
-  scope.endScanAndPrewarm();
-  const uint32_t heapAfter = esp_get_free_heap_size();
-  fcm->logStats("prewarm");
-  const auto tPrewarm = millis();
-
-  LOG_DBG("ERS", "Heap: before=%lu after=%lu delta=%ld", heapBefore, heapAfter,
-          (int32_t)heapAfter - (int32_t)heapBefore);
-
-  // Force special handling for pages with images when anti-aliasing is on
-  bool imagePageWithAA = page->hasImages() && SETTINGS.textAntiAliasing;
-
-  page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
-  renderStatusBar();
-  fcm->logStats("bw_render");
-  const auto tBwRender = millis();
-
-  if (imagePageWithAA) {
-    // Double FAST_REFRESH with selective image blanking (pablohc's technique):
-    // HALF_REFRESH sets particles too firmly for the grayscale LUT to adjust.
-    // Instead, blank only the image area and do two fast refreshes.
-    // Step 1: Display page with image area blanked (text appears, image area white)
-    // Step 2: Re-render with images and display again (images appear clean)
-    int16_t imgX, imgY, imgW, imgH;
-    if (page->getImageBoundingBox(imgX, imgY, imgW, imgH)) {
-      renderer.fillRect(imgX + orientedMarginLeft, imgY + orientedMarginTop, imgW, imgH, false);
-      renderer.displayBuffer(HalDisplay::FAST_REFRESH);
+  // The black and white frame may have been rendered ahead while the previous page was up
+  bool fromShadow = false;
+  if (!pageShadow.empty()) {
+    fromShadow = !PerfProfiler::overlayEnabled() &&
+                 pageShadow.take(shadowKey(pageIndex), renderer.getFrameBuffer(), renderer.getBufferSize());
+    if (!fromShadow) {
+      renderer.clearScreen();
+    }
+  }
+
+  // Decoding and dithering images takes much longer than drawing text: the text of an image page goes up first and the
+  // images follow in a refresh of their own area. Bilevel images are drawn from their pixel caches with the text.
+  const bool deferImages = !fromShadow && page.hasGrayImages();
+
+  std::optional<FontCacheManager::PrewarmScope> scope;
+  if (fromShadow) {
+    LOG_DBG("ERS", "Showing page %d rendered ahead", pageIndex);
+  } else {
+    // Font prewarm: the page's glyphs are collected without rendering it, then prewarmed, then the real render
+    const uint32_t heapBefore = esp_get_free_heap_size();
+    scope.emplace(fcm->createPrewarmScope());
+    {
+      PerfProfiler::Scope timer(PerfProfiler::SCAN_PASS);
+      page.recordGlyphs(*fcm, SETTINGS.getReaderFontId());
+    }
+    {
+      PerfProfiler::Scope timer(PerfProfiler::PREWARM);
+      scope->endScanAndPrewarm();
+    }
+    const uint32_t heapAfter = esp_get_free_heap_size();
+    fcm->logStats("prewarm");
+
+    LOG_DBG("ERS", "Heap: before=%lu after=%lu delta=%ld", heapBefore, heapAfter,
+            (int32_t)heapAfter - (int32_t)heapBefore);
+
+    PerfProfiler::Scope timer(PerfProfiler::BW_RENDER);
+    if (deferImages) {
+      page.renderText(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+    } else {
+      page.render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+    }
+    renderStatusBar(pageIndex);
+    if (PerfProfiler::overlayEnabled()) {
+      const int overlayWidth = renderer.getScreenWidth() - orientedMarginLeft - orientedMarginRight;
+      PerfProfiler::drawOverlay(renderer, orientedMarginLeft, orientedMarginTop, overlayWidth);
+      ResourceMonitor::drawOverlay(renderer, orientedMarginLeft,
+                                   orientedMarginTop + renderer.getLineHeight(SMALL_FONT_ID), overlayWidth);
+    }
+    timer.end();
+    fcm->logStats("bw_render");
+  }
 
-      // Re-render page content to restore images into the blanked area
-      // Status bar is not re-rendered here to avoid reading stale dynamic values (e.g. battery %)
-      page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  // A page turn arrived while this page was drawn; the next render shows the page the turns end on
+  if (activityManager.isRenderSuperseded()) {
+    LOG_DBG("ERS", "Render superseded, skipping display");
+    renderPageTurnOverlay();
+    return;
+  }
+
+  {
+    PerfProfiler::Scope timer(PerfProfiler::BW_DISPLAY);
+    if (deferImages && SETTINGS.textAntiAliasing) {
+      // Fast refreshes only (pablohc's technique): a half refresh sets particles too firmly for the grayscale LUT to
+      // adjust. The image area is blank in this one and gets its own fast refresh below, which together handle the
+      // ghosting, so image pages don't count toward the full refresh cadence.
       renderer.displayBuffer(HalDisplay::FAST_REFRESH);
     } else {
-      renderer.displayBuffer(HalDisplay::HALF_REFRESH);
+      ReaderUtils::displayWithRefreshCycle(renderer);
     }
-    // Double FAST_REFRESH handles ghosting for image pages; don't count toward full refresh cadence
-  } else {
-    ReaderUtils::displayWithRefreshCycle(renderer, pagesUntilFullRefresh);
   }
-  const auto tDisplay = millis();
+  if (const uint32_t latencyUs = renderer.takeInputLatencyUs()) {
+    PerfProfiler::record(PerfProfiler::INPUT_LATENCY, latencyUs);
+    PERF_HISTORY.record(PerfHistory::PAGE_TURN_MS, latencyUs / 1000);
+  }
+
+  if (deferImages) {
+    // A page turn that arrived while the text went up skips the decode
+    if (activityManager.isRenderSuperseded()) {
+      LOG_DBG("ERS", "Render superseded, skipping images");
+      return;
+    }
+    {
+      PerfProfiler::Scope timer(PerfProfiler::BW_RENDER);
+      page.renderImages(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+    }
+    PerfProfiler::Scope timer(PerfProfiler::BW_DISPLAY);
+    // Only the images' ink changed; images that came out blank need no refresh
+    int16_t imgX, imgY, imgW, imgH;
+    if (page.getImageBoundingBox(imgX, imgY, imgW, imgH) &&
+        !renderer.displayRegion(imgX + orientedMarginLeft, imgY + orientedMarginTop, imgW, imgH)) {
+      renderer.displayBuffer(HalDisplay::FAST_REFRESH);
+    }
+  }
+
+  // The black and white page is up; its grayscale pass would only delay the next page
+  if (activityManager.isRenderSuperseded()) {
+    LOG_DBG("ERS", "Render superseded, skipping grayscale pass");
+    return;
+  }
 
   // Save bw buffer to reset buffer state after grayscale data sync
-  renderer.storeBwBuffer();
-  const auto tBwStore = millis();
+  bool bwStored;
+  {
+    PerfProfiler::Scope timer(PerfProfiler::BW_STORE);
+    bwStored = renderer.storeBwBuffer();
+  }
 
   // grayscale rendering
   // TODO: Only do this if font supports it
-  if (SETTINGS.textAntiAliasing) {
-    renderer.clearScreen(0x00);
-    renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
-    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
-    renderer.copyGrayscaleLsbBuffers();
-    const auto tGrayLsb = millis();
+  if (SETTINGS.textAntiAliasing == CrossPointSettings::AA_WHEN_IDLE) {
+    // The main loop asks for the grayscale pass once the reader has been idle, unless another page comes up first
+    deferredGraySpineIndex = currentSpineIndex;
+    deferredGrayPage = provisionalPage ? -1 : pageIndex;
+    deferredGrayAt = millis();
+  } else if (SETTINGS.textAntiAliasing) {
+    // Glyphs of a page from the shadow are prewarmed only now, after it is up
+    renderGrayscale(page, orientedMarginTop, orientedMarginLeft, fromShadow);
+  }
+  scope.reset();
 
-    // Render and copy to MSB buffer
-    renderer.clearScreen(0x00);
-    renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
-    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
-    renderer.copyGrayscaleMsbBuffers();
-    const auto tGrayMsb = millis();
+  // The frame buffer is free until the BW frame is restored, which is when the next page can be drawn in it
+  if (bwStored) {
+    prerenderNextPage(pageIndex, orientedMarginTop, orientedMarginLeft);
+  }
 
-    // display grayscale part
+  // restore the bw data
+  PerfProfiler::Scope timer(PerfProfiler::BW_RESTORE);
+  renderer.restoreBwBuffer();
+}
+
+void EpubReaderActivity::renderGrayscale(const Page& page, const int orientedMarginTop, const int orientedMarginLeft,
+                                         const bool prewarm) {
+  auto* fcm = renderer.getFontCacheManager();
+  std::optional<FontCacheManager::PrewarmScope> scope;
+  if (prewarm) {
+    scope.emplace(fcm->createPrewarmScope());
+    {
+      PerfProfiler::Scope timer(PerfProfiler::SCAN_PASS);
+      page.recordGlyphs(*fcm, SETTINGS.getReaderFontId());
+    }
+    PerfProfiler::Scope timer(PerfProfiler::PREWARM);
+    scope->endScanAndPrewarm();
+  }
+  bool splitGray;
+  {
+    PerfProfiler::Scope timer(PerfProfiler::GRAY_RENDER);
+    // Pages without gray images get both gray planes from one render when there's memory for the second plane
+    splitGray = !page.hasGrayImages() && renderer.beginGrayscaleSplit();
+    if (splitGray) {
+      for (int band = 0; band < renderer.getGrayscaleBandCount(); band++) {
+        int bandTop, bandBottom;
+        renderer.beginGrayscaleBand(band, &bandTop, &bandBottom);
+        page.renderBand(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop, bandTop,
+                        bandBottom);
+        renderer.endGrayscaleBand();
+      }
+      splitGray = renderer.copyGrayscaleSplitBuffers();
+    }
+    if (!splitGray) {
+      renderer.clearScreen(0x00);
+      renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
+      page.render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+      renderer.copyGrayscaleLsbBuffers();
+
+      // Render and copy to MSB buffer
+      renderer.clearScreen(0x00);
+      renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+      page.render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+      renderer.copyGrayscaleMsbBuffers();
+    }
+  }
+  LOG_DBG("ERS", "Gray planes rendered %s", splitGray ? "in one banded pass" : "as lsb+msb");
+
+  // display grayscale part
+  {
+    PerfProfiler::Scope timer(PerfProfiler::GRAY_DISPLAY);
     renderer.displayGrayBuffer();
-    const auto tGrayDisplay = millis();
-    renderer.setRenderMode(GfxRenderer::BW);
-    fcm->logStats("gray");
-
-    // restore the bw data
-    renderer.restoreBwBuffer();
-    const auto tBwRestore = millis();
-
-    const auto tEnd = millis();
-    LOG_DBG("ERS",
-            "Page render: prewarm=%lums bw_render=%lums display=%lums bw_store=%lums "
-            "gray_lsb=%lums gray_msb=%lums gray_display=%lums bw_restore=%lums total=%lums",
-            tPrewarm - t0, tBwRender - tPrewarm, tDisplay - tBwRender, tBwStore - tDisplay, tGrayLsb - tBwStore,
-            tGrayMsb - tGrayLsb, tGrayDisplay - tGrayMsb, tBwRestore - tGrayDisplay, tEnd - t0);
-  } else {
-    // restore the bw data
-    renderer.restoreBwBuffer();
-    const auto tBwRestore = millis();
+  }
+  renderer.setRenderMode(GfxRenderer::BW);
+  fcm->logStats("gray");
+}
+
+bool EpubReaderActivity::renderDeferredGrayscale() {
+  if (deferredGrayPage < 0 || !section || provisionalPage || deferredGraySpineIndex != currentSpineIndex ||
+      deferredGrayPage != section->currentPage) {
+    return false;
+  }
+  deferredGrayPage = -1;
+  // The frame buffer still holds the page's BW frame, as the last render left it
+  const auto page = section->loadPage(section->currentPage);
+  if (!page || activityManager.isRenderSuperseded()) {
+    return page != nullptr;
+  }
 
-    const auto tEnd = millis();
-    LOG_DBG("ERS",
-            "Page render: prewarm=%lums bw_render=%lums display=%lums bw_store=%lums bw_restore=%lums total=%lums",
-            tPrewarm - t0, tBwRender - tPrewarm, tDisplay - tBwRender, tBwStore - tDisplay, tBwRestore - tBwStore,
-            tEnd - t0);
+  const auto margins = ReaderUtils::getEpubMargins(renderer, automaticPageTurnActive);
+  {
+    PerfProfiler::Scope timer(PerfProfiler::BW_STORE);
+    renderer.storeBwBuffer();
   }
+  renderGrayscale(*page, margins.top, margins.left, true);
+  PerfProfiler::Scope timer(PerfProfiler::BW_RESTORE);
+  renderer.restoreBwBuffer();
+  return true;
 }
 
-void EpubReaderActivity::renderStatusBar() const {
+void EpubReaderActivity::prerenderNextPage(const int pageIndex, const int orientedMarginTop,
+                                           const int orientedMarginLeft) {
+  const int nextPage = pageIndex + 1;
+  if (provisionalPage || nextPage >= section->pageCount || activityManager.isRenderSuperseded()) {
+    return;
+  }
+  const auto start = millis();
+  // Deserialized into the page cache even if it isn't drawn, the turn to it then skips the SD card
+  const auto page = section->loadPage(nextPage);
+  // Pages with gray images take their own refresh sequence and the perf overlay changes every frame
+  if (!page || page->hasGrayImages() || PerfProfiler::overlayEnabled()) {
+    return;
+  }
+  // The compressed frame takes up to half a frame buffer; the BW buffer chunks held now are freed right after
+  const size_t frameSize = renderer.getBufferSize();
+  if (esp_get_free_heap_size() < frameSize / 2 + PRERENDER_HEAP_RESERVE ||
+      heap_caps_get_largest_free_block(MALLOC_CAP_8BIT) < frameSize / 2) {
+    LOG_DBG("ERS", "Not enough memory to render page %d ahead", nextPage);
+    return;
+  }
+
+  renderer.clearScreen();
+  {
+    auto* fcm = renderer.getFontCacheManager();
+    auto scope = fcm->createPrewarmScope();
+    page->recordGlyphs(*fcm, SETTINGS.getReaderFontId());
+    scope.endScanAndPrewarm();
+    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  }
+  renderStatusBar(nextPage);
+
+  // In portrait, panel columns run along the lines of text
+  const auto orientation = renderer.getOrientation();
+  const bool byColumns = orientation == GfxRenderer::Portrait || orientation == GfxRenderer::PortraitInverted;
+  if (pageShadow.capture(shadowKey(nextPage), renderer.getFrameBuffer(), frameSize, renderer.getDisplayWidthBytes(),
+                         byColumns)) {
+    LOG_DBG("ERS", "Rendered page %d ahead in %lums", nextPage, millis() - start);
+  }
+}
+
+PageShadow::Key EpubReaderActivity::shadowKey(const int pageIndex) const {
+  return {currentSpineIndex, pageIndex, section->pageCount, section->getLayoutStamp(), automaticPageTurnActive};
+}
+
+void EpubReaderActivity::renderPageTurnOverlay() const {
+  constexpr int PADDING = 12;
+  const std::string text = std::to_string(section->currentPage + 1) + " / " + std::to_string(section->pageCount);
+  const int width = renderer.getTextWidth(UI_12_FONT_ID, text.c_str(), EpdFontFamily::BOLD) + 2 * PADDING;
+  const int height = renderer.getLineHeight(UI_12_FONT_ID) + 2 * PADDING;
+  const int x = (renderer.getScreenWidth() - width) / 2;
+  const int y = (renderer.getScreenHeight() - height) / 2;
+  renderer.fillRect(x, y, width, height, false);
+  renderer.drawRect(x, y, width, height, 2, true);
+  renderer.drawText(UI_12_FONT_ID, x + PADDING, y + PADDING, text.c_str(), true, EpdFontFamily::BOLD);
+  renderer.displayRegion(x, y, width, height);
+}
+
+void EpubReaderActivity::renderStatusBar(const int pageIndex) const {
   // Calculate progress in book
-  const int currentPage = section->currentPage + 1;
+  const int currentPage = pageIndex + 1;
   const float pageCount = section->pageCount;
   const float sectionChapterProg = (pageCount > 0) ? (static_cast<float>(currentPage) / pageCount) : 0;
-  const float bookProgress = epub->calculateProgress(currentSpineIndex, sectionChapterProg) * 100;
+  const float bookProgress =
+      epub->calculateProgress(currentSpineIndex, provisionalPage ? pendingSpineProgress : sectionChapterProg) * 100;
+
+  int shownPage = currentPage;
+  int shownPageCount = section->pageCount;
+  bool pageCountEstimated = false;
+  if (provisionalPage) {
+    // Where the chapter's layout will put the page, as far as the page counts of the book can tell
+    const int chapterPages = bookPages.isLoaded() ? std::max(1, bookPages.pagesOf(currentSpineIndex)) : 1;
+    shownPage = std::min(static_cast<int>(pendingSpineProgress * chapterPages), chapterPages - 1) + 1;
+    shownPageCount = chapterPages;
+    pageCountEstimated = true;
+    if (SETTINGS.statusBarBookPageNumbers && bookPages.isLoaded()) {
+      shownPage += bookPages.pagesBefore(currentSpineIndex);
+      shownPageCount = bookPages.totalPages();
+    }
+  } else if (SETTINGS.statusBarBookPageNumbers && bookPages.isLoaded()) {
+    // The chapter on screen counts with the pages laid out so far, even where pages.bin is behind
+    const int before = bookPages.pagesBefore(currentSpineIndex);
+    const int after = bookPages.totalPages() - bookPages.pagesBefore(currentSpineIndex + 1);
+    const int chapterPages = section->isPartial()
+                                 ? std::max<int>(bookPages.pagesOf(currentSpineIndex), section->pageCount)
+                                 : section->pageCount;
+    shownPage = before + currentPage;
+    shownPageCount = before + chapterPages + after;
+    pageCountEstimated = !bookPages.isExact() || section->isPartial();
+  }
 
   std::string title;
 
@@ -826,15 +1369,29 @@ void EpubReaderActivity::renderStatusBar() const {
     title = tr(STR_UNNAMED);
     const int tocIndex = epub->getTocIndexForSpineIndex(currentSpineIndex);
     if (tocIndex != -1) {
-      const auto tocItem = epub->getTocItem(tocIndex);
-      title = tocItem.title;
+      title = epub->getTocTitle(tocIndex);
     }
 
   } else if (SETTINGS.statusBarTitle == CrossPointSettings::STATUS_BAR_TITLE::BOOK_TITLE) {
     title = epub->getTitle();
   }
 
-  GUI.drawStatusBar(renderer, bookProgress, currentPage, pageCount, title, 0, textYOffset);
+  GUI.drawStatusBar(renderer, bookProgress, shownPage, shownPageCount, title, 0, textYOffset, pageCountEstimated);
+}
+
+void EpubReaderActivity::refreshBookPages() {
+  // A provisional page is numbered from the estimate too
+  if (!SETTINGS.statusBarBookPageNumbers && !provisionalPage) {
+    return;
+  }
+  if (bookPagesSpineIndex == currentSpineIndex && bookPagesLayoutStamp == section->getLayoutStamp() &&
+      bookPagesPartial == section->isPartial()) {
+    return;
+  }
+  bookPagesSpineIndex = currentSpineIndex;
+  bookPagesLayoutStamp = section->getLayoutStamp();
+  bookPagesPartial = section->isPartial();
+  bookPages.load(*epub, section->getLayoutDir());
 }
 
 void EpubReaderActivity::navigateToHref(const std::string& hrefStr, const bool savePosition) {
@@ -1,22 +1,39 @@
 #pragma once
 #include <Epub.h>
+#include <Epub/BookPageCounts.h>
 #include <Epub/FootnoteEntry.h>
+#include <Epub/Page.h>
+#include <Epub/PageCache.h>
 #include <Epub/Section.h>
 
 #include "EpubReaderMenuActivity.h"
+#include "EpubSectionIndexer.h"
+#include "PageShadow.h"
+#include "ProgressJournal.h"
 #include "activities/Activity.h"
 
 class EpubReaderActivity final : public Activity {
   std::shared_ptr<Epub> epub;
   std::unique_ptr<Section> section = nullptr;
+  ProgressJournal progressJournal;
+  // Recently shown pages across sections, so flipping back or returning from a footnote skips the SD card
+  PageCache pageCache;
+  // The page after the one on screen, rendered ahead (see prerenderNextPage())
+  PageShadow pageShadow;
+  // Builds the remaining section caches in the background while the reader is idle
+  std::unique_ptr<EpubSectionIndexer> indexer;
   int currentSpineIndex = 0;
   int nextPageNumber = 0;
   // Set when navigating to a footnote href with a fragment (e.g. #note1).
   // Cleared on the next render after the new section loads and resolves it to a page.
   std::string pendingAnchor;
-  int pagesUntilFullRefresh = 0;
   int cachedSpineIndex = 0;
   int cachedChapterTotalPageCount = 0;
+  // Book-wide page numbers for the status bar, reread whenever another section (or layout) comes on screen
+  BookPageCounts bookPages;
+  int bookPagesSpineIndex = -1;
+  uint32_t bookPagesLayoutStamp = 0;
+  bool bookPagesPartial = false;
   unsigned long lastPageTurnTime = 0UL;
   unsigned long pageTurnDuration = 0UL;
   // Signals that the next render should reposition within the newly loaded section
@@ -24,9 +41,26 @@ class EpubReaderActivity final : public Activity {
   bool pendingPercentJump = false;
   // Normalized 0.0-1.0 progress within the target spine item, computed from book percentage.
   float pendingSpineProgress = 0.0f;
+  // Byte offset in the target spine item from a sync, resolved to a page once the section is loaded; -1 if none
+  int32_t pendingSourceOffset = -1;
+  // Page laid out on its own after a percent jump past what the chapter's section file has (see
+  // Section::layoutPageAt()), shown until the next page turn while the indexer lays out the chapter
+  std::unique_ptr<Page> provisionalPage;
+  uint32_t provisionalSourceOffset = 0;
+  // Pages to turn from the page found at pendingSourceOffset: the turn that left the provisional page
+  int provisionalTurn = 0;
+  // Offered again the next time the book is searched
+  std::string lastSearchQuery;
   bool pendingScreenshot = false;
   bool skipNextButtonCheck = false;  // Skip button processing for one frame after subactivity exit
   bool automaticPageTurnActive = false;
+  // Text anti-aliasing when idle: the page on screen still waiting for its grayscale pass (-1 if none), written by
+  // the render task; the main loop sets grayPassDue once the reader has been idle for GRAY_PASS_IDLE_MS
+  volatile int deferredGraySpineIndex = -1;
+  volatile int deferredGrayPage = -1;
+  volatile unsigned long deferredGrayAt = 0;
+  volatile bool grayPassDue = false;
+  unsigned long lastInputMs = 0;
 
   // Footnote support
   std::vector<FootnoteEntry> currentPageFootnotes;
@@ -38,11 +72,37 @@ class EpubReaderActivity final : public Activity {
   SavedPosition savedPositions[MAX_FOOTNOTE_DEPTH] = {};
   int footnoteDepth = 0;
 
-  void renderContents(std::unique_ptr<Page> page, int orientedMarginTop, int orientedMarginRight,
+  void renderContents(const Page& page, int pageIndex, int orientedMarginTop, int orientedMarginRight,
                       int orientedMarginBottom, int orientedMarginLeft);
-  void renderStatusBar() const;
+  // Draws the page after pageIndex into pageShadow, with the frame of pageIndex parked in the BW buffer chunks
+  void prerenderNextPage(int pageIndex, int orientedMarginTop, int orientedMarginLeft);
+  // Renders and shows the grayscale planes of the page, with its BW frame parked in the BW buffer chunks. prewarm
+  // collects the page's glyphs first, for when no prewarm scope is open.
+  void renderGrayscale(const Page& page, int orientedMarginTop, int orientedMarginLeft, bool prewarm);
+  // The deferred grayscale pass of the page on screen; false if another page has to be drawn instead
+  bool renderDeferredGrayscale();
+  PageShadow::Key shadowKey(int pageIndex) const;
+  void renderStatusBar(int pageIndex) const;
+  // Searches the book for lastSearchQuery and goes to the match picked
+  void startSearch();
+  // Lays out the provisional page for the pending percent jump; false if it is better found in the section file
+  bool layOutProvisionalPage(uint16_t viewportWidth, uint16_t viewportHeight);
+  void refreshBookPages();
+  // While paging quickly: shows only the page number reached, in a box refreshed on its own
+  void renderPageTurnOverlay() const;
+  // Lays out the current section. With targetPage >= 0, stops once that page exists (and, with targetSourceOffset,
+  // the chapter's XHTML up to that offset is laid out) and leaves the rest of the chapter to the indexer (progressive
+  // open).
+  bool buildSection(uint16_t viewportWidth, uint16_t viewportHeight, int targetPage,
+                    std::optional<uint32_t> targetSourceOffset = std::nullopt);
   void silentIndexNextChapterIfNeeded(uint16_t viewportWidth, uint16_t viewportHeight);
-  void saveProgress(int spineIndex, int currentPage, int pageCount);
+  void saveProgress(int spineIndex, int currentPage, int pageCount, bool now = false);
+  // Queues the position for the next batched KOReader sync
+  void recordSyncPosition();
+  // Remembers the page on screen so a wake from sleep can show it before anything else loads
+  void saveResumeSnapshot();
+  // Source byte offset of the current page (see Section::getPageSourceOffset()), -1 if unknown
+  int32_t currentSourceOffset() const;
   // Jump to a percentage of the book (0-100), mapping it to spine and page.
   void jumpToPercent(int percent);
   void onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction action);
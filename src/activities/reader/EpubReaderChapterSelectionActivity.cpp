@@ -41,7 +41,10 @@ void EpubReaderChapterSelectionActivity::onEnter() {
   requestUpdate();
 }
 
-void EpubReaderChapterSelectionActivity::onExit() { Activity::onExit(); }
+void EpubReaderChapterSelectionActivity::onExit() {
+  Activity::onExit();
+  tocWindow.clear();
+}
 
 void EpubReaderChapterSelectionActivity::loop() {
   const int pageItems = getPageItems();
@@ -76,12 +79,14 @@ void EpubReaderChapterSelectionActivity::loop() {
   });
 
   buttonNavigator.onNextContinuous([this, totalItems, pageItems] {
-    selectorIndex = ButtonNavigator::nextPageIndex(selectorIndex, totalItems, pageItems);
+    selectorIndex = ButtonNavigator::nextPageIndex(selectorIndex, totalItems, pageItems,
+                                                   buttonNavigator.continuousStride());
     requestUpdate();
   });
 
   buttonNavigator.onPreviousContinuous([this, totalItems, pageItems] {
-    selectorIndex = ButtonNavigator::previousPageIndex(selectorIndex, totalItems, pageItems);
+    selectorIndex = ButtonNavigator::previousPageIndex(selectorIndex, totalItems, pageItems,
+                                                       buttonNavigator.continuousStride());
     requestUpdate();
   });
 }
@@ -111,6 +116,8 @@ void EpubReaderChapterSelectionActivity::render(RenderLock&&) {
   renderer.drawText(UI_12_FONT_ID, titleX, 15 + contentY, tr(STR_SELECT_CHAPTER), true, EpdFontFamily::BOLD);
 
   const auto pageStartIndex = selectorIndex / pageItems * pageItems;
+  // Only reads when the page jumped past the window, e.g. on entering or through the wrap-around
+  tocWindow.load(pageStartIndex, pageItems, totalItems, false);
   // Highlight only the content area, not the hint gutters.
   renderer.fillRect(contentX, 60 + contentY + (selectorIndex % pageItems) * 30 - 2, contentWidth - 1, 30);
 
@@ -120,12 +127,13 @@ void EpubReaderChapterSelectionActivity::render(RenderLock&&) {
     const int displayY = 60 + contentY + i * 30;
     const bool isSelected = (itemIndex == selectorIndex);
 
-    auto item = epub->getTocItem(itemIndex);
+    const auto* item = tocWindow.at(itemIndex);
+    if (!item) break;
 
     // Indent per TOC level while keeping content within the gutter-safe region.
-    const int indentSize = contentX + 20 + (item.level - 1) * 15;
+    const int indentSize = contentX + 20 + (item->level - 1) * 15;
     const std::string chapterName =
-        renderer.truncatedText(UI_10_FONT_ID, item.title.c_str(), contentWidth - 40 - indentSize);
+        renderer.truncatedText(UI_10_FONT_ID, item->title.c_str(), contentWidth - 40 - indentSize);
 
     renderer.drawText(UI_10_FONT_ID, indentSize, displayY, chapterName.c_str(), !isSelected);
   }
@@ -133,5 +141,8 @@ void EpubReaderChapterSelectionActivity::render(RenderLock&&) {
   const auto labels = mappedInput.mapLabels(tr(STR_BACK), tr(STR_SELECT), tr(STR_DIR_UP), tr(STR_DIR_DOWN));
   GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
-  renderer.displayBuffer();
+  renderer.displayChanges();
+
+  // With the page on screen, move the window along so the next page up or down is already in RAM
+  tocWindow.load(pageStartIndex, pageItems, totalItems, true);
 }
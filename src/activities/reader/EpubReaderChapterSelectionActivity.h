@@ -4,6 +4,7 @@
 #include <memory>
 
 #include "../Activity.h"
+#include "components/ListWindow.h"
 #include "util/ButtonNavigator.h"
 
 class EpubReaderChapterSelectionActivity final : public Activity {
@@ -12,6 +13,8 @@ class EpubReaderChapterSelectionActivity final : public Activity {
   ButtonNavigator buttonNavigator;
   int currentSpineIndex = 0;
   int selectorIndex = 0;
+  // TOC entries of the page shown and the pages either side of it, read in one pass
+  ListWindow<BookMetadataCache::TocEntry> tocWindow;
 
   // Number of items that fit on a page, derived from logical screen height.
   // This adapts automatically when switching between portrait and landscape.
@@ -27,7 +30,10 @@ class EpubReaderChapterSelectionActivity final : public Activity {
       : Activity("EpubReaderChapterSelection", renderer, mappedInput),
         epub(epub),
         epubPath(epubPath),
-        currentSpineIndex(currentSpineIndex) {}
+        currentSpineIndex(currentSpineIndex),
+        tocWindow([this](const int first, const int count, std::vector<BookMetadataCache::TocEntry>& rows) {
+          this->epub->getTocItems(first, count, rows);
+        }) {}
   void onEnter() override;
   void onExit() override;
   void loop() override;
@@ -13,6 +13,8 @@ class EpubReaderMenuActivity final : public Activity {
   // Menu actions available from the reader menu.
   enum class MenuAction {
     SELECT_CHAPTER,
+    SEARCH,
+    LOOKUP_WORD,
     FOOTNOTES,
     GO_TO_PERCENT,
     AUTO_PAGE_TURN,
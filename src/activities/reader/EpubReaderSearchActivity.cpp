@@ -0,0 +1,191 @@
+#include "EpubReaderSearchActivity.h"
+
+#include <Epub/Section.h>
+#include <GfxRenderer.h>
+#include <I18n.h>
+
+#include <algorithm>
+
+#include "CrossPointSettings.h"
+#include "MappedInputManager.h"
+#include "components/UITheme.h"
+#include "fontIds.h"
+
+namespace {
+constexpr int ROW_HEIGHT = 50;
+}
+
+int EpubReaderSearchActivity::getPageItems() const {
+  const bool isPortraitInverted = renderer.getOrientation() == GfxRenderer::Orientation::PortraitInverted;
+  const int startY = 90 + (isPortraitInverted ? 50 : 0);
+  return std::max(1, (renderer.getScreenHeight() - startY - ROW_HEIGHT) / ROW_HEIGHT);
+}
+
+void EpubReaderSearchActivity::onEnter() {
+  Activity::onEnter();
+  terms = SearchIndex::terms(query);
+  if (terms.empty()) {
+    nextSpineIndex = epub->getSpineItemsCount();
+  }
+  requestUpdate();
+}
+
+void EpubReaderSearchActivity::onExit() {
+  Activity::onExit();
+  rows.clear();
+}
+
+void EpubReaderSearchActivity::searchSpineItem(const int spineIndex) {
+  std::vector<SearchMatch> found;
+  const size_t maxMatches = MAX_MATCHES - rows.size();
+  // The reader's page cache isn't used, the pages loaded to confirm a match are rarely read next
+  Section section(epub, spineIndex, renderer);
+  const bool laidOut = section.loadSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                                               SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment,
+                                               viewportWidth, viewportHeight, SETTINGS.hyphenationEnabled,
+                                               SETTINGS.embeddedStyle, SETTINGS.imageRendering);
+  if (!laidOut || !section.findPhrase(terms, maxMatches, found)) {
+    found.clear();
+    SearchIndex::scanMarkup(*epub, spineIndex, terms, maxMatches, found);
+  }
+  if (found.empty()) {
+    return;
+  }
+
+  std::string chapter = tr(STR_UNNAMED);
+  const int tocIndex = epub->getTocIndexForSpineIndex(spineIndex);
+  if (tocIndex != -1) {
+    chapter = epub->getTocTitle(tocIndex);
+  }
+  RenderLock lock(*this);
+  for (auto& match : found) {
+    rows.push_back({std::move(match), chapter});
+  }
+}
+
+void EpubReaderSearchActivity::loop() {
+  if (isSearching()) {
+    if (mappedInput.wasReleased(MappedInputManager::Button::Back)) {
+      // Stops with the matches found so far
+      RenderLock lock(*this);
+      nextSpineIndex = epub->getSpineItemsCount();
+    } else {
+      searchSpineItem(nextSpineIndex);
+      RenderLock lock(*this);
+      nextSpineIndex = rows.size() < MAX_MATCHES ? nextSpineIndex + 1 : epub->getSpineItemsCount();
+    }
+    requestUpdate();
+    return;
+  }
+
+  const int pageItems = getPageItems();
+  const int totalItems = static_cast<int>(rows.size());
+
+  if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
+    if (selectorIndex < totalItems) {
+      const auto& match = rows[selectorIndex].match;
+      setResult(SearchResult{match.spineIndex, match.page, match.sourceOffset});
+      finish();
+    }
+    return;
+  }
+  if (mappedInput.wasReleased(MappedInputManager::Button::Back)) {
+    ActivityResult result;
+    result.isCancelled = true;
+    setResult(std::move(result));
+    finish();
+    return;
+  }
+  if (totalItems == 0) {
+    return;
+  }
+
+  buttonNavigator.onNextRelease([this, totalItems] {
+    selectorIndex = ButtonNavigator::nextIndex(selectorIndex, totalItems);
+    requestUpdate();
+  });
+
+  buttonNavigator.onPreviousRelease([this, totalItems] {
+    selectorIndex = ButtonNavigator::previousIndex(selectorIndex, totalItems);
+    requestUpdate();
+  });
+
+  buttonNavigator.onNextContinuous([this, totalItems, pageItems] {
+    selectorIndex = ButtonNavigator::nextPageIndex(selectorIndex, totalItems, pageItems,
+                                                   buttonNavigator.continuousStride());
+    requestUpdate();
+  });
+
+  buttonNavigator.onPreviousContinuous([this, totalItems, pageItems] {
+    selectorIndex = ButtonNavigator::previousPageIndex(selectorIndex, totalItems, pageItems,
+                                                       buttonNavigator.continuousStride());
+    requestUpdate();
+  });
+}
+
+void EpubReaderSearchActivity::render(RenderLock&&) {
+  renderer.clearScreen();
+
+  const auto pageWidth = renderer.getScreenWidth();
+  const auto orientation = renderer.getOrientation();
+  // Landscape orientation: reserve a horizontal gutter for button hints.
+  const bool isLandscapeCw = orientation == GfxRenderer::Orientation::LandscapeClockwise;
+  const bool isLandscapeCcw = orientation == GfxRenderer::Orientation::LandscapeCounterClockwise;
+  const bool isPortraitInverted = orientation == GfxRenderer::Orientation::PortraitInverted;
+  const int hintGutterWidth = (isLandscapeCw || isLandscapeCcw) ? 30 : 0;
+  const int contentX = isLandscapeCw ? hintGutterWidth : 0;
+  const int contentWidth = pageWidth - hintGutterWidth;
+  const int contentY = isPortraitInverted ? 50 : 0;
+
+  const int titleX =
+      contentX + (contentWidth - renderer.getTextWidth(UI_12_FONT_ID, tr(STR_SEARCH_BOOK), EpdFontFamily::BOLD)) / 2;
+  renderer.drawText(UI_12_FONT_ID, titleX, 15 + contentY, tr(STR_SEARCH_BOOK), true, EpdFontFamily::BOLD);
+  const std::string shownQuery =
+      renderer.truncatedText(UI_10_FONT_ID, ("\"" + query + "\"").c_str(), contentWidth - 40);
+  const int queryX = contentX + (contentWidth - renderer.getTextWidth(UI_10_FONT_ID, shownQuery.c_str())) / 2;
+  renderer.drawText(UI_10_FONT_ID, queryX, 50 + contentY, shownQuery.c_str());
+
+  if (isSearching()) {
+    const int spineCount = epub->getSpineItemsCount();
+    const std::string progress = std::string(tr(STR_SEARCHING)) + " " +
+                                 std::to_string(nextSpineIndex * 100 / std::max(1, spineCount)) + "%  (" +
+                                 std::to_string(rows.size()) + ")";
+    renderer.drawCenteredText(UI_10_FONT_ID, 120 + contentY, progress.c_str());
+    const auto labels = mappedInput.mapLabels(tr(STR_BACK), "", "", "");
+    GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
+    renderer.displayBuffer();
+    return;
+  }
+
+  if (rows.empty()) {
+    renderer.drawCenteredText(UI_10_FONT_ID, 120 + contentY, tr(STR_NO_MATCHES));
+    const auto labels = mappedInput.mapLabels(tr(STR_BACK), "", "", "");
+    GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
+    renderer.displayBuffer();
+    return;
+  }
+
+  const int pageItems = getPageItems();
+  const int totalItems = static_cast<int>(rows.size());
+  const int pageStartIndex = selectorIndex / pageItems * pageItems;
+  const int listY = 90 + contentY;
+  renderer.fillRect(contentX, listY + (selectorIndex % pageItems) * ROW_HEIGHT - 2, contentWidth - 1, ROW_HEIGHT);
+
+  for (int i = 0; i < pageItems; i++) {
+    const int itemIndex = pageStartIndex + i;
+    if (itemIndex >= totalItems) break;
+    const int displayY = listY + i * ROW_HEIGHT;
+    const bool isSelected = itemIndex == selectorIndex;
+    const auto& row = rows[itemIndex];
+
+    const std::string chapter = renderer.truncatedText(SMALL_FONT_ID, row.chapter.c_str(), contentWidth - 40);
+    renderer.drawText(SMALL_FONT_ID, contentX + 20, displayY, chapter.c_str(), !isSelected);
+    const std::string snippet = renderer.truncatedText(UI_10_FONT_ID, row.match.snippet.c_str(), contentWidth - 40);
+    renderer.drawText(UI_10_FONT_ID, contentX + 20, displayY + 20, snippet.c_str(), !isSelected);
+  }
+
+  const auto labels = mappedInput.mapLabels(tr(STR_BACK), tr(STR_SELECT), tr(STR_DIR_UP), tr(STR_DIR_DOWN));
+  GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
+
+  renderer.displayChanges();
+}
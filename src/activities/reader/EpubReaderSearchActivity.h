@@ -0,0 +1,57 @@
+#pragma once
+#include <Epub.h>
+#include <Epub/SearchIndex.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../Activity.h"
+#include "util/ButtonNavigator.h"
+
+/**
+ * Searches the book for a phrase, one spine item per loop iteration so the search shows its progress and Back stops
+ * it with the matches found so far. Chapters laid out in the reader's layout are searched through their search index,
+ * the others by scanning their markup (see SearchIndex).
+ */
+class EpubReaderSearchActivity final : public Activity {
+  struct Row {
+    SearchMatch match;
+    std::string chapter;
+  };
+
+  std::shared_ptr<Epub> epub;
+  std::string query;
+  std::vector<std::string> terms;
+  // Layout of the reader's section files
+  uint16_t viewportWidth;
+  uint16_t viewportHeight;
+  // Spine item searched next; the search is done once it reaches the spine item count
+  int nextSpineIndex = 0;
+  std::vector<Row> rows;
+  int selectorIndex = 0;
+  ButtonNavigator buttonNavigator;
+
+  static constexpr size_t MAX_MATCHES = 100;
+
+  bool isSearching() const { return nextSpineIndex < epub->getSpineItemsCount(); }
+  void searchSpineItem(int spineIndex);
+  int getPageItems() const;
+
+ public:
+  explicit EpubReaderSearchActivity(GfxRenderer& renderer, MappedInputManager& mappedInput,
+                                    const std::shared_ptr<Epub>& epub, std::string query, const uint16_t viewportWidth,
+                                    const uint16_t viewportHeight)
+      : Activity("EpubReaderSearch", renderer, mappedInput),
+        epub(epub),
+        query(std::move(query)),
+        viewportWidth(viewportWidth),
+        viewportHeight(viewportHeight) {}
+  void onEnter() override;
+  void onExit() override;
+  void loop() override;
+  void render(RenderLock&&) override;
+  bool skipLoopDelay() override { return isSearching(); }
+  bool preventAutoSleep() override { return isSearching(); }
+  bool isReaderActivity() const override { return true; }
+};
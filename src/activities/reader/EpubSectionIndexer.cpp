@@ -0,0 +1,199 @@
+#include "EpubSectionIndexer.h"
+
+#include <Epub/Section.h>
+#include <HalPowerManager.h>
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include "CrossPointSettings.h"
+#include "PerfHistory.h"
+#include "activities/RenderLock.h"
+#include "util/PerfProfiler.h"
+
+namespace {
+constexpr uint8_t CURSOR_FILE_VERSION = 1;
+constexpr unsigned long POLL_MS = 250;
+constexpr unsigned long LOCK_TIMEOUT_MS = 100;
+}  // namespace
+
+void EpubSectionIndexer::notifyInteraction() { lastInteractionMs = millis(); }
+
+void EpubSectionIndexer::setLayout(const uint16_t width, const uint16_t height, const int currentSpineIndex,
+                                   const bool currentSectionPartial) {
+  readerSpineIndex = currentSpineIndex;
+  readerSectionPartial = currentSectionPartial;
+  viewportWidth = width;
+  viewportHeight = height;
+  // Any setting in the key changes the layout, not just the viewport; the worker may have finished with the old one
+  if (computeLayoutKey() != layoutKey) {
+    layoutChanged = true;
+  }
+  if ((layoutChanged || readerSectionPartial) && !isRunning()) {
+    start(STACK_SIZE);
+  }
+}
+
+uint32_t EpubSectionIndexer::computeLayoutKey() const {
+  // Same parameters Section::loadSectionFile validates against, so a key match means the cursor is still meaningful
+  uint32_t hash = 2166136261u;
+  serialization::hashPod(hash, SETTINGS.getReaderFontId());
+  serialization::hashPod(hash, SETTINGS.getReaderLineCompression());
+  serialization::hashPod(hash, SETTINGS.extraParagraphSpacing);
+  serialization::hashPod(hash, SETTINGS.paragraphAlignment);
+  serialization::hashPod(hash, viewportWidth);
+  serialization::hashPod(hash, viewportHeight);
+  serialization::hashPod(hash, SETTINGS.hyphenationEnabled);
+  serialization::hashPod(hash, SETTINGS.embeddedStyle);
+  serialization::hashPod(hash, SETTINGS.imageRendering);
+  return hash;
+}
+
+void EpubSectionIndexer::resetCursor(const uint32_t key) {
+  const int spineCount = epub->getSpineItemsCount();
+  layoutKey = key;
+  // Start right after the chapter being read, then wrap around to the beginning of the book
+  nextSpineIndex = spineCount > 0 ? static_cast<uint16_t>((readerSpineIndex + 1) % spineCount) : 0;
+  remaining = static_cast<uint16_t>(spineCount);
+  saveCursor();
+}
+
+bool EpubSectionIndexer::loadCursor(const uint32_t key) {
+  FsFile f;
+  if (!Storage.openFileForRead("IDX", epub->getCachePath() + "/indexer.bin", f)) {
+    return false;
+  }
+
+  uint8_t version;
+  uint32_t fileKey;
+  uint16_t fileNext, fileRemaining;
+  serialization::readPod(f, version);
+  serialization::readPod(f, fileKey);
+  serialization::readPod(f, fileNext);
+  serialization::readPod(f, fileRemaining);
+  if (version != CURSOR_FILE_VERSION || fileKey != key || fileNext >= epub->getSpineItemsCount() ||
+      fileRemaining > epub->getSpineItemsCount()) {
+    LOG_DBG("IDX", "Ignoring stale cursor");
+    return false;
+  }
+
+  layoutKey = key;
+  nextSpineIndex = fileNext;
+  remaining = fileRemaining;
+  LOG_DBG("IDX", "Resuming at spine %u, %u remaining", nextSpineIndex, remaining);
+  return true;
+}
+
+void EpubSectionIndexer::saveCursor() const {
+  FsFile f;
+  if (!Storage.openFileForWrite("IDX", epub->getCachePath() + "/indexer.bin", f)) {
+    return;
+  }
+  serialization::writePod(f, CURSOR_FILE_VERSION);
+  serialization::writePod(f, layoutKey);
+  serialization::writePod(f, nextSpineIndex);
+  serialization::writePod(f, remaining);
+}
+
+EpubSectionIndexer::BuildResult EpubSectionIndexer::indexSpineItem(const int spineIndex) {
+  Section section(epub, spineIndex, renderer);
+  if (section.loadSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                              SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
+                              viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle,
+                              SETTINGS.imageRendering)) {
+    return BuildResult::BUILT;
+  }
+
+  LOG_DBG("IDX", "Indexing spine item %d from page %d", spineIndex, section.pageCount);
+  if (spineIndex != timedSpineIndex) {
+    timedSpineIndex = spineIndex;
+    timedBuildMs = 0;
+    timedFromStart = section.pageCount == 0;
+  }
+  HalPowerManager::Lock powerLock;  // Don't get clocked down by idle power saving while laying out
+  // The step ends STEP_PAGES past where the build starts, which a resumed build only knows once it is under way
+  int stepEnd = -1;
+  const auto abortFn = [this, &section, &stepEnd]() {
+    if (stepEnd < 0) {
+      stepEnd = section.pageCount + STEP_PAGES;
+    }
+    return shouldYield() || section.pageCount >= stepEnd;
+  };
+  const unsigned long buildStart = millis();
+  const bool built = section.createSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                                               SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment,
+                                               viewportWidth, viewportHeight, SETTINGS.hyphenationEnabled,
+                                               SETTINGS.embeddedStyle, SETTINGS.imageRendering, nullptr, abortFn);
+  timedBuildMs += millis() - buildStart;
+  if (built) {
+    const size_t previous = spineIndex > 0 ? epub->getCumulativeSpineItemSize(spineIndex - 1) : 0;
+    const size_t sizeKb = (epub->getCumulativeSpineItemSize(spineIndex) - previous) / 1024;
+    if (timedFromStart && sizeKb > 0) {
+      PERF_HISTORY.record(PerfHistory::INDEXING_US_PER_KB, timedBuildMs * 1000 / sizeKb);
+    }
+    timedSpineIndex = -1;
+    return BuildResult::BUILT;
+  }
+  // Stopped for the lock before the first checkpoint, it starts over (or from the previous checkpoint) next time
+  return section.isPartial() || shouldYield() ? BuildResult::PAUSED : BuildResult::FAILED;
+}
+
+void EpubSectionIndexer::run() {
+  // After a pause for a waiter, give it time to take the lock rather than taking it straight back on the next pass
+  const auto pauseFor = [this](RenderLock& lock) {
+    if (shouldYield()) {
+      lock.unlock();
+      sleepFor(POLL_MS);
+    }
+  };
+
+  while (!stopRequested()) {
+    if (millis() - lastInteractionMs < IDLE_BEFORE_BUILD_MS) {
+      sleepFor(POLL_MS);
+      continue;
+    }
+
+    RenderLock lock(LOCK_TIMEOUT_MS);
+    if (!lock.isHeld() || stopRequested()) {
+      continue;
+    }
+
+    if (layoutChanged) {
+      layoutChanged = false;
+      const uint32_t key = computeLayoutKey();
+      if (key != layoutKey && !loadCursor(key)) {
+        resetCursor(key);
+      }
+    }
+
+    if (readerSectionPartial) {
+      if (indexSpineItem(readerSpineIndex) != BuildResult::PAUSED) {
+        readerSectionPartial = false;
+      } else {
+        pauseFor(lock);
+      }
+      continue;
+    }
+
+    if (remaining == 0) {
+      LOG_DBG("IDX", "All sections indexed");
+      PerfProfiler::logCpuResidency();
+      return;
+    }
+
+    const int spineIndex = nextSpineIndex;
+    const BuildResult result = indexSpineItem(spineIndex);
+    if (result == BuildResult::PAUSED) {
+      // Release the lock and continue this spine item from its checkpoint, once idle if someone was waiting for it
+      pauseFor(lock);
+      continue;
+    }
+    if (result == BuildResult::FAILED) {
+      LOG_ERR("IDX", "Failed to index spine item %d, skipping", spineIndex);
+    }
+
+    nextSpineIndex = static_cast<uint16_t>((nextSpineIndex + 1) % epub->getSpineItemsCount());
+    remaining--;
+    saveCursor();
+  }
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <Epub.h>
+
+#include <memory>
+
+#include "activities/Worker.h"
+
+class GfxRenderer;
+
+/**
+ * Builds the section cache (sections/<layout>/N.bin) for every spine item of the open book while the reader is idle, so
+ * that TOC and percent jumps into unindexed chapters don't stall on Section::createSectionFile.
+ *
+ * Each section is built while holding RenderLock, because layout shares the renderer, font caches and the book's CSS
+ * parser with the render task. A build is paused at the next text block boundary as soon as the render or main task
+ * wants the lock (see Section checkpoints) and continued once the reader has been idle again for IDLE_BEFORE_BUILD_MS.
+ * Progress is persisted to indexer.bin in the book's cache directory, so indexing resumes where it stopped after sleep
+ * or reopening the book.
+ *
+ * A spine item holding a whole book in one XHTML file is built in steps of at most STEP_PAGES pages, each ending in a
+ * checkpoint, with the lock released in between: the lock is never held for longer than a step, and sleep or a crash
+ * loses at most one step of work however the publisher structured the file.
+ */
+class EpubSectionIndexer final : public Worker {
+  std::shared_ptr<Epub> epub;
+  GfxRenderer& renderer;
+
+  // Written via setLayout() from the render task, read by the worker; both under RenderLock.
+  uint16_t viewportWidth = 0;
+  uint16_t viewportHeight = 0;
+  int readerSpineIndex = 0;
+  bool readerSectionPartial = false;
+  bool layoutChanged = false;
+
+  // Written by the main loop, read by the worker.
+  volatile unsigned long lastInteractionMs = 0;
+
+  // Worker cursor state, mirrored in indexer.bin. setLayout() compares layoutKey, under RenderLock.
+  uint32_t layoutKey = 0;
+  uint16_t nextSpineIndex = 0;
+  uint16_t remaining = 0;
+  // Layout time of the spine item being built, summed over its steps; not timed if the build began before this session
+  int timedSpineIndex = -1;
+  uint32_t timedBuildMs = 0;
+  bool timedFromStart = false;
+
+  enum class BuildResult : uint8_t { BUILT, PAUSED, FAILED };
+
+  uint32_t computeLayoutKey() const;
+  void resetCursor(uint32_t key);
+  bool loadCursor(uint32_t key);
+  void saveCursor() const;
+  // PAUSED when the build was checkpointed, because the lock is wanted or a step is done; calling again continues it
+  BuildResult indexSpineItem(int spineIndex);
+
+ protected:
+  void run() override;
+
+ public:
+  static constexpr unsigned long IDLE_BEFORE_BUILD_MS = 1500;
+  static constexpr int STEP_PAGES = 200;
+  static constexpr uint32_t STACK_SIZE = 8192;  // Same as the render task, which runs the same layout code
+
+  explicit EpubSectionIndexer(std::shared_ptr<Epub> epub, GfxRenderer& renderer)
+      : Worker("EpubSectionIndexer"), epub(std::move(epub)), renderer(renderer) {}
+  ~EpubSectionIndexer() override { stop(); }
+
+  // Called from render() with RenderLock held. Starts (or restarts) indexing for the given layout. A partially built
+  // current section (progressive open) is finished before any other.
+  void setLayout(uint16_t viewportWidth, uint16_t viewportHeight, int currentSpineIndex, bool currentSectionPartial);
+
+  // Called from loop() on user input; postpones the next build so page turns are never contended.
+  void notifyInteraction();
+};
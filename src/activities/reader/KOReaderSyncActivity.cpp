@@ -8,6 +8,7 @@
 
 #include "KOReaderCredentialStore.h"
 #include "KOReaderDocumentId.h"
+#include "KOReaderSyncJournal.h"
 #include "MappedInputManager.h"
 #include "activities/network/WifiSelectionActivity.h"
 #include "components/UITheme.h"
@@ -86,7 +87,7 @@ void KOReaderSyncActivity::performSync() {
   if (KOREADER_STORE.getMatchMethod() == DocumentMatchMethod::FILENAME) {
     documentHash = KOReaderDocumentId::calculateFromFilename(epubPath);
   } else {
-    documentHash = KOReaderDocumentId::calculate(epubPath);
+    documentHash = KOReaderDocumentId::calculate(epubPath, epub->getCachePath());
   }
   if (documentHash.empty()) {
     {
@@ -100,6 +101,10 @@ void KOReaderSyncActivity::performSync() {
 
   LOG_DBG("KOSync", "Document hash: %s", documentHash.c_str());
 
+  // This book is synced interactively below; send whatever else is queued while the radio is up
+  KOReaderSyncJournal::remove(documentHash);
+  KOReaderSyncJournal::flush();
+
   {
     RenderLock lock(*this);
     statusMessage = tr(STR_FETCH_PROGRESS);
@@ -136,7 +141,7 @@ void KOReaderSyncActivity::performSync() {
   remotePosition = ProgressMapper::toCrossPoint(epub, koPos, currentSpineIndex, totalPagesInSpine);
 
   // Calculate local progress in KOReader format (for display)
-  CrossPointPosition localPos = {currentSpineIndex, currentPage, totalPagesInSpine};
+  CrossPointPosition localPos = {currentSpineIndex, currentPage, totalPagesInSpine, currentSourceOffset};
   localProgress = ProgressMapper::toKOReader(epub, localPos);
 
   {
@@ -162,7 +167,7 @@ void KOReaderSyncActivity::performUpload() {
   requestUpdateAndWait();
 
   // Convert current position to KOReader format
-  CrossPointPosition localPos = {currentSpineIndex, currentPage, totalPagesInSpine};
+  CrossPointPosition localPos = {currentSpineIndex, currentPage, totalPagesInSpine, currentSourceOffset};
   KOReaderPosition koPos = ProgressMapper::toKOReader(epub, localPos);
 
   KOReaderProgress progress;
@@ -360,7 +365,7 @@ void KOReaderSyncActivity::loop() {
     if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
       if (selectedOption == 0) {
         // Wifi will be turned off in onExit()
-        setResult(SyncResult{remotePosition.spineIndex, remotePosition.pageNumber});
+        setResult(SyncResult{remotePosition.spineIndex, remotePosition.pageNumber, remotePosition.sourceOffset});
         finish();
       } else if (selectedOption == 1) {
         // Upload local progress
@@ -384,7 +389,7 @@ void KOReaderSyncActivity::loop() {
         if (KOREADER_STORE.getMatchMethod() == DocumentMatchMethod::FILENAME) {
           documentHash = KOReaderDocumentId::calculateFromFilename(epubPath);
         } else {
-          documentHash = KOReaderDocumentId::calculate(epubPath);
+          documentHash = KOReaderDocumentId::calculate(epubPath, epub->getCachePath());
         }
       }
       performUpload();
@@ -0,0 +1,206 @@
+#include "MarkdownReaderActivity.h"
+
+#include <Epub/Page.h>
+#include <FontCacheManager.h>
+#include <GfxRenderer.h>
+#include <HalStorage.h>
+#include <I18n.h>
+#include <Serialization.h>
+
+#include <algorithm>
+
+#include "CacheBudget.h"
+#include "CrossPointSettings.h"
+#include "CrossPointState.h"
+#include "MappedInputManager.h"
+#include "ReaderUtils.h"
+#include "RecentBooksStore.h"
+#include "SdReaderFont.h"
+#include "components/UITheme.h"
+#include "fontIds.h"
+
+void MarkdownReaderActivity::onEnter() {
+  Activity::onEnter();
+  SD_READER_FONT.sync(renderer);
+  // The first page clears what was on screen before
+  renderer.requestFullRefresh();
+
+  if (!txt) {
+    return;
+  }
+
+  ReaderUtils::applyOrientation(renderer, SETTINGS.orientation);
+
+  txt->setupCacheDir();
+
+  // Save current file as last opened file and add to recent books
+  auto filePath = txt->getPath();
+  auto fileName = filePath.substr(filePath.rfind('/') + 1);
+  APP_STATE.openEpubPath = filePath;
+  APP_STATE.saveToFile();
+  RECENT_BOOKS.addBook(filePath, fileName, "", "");
+
+  // Trigger first update
+  requestUpdate();
+}
+
+void MarkdownReaderActivity::onExit() {
+  Activity::onExit();
+
+  // Reset orientation back to portrait for the rest of the UI
+  renderer.setOrientation(GfxRenderer::Orientation::Portrait);
+
+  if (section) {
+    saveProgress(true);
+  }
+  progressJournal.close();
+  section.reset();
+  APP_STATE.readerActivityLoadCount = 0;
+  APP_STATE.saveToFile();
+  if (txt) {
+    CacheBudget::onBookClosed(txt->getCachePath());
+  }
+  txt.reset();
+  SD_READER_FONT.release(renderer);
+}
+
+void MarkdownReaderActivity::loop() {
+  // Long press BACK (1s+) goes to file selection
+  if (mappedInput.isPressed(MappedInputManager::Button::Back) && mappedInput.getHeldTime() >= ReaderUtils::GO_HOME_MS) {
+    activityManager.goToFileBrowser(txt ? txt->getPath() : "");
+    return;
+  }
+
+  // Short press BACK goes directly to home
+  if (mappedInput.wasReleased(MappedInputManager::Button::Back) &&
+      mappedInput.getHeldTime() < ReaderUtils::GO_HOME_MS) {
+    onGoHome();
+    return;
+  }
+
+  // The section is built by the first render
+  if (!initialized) {
+    return;
+  }
+
+  auto [prevTriggered, nextTriggered] = ReaderUtils::detectPageTurn(mappedInput);
+  if (!prevTriggered && !nextTriggered) {
+    return;
+  }
+
+  if (prevTriggered && section->currentPage > 0) {
+    section->currentPage--;
+    requestUpdate();
+  } else if (nextTriggered) {
+    if (section->currentPage < section->pageCount - 1) {
+      section->currentPage++;
+      requestUpdate();
+    } else {
+      onGoHome();
+    }
+  }
+}
+
+void MarkdownReaderActivity::initializeReader() {
+  // Same margins as the TXT reader
+  renderer.getOrientedViewableTRBL(&orientedMarginTop, &orientedMarginRight, &orientedMarginBottom,
+                                   &orientedMarginLeft);
+  orientedMarginTop += SETTINGS.screenMargin;
+  orientedMarginLeft += SETTINGS.screenMargin;
+  orientedMarginRight += SETTINGS.screenMargin;
+  orientedMarginBottom +=
+      std::max(SETTINGS.screenMargin, static_cast<uint8_t>(UITheme::getInstance().getStatusBarHeight()));
+
+  const uint16_t viewportWidth = renderer.getScreenWidth() - orientedMarginLeft - orientedMarginRight;
+  const uint16_t viewportHeight = renderer.getScreenHeight() - orientedMarginTop - orientedMarginBottom;
+
+  section = std::make_unique<MarkdownSection>(txt->getPath(), txt->getCachePath(), renderer);
+  const auto fileSize = static_cast<uint32_t>(txt->getFileSize());
+  if (!section->loadSectionFile(fileSize, SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                                SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
+                                viewportHeight, SETTINGS.hyphenationEnabled)) {
+    LOG_DBG("MDR", "Cache not found, building...");
+    const auto popupFn = [this]() { GUI.drawPopup(renderer, tr(STR_INDEXING)); };
+    if (!section->createSectionFile(fileSize, SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                                    SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
+                                    viewportHeight, SETTINGS.hyphenationEnabled, popupFn)) {
+      LOG_ERR("MDR", "Failed to lay out Markdown file");
+    }
+  }
+
+  loadProgress();
+  initialized = true;
+}
+
+void MarkdownReaderActivity::render(RenderLock&&) {
+  if (!txt) {
+    return;
+  }
+
+  if (!initialized) {
+    initializeReader();
+  }
+
+  const auto page = section->loadPageFromSectionFile();
+  if (!page) {
+    renderer.clearScreen();
+    renderer.drawCenteredText(UI_12_FONT_ID, 300, tr(STR_EMPTY_FILE), true, EpdFontFamily::BOLD);
+    renderer.displayBuffer();
+    return;
+  }
+
+  renderer.clearScreen();
+  renderPage(*page);
+
+  saveProgress();
+}
+
+void MarkdownReaderActivity::renderPage(const Page& page) {
+  const int fontId = SETTINGS.getReaderFontId();
+
+  // Font prewarm: scan pass accumulates text, then prewarm, then real render
+  auto* fcm = renderer.getFontCacheManager();
+  auto scope = fcm->createPrewarmScope();
+  page.render(renderer, fontId, orientedMarginLeft, orientedMarginTop);  // scan pass
+  scope.endScanAndPrewarm();
+
+  // BW rendering
+  page.render(renderer, fontId, orientedMarginLeft, orientedMarginTop);
+  renderStatusBar();
+
+  ReaderUtils::displayWithRefreshCycle(renderer);
+
+  if (SETTINGS.textAntiAliasing) {
+    ReaderUtils::renderAntiAliased(
+        renderer, [&]() { page.render(renderer, fontId, orientedMarginLeft, orientedMarginTop); });
+  }
+  // scope destructor clears font cache via FontCacheManager
+}
+
+void MarkdownReaderActivity::renderStatusBar() const {
+  const int page = section->currentPage + 1;
+  const int pageCount = section->pageCount;
+  const float progress = pageCount > 0 ? page * 100.0f / pageCount : 0;
+
+  std::string title;
+  if (SETTINGS.statusBarTitle != CrossPointSettings::STATUS_BAR_TITLE::HIDE_TITLE) {
+    title = txt->getTitle();
+  }
+  GUI.drawStatusBar(renderer, progress, page, pageCount, title);
+}
+
+void MarkdownReaderActivity::saveProgress(const bool now) {
+  const auto page = static_cast<uint32_t>(section->currentPage);
+  // Debounced: only every few page turns reach the SD card
+  progressJournal.record(&page, sizeof(page), now);
+}
+
+void MarkdownReaderActivity::loadProgress() {
+  uint32_t page = 0;
+  if (progressJournal.open(txt->getCachePath(), &page, sizeof(page)) != sizeof(page)) {
+    return;
+  }
+  // The page count changes with the layout; keep the saved page in range
+  section->currentPage = section->pageCount > 0 ? std::min<int>(page, section->pageCount - 1) : 0;
+  LOG_DBG("MDR", "Loaded progress: page %u", page);
+}
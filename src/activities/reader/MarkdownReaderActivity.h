@@ -0,0 +1,37 @@
+#pragma once
+
+#include <Epub/MarkdownSection.h>
+#include <Txt.h>
+
+#include <memory>
+
+#include "ProgressJournal.h"
+#include "activities/Activity.h"
+
+class MarkdownReaderActivity final : public Activity {
+  std::unique_ptr<Txt> txt;
+  std::unique_ptr<MarkdownSection> section;
+  ProgressJournal progressJournal;
+
+  bool initialized = false;
+
+  int orientedMarginTop = 0;
+  int orientedMarginRight = 0;
+  int orientedMarginBottom = 0;
+  int orientedMarginLeft = 0;
+
+  void initializeReader();
+  void renderPage(const Page& page);
+  void renderStatusBar() const;
+  void saveProgress(bool now = false);
+  void loadProgress();
+
+ public:
+  explicit MarkdownReaderActivity(GfxRenderer& renderer, MappedInputManager& mappedInput, std::unique_ptr<Txt> txt)
+      : Activity("MarkdownReader", renderer, mappedInput), txt(std::move(txt)) {}
+  void onEnter() override;
+  void onExit() override;
+  void loop() override;
+  void render(RenderLock&&) override;
+  bool isReaderActivity() const override { return true; }
+};
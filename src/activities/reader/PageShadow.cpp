@@ -0,0 +1,83 @@
+#include "PageShadow.h"
+
+#include <FramePackBits.h>
+#include <Logging.h>
+#include <MemoryBudget.h>
+
+#include <cstdlib>
+#include <cstring>
+
+PageShadow::PageShadow() {
+  MemoryBudget::registerCache(this, "page shadow", MemoryBudget::EVICT_FIRST, [this] {
+    if (empty()) {
+      return false;
+    }
+    clear();
+    return true;
+  });
+}
+
+PageShadow::~PageShadow() {
+  MemoryBudget::unregisterCache(this);
+  clear();
+}
+
+bool PageShadow::capture(const Key& frameKey, const uint8_t* frame, const size_t size, const uint16_t frameRowBytes,
+                         const bool walkByColumns) {
+  clear();
+  if (frameRowBytes == 0 || size % frameRowBytes != 0) {
+    return false;
+  }
+  const size_t capacity = size / 2;
+  auto* out = static_cast<uint8_t*>(malloc(capacity));
+  if (!out) {
+    LOG_DBG("PSH", "No memory for a %zu byte page shadow", capacity);
+    return false;
+  }
+
+  size_t used = 0;
+  const bool fits =
+      FramePackBits(size, frameRowBytes, walkByColumns).encode(frame, [&](const uint8_t* packet, const size_t length) {
+        if (used + length > capacity) return false;
+        memcpy(out + used, packet, length);
+        used += length;
+        return true;
+      });
+  if (!fits) {
+    free(out);
+    LOG_DBG("PSH", "Page does not compress to %zu bytes, no shadow", capacity);
+    return false;
+  }
+
+  // Shrinks in place, the rest of the half frame goes back to the heap
+  auto* shrunk = static_cast<uint8_t*>(realloc(out, used));
+  data = shrunk ? shrunk : out;
+  dataSize = used;
+  frameSize = size;
+  rowBytes = frameRowBytes;
+  byColumns = walkByColumns;
+  key = frameKey;
+  LOG_DBG("PSH", "Page shadow of %zu bytes", used);
+  return true;
+}
+
+bool PageShadow::take(const Key& frameKey, uint8_t* frame, const size_t size) {
+  if (!data || !(key == frameKey) || size != frameSize) {
+    clear();
+    return false;
+  }
+
+  const size_t decoded = FramePackBits(size, rowBytes, byColumns).decode(data, dataSize, frame, 0);
+  clear();
+  if (decoded != size) {
+    LOG_ERR("PSH", "Page shadow is corrupt");
+    return false;
+  }
+  return true;
+}
+
+void PageShadow::clear() {
+  free(data);
+  data = nullptr;
+  dataSize = 0;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * The black and white frame of the page after the one on screen, rendered ahead while the reader waits for the next
+ * turn and kept PackBits compressed, so that turn is a decompress and a refresh.
+ *
+ * See FramePackBits for walking the frame by panel columns. A frame that doesn't compress to half its size is not
+ * kept.
+ * Registered with MemoryBudget, which drops it when a large allocation needs room: it is only a head start on a turn.
+ * Not thread-safe: only use it with RenderLock held.
+ */
+class PageShadow {
+ public:
+  // What the frame was rendered for; a shadow is only shown for the same page of the same layout and status bar
+  struct Key {
+    int spineIndex;
+    int page;
+    int pageCount;
+    uint32_t layoutStamp;
+    bool autoPageTurn;
+    bool operator==(const Key& other) const {
+      return spineIndex == other.spineIndex && page == other.page && pageCount == other.pageCount &&
+             layoutStamp == other.layoutStamp && autoPageTurn == other.autoPageTurn;
+    }
+  };
+
+  PageShadow();
+  PageShadow(const PageShadow&) = delete;
+  PageShadow& operator=(const PageShadow&) = delete;
+  ~PageShadow();
+
+  // Compresses a frame of rowBytes wide rows as the page of key, replacing the one kept. False, keeping none, if it
+  // doesn't compress to half its size or there is no memory for it.
+  bool capture(const Key& key, const uint8_t* frame, size_t size, uint16_t rowBytes, bool byColumns);
+  // Decompresses the kept frame into frame if it is the page of key. The shadow is used up either way; frame is only
+  // written to when the key matches, and holds a partial page if the data turns out to be corrupt.
+  bool take(const Key& key, uint8_t* frame, size_t size);
+  void clear();
+  bool empty() const { return data == nullptr; }
+
+ private:
+  Key key = {};
+  uint8_t* data = nullptr;
+  size_t dataSize = 0;
+  size_t frameSize = 0;
+  uint16_t rowBytes = 0;
+  bool byColumns = false;
+};
@@ -0,0 +1,147 @@
+#include "ProgressJournal.h"
+
+#include <HalStorage.h>
+#include <Logging.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+namespace {
+constexpr size_t SLOT_COUNT = 32;
+// Page turns between appends; at most this many pages are lost on a power cut while reading
+constexpr uint8_t APPEND_INTERVAL = 4;
+
+struct Slot {
+  uint16_t sequence;  // 0 marks an empty slot
+  uint8_t size;
+  uint8_t data[ProgressJournal::MAX_POSITION_SIZE];
+  uint8_t check;
+};
+static_assert(sizeof(Slot) == 16, "Slot is part of the journal file format");
+
+// FNV-1a over the slot before the check byte, folded to 8 bits
+uint8_t checkOf(const Slot& slot) {
+  const auto* bytes = reinterpret_cast<const uint8_t*>(&slot);
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < offsetof(Slot, check); i++) {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+  return static_cast<uint8_t>(hash ^ (hash >> 8) ^ (hash >> 16) ^ (hash >> 24));
+}
+}  // namespace
+
+size_t ProgressJournal::open(const std::string& cacheDir, void* data, const size_t capacity) {
+  progressPath = cacheDir + "/progress.bin";
+  journalPath = cacheDir + "/progress.log";
+  positionSize = 0;
+  pendingChanges = 0;
+  nextSlot = 0;
+  sequence = 0;
+  journalReady = false;
+
+  FsFile file;
+  if (Storage.openFileForRead("PGJ", progressPath, file)) {
+    positionSize = static_cast<uint8_t>(std::max(file.read(position, sizeof(position)), 0));
+    file.close();
+  }
+
+  // Left behind when the reader was not closed properly; its newest valid slot is later than progress.bin
+  if (Storage.exists(journalPath.c_str()) && Storage.openFileForRead("PGJ", journalPath, file)) {
+    bool replayed = false;
+    Slot slot;
+    while (file.read(&slot, sizeof(slot)) == sizeof(slot)) {
+      if (slot.sequence == 0 || slot.size == 0 || slot.size > MAX_POSITION_SIZE || slot.check != checkOf(slot)) {
+        continue;
+      }
+      if (!replayed || static_cast<int16_t>(slot.sequence - sequence) > 0) {
+        sequence = slot.sequence;
+        positionSize = slot.size;
+        memcpy(position, slot.data, slot.size);
+        replayed = true;
+      }
+    }
+    file.close();
+    if (replayed) {
+      LOG_DBG("PGJ", "Replayed progress journal up to #%u", sequence);
+      writeProgressFile();
+    }
+    sequence = 0;
+  }
+
+  // Created at full size now, so appends while reading only overwrite slots
+  if (Storage.openFileForWrite("PGJ", journalPath, file)) {
+    const Slot empty = {};
+    journalReady = true;
+    for (size_t i = 0; i < SLOT_COUNT && journalReady; i++) {
+      journalReady = file.write(&empty, sizeof(empty)) == sizeof(empty);
+    }
+    file.close();
+  }
+
+  const size_t size = std::min<size_t>(positionSize, capacity);
+  memcpy(data, position, size);
+  return size;
+}
+
+bool ProgressJournal::record(const void* data, const size_t size, const bool appendNow) {
+  if (size == 0 || size > MAX_POSITION_SIZE) {
+    return false;
+  }
+  if (size != positionSize || memcmp(position, data, size) != 0) {
+    memcpy(position, data, size);
+    positionSize = static_cast<uint8_t>(size);
+    pendingChanges++;
+  }
+  if (pendingChanges == 0 || (!appendNow && pendingChanges < APPEND_INTERVAL)) {
+    return false;
+  }
+  return append();
+}
+
+bool ProgressJournal::append() {
+  pendingChanges = 0;
+  if (!journalReady) {
+    // No journal to append to; fall back to rewriting the progress file
+    return writeProgressFile();
+  }
+
+  Slot slot = {};
+  sequence = sequence == UINT16_MAX ? 1 : sequence + 1;
+  slot.sequence = sequence;
+  slot.size = positionSize;
+  memcpy(slot.data, position, positionSize);
+  slot.check = checkOf(slot);
+
+  auto file = Storage.open(journalPath.c_str(), O_RDWR);
+  const bool ok = file && file.seek(nextSlot * sizeof(Slot)) && file.write(&slot, sizeof(slot)) == sizeof(slot);
+  nextSlot = (nextSlot + 1) % SLOT_COUNT;
+  if (!ok) {
+    LOG_ERR("PGJ", "Could not append to progress journal");
+  }
+  return ok;
+}
+
+bool ProgressJournal::writeProgressFile() const {
+  FsFile file;
+  if (!Storage.openFileForWrite("PGJ", progressPath, file) || file.write(position, positionSize) != positionSize) {
+    LOG_ERR("PGJ", "Could not save progress!");
+    return false;
+  }
+  return true;
+}
+
+bool ProgressJournal::close() {
+  if (progressPath.empty()) {
+    return false;
+  }
+  const bool saved = positionSize == 0 || writeProgressFile();
+  // Kept if progress.bin could not be written, the next open() replays it
+  if (saved && Storage.exists(journalPath.c_str())) {
+    Storage.remove(journalPath.c_str());
+  }
+  progressPath.clear();
+  journalPath.clear();
+  journalReady = false;
+  return saved;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * A book's reading position, saved as progress.bin in its cache directory with an append-only journal
+ * (progress.log) in front of it.
+ *
+ * Page turns only update the position in memory. Every few changes it is appended to the journal as one small slot.
+ * open() creates the journal at its full size, so these writes on the render path go into clusters the file already
+ * has and never create, truncate or grow a file. close() compacts: the latest position goes to progress.bin and the
+ * journal is removed. A journal left behind by a crash or power loss is replayed by the next open().
+ *
+ * The position itself is opaque, each reader keeps its own progress.bin layout.
+ */
+class ProgressJournal {
+ public:
+  static constexpr size_t MAX_POSITION_SIZE = 12;
+
+  // Loads the latest saved position into data and returns its size, 0 if there is none
+  size_t open(const std::string& cacheDir, void* data, size_t capacity);
+
+  // Takes the current position. Returns true when this call wrote it to the journal, which happens every few changes,
+  // or right away with appendNow if it differs from the last one written.
+  bool record(const void* data, size_t size, bool appendNow = false);
+
+  // Writes the latest position to progress.bin and removes the journal
+  bool close();
+
+ private:
+  bool append();
+  bool writeProgressFile() const;
+
+  std::string progressPath;
+  std::string journalPath;
+  uint8_t position[MAX_POSITION_SIZE] = {};
+  uint8_t positionSize = 0;
+  uint8_t pendingChanges = 0;
+  uint8_t nextSlot = 0;
+  uint16_t sequence = 0;
+  bool journalReady = false;
+};
@@ -3,9 +3,13 @@
 #include <FsHelpers.h>
 #include <HalStorage.h>
 
+#include "Cbz.h"
+#include "CbzReaderActivity.h"
 #include "CrossPointSettings.h"
 #include "Epub.h"
 #include "EpubReaderActivity.h"
+#include "MarkdownReaderActivity.h"
+#include "ResumeSnapshot.h"
 #include "Txt.h"
 #include "TxtReaderActivity.h"
 #include "Xtc.h"
@@ -15,13 +19,14 @@
 
 bool ReaderActivity::isXtcFile(const std::string& path) { return FsHelpers::hasXtcExtension(path); }
 
-bool ReaderActivity::isTxtFile(const std::string& path) {
-  return FsHelpers::hasTxtExtension(path) ||
-         FsHelpers::hasMarkdownExtension(path);  // Treat .md as txt files (until we have a markdown reader)
-}
+bool ReaderActivity::isTxtFile(const std::string& path) { return FsHelpers::hasTxtExtension(path); }
+
+bool ReaderActivity::isMarkdownFile(const std::string& path) { return FsHelpers::hasMarkdownExtension(path); }
 
 bool ReaderActivity::isBmpFile(const std::string& path) { return FsHelpers::hasBmpExtension(path); }
 
+bool ReaderActivity::isCbzFile(const std::string& path) { return FsHelpers::hasCbzExtension(path); }
+
 std::unique_ptr<Epub> ReaderActivity::loadEpub(const std::string& path) {
   if (!Storage.exists(path.c_str())) {
     LOG_ERR("READER", "File does not exist: %s", path.c_str());
@@ -29,7 +34,7 @@ std::unique_ptr<Epub> ReaderActivity::loadEpub(const std::string& path) {
   }
 
   auto epub = std::unique_ptr<Epub>(new Epub(path, "/.crosspoint"));
-  if (epub->load(true, SETTINGS.embeddedStyle == 0)) {
+  if (epub->load(true)) {
     return epub;
   }
 
@@ -67,6 +72,21 @@ std::unique_ptr<Txt> ReaderActivity::loadTxt(const std::string& path) {
   return nullptr;
 }
 
+std::unique_ptr<Cbz> ReaderActivity::loadCbz(const std::string& path) {
+  if (!Storage.exists(path.c_str())) {
+    LOG_ERR("READER", "File does not exist: %s", path.c_str());
+    return nullptr;
+  }
+
+  auto cbz = std::unique_ptr<Cbz>(new Cbz(path, "/.crosspoint"));
+  if (cbz->load()) {
+    return cbz;
+  }
+
+  LOG_ERR("READER", "Failed to load CBZ");
+  return nullptr;
+}
+
 void ReaderActivity::goToLibrary(const std::string& fromBookPath) {
   // If coming from a book, start in that book's folder; otherwise start from root
   auto initialPath = fromBookPath.empty() ? "/" : FsHelpers::extractFolderPath(fromBookPath);
@@ -95,6 +115,18 @@ void ReaderActivity::onGoToTxtReader(std::unique_ptr<Txt> txt) {
   activityManager.replaceActivity(std::make_unique<TxtReaderActivity>(renderer, mappedInput, std::move(txt)));
 }
 
+void ReaderActivity::onGoToMarkdownReader(std::unique_ptr<Txt> txt) {
+  const auto mdPath = txt->getPath();
+  currentBookPath = mdPath;
+  activityManager.replaceActivity(std::make_unique<MarkdownReaderActivity>(renderer, mappedInput, std::move(txt)));
+}
+
+void ReaderActivity::onGoToCbzReader(std::unique_ptr<Cbz> cbz) {
+  const auto cbzPath = cbz->getPath();
+  currentBookPath = cbzPath;
+  activityManager.replaceActivity(std::make_unique<CbzReaderActivity>(renderer, mappedInput, std::move(cbz)));
+}
+
 void ReaderActivity::onEnter() {
   Activity::onEnter();
 
@@ -120,9 +152,32 @@ void ReaderActivity::onEnter() {
       return;
     }
     onGoToTxtReader(std::move(txt));
+  } else if (isMarkdownFile(initialBookPath)) {
+    // Markdown files share the TXT loader; only the reader differs
+    auto txt = loadTxt(initialBookPath);
+    if (!txt) {
+      onGoBack();
+      return;
+    }
+    onGoToMarkdownReader(std::move(txt));
+  } else if (isCbzFile(initialBookPath)) {
+    auto cbz = loadCbz(initialBookPath);
+    if (!cbz) {
+      onGoBack();
+      return;
+    }
+    onGoToCbzReader(std::move(cbz));
   } else {
+    // A book of the warm set puts its last page up before it is loaded; waking into the reader did so already
+    if (!ResumeSnapshot::isPageShown()) {
+      RenderLock lock(*this);
+      ResumeSnapshot::show(renderer, initialBookPath);
+    }
     auto epub = loadEpub(initialBookPath);
     if (!epub) {
+      if (ResumeSnapshot::takePageShown()) {
+        renderer.setOrientation(GfxRenderer::Orientation::Portrait);
+      }
       onGoBack();
       return;
     }
@@ -4,6 +4,7 @@
 #include "../Activity.h"
 #include "activities/home/FileBrowserActivity.h"
 
+class Cbz;
 class Epub;
 class Xtc;
 class Txt;
@@ -14,14 +15,19 @@ class ReaderActivity final : public Activity {
   static std::unique_ptr<Epub> loadEpub(const std::string& path);
   static std::unique_ptr<Xtc> loadXtc(const std::string& path);
   static std::unique_ptr<Txt> loadTxt(const std::string& path);
+  static std::unique_ptr<Cbz> loadCbz(const std::string& path);
   static bool isXtcFile(const std::string& path);
   static bool isTxtFile(const std::string& path);
+  static bool isMarkdownFile(const std::string& path);
   static bool isBmpFile(const std::string& path);
+  static bool isCbzFile(const std::string& path);
 
   void goToLibrary(const std::string& fromBookPath = "");
   void onGoToEpubReader(std::unique_ptr<Epub> epub);
   void onGoToXtcReader(std::unique_ptr<Xtc> xtc);
   void onGoToTxtReader(std::unique_ptr<Txt> txt);
+  void onGoToMarkdownReader(std::unique_ptr<Txt> txt);
+  void onGoToCbzReader(std::unique_ptr<Cbz> cbz);
   void onGoToBmpViewer(const std::string& path);
 
   void onGoBack();
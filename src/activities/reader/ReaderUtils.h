@@ -4,7 +4,10 @@
 #include <GfxRenderer.h>
 #include <Logging.h>
 
+#include <algorithm>
+
 #include "MappedInputManager.h"
+#include "components/UITheme.h"
 
 namespace ReaderUtils {
 
@@ -29,6 +32,37 @@ inline void applyOrientation(GfxRenderer& renderer, const uint8_t orientation) {
   }
 }
 
+struct Margins {
+  int top;
+  int right;
+  int bottom;
+  int left;
+};
+
+// Page margins of the EPUB reader in the renderer's current orientation. Section caches are keyed on the viewport
+// these give, so anything laying out chapters ahead of the reader must use them too. Only the sums of opposite margins
+// size the viewport, and those don't change when the device is turned 180 degrees, so mirrored orientations share
+// their caches. reserveTurnIndicator leaves room for the automatic page turn indicator when the status bar does not
+// already.
+inline Margins getEpubMargins(const GfxRenderer& renderer, const bool reserveTurnIndicator) {
+  Margins margins{};
+  renderer.getOrientedViewableTRBL(&margins.top, &margins.right, &margins.bottom, &margins.left);
+  margins.top += SETTINGS.screenMargin;
+  margins.left += SETTINGS.screenMargin;
+  margins.right += SETTINGS.screenMargin;
+
+  const uint8_t statusBarHeight = UITheme::getInstance().getStatusBarHeight();
+  if (reserveTurnIndicator &&
+      (statusBarHeight == 0 || statusBarHeight == UITheme::getInstance().getProgressBarHeight())) {
+    margins.bottom +=
+        std::max(SETTINGS.screenMargin,
+                 static_cast<uint8_t>(statusBarHeight + UITheme::getInstance().getMetrics().statusBarVerticalMargin));
+  } else {
+    margins.bottom += std::max(SETTINGS.screenMargin, statusBarHeight);
+  }
+  return margins;
+}
+
 struct PageTurnResult {
   bool prev;
   bool next;
@@ -49,14 +83,8 @@ inline PageTurnResult detectPageTurn(const MappedInputManager& input) {
   return {prev, next};
 }
 
-inline void displayWithRefreshCycle(const GfxRenderer& renderer, int& pagesUntilFullRefresh) {
-  if (pagesUntilFullRefresh <= 1) {
-    renderer.displayBuffer(HalDisplay::HALF_REFRESH);
-    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
-  } else {
-    renderer.displayBuffer();
-    pagesUntilFullRefresh--;
-  }
+inline void displayWithRefreshCycle(const GfxRenderer& renderer) {
+  renderer.displayPage(SETTINGS.getRefreshFrequency());
 }
 
 // Grayscale anti-aliasing pass. Renders content twice (LSB + MSB) to build
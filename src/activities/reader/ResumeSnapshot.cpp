@@ -0,0 +1,141 @@
+#include "ResumeSnapshot.h"
+
+#include <Epub/Page.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "CrossPointSettings.h"
+#include "ReaderUtils.h"
+#include "SdReaderFont.h"
+
+namespace {
+constexpr uint8_t SNAPSHOT_FILE_VERSION = 3;
+constexpr char SNAPSHOT_FILE[] = "/.crosspoint/resume.bin";
+// Books in the warm set, the one left last first
+constexpr size_t WARM_BOOK_COUNT = 3;
+
+bool pageShown = false;
+
+void readSnapshot(FsFile& file, ResumeSnapshot::Snapshot& snapshot) {
+  serialization::readString(file, snapshot.bookPath);
+  serialization::readString(file, snapshot.sectionPath);
+  serialization::readPod(file, snapshot.sectionSize);
+  serialization::readPod(file, snapshot.pagePos);
+  serialization::readPod(file, snapshot.pageEnd);
+  serialization::readPod(file, snapshot.fontId);
+  serialization::readPod(file, snapshot.orientation);
+  serialization::readPod(file, snapshot.marginLeft);
+  serialization::readPod(file, snapshot.marginTop);
+}
+
+void writeSnapshot(FsFile& file, const ResumeSnapshot::Snapshot& snapshot) {
+  serialization::writeString(file, snapshot.bookPath);
+  serialization::writeString(file, snapshot.sectionPath);
+  serialization::writePod(file, snapshot.sectionSize);
+  serialization::writePod(file, snapshot.pagePos);
+  serialization::writePod(file, snapshot.pageEnd);
+  serialization::writePod(file, snapshot.fontId);
+  serialization::writePod(file, snapshot.orientation);
+  serialization::writePod(file, snapshot.marginLeft);
+  serialization::writePod(file, snapshot.marginTop);
+}
+
+bool load(std::vector<ResumeSnapshot::Snapshot>& snapshots) {
+  FsFile file;
+  if (!Storage.exists(SNAPSHOT_FILE) || !Storage.openFileForRead("RSN", SNAPSHOT_FILE, file)) {
+    return false;
+  }
+  uint8_t version = 0;
+  serialization::readPod(file, version);
+  if (version != SNAPSHOT_FILE_VERSION) {
+    return false;
+  }
+  uint8_t count = 0;
+  serialization::readPod(file, count);
+  snapshots.resize(std::min<size_t>(count, WARM_BOOK_COUNT));
+  for (auto& snapshot : snapshots) {
+    readSnapshot(file, snapshot);
+  }
+  return true;
+}
+}  // namespace
+
+bool ResumeSnapshot::save(const Snapshot& snapshot) {
+  std::vector<Snapshot> snapshots;
+  load(snapshots);
+  snapshots.erase(std::remove_if(snapshots.begin(), snapshots.end(),
+                                 [&snapshot](const Snapshot& other) { return other.bookPath == snapshot.bookPath; }),
+                  snapshots.end());
+  snapshots.insert(snapshots.begin(), snapshot);
+  if (snapshots.size() > WARM_BOOK_COUNT) {
+    snapshots.resize(WARM_BOOK_COUNT);
+  }
+
+  FsFile file;
+  if (!Storage.openFileForWrite("RSN", SNAPSHOT_FILE, file)) {
+    return false;
+  }
+  serialization::writePod(file, SNAPSHOT_FILE_VERSION);
+  serialization::writePod(file, static_cast<uint8_t>(snapshots.size()));
+  for (const auto& warm : snapshots) {
+    writeSnapshot(file, warm);
+  }
+  return true;
+}
+
+bool ResumeSnapshot::show(GfxRenderer& renderer, const std::string& bookPath) {
+  const unsigned long start = millis();
+  std::vector<Snapshot> snapshots;
+  if (!load(snapshots)) {
+    return false;
+  }
+  const auto it = std::find_if(snapshots.begin(), snapshots.end(),
+                               [&bookPath](const Snapshot& snapshot) { return snapshot.bookPath == bookPath; });
+  if (it == snapshots.end() || it->orientation != SETTINGS.orientation) {
+    return false;
+  }
+  const Snapshot& snapshot = *it;
+
+  FsFile section;
+  if (!Storage.openFileForRead("RSN", snapshot.sectionPath, section) || section.size() != snapshot.sectionSize ||
+      snapshot.pageEnd <= snapshot.pagePos || snapshot.pageEnd > snapshot.sectionSize) {
+    LOG_DBG("RSN", "Section file changed since the snapshot");
+    return false;
+  }
+
+  // The font settings may have changed since, and a font on the SD card has to be loaded first
+  SD_READER_FONT.sync(renderer);
+  if (snapshot.fontId != SETTINGS.getReaderFontId() || !renderer.resolveFont(snapshot.fontId).family) {
+    return false;
+  }
+
+  section.seek(snapshot.pagePos);
+  const auto page = Page::deserialize(section, snapshot.pageEnd - snapshot.pagePos);
+  section.close();
+  if (!page) {
+    return false;
+  }
+
+  ReaderUtils::applyOrientation(renderer, snapshot.orientation);
+  renderer.clearScreen();
+  page->render(renderer, snapshot.fontId, snapshot.marginLeft, snapshot.marginTop);
+  // Clears the sleep screen
+  renderer.displayBuffer(HalDisplay::HALF_REFRESH);
+  pageShown = true;
+  LOG_DBG("RSN", "Restored last page in %lu ms", millis() - start);
+  return true;
+}
+
+bool ResumeSnapshot::takePageShown() {
+  const bool shown = pageShown;
+  pageShown = false;
+  return shown;
+}
+
+bool ResumeSnapshot::isPageShown() { return pageShown; }
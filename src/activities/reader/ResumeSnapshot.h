@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+class GfxRenderer;
+
+/**
+ * The page the EPUB reader showed last in each of the few books read most recently, saved when the reader is left.
+ * Waking from sleep into the reader, or opening one of those books again, puts that page straight back on screen from
+ * its section file record, before the book, the reader and (when waking) the rest of the UI are loaded; the reader
+ * then redraws it with the status bar using a fast refresh. Switching back and forth between two or three books so
+ * shows each one at once.
+ */
+namespace ResumeSnapshot {
+
+struct Snapshot {
+  std::string bookPath;
+  std::string sectionPath;
+  uint32_t sectionSize = 0;  // Guards against a section file rebuilt since
+  uint32_t pagePos = 0;
+  uint32_t pageEnd = 0;
+  int fontId = 0;
+  uint8_t orientation = 0;  // CrossPointSettings::ORIENTATION the page was laid out for
+  int16_t marginLeft = 0;
+  int16_t marginTop = 0;
+};
+
+// Makes the snapshot the book's, and its book the most recent of the warm set
+bool save(const Snapshot& snapshot);
+
+// Renders the saved page if it belongs to bookPath and the reader settings still match; returns whether it did.
+// Call after the settings are loaded and the fonts set up.
+bool show(GfxRenderer& renderer, const std::string& bookPath);
+
+// True once after show() succeeded, so the reader's first frame does not need a half refresh
+bool takePageShown();
+// Whether a page show() put up is still waiting for the reader, without taking it
+bool isPageShown();
+
+}  // namespace ResumeSnapshot
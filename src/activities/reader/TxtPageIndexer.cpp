@@ -0,0 +1,34 @@
+#include "TxtPageIndexer.h"
+
+#include <HalPowerManager.h>
+#include <Logging.h>
+
+#include "TxtReaderActivity.h"
+#include "activities/RenderLock.h"
+
+namespace {
+constexpr unsigned long POLL_MS = 250;
+constexpr unsigned long LOCK_TIMEOUT_MS = 100;
+}  // namespace
+
+void TxtPageIndexer::notifyInteraction() { lastInteractionMs = millis(); }
+
+void TxtPageIndexer::run() {
+  while (!stopRequested()) {
+    if (millis() - lastInteractionMs < IDLE_BEFORE_BUILD_MS) {
+      sleepFor(POLL_MS);
+      continue;
+    }
+
+    RenderLock lock(LOCK_TIMEOUT_MS);
+    if (!lock.isHeld() || stopRequested()) {
+      continue;
+    }
+
+    HalPowerManager::Lock powerLock;  // Don't get clocked down by idle power saving while laying out
+    if (reader.indexMorePages([this]() { return shouldYield(); })) {
+      LOG_DBG("TRS", "Page index complete");
+      return;
+    }
+  }
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+
+#include "activities/Worker.h"
+
+class TxtReaderActivity;
+
+/**
+ * Lays out the pages of the open TXT file while the reader is idle, so that opening a long file (or reopening it after
+ * a font or margin change) shows the saved page right away instead of after laying out everything before it.
+ *
+ * Pages are laid out in batches while holding RenderLock, because layout measures text with the renderer's fonts. A
+ * batch ends at the next page as soon as the render or main task wants the lock, and indexing continues once the reader
+ * has been idle again for IDLE_BEFORE_BUILD_MS. The reader appends the offsets to index.bin as they come, so indexing
+ * resumes where it stopped after sleep or reopening the file.
+ */
+class TxtPageIndexer final : public Worker {
+  TxtReaderActivity& reader;
+
+  // Written by the main loop, read by the worker.
+  volatile unsigned long lastInteractionMs = 0;
+
+ protected:
+  void run() override;
+
+ public:
+  static constexpr unsigned long IDLE_BEFORE_BUILD_MS = 1000;
+  static constexpr uint32_t STACK_SIZE = 8192;  // Same as the render task, which runs the same layout code
+
+  explicit TxtPageIndexer(TxtReaderActivity& reader) : Worker("TxtPageIndexer"), reader(reader) {}
+  ~TxtPageIndexer() override { stop(); }
+
+  // Called from loop() on user input; postpones the next batch so page turns are never contended.
+  void notifyInteraction();
+};
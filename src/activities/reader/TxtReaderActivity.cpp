@@ -7,11 +7,15 @@
 #include <Serialization.h>
 #include <Utf8.h>
 
+#include <algorithm>
+
+#include "CacheBudget.h"
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
 #include "MappedInputManager.h"
 #include "ReaderUtils.h"
 #include "RecentBooksStore.h"
+#include "SdReaderFont.h"
 #include "components/UITheme.h"
 #include "fontIds.h"
 
@@ -19,11 +23,31 @@ namespace {
 constexpr size_t CHUNK_SIZE = 8 * 1024;  // 8KB chunk for reading
 // Cache file magic and version
 constexpr uint32_t CACHE_MAGIC = 0x54585449;  // "TXTI"
-constexpr uint8_t CACHE_VERSION = 2;          // Increment when cache format changes
+constexpr uint8_t CACHE_VERSION = 3;          // Increment when cache format changes
+// magic, version, file size, viewport width, lines per page, font ID, screen margin, alignment
+constexpr size_t CACHE_COMPLETE_FLAG_POS = 4 + 1 + 4 + 4 + 4 + 4 + 4 + 1;
+constexpr size_t CACHE_HEADER_SIZE = CACHE_COMPLETE_FLAG_POS + 1;
+constexpr size_t CACHE_APPEND_PAGES = 64;      // Page offsets laid out before they are appended to the cache file
+constexpr size_t ESTIMATED_PAGE_BYTES = 2048;  // For sizing the page index before it is built
+constexpr size_t MIN_CHECKPOINT_STRIDE = 16;
+
+// Smallest power of two whose square covers the estimated page count, so that both the checkpoints and a window of
+// page offsets take O(sqrt n) memory
+size_t checkpointStrideFor(const size_t fileSize) {
+  const size_t estimatedPages = fileSize / ESTIMATED_PAGE_BYTES + 1;
+  size_t stride = MIN_CHECKPOINT_STRIDE;
+  while (stride * stride < estimatedPages) {
+    stride *= 2;
+  }
+  return stride;
+}
 }  // namespace
 
 void TxtReaderActivity::onEnter() {
   Activity::onEnter();
+  SD_READER_FONT.sync(renderer);
+  // The first page clears what was on screen before
+  renderer.requestFullRefresh();
 
   if (!txt) {
     return;
@@ -40,6 +64,9 @@ void TxtReaderActivity::onEnter() {
   APP_STATE.saveToFile();
   RECENT_BOOKS.addBook(filePath, fileName, "", "");
 
+  // Started from render() once the layout is known
+  indexer = std::make_unique<TxtPageIndexer>(*this);
+
   // Trigger first update
   requestUpdate();
 }
@@ -50,14 +77,33 @@ void TxtReaderActivity::onExit() {
   // Reset orientation back to portrait for the rest of the UI
   renderer.setOrientation(GfxRenderer::Orientation::Portrait);
 
-  pageOffsets.clear();
+  if (indexer) {
+    indexer->stop();
+    indexer.reset();
+  }
+  if (initialized) {
+    saveProgress(true);
+  }
+  progressJournal.close();
+  checkpoints.clear();
+  unsavedOffsets.clear();
+  windowOffsets.clear();
   currentPageLines.clear();
   APP_STATE.readerActivityLoadCount = 0;
   APP_STATE.saveToFile();
+  if (txt) {
+    CacheBudget::onBookClosed(txt->getCachePath());
+  }
   txt.reset();
+  SD_READER_FONT.release(renderer);
 }
 
 void TxtReaderActivity::loop() {
+  // Keep background indexing out of the way while the user is interacting
+  if (indexer && (mappedInput.wasAnyPressed() || mappedInput.wasAnyReleased())) {
+    indexer->notifyInteraction();
+  }
+
   // Long press BACK (1s+) goes to file selection
   if (mappedInput.isPressed(MappedInputManager::Button::Back) && mappedInput.getHeldTime() >= ReaderUtils::GO_HOME_MS) {
     activityManager.goToFileBrowser(txt ? txt->getPath() : "");
@@ -76,12 +122,12 @@ void TxtReaderActivity::loop() {
     return;
   }
 
-  if (prevTriggered && currentPage > 0) {
-    currentPage--;
+  if (prevTriggered && (currentOffset > 0 || pendingPageTurns > 0)) {
+    pendingPageTurns--;
     requestUpdate();
   } else if (nextTriggered) {
-    if (currentPage < totalPages - 1) {
-      currentPage++;
+    if (currentPageEnd < txt->getFileSize() || pendingPageTurns < 0) {
+      pendingPageTurns++;
       requestUpdate();
     } else {
       onGoHome();
@@ -117,57 +163,149 @@ void TxtReaderActivity::initializeReader() {
 
   LOG_DBG("TRS", "Viewport: %dx%d, lines per page: %d", viewportWidth, viewportHeight, linesPerPage);
 
-  // Try to load cached page index first
+  // Continue the page index from its cache file, or start a new one; the indexer builds the rest in the background
+  checkpointStride = checkpointStrideFor(txt->getFileSize());
+  checkpoints.reserve(txt->getFileSize() / ESTIMATED_PAGE_BYTES / checkpointStride + 1);
+  unsavedOffsets.reserve(CACHE_APPEND_PAGES);
+  windowOffsets.reserve(checkpointStride);
   if (!loadPageIndexCache()) {
-    // Cache not found, build page index
-    buildPageIndex();
-    // Save to cache for next time
-    savePageIndexCache();
+    startPageIndexCache();
   }
 
   // Load saved progress
   loadProgress();
 
   initialized = true;
+  if (!indexComplete && indexer) {
+    indexer->start(TxtPageIndexer::STACK_SIZE);
+  }
 }
 
-void TxtReaderActivity::buildPageIndex() {
-  pageOffsets.clear();
-  pageOffsets.push_back(0);  // First page starts at offset 0
-
-  size_t offset = 0;
+bool TxtReaderActivity::indexMorePages(const std::function<bool()>& shouldStop) {
   const size_t fileSize = txt->getFileSize();
+  const bool wasComplete = indexComplete;
+  std::vector<std::string> tempLines;
+
+  while (!indexComplete && !shouldStop()) {
+    size_t nextOffset = indexFrontier;
+    if (indexFrontier >= fileSize || !loadPageAtOffset(indexFrontier, tempLines, nextOffset) ||
+        nextOffset <= indexFrontier) {
+      // End of file, or no progress made: stop rather than loop forever
+      indexComplete = true;
+      indexFrontier = fileSize;
+      break;
+    }
+
+    if (indexedPageCount % checkpointStride == 0) {
+      checkpoints.push_back(indexFrontier);
+    }
+    unsavedOffsets.push_back(indexFrontier);
+    indexedPageCount++;
+    indexFrontier = nextOffset;
+    if (unsavedOffsets.size() >= CACHE_APPEND_PAGES) {
+      appendPageIndexCache();
+    }
 
-  LOG_DBG("TRS", "Building page index for %zu bytes...", fileSize);
+    // Yield to other tasks periodically
+    if (indexedPageCount % 20 == 0) {
+      vTaskDelay(1);
+    }
+  }
+
+  if (!unsavedOffsets.empty() || indexComplete != wasComplete) {
+    appendPageIndexCache();
+  }
+  if (indexComplete && !wasComplete) {
+    LOG_DBG("TRS", "Built page index: %zu pages", indexedPageCount);
+  }
+  return indexComplete;
+}
 
+void TxtReaderActivity::indexThrough(const size_t offset) {
+  if (indexComplete || offset < indexFrontier) {
+    return;
+  }
+  LOG_DBG("TRS", "Indexing through offset %zu in the foreground", offset);
   GUI.drawPopup(renderer, tr(STR_INDEXING));
+  indexMorePages([this, offset]() { return indexFrontier > offset; });
+}
 
-  while (offset < fileSize) {
-    std::vector<std::string> tempLines;
-    size_t nextOffset = offset;
+int TxtReaderActivity::pageIndexOf(const size_t offset) {
+  if (indexedPageCount == 0 || (!indexComplete && offset >= indexFrontier)) {
+    return -1;
+  }
+  // The first checkpoint is page 0 at offset 0, so the offset is never before it
+  const size_t checkpoint = std::upper_bound(checkpoints.begin(), checkpoints.end(), offset) - checkpoints.begin() - 1;
+  loadOffsetWindow(checkpoint);
+  const auto it = std::upper_bound(windowOffsets.begin(), windowOffsets.end(), offset);
+  return static_cast<int>(checkpoint * checkpointStride + (it - windowOffsets.begin())) - 1;
+}
 
-    if (!loadPageAtOffset(offset, tempLines, nextOffset)) {
-      break;
-    }
+uint32_t TxtReaderActivity::pageOffset(const size_t page) {
+  loadOffsetWindow(page / checkpointStride);
+  return windowOffsets[page % checkpointStride];
+}
 
-    if (nextOffset <= offset) {
-      // No progress made, avoid infinite loop
-      break;
+void TxtReaderActivity::loadOffsetWindow(const size_t checkpoint) {
+  const size_t firstPage = checkpoint * checkpointStride;
+  const size_t count = std::min(checkpointStride, indexedPageCount - firstPage);
+  if (windowCheckpoint == checkpoint && windowOffsets.size() == count) {
+    return;
+  }
+  windowCheckpoint = checkpoint;
+  windowOffsets.resize(count);
+
+  // Pages already appended to index.bin are read back from it, the rest come from unsavedOffsets
+  const size_t savedCount = firstPage < savedPageCount ? std::min(count, savedPageCount - firstPage) : 0;
+  if (savedCount > 0) {
+    FsFile f;
+    const size_t bytes = savedCount * sizeof(uint32_t);
+    const bool loaded = Storage.openFileForRead("TRS", txt->getCachePath() + "/index.bin", f) &&
+                        f.seekSet(CACHE_HEADER_SIZE + firstPage * sizeof(uint32_t)) &&
+                        f.read(windowOffsets.data(), bytes) == static_cast<int>(bytes);
+    if (!loaded) {
+      // Each page starts where the previous one ends, so the window can be laid out again from its checkpoint
+      LOG_ERR("TRS", "Failed to read page offsets %zu+%zu, laying them out again", firstPage, savedCount);
+      std::vector<std::string> tempLines;
+      windowOffsets[0] = checkpoints[checkpoint];
+      for (size_t i = 1; i < savedCount; i++) {
+        size_t nextOffset = windowOffsets[i - 1];
+        loadPageAtOffset(windowOffsets[i - 1], tempLines, nextOffset);
+        windowOffsets[i] = nextOffset;
+      }
     }
+  }
+  for (size_t i = savedCount; i < count; i++) {
+    windowOffsets[i] = unsavedOffsets[firstPage + i - savedPageCount];
+  }
+}
 
-    offset = nextOffset;
-    if (offset < fileSize) {
-      pageOffsets.push_back(offset);
-    }
+void TxtReaderActivity::applyPendingPageTurns() {
+  const size_t fileSize = txt->getFileSize();
+  int turns = pendingPageTurns.exchange(0);
 
-    // Yield to other tasks periodically
-    if (pageOffsets.size() % 20 == 0) {
-      vTaskDelay(1);
+  for (; turns > 0; turns--) {
+    if (currentPageEnd >= fileSize) {
+      break;
     }
+    // Prefer the index so that a page shown from a mid-page offset (saved under another layout) gets back in step
+    const int page = pageIndexOf(currentOffset);
+    const uint32_t nextPageOffset =
+        page >= 0 && static_cast<size_t>(page) + 1 < indexedPageCount ? pageOffset(page + 1) : 0;
+    currentOffset = nextPageOffset > currentOffset ? nextPageOffset : currentPageEnd;
+    std::vector<std::string> tempLines;
+    loadPageAtOffset(currentOffset, tempLines, currentPageEnd);
   }
 
-  totalPages = pageOffsets.size();
-  LOG_DBG("TRS", "Built page index: %d pages", totalPages);
+  for (; turns < 0; turns++) {
+    if (currentOffset == 0) {
+      break;
+    }
+    // Only the index knows where the previous page starts, so catch up to here first
+    indexThrough(currentOffset - 1);
+    const int page = pageIndexOf(currentOffset - 1);
+    currentOffset = page >= 0 ? pageOffset(page) : 0;
+  }
 }
 
 bool TxtReaderActivity::loadPageAtOffset(size_t offset, std::vector<std::string>& outLines, size_t& nextOffset) {
@@ -306,23 +444,16 @@ void TxtReaderActivity::render(RenderLock&&) {
     initializeReader();
   }
 
-  if (pageOffsets.empty()) {
+  // Load current page content
+  applyPendingPageTurns();
+  currentPageLines.clear();
+  if (!loadPageAtOffset(currentOffset, currentPageLines, currentPageEnd)) {
     renderer.clearScreen();
     renderer.drawCenteredText(UI_12_FONT_ID, 300, tr(STR_EMPTY_FILE), true, EpdFontFamily::BOLD);
     renderer.displayBuffer();
     return;
   }
 
-  // Bounds check
-  if (currentPage < 0) currentPage = 0;
-  if (currentPage >= totalPages) currentPage = totalPages - 1;
-
-  // Load current page content
-  size_t offset = pageOffsets[currentPage];
-  size_t nextOffset;
-  currentPageLines.clear();
-  loadPageAtOffset(offset, currentPageLines, nextOffset);
-
   renderer.clearScreen();
   renderPage();
 
@@ -379,7 +510,7 @@ void TxtReaderActivity::renderPage() {
   renderLines();
   renderStatusBar();
 
-  ReaderUtils::displayWithRefreshCycle(renderer, pagesUntilFullRefresh);
+  ReaderUtils::displayWithRefreshCycle(renderer);
 
   if (SETTINGS.textAntiAliasing) {
     ReaderUtils::renderAntiAliased(renderer, [&renderLines]() { renderLines(); });
@@ -387,42 +518,75 @@ void TxtReaderActivity::renderPage() {
   // scope destructor clears font cache via FontCacheManager
 }
 
-void TxtReaderActivity::renderStatusBar() const {
-  const float progress = totalPages > 0 ? (currentPage + 1) * 100.0f / totalPages : 0;
+void TxtReaderActivity::renderStatusBar() {
+  const size_t fileSize = txt->getFileSize();
+
+  // Until the index is complete, extrapolate the page count from the pages laid out so far
+  int pageCount = static_cast<int>(indexedPageCount);
+  if (!indexComplete) {
+    if (indexFrontier > 0 && indexedPageCount > 0) {
+      pageCount = static_cast<int>(static_cast<uint64_t>(indexedPageCount) * fileSize / indexFrontier);
+    } else if (currentPageEnd > currentOffset) {
+      pageCount = static_cast<int>((fileSize + currentPageEnd - currentOffset - 1) / (currentPageEnd - currentOffset));
+    }
+  }
+
+  int page = pageIndexOf(currentOffset);
+  if (page < 0) {
+    page = fileSize > 0 ? static_cast<int>(static_cast<uint64_t>(currentOffset) * pageCount / fileSize) : 0;
+  }
+  pageCount = std::max(pageCount, page + 1);
+
+  float progress = 0;
+  if (indexComplete) {
+    progress = pageCount > 0 ? (page + 1) * 100.0f / pageCount : 0;
+  } else if (fileSize > 0) {
+    progress = currentPageEnd * 100.0f / fileSize;
+  }
+
   std::string title;
   if (SETTINGS.statusBarTitle != CrossPointSettings::STATUS_BAR_TITLE::HIDE_TITLE) {
     title = txt->getTitle();
   }
-  GUI.drawStatusBar(renderer, progress, currentPage + 1, totalPages, title);
+  GUI.drawStatusBar(renderer, progress, page + 1, pageCount, title, 0, 0, !indexComplete);
 }
 
-void TxtReaderActivity::saveProgress() const {
-  FsFile f;
-  if (Storage.openFileForWrite("TRS", txt->getCachePath() + "/progress.bin", f)) {
-    uint8_t data[4];
-    data[0] = currentPage & 0xFF;
-    data[1] = (currentPage >> 8) & 0xFF;
-    data[2] = 0;
-    data[3] = 0;
-    f.write(data, 4);
-  }
+void TxtReaderActivity::saveProgress(const bool now) {
+  // Progress file format:
+  // - uint32_t: page index, read by older firmware
+  // - uint32_t: file offset of the page
+  const int page = pageIndexOf(currentOffset);
+  const uint32_t data[2] = {static_cast<uint32_t>(page >= 0 ? page : 0), static_cast<uint32_t>(currentOffset)};
+  // Debounced: only every few page turns reach the SD card
+  progressJournal.record(data, sizeof(data), now);
 }
 
 void TxtReaderActivity::loadProgress() {
-  FsFile f;
-  if (Storage.openFileForRead("TRS", txt->getCachePath() + "/progress.bin", f)) {
-    uint8_t data[4];
-    if (f.read(data, 4) == 4) {
-      currentPage = data[0] + (data[1] << 8);
-      if (currentPage >= totalPages) {
-        currentPage = totalPages - 1;
-      }
-      if (currentPage < 0) {
-        currentPage = 0;
-      }
-      LOG_DBG("TRS", "Loaded progress: page %d/%d", currentPage, totalPages);
-    }
+  uint32_t data[2] = {};
+  const size_t size = progressJournal.open(txt->getCachePath(), data, sizeof(data));
+  if (size < sizeof(data[0])) {
+    return;
+  }
+
+  uint32_t page = data[0];
+  const uint32_t offset = data[1];
+  if (size == sizeof(data)) {
+    // Offsets don't depend on the layout, so this opens at the saved text even before the index reaches it
+    currentOffset = std::min<size_t>(offset, txt->getFileSize());
+    LOG_DBG("TRS", "Loaded progress: offset %u", offset);
+    return;
+  }
+
+  // Saved by older firmware as a page index only: lay out pages up to it
+  page &= 0xFFFF;
+  if (!indexComplete && page >= indexedPageCount) {
+    GUI.drawPopup(renderer, tr(STR_INDEXING));
+    indexMorePages([this, page]() { return indexedPageCount > page; });
+  }
+  if (indexedPageCount > 0) {
+    currentOffset = pageOffset(std::min<size_t>(page, indexedPageCount - 1));
   }
+  LOG_DBG("TRS", "Loaded legacy progress: page %u", page);
 }
 
 bool TxtReaderActivity::loadPageIndexCache() {
@@ -435,8 +599,9 @@ bool TxtReaderActivity::loadPageIndexCache() {
   // - int32_t: font ID (to invalidate cache on font change)
   // - int32_t: screen margin (to invalidate cache on margin change)
   // - uint8_t: paragraph alignment (to invalidate cache on alignment change)
-  // - uint32_t: total pages count
-  // - N * uint32_t: page offsets
+  // - uint8_t: 1 once every page is indexed
+  // - N * uint32_t: page offsets, appended as the index grows
+  // - uint32_t: index frontier (file size once complete), overwritten by the next append
 
   std::string cachePath = txt->getCachePath() + "/index.bin";
   FsFile f;
@@ -502,29 +667,51 @@ bool TxtReaderActivity::loadPageIndexCache() {
     return false;
   }
 
-  uint32_t numPages;
-  serialization::readPod(f, numPages);
+  uint8_t complete;
+  serialization::readPod(f, complete);
 
-  // Read page offsets
-  pageOffsets.clear();
-  pageOffsets.reserve(numPages);
-
-  for (uint32_t i = 0; i < numPages; i++) {
+  // Only the checkpoints and the frontier are read; a partially written trailing offset is dropped
+  const size_t numOffsets = (f.size() - CACHE_HEADER_SIZE) / sizeof(uint32_t);
+  if (numOffsets == 0) {
+    LOG_DBG("TRS", "Cache has no frontier, rebuilding");
+    return false;
+  }
+  indexedPageCount = numOffsets - 1;
+  checkpoints.clear();
+  checkpoints.reserve(indexedPageCount / checkpointStride + 1);
+  for (size_t page = 0; page < indexedPageCount; page += checkpointStride) {
     uint32_t offset;
+    f.seekSet(CACHE_HEADER_SIZE + page * sizeof(uint32_t));
     serialization::readPod(f, offset);
-    pageOffsets.push_back(offset);
-  }
-
-  totalPages = pageOffsets.size();
-  LOG_DBG("TRS", "Loaded page index cache: %d pages", totalPages);
+    checkpoints.push_back(offset);
+  }
+  uint32_t frontier;
+  f.seekSet(CACHE_HEADER_SIZE + indexedPageCount * sizeof(uint32_t));
+  serialization::readPod(f, frontier);
+  indexFrontier = frontier;
+  savedPageCount = indexedPageCount;
+  unsavedOffsets.clear();
+  windowCheckpoint = SIZE_MAX;
+  indexComplete = complete != 0;
+
+  LOG_DBG("TRS", "Loaded page index cache: %zu pages, %zu checkpoints%s", indexedPageCount, checkpoints.size(),
+          indexComplete ? "" : " (partial)");
   return true;
 }
 
-void TxtReaderActivity::savePageIndexCache() const {
+void TxtReaderActivity::startPageIndexCache() {
+  indexedPageCount = 0;
+  indexFrontier = 0;
+  indexComplete = false;
+  checkpoints.clear();
+  unsavedOffsets.clear();
+  savedPageCount = 0;
+  windowCheckpoint = SIZE_MAX;
+
   std::string cachePath = txt->getCachePath() + "/index.bin";
   FsFile f;
   if (!Storage.openFileForWrite("TRS", cachePath, f)) {
-    LOG_ERR("TRS", "Failed to save page index cache");
+    LOG_ERR("TRS", "Failed to create page index cache");
     return;
   }
 
@@ -537,12 +724,30 @@ void TxtReaderActivity::savePageIndexCache() const {
   serialization::writePod(f, static_cast<int32_t>(cachedFontId));
   serialization::writePod(f, static_cast<int32_t>(cachedScreenMargin));
   serialization::writePod(f, cachedParagraphAlignment);
-  serialization::writePod(f, static_cast<uint32_t>(pageOffsets.size()));
+  serialization::writePod(f, static_cast<uint8_t>(0));
+  serialization::writePod(f, static_cast<uint32_t>(indexFrontier));
+}
 
-  // Write page offsets
-  for (size_t offset : pageOffsets) {
-    serialization::writePod(f, static_cast<uint32_t>(offset));
+void TxtReaderActivity::appendPageIndexCache() {
+  std::string cachePath = txt->getCachePath() + "/index.bin";
+  FsFile f = Storage.open(cachePath.c_str(), O_RDWR);
+  if (!f || f.size() < CACHE_HEADER_SIZE) {
+    LOG_ERR("TRS", "Failed to update page index cache");
+    return;
   }
 
-  LOG_DBG("TRS", "Saved page index cache: %d pages", totalPages);
+  // Overwrite the frontier saved last time (see loadPageIndexCache) with the pages laid out from it
+  f.seekSet(CACHE_HEADER_SIZE + savedPageCount * sizeof(uint32_t));
+  const size_t bytes = unsavedOffsets.size() * sizeof(uint32_t);
+  if (f.write(unsavedOffsets.data(), bytes) != bytes) {
+    LOG_ERR("TRS", "Failed to append to page index cache");
+    return;  // Keep the offsets in RAM and retry with the next batch
+  }
+  serialization::writePod(f, static_cast<uint32_t>(indexFrontier));
+  if (indexComplete) {
+    f.seekSet(CACHE_COMPLETE_FLAG_POS);
+    serialization::writePod(f, static_cast<uint8_t>(1));
+  }
+  savedPageCount = indexedPageCount;
+  unsavedOffsets.clear();
 }
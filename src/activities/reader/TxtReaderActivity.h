@@ -2,24 +2,46 @@
 
 #include <Txt.h>
 
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <vector>
 
 #include "CrossPointSettings.h"
+#include "ProgressJournal.h"
+#include "TxtPageIndexer.h"
 #include "activities/Activity.h"
 
 class TxtReaderActivity final : public Activity {
   std::unique_ptr<Txt> txt;
+  std::unique_ptr<TxtPageIndexer> indexer;
 
-  int currentPage = 0;
-  int totalPages = 1;
-  int pagesUntilFullRefresh = 0;
 
-  // Streaming text reader - stores file offsets for each page
-  std::vector<size_t> pageOffsets;  // File offset for start of each page
+  // Streaming text reader - the page index maps pages to file offsets and is built in the background by indexer.
+  // indexedPageCount pages have been laid out so far, indexFrontier is the start of the next page to lay out.
+  // The full table of page offsets lives in index.bin; RAM only holds every checkpointStride-th offset, the pages
+  // not yet appended to the file, and the offsets of one checkpoint's pages read back around the page on screen.
+  size_t indexedPageCount = 0;
+  size_t indexFrontier = 0;
+  bool indexComplete = false;
+  size_t checkpointStride = 1;
+  std::vector<uint32_t> checkpoints;     // Offset of page i * checkpointStride
+  std::vector<uint32_t> unsavedOffsets;  // Offsets of the pages from savedPageCount on, not yet in index.bin
+  size_t savedPageCount = 0;
+  std::vector<uint32_t> windowOffsets;  // Offsets of the pages from checkpoint windowCheckpoint on
+  size_t windowCheckpoint = SIZE_MAX;
+
+  // Page on screen, by file offset so that it can be shown before the index reaches it
+  size_t currentOffset = 0;
+  size_t currentPageEnd = 0;
+  std::atomic<int> pendingPageTurns{0};  // Requested by loop(), applied by render()
+
   std::vector<std::string> currentPageLines;
   int linesPerPage = 0;
   int viewportWidth = 0;
   bool initialized = false;
+  ProgressJournal progressJournal;
 
   // Cached settings for cache validation (different fonts/margins require re-indexing)
   int cachedFontId = 0;
@@ -31,14 +53,19 @@ class TxtReaderActivity final : public Activity {
   int cachedOrientedMarginLeft = 0;
 
   void renderPage();
-  void renderStatusBar() const;
+  void renderStatusBar();
 
   void initializeReader();
   bool loadPageAtOffset(size_t offset, std::vector<std::string>& outLines, size_t& nextOffset);
-  void buildPageIndex();
+  void applyPendingPageTurns();
+  void indexThrough(size_t offset);
+  int pageIndexOf(size_t offset);
+  uint32_t pageOffset(size_t page);
+  void loadOffsetWindow(size_t checkpoint);
   bool loadPageIndexCache();
-  void savePageIndexCache() const;
-  void saveProgress() const;
+  void startPageIndexCache();
+  void appendPageIndexCache();
+  void saveProgress(bool now = false);
   void loadProgress();
 
  public:
@@ -49,4 +76,8 @@ class TxtReaderActivity final : public Activity {
   void loop() override;
   void render(RenderLock&&) override;
   bool isReaderActivity() const override { return true; }
+
+  // Lays out pages after the index frontier until the whole file is indexed (returns true) or shouldStop() returns
+  // true. Called by the indexer and render() with RenderLock held.
+  bool indexMorePages(const std::function<bool()>& shouldStop);
 };
@@ -0,0 +1,28 @@
+#include "XtcPagePrefetcher.h"
+
+#include <Logging.h>
+#include <Xtc.h>
+
+void XtcPagePrefetcher::prefetch(const uint32_t pageIndex, uint8_t* pageBuffer, const size_t pageBufferSize) {
+  stop();
+  buffer = pageBuffer;
+  bufferSize = pageBufferSize;
+  page = pageIndex;
+  loaded = false;
+  start(STACK_SIZE);
+}
+
+bool XtcPagePrefetcher::take(const uint32_t pageIndex) {
+  stop();
+  const bool hit = loaded && page == pageIndex;
+  loaded = false;
+  return hit;
+}
+
+void XtcPagePrefetcher::run() {
+  if (stopRequested()) {
+    return;
+  }
+  loaded = xtc.loadPage(page, buffer, bufferSize) > 0;
+  LOG_DBG("XTR", "Prefetched page %lu: %s", page, loaded ? "ok" : "failed");
+}
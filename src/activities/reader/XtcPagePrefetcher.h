@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "activities/Worker.h"
+
+class Xtc;
+
+/**
+ * Reads the page the reader is likely to show next into a spare page buffer, so that a page turn only has to draw it.
+ *
+ * The read is started by render() right before it sends the current page to the panel, so it overlaps the refresh
+ * wait (and otherwise the time the page is being read). The prefetcher and the render task share the XTC file handle:
+ * render() calls take() first, which waits for a read in flight to finish, and only then touches the Xtc again.
+ */
+class XtcPagePrefetcher final : public Worker {
+  const Xtc& xtc;
+  uint8_t* buffer = nullptr;
+  size_t bufferSize = 0;
+  uint32_t page = 0;
+  volatile bool loaded = false;
+
+ protected:
+  void run() override;
+
+ public:
+  static constexpr uint32_t STACK_SIZE = 4096;
+
+  explicit XtcPagePrefetcher(const Xtc& xtc) : Worker("XtcPagePrefetcher"), xtc(xtc) {}
+  ~XtcPagePrefetcher() override { stop(); }
+
+  // Starts reading page into buffer, replacing any earlier prefetch.
+  void prefetch(uint32_t pageIndex, uint8_t* pageBuffer, size_t pageBufferSize);
+  // Waits for the read in flight. True if pageIndex is in the buffer given to prefetch(), which is then the caller's.
+  bool take(uint32_t pageIndex);
+};
@@ -11,11 +11,18 @@
 #include <GfxRenderer.h>
 #include <HalStorage.h>
 #include <I18n.h>
+#include <esp_heap_caps.h>
 
+#include <algorithm>
+
+#include "CacheBudget.h"
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
+#include "LibraryDatabase.h"
 #include "MappedInputManager.h"
+#include "ReaderUtils.h"
 #include "RecentBooksStore.h"
+#include "XtcPagePrefetcher.h"
 #include "XtcReaderChapterSelectionActivity.h"
 #include "components/UITheme.h"
 #include "fontIds.h"
@@ -23,10 +30,81 @@
 namespace {
 constexpr unsigned long skipPageMs = 700;
 constexpr unsigned long goHomeMs = 1000;
+constexpr size_t STREAM_CHUNK_SIZE = 4096;
+
+// One frame buffer image of an XTH page. With the planes laid out like the frame buffer (see planesMatchFrameBuffer),
+// it is built byte by byte: the first plane's byte is copied in (inverted or not) and the second plane's byte is
+// combined into it. Plane bits are 1 for ink; frame buffer bits are 1 for white, or, in the gray planes, for pixels
+// the gray waveform leaves alone. Otherwise it is drawn pixel by pixel: clear to clearColor, then flip the pixels
+// whose value is in pixelMask.
+struct PlaneOps {
+  enum Op : uint8_t { COPY, COPY_INVERTED, AND, AND_INVERTED, XOR };
+  Op first;
+  Op second;
+  uint8_t clearColor;
+  uint8_t pixelMask;  // Bit v set: pixels of value v
+};
+// BW: every non-white pixel is black
+constexpr PlaneOps BW_IMAGE = {PlaneOps::COPY_INVERTED, PlaneOps::AND_INVERTED, 0xFF, 0b1110};
+// LSB: dark grey only (value 1: bit1 = 0, bit2 = 1)
+constexpr PlaneOps GRAY_LSB_IMAGE = {PlaneOps::COPY_INVERTED, PlaneOps::AND, 0x00, 0b0010};
+// MSB: dark and light grey (value 1 or 2: bit1 != bit2)
+constexpr PlaneOps GRAY_MSB_IMAGE = {PlaneOps::COPY, PlaneOps::XOR, 0x00, 0b0110};
+
+// Combines size bytes of XTH page data, starting at offset into the bitmap (both planes), into the frame buffer
+void combinePlanes(uint8_t* frameBuffer, const size_t planeSize, const uint8_t* data, const size_t size,
+                   const size_t offset, const PlaneOps& ops) {
+  for (size_t i = 0; i < size; i++) {
+    const bool secondPlane = offset + i >= planeSize;
+    uint8_t& dst = frameBuffer[secondPlane ? offset + i - planeSize : offset + i];
+    switch (secondPlane ? ops.second : ops.first) {
+      case PlaneOps::COPY:
+        dst = data[i];
+        break;
+      case PlaneOps::COPY_INVERTED:
+        dst = ~data[i];
+        break;
+      case PlaneOps::AND:
+        dst &= data[i];
+        break;
+      case PlaneOps::AND_INVERTED:
+        dst &= ~data[i];
+        break;
+      case PlaneOps::XOR:
+        dst ^= data[i];
+        break;
+    }
+  }
+}
+
+// Draws size bytes of XTG page data, starting at offset into the bitmap, through drawPixel so that any orientation
+// works. XTG: 0 = black, 1 = white; white pixels are already cleared by clearScreen()
+void drawRows(const GfxRenderer& renderer, const uint16_t pageWidth, const uint16_t pageHeight, const uint8_t* data,
+              const size_t size, const size_t offset) {
+  const size_t srcRowBytes = (pageWidth + 7) / 8;  // 60 bytes for 480 width
+  for (size_t i = 0; i < size; i++) {
+    const uint8_t byte = data[i];
+    if (byte == 0xFF) {
+      continue;
+    }
+    const size_t srcY = (offset + i) / srcRowBytes;
+    const size_t srcX = ((offset + i) % srcRowBytes) * 8;
+    if (srcY >= pageHeight) {
+      return;
+    }
+    for (int bit = 0; bit < 8 && srcX + bit < pageWidth; bit++) {
+      if (!((byte >> (7 - bit)) & 1)) {
+        renderer.drawPixel(srcX + bit, srcY, true);
+      }
+    }
+  }
+}
 }  // namespace
 
 void XtcReaderActivity::onEnter() {
   Activity::onEnter();
+  // The first page clears what was on screen before
+  renderer.requestFullRefresh();
 
   if (!xtc) {
     return;
@@ -41,6 +119,7 @@ void XtcReaderActivity::onEnter() {
   APP_STATE.openEpubPath = xtc->getPath();
   APP_STATE.saveToFile();
   RECENT_BOOKS.addBook(xtc->getPath(), xtc->getTitle(), xtc->getAuthor(), xtc->getThumbBmpPath());
+  LIBRARY.putBook(xtc->getPath(), xtc->getTitle(), xtc->getAuthor(), "", xtc->getThumbBmpPath());
 
   // Trigger first update
   requestUpdate();
@@ -49,15 +128,28 @@ void XtcReaderActivity::onEnter() {
 void XtcReaderActivity::onExit() {
   Activity::onExit();
 
+  freePrefetchBuffer();
+  if (xtc) {
+    saveProgress(true);
+  }
+  progressJournal.close();
   APP_STATE.readerActivityLoadCount = 0;
   APP_STATE.saveToFile();
+  if (xtc) {
+    CacheBudget::onBookClosed(xtc->getCachePath());
+  }
   xtc.reset();
 }
 
 void XtcReaderActivity::loop() {
   // Enter chapter selection activity
   if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
-    if (xtc && xtc->hasChapters() && !xtc->getChapters().empty()) {
+    if (prefetcher) {
+      // Chapters are read from the file the prefetcher may be reading
+      RenderLock lock(*this);
+      prefetcher->stop();
+    }
+    if (xtc && xtc->hasChapters() && xtc->getChapterCount() > 0) {
       startActivityForResult(
           std::make_unique<XtcReaderChapterSelectionActivity>(renderer, mappedInput, xtc, currentPage),
           [this](const ActivityResult& result) {
@@ -112,6 +204,7 @@ void XtcReaderActivity::loop() {
   const bool skipPages = SETTINGS.longPressChapterSkip && mappedInput.getHeldTime() > skipPageMs;
   const int skipAmount = skipPages ? 10 : 1;
 
+  lastTurnForward = nextTriggered;
   if (prevTriggered) {
     if (currentPage >= static_cast<uint32_t>(skipAmount)) {
       currentPage -= skipAmount;
@@ -146,49 +239,68 @@ void XtcReaderActivity::render(RenderLock&&) {
   saveProgress();
 }
 
-void XtcReaderActivity::renderPage() {
-  const uint16_t pageWidth = xtc->getPageWidth();
-  const uint16_t pageHeight = xtc->getPageHeight();
-  const uint8_t bitDepth = xtc->getBitDepth();
+void XtcReaderActivity::allocatePrefetchBuffer() {
+  if (pageBufferSize > 0) {
+    return;  // Already tried
+  }
 
   // Calculate buffer size for one page
   // XTG (1-bit): Row-major, ((width+7)/8) * height bytes
   // XTH (2-bit): Two bit planes, column-major, ((width * height + 7) / 8) * 2 bytes
-  size_t pageBufferSize;
-  if (bitDepth == 2) {
+  const uint16_t pageWidth = xtc->getPageWidth();
+  const uint16_t pageHeight = xtc->getPageHeight();
+  if (xtc->getBitDepth() == 2) {
     pageBufferSize = ((static_cast<size_t>(pageWidth) * pageHeight + 7) / 8) * 2;
   } else {
     pageBufferSize = ((pageWidth + 7) / 8) * pageHeight;
   }
 
-  // Allocate page buffer
-  uint8_t* pageBuffer = static_cast<uint8_t*>(malloc(pageBufferSize));
-  if (!pageBuffer) {
-    LOG_ERR("XTR", "Failed to allocate page buffer (%lu bytes)", pageBufferSize);
-    renderer.clearScreen();
-    renderer.drawCenteredText(UI_12_FONT_ID, 300, tr(STR_MEMORY_ERROR), true, EpdFontFamily::BOLD);
-    renderer.displayBuffer();
-    return;
+  // Pages are streamed into the frame buffer, so the buffer is optional: only take it if a block as big would still
+  // be left for everything else. Kept for the whole session, so page turns don't fragment the heap.
+  if (heap_caps_get_largest_free_block(MALLOC_CAP_8BIT) >= pageBufferSize * 2) {
+    prefetchBuffer = static_cast<uint8_t*>(malloc(pageBufferSize));
   }
+  if (prefetchBuffer) {
+    prefetcher = std::make_unique<XtcPagePrefetcher>(*xtc);
+  } else {
+    LOG_DBG("XTR", "Not enough heap for a prefetch buffer, pages load on demand");
+  }
+}
 
-  // Load page data
-  size_t bytesRead = xtc->loadPage(currentPage, pageBuffer, pageBufferSize);
-  if (bytesRead == 0) {
-    LOG_ERR("XTR", "Failed to load page %lu", currentPage);
-    free(pageBuffer);
-    renderer.clearScreen();
-    renderer.drawCenteredText(UI_12_FONT_ID, 300, tr(STR_PAGE_LOAD_ERROR), true, EpdFontFamily::BOLD);
-    renderer.displayBuffer();
+void XtcReaderActivity::freePrefetchBuffer() {
+  prefetcher.reset();
+  free(prefetchBuffer);
+  prefetchBuffer = nullptr;
+}
+
+void XtcReaderActivity::prefetchNextPage() {
+  if (!prefetcher) {
     return;
   }
+  if (lastTurnForward ? currentPage + 1 < xtc->getPageCount() : currentPage > 0) {
+    prefetcher->prefetch(lastTurnForward ? currentPage + 1 : currentPage - 1, prefetchBuffer, pageBufferSize);
+  }
+}
 
-  // Clear screen first
-  renderer.clearScreen();
+bool XtcReaderActivity::planesMatchFrameBuffer() const {
+  // In portrait, logical (x, y) is panel (y, panelHeight - 1 - x): an XTH column, right to left, is a panel row, top
+  // to bottom, and its 8 vertical pixels per byte are 8 horizontal ones, MSB first like the frame buffer
+  return renderer.getOrientation() == GfxRenderer::Portrait && xtc->getPageWidth() == renderer.getDisplayHeight() &&
+         xtc->getPageHeight() == renderer.getDisplayWidth();
+}
 
-  // Copy page bitmap using GfxRenderer's drawPixel
-  // XTC/XTCH pages are pre-rendered with status bar included, so render full page
-  const uint16_t maxSrcY = pageHeight;
+void XtcReaderActivity::renderPage() {
+  const uint16_t pageWidth = xtc->getPageWidth();
+  const uint16_t pageHeight = xtc->getPageHeight();
+  const uint8_t bitDepth = xtc->getBitDepth();
+
+  allocatePrefetchBuffer();
 
+  // Use the page from the prefetcher if it read the right one, otherwise stream it from the SD card straight into
+  // the frame buffer
+  const uint8_t* pageData = prefetcher && prefetcher->take(currentPage) ? prefetchBuffer : nullptr;
+
+  // XTC/XTCH pages are pre-rendered with status bar included, so render full page
   if (bitDepth == 2) {
     // XTH 2-bit mode: Two bit planes, column-major order
     // - Columns scanned right to left (x = width-1 down to 0)
@@ -196,162 +308,166 @@ void XtcReaderActivity::renderPage() {
     // - First plane: Bit1, Second plane: Bit2
     // - Pixel value = (bit1 << 1) | bit2
     // - Grayscale: 0=White, 1=Dark Grey, 2=Light Grey, 3=Black
-
     const size_t planeSize = (static_cast<size_t>(pageWidth) * pageHeight + 7) / 8;
-    const uint8_t* plane1 = pageBuffer;              // Bit1 plane
-    const uint8_t* plane2 = pageBuffer + planeSize;  // Bit2 plane
-    const size_t colBytes = (pageHeight + 7) / 8;    // Bytes per column (100 for 800 height)
 
-    // Lambda to get pixel value at (x, y)
+    // Planes that don't line up with the frame buffer are drawn pixel by pixel, which needs the whole page in RAM
+    uint8_t* fallbackBuffer = nullptr;
+    const bool inPlace = planesMatchFrameBuffer();
+    if (!inPlace && !pageData) {
+      fallbackBuffer = static_cast<uint8_t*>(malloc(planeSize * 2));
+      if (!fallbackBuffer) {
+        LOG_ERR("XTR", "Failed to allocate page buffer (%lu bytes)", planeSize * 2);
+        renderer.clearScreen();
+        renderer.drawCenteredText(UI_12_FONT_ID, 300, tr(STR_MEMORY_ERROR), true, EpdFontFamily::BOLD);
+        renderer.displayBuffer();
+        return;
+      }
+      if (xtc->loadPage(currentPage, fallbackBuffer, planeSize * 2) == 0) {
+        free(fallbackBuffer);
+        fallbackBuffer = nullptr;
+      }
+      pageData = fallbackBuffer;
+    }
+
+    const size_t colBytes = (pageHeight + 7) / 8;  // Bytes per column (100 for 800 height)
     auto getPixelValue = [&](uint16_t x, uint16_t y) -> uint8_t {
       const size_t colIndex = pageWidth - 1 - x;
       const size_t byteInCol = y / 8;
       const size_t bitInByte = 7 - (y % 8);
       const size_t byteOffset = colIndex * colBytes + byteInCol;
-      const uint8_t bit1 = (plane1[byteOffset] >> bitInByte) & 1;
-      const uint8_t bit2 = (plane2[byteOffset] >> bitInByte) & 1;
+      const uint8_t bit1 = (pageData[byteOffset] >> bitInByte) & 1;
+      const uint8_t bit2 = (pageData[planeSize + byteOffset] >> bitInByte) & 1;
       return (bit1 << 1) | bit2;
     };
 
-    // Optimized grayscale rendering without storeBwBuffer (saves 48KB peak memory)
-    // Flow: BW display → LSB/MSB passes → grayscale display → re-render BW for next frame
-
-    // Count pixel distribution for debugging
-    uint32_t pixelCounts[4] = {0, 0, 0, 0};
-    for (uint16_t y = 0; y < pageHeight; y++) {
-      for (uint16_t x = 0; x < pageWidth; x++) {
-        pixelCounts[getPixelValue(x, y)]++;
+    // Fills the frame buffer with one of the page's images: the BW image or a gray plane for the LUT
+    auto drawImage = [&](const PlaneOps& ops) -> bool {
+      if (!inPlace) {
+        if (!pageData) {
+          return false;
+        }
+        renderer.clearScreen(ops.clearColor);
+        for (uint16_t y = 0; y < pageHeight; y++) {
+          for (uint16_t x = 0; x < pageWidth; x++) {
+            if (ops.pixelMask & (1 << getPixelValue(x, y))) {
+              renderer.drawPixel(x, y, ops.clearColor != 0);
+            }
+          }
+        }
+        return true;
       }
-    }
-    LOG_DBG("XTR", "Pixel distribution: White=%lu, DarkGrey=%lu, LightGrey=%lu, Black=%lu", pixelCounts[0],
-            pixelCounts[1], pixelCounts[2], pixelCounts[3]);
 
-    // Pass 1: BW buffer - draw all non-white pixels as black
-    for (uint16_t y = 0; y < pageHeight; y++) {
-      for (uint16_t x = 0; x < pageWidth; x++) {
-        if (getPixelValue(x, y) >= 1) {
-          renderer.drawPixel(x, y, true);
-        }
+      uint8_t* frameBuffer = renderer.getFrameBuffer();
+      if (pageData) {
+        combinePlanes(frameBuffer, planeSize, pageData, planeSize * 2, 0, ops);
+        return true;
       }
-    }
+      return xtc->loadPageStreaming(
+                 currentPage,
+                 [&](const uint8_t* data, size_t size, size_t offset) {
+                   combinePlanes(frameBuffer, planeSize, data, size, offset, ops);
+                 },
+                 STREAM_CHUNK_SIZE) == xtc::XtcError::OK;
+    };
 
-    // Display BW with conditional refresh based on pagesUntilFullRefresh
-    if (pagesUntilFullRefresh <= 1) {
-      renderer.displayBuffer(HalDisplay::HALF_REFRESH);
-      pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
-    } else {
+    // Optimized grayscale rendering without storeBwBuffer (saves 48KB peak memory)
+    // Flow: BW display → LSB/MSB passes → grayscale display → re-render BW for next frame
+
+    // Pass 1: BW buffer - draw all non-white pixels as black
+    if (!drawImage(BW_IMAGE)) {
+      LOG_ERR("XTR", "Failed to load page %lu", currentPage);
+      free(fallbackBuffer);
+      renderer.clearScreen();
+      renderer.drawCenteredText(UI_12_FONT_ID, 300, tr(STR_PAGE_LOAD_ERROR), true, EpdFontFamily::BOLD);
       renderer.displayBuffer();
-      pagesUntilFullRefresh--;
+      return;
     }
 
-    // Pass 2: LSB buffer - mark DARK gray only (XTH value 1)
-    // In LUT: 0 bit = apply gray effect, 1 bit = untouched
-    renderer.clearScreen(0x00);
-    for (uint16_t y = 0; y < pageHeight; y++) {
-      for (uint16_t x = 0; x < pageWidth; x++) {
-        if (getPixelValue(x, y) == 1) {  // Dark grey only
-          renderer.drawPixel(x, y, false);
-        }
-      }
-    }
-    renderer.copyGrayscaleLsbBuffers();
+    ReaderUtils::displayWithRefreshCycle(renderer);
 
+    // Pass 2: LSB buffer - mark DARK gray only (XTH value 1)
     // Pass 3: MSB buffer - mark LIGHT AND DARK gray (XTH value 1 or 2)
     // In LUT: 0 bit = apply gray effect, 1 bit = untouched
-    renderer.clearScreen(0x00);
-    for (uint16_t y = 0; y < pageHeight; y++) {
-      for (uint16_t x = 0; x < pageWidth; x++) {
-        const uint8_t pv = getPixelValue(x, y);
-        if (pv == 1 || pv == 2) {  // Dark grey or Light grey
-          renderer.drawPixel(x, y, false);
-        }
-      }
-    }
+    // Pass 4: Re-render BW to framebuffer (restore for next frame, instead of restoreBwBuffer)
+    bool loaded = drawImage(GRAY_LSB_IMAGE);
+    renderer.copyGrayscaleLsbBuffers();
+    loaded = drawImage(GRAY_MSB_IMAGE) && loaded;
     renderer.copyGrayscaleMsbBuffers();
-
-    // Display grayscale overlay
     renderer.displayGrayBuffer();
-
-    // Pass 4: Re-render BW to framebuffer (restore for next frame, instead of restoreBwBuffer)
-    renderer.clearScreen();
-    for (uint16_t y = 0; y < pageHeight; y++) {
-      for (uint16_t x = 0; x < pageWidth; x++) {
-        if (getPixelValue(x, y) >= 1) {
-          renderer.drawPixel(x, y, true);
-        }
-      }
+    loaded = drawImage(BW_IMAGE) && loaded;
+    if (!loaded) {
+      LOG_ERR("XTR", "Failed to reload page %lu for grayscale", currentPage);
     }
+    free(fallbackBuffer);
 
     // Cleanup grayscale buffers with current frame buffer
     renderer.cleanupGrayscaleWithFrameBuffer();
 
-    free(pageBuffer);
+    // The page data isn't needed anymore; read the next page while this one is being read
+    prefetchNextPage();
 
     LOG_DBG("XTR", "Rendered page %lu/%lu (2-bit grayscale)", currentPage + 1, xtc->getPageCount());
     return;
-  } else {
-    // 1-bit mode: 8 pixels per byte, MSB first
-    const size_t srcRowBytes = (pageWidth + 7) / 8;  // 60 bytes for 480 width
-
-    for (uint16_t srcY = 0; srcY < maxSrcY; srcY++) {
-      const size_t srcRowStart = srcY * srcRowBytes;
-
-      for (uint16_t srcX = 0; srcX < pageWidth; srcX++) {
-        // Read source pixel (MSB first, bit 7 = leftmost pixel)
-        const size_t srcByte = srcRowStart + srcX / 8;
-        const size_t srcBit = 7 - (srcX % 8);
-        const bool isBlack = !((pageBuffer[srcByte] >> srcBit) & 1);  // XTC: 0 = black, 1 = white
+  }
 
-        if (isBlack) {
-          renderer.drawPixel(srcX, srcY, true);
-        }
-      }
-    }
+  // 1-bit mode: 8 pixels per byte, MSB first, row-major
+  renderer.clearScreen();
+  const size_t bitmapSize = ((pageWidth + 7) / 8) * pageHeight;
+  bool loaded = true;
+  if (pageData) {
+    drawRows(renderer, pageWidth, pageHeight, pageData, bitmapSize, 0);
+  } else {
+    loaded = xtc->loadPageStreaming(
+                 currentPage,
+                 [this, pageWidth, pageHeight](const uint8_t* data, size_t size, size_t offset) {
+                   drawRows(renderer, pageWidth, pageHeight, data, size, offset);
+                 },
+                 STREAM_CHUNK_SIZE) == xtc::XtcError::OK;
+  }
+  if (!loaded) {
+    LOG_ERR("XTR", "Failed to load page %lu", currentPage);
+    renderer.clearScreen();
+    renderer.drawCenteredText(UI_12_FONT_ID, 300, tr(STR_PAGE_LOAD_ERROR), true, EpdFontFamily::BOLD);
+    renderer.displayBuffer();
+    return;
   }
   // White pixels are already cleared by clearScreen()
 
-  free(pageBuffer);
-
   // XTC pages already have status bar pre-rendered, no need to add our own
 
-  // Display with appropriate refresh
-  if (pagesUntilFullRefresh <= 1) {
-    renderer.displayBuffer(HalDisplay::HALF_REFRESH);
-    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
-  } else {
-    renderer.displayBuffer();
-    pagesUntilFullRefresh--;
-  }
+  // Read the next page while the panel refreshes
+  prefetchNextPage();
+
+  ReaderUtils::displayWithRefreshCycle(renderer);
 
   LOG_DBG("XTR", "Rendered page %lu/%lu (%u-bit)", currentPage + 1, xtc->getPageCount(), bitDepth);
 }
 
-void XtcReaderActivity::saveProgress() const {
-  FsFile f;
-  if (Storage.openFileForWrite("XTR", xtc->getCachePath() + "/progress.bin", f)) {
-    uint8_t data[4];
-    data[0] = currentPage & 0xFF;
-    data[1] = (currentPage >> 8) & 0xFF;
-    data[2] = (currentPage >> 16) & 0xFF;
-    data[3] = (currentPage >> 24) & 0xFF;
-    f.write(data, 4);
-    f.close();
+void XtcReaderActivity::saveProgress(const bool now) {
+  uint8_t data[4];
+  data[0] = currentPage & 0xFF;
+  data[1] = (currentPage >> 8) & 0xFF;
+  data[2] = (currentPage >> 16) & 0xFF;
+  data[3] = (currentPage >> 24) & 0xFF;
+  // Debounced: only every few page turns reach the SD card
+  if (!progressJournal.record(data, sizeof(data), now)) {
+    return;
+  }
+  const uint32_t pageCount = xtc->getPageCount();
+  if (pageCount > 0) {
+    LIBRARY.setProgress(xtc->getPath(), static_cast<uint16_t>(static_cast<uint64_t>(currentPage) * 1000 / pageCount));
   }
 }
 
 void XtcReaderActivity::loadProgress() {
-  FsFile f;
-  if (Storage.openFileForRead("XTR", xtc->getCachePath() + "/progress.bin", f)) {
-    uint8_t data[4];
-    if (f.read(data, 4) == 4) {
-      currentPage = data[0] | (data[1] << 8) | (data[2] << 16) | (data[3] << 24);
-      LOG_DBG("XTR", "Loaded progress: page %lu", currentPage);
-
-      // Validate page number
-      if (currentPage >= xtc->getPageCount()) {
-        currentPage = 0;
-      }
+  uint8_t data[4];
+  if (progressJournal.open(xtc->getCachePath(), data, sizeof(data)) == sizeof(data)) {
+    currentPage = data[0] | (data[1] << 8) | (data[2] << 16) | (data[3] << 24);
+    LOG_DBG("XTR", "Loaded progress: page %lu", currentPage);
+
+    // Validate page number
+    if (currentPage >= xtc->getPageCount()) {
+      currentPage = 0;
     }
-    f.close();
   }
 }
@@ -9,16 +9,32 @@
 
 #include <Xtc.h>
 
+#include <memory>
+
+#include "ProgressJournal.h"
+#include "XtcPagePrefetcher.h"
 #include "activities/Activity.h"
 
 class XtcReaderActivity final : public Activity {
   std::shared_ptr<Xtc> xtc;
 
   uint32_t currentPage = 0;
-  int pagesUntilFullRefresh = 0;
 
+  // Pages are streamed from the SD card into the frame buffer. If the heap can spare a page, it is allocated on the
+  // first page shown and kept until exit, and prefetcher reads the page after the current one into it (the page
+  // before, if the last turn was backwards); render() draws from it when it is the page asked for.
+  uint8_t* prefetchBuffer = nullptr;
+  size_t pageBufferSize = 0;
+  std::unique_ptr<XtcPagePrefetcher> prefetcher;
+  bool lastTurnForward = true;
+  ProgressJournal progressJournal;
+
+  void allocatePrefetchBuffer();
+  void freePrefetchBuffer();
+  void prefetchNextPage();
+  bool planesMatchFrameBuffer() const;
   void renderPage();
-  void saveProgress() const;
+  void saveProgress(bool now = false);
   void loadProgress();
 
  public:
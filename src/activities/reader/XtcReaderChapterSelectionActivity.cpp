@@ -29,13 +29,7 @@ int XtcReaderChapterSelectionActivity::findChapterIndexForPage(uint32_t page) co
     return 0;
   }
 
-  const auto& chapters = xtc->getChapters();
-  for (size_t i = 0; i < chapters.size(); i++) {
-    if (page >= chapters[i].startPage && page <= chapters[i].endPage) {
-      return static_cast<int>(i);
-    }
-  }
-  return 0;
+  return std::max(0, xtc->findChapterForPage(page));
 }
 
 void XtcReaderChapterSelectionActivity::onEnter() {
@@ -54,12 +48,12 @@ void XtcReaderChapterSelectionActivity::onExit() { Activity::onExit(); }
 
 void XtcReaderChapterSelectionActivity::loop() {
   const int pageItems = getPageItems();
-  const int totalItems = static_cast<int>(xtc->getChapters().size());
+  const int totalItems = xtc->getChapterCount();
 
   if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
-    const auto& chapters = xtc->getChapters();
-    if (!chapters.empty() && selectorIndex >= 0 && selectorIndex < static_cast<int>(chapters.size())) {
-      setResult(PageResult{chapters[selectorIndex].startPage});
+    xtc::ChapterInfo chapter;
+    if (selectorIndex >= 0 && selectorIndex < totalItems && xtc->getChapter(selectorIndex, chapter)) {
+      setResult(PageResult{chapter.startPage});
       finish();
     }
   } else if (mappedInput.wasReleased(MappedInputManager::Button::Back)) {
@@ -80,12 +74,14 @@ void XtcReaderChapterSelectionActivity::loop() {
   });
 
   buttonNavigator.onNextContinuous([this, totalItems, pageItems] {
-    selectorIndex = ButtonNavigator::nextPageIndex(selectorIndex, totalItems, pageItems);
+    selectorIndex = ButtonNavigator::nextPageIndex(selectorIndex, totalItems, pageItems,
+                                                   buttonNavigator.continuousStride());
     requestUpdate();
   });
 
   buttonNavigator.onPreviousContinuous([this, totalItems, pageItems] {
-    selectorIndex = ButtonNavigator::previousPageIndex(selectorIndex, totalItems, pageItems);
+    selectorIndex = ButtonNavigator::previousPageIndex(selectorIndex, totalItems, pageItems,
+                                                       buttonNavigator.continuousStride());
     requestUpdate();
   });
 }
@@ -112,8 +108,8 @@ void XtcReaderChapterSelectionActivity::render(RenderLock&&) {
       contentX + (contentWidth - renderer.getTextWidth(UI_12_FONT_ID, tr(STR_SELECT_CHAPTER), EpdFontFamily::BOLD)) / 2;
   renderer.drawText(UI_12_FONT_ID, titleX, 15 + contentY, tr(STR_SELECT_CHAPTER), true, EpdFontFamily::BOLD);
 
-  const auto& chapters = xtc->getChapters();
-  if (chapters.empty()) {
+  const int totalItems = xtc->getChapterCount();
+  if (totalItems == 0) {
     // Center the empty state within the gutter-safe content region.
     const int emptyX = contentX + (contentWidth - renderer.getTextWidth(UI_10_FONT_ID, tr(STR_NO_CHAPTERS))) / 2;
     renderer.drawText(UI_10_FONT_ID, emptyX, 120 + contentY, tr(STR_NO_CHAPTERS));
@@ -124,8 +120,8 @@ void XtcReaderChapterSelectionActivity::render(RenderLock&&) {
   const auto pageStartIndex = selectorIndex / pageItems * pageItems;
   // Highlight only the content area, not the hint gutters.
   renderer.fillRect(contentX, 60 + contentY + (selectorIndex % pageItems) * 30 - 2, contentWidth - 1, 30);
-  for (int i = pageStartIndex; i < static_cast<int>(chapters.size()) && i < pageStartIndex + pageItems; i++) {
-    const auto& chapter = chapters[i];
+  xtc::ChapterInfo chapter;
+  for (int i = pageStartIndex; i < totalItems && i < pageStartIndex + pageItems && xtc->getChapter(i, chapter); i++) {
     const char* title = chapter.name.empty() ? tr(STR_UNNAMED) : chapter.name.c_str();
     renderer.drawText(UI_10_FONT_ID, contentX + 20, 60 + contentY + (i % pageItems) * 30, title, i != selectorIndex);
   }
@@ -136,5 +132,5 @@ void XtcReaderChapterSelectionActivity::render(RenderLock&&) {
     GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
   }
 
-  renderer.displayBuffer();
+  renderer.displayChanges();
 }
@@ -0,0 +1,135 @@
+#include "EnergyUsageActivity.h"
+
+#include <GfxRenderer.h>
+#include <HalPowerManager.h>
+#include <I18n.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "EnergyLedger.h"
+#include "MappedInputManager.h"
+#include "components/UITheme.h"
+#include "fontIds.h"
+
+namespace {
+constexpr int ACCOUNT_LINES = 3;
+
+// "1h02m", "4m05s" or "12s"
+std::string formatDuration(const uint32_t ms) {
+  const uint32_t seconds = ms / 1000;
+  char text[16];
+  if (seconds >= 3600) {
+    snprintf(text, sizeof(text), "%luh%02lum", static_cast<unsigned long>(seconds / 3600),
+             static_cast<unsigned long>(seconds / 60 % 60));
+  } else if (seconds >= 60) {
+    snprintf(text, sizeof(text), "%lum%02lus", static_cast<unsigned long>(seconds / 60),
+             static_cast<unsigned long>(seconds % 60));
+  } else {
+    snprintf(text, sizeof(text), "%lus", static_cast<unsigned long>(seconds));
+  }
+  return text;
+}
+
+// Longest on screen first
+std::vector<uint8_t> accountsByTime() {
+  std::vector<uint8_t> order(ENERGY_LEDGER.getAccountCount());
+  for (uint8_t i = 0; i < order.size(); i++) {
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(), [](const uint8_t a, const uint8_t b) {
+    return ENERGY_LEDGER.getAccount(a).counters[EnergyLedger::ACTIVE_MS] >
+           ENERGY_LEDGER.getAccount(b).counters[EnergyLedger::ACTIVE_MS];
+  });
+  return order;
+}
+}  // namespace
+
+void EnergyUsageActivity::onEnter() {
+  Activity::onEnter();
+  page = 0;
+  requestUpdate();
+}
+
+void EnergyUsageActivity::loop() {
+  if (mappedInput.wasPressed(MappedInputManager::Button::Back)) {
+    finish();
+    return;
+  }
+  if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
+    ENERGY_LEDGER.reset();
+    page = 0;
+    requestUpdate();
+    return;
+  }
+
+  buttonNavigator.onNextRelease([this] {
+    page = ButtonNavigator::nextIndex(page, pageCount);
+    requestUpdate();
+  });
+  buttonNavigator.onPreviousRelease([this] {
+    page = ButtonNavigator::previousIndex(page, pageCount);
+    requestUpdate();
+  });
+}
+
+void EnergyUsageActivity::render(RenderLock&&) {
+  const auto& metrics = UITheme::getInstance().getMetrics();
+  const auto pageWidth = renderer.getScreenWidth();
+  const auto pageHeight = renderer.getScreenHeight();
+  const int textWidth = pageWidth - metrics.contentSidePadding * 2;
+  const int lineHeight = renderer.getLineHeight(SMALL_FONT_ID);
+  const int normalMhz = powerManager.getResidency().normalMhz;
+
+  renderer.clearScreen();
+  GUI.drawHeader(renderer, Rect{0, metrics.topPadding, pageWidth, metrics.headerHeight}, tr(STR_ENERGY_USAGE));
+
+  int y = metrics.topPadding + metrics.headerHeight + metrics.verticalSpacing;
+  const std::string sleeps =
+      std::string(tr(STR_SLEEPS_SINCE_RESET)) + ": " + std::to_string(ENERGY_LEDGER.getSleepCount());
+  renderer.drawText(UI_10_FONT_ID, metrics.contentSidePadding, y, sleeps.c_str());
+  y += renderer.getLineHeight(UI_10_FONT_ID) + metrics.verticalSpacing;
+
+  const auto order = accountsByTime();
+  const int accountHeight = lineHeight * ACCOUNT_LINES + metrics.verticalSpacing;
+  const int listBottom = pageHeight - metrics.buttonHintsHeight - metrics.verticalSpacing;
+  const int perPage = std::max(1, (listBottom - y) / accountHeight);
+  pageCount = std::max(1, (static_cast<int>(order.size()) + perPage - 1) / perPage);
+  const int shownPage = std::min(page, pageCount - 1);
+
+  char line[160];
+  for (int i = shownPage * perPage; i < static_cast<int>(order.size()) && i < (shownPage + 1) * perPage; i++) {
+    const EnergyLedger::Account& account = ENERGY_LEDGER.getAccount(order[i]);
+    const uint32_t* counters = account.counters;
+
+    snprintf(line, sizeof(line), "%s  %s", account.name, formatDuration(counters[EnergyLedger::ACTIVE_MS]).c_str());
+    renderer.drawText(SMALL_FONT_ID, metrics.contentSidePadding, y, line, true, EpdFontFamily::BOLD);
+    y += lineHeight;
+
+    snprintf(line, sizeof(line), "CPU %dMHz %s (boost %s), %dMHz %s  WiFi %s  SD %s", normalMhz,
+             formatDuration(counters[EnergyLedger::CPU_NORMAL_MS]).c_str(),
+             formatDuration(counters[EnergyLedger::CPU_BOOSTED_MS]).c_str(), HalPowerManager::LOW_POWER_FREQ,
+             formatDuration(counters[EnergyLedger::CPU_LOW_POWER_MS]).c_str(),
+             formatDuration(counters[EnergyLedger::WIFI_MS]).c_str(),
+             formatDuration(counters[EnergyLedger::SD_BUSY_MS]).c_str());
+    renderer.drawText(SMALL_FONT_ID, metrics.contentSidePadding, y,
+                      renderer.truncatedText(SMALL_FONT_ID, line, textWidth).c_str());
+    y += lineHeight;
+
+    snprintf(line, sizeof(line), "Refresh full %lu  half %lu  fast %lu  window %lu  gray %lu",
+             static_cast<unsigned long>(counters[EnergyLedger::FULL_REFRESHES]),
+             static_cast<unsigned long>(counters[EnergyLedger::HALF_REFRESHES]),
+             static_cast<unsigned long>(counters[EnergyLedger::FAST_REFRESHES]),
+             static_cast<unsigned long>(counters[EnergyLedger::WINDOW_REFRESHES]),
+             static_cast<unsigned long>(counters[EnergyLedger::GRAY_REFRESHES]));
+    renderer.drawText(SMALL_FONT_ID, metrics.contentSidePadding, y,
+                      renderer.truncatedText(SMALL_FONT_ID, line, textWidth).c_str());
+    y += lineHeight + metrics.verticalSpacing;
+  }
+
+  const auto labels = mappedInput.mapLabels(tr(STR_BACK), tr(STR_RESET), tr(STR_DIR_UP), tr(STR_DIR_DOWN));
+  GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
+  renderer.displayBuffer();
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "../Activity.h"
+#include "util/ButtonNavigator.h"
+
+/**
+ * Debug screen listing the energy ledger: for each activity, its time on screen, at each CPU frequency, with WiFi on
+ * and with the SD card busy, and its panel updates by refresh mode. Confirm resets the ledger.
+ */
+class EnergyUsageActivity final : public Activity {
+ public:
+  explicit EnergyUsageActivity(GfxRenderer& renderer, MappedInputManager& mappedInput)
+      : Activity("EnergyUsage", renderer, mappedInput) {}
+
+  void onEnter() override;
+  void loop() override;
+  void render(RenderLock&&) override;
+
+ private:
+  ButtonNavigator buttonNavigator;
+  int page = 0;
+  int pageCount = 1;  // Set by render(), from how many accounts fit on the screen
+};
@@ -2,6 +2,8 @@
 
 #include <GfxRenderer.h>
 #include <I18n.h>
+#include <KOReaderSyncJournal.h>
+#include <Logging.h>
 #include <WiFi.h>
 
 #include "MappedInputManager.h"
@@ -25,6 +27,9 @@ void OtaUpdateActivity::onWifiSelectionComplete(const bool success) {
   }
   requestUpdateAndWait();
 
+  // The radio is up anyway; send reading positions queued since the last sync
+  KOReaderSyncJournal::flush();
+
   const auto res = updater.checkForUpdate();
   if (res != OtaUpdater::OK) {
     LOG_DBG("OTA", "Update check failed: %d", res);
@@ -53,6 +58,14 @@ void OtaUpdateActivity::onWifiSelectionComplete(const bool success) {
 void OtaUpdateActivity::onEnter() {
   Activity::onEnter();
 
+  // A release downloaded in the background needs no WiFi; it can be installed now rather than on the next sleep
+  if (OtaUpdater::hasStagedUpdate(&stagedVersion) && stagedVersion != CROSSPOINT_VERSION) {
+    state = UPDATE_STAGED;
+    stagedAccepted = OtaUpdater::hasAcceptedUpdate();
+    requestUpdate();
+    return;
+  }
+
   // Turn on WiFi immediately
   LOG_DBG("OTA", "Turning on WiFi...");
   WiFi.mode(WIFI_STA);
@@ -87,7 +100,10 @@ void OtaUpdateActivity::render(RenderLock&&) {
   float updaterProgress = 0;
   if (state == UPDATE_IN_PROGRESS) {
     LOG_DBG("OTA", "Update progress: %d / %d", updater.getProcessedSize(), updater.getTotalSize());
-    updaterProgress = static_cast<float>(updater.getProcessedSize()) / static_cast<float>(updater.getTotalSize());
+    // A staged update is installed from the card without progress reports
+    if (updater.getTotalSize() > 0) {
+      updaterProgress = static_cast<float>(updater.getProcessedSize()) / static_cast<float>(updater.getTotalSize());
+    }
     // Only update every 2% at the most
     if (static_cast<int>(updaterProgress * 50) == lastUpdaterPercentage / 2) {
       return;
@@ -106,6 +122,15 @@ void OtaUpdateActivity::render(RenderLock&&) {
 
     const auto labels = mappedInput.mapLabels(tr(STR_CANCEL), tr(STR_UPDATE), "", "");
     GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
+  } else if (state == UPDATE_STAGED) {
+    renderer.drawCenteredText(UI_10_FONT_ID, top, tr(STR_UPDATE_DOWNLOADED), true, EpdFontFamily::BOLD);
+    renderer.drawText(UI_10_FONT_ID, metrics.contentSidePadding, top + height + metrics.verticalSpacing,
+                      (std::string(tr(STR_NEW_VERSION)) + stagedVersion).c_str());
+    renderer.drawText(UI_10_FONT_ID, metrics.contentSidePadding, top + height * 2 + metrics.verticalSpacing * 2,
+                      stagedAccepted ? tr(STR_INSTALLS_ON_SLEEP) : tr(STR_INSTALL_NOW_OR_ON_SLEEP));
+
+    const auto labels = mappedInput.mapLabels(tr(STR_BACK), tr(STR_UPDATE), stagedAccepted ? "" : tr(STR_ON_SLEEP), "");
+    GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
   } else if (state == UPDATE_IN_PROGRESS) {
     renderer.drawCenteredText(UI_10_FONT_ID, top, tr(STR_UPDATING));
 
@@ -178,6 +203,31 @@ void OtaUpdateActivity::loop() {
     return;
   }
 
+  if (state == UPDATE_STAGED) {
+    if (mappedInput.wasPressed(MappedInputManager::Button::Confirm)) {
+      {
+        RenderLock lock(*this);
+        state = UPDATE_IN_PROGRESS;
+      }
+      requestUpdateAndWait();
+      const auto res = OtaUpdater::installStagedUpdate();
+      {
+        RenderLock lock(*this);
+        state = res == OtaUpdater::OK ? FINISHED : FAILED;
+      }
+      requestUpdate();
+    } else if (!stagedAccepted && mappedInput.wasPressed(MappedInputManager::Button::Left)) {
+      if (OtaUpdater::acceptStagedUpdate()) {
+        RenderLock lock(*this);
+        stagedAccepted = true;
+      }
+      requestUpdate();
+    } else if (mappedInput.wasPressed(MappedInputManager::Button::Back)) {
+      finish();
+    }
+    return;
+  }
+
   if (state == FAILED) {
     if (mappedInput.wasPressed(MappedInputManager::Button::Back)) {
       finish();
@@ -193,6 +243,7 @@ void OtaUpdateActivity::loop() {
   }
 
   if (state == SHUTTING_DOWN) {
+    logFlush();
     ESP.restart();
   }
 }
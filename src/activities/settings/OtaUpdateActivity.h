@@ -8,6 +8,7 @@ class OtaUpdateActivity : public Activity {
     WIFI_SELECTION,
     CHECKING_FOR_UPDATE,
     WAITING_CONFIRMATION,
+    UPDATE_STAGED,  // Downloaded in the background, installed now or, once accepted, on the next sleep
     UPDATE_IN_PROGRESS,
     NO_UPDATE,
     FAILED,
@@ -21,6 +22,8 @@ class OtaUpdateActivity : public Activity {
   State state = WIFI_SELECTION;
   unsigned int lastUpdaterPercentage = UNINITIALIZED_PERCENTAGE;
   OtaUpdater updater;
+  std::string stagedVersion;
+  bool stagedAccepted = false;
 
   void onWifiSelectionComplete(bool success);
 
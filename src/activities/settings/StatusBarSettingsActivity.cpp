@@ -11,8 +11,9 @@
 #include "fontIds.h"
 
 namespace {
-constexpr int MENU_ITEMS = 6;
+constexpr int MENU_ITEMS = 7;
 const StrId menuNames[MENU_ITEMS] = {StrId::STR_CHAPTER_PAGE_COUNT,
+                                     StrId::STR_BOOK_PAGE_NUMBERS,
                                      StrId::STR_BOOK_PROGRESS_PERCENTAGE,
                                      StrId::STR_PROGRESS_BAR,
                                      StrId::STR_PROGRESS_BAR_THICKNESS,
@@ -95,19 +96,22 @@ void StatusBarSettingsActivity::handleSelection() {
     // Chapter Page Count
     SETTINGS.statusBarChapterPageCount = (SETTINGS.statusBarChapterPageCount + 1) % 2;
   } else if (selectedIndex == 1) {
+    // Book Page Numbers
+    SETTINGS.statusBarBookPageNumbers = (SETTINGS.statusBarBookPageNumbers + 1) % 2;
+  } else if (selectedIndex == 2) {
     // Book Progress %
     SETTINGS.statusBarBookProgressPercentage = (SETTINGS.statusBarBookProgressPercentage + 1) % 2;
-  } else if (selectedIndex == 2) {
+  } else if (selectedIndex == 3) {
     // Progress Bar
     SETTINGS.statusBarProgressBar = (SETTINGS.statusBarProgressBar + 1) % PROGRESS_BAR_ITEMS;
-  } else if (selectedIndex == 3) {
+  } else if (selectedIndex == 4) {
     // Progress Bar Thickness
     SETTINGS.statusBarProgressBarThickness =
         (SETTINGS.statusBarProgressBarThickness + 1) % PROGRESS_BAR_THICKNESS_ITEMS;
-  } else if (selectedIndex == 4) {
+  } else if (selectedIndex == 5) {
     // Chapter Title
     SETTINGS.statusBarTitle = (SETTINGS.statusBarTitle + 1) % TITLE_ITEMS;
-  } else if (selectedIndex == 5) {
+  } else if (selectedIndex == 6) {
     // Show Battery
     SETTINGS.statusBarBattery = (SETTINGS.statusBarBattery + 1) % 2;
   }
@@ -134,14 +138,16 @@ void StatusBarSettingsActivity::render(RenderLock&&) {
         if (index == 0) {
           return SETTINGS.statusBarChapterPageCount ? tr(STR_SHOW) : tr(STR_HIDE);
         } else if (index == 1) {
-          return SETTINGS.statusBarBookProgressPercentage ? tr(STR_SHOW) : tr(STR_HIDE);
+          return SETTINGS.statusBarBookPageNumbers ? tr(STR_STATE_ON) : tr(STR_STATE_OFF);
         } else if (index == 2) {
-          return I18N.get(progressBarNames[SETTINGS.statusBarProgressBar]);
+          return SETTINGS.statusBarBookProgressPercentage ? tr(STR_SHOW) : tr(STR_HIDE);
         } else if (index == 3) {
-          return I18N.get(progressBarThicknessNames[SETTINGS.statusBarProgressBarThickness]);
+          return I18N.get(progressBarNames[SETTINGS.statusBarProgressBar]);
         } else if (index == 4) {
-          return I18N.get(titleNames[SETTINGS.statusBarTitle]);
+          return I18N.get(progressBarThicknessNames[SETTINGS.statusBarProgressBarThickness]);
         } else if (index == 5) {
+          return I18N.get(titleNames[SETTINGS.statusBarTitle]);
+        } else if (index == 6) {
           return SETTINGS.statusBarBattery ? tr(STR_SHOW) : tr(STR_HIDE);
         } else {
           return tr(STR_HIDE);
@@ -1,9 +1,15 @@
 #include "BmpViewerActivity.h"
 
-#include <Bitmap.h>
 #include <GfxRenderer.h>
-#include <HalStorage.h>
 #include <I18n.h>
+#include <Logging.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
 
 #include "components/UITheme.h"
 #include "fontIds.h"
@@ -13,88 +19,372 @@ BmpViewerActivity::BmpViewerActivity(GfxRenderer& renderer, MappedInputManager&
 
 void BmpViewerActivity::onEnter() {
   Activity::onEnter();
-  // Removed the redundant initial renderer.clearScreen()
-
-  FsFile file;
 
-  const auto pageWidth = renderer.getScreenWidth();
-  const auto pageHeight = renderer.getScreenHeight();
-  Rect popupRect = GUI.drawPopup(renderer, tr(STR_LOADING_POPUP));
-  GUI.fillPopupProgress(renderer, popupRect, 20);  // Initial 20% progress
-  // 1. Open the file
-  if (Storage.openFileForRead("BMP", filePath, file)) {
-    Bitmap bitmap(file, true);
-
-    // 2. Parse headers to get dimensions
-    if (bitmap.parseHeaders() == BmpReaderError::Ok) {
-      int x, y;
-
-      if (bitmap.getWidth() > pageWidth || bitmap.getHeight() > pageHeight) {
-        float ratio = static_cast<float>(bitmap.getWidth()) / static_cast<float>(bitmap.getHeight());
-        const float screenRatio = static_cast<float>(pageWidth) / static_cast<float>(pageHeight);
-
-        if (ratio > screenRatio) {
-          // Wider than screen
-          x = 0;
-          y = std::round((static_cast<float>(pageHeight) - static_cast<float>(pageWidth) / ratio) / 2);
-        } else {
-          // Taller than screen
-          x = std::round((static_cast<float>(pageWidth) - static_cast<float>(pageHeight) * ratio) / 2);
-          y = 0;
-        }
-      } else {
-        // Center small images
-        x = (pageWidth - bitmap.getWidth()) / 2;
-        y = (pageHeight - bitmap.getHeight()) / 2;
+  {
+    RenderLock lock(*this);
+    if (!Storage.openFileForRead("BMP", filePath, file)) {
+      error = "Could not open file";
+    } else {
+      bitmap.reset(new (std::nothrow) Bitmap(file));
+      if (!bitmap || bitmap->parseHeaders() != BmpReaderError::Ok) {
+        error = "Invalid BMP File";
       }
+    }
+  }
+
+  // Without room for the tiles the fit view is all there is
+  if (!error) {
+    tilePixels = static_cast<uint8_t*>(malloc(TILE_SLOTS * TILE_BYTES));
+    if (!tilePixels) {
+      LOG_ERR("BMP", "Couldn't allocate the tile cache, zoom is off");
+    }
+  }
 
-      // 4. Prepare Rendering
-      const auto labels = mappedInput.mapLabels(tr(STR_BACK), "", "", "");
-      GUI.fillPopupProgress(renderer, popupRect, 50);
+  zoom = Zoom::Fit;
+  zoomChanged = true;
+  requestUpdate();
+}
 
-      renderer.clearScreen();
-      // Assuming drawBitmap defaults to 0,0 crop if omitted, or pass explicitly: drawBitmap(bitmap, x, y, pageWidth,
-      // pageHeight, 0, 0)
-      renderer.drawBitmap(bitmap, x, y, pageWidth, pageHeight, 0, 0);
+void BmpViewerActivity::onExit() {
+  Activity::onExit();
+  bitmap.reset();
+  file.close();
+  free(tilePixels);
+  tilePixels = nullptr;
+  std::fill(std::begin(tiles), std::end(tiles), Tile{});
+  renderer.clearScreen();
+  renderer.displayBuffer(HalDisplay::HALF_REFRESH);
+}
 
-      // Draw UI hints on the base layer
-      GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
-      // Single pass for non-grayscale images
+void BmpViewerActivity::loop() {
+  // Keep CPU awake/polling so 1st click works
+  Activity::loop();
 
-      renderer.displayBuffer(HalDisplay::HALF_REFRESH);
+  if (mappedInput.wasReleased(MappedInputManager::Button::Back)) {
+    activityManager.goToFileBrowser(filePath);
+    return;
+  }
+  if (error || !tilePixels) {
+    return;
+  }
 
-    } else {
-      // Handle file parsing error
-      renderer.clearScreen();
-      renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2, "Invalid BMP File");
-      const auto labels = mappedInput.mapLabels(tr(STR_BACK), "", "", "");
-      GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
-      renderer.displayBuffer(HalDisplay::HALF_REFRESH);
+  if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
+    {
+      RenderLock lock(*this);
+      nextZoom();
     }
+    requestUpdate();
+    return;
+  }
+  if (zoom == Zoom::Fit) {
+    return;
+  }
 
-    file.close();
+  int dx = 0;
+  int dy = 0;
+  if (mappedInput.wasReleased(MappedInputManager::Button::Left)) {
+    dx = -1;
+  } else if (mappedInput.wasReleased(MappedInputManager::Button::Right)) {
+    dx = 1;
+  } else if (mappedInput.wasReleased(MappedInputManager::Button::Up)) {
+    dy = -1;
+  } else if (mappedInput.wasReleased(MappedInputManager::Button::Down)) {
+    dy = 1;
   } else {
-    // Handle file open error
+    return;
+  }
+
+  const int oldX = viewX;
+  const int oldY = viewY;
+  {
+    RenderLock lock(*this);
+    pan(dx, dy);
+  }
+  if (viewX != oldX || viewY != oldY) {
+    requestUpdate();
+  }
+}
+
+void BmpViewerActivity::nextZoom() {
+  const int screenWidth = renderer.getScreenWidth();
+  const int screenHeight = renderer.getScreenHeight();
+  const int width = bitmap->getWidth();
+  const int height = bitmap->getHeight();
+
+  // The point at the middle of the screen stays there
+  int centerX = width / 2;
+  int centerY = height / 2;
+  if (zoom != Zoom::Fit) {
+    centerX = viewX + std::min(width, screenWidth / zoomFactor()) / 2;
+    centerY = viewY + std::min(height, screenHeight / zoomFactor()) / 2;
+  }
+
+  switch (zoom) {
+    case Zoom::Fit:
+      // An image that fits the screen is already shown at 1:1
+      zoom = width <= screenWidth && height <= screenHeight ? Zoom::Double : Zoom::Actual;
+      break;
+    case Zoom::Actual:
+      zoom = Zoom::Double;
+      break;
+    case Zoom::Double:
+      zoom = Zoom::Fit;
+      break;
+  }
+  zoomChanged = true;
+
+  viewX = centerX - screenWidth / zoomFactor() / 2;
+  viewY = centerY - screenHeight / zoomFactor() / 2;
+  clampView();
+}
+
+void BmpViewerActivity::pan(const int dx, const int dy) {
+  viewX += dx * (renderer.getScreenWidth() / zoomFactor() / 2);
+  viewY += dy * (renderer.getScreenHeight() / zoomFactor() / 2);
+  clampView();
+}
+
+void BmpViewerActivity::clampView() {
+  const int maxX = std::max(0, bitmap->getWidth() - renderer.getScreenWidth() / zoomFactor());
+  const int maxY = std::max(0, bitmap->getHeight() - renderer.getScreenHeight() / zoomFactor());
+  viewX = std::clamp(viewX, 0, maxX);
+  viewY = std::clamp(viewY, 0, maxY);
+}
+
+void BmpViewerActivity::render(RenderLock&&) {
+  const auto pageHeight = renderer.getScreenHeight();
+
+  if (error) {
     renderer.clearScreen();
-    renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2, "Could not open file");
+    renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2, error);
     const auto labels = mappedInput.mapLabels(tr(STR_BACK), "", "", "");
     GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
     renderer.displayBuffer(HalDisplay::HALF_REFRESH);
+    return;
   }
+
+  if (zoom == Zoom::Fit) {
+    renderFit();
+  } else {
+    renderZoomed();
+  }
+
+  const char* zoomLabel = tilePixels ? tr(STR_ZOOM) : "";
+  const auto labels = zoom == Zoom::Fit
+                          ? mappedInput.mapLabels(tr(STR_BACK), zoomLabel, "", "")
+                          : mappedInput.mapLabels(tr(STR_BACK), zoomLabel, tr(STR_DIR_LEFT), tr(STR_DIR_RIGHT));
+  GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
+
+  // A pan redraws the same kind of picture a half screen along, which a fast refresh handles
+  renderer.displayBuffer(zoomChanged ? HalDisplay::HALF_REFRESH : HalDisplay::FAST_REFRESH);
+  zoomChanged = false;
 }
 
-void BmpViewerActivity::onExit() {
-  Activity::onExit();
+void BmpViewerActivity::renderFit() {
+  const auto pageWidth = renderer.getScreenWidth();
+  const auto pageHeight = renderer.getScreenHeight();
+  Rect popupRect = GUI.drawPopup(renderer, tr(STR_LOADING_POPUP));
+  GUI.fillPopupProgress(renderer, popupRect, 20);  // Initial 20% progress
+
+  // Dithered, unlike the tiles: the fit view is decoded in one pass from the top
+  Bitmap fitBitmap(file, true);
+  if (fitBitmap.parseHeaders() != BmpReaderError::Ok) {
+    renderer.clearScreen();
+    renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2, "Invalid BMP File");
+    return;
+  }
+
+  int x, y;
+  if (fitBitmap.getWidth() > pageWidth || fitBitmap.getHeight() > pageHeight) {
+    float ratio = static_cast<float>(fitBitmap.getWidth()) / static_cast<float>(fitBitmap.getHeight());
+    const float screenRatio = static_cast<float>(pageWidth) / static_cast<float>(pageHeight);
+
+    if (ratio > screenRatio) {
+      // Wider than screen
+      x = 0;
+      y = std::round((static_cast<float>(pageHeight) - static_cast<float>(pageWidth) / ratio) / 2);
+    } else {
+      // Taller than screen
+      x = std::round((static_cast<float>(pageWidth) - static_cast<float>(pageHeight) * ratio) / 2);
+      y = 0;
+    }
+  } else {
+    // Center small images
+    x = (pageWidth - fitBitmap.getWidth()) / 2;
+    y = (pageHeight - fitBitmap.getHeight()) / 2;
+  }
+
+  GUI.fillPopupProgress(renderer, popupRect, 50);
   renderer.clearScreen();
-  renderer.displayBuffer(HalDisplay::HALF_REFRESH);
+  renderer.drawBitmap(fitBitmap, x, y, pageWidth, pageHeight, 0, 0);
 }
 
-void BmpViewerActivity::loop() {
-  // Keep CPU awake/polling so 1st click works
-  Activity::loop();
+void BmpViewerActivity::renderZoomed() {
+  const int screenWidth = renderer.getScreenWidth();
+  const int screenHeight = renderer.getScreenHeight();
+  const int scale = zoomFactor();
+  const int width = bitmap->getWidth();
+  const int height = bitmap->getHeight();
+  const int spanWidth = screenWidth / scale;
+  const int spanHeight = screenHeight / scale;
 
-  if (mappedInput.wasReleased(MappedInputManager::Button::Back)) {
-    activityManager.goToFileBrowser(filePath);
-    return;
+  // An image smaller than the screen sits in its middle, as in the fit view
+  const int originX = width < spanWidth ? (screenWidth - width * scale) / 2 : -viewX * scale;
+  const int originY = height < spanHeight ? (screenHeight - height * scale) / 2 : -viewY * scale;
+
+  const int firstColumn = viewX / TILE_SIZE;
+  const int lastColumn = (std::min(width, viewX + spanWidth) - 1) / TILE_SIZE;
+  const int firstRow = viewY / TILE_SIZE;
+  const int lastRow = (std::min(height, viewY + spanHeight) - 1) / TILE_SIZE;
+  const int columns = lastColumn - firstColumn + 1;
+  std::vector<int16_t> slots(columns * (lastRow - firstRow + 1));
+  loadTiles(firstColumn, lastColumn, firstRow, lastRow, slots.data());
+
+  renderer.clearScreen();
+  for (int row = firstRow; row <= lastRow; row++) {
+    for (int column = firstColumn; column <= lastColumn; column++) {
+      const int slot = slots[(row - firstRow) * columns + column - firstColumn];
+      if (slot < 0) {
+        continue;
+      }
+      const uint8_t* pixels = tilePixels + slot * TILE_BYTES;
+      const int tileX = originX + column * TILE_SIZE * scale;
+      const int tileY = originY + row * TILE_SIZE * scale;
+
+      for (int y = 0; y < TILE_SIZE; y++) {
+        const int screenY = tileY + y * scale;
+        if (screenY > screenHeight - scale) {
+          break;
+        }
+        if (screenY < 0) {
+          continue;
+        }
+        for (int byte = 0; byte < TILE_SIZE / 8; byte++) {
+          const uint8_t bits = pixels[y * (TILE_SIZE / 8) + byte];
+          if (!bits) {
+            continue;
+          }
+          for (int bit = 0; bit < 8; bit++) {
+            const int screenX = tileX + (byte * 8 + bit) * scale;
+            if (!(bits & 0x80 >> bit) || screenX < 0 || screenX > screenWidth - scale) {
+              continue;
+            }
+            for (int dy = 0; dy < scale; dy++) {
+              for (int dx = 0; dx < scale; dx++) {
+                renderer.drawPixel(screenX + dx, screenY + dy);
+              }
+            }
+          }
+        }
+      }
+    }
   }
-}
\ No newline at end of file
+}
+
+void BmpViewerActivity::loadTiles(const int firstColumn, const int lastColumn, const int firstRow, const int lastRow,
+                                  int16_t* slots) {
+  const int columns = lastColumn - firstColumn + 1;
+  frame++;
+
+  // Tiles already cached are marked as in use first, so decoding the others doesn't evict them
+  for (int row = firstRow; row <= lastRow; row++) {
+    for (int column = firstColumn; column <= lastColumn; column++) {
+      int16_t& slot = slots[(row - firstRow) * columns + column - firstColumn];
+      slot = -1;
+      for (int i = 0; i < TILE_SLOTS; i++) {
+        if (tiles[i].lastUsed != 0 && tiles[i].column == column && tiles[i].row == row) {
+          tiles[i].lastUsed = frame;
+          slot = static_cast<int16_t>(i);
+          break;
+        }
+      }
+    }
+  }
+
+  std::vector<int> missingColumns;
+  std::vector<int> missingSlots;
+  for (int row = firstRow; row <= lastRow; row++) {
+    missingColumns.clear();
+    missingSlots.clear();
+    for (int column = firstColumn; column <= lastColumn; column++) {
+      int16_t& slot = slots[(row - firstRow) * columns + column - firstColumn];
+      if (slot >= 0) {
+        continue;
+      }
+      // Least recently drawn slot, empty ones first
+      int victim = -1;
+      for (int i = 0; i < TILE_SLOTS; i++) {
+        if (tiles[i].lastUsed != frame && (victim < 0 || tiles[i].lastUsed < tiles[victim].lastUsed)) {
+          victim = i;
+        }
+      }
+      if (victim < 0) {
+        LOG_ERR("BMP", "Tile cache is too small for the screen");
+        break;
+      }
+      tiles[victim] = {static_cast<uint16_t>(column), static_cast<uint16_t>(row), frame};
+      slot = static_cast<int16_t>(victim);
+      missingColumns.push_back(column);
+      missingSlots.push_back(victim);
+    }
+    if (missingColumns.empty()) {
+      continue;
+    }
+
+    // The tiles of a row share their image rows, so they are decoded together
+    if (!decodeTileRow(row, missingColumns.data(), missingSlots.data(), static_cast<int>(missingColumns.size()))) {
+      for (size_t i = 0; i < missingColumns.size(); i++) {
+        tiles[missingSlots[i]].lastUsed = 0;
+        slots[(row - firstRow) * columns + missingColumns[i] - firstColumn] = -1;
+      }
+    }
+  }
+}
+
+bool BmpViewerActivity::decodeTileRow(const int row, const int* columns, const int* columnSlots, const int count) {
+  const int width = bitmap->getWidth();
+  const int top = row * TILE_SIZE;
+  const int bandHeight = std::min(TILE_SIZE, bitmap->getHeight() - top);
+
+  auto* outputRow = static_cast<uint8_t*>(malloc((width + 3) / 4));
+  auto* rowBytes = static_cast<uint8_t*>(malloc(bitmap->getRowBytes()));
+  if (!outputRow || !rowBytes) {
+    LOG_ERR("BMP", "Couldn't allocate BMP row buffers");
+    free(outputRow);
+    free(rowBytes);
+    return false;
+  }
+
+  for (int i = 0; i < count; i++) {
+    memset(tilePixels + columnSlots[i] * TILE_BYTES, 0, TILE_BYTES);
+  }
+
+  // The band's rows lie together in the file, so it is read from whichever of its ends comes first there
+  const bool topDown = bitmap->isTopDown();
+  bool ok = bitmap->seekToRow(topDown ? top : top + bandHeight - 1) == BmpReaderError::Ok;
+  for (int i = 0; ok && i < bandHeight; i++) {
+    if (bitmap->readNextRow(outputRow, rowBytes) != BmpReaderError::Ok) {
+      LOG_ERR("BMP", "Failed to read row %d", top + (topDown ? i : bandHeight - 1 - i));
+      ok = false;
+      break;
+    }
+    const int y = topDown ? i : bandHeight - 1 - i;
+
+    for (int tile = 0; tile < count; tile++) {
+      uint8_t* pixels = tilePixels + columnSlots[tile] * TILE_BYTES + y * (TILE_SIZE / 8);
+      const int left = columns[tile] * TILE_SIZE;
+      const int tileWidth = std::min(TILE_SIZE, width - left);
+      for (int x = 0; x < tileWidth; x++) {
+        const int sourceX = left + x;
+        // Only white stays white in the BW frame, as drawBitmap() draws it
+        if ((outputRow[sourceX >> 2] >> (6 - ((sourceX & 3) << 1)) & 0x3) != 3) {
+          pixels[x >> 3] |= 0x80 >> (x & 7);
+        }
+      }
+    }
+  }
+
+  free(outputRow);
+  free(rowBytes);
+  return ok;
+}
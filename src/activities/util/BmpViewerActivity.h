@@ -1,11 +1,20 @@
 #pragma once
 
-#include <functional>
+#include <Bitmap.h>
+#include <HalStorage.h>
+
+#include <cstdint>
+#include <memory>
 #include <string>
 
 #include "../Activity.h"
 #include "MappedInputManager.h"
 
+/**
+ * Shows a BMP scaled to fit the screen, or at 1:1 and 2:1 panned a half screen at a time. A zoomed view decodes only
+ * the tiles of the image it shows, seeking straight to their rows, and keeps them in a tile cache so a pan decodes
+ * just the strip it brings into view.
+ */
 class BmpViewerActivity final : public Activity {
  public:
   BmpViewerActivity(GfxRenderer& renderer, MappedInputManager& mappedInput, std::string filePath);
@@ -13,7 +22,45 @@ class BmpViewerActivity final : public Activity {
   void onEnter() override;
   void onExit() override;
   void loop() override;
+  void render(RenderLock&&) override;
 
  private:
+  enum class Zoom : uint8_t { Fit, Actual, Double };
+
+  // Square pieces of the image at 1:1, a bit per pixel as the BW frame shows it (set for black)
+  static constexpr int TILE_SIZE = 64;
+  static constexpr int TILE_BYTES = TILE_SIZE / 8 * TILE_SIZE;
+  // A 1:1 screen straddling tile edges on all four sides, 9 x 14 tiles, fits with room to spare
+  static constexpr int TILE_SLOTS = 128;
+
+  struct Tile {
+    uint16_t column;
+    uint16_t row;
+    uint32_t lastUsed;  // Frame the tile was last drawn in, 0 for an empty slot
+  };
+
   std::string filePath;
-};
\ No newline at end of file
+  FsFile file;
+  std::unique_ptr<Bitmap> bitmap;  // Undithered, so tiles decoded apart still meet without seams
+  const char* error = nullptr;
+  Zoom zoom = Zoom::Fit;
+  bool zoomChanged = true;
+  // Image pixel at the top left corner of a zoomed screen
+  int viewX = 0;
+  int viewY = 0;
+
+  uint8_t* tilePixels = nullptr;  // TILE_SLOTS * TILE_BYTES
+  Tile tiles[TILE_SLOTS] = {};
+  uint32_t frame = 0;
+
+  int zoomFactor() const { return zoom == Zoom::Double ? 2 : 1; }
+  void nextZoom();
+  void pan(int dx, int dy);
+  void clampView();
+  void renderFit();
+  void renderZoomed();
+  // Slots of the tiles in [firstColumn, lastColumn] x [firstRow, lastRow], decoding those not cached; -1 where a tile
+  // couldn't be had
+  void loadTiles(int firstColumn, int lastColumn, int firstRow, int lastRow, int16_t* slots);
+  bool decodeTileRow(int row, const int* columns, const int* columnSlots, int count);
+};
@@ -733,7 +733,7 @@ void KeyboardEntryActivity::render(RenderLock&&) {
 
   GUI.drawSideButtonHints(renderer, ">", "<");
 
-  renderer.displayBuffer();
+  renderer.displayChanges();
 }
 
 void KeyboardEntryActivity::onComplete(std::string text) {
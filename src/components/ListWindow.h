@@ -0,0 +1,52 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+/**
+ * Rows of a long list around the page on screen, read from their source by index: the page shown and the pages
+ * either side of it, so a list never holds more than three pages of rows however long it is.
+ *
+ * The loader fills rows with count rows starting at first; it may return fewer at the end of the source.
+ */
+template <typename Row>
+class ListWindow {
+ public:
+  using Loader = std::function<void(int first, int count, std::vector<Row>& rows)>;
+
+  explicit ListWindow(Loader loader) : loader(std::move(loader)) {}
+
+  // Makes sure the window holds the page starting at pageStart, and with neighbours the pages either side of it
+  // too, reading them all in one call to the loader when it doesn't
+  void load(const int pageStart, const int pageItems, const int totalItems, const bool neighbours) {
+    const int first = std::max(0, pageStart - pageItems);
+    const int last = std::min(totalItems, pageStart + 2 * pageItems);
+    const int neededFirst = neighbours ? first : pageStart;
+    const int neededLast = neighbours ? last : std::min(totalItems, pageStart + pageItems);
+    if (neededFirst >= start && neededLast <= start + static_cast<int>(rows.size())) {
+      return;
+    }
+    start = first;
+    rows.clear();
+    loader(first, last - first, rows);
+  }
+
+  // The row at index, or nullptr if it is outside the window
+  const Row* at(const int index) const {
+    const int offset = index - start;
+    return offset >= 0 && offset < static_cast<int>(rows.size()) ? &rows[offset] : nullptr;
+  }
+
+  void clear() {
+    rows.clear();
+    rows.shrink_to_fit();
+    start = 0;
+  }
+
+ private:
+  Loader loader;
+  std::vector<Row> rows;
+  int start = 0;
+};
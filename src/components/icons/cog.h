@@ -1,8 +1,10 @@
 #pragma once
+#include <GfxRenderer.h>
+
 #include <cstdint>
 
 // size: 32x32
-static const uint8_t CogIcon[] = {
+static const uint8_t CogIconPortrait[] = {
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xBE, 0x7D, 0xFF, 0xFF, 0x1C, 0x38,
     0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x82, 0x41, 0xFF, 0xFF, 0x0E, 0x70, 0xFF, 0xF6, 0x3E, 0x7C, 0x6F, 0xE0, 0x7E,
     0x7E, 0x07, 0xF0, 0xFE, 0x7F, 0x0F, 0xF8, 0xFE, 0x7F, 0x1F, 0xF9, 0xFE, 0x7F, 0x9F, 0xF9, 0xF8, 0x1F, 0x9F, 0xF3,
@@ -10,3 +12,29 @@ static const uint8_t CogIcon[] = {
     0xF9, 0x0E, 0x70, 0x9F, 0xF8, 0x3F, 0xFC, 0x1F, 0xF0, 0x7F, 0xFE, 0x0F, 0xE0, 0x7F, 0xFE, 0x07, 0xF6, 0x3F, 0xFC,
     0x6F, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0x83, 0xC1, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x1C, 0x38, 0xFF, 0xFF, 0xBE,
     0x7D, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t CogIconLandscapeClockwise[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xBE, 0x7D, 0xFF, 0xFF, 0x1C, 0x38,
+    0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x83, 0xC1, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xF6, 0x3F, 0xE0, 0x6F, 0xE0, 0x7F,
+    0xE6, 0x07, 0xF0, 0xFF, 0xCF, 0x0F, 0xF8, 0xFF, 0x8F, 0x1F, 0xF9, 0xFE, 0x1F, 0x9F, 0xF9, 0xF8, 0x1F, 0x9F, 0xF3,
+    0xF9, 0x1F, 0xCF, 0xC0, 0x01, 0xCF, 0xC3, 0xC0, 0x01, 0xCF, 0xC3, 0xF3, 0xF9, 0x1F, 0xCF, 0xF9, 0xF8, 0x1F, 0x9F,
+    0xF9, 0xFE, 0x1F, 0x9F, 0xF8, 0xFF, 0x8F, 0x1F, 0xF0, 0xFF, 0xCF, 0x0F, 0xE0, 0x7F, 0xE6, 0x07, 0xF6, 0x3F, 0xE0,
+    0x6F, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0x83, 0xC1, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x1C, 0x38, 0xFF, 0xFF, 0xBE,
+    0x7D, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t CogIconPortraitInverted[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xBE, 0x7D, 0xFF, 0xFF, 0x1C, 0x38,
+    0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x83, 0xC1, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xF6, 0x3F, 0xFC, 0x6F, 0xE0, 0x7F,
+    0xFE, 0x07, 0xF0, 0x7F, 0xFE, 0x0F, 0xF8, 0x3F, 0xFC, 0x1F, 0xF9, 0x0E, 0x70, 0x9F, 0xF9, 0xC0, 0x03, 0x9F, 0xF3,
+    0xE1, 0x87, 0xCF, 0xC3, 0xF1, 0x8F, 0xC3, 0xC3, 0xF3, 0xCF, 0xC3, 0xF3, 0xF8, 0x1F, 0xCF, 0xF9, 0xF8, 0x1F, 0x9F,
+    0xF9, 0xFE, 0x7F, 0x9F, 0xF8, 0xFE, 0x7F, 0x1F, 0xF0, 0xFE, 0x7F, 0x0F, 0xE0, 0x7E, 0x7E, 0x07, 0xF6, 0x3E, 0x7C,
+    0x6F, 0xFF, 0x0E, 0x70, 0xFF, 0xFF, 0x82, 0x41, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x1C, 0x38, 0xFF, 0xFF, 0xBE,
+    0x7D, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t CogIconLandscapeCounterClockwise[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xBE, 0x7D, 0xFF, 0xFF, 0x1C, 0x38,
+    0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x83, 0xC1, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xF6, 0x07, 0xFC, 0x6F, 0xE0, 0x67,
+    0xFE, 0x07, 0xF0, 0xF3, 0xFF, 0x0F, 0xF8, 0xF1, 0xFF, 0x1F, 0xF9, 0xF8, 0x7F, 0x9F, 0xF9, 0xF8, 0x1F, 0x9F, 0xF3,
+    0xF8, 0x9F, 0xCF, 0xC3, 0xF3, 0x80, 0x03, 0xC3, 0xF3, 0x80, 0x03, 0xF3, 0xF8, 0x9F, 0xCF, 0xF9, 0xF8, 0x1F, 0x9F,
+    0xF9, 0xF8, 0x7F, 0x9F, 0xF8, 0xF1, 0xFF, 0x1F, 0xF0, 0xF3, 0xFF, 0x0F, 0xE0, 0x67, 0xFE, 0x07, 0xF6, 0x07, 0xFC,
+    0x6F, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0x83, 0xC1, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x1C, 0x38, 0xFF, 0xFF, 0xBE,
+    0x7D, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const GfxRenderer::Icon CogIcon = {{CogIconPortrait, CogIconLandscapeClockwise,
+                                           CogIconPortraitInverted, CogIconLandscapeCounterClockwise}};
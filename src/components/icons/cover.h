@@ -1,8 +1,10 @@
 #pragma once
+#include <GfxRenderer.h>
+
 #include <cstdint>
 
 // size: 32x32
-static const uint8_t CoverIcon[] = {
+static const uint8_t CoverIconPortrait[] = {
     0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x1F, 0xE0, 0x00, 0x02, 0x1F, 0xE0, 0x00, 0x03,
     0x1F, 0xE0, 0x00, 0x03, 0x1F, 0xF0, 0x00, 0x01, 0x1F, 0xF0, 0x00, 0x01, 0x1F, 0xF0, 0x00, 0x01, 0x9F, 0xF8, 0x00,
     0x00, 0x9F, 0xF8, 0x00, 0x00, 0xDF, 0xFC, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
@@ -10,3 +12,29 @@ static const uint8_t CoverIcon[] = {
     0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0xDF, 0xF8, 0x00, 0x00, 0x9F, 0xF0, 0x00, 0x01,
     0x9F, 0xF0, 0x00, 0x01, 0x1F, 0xE0, 0x00, 0x01, 0x1F, 0xE0, 0x00, 0x03, 0x1F, 0xE0, 0x00, 0x02, 0x1F, 0xE0, 0x00,
     0x02, 0x1F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F};
+static const uint8_t CoverIconLandscapeClockwise[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xB7,
+    0xFF, 0x00, 0x19, 0x98, 0x00, 0x00, 0x31, 0x8C, 0x00, 0x00, 0xE1, 0x87, 0x00, 0x0F, 0x81, 0x81, 0xE0, 0x3C, 0x01,
+    0x80, 0x3C, 0x20, 0x01, 0x80, 0x04, 0x20, 0x01, 0x80, 0x04, 0x20, 0x01, 0x80, 0x04, 0x20, 0x01, 0x80, 0x04, 0x20,
+    0x01, 0x80, 0x04, 0x20, 0x01, 0x80, 0x04, 0x20, 0x01, 0x80, 0x04, 0x20, 0x01, 0x80, 0x04, 0x20, 0x01, 0x80, 0x04,
+    0x20, 0x01, 0x80, 0x04, 0x20, 0x01, 0x80, 0x04, 0x20, 0x01, 0x80, 0x04, 0x20, 0x01, 0x80, 0x04, 0x20, 0x03, 0xC0,
+    0x04, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x0F, 0xF0, 0x07, 0xE0, 0x1F, 0xF8, 0x07, 0xE0, 0x7F, 0xFE, 0x07, 0xE3, 0xFF,
+    0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t CoverIconPortraitInverted[] = {
+    0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF8, 0x40, 0x00, 0x07, 0xF8, 0x40, 0x00,
+    0x07, 0xF8, 0xC0, 0x00, 0x07, 0xF8, 0x80, 0x00, 0x07, 0xF8, 0x80, 0x00, 0x0F, 0xF9, 0x80, 0x00, 0x0F, 0xF9, 0x00,
+    0x00, 0x1F, 0xFB, 0x00, 0x00, 0x1F, 0xF6, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xF0,
+    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
+    0xFC, 0x00, 0x00, 0x7F, 0xF6, 0x00, 0x00, 0x3F, 0xFB, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x00, 0x1F, 0xF9, 0x80, 0x00,
+    0x0F, 0xF8, 0x80, 0x00, 0x0F, 0xF8, 0x80, 0x00, 0x0F, 0xF8, 0xC0, 0x00, 0x07, 0xF8, 0xC0, 0x00, 0x07, 0xF8, 0x40,
+    0x00, 0x07, 0xF8, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF};
+static const uint8_t CoverIconLandscapeCounterClockwise[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xC7, 0xE0, 0x7F, 0xFE,
+    0x07, 0xE0, 0x1F, 0xF8, 0x07, 0xE0, 0x0F, 0xF0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0x20, 0x03, 0xC0, 0x04, 0x20, 0x01,
+    0x80, 0x04, 0x20, 0x01, 0x80, 0x04, 0x20, 0x01, 0x80, 0x04, 0x20, 0x01, 0x80, 0x04, 0x20, 0x01, 0x80, 0x04, 0x20,
+    0x01, 0x80, 0x04, 0x20, 0x01, 0x80, 0x04, 0x20, 0x01, 0x80, 0x04, 0x20, 0x01, 0x80, 0x04, 0x20, 0x01, 0x80, 0x04,
+    0x20, 0x01, 0x80, 0x04, 0x20, 0x01, 0x80, 0x04, 0x20, 0x01, 0x80, 0x04, 0x3C, 0x01, 0x80, 0x3C, 0x07, 0x81, 0x81,
+    0xF0, 0x00, 0xE1, 0x87, 0x00, 0x00, 0x31, 0x8C, 0x00, 0x00, 0x19, 0x98, 0x00, 0xFF, 0xED, 0xB7, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const GfxRenderer::Icon CoverIcon = {{CoverIconPortrait, CoverIconLandscapeClockwise,
+                                             CoverIconPortraitInverted, CoverIconLandscapeCounterClockwise}};
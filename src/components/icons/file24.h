@@ -1,9 +1,28 @@
 #pragma once
+#include <GfxRenderer.h>
+
 #include <cstdint>
 
 // size: 24x24
-static const uint8_t File24Icon[] = {
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF0, 0x7F, 0xF1,
-    0xE2, 0x7F, 0xF9, 0xC6, 0x7F, 0xF9, 0x8E, 0x7F, 0xF9, 0x80, 0x7F, 0xF9, 0x80, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9,
-    0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9,
-    0x8F, 0xFF, 0xF1, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t File24IconPortrait[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF0, 0x7F, 0xF1, 0xE2,
+    0x7F, 0xF9, 0xC6, 0x7F, 0xF9, 0x8E, 0x7F, 0xF9, 0x80, 0x7F, 0xF9, 0x80, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF,
+    0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x8F, 0xFF, 0xF1,
+    0xC0, 0x00, 0x01, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t File24IconLandscapeClockwise[] = {
+    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE3, 0xFF, 0xC7, 0xE7, 0xFF, 0xE7, 0xE7, 0xFF, 0xE7, 0xE7,
+    0xFF, 0xE7, 0xE7, 0xFF, 0xE7, 0xE7, 0xFF, 0xE7, 0xE7, 0xFF, 0xE7, 0xE7, 0xFF, 0xE7, 0xE7, 0xFF, 0xE7, 0xE7, 0xFF,
+    0xE7, 0xE7, 0xFF, 0xE7, 0xE7, 0xFF, 0xE7, 0xE0, 0x3F, 0xE7, 0xE0, 0x1F, 0xE7, 0xF3, 0x9F, 0xE7, 0xF1, 0x9F, 0xE7,
+    0xF8, 0x9F, 0xE7, 0xFC, 0x1F, 0xC7, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF};
+static const uint8_t File24IconPortraitInverted[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x03, 0x8F, 0xFF, 0xF1, 0x9F,
+    0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF,
+    0xF9, 0x9F, 0xFF, 0x01, 0x9F, 0xFE, 0x01, 0x9F, 0xFE, 0x71, 0x9F, 0xFE, 0x63, 0x9F, 0xFE, 0x47, 0x8F, 0xFE, 0x0F,
+    0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t File24IconLandscapeCounterClockwise[] = {
+    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xE3, 0xF8, 0x3F, 0xE7, 0xF9, 0x1F, 0xE7, 0xF9, 0x8F, 0xE7,
+    0xF9, 0xCF, 0xE7, 0xF8, 0x07, 0xE7, 0xFC, 0x07, 0xE7, 0xFF, 0xE7, 0xE7, 0xFF, 0xE7, 0xE7, 0xFF, 0xE7, 0xE7, 0xFF,
+    0xE7, 0xE7, 0xFF, 0xE7, 0xE7, 0xFF, 0xE7, 0xE7, 0xFF, 0xE7, 0xE7, 0xFF, 0xE7, 0xE7, 0xFF, 0xE7, 0xE7, 0xFF, 0xE7,
+    0xE7, 0xFF, 0xE7, 0xE3, 0xFF, 0xC7, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF};
+static const GfxRenderer::Icon File24Icon = {{File24IconPortrait, File24IconLandscapeClockwise,
+                                              File24IconPortraitInverted, File24IconLandscapeCounterClockwise}};
@@ -1,8 +1,10 @@
 #pragma once
+#include <GfxRenderer.h>
+
 #include <cstdint>
 
 // size: 32x32
-static const uint8_t FolderIcon[] = {
+static const uint8_t FolderIconPortrait[] = {
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x3F, 0xFF,
     0x9F, 0xFE, 0x7F, 0xFF, 0xCF, 0xFE, 0x7F, 0xFF, 0xCF, 0xFE, 0x7F, 0xFF, 0xCF, 0xFE, 0x7F, 0xFF, 0xCF, 0xFE, 0x7F,
     0xFF, 0xCF, 0xFE, 0x7F, 0xFF, 0xCF, 0xFE, 0x7F, 0xFF, 0xCF, 0xFE, 0x7F, 0xFF, 0xCF, 0xFE, 0x7F, 0xFF, 0xCF, 0xFE,
@@ -10,3 +12,29 @@ static const uint8_t FolderIcon[] = {
     0xE1, 0xFF, 0xFF, 0xCF, 0xE3, 0xFF, 0xFF, 0xCF, 0xE7, 0xFF, 0xFF, 0xCF, 0xE7, 0xFF, 0xFF, 0xCF, 0xE7, 0xFF, 0xFF,
     0xCF, 0xE7, 0xFF, 0xFF, 0xCF, 0xE7, 0xFF, 0xFF, 0xCF, 0xE7, 0xFF, 0xFF, 0x8F, 0xE7, 0xFF, 0xFF, 0x8F, 0xF0, 0x00,
     0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t FolderIconLandscapeClockwise[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+    0x0F, 0xC0, 0x00, 0x00, 0x07, 0xC7, 0xFF, 0xFF, 0xC3, 0xCF, 0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xF3, 0xCF, 0xFF,
+    0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xF3, 0xCF,
+    0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xF3,
+    0xCF, 0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xF3, 0xC7, 0xFF, 0xFF, 0xF3, 0xC0, 0x00, 0x3F,
+    0xF3, 0xE0, 0x00, 0x1F, 0xF3, 0xFF, 0xFF, 0x8F, 0xF3, 0xFF, 0xFF, 0xC7, 0xF3, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
+    0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t FolderIconPortraitInverted[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF1, 0xFF, 0xFF,
+    0xE7, 0xF1, 0xFF, 0xFF, 0xE7, 0xF3, 0xFF, 0xFF, 0xE7, 0xF3, 0xFF, 0xFF, 0xE7, 0xF3, 0xFF, 0xFF, 0xE7, 0xF3, 0xFF,
+    0xFF, 0xE7, 0xF3, 0xFF, 0xFF, 0xE7, 0xF3, 0xFF, 0xFF, 0xC7, 0xF3, 0xFF, 0xFF, 0x87, 0xF3, 0xFF, 0xFF, 0x0F, 0xF3,
+    0xFF, 0xFE, 0x3F, 0xF3, 0xFF, 0xFE, 0x7F, 0xF3, 0xFF, 0xFE, 0x7F, 0xF3, 0xFF, 0xFE, 0x7F, 0xF3, 0xFF, 0xFE, 0x7F,
+    0xF3, 0xFF, 0xFE, 0x7F, 0xF3, 0xFF, 0xFE, 0x7F, 0xF3, 0xFF, 0xFE, 0x7F, 0xF3, 0xFF, 0xFE, 0x7F, 0xF3, 0xFF, 0xFE,
+    0x7F, 0xF3, 0xFF, 0xFE, 0x7F, 0xF3, 0xFF, 0xFE, 0x7F, 0xF3, 0xFF, 0xFE, 0x7F, 0xF9, 0xFF, 0xFC, 0x7F, 0xF8, 0x00,
+    0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t FolderIconLandscapeCounterClockwise[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
+    0xFF, 0xCF, 0xE3, 0xFF, 0xFF, 0xCF, 0xF1, 0xFF, 0xFF, 0xCF, 0xF8, 0x00, 0x07, 0xCF, 0xFC, 0x00, 0x03, 0xCF, 0xFF,
+    0xFF, 0xE3, 0xCF, 0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xF3, 0xCF,
+    0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xF3,
+    0xCF, 0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF,
+    0xF3, 0xCF, 0xFF, 0xFF, 0xF3, 0xC3, 0xFF, 0xFF, 0xE3, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const GfxRenderer::Icon FolderIcon = {{FolderIconPortrait, FolderIconLandscapeClockwise,
+                                              FolderIconPortraitInverted, FolderIconLandscapeCounterClockwise}};
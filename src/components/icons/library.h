@@ -1,8 +1,10 @@
 #pragma once
+#include <GfxRenderer.h>
+
 #include <cstdint>
 
 // size: 32x32
-static const uint8_t LibraryIcon[] = {
+static const uint8_t LibraryIconPortrait[] = {
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
     0x1F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC1, 0xCF, 0xFF, 0xFE, 0x07, 0xE7, 0xFF, 0xF0, 0x3F, 0xE7, 0xFF, 0x81,
     0xFF, 0x87, 0xFC, 0x0F, 0xFC, 0x0F, 0xF0, 0x3F, 0xF0, 0x3F, 0xE1, 0xFF, 0x81, 0xFF, 0xE7, 0xFC, 0x0F, 0xFF, 0xE7,
@@ -10,3 +12,29 @@ static const uint8_t LibraryIcon[] = {
     0xE7, 0xFF, 0xFF, 0xE7, 0xE7, 0xFF, 0xFF, 0xE7, 0xE7, 0xFF, 0xFF, 0xE7, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
     0x07, 0xE7, 0xFF, 0xFF, 0xE7, 0xE7, 0xFF, 0xFF, 0xE7, 0xE7, 0xFF, 0xFF, 0xE7, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00,
     0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t LibraryIconLandscapeClockwise[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0x80, 0x0F, 0xF8, 0x1F, 0x80,
+    0x07, 0xF1, 0x9F, 0x3C, 0xE7, 0xF3, 0x8F, 0x3C, 0xE7, 0xF3, 0xCF, 0x3C, 0xE7, 0xF3, 0xCF, 0x3C, 0xE7, 0xF9, 0xC7,
+    0x3C, 0xE7, 0xF9, 0xE7, 0x3C, 0xE7, 0xF8, 0xE7, 0x3C, 0xE7, 0xFC, 0xF3, 0x3C, 0xE7, 0xFC, 0xF3, 0x3C, 0xE7, 0xFE,
+    0x73, 0x3C, 0xE7, 0xFE, 0x79, 0x3C, 0xE7, 0xFE, 0x79, 0x3C, 0xE7, 0xFF, 0x39, 0x3C, 0xE7, 0xFF, 0x3C, 0x3C, 0xE7,
+    0xFF, 0x3C, 0x3C, 0xE7, 0xFF, 0x9C, 0x3C, 0xE7, 0xFF, 0x9E, 0x3C, 0xE7, 0xFF, 0x8E, 0x3C, 0xE7, 0xFF, 0xCF, 0x3C,
+    0xE7, 0xFF, 0xCF, 0x3C, 0xE7, 0xFF, 0xC7, 0x3C, 0xE7, 0xFF, 0xE6, 0x3C, 0xE7, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xF1,
+    0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t LibraryIconPortraitInverted[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
+    0x07, 0xE7, 0xFF, 0xFF, 0xE7, 0xE7, 0xFF, 0xFF, 0xE7, 0xE7, 0xFF, 0xFF, 0xE7, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00,
+    0x00, 0x07, 0xE7, 0xFF, 0xFF, 0xE7, 0xE7, 0xFF, 0xFF, 0xE7, 0xE7, 0xFF, 0xFF, 0xE7, 0xE7, 0xFF, 0xFF, 0xE7, 0xE0,
+    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC1, 0xCF, 0xFF, 0xFE, 0x07, 0xE7, 0xFF, 0xF0, 0x3F, 0xE7,
+    0xFF, 0x81, 0xFF, 0x87, 0xFC, 0x0F, 0xFC, 0x0F, 0xF0, 0x3F, 0xF0, 0x3F, 0xE1, 0xFF, 0x81, 0xFF, 0xE7, 0xFC, 0x0F,
+    0xFF, 0xE7, 0xE0, 0x7F, 0xFF, 0xF3, 0x83, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t LibraryIconLandscapeCounterClockwise[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0x8F, 0xFF, 0xE0, 0x00, 0x07,
+    0xFF, 0xE7, 0x3C, 0x67, 0xFF, 0xE7, 0x3C, 0xE3, 0xFF, 0xE7, 0x3C, 0xF3, 0xFF, 0xE7, 0x3C, 0xF3, 0xFF, 0xE7, 0x3C,
+    0x71, 0xFF, 0xE7, 0x3C, 0x79, 0xFF, 0xE7, 0x3C, 0x39, 0xFF, 0xE7, 0x3C, 0x3C, 0xFF, 0xE7, 0x3C, 0x3C, 0xFF, 0xE7,
+    0x3C, 0x9C, 0xFF, 0xE7, 0x3C, 0x9E, 0x7F, 0xE7, 0x3C, 0x9E, 0x7F, 0xE7, 0x3C, 0xCE, 0x7F, 0xE7, 0x3C, 0xCF, 0x3F,
+    0xE7, 0x3C, 0xCF, 0x3F, 0xE7, 0x3C, 0xE7, 0x1F, 0xE7, 0x3C, 0xE7, 0x9F, 0xE7, 0x3C, 0xE3, 0x9F, 0xE7, 0x3C, 0xF3,
+    0xCF, 0xE7, 0x3C, 0xF3, 0xCF, 0xE7, 0x3C, 0xF1, 0xCF, 0xE7, 0x3C, 0xF9, 0x8F, 0xE0, 0x01, 0xF8, 0x1F, 0xF0, 0x01,
+    0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const GfxRenderer::Icon LibraryIcon = {{LibraryIconPortrait, LibraryIconLandscapeClockwise,
+                                               LibraryIconPortraitInverted, LibraryIconLandscapeCounterClockwise}};
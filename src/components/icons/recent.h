@@ -1,8 +1,10 @@
 #pragma once
+#include <GfxRenderer.h>
+
 #include <cstdint>
 
 // size: 32x32
-static const uint8_t RecentIcon[] = {
+static const uint8_t RecentIconPortrait[] = {
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
     0x07, 0xC0, 0x00, 0x00, 0x03, 0xCF, 0xFF, 0xF8, 0xF3, 0xCF, 0xFF, 0xFC, 0xF3, 0xCF, 0xFF, 0xFC, 0xF3, 0xCF, 0xFF,
     0xFC, 0xF3, 0xC0, 0x03, 0xFC, 0xF3, 0xC0, 0x03, 0xFC, 0xF3, 0xCF, 0xC7, 0xFC, 0xF3, 0xCF, 0x8F, 0xFC, 0xF3, 0xCF,
@@ -10,3 +12,29 @@ static const uint8_t RecentIcon[] = {
     0xC0, 0x03, 0xFC, 0xF3, 0xCF, 0xFF, 0xFC, 0xF3, 0xCF, 0xFF, 0xFC, 0xF3, 0xCF, 0xFF, 0xFC, 0xF3, 0xCF, 0xFF, 0xFC,
     0xF3, 0xCF, 0xFF, 0xFC, 0xF3, 0xC3, 0xFF, 0xFC, 0x23, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t RecentIconLandscapeClockwise[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF3, 0xFF, 0xFF,
+    0x9F, 0xF3, 0xFF, 0xFF, 0xCF, 0xF3, 0xFF, 0xFF, 0x8F, 0xF3, 0xFF, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+    0x00, 0x0F, 0xF1, 0xFF, 0xFF, 0xCF, 0xF3, 0xFF, 0xFF, 0xCF, 0xF3, 0xFF, 0xFF, 0xCF, 0xF3, 0xFF, 0xFF, 0xCF, 0xF3,
+    0xFF, 0xFF, 0xCF, 0xF3, 0xFF, 0xFF, 0xCF, 0xF3, 0xFF, 0xFF, 0xCF, 0xF3, 0xFF, 0xFF, 0xCF, 0xF3, 0xCF, 0x8F, 0xCF,
+    0xF3, 0xC7, 0x0F, 0xCF, 0xF3, 0xC2, 0x0F, 0xCF, 0xF3, 0xC0, 0x0F, 0xCF, 0xF3, 0xC8, 0x4F, 0xCF, 0xF3, 0xCD, 0xCF,
+    0xCF, 0xF3, 0xCF, 0xCF, 0xCF, 0xF3, 0xCF, 0xCF, 0xCF, 0xF3, 0xCF, 0xCF, 0x8F, 0xF3, 0xCF, 0xCF, 0x9F, 0xF8, 0x00,
+    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t RecentIconPortraitInverted[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+    0x1F, 0xE0, 0x00, 0x00, 0x07, 0xC4, 0x3F, 0xFF, 0xC3, 0xCF, 0x3F, 0xFF, 0xF3, 0xCF, 0x3F, 0xFF, 0xF3, 0xCF, 0x3F,
+    0xFF, 0xF3, 0xCF, 0x3F, 0xFF, 0xF3, 0xCF, 0x3F, 0xFF, 0xF3, 0xCF, 0x3F, 0xC0, 0x03, 0xCF, 0x3F, 0xC0, 0x03, 0xCF,
+    0x3F, 0xC3, 0xF3, 0xCF, 0x3F, 0xE1, 0xF3, 0xCF, 0x3F, 0xF1, 0xF3, 0xCF, 0x3F, 0xF8, 0xF3, 0xCF, 0x3F, 0xF1, 0xF3,
+    0xCF, 0x3F, 0xE3, 0xF3, 0xCF, 0x3F, 0xC0, 0x03, 0xCF, 0x3F, 0xC0, 0x03, 0xCF, 0x3F, 0xFF, 0xF3, 0xCF, 0x3F, 0xFF,
+    0xF3, 0xCF, 0x3F, 0xFF, 0xF3, 0xCF, 0x1F, 0xFF, 0xF3, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t RecentIconLandscapeCounterClockwise[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF9, 0xF3, 0xF3,
+    0xCF, 0xF1, 0xF3, 0xF3, 0xCF, 0xF3, 0xF3, 0xF3, 0xCF, 0xF3, 0xF3, 0xF3, 0xCF, 0xF3, 0xF3, 0xB3, 0xCF, 0xF3, 0xF2,
+    0x13, 0xCF, 0xF3, 0xF0, 0x03, 0xCF, 0xF3, 0xF0, 0x43, 0xCF, 0xF3, 0xF0, 0xE3, 0xCF, 0xF3, 0xF1, 0xF3, 0xCF, 0xF3,
+    0xFF, 0xFF, 0xCF, 0xF3, 0xFF, 0xFF, 0xCF, 0xF3, 0xFF, 0xFF, 0xCF, 0xF3, 0xFF, 0xFF, 0xCF, 0xF3, 0xFF, 0xFF, 0xCF,
+    0xF3, 0xFF, 0xFF, 0xCF, 0xF3, 0xFF, 0xFF, 0xCF, 0xF3, 0xFF, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x0F, 0xF1, 0xFF, 0xFF, 0xCF, 0xF1, 0xFF, 0xFF, 0xCF, 0xF3, 0xFF, 0xFF, 0xCF, 0xF9, 0xFF, 0xFF, 0xCF, 0xF8, 0x00,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const GfxRenderer::Icon RecentIcon = {{RecentIconPortrait, RecentIconLandscapeClockwise,
+                                              RecentIconPortraitInverted, RecentIconLandscapeCounterClockwise}};
@@ -1,8 +1,26 @@
 #pragma once
+#include <GfxRenderer.h>
+
 #include <cstdint>
 
 // size: 32x32
-static const uint8_t SettingsIcon[] = {
+static const uint8_t SettingsIconPortrait[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xE1, 0xFF, 0xFF, 0x03, 0xC0,
+    0xFF, 0xFE, 0x30, 0x8C, 0x7F, 0xFE, 0x78, 0x1E, 0x7F, 0xFE, 0x7C, 0x7E, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F,
+    0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFC, 0x7C, 0x3E, 0x3F, 0xF0, 0xF0, 0x0F, 0x07, 0xC1, 0xF3, 0xCF, 0x83, 0xC7,
+    0xE7, 0xE7, 0xE3, 0xCF, 0xE7, 0xE7, 0xF3, 0xCF, 0xE7, 0xE7, 0xF3, 0xC7, 0xE7, 0xE7, 0xE3, 0xC1, 0xF3, 0xCF, 0x83,
+    0xE0, 0xF0, 0x0F, 0x0F, 0xFC, 0x7C, 0x3E, 0x3F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE,
+    0x7F, 0xFE, 0x7E, 0x3E, 0x7F, 0xFE, 0x78, 0x1E, 0x7F, 0xFE, 0x31, 0x0C, 0x7F, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x87,
+    0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t SettingsIconLandscapeClockwise[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF1, 0x8F,
+    0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xE3, 0xC7, 0xFF, 0xF8, 0x07, 0xE0, 0x1F, 0xF0, 0x0F, 0xF0, 0x0F, 0xE3, 0xFF,
+    0xFF, 0xC7, 0xE7, 0xFF, 0xFF, 0xE7, 0xE7, 0xFC, 0x3F, 0xE7, 0xE3, 0xF0, 0x0F, 0xC7, 0xF1, 0xF3, 0xCF, 0x8F, 0xF9,
+    0xE7, 0xE7, 0x1F, 0xFC, 0xE7, 0xE7, 0x1F, 0xF8, 0xE7, 0xE7, 0x3F, 0xF8, 0xE7, 0xE7, 0x9F, 0xF1, 0xF3, 0xCF, 0x8F,
+    0xE3, 0xF0, 0x0F, 0xC7, 0xE7, 0xFC, 0x3F, 0xE7, 0xE7, 0xFF, 0xFF, 0xE7, 0xE3, 0xFF, 0xFF, 0xC7, 0xF0, 0x0F, 0xF0,
+    0x0F, 0xF8, 0x07, 0xE0, 0x1F, 0xFF, 0xE3, 0xC7, 0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xF1, 0x8F, 0xFF, 0xFF, 0xF8,
+    0x0F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t SettingsIconPortraitInverted[] = {
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xE1, 0xFF, 0xFF, 0x03, 0xC0,
     0xFF, 0xFE, 0x30, 0x8C, 0x7F, 0xFE, 0x78, 0x1E, 0x7F, 0xFE, 0x7C, 0x7E, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F,
     0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFC, 0x7C, 0x3E, 0x3F, 0xF0, 0xF0, 0x0F, 0x07, 0xC1, 0xF3, 0xCF, 0x83, 0xC7,
@@ -10,3 +28,13 @@ static const uint8_t SettingsIcon[] = {
     0xE0, 0xF0, 0x0F, 0x0F, 0xFC, 0x7C, 0x3E, 0x3F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE,
     0x7F, 0xFE, 0x7E, 0x3E, 0x7F, 0xFE, 0x78, 0x1E, 0x7F, 0xFE, 0x31, 0x0C, 0x7F, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x87,
     0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t SettingsIconLandscapeCounterClockwise[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF1, 0x8F,
+    0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xE3, 0xC7, 0xFF, 0xF8, 0x07, 0xE0, 0x1F, 0xF0, 0x0F, 0xF0, 0x0F, 0xE3, 0xFF,
+    0xFF, 0xC7, 0xE7, 0xFF, 0xFF, 0xE7, 0xE7, 0xFC, 0x3F, 0xE7, 0xE3, 0xF0, 0x0F, 0xC7, 0xF1, 0xF3, 0xCF, 0x8F, 0xF9,
+    0xE7, 0xE7, 0x1F, 0xFC, 0xE7, 0xE7, 0x1F, 0xF8, 0xE7, 0xE7, 0x3F, 0xF8, 0xE7, 0xE7, 0x9F, 0xF1, 0xF3, 0xCF, 0x8F,
+    0xE3, 0xF0, 0x0F, 0xC7, 0xE7, 0xFC, 0x3F, 0xE7, 0xE7, 0xFF, 0xFF, 0xE7, 0xE3, 0xFF, 0xFF, 0xC7, 0xF0, 0x0F, 0xF0,
+    0x0F, 0xF8, 0x07, 0xE0, 0x1F, 0xFF, 0xE3, 0xC7, 0xFF, 0xFF, 0xF3, 0xCF, 0xFF, 0xFF, 0xF1, 0x8F, 0xFF, 0xFF, 0xF8,
+    0x0F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const GfxRenderer::Icon SettingsIcon = {{SettingsIconPortrait, SettingsIconLandscapeClockwise,
+                                                SettingsIconPortraitInverted, SettingsIconLandscapeCounterClockwise}};
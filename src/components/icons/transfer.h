@@ -1,8 +1,10 @@
 #pragma once
+#include <GfxRenderer.h>
+
 #include <cstdint>
 
 // size: 32x32
-static const uint8_t TransferIcon[] = {
+static const uint8_t TransferIconPortrait[] = {
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F,
     0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF0, 0x4F, 0xFF, 0xFF, 0xE2, 0x4F, 0xFF, 0xFF, 0xE2,
     0x47, 0xFF, 0xFF, 0xC6, 0x67, 0xFF, 0xFF, 0xC6, 0x63, 0xFF, 0xFF, 0xCE, 0x73, 0xFF, 0xFF, 0x8E, 0x71, 0xFF, 0xFF,
@@ -10,3 +12,29 @@ static const uint8_t TransferIcon[] = {
     0xFC, 0x7E, 0x7E, 0x3F, 0xFC, 0x7E, 0x7F, 0x3F, 0xF8, 0xFE, 0x7F, 0x3F, 0xF8, 0xFE, 0x7F, 0x9F, 0xF1, 0xFC, 0x1F,
     0x9F, 0xF1, 0xE0, 0x07, 0xCF, 0xE3, 0x83, 0x80, 0xCF, 0xE0, 0x0F, 0xF0, 0x07, 0xE0, 0x7F, 0xFC, 0x07, 0xF3, 0xFF,
     0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t TransferIconLandscapeClockwise[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    0x07, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xE0, 0xC7, 0xFF, 0xFF, 0x83, 0xCF, 0xFF, 0xFE, 0x0F, 0x8F, 0xFF, 0xF8,
+    0x3F, 0x8F, 0xFF, 0xE0, 0xFF, 0x9F, 0xFF, 0x83, 0xFF, 0x1F, 0xFE, 0x0F, 0xFF, 0x3F, 0xF8, 0x3F, 0xFE, 0x3F, 0xC1,
+    0xFF, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xFE, 0x7F, 0xF0, 0x3F, 0xFF, 0x3F,
+    0xFC, 0x0F, 0xFF, 0x3F, 0xFF, 0x03, 0xFF, 0x1F, 0xFF, 0xC0, 0xFF, 0x9F, 0xFF, 0xF8, 0x1F, 0x9F, 0xFF, 0xFE, 0x07,
+    0xCF, 0xFF, 0xFF, 0x81, 0xCF, 0xFF, 0xFF, 0xE0, 0x4F, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
+    0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t TransferIconPortraitInverted[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xCF, 0xE0, 0x3F, 0xFE,
+    0x07, 0xE0, 0x0F, 0xF0, 0x07, 0xF3, 0x01, 0xC1, 0xC7, 0xF3, 0xE0, 0x07, 0x8F, 0xF9, 0xF8, 0x3F, 0x8F, 0xF9, 0xFE,
+    0x7F, 0x1F, 0xFC, 0xFE, 0x7F, 0x1F, 0xFC, 0xFE, 0x7E, 0x3F, 0xFC, 0x7E, 0x7E, 0x3F, 0xFE, 0x7E, 0x7C, 0x7F, 0xFE,
+    0x3E, 0x7C, 0x7F, 0xFF, 0x3E, 0x7C, 0xFF, 0xFF, 0x1E, 0x78, 0xFF, 0xFF, 0x9E, 0x79, 0xFF, 0xFF, 0x8E, 0x71, 0xFF,
+    0xFF, 0xCE, 0x73, 0xFF, 0xFF, 0xC6, 0x63, 0xFF, 0xFF, 0xE6, 0x63, 0xFF, 0xFF, 0xE2, 0x47, 0xFF, 0xFF, 0xF2, 0x47,
+    0xFF, 0xFF, 0xF2, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFC,
+    0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t TransferIconLandscapeCounterClockwise[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF,
+    0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xF2, 0x07, 0xFF, 0xFF, 0xF3, 0x81, 0xFF, 0xFF, 0xF3, 0xE0, 0x7F, 0xFF, 0xF9, 0xF8,
+    0x1F, 0xFF, 0xF9, 0xFF, 0x03, 0xFF, 0xF8, 0xFF, 0xC0, 0xFF, 0xFC, 0xFF, 0xF0, 0x3F, 0xFC, 0xFF, 0xFC, 0x0F, 0xFE,
+    0x7F, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0xFF, 0x83, 0xFC, 0x7F, 0xFC, 0x1F,
+    0xFC, 0xFF, 0xF0, 0x7F, 0xF8, 0xFF, 0xC1, 0xFF, 0xF9, 0xFF, 0x07, 0xFF, 0xF1, 0xFC, 0x1F, 0xFF, 0xF1, 0xF0, 0x7F,
+    0xFF, 0xF3, 0xC1, 0xFF, 0xFF, 0xE3, 0x07, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const GfxRenderer::Icon TransferIcon = {{TransferIconPortrait, TransferIconLandscapeClockwise,
+                                                TransferIconPortraitInverted, TransferIconLandscapeCounterClockwise}};
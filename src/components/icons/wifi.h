@@ -1,8 +1,10 @@
 #pragma once
+#include <GfxRenderer.h>
+
 #include <cstdint>
 
 // size: 32x32
-static const uint8_t WifiIcon[] = {
+static const uint8_t WifiIconPortrait[] = {
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF,
     0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0x3F, 0xFF, 0xFE, 0x3E, 0x3F, 0xFF, 0xFE, 0x3C, 0x7F, 0xFF, 0xFE, 0x7C,
     0x7F, 0xFF, 0xFC, 0x78, 0xFD, 0xFF, 0xFC, 0x78, 0xF1, 0xFF, 0xFC, 0xF9, 0xF1, 0xFF, 0xFC, 0xF1, 0xE3, 0xFF, 0xFC,
@@ -10,3 +12,29 @@ static const uint8_t WifiIcon[] = {
     0xFC, 0xF9, 0xF3, 0xFF, 0xFC, 0xF9, 0xF1, 0xFF, 0xFC, 0x7C, 0xFB, 0xFF, 0xFE, 0x7C, 0xFF, 0xFF, 0xFE, 0x7C, 0x7F,
     0xFF, 0xFF, 0x3E, 0x3F, 0xFF, 0xFF, 0x3F, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xCF,
     0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t WifiIconLandscapeClockwise[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7,
+    0xF7, 0xFF, 0xFF, 0xE1, 0xC3, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+    0xFF, 0xFF, 0x3F, 0xFC, 0x3F, 0xFE, 0x3F, 0xFE, 0x0F, 0xF8, 0x7F, 0xFF, 0x00, 0x80, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
+    0xCF, 0xF8, 0x3F, 0xFB, 0xC7, 0xFF, 0xFF, 0xE3, 0xC1, 0xFF, 0xFF, 0xC7, 0xF0, 0x7F, 0xFF, 0x0F, 0xF8, 0x0F, 0xF8,
+    0x1F, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t WifiIconPortraitInverted[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF1,
+    0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xFC, 0x7C, 0xFF, 0xFF, 0xFE, 0x3E, 0x7F, 0xFF, 0xFF,
+    0x3E, 0x7F, 0xFF, 0xDF, 0x3E, 0x3F, 0xFF, 0x8F, 0x9F, 0x3F, 0xFF, 0xCF, 0x9F, 0x3F, 0xFF, 0xC7, 0x9F, 0x3F, 0xFF,
+    0xE7, 0x8F, 0x3F, 0xFB, 0xE7, 0xCF, 0x3F, 0xFB, 0xE7, 0x8F, 0x3F, 0xFF, 0xC7, 0x8F, 0x3F, 0xFF, 0xC7, 0x8F, 0x3F,
+    0xFF, 0x8F, 0x9F, 0x3F, 0xFF, 0x8F, 0x1E, 0x3F, 0xFF, 0xBF, 0x1E, 0x3F, 0xFF, 0xFE, 0x3E, 0x7F, 0xFF, 0xFE, 0x3C,
+    0x7F, 0xFF, 0xFC, 0x7C, 0x7F, 0xFF, 0xFC, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF,
+    0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t WifiIconLandscapeCounterClockwise[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xF8, 0x1F, 0xF0, 0x1F, 0xF0, 0xFF,
+    0xFE, 0x0F, 0xE3, 0xFF, 0xFF, 0x83, 0xC7, 0xFF, 0xFF, 0xE3, 0xDF, 0xFC, 0x1F, 0xF3, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
+    0x01, 0x00, 0xFF, 0xFE, 0x1F, 0xF0, 0x7F, 0xFC, 0x7F, 0xFC, 0x3F, 0xFC, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xC3, 0x87, 0xFF, 0xFF, 0xEF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const GfxRenderer::Icon WifiIcon = {{WifiIconPortrait, WifiIconLandscapeClockwise,
+                                            WifiIconPortraitInverted, WifiIconLandscapeCounterClockwise}};
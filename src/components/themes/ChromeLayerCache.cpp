@@ -0,0 +1,53 @@
+#include "ChromeLayerCache.h"
+
+#include <FontCacheManager.h>
+
+uint32_t ChromeLayerCache::key(const char* text) {
+  uint32_t hash = 2166136261u;
+  for (const char* c = text; c && *c; c++) {
+    hash = (hash ^ static_cast<uint8_t>(*c)) * 16777619u;
+  }
+  return hash;
+}
+
+void ChromeLayerCache::draw(const GfxRenderer& renderer, const uint32_t key, const int x, const int y,
+                            const int width, const int height, const std::function<void()>& draw) {
+  const GfxRenderer::Orientation orientation = renderer.getOrientation();
+  Entry* found = nullptr;
+  for (Entry& entry : entries) {
+    const GfxRenderer::Layer& layer = entry.layer;
+    if (entry.key == key && layer.x == x && layer.y == y && layer.width == width && layer.height == height &&
+        layer.orientation == orientation) {
+      found = &entry;
+      break;
+    }
+  }
+  if (found && renderer.blitLayer(found->layer)) {
+    found->lastUse = ++clock;
+    return;
+  }
+
+  draw();
+  // A font prewarm scan only records the glyphs, drawing nothing to capture
+  const FontCacheManager* fontCacheManager = renderer.getFontCacheManager();
+  if (renderer.getRenderMode() != GfxRenderer::BW || (fontCacheManager && fontCacheManager->isScanning())) {
+    return;
+  }
+  if (!found && entries.size() < MAX_LAYERS) {
+    entries.push_back({});
+    found = &entries.back();
+  } else if (!found) {
+    found = &entries[0];
+    for (Entry& entry : entries) {
+      if (entry.lastUse < found->lastUse) {
+        found = &entry;
+      }
+    }
+  }
+  found->key = key;
+  found->lastUse = ++clock;
+  if (!renderer.captureLayer(x, y, width, height, found->layer)) {
+    // Matches no piece
+    found->layer.width = 0;
+  }
+}
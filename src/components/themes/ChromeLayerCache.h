@@ -0,0 +1,34 @@
+#pragma once
+
+#include <GfxRenderer.h>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * Layers of a theme's static chrome (see GfxRenderer::Layer), such as its button hints: the first time a piece is
+ * drawn it is captured, and later frames blit it back instead of drawing it again from rectangles and glyphs.
+ *
+ * A piece is looked up by a key for what it shows and by the rectangle and orientation it was drawn in, so pieces of
+ * another screen size or orientation are drawn afresh. Whatever draw leaves untouched in the rectangle is captured
+ * along with it, so a piece has to be drawn over the same background each time, as chrome is.
+ */
+class ChromeLayerCache {
+ public:
+  static uint32_t key(const char* text);
+
+  // Blits the piece if it is cached, otherwise calls draw and captures the rectangle
+  void draw(const GfxRenderer& renderer, uint32_t key, int x, int y, int width, int height,
+            const std::function<void()>& draw);
+
+ private:
+  static constexpr size_t MAX_LAYERS = 12;
+  struct Entry {
+    uint32_t key;
+    uint32_t lastUse;
+    GfxRenderer::Layer layer;
+  };
+  std::vector<Entry> entries;
+  uint32_t clock = 0;
+};
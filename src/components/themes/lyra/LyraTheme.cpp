@@ -66,40 +66,40 @@ void drawLyraBatteryIcon(const GfxRenderer& renderer, int x, int y, int battWidt
   }
 }
 
-const uint8_t* iconForName(UIIcon icon, int size) {
+const GfxRenderer::Icon* iconForName(UIIcon icon, int size) {
   if (size == 24) {
     switch (icon) {
       case UIIcon::Folder:
-        return Folder24Icon;
+        return &Folder24Icon;
       case UIIcon::Text:
-        return Text24Icon;
+        return &Text24Icon;
       case UIIcon::Image:
-        return Image24Icon;
+        return &Image24Icon;
       case UIIcon::Book:
-        return Book24Icon;
+        return &Book24Icon;
       case UIIcon::File:
-        return File24Icon;
+        return &File24Icon;
       default:
         return nullptr;
     }
   } else if (size == 32) {
     switch (icon) {
       case UIIcon::Folder:
-        return FolderIcon;
+        return &FolderIcon;
       case UIIcon::Book:
-        return BookIcon;
+        return &BookIcon;
       case UIIcon::Recent:
-        return RecentIcon;
+        return &RecentIcon;
       case UIIcon::Settings:
-        return Settings2Icon;
+        return &Settings2Icon;
       case UIIcon::Transfer:
-        return TransferIcon;
+        return &TransferIcon;
       case UIIcon::Library:
-        return LibraryIcon;
+        return &LibraryIcon;
       case UIIcon::Wifi:
-        return WifiIcon;
+        return &WifiIcon;
       case UIIcon::Hotspot:
-        return HotspotIcon;
+        return &HotspotIcon;
       default:
         return nullptr;
     }
@@ -286,9 +286,9 @@ void LyraTheme::drawList(const GfxRenderer& renderer, Rect rect, int itemCount,
 
     if (rowIcon != nullptr) {
       UIIcon icon = rowIcon(i);
-      const uint8_t* iconBitmap = iconForName(icon, iconSize);
+      const GfxRenderer::Icon* iconBitmap = iconForName(icon, iconSize);
       if (iconBitmap != nullptr) {
-        renderer.drawIcon(iconBitmap, rect.x + LyraMetrics::values.contentSidePadding + hPaddingInSelection,
+        renderer.drawIcon(*iconBitmap, rect.x + LyraMetrics::values.contentSidePadding + hPaddingInSelection,
                           itemY + iconY, iconSize, iconSize);
       }
     }
@@ -335,18 +335,24 @@ void LyraTheme::drawButtonHints(GfxRenderer& renderer, const char* btn1, const c
     const int x = buttonPositions[i];
     if (labels[i] != nullptr && labels[i][0] != '\0') {
       // Draw the filled background and border for a FULL-sized button
-      renderer.fillRoundedRect(x, pageHeight - buttonY, buttonWidth, buttonHeight, cornerRadius, Color::White);
-      renderer.drawRoundedRect(x, pageHeight - buttonY, buttonWidth, buttonHeight, 1, cornerRadius, true, true, false,
-                               false, true);
-      const int textWidth = renderer.getTextWidth(SMALL_FONT_ID, labels[i]);
-      const int textX = x + (buttonWidth - 1 - textWidth) / 2;
-      renderer.drawText(SMALL_FONT_ID, textX, pageHeight - buttonY + textYOffset, labels[i]);
+      chromeLayers.draw(renderer, ChromeLayerCache::key(labels[i]), x, pageHeight - buttonY, buttonWidth, buttonHeight,
+                        [&]() {
+                          renderer.fillRoundedRect(x, pageHeight - buttonY, buttonWidth, buttonHeight, cornerRadius,
+                                                   Color::White);
+                          renderer.drawRoundedRect(x, pageHeight - buttonY, buttonWidth, buttonHeight, 1, cornerRadius,
+                                                   true, true, false, false, true);
+                          const int textWidth = renderer.getTextWidth(SMALL_FONT_ID, labels[i]);
+                          const int textX = x + (buttonWidth - 1 - textWidth) / 2;
+                          renderer.drawText(SMALL_FONT_ID, textX, pageHeight - buttonY + textYOffset, labels[i]);
+                        });
     } else {
       // Draw the filled background and border for a SMALL-sized button
-      renderer.fillRoundedRect(x, pageHeight - smallButtonHeight, buttonWidth, smallButtonHeight, cornerRadius,
-                               Color::White);
-      renderer.drawRoundedRect(x, pageHeight - smallButtonHeight, buttonWidth, smallButtonHeight, 1, cornerRadius, true,
-                               true, false, false, true);
+      chromeLayers.draw(renderer, 0, x, pageHeight - smallButtonHeight, buttonWidth, smallButtonHeight, [&]() {
+        renderer.fillRoundedRect(x, pageHeight - smallButtonHeight, buttonWidth, smallButtonHeight, cornerRadius,
+                                 Color::White);
+        renderer.drawRoundedRect(x, pageHeight - smallButtonHeight, buttonWidth, smallButtonHeight, 1, cornerRadius,
+                                 true, true, false, false, true);
+      });
     }
   }
 
@@ -411,6 +417,18 @@ void LyraTheme::drawRecentBookCover(GfxRenderer& renderer, Rect rect, const std:
   const bool hasContinueReading = !recentBooks.empty();
   if (coverWidth == 0) {
     coverWidth = LyraMetrics::values.homeCoverHeight * 0.6;
+    // A cover buffer cached by an earlier boot was not drawn this boot: measure the thumbnail it shows
+    FsFile file;
+    if (hasContinueReading && coverRendered && !recentBooks[0].coverBmpPath.empty() &&
+        Storage.openFileForRead(
+            "HOME", UITheme::getCoverThumbPath(recentBooks[0].coverBmpPath, LyraMetrics::values.homeCoverHeight),
+            file)) {
+      Bitmap bitmap(file);
+      if (bitmap.parseHeaders() == BmpReaderError::Ok) {
+        coverWidth = bitmap.getWidth();
+      }
+      file.close();
+    }
   }
 
   // Draw book card regardless, fill with message based on `hasContinueReading`
@@ -529,9 +547,9 @@ void LyraTheme::drawButtonMenu(GfxRenderer& renderer, Rect rect, int buttonCount
 
     if (rowIcon != nullptr) {
       UIIcon icon = rowIcon(i);
-      const uint8_t* iconBitmap = iconForName(icon, mainMenuIconSize);
+      const GfxRenderer::Icon* iconBitmap = iconForName(icon, mainMenuIconSize);
       if (iconBitmap != nullptr) {
-        renderer.drawIcon(iconBitmap, textX, textY + 3, mainMenuIconSize, mainMenuIconSize);
+        renderer.drawIcon(*iconBitmap, textX, textY + 3, mainMenuIconSize, mainMenuIconSize);
         textX += mainMenuIconSize + hPaddingInSelection + 2;
       }
     }
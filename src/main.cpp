@@ -5,6 +5,7 @@
 #include <GfxRenderer.h>
 #include <HalDisplay.h>
 #include <HalGPIO.h>
+#include <HalHeapTrace.h>
 #include <HalPowerManager.h>
 #include <HalStorage.h>
 #include <HalSystem.h>
@@ -17,21 +18,33 @@
 
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
+#include "EnergyLedger.h"
 #include "KOReaderCredentialStore.h"
 #include "MappedInputManager.h"
+#include "PartitionReaderFonts.h"
+#include "PerfHistory.h"
 #include "RecentBooksStore.h"
+#include "RecordStore.h"
 #include "activities/Activity.h"
 #include "activities/ActivityManager.h"
+#include "activities/reader/ResumeSnapshot.h"
 #include "components/UITheme.h"
 #include "fontIds.h"
+#include "network/OtaUpdater.h"
+#include "util/BootTimeline.h"
 #include "util/ButtonNavigator.h"
+#include "util/PerfProfiler.h"
+#include "util/RenderBenchmark.h"
+#include "util/ResourceMonitor.h"
 #include "util/ScreenshotUtil.h"
+#include "util/TrashCollector.h"
 
 MappedInputManager mappedInputManager(gpio);
 GfxRenderer renderer(display);
 ActivityManager activityManager(renderer, mappedInputManager);
 FontDecompressor fontDecompressor;
 FontCacheManager fontCacheManager(renderer.getFontMap());
+TrashCollector trashCollector;
 
 // Fonts
 EpdFont bookerly14RegularFont(&bookerly_14_regular);
@@ -40,7 +53,7 @@ EpdFont bookerly14ItalicFont(&bookerly_14_italic);
 EpdFont bookerly14BoldItalicFont(&bookerly_14_bolditalic);
 EpdFontFamily bookerly14FontFamily(&bookerly14RegularFont, &bookerly14BoldFont, &bookerly14ItalicFont,
                                    &bookerly14BoldItalicFont);
-#ifndef OMIT_FONTS
+#if !defined(OMIT_FONTS) && !defined(FONTS_IN_PARTITION)
 EpdFont bookerly12RegularFont(&bookerly_12_regular);
 EpdFont bookerly12BoldFont(&bookerly_12_bold);
 EpdFont bookerly12ItalicFont(&bookerly_12_italic);
@@ -109,7 +122,7 @@ EpdFont opendyslexic14ItalicFont(&opendyslexic_14_italic);
 EpdFont opendyslexic14BoldItalicFont(&opendyslexic_14_bolditalic);
 EpdFontFamily opendyslexic14FontFamily(&opendyslexic14RegularFont, &opendyslexic14BoldFont, &opendyslexic14ItalicFont,
                                        &opendyslexic14BoldItalicFont);
-#endif  // OMIT_FONTS
+#endif  // !OMIT_FONTS && !FONTS_IN_PARTITION
 
 EpdFont smallFont(&notosans_8_regular);
 EpdFontFamily smallFontFamily(&smallFont);
@@ -184,6 +197,15 @@ void enterDeepSleep() {
   APP_STATE.saveToFile();
 
   activityManager.goToSleep();
+  ENERGY_LEDGER.saveForSleep();
+  PERF_HISTORY.saveForSleep();
+  RecordStore::flush();
+  trashCollector.stop();
+  // Behind the sleep screen, a release downloaded in the background and accepted on the update screen goes to the next
+  // OTA partition, booted on wake
+  if (OtaUpdater::hasAcceptedUpdate()) {
+    OtaUpdater::installStagedUpdate();
+  }
 
   display.deepSleep();
   LOG_DBG("MAIN", "Entering deep sleep");
@@ -204,7 +226,9 @@ void setupDisplayAndFonts() {
   fontCacheManager.setFontDecompressor(&fontDecompressor);
   renderer.setFontCacheManager(&fontCacheManager);
   renderer.insertFont(BOOKERLY_14_FONT_ID, bookerly14FontFamily);
-#ifndef OMIT_FONTS
+#if defined(FONTS_IN_PARTITION) && !defined(OMIT_FONTS)
+  PARTITION_READER_FONTS.insertFonts(renderer);
+#elif !defined(OMIT_FONTS)
   renderer.insertFont(BOOKERLY_12_FONT_ID, bookerly12FontFamily);
   renderer.insertFont(BOOKERLY_16_FONT_ID, bookerly16FontFamily);
   renderer.insertFont(BOOKERLY_18_FONT_ID, bookerly18FontFamily);
@@ -217,7 +241,7 @@ void setupDisplayAndFonts() {
   renderer.insertFont(OPENDYSLEXIC_10_FONT_ID, opendyslexic10FontFamily);
   renderer.insertFont(OPENDYSLEXIC_12_FONT_ID, opendyslexic12FontFamily);
   renderer.insertFont(OPENDYSLEXIC_14_FONT_ID, opendyslexic14FontFamily);
-#endif  // OMIT_FONTS
+#endif
   renderer.insertFont(UI_10_FONT_ID, ui10FontFamily);
   renderer.insertFont(UI_12_FONT_ID, ui12FontFamily);
   renderer.insertFont(SMALL_FONT_ID, smallFontFamily);
@@ -226,6 +250,7 @@ void setupDisplayAndFonts() {
 
 void setup() {
   t1 = millis();
+  BootTimeline::begin();
 
   HalSystem::begin();
   gpio.begin();
@@ -240,6 +265,7 @@ void setup() {
     }
   }
 #endif
+  BootTimeline::mark("hal");
 
   LOG_INF("MAIN", "Hardware detect: %s", gpio.deviceIsX3() ? "X3" : "X4");
 
@@ -252,13 +278,15 @@ void setup() {
     return;
   }
 
+  Storage.tune();
   HalSystem::checkPanic();
+  BootTimeline::mark("storage");
 
   SETTINGS.loadFromFile();
   I18N.loadSettings();
-  KOREADER_STORE.loadFromFile();
   UITheme::getInstance().reload();
   ButtonNavigator::setMappedInputManager(mappedInputManager);
+  BootTimeline::mark("settings");
 
   const auto wakeupReason = gpio.getWakeupReason();
   switch (wakeupReason) {
@@ -281,30 +309,52 @@ void setup() {
 
   // First serial output only here to avoid timing inconsistencies for power button press duration verification
   LOG_DBG("MAIN", "Starting CrossPoint version " CROSSPOINT_VERSION);
+  BootTimeline::mark("wakeup");
+  BootTimeline::logPrevious();
 
   setupDisplayAndFonts();
-
-  activityManager.goToBoot();
+  BootTimeline::mark("display");
 
   APP_STATE.loadFromFile();
+  ENERGY_LEDGER.loadFromFile();
+  PERF_HISTORY.loadFromFile();
+  BootTimeline::mark("state");
+  // Boot to home screen if no book is open, last sleep was not from reader, back button is held, or reader activity
+  // crashed (indicated by readerActivityLoadCount > 0)
+  const bool rebootFromPanic = HalSystem::isRebootFromPanic();
+  const bool resumeReader = !rebootFromPanic && !APP_STATE.openEpubPath.empty() && APP_STATE.lastSleepFromReader &&
+                            !mappedInputManager.isPressed(MappedInputManager::Button::Back) &&
+                            APP_STATE.readerActivityLoadCount == 0;
+
+  // Resuming a book: show its last page right away instead of the boot screen, everything else loads after
+  if (!resumeReader || !ResumeSnapshot::show(renderer, APP_STATE.openEpubPath)) {
+    activityManager.goToBoot();
+  }
+  BootTimeline::mark("bootscreen");
+
+  // WiFi and KOReader credentials are loaded on first use
   RECENT_BOOKS.loadFromFile();
+  BootTimeline::mark("recents");
 
-  if (HalSystem::isRebootFromPanic()) {
+  if (rebootFromPanic) {
     // If we rebooted from a panic, go to crash report screen to show the panic info
     activityManager.goToCrashReport();
-  } else if (APP_STATE.openEpubPath.empty() || !APP_STATE.lastSleepFromReader ||
-             mappedInputManager.isPressed(MappedInputManager::Button::Back) || APP_STATE.readerActivityLoadCount > 0) {
-    // Boot to home screen if no book is open, last sleep was not from reader, back button is held, or reader activity
-    // crashed (indicated by readerActivityLoadCount > 0)
+    PERF_HISTORY.skipBootTime();
+  } else if (!resumeReader) {
     activityManager.goHome();
   } else {
+    // Boot time is measured to the home screen; a boot into a book has no home screen to wait for
+    PERF_HISTORY.skipBootTime();
     // Clear app state to avoid getting into a boot loop if the epub doesn't load
     const auto path = APP_STATE.openEpubPath;
     APP_STATE.openEpubPath = "";
     APP_STATE.readerActivityLoadCount++;
     APP_STATE.saveToFile();
+    RecordStore::flush();
     activityManager.goToReader(path);
   }
+  BootTimeline::mark("activity");
+  BootTimeline::logCurrent();
 
   // Ensure we're not still holding the power button before leaving setup
   waitForPowerRelease();
@@ -333,11 +383,45 @@ void loop() {
       String cmd = line.substring(4);
       cmd.trim();
       if (cmd == "SCREENSHOT") {
+        RawLogOutput raw;
         const uint32_t bufferSize = display.getBufferSize();
         logSerial.printf("SCREENSHOT_START:%d\n", bufferSize);
         uint8_t* buf = display.getFrameBuffer();
         logSerial.write(buf, bufferSize);
         logSerial.printf("SCREENSHOT_END\n");
+      } else if (cmd == "PERF") {
+        RenderLock lock;
+        {
+          RawLogOutput raw;
+          PerfProfiler::dump(logSerial);
+        }
+        PerfProfiler::logCpuResidency();
+        ResourceMonitor::log();
+      } else if (cmd == "RENDERBENCH") {
+        {
+          RenderLock lock;
+          const int failures =
+              RenderBenchmark::run(renderer, "/.crosspoint", 10, [](const RenderBenchmark::Result& result) {
+                LOG_INF("RBM", "%-32s %8lu us  %08lX %s", result.name, static_cast<unsigned long>(result.bestUs),
+                        static_cast<unsigned long>(result.hash),
+                        result.golden == 0 ? "(no golden)" : result.ok ? "ok" : "MISMATCH");
+              });
+          LOG_INF("RBM", "%d case(s) changed pixels", failures);
+        }
+        // The cases drew over the frame buffer, the activity draws its screen again
+        activityManager.requestUpdate();
+      } else if (cmd == "PERF_OVERLAY") {
+        PerfProfiler::setOverlayEnabled(!PerfProfiler::overlayEnabled());
+        LOG_INF("PRF", "Overlay %s", PerfProfiler::overlayEnabled() ? "on" : "off");
+      } else if (cmd == "HEAP" || cmd == "HEAP_SD") {
+        if (!HalHeapTrace::enabled) {
+          LOG_INF("HTR", "Heap tracing needs the heap_trace build env");
+        } else if (cmd == "HEAP") {
+          RawLogOutput raw;
+          HalHeapTrace::dump(logSerial);
+        } else {
+          HalHeapTrace::dumpToFile("/heap_trace.bin");
+        }
       }
     }
   }
@@ -395,6 +479,13 @@ void loop() {
     activityManager.requestUpdate();
   }
 
+  ENERGY_LEDGER.sample();
+  ResourceMonitor::sample();
+
+  if (Storage.hasTrash() && !trashCollector.isRunning()) {
+    trashCollector.start(TrashCollector::STACK_SIZE);
+  }
+
   const unsigned long activityStartTime = millis();
   activityManager.loop();
   const unsigned long activityDuration = millis() - activityStartTime;
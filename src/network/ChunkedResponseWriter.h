@@ -0,0 +1,105 @@
+#pragma once
+
+#include <WebServer.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+/**
+ * Body of a CONTENT_LENGTH_UNKNOWN response, collected in a fixed buffer and sent one CHUNK_SIZE chunk at a time. A
+ * listing goes out as it is read, in a few large chunks rather than one chunk (and one String) per entry, and is never
+ * held in RAM whole. Call finish() once the body is complete.
+ */
+class ChunkedResponseWriter {
+ public:
+  // A listing of a large folder is a handful of chunks; small enough for the server task's stack
+  static constexpr size_t CHUNK_SIZE = 2048;
+
+  explicit ChunkedResponseWriter(WebServer& server) : server(server) {}
+  ChunkedResponseWriter(const ChunkedResponseWriter&) = delete;
+  ChunkedResponseWriter& operator=(const ChunkedResponseWriter&) = delete;
+
+  void flush() {
+    if (length > 0) {
+      server.sendContent(buffer, length);
+      length = 0;
+    }
+  }
+
+  // Sends what is buffered and the empty chunk that ends the response
+  void finish() {
+    flush();
+    server.sendContent("");
+  }
+
+  void append(const char* text, size_t textLength) {
+    while (textLength > 0) {
+      const size_t n = std::min(textLength, sizeof(buffer) - length);
+      memcpy(buffer + length, text, n);
+      length += n;
+      text += n;
+      textLength -= n;
+      if (length == sizeof(buffer)) {
+        flush();
+      }
+    }
+  }
+
+  void append(const char* text) { append(text, strlen(text)); }
+
+  void appendNumber(const size_t value) {
+    char digits[12];
+    append(digits, snprintf(digits, sizeof(digits), "%u", static_cast<unsigned>(value)));
+  }
+
+  void appendBool(const bool value) { append(value ? "true" : "false"); }
+
+  // A JSON string, quotes included; control characters, quotes and backslashes escaped, UTF-8 passed through
+  void appendJsonString(const char* text) {
+    append("\"", 1);
+    const char* run = text;
+    for (const char* p = text; *p; p++) {
+      const auto c = static_cast<uint8_t>(*p);
+      if (c >= 0x20 && c != '"' && c != '\\') {
+        continue;
+      }
+      append(run, p - run);
+      run = p + 1;
+      char escaped[7];
+      switch (c) {
+        case '"':
+          append("\\\"", 2);
+          break;
+        case '\\':
+          append("\\\\", 2);
+          break;
+        case '\b':
+          append("\\b", 2);
+          break;
+        case '\f':
+          append("\\f", 2);
+          break;
+        case '\n':
+          append("\\n", 2);
+          break;
+        case '\r':
+          append("\\r", 2);
+          break;
+        case '\t':
+          append("\\t", 2);
+          break;
+        default:
+          append(escaped, snprintf(escaped, sizeof(escaped), "\\u%04x", c));
+          break;
+      }
+    }
+    append(run, strlen(run));
+    append("\"", 1);
+  }
+
+ private:
+  WebServer& server;
+  char buffer[CHUNK_SIZE];
+  size_t length = 0;
+};
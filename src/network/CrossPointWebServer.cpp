@@ -6,17 +6,25 @@
 #include <HalStorage.h>
 #include <Logging.h>
 #include <WiFi.h>
+#include <esp_rom_crc.h>
 #include <esp_task_wdt.h>
 
 #include <algorithm>
 
+#include "ChunkedResponseWriter.h"
 #include "CrossPointSettings.h"
+#include "HttpFileSender.h"
+#include "LibraryDatabase.h"
+#include "PerfHistory.h"
+#include "RecordStore.h"
 #include "SettingsList.h"
 #include "WebDAVHandler.h"
+#include "activities/boot_sleep/SleepScreenCache.h"
 #include "html/FilesPageHtml.generated.h"
 #include "html/HomePageHtml.generated.h"
 #include "html/SettingsPageHtml.generated.h"
 #include "html/js/jszip_minJs.generated.h"
+#include "util/DirectoryIndex.h"
 
 namespace {
 // Folders/files to hide from the web interface file browser
@@ -31,6 +39,7 @@ CrossPointWebServer* wsInstance = nullptr;
 
 // WebSocket upload state
 FsFile wsUploadFile;
+UploadWriter wsUploadWriter;
 String wsUploadFileName;
 String wsUploadPath;
 size_t wsUploadSize = 0;
@@ -42,13 +51,69 @@ size_t wsLastProgressSent = 0;
 String wsLastCompleteName;
 size_t wsLastCompleteSize = 0;
 unsigned long wsLastCompleteAt = 0;
+// Framed (BEGIN) uploads: a part left by a disconnect is kept until the client BEGINs the same upload again
+bool wsUploadFramed = false;
+bool wsUploadSuspended = false;
+bool wsRetryRequested = false;
+// Two writer buffers in flight: one being written while the next fills, without the socket buffers growing with it
+constexpr size_t WS_UPLOAD_WINDOW = 2 * UploadWriter::BUFFER_SIZE;
+constexpr size_t WS_FRAME_HEADER_SIZE = 8;  // uint32 offset, uint32 CRC-32
+// WebSocket uploads share one held DirectoryIndex edit while books keep arriving (a Calibre sync sends them one after
+// another), released once none has for this long
+constexpr unsigned long WS_INDEX_HOLD_MS = 3000;
+unsigned long wsIndexHeldAt = 0;
+// Guards the strings of the upload status, written on the server task and read by getWsUploadStatus()
+SemaphoreHandle_t wsStatusMutex = nullptr;
+
+class StatusGuard {
+ public:
+  StatusGuard() {
+    if (wsStatusMutex) xSemaphoreTake(wsStatusMutex, portMAX_DELAY);
+  }
+  ~StatusGuard() {
+    if (wsStatusMutex) xSemaphoreGive(wsStatusMutex);
+  }
+  StatusGuard(const StatusGuard&) = delete;
+  StatusGuard& operator=(const StatusGuard&) = delete;
+};
+
+DirectoryIndex::Edit& holdWsIndexEdit() {
+  wsIndexHeldAt = millis();
+  return DirectoryIndex::heldEdit(wsUploadPath.c_str());
+}
+
+void releaseWsIndexEdit() {
+  if (wsIndexHeldAt != 0) {
+    DirectoryIndex::releaseHeldEdit();
+    wsIndexHeldAt = 0;
+  }
+}
+
+String wsUploadFilePath() {
+  String filePath = wsUploadPath;
+  if (!filePath.endsWith("/")) filePath += "/";
+  filePath += wsUploadFileName;
+  return filePath;
+}
 
-// Helper function to clear epub cache after upload
-void clearEpubCacheIfNeeded(const String& filePath) {
-  // Only clear cache for .epub files
-  if (FsHelpers::hasEpubExtension(filePath)) {
+// Helper function to clear the epub or sleep screen cache of a file after a delete or move
+void clearFileCachesIfNeeded(const String& filePath) {
+  // Only clear cache for .epub and .fb2 files
+  if (FsHelpers::hasEpubExtension(filePath) || FsHelpers::hasFb2Extension(filePath)) {
     Epub(filePath.c_str(), "/.crosspoint").clearCache();
     LOG_DBG("WEB", "Cleared epub cache for: %s", filePath.c_str());
+  } else if (FsHelpers::hasBmpExtension(filePath.c_str())) {
+    SleepScreenCache::forget(filePath.c_str());
+  }
+}
+
+// After an upload the book is opened again later, so the cache is only marked stale and cleared by that load. A sleep
+// image's cached screen is dropped: a replacement of the same size would pass for the old image (see SleepScreenCache).
+void invalidateFileCachesIfNeeded(const String& filePath) {
+  if (FsHelpers::hasEpubExtension(filePath) || FsHelpers::hasFb2Extension(filePath)) {
+    Epub(filePath.c_str(), "/.crosspoint").invalidateCache();
+  } else if (FsHelpers::hasBmpExtension(filePath.c_str())) {
+    SleepScreenCache::forget(filePath.c_str());
   }
 }
 
@@ -137,7 +202,10 @@ void CrossPointWebServer::begin() {
   server->on("/js/jszip.min.js", HTTP_GET, [this] { handleJszip(); });
 
   server->on("/api/status", HTTP_GET, [this] { handleStatus(); });
+  server->on("/api/perf", HTTP_GET, [this] { handlePerfHistory(); });
   server->on("/api/files", HTTP_GET, [this] { handleFileListData(); });
+  server->on("/api/library", HTTP_GET, [this] { handleLibraryData(); });
+  server->on("/api/library", HTTP_POST, [this] { handlePostLibrary(); });
   server->on("/download", HTTP_GET, [this] { handleDownload(); });
 
   // Upload endpoint with special handling for multipart form data
@@ -163,9 +231,9 @@ void CrossPointWebServer::begin() {
   server->onNotFound([this] { handleNotFound(); });
   LOG_DBG("WEB", "[MEM] Free heap after route setup: %d bytes", ESP.getFreeHeap());
 
-  // Collect WebDAV headers and register handler
-  const char* davHeaders[] = {"Depth", "Destination", "Overwrite", "If", "Lock-Token", "Timeout"};
-  server->collectHeaders(davHeaders, 6);
+  // Collect WebDAV headers (and Range for resumable downloads) and register handler
+  const char* collectedHeaders[] = {"Depth", "Destination", "Overwrite", "If", "Lock-Token", "Timeout", "Range"};
+  server->collectHeaders(collectedHeaders, sizeof(collectedHeaders) / sizeof(collectedHeaders[0]));
   server->addHandler(new WebDAVHandler());  // Note: WebDAVHandler will be deleted by WebServer when server is stopped
   LOG_DBG("WEB", "WebDAV handler initialized");
 
@@ -182,7 +250,15 @@ void CrossPointWebServer::begin() {
   udpActive = udp.begin(LOCAL_UDP_PORT);
   LOG_DBG("WEB", "Discovery UDP %s on port %d", udpActive ? "enabled" : "failed", LOCAL_UDP_PORT);
 
+  if (!wsStatusMutex) {
+    wsStatusMutex = xSemaphoreCreateMutex();
+  }
   running = true;
+  if (!task.start(ServerTask::STACK_SIZE, ServerTask::PRIORITY)) {
+    LOG_ERR("WEB", "Failed to start the server task");
+    stop();
+    return;
+  }
 
   LOG_DBG("WEB", "Web server started on port %d", port);
   // Show the correct IP based on network mode
@@ -193,21 +269,40 @@ void CrossPointWebServer::begin() {
 }
 
 void CrossPointWebServer::abortWsUpload(const char* tag) {
+  DirectoryIndex::Edit& edit = holdWsIndexEdit();
+  wsUploadWriter.abort();
   // Explicit close() required: file-scope global persists beyond function scope
   wsUploadFile.close();
-  String filePath = wsUploadPath;
-  if (!filePath.endsWith("/")) filePath += "/";
-  filePath += wsUploadFileName;
+  const String filePath = wsUploadFilePath();
   if (Storage.remove(filePath.c_str())) {
+    edit.removed(wsUploadFileName.c_str());
     LOG_DBG(tag, "Deleted incomplete upload: %s", filePath.c_str());
   } else {
     LOG_DBG(tag, "Failed to delete incomplete upload: %s", filePath.c_str());
   }
   wsUploadInProgress = false;
+  wsUploadSuspended = false;
   wsUploadClientNum = 255;
   wsLastProgressSent = 0;
 }
 
+void CrossPointWebServer::suspendWsUpload() {
+  if (!wsUploadWriter.finish()) {
+    abortWsUpload("WS");
+    return;
+  }
+  {
+    // Before close(), which updates the file's directory entry
+    DirectoryIndex::Edit& edit = holdWsIndexEdit();
+    wsUploadFile.close();
+    edit.added(wsUploadFileName.c_str(), false, wsUploadReceived);
+  }
+  LOG_DBG("WS", "Upload suspended at %zu of %zu bytes: %s", wsUploadReceived, wsUploadSize, wsUploadFileName.c_str());
+  wsUploadInProgress = false;
+  wsUploadSuspended = true;
+  wsUploadClientNum = 255;
+}
+
 void CrossPointWebServer::stop() {
   if (!running || !server) {
     LOG_DBG("WEB", "stop() called but already stopped (running=%d, server=%p)", running, server.get());
@@ -216,14 +311,17 @@ void CrossPointWebServer::stop() {
 
   LOG_DBG("WEB", "STOP INITIATED - setting running=false first");
   running = false;  // Set this FIRST to prevent handleClient from using server
+  task.stop();      // Returns once the request being served is done
 
   LOG_DBG("WEB", "[MEM] Free heap before stop: %d bytes", ESP.getFreeHeap());
 
-  // Close any in-progress WebSocket upload and remove partial file
-  if (wsUploadInProgress && wsUploadFile) {
+  // Close any in-progress WebSocket upload and remove partial file, a suspended one's included
+  if ((wsUploadInProgress && wsUploadFile) || wsUploadSuspended) {
     abortWsUpload("WEB");
   }
 
+  releaseWsIndexEdit();
+
   // Stop WebSocket server
   if (wsServer) {
     LOG_DBG("WEB", "Stopping WebSocket server...");
@@ -238,9 +336,6 @@ void CrossPointWebServer::stop() {
     udpActive = false;
   }
 
-  // Brief delay to allow any in-flight handleClient() calls to complete
-  delay(20);
-
   server->stop();
   LOG_DBG("WEB", "[MEM] Free heap after server->stop(): %d bytes", ESP.getFreeHeap());
 
@@ -256,6 +351,23 @@ void CrossPointWebServer::stop() {
   LOG_DBG("WEB", "[MEM] Free heap final: %d bytes", ESP.getFreeHeap());
 }
 
+void CrossPointWebServer::ServerTask::run() {
+  // Requests used to be served on the loop task, under its watchdog
+  const bool watched = esp_task_wdt_add(nullptr) == ESP_OK;
+  while (!stopRequested()) {
+    esp_task_wdt_reset();
+    owner.handleClient();
+    if (owner.isUploading()) {
+      taskYIELD();
+    } else if (!sleepFor(POLL_INTERVAL_MS)) {
+      break;
+    }
+  }
+  if (watched) {
+    esp_task_wdt_delete(nullptr);
+  }
+}
+
 void CrossPointWebServer::handleClient() {
   static unsigned long lastDebugPrint = 0;
 
@@ -282,6 +394,9 @@ void CrossPointWebServer::handleClient() {
   if (wsServer) {
     wsServer->loop();
   }
+  if (wsIndexHeldAt != 0 && !wsUploadInProgress && millis() - wsIndexHeldAt >= WS_INDEX_HOLD_MS) {
+    releaseWsIndexEdit();
+  }
 
   // Respond to discovery broadcasts
   if (udpActive) {
@@ -306,7 +421,10 @@ void CrossPointWebServer::handleClient() {
   }
 }
 
+bool CrossPointWebServer::isUploading() const { return wsUploadInProgress || upload.file; }
+
 CrossPointWebServer::WsUploadStatus CrossPointWebServer::getWsUploadStatus() const {
+  StatusGuard guard;
   WsUploadStatus status;
   status.inProgress = wsUploadInProgress;
   status.received = wsUploadReceived;
@@ -351,6 +469,44 @@ void CrossPointWebServer::handleStatus() const {
   doc["rssi"] = apMode ? 0 : WiFi.RSSI();
   doc["freeHeap"] = ESP.getFreeHeap();
   doc["uptime"] = millis() / 1000;
+  if (indexingStatusProvider) {
+    const IndexingStatus indexing = indexingStatusProvider();
+    doc["indexing"]["pending"] = indexing.pending;
+    doc["indexing"]["done"] = indexing.done;
+    doc["indexing"]["current"] = indexing.current;
+  }
+
+  String json;
+  serializeJson(doc, json);
+  server->send(200, "application/json", json);
+}
+
+void CrossPointWebServer::handlePerfHistory() const {
+  // Nothing records while the web server runs, so the history can be read without a lock
+  JsonDocument doc;
+  const JsonArray versions = doc["versions"].to<JsonArray>();
+  for (uint8_t i = 0; i < PERF_HISTORY.getEntryCount(); i++) {
+    const PerfHistory::Entry& entry = PERF_HISTORY.getEntry(i);
+    const JsonObject version = versions.add<JsonObject>();
+    version["version"] = entry.version;
+    version["peakHeapUsed"] = entry.peakHeapUsed;
+    for (uint8_t m = 0; m < PerfHistory::METRIC_COUNT; m++) {
+      const auto metric = static_cast<PerfHistory::Metric>(m);
+      const PerfHistory::Histogram& histogram = entry.histograms[m];
+      uint32_t count = 0;
+      for (const uint16_t bucketCount : histogram.counts) {
+        count += bucketCount;
+      }
+      const JsonObject stats = version[PerfHistory::metricName(metric)].to<JsonObject>();
+      stats["count"] = count;
+      stats["p50"] = PerfHistory::percentile(histogram, 50);
+      stats["p95"] = PerfHistory::percentile(histogram, 95);
+      const JsonArray buckets = stats["buckets"].to<JsonArray>();
+      for (const uint16_t bucketCount : histogram.counts) {
+        buckets.add(bucketCount);
+      }
+    }
+  }
 
   String json;
   serializeJson(doc, json);
@@ -376,15 +532,14 @@ void CrossPointWebServer::scanFiles(const char* path, const std::function<void(F
   char name[500];
   while (file) {
     file.getName(name, sizeof(name));
-    auto fileName = String(name);
 
     // Skip hidden items (starting with ".")
-    bool shouldHide = !SETTINGS.showHiddenFiles && fileName.startsWith(".");
+    bool shouldHide = !SETTINGS.showHiddenFiles && name[0] == '.';
 
     // Check against explicitly hidden items list
     if (!shouldHide) {
       for (size_t i = 0; i < HIDDEN_ITEMS_COUNT; i++) {
-        if (fileName.equals(HIDDEN_ITEMS[i])) {
+        if (strcmp(name, HIDDEN_ITEMS[i]) == 0) {
           shouldHide = true;
           break;
         }
@@ -393,7 +548,7 @@ void CrossPointWebServer::scanFiles(const char* path, const std::function<void(F
 
     if (!shouldHide) {
       FileInfo info;
-      info.name = fileName;
+      info.name = name;
       info.isDirectory = file.isDirectory();
 
       if (info.isDirectory) {
@@ -401,7 +556,7 @@ void CrossPointWebServer::scanFiles(const char* path, const std::function<void(F
         info.isEpub = false;
       } else {
         info.size = file.size();
-        info.isEpub = isEpubFile(info.name);
+        info.isEpub = FsHelpers::hasEpubExtension(name);
       }
 
       callback(info);
@@ -438,37 +593,101 @@ void CrossPointWebServer::handleFileListData() const {
 
   server->setContentLength(CONTENT_LENGTH_UNKNOWN);
   server->send(200, "application/json", "");
-  server->sendContent("[");
-  char output[512];
-  constexpr size_t outputSize = sizeof(output);
+  // Entries are written straight into the chunk buffer as the directory is read
+  ChunkedResponseWriter out(*server);
+  out.append("[");
   bool seenFirst = false;
-  JsonDocument doc;
 
-  scanFiles(currentPath.c_str(), [this, &output, &doc, seenFirst](const FileInfo& info) mutable {
-    doc.clear();
-    doc["name"] = info.name;
-    doc["size"] = info.size;
-    doc["isDirectory"] = info.isDirectory;
-    doc["isEpub"] = info.isEpub;
+  scanFiles(currentPath.c_str(), [&out, &seenFirst](const FileInfo& info) {
+    out.append(seenFirst ? ",{\"name\":" : "{\"name\":");
+    seenFirst = true;
+    out.appendJsonString(info.name);
+    out.append(",\"size\":");
+    out.appendNumber(info.size);
+    out.append(",\"isDirectory\":");
+    out.appendBool(info.isDirectory);
+    out.append(",\"isEpub\":");
+    out.appendBool(info.isEpub);
+    out.append("}");
+  });
+  out.append("]");
+  out.finish();
+  LOG_DBG("WEB", "Served file listing page for path: %s", currentPath.c_str());
+}
 
-    const size_t written = serializeJson(doc, output, outputSize);
-    if (written >= outputSize) {
-      // JSON output truncated; skip this entry to avoid sending malformed JSON
-      LOG_DBG("WEB", "Skipping file entry with oversized JSON for name: %s", info.name.c_str());
-      return;
-    }
+void CrossPointWebServer::handleLibraryData() const {
+  // The books the device knows, from the library database rather than by opening them, for a sync to compare with
+  server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server->send(200, "application/json", "");
+  ChunkedResponseWriter out(*server);
+  out.append("[");
 
-    if (seenFirst) {
-      server->sendContent(",");
+  esp_task_wdt_reset();
+  const size_t count = LIBRARY.getSortedCount(LibraryDatabase::Order::TITLE);
+  LibraryRecord record;
+  bool seenFirst = false;
+  for (size_t i = 0; i < count; i++) {
+    esp_task_wdt_reset();
+    if (!LIBRARY.getSorted(LibraryDatabase::Order::TITLE, i, record)) {
+      continue;
+    }
+    out.append(seenFirst ? ",{\"path\":" : "{\"path\":");
+    seenFirst = true;
+    out.appendJsonString(record.path);
+    out.append(",\"size\":");
+    out.appendNumber(record.fileSize);
+    out.append(",\"title\":");
+    out.appendJsonString(record.title);
+    out.append(",\"author\":");
+    out.appendJsonString(record.author);
+    out.append(",\"progress\":");
+    if (record.progress == LibraryRecord::NO_PROGRESS) {
+      out.append("null");
     } else {
-      seenFirst = true;
+      out.appendNumber(record.progress);
     }
-    server->sendContent(output);
-  });
-  server->sendContent("]");
-  // End of streamed response, empty chunk to signal client
-  server->sendContent("");
-  LOG_DBG("WEB", "Served file listing page for path: %s", currentPath.c_str());
+    out.append("}");
+  }
+  out.append("]");
+  out.finish();
+  LOG_DBG("WEB", "Served library of %u books", static_cast<unsigned>(count));
+}
+
+void CrossPointWebServer::handlePostLibrary() const {
+  // A batch of metadata changes: [{"path": ..., "title": ..., "author": ...}], title and author each optional, for
+  // just the books whose metadata changed
+  if (!server->hasArg("plain")) {
+    server->send(400, "text/plain", "Missing JSON body");
+    return;
+  }
+
+  JsonDocument doc;
+  const DeserializationError err = deserializeJson(doc, server->arg("plain"));
+  if (err || !doc.is<JsonArrayConst>()) {
+    server->send(400, "text/plain", String("Invalid JSON: ") + (err ? err.c_str() : "expected an array"));
+    return;
+  }
+
+  int updated = 0;
+  for (const JsonObjectConst change : doc.as<JsonArrayConst>()) {
+    esp_task_wdt_reset();
+    const char* path = change["path"] | "";
+    if (!*path || !Storage.exists(path)) {
+      continue;
+    }
+    LibraryRecord record;
+    if (!LIBRARY.findBook(path, record)) {
+      memset(&record, 0, sizeof(record));  // On the card but not walked yet
+    }
+    const char* title = change["title"] | record.title;
+    const char* author = change["author"] | record.author;
+    if (LIBRARY.putBook(path, title, author, record.language, record.thumbPath)) {
+      updated++;
+    }
+  }
+
+  LOG_DBG("WEB", "Updated metadata of %d book(s)", updated);
+  server->send(200, "text/plain", String("Updated ") + String(updated) + " book(s)");
 }
 
 void CrossPointWebServer::handleDownload() const {
@@ -525,57 +744,16 @@ void CrossPointWebServer::handleDownload() const {
     filename = nameBuf;
   }
 
-  server->setContentLength(file.size());
   server->sendHeader("Content-Disposition", "attachment; filename=\"" + filename + "\"");
-  server->send(200, contentType.c_str(), "");
-
-  NetworkClient client = server->client();
-  const size_t chunkSize = 4096;
-  uint8_t buffer[chunkSize];
-
-  bool downloadOk = true;
-  while (downloadOk && file.available()) {
-    int result = file.read(buffer, chunkSize);
-    if (result <= 0) break;
-    size_t bytesRead = static_cast<size_t>(result);
-    size_t totalWritten = 0;
-    while (totalWritten < bytesRead) {
-      esp_task_wdt_reset();
-      size_t wrote = client.write(buffer + totalWritten, bytesRead - totalWritten);
-      if (wrote == 0) {
-        downloadOk = false;
-        break;
-      }
-      totalWritten += wrote;
-    }
+  if (!HttpFileSender::send(*server, file, contentType.c_str())) {
+    LOG_DBG("WEB", "Download of %s ended early", itemPath.c_str());
   }
-  client.clear();
+  server->client().clear();
   file.close();
 }
 
-// Diagnostic counters for upload performance analysis
+// Diagnostic counter for upload performance analysis
 static unsigned long uploadStartTime = 0;
-static unsigned long totalWriteTime = 0;
-static size_t writeCount = 0;
-
-static bool flushUploadBuffer(CrossPointWebServer::UploadState& state) {
-  if (state.bufferPos > 0 && state.file) {
-    esp_task_wdt_reset();  // Reset watchdog before potentially slow SD write
-    const unsigned long writeStart = millis();
-    const size_t written = state.file.write(state.buffer.data(), state.bufferPos);
-    totalWriteTime += millis() - writeStart;
-    writeCount++;
-    esp_task_wdt_reset();  // Reset watchdog after SD write
-
-    if (written != state.bufferPos) {
-      LOG_DBG("WEB", "[UPLOAD] Buffer flush failed: expected %d, wrote %d", state.bufferPos, written);
-      state.bufferPos = 0;
-      return false;
-    }
-    state.bufferPos = 0;
-  }
-  return true;
-}
 
 void CrossPointWebServer::handleUpload(UploadState& state) const {
   static size_t lastLoggedSize = 0;
@@ -595,40 +773,45 @@ void CrossPointWebServer::handleUpload(UploadState& state) const {
     // Reset watchdog - this is the critical 1% crash point
     esp_task_wdt_reset();
 
-    state.fileName = upload.filename;
-    state.size = 0;
-    state.success = false;
-    state.error = "";
-    uploadStartTime = millis();
-    lastLoggedSize = 0;
-    state.bufferPos = 0;
-    totalWriteTime = 0;
-    writeCount = 0;
-
     // Get upload path from query parameter (defaults to root if not specified)
     // Note: We use query parameter instead of form data because multipart form
     // fields aren't available until after file upload completes
+    String path = "/";
     if (server->hasArg("path")) {
-      state.path = server->arg("path");
+      path = server->arg("path");
       // Ensure path starts with /
-      if (!state.path.startsWith("/")) {
-        state.path = "/" + state.path;
+      if (!path.startsWith("/")) {
+        path = "/" + path;
       }
       // Remove trailing slash unless it's root
-      if (state.path.length() > 1 && state.path.endsWith("/")) {
-        state.path = state.path.substring(0, state.path.length() - 1);
+      if (path.length() > 1 && path.endsWith("/")) {
+        path = path.substring(0, path.length() - 1);
       }
-    } else {
-      state.path = "/";
     }
 
+    // The first file of a request opens its batch. One still open for another folder was left by a request that
+    // broke off between two files.
+    if (state.indexEdit && path != state.path) {
+      finishUploadBatch(state);
+    }
+    if (!state.indexEdit) {
+      state.uploaded.clear();
+      state.failed.clear();
+      esp_task_wdt_reset();
+      state.indexEdit.reset(new DirectoryIndex::Edit(path.c_str()));
+    }
+
+    state.fileName = upload.filename;
+    state.path = path;
+    state.size = 0;
+    state.error = "";
+    uploadStartTime = millis();
+    lastLoggedSize = 0;
+
     LOG_DBG("WEB", "[UPLOAD] START: %s to path: %s", state.fileName.c_str(), state.path.c_str());
     LOG_DBG("WEB", "[UPLOAD] Free heap: %d bytes", ESP.getFreeHeap());
 
-    // Create file path
-    String filePath = state.path;
-    if (!filePath.endsWith("/")) filePath += "/";
-    filePath += state.fileName;
+    const String filePath = state.filePath();
 
     // Check if file already exists - SD operations can be slow
     esp_task_wdt_reset();
@@ -636,6 +819,7 @@ void CrossPointWebServer::handleUpload(UploadState& state) const {
       LOG_DBG("WEB", "[UPLOAD] Overwriting existing file: %s", filePath.c_str());
       esp_task_wdt_reset();
       Storage.remove(filePath.c_str());
+      state.indexEdit->removed(state.fileName.c_str());
     }
 
     // Open file for writing - this can be slow due to FAT cluster allocation
@@ -645,33 +829,19 @@ void CrossPointWebServer::handleUpload(UploadState& state) const {
       LOG_DBG("WEB", "[UPLOAD] FAILED to create file: %s", filePath.c_str());
       return;
     }
+    state.indexEdit->added(state.fileName.c_str(), false, 0);
+    state.writer.begin(state.file);
     esp_task_wdt_reset();
 
     LOG_DBG("WEB", "[UPLOAD] File created successfully: %s", filePath.c_str());
   } else if (upload.status == UPLOAD_FILE_WRITE) {
     if (state.file && state.error.isEmpty()) {
-      // Buffer incoming data and flush when buffer is full
-      // This reduces SD card write operations and improves throughput
-      const uint8_t* data = upload.buf;
-      size_t remaining = upload.currentSize;
-
-      while (remaining > 0) {
-        const size_t space = UploadState::UPLOAD_BUFFER_SIZE - state.bufferPos;
-        const size_t toCopy = (remaining < space) ? remaining : space;
-
-        memcpy(state.buffer.data() + state.bufferPos, data, toCopy);
-        state.bufferPos += toCopy;
-        data += toCopy;
-        remaining -= toCopy;
-
-        // Flush buffer when full
-        if (state.bufferPos >= UploadState::UPLOAD_BUFFER_SIZE) {
-          if (!flushUploadBuffer(state)) {
-            state.error = "Failed to write to SD card - disk may be full";
-            state.file.close();
-            return;
-          }
-        }
+      // The writer batches the chunks and writes full buffers while we receive the next ones
+      if (!state.writer.write(upload.buf, upload.currentSize)) {
+        state.error = "Failed to write to SD card - disk may be full";
+        state.writer.abort();
+        state.file.close();
+        return;
       }
 
       state.size += upload.currentSize;
@@ -681,57 +851,86 @@ void CrossPointWebServer::handleUpload(UploadState& state) const {
         const unsigned long elapsed = millis() - uploadStartTime;
         const float kbps = (elapsed > 0) ? (state.size / 1024.0) / (elapsed / 1000.0) : 0;
         LOG_DBG("WEB", "[UPLOAD] %d bytes (%.1f KB), %.1f KB/s, %d writes", state.size, state.size / 1024.0, kbps,
-                writeCount);
+                state.writer.writeCount);
         lastLoggedSize = state.size;
       }
     }
   } else if (upload.status == UPLOAD_FILE_END) {
     if (state.file) {
-      // Flush any remaining buffered data
-      if (!flushUploadBuffer(state)) {
+      // Write any remaining buffered data and wait for the writer
+      if (!state.writer.finish()) {
         state.error = "Failed to write final data to SD card";
       }
       state.file.close();
+      state.indexEdit->added(state.fileName.c_str(), false, state.size);
 
       if (state.error.isEmpty()) {
-        state.success = true;
+        state.uploaded.push_back(state.filePath());
         const unsigned long elapsed = millis() - uploadStartTime;
         const float avgKbps = (elapsed > 0) ? (state.size / 1024.0) / (elapsed / 1000.0) : 0;
-        const float writePercent = (elapsed > 0) ? (totalWriteTime * 100.0 / elapsed) : 0;
+        const float writePercent = (elapsed > 0) ? (state.writer.writeTime * 100.0 / elapsed) : 0;
         LOG_DBG("WEB", "[UPLOAD] Complete: %s (%d bytes in %lu ms, avg %.1f KB/s)", state.fileName.c_str(), state.size,
                 elapsed, avgKbps);
-        LOG_DBG("WEB", "[UPLOAD] Diagnostics: %d writes, total write time: %lu ms (%.1f%%)", writeCount, totalWriteTime,
-                writePercent);
-
-        // Clear epub cache to prevent stale metadata issues when overwriting files
-        String filePath = state.path;
-        if (!filePath.endsWith("/")) filePath += "/";
-        filePath += state.fileName;
-        clearEpubCacheIfNeeded(filePath);
+        LOG_DBG("WEB", "[UPLOAD] Diagnostics: %d writes, background write time: %lu ms (%.1f%%)",
+                state.writer.writeCount, state.writer.writeTime, writePercent);
       }
     }
+    if (!state.error.isEmpty()) {
+      state.failed.push_back(state.fileName + ": " + state.error);
+    }
   } else if (upload.status == UPLOAD_FILE_ABORTED) {
-    state.bufferPos = 0;  // Discard buffered data
+    state.writer.abort();  // Discard buffered data
     if (state.file) {
       state.file.close();
       // Try to delete the incomplete file
-      String filePath = state.path;
-      if (!filePath.endsWith("/")) filePath += "/";
-      filePath += state.fileName;
-      Storage.remove(filePath.c_str());
+      if (Storage.remove(state.filePath().c_str()) && state.indexEdit) {
+        state.indexEdit->removed(state.fileName.c_str());
+      }
     }
     state.error = "Upload aborted";
     LOG_DBG("WEB", "Upload aborted");
+    // The request ends here; the files it finished before are kept
+    finishUploadBatch(state);
+  }
+}
+
+void CrossPointWebServer::finishUploadBatch(UploadState& state) const {
+  esp_task_wdt_reset();
+  state.indexEdit.reset();  // Writes the folder's index, once for all of the request's files
+  for (const String& filePath : state.uploaded) {
+    // Mark the epub cache stale to prevent stale metadata issues when overwriting files
+    esp_task_wdt_reset();
+    invalidateFileCachesIfNeeded(filePath);
+    if (uploadCallback) {
+      uploadCallback(filePath.c_str());
+    }
+  }
+  if (state.uploaded.size() > 1) {
+    LOG_DBG("WEB", "[UPLOAD] Batch of %u files done", static_cast<unsigned>(state.uploaded.size()));
   }
 }
 
 void CrossPointWebServer::handleUploadPost(UploadState& state) const {
-  if (state.success) {
+  finishUploadBatch(state);
+  const size_t uploaded = state.uploaded.size();
+  const size_t failed = state.failed.size();
+  if (failed == 0 && uploaded == 1) {
     server->send(200, "text/plain", "File uploaded successfully: " + state.fileName);
+  } else if (failed == 0 && uploaded > 1) {
+    server->send(200, "text/plain", "Uploaded " + String(uploaded) + " files");
+  } else if (failed == 1 && uploaded == 0) {
+    server->send(400, "text/plain", state.error);
+  } else if (failed > 0) {
+    String message = "Uploaded " + String(uploaded) + " of " + String(uploaded + failed) + " files. Failed:";
+    for (const String& failure : state.failed) {
+      message += "\n" + failure;
+    }
+    server->send(400, "text/plain", message);
   } else {
-    const String error = state.error.isEmpty() ? "Unknown error during upload" : state.error;
-    server->send(400, "text/plain", error);
+    server->send(400, "text/plain", "Unknown error during upload");
   }
+  state.uploaded.clear();
+  state.failed.clear();
 }
 
 void CrossPointWebServer::handleCreateFolder() const {
@@ -775,7 +974,9 @@ void CrossPointWebServer::handleCreateFolder() const {
   }
 
   // Create the folder
+  DirectoryIndex::Edit edit(parentPath.c_str());
   if (Storage.mkdir(folderPath.c_str())) {
+    edit.added(folderName.c_str(), true, 0);
     LOG_DBG("WEB", "Folder created successfully: %s", folderPath.c_str());
     server->send(200, "text/plain", "Folder created: " + folderName);
   } else {
@@ -853,11 +1054,15 @@ void CrossPointWebServer::handleRename() const {
     return;
   }
 
-  clearEpubCacheIfNeeded(itemPath);
+  clearFileCachesIfNeeded(itemPath);
+  DirectoryIndex::Edit edit(parentPath.c_str());
+  const uint32_t size = file.fileSize();
   const bool success = file.rename(newPath.c_str());
   file.close();
 
   if (success) {
+    edit.removed(itemName.c_str());
+    edit.added(newName.c_str(), false, size);
     LOG_DBG("WEB", "Renamed file: %s -> %s", itemPath.c_str(), newPath.c_str());
     server->send(200, "text/plain", "Renamed successfully");
   } else {
@@ -946,11 +1151,16 @@ void CrossPointWebServer::handleMove() const {
     return;
   }
 
-  clearEpubCacheIfNeeded(itemPath);
+  clearFileCachesIfNeeded(itemPath);
+  DirectoryIndex::Edit fromEdit(FsHelpers::extractFolderPath(itemPath.c_str()));
+  DirectoryIndex::Edit toEdit(destPath.c_str());
+  const uint32_t size = file.fileSize();
   const bool success = file.rename(newPath.c_str());
   file.close();
 
   if (success) {
+    fromEdit.removed(itemName.c_str());
+    toEdit.added(itemName.c_str(), false, size);
     LOG_DBG("WEB", "Moved file: %s -> %s", itemPath.c_str(), newPath.c_str());
     server->send(200, "text/plain", "Moved successfully");
   } else {
@@ -1048,6 +1258,7 @@ void CrossPointWebServer::handleDelete() const {
 
     // Decide whether it's a directory or file by opening it
     bool success = false;
+    DirectoryIndex::Edit edit(FsHelpers::extractFolderPath(itemPath.c_str()));
     FsFile f = Storage.open(itemPath.c_str());
     if (f && f.isDirectory()) {
       // For folders, ensure empty before removing
@@ -1061,14 +1272,17 @@ void CrossPointWebServer::handleDelete() const {
       }
       f.close();
       success = Storage.rmdir(itemPath.c_str());
+      if (success) DirectoryIndex::forget(itemPath.c_str());
     } else {
       // It's a file (or couldn't open as dir) — remove file
       if (f) f.close();
       success = Storage.remove(itemPath.c_str());
-      clearEpubCacheIfNeeded(itemPath);
+      clearFileCachesIfNeeded(itemPath);
     }
 
-    if (!success) {
+    if (success) {
+      edit.removed(itemName.c_str());
+    } else {
       failedItems += itemPath + " (deletion failed); ";
       allSuccess = false;
     }
@@ -1091,7 +1305,8 @@ void CrossPointWebServer::handleGetSettings() const {
 
   server->setContentLength(CONTENT_LENGTH_UNKNOWN);
   server->send(200, "application/json", "");
-  server->sendContent("[");
+  ChunkedResponseWriter out(*server);
+  out.append("[");
 
   char output[512];
   constexpr size_t outputSize = sizeof(output);
@@ -1157,15 +1372,15 @@ void CrossPointWebServer::handleGetSettings() const {
     }
 
     if (seenFirst) {
-      server->sendContent(",");
+      out.append(",");
     } else {
       seenFirst = true;
     }
-    server->sendContent(output);
+    out.append(output, written);
   }
 
-  server->sendContent("]");
-  server->sendContent("");
+  out.append("]");
+  out.finish();
   LOG_DBG("WEB", "Served settings API");
 }
 
@@ -1238,7 +1453,9 @@ void CrossPointWebServer::handlePostSettings() {
     }
   }
 
+  // Written right away, the browser reports them as saved
   SETTINGS.saveToFile();
+  RecordStore::flush();
 
   LOG_DBG("WEB", "Applied %d setting(s)", applied);
   server->send(200, "text/plain", String("Applied ") + String(applied) + " setting(s)");
@@ -1257,6 +1474,15 @@ void CrossPointWebServer::wsEventCallback(uint8_t num, WStype_t type, uint8_t* p
 //   2. Client sends BINARY messages with file data chunks
 //   3. Server sends TEXT "PROGRESS:<received>:<total>" after each chunk
 //   4. Server sends TEXT "DONE" or "ERROR:<message>" when complete
+// Framed variant, used by the files page (the Calibre plugin speaks the one above):
+//   1. Client sends TEXT "BEGIN:<filename>:<size>:<path>"; server answers "READY:<offset>:<window>", offset being where
+//      an upload of the same file cut off by a disconnect carries on (0 for a new one)
+//   2. Client sends BINARY frames of uint32 offset, uint32 CRC-32 of the data (little-endian) and the data, keeping at
+//      most <window> bytes beyond the last acknowledged offset
+//   3. Server sends TEXT "ACK:<received>" for each frame it wrote but the last, or "RETRY:<received>" when a frame
+//      fails its CRC or doesn't start at the received offset; frames sent after it are dropped until the client goes
+//      back there
+//   4. Server sends TEXT "DONE" or "ERROR:<message>" as above; a TEXT "CANCEL" drops the upload and its part
 void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length) {
   switch (type) {
     case WStype_DISCONNECTED:
@@ -1265,7 +1491,11 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
       // A new client may have already started a fresh upload before this
       // DISCONNECTED event fires (race condition on quick cancel + retry).
       if (num == wsUploadClientNum && wsUploadInProgress && wsUploadFile) {
-        abortWsUpload("WS");
+        if (wsUploadFramed) {
+          suspendWsUpload();
+        } else {
+          abortWsUpload("WS");
+        }
       }
       break;
 
@@ -1279,10 +1509,11 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
       String msg = String((char*)payload);
       LOG_DBG("WS", "Text from client %u: %s", num, msg.c_str());
 
-      if (msg.startsWith("START:")) {
+      const bool framed = msg.startsWith("BEGIN:");
+      if (framed || msg.startsWith("START:")) {
         // Reject any START while an upload is already active to prevent
         // leaking the open wsUploadFile handle (owning client re-START included)
-        if (wsUploadInProgress) {
+        if (wsUploadInProgress && !(framed && wsUploadFramed && num != wsUploadClientNum)) {
           wsServer->sendTXT(num, "ERROR:Upload already in progress");
           break;
         }
@@ -1292,7 +1523,7 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
         int secondColon = msg.indexOf(':', firstColon + 1);
 
         if (firstColon > 0 && secondColon > 0) {
-          wsUploadFileName = msg.substring(6, firstColon);
+          const String fileName = msg.substring(6, firstColon);
           String sizeToken = msg.substring(firstColon + 1, secondColon);
           bool sizeValid = sizeToken.length() > 0;
           int digitStart = (sizeValid && sizeToken[0] == '+') ? 1 : 0;
@@ -1305,62 +1536,117 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
             wsServer->sendTXT(num, "ERROR:Invalid START format");
             return;
           }
-          wsUploadSize = sizeToken.toInt();
-          wsUploadPath = msg.substring(secondColon + 1);
-          wsUploadReceived = 0;
-          wsLastProgressSent = 0;
-          wsUploadStartTime = millis();
+          const size_t size = sizeToken.toInt();
+          String path = msg.substring(secondColon + 1);
 
           // Ensure path is valid
-          if (!wsUploadPath.startsWith("/")) wsUploadPath = "/" + wsUploadPath;
-          if (wsUploadPath.length() > 1 && wsUploadPath.endsWith("/")) {
-            wsUploadPath = wsUploadPath.substring(0, wsUploadPath.length() - 1);
+          if (!path.startsWith("/")) path = "/" + path;
+          if (path.length() > 1 && path.endsWith("/")) {
+            path = path.substring(0, path.length() - 1);
+          }
+
+          // A client back from a dropped connection can BEGIN before its old connection is noticed to be gone
+          if (wsUploadInProgress) {
+            if (fileName != wsUploadFileName || path != wsUploadPath || size != wsUploadSize) {
+              wsServer->sendTXT(num, "ERROR:Upload already in progress");
+              break;
+            }
+            suspendWsUpload();
           }
 
+          // A BEGIN of the upload a disconnect cut off carries on from its last whole writer buffer, so writes stay
+          // sector aligned; the part of any other one is removed
+          const bool resume = framed && wsUploadSuspended && fileName == wsUploadFileName && path == wsUploadPath &&
+                              size == wsUploadSize;
+          if (wsUploadSuspended && !resume) {
+            abortWsUpload("WS");
+          }
+          wsUploadSuspended = false;
+
+          {
+            StatusGuard guard;
+            wsUploadFileName = fileName;
+          }
+          wsUploadSize = size;
+          wsUploadPath = path;
+          wsUploadReceived = resume ? wsUploadReceived / UploadWriter::BUFFER_SIZE * UploadWriter::BUFFER_SIZE : 0;
+          wsUploadFramed = framed;
+          wsRetryRequested = false;
+          wsLastProgressSent = wsUploadReceived;
+          wsUploadStartTime = millis();
+
           // Build file path
-          String filePath = wsUploadPath;
-          if (!filePath.endsWith("/")) filePath += "/";
-          filePath += wsUploadFileName;
+          const String filePath = wsUploadFilePath();
 
           LOG_DBG("WS", "Starting upload: %s (%d bytes) to %s", wsUploadFileName.c_str(), wsUploadSize,
                   filePath.c_str());
 
-          // Check if file exists and remove it
-          esp_task_wdt_reset();
-          if (Storage.exists(filePath.c_str())) {
-            Storage.remove(filePath.c_str());
+          if (resume) {
+            LOG_DBG("WS", "Resuming at %zu bytes", wsUploadReceived);
+            wsUploadFile = Storage.open(filePath.c_str(), O_RDWR);
+            if (!wsUploadFile || !wsUploadFile.seekSet(wsUploadReceived)) {
+              abortWsUpload("WS");
+              wsServer->sendTXT(num, "ERROR:Failed to reopen file");
+              return;
+            }
+          } else {
+            // Check if file exists and remove it
+            esp_task_wdt_reset();
+            DirectoryIndex::Edit& edit = holdWsIndexEdit();
+            if (Storage.exists(filePath.c_str())) {
+              Storage.remove(filePath.c_str());
+              edit.removed(wsUploadFileName.c_str());
+            }
+
+            // Open file for writing
+            esp_task_wdt_reset();
+            if (!Storage.openFileForWrite("WS", filePath, wsUploadFile)) {
+              wsServer->sendTXT(num, "ERROR:Failed to create file");
+              wsUploadInProgress = false;
+              wsUploadClientNum = 255;
+              return;
+            }
+            edit.added(wsUploadFileName.c_str(), false, 0);
+            esp_task_wdt_reset();
           }
 
-          // Open file for writing
-          esp_task_wdt_reset();
-          if (!Storage.openFileForWrite("WS", filePath, wsUploadFile)) {
-            wsServer->sendTXT(num, "ERROR:Failed to create file");
-            wsUploadInProgress = false;
-            wsUploadClientNum = 255;
-            return;
-          }
-          esp_task_wdt_reset();
-
           // Zero-byte upload: complete immediately without waiting for BIN frames
           if (wsUploadSize == 0) {
             // Explicit close() required: file-scope global persists beyond function scope
             wsUploadFile.close();
-            wsLastCompleteName = wsUploadFileName;
-            wsLastCompleteSize = 0;
-            wsLastCompleteAt = millis();
+            {
+              StatusGuard guard;
+              wsLastCompleteName = wsUploadFileName;
+              wsLastCompleteSize = 0;
+              wsLastCompleteAt = millis();
+            }
             LOG_DBG("WS", "Zero-byte upload complete: %s", filePath.c_str());
-            clearEpubCacheIfNeeded(filePath);
+            invalidateFileCachesIfNeeded(filePath);
             wsServer->sendTXT(num, "DONE");
             wsLastProgressSent = 0;
+            if (uploadCallback) {
+              uploadCallback(filePath.c_str());
+            }
             break;
           }
 
+          wsUploadWriter.begin(wsUploadFile);
           wsUploadClientNum = num;
           wsUploadInProgress = true;
-          wsServer->sendTXT(num, "READY");
+          if (framed) {
+            String ready = "READY:" + String(wsUploadReceived) + ":" + String(WS_UPLOAD_WINDOW);
+            wsServer->sendTXT(num, ready);
+          } else {
+            wsServer->sendTXT(num, "READY");
+          }
         } else {
           wsServer->sendTXT(num, "ERROR:Invalid START format");
         }
+      } else if (msg == "CANCEL") {
+        // A framed upload the user cancelled isn't kept for resuming
+        if (num == wsUploadClientNum && wsUploadInProgress && wsUploadFile) {
+          abortWsUpload("WS");
+        }
       }
       break;
     }
@@ -1371,7 +1657,36 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
         return;
       }
 
-      // Write binary data directly to file
+      if (wsUploadFramed) {
+        if (length < WS_FRAME_HEADER_SIZE) {
+          abortWsUpload("WS");
+          wsServer->sendTXT(num, "ERROR:Invalid frame");
+          return;
+        }
+        uint32_t offset;
+        uint32_t crc;
+        memcpy(&offset, payload, sizeof(offset));
+        memcpy(&crc, payload + sizeof(offset), sizeof(crc));
+        payload += WS_FRAME_HEADER_SIZE;
+        length -= WS_FRAME_HEADER_SIZE;
+        if (offset < wsUploadReceived) {
+          return;  // Sent again after a RETRY that came too late for it
+        }
+        if (offset > wsUploadReceived || esp_rom_crc32_le(0, payload, length) != crc) {
+          // Ask once; the frames already in flight behind this one are dropped until the client goes back
+          if (!wsRetryRequested) {
+            LOG_DBG("WS", "Frame at %lu rejected, asking for %zu again", static_cast<unsigned long>(offset),
+                    wsUploadReceived);
+            wsRetryRequested = true;
+            String retry = "RETRY:" + String(wsUploadReceived);
+            wsServer->sendTXT(num, retry);
+          }
+          return;
+        }
+        wsRetryRequested = false;
+      }
+
+      // Queue the frame; the writer task writes full buffers while the next frames arrive
       size_t remaining = wsUploadSize - wsUploadReceived;
       if (length > remaining) {
         abortWsUpload("WS");
@@ -1379,19 +1694,25 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
         return;
       }
       esp_task_wdt_reset();
-      size_t written = wsUploadFile.write(payload, length);
+      // The last frame also waits for everything queued to reach the card
+      const bool written = wsUploadWriter.write(payload, length) &&
+                           (wsUploadReceived + length < wsUploadSize || wsUploadWriter.finish());
       esp_task_wdt_reset();
 
-      if (written != length) {
+      if (!written) {
         abortWsUpload("WS");
         wsServer->sendTXT(num, "ERROR:Write failed - disk full?");
         return;
       }
 
-      wsUploadReceived += written;
+      wsUploadReceived += length;
 
-      // Send progress update (every 64KB or at end)
-      if (wsUploadReceived - wsLastProgressSent >= 65536 || wsUploadReceived >= wsUploadSize) {
+      // Framed uploads are acknowledged frame by frame, which opens the client's window again
+      if (wsUploadFramed && wsUploadReceived < wsUploadSize) {
+        String ack = "ACK:" + String(wsUploadReceived);
+        wsServer->sendTXT(num, ack);
+      } else if (wsUploadReceived - wsLastProgressSent >= 65536 || wsUploadReceived >= wsUploadSize) {
+        // Send progress update (every 64KB or at end)
         String progress = "PROGRESS:" + String(wsUploadReceived) + ":" + String(wsUploadSize);
         wsServer->sendTXT(num, progress);
         wsLastProgressSent = wsUploadReceived;
@@ -1399,14 +1720,22 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
 
       // Check if upload complete
       if (wsUploadReceived >= wsUploadSize) {
-        // Explicit close() required: file-scope global persists beyond function scope
-        wsUploadFile.close();
+        {
+          // Before close(), which updates the file's directory entry
+          DirectoryIndex::Edit& edit = holdWsIndexEdit();
+          // Explicit close() required: file-scope global persists beyond function scope
+          wsUploadFile.close();
+          edit.added(wsUploadFileName.c_str(), false, wsUploadSize);
+        }
         wsUploadInProgress = false;
         wsUploadClientNum = 255;
 
-        wsLastCompleteName = wsUploadFileName;
-        wsLastCompleteSize = wsUploadSize;
-        wsLastCompleteAt = millis();
+        {
+          StatusGuard guard;
+          wsLastCompleteName = wsUploadFileName;
+          wsLastCompleteSize = wsUploadSize;
+          wsLastCompleteAt = millis();
+        }
 
         unsigned long elapsed = millis() - wsUploadStartTime;
         float kbps = (elapsed > 0) ? (wsUploadSize / 1024.0) / (elapsed / 1000.0) : 0;
@@ -1414,14 +1743,15 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
         LOG_DBG("WS", "Upload complete: %s (%d bytes in %lu ms, %.1f KB/s)", wsUploadFileName.c_str(), wsUploadSize,
                 elapsed, kbps);
 
-        // Clear epub cache to prevent stale metadata issues when overwriting files
-        String filePath = wsUploadPath;
-        if (!filePath.endsWith("/")) filePath += "/";
-        filePath += wsUploadFileName;
-        clearEpubCacheIfNeeded(filePath);
+        // Mark the epub cache stale to prevent stale metadata issues when overwriting files
+        const String filePath = wsUploadFilePath();
+        invalidateFileCachesIfNeeded(filePath);
 
         wsServer->sendTXT(num, "DONE");
         wsLastProgressSent = 0;
+        if (uploadCallback) {
+          uploadCallback(filePath.c_str());
+        }
       }
       break;
     }
@@ -5,13 +5,18 @@
 #include <WebServer.h>
 #include <WebSocketsServer.h>
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
 
-// Structure to hold file information
+#include "UploadWriter.h"
+#include "activities/Worker.h"
+#include "util/DirectoryIndex.h"
+
+// Structure to hold file information; name is only valid during the scanFiles() callback
 struct FileInfo {
-  String name;
+  const char* name;
   size_t size;
   bool isEpub;
   bool isDirectory;
@@ -29,46 +34,89 @@ class CrossPointWebServer {
     unsigned long lastCompleteAt = 0;
   };
 
-  // Used by POST upload handler
+  // Progress of the device preparing uploaded books for reading, reported by /api/status
+  struct IndexingStatus {
+    size_t pending = 0;
+    uint32_t done = 0;
+    std::string current;
+  };
+
+  // Used by POST upload handler. A request may carry several files (one multipart part each), written one after the
+  // other; the folder's index, the book caches and the upload callback are brought up to date once it ends.
   struct UploadState {
     FsFile file;
     String fileName;
     String path = "/";
     size_t size = 0;
-    bool success = false;
     String error = "";
 
-    // Upload write buffer - batches small writes into larger SD card operations
-    // 4KB is a good balance: large enough to reduce syscall overhead, small enough
-    // to keep individual write times short and avoid watchdog issues
-    static constexpr size_t UPLOAD_BUFFER_SIZE = 4096;  // 4KB buffer
-    std::vector<uint8_t> buffer;
-    size_t bufferPos = 0;
+    // Batches the small chunks the HTTP parser hands us into sector-aligned writes done in the background
+    UploadWriter writer;
+
+    // The request's files so far; the Edit is open from its first file to its end
+    std::unique_ptr<DirectoryIndex::Edit> indexEdit;
+    std::vector<String> uploaded;  // Paths
+    std::vector<String> failed;    // "<name>: <error>"
 
-    UploadState() { buffer.resize(UPLOAD_BUFFER_SIZE); }
+    String filePath() const {
+      String filePath = path;
+      if (!filePath.endsWith("/")) filePath += "/";
+      filePath += fileName;
+      return filePath;
+    }
   } upload;
 
   CrossPointWebServer();
   ~CrossPointWebServer();
 
-  // Start the web server (call after WiFi is connected)
+  // Start the web server (call after WiFi is connected). Requests are served on a task of its own from then on, so set
+  // the callbacks first; they run on that task.
   void begin();
 
-  // Stop the web server
+  // Stop the web server, waiting for the request being served
   void stop();
 
-  // Call this periodically to handle client requests
-  void handleClient();
-
   // Check if server is running
   bool isRunning() const { return running; }
 
+  // Safe to poll from the activity while the server task updates it
   WsUploadStatus getWsUploadStatus() const;
 
+  // True while a file is being received, over either upload path
+  bool isUploading() const;
+
   // Get the port number
   uint16_t getPort() const { return port; }
 
+  // Called on the server task with the path of every file uploaded successfully (HTTP or WebSocket)
+  void setUploadCallback(std::function<void(const std::string&)> callback) { uploadCallback = std::move(callback); }
+
+  // Queried from handleStatus(); without a provider the status has no indexing section
+  void setIndexingStatusProvider(std::function<IndexingStatus()> provider) {
+    indexingStatusProvider = std::move(provider);
+  }
+
  private:
+  // Polls the HTTP, WebSocket and discovery sockets: back to back while a file streams in, otherwise once per
+  // POLL_INTERVAL_MS so idle-priority work (the thumbnail generator) gets the CPU in between. The Arduino servers
+  // offer no way to block on their sockets, so this short sleep stands in for it.
+  class ServerTask final : public Worker {
+    CrossPointWebServer& owner;
+    void run() override;
+
+   public:
+    static constexpr uint32_t STACK_SIZE = 8192;  // Same as the loop task, which used to serve the requests
+    // The loop task's: the activity keeps the screen and buttons responsive while an upload runs
+    static constexpr UBaseType_t PRIORITY = tskIDLE_PRIORITY + 1;
+    static constexpr unsigned long POLL_INTERVAL_MS = 1;
+
+    explicit ServerTask(CrossPointWebServer& owner) : Worker("WebServer"), owner(owner) {}
+    ~ServerTask() override { stop(); }
+  };
+  ServerTask task{*this};
+
+  void handleClient();
+
   std::unique_ptr<WebServer> server = nullptr;
   std::unique_ptr<WebSocketsServer> wsServer = nullptr;
   bool running = false;
@@ -77,11 +125,15 @@ class CrossPointWebServer {
   uint16_t wsPort = 81;  // WebSocket port
   NetworkUDP udp;
   bool udpActive = false;
+  std::function<void(const std::string&)> uploadCallback;
+  std::function<IndexingStatus()> indexingStatusProvider;
 
   // WebSocket upload state
   void onWebSocketEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length);
   static void wsEventCallback(uint8_t num, WStype_t type, uint8_t* payload, size_t length);
   void abortWsUpload(const char* tag);
+  // Closes a framed upload whose client went away, keeping the part for a BEGIN that resumes it
+  void suspendWsUpload();
 
   // File scanning
   void scanFiles(const char* path, const std::function<void(FileInfo)>& callback) const;
@@ -93,11 +145,15 @@ class CrossPointWebServer {
   void handleJszip() const;
   void handleNotFound() const;
   void handleStatus() const;
+  void handlePerfHistory() const;
   void handleFileList() const;
   void handleFileListData() const;
+  void handleLibraryData() const;
+  void handlePostLibrary() const;
   void handleDownload() const;
   void handleUpload(UploadState& state) const;
   void handleUploadPost(UploadState& state) const;
+  void finishUploadBatch(UploadState& state) const;
   void handleCreateFolder() const;
   void handleRename() const;
   void handleMove() const;
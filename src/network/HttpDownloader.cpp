@@ -6,87 +6,313 @@
 #include <NetworkClientSecure.h>
 #include <StreamString.h>
 #include <base64.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <functional>
 #include <memory>
 #include <utility>
 
 #include "CrossPointSettings.h"
+#include "UploadWriter.h"
 #include "util/UrlUtils.h"
 
 namespace {
+constexpr const char* FEED_CACHE_DIR = "/.crosspoint/opds";
+// Copies are kept in a fixed set of slots picked by URL hash, which bounds the cache without any bookkeeping
+constexpr size_t FEED_CACHE_SLOTS = 16;
+constexpr size_t MAX_CACHE_LINE = 512;
+
+// The connection kept alive between requests. client is declared first so http, which stops it, goes first.
+struct Session {
+  std::unique_ptr<NetworkClient> client;
+  HTTPClient http;
+  std::string origin;
+};
+std::unique_ptr<Session> session;
+
+// Held for a whole request, so a worker's request waits for the main loop's and the other way round. Recursive, as
+// beginRequest() closes the session when the origin changes.
+class SessionLock {
+  static SemaphoreHandle_t mutex() {
+    static const SemaphoreHandle_t handle = xSemaphoreCreateRecursiveMutex();
+    return handle;
+  }
+
+ public:
+  SessionLock() { xSemaphoreTakeRecursive(mutex(), portMAX_DELAY); }
+  ~SessionLock() { xSemaphoreGiveRecursive(mutex()); }
+  SessionLock(const SessionLock&) = delete;
+  SessionLock& operator=(const SessionLock&) = delete;
+};
+
+// Starts a request on the session, reconnecting only when the origin changes
+HTTPClient& beginRequest(const std::string& url, const bool sendCredentials = true) {
+  const std::string origin = UrlUtils::extractHost(url);
+  if (!session || session->origin != origin) {
+    HttpDownloader::closeSession();
+    session.reset(new Session());
+    // Use NetworkClientSecure for HTTPS, regular NetworkClient for HTTP
+    if (UrlUtils::isHttpsUrl(url)) {
+      auto* secureClient = new NetworkClientSecure();
+      secureClient->setInsecure();
+      session->client.reset(secureClient);
+    } else {
+      session->client.reset(new NetworkClient());
+    }
+    session->origin = origin;
+    session->http.setReuse(true);
+  }
+
+  HTTPClient& http = session->http;
+  http.begin(*session->client, url.c_str());
+  http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
+  http.addHeader("User-Agent", "CrossPoint-ESP32-" CROSSPOINT_VERSION);
+
+  // Add Basic HTTP auth if credentials are configured
+  if (sendCredentials && strlen(SETTINGS.opdsUsername) > 0 && strlen(SETTINGS.opdsPassword) > 0) {
+    std::string credentials = std::string(SETTINGS.opdsUsername) + ":" + SETTINGS.opdsPassword;
+    String encoded = base64::encode(credentials.c_str());
+    http.addHeader("Authorization", "Basic " + encoded);
+  }
+  return http;
+}
+
+// After a failed request the connection may still hold part of a response, so it is not reused
+void endRequest(const bool ok) {
+  session->http.end();
+  if (!ok) {
+    HttpDownloader::closeSession();
+  }
+}
+
+// Cache file layout: the URL, ETag and Last-Modified, one per line, followed by the body
+struct CachedFeed {
+  FsFile file;
+  std::string etag;
+  std::string lastModified;
+};
+
+std::string feedCachePath(const std::string& url) {
+  // Keyed on the user too, so a feed fetched with other credentials is never served
+  const size_t slot = std::hash<std::string>{}(url + '\n' + SETTINGS.opdsUsername) % FEED_CACHE_SLOTS;
+  return std::string(FEED_CACHE_DIR) + "/" + std::to_string(slot) + ".feed";
+}
+
+bool readCacheLine(FsFile& file, std::string& line) {
+  line.clear();
+  char c;
+  while (file.read(&c, 1) == 1) {
+    if (c == '\n') {
+      return true;
+    }
+    if (line.size() == MAX_CACHE_LINE) {
+      return false;
+    }
+    line += c;
+  }
+  return false;
+}
+
+// Opens the copy of url, positioned at the body
+bool openCachedFeed(const std::string& url, CachedFeed& cached) {
+  const std::string path = feedCachePath(url);
+  if (!Storage.exists(path.c_str()) || !Storage.openFileForRead("HTTP", path, cached.file)) {
+    return false;
+  }
+  std::string cachedUrl;
+  if (readCacheLine(cached.file, cachedUrl) && cachedUrl == url && readCacheLine(cached.file, cached.etag) &&
+      readCacheLine(cached.file, cached.lastModified)) {
+    return true;
+  }
+  // Another URL in the same slot, or a damaged file
+  cached.file.close();
+  return false;
+}
+
+void sendCachedBody(FsFile& file, Stream& out) {
+  uint8_t buffer[512];
+  int bytesRead;
+  while ((bytesRead = file.read(buffer, sizeof(buffer))) > 0) {
+    out.write(buffer, bytesRead);
+  }
+  file.close();
+}
+
+// Passes the body on while copying it to the cache file
+class CacheWriteStream final : public Stream {
+ public:
+  CacheWriteStream(Stream& out, FsFile& file) : out_(out), file_(file) {}
+
+  size_t write(uint8_t byte) override { return write(&byte, 1); }
+
+  size_t write(const uint8_t* buffer, size_t size) override {
+    if (writeOk_ && file_.write(buffer, size) != size) {
+      writeOk_ = false;
+    }
+    return out_.write(buffer, size);
+  }
+
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+
+  bool ok() const { return writeOk_; }
+
+ private:
+  Stream& out_;
+  FsFile& file_;
+  bool writeOk_ = true;
+};
+
+// Feeds the body to the background SD writer, with progress tracking
 class FileWriteStream final : public Stream {
  public:
-  FileWriteStream(FsFile& file, size_t total, HttpDownloader::ProgressCallback progress)
-      : file_(file), total_(total), progress_(std::move(progress)) {}
+  FileWriteStream(UploadWriter& writer, size_t offset, size_t total, HttpDownloader::ProgressCallback progress,
+                  std::function<bool()> cancelled)
+      : writer_(writer),
+        offset_(offset),
+        total_(total),
+        progress_(std::move(progress)),
+        cancelled_(std::move(cancelled)) {}
 
   size_t write(uint8_t byte) override { return write(&byte, 1); }
 
   size_t write(const uint8_t* buffer, size_t size) override {
-    // Write-through stream for HTTPClient::writeToStream with progress tracking.
-    const size_t written = file_.write(buffer, size);
-    if (written != size) {
+    if (cancelled_ && cancelled_()) {
+      aborted_ = true;
+      return 0;  // Makes writeToStream give up; what was written is kept
+    }
+    if (!writer_.write(buffer, size)) {
       writeOk_ = false;
+      return 0;  // Makes writeToStream give up instead of downloading into a failed file
     }
-    downloaded_ += written;
+    downloaded_ += size;
     if (progress_ && total_ > 0) {
-      progress_(downloaded_, total_);
+      progress_(offset_ + downloaded_, total_);
     }
-    return written;
+    return size;
   }
 
   int available() override { return 0; }
   int read() override { return -1; }
   int peek() override { return -1; }
-  void flush() override { file_.flush(); }
 
   size_t downloaded() const { return downloaded_; }
   bool ok() const { return writeOk_; }
+  bool aborted() const { return aborted_; }
 
  private:
-  FsFile& file_;
+  UploadWriter& writer_;
+  size_t offset_;
   size_t total_;
   size_t downloaded_ = 0;
   bool writeOk_ = true;
+  bool aborted_ = false;
   HttpDownloader::ProgressCallback progress_;
+  std::function<bool()> cancelled_;
 };
+
+// What a .part file was downloaded from, so a resumed request can ask for the same version of the file
+struct PartInfo {
+  size_t total = 0;
+  std::string validator;  // ETag, or Last-Modified if the server sent no ETag
+};
+
+bool readPartInfo(const std::string& path, PartInfo& info) {
+  FsFile file;
+  if (!Storage.exists(path.c_str()) || !Storage.openFileForRead("HTTP", path, file)) {
+    return false;
+  }
+  std::string total;
+  const bool ok = readCacheLine(file, total) && readCacheLine(file, info.validator);
+  file.close();
+  info.total = ok ? strtoul(total.c_str(), nullptr, 10) : 0;
+  return ok && info.total > 0;
+}
+
+void writePartInfo(const std::string& path, const PartInfo& info) {
+  FsFile file;
+  if (Storage.openFileForWrite("HTTP", path, file)) {
+    const std::string content = std::to_string(info.total) + "\n" + info.validator + "\n";
+    file.write(content.data(), content.size());
+    file.close();
+  }
+}
+
+void removePart(const std::string& partPath, const std::string& infoPath) {
+  Storage.remove(partPath.c_str());
+  Storage.remove(infoPath.c_str());
+}
 }  // namespace
 
-bool HttpDownloader::fetchUrl(const std::string& url, Stream& outContent) {
-  // Use NetworkClientSecure for HTTPS, regular NetworkClient for HTTP
-  std::unique_ptr<NetworkClient> client;
-  if (UrlUtils::isHttpsUrl(url)) {
-    auto* secureClient = new NetworkClientSecure();
-    secureClient->setInsecure();
-    client.reset(secureClient);
-  } else {
-    client.reset(new NetworkClient());
+bool HttpDownloader::fetchUrl(const std::string& url, Stream& outContent, const CachePolicy cache) {
+  SessionLock lock;
+  CachedFeed cached;
+  const bool haveCached = cache != CachePolicy::NONE && openCachedFeed(url, cached);
+  if (haveCached && cache == CachePolicy::PREFER_CACHE) {
+    LOG_DBG("HTTP", "Using cached copy of %s", url.c_str());
+    sendCachedBody(cached.file, outContent);
+    return true;
   }
-  HTTPClient http;
 
   LOG_DBG("HTTP", "Fetching: %s", url.c_str());
 
-  http.begin(*client, url.c_str());
-  http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
-  http.addHeader("User-Agent", "CrossPoint-ESP32-" CROSSPOINT_VERSION);
-
-  // Add Basic HTTP auth if credentials are configured
-  if (strlen(SETTINGS.opdsUsername) > 0 && strlen(SETTINGS.opdsPassword) > 0) {
-    std::string credentials = std::string(SETTINGS.opdsUsername) + ":" + SETTINGS.opdsPassword;
-    String encoded = base64::encode(credentials.c_str());
-    http.addHeader("Authorization", "Basic " + encoded);
+  HTTPClient& http = beginRequest(url);
+  if (haveCached) {
+    if (!cached.etag.empty()) http.addHeader("If-None-Match", cached.etag.c_str());
+    if (!cached.lastModified.empty()) http.addHeader("If-Modified-Since", cached.lastModified.c_str());
   }
+  const char* validatorHeaders[] = {"ETag", "Last-Modified"};
+  http.collectHeaders(validatorHeaders, 2);
 
   const int httpCode = http.GET();
+  if (haveCached && httpCode == HTTP_CODE_NOT_MODIFIED) {
+    endRequest(true);
+    LOG_DBG("HTTP", "Not modified, using cached copy");
+    sendCachedBody(cached.file, outContent);
+    return true;
+  }
+  if (haveCached) {
+    cached.file.close();
+  }
   if (httpCode != HTTP_CODE_OK) {
     LOG_ERR("HTTP", "Fetch failed: %d", httpCode);
-    http.end();
+    endRequest(false);
     return false;
   }
 
-  http.writeToStream(&outContent);
+  int writeResult;
+  const std::string cachePath = feedCachePath(url);
+  const std::string tempPath = cachePath + ".tmp";
+  FsFile cacheFile;
+  if (cache != CachePolicy::NONE && Storage.ensureDirectoryExists(FEED_CACHE_DIR) &&
+      Storage.openFileForWrite("HTTP", tempPath, cacheFile)) {
+    // Written under a temporary name so an interrupted fetch never replaces a good copy
+    const std::string header =
+        url + "\n" + http.header("ETag").c_str() + "\n" + http.header("Last-Modified").c_str() + "\n";
+    CacheWriteStream stream(outContent, cacheFile);
+    const bool headerOk = cacheFile.write(header.data(), header.size()) == header.size();
+    writeResult = http.writeToStream(&stream);
+    cacheFile.close();
+    if (writeResult >= 0 && headerOk && stream.ok()) {
+      Storage.remove(cachePath.c_str());
+      Storage.rename(tempPath.c_str(), cachePath.c_str());
+    } else {
+      Storage.remove(tempPath.c_str());
+    }
+  } else {
+    writeResult = http.writeToStream(&outContent);
+  }
 
-  http.end();
+  endRequest(writeResult >= 0);
+  if (writeResult < 0) {
+    LOG_ERR("HTTP", "writeToStream error: %d", writeResult);
+    return false;
+  }
 
   LOG_DBG("HTTP", "Fetch success");
   return true;
@@ -103,35 +329,58 @@ bool HttpDownloader::fetchUrl(const std::string& url, std::string& outContent) {
 
 HttpDownloader::DownloadError HttpDownloader::downloadToFile(const std::string& url, const std::string& destPath,
                                                              ProgressCallback progress) {
-  // Use NetworkClientSecure for HTTPS, regular NetworkClient for HTTP
-  std::unique_ptr<NetworkClient> client;
-  if (UrlUtils::isHttpsUrl(url)) {
-    auto* secureClient = new NetworkClientSecure();
-    secureClient->setInsecure();
-    client.reset(secureClient);
-  } else {
-    client.reset(new NetworkClient());
-  }
-  HTTPClient http;
+  return downloadToFile(url, destPath, std::move(progress), DownloadOptions());
+}
 
+HttpDownloader::DownloadError HttpDownloader::downloadToFile(const std::string& url, const std::string& destPath,
+                                                             ProgressCallback progress,
+                                                             const DownloadOptions& options) {
+  SessionLock lock;
   LOG_DBG("HTTP", "Downloading: %s", url.c_str());
   LOG_DBG("HTTP", "Destination: %s", destPath.c_str());
 
-  http.begin(*client, url.c_str());
-  http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
-  http.addHeader("User-Agent", "CrossPoint-ESP32-" CROSSPOINT_VERSION);
+  // The body goes to destPath.part and is renamed when complete. A part left by an interrupted download is resumed
+  // with a Range request, from its last whole buffer so writes stay sector aligned.
+  const std::string partPath = destPath + ".part";
+  const std::string infoPath = partPath + ".info";
+  PartInfo partInfo;
+  size_t resumeFrom = 0;
+  if (Storage.exists(partPath.c_str()) && readPartInfo(infoPath, partInfo)) {
+    FsFile part = Storage.open(partPath.c_str());
+    resumeFrom = part ? part.size() / UploadWriter::BUFFER_SIZE * UploadWriter::BUFFER_SIZE : 0;
+    part.close();
+  }
 
-  // Add Basic HTTP auth if credentials are configured
-  if (strlen(SETTINGS.opdsUsername) > 0 && strlen(SETTINGS.opdsPassword) > 0) {
-    std::string credentials = std::string(SETTINGS.opdsUsername) + ":" + SETTINGS.opdsPassword;
-    String encoded = base64::encode(credentials.c_str());
-    http.addHeader("Authorization", "Basic " + encoded);
+  HTTPClient& http = beginRequest(url, options.sendCredentials);
+  if (resumeFrom > 0) {
+    LOG_DBG("HTTP", "Resuming at %zu of %zu", resumeFrom, partInfo.total);
+    http.addHeader("Range", ("bytes=" + std::to_string(resumeFrom) + "-").c_str());
+    // A server whose file has changed since answers with all of it (200) instead
+    if (!partInfo.validator.empty()) http.addHeader("If-Range", partInfo.validator.c_str());
   }
+  const char* responseHeaders[] = {"Content-Range", "ETag", "Last-Modified"};
+  http.collectHeaders(responseHeaders, 3);
 
   const int httpCode = http.GET();
-  if (httpCode != HTTP_CODE_OK) {
+  if (httpCode == HTTP_CODE_PARTIAL_CONTENT && resumeFrom > 0) {
+    size_t first = 0;
+    size_t last = 0;
+    size_t total = 0;
+    if (sscanf(http.header("Content-Range").c_str(), "bytes %zu-%zu/%zu", &first, &last, &total) != 3 ||
+        first != resumeFrom || total != partInfo.total) {
+      LOG_ERR("HTTP", "Unexpected Content-Range: %s", http.header("Content-Range").c_str());
+      endRequest(false);
+      removePart(partPath, infoPath);
+      return HTTP_ERROR;
+    }
+  } else if (httpCode == HTTP_CODE_OK) {
+    resumeFrom = 0;
+  } else {
     LOG_ERR("HTTP", "Download failed: %d", httpCode);
-    http.end();
+    endRequest(false);
+    if (httpCode == HTTP_CODE_RANGE_NOT_SATISFIABLE) {
+      removePart(partPath, infoPath);
+    }
     return HTTP_ERROR;
   }
 
@@ -143,54 +392,100 @@ HttpDownloader::DownloadError HttpDownloader::downloadToFile(const std::string&
     LOG_DBG("HTTP", "Content-Length: unknown");
   }
 
-  // Remove existing file if present
-  if (Storage.exists(destPath.c_str())) {
-    Storage.remove(destPath.c_str());
-  }
-
-  // Open file for writing
   FsFile file;
-  if (!Storage.openFileForWrite("HTTP", destPath.c_str(), file)) {
-    LOG_ERR("HTTP", "Failed to open file for writing");
-    http.end();
-    return FILE_ERROR;
+  if (resumeFrom > 0) {
+    file = Storage.open(partPath.c_str(), O_RDWR);
+    if (!file || !file.seekSet(resumeFrom)) {
+      LOG_ERR("HTTP", "Failed to reopen %s", partPath.c_str());
+      file.close();
+      endRequest(false);
+      return FILE_ERROR;
+    }
+  } else {
+    if (Storage.exists(partPath.c_str())) {
+      Storage.remove(partPath.c_str());
+    }
+    if (!Storage.openFileForWrite("HTTP", partPath.c_str(), file)) {
+      LOG_ERR("HTTP", "Failed to open file for writing");
+      endRequest(false);
+      return FILE_ERROR;
+    }
+    // Only a download of known size can be resumed
+    partInfo.total = contentLength;
+    partInfo.validator = http.header("ETag").c_str();
+    if (partInfo.validator.empty()) partInfo.validator = http.header("Last-Modified").c_str();
+    if (partInfo.total > 0) {
+      writePartInfo(infoPath, partInfo);
+    } else {
+      Storage.remove(infoPath.c_str());
+    }
   }
+  const size_t totalLength = resumeFrom > 0 ? partInfo.total : contentLength;
 
-  // Let HTTPClient handle chunked decoding and stream body bytes into the file.
-  FileWriteStream fileStream(file, contentLength, progress);
+  // Let HTTPClient handle chunked decoding; the body is written to SD in the background while more is received
+  UploadWriter writer;
+  writer.begin(file);
+  FileWriteStream fileStream(writer, resumeFrom, totalLength, progress, options.cancelled);
   const int writeResult = http.writeToStream(&fileStream);
+  const bool writeOk = writer.finish() && fileStream.ok();
 
   file.close();
-  http.end();
+  endRequest(writeResult >= 0);
 
-  if (writeResult < 0) {
-    LOG_ERR("HTTP", "writeToStream error: %d", writeResult);
-    Storage.remove(destPath.c_str());
-    return HTTP_ERROR;
-  }
-
-  const size_t downloaded = fileStream.downloaded();
+  const size_t downloaded = resumeFrom + fileStream.downloaded();
   LOG_DBG("HTTP", "Downloaded %zu bytes", downloaded);
 
   // Guard against partial writes even if HTTPClient completes.
-  if (!fileStream.ok()) {
+  if (!writeOk) {
     LOG_ERR("HTTP", "Write failed during download");
-    Storage.remove(destPath.c_str());
+    removePart(partPath, infoPath);
     return FILE_ERROR;
   }
 
-  if (contentLength == 0 && downloaded == 0) {
+  if (fileStream.aborted()) {
+    LOG_DBG("HTTP", "Download stopped at %zu bytes", downloaded);
+    return ABORTED;
+  }
+
+  if (writeResult < 0) {
+    // The part file is kept for the next attempt to resume from
+    LOG_ERR("HTTP", "writeToStream error: %d", writeResult);
+    return HTTP_ERROR;
+  }
+
+  if (totalLength == 0 && downloaded == 0) {
     LOG_ERR("HTTP", "Download failed: no data received");
-    Storage.remove(destPath.c_str());
+    removePart(partPath, infoPath);
     return HTTP_ERROR;
   }
 
   // Verify download size if known
-  if (contentLength > 0 && downloaded != contentLength) {
-    LOG_ERR("HTTP", "Size mismatch: got %zu, expected %zu", downloaded, contentLength);
-    Storage.remove(destPath.c_str());
+  if (totalLength > 0 && downloaded != totalLength) {
+    LOG_ERR("HTTP", "Size mismatch: got %zu, expected %zu", downloaded, totalLength);
+    if (downloaded > totalLength) {
+      removePart(partPath, infoPath);
+    }
     return HTTP_ERROR;
   }
 
+  // Replace any existing file only once the new one is complete
+  if (Storage.exists(destPath.c_str())) {
+    Storage.remove(destPath.c_str());
+  }
+  Storage.remove(infoPath.c_str());
+  if (!Storage.rename(partPath.c_str(), destPath.c_str())) {
+    LOG_ERR("HTTP", "Failed to rename %s", partPath.c_str());
+    return FILE_ERROR;
+  }
+
   return OK;
 }
+
+void HttpDownloader::closeSession() {
+  SessionLock lock;
+  if (session) {
+    session->http.end();
+    session->client->stop();
+    session.reset();
+  }
+}
@@ -7,6 +7,11 @@
 /**
  * HTTP client utility for fetching content and downloading files.
  * Wraps NetworkClientSecure and HTTPClient for HTTPS requests.
+ *
+ * The connection is kept alive between requests to the same origin (scheme, host and port), so browsing a catalog
+ * pays for the TCP and TLS setup once. Call closeSession() when done to free it; TLS buffers take tens of KB.
+ *
+ * Requests may come from a worker as well as the main loop; they take turns on the one connection.
  */
 class HttpDownloader {
  public:
@@ -19,6 +24,20 @@ class HttpDownloader {
     ABORTED,
   };
 
+  struct DownloadOptions {
+    // Sends the OPDS server's credentials, if set; off for downloads from anywhere else
+    bool sendCredentials = true;
+    // Polled as the body arrives; returning true stops the download (ABORTED), keeping the part to resume
+    std::function<bool()> cancelled;
+  };
+
+  // How fetchUrl() uses the copies of recently fetched URLs kept on the SD card
+  enum class CachePolicy {
+    NONE,          // Always fetch from the server, keep no copy
+    REVALIDATE,    // Ask the server with the copy's ETag/Last-Modified; a 304 is answered from the copy
+    PREFER_CACHE,  // Use the copy without asking the server, fetch only if there is none
+  };
+
   /**
    * Fetch text content from a URL.
    * @param url The URL to fetch
@@ -27,10 +46,12 @@ class HttpDownloader {
    */
   static bool fetchUrl(const std::string& url, std::string& outContent);
 
-  static bool fetchUrl(const std::string& url, Stream& stream);
+  static bool fetchUrl(const std::string& url, Stream& stream, CachePolicy cache = CachePolicy::NONE);
 
   /**
    * Download a file to the SD card.
+   * The body is written to destPath + ".part", which is renamed once complete. If the connection drops, the part is
+   * kept and the next download of the same URL to the same path resumes it with a Range request.
    * @param url The URL to download
    * @param destPath The destination path on SD card
    * @param progress Optional progress callback
@@ -38,4 +59,11 @@ class HttpDownloader {
    */
   static DownloadError downloadToFile(const std::string& url, const std::string& destPath,
                                       ProgressCallback progress = nullptr);
+  static DownloadError downloadToFile(const std::string& url, const std::string& destPath, ProgressCallback progress,
+                                      const DownloadOptions& options);
+
+  /**
+   * Close the kept-alive connection, if any.
+   */
+  static void closeSession();
 };
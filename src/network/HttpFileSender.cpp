@@ -0,0 +1,159 @@
+#include "HttpFileSender.h"
+
+#include <Logging.h>
+#include <esp_task_wdt.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+constexpr size_t SECTOR_SIZE = 512;
+
+enum class RangeResult { FULL, PARTIAL, UNSATISFIABLE };
+
+// Inclusive byte positions, as in Content-Range
+struct ByteRange {
+  size_t first = 0;
+  size_t last = 0;
+};
+
+bool parseNumber(const char* begin, const char* end, size_t& value) {
+  if (begin == end) {
+    return false;
+  }
+  value = 0;
+  for (const char* p = begin; p < end; p++) {
+    if (*p < '0' || *p > '9') {
+      return false;
+    }
+    const size_t next = value * 10 + (*p - '0');
+    if (next < value) {
+      return false;
+    }
+    value = next;
+  }
+  return true;
+}
+
+// Handles "bytes=first-last", "bytes=first-" and "bytes=-suffixLength" (RFC 9110 section 14.1.2)
+RangeResult parseRange(const String& header, const size_t size, ByteRange& range) {
+  if (!header.startsWith("bytes=") || header.indexOf(',') >= 0) {
+    return RangeResult::FULL;
+  }
+  const char* spec = header.c_str() + 6;
+  const char* specEnd = header.c_str() + header.length();
+  const char* dash = strchr(spec, '-');
+  if (!dash) {
+    return RangeResult::FULL;
+  }
+
+  if (dash == spec) {
+    size_t suffixLength;
+    if (!parseNumber(dash + 1, specEnd, suffixLength)) {
+      return RangeResult::FULL;
+    }
+    if (suffixLength == 0 || size == 0) {
+      return RangeResult::UNSATISFIABLE;
+    }
+    range.first = suffixLength >= size ? 0 : size - suffixLength;
+    range.last = size - 1;
+    return RangeResult::PARTIAL;
+  }
+
+  size_t first;
+  if (!parseNumber(spec, dash, first)) {
+    return RangeResult::FULL;
+  }
+  size_t last = SIZE_MAX;
+  if (dash + 1 != specEnd && (!parseNumber(dash + 1, specEnd, last) || last < first)) {
+    return RangeResult::FULL;
+  }
+  if (first >= size) {
+    return RangeResult::UNSATISFIABLE;
+  }
+  range.first = first;
+  range.last = std::min(last, size - 1);
+  return RangeResult::PARTIAL;
+}
+
+// Sends the status line and headers. Returns false if there is no body to send (416).
+bool sendResponseHeaders(WebServer& server, FsFile& file, const char* contentType, ByteRange& range) {
+  const size_t size = file.size();
+  const RangeResult result = parseRange(server.header("Range"), size, range);
+  server.sendHeader("Accept-Ranges", "bytes");
+
+  if (result == RangeResult::UNSATISFIABLE) {
+    server.sendHeader("Content-Range", "bytes */" + String(size));
+    server.send(416, "text/plain", "");
+    return false;
+  }
+  if (result == RangeResult::FULL) {
+    range.first = 0;
+    range.last = size - 1;
+    server.setContentLength(size);
+    server.send(200, contentType, "");
+    return size > 0;
+  }
+
+  LOG_DBG("WEB", "Range %u-%u of %u", static_cast<unsigned>(range.first), static_cast<unsigned>(range.last),
+          static_cast<unsigned>(size));
+  server.sendHeader("Content-Range", "bytes " + String(range.first) + "-" + String(range.last) + "/" + String(size));
+  server.setContentLength(range.last - range.first + 1);
+  server.send(206, contentType, "");
+  return true;
+}
+
+}  // namespace
+
+void HttpFileSender::sendHeaders(WebServer& server, FsFile& file, const char* contentType) {
+  ByteRange range;
+  sendResponseHeaders(server, file, contentType, range);
+}
+
+bool HttpFileSender::send(WebServer& server, FsFile& file, const char* contentType) {
+  ByteRange range;
+  if (!sendResponseHeaders(server, file, contentType, range)) {
+    return true;
+  }
+  if (!file.seek(range.first)) {
+    return false;
+  }
+
+  // Heap buffer: the web server runs on the main loop task, whose stack cannot spare CHUNK_SIZE
+  uint8_t fallback[SECTOR_SIZE];
+  auto* buffer = static_cast<uint8_t*>(malloc(CHUNK_SIZE));
+  const size_t chunkSize = buffer ? CHUNK_SIZE : sizeof(fallback);
+  uint8_t* data = buffer ? buffer : fallback;
+
+  NetworkClient client = server.client();
+  size_t position = range.first;
+  size_t remaining = range.last - range.first + 1;
+  bool ok = true;
+  while (ok && remaining > 0) {
+    // The first read of a range ends on a sector boundary, so all later reads are whole sectors
+    const size_t toRead = std::min(remaining, chunkSize - position % SECTOR_SIZE);
+    const int result = file.read(data, toRead);
+    if (result <= 0) {
+      ok = false;
+      break;
+    }
+    const size_t bytesRead = static_cast<size_t>(result);
+    size_t totalWritten = 0;
+    while (totalWritten < bytesRead) {
+      esp_task_wdt_reset();
+      const size_t wrote = client.write(data + totalWritten, bytesRead - totalWritten);
+      if (wrote == 0) {
+        ok = false;
+        break;
+      }
+      totalWritten += wrote;
+    }
+    position += bytesRead;
+    remaining -= bytesRead;
+  }
+
+  free(buffer);
+  return ok;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <HalStorage.h>
+#include <WebServer.h>
+
+/**
+ * Sends a file as the response to the current request, shared by /download and WebDAV GET/HEAD.
+ *
+ * A single "Range: bytes=..." request range is honoured with 206 Partial Content (416 when it starts past the end),
+ * so clients can resume an interrupted download or fetch a large file in parallel pieces. Multiple ranges and
+ * malformed headers get the whole file, as RFC 9110 allows. The server must collect the "Range" header.
+ *
+ * Extra headers such as Content-Disposition must be added with sendHeader() before calling.
+ */
+namespace HttpFileSender {
+
+// Reads per SD access while streaming; a multiple of the sector size, reads are kept sector aligned
+constexpr size_t CHUNK_SIZE = 8192;
+
+// Sends headers and body. Returns false if the client stopped reading or the file could not be read.
+bool send(WebServer& server, FsFile& file, const char* contentType);
+
+// Sends the headers send() would, without a body (HEAD)
+void sendHeaders(WebServer& server, FsFile& file, const char* contentType);
+
+}  // namespace HttpFileSender
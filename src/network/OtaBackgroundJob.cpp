@@ -0,0 +1,37 @@
+#include "OtaBackgroundJob.h"
+
+#include <Logging.h>
+
+#include "HttpDownloader.h"
+#include "OtaUpdater.h"
+
+namespace {
+// The session's own requests (the browser loading the file list) go first
+constexpr unsigned long START_DELAY_MS = 15000;
+// Set once a check found nothing (more) to download; GitHub allows few unauthenticated API calls an hour
+bool settledThisBoot = false;
+}  // namespace
+
+void OtaBackgroundJob::run() {
+  if (settledThisBoot || !sleepFor(START_DELAY_MS)) {
+    return;
+  }
+
+  OtaUpdater updater;
+  const auto checked = updater.checkForUpdate();
+  if (checked != OtaUpdater::OK) {
+    LOG_DBG("OTA", "Background check failed: %d", checked);
+    settledThisBoot = checked == OtaUpdater::NO_UPDATE;
+    return;
+  }
+  if (!updater.isUpdateNewer()) {
+    LOG_DBG("OTA", "No newer release than %s", CROSSPOINT_VERSION);
+    settledThisBoot = true;
+    return;
+  }
+
+  LOG_DBG("OTA", "Downloading %s in the background", updater.getLatestVersion().c_str());
+  const auto staged = updater.stageUpdate([this] { return stopRequested(); });
+  HttpDownloader::closeSession();  // Frees the TLS buffers
+  settledThisBoot = staged == OtaUpdater::OK;
+}
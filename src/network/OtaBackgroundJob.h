@@ -0,0 +1,20 @@
+#pragma once
+
+#include "activities/Worker.h"
+
+/**
+ * Checks for a firmware release and downloads it to the SD card while WiFi is up for something else (the file
+ * transfer screen in station mode), for the update screen to offer; it is installed only once accepted there.
+ * Checks once per boot; a download that broke off is resumed by the next session. Owned by the activity that holds
+ * the WiFi session, which stops it before turning WiFi off.
+ */
+class OtaBackgroundJob final : public Worker {
+ protected:
+  void run() override;
+
+ public:
+  static constexpr uint32_t STACK_SIZE = 8192;  // TLS handshakes, as on the loop task
+
+  OtaBackgroundJob() : Worker("OtaBackground") {}
+  ~OtaBackgroundJob() override { stop(); }
+};
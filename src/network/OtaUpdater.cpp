@@ -1,14 +1,42 @@
 #include "OtaUpdater.h"
 
 #include <ArduinoJson.h>
+#include <HalStorage.h>
+#include <InflateReader.h>
 #include <Logging.h>
 
+#include <cstdlib>
+
+#include "HttpDownloader.h"
+
 #include "esp_http_client.h"
 #include "esp_https_ota.h"
+#include "esp_ota_ops.h"
 #include "esp_wifi.h"
 
+struct OtaInflateCtx {
+  InflateReader reader;  // Must be first — callback casts uzlib_uncomp* to OtaInflateCtx*
+  esp_http_client_handle_t client = nullptr;
+  FsFile* file = nullptr;  // Read instead of client when installing a staged update
+  uint8_t* readBuf = nullptr;
+  size_t readBufSize = 0;
+  size_t received = 0;
+};
+
 namespace {
 constexpr char latestReleaseUrl[] = "https://api.github.com/repos/crosspoint-reader/crosspoint-reader/releases/latest";
+// Released next to firmware.bin; the image gzipped, which the flash layout (builtin fonts, hyphenation tries) makes
+// much smaller to download
+constexpr char compressedAssetName[] = "firmware.bin.gz";
+constexpr size_t OTA_CHUNK_SIZE = 4096;
+constexpr int MAX_REDIRECTS = 5;
+
+// A staged update: the downloaded asset, and a note written once it is complete ("<version>\n<compressed>\n")
+constexpr char STAGING_DIR[] = "/.crosspoint/ota";
+constexpr char STAGED_IMAGE[] = "/.crosspoint/ota/firmware.bin";
+constexpr char STAGED_NOTE[] = "/.crosspoint/ota/staged";
+// Present once the user chose to install the staged update on the next sleep
+constexpr char STAGED_ACCEPTED[] = "/.crosspoint/ota/accepted";
 
 /* This is buffer and size holder to keep upcoming data from latestReleaseUrl */
 char* local_buf;
@@ -58,6 +86,51 @@ esp_err_t event_handler(esp_http_client_event_t* event) {
 
   return ESP_OK;
 } /* event_handler */
+
+int otaReadCallback(uzlib_uncomp* uncomp) {
+  auto* ctx = reinterpret_cast<OtaInflateCtx*>(uncomp);
+  const int bytesRead = ctx->file ? ctx->file->read(ctx->readBuf, ctx->readBufSize)
+                                  : esp_http_client_read(ctx->client, reinterpret_cast<char*>(ctx->readBuf),
+                                                         ctx->readBufSize);
+  if (bytesRead <= 0) return -1;
+  ctx->received += bytesRead;
+
+  uncomp->source = ctx->readBuf + 1;
+  uncomp->source_limit = ctx->readBuf + bytesRead;
+  return ctx->readBuf[0];
+}
+
+bool isRedirect(const int status) {
+  return status == 301 || status == 302 || status == 303 || status == 307 || status == 308;
+}
+
+bool readStagedNote(std::string& version, bool& compressed) {
+  FsFile note;
+  if (!Storage.exists(STAGED_NOTE) || !Storage.openFileForRead("OTA", STAGED_NOTE, note)) {
+    return false;
+  }
+  char buffer[64];
+  const int length = note.read(buffer, sizeof(buffer) - 1);
+  note.close();
+  if (length <= 0) {
+    return false;
+  }
+  buffer[length] = '\0';
+  char* newline = strchr(buffer, '\n');
+  if (!newline || newline == buffer) {
+    return false;
+  }
+  *newline = '\0';
+  version = buffer;
+  compressed = newline[1] == '1';
+  return true;
+}
+
+void removeStagedUpdate() {
+  Storage.remove(STAGED_ACCEPTED);
+  Storage.remove(STAGED_NOTE);
+  Storage.remove(STAGED_IMAGE);
+}
 } /* namespace */
 
 OtaUpdater::OtaUpdaterError OtaUpdater::checkForUpdate() {
@@ -136,13 +209,16 @@ OtaUpdater::OtaUpdaterError OtaUpdater::checkForUpdate() {
 
   latestVersion = doc["tag_name"].as<std::string>();
 
+  // Prefer the compressed image when the release has one
   for (int i = 0; i < doc["assets"].size(); i++) {
-    if (doc["assets"][i]["name"] == "firmware.bin") {
+    const bool compressed = doc["assets"][i]["name"] == compressedAssetName;
+    if (compressed || (!updateAvailable && doc["assets"][i]["name"] == "firmware.bin")) {
       otaUrl = doc["assets"][i]["browser_download_url"].as<std::string>();
       otaSize = doc["assets"][i]["size"].as<size_t>();
+      otaCompressed = compressed;
       totalSize = otaSize;
       updateAvailable = true;
-      break;
+      if (compressed) break;
     }
   }
 
@@ -151,7 +227,7 @@ OtaUpdater::OtaUpdaterError OtaUpdater::checkForUpdate() {
     return NO_UPDATE;
   }
 
-  LOG_DBG("OTA", "Found update: %s", latestVersion.c_str());
+  LOG_DBG("OTA", "Found update: %s%s", latestVersion.c_str(), otaCompressed ? " (compressed)" : "");
   return OK;
 }
 
@@ -204,6 +280,9 @@ OtaUpdater::OtaUpdaterError OtaUpdater::installUpdate() {
   if (!isUpdateNewer()) {
     return UPDATE_OLDER_ERROR;
   }
+  if (otaCompressed) {
+    return installCompressedUpdate();
+  }
 
   esp_https_ota_handle_t ota_handle = NULL;
   esp_err_t esp_err;
@@ -267,6 +346,321 @@ OtaUpdater::OtaUpdaterError OtaUpdater::installUpdate() {
     return INTERNAL_UPDATE_ERROR;
   }
 
+  removeStagedUpdate();  // Older than what was just installed
   LOG_INF("OTA", "Update completed");
   return OK;
 }
+
+/*
+ * Streams firmware.bin.gz, inflating it straight into the next OTA partition. esp_https_ota only takes the raw
+ * image, so the partition is written with the lower level esp_ota_* calls; esp_ota_end() still verifies the image.
+ */
+OtaUpdater::OtaUpdaterError OtaUpdater::installCompressedUpdate() {
+  esp_err_t esp_err;
+  render = false;
+  processedSize = 0;
+
+  const esp_partition_t* partition = esp_ota_get_next_update_partition(nullptr);
+  if (!partition) {
+    LOG_ERR("OTA", "No OTA partition to update");
+    return INTERNAL_UPDATE_ERROR;
+  }
+
+  esp_http_client_config_t client_config = {
+      .url = otaUrl.c_str(),
+      .timeout_ms = 15000,
+      .buffer_size = 8192,
+      .buffer_size_tx = 8192,
+      .skip_cert_common_name_check = true,
+      .crt_bundle_attach = esp_crt_bundle_attach,
+      .keep_alive_enable = true,
+  };
+
+  esp_http_client_handle_t client = esp_http_client_init(&client_config);
+  if (!client) {
+    LOG_ERR("OTA", "HTTP Client Handle Failed");
+    return INTERNAL_UPDATE_ERROR;
+  }
+  http_client_set_header_cb(client);
+
+  /* For better timing and connectivity, we disable power saving for WiFi */
+  esp_wifi_set_ps(WIFI_PS_NONE);
+
+  struct Cleanup {
+    esp_http_client_handle_t client;
+    OtaInflateCtx ctx;
+    uint8_t* outBuf = nullptr;
+    esp_ota_handle_t ota = 0;
+    ~Cleanup() {
+      if (ota) esp_ota_abort(ota);
+      free(outBuf);
+      free(ctx.readBuf);
+      esp_http_client_cleanup(client);
+      esp_wifi_set_ps(WIFI_PS_MIN_MODEM);
+    }
+  } cleanup{client};
+  OtaInflateCtx& ctx = cleanup.ctx;
+
+  /* Release assets are served through a redirect, which has to be followed by hand with the streaming API */
+  int status = 0;
+  for (int redirects = 0;; redirects++) {
+    esp_err = esp_http_client_open(client, 0);
+    if (esp_err != ESP_OK) {
+      LOG_ERR("OTA", "esp_http_client_open Failed : %s", esp_err_to_name(esp_err));
+      return HTTP_ERROR;
+    }
+    esp_http_client_fetch_headers(client);
+    status = esp_http_client_get_status_code(client);
+    if (!isRedirect(status) || redirects == MAX_REDIRECTS) break;
+    esp_http_client_flush_response(client, nullptr);
+    esp_http_client_set_redirection(client);
+    esp_http_client_close(client);
+  }
+  if (status != 200) {
+    LOG_ERR("OTA", "Download failed: HTTP %d", status);
+    return HTTP_ERROR;
+  }
+
+  ctx.readBufSize = OTA_CHUNK_SIZE;
+  ctx.readBuf = static_cast<uint8_t*>(malloc(OTA_CHUNK_SIZE));
+  cleanup.outBuf = static_cast<uint8_t*>(malloc(OTA_CHUNK_SIZE));
+  ctx.client = client;
+  if (!ctx.readBuf || !cleanup.outBuf || !ctx.reader.init(true)) {
+    LOG_ERR("OTA", "Not enough memory to inflate the update");
+    return OOM_ERROR;
+  }
+  ctx.reader.setReadCallback(otaReadCallback);
+  if (!ctx.reader.skipGzipHeader()) {
+    LOG_ERR("OTA", "Update is not gzip compressed");
+    return INTERNAL_UPDATE_ERROR;
+  }
+
+  esp_err = esp_ota_begin(partition, OTA_WITH_SEQUENTIAL_WRITES, &cleanup.ota);
+  if (esp_err != ESP_OK) {
+    LOG_ERR("OTA", "esp_ota_begin Failed: %s", esp_err_to_name(esp_err));
+    cleanup.ota = 0;
+    return INTERNAL_UPDATE_ERROR;
+  }
+
+  size_t imageSize = 0;
+  InflateStatus inflateStatus;
+  do {
+    size_t produced = 0;
+    inflateStatus = ctx.reader.readAtMost(cleanup.outBuf, OTA_CHUNK_SIZE, &produced);
+    if (inflateStatus == InflateStatus::Error) {
+      LOG_ERR("OTA", "Inflate failed after %zu bytes", ctx.received);
+      return HTTP_ERROR;
+    }
+    if (produced > 0) {
+      esp_err = esp_ota_write(cleanup.ota, cleanup.outBuf, produced);
+      if (esp_err != ESP_OK) {
+        LOG_ERR("OTA", "esp_ota_write Failed: %s", esp_err_to_name(esp_err));
+        return INTERNAL_UPDATE_ERROR;
+      }
+      imageSize += produced;
+    }
+    processedSize = ctx.received;
+    /* Sent signal to  OtaUpdateActivity */
+    render = true;
+  } while (inflateStatus != InflateStatus::Done);
+
+  LOG_DBG("OTA", "Inflated %zu bytes into %zu", ctx.received, imageSize);
+  esp_err = esp_ota_end(cleanup.ota);
+  cleanup.ota = 0;
+  if (esp_err != ESP_OK) {
+    LOG_ERR("OTA", "esp_ota_end Failed: %s", esp_err_to_name(esp_err));
+    return INTERNAL_UPDATE_ERROR;
+  }
+
+  esp_err = esp_ota_set_boot_partition(partition);
+  if (esp_err != ESP_OK) {
+    LOG_ERR("OTA", "esp_ota_set_boot_partition Failed: %s", esp_err_to_name(esp_err));
+    return INTERNAL_UPDATE_ERROR;
+  }
+
+  removeStagedUpdate();  // Older than what was just installed
+  LOG_INF("OTA", "Update completed");
+  return OK;
+}
+
+OtaUpdater::OtaUpdaterError OtaUpdater::stageUpdate(const std::function<bool()>& cancelled) {
+  if (!isUpdateNewer()) {
+    return UPDATE_OLDER_ERROR;
+  }
+  std::string stagedVersion;
+  if (hasStagedUpdate(&stagedVersion) && stagedVersion == latestVersion) {
+    return OK;
+  }
+  // An older staged release is replaced, and has to be accepted again; a part of this one is resumed by the downloader
+  Storage.remove(STAGED_ACCEPTED);
+  Storage.remove(STAGED_NOTE);
+  Storage.remove(STAGED_IMAGE);
+  Storage.ensureDirectoryExists(STAGING_DIR);
+
+  processedSize = 0;
+  HttpDownloader::DownloadOptions options;
+  options.sendCredentials = false;
+  options.cancelled = cancelled;
+  const auto result = HttpDownloader::downloadToFile(
+      otaUrl, STAGED_IMAGE, [this](const size_t downloaded, size_t) { processedSize = downloaded; }, options);
+  if (result == HttpDownloader::ABORTED) {
+    LOG_DBG("OTA", "Download of %s stopped at %zu bytes", latestVersion.c_str(), processedSize);
+    return HTTP_ERROR;
+  }
+  if (result != HttpDownloader::OK) {
+    LOG_ERR("OTA", "Download of %s failed: %d", latestVersion.c_str(), result);
+    return result == HttpDownloader::FILE_ERROR ? INTERNAL_UPDATE_ERROR : HTTP_ERROR;
+  }
+
+  // The release lists the asset's size; the image itself is verified by esp_ota_end() when installed
+  FsFile image = Storage.open(STAGED_IMAGE);
+  const size_t size = image ? image.size() : 0;
+  image.close();
+  if (size != otaSize) {
+    LOG_ERR("OTA", "Downloaded %zu bytes, release lists %zu", size, otaSize);
+    Storage.remove(STAGED_IMAGE);
+    return HTTP_ERROR;
+  }
+
+  FsFile note;
+  if (!Storage.openFileForWrite("OTA", STAGED_NOTE, note)) {
+    return INTERNAL_UPDATE_ERROR;
+  }
+  const std::string content = latestVersion + "\n" + (otaCompressed ? "1" : "0") + "\n";
+  const bool written = note.write(content.data(), content.size()) == content.size();
+  note.close();
+  if (!written) {
+    Storage.remove(STAGED_NOTE);
+    return INTERNAL_UPDATE_ERROR;
+  }
+  LOG_INF("OTA", "Update %s downloaded, waiting to be accepted on the update screen", latestVersion.c_str());
+  return OK;
+}
+
+bool OtaUpdater::hasStagedUpdate(std::string* version) {
+  std::string stagedVersion;
+  bool compressed;
+  if (!readStagedNote(stagedVersion, compressed) || !Storage.exists(STAGED_IMAGE)) {
+    return false;
+  }
+  if (version) {
+    *version = stagedVersion;
+  }
+  return true;
+}
+
+bool OtaUpdater::acceptStagedUpdate() {
+  FsFile marker;
+  if (!hasStagedUpdate() || !Storage.openFileForWrite("OTA", STAGED_ACCEPTED, marker)) {
+    return false;
+  }
+  return marker.close();
+}
+
+bool OtaUpdater::hasAcceptedUpdate() { return hasStagedUpdate() && Storage.exists(STAGED_ACCEPTED); }
+
+OtaUpdater::OtaUpdaterError OtaUpdater::installStagedUpdate() {
+  std::string version;
+  bool compressed;
+  if (!readStagedNote(version, compressed)) {
+    return NO_UPDATE;
+  }
+  if (version == CROSSPOINT_VERSION) {
+    removeStagedUpdate();  // Installed from the update screen since
+    return NO_UPDATE;
+  }
+  LOG_INF("OTA", "Installing staged update %s", version.c_str());
+
+  const esp_partition_t* partition = esp_ota_get_next_update_partition(nullptr);
+  if (!partition) {
+    LOG_ERR("OTA", "No OTA partition to update");
+    removeStagedUpdate();
+    return INTERNAL_UPDATE_ERROR;
+  }
+
+  struct Cleanup {
+    FsFile file;
+    OtaInflateCtx ctx;
+    uint8_t* outBuf = nullptr;
+    esp_ota_handle_t ota = 0;
+    ~Cleanup() {
+      if (ota) esp_ota_abort(ota);
+      free(outBuf);
+      free(ctx.readBuf);
+      file.close();
+      removeStagedUpdate();
+    }
+  } cleanup;
+  OtaInflateCtx& ctx = cleanup.ctx;
+
+  if (!Storage.openFileForRead("OTA", STAGED_IMAGE, cleanup.file)) {
+    return INTERNAL_UPDATE_ERROR;
+  }
+  ctx.file = &cleanup.file;
+  ctx.readBufSize = OTA_CHUNK_SIZE;
+  ctx.readBuf = static_cast<uint8_t*>(malloc(OTA_CHUNK_SIZE));
+  cleanup.outBuf = static_cast<uint8_t*>(malloc(OTA_CHUNK_SIZE));
+  if (!ctx.readBuf || !cleanup.outBuf || (compressed && !ctx.reader.init(true))) {
+    LOG_ERR("OTA", "Not enough memory to install the update");
+    return OOM_ERROR;
+  }
+  if (compressed) {
+    ctx.reader.setReadCallback(otaReadCallback);
+    if (!ctx.reader.skipGzipHeader()) {
+      LOG_ERR("OTA", "Staged update is not gzip compressed");
+      return INTERNAL_UPDATE_ERROR;
+    }
+  }
+
+  esp_err_t esp_err = esp_ota_begin(partition, OTA_WITH_SEQUENTIAL_WRITES, &cleanup.ota);
+  if (esp_err != ESP_OK) {
+    LOG_ERR("OTA", "esp_ota_begin Failed: %s", esp_err_to_name(esp_err));
+    cleanup.ota = 0;
+    return INTERNAL_UPDATE_ERROR;
+  }
+
+  size_t imageSize = 0;
+  bool done = false;
+  while (!done) {
+    size_t produced = 0;
+    if (compressed) {
+      const InflateStatus status = ctx.reader.readAtMost(cleanup.outBuf, OTA_CHUNK_SIZE, &produced);
+      if (status == InflateStatus::Error) {
+        LOG_ERR("OTA", "Inflate failed after %zu bytes", imageSize);
+        return INTERNAL_UPDATE_ERROR;
+      }
+      done = status == InflateStatus::Done;
+    } else {
+      const int bytesRead = cleanup.file.read(cleanup.outBuf, OTA_CHUNK_SIZE);
+      if (bytesRead < 0) {
+        LOG_ERR("OTA", "Reading the staged update failed after %zu bytes", imageSize);
+        return INTERNAL_UPDATE_ERROR;
+      }
+      produced = bytesRead;
+      done = produced == 0;
+    }
+    if (produced > 0) {
+      esp_err = esp_ota_write(cleanup.ota, cleanup.outBuf, produced);
+      if (esp_err != ESP_OK) {
+        LOG_ERR("OTA", "esp_ota_write Failed: %s", esp_err_to_name(esp_err));
+        return INTERNAL_UPDATE_ERROR;
+      }
+      imageSize += produced;
+    }
+  }
+
+  esp_err = esp_ota_end(cleanup.ota);
+  cleanup.ota = 0;
+  if (esp_err != ESP_OK) {
+    LOG_ERR("OTA", "esp_ota_end Failed: %s", esp_err_to_name(esp_err));
+    return INTERNAL_UPDATE_ERROR;
+  }
+  esp_err = esp_ota_set_boot_partition(partition);
+  if (esp_err != ESP_OK) {
+    LOG_ERR("OTA", "esp_ota_set_boot_partition Failed: %s", esp_err_to_name(esp_err));
+    return INTERNAL_UPDATE_ERROR;
+  }
+
+  LOG_INF("OTA", "Installed %s (%zu bytes), booting it on wake", version.c_str(), imageSize);
+  return OK;
+}
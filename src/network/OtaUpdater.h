@@ -7,6 +7,7 @@ class OtaUpdater {
   bool updateAvailable = false;
   std::string latestVersion;
   std::string otaUrl;
+  bool otaCompressed = false;  // otaUrl is firmware.bin.gz
   size_t otaSize = 0;
   size_t processedSize = 0;
   size_t totalSize = 0;
@@ -36,4 +37,24 @@ class OtaUpdater {
   const std::string& getLatestVersion() const;
   OtaUpdaterError checkForUpdate();
   OtaUpdaterError installUpdate();
+
+  /*
+   * Background updates: after checkForUpdate(), the release is downloaded to the SD card (resumed where an earlier
+   * session left it) while WiFi is up for something else, so nobody waits on the download. The update screen then
+   * offers it, to install right away or when the device next goes to sleep; nothing is installed unless accepted there,
+   * so an RC or custom build isn't replaced behind its user's back.
+   */
+  // Downloads the newer release unless it is already staged. cancelled is polled during the download.
+  OtaUpdaterError stageUpdate(const std::function<bool()>& cancelled);
+  // Whether a downloaded release is waiting to be installed, and its version
+  static bool hasStagedUpdate(std::string* version = nullptr);
+  // Marks the staged release to be installed on the next sleep
+  static bool acceptStagedUpdate();
+  static bool hasAcceptedUpdate();
+  // Writes the staged release to the next OTA partition and boots it from then on; the staged files are removed
+  // either way, so a bad download isn't retried at every sleep
+  static OtaUpdaterError installStagedUpdate();
+
+ private:
+  OtaUpdaterError installCompressedUpdate();
 };
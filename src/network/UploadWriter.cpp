@@ -0,0 +1,174 @@
+#include "UploadWriter.h"
+
+#include <Arduino.h>
+#include <Logging.h>
+#include <esp_task_wdt.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+void UploadWriter::taskTrampoline(void* param) {
+  auto* self = static_cast<UploadWriter*>(param);
+  self->writeLoop();
+  // Copy the handle before signalling: once the semaphore is given, the owner may free the semaphores.
+  SemaphoreHandle_t done = self->drained;
+  xSemaphoreGive(done);
+  vTaskDelete(nullptr);
+}
+
+void UploadWriter::writeLoop() {
+  while (true) {
+    xSemaphoreTake(filled, portMAX_DELAY);
+    if (!pending) {
+      // end() asks the task to exit with an empty hand-off
+      return;
+    }
+    writeNow(pending, pendingSize);
+    pending = nullptr;
+    xSemaphoreGive(drained);
+  }
+}
+
+void UploadWriter::begin(FsFile& target) {
+  end();
+  file = &target;
+  fillIndex = 0;
+  fillPos = 0;
+  failed = false;
+  writeCount = 0;
+  writeTime = 0;
+
+  buffers[0] = static_cast<uint8_t*>(malloc(BUFFER_SIZE));
+  buffers[1] = static_cast<uint8_t*>(malloc(BUFFER_SIZE));
+  if (!buffers[0] || !buffers[1]) {
+    LOG_ERR("UPW", "Not enough memory for upload buffers, writing synchronously");
+    free(buffers[1]);
+    buffers[1] = nullptr;
+    return;
+  }
+
+  filled = xSemaphoreCreateBinary();
+  drained = xSemaphoreCreateBinary();
+  // Same priority as the caller, so the two time-slice while both have work
+  if (!filled || !drained ||
+      xTaskCreate(&taskTrampoline, "UploadWriter", STACK_SIZE, this, uxTaskPriorityGet(nullptr), &taskHandle) !=
+          pdPASS) {
+    LOG_ERR("UPW", "Failed to start writer task, writing synchronously");
+    if (filled) vSemaphoreDelete(filled);
+    if (drained) vSemaphoreDelete(drained);
+    filled = nullptr;
+    drained = nullptr;
+    taskHandle = nullptr;
+    free(buffers[1]);
+    buffers[1] = nullptr;
+  }
+}
+
+bool UploadWriter::writeNow(const uint8_t* data, const size_t size) {
+  const unsigned long start = millis();
+  const size_t written = file->write(data, size);
+  writeTime += millis() - start;
+  writeCount++;
+  if (written != size) {
+    LOG_ERR("UPW", "Write failed: expected %u, wrote %u", static_cast<unsigned>(size), static_cast<unsigned>(written));
+    failed = true;
+    return false;
+  }
+  return true;
+}
+
+void UploadWriter::waitDrained() {
+  if (!inFlight) {
+    return;
+  }
+  // The caller is the watchdog-supervised web server loop; a slow card must not trip it
+  while (xSemaphoreTake(drained, pdMS_TO_TICKS(1000)) != pdTRUE) {
+    esp_task_wdt_reset();
+  }
+  inFlight = false;
+}
+
+void UploadWriter::submit() {
+  if (!taskHandle) {
+    esp_task_wdt_reset();
+    writeNow(buffers[fillIndex], fillPos);
+    esp_task_wdt_reset();
+    fillPos = 0;
+    return;
+  }
+
+  waitDrained();
+  if (!failed) {
+    pending = buffers[fillIndex];
+    pendingSize = fillPos;
+    inFlight = true;
+    xSemaphoreGive(filled);
+    fillIndex ^= 1;
+  }
+  fillPos = 0;
+}
+
+bool UploadWriter::write(const uint8_t* data, size_t size) {
+  if (!file || failed) {
+    return false;
+  }
+  if (!buffers[0]) {
+    esp_task_wdt_reset();
+    return writeNow(data, size);
+  }
+
+  while (size > 0) {
+    const size_t toCopy = std::min(size, BUFFER_SIZE - fillPos);
+    memcpy(buffers[fillIndex] + fillPos, data, toCopy);
+    fillPos += toCopy;
+    data += toCopy;
+    size -= toCopy;
+    if (fillPos == BUFFER_SIZE) {
+      submit();
+      if (failed) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool UploadWriter::finish() {
+  if (!file) {
+    return false;
+  }
+  if (fillPos > 0 && !failed) {
+    submit();
+  }
+  waitDrained();
+  const bool ok = !failed;
+  end();
+  return ok;
+}
+
+void UploadWriter::abort() {
+  fillPos = 0;
+  end();
+}
+
+void UploadWriter::end() {
+  if (taskHandle) {
+    waitDrained();
+    pending = nullptr;
+    inFlight = true;
+    xSemaphoreGive(filled);
+    waitDrained();
+    vSemaphoreDelete(filled);
+    vSemaphoreDelete(drained);
+    filled = nullptr;
+    drained = nullptr;
+    taskHandle = nullptr;
+  }
+  free(buffers[0]);
+  free(buffers[1]);
+  buffers[0] = nullptr;
+  buffers[1] = nullptr;
+  fillPos = 0;
+  file = nullptr;
+}
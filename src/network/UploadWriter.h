@@ -0,0 +1,72 @@
+#pragma once
+
+#include <HalStorage.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * UploadWriter
+ *
+ * Writes an incoming upload (or download) to an open file from a dedicated task, so the network can keep receiving
+ * while the SD card is busy. Data is collected in one of two buffers; a full buffer is handed to the writer task and
+ * the other one is filled in the meantime. The caller only waits when it fills a buffer before the previous write has
+ * finished.
+ *
+ * Buffers are a multiple of the SD sector size and the file is written from offset 0 (or another multiple of
+ * BUFFER_SIZE, when appending to a resumed download), so every write but the last covers whole sectors and never
+ * straddles a cluster boundary (FAT clusters are at least BUFFER_SIZE on SD cards), which lets SdFat write straight
+ * from our buffer instead of going through its sector cache.
+ *
+ * The file must not be touched between begin() and finish()/abort(). Both wait for the write in flight and end the
+ * task; the caller then closes the file as before.
+ */
+class UploadWriter {
+  static constexpr uint32_t STACK_SIZE = 4096;
+
+  FsFile* file = nullptr;
+  uint8_t* buffers[2] = {nullptr, nullptr};
+  size_t fillIndex = 0;
+  size_t fillPos = 0;
+
+  // Handed from the caller to the writer task through filled, and back through drained
+  const uint8_t* pending = nullptr;
+  size_t pendingSize = 0;
+  bool inFlight = false;
+  volatile bool failed = false;
+
+  TaskHandle_t taskHandle = nullptr;
+  SemaphoreHandle_t filled = nullptr;
+  SemaphoreHandle_t drained = nullptr;
+
+  static void taskTrampoline(void* param);
+  void writeLoop();
+  bool writeNow(const uint8_t* data, size_t size);
+  void submit();
+  void waitDrained();
+  void end();
+
+ public:
+  static constexpr size_t BUFFER_SIZE = 8192;
+
+  // Diagnostics for the upload logs
+  uint32_t writeCount = 0;
+  unsigned long writeTime = 0;
+
+  UploadWriter() = default;
+  ~UploadWriter() { end(); }
+  UploadWriter(const UploadWriter&) = delete;
+  UploadWriter& operator=(const UploadWriter&) = delete;
+
+  // Starts writing to file. Without the heap for the task and buffers, write() writes synchronously instead.
+  void begin(FsFile& file);
+  // Queues data. Returns false once a write has failed (short write, disk full); the upload should then be aborted.
+  bool write(const uint8_t* data, size_t size);
+  // Writes what is left and waits for it. Returns false if any write failed.
+  bool finish();
+  // Drops buffered data, waiting for the write in flight.
+  void abort();
+};
@@ -6,6 +6,14 @@
 #include <Logging.h>
 #include <esp_task_wdt.h>
 
+#include <algorithm>
+#include <cstring>
+
+#include "ChunkedResponseWriter.h"
+#include "HttpFileSender.h"
+#include "activities/boot_sleep/SleepScreenCache.h"
+#include "util/DirectoryIndex.h"
+
 namespace {
 const char* HIDDEN_ITEMS[] = {"System Volume Information", "XTCache"};
 constexpr size_t HIDDEN_ITEMS_COUNT = sizeof(HIDDEN_ITEMS) / sizeof(HIDDEN_ITEMS[0]);
@@ -78,6 +86,7 @@ void WebDAVHandler::raw(WebServer& server, const String& uri, HTTPRaw& raw) {
 
     // Write to a temp file to avoid destroying the original on failed upload
     String tempPath = _putPath + ".davtmp";
+    DirectoryIndex::Edit edit(FsHelpers::extractFolderPath(_putPath.c_str()));
     Storage.remove(tempPath.c_str());
     _putOk = Storage.openFileForWrite("DAV", tempPath, _putFile);
     LOG_DBG("DAV", "PUT START: %s", _putPath.c_str());
@@ -92,14 +101,19 @@ void WebDAVHandler::raw(WebServer& server, const String& uri, HTTPRaw& raw) {
     }
 
   } else if (raw.status == RAW_END) {
+    // Before close(), which updates the temp file's directory entry
+    DirectoryIndex::Edit edit(FsHelpers::extractFolderPath(_putPath.c_str()));
     if (_putFile) _putFile.close();
     if (_putOk) {
       String tempPath = _putPath + ".davtmp";
-      if (_putExisted) Storage.remove(_putPath.c_str());
+      const std::string name = _putPath.substring(_putPath.lastIndexOf('/') + 1).c_str();
+      if (_putExisted && Storage.remove(_putPath.c_str())) edit.removed(name);
       FsFile tmp = Storage.open(tempPath.c_str());
       if (tmp) {
+        const uint32_t size = tmp.fileSize();
         _putOk = tmp.rename(_putPath.c_str());
         tmp.close();
+        if (_putOk) edit.added(name, false, size);
       } else {
         _putOk = false;
       }
@@ -108,6 +122,7 @@ void WebDAVHandler::raw(WebServer& server, const String& uri, HTTPRaw& raw) {
     LOG_DBG("DAV", "PUT END: %u bytes, ok=%d", raw.totalSize, _putOk);
 
   } else if (raw.status == RAW_ABORTED) {
+    DirectoryIndex::Edit edit(FsHelpers::extractFolderPath(_putPath.c_str()));
     if (_putFile) _putFile.close();
     String tempPath = _putPath + ".davtmp";
     Storage.remove(tempPath.c_str());
@@ -170,6 +185,26 @@ void WebDAVHandler::handleOptions(WebServer& s) {
 
 // ── PROPFIND ─────────────────────────────────────────────────────────────────
 
+// Response XML is sent in chunks of ChunkedResponseWriter::CHUNK_SIZE, rather than one chunk (and one String) per entry
+class WebDAVHandler::PropfindWriter : public ChunkedResponseWriter {
+ public:
+  using ChunkedResponseWriter::ChunkedResponseWriter;
+
+  // Percent-encodes the characters that would break an href, keeping '/'
+  void appendEncodedPath(const char* path) {
+    for (const char* p = path; *p; p++) {
+      const auto c = static_cast<uint8_t>(*p);
+      if (c > 127 || c == ' ' || c == '%' || c == '#' || c == '?' || c == '&') {
+        char hex[4];
+        snprintf(hex, sizeof(hex), "%%%02X", c);
+        append(hex, 3);
+      } else {
+        append(p, 1);
+      }
+    }
+  }
+};
+
 void WebDAVHandler::handlePropfind(WebServer& s) {
   String path = getRequestPath(s);
   int depth = getDepth(s);
@@ -183,116 +218,114 @@ void WebDAVHandler::handlePropfind(WebServer& s) {
   }
 
   FsFile root = Storage.open(path.c_str());
-  if (!root) {
-    if (path == "/") {
-      // Root should always work — send minimal response
-      s.setContentLength(CONTENT_LENGTH_UNKNOWN);
-      s.send(207, "application/xml; charset=\"utf-8\"", "");
-      s.sendContent(
-          "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
-          "<D:multistatus xmlns:D=\"DAV:\">\n");
-      sendPropEntry(s, "/", true, 0, FIXED_DATE);
-      s.sendContent("</D:multistatus>\n");
-      s.sendContent("");
-      return;
-    }
+  if (!root && path != "/") {
     s.send(500, "text/plain", "Failed to open");
     return;
   }
 
-  bool isDir = root.isDirectory();
-
   s.setContentLength(CONTENT_LENGTH_UNKNOWN);
   s.send(207, "application/xml; charset=\"utf-8\"", "");
-  s.sendContent(
+  PropfindWriter out(s);
+  out.append(
       "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
       "<D:multistatus xmlns:D=\"DAV:\">\n");
 
-  // Entry for the resource itself
-  if (isDir) {
-    sendPropEntry(s, path, true, 0, FIXED_DATE);
+  char lastModified[32];
+  if (!root) {
+    // Root should always work — send minimal response
+    sendPropEntry(out, "/", nullptr, true, 0, FIXED_DATE);
+  } else if (!root.isDirectory()) {
+    sendPropEntry(out, path, nullptr, false, root.size(), formatLastModified(root, lastModified));
   } else {
-    sendPropEntry(s, path, false, root.size(), FIXED_DATE);
-    root.close();
-    s.sendContent("</D:multistatus>\n");
-    s.sendContent("");
-    return;
-  }
-
-  // If depth > 0 and it's a directory, list children
-  if (depth > 0) {
-    FsFile file = root.openNextFile();
-    char name[500];
-    while (file) {
-      file.getName(name, sizeof(name));
-      String fileName(name);
-
-      // Skip hidden/protected items
-      bool shouldHide = fileName.startsWith(".");
-      if (!shouldHide) {
-        for (size_t i = 0; i < HIDDEN_ITEMS_COUNT; i++) {
-          if (fileName.equals(HIDDEN_ITEMS[i])) {
-            shouldHide = true;
-            break;
-          }
+    // Entry for the resource itself
+    sendPropEntry(out, path, nullptr, true, 0, formatLastModified(root, lastModified));
+
+    // If depth > 0, list children. Name, size and date all come from the directory entry openNextFile() reads.
+    if (depth > 0) {
+      char name[500];
+      for (FsFile file = root.openNextFile(); file; file = root.openNextFile()) {
+        file.getName(name, sizeof(name));
+
+        // Skip hidden/protected items
+        bool shouldHide = name[0] == '.';
+        for (size_t i = 0; i < HIDDEN_ITEMS_COUNT && !shouldHide; i++) {
+          shouldHide = strcmp(name, HIDDEN_ITEMS[i]) == 0;
         }
-      }
 
-      if (!shouldHide) {
-        String childPath = path;
-        if (!childPath.endsWith("/")) childPath += "/";
-        childPath += fileName;
-
-        if (file.isDirectory()) {
-          sendPropEntry(s, childPath, true, 0, FIXED_DATE);
-        } else {
-          sendPropEntry(s, childPath, false, file.size(), FIXED_DATE);
+        if (!shouldHide) {
+          const bool isDir = file.isDirectory();
+          sendPropEntry(out, path, name, isDir, isDir ? 0 : file.size(), formatLastModified(file, lastModified));
         }
-      }
 
-      file.close();
-      yield();
-      esp_task_wdt_reset();
-      file = root.openNextFile();
+        file.close();
+        yield();
+        esp_task_wdt_reset();
+      }
     }
   }
 
-  root.close();
-  s.sendContent("</D:multistatus>\n");
-  s.sendContent("");
+  if (root) {
+    root.close();
+  }
+  out.append("</D:multistatus>\n");
+  out.finish();
 }
 
-void WebDAVHandler::sendPropEntry(WebServer& s, const String& path, bool isDir, size_t size,
-                                  const String& lastModified) const {
-  String href;
-  urlEncodePath(path, href);
-  // Ensure directory hrefs end with /
-  if (isDir && !href.endsWith("/")) href += "/";
+// FAT keeps local time without a zone; it is reported as GMT. Entries without a date get FIXED_DATE.
+const char* WebDAVHandler::formatLastModified(FsFile& file, char* out) const {
+  static const char* const DAYS[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+  static const char* const MONTHS[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                       "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+  uint16_t date = 0;
+  uint16_t time = 0;
+  if (!file.getModifyDateTime(&date, &time)) {
+    return FIXED_DATE;
+  }
+  const int year = 1980 + (date >> 9);
+  const int month = (date >> 5) & 0x0F;
+  const int day = date & 0x1F;
+  if (month < 1 || month > 12 || day < 1) {
+    return FIXED_DATE;
+  }
+
+  // Day of the week (Sakamoto)
+  static const int MONTH_OFFSETS[] = {0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4};
+  const int y = month < 3 ? year - 1 : year;
+  const int weekday = (y + y / 4 - y / 100 + y / 400 + MONTH_OFFSETS[month - 1] + day) % 7;
+
+  snprintf(out, 32, "%s, %02d %s %04d %02d:%02d:%02d GMT", DAYS[weekday], day, MONTHS[month - 1], year, time >> 11,
+           (time >> 5) & 0x3F, (time & 0x1F) * 2);
+  return out;
+}
 
-  String xml = "<D:response><D:href>";
-  xml += href;
-  xml += "</D:href><D:propstat><D:prop>";
+void WebDAVHandler::sendPropEntry(PropfindWriter& out, const String& path, const char* childName, bool isDir,
+                                  size_t size, const char* lastModified) const {
+  out.append("<D:response><D:href>");
+  out.appendEncodedPath(path.c_str());
+  if (childName) {
+    if (!path.endsWith("/")) out.append("/");
+    out.appendEncodedPath(childName);
+  }
+  // Ensure directory hrefs end with /
+  if (isDir && (childName || !path.endsWith("/"))) out.append("/");
+  out.append("</D:href><D:propstat><D:prop>");
 
   if (isDir) {
-    xml += "<D:resourcetype><D:collection/></D:resourcetype>";
+    out.append("<D:resourcetype><D:collection/></D:resourcetype>");
   } else {
-    xml += "<D:resourcetype/>";
-    xml += "<D:getcontentlength>";
-    xml += String(size);
-    xml += "</D:getcontentlength>";
-    String mime = getMimeType(path);
-    xml += "<D:getcontenttype>";
-    xml += mime;
-    xml += "</D:getcontenttype>";
+    out.append("<D:resourcetype/><D:getcontentlength>");
+    out.appendNumber(size);
+    out.append("</D:getcontentlength><D:getcontenttype>");
+    // The extension is all the MIME lookup needs
+    out.append(getMimeType(childName ? String(childName) : path).c_str());
+    out.append("</D:getcontenttype>");
   }
 
-  xml += "<D:getlastmodified>";
-  xml += lastModified;
-  xml += "</D:getlastmodified>";
+  out.append("<D:getlastmodified>");
+  out.append(lastModified);
+  out.append("</D:getlastmodified>");
 
-  xml += "</D:prop><D:status>HTTP/1.1 200 OK</D:status></D:propstat></D:response>\n";
-
-  s.sendContent(xml);
+  out.append("</D:prop><D:status>HTTP/1.1 200 OK</D:status></D:propstat></D:response>\n");
 }
 
 // ── GET ──────────────────────────────────────────────────────────────────────
@@ -324,11 +357,9 @@ void WebDAVHandler::handleGet(WebServer& s) {
   }
 
   String contentType = getMimeType(path);
-  s.setContentLength(file.size());
-  s.send(200, contentType.c_str(), "");
-
-  NetworkClient client = s.client();
-  client.write(file);
+  if (!HttpFileSender::send(s, file, contentType.c_str())) {
+    LOG_DBG("DAV", "GET %s ended early", path.c_str());
+  }
   file.close();
 }
 
@@ -361,8 +392,7 @@ void WebDAVHandler::handleHead(WebServer& s) {
   }
 
   String contentType = getMimeType(path);
-  s.setContentLength(file.size());
-  s.send(200, contentType.c_str(), "");
+  HttpFileSender::sendHeaders(s, file, contentType.c_str());
   file.close();
 }
 
@@ -380,12 +410,13 @@ void WebDAVHandler::handlePut(WebServer& s) {
 
   if (!_putOk) {
     String tempPath = path + ".davtmp";
+    DirectoryIndex::Edit edit(FsHelpers::extractFolderPath(path.c_str()));
     Storage.remove(tempPath.c_str());
     s.send(500, "text/plain", "Write failed - incomplete upload or disk full");
     return;
   }
 
-  clearEpubCacheIfNeeded(path);
+  invalidateFileCachesIfNeeded(path);
   s.send(_putExisted ? 204 : 201);
   LOG_DBG("DAV", "PUT complete: %s", path.c_str());
 }
@@ -417,6 +448,8 @@ void WebDAVHandler::handleDelete(WebServer& s) {
     return;
   }
 
+  DirectoryIndex::Edit edit(FsHelpers::extractFolderPath(path.c_str()));
+  const std::string name = path.substring(path.lastIndexOf('/') + 1).c_str();
   if (file.isDirectory()) {
     // Check if directory is empty
     FsFile entry = file.openNextFile();
@@ -428,14 +461,17 @@ void WebDAVHandler::handleDelete(WebServer& s) {
     }
     file.close();
     if (Storage.rmdir(path.c_str())) {
+      edit.removed(name);
+      DirectoryIndex::forget(path.c_str());
       s.send(204);
     } else {
       s.send(500, "text/plain", "Failed to remove directory");
     }
   } else {
     file.close();
-    clearEpubCacheIfNeeded(path);
+    clearFileCachesIfNeeded(path);
     if (Storage.remove(path.c_str())) {
+      edit.removed(name);
       s.send(204);
     } else {
       s.send(500, "text/plain", "Failed to delete file");
@@ -475,7 +511,9 @@ void WebDAVHandler::handleMkcol(WebServer& s) {
     }
   }
 
+  DirectoryIndex::Edit edit(FsHelpers::extractFolderPath(path.c_str()));
   if (Storage.mkdir(path.c_str())) {
+    edit.added(path.substring(path.lastIndexOf('/') + 1).c_str(), true, 0);
     s.send(201);
     LOG_DBG("DAV", "Created directory: %s", path.c_str());
   } else {
@@ -533,8 +571,13 @@ void WebDAVHandler::handleMove(WebServer& s) {
     return;
   }
 
+  DirectoryIndex::Edit fromEdit(FsHelpers::extractFolderPath(srcPath.c_str()));
+  DirectoryIndex::Edit toEdit(FsHelpers::extractFolderPath(dstPath.c_str()));
+  const std::string srcName = srcPath.substring(srcPath.lastIndexOf('/') + 1).c_str();
+  const std::string dstName = dstPath.substring(dstPath.lastIndexOf('/') + 1).c_str();
   if (dstExists) {
     Storage.remove(dstPath.c_str());
+    toEdit.removed(dstName);
   }
 
   FsFile file = Storage.open(srcPath.c_str());
@@ -543,11 +586,17 @@ void WebDAVHandler::handleMove(WebServer& s) {
     return;
   }
 
-  clearEpubCacheIfNeeded(srcPath);
+  clearFileCachesIfNeeded(srcPath);
+  clearFileCachesIfNeeded(dstPath);  // Whatever was cached for an earlier file at the destination
+  const bool isDirectory = file.isDirectory();
+  const uint32_t size = isDirectory ? 0 : file.fileSize();
   bool success = file.rename(dstPath.c_str());
   file.close();
 
   if (success) {
+    fromEdit.removed(srcName);
+    toEdit.added(dstName, isDirectory, size);
+    if (isDirectory) DirectoryIndex::forget(srcPath.c_str());
     s.send(dstExists ? 204 : 201);
   } else {
     s.send(500, "text/plain", "Move failed");
@@ -613,8 +662,11 @@ void WebDAVHandler::handleCopy(WebServer& s) {
     return;
   }
 
+  DirectoryIndex::Edit edit(FsHelpers::extractFolderPath(dstPath.c_str()));
+  const std::string dstName = dstPath.substring(dstPath.lastIndexOf('/') + 1).c_str();
   if (dstExists) {
     Storage.remove(dstPath.c_str());
+    edit.removed(dstName);
   }
 
   FsFile dstFile;
@@ -638,10 +690,13 @@ void WebDAVHandler::handleCopy(WebServer& s) {
     }
   }
 
+  const uint32_t size = dstFile.fileSize();
   srcFile.close();
   dstFile.close();
 
   if (copyOk) {
+    edit.added(dstName, false, size);
+    clearFileCachesIfNeeded(dstPath);
     s.send(dstExists ? 204 : 201);
   } else {
     Storage.remove(dstPath.c_str());
@@ -731,33 +786,6 @@ String WebDAVHandler::getDestinationPath(WebServer& s) const {
   return result;
 }
 
-void WebDAVHandler::urlEncodePath(const String& path, String& out) const {
-  out = "";
-  for (unsigned int i = 0; i < path.length(); i++) {
-    char c = path.charAt(i);
-    if (c == '/') {
-      out += '/';
-    } else if (c == ' ') {
-      out += "%20";
-    } else if (c == '%') {
-      out += "%25";
-    } else if (c == '#') {
-      out += "%23";
-    } else if (c == '?') {
-      out += "%3F";
-    } else if (c == '&') {
-      out += "%26";
-    } else if ((uint8_t)c > 127) {
-      // Encode non-ASCII bytes
-      char hex[4];
-      snprintf(hex, sizeof(hex), "%%%02X", (uint8_t)c);
-      out += hex;
-    } else {
-      out += c;
-    }
-  }
-}
-
 bool WebDAVHandler::isProtectedPath(const String& path) const {
   // Check every segment of the path, not just the last one.
   // This prevents access to e.g. /.hidden/somefile or /System Volume Information/foo
@@ -798,10 +826,20 @@ bool WebDAVHandler::getOverwrite(WebServer& s) const {
   return true;  // Default is T
 }
 
-void WebDAVHandler::clearEpubCacheIfNeeded(const String& path) const {
-  if (FsHelpers::hasEpubExtension(path)) {
+void WebDAVHandler::clearFileCachesIfNeeded(const String& path) const {
+  if (FsHelpers::hasEpubExtension(path) || FsHelpers::hasFb2Extension(path)) {
     Epub(path.c_str(), "/.crosspoint").clearCache();
     LOG_DBG("DAV", "Cleared epub cache for: %s", path.c_str());
+  } else if (FsHelpers::hasBmpExtension(path.c_str())) {
+    SleepScreenCache::forget(path.c_str());
+  }
+}
+
+void WebDAVHandler::invalidateFileCachesIfNeeded(const String& path) const {
+  if (FsHelpers::hasEpubExtension(path) || FsHelpers::hasFb2Extension(path)) {
+    Epub(path.c_str(), "/.crosspoint").invalidateCache();
+  } else if (FsHelpers::hasBmpExtension(path.c_str())) {
+    SleepScreenCache::forget(path.c_str());  // Can't be told from a replaced image of the same size
   }
 }
 
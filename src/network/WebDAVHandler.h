@@ -12,6 +12,8 @@ class WebDAVHandler : public RequestHandler {
   bool handle(WebServer& server, HTTPMethod method, const String& uri) override;
 
  private:
+  class PropfindWriter;
+
   // PUT streaming state (raw() is called in chunks)
   FsFile _putFile;
   String _putPath;
@@ -34,11 +36,16 @@ class WebDAVHandler : public RequestHandler {
   // Utilities
   String getRequestPath(WebServer& s) const;
   String getDestinationPath(WebServer& s) const;
-  void urlEncodePath(const String& path, String& out) const;
   bool isProtectedPath(const String& path) const;
   int getDepth(WebServer& s) const;
   bool getOverwrite(WebServer& s) const;
-  void clearEpubCacheIfNeeded(const String& path) const;
-  void sendPropEntry(WebServer& s, const String& href, bool isDir, size_t size, const String& lastModified) const;
+  void clearFileCachesIfNeeded(const String& path) const;
+  // For uploads: the cache is cleared by the book's next load instead of during the request
+  void invalidateFileCachesIfNeeded(const String& path) const;
+  // Appends the response element for path, or for its child childName when that is not null
+  void sendPropEntry(PropfindWriter& out, const String& path, const char* childName, bool isDir, size_t size,
+                     const char* lastModified) const;
+  // RFC 1123 modification date of file, written to out (32 bytes)
+  const char* formatLastModified(FsFile& file, char* out) const;
   String getMimeType(const String& path) const;
 };
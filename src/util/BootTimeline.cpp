@@ -0,0 +1,62 @@
+#include "BootTimeline.h"
+
+#include <Arduino.h>
+#include <Logging.h>
+
+#include <cstring>
+
+namespace {
+constexpr uint32_t TIMELINE_MAGIC = 0x31544F42;  // "BOT1"
+}  // namespace
+
+// Not zeroed on reboot; only trusted when the magic matches (see rtcLogMagic in Logging.cpp)
+RTC_NOINIT_ATTR BootTimeline::Timeline BootTimeline::current;
+BootTimeline::Timeline BootTimeline::previous = {};
+uint32_t BootTimeline::lastMarkMs = 0;
+
+void BootTimeline::begin() {
+  if (current.magic == TIMELINE_MAGIC && current.count <= MAX_STAGES) {
+    previous = current;
+  }
+  memset(&current, 0, sizeof(current));
+  current.magic = TIMELINE_MAGIC;
+  // From reset to setup(): ROM and second stage bootloader, Arduino core start
+  lastMarkMs = 0;
+  mark("startup");
+}
+
+void BootTimeline::mark(const char* stage) {
+  const uint32_t now = millis();
+  if (current.magic != TIMELINE_MAGIC || current.count >= MAX_STAGES) {
+    return;
+  }
+  auto& entry = current.stages[current.count++];
+  strncpy(entry.name, stage, NAME_LENGTH - 1);
+  entry.name[NAME_LENGTH - 1] = '\0';
+  entry.durationMs = now - lastMarkMs;
+  lastMarkMs = now;
+}
+
+void BootTimeline::logPrevious() { log("Previous boot", previous); }
+
+void BootTimeline::logCurrent() { log("Boot", current); }
+
+void BootTimeline::log(const char* label, const Timeline& timeline) {
+  if (timeline.magic != TIMELINE_MAGIC || timeline.count == 0) {
+    return;
+  }
+  char line[MAX_STAGES * (NAME_LENGTH + 8)];
+  size_t len = 0;
+  uint32_t totalMs = 0;
+  for (uint8_t i = 0; i < timeline.count && len < sizeof(line); i++) {
+    const auto& stage = timeline.stages[i];
+    const int written = snprintf(line + len, sizeof(line) - len, " %s=%lu", stage.name,
+                                 static_cast<unsigned long>(stage.durationMs));
+    if (written < 0) {
+      break;
+    }
+    len += static_cast<size_t>(written);
+    totalMs += stage.durationMs;
+  }
+  LOG_INF("BOOT", "%s: %lu ms,%s", label, static_cast<unsigned long>(totalMs), line);
+}
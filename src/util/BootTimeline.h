@@ -0,0 +1,42 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Durations of the stages of setup(), kept in RTC memory so they survive the reboot and can be logged early on the
+ * next boot, where the serial console is usually already attached. The current boot's timeline is logged once setup()
+ * is done as well.
+ *
+ * No heap is used. Stage names are copied, as string literals from a previous firmware are not valid after an update.
+ */
+class BootTimeline {
+ public:
+  static constexpr size_t MAX_STAGES = 16;
+  static constexpr size_t NAME_LENGTH = 12;
+
+  // Call first thing in setup(): keeps the previous boot's timeline for logPrevious() and starts a new one
+  static void begin();
+  // Ends the stage running since the last mark (or begin) and records it under this name
+  static void mark(const char* stage);
+
+  static void logPrevious();
+  static void logCurrent();
+
+ private:
+  struct Stage {
+    char name[NAME_LENGTH];
+    uint32_t durationMs;
+  };
+
+  struct Timeline {
+    uint32_t magic;
+    uint8_t count;
+    Stage stages[MAX_STAGES];
+  };
+
+  static void log(const char* label, const Timeline& timeline);
+
+  static Timeline current;
+  static Timeline previous;
+  static uint32_t lastMarkMs;
+};
@@ -1,5 +1,7 @@
 #include "ButtonNavigator.h"
 
+#include <algorithm>
+
 const MappedInputManager* ButtonNavigator::mappedInput = nullptr;
 
 void ButtonNavigator::onNext(const Callback& callback) {
@@ -59,6 +61,11 @@ void ButtonNavigator::onContinuous(const Buttons& buttons, const Callback& callb
   });
 
   if (isPressed) {
+    if (mappedInput->getPressTime() != continuousPressTime) {
+      continuousPressTime = mappedInput->getPressTime();
+      continuousSteps = 0;
+    }
+    continuousSteps++;
     callback();
     lastContinuousNavTime = millis();
   }
@@ -68,11 +75,19 @@ bool ButtonNavigator::shouldNavigateContinuously() const {
   if (!mappedInput) return false;
 
   const bool buttonHeldLongEnough = mappedInput->getHeldTime() > continuousStartMs;
-  const bool navigationIntervalElapsed = (millis() - lastContinuousNavTime) > continuousIntervalMs;
+  // Steps of the same press come faster as it goes on
+  const int speedUps =
+      mappedInput->getPressTime() == continuousPressTime ? std::min(continuousSteps / ACCELERATE_STEPS, 2) : 0;
+  const uint32_t intervalMs = continuousIntervalMs >> speedUps;
+  const bool navigationIntervalElapsed = (millis() - lastContinuousNavTime) > intervalMs;
 
   return buttonHeldLongEnough && navigationIntervalElapsed;
 }
 
+int ButtonNavigator::continuousStride() const {
+  return std::min(1 << ((continuousSteps - 1) / ACCELERATE_STEPS), MAX_STRIDE);
+}
+
 int ButtonNavigator::nextIndex(const int currentIndex, const int totalItems) {
   if (totalItems <= 0) return 0;
 
@@ -87,7 +102,8 @@ int ButtonNavigator::previousIndex(const int currentIndex, const int totalItems)
   return (currentIndex + totalItems - 1) % totalItems;
 }
 
-int ButtonNavigator::nextPageIndex(const int currentIndex, const int totalItems, const int itemsPerPage) {
+int ButtonNavigator::nextPageIndex(const int currentIndex, const int totalItems, const int itemsPerPage,
+                                   const int pages) {
   if (totalItems <= 0 || itemsPerPage <= 0) return 0;
 
   // When items fit on one page, use index navigation instead
@@ -99,13 +115,14 @@ int ButtonNavigator::nextPageIndex(const int currentIndex, const int totalItems,
   const int currentPageIndex = currentIndex / itemsPerPage;
 
   if (currentPageIndex < lastPageIndex) {
-    return (currentPageIndex + 1) * itemsPerPage;
+    return std::min(currentPageIndex + std::max(pages, 1), lastPageIndex) * itemsPerPage;
   }
 
   return 0;
 }
 
-int ButtonNavigator::previousPageIndex(const int currentIndex, const int totalItems, const int itemsPerPage) {
+int ButtonNavigator::previousPageIndex(const int currentIndex, const int totalItems, const int itemsPerPage,
+                                       const int pages) {
   if (totalItems <= 0 || itemsPerPage <= 0) return 0;
 
   // When items fit on one page, use index navigation instead
@@ -117,8 +134,49 @@ int ButtonNavigator::previousPageIndex(const int currentIndex, const int totalIt
   const int currentPageIndex = currentIndex / itemsPerPage;
 
   if (currentPageIndex > 0) {
-    return (currentPageIndex - 1) * itemsPerPage;
+    return std::max(currentPageIndex - std::max(pages, 1), 0) * itemsPerPage;
   }
 
   return lastPageIndex * itemsPerPage;
 }
+
+int ButtonNavigator::nextGroupIndex(const int currentIndex, const int totalItems,
+                                    const std::function<uint32_t(int index)>& groupKey) {
+  if (totalItems <= 0) return 0;
+  if (currentIndex < 0 || currentIndex >= totalItems - 1) return 0;
+
+  // First index past currentIndex with a greater key
+  const uint32_t key = groupKey(currentIndex);
+  int low = currentIndex + 1;
+  int high = totalItems;
+  while (low < high) {
+    const int mid = low + (high - low) / 2;
+    if (groupKey(mid) > key) {
+      high = mid;
+    } else {
+      low = mid + 1;
+    }
+  }
+  return low < totalItems ? low : 0;
+}
+
+int ButtonNavigator::previousGroupIndex(const int currentIndex, const int totalItems,
+                                        const std::function<uint32_t(int index)>& groupKey) {
+  if (totalItems <= 0) return 0;
+
+  // The group of the item before currentIndex, so the first of a group steps back a whole group; the first item wraps
+  // around to the last group
+  const int end = currentIndex <= 0 || currentIndex >= totalItems ? totalItems : currentIndex;
+  const uint32_t key = groupKey(end - 1);
+  int low = 0;
+  int high = end - 1;
+  while (low < high) {
+    const int mid = low + (high - low) / 2;
+    if (groupKey(mid) < key) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  return low;
+}
@@ -9,9 +9,17 @@ class ButtonNavigator final {
   using Callback = std::function<void()>;
   using Buttons = std::vector<MappedInputManager::Button>;
 
+  // A held button steps faster, and further, the longer it is held: the interval halves and the stride doubles every
+  // ACCELERATE_STEPS continuous steps, down to a quarter of the interval and up to MAX_STRIDE. Steps can come faster
+  // than the panel refreshes, as the render task only ever draws the latest selection.
+  static constexpr int ACCELERATE_STEPS = 4;
+  static constexpr int MAX_STRIDE = 8;
+
   const uint16_t continuousStartMs;
   const uint16_t continuousIntervalMs;
   uint32_t lastContinuousNavTime = 0;
+  uint32_t continuousPressTime = 0;  // Of the press the steps are counted for
+  int continuousSteps = 0;
   static const MappedInputManager* mappedInput;
 
   [[nodiscard]] bool shouldNavigateContinuously() const;
@@ -38,11 +46,24 @@ class ButtonNavigator final {
   void onPreviousContinuous(const Callback& callback);
   void onContinuous(const Buttons& buttons, const Callback& callback);
 
+  // Pages (or other units) the current continuous step should move by: 1 at first, doubling as the button stays held
+  [[nodiscard]] int continuousStride() const;
+  // Whether the button has been held long enough for a sorted list to jump a group (an initial letter) at a time
+  [[nodiscard]] bool continuousGroupJumps() const { return continuousSteps > 3 * ACCELERATE_STEPS; }
+
   [[nodiscard]] static int nextIndex(int currentIndex, int totalItems);
   [[nodiscard]] static int previousIndex(int currentIndex, int totalItems);
 
-  [[nodiscard]] static int nextPageIndex(int currentIndex, int totalItems, int itemsPerPage);
-  [[nodiscard]] static int previousPageIndex(int currentIndex, int totalItems, int itemsPerPage);
+  // The first item pages pages on, stopping at the last page before wrapping around
+  [[nodiscard]] static int nextPageIndex(int currentIndex, int totalItems, int itemsPerPage, int pages = 1);
+  [[nodiscard]] static int previousPageIndex(int currentIndex, int totalItems, int itemsPerPage, int pages = 1);
+
+  // For a list sorted by groupKey (directories then files by initial letter, say): the first item of the next group,
+  // wrapping around after the last, or the first of the previous group. Binary searches, reading a few keys only.
+  [[nodiscard]] static int nextGroupIndex(int currentIndex, int totalItems,
+                                          const std::function<uint32_t(int index)>& groupKey);
+  [[nodiscard]] static int previousGroupIndex(int currentIndex, int totalItems,
+                                              const std::function<uint32_t(int index)>& groupKey);
 
   [[nodiscard]] static Buttons getNextButtons() {
     return {MappedInputManager::Button::Down, MappedInputManager::Button::Right};
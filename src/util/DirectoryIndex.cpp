@@ -0,0 +1,459 @@
+#include "DirectoryIndex.h"
+
+#include <Arduino.h>
+#include <FsHelpers.h>
+#include <Logging.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+
+namespace {
+constexpr char MAGIC[4] = {'D', 'I', 'X', '1'};
+constexpr const char* INDEX_DIR = "/.crosspoint/dirs";
+constexpr uint8_t FLAG_SHOW_HIDDEN = 0x01;
+constexpr size_t MAX_NAME_LENGTH = 499;  // Same limit as the browser's listing buffer
+constexpr size_t RECORD_HEADER_SIZE = 7;
+
+struct Header {
+  char magic[4];
+  uint32_t fingerprint;
+  uint32_t count;
+  uint32_t tableOffset;
+  uint8_t flags;
+  uint8_t reserved[3];
+};
+static_assert(sizeof(Header) == 20, "Header is part of the index format");
+
+// "/", or the path without a trailing slash
+std::string normaliseDir(const std::string& dirPath) {
+  std::string dir = dirPath.empty() ? "/" : dirPath;
+  while (dir.size() > 1 && dir.back() == '/') {
+    dir.pop_back();
+  }
+  return dir;
+}
+
+std::string indexPathFor(const std::string& dir) {
+  return std::string(INDEX_DIR) + "/" + std::to_string(std::hash<std::string>{}(dir)) + ".idx";
+}
+
+bool readHeader(FsFile& file, Header& header) {
+  return file.read(&header, sizeof(header)) == sizeof(header) && memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+bool readRecord(FsFile& file, DirectoryIndex::Entry& entry) {
+  uint8_t record[RECORD_HEADER_SIZE];
+  if (file.read(record, sizeof(record)) != sizeof(record)) {
+    return false;
+  }
+  uint16_t length;
+  memcpy(&entry.size, record + 1, sizeof(entry.size));
+  memcpy(&length, record + 5, sizeof(length));
+  if (length > MAX_NAME_LENGTH) {
+    return false;
+  }
+  entry.isDirectory = record[0] != 0;
+  entry.name.resize(length);
+  return file.read(&entry.name[0], length) == length;
+}
+
+// Writes an index under a temporary name, moved over the old one by finish()
+class IndexWriter {
+  FsFile file;
+  std::string path;
+  Header header = {};
+  std::vector<uint32_t> offsets;
+  uint32_t position = 0;
+  bool ok = false;
+
+  void write(const void* data, const size_t size) {
+    ok = ok && file.write(data, size) == size;
+    position += size;
+  }
+
+ public:
+  ~IndexWriter() {
+    if (file) {
+      file.close();
+      Storage.remove((path + ".tmp").c_str());
+    }
+  }
+
+  bool begin(const std::string& indexPath, const uint32_t fingerprint, const bool showHidden) {
+    path = indexPath;
+    if (!Storage.ensureDirectoryExists(INDEX_DIR) || !Storage.openFileForWrite("DIX", path + ".tmp", file)) {
+      return false;
+    }
+    memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.fingerprint = fingerprint;
+    header.flags = showHidden ? FLAG_SHOW_HIDDEN : 0;
+    ok = true;
+    write(&header, sizeof(header));  // Placeholder until the count and table offset are known
+    return ok;
+  }
+
+  void add(const DirectoryIndex::Entry& entry) {
+    const uint16_t length = std::min(entry.name.size(), MAX_NAME_LENGTH);
+    uint8_t record[RECORD_HEADER_SIZE];
+    record[0] = entry.isDirectory ? 1 : 0;
+    memcpy(record + 1, &entry.size, sizeof(entry.size));
+    memcpy(record + 5, &length, sizeof(length));
+    offsets.push_back(position);
+    write(record, sizeof(record));
+    write(entry.name.data(), length);
+  }
+
+  bool finish() {
+    header.count = offsets.size();
+    header.tableOffset = position;
+    write(offsets.data(), offsets.size() * sizeof(uint32_t));
+    ok = ok && file.seek(0) && file.write(&header, sizeof(header)) == sizeof(header);
+    file.close();
+
+    const std::string tempPath = path + ".tmp";
+    if (ok) {
+      Storage.remove(path.c_str());
+      ok = Storage.rename(tempPath.c_str(), path.c_str());
+    }
+    if (!ok) {
+      Storage.remove(tempPath.c_str());
+    }
+    return ok;
+  }
+};
+std::unique_ptr<DirectoryIndex::Edit> held;
+}  // namespace
+
+// FNV-1a over the directory's raw 32-byte entries: names, attributes, sizes and times of everything in it, including
+// deleted slots. Reading them is one sequential pass, much cheaper than opening every entry.
+uint32_t DirectoryIndex::fingerprint(const std::string& dirPath) {
+  auto file = Storage.open(dirPath.c_str());
+  if (!file || !file.isDirectory()) {
+    return 0;
+  }
+  uint8_t buffer[256];
+  uint32_t hash = 2166136261u;
+  int bytes;
+  while ((bytes = file.read(buffer, sizeof(buffer))) > 0) {
+    for (int i = 0; i < bytes; i++) {
+      hash = (hash ^ buffer[i]) * 16777619u;
+    }
+  }
+  file.close();
+  return hash != 0 ? hash : 1;
+}
+
+bool DirectoryIndex::less(const Entry& a, const Entry& b) {
+  // Directories first
+  if (a.isDirectory != b.isDirectory) return a.isDirectory;
+
+  // Start naive natural sort
+  const char* s1 = a.name.c_str();
+  const char* s2 = b.name.c_str();
+
+  // Iterate while both strings have characters
+  while (*s1 && *s2) {
+    // Check if both are at the start of a number
+    if (isdigit(*s1) && isdigit(*s2)) {
+      // Skip leading zeros
+      while (*s1 == '0') s1++;
+      while (*s2 == '0') s2++;
+
+      // Count digits to compare lengths first
+      int len1 = 0, len2 = 0;
+      while (isdigit(s1[len1])) len1++;
+      while (isdigit(s2[len2])) len2++;
+
+      // Different length so return smaller integer value
+      if (len1 != len2) return len1 < len2;
+
+      // Same length so compare digit by digit
+      for (int i = 0; i < len1; i++) {
+        if (s1[i] != s2[i]) return s1[i] < s2[i];
+      }
+
+      // Numbers equal so advance pointers
+      s1 += len1;
+      s2 += len2;
+    } else {
+      // Regular case-insensitive character comparison
+      char c1 = tolower(*s1);
+      char c2 = tolower(*s2);
+      if (c1 != c2) return c1 < c2;
+      s1++;
+      s2++;
+    }
+  }
+
+  // One string is prefix of other
+  return *s1 == '\0' && *s2 != '\0';
+}
+
+bool DirectoryIndex::isListed(const char* name, const bool isDirectory, const bool showHidden) {
+  if ((!showHidden && name[0] == '.') || strcmp(name, "System Volume Information") == 0) {
+    return false;
+  }
+  if (isDirectory) {
+    return true;
+  }
+  const std::string_view filename{name};
+  return FsHelpers::hasEpubExtension(filename) || FsHelpers::hasFb2Extension(filename) ||
+         FsHelpers::hasXtcExtension(filename) || FsHelpers::hasTxtExtension(filename) ||
+         FsHelpers::hasMarkdownExtension(filename) || FsHelpers::hasBmpExtension(filename) ||
+         FsHelpers::hasCbzExtension(filename);
+}
+
+void DirectoryIndex::forget(const std::string& dirPath) {
+  releaseHeldEdit();
+  const std::string path = indexPathFor(normaliseDir(dirPath));
+  if (Storage.exists(path.c_str())) {
+    Storage.remove(path.c_str());
+  }
+}
+
+bool DirectoryIndex::open(const std::string& dirPath, const bool showHidden) {
+  close();
+  releaseHeldEdit();
+  const std::string dir = normaliseDir(dirPath);
+  const uint32_t current = fingerprint(dir);
+  if (current == 0) {
+    return false;
+  }
+  if (openFile(indexPathFor(dir), current, showHidden)) {
+    LOG_DBG("DIX", "Listing %s from its index: %zu entries", dir.c_str(), count);
+    return true;
+  }
+  return build(dir, current, showHidden);
+}
+
+void DirectoryIndex::close() {
+  if (file) {
+    file.close();
+  }
+  count = 0;
+  tableOffset = 0;
+  fallback.clear();
+  fallback.shrink_to_fit();
+  page.clear();
+  pageStart = 0;
+}
+
+bool DirectoryIndex::openFile(const std::string& indexPath, const uint32_t fingerprint, const bool showHidden) {
+  if (!Storage.exists(indexPath.c_str()) || !Storage.openFileForRead("DIX", indexPath, file)) {
+    return false;
+  }
+  Header header;
+  if (!readHeader(file, header) || header.fingerprint != fingerprint ||
+      ((header.flags & FLAG_SHOW_HIDDEN) != 0) != showHidden) {
+    file.close();
+    return false;
+  }
+  count = header.count;
+  tableOffset = header.tableOffset;
+  return true;
+}
+
+bool DirectoryIndex::build(const std::string& dirPath, const uint32_t fingerprint, const bool showHidden) {
+  auto dir = Storage.open(dirPath.c_str());
+  if (!dir || !dir.isDirectory()) {
+    return false;
+  }
+
+  const unsigned long start = millis();
+  std::vector<Entry> entries;
+  char name[MAX_NAME_LENGTH + 1];
+  for (auto file = dir.openNextFile(); file; file = dir.openNextFile()) {
+    file.getName(name, sizeof(name));
+    const bool isDirectory = file.isDirectory();
+    if (isListed(name, isDirectory, showHidden)) {
+      entries.push_back({name, isDirectory, isDirectory ? 0 : static_cast<uint32_t>(file.fileSize())});
+    }
+  }
+  dir.close();
+  std::sort(entries.begin(), entries.end(), less);
+
+  const std::string path = indexPathFor(dirPath);
+  IndexWriter writer;
+  if (writer.begin(path, fingerprint, showHidden)) {
+    for (const auto& entry : entries) {
+      writer.add(entry);
+    }
+    if (writer.finish() && openFile(path, fingerprint, showHidden)) {
+      LOG_DBG("DIX", "Indexed %s: %zu entries in %lu ms", dirPath.c_str(), count, millis() - start);
+      return true;
+    }
+  }
+
+  LOG_ERR("DIX", "Failed to write index for %s, listing from RAM", dirPath.c_str());
+  fallback = std::move(entries);
+  count = fallback.size();
+  return true;
+}
+
+bool DirectoryIndex::loadPage(const size_t start) {
+  page.clear();
+  uint32_t offset;
+  if (!file.seek(tableOffset + start * sizeof(uint32_t)) || file.read(&offset, sizeof(offset)) != sizeof(offset) ||
+      !file.seek(offset)) {
+    LOG_ERR("DIX", "Failed to read index table at entry %zu", start);
+    return false;
+  }
+  // Records are stored in order, so a page is one sequential read
+  const size_t end = std::min(start + PAGE_SIZE, count);
+  page.resize(end - start);
+  for (auto& entry : page) {
+    if (!readRecord(file, entry)) {
+      LOG_ERR("DIX", "Corrupt index record near entry %zu", start);
+      page.clear();
+      return false;
+    }
+  }
+  pageStart = start;
+  return true;
+}
+
+const DirectoryIndex::Entry& DirectoryIndex::at(const size_t index) {
+  if (index >= count) {
+    return empty;
+  }
+  if (!file) {
+    return fallback[index];
+  }
+  if (page.empty() || index < pageStart || index >= pageStart + page.size()) {
+    if (!loadPage(index - index % PAGE_SIZE)) {
+      return empty;
+    }
+  }
+  return page[index - pageStart];
+}
+
+size_t DirectoryIndex::find(const std::string& name, const bool isDirectory) {
+  const Entry key{name, isDirectory, 0};
+  size_t low = 0;
+  size_t high = count;
+  while (low < high) {
+    const size_t mid = low + (high - low) / 2;
+    if (less(at(mid), key)) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  // Names the natural order ranks equal ("a01", "a1") sit next to each other
+  for (size_t i = low; i < count && !less(key, at(i)); i++) {
+    const Entry& entry = at(i);
+    if (entry.isDirectory == isDirectory && entry.name == name) {
+      return i;
+    }
+  }
+  return npos;
+}
+
+DirectoryIndex::Edit& DirectoryIndex::heldEdit(const std::string& dirPath) {
+  if (held && held->dirPath != normaliseDir(dirPath)) {
+    held.reset();
+  }
+  if (!held) {
+    held.reset(new Edit(dirPath));
+  }
+  return *held;
+}
+
+void DirectoryIndex::releaseHeldEdit() { held.reset(); }
+
+DirectoryIndex::Edit::Edit(const std::string& dirPath) : dirPath(normaliseDir(dirPath)) {
+  releaseHeldEdit();
+  FsFile file;
+  const std::string path = indexPathFor(this->dirPath);
+  if (!Storage.exists(path.c_str()) || !Storage.openFileForRead("DIX", path, file)) {
+    return;
+  }
+  Header header;
+  current = readHeader(file, header) && header.fingerprint == fingerprint(this->dirPath);
+  showHidden = (header.flags & FLAG_SHOW_HIDDEN) != 0;
+  file.close();
+}
+
+void DirectoryIndex::Edit::added(const std::string& name, const bool isDirectory, const uint32_t size) {
+  if (!current || !isListed(name.c_str(), isDirectory, showHidden)) {
+    return;
+  }
+  additions.erase(std::remove_if(additions.begin(), additions.end(),
+                                 [&name](const Entry& entry) { return entry.name == name; }),
+                  additions.end());
+  additions.push_back({name, isDirectory, size});
+}
+
+void DirectoryIndex::Edit::removed(const std::string& name) {
+  if (!current) {
+    return;
+  }
+  additions.erase(std::remove_if(additions.begin(), additions.end(),
+                                 [&name](const Entry& entry) { return entry.name == name; }),
+                  additions.end());
+  removals.push_back(name);
+}
+
+DirectoryIndex::Edit::~Edit() {
+  if (!current) {
+    return;
+  }
+  const uint32_t updated = fingerprint(dirPath);
+  const std::string path = indexPathFor(dirPath);
+
+  if (additions.empty() && removals.empty()) {
+    // Nothing listed changed, only the fingerprint needs refreshing
+    auto file = Storage.open(path.c_str(), O_RDWR);
+    const bool written = file && file.seek(offsetof(Header, fingerprint)) &&
+                         file.write(&updated, sizeof(updated)) == sizeof(updated) && file.close();
+    if (!written) {
+      LOG_ERR("DIX", "Failed to refresh index of %s", dirPath.c_str());
+      Storage.remove(path.c_str());
+    }
+    return;
+  }
+
+  // Merge the changes into a copy of the old index, which is already in order
+  FsFile old;
+  Header header;
+  if (!Storage.openFileForRead("DIX", path, old) || !readHeader(old, header)) {
+    Storage.remove(path.c_str());
+    return;
+  }
+  std::sort(additions.begin(), additions.end(), less);
+  const auto isReplaced = [this](const std::string& name) {
+    return std::find(removals.begin(), removals.end(), name) != removals.end() ||
+           std::any_of(additions.begin(), additions.end(), [&name](const Entry& entry) { return entry.name == name; });
+  };
+
+  IndexWriter writer;
+  bool ok = writer.begin(path, updated, showHidden);
+  auto next = additions.begin();
+  Entry entry;
+  for (uint32_t i = 0; ok && i < header.count; i++) {
+    if (!readRecord(old, entry)) {
+      ok = false;
+      break;
+    }
+    if (isReplaced(entry.name)) {
+      continue;
+    }
+    while (next != additions.end() && less(*next, entry)) {
+      writer.add(*next++);
+    }
+    writer.add(entry);
+  }
+  while (next != additions.end()) {
+    writer.add(*next++);
+  }
+  old.close();
+
+  if (!ok || !writer.finish()) {
+    LOG_ERR("DIX", "Failed to update index of %s", dirPath.c_str());
+    Storage.remove(path.c_str());
+  }
+}
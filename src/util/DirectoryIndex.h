@@ -0,0 +1,113 @@
+#pragma once
+
+#include <HalStorage.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Sorted listing of one directory, kept on the SD card (/.crosspoint/dirs/<hash of the path>.idx) so the file browser
+ * can open a folder of hundreds of books without walking and sorting it on every visit. It holds the entries the
+ * browser lists (directories and supported files, directories first, in natural order) with their type and size, and
+ * is read a page at a time, so a large folder never sits in RAM.
+ *
+ * FAT keeps no usable modification time for directories, so an index is checked against a fingerprint of the
+ * directory's raw entries instead, which changes whenever an entry is added, removed, renamed or written. A stale index
+ * is rebuilt on open. Changes the firmware makes itself (uploads, WebDAV, deleting from the browser) go through Edit,
+ * which patches the index rather than leaving it to be rebuilt.
+ *
+ * Index file format:
+ * - char magic[4] - "DIX1"
+ * - uint32_t fingerprint
+ * - uint32_t count
+ * - uint32_t tableOffset
+ * - uint8_t flags - bit 0: hidden files listed
+ * - uint8_t reserved[3]
+ * - count records: uint8_t isDirectory, uint32_t size, uint16_t nameLength, char name[nameLength]
+ * - uint32_t offsets[count] at tableOffset - file offset of each record
+ */
+class DirectoryIndex {
+ public:
+  struct Entry {
+    std::string name;
+    bool isDirectory = false;
+    uint32_t size = 0;
+  };
+
+  static constexpr size_t npos = static_cast<size_t>(-1);
+
+  // Natural order, directories first
+  static bool less(const Entry& a, const Entry& b);
+  // Whether the browser lists an entry of this name
+  static bool isListed(const char* name, bool isDirectory, bool showHidden);
+  // Drops the index of a directory that was removed or moved away
+  static void forget(const std::string& dirPath);
+  // Changes whenever an entry of the directory is added, removed, renamed or written; 0 if it is not a directory
+  static uint32_t fingerprint(const std::string& dirPath);
+
+  DirectoryIndex() = default;
+  DirectoryIndex(const DirectoryIndex&) = delete;
+  DirectoryIndex& operator=(const DirectoryIndex&) = delete;
+
+  // Opens the index of dirPath, rebuilding it first if it is missing or stale. False if dirPath is not a directory.
+  bool open(const std::string& dirPath, bool showHidden);
+  void close();
+
+  size_t size() const { return count; }
+  // Reads the page holding index from the card unless it is already loaded; out of range gives an empty entry
+  const Entry& at(size_t index);
+  // Position of an entry, or npos
+  size_t find(const std::string& name, bool isDirectory);
+
+  /**
+   * Records a change the firmware makes to a directory. Construct it before the change, report the entries it
+   * touched, and the index is brought up to date when the Edit goes out of scope. An Edit that finds the index already
+   * stale leaves it to be rebuilt on the next open, so a change made behind its back costs a rebuild, never a wrong
+   * listing. Changes to unlisted entries (temporary files, hidden files) need an Edit with nothing reported.
+   */
+  class Edit {
+    friend class DirectoryIndex;
+
+    std::string dirPath;
+    bool current = false;
+    bool showHidden = false;
+    std::vector<Entry> additions;
+    std::vector<std::string> removals;
+
+   public:
+    explicit Edit(const std::string& dirPath);
+    ~Edit();
+    Edit(const Edit&) = delete;
+    Edit& operator=(const Edit&) = delete;
+
+    // Adds an entry, or updates it if the name is already listed
+    void added(const std::string& name, bool isDirectory, uint32_t size);
+    void removed(const std::string& name);
+  };
+
+  /**
+   * An Edit kept open over a run of changes to one directory, such as the books of a sync arriving one after another,
+   * so the directory is fingerprinted and its index rewritten once for the run instead of for every book. Any other
+   * Edit, open() or forget() closes it first, so none of them sees it half done; so does a held Edit of another
+   * directory. Used from one task at a time, like Edit.
+   */
+  static Edit& heldEdit(const std::string& dirPath);
+  static void releaseHeldEdit();
+
+ private:
+  static constexpr size_t PAGE_SIZE = 16;
+
+  FsFile file;
+  size_t count = 0;
+  uint32_t tableOffset = 0;
+  // Entries of a directory whose index could not be written, held in RAM as the browser always did
+  std::vector<Entry> fallback;
+  std::vector<Entry> page;
+  size_t pageStart = 0;
+  Entry empty;
+
+  bool build(const std::string& dirPath, uint32_t fingerprint, bool showHidden);
+  bool openFile(const std::string& indexPath, uint32_t fingerprint, bool showHidden);
+  bool loadPage(size_t start);
+};
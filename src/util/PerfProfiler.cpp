@@ -0,0 +1,169 @@
+#include "PerfProfiler.h"
+
+#include <Arduino.h>
+#include <GfxRenderer.h>
+#include <HalPowerManager.h>
+#include <Logging.h>
+
+#include <cstdio>
+
+#include "fontIds.h"
+
+namespace {
+constexpr uint32_t DUMP_MAGIC = 0x31465250;  // "PRF1"
+constexpr uint16_t DUMP_VERSION = 1;
+
+struct DumpHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint8_t sampleSize;
+  uint8_t phaseCount;
+  uint32_t sampleCount;
+};
+static_assert(sizeof(DumpHeader) == 12, "DumpHeader is part of the serial dump format");
+
+// Short labels for the overlay, same order as PerfProfiler::Phase
+constexpr const char* SHORT_NAMES[PerfProfiler::PHASE_COUNT] = {"sec",   "page", "scan",  "pre",  "bw",   "disp",
+                                                                "store", "gray", "gdisp", "rest", "input"};
+}  // namespace
+
+PerfProfiler::Sample PerfProfiler::samples[CAPACITY] = {};
+size_t PerfProfiler::head = 0;
+size_t PerfProfiler::count = 0;
+uint16_t PerfProfiler::frame = 0;
+bool PerfProfiler::overlay = false;
+
+PerfProfiler::Scope::Scope(const Phase phase) : phase(phase), startUs(micros()) {}
+
+void PerfProfiler::Scope::end() {
+  if (!active) {
+    return;
+  }
+  active = false;
+  record(phase, micros() - startUs);
+}
+
+void PerfProfiler::beginFrame() { frame++; }
+
+void PerfProfiler::record(const Phase phase, const uint32_t durationUs) {
+  samples[head] = {frame, phase, 0, durationUs};
+  head = (head + 1) % CAPACITY;
+  if (count < CAPACITY) {
+    count++;
+  }
+}
+
+bool PerfProfiler::frameTotals(const uint16_t frameId, uint32_t (&totalsUs)[PHASE_COUNT]) {
+  for (auto& total : totalsUs) {
+    total = 0;
+  }
+  bool found = false;
+  // Newest first: a frame's samples are contiguous, so stop once we've walked past it
+  for (size_t i = 0; i < count; i++) {
+    const Sample& sample = samples[(head + CAPACITY - 1 - i) % CAPACITY];
+    if (sample.frame != frameId) {
+      if (found) {
+        break;
+      }
+      continue;
+    }
+    found = true;
+    if (sample.phase < PHASE_COUNT) {
+      totalsUs[sample.phase] += sample.durationUs;
+    }
+  }
+  return found;
+}
+
+void PerfProfiler::logFrame(const uint16_t frameId) {
+  uint32_t totalsUs[PHASE_COUNT];
+  if (!frameTotals(frameId, totalsUs)) {
+    return;
+  }
+  char line[256];
+  int len = snprintf(line, sizeof(line), "Frame %u:", frameId);
+  uint32_t sumUs = 0;
+  for (int i = 0; i < PHASE_COUNT && len < static_cast<int>(sizeof(line)); i++) {
+    if (i != INPUT_LATENCY) {
+      sumUs += totalsUs[i];
+    }
+    if (totalsUs[i] > 0) {
+      len += snprintf(line + len, sizeof(line) - len, " %s=%lums", phaseName(static_cast<Phase>(i)),
+                      static_cast<unsigned long>(totalsUs[i] / 1000));
+    }
+  }
+  LOG_DBG("PRF", "%s total=%lums", line, static_cast<unsigned long>(sumUs / 1000));
+}
+
+const char* PerfProfiler::phaseName(const Phase phase) {
+  switch (phase) {
+    case SECTION_LOAD:
+      return "section_load";
+    case PAGE_LOAD:
+      return "page_load";
+    case SCAN_PASS:
+      return "scan";
+    case PREWARM:
+      return "prewarm";
+    case BW_RENDER:
+      return "bw_render";
+    case BW_DISPLAY:
+      return "display";
+    case BW_STORE:
+      return "bw_store";
+    case GRAY_RENDER:
+      return "gray_render";
+    case GRAY_DISPLAY:
+      return "gray_display";
+    case BW_RESTORE:
+      return "bw_restore";
+    case INPUT_LATENCY:
+      return "input_latency";
+    default:
+      return "unknown";
+  }
+}
+
+void PerfProfiler::drawOverlay(GfxRenderer& renderer, const int x, const int y, const int width) {
+  uint32_t totalsUs[PHASE_COUNT];
+  if (!frameTotals(static_cast<uint16_t>(frame - 1), totalsUs)) {
+    return;
+  }
+  char line[160];
+  int len = 0;
+  uint32_t sumUs = 0;
+  for (int i = 0; i < PHASE_COUNT && len < static_cast<int>(sizeof(line)); i++) {
+    if (i != INPUT_LATENCY) {
+      sumUs += totalsUs[i];
+    }
+    if (totalsUs[i] > 0) {
+      len += snprintf(line + len, sizeof(line) - len, "%s %lu ", SHORT_NAMES[i],
+                      static_cast<unsigned long>(totalsUs[i] / 1000));
+    }
+  }
+  if (len < static_cast<int>(sizeof(line))) {
+    snprintf(line + len, sizeof(line) - len, "= %lums", static_cast<unsigned long>(sumUs / 1000));
+  }
+
+  renderer.fillRect(x, y, width, renderer.getLineHeight(SMALL_FONT_ID), false);
+  renderer.drawText(SMALL_FONT_ID, x, y, renderer.truncatedText(SMALL_FONT_ID, line, width).c_str());
+}
+
+void PerfProfiler::logCpuResidency() {
+  const HalPowerManager::Residency residency = powerManager.getResidency();
+  LOG_INF("PRF", "CPU %dMHz=%lums (boosted %lums) %dMHz=%lums", residency.normalMhz,
+          static_cast<unsigned long>(residency.normalMs), static_cast<unsigned long>(residency.boostedMs),
+          HalPowerManager::LOW_POWER_FREQ, static_cast<unsigned long>(residency.lowPowerMs));
+}
+
+void PerfProfiler::dump(Print& out) {
+  const DumpHeader header = {DUMP_MAGIC, DUMP_VERSION, sizeof(Sample), PHASE_COUNT, static_cast<uint32_t>(count)};
+  out.printf("PERF_START:%u\n", static_cast<unsigned>(sizeof(header) + count * sizeof(Sample)));
+  out.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+  // Oldest first; the ring is at most two contiguous runs
+  const size_t oldest = (head + CAPACITY - count) % CAPACITY;
+  const size_t firstRun = count < CAPACITY - oldest ? count : CAPACITY - oldest;
+  out.write(reinterpret_cast<const uint8_t*>(&samples[oldest]), firstRun * sizeof(Sample));
+  out.write(reinterpret_cast<const uint8_t*>(&samples[0]), (count - firstRun) * sizeof(Sample));
+  out.printf("PERF_END\n");
+}
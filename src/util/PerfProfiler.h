@@ -0,0 +1,84 @@
+#pragma once
+#include <Print.h>
+
+#include <cstddef>
+#include <cstdint>
+
+class GfxRenderer;
+
+/**
+ * Fixed-size timing ring for the reader's render path. Samples are recorded by scoped timers and grouped by frame (one
+ * frame = one EpubReaderActivity::render), so the last frame's breakdown can be logged or drawn as an overlay, and a
+ * whole reading session can be dumped over serial with CMD:PERF (see scripts/debugging_monitor.py).
+ *
+ * No heap is used. Recording and reading both happen under RenderLock, which is what keeps the ring consistent.
+ */
+class PerfProfiler {
+ public:
+  enum Phase : uint8_t {
+    SECTION_LOAD,
+    PAGE_LOAD,
+    SCAN_PASS,
+    PREWARM,
+    BW_RENDER,
+    BW_DISPLAY,
+    BW_STORE,
+    GRAY_RENDER,
+    GRAY_DISPLAY,
+    BW_RESTORE,
+    INPUT_LATENCY,  // From the button press to the start of the display; overlaps the phases above
+    PHASE_COUNT
+  };
+
+  struct Sample {
+    uint16_t frame;
+    uint8_t phase;
+    uint8_t reserved;
+    uint32_t durationUs;
+  };
+  static_assert(sizeof(Sample) == 8, "Sample is part of the serial dump format");
+
+  static constexpr size_t CAPACITY = 512;  // 4KB, roughly 50 pages of history
+
+  // Records the time from construction until end() or destruction as one sample of the current frame
+  class Scope {
+    Phase phase;
+    uint32_t startUs;
+    bool active = true;
+
+   public:
+    explicit Scope(Phase phase);
+    ~Scope() { end(); }
+    void end();
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+  };
+
+  static void beginFrame();
+  static uint16_t currentFrame() { return frame; }
+  static void record(Phase phase, uint32_t durationUs);
+
+  // Sums the samples of a frame still in the ring, in microseconds; false if none are left
+  static bool frameTotals(uint16_t frameId, uint32_t (&totalsUs)[PHASE_COUNT]);
+  static void logFrame(uint16_t frameId);
+
+  static const char* phaseName(Phase phase);
+
+  static bool overlayEnabled() { return overlay; }
+  static void setOverlayEnabled(bool enabled) { overlay = enabled; }
+  // Draws the previous frame's breakdown (the current one is still being rendered) as a one-line strip at (x, y)
+  static void drawOverlay(GfxRenderer& renderer, int x, int y, int width);
+
+  // Logs the time the CPU spent at each frequency and boosted by HalPowerManager::Lock, since boot
+  static void logCpuResidency();
+
+  // Writes PERF_START:<size>, the binary dump (header followed by the samples, oldest first) and PERF_END
+  static void dump(Print& out);
+
+ private:
+  static Sample samples[CAPACITY];
+  static size_t head;
+  static size_t count;
+  static uint16_t frame;
+  static bool overlay;
+};
@@ -0,0 +1,325 @@
+#include "RenderBenchmark.h"
+
+#include <Arduino.h>
+#include <Bitmap.h>
+#include <FontCacheManager.h>
+#include <GfxRenderer.h>
+#include <HalStorage.h>
+#include <Logging.h>
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+#include <string>
+
+#include "RenderBenchmarkGolden.h"
+#include "components/icons/book24.h"
+#include "components/icons/folder.h"
+#include "components/icons/settings2.h"
+#include "components/themes/ChromeLayerCache.h"
+#include "fontIds.h"
+
+namespace {
+// Kerning pairs, ligatures, accented and typographic characters, all three reader styles
+constexpr const char* TEXT_LINES[] = {
+    "Waltz, bad nymph, for quick jigs vex.",
+    "AVATAR Toward LY fjord: “officially” fine.",
+    "Æsthetic façade, naïve café — déjà vu…",
+    "The quick brown fox jumps over the lazy dog",
+};
+constexpr EpdFontFamily::Style TEXT_STYLES[] = {EpdFontFamily::REGULAR, EpdFontFamily::BOLD, EpdFontFamily::ITALIC,
+                                                EpdFontFamily::BOLD_ITALIC};
+constexpr int TEXT_REPEATS = 4;
+
+constexpr int BITMAP_WIDTH = 240;
+constexpr int BITMAP_HEIGHT = 160;
+
+struct Context {
+  GfxRenderer& renderer;
+  std::string grayBitmapPath;
+  std::string monoBitmapPath;
+  ChromeLayerCache* chromeLayers;
+};
+
+struct Case {
+  const char* name;
+  GfxRenderer::Orientation orientation;
+  GfxRenderer::RenderMode mode;
+  void (*draw)(const Context& context);
+};
+
+void drawParagraphs(const Context& context) {
+  const GfxRenderer& renderer = context.renderer;
+  const int lineHeight = renderer.getLineHeight(BOOKERLY_14_FONT_ID);
+  int y = 20;
+  for (int repeat = 0; repeat < TEXT_REPEATS; repeat++) {
+    for (size_t i = 0; i < sizeof(TEXT_LINES) / sizeof(TEXT_LINES[0]); i++) {
+      renderer.drawText(BOOKERLY_14_FONT_ID, 10 + repeat * 3, y, TEXT_LINES[i], true, TEXT_STYLES[i]);
+      y += lineHeight;
+    }
+  }
+  renderer.drawText(UI_10_FONT_ID, 10, y, "Chapter 12 of 40 — 37%", true, EpdFontFamily::BOLD);
+}
+
+void drawRotatedText(const Context& context) {
+  const GfxRenderer& renderer = context.renderer;
+  for (int i = 0; i < 8; i++) {
+    renderer.drawTextRotated90CW(SMALL_FONT_ID, 10 + i * 40, 700, TEXT_LINES[i % 4]);
+    renderer.drawTextRotated90CW(UI_10_FONT_ID, 20 + i * 40, 400, "Previous page", i % 2 == 0);
+  }
+  // 2-bit glyphs, which the gray planes draw differently
+  renderer.drawTextRotated90CW(BOOKERLY_14_FONT_ID, 350, 780, TEXT_LINES[1], true, EpdFontFamily::ITALIC);
+}
+
+void drawBitmapFile(const Context& context, const std::string& path, const int maxWidth, const int maxHeight) {
+  FsFile file;
+  if (!Storage.openFileForRead("RBM", path, file)) {
+    return;
+  }
+  Bitmap bitmap(file);
+  if (bitmap.parseHeaders() == BmpReaderError::Ok) {
+    context.renderer.drawBitmap(bitmap, 30, 40, maxWidth, maxHeight);
+  }
+}
+
+void drawGrayBitmap(const Context& context) {
+  drawBitmapFile(context, context.grayBitmapPath, BITMAP_WIDTH, BITMAP_HEIGHT);
+}
+void drawGrayBitmapHalf(const Context& context) {
+  drawBitmapFile(context, context.grayBitmapPath, BITMAP_WIDTH / 2, BITMAP_HEIGHT / 2);
+}
+void drawGrayBitmapScaled(const Context& context) {
+  drawBitmapFile(context, context.grayBitmapPath, BITMAP_WIDTH * 2 / 3, BITMAP_HEIGHT * 2 / 3);
+}
+void drawMonoBitmap(const Context& context) {
+  drawBitmapFile(context, context.monoBitmapPath, BITMAP_WIDTH, BITMAP_HEIGHT);
+}
+
+void drawDitheredRects(const Context& context) {
+  const GfxRenderer& renderer = context.renderer;
+  constexpr Color COLORS[] = {LightGray, DarkGray, Black, White};
+  for (int i = 0; i < 12; i++) {
+    renderer.fillRectDither(7 + i * 31, 13 + i * 57, 300 - i * 7, 45 + i * 3, COLORS[i % 4]);
+  }
+}
+
+void drawRoundedRects(const Context& context) {
+  const GfxRenderer& renderer = context.renderer;
+  constexpr Color COLORS[] = {Black, LightGray, DarkGray};
+  constexpr int RADII[] = {0, 4, 9, 20};
+  for (int i = 0; i < 12; i++) {
+    renderer.fillRoundedRect(11 + i * 17, 9 + i * 61, 420 - i * 20, 50, RADII[i % 4], COLORS[i % 3]);
+  }
+  renderer.fillRoundedRect(40, 500, 200, 120, 16, true, false, false, true, DarkGray);
+}
+
+// Button hints as the themes draw them, from primitives or blitted from their layers; both leave the same frame
+constexpr const char* BUTTON_LABELS[] = {"« Back", "Select", "Previous", "Next"};
+
+void drawButtons(const Context& context, ChromeLayerCache* chromeLayers) {
+  const GfxRenderer& renderer = context.renderer;
+  constexpr int buttonWidth = 106;
+  constexpr int buttonHeight = 40;
+  for (int row = 0; row < 3; row++) {
+    for (int i = 0; i < 4; i++) {
+      const int x = 13 + i * 115;
+      const int y = 100 + row * 250;
+      const auto draw = [&]() {
+        renderer.fillRect(x, y, buttonWidth, buttonHeight, false);
+        renderer.drawRect(x, y, buttonWidth, buttonHeight);
+        const int textWidth = renderer.getTextWidth(UI_10_FONT_ID, BUTTON_LABELS[i]);
+        renderer.drawText(UI_10_FONT_ID, x + (buttonWidth - 1 - textWidth) / 2, y + 7, BUTTON_LABELS[i]);
+      };
+      if (chromeLayers) {
+        chromeLayers->draw(renderer, ChromeLayerCache::key(BUTTON_LABELS[i]), x, y, buttonWidth, buttonHeight, draw);
+      } else {
+        draw();
+      }
+    }
+  }
+}
+void drawButtonsDirect(const Context& context) { drawButtons(context, nullptr); }
+void drawButtonsLayered(const Context& context) { drawButtons(context, context.chromeLayers); }
+
+// Icons at every bit offset, blitted from their pre-rotated rows or plotted pixel by pixel from the unrotated one
+// (LandscapeCounterClockwise is the panel's own orientation); both leave the same frame
+void drawIcons(const Context& context, const bool plotted) {
+  const GfxRenderer& renderer = context.renderer;
+  constexpr struct {
+    const GfxRenderer::Icon* icon;
+    int size;
+  } ICONS[] = {{&FolderIcon, 32}, {&Book24Icon, 24}, {&Settings2Icon, 32}};
+  for (int i = 0; i < 24; i++) {
+    const auto& [icon, size] = ICONS[i % 3];
+    const int x = 5 + i % 6 * 71 + i % 8;
+    const int y = 9 + i / 6 * 97 + i % 5;
+    if (!plotted) {
+      renderer.drawIcon(*icon, x, y, size, size);
+      continue;
+    }
+    const uint8_t* bitmap = icon->bitmaps[GfxRenderer::LandscapeCounterClockwise];
+    const int rowBytes = (size + 7) / 8;
+    for (int row = 0; row < size; row++) {
+      for (int col = 0; col < size; col++) {
+        if (!(bitmap[row * rowBytes + col / 8] & 0x80 >> col % 8)) {
+          renderer.drawPixel(x + col, y + row, true);
+        }
+      }
+    }
+  }
+}
+void drawIconsBlitted(const Context& context) { drawIcons(context, false); }
+void drawIconsPlotted(const Context& context) { drawIcons(context, true); }
+
+#define ICON_CASES(suffix, orientation)                                         \
+  {"icons_" suffix, GfxRenderer::orientation, GfxRenderer::BW, drawIconsBlitted}, \
+      {"icons_plotted_" suffix, GfxRenderer::orientation, GfxRenderer::BW, drawIconsPlotted}
+
+// Text in each orientation and plane; the gray planes are drawn from the same glyph data as the reader's antialiasing
+// pass
+#define TEXT_CASES(suffix, orientation)                                                        \
+  {"text_bw_" suffix, GfxRenderer::orientation, GfxRenderer::BW, drawParagraphs},              \
+      {"text_lsb_" suffix, GfxRenderer::orientation, GfxRenderer::GRAYSCALE_LSB, drawParagraphs}, \
+      {"text_msb_" suffix, GfxRenderer::orientation, GfxRenderer::GRAYSCALE_MSB, drawParagraphs}
+
+const Case CASES[] = {
+    TEXT_CASES("portrait", Portrait),
+    TEXT_CASES("landscape_cw", LandscapeClockwise),
+    TEXT_CASES("portrait_inverted", PortraitInverted),
+    TEXT_CASES("landscape_ccw", LandscapeCounterClockwise),
+    {"text_rotated_90cw", GfxRenderer::Portrait, GfxRenderer::BW, drawRotatedText},
+    {"text_rotated_90cw_lsb", GfxRenderer::Portrait, GfxRenderer::GRAYSCALE_LSB, drawRotatedText},
+    {"text_rotated_90cw_msb", GfxRenderer::Portrait, GfxRenderer::GRAYSCALE_MSB, drawRotatedText},
+    {"bitmap_gray", GfxRenderer::Portrait, GfxRenderer::BW, drawGrayBitmap},
+    {"bitmap_gray_half", GfxRenderer::Portrait, GfxRenderer::BW, drawGrayBitmapHalf},
+    {"bitmap_gray_scaled", GfxRenderer::Portrait, GfxRenderer::BW, drawGrayBitmapScaled},
+    {"bitmap_gray_lsb", GfxRenderer::Portrait, GfxRenderer::GRAYSCALE_LSB, drawGrayBitmap},
+    {"bitmap_gray_landscape_cw", GfxRenderer::LandscapeClockwise, GfxRenderer::BW, drawGrayBitmap},
+    {"bitmap_mono", GfxRenderer::Portrait, GfxRenderer::BW, drawMonoBitmap},
+    {"fill_rect_dither", GfxRenderer::Portrait, GfxRenderer::BW, drawDitheredRects},
+    {"fill_rect_dither_landscape_ccw", GfxRenderer::LandscapeCounterClockwise, GfxRenderer::BW, drawDitheredRects},
+    {"fill_rounded_rect", GfxRenderer::Portrait, GfxRenderer::BW, drawRoundedRects},
+    {"button_hints", GfxRenderer::Portrait, GfxRenderer::BW, drawButtonsDirect},
+    {"button_hints_layered", GfxRenderer::Portrait, GfxRenderer::BW, drawButtonsLayered},
+    ICON_CASES("portrait", Portrait),
+    ICON_CASES("landscape_cw", LandscapeClockwise),
+    ICON_CASES("portrait_inverted", PortraitInverted),
+    ICON_CASES("landscape_ccw", LandscapeCounterClockwise),
+};
+
+#undef ICON_CASES
+#undef TEXT_CASES
+
+void writeLE(FsFile& file, const uint32_t value, const int bytes) {
+  for (int i = 0; i < bytes; i++) {
+    file.write(static_cast<uint8_t>(value >> (8 * i)));
+  }
+}
+
+// A bottom-up BMP of BITMAP_WIDTH x BITMAP_HEIGHT, 8 bit grayscale gradients or 1 bit rings
+bool writeBitmap(const std::string& path, const int bpp) {
+  FsFile file;
+  if (!Storage.openFileForWrite("RBM", path, file)) {
+    return false;
+  }
+  const uint32_t paletteSize = (1u << bpp) * 4;
+  const uint32_t rowBytes = (BITMAP_WIDTH * bpp + 31) / 32 * 4;
+  const uint32_t dataOffset = 14 + 40 + paletteSize;
+  file.write('B');
+  file.write('M');
+  writeLE(file, dataOffset + rowBytes * BITMAP_HEIGHT, 4);
+  writeLE(file, 0, 4);
+  writeLE(file, dataOffset, 4);
+  writeLE(file, 40, 4);
+  writeLE(file, BITMAP_WIDTH, 4);
+  writeLE(file, BITMAP_HEIGHT, 4);
+  writeLE(file, 1, 2);
+  writeLE(file, bpp, 2);
+  writeLE(file, 0, 4);
+  writeLE(file, rowBytes * BITMAP_HEIGHT, 4);
+  writeLE(file, 2835, 4);
+  writeLE(file, 2835, 4);
+  writeLE(file, 0, 4);
+  writeLE(file, 0, 4);
+  for (uint32_t i = 0; i < (1u << bpp); i++) {
+    const uint8_t level = bpp == 1 ? i * 255 : i;
+    writeLE(file, level | level << 8 | level << 16, 4);
+  }
+  uint8_t row[(BITMAP_WIDTH * 8 + 31) / 32 * 4];
+  for (int y = 0; y < BITMAP_HEIGHT; y++) {
+    memset(row, 0, sizeof(row));
+    for (int x = 0; x < BITMAP_WIDTH; x++) {
+      if (bpp == 8) {
+        row[x] = static_cast<uint8_t>((x * 255 / BITMAP_WIDTH + y * 3) & 0xFF);
+      } else {
+        const int dx = x - BITMAP_WIDTH / 2;
+        const int dy = y - BITMAP_HEIGHT / 2;
+        if ((dx * dx + dy * dy) / 300 % 2 == 0) {
+          row[x / 8] |= 0x80 >> (x % 8);
+        }
+      }
+    }
+    file.write(row, rowBytes);
+  }
+  file.close();
+  return true;
+}
+}  // namespace
+
+uint32_t RenderBenchmark::hashFrame(const GfxRenderer& renderer) {
+  const uint8_t* frame = renderer.getFrameBuffer();
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < renderer.getBufferSize(); i++) {
+    hash = (hash ^ frame[i]) * 16777619u;
+  }
+  return hash;
+}
+
+int RenderBenchmark::run(GfxRenderer& renderer, const char* scratchDir, const int repeat,
+                         const std::function<void(const Result&)>& report) {
+  ChromeLayerCache chromeLayers;
+  Context context{renderer, std::string(scratchDir) + "/render_bench_gray.bmp",
+                  std::string(scratchDir) + "/render_bench_mono.bmp", &chromeLayers};
+  if (!writeBitmap(context.grayBitmapPath, 8) || !writeBitmap(context.monoBitmapPath, 1)) {
+    LOG_ERR("RBM", "Could not write the bitmaps to %s", scratchDir);
+  }
+
+  const GfxRenderer::Orientation orientation = renderer.getOrientation();
+  const GfxRenderer::RenderMode mode = renderer.getRenderMode();
+  int failures = 0;
+  for (const Case& benchmarkCase : CASES) {
+    renderer.setOrientation(benchmarkCase.orientation);
+    Result result{benchmarkCase.name, 0, UINT32_MAX, 0, true};
+    // Glyphs come from the page buffer, as the reader draws a page: a scan pass and the prewarm, both untimed
+    std::optional<FontCacheManager::PrewarmScope> scope;
+    if (FontCacheManager* fcm = renderer.getFontCacheManager()) {
+      scope.emplace(fcm->createPrewarmScope());
+      benchmarkCase.draw(context);
+      scope->endScanAndPrewarm();
+    }
+    for (int i = 0; i < repeat; i++) {
+      // Gray planes start cleared, as the reader's antialiasing pass does
+      renderer.setRenderMode(GfxRenderer::BW);
+      renderer.clearScreen(benchmarkCase.mode == GfxRenderer::BW ? 0xFF : 0x00);
+      renderer.setRenderMode(benchmarkCase.mode);
+      const uint32_t start = micros();
+      benchmarkCase.draw(context);
+      result.bestUs = std::min(result.bestUs, static_cast<uint32_t>(micros() - start));
+    }
+    result.hash = hashFrame(renderer);
+    for (const auto& entry : RenderBenchmarkGolden::HASHES) {
+      if (strcmp(entry.name, benchmarkCase.name) == 0) {
+        result.golden = entry.hash;
+      }
+    }
+    result.ok = result.golden == 0 || result.golden == result.hash;
+    failures += result.ok ? 0 : 1;
+    report(result);
+  }
+  renderer.setOrientation(orientation);
+  renderer.setRenderMode(mode);
+
+  Storage.remove(context.grayBitmapPath.c_str());
+  Storage.remove(context.monoBitmapPath.c_str());
+  return failures;
+}
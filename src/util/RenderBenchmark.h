@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+
+class GfxRenderer;
+
+/**
+ * Timing and golden-frame checks of the GfxRenderer primitives: text in BW and in each gray plane in every
+ * orientation, rotated text, bitmaps, dithered and rounded fills. Each case prewarms the fonts it draws with, as the
+ * reader does for a page, then clears the frame buffer, draws, and is timed (the drawing only) over a number of
+ * repetitions; the frame it leaves is hashed and compared with the hash in RenderBenchmarkGolden.h, so an optimization
+ * of a drawing path can't change pixels unnoticed.
+ *
+ * Runs on the device (CMD:RENDERBENCH over serial) and on the host (test/run_render_benchmark.sh, which also
+ * regenerates the golden hashes). Both draw with the fonts main.cpp registers under BOOKERLY_14_FONT_ID, UI_10_FONT_ID
+ * and SMALL_FONT_ID.
+ */
+class RenderBenchmark {
+ public:
+  struct Result {
+    const char* name;
+    uint32_t hash;
+    uint32_t bestUs;    // Fastest repetition
+    uint32_t golden;    // 0 if the case has no golden hash yet
+    bool ok;            // Drawn and matching its golden hash, if any
+  };
+
+  // Runs every case, calling report after each one with its frame still in the frame buffer. The bitmap inputs are
+  // written to scratchDir and removed afterwards; the orientation and render mode are restored. The frame buffer is
+  // left holding the last case, the caller redraws the screen. Returns the number of cases that failed.
+  static int run(GfxRenderer& renderer, const char* scratchDir, int repeat,
+                 const std::function<void(const Result&)>& report);
+
+  // FNV-1a of the frame buffer
+  static uint32_t hashFrame(const GfxRenderer& renderer);
+};
@@ -0,0 +1,47 @@
+// Generated by test/run_render_benchmark.sh --update: the frame each RenderBenchmark case has to leave
+#pragma once
+#include <cstdint>
+
+namespace RenderBenchmarkGolden {
+struct Entry {
+  const char* name;
+  uint32_t hash;
+};
+
+constexpr Entry HASHES[] = {
+    {"text_bw_portrait", 0x24745973},
+    {"text_lsb_portrait", 0xA49D5133},
+    {"text_msb_portrait", 0x65AD9CB7},
+    {"text_bw_landscape_cw", 0xCD37E695},
+    {"text_lsb_landscape_cw", 0x476C1754},
+    {"text_msb_landscape_cw", 0x9DED26CB},
+    {"text_bw_portrait_inverted", 0x8C698844},
+    {"text_lsb_portrait_inverted", 0x0A24FF95},
+    {"text_msb_portrait_inverted", 0xA2EB2252},
+    {"text_bw_landscape_ccw", 0x13689140},
+    {"text_lsb_landscape_ccw", 0x6D94BF0D},
+    {"text_msb_landscape_ccw", 0xEE5C9F3B},
+    {"text_rotated_90cw", 0xE3B6DDED},
+    {"text_rotated_90cw_lsb", 0x0B565076},
+    {"text_rotated_90cw_msb", 0xADF651D9},
+    {"bitmap_gray", 0x86AE5F04},
+    {"bitmap_gray_half", 0x03CA9966},
+    {"bitmap_gray_scaled", 0xADFFE769},
+    {"bitmap_gray_lsb", 0x89249788},
+    {"bitmap_gray_landscape_cw", 0xAE3DEA4F},
+    {"bitmap_mono", 0x2DD116ED},
+    {"fill_rect_dither", 0x84E74339},
+    {"fill_rect_dither_landscape_ccw", 0x083110D7},
+    {"fill_rounded_rect", 0xF7895594},
+    {"button_hints", 0x2B2DD632},
+    {"button_hints_layered", 0x2B2DD632},
+    {"icons_portrait", 0xE42A3AE3},
+    {"icons_plotted_portrait", 0xE42A3AE3},
+    {"icons_landscape_cw", 0xCBB8308D},
+    {"icons_plotted_landscape_cw", 0xCBB8308D},
+    {"icons_portrait_inverted", 0xDD0FA9A0},
+    {"icons_plotted_portrait_inverted", 0xDD0FA9A0},
+    {"icons_landscape_ccw", 0x0FCA1499},
+    {"icons_plotted_landscape_ccw", 0x0FCA1499},
+};
+}  // namespace RenderBenchmarkGolden
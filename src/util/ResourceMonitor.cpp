@@ -0,0 +1,142 @@
+#include "ResourceMonitor.h"
+
+#include <Arduino.h>
+#include <GfxRenderer.h>
+#include <Logging.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <cstdio>
+#include <cstring>
+
+#include "fontIds.h"
+
+namespace {
+// From reset until the first activity is entered
+constexpr char BOOT_ACTIVITY[] = "Boot";
+constexpr char OTHER_ACTIVITY[] = "Other";
+// uxTaskGetSystemState() returns nothing unless there's room for every task
+constexpr UBaseType_t MAX_SYSTEM_TASKS = 24;
+constexpr int OVERLAY_TASKS = 3;
+}  // namespace
+
+ResourceMonitor::TaskPeak ResourceMonitor::tasks[MAX_TASKS] = {};
+size_t ResourceMonitor::taskCount = 0;
+ResourceMonitor::ActivityPeak ResourceMonitor::activities[MAX_ACTIVITIES] = {};
+size_t ResourceMonitor::activityCount = 0;
+uint8_t ResourceMonitor::current = 0;
+uint32_t ResourceMonitor::lastMinFreeHeap = UINT32_MAX;
+unsigned long ResourceMonitor::lastSampleMs = 0;
+
+uint8_t ResourceMonitor::activityFor(const char* name) {
+  for (size_t i = 0; i < activityCount; i++) {
+    if (strncmp(activities[i].name, name, NAME_LENGTH - 1) == 0) {
+      return i;
+    }
+  }
+  if (activityCount == MAX_ACTIVITIES) {
+    return MAX_ACTIVITIES - 1;
+  }
+  ActivityPeak& activity = activities[activityCount];
+  activity = {};
+  strncpy(activity.name, activityCount == MAX_ACTIVITIES - 1 ? OTHER_ACTIVITY : name, NAME_LENGTH - 1);
+  return activityCount++;
+}
+
+void ResourceMonitor::sampleNow() {
+  lastSampleMs = millis();
+  if (activityCount == 0) {
+    current = activityFor(BOOT_ACTIVITY);
+  }
+  ActivityPeak& activity = activities[current];
+
+  const uint32_t minFreeHeap = ESP.getMinFreeHeap();
+  if (minFreeHeap < lastMinFreeHeap) {
+    activity.minFreeHeap = minFreeHeap;
+    lastMinFreeHeap = minFreeHeap;
+  }
+  const uint32_t largestBlock = ESP.getMaxAllocHeap();
+  if (activity.minLargestBlock == 0 || largestBlock < activity.minLargestBlock) {
+    activity.minLargestBlock = largestBlock;
+  }
+
+#if configUSE_TRACE_FACILITY
+  // Static: on the loop task's stack it would count against the loop task's own watermark
+  static TaskStatus_t statuses[MAX_SYSTEM_TASKS];
+  const UBaseType_t count = uxTaskGetSystemState(statuses, MAX_SYSTEM_TASKS, nullptr);
+  for (UBaseType_t i = 0; i < count; i++) {
+    const uint32_t freeStack = statuses[i].usStackHighWaterMark;  // Bytes: ESP-IDF stacks are counted in bytes
+    size_t t = 0;
+    while (t < taskCount && strncmp(tasks[t].name, statuses[i].pcTaskName, NAME_LENGTH - 1) != 0) {
+      t++;
+    }
+    if (t == taskCount) {
+      if (taskCount == MAX_TASKS) {
+        continue;
+      }
+      tasks[t] = {};
+      strncpy(tasks[t].name, statuses[i].pcTaskName, NAME_LENGTH - 1);
+      tasks[t].minFreeStack = UINT32_MAX;
+      taskCount++;
+    }
+    if (freeStack < tasks[t].minFreeStack) {
+      tasks[t].minFreeStack = freeStack;
+      tasks[t].activity = current;
+    }
+  }
+#endif
+}
+
+void ResourceMonitor::enter(const char* name) {
+  sampleNow();
+  current = activityFor(name);
+}
+
+void ResourceMonitor::sample() {
+  if (millis() - lastSampleMs >= SAMPLE_INTERVAL_MS) {
+    sampleNow();
+  }
+}
+
+void ResourceMonitor::log() {
+  LOG_INF("MON", "Heap free %lu, min free %lu, largest block %lu", static_cast<unsigned long>(ESP.getFreeHeap()),
+          static_cast<unsigned long>(ESP.getMinFreeHeap()), static_cast<unsigned long>(ESP.getMaxAllocHeap()));
+  for (size_t i = 0; i < activityCount; i++) {
+    const ActivityPeak& activity = activities[i];
+    LOG_INF("MON", "%-20s heap min %7lu  largest block min %7lu", activity.name,
+            static_cast<unsigned long>(activity.minFreeHeap), static_cast<unsigned long>(activity.minLargestBlock));
+  }
+  for (size_t i = 0; i < taskCount; i++) {
+    const TaskPeak& task = tasks[i];
+    LOG_INF("MON", "%-20s stack min free %6lu  (in %s)", task.name, static_cast<unsigned long>(task.minFreeStack),
+            activities[task.activity].name);
+  }
+}
+
+void ResourceMonitor::drawOverlay(GfxRenderer& renderer, const int x, const int y, const int width) {
+  char line[160];
+  int len = snprintf(line, sizeof(line), "heap %luK min %luK blk %luK ",
+                     static_cast<unsigned long>(ESP.getFreeHeap() / 1024),
+                     static_cast<unsigned long>(ESP.getMinFreeHeap() / 1024),
+                     static_cast<unsigned long>(ESP.getMaxAllocHeap() / 1024));
+
+  // The tightest stacks, least free first
+  bool shown[MAX_TASKS] = {};
+  for (int n = 0; n < OVERLAY_TASKS && len < static_cast<int>(sizeof(line)); n++) {
+    int tightest = -1;
+    for (size_t i = 0; i < taskCount; i++) {
+      if (!shown[i] && (tightest < 0 || tasks[i].minFreeStack < tasks[tightest].minFreeStack)) {
+        tightest = i;
+      }
+    }
+    if (tightest < 0) {
+      break;
+    }
+    shown[tightest] = true;
+    len += snprintf(line + len, sizeof(line) - len, "%.8s %lu ", tasks[tightest].name,
+                    static_cast<unsigned long>(tasks[tightest].minFreeStack));
+  }
+
+  renderer.fillRect(x, y, width, renderer.getLineHeight(SMALL_FONT_ID), false);
+  renderer.drawText(SMALL_FONT_ID, x, y, renderer.truncatedText(SMALL_FONT_ID, line, width).c_str());
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+class GfxRenderer;
+
+/**
+ * Stack and heap low-water marks, to size task stacks and cache budgets from measurements. Every task's stack
+ * high-water mark (its least free stack so far) and the heap's minimum free size are watermarks kept by FreeRTOS and
+ * the allocator, so sampling them once a second still catches the deepest point; whenever one drops, the drop is
+ * charged to the activity on screen. The largest free block has no watermark and is only sampled.
+ *
+ * The activity manager calls enter() as activities change and the main loop calls sample() every pass. The peaks are
+ * logged with CMD:PERF and the current figures drawn under the reader's perf overlay.
+ *
+ * No heap is used. Only the main loop writes; the overlay reads whole words, and names are written before they are
+ * counted.
+ */
+class ResourceMonitor {
+ public:
+  static constexpr size_t MAX_TASKS = 16;
+  static constexpr size_t MAX_ACTIVITIES = 16;  // The last one takes all activities past it, as "Other"
+  static constexpr size_t NAME_LENGTH = 20;
+  static constexpr unsigned long SAMPLE_INTERVAL_MS = 1000;
+
+  struct TaskPeak {
+    char name[NAME_LENGTH];
+    uint32_t minFreeStack;  // Bytes
+    uint8_t activity;       // Where minFreeStack was reached
+  };
+
+  struct ActivityPeak {
+    char name[NAME_LENGTH];
+    uint32_t minFreeHeap;  // 0 if the heap's minimum never dropped while it was on screen
+    uint32_t minLargestBlock;
+  };
+
+  // Samples, so what happened until now is charged to the outgoing activity, then makes name the current one
+  static void enter(const char* name);
+  // Samples if SAMPLE_INTERVAL_MS have passed
+  static void sample();
+
+  // Logs the peaks by activity and by task
+  static void log();
+  // Draws free heap, largest block and the three tightest stacks as a one-line strip at (x, y)
+  static void drawOverlay(GfxRenderer& renderer, int x, int y, int width);
+
+ private:
+  static TaskPeak tasks[MAX_TASKS];
+  static size_t taskCount;
+  static ActivityPeak activities[MAX_ACTIVITIES];
+  static size_t activityCount;
+  static uint8_t current;
+  static uint32_t lastMinFreeHeap;
+  static unsigned long lastSampleMs;
+
+  static uint8_t activityFor(const char* name);
+  static void sampleNow();
+};
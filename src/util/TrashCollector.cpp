@@ -0,0 +1,30 @@
+#include "TrashCollector.h"
+
+#include <HalStorage.h>
+#include <Logging.h>
+
+namespace {
+// Files and directories deleted per batch, and the pauses between batches and after stepping aside
+constexpr int ENTRIES_PER_BATCH = 8;
+constexpr unsigned long BATCH_PAUSE_MS = 20;
+constexpr unsigned long YIELD_PAUSE_MS = 500;
+}  // namespace
+
+void TrashCollector::run() {
+  LOG_DBG("TRC", "Emptying the trash");
+  while (!stopRequested()) {
+    if (shouldYield()) {
+      if (!sleepFor(YIELD_PAUSE_MS)) {
+        return;
+      }
+      continue;
+    }
+    if (Storage.removeTrash(ENTRIES_PER_BATCH)) {
+      LOG_DBG("TRC", "Trash emptied");
+      return;
+    }
+    if (!sleepFor(BATCH_PAUSE_MS)) {
+      return;
+    }
+  }
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "activities/Worker.h"
+
+/**
+ * Deletes the directories discarded into the trash by HalStorage::discardDir() in the background, a few files at a
+ * time, so clearing a cache never waits for its files to be deleted. Runs at idle priority like every worker and
+ * steps aside while another task waits for the card. Owned by the main loop, which starts it whenever there is trash
+ * and stops it before deep sleep.
+ */
+class TrashCollector final : public Worker {
+ protected:
+  void run() override;
+
+ public:
+  static constexpr uint32_t STACK_SIZE = 4096;
+
+  TrashCollector() : Worker("TrashCollector") {}
+  ~TrashCollector() override { stop(); }
+};
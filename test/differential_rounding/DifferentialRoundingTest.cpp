@@ -94,6 +94,16 @@ static const EpdFontData kTestFontData = {
   .kernRightClassCount = 2,
   .ligaturePairs     = nullptr,
   .ligaturePairCount = 0,
+  .glyphLookup       = nullptr,
+  .glyphLookupSize   = 0,
+  .kernLeftLookup    = nullptr,
+  .kernRightLookup   = nullptr,
+  .kernLookupSize    = 0,
+  .ligatureStarts    = nullptr,
+  .ligatureStartsSize = 0,
+  .glyphCount        = 4,
+  .readBitmap        = nullptr,
+  .readContext       = nullptr,
 };
 // clang-format on
 
@@ -0,0 +1,435 @@
+// Host benchmark of the chapter layout pipeline: ChapterHtmlSlimParser -> ParsedText -> Page::serializeRecord,
+// measuring text with the real GfxRenderer and built-in fonts. Reports time, allocations, peak heap and the size of the
+// page records written per chapter. Linux only, for the heap accounting.
+//
+// Usage: LayoutBenchmark [--hyphenation] [--language TAG] [--repeat N] [--out DIR]
+//                        [--render] [--frames DIR] [--input FILE] [--cpu-scale X] <chapter dir or file>...
+// A directory stands for an unpacked EPUB: every .xhtml/.html/.htm file in it is a chapter, styled with every .css
+// file in it. run_layout_benchmark.sh unpacks test/epubs (or the EPUBs given to it) and runs this on each.
+//
+// --render also turns the pages of every chapter as the reader does: each page record is read back, drawn and
+// displayed through the host HAL (HostEmulator.h), which counts refreshes and SD traffic for an estimate of the time
+// the device would take. --frames writes every displayed frame as a PNG, --input replays button presses instead of
+// turning every page (Right/Down next, Left/Up previous, Back ends the chapter), --cpu-scale sets how much slower than
+// the host the device computes.
+
+#include <FontCacheManager.h>
+#include <FontDecompressor.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <HalGPIO.h>
+#include <HalStorage.h>
+#include <malloc.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "Epub/Page.h"
+#include "Epub/css/CssParser.h"
+#include "Epub/hyphenation/Hyphenator.h"
+#include "Epub/parsers/ChapterHtmlSlimParser.h"
+#include "HostEmulator.h"
+#include "builtinFonts/bookerly_14_bold.h"
+#include "builtinFonts/bookerly_14_bolditalic.h"
+#include "builtinFonts/bookerly_14_italic.h"
+#include "builtinFonts/bookerly_14_regular.h"
+
+// ============================================================================
+// Heap accounting: malloc and friends are replaced (glibc lets a program do so), and operator new goes through them,
+// so expat's and the font decompressor's buffers count as well as the C++ allocations.
+// ============================================================================
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+void __libc_free(void* ptr);
+}
+
+namespace {
+
+struct HeapStats {
+  size_t allocations = 0;
+  size_t current = 0;
+  size_t peak = 0;
+};
+HeapStats heap;
+
+void* track(void* ptr) {
+  if (ptr) {
+    heap.allocations++;
+    heap.current += malloc_usable_size(ptr);
+    heap.peak = std::max(heap.peak, heap.current);
+  }
+  return ptr;
+}
+
+void untrack(void* ptr) {
+  if (ptr) {
+    heap.current -= malloc_usable_size(ptr);
+  }
+}
+
+}  // namespace
+
+extern "C" {
+void* malloc(const size_t size) { return track(__libc_malloc(size)); }
+void* calloc(const size_t count, const size_t size) { return track(__libc_calloc(count, size)); }
+void* realloc(void* ptr, const size_t size) {
+  untrack(ptr);
+  void* moved = __libc_realloc(ptr, size);
+  if (!moved && size > 0) {
+    track(ptr);  // Failed, the old block is still there
+    return nullptr;
+  }
+  return track(moved);
+}
+void* memalign(const size_t alignment, const size_t size) { return track(__libc_memalign(alignment, size)); }
+void* aligned_alloc(const size_t alignment, const size_t size) { return memalign(alignment, size); }
+int posix_memalign(void** out, const size_t alignment, const size_t size) {
+  *out = memalign(alignment, size);
+  return *out ? 0 : ENOMEM;
+}
+void free(void* ptr) {
+  untrack(ptr);
+  __libc_free(ptr);
+}
+}
+
+void* operator new(const size_t size) {
+  void* ptr = malloc(size);
+  if (!ptr) {
+    abort();  // Built without exceptions, like the firmware
+  }
+  return ptr;
+}
+void* operator new[](const size_t size) { return operator new(size); }
+void* operator new(const size_t size, const std::nothrow_t&) noexcept { return malloc(size); }
+void* operator new[](const size_t size, const std::nothrow_t&) noexcept { return malloc(size); }
+void operator delete(void* ptr) noexcept { free(ptr); }
+void operator delete[](void* ptr) noexcept { free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { free(ptr); }
+
+// ============================================================================
+// Benchmark
+// ============================================================================
+
+namespace {
+
+constexpr int FONT_ID = 1;
+// Portrait screen less the reader's default margins
+constexpr uint16_t VIEWPORT_WIDTH = 464;
+constexpr uint16_t VIEWPORT_HEIGHT = 760;
+constexpr int MARGIN_LEFT = 8;
+constexpr int MARGIN_TOP = 20;
+// The reader's default refresh frequency
+constexpr int FULL_REFRESH_PAGES = 15;
+
+EpdFont regularFont(&bookerly_14_regular);
+EpdFont boldFont(&bookerly_14_bold);
+EpdFont italicFont(&bookerly_14_italic);
+EpdFont boldItalicFont(&bookerly_14_bolditalic);
+EpdFontFamily fontFamily(&regularFont, &boldFont, &italicFont, &boldItalicFont);
+
+struct Options {
+  bool hyphenation = false;
+  std::string language = "en";
+  int repeat = 1;
+  std::string outDir = std::filesystem::temp_directory_path().string();
+  bool render = false;
+  std::string framesDir;
+  std::string inputScript;
+  std::vector<std::string> inputs;
+};
+
+struct ChapterResult {
+  size_t bytes = 0;
+  int pages = 0;
+  size_t recordBytes = 0;
+  double seconds = 0;  // Fastest of the repeats
+  size_t allocations = 0;
+  size_t peakHeap = 0;  // Above what was allocated before the chapter started
+  // --render: pages displayed, the host time it took and what the HAL counted
+  int pagesShown = 0;
+  double renderSeconds = 0;
+  HostEmulator::Stats renderStats;
+  bool ok = true;
+};
+
+bool isChapter(const std::filesystem::path& path) {
+  const std::string ext = path.extension().string();
+  return ext == ".xhtml" || ext == ".html" || ext == ".htm";
+}
+
+// Turns the pages of a laid out chapter as the reader does, from the record at each offset (the last one being the
+// end of the records), or as the input script says
+void renderChapter(GfxRenderer& renderer, const std::string& pagesPath, const std::vector<uint32_t>& recordOffsets,
+                   const Options& options, ChapterResult& result) {
+  HostEmulator::resetStats();
+  const auto start = std::chrono::steady_clock::now();
+  FsFile pagesFile;
+  if (!Storage.openFileForRead("LBM", pagesPath, pagesFile)) {
+    result.ok = false;
+    return;
+  }
+  if (!options.inputScript.empty() && !HostEmulator::loadInputScript(options.inputScript)) {
+    result.ok = false;
+    return;
+  }
+  const int pageCount = static_cast<int>(recordOffsets.size()) - 1;
+  int shownPage = -1;
+  int page = 0;
+  while (page >= 0 && page < pageCount) {
+    if (page != shownPage) {
+      std::unique_ptr<Page> loaded;
+      if (pagesFile.seekSet(recordOffsets[page])) {
+        loaded = Page::deserialize(pagesFile, recordOffsets[page + 1] - recordOffsets[page]);
+      }
+      if (!loaded) {
+        result.ok = false;
+        break;
+      }
+      renderer.clearScreen();
+      // Font prewarm as the reader does it: a scan pass collects the glyphs, then the real render
+      auto scope = renderer.getFontCacheManager()->createPrewarmScope();
+      loaded->render(renderer, FONT_ID, MARGIN_LEFT, MARGIN_TOP);
+      scope.endScanAndPrewarm();
+      loaded->render(renderer, FONT_ID, MARGIN_LEFT, MARGIN_TOP);
+      renderer.displayPage(FULL_REFRESH_PAGES);
+      shownPage = page;
+      result.pagesShown++;
+    }
+    if (options.inputScript.empty()) {
+      page++;
+      continue;
+    }
+    if (!HostEmulator::hasScriptedInput()) {
+      break;
+    }
+    gpio.update();
+    if (gpio.wasReleased(HalGPIO::BTN_BACK)) {
+      break;
+    } else if (gpio.wasReleased(HalGPIO::BTN_RIGHT) || gpio.wasReleased(HalGPIO::BTN_DOWN)) {
+      page = std::min(page + 1, pageCount - 1);
+    } else if (gpio.wasReleased(HalGPIO::BTN_LEFT) || gpio.wasReleased(HalGPIO::BTN_UP)) {
+      page = std::max(page - 1, 0);
+    }
+  }
+  result.renderSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  result.renderStats = HostEmulator::stats();
+}
+
+ChapterResult layOutChapter(GfxRenderer& renderer, const std::string& chapterPath, const CssParser* css,
+                            const Options& options) {
+  ChapterResult result;
+  result.bytes = std::filesystem::file_size(chapterPath);
+  const std::string pagesPath = options.outDir + "/layout_benchmark_pages.bin";
+  const std::string imageBasePath = options.outDir + "/layout_benchmark_img_";
+  const size_t lastSlash = chapterPath.find_last_of('/');
+  const std::string contentBase = lastSlash != std::string::npos ? chapterPath.substr(0, lastSlash + 1) : "";
+  std::vector<uint32_t> recordOffsets;
+
+  for (int run = 0; run < options.repeat; run++) {
+    FsFile pagesFile;
+    if (!Storage.openFileForWrite("LBM", pagesPath, pagesFile)) {
+      fprintf(stderr, "Can't write %s\n", pagesPath.c_str());
+      result.ok = false;
+      return result;
+    }
+
+    const HeapStats before = heap;
+    heap.peak = heap.current;
+    int pages = 0;
+    bool serialized = true;
+    recordOffsets.clear();
+    const auto start = std::chrono::steady_clock::now();
+    {
+      BufferedFileWriter pagesWriter(pagesFile, 4096);
+      std::unique_ptr<PageRecordScratch> recordScratch;
+      if (SECTION_RECORD_COMPRESSION) {
+        recordScratch.reset(new PageRecordScratch());
+      }
+      ChapterHtmlSlimParser parser(
+          nullptr, chapterPath, renderer, FONT_ID, 1.0f, true, static_cast<uint8_t>(CssTextAlign::Justify),
+          VIEWPORT_WIDTH, VIEWPORT_HEIGHT, options.hyphenation,
+          [&](std::unique_ptr<Page> page) {
+            if (options.render) {
+              recordOffsets.push_back(pagesWriter.position());
+            }
+            serialized = page->serializeRecord(pagesWriter, recordScratch.get(), &renderer, FONT_ID) && serialized;
+            pages++;
+          },
+          css != nullptr, contentBase, imageBasePath, 0, nullptr, css);
+      result.ok = parser.parseAndBuildPages() && serialized && pagesWriter.flush();
+      result.recordBytes = pagesWriter.position();
+      recordOffsets.push_back(pagesWriter.position());
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (run == 0 || seconds < result.seconds) {
+      result.seconds = seconds;
+    }
+    result.pages = pages;
+    result.allocations = heap.allocations - before.allocations;
+    result.peakHeap = heap.peak - before.current;
+    pagesFile.close();
+  }
+  if (options.render && result.ok) {
+    renderChapter(renderer, pagesPath, recordOffsets, options, result);
+  }
+  Storage.remove(pagesPath.c_str());
+  return result;
+}
+
+// The chapters of an input path, and the CSS files styling them
+void collectInput(const std::string& input, std::vector<std::string>& chapters, std::vector<std::string>& cssFiles) {
+  if (!std::filesystem::is_directory(input)) {
+    chapters.push_back(input);
+    return;
+  }
+  for (const auto& entry : std::filesystem::recursive_directory_iterator(input)) {
+    if (!entry.is_regular_file()) continue;
+    if (isChapter(entry.path())) {
+      chapters.push_back(entry.path().string());
+    } else if (entry.path().extension() == ".css") {
+      cssFiles.push_back(entry.path().string());
+    }
+  }
+  std::sort(chapters.begin(), chapters.end());
+  std::sort(cssFiles.begin(), cssFiles.end());
+}
+
+bool parseOptions(const int argc, char* argv[], Options& options) {
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if (arg == "--hyphenation") {
+      options.hyphenation = true;
+    } else if (arg == "--language" && i + 1 < argc) {
+      options.language = argv[++i];
+    } else if (arg == "--repeat" && i + 1 < argc) {
+      options.repeat = std::max(1, atoi(argv[++i]));
+    } else if (arg == "--out" && i + 1 < argc) {
+      options.outDir = argv[++i];
+    } else if (arg == "--render") {
+      options.render = true;
+    } else if (arg == "--frames" && i + 1 < argc) {
+      options.framesDir = argv[++i];
+      options.render = true;
+    } else if (arg == "--input" && i + 1 < argc) {
+      options.inputScript = argv[++i];
+      options.render = true;
+    } else if (arg == "--cpu-scale" && i + 1 < argc) {
+      HostEmulator::costModel().cpuScale = atof(argv[++i]);
+    } else if (arg.rfind("--", 0) == 0) {
+      return false;
+    } else {
+      options.inputs.push_back(arg);
+    }
+  }
+  return !options.inputs.empty();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    fprintf(stderr,
+            "Usage: %s [--hyphenation] [--language TAG] [--repeat N] [--out DIR]\n"
+            "       [--render] [--frames DIR] [--input FILE] [--cpu-scale X] <chapter dir or file>...\n",
+            argv[0]);
+    return 2;
+  }
+
+  GfxRenderer renderer(display);
+  renderer.insertFont(FONT_ID, fontFamily);
+  FontDecompressor fontDecompressor;
+  FontCacheManager fontCacheManager(renderer.getFontMap());
+  if (options.render) {
+    renderer.begin();
+    fontDecompressor.init();
+    fontCacheManager.setFontDecompressor(&fontDecompressor);
+    renderer.setFontCacheManager(&fontCacheManager);
+    if (!options.framesDir.empty()) {
+      std::filesystem::create_directories(options.framesDir);
+      HostEmulator::setFrameDumpDir(options.framesDir);
+    }
+  }
+  Hyphenator::setPreferredLanguage(options.language);
+
+  printf("%-48s %8s %6s %9s %9s %9s %9s %9s\n", "chapter", "KB", "pages", "ms", "pages/s", "allocs", "peak KB",
+         "pages KB");
+  ChapterResult total;
+  int failures = 0;
+  for (const auto& input : options.inputs) {
+    std::vector<std::string> chapters;
+    std::vector<std::string> cssFiles;
+    collectInput(input, chapters, cssFiles);
+
+    std::unique_ptr<CssParser> css;
+    if (!cssFiles.empty()) {
+      const std::string cssCacheDir = options.outDir + "/layout_benchmark_css";
+      std::filesystem::create_directories(cssCacheDir);
+      css.reset(new CssParser(cssCacheDir));
+      for (const auto& cssPath : cssFiles) {
+        FsFile cssFile;
+        if (Storage.openFileForRead("LBM", cssPath, cssFile)) {
+          css->loadFromStream(cssFile);
+        }
+      }
+      // Styles are resolved from the compiled cache, as Section does on device
+      if (!css->saveToCache() || !css->loadFromCache()) {
+        fprintf(stderr, "Could not compile CSS of %s\n", input.c_str());
+      }
+    }
+
+    for (const auto& chapter : chapters) {
+      const ChapterResult result = layOutChapter(renderer, chapter, css.get(), options);
+      std::string name = std::filesystem::relative(chapter, std::filesystem::path(input).parent_path()).string();
+      if (name.size() > 48) {
+        name = "..." + name.substr(name.size() - 45);
+      }
+      printf("%-48s %8.1f %6d %9.2f %9.0f %9zu %9.1f %9.1f%s\n", name.c_str(), result.bytes / 1024.0, result.pages,
+             result.seconds * 1000, result.seconds > 0 ? result.pages / result.seconds : 0.0, result.allocations,
+             result.peakHeap / 1024.0, result.recordBytes / 1024.0, result.ok ? "" : "  FAILED");
+      total.bytes += result.bytes;
+      total.pages += result.pages;
+      total.recordBytes += result.recordBytes;
+      total.seconds += result.seconds;
+      total.allocations += result.allocations;
+      total.peakHeap = std::max(total.peakHeap, result.peakHeap);
+      failures += result.ok ? 0 : 1;
+      if (options.render) {
+        const HostEmulator::Stats& stats = result.renderStats;
+        const double hostMs = result.renderSeconds * 1000;
+        printf("  rendered %d pages in %.2f ms (%.2f ms/page), %u half + %u fast refreshes, %.1f KB read;"
+               " device estimate %.0f ms\n",
+               result.pagesShown, hostMs, result.pagesShown > 0 ? hostMs / result.pagesShown : 0.0,
+               static_cast<unsigned>(stats.halfRefreshes), static_cast<unsigned>(stats.fastRefreshes),
+               stats.bytesRead / 1024.0, HostEmulator::estimateDeviceMs(stats, hostMs));
+        total.pagesShown += result.pagesShown;
+        total.renderSeconds += result.renderSeconds;
+      }
+    }
+  }
+  printf("%-48s %8.1f %6d %9.2f %9.0f %9zu %9.1f %9.1f\n", "total", total.bytes / 1024.0, total.pages,
+         total.seconds * 1000, total.seconds > 0 ? total.pages / total.seconds : 0.0, total.allocations,
+         total.peakHeap / 1024.0, total.recordBytes / 1024.0);
+  if (options.render) {
+    printf("rendered %d pages in %.2f ms\n", total.pagesShown, total.renderSeconds * 1000);
+  }
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+// Host stand-ins for the parts of the Arduino core the layout pipeline uses. Implemented in HostPlatform.cpp.
+
+#include <HardwareSerial.h>
+#include <Print.h>
+#include <WString.h>
+
+// The Arduino core pulls these in for every sketch, so the sources rely on them
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+struct EspClass {
+  uint32_t getFreeHeap();
+  uint32_t getMaxAllocHeap();
+};
+extern EspClass ESP;
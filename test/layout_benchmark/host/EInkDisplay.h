@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+
+// Panel geometry only; HostPlatform.cpp implements HalDisplay over a plain frame buffer
+class EInkDisplay {
+ public:
+  static constexpr uint16_t DISPLAY_WIDTH = 800;
+  static constexpr uint16_t DISPLAY_HEIGHT = 480;
+};
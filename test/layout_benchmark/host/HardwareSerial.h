@@ -0,0 +1,15 @@
+#pragma once
+
+#include <Print.h>
+
+// Logging goes to stderr
+class HWCDC : public Stream {
+ public:
+  size_t write(uint8_t b) override;
+  using Print::write;
+  void begin(unsigned long) {}
+  operator bool() const { return true; }
+  int available() override { return 0; }
+  int read() override { return -1; }
+};
+extern HWCDC Serial;
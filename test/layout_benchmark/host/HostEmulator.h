@@ -0,0 +1,63 @@
+#pragma once
+
+// Control of the host HAL in HostPlatform.cpp, for benchmarks that run the firmware's libraries on a PC:
+// - a directory standing for the SD card
+// - the frame buffer written out as PNG images at every refresh
+// - button presses read from a script
+// - counters of what the HAL was asked to do, and a cost model turning them into an estimate of the time the device
+//   would take
+//
+// Host time is not device time: the estimate scales the host CPU time by cpuScale and adds the modeled cost of panel
+// refreshes and SD card accesses. The defaults are rough; calibrate them against PerfProfiler numbers from a device
+// before comparing estimates with measurements.
+
+#include <cstdint>
+#include <string>
+
+namespace HostEmulator {
+
+struct CostModel {
+  // ESP32-C3 at 160 MHz against the host, for the same code
+  double cpuScale = 40.0;
+  double fullRefreshMs = 2000.0;
+  double halfRefreshMs = 1720.0;
+  double fastRefreshMs = 500.0;
+  double grayRefreshMs = 600.0;
+  double sdSeekMs = 0.2;
+  double sdReadMsPerKB = 0.5;
+  double sdWriteMsPerKB = 1.0;
+};
+
+struct Stats {
+  uint32_t fullRefreshes = 0;
+  uint32_t halfRefreshes = 0;
+  uint32_t fastRefreshes = 0;
+  uint32_t grayRefreshes = 0;
+  uint32_t framesWritten = 0;
+  uint32_t fileOpens = 0;
+  uint32_t seeks = 0;
+  uint64_t bytesRead = 0;
+  uint64_t bytesWritten = 0;
+};
+
+// Device paths ("/books/a.epub") open <dir>/books/a.epub. Without a directory (the default) paths are host paths.
+void setSdRoot(const std::string& dir);
+// Every displayed frame is written to <dir>/frame_NNNNN.png, as the panel holds it (800x480, 1 bit); empty stops it
+void setFrameDumpDir(const std::string& dir);
+// Reads button presses for HalGPIO::update() to replay, one per update: a line holds a button name (BACK, CONFIRM,
+// LEFT, RIGHT, UP, DOWN, POWER, or NONE for an update without a press) and an optional repeat count; '#' starts a
+// comment. Returns false if the file can't be read or names an unknown button.
+bool loadInputScript(const std::string& path);
+// True while scripted presses remain
+bool hasScriptedInput();
+
+Stats& stats();
+void resetStats();
+CostModel& costModel();
+// The time the device would take for what stats counts, hostCpuMs being the host time spent computing
+double estimateDeviceMs(const Stats& stats, double hostCpuMs);
+
+// Writes a 1 bit per pixel frame buffer (set bits white, rows of width / 8 bytes) as a grayscale PNG
+bool writePng(const std::string& path, const uint8_t* frame, uint16_t width, uint16_t height);
+
+}  // namespace HostEmulator
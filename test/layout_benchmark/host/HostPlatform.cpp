@@ -0,0 +1,510 @@
+// Host implementations of the HAL and Arduino pieces the firmware's libraries link against, controlled through
+// HostEmulator.h: storage on the host file system (optionally under a directory standing for the SD card), the display
+// as a frame buffer that can be written out as PNG images, and buttons replayed from a script.
+
+#include "HostEmulator.h"
+
+#include <Arduino.h>
+#include <HalDisplay.h>
+#include <HalGPIO.h>
+#include <HalStorage.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Epub.h"
+#include "Epub/converters/ImageDecoderFactory.h"
+
+// ---- Arduino core ----
+
+namespace {
+const auto startTime = std::chrono::steady_clock::now();
+}
+
+unsigned long millis() {
+  return static_cast<unsigned long>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count());
+}
+
+unsigned long micros() {
+  return static_cast<unsigned long>(
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count());
+}
+
+void delay(unsigned long) {}
+
+// Large enough that no heap-pressure fallback kicks in; the benchmark measures the heap itself
+uint32_t EspClass::getFreeHeap() { return 4 * 1024 * 1024; }
+uint32_t EspClass::getMaxAllocHeap() { return 4 * 1024 * 1024; }
+EspClass ESP;
+
+size_t HWCDC::write(const uint8_t b) { return fputc(b, stderr) == EOF ? 0 : 1; }
+HWCDC Serial;
+
+void logPrintf(const char* level, const char* origin, const char* format, ...) {
+  fprintf(stderr, "[%lu] [%s] [%s] ", millis(), level, origin);
+  va_list args;
+  va_start(args, format);
+  vfprintf(stderr, format, args);
+  va_end(args);
+}
+
+// ---- Emulator state ----
+
+namespace {
+std::string sdRoot;
+std::string frameDumpDir;
+uint32_t nextFrame = 0;
+HostEmulator::Stats counters;
+HostEmulator::CostModel model;
+// Scripted buttons, NO_BUTTON for an update without a press
+constexpr uint8_t NO_BUTTON = 0xFF;
+std::vector<uint8_t> inputScript;
+size_t nextInput = 0;
+uint8_t currentInput = NO_BUTTON;
+
+std::string hostPath(const char* path) { return sdRoot.empty() || path[0] != '/' ? path : sdRoot + path; }
+
+uint32_t crc32(uint32_t crc, const uint8_t* data, const size_t length) {
+  static uint32_t table[256];
+  if (table[1] == 0) {
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; k++) {
+        c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+      }
+      table[i] = c;
+    }
+  }
+  crc = ~crc;
+  for (size_t i = 0; i < length; i++) {
+    crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+void appendBigEndian(std::string& out, const uint32_t value) {
+  for (int shift = 24; shift >= 0; shift -= 8) {
+    out += static_cast<char>(value >> shift & 0xFF);
+  }
+}
+
+void appendChunk(std::string& png, const char* type, const std::string& data) {
+  appendBigEndian(png, data.size());
+  std::string chunk = type + data;
+  png += chunk;
+  appendBigEndian(png, crc32(0, reinterpret_cast<const uint8_t*>(chunk.data()), chunk.size()));
+}
+
+void dumpFrame(const uint8_t* frame) {
+  if (frameDumpDir.empty()) {
+    return;
+  }
+  char name[32];
+  snprintf(name, sizeof(name), "/frame_%05u.png", static_cast<unsigned>(nextFrame++));
+  counters.framesWritten++;
+  HostEmulator::writePng(frameDumpDir + name, frame, HalDisplay::DISPLAY_WIDTH, HalDisplay::DISPLAY_HEIGHT);
+}
+}  // namespace
+
+void HostEmulator::setSdRoot(const std::string& dir) { sdRoot = dir; }
+void HostEmulator::setFrameDumpDir(const std::string& dir) { frameDumpDir = dir; }
+
+bool HostEmulator::loadInputScript(const std::string& path) {
+  static const char* const BUTTONS[] = {"BACK", "CONFIRM", "LEFT", "RIGHT", "UP", "DOWN", "POWER"};
+  std::ifstream in(path);
+  if (!in) {
+    return false;
+  }
+  inputScript.clear();
+  nextInput = 0;
+  std::string line;
+  while (std::getline(in, line)) {
+    line = line.substr(0, line.find('#'));
+    std::istringstream words(line);
+    std::string name;
+    int repeat = 1;
+    if (!(words >> name)) {
+      continue;
+    }
+    words >> repeat;
+    uint8_t button = NO_BUTTON;
+    for (uint8_t i = 0; i < sizeof(BUTTONS) / sizeof(BUTTONS[0]); i++) {
+      if (name == BUTTONS[i]) {
+        button = i;
+      }
+    }
+    if (button == NO_BUTTON && name != "NONE") {
+      fprintf(stderr, "%s: unknown button %s\n", path.c_str(), name.c_str());
+      return false;
+    }
+    inputScript.insert(inputScript.end(), std::max(repeat, 0), button);
+  }
+  return true;
+}
+
+bool HostEmulator::hasScriptedInput() { return nextInput < inputScript.size(); }
+
+HostEmulator::Stats& HostEmulator::stats() { return counters; }
+void HostEmulator::resetStats() { counters = Stats(); }
+HostEmulator::CostModel& HostEmulator::costModel() { return model; }
+
+double HostEmulator::estimateDeviceMs(const Stats& stats, const double hostCpuMs) {
+  return hostCpuMs * model.cpuScale + stats.fullRefreshes * model.fullRefreshMs +
+         stats.halfRefreshes * model.halfRefreshMs + stats.fastRefreshes * model.fastRefreshMs +
+         stats.grayRefreshes * model.grayRefreshMs + (stats.fileOpens + stats.seeks) * model.sdSeekMs +
+         stats.bytesRead / 1024.0 * model.sdReadMsPerKB + stats.bytesWritten / 1024.0 * model.sdWriteMsPerKB;
+}
+
+bool HostEmulator::writePng(const std::string& path, const uint8_t* frame, const uint16_t width,
+                            const uint16_t height) {
+  const size_t rowBytes = width / 8;
+  // Filter byte 0 and the row as it is: PNG's 1 bit grayscale has set bits white too
+  std::string raw;
+  raw.reserve((rowBytes + 1) * height);
+  for (uint16_t y = 0; y < height; y++) {
+    raw += '\0';
+    raw.append(reinterpret_cast<const char*>(frame + y * rowBytes), rowBytes);
+  }
+  // zlib stream of stored blocks; frames are small enough that compressing them isn't worth a dependency
+  std::string zlib = "\x78\x01";
+  for (size_t offset = 0; offset < raw.size() || offset == 0; offset += 65535) {
+    const size_t length = std::min<size_t>(65535, raw.size() - offset);
+    zlib += static_cast<char>(offset + length >= raw.size() ? 1 : 0);
+    zlib += static_cast<char>(length & 0xFF);
+    zlib += static_cast<char>(length >> 8);
+    zlib += static_cast<char>(~length & 0xFF);
+    zlib += static_cast<char>(~length >> 8 & 0xFF);
+    zlib.append(raw, offset, length);
+  }
+  uint32_t a = 1;
+  uint32_t b = 0;
+  for (const char c : raw) {
+    a = (a + static_cast<uint8_t>(c)) % 65521;
+    b = (b + a) % 65521;
+  }
+  appendBigEndian(zlib, b << 16 | a);
+
+  std::string header;
+  appendBigEndian(header, width);
+  appendBigEndian(header, height);
+  header += std::string("\x01\x00\x00\x00\x00", 5);  // 1 bit grayscale, no interlace
+  std::string png = "\x89PNG\r\n\x1a\n";
+  appendChunk(png, "IHDR", header);
+  appendChunk(png, "IDAT", zlib);
+  appendChunk(png, "IEND", "");
+
+  FILE* fp = fopen(path.c_str(), "wb");
+  if (!fp) {
+    return false;
+  }
+  const bool ok = fwrite(png.data(), 1, png.size(), fp) == png.size();
+  return fclose(fp) == 0 && ok;
+}
+
+// ---- Storage ----
+
+class HalFile::Impl {
+ public:
+  Impl(FILE* fp, std::string path) : fp(fp), path(std::move(path)) {}
+  Impl(DIR* dir, std::string path) : dir(dir), path(std::move(path)) {}
+  ~Impl() {
+    if (fp) {
+      fclose(fp);
+    }
+    if (dir) {
+      closedir(dir);
+    }
+  }
+  FILE* fp = nullptr;
+  DIR* dir = nullptr;
+  // Host path
+  std::string path;
+};
+
+HalStorage HalStorage::instance;
+
+HalStorage::HalStorage() = default;
+
+bool HalStorage::exists(const char* path) {
+  struct stat info;
+  return stat(hostPath(path).c_str(), &info) == 0;
+}
+
+bool HalStorage::remove(const char* path) { return ::remove(hostPath(path).c_str()) == 0; }
+bool HalStorage::rename(const char* oldPath, const char* newPath) {
+  return ::rename(hostPath(oldPath).c_str(), hostPath(newPath).c_str()) == 0;
+}
+bool HalStorage::rmdir(const char* path) { return ::rmdir(hostPath(path).c_str()) == 0; }
+
+bool HalStorage::mkdir(const char* path, const bool pFlag) {
+  const std::string full = hostPath(path);
+  if (pFlag) {
+    for (size_t slash = full.find('/', 1); slash != std::string::npos; slash = full.find('/', slash + 1)) {
+      ::mkdir(full.substr(0, slash).c_str(), 0755);
+    }
+  }
+  return ::mkdir(full.c_str(), 0755) == 0 || errno == EEXIST;
+}
+
+HalFile HalStorage::open(const char* path, const oflag_t oflag) {
+  const std::string full = hostPath(path);
+  struct stat info;
+  if (stat(full.c_str(), &info) == 0 && S_ISDIR(info.st_mode)) {
+    DIR* dir = opendir(full.c_str());
+    return dir ? HalFile(std::make_unique<HalFile::Impl>(dir, full)) : HalFile();
+  }
+  const char* mode = "rb";
+  if (oflag & O_TRUNC) {
+    mode = "w+b";
+  } else if (oflag & (O_WRONLY | O_RDWR)) {
+    mode = oflag & O_CREAT && stat(full.c_str(), &info) != 0 ? "w+b" : "r+b";
+  }
+  FILE* fp = fopen(full.c_str(), mode);
+  counters.fileOpens += fp ? 1 : 0;
+  return fp ? HalFile(std::make_unique<HalFile::Impl>(fp, full)) : HalFile();
+}
+
+bool HalStorage::openFileForRead(const char* moduleName, const std::string& path, HalFile& file) {
+  return openFileForRead(moduleName, path.c_str(), file);
+}
+
+bool HalStorage::openFileForRead(const char*, const char* path, HalFile& file) {
+  const std::string full = hostPath(path);
+  FILE* fp = fopen(full.c_str(), "rb");
+  counters.fileOpens += fp ? 1 : 0;
+  file = fp ? HalFile(std::make_unique<HalFile::Impl>(fp, full)) : HalFile();
+  return fp != nullptr;
+}
+
+bool HalStorage::openFileForWrite(const char* moduleName, const std::string& path, HalFile& file) {
+  return openFileForWrite(moduleName, path.c_str(), file);
+}
+
+bool HalStorage::openFileForWrite(const char*, const char* path, HalFile& file) {
+  const std::string full = hostPath(path);
+  FILE* fp = fopen(full.c_str(), "w+b");
+  counters.fileOpens += fp ? 1 : 0;
+  file = fp ? HalFile(std::make_unique<HalFile::Impl>(fp, full)) : HalFile();
+  return fp != nullptr;
+}
+
+HalFile::HalFile() = default;
+HalFile::HalFile(std::unique_ptr<Impl> impl) : impl(std::move(impl)) {}
+HalFile::~HalFile() = default;
+HalFile::HalFile(HalFile&&) = default;
+HalFile& HalFile::operator=(HalFile&&) = default;
+
+void HalFile::flush() {
+  if (isOpen()) {
+    fflush(impl->fp);
+  }
+}
+
+size_t HalFile::getName(char* name, const size_t len) {
+  if (!impl || len == 0) {
+    return 0;
+  }
+  const std::string base = impl->path.substr(impl->path.find_last_of('/') + 1);
+  const size_t length = std::min(base.size(), len - 1);
+  memcpy(name, base.data(), length);
+  name[length] = '\0';
+  return length;
+}
+
+bool HalFile::isDirectory() const { return impl && impl->dir; }
+
+void HalFile::rewindDirectory() {
+  if (isDirectory()) {
+    rewinddir(impl->dir);
+  }
+}
+
+HalFile HalFile::openNextFile() {
+  if (!isDirectory()) {
+    return HalFile();
+  }
+  while (const dirent* entry = readdir(impl->dir)) {
+    if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+      continue;
+    }
+    const std::string child = impl->path + "/" + entry->d_name;
+    if (entry->d_type == DT_DIR) {
+      DIR* dir = opendir(child.c_str());
+      if (dir) {
+        return HalFile(std::make_unique<Impl>(dir, child));
+      }
+    } else if (FILE* fp = fopen(child.c_str(), "rb")) {
+      counters.fileOpens++;
+      return HalFile(std::make_unique<Impl>(fp, child));
+    }
+  }
+  return HalFile();
+}
+
+size_t HalFile::fileSize() {
+  if (!isOpen()) {
+    return 0;
+  }
+  const long pos = ftell(impl->fp);
+  fseek(impl->fp, 0, SEEK_END);
+  const long end = ftell(impl->fp);
+  fseek(impl->fp, pos, SEEK_SET);
+  return end < 0 ? 0 : static_cast<size_t>(end);
+}
+
+size_t HalFile::size() { return fileSize(); }
+
+bool HalFile::seekSet(const size_t offset) {
+  counters.seeks++;
+  return isOpen() && fseek(impl->fp, static_cast<long>(offset), SEEK_SET) == 0;
+}
+bool HalFile::seek(const size_t pos) { return seekSet(pos); }
+bool HalFile::seekCur(const int64_t offset) {
+  counters.seeks++;
+  return isOpen() && fseek(impl->fp, static_cast<long>(offset), SEEK_CUR) == 0;
+}
+
+size_t HalFile::position() const { return isOpen() ? static_cast<size_t>(ftell(impl->fp)) : 0; }
+
+int HalFile::available() const {
+  if (!isOpen()) {
+    return 0;
+  }
+  const long pos = ftell(impl->fp);
+  fseek(impl->fp, 0, SEEK_END);
+  const long end = ftell(impl->fp);
+  fseek(impl->fp, pos, SEEK_SET);
+  return static_cast<int>(end - pos);
+}
+
+int HalFile::read(void* buf, const size_t count) {
+  if (!isOpen()) {
+    return -1;
+  }
+  const size_t bytesRead = fread(buf, 1, count, impl->fp);
+  counters.bytesRead += bytesRead;
+  return static_cast<int>(bytesRead);
+}
+
+int HalFile::read() {
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+size_t HalFile::write(const void* buf, const size_t count) {
+  if (!isOpen()) {
+    return 0;
+  }
+  const size_t written = fwrite(buf, 1, count, impl->fp);
+  counters.bytesWritten += written;
+  return written;
+}
+size_t HalFile::write(const uint8_t b) { return write(&b, 1); }
+
+// Host files need no reservation; as on the card, only an empty file takes one
+bool HalFile::preAllocate(size_t) { return isOpen() && fileSize() == 0; }
+bool HalFile::truncate() {
+  return isOpen() && fflush(impl->fp) == 0 && ftruncate(fileno(impl->fp), ftell(impl->fp)) == 0;
+}
+
+bool HalFile::close() {
+  impl.reset();
+  return true;
+}
+
+bool HalFile::isOpen() const { return impl != nullptr && (impl->fp != nullptr || impl->dir != nullptr); }
+HalFile::operator bool() const { return isOpen(); }
+
+// ---- Display ----
+
+namespace {
+uint8_t frameBuffer[HalDisplay::BUFFER_SIZE];
+}
+
+HalDisplay::HalDisplay() = default;
+HalDisplay::~HalDisplay() = default;
+uint8_t* HalDisplay::getFrameBuffer() const { return frameBuffer; }
+void HalDisplay::clearScreen(const uint8_t color) const { memset(frameBuffer, color, sizeof(frameBuffer)); }
+void HalDisplay::drawImage(const uint8_t*, uint16_t, uint16_t, uint16_t, uint16_t, bool) const {}
+void HalDisplay::drawImageTransparent(const uint8_t*, uint16_t, uint16_t, uint16_t, uint16_t, bool) const {}
+
+void HalDisplay::displayBuffer(const RefreshMode mode, bool) {
+  switch (mode) {
+    case FULL_REFRESH:
+      counters.fullRefreshes++;
+      break;
+    case HALF_REFRESH:
+      counters.halfRefreshes++;
+      break;
+    case FAST_REFRESH:
+      counters.fastRefreshes++;
+      break;
+  }
+  dumpFrame(frameBuffer);
+}
+
+// Like the display drivers without a windowed update: the renderer falls back to displayBuffer()
+bool HalDisplay::displayWindow(uint16_t, uint16_t, uint16_t, uint16_t, bool) { return false; }
+void HalDisplay::copyGrayscaleBuffers(const uint8_t*, const uint8_t*) {}
+void HalDisplay::copyGrayscaleLsbBuffers(const uint8_t*) {}
+void HalDisplay::copyGrayscaleMsbBuffers(const uint8_t*) {}
+void HalDisplay::cleanupGrayscaleBuffers(const uint8_t*) {}
+void HalDisplay::displayGrayBuffer(bool) { counters.grayRefreshes++; }
+uint16_t HalDisplay::getDisplayWidth() const { return DISPLAY_WIDTH; }
+uint16_t HalDisplay::getDisplayHeight() const { return DISPLAY_HEIGHT; }
+uint16_t HalDisplay::getDisplayWidthBytes() const { return DISPLAY_WIDTH_BYTES; }
+uint32_t HalDisplay::getBufferSize() const { return BUFFER_SIZE; }
+HalDisplay display;
+
+// ---- Buttons ----
+
+// Each update() replays the next scripted press, pressed and released within that update
+void HalGPIO::begin() {}
+
+void HalGPIO::update() {
+  currentInput = nextInput < inputScript.size() ? inputScript[nextInput++] : NO_BUTTON;
+  if (currentInput != NO_BUTTON) {
+    lastPressUs = micros();
+  }
+}
+
+bool HalGPIO::isPressed(uint8_t) const { return false; }
+bool HalGPIO::wasPressed(const uint8_t buttonIndex) const { return currentInput == buttonIndex; }
+bool HalGPIO::wasAnyPressed() const { return currentInput != NO_BUTTON; }
+bool HalGPIO::wasReleased(const uint8_t buttonIndex) const { return currentInput == buttonIndex; }
+bool HalGPIO::wasAnyReleased() const { return currentInput != NO_BUTTON; }
+unsigned long HalGPIO::getHeldTime() const { return 0; }
+bool HalGPIO::isUsbConnected() const { return false; }
+bool HalGPIO::wasUsbStateChanged() const { return false; }
+HalGPIO::WakeupReason HalGPIO::getWakeupReason() const { return WakeupReason::Other; }
+HalGPIO gpio;
+
+// ---- Images ----
+
+// Chapters are laid out without their images: the decoders need the device's JPEG and PNG libraries, and image
+// layout doesn't go through ParsedText anyway
+bool ImageDecoderFactory::isFormatSupported(const std::string&) { return false; }
+void ImageDecoderFactory::releaseScratch() {}
+ImageToFramebufferDecoder* ImageDecoderFactory::getDecoder(const std::string&) { return nullptr; }
+bool ImageDecoderFactory::readDimensions(const std::string&, const std::function<int(void*, size_t)>&,
+                                         ImageDimensions&) {
+  return false;
+}
+bool Epub::openStoredItem(const std::string&, ZipFile::StoredEntry&) const { return false; }
+bool Epub::readItemContentsToStream(const std::string&, Print&, size_t) const { return false; }
+const std::string& Epub::getFb2Encoding() const {
+  static std::string blank;
+  return blank;
+}
+std::string Epub::resolveFb2Href(const std::string& href) const { return href; }
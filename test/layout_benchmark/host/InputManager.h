@@ -0,0 +1,3 @@
+#pragma once
+
+// Included by HalGPIO.h; the host build sets CROSSPOINT_EMULATED so no InputManager is instantiated
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <string>
+
+// Only appears in HalStorage signatures the benchmark doesn't call
+class String : public std::string {
+ public:
+  using std::string::string;
+};
@@ -0,0 +1,5 @@
+#pragma once
+
+#include <fcntl.h>
+
+typedef int oflag_t;
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <cstdint>
+
+typedef void* SemaphoreHandle_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE 1
+#define portMAX_DELAY UINT32_MAX
@@ -0,0 +1,215 @@
+// Host test of ParsedText's optimal line breaking on long generated paragraphs, measured with the real GfxRenderer and
+// a built-in font. Writes every line laid out (its words, styles and x positions) to the file given with --lines, and
+// checks that laying each paragraph out in partial passes as it streams in emits the same lines as a single pass.
+//
+// Usage: LineBreakTest --lines FILE
+// run_line_break_test.sh builds this twice: with the firmware's break window, and with PARSED_TEXT_BREAK_WINDOW wider
+// than any paragraph here, which makes computeLineBreaks the full DP over the whole paragraph. The two line files must
+// be identical. The windowed DP only keeps the full DP's lines while the candidate layouts agree on a line within the
+// window; a paragraph of lines so uniform that they don't (narrowWords below) is only checked for its line count.
+
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Epub/ParsedText.h"
+#include "Epub/hyphenation/Hyphenator.h"
+#include "builtinFonts/bookerly_14_bold.h"
+#include "builtinFonts/bookerly_14_bolditalic.h"
+#include "builtinFonts/bookerly_14_italic.h"
+#include "builtinFonts/bookerly_14_regular.h"
+
+namespace {
+
+constexpr int FONT_ID = 1;
+// Portrait screen less the reader's default margins
+constexpr uint16_t VIEWPORT_WIDTH = 464;
+
+EpdFont regularFont(&bookerly_14_regular);
+EpdFont boldFont(&bookerly_14_bold);
+EpdFont italicFont(&bookerly_14_italic);
+EpdFont boldItalicFont(&bookerly_14_bolditalic);
+EpdFontFamily fontFamily(&regularFont, &boldFont, &italicFont, &boldItalicFont);
+
+// Words of every length up to a line's worth, so paragraphs mix loose and tight lines
+const char* const VOCABULARY[] = {
+    "a",    "I",        "of",        "to",         "in",         "the",          "and",           "was",
+    "that", "with",     "from",      "which",      "would",      "little",       "through",       "suddenly",
+    "über", "naïve",    "Ώστε",      "beautiful",  "everything", "remembered",   "considerable",  "extraordinary",
+    "notwithstanding",  "incomprehensibility"};
+constexpr size_t VOCABULARY_SIZE = sizeof(VOCABULARY) / sizeof(VOCABULARY[0]);
+// Wider than the viewport, so computeLineBreaks splits it before breaking lines
+constexpr char OVERSIZED_WORD[] =
+    "Pneumonoultramicroscopicsilicovolcanoconiosis-and-supercalifragilisticexpialidocious";
+
+struct ParagraphSpec {
+  const char* name;
+  size_t words;
+  uint32_t seed;
+  CssTextAlign alignment;
+  int16_t textIndent;
+  // Only "a" and "I", of almost the same width: many layouts cost nearly the same for longer than the window, which
+  // then keeps the cheapest one's lines
+  bool narrowWords;
+};
+
+const ParagraphSpec PARAGRAPHS[] = {
+    {"short justified", 60, 1, CssTextAlign::Justify, 0, false},
+    {"under the window", 900, 2, CssTextAlign::Justify, 24, false},
+    {"just over the window", 1100, 3, CssTextAlign::Justify, 0, false},
+    {"long justified", 6000, 4, CssTextAlign::Justify, 24, false},
+    {"long left aligned", 6000, 5, CssTextAlign::Left, -16, false},
+    {"long centered", 4000, 6, CssTextAlign::Center, 0, false},
+    {"very long justified", 30000, 8, CssTextAlign::Justify, 24, false},
+    {"long narrow words", 8000, 7, CssTextAlign::Justify, 0, true},
+};
+
+// Words added between partial layouts: every word, the parser's interval, and one over the break window
+const size_t STREAM_INTERVALS[] = {1, 64, 1500};
+
+BlockStyle blockStyleOf(const ParagraphSpec& spec) {
+  BlockStyle blockStyle;
+  blockStyle.alignment = spec.alignment;
+  blockStyle.textIndent = spec.textIndent;
+  blockStyle.textIndentDefined = spec.textIndent != 0;
+  return blockStyle;
+}
+
+// Deterministic across hosts, unlike std::rand
+struct Lcg {
+  uint32_t state;
+  uint32_t next(const uint32_t bound) {
+    state = state * 1664525u + 1013904223u;
+    return (state >> 8) % bound;
+  }
+};
+
+// Feeds the paragraph's words to text, calling afterWord after each
+void fillParagraph(ParsedText& text, const ParagraphSpec& spec, const std::function<void()>& afterWord) {
+  Lcg rng{spec.seed};
+  for (size_t i = 0; i < spec.words; ++i) {
+    const uint32_t roll = rng.next(100);
+    if (spec.narrowWords) {
+      text.addWord(roll < 50 ? "a" : "I", EpdFontFamily::REGULAR);
+    } else if (i > 0 && roll < 8) {
+      // Punctuation attached to the word before, which can't be broken from it
+      text.addWord(roll < 5 ? "," : ".", EpdFontFamily::REGULAR, false, true);
+    } else if (roll == 99 && rng.next(4) == 0) {
+      text.addWord(OVERSIZED_WORD, EpdFontFamily::REGULAR);
+    } else {
+      const EpdFontFamily::Style style = roll >= 95 ? EpdFontFamily::ITALIC
+                                         : roll >= 93 ? EpdFontFamily::BOLD
+                                                      : EpdFontFamily::REGULAR;
+      text.addWord(VOCABULARY[rng.next(VOCABULARY_SIZE)], style, roll == 92);
+    }
+    afterWord();
+  }
+}
+
+std::string formatLine(const TextBlock& line) {
+  std::string formatted;
+  char word[16];
+  const auto& words = line.getWords();
+  for (size_t i = 0; i < words.size(); ++i) {
+    snprintf(word, sizeof(word), " %d/%d/", line.getWordXpos()[i], static_cast<int>(line.getWordStyles()[i]));
+    formatted += word;
+    formatted += words[i];
+  }
+  return formatted;
+}
+
+std::vector<std::string> layOutInOnePass(const GfxRenderer& renderer, const ParagraphSpec& spec,
+                                         const bool hyphenation) {
+  ParsedText text(false, hyphenation, blockStyleOf(spec));
+  fillParagraph(text, spec, [] {});
+  std::vector<std::string> lines;
+  text.layoutAndExtractLines(renderer, FONT_ID, VIEWPORT_WIDTH,
+                             [&](const std::shared_ptr<TextBlock>& line) { lines.push_back(formatLine(*line)); });
+  return lines;
+}
+
+// Lays the paragraph out as ChapterHtmlSlimParser streams it: a partial layout whenever the words buffered reach the
+// threshold, which then moves interval words past them, and the rest once the paragraph ends
+std::vector<std::string> layOutStreamed(const GfxRenderer& renderer, const ParagraphSpec& spec, const bool hyphenation,
+                                        const size_t interval) {
+  ParsedText text(false, hyphenation, blockStyleOf(spec));
+  std::vector<std::string> lines;
+  const auto collect = [&](const std::shared_ptr<TextBlock>& line) { lines.push_back(formatLine(*line)); };
+  size_t layoutAt = interval;
+  fillParagraph(text, spec, [&] {
+    if (text.size() >= layoutAt) {
+      layoutAt = text.size() + interval;
+      text.layoutAndExtractLines(renderer, FONT_ID, VIEWPORT_WIDTH, collect, false);
+    }
+  });
+  text.layoutAndExtractLines(renderer, FONT_ID, VIEWPORT_WIDTH, collect);
+  return lines;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  if (argc != 3 || strcmp(argv[1], "--lines") != 0) {
+    fprintf(stderr, "Usage: %s --lines FILE\n", argv[0]);
+    return 2;
+  }
+  FILE* out = fopen(argv[2], "w");
+  if (!out) {
+    fprintf(stderr, "Cannot write %s\n", argv[2]);
+    return 1;
+  }
+
+  GfxRenderer renderer(display);
+  renderer.insertFont(FONT_ID, fontFamily);
+  Hyphenator::setPreferredLanguage("en");
+
+  int checked = 0;
+  int failed = 0;
+  for (const ParagraphSpec& spec : PARAGRAPHS) {
+    const std::vector<std::string> lines = layOutInOnePass(renderer, spec, false);
+    fprintf(out, "# %s\n", spec.name);
+    if (spec.narrowWords) {
+      fprintf(out, "%zu lines\n", lines.size());
+    } else {
+      for (size_t i = 0; i < lines.size(); ++i) {
+        fprintf(out, "%zu:%s\n", i, lines[i].c_str());
+      }
+    }
+    printf("%-22s %6zu words %5zu lines\n", spec.name, spec.words, lines.size());
+
+    // Streamed partial layout must emit exactly the lines of the single pass, with optimal and with greedy hyphenated
+    // breaking, however often it runs
+    for (const bool hyphenation : {false, true}) {
+      const std::vector<std::string> expected = hyphenation ? layOutInOnePass(renderer, spec, true) : lines;
+      for (const size_t interval : STREAM_INTERVALS) {
+        const std::vector<std::string> streamed = layOutStreamed(renderer, spec, hyphenation, interval);
+        checked++;
+        if (streamed == expected) {
+          continue;
+        }
+        size_t first = 0;
+        while (first < streamed.size() && first < expected.size() && streamed[first] == expected[first]) {
+          ++first;
+        }
+        fprintf(stderr, "  FAIL: %s%s, streamed every %zu words: line %zu differs (%zu lines, %zu in one pass)\n",
+                spec.name, hyphenation ? " hyphenated" : "", interval, first, streamed.size(), expected.size());
+        failed++;
+      }
+    }
+  }
+
+  printf("Streamed layout: %d passed, %d failed\n", checked - failed, failed);
+
+  if (fclose(out) != 0) {
+    fprintf(stderr, "Cannot write %s\n", argv[2]);
+    return 1;
+  }
+  return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,122 @@
+// Host run of RenderBenchmark (src/util/RenderBenchmark.h): times every GfxRenderer case and checks the frame it leaves
+// against the golden hashes, exiting with 1 on a mismatch.
+//
+// Usage: RenderBenchmarkTest [--repeat N] [--frames DIR] [--update GOLDEN_HEADER]
+// --frames writes the frame of every case as <DIR>/<case>.png; --update rewrites the golden hashes from this run,
+// after a change that is meant to change pixels.
+
+#include <FontCacheManager.h>
+#include <FontDecompressor.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "HostEmulator.h"
+#include "builtinFonts/bookerly_14_bold.h"
+#include "builtinFonts/bookerly_14_bolditalic.h"
+#include "builtinFonts/bookerly_14_italic.h"
+#include "builtinFonts/bookerly_14_regular.h"
+#include "builtinFonts/notosans_8_regular.h"
+#include "builtinFonts/ubuntu_10_bold.h"
+#include "builtinFonts/ubuntu_10_regular.h"
+#include "fontIds.h"
+#include "util/RenderBenchmark.h"
+
+namespace {
+// Registered as main.cpp does
+EpdFont bookerly14RegularFont(&bookerly_14_regular);
+EpdFont bookerly14BoldFont(&bookerly_14_bold);
+EpdFont bookerly14ItalicFont(&bookerly_14_italic);
+EpdFont bookerly14BoldItalicFont(&bookerly_14_bolditalic);
+EpdFontFamily bookerly14FontFamily(&bookerly14RegularFont, &bookerly14BoldFont, &bookerly14ItalicFont,
+                                   &bookerly14BoldItalicFont);
+EpdFont ui10RegularFont(&ubuntu_10_regular);
+EpdFont ui10BoldFont(&ubuntu_10_bold);
+EpdFontFamily ui10FontFamily(&ui10RegularFont, &ui10BoldFont);
+EpdFont smallFont(&notosans_8_regular);
+EpdFontFamily smallFontFamily(&smallFont);
+
+bool writeGoldenHeader(const std::string& path, const std::vector<std::pair<std::string, uint32_t>>& hashes) {
+  FILE* out = fopen(path.c_str(), "w");
+  if (!out) {
+    return false;
+  }
+  fprintf(out,
+          "// Generated by test/run_render_benchmark.sh --update: the frame each RenderBenchmark case has to leave\n"
+          "#pragma once\n#include <cstdint>\n\nnamespace RenderBenchmarkGolden {\nstruct Entry {\n"
+          "  const char* name;\n  uint32_t hash;\n};\n\nconstexpr Entry HASHES[] = {\n");
+  for (const auto& [name, hash] : hashes) {
+    fprintf(out, "    {\"%s\", 0x%08X},\n", name.c_str(), hash);
+  }
+  fprintf(out, "};\n}  // namespace RenderBenchmarkGolden\n");
+  return fclose(out) == 0;
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  int repeat = 20;
+  std::string framesDir;
+  std::string goldenPath;
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if (arg == "--repeat" && i + 1 < argc) {
+      repeat = std::max(1, atoi(argv[++i]));
+    } else if (arg == "--frames" && i + 1 < argc) {
+      framesDir = argv[++i];
+    } else if (arg == "--update" && i + 1 < argc) {
+      goldenPath = argv[++i];
+    } else {
+      fprintf(stderr, "Usage: %s [--repeat N] [--frames DIR] [--update GOLDEN_HEADER]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (!framesDir.empty()) {
+    std::filesystem::create_directories(framesDir);
+  }
+
+  GfxRenderer renderer(display);
+  renderer.begin();
+  FontDecompressor fontDecompressor;
+  fontDecompressor.init();
+  FontCacheManager fontCacheManager(renderer.getFontMap());
+  fontCacheManager.setFontDecompressor(&fontDecompressor);
+  renderer.setFontCacheManager(&fontCacheManager);
+  renderer.insertFont(BOOKERLY_14_FONT_ID, bookerly14FontFamily);
+  renderer.insertFont(UI_10_FONT_ID, ui10FontFamily);
+  renderer.insertFont(SMALL_FONT_ID, smallFontFamily);
+
+  const std::string scratchDir = std::filesystem::temp_directory_path().string();
+  std::vector<std::pair<std::string, uint32_t>> hashes;
+  printf("%-34s %10s %10s  %s\n", "case", "best us", "hash", "golden");
+  const auto report = [&](const RenderBenchmark::Result& r) {
+    printf("%-34s %10u   %08X  %s\n", r.name, static_cast<unsigned>(r.bestUs), static_cast<unsigned>(r.hash),
+           r.golden == 0 ? "none" : r.ok ? "ok" : "MISMATCH");
+    hashes.emplace_back(r.name, r.hash);
+    if (!framesDir.empty()) {
+      HostEmulator::writePng(framesDir + "/" + r.name + ".png", renderer.getFrameBuffer(),
+                             renderer.getDisplayWidth(), renderer.getDisplayHeight());
+    }
+  };
+  const int failures = RenderBenchmark::run(renderer, scratchDir.c_str(), repeat, report);
+
+  if (!goldenPath.empty()) {
+    if (!writeGoldenHeader(goldenPath, hashes)) {
+      fprintf(stderr, "Can't write %s\n", goldenPath.c_str());
+      return 1;
+    }
+    printf("Updated %s\n", goldenPath.c_str());
+    return 0;
+  }
+  if (failures > 0) {
+    printf("%d case(s) changed pixels\n", failures);
+    return 1;
+  }
+  return 0;
+}
@@ -23,6 +23,7 @@ CXXFLAGS=(
   -I"$ROOT_DIR/lib"
   -I"$ROOT_DIR/lib/EpdFont"
   -I"$ROOT_DIR/lib/Utf8"
+  -I"$ROOT_DIR/lib/hal"
 )
 
 c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" -o "$BINARY"
@@ -0,0 +1,134 @@
+#!/usr/bin/env bash
+# Builds the host layout benchmark and runs it over test/epubs, or over the EPUBs and unpacked EPUB directories given
+# as arguments. Benchmark options (--hyphenation, --language TAG, --repeat N, --render, --frames DIR, --input FILE,
+# --cpu-scale X) are passed through. --pull-tokenizer builds the parser with XhtmlPullTokenizer instead of expat
+# (XHTML_PULL_TOKENIZER), in a build directory of its own, to compare their time and peak heap.
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/layout_benchmark"
+PULL_TOKENIZER=0
+for arg in "$@"; do
+  if [[ "$arg" == "--pull-tokenizer" ]]; then
+    PULL_TOKENIZER=1
+    BUILD_DIR="$ROOT_DIR/build/layout_benchmark_pull"
+  fi
+done
+BINARY="$BUILD_DIR/LayoutBenchmark"
+
+mkdir -p "$BUILD_DIR/obj" "$BUILD_DIR/epubs"
+
+SOURCES=(
+  "$ROOT_DIR/test/layout_benchmark/LayoutBenchmark.cpp"
+  "$ROOT_DIR/test/layout_benchmark/host/HostPlatform.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/parsers/ChapterHtmlSlimParser.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/parsers/XhtmlPullTokenizer.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/ParsedText.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/TableLayout.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/WordWidthCache.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/Page.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/blocks/TextBlock.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/ImagePack.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/blocks/ImageBlock.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/css/CssParser.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/css/CssStyleCache.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/htmlEntities.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/HyphenationCache.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/HyphenationCommon.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/Hyphenator.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/LanguageRegistry.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/LiangHyphenation.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/Bitmap.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/BitmapHelpers.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/FontCacheManager.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/FontTable.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/FramePackBits.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/GfxRenderer.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFont.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFontFamily.cpp"
+  "$ROOT_DIR/lib/EpdFont/FontDecompressor.cpp"
+  "$ROOT_DIR/lib/FsHelpers/FsHelpers.cpp"
+  "$ROOT_DIR/lib/InflateReader/InflateReader.cpp"
+  "$ROOT_DIR/lib/MemoryBudget/MemoryBudget.cpp"
+  "$ROOT_DIR/lib/Serialization/LzCodec.cpp"
+  "$ROOT_DIR/lib/Utf8/Utf8.cpp"
+  "$ROOT_DIR/lib/XmlParserUtils/XmlParserUtils.cpp"
+  "$ROOT_DIR/lib/ZipFile/ZipFile.cpp"
+)
+
+C_SOURCES=(
+  "$ROOT_DIR/lib/expat/xmlparse.c"
+  "$ROOT_DIR/lib/expat/xmlrole.c"
+  "$ROOT_DIR/lib/expat/xmltok.c"
+  "$ROOT_DIR/lib/uzlib/src/tinflate.c"
+)
+
+DEFINES=(
+  -DCROSSPOINT_EMULATED=1
+  -DEINK_DISPLAY_SINGLE_BUFFER_MODE=1
+  -DDESTRUCTOR_CLOSES_FILE=1
+  -DXML_GE=0
+  -DXML_CONTEXT_BYTES=1024
+  -DXHTML_PULL_TOKENIZER=$PULL_TOKENIZER
+)
+
+INCLUDES=(-I"$ROOT_DIR/test/layout_benchmark/host" -I"$ROOT_DIR/lib/Epub" -I"$ROOT_DIR/lib/uzlib/src")
+for dir in "$ROOT_DIR"/lib/*/; do
+  INCLUDES+=(-I"$dir")
+done
+
+CXXFLAGS=(-std=gnu++2a -O2 -fno-exceptions -ffunction-sections "${DEFINES[@]}" "${INCLUDES[@]}")
+CFLAGS=(-O2 -ffunction-sections "${DEFINES[@]}" -I"$ROOT_DIR/lib/expat" -I"$ROOT_DIR/lib/uzlib/src")
+
+OBJECTS=()
+for src in "${C_SOURCES[@]}"; do
+  obj="$BUILD_DIR/obj/$(basename "$src").o"
+  cc "${CFLAGS[@]}" -c "$src" -o "$obj"
+  OBJECTS+=("$obj")
+done
+for src in "${SOURCES[@]}"; do
+  obj="$BUILD_DIR/obj/$(basename "$src").o"
+  c++ "${CXXFLAGS[@]}" -c "$src" -o "$obj"
+  OBJECTS+=("$obj")
+done
+# Sections let the linker drop code the benchmark never reaches, as the firmware link does (uzlib checksums)
+c++ "${OBJECTS[@]}" -Wl,--gc-sections -o "$BINARY"
+
+OPTIONS=()
+INPUTS=()
+while [[ $# -gt 0 ]]; do
+  case "$1" in
+    --language | --repeat | --frames | --input | --cpu-scale)
+      OPTIONS+=("$1" "$2")
+      shift 2
+      ;;
+    --pull-tokenizer)
+      shift
+      ;;
+    --*)
+      OPTIONS+=("$1")
+      shift
+      ;;
+    *)
+      INPUTS+=("$1")
+      shift
+      ;;
+  esac
+done
+if [[ ${#INPUTS[@]} -eq 0 ]]; then
+  INPUTS=("$ROOT_DIR"/test/epubs/*.epub)
+fi
+
+DIRS=()
+for input in "${INPUTS[@]}"; do
+  if [[ -d "$input" ]]; then
+    DIRS+=("$input")
+    continue
+  fi
+  dir="$BUILD_DIR/epubs/$(basename "$input" .epub)"
+  rm -rf "$dir"
+  python3 -c 'import sys, zipfile; zipfile.ZipFile(sys.argv[1]).extractall(sys.argv[2])' "$input" "$dir"
+  DIRS+=("$dir")
+done
+
+"$BINARY" "${OPTIONS[@]}" --out "$BUILD_DIR" "${DIRS[@]}"
@@ -0,0 +1,81 @@
+#!/usr/bin/env bash
+# Builds the host line break test twice, with the firmware's line breaking window and with a window wider than any of
+# its paragraphs (the full DP), and checks that both lay out every paragraph into the same lines. Each build also
+# checks that streamed partial layout emits the lines of a single pass.
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/line_breaks"
+# Wider than the longest paragraph of LineBreakTest.cpp
+FULL_DP_WINDOW=1000000
+
+mkdir -p "$BUILD_DIR/obj"
+
+SOURCES=(
+  "$ROOT_DIR/test/line_breaks/LineBreakTest.cpp"
+  "$ROOT_DIR/test/layout_benchmark/host/HostPlatform.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/WordWidthCache.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/blocks/TextBlock.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/HyphenationCache.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/HyphenationCommon.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/Hyphenator.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/LanguageRegistry.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/LiangHyphenation.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/Bitmap.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/BitmapHelpers.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/FontCacheManager.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/FontTable.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/FramePackBits.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/GfxRenderer.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFont.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFontFamily.cpp"
+  "$ROOT_DIR/lib/EpdFont/FontDecompressor.cpp"
+  "$ROOT_DIR/lib/FsHelpers/FsHelpers.cpp"
+  "$ROOT_DIR/lib/MemoryBudget/MemoryBudget.cpp"
+  "$ROOT_DIR/lib/Serialization/LzCodec.cpp"
+  "$ROOT_DIR/lib/Utf8/Utf8.cpp"
+)
+PARSED_TEXT="$ROOT_DIR/lib/Epub/Epub/ParsedText.cpp"
+
+C_SOURCES=(
+  "$ROOT_DIR/lib/uzlib/src/tinflate.c"
+)
+
+DEFINES=(
+  -DCROSSPOINT_EMULATED=1
+  -DEINK_DISPLAY_SINGLE_BUFFER_MODE=1
+  -DDESTRUCTOR_CLOSES_FILE=1
+)
+
+INCLUDES=(-I"$ROOT_DIR/test/layout_benchmark/host" -I"$ROOT_DIR/lib/Epub" -I"$ROOT_DIR/lib/uzlib/src")
+for dir in "$ROOT_DIR"/lib/*/; do
+  INCLUDES+=(-I"$dir")
+done
+
+CXXFLAGS=(-std=gnu++2a -O2 -fno-exceptions -ffunction-sections "${DEFINES[@]}" "${INCLUDES[@]}")
+CFLAGS=(-O2 -ffunction-sections "${DEFINES[@]}" -I"$ROOT_DIR/lib/uzlib/src")
+
+OBJECTS=()
+for src in "${C_SOURCES[@]}"; do
+  obj="$BUILD_DIR/obj/$(basename "$src").o"
+  cc "${CFLAGS[@]}" -c "$src" -o "$obj"
+  OBJECTS+=("$obj")
+done
+for src in "${SOURCES[@]}"; do
+  obj="$BUILD_DIR/obj/$(basename "$src").o"
+  c++ "${CXXFLAGS[@]}" -c "$src" -o "$obj"
+  OBJECTS+=("$obj")
+done
+c++ "${CXXFLAGS[@]}" -c "$PARSED_TEXT" -o "$BUILD_DIR/obj/ParsedText.windowed.o"
+c++ "${CXXFLAGS[@]}" -DPARSED_TEXT_BREAK_WINDOW=$FULL_DP_WINDOW -c "$PARSED_TEXT" -o "$BUILD_DIR/obj/ParsedText.full.o"
+c++ "${OBJECTS[@]}" "$BUILD_DIR/obj/ParsedText.windowed.o" -Wl,--gc-sections -o "$BUILD_DIR/LineBreakTest"
+c++ "${OBJECTS[@]}" "$BUILD_DIR/obj/ParsedText.full.o" -Wl,--gc-sections -o "$BUILD_DIR/LineBreakTestFullDp"
+
+"$BUILD_DIR/LineBreakTest" --lines "$BUILD_DIR/windowed.txt"
+"$BUILD_DIR/LineBreakTestFullDp" --lines "$BUILD_DIR/full.txt" >/dev/null
+if ! cmp -s "$BUILD_DIR/windowed.txt" "$BUILD_DIR/full.txt"; then
+  echo "FAIL: windowed line breaks differ from the full DP:"
+  diff "$BUILD_DIR/full.txt" "$BUILD_DIR/windowed.txt" | head -20
+  exit 1
+fi
+echo "OK: windowed line breaks match the full DP"
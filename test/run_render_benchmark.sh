@@ -0,0 +1,77 @@
+#!/usr/bin/env bash
+# Builds the host renderer benchmark and runs it: times the GfxRenderer primitives and checks the frames they leave
+# against src/util/RenderBenchmarkGolden.h. --update regenerates the golden hashes; --repeat N and --frames DIR are
+# passed through.
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/render_benchmark"
+BINARY="$BUILD_DIR/RenderBenchmarkTest"
+
+mkdir -p "$BUILD_DIR/obj"
+
+SOURCES=(
+  "$ROOT_DIR/test/render_benchmark/RenderBenchmarkTest.cpp"
+  "$ROOT_DIR/test/layout_benchmark/host/HostPlatform.cpp"
+  "$ROOT_DIR/src/util/RenderBenchmark.cpp"
+  "$ROOT_DIR/src/components/themes/ChromeLayerCache.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/Bitmap.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/BitmapHelpers.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/FontCacheManager.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/FontTable.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/FramePackBits.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/GfxRenderer.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFont.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFontFamily.cpp"
+  "$ROOT_DIR/lib/EpdFont/FontDecompressor.cpp"
+  "$ROOT_DIR/lib/InflateReader/InflateReader.cpp"
+  "$ROOT_DIR/lib/MemoryBudget/MemoryBudget.cpp"
+  "$ROOT_DIR/lib/Utf8/Utf8.cpp"
+)
+
+C_SOURCES=(
+  "$ROOT_DIR/lib/uzlib/src/tinflate.c"
+)
+
+DEFINES=(
+  -DCROSSPOINT_EMULATED=1
+  -DEINK_DISPLAY_SINGLE_BUFFER_MODE=1
+  -DDESTRUCTOR_CLOSES_FILE=1
+)
+
+INCLUDES=(-I"$ROOT_DIR/test/layout_benchmark/host" -I"$ROOT_DIR/src" -I"$ROOT_DIR/lib/Epub" -I"$ROOT_DIR/lib/uzlib/src")
+for dir in "$ROOT_DIR"/lib/*/; do
+  INCLUDES+=(-I"$dir")
+done
+
+CXXFLAGS=(-std=gnu++2a -O2 -fno-exceptions -ffunction-sections "${DEFINES[@]}" "${INCLUDES[@]}")
+CFLAGS=(-O2 -ffunction-sections "${DEFINES[@]}" -I"$ROOT_DIR/lib/uzlib/src")
+
+OBJECTS=()
+for src in "${C_SOURCES[@]}"; do
+  obj="$BUILD_DIR/obj/$(basename "$src").o"
+  cc "${CFLAGS[@]}" -c "$src" -o "$obj"
+  OBJECTS+=("$obj")
+done
+for src in "${SOURCES[@]}"; do
+  obj="$BUILD_DIR/obj/$(basename "$src").o"
+  c++ "${CXXFLAGS[@]}" -c "$src" -o "$obj"
+  OBJECTS+=("$obj")
+done
+c++ "${OBJECTS[@]}" -Wl,--gc-sections -o "$BINARY"
+
+OPTIONS=()
+while [[ $# -gt 0 ]]; do
+  case "$1" in
+    --update)
+      OPTIONS+=(--update "$ROOT_DIR/src/util/RenderBenchmarkGolden.h")
+      shift
+      ;;
+    *)
+      OPTIONS+=("$1")
+      shift
+      ;;
+  esac
+done
+
+"$BINARY" "${OPTIONS[@]}"